@@ -0,0 +1,141 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Benchmarks for converting repeated messages to columns with
+// util::ColumnarConverter, compared to a loop over Reflection getters, and for
+// converting them back.  The rows are google.protobuf.Field messages, which
+// mix enums, integers, a bool and strings.
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include <google/protobuf/type.pb.h>
+#include <google/protobuf/util/columnar_util.h>
+
+using google::protobuf::Field;
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Reflection;
+using google::protobuf::RepeatedPtrField;
+using google::protobuf::util::ColumnarBatch;
+using google::protobuf::util::ColumnarConverter;
+
+namespace {
+
+void MakeRows(int n, RepeatedPtrField<Field>* rows) {
+  for (int i = 0; i < n; i++) {
+    Field* row = rows->Add();
+    row->set_kind(static_cast<Field::Kind>(1 + i % 18));
+    row->set_cardinality(Field::CARDINALITY_OPTIONAL);
+    row->set_number(i + 1);
+    row->set_name("field_" + std::to_string(i));
+    if (i % 3 == 0) row->set_type_url("type.googleapis.com/Row");
+    row->set_packed(i % 2 == 0);
+    row->set_json_name("field" + std::to_string(i));
+  }
+}
+
+// Column-at-a-time export written against the Reflection API, as analytics
+// code does without ColumnarConverter.
+void BM_ExportWithReflection(benchmark::State& state) {
+  RepeatedPtrField<Field> rows;
+  MakeRows(state.range(0), &rows);
+  const Reflection* reflection = Field::default_instance().GetReflection();
+  std::vector<const FieldDescriptor*> fields;
+  for (int i = 0; i < Field::descriptor()->field_count(); i++) {
+    const FieldDescriptor* field = Field::descriptor()->field(i);
+    if (!field->is_repeated()) fields.push_back(field);
+  }
+  while (state.KeepRunning()) {
+    std::vector<std::vector<int64_t> > numbers(fields.size());
+    std::vector<std::string> strings(fields.size());
+    for (const Field& row : rows) {
+      for (size_t i = 0; i < fields.size(); i++) {
+        const FieldDescriptor* field = fields[i];
+        switch (field->cpp_type()) {
+          case FieldDescriptor::CPPTYPE_INT32:
+            numbers[i].push_back(reflection->GetInt32(row, field));
+            break;
+          case FieldDescriptor::CPPTYPE_ENUM:
+            numbers[i].push_back(reflection->GetEnumValue(row, field));
+            break;
+          case FieldDescriptor::CPPTYPE_BOOL:
+            numbers[i].push_back(reflection->GetBool(row, field));
+            break;
+          case FieldDescriptor::CPPTYPE_STRING: {
+            std::string scratch;
+            strings[i].append(
+                reflection->GetStringReference(row, field, &scratch));
+            break;
+          }
+          default:
+            break;
+        }
+      }
+    }
+    benchmark::DoNotOptimize(numbers.data());
+    benchmark::DoNotOptimize(strings.data());
+  }
+  state.SetItemsProcessed(state.iterations() * rows.size());
+}
+
+void BM_ExportWithConverter(benchmark::State& state) {
+  RepeatedPtrField<Field> rows;
+  MakeRows(state.range(0), &rows);
+  ColumnarConverter converter(Field::default_instance());
+  while (state.KeepRunning()) {
+    ColumnarBatch batch;
+    converter.AppendRows(rows, &batch);
+    benchmark::DoNotOptimize(batch.num_rows());
+  }
+  state.SetItemsProcessed(state.iterations() * rows.size());
+}
+
+void BM_ImportWithConverter(benchmark::State& state) {
+  RepeatedPtrField<Field> rows;
+  MakeRows(state.range(0), &rows);
+  ColumnarConverter converter(Field::default_instance());
+  ColumnarBatch batch;
+  converter.AppendRows(rows, &batch);
+  while (state.KeepRunning()) {
+    RepeatedPtrField<Field> result;
+    converter.ToRows(batch, &result);
+    benchmark::DoNotOptimize(result.size());
+  }
+  state.SetItemsProcessed(state.iterations() * rows.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_ExportWithReflection)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_ExportWithConverter)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_ImportWithConverter)->Arg(1000)->Arg(100000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,134 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Benchmarks for building descriptors from FileDescriptorProtos, with and
+// without DescriptorPool::TrustInputs().  The files are synthetic proto3
+// files shaped like those of a large schema registry: many messages with
+// many fields each, plus enums and reserved ranges for the validation to
+// look at.
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor.pb.h>
+
+using google::protobuf::DescriptorPool;
+using google::protobuf::DescriptorProto;
+using google::protobuf::EnumDescriptorProto;
+using google::protobuf::EnumValueDescriptorProto;
+using google::protobuf::FieldDescriptorProto;
+using google::protobuf::FileDescriptorProto;
+using google::protobuf::FileDescriptorSet;
+
+namespace {
+
+const int kFiles = 50;
+const int kMessagesPerFile = 20;
+const int kFieldsPerMessage = 50;
+const int kEnumValues = 20;
+
+FileDescriptorSet MakeFiles() {
+  FileDescriptorSet files;
+  for (int f = 0; f < kFiles; f++) {
+    FileDescriptorProto* file = files.add_file();
+    file->set_name("registry_" + std::to_string(f) + ".proto");
+    file->set_package("registry");
+    file->set_syntax("proto3");
+    if (f > 0) file->add_dependency(files.file(f - 1).name());
+    for (int m = 0; m < kMessagesPerFile; m++) {
+      const std::string suffix = std::to_string(f) + "_" + std::to_string(m);
+      EnumDescriptorProto* enm = file->add_enum_type();
+      enm->set_name("Enum" + suffix);
+      for (int i = 0; i < kEnumValues; i++) {
+        EnumValueDescriptorProto* value = enm->add_value();
+        value->set_name("ENUM" + suffix + "_VALUE_" + std::to_string(i));
+        value->set_number(i);
+      }
+
+      DescriptorProto* message = file->add_message_type();
+      message->set_name("Message" + suffix);
+      for (int i = 1; i <= kFieldsPerMessage; i++) {
+        FieldDescriptorProto* field = message->add_field();
+        field->set_name("field_" + std::to_string(i));
+        field->set_json_name("field" + std::to_string(i));
+        field->set_number(i);
+        field->set_label(FieldDescriptorProto::LABEL_OPTIONAL);
+        if (i == 1) {
+          field->set_type(FieldDescriptorProto::TYPE_ENUM);
+          field->set_type_name(".registry." + enm->name());
+        } else if (i == 2 && f > 0) {
+          field->set_type(FieldDescriptorProto::TYPE_MESSAGE);
+          field->set_type_name(".registry.Message" + std::to_string(f - 1) +
+                               "_" + std::to_string(m));
+        } else {
+          field->set_type(i % 2 ? FieldDescriptorProto::TYPE_STRING
+                                : FieldDescriptorProto::TYPE_INT64);
+        }
+      }
+      for (int i = 0; i < 5; i++) {
+        DescriptorProto::ReservedRange* range = message->add_reserved_range();
+        range->set_start(1000 + 10 * i);
+        range->set_end(1005 + 10 * i);
+        message->add_reserved_name("removed_" + std::to_string(i));
+      }
+    }
+  }
+  return files;
+}
+
+const FileDescriptorSet& Files() {
+  static const FileDescriptorSet* files = new FileDescriptorSet(MakeFiles());
+  return *files;
+}
+
+// Builds all the files in a new pool; the argument is whether the pool
+// trusts its inputs.
+void BM_BuildFiles(benchmark::State& state) {
+  const bool trusted = state.range(0);
+  int fields = 0;
+  while (state.KeepRunning()) {
+    DescriptorPool pool;
+    pool.TrustInputs(trusted);
+    for (const FileDescriptorProto& file : Files().file()) {
+      if (pool.BuildFile(file) == nullptr) {
+        state.SkipWithError("Failed to build a file.");
+        return;
+      }
+    }
+    fields += kFiles * kMessagesPerFile * kFieldsPerMessage;
+  }
+  state.SetItemsProcessed(fields);
+}
+BENCHMARK(BM_BuildFiles)->Arg(false)->Arg(true);
+
+}  // namespace
+
+BENCHMARK_MAIN();
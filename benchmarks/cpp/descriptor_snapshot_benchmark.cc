@@ -0,0 +1,130 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Startup benchmarks for a service that links many large .proto files: the
+// time from process start to the first lookup of a type, when the files come
+// from a SnapshotDescriptorDatabase compared to the EncodedDescriptorDatabase
+// that generated code registers its files with.  The files are synthetic and
+// shaped like unittest_enormous_descriptor.proto: many messages with many
+// fields each.
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/descriptor_database.h>
+#include <google/protobuf/descriptor_snapshot.h>
+
+using google::protobuf::DescriptorPool;
+using google::protobuf::DescriptorProto;
+using google::protobuf::EncodedDescriptorDatabase;
+using google::protobuf::FieldDescriptorProto;
+using google::protobuf::FileDescriptorProto;
+using google::protobuf::FileDescriptorSet;
+using google::protobuf::SnapshotDescriptorDatabase;
+
+namespace {
+
+const int kFiles = 200;
+const int kMessagesPerFile = 20;
+const int kFieldsPerMessage = 100;
+
+FileDescriptorSet MakeFiles() {
+  FileDescriptorSet files;
+  for (int f = 0; f < kFiles; f++) {
+    FileDescriptorProto* file = files.add_file();
+    file->set_name("enormous_" + std::to_string(f) + ".proto");
+    file->set_package("enormous");
+    for (int m = 0; m < kMessagesPerFile; m++) {
+      DescriptorProto* message = file->add_message_type();
+      message->set_name("Message" + std::to_string(f) + "_" +
+                        std::to_string(m));
+      for (int i = 1; i <= kFieldsPerMessage; i++) {
+        FieldDescriptorProto* field = message->add_field();
+        field->set_name("field_" + std::to_string(i));
+        field->set_number(i);
+        field->set_label(FieldDescriptorProto::LABEL_OPTIONAL);
+        field->set_type(i % 2 ? FieldDescriptorProto::TYPE_STRING
+                              : FieldDescriptorProto::TYPE_INT64);
+      }
+    }
+  }
+  return files;
+}
+
+const FileDescriptorSet& Files() {
+  static const FileDescriptorSet* files = new FileDescriptorSet(MakeFiles());
+  return *files;
+}
+
+// The type that the benchmarks look up, in the last file.
+std::string TypeName() {
+  return "enormous.Message" + std::to_string(kFiles - 1) + "_0";
+}
+
+// What AddDescriptors() does for every linked file, followed by the first
+// lookup.
+void BM_StartupFromEncodedDatabase(benchmark::State& state) {
+  std::vector<std::string> encoded;
+  for (const FileDescriptorProto& file : Files().file()) {
+    encoded.push_back(file.SerializeAsString());
+  }
+  const std::string type_name = TypeName();
+  while (state.KeepRunning()) {
+    EncodedDescriptorDatabase database;
+    for (const std::string& file : encoded) {
+      database.Add(file.data(), file.size());
+    }
+    DescriptorPool pool(&database);
+    benchmark::DoNotOptimize(pool.FindMessageTypeByName(type_name));
+  }
+}
+BENCHMARK(BM_StartupFromEncodedDatabase);
+
+// Opening an (already mapped) snapshot, followed by the first lookup.
+void BM_StartupFromSnapshot(benchmark::State& state) {
+  std::string snapshot;
+  SnapshotDescriptorDatabase::BuildSnapshot(Files(), &snapshot);
+  const std::string type_name = TypeName();
+  while (state.KeepRunning()) {
+    SnapshotDescriptorDatabase database;
+    database.Open(snapshot.data(), snapshot.size());
+    DescriptorPool pool(&database);
+    benchmark::DoNotOptimize(pool.FindMessageTypeByName(type_name));
+  }
+  state.SetBytesProcessed(state.iterations() * snapshot.size());
+}
+BENCHMARK(BM_StartupFromSnapshot);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,172 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Startup and memory benchmarks for EncodedDescriptorDatabase, the database
+// that generated code registers its files with.  The files are synthetic and
+// shaped like a large generated pool: many small files, each with a few
+// messages, an enum and an extension.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/descriptor_database.h>
+
+using google::protobuf::DescriptorProto;
+using google::protobuf::EncodedDescriptorDatabase;
+using google::protobuf::FieldDescriptorProto;
+using google::protobuf::FileDescriptorProto;
+
+namespace {
+
+// Live heap bytes and the number of allocations, tracked by the replacement
+// operator new and delete at the bottom of this file.
+std::atomic<int64_t> live_bytes(0);
+std::atomic<int64_t> allocations(0);
+
+// Room in front of every allocation to remember its size.
+const size_t kHeaderSize = alignof(std::max_align_t);
+
+const int kFiles = 20000;
+const int kMessagesPerFile = 4;
+
+const std::vector<std::string>& EncodedFiles() {
+  static const std::vector<std::string>* files = [] {
+    auto* files = new std::vector<std::string>;
+    for (int f = 0; f < kFiles; f++) {
+      FileDescriptorProto file;
+      std::string suffix = std::to_string(f);
+      file.set_name("generated/service_" + suffix + ".proto");
+      file.set_package("company.product.service_" + suffix);
+      file.add_dependency("generated/options.proto");
+      for (int m = 0; m < kMessagesPerFile; m++) {
+        DescriptorProto* message = file.add_message_type();
+        message->set_name("Message" + std::to_string(m));
+        for (int i = 1; i <= 10; i++) {
+          FieldDescriptorProto* field = message->add_field();
+          field->set_name("field_" + std::to_string(i));
+          field->set_number(i);
+          field->set_label(FieldDescriptorProto::LABEL_OPTIONAL);
+          field->set_type(FieldDescriptorProto::TYPE_INT64);
+        }
+      }
+      file.add_enum_type()->set_name("Kind");
+      FieldDescriptorProto* extension = file.add_extension();
+      extension->set_name("options_" + suffix);
+      extension->set_extendee(".company.Options");
+      extension->set_number(1000 + f);
+      extension->set_label(FieldDescriptorProto::LABEL_OPTIONAL);
+      extension->set_type(FieldDescriptorProto::TYPE_BOOL);
+      files->push_back(file.SerializeAsString());
+    }
+    return files;
+  }();
+  return *files;
+}
+
+const char kLastType[] = "company.product.service_19999.Message0";
+
+// What AddDescriptors() costs before main(), when every file is indexed as it
+// is registered.
+void BM_AddFiles(benchmark::State& state) {
+  const std::vector<std::string>& files = EncodedFiles();
+  while (state.KeepRunning()) {
+    EncodedDescriptorDatabase database;
+    for (const std::string& file : files) {
+      database.Add(file.data(), file.size());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * files.size());
+}
+BENCHMARK(BM_AddFiles);
+
+// What AddDescriptors() costs before main() now that the generated database
+// defers indexing.
+void BM_AddFilesLazily(benchmark::State& state) {
+  const std::vector<std::string>& files = EncodedFiles();
+  while (state.KeepRunning()) {
+    EncodedDescriptorDatabase database;
+    for (const std::string& file : files) {
+      database.AddLazily(file.data(), file.size());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * files.size());
+}
+BENCHMARK(BM_AddFilesLazily);
+
+// Registering every file and then looking one up, which builds the index.
+// Also reports how much heap the index holds on to afterwards, and how many
+// allocations it took to build it.
+void BM_FirstLookup(benchmark::State& state) {
+  const std::vector<std::string>& files = EncodedFiles();
+  std::string filename;
+  int64_t index_bytes = 0;
+  int64_t index_allocations = 0;
+  while (state.KeepRunning()) {
+    int64_t bytes_before = live_bytes;
+    int64_t allocations_before = allocations;
+    EncodedDescriptorDatabase database;
+    for (const std::string& file : files) {
+      database.AddLazily(file.data(), file.size());
+    }
+    benchmark::DoNotOptimize(
+        database.FindNameOfFileContainingSymbol(kLastType, &filename));
+    index_bytes = live_bytes - bytes_before;
+    index_allocations = allocations - allocations_before;
+  }
+  state.counters["index_bytes"] = index_bytes;
+  state.counters["index_allocations"] = index_allocations;
+}
+BENCHMARK(BM_FirstLookup);
+
+}  // namespace
+
+void* operator new(size_t size) {
+  char* p = static_cast<char*>(std::malloc(size + kHeaderSize));
+  if (p == NULL) throw std::bad_alloc();
+  *reinterpret_cast<size_t*>(p) = size;
+  live_bytes += size;
+  allocations++;
+  return p + kHeaderSize;
+}
+
+void operator delete(void* p) noexcept {
+  if (p == NULL) return;
+  char* start = static_cast<char*>(p) - kHeaderSize;
+  live_bytes -= *reinterpret_cast<size_t*>(start);
+  std::free(start);
+}
+
+BENCHMARK_MAIN();
@@ -0,0 +1,115 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Benchmarks for parsing messages carrying many extensions, each of which is
+// looked up in the global extension registry.  The extensions are registered
+// at startup on two extendable messages of descriptor.proto: with contiguous
+// field numbers on FieldOptions, and with sparse ones on MessageOptions.
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/wire_format_lite.h>
+
+using google::protobuf::FieldOptions;
+using google::protobuf::Message;
+using google::protobuf::MessageOptions;
+using google::protobuf::io::CodedOutputStream;
+using google::protobuf::io::StringOutputStream;
+using google::protobuf::internal::ExtensionSet;
+using google::protobuf::internal::WireFormatLite;
+
+namespace {
+
+const int kExtensions = 64;
+const int kFirstNumber = 50000;
+
+int ContiguousNumber(int i) { return kFirstNumber + i; }
+int SparseNumber(int i) { return kFirstNumber + 7 * i; }
+
+bool RegisterExtensions() {
+  for (int i = 0; i < kExtensions; i++) {
+    ExtensionSet::RegisterExtension(&FieldOptions::default_instance(),
+                                    ContiguousNumber(i),
+                                    WireFormatLite::TYPE_INT32, false, false);
+    ExtensionSet::RegisterExtension(&MessageOptions::default_instance(),
+                                    SparseNumber(i),
+                                    WireFormatLite::TYPE_INT32, false, false);
+  }
+  return true;
+}
+const bool registered = RegisterExtensions();
+
+// Returns a message setting every extension once.
+std::string MakeData(int (*number)(int)) {
+  std::string data;
+  {
+    StringOutputStream output(&data);
+    CodedOutputStream coded(&output);
+    for (int i = 0; i < kExtensions; i++) {
+      coded.WriteTag(WireFormatLite::MakeTag(number(i),
+                                             WireFormatLite::WIRETYPE_VARINT));
+      coded.WriteVarint32(i);
+    }
+  }
+  return data;
+}
+
+// Parses a message with kExtensions extensions; the argument is whether
+// their numbers are sparse.
+void BM_ParseExtensions(benchmark::State& state) {
+  const bool sparse = state.range(0);
+  FieldOptions field_options;
+  MessageOptions message_options;
+  Message* message =
+      sparse ? static_cast<Message*>(&message_options) : &field_options;
+  const std::string data = MakeData(sparse ? SparseNumber : ContiguousNumber);
+  int extensions = 0;
+  while (state.KeepRunning()) {
+    if (!message->ParseFromString(data)) {
+      state.SkipWithError("Failed to parse.");
+      return;
+    }
+    extensions += kExtensions;
+  }
+  state.SetItemsProcessed(extensions);
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          data.size());
+}
+BENCHMARK(BM_ParseExtensions)->Arg(false)->Arg(true);
+
+}  // namespace
+
+BENCHMARK_MAIN();
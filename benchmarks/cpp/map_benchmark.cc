@@ -0,0 +1,242 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Benchmarks for the hash table behind map fields.  Build the protobuf library
+// with and without GOOGLE_PROTOBUF_MAP_OPEN_ADDRESSING defined to compare the
+// two tables, and with and without GOOGLE_PROTOBUF_MAP_DENSE_INTEGER_KEYS
+// defined to compare indexing integer keys directly with always hashing them.
+// The Int benchmarks use sparse keys and the NegativeInt ones negative keys,
+// which are always hashed, so they show the cost of the dense array's
+// fallback; the DenseInt ones use keys 0..n-1, which the dense array indexes.
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include <google/protobuf/struct.pb.h>
+#include <google/protobuf/map.h>
+
+using google::protobuf::Map;
+using google::protobuf::Struct;
+
+namespace {
+
+std::vector<std::string> MakeStringKeys(int n) {
+  std::vector<std::string> keys;
+  keys.reserve(n);
+  for (int i = 0; i < n; i++) {
+    keys.push_back("key_" + std::to_string(i * 7919));
+  }
+  return keys;
+}
+
+void BM_MapInsertInt(benchmark::State& state) {
+  const int n = state.range(0);
+  while (state.KeepRunning()) {
+    Map<int32_t, int32_t> m;
+    for (int i = 0; i < n; i++) {
+      m[i * 7919] = i;
+    }
+    benchmark::DoNotOptimize(m.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+void BM_MapInsertString(benchmark::State& state) {
+  const int n = state.range(0);
+  const std::vector<std::string> keys = MakeStringKeys(n);
+  while (state.KeepRunning()) {
+    Map<std::string, int32_t> m;
+    for (int i = 0; i < n; i++) {
+      m[keys[i]] = i;
+    }
+    benchmark::DoNotOptimize(m.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+void BM_MapLookupInt(benchmark::State& state) {
+  const int n = state.range(0);
+  Map<int32_t, int32_t> m;
+  for (int i = 0; i < n; i++) {
+    m[i * 7919] = i;
+  }
+  int i = 0;
+  int64_t sum = 0;
+  while (state.KeepRunning()) {
+    // Every other lookup misses.
+    auto it = m.find((i >> 1) * 7919 + (i & 1));
+    if (it != m.end()) sum += it->second;
+    if (++i == 2 * n) i = 0;
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_MapLookupString(benchmark::State& state) {
+  const int n = state.range(0);
+  const std::vector<std::string> keys = MakeStringKeys(n);
+  Map<std::string, int32_t> m;
+  for (int i = 0; i < n; i++) {
+    m[keys[i]] = i;
+  }
+  int i = 0;
+  int64_t sum = 0;
+  while (state.KeepRunning()) {
+    auto it = m.find(keys[i]);
+    if (it != m.end()) sum += it->second;
+    if (++i == n) i = 0;
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_MapIterate(benchmark::State& state) {
+  const int n = state.range(0);
+  Map<int32_t, int32_t> m;
+  for (int i = 0; i < n; i++) {
+    m[i * 7919] = i;
+  }
+  while (state.KeepRunning()) {
+    int64_t sum = 0;
+    for (const auto& entry : m) {
+      sum += entry.second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+void BM_MapInsertDenseInt(benchmark::State& state) {
+  const int n = state.range(0);
+  while (state.KeepRunning()) {
+    Map<int32_t, int32_t> m;
+    for (int i = 0; i < n; i++) {
+      m[i] = i;
+    }
+    benchmark::DoNotOptimize(m.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+void BM_MapLookupDenseInt(benchmark::State& state) {
+  const int n = state.range(0);
+  Map<int32_t, int32_t> m;
+  for (int i = 0; i < n; i += 2) {
+    m[i] = i;
+  }
+  int i = 0;
+  int64_t sum = 0;
+  while (state.KeepRunning()) {
+    // Every other lookup misses.
+    auto it = m.find(i);
+    if (it != m.end()) sum += it->second;
+    if (++i == n) i = 0;
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_MapIterateDenseInt(benchmark::State& state) {
+  const int n = state.range(0);
+  Map<int32_t, int32_t> m;
+  for (int i = 0; i < n; i++) {
+    m[i] = i;
+  }
+  while (state.KeepRunning()) {
+    int64_t sum = 0;
+    for (const auto& entry : m) {
+      sum += entry.second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+void BM_MapInsertNegativeInt(benchmark::State& state) {
+  const int n = state.range(0);
+  while (state.KeepRunning()) {
+    Map<int32_t, int32_t> m;
+    for (int i = 0; i < n; i++) {
+      m[-1 - i] = i;
+    }
+    benchmark::DoNotOptimize(m.size());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+void BM_MapLookupNegativeInt(benchmark::State& state) {
+  const int n = state.range(0);
+  Map<int32_t, int32_t> m;
+  for (int i = 0; i < n; i += 2) {
+    m[-1 - i] = i;
+  }
+  int i = 0;
+  int64_t sum = 0;
+  while (state.KeepRunning()) {
+    // Every other lookup misses.
+    auto it = m.find(-1 - i);
+    if (it != m.end()) sum += it->second;
+    if (++i == n) i = 0;
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_MapParse(benchmark::State& state) {
+  const int n = state.range(0);
+  Struct s;
+  for (int i = 0; i < n; i++) {
+    (*s.mutable_fields())["key_" + std::to_string(i)].set_number_value(i);
+  }
+  const std::string payload = s.SerializeAsString();
+  while (state.KeepRunning()) {
+    Struct parsed;
+    parsed.ParseFromString(payload);
+    benchmark::DoNotOptimize(parsed.fields_size());
+  }
+  state.SetBytesProcessed(state.iterations() * payload.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_MapInsertInt)->Arg(10)->Arg(1000)->Arg(1000000);
+BENCHMARK(BM_MapInsertString)->Arg(10)->Arg(1000)->Arg(1000000);
+BENCHMARK(BM_MapLookupInt)->Arg(10)->Arg(1000)->Arg(1000000);
+BENCHMARK(BM_MapLookupString)->Arg(10)->Arg(1000)->Arg(1000000);
+BENCHMARK(BM_MapIterate)->Arg(10)->Arg(1000)->Arg(1000000);
+BENCHMARK(BM_MapInsertDenseInt)->Arg(10)->Arg(1000)->Arg(1000000);
+BENCHMARK(BM_MapLookupDenseInt)->Arg(10)->Arg(1000)->Arg(1000000);
+BENCHMARK(BM_MapIterateDenseInt)->Arg(10)->Arg(1000)->Arg(1000000);
+BENCHMARK(BM_MapInsertNegativeInt)->Arg(10)->Arg(1000)->Arg(1000000);
+BENCHMARK(BM_MapLookupNegativeInt)->Arg(10)->Arg(1000)->Arg(1000000);
+BENCHMARK(BM_MapParse)->Arg(10)->Arg(1000)->Arg(1000000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,85 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Benchmarks for looking up prototypes that have already been built, from one
+// thread and from many threads at once.  Before lookups stopped taking a lock
+// every thread serialized on the factory's mutex here.
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/type.pb.h>
+
+using google::protobuf::Descriptor;
+using google::protobuf::DynamicMessageFactory;
+using google::protobuf::Message;
+using google::protobuf::MessageFactory;
+
+namespace {
+
+std::vector<const Descriptor*> Types() {
+  std::vector<const Descriptor*> types;
+  types.push_back(google::protobuf::FileDescriptorProto::descriptor());
+  types.push_back(google::protobuf::DescriptorProto::descriptor());
+  types.push_back(google::protobuf::FieldDescriptorProto::descriptor());
+  types.push_back(google::protobuf::FieldOptions::descriptor());
+  types.push_back(google::protobuf::Type::descriptor());
+  types.push_back(google::protobuf::Field::descriptor());
+  return types;
+}
+
+void LookUp(MessageFactory* factory, benchmark::State& state) {
+  std::vector<const Descriptor*> types = Types();
+  for (const Descriptor* type : types) factory->GetPrototype(type);
+  while (state.KeepRunning()) {
+    for (const Descriptor* type : types) {
+      benchmark::DoNotOptimize(factory->GetPrototype(type));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * types.size());
+}
+
+void BM_GeneratedFactory(benchmark::State& state) {
+  LookUp(MessageFactory::generated_factory(), state);
+}
+BENCHMARK(BM_GeneratedFactory)->ThreadRange(1, 32)->UseRealTime();
+
+DynamicMessageFactory* dynamic_factory = new DynamicMessageFactory;
+
+void BM_DynamicFactory(benchmark::State& state) {
+  LookUp(dynamic_factory, state);
+}
+BENCHMARK(BM_DynamicFactory)->ThreadRange(1, 32)->UseRealTime();
+
+}  // namespace
+
+BENCHMARK_MAIN();
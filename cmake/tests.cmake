@@ -82,6 +82,13 @@ set(tests_protos
   google/protobuf/util/message_differencer_unittest.proto
 )
 
+# Protos compiled with extra C++ generator options.
+set(inlined_string_test_protos
+  google/protobuf/unittest_inlined_string.proto
+)
+
+# An optional second argument is prepended to --cpp_out as generator options,
+# e.g. "inline_strings:".
 macro(compile_proto_file filename)
   get_filename_component(dirname ${filename} PATH)
   get_filename_component(basename ${filename} NAME_WE)
@@ -90,7 +97,7 @@ macro(compile_proto_file filename)
     DEPENDS ${protobuf_PROTOC_EXE} ${protobuf_source_dir}/src/${dirname}/${basename}.proto
     COMMAND ${protobuf_PROTOC_EXE} ${protobuf_source_dir}/src/${dirname}/${basename}.proto
         --proto_path=${protobuf_source_dir}/src
-        --cpp_out=${protobuf_source_dir}/src
+        --cpp_out=${ARGN}${protobuf_source_dir}/src
         --experimental_allow_proto3_optional
   )
 endmacro(compile_proto_file)
@@ -110,6 +117,12 @@ foreach(proto_file ${tests_protos})
   set(tests_proto_files ${tests_proto_files}
       ${protobuf_source_dir}/src/${pb_file})
 endforeach(proto_file)
+foreach(proto_file ${inlined_string_test_protos})
+  compile_proto_file(${proto_file} inline_strings:)
+  string(REPLACE .proto .pb.cc pb_file ${proto_file})
+  set(tests_proto_files ${tests_proto_files}
+      ${protobuf_source_dir}/src/${pb_file})
+endforeach(proto_file)
 
 set(common_test_files
   ${protobuf_source_dir}/src/google/protobuf/arena_test_util.cc
@@ -148,11 +161,14 @@ set(tests_files
   ${protobuf_source_dir}/src/google/protobuf/compiler/python/python_plugin_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/compiler/ruby/ruby_generator_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/descriptor_database_unittest.cc
+  ${protobuf_source_dir}/src/google/protobuf/descriptor_snapshot_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/descriptor_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/drop_unknown_fields_test.cc
   ${protobuf_source_dir}/src/google/protobuf/dynamic_message_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/extension_set_unittest.cc
+  ${protobuf_source_dir}/src/google/protobuf/field_access_plan_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/generated_message_reflection_unittest.cc
+  ${protobuf_source_dir}/src/google/protobuf/inlined_string_field_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/io/coded_stream_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/io/io_win32_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/io/printer_unittest.cc
@@ -168,9 +184,11 @@ set(tests_files
   ${protobuf_source_dir}/src/google/protobuf/proto3_arena_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/proto3_lite_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/proto3_lite_unittest.inc
+  ${protobuf_source_dir}/src/google/protobuf/read_mostly_map_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/reflection_ops_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/repeated_field_reflection_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/repeated_field_unittest.cc
+  ${protobuf_source_dir}/src/google/protobuf/string_intern_pool_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/stubs/bytestream_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/stubs/common_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/stubs/int128_unittest.cc
@@ -184,6 +202,7 @@ set(tests_files
   ${protobuf_source_dir}/src/google/protobuf/stubs/time_test.cc
   ${protobuf_source_dir}/src/google/protobuf/text_format_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/unknown_field_set_unittest.cc
+  ${protobuf_source_dir}/src/google/protobuf/util/columnar_util_test.cc
   ${protobuf_source_dir}/src/google/protobuf/util/delimited_message_util_test.cc
   ${protobuf_source_dir}/src/google/protobuf/util/field_comparator_test.cc
   ${protobuf_source_dir}/src/google/protobuf/util/field_mask_util_test.cc
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstring>
 #include <limits>
 
 #include <google/protobuf/stubs/mutex.h>
@@ -72,6 +73,8 @@ void ArenaImpl::Init() {
       lifecycle_id_generator_.fetch_add(1, std::memory_order_relaxed);
   hint_.store(nullptr, std::memory_order_relaxed);
   threads_.store(nullptr, std::memory_order_relaxed);
+  free_lists_owner_.store(nullptr, std::memory_order_relaxed);
+  free_lists_ = NULL;
 
   if (initial_block_) {
     // Thread which calls Init() owns the first block. This allows the
@@ -331,6 +334,52 @@ ArenaImpl::SerialArena* ArenaImpl::SerialArena::New(Block* b, void* owner,
   return serial;
 }
 
+void ArenaImpl::AddToFreeList(SerialArena* serial, void* p, size_t n) {
+  GOOGLE_DCHECK_EQ(internal::AlignUpTo8(n), n);
+  if (n < sizeof(FreeBlock)) return;
+  if (free_lists_owner_.load(std::memory_order_relaxed) != serial) {
+    SerialArena* expected = NULL;
+    if (!free_lists_owner_.compare_exchange_strong(
+            expected, serial, std::memory_order_relaxed)) {
+      return;
+    }
+    const size_t size = sizeof(FreeBlock*) * kNumFreeLists;
+    free_lists_ = static_cast<FreeBlock**>(serial->AllocateAligned(size));
+    memset(free_lists_, 0, size);
+  }
+  int list = std::min<int>(Bits::Log2FloorNonZero64(n) - kMinFreeListLog2,
+                           kNumFreeLists - 1);
+  FreeBlock* block = static_cast<FreeBlock*>(p);
+  block->next = free_lists_[list];
+  block->size = n;
+  free_lists_[list] = block;
+#ifdef ADDRESS_SANITIZER
+  ASAN_POISON_MEMORY_REGION(block + 1, n - sizeof(FreeBlock));
+#endif  // ADDRESS_SANITIZER
+}
+
+void* ArenaImpl::AllocateFromFreeList(size_t n) {
+  GOOGLE_DCHECK_EQ(internal::AlignUpTo8(n), n);
+  if (n <= sizeof(FreeBlock)) n = sizeof(FreeBlock);
+  // Pieces in the list for floor(log2(n)) may be too small, while the head of
+  // any higher list fits, except in the last list, whose sizes are unbounded.
+  for (int list = std::min<int>(Bits::Log2FloorNonZero64(n) - kMinFreeListLog2,
+                                kNumFreeLists - 1);
+       list < kNumFreeLists; list++) {
+    FreeBlock** prev = &free_lists_[list];
+    while (*prev != NULL && (*prev)->size < n) prev = &(*prev)->next;
+    if (*prev != NULL) {
+      FreeBlock* block = *prev;
+      *prev = block->next;
+#ifdef ADDRESS_SANITIZER
+      ASAN_UNPOISON_MEMORY_REGION(block, block->size);
+#endif  // ADDRESS_SANITIZER
+      return block;
+    }
+  }
+  return NULL;
+}
+
 PROTOBUF_NOINLINE
 ArenaImpl::SerialArena* ArenaImpl::GetSerialArenaFallback(void* me) {
   // Look for this SerialArena in our linked list.
@@ -77,6 +77,9 @@ class Message;  // defined in message.h
 class MessageLite;
 template <typename Key, typename T>
 class Map;
+template <typename Element>
+class RepeatedField;  // defined in repeated_field.h
+class StringInternPool;  // defined in string_intern_pool.h
 
 namespace arena_metrics {
 
@@ -92,6 +95,12 @@ class EpsCopyInputStream;  // defined in parse_context.h
 
 template <typename Type>
 class GenericTypeHandler;  // defined in repeated_field.h
+class RepeatedPtrFieldBase;  // defined in repeated_field.h
+
+template <typename Key, typename T>
+class FlatInnerMap;  // defined in map.h
+template <typename Key, typename T, typename HashMap>
+class DenseInnerMap;  // defined in map.h
 
 // Templated cleanup methods.
 template <typename T>
@@ -272,6 +281,7 @@ class PROTOBUF_EXPORT PROTOBUF_ALIGNAS(8) Arena final {
   }
 
   void Init(const ArenaOptions& options) {
+    string_intern_pool_ = NULL;
     on_arena_allocation_ = options.on_arena_allocation;
     on_arena_reset_ = options.on_arena_reset;
     on_arena_destruction_ = options.on_arena_destruction;
@@ -361,15 +371,27 @@ class PROTOBUF_EXPORT PROTOBUF_ALIGNAS(8) Arena final {
   // registered with OwnDestructor() and freeing objects registered with Own().
   // Any objects allocated on this arena are unusable after this call. It also
   // returns the total space used by the arena which is the sums of the sizes
-  // of the allocated blocks. This method is not thread-safe.
+  // of the allocated blocks. The string intern pool, if any, is detached.
+  // This method is not thread-safe.
   PROTOBUF_NOINLINE uint64 Reset() {
     // Call the reset hook
     if (on_arena_reset_ != NULL) {
       on_arena_reset_(this, hooks_cookie_, impl_.SpaceAllocated());
     }
+    string_intern_pool_ = NULL;
     return impl_.Reset();
   }
 
+  // Attaches a pool that deduplicates singular string field values of
+  // messages parsed into this arena (see string_intern_pool.h). The pool must
+  // outlive those messages; creating it on this arena is the simplest way to
+  // ensure that. Pass NULL to stop interning. Not thread-safe with respect to
+  // concurrent parses.
+  void set_string_intern_pool(StringInternPool* pool) {
+    string_intern_pool_ = pool;
+  }
+  StringInternPool* string_intern_pool() const { return string_intern_pool_; }
+
   // Adds |object| to a list of heap-allocated objects to be freed with |delete|
   // when the arena is destroyed or reset.
   template <typename T>
@@ -634,6 +656,18 @@ class PROTOBUF_EXPORT PROTOBUF_ALIGNAS(8) Arena final {
     new (ptr) T(std::forward<Args>(args)...);
   }
 
+  // Constructs num_elements objects of type T in one contiguous allocation,
+  // like CreateInArenaStorage() does for each of them.  This is used to
+  // pre-allocate the elements of repeated message fields.
+  template <typename T>
+  static T* CreateArrayOfObjects(Arena* arena, size_t num_elements) {
+    T* objects = arena->CreateInternalRawArray<T>(num_elements);
+    for (size_t i = 0; i < num_elements; i++) {
+      CreateInArenaStorage(&objects[i], arena);
+    }
+    return objects;
+  }
+
   template <typename T>
   static void RegisterDestructorInternal(T* /* ptr */, Arena* /* arena */,
                                          std::true_type) {}
@@ -704,8 +738,31 @@ class PROTOBUF_EXPORT PROTOBUF_ALIGNAS(8) Arena final {
 
   void* AllocateAlignedNoHook(size_t n);
 
+  // For repeated fields, whose arrays are abandoned whenever they grow.  Such
+  // arrays are allocated with AllocateGrowableArray(), grown in place with
+  // TryGrowArrayInPlace() when they are the most recent allocation, and
+  // otherwise given back with ReturnArrayMemory() after being copied, so that
+  // later arrays can reuse the memory.
+  void* AllocateGrowableArray(size_t n) {
+    AllocHook(NULL, n);
+    return impl_.AllocateArrayAligned(internal::AlignUpTo8(n));
+  }
+  bool TryGrowArrayInPlace(void* p, size_t old_n, size_t new_n) {
+    if (!impl_.TryExtendAligned(p, internal::AlignUpTo8(old_n),
+                                internal::AlignUpTo8(new_n))) {
+      return false;
+    }
+    AllocHook(NULL, new_n - old_n);
+    return true;
+  }
+  void ReturnArrayMemory(void* p, size_t n) {
+    impl_.ReturnArrayMemory(p, internal::AlignUpTo8(n));
+  }
+
   internal::ArenaImpl impl_;
 
+  StringInternPool* string_intern_pool_;
+
   void (*on_arena_allocation_)(const std::type_info* allocated_type,
                                uint64 alloc_size, void* cookie);
   void (*on_arena_reset_)(Arena* arena, void* cookie, uint64 space_used);
@@ -723,6 +780,13 @@ class PROTOBUF_EXPORT PROTOBUF_ALIGNAS(8) Arena final {
   friend class MessageLite;
   template <typename Key, typename T>
   friend class Map;
+  template <typename Key, typename T>
+  friend class internal::FlatInnerMap;
+  template <typename Key, typename T, typename HashMap>
+  friend class internal::DenseInnerMap;
+  template <typename Element>
+  friend class RepeatedField;
+  friend class internal::RepeatedPtrFieldBase;
 };
 
 // Defined above for supporting environments without RTTI.
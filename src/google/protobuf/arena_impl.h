@@ -134,6 +134,35 @@ class PROTOBUF_EXPORT ArenaImpl {
   // Add object pointer and cleanup function pointer to the list.
   void AddCleanup(void* elem, void (*cleanup)(void*));
 
+  // Grows the allocation of old_n bytes at p to new_n bytes without moving it.
+  // This only succeeds if p is the most recent allocation of the calling
+  // thread and the rest of its block has room.
+  bool TryExtendAligned(void* p, size_t old_n, size_t new_n) {
+    SerialArena* arena;
+    return GetSerialArenaFast(&arena) && arena->TryExtend(p, old_n, new_n);
+  }
+
+  // Like AllocateAligned(), but reuses memory given back through
+  // ReturnArrayMemory() when a large enough piece is available.
+  void* AllocateArrayAligned(size_t n) {
+    SerialArena* arena = GetSerialArena();
+    if (PROTOBUF_PREDICT_FALSE(
+            free_lists_owner_.load(std::memory_order_relaxed) == arena)) {
+      void* ret = AllocateFromFreeList(n);
+      if (ret != NULL) return ret;
+    }
+    return arena->AllocateAligned(n);
+  }
+
+  // Makes n bytes at p, allocated from this arena and no longer used by
+  // anything, available to later AllocateArrayAligned() calls of the calling
+  // thread.
+  void ReturnArrayMemory(void* p, size_t n) {
+    SerialArena* arena;
+    if (!GetSerialArenaFast(&arena) || arena->TryRollback(p, n)) return;
+    AddToFreeList(arena, p, n);
+  }
+
  private:
   friend class ArenaBenchmark;
 
@@ -224,6 +253,31 @@ class PROTOBUF_EXPORT ArenaImpl {
       return ret;
     }
 
+    bool TryExtend(void* p, size_t old_n, size_t new_n) {
+      GOOGLE_DCHECK_EQ(internal::AlignUpTo8(old_n), old_n);
+      GOOGLE_DCHECK_EQ(internal::AlignUpTo8(new_n), new_n);
+      GOOGLE_DCHECK_GE(new_n, old_n);
+      if (static_cast<char*>(p) + old_n != ptr_ || !HasSpace(new_n - old_n)) {
+        return false;
+      }
+#ifdef ADDRESS_SANITIZER
+      ASAN_UNPOISON_MEMORY_REGION(ptr_, new_n - old_n);
+#endif  // ADDRESS_SANITIZER
+      ptr_ += new_n - old_n;
+      return true;
+    }
+
+    // Gives back the n bytes at p if they are the most recent allocation.
+    bool TryRollback(void* p, size_t n) {
+      GOOGLE_DCHECK_EQ(internal::AlignUpTo8(n), n);
+      if (static_cast<char*>(p) + n != ptr_) return false;
+      ptr_ = static_cast<char*>(p);
+#ifdef ADDRESS_SANITIZER
+      ASAN_POISON_MEMORY_REGION(ptr_, n);
+#endif  // ADDRESS_SANITIZER
+      return true;
+    }
+
     void* owner() const { return owner_; }
     SerialArena* next() const { return next_; }
     void set_next(SerialArena* next) { next_ = next; }
@@ -319,6 +373,20 @@ class PROTOBUF_EXPORT ArenaImpl {
     hint_.store(serial, std::memory_order_release);
   }
 
+  // Abandoned arrays are kept in free lists by size class: list i holds pieces
+  // of at least 2^(i + kMinFreeListLog2) bytes, except that the last list holds
+  // all larger pieces, too.  The lists belong to the SerialArena of the first
+  // thread that returns an array, so they need no synchronization; arrays
+  // returned by other threads are abandoned as before.
+  struct FreeBlock {
+    FreeBlock* next;
+    size_t size;
+  };
+  static const int kMinFreeListLog2 = 4;  // sizeof(FreeBlock)
+  static const int kNumFreeLists = 16;
+  void* AllocateFromFreeList(size_t n);
+  void AddToFreeList(SerialArena* serial, void* p, size_t n);
+
   std::atomic<SerialArena*>
       threads_;                     // Pointer to a linked list of SerialArena.
   std::atomic<SerialArena*> hint_;  // Fast thread-local block access
@@ -327,6 +395,11 @@ class PROTOBUF_EXPORT ArenaImpl {
   Block* initial_block_;  // If non-NULL, points to the block that came from
                           // user data.
 
+  // SerialArena whose thread owns the free lists, and their heads, allocated
+  // from that SerialArena when the first array is returned.
+  std::atomic<SerialArena*> free_lists_owner_;
+  FreeBlock** free_lists_;
+
   Block* NewBlock(Block* last_block, size_t min_bytes);
 
   SerialArena* GetSerialArena();
@@ -72,10 +72,15 @@ class TaggedPtr {
   uintptr_t ptr_;
 };
 
+// An ArenaStringPtr may also point at an interned value owned by a
+// StringInternPool (see SetInterned()). Interned values are shared between
+// fields and are marked with the low bit of the pointer; every method that
+// would modify or free the string first replaces the shared value with a
+// private copy, or simply drops the reference.
 struct PROTOBUF_EXPORT ArenaStringPtr {
   inline void Set(const ::std::string* default_value,
                   const ::std::string& value, Arena* arena) {
-    if (ptr_ == default_value) {
+    if (ptr_ == default_value || IsInterned()) {
       CreateInstance(arena, &value);
     } else {
       *ptr_ = value;
@@ -88,12 +93,12 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
   }
 
   // Basic accessors.
-  inline const ::std::string& Get() const { return *ptr_; }
+  inline const ::std::string& Get() const { return *UntaggedPtr(); }
 
   inline ::std::string* Mutable(const ::std::string* default_value,
                                 Arena* arena) {
-    if (ptr_ == default_value) {
-      CreateInstance(arena, default_value);
+    if (ptr_ == default_value || IsInterned()) {
+      CreateInstance(arena, &Get());
     }
     return ptr_;
   }
@@ -115,7 +120,9 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
                                           Arena* arena) {
     GOOGLE_DCHECK(!IsDefault(default_value));
     ::std::string* released = NULL;
-    if (arena != NULL) {
+    if (IsInterned()) {
+      released = new ::std::string(Get());
+    } else if (arena != NULL) {
       // ptr_ is owned by the arena.
       released = new ::std::string;
       released->swap(*ptr_);
@@ -132,11 +139,12 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
   // NULL state. Used to implement unsafe_arena_release_<field>() methods on
   // generated classes.
   inline ::std::string* UnsafeArenaRelease(const ::std::string* default_value,
-                                           Arena* /* arena */) {
+                                           Arena* arena) {
     if (ptr_ == default_value) {
       return NULL;
     }
-    ::std::string* released = ptr_;
+    ::std::string* released =
+        IsInterned() ? Arena::Create< ::std::string>(arena, Get()) : ptr_;
     ptr_ = const_cast< ::std::string*>(default_value);
     return released;
   }
@@ -208,7 +216,7 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
 
   // Frees storage (if not on an arena).
   inline void Destroy(const ::std::string* default_value, Arena* arena) {
-    if (arena == NULL && ptr_ != default_value) {
+    if (arena == NULL && ptr_ != default_value && !IsInterned()) {
       delete ptr_;
     }
   }
@@ -221,6 +229,8 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
                            Arena* /* arena */) {
     if (ptr_ == default_value) {
       // Already set to default (which is empty) -- do nothing.
+    } else if (IsInterned()) {
+      ptr_ = const_cast< ::std::string*>(default_value);
     } else {
       ptr_->clear();
     }
@@ -228,8 +238,14 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
 
   // Clears content, assuming that the current value is not the empty string
   // default.
-  inline void ClearNonDefaultToEmpty() { ptr_->clear(); }
-  inline void ClearNonDefaultToEmptyNoArena() { ptr_->clear(); }
+  inline void ClearNonDefaultToEmpty() {
+    if (PROTOBUF_PREDICT_FALSE(IsInterned())) {
+      ClearInternedToEmpty();
+    } else {
+      ptr_->clear();
+    }
+  }
+  inline void ClearNonDefaultToEmptyNoArena() { ClearNonDefaultToEmpty(); }
 
   // Clears content, but keeps allocated string if arena != NULL, to avoid the
   // overhead of heap operations. After this returns, the content (as seen by
@@ -238,6 +254,8 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
                              Arena* /* arena */) {
     if (ptr_ == default_value) {
       // Already set to default -- do nothing.
+    } else if (IsInterned()) {
+      ptr_ = const_cast< ::std::string*>(default_value);
     } else {
       // Have another allocated string -- rather than throwing this away and
       // resetting ptr_ to the canonical default string instance, we just reuse
@@ -266,7 +284,7 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
   // tagged-pointer manipulations to be avoided.
   inline void SetNoArena(const ::std::string* default_value,
                          const ::std::string& value) {
-    if (ptr_ == default_value) {
+    if (ptr_ == default_value || IsInterned()) {
       CreateInstanceNoArena(&value);
     } else {
       *ptr_ = value;
@@ -274,7 +292,7 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
   }
 
   void SetNoArena(const ::std::string* default_value, ::std::string&& value) {
-    if (IsDefault(default_value)) {
+    if (IsDefault(default_value) || IsInterned()) {
       ptr_ = new ::std::string(std::move(value));
     } else {
       *ptr_ = std::move(value);
@@ -284,11 +302,11 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
   void AssignWithDefault(const ::std::string* default_value,
                          ArenaStringPtr value);
 
-  inline const ::std::string& GetNoArena() const { return *ptr_; }
+  inline const ::std::string& GetNoArena() const { return Get(); }
 
   inline ::std::string* MutableNoArena(const ::std::string* default_value) {
-    if (ptr_ == default_value) {
-      CreateInstanceNoArena(default_value);
+    if (ptr_ == default_value || IsInterned()) {
+      CreateInstanceNoArena(&Get());
     }
     return ptr_;
   }
@@ -304,16 +322,15 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
   inline ::std::string* ReleaseNonDefaultNoArena(
       const ::std::string* default_value) {
     GOOGLE_DCHECK(!IsDefault(default_value));
-    ::std::string* released = ptr_;
+    ::std::string* released =
+        IsInterned() ? new ::std::string(Get()) : ptr_;
     ptr_ = const_cast< ::std::string*>(default_value);
     return released;
   }
 
   inline void SetAllocatedNoArena(const ::std::string* default_value,
                                   ::std::string* value) {
-    if (ptr_ != default_value) {
-      delete ptr_;
-    }
+    DestroyNoArena(default_value);
     if (value != NULL) {
       ptr_ = value;
     } else {
@@ -322,7 +339,7 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
   }
 
   inline void DestroyNoArena(const ::std::string* default_value) {
-    if (ptr_ != default_value) {
+    if (ptr_ != default_value && !IsInterned()) {
       delete ptr_;
     }
   }
@@ -330,6 +347,8 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
   inline void ClearToEmptyNoArena(const ::std::string* default_value) {
     if (ptr_ == default_value) {
       // Nothing: already equal to default (which is the empty string).
+    } else if (IsInterned()) {
+      ptr_ = const_cast< ::std::string*>(default_value);
     } else {
       ptr_->clear();
     }
@@ -338,6 +357,8 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
   inline void ClearToDefaultNoArena(const ::std::string* default_value) {
     if (ptr_ == default_value) {
       // Nothing: already set to default.
+    } else if (IsInterned()) {
+      ptr_ = const_cast< ::std::string*>(default_value);
     } else {
       // Reuse existing allocated instance.
       *ptr_ = *default_value;
@@ -354,6 +375,22 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
     return ptr_ == default_value;
   }
 
+  // Points this field at |value|, an interned string owned by a
+  // StringInternPool, releasing the current value. The pool must outlive the
+  // message. The field never modifies or frees |value|; mutating accessors
+  // replace it with a private copy first.
+  inline void SetInterned(const ::std::string* default_value,
+                          const ::std::string* value, Arena* arena) {
+    Destroy(default_value, arena);
+    ptr_ = reinterpret_cast< ::std::string*>(
+        reinterpret_cast<uintptr_t>(value) | kInternedBit);
+  }
+
+  // Returns true if the field currently shares an interned value.
+  inline bool IsInterned() const {
+    return (reinterpret_cast<uintptr_t>(ptr_) & kInternedBit) != 0;
+  }
+
   // Internal accessors!!!!
   void UnsafeSetTaggedPointer(TaggedPtr< ::std::string> value) {
     ptr_ = value.Get();
@@ -361,11 +398,25 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
   // Generated code only! An optimization, in certain cases the generated
   // code is certain we can obtain a string with no default checks and
   // tag tests.
-  ::std::string* UnsafeMutablePointer() { return ptr_; }
+  ::std::string* UnsafeMutablePointer() {
+    GOOGLE_DCHECK(!IsInterned());
+    return ptr_;
+  }
 
  private:
+  enum : uintptr_t { kInternedBit = 1 };
+
   ::std::string* ptr_;
 
+  ::std::string* UntaggedPtr() const {
+    return reinterpret_cast< ::std::string*>(
+        reinterpret_cast<uintptr_t>(ptr_) &
+        ~static_cast<uintptr_t>(kInternedBit));
+  }
+
+  // Out of line to avoid a dependency on message_lite.h for the empty string.
+  void ClearInternedToEmpty();
+
   PROTOBUF_NOINLINE
   void CreateInstance(Arena* arena, const ::std::string* initial_value) {
     GOOGLE_DCHECK(initial_value != NULL);
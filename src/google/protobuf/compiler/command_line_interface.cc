@@ -52,6 +52,7 @@
 #include <ctype.h>
 #include <errno.h>
 #include <fstream>
+#include <functional>
 #include <iostream>
 
 #include <limits.h>  //For PATH_MAX
@@ -74,6 +75,7 @@
 #include <google/protobuf/io/printer.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor_snapshot.h>
 #include <google/protobuf/dynamic_message.h>
 #include <google/protobuf/text_format.h>
 #include <google/protobuf/stubs/strutil.h>
@@ -270,6 +272,39 @@ std::string PluginName(const std::string& plugin_prefix,
   return plugin_prefix + "gen-" + directive.substr(2, directive.size() - 6);
 }
 
+// Creates or truncates the file at filename and fills it using write, which
+// returns false on failure.  Errors are reported to stderr.
+bool WriteOutputFile(const std::string& filename,
+                     const std::function<bool(io::CodedOutputStream*)>& write) {
+  int fd;
+  do {
+    fd = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, 0666);
+  } while (fd < 0 && errno == EINTR);
+
+  if (fd < 0) {
+    perror(filename.c_str());
+    return false;
+  }
+
+  io::FileOutputStream out(fd);
+
+  {
+    io::CodedOutputStream coded_out(&out);
+    if (!write(&coded_out)) {
+      std::cerr << filename << ": " << strerror(out.GetErrno()) << std::endl;
+      out.Close();
+      return false;
+    }
+  }
+
+  if (!out.Close()) {
+    std::cerr << filename << ": " << strerror(out.GetErrno()) << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
 }  // namespace
 
 // A MultiFileErrorCollector that prints errors to stderr.
@@ -996,6 +1031,12 @@ int CommandLineInterface::Run(int argc, const char* const argv[]) {
     }
   }
 
+  if (!descriptor_snapshot_out_name_.empty()) {
+    if (!WriteDescriptorSnapshot(parsed_files)) {
+      return 1;
+    }
+  }
+
   if (mode_ == MODE_ENCODE || mode_ == MODE_DECODE) {
     if (codec_type_.empty()) {
       // HACK:  Define an EmptyMessage type to use for decoding.
@@ -1224,6 +1265,7 @@ void CommandLineInterface::Clear() {
   codec_type_.clear();
   descriptor_set_in_names_.clear();
   descriptor_set_out_name_.clear();
+  descriptor_snapshot_out_name_.clear();
   dependency_out_name_.clear();
 
 
@@ -1433,7 +1475,8 @@ CommandLineInterface::ParseArgumentStatus CommandLineInterface::ParseArguments(
     return PARSE_ARGUMENT_FAIL;
   }
   if (mode_ == MODE_COMPILE && output_directives_.empty() &&
-      descriptor_set_out_name_.empty()) {
+      descriptor_set_out_name_.empty() &&
+      descriptor_snapshot_out_name_.empty()) {
     std::cerr << "Missing output directives." << std::endl;
     return PARSE_ARGUMENT_FAIL;
   }
@@ -1672,6 +1715,24 @@ CommandLineInterface::InterpretArgument(const std::string& name,
     }
     descriptor_set_out_name_ = value;
 
+  } else if (name == "--descriptor_snapshot_out") {
+    if (!descriptor_snapshot_out_name_.empty()) {
+      std::cerr << name << " may only be passed once." << std::endl;
+      return PARSE_ARGUMENT_FAIL;
+    }
+    if (value.empty()) {
+      std::cerr << name << " requires a non-empty value." << std::endl;
+      return PARSE_ARGUMENT_FAIL;
+    }
+    if (mode_ != MODE_COMPILE) {
+      std::cerr
+          << "Cannot use --encode or --decode and generate descriptors at the "
+             "same time."
+          << std::endl;
+      return PARSE_ARGUMENT_FAIL;
+    }
+    descriptor_snapshot_out_name_ = value;
+
   } else if (name == "--dependency_out") {
     if (!dependency_out_name_.empty()) {
       std::cerr << name << " may only be passed once." << std::endl;
@@ -1944,6 +2005,15 @@ void CommandLineInterface::PrintHelpText() {
          "                              location of each decl in the source "
          "file as\n"
          "                              well as surrounding comments.\n"
+         "  --descriptor_snapshot_out=FILE\n"
+         "                              Writes a descriptor snapshot (see\n"
+         "                              google/protobuf/descriptor_snapshot.h) "
+         "of the\n"
+         "                              input files and all of their "
+         "dependencies to\n"
+         "                              FILE. With --descriptor_set_in, this "
+         "converts\n"
+         "                              a FileDescriptorSet to a snapshot.\n"
          "  --dependency_out=FILE       Write a dependency output file in the "
          "format\n"
          "                              expected by make. This writes the "
@@ -2347,39 +2417,39 @@ bool CommandLineInterface::WriteDescriptorSet(
                               file_set.mutable_file());
   }
 
-  int fd;
-  do {
-    fd = open(descriptor_set_out_name_.c_str(),
-              O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, 0666);
-  } while (fd < 0 && errno == EINTR);
-
-  if (fd < 0) {
-    perror(descriptor_set_out_name_.c_str());
-    return false;
-  }
-
-  io::FileOutputStream out(fd);
+  return WriteOutputFile(
+      descriptor_set_out_name_, [&file_set](io::CodedOutputStream* coded_out) {
+        // Determinism is useful here because build outputs are sometimes
+        // checked into version control.
+        coded_out->SetSerializationDeterministic(true);
+        return file_set.SerializeToCodedStream(coded_out);
+      });
+}
 
-  {
-    io::CodedOutputStream coded_out(&out);
-    // Determinism is useful here because build outputs are sometimes checked
-    // into version control.
-    coded_out.SetSerializationDeterministic(true);
-    if (!file_set.SerializeToCodedStream(&coded_out)) {
-      std::cerr << descriptor_set_out_name_ << ": " << strerror(out.GetErrno())
-                << std::endl;
-      out.Close();
-      return false;
-    }
+bool CommandLineInterface::WriteDescriptorSnapshot(
+    const std::vector<const FileDescriptor*>& parsed_files) {
+  // A snapshot must be self-contained, so it always includes the imports.
+  FileDescriptorSet file_set;
+  std::set<const FileDescriptor*> already_seen;
+  for (int i = 0; i < parsed_files.size(); i++) {
+    GetTransitiveDependencies(parsed_files[i],
+                              true,   // Include json_name
+                              false,  // Exclude source_code_info
+                              &already_seen, file_set.mutable_file());
   }
 
-  if (!out.Close()) {
-    std::cerr << descriptor_set_out_name_ << ": " << strerror(out.GetErrno())
-              << std::endl;
+  std::string snapshot;
+  if (!SnapshotDescriptorDatabase::BuildSnapshot(file_set, &snapshot)) {
+    std::cerr << descriptor_snapshot_out_name_
+              << ": Could not build the descriptor snapshot." << std::endl;
     return false;
   }
 
-  return true;
+  return WriteOutputFile(descriptor_snapshot_out_name_,
+                         [&snapshot](io::CodedOutputStream* coded_out) {
+                           coded_out->WriteString(snapshot);
+                           return !coded_out->HadError();
+                         });
 }
 
 void CommandLineInterface::GetTransitiveDependencies(
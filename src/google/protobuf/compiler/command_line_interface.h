@@ -302,6 +302,10 @@ class PROTOC_EXPORT CommandLineInterface {
   bool WriteDescriptorSet(
       const std::vector<const FileDescriptor*>& parsed_files);
 
+  // Implements the --descriptor_snapshot_out option.
+  bool WriteDescriptorSnapshot(
+      const std::vector<const FileDescriptor*>& parsed_files);
+
   // Implements the --dependency_out option
   bool GenerateDependencyManifestFile(
       const std::vector<const FileDescriptor*>& parsed_files,
@@ -432,6 +436,11 @@ class PROTOC_EXPORT CommandLineInterface {
   // FileDescriptorSet should be written.  Otherwise, empty.
   std::string descriptor_set_out_name_;
 
+  // If --descriptor_snapshot_out was given, this is the filename to which the
+  // descriptor snapshot (see descriptor_snapshot.h) of the input files and
+  // their transitive dependencies should be written.  Otherwise, empty.
+  std::string descriptor_snapshot_out_name_;
+
   // If --dependency_out was given, this is the path to the file where the
   // dependency file will be written. Otherwise, empty.
   std::string dependency_out_name_;
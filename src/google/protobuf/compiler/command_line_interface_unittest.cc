@@ -57,6 +57,7 @@
 #include <google/protobuf/io/zero_copy_stream.h>
 #include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor_snapshot.h>
 #include <google/protobuf/testing/googletest.h>
 #include <gtest/gtest.h>
 #include <google/protobuf/stubs/substitute.h>
@@ -202,6 +203,9 @@ class CommandLineInterfaceTest : public testing::Test {
   void WriteDescriptorSet(const std::string& filename,
                           const FileDescriptorSet* descriptor_set);
 
+  void OpenDescriptorSnapshot(const std::string& filename,
+                              SnapshotDescriptorDatabase* database);
+
   void ExpectFileContent(const std::string& filename,
                          const std::string& content);
 
@@ -494,6 +498,14 @@ void CommandLineInterfaceTest::ReadDescriptorSet(
   }
 }
 
+void CommandLineInterfaceTest::OpenDescriptorSnapshot(
+    const std::string& filename, SnapshotDescriptorDatabase* database) {
+  std::string path = temp_directory_ + "/" + filename;
+  if (!database->OpenFile(path)) {
+    FAIL() << "Could not open descriptor snapshot: " << path;
+  }
+}
+
 void CommandLineInterfaceTest::WriteDescriptorSet(
     const std::string& filename, const FileDescriptorSet* descriptor_set) {
   std::string binary_proto;
@@ -1536,6 +1548,35 @@ TEST_F(CommandLineInterfaceTest, WriteDescriptorSet) {
   EXPECT_TRUE(descriptor_set.file(0).message_type(0).field(0).has_json_name());
 }
 
+TEST_F(CommandLineInterfaceTest, WriteDescriptorSnapshot) {
+  CreateTempFile("foo.proto",
+                 "syntax = \"proto2\";\n"
+                 "message Foo {}\n");
+  CreateTempFile("bar.proto",
+                 "syntax = \"proto2\";\n"
+                 "import \"foo.proto\";\n"
+                 "message Bar {\n"
+                 "  optional Foo foo = 1;\n"
+                 "}\n");
+
+  Run("protocol_compiler --descriptor_snapshot_out=$tmpdir/snapshot "
+      "--proto_path=$tmpdir bar.proto");
+
+  ExpectNoErrors();
+
+  // The snapshot includes the imports, so a pool can build Bar from it.
+  SnapshotDescriptorDatabase database;
+  OpenDescriptorSnapshot("snapshot", &database);
+  if (HasFatalFailure()) return;
+  std::vector<std::string> names;
+  ASSERT_TRUE(database.FindAllFileNames(&names));
+  EXPECT_EQ(2, names.size());
+  DescriptorPool pool(&database);
+  const Descriptor* bar = pool.FindMessageTypeByName("Bar");
+  ASSERT_TRUE(bar != nullptr);
+  EXPECT_EQ("Foo", bar->field(0)->message_type()->full_name());
+}
+
 TEST_F(CommandLineInterfaceTest, WriteDescriptorSetWithDuplicates) {
   CreateTempFile("foo.proto",
                  "syntax = \"proto2\";\n"
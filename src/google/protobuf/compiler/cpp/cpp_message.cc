@@ -3393,12 +3393,110 @@ void MessageGenerator::GenerateCopyFrom(io::Printer* printer) {
   } else {
     format("Clear();\n");
   }
-  format("MergeFrom(from);\n");
+  if (CanUseFastCopyFrom()) {
+    GenerateFastCopyFromBody(printer);
+  } else {
+    format("MergeFrom(from);\n");
+  }
 
   format.Outdent();
   format("}\n");
 }
 
+bool MessageGenerator::CanUseFastCopyFrom() const {
+  if (num_weak_fields_ > 0 ||
+      UsingImplicitWeakFields(descriptor_->file(), options_)) {
+    return false;
+  }
+  // The layout helper groups the primitive fields together, so there is
+  // usually a single run of them.  Only bother if it can be copied with a
+  // memcpy, i.e. it has more than one field.
+  const RunMap runs = FindRuns(optimized_order_, IsPOD);
+  for (const auto& run : runs) {
+    if (run.second > 1) return true;
+  }
+  return false;
+}
+
+void MessageGenerator::GenerateFastCopyFromBody(io::Printer* printer) {
+  // Called after Clear().  Primitive fields hold their default value whenever
+  // their hasbit is clear, so they can be copied as raw bytes together with
+  // the hasbits; only the remaining fields need to be merged one by one.
+  Formatter format(printer, variables_);
+  std::map<std::string, std::string> vars;
+  SetUnknkownFieldsVariable(descriptor_, options_, &vars);
+  format.AddMap(vars);
+
+  if (descriptor_->extension_range_count() > 0) {
+    format("_extensions_.MergeFrom(from._extensions_);\n");
+  }
+  format(
+      "_internal_metadata_.MergeFrom<$unknown_fields_type$>(from._internal_"
+      "metadata_);\n");
+  if (!has_bit_indices_.empty()) {
+    format("_has_bits_ = from._has_bits_;\n");
+  }
+
+  const RunMap runs = FindRuns(optimized_order_, IsPOD);
+  for (int i = 0; i < optimized_order_.size(); ++i) {
+    const FieldDescriptor* field = optimized_order_[i];
+    const FieldGenerator& generator = field_generators_.get(field);
+    const auto it = runs.find(field);
+
+    if (it != runs.end() && it->second > 1) {
+      const size_t run_length = it->second;
+      format(
+          "::memcpy(&$1$_, &from.$1$_,\n"
+          "  static_cast<size_t>(reinterpret_cast<char*>(&$2$_) -\n"
+          "  reinterpret_cast<char*>(&$1$_)) + sizeof($2$_));\n",
+          FieldName(field), FieldName(optimized_order_[i + run_length - 1]));
+      i += run_length - 1;
+      // ++i at the top of the loop.
+    } else if (IsPOD(field)) {
+      generator.GenerateCopyConstructorCode(printer);
+    } else if (field->is_repeated()) {
+      generator.GenerateMergingCode(printer);
+    } else if (!HasHasbit(field)) {
+      bool have_enclosing_if =
+          EmitFieldNonDefaultCondition(printer, "from.", field);
+      generator.GenerateMergingCode(printer);
+      if (have_enclosing_if) {
+        format.Outdent();
+        format("}\n");
+      }
+    } else {
+      format("if (from._internal_has_$1$()) {\n", FieldName(field));
+      format.Indent();
+      generator.GenerateMergingCode(printer);
+      format.Outdent();
+      format("}\n");
+    }
+  }
+
+  // Copy oneof fields. Oneof field requires oneof case check.
+  for (auto oneof : OneOfRange(descriptor_)) {
+    format("switch (from.$1$_case()) {\n", oneof->name());
+    format.Indent();
+    for (auto field : FieldRange(oneof)) {
+      format("case k$1$: {\n", UnderscoresToCamelCase(field->name(), true));
+      format.Indent();
+      if (IsFieldUsed(field, options_)) {
+        field_generators_.get(field).GenerateMergingCode(printer);
+      }
+      format("break;\n");
+      format.Outdent();
+      format("}\n");
+    }
+    format(
+        "case $1$_NOT_SET: {\n"
+        "  break;\n"
+        "}\n",
+        ToUpper(oneof->name()));
+    format.Outdent();
+    format("}\n");
+  }
+}
+
 void MessageGenerator::GenerateMergeFromCodedStream(io::Printer* printer) {
   std::map<std::string, std::string> vars = variables_;
   SetUnknkownFieldsVariable(descriptor_, options_, &vars);
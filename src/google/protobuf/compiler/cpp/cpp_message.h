@@ -146,6 +146,10 @@ class MessageGenerator {
   void GenerateMergeFrom(io::Printer* printer);
   void GenerateClassSpecificMergeFrom(io::Printer* printer);
   void GenerateCopyFrom(io::Printer* printer);
+  // Whether CopyFrom() can copy the primitive fields and hasbits as raw
+  // bytes instead of going through MergeFrom().
+  bool CanUseFastCopyFrom() const;
+  void GenerateFastCopyFromBody(io::Printer* printer);
   void GenerateSwap(io::Printer* printer);
   void GenerateIsInitialized(io::Printer* printer);
 
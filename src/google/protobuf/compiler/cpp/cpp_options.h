@@ -64,6 +64,7 @@ struct Options {
   bool opensource_runtime = false;
   bool annotate_accessor = false;
   bool unused_field_stripping = false;
+  bool inline_strings = false;
   std::string runtime_include_base;
   int num_cc_files = 0;
   std::string annotation_pragma_name;
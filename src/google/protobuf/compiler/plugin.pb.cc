@@ -359,9 +359,10 @@ const char* Version::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
       // optional string suffix = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          auto str = _internal_mutable_suffix();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_suffix(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&suffix_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &suffix_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.compiler.Version.suffix");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -532,7 +533,14 @@ void Version::CopyFrom(const Version& from) {
 // @@protoc_insertion_point(class_specific_copy_from_start:google.protobuf.compiler.Version)
   if (&from == this) return;
   Clear();
-  MergeFrom(from);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  if (from._internal_has_suffix()) {
+    _internal_set_suffix(from._internal_suffix());
+  }
+  ::memcpy(&major_, &from.major_,
+    static_cast<size_t>(reinterpret_cast<char*>(&patch_) -
+    reinterpret_cast<char*>(&major_)) + sizeof(patch_));
 }
 
 bool Version::IsInitialized() const {
@@ -692,9 +700,10 @@ const char* CodeGeneratorRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // optional string parameter = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_parameter();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_parameter(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&parameter_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &parameter_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.compiler.CodeGeneratorRequest.parameter");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -711,6 +720,8 @@ const char* CodeGeneratorRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       case 15:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
           ptr -= 1;
+          proto_file_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<122>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_proto_file(), ptr);
@@ -1026,9 +1037,10 @@ const char* CodeGeneratorResponse_File::_InternalParse(const char* ptr, ::PROTOB
       // optional string name = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_name(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &name_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.compiler.CodeGeneratorResponse.File.name");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -1037,9 +1049,10 @@ const char* CodeGeneratorResponse_File::_InternalParse(const char* ptr, ::PROTOB
       // optional string insertion_point = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_insertion_point();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_insertion_point(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&insertion_point_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &insertion_point_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.compiler.CodeGeneratorResponse.File.insertion_point");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -1048,9 +1061,10 @@ const char* CodeGeneratorResponse_File::_InternalParse(const char* ptr, ::PROTOB
       // optional string content = 15;
       case 15:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
-          auto str = _internal_mutable_content();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_content(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&content_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &content_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.compiler.CodeGeneratorResponse.File.content");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -1329,9 +1343,10 @@ const char* CodeGeneratorResponse::_InternalParse(const char* ptr, ::PROTOBUF_NA
       // optional string error = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_error();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_error(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&error_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &error_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.compiler.CodeGeneratorResponse.error");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -1349,6 +1364,8 @@ const char* CodeGeneratorResponse::_InternalParse(const char* ptr, ::PROTOBUF_NA
       case 15:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
           ptr -= 1;
+          file_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<122>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_file(), ptr);
@@ -41,6 +41,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -56,6 +57,7 @@
 #include <google/protobuf/descriptor_database.h>
 #include <google/protobuf/dynamic_message.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/read_mostly_map.h>
 #include <google/protobuf/text_format.h>
 #include <google/protobuf/unknown_field_set.h>
 #include <google/protobuf/wire_format.h>
@@ -571,6 +573,11 @@ class DescriptorPool::Tables {
   // so the overhead is small.
   HASH_MAP<std::string, Descriptor::WellKnownType> well_known_types_;
 
+  // Whether committed symbols and files are also entered into the indexes
+  // used by FindPublishedSymbol() and FindPublishedFile().  Set for pools
+  // with a mutex; other pools do not pay for the extra memory.
+  bool publish_for_lock_free_lookup_;
+
   // -----------------------------------------------------------------
   // Finding items.
 
@@ -586,6 +593,12 @@ class DescriptorPool::Tables {
 
   // These return nullptr if not found.
   inline const FileDescriptor* FindFile(StringPiece key) const;
+
+  // Like FindSymbol() and FindFile(), but only see what has been committed
+  // (see ClearLastCheckpoint()).  They take no lock and may be called while
+  // another thread is building files into the pool.
+  inline Symbol FindPublishedSymbol(StringPiece key) const;
+  inline const FileDescriptor* FindPublishedFile(StringPiece key) const;
   inline const FieldDescriptor* FindExtension(const Descriptor* extendee,
                                               int number) const;
   inline void FindAllExtensions(const Descriptor* extendee,
@@ -624,6 +637,36 @@ class DescriptorPool::Tables {
   // Allocate empty string which will be destroyed when the pool is destroyed.
   std::string* AllocateEmptyString();
 
+  // Returns a string with the given value that will be destroyed when the
+  // pool is destroyed, shared with every other caller asking for the same
+  // value.  Used for short names (e.g. of fields) which repeat a lot across
+  // a pool; the result must never be modified.
+  const std::string* AllocateInternedString(StringPiece value);
+
+  // Options are identified by a key: the name of their type, a NUL and their
+  // serialized form.  Returns the pool's copy of `key`, which lives as long
+  // as the pool, or null if neither AllocateOptionsKey() nor InternOptions()
+  // was called with it.
+  const std::string* FindOptionsKey(const std::string& key) const;
+  // Returns the pool's copy of `key`, adding it if needed.
+  const std::string* AllocateOptionsKey(const std::string& key);
+  // Returns the options passed to InternOptions() with `key`, or null.
+  const Message* FindInternedOptions(const std::string& key) const;
+  // Allows `options` to be shared by descriptors with identical options.  It
+  // must not be modified afterwards.
+  void InternOptions(const std::string& key, const Message* options);
+
+  // Records that `file` has been built, which is what SpaceUsedLong()
+  // attributes the memory allocated since the last checkpoint to.  Must be
+  // called before clearing that checkpoint.
+  void RecordFileAllocations(const FileDescriptor* file);
+
+  // Implements DescriptorPool::SpaceUsedLong().  Takes the tables by pointer
+  // and a lock for them, since the options messages must be measured without
+  // holding it.
+  static size_t SpaceUsedLong(const Tables* tables, internal::WrappedMutex* mu,
+                              std::map<std::string, size_t>* by_file);
+
   // Allocate a internal::call_once which will be destroyed when the pool is
   // destroyed.
   internal::once_flag* AllocateOnceDynamic();
@@ -651,6 +694,23 @@ class DescriptorPool::Tables {
   FilesByNameMap files_by_name_;
   ExtensionsGroupedByDescriptorMap extensions_;
 
+  // See AllocateInternedString() and InternOptions().  The string keys point
+  // to the interned strings themselves.  Options keys without options yet
+  // map to null.
+  std::unordered_map<StringPiece, const std::string*, hash<StringPiece>>
+      interned_strings_;
+  std::unordered_map<std::string, const Message*> interned_options_;
+
+  // Committed symbols and files, for lookups that take no lock.  Entries are
+  // added when the last checkpoint is cleared, by the thread holding the
+  // pool's mutex, and never removed.  The keys point to the same strings as
+  // those of symbols_by_name_ and files_by_name_.
+  internal::ReadMostlyMap<StringPiece, Symbol, hash<StringPiece>>
+      published_symbols_;
+  internal::ReadMostlyMap<StringPiece, const FileDescriptor*,
+                          hash<StringPiece>>
+      published_files_;
+
   struct CheckPoint {
     explicit CheckPoint(const Tables* tables)
         : strings_before_checkpoint(tables->strings_.size()),
@@ -663,7 +723,13 @@ class DescriptorPool::Tables {
           pending_files_before_checkpoint(
               tables->files_after_checkpoint_.size()),
           pending_extensions_before_checkpoint(
-              tables->extensions_after_checkpoint_.size()) {}
+              tables->extensions_after_checkpoint_.size()),
+          pending_interned_strings_before_checkpoint(
+              tables->interned_strings_after_checkpoint_.size()),
+          pending_interned_options_before_checkpoint(
+              tables->interned_options_after_checkpoint_.size()),
+          file_allocations_before_checkpoint(
+              tables->file_allocations_.size()) {}
     int strings_before_checkpoint;
     int messages_before_checkpoint;
     int once_dynamics_before_checkpoint;
@@ -672,11 +738,33 @@ class DescriptorPool::Tables {
     int pending_symbols_before_checkpoint;
     int pending_files_before_checkpoint;
     int pending_extensions_before_checkpoint;
+    int pending_interned_strings_before_checkpoint;
+    int pending_interned_options_before_checkpoint;
+    int file_allocations_before_checkpoint;
   };
   std::vector<CheckPoint> checkpoints_;
   std::vector<const char*> symbols_after_checkpoint_;
   std::vector<const char*> files_after_checkpoint_;
   std::vector<DescriptorIntPair> extensions_after_checkpoint_;
+  std::vector<const std::string*> interned_strings_after_checkpoint_;
+  // The options keys added, with true, or given options, with false.
+  std::vector<std::pair<const std::string*, bool>>
+      interned_options_after_checkpoint_;
+
+  // For every file built, in the order they were committed, the state of the
+  // allocation lists when building it started and when it was done.  Files
+  // built recursively while building another one are committed first.
+  struct FileAllocations {
+    const FileDescriptor* file;
+    CheckPoint begin;
+    CheckPoint end;
+  };
+  std::vector<FileAllocations> file_allocations_;
+
+  // Returns, for each of the `size` first elements of the allocation list
+  // counted by `field`, the index in file_allocations_ of the file which
+  // allocated it, or -1 if none did.
+  std::vector<int> FindAllocatingFiles(int size, int CheckPoint::*field) const;
 
   // Allocate some bytes which will be reclaimed when the pool is
   // destroyed.
@@ -756,6 +844,43 @@ class FileDescriptorTables {
   // we are going to roll back to the last checkpoint.
   void FinalizeTables();
 
+  // Bytes of memory used by the tables, including sizeof(*this).  The
+  // locations_by_path_ map is populated by readers without any lock which
+  // could be taken here, so it is not counted.
+  size_t SpaceUsedLong() const;
+  // Appends the messages created on demand by ParseLazyOptions() and
+  // GetSourceCodeInfo(), which SpaceUsedLong() does not count.
+  void AppendLazyMessages(std::vector<const Message*>* messages) const;
+
+  // Options of a descriptor which are parsed on first use (see
+  // DescriptorPool::ParseOptionsLazily()).
+  struct LazyOptions {
+    void* descriptor;
+    // The name of the options type, a NUL and the serialized options, as
+    // kept by the pool (see DescriptorPool::Tables::AllocateOptionsKey()).
+    const std::string* serialized;
+    // Returns a new, empty message of the descriptor's options type.
+    Message* (*new_options)();
+    // Sets the descriptor's options to `options`, which is of its type.
+    void (*set_options)(void* descriptor, const Message* options);
+  };
+
+  // Sets the options which ParseLazyOptions() parses.  The array must
+  // outlive the tables.
+  void SetLazyOptions(const LazyOptions* options, int count);
+  // Parses all the options passed to SetLazyOptions() and sets them in their
+  // descriptors.  Must be called once.
+  void ParseLazyOptions() const;
+
+  // Makes GetSourceCodeInfo() load the SourceCodeInfo from `database`, while
+  // holding `mutex` (which may be null).
+  void LoadSourceCodeInfoOnDemand(DescriptorDatabase* database,
+                                  internal::WrappedMutex* mutex);
+  // Returns `built`, the SourceCodeInfo that `file` was built with, or the one
+  // loaded from the database if LoadSourceCodeInfoOnDemand() was called.
+  const SourceCodeInfo* GetSourceCodeInfo(const FileDescriptor* file,
+                                          const SourceCodeInfo* built) const;
+
  private:
   const void* FindParentForFieldsByMap(const FieldDescriptor* field) const;
   static void FieldsByLowercaseNamesLazyInitStatic(
@@ -784,6 +909,19 @@ class FileDescriptorTables {
   // Mutex to protect the unknown-enum-value map due to dynamic
   // EnumValueDescriptor creation on unknown values.
   mutable internal::WrappedMutex unknown_enum_values_mu_;
+
+  const LazyOptions* lazy_options_;
+  int lazy_options_count_;
+
+  DescriptorDatabase* source_code_info_database_;
+  internal::WrappedMutex* source_code_info_mutex_;
+  mutable internal::once_flag source_code_info_once_;
+  mutable const SourceCodeInfo* loaded_source_code_info_;
+
+  // Messages created on demand, which the tables own.
+  mutable std::vector<std::unique_ptr<Message>> lazy_messages_
+      PROTOBUF_GUARDED_BY(lazy_messages_mu_);
+  mutable internal::WrappedMutex lazy_messages_mu_;
 };
 
 DescriptorPool::Tables::Tables()
@@ -791,6 +929,7 @@ DescriptorPool::Tables::Tables()
     : known_bad_files_(3),
       known_bad_symbols_(3),
       extensions_loaded_from_db_(3),
+      publish_for_lock_free_lookup_(false),
       symbols_by_name_(3),
       files_by_name_(3) {
   well_known_types_.insert({
@@ -825,7 +964,12 @@ FileDescriptorTables::FileDescriptorTables()
       fields_by_number_(3),
       enum_values_by_number_(3),
       unknown_enum_values_by_number_(3),
-      locations_by_path_(3) {}
+      locations_by_path_(3),
+      lazy_options_(nullptr),
+      lazy_options_count_(0),
+      source_code_info_database_(nullptr),
+      source_code_info_mutex_(nullptr),
+      loaded_source_code_info_(nullptr) {}
 
 FileDescriptorTables::~FileDescriptorTables() {}
 
@@ -845,9 +989,19 @@ void DescriptorPool::Tables::ClearLastCheckpoint() {
   if (checkpoints_.empty()) {
     // All checkpoints have been cleared: we can now commit all of the pending
     // data.
+    if (publish_for_lock_free_lookup_) {
+      for (const char* name : symbols_after_checkpoint_) {
+        published_symbols_.Insert(name, FindSymbol(name));
+      }
+      for (const char* name : files_after_checkpoint_) {
+        published_files_.Insert(name, FindFile(name));
+      }
+    }
     symbols_after_checkpoint_.clear();
     files_after_checkpoint_.clear();
     extensions_after_checkpoint_.clear();
+    interned_strings_after_checkpoint_.clear();
+    interned_options_after_checkpoint_.clear();
   }
 }
 
@@ -867,12 +1021,33 @@ void DescriptorPool::Tables::RollbackToLastCheckpoint() {
        i < extensions_after_checkpoint_.size(); i++) {
     extensions_.erase(extensions_after_checkpoint_[i]);
   }
+  for (int i = checkpoint.pending_interned_strings_before_checkpoint;
+       i < interned_strings_after_checkpoint_.size(); i++) {
+    interned_strings_.erase(*interned_strings_after_checkpoint_[i]);
+  }
+  // Backwards, since a key may have been added and then given options.
+  for (int i = interned_options_after_checkpoint_.size() - 1;
+       i >= checkpoint.pending_interned_options_before_checkpoint; i--) {
+    const auto& change = interned_options_after_checkpoint_[i];
+    if (change.second) {
+      interned_options_.erase(*change.first);
+    } else {
+      interned_options_[*change.first] = nullptr;
+    }
+  }
 
   symbols_after_checkpoint_.resize(
       checkpoint.pending_symbols_before_checkpoint);
   files_after_checkpoint_.resize(checkpoint.pending_files_before_checkpoint);
   extensions_after_checkpoint_.resize(
       checkpoint.pending_extensions_before_checkpoint);
+  interned_strings_after_checkpoint_.resize(
+      checkpoint.pending_interned_strings_before_checkpoint);
+  interned_options_after_checkpoint_.resize(
+      checkpoint.pending_interned_options_before_checkpoint);
+  file_allocations_.erase(
+      file_allocations_.begin() + checkpoint.file_allocations_before_checkpoint,
+      file_allocations_.end());
 
   strings_.resize(checkpoint.strings_before_checkpoint);
   messages_.resize(checkpoint.messages_before_checkpoint);
@@ -914,10 +1089,10 @@ inline Symbol FileDescriptorTables::FindNestedSymbolOfType(
 Symbol DescriptorPool::Tables::FindByNameHelper(const DescriptorPool* pool,
                                                 StringPiece name) {
   if (pool->mutex_ != nullptr) {
-    // Fast path: the Symbol is already cached.  This is just a hash lookup.
-    ReaderMutexLock lock(pool->mutex_);
-    if (known_bad_symbols_.empty() && known_bad_files_.empty()) {
-      Symbol result = FindSymbol(name);
+    // Fast path: the Symbol has already been built, here or in an underlay.
+    // This is just a hash lookup per pool and takes no lock.
+    for (const DescriptorPool* p = pool; p != nullptr; p = p->underlay_) {
+      Symbol result = p->tables_->FindPublishedSymbol(name);
       if (!result.IsNull()) return result;
     }
   }
@@ -948,6 +1123,18 @@ inline const FileDescriptor* DescriptorPool::Tables::FindFile(
   return FindPtrOrNull(files_by_name_, key);
 }
 
+inline Symbol DescriptorPool::Tables::FindPublishedSymbol(
+    StringPiece key) const {
+  const Symbol* result = published_symbols_.Find(key);
+  return result == nullptr ? kNullSymbol : *result;
+}
+
+inline const FileDescriptor* DescriptorPool::Tables::FindPublishedFile(
+    StringPiece key) const {
+  const FileDescriptor* const* result = published_files_.Find(key);
+  return result == nullptr ? nullptr : *result;
+}
+
 inline const FieldDescriptor* FileDescriptorTables::FindFieldByNumber(
     const Descriptor* parent, int number) const {
   return FindPtrOrNull(fields_by_number_, std::make_pair(parent, number));
@@ -1120,6 +1307,99 @@ void FileDescriptorTables::FinalizeTables() {
   fields_by_camelcase_name_tmp_ = nullptr;
 }
 
+namespace {
+
+// Approximates the memory used by a node-based hash map (such as
+// std::unordered_map), not counting sizeof(map).
+template <typename Map>
+size_t HashMapSpaceUsedExcludingSelfLong(const Map& map) {
+  return map.bucket_count() * sizeof(void*) +
+         map.size() * (sizeof(typename Map::value_type) + 2 * sizeof(void*));
+}
+
+}  // namespace
+
+size_t FileDescriptorTables::SpaceUsedLong() const {
+  // Build the lazily populated maps first, as lookups would, so that they can
+  // be read without racing with a concurrent lookup.
+  internal::call_once(
+      fields_by_lowercase_name_once_,
+      &FileDescriptorTables::FieldsByLowercaseNamesLazyInitStatic, this);
+  internal::call_once(
+      fields_by_camelcase_name_once_,
+      &FileDescriptorTables::FieldsByCamelcaseNamesLazyInitStatic, this);
+
+  size_t total = sizeof(*this) +
+                 HashMapSpaceUsedExcludingSelfLong(symbols_by_parent_) +
+                 HashMapSpaceUsedExcludingSelfLong(fields_by_lowercase_name_) +
+                 HashMapSpaceUsedExcludingSelfLong(fields_by_camelcase_name_) +
+                 HashMapSpaceUsedExcludingSelfLong(fields_by_number_) +
+                 HashMapSpaceUsedExcludingSelfLong(enum_values_by_number_);
+  ReaderMutexLock l(&unknown_enum_values_mu_);
+  return total +
+         HashMapSpaceUsedExcludingSelfLong(unknown_enum_values_by_number_);
+}
+
+void FileDescriptorTables::AppendLazyMessages(
+    std::vector<const Message*>* messages) const {
+  MutexLock l(&lazy_messages_mu_);
+  for (const auto& message : lazy_messages_) {
+    messages->push_back(message.get());
+  }
+}
+
+void FileDescriptorTables::SetLazyOptions(const LazyOptions* options,
+                                          int count) {
+  lazy_options_ = options;
+  lazy_options_count_ = count;
+}
+
+void FileDescriptorTables::ParseLazyOptions() const {
+  // Options which repeat in the file are shared when building it, so each of
+  // these is distinct.
+  std::vector<std::unique_ptr<Message>> messages;
+  for (int i = 0; i < lazy_options_count_; i++) {
+    const LazyOptions& lazy = lazy_options_[i];
+    Message* options = lazy.new_options();
+    messages.emplace_back(options);
+    StringPiece serialized(*lazy.serialized);
+    serialized.remove_prefix(serialized.find('\0') + 1);
+    options->ParseFromArray(serialized.data(), serialized.size());
+    lazy.set_options(lazy.descriptor, options);
+  }
+
+  MutexLock l(&lazy_messages_mu_);
+  for (auto& message : messages) lazy_messages_.push_back(std::move(message));
+}
+
+void FileDescriptorTables::LoadSourceCodeInfoOnDemand(
+    DescriptorDatabase* database, internal::WrappedMutex* mutex) {
+  source_code_info_database_ = database;
+  source_code_info_mutex_ = mutex;
+}
+
+const SourceCodeInfo* FileDescriptorTables::GetSourceCodeInfo(
+    const FileDescriptor* file, const SourceCodeInfo* built) const {
+  if (source_code_info_database_ == nullptr) return built;
+  internal::call_once(source_code_info_once_, [this, file] {
+    FileDescriptorProto proto;
+    {
+      MutexLockMaybe lock(source_code_info_mutex_);
+      if (!source_code_info_database_->FindFileByName(file->name(), &proto)) {
+        return;
+      }
+    }
+    SourceCodeInfo* info = new SourceCodeInfo;
+    info->Swap(proto.mutable_source_code_info());
+    loaded_source_code_info_ = info;
+    MutexLock l(&lazy_messages_mu_);
+    lazy_messages_.emplace_back(info);
+  });
+  return loaded_source_code_info_ != nullptr
+             ? loaded_source_code_info_
+             : &SourceCodeInfo::default_instance();
+}
+
 void FileDescriptorTables::AddFieldByStylizedNames(
     const FieldDescriptor* field) {
   const void* parent = FindParentForFieldsByMap(field);
@@ -1193,6 +1473,166 @@ std::string* DescriptorPool::Tables::AllocateEmptyString() {
   return result;
 }
 
+const std::string* DescriptorPool::Tables::AllocateInternedString(
+    StringPiece value) {
+  auto it = interned_strings_.find(value);
+  if (it != interned_strings_.end()) return it->second;
+  std::string* result = AllocateString(value);
+  interned_strings_[*result] = result;
+  interned_strings_after_checkpoint_.push_back(result);
+  return result;
+}
+
+const std::string* DescriptorPool::Tables::FindOptionsKey(
+    const std::string& key) const {
+  auto it = interned_options_.find(key);
+  return it == interned_options_.end() ? nullptr : &it->first;
+}
+
+const std::string* DescriptorPool::Tables::AllocateOptionsKey(
+    const std::string& key) {
+  auto result = interned_options_.insert(std::make_pair(key, nullptr));
+  if (result.second) {
+    interned_options_after_checkpoint_.push_back({&result.first->first, true});
+  }
+  return &result.first->first;
+}
+
+const Message* DescriptorPool::Tables::FindInternedOptions(
+    const std::string& key) const {
+  auto it = interned_options_.find(key);
+  return it == interned_options_.end() ? nullptr : it->second;
+}
+
+void DescriptorPool::Tables::InternOptions(const std::string& key,
+                                           const Message* options) {
+  auto result = interned_options_.insert(std::make_pair(key, options));
+  if (result.second) {
+    interned_options_after_checkpoint_.push_back({&result.first->first, true});
+  } else if (result.first->second == nullptr) {
+    result.first->second = options;
+    interned_options_after_checkpoint_.push_back(
+        {&result.first->first, false});
+  }
+}
+
+void DescriptorPool::Tables::RecordFileAllocations(
+    const FileDescriptor* file) {
+  GOOGLE_DCHECK(!checkpoints_.empty());
+  file_allocations_.push_back({file, checkpoints_.back(), CheckPoint(this)});
+}
+
+std::vector<int> DescriptorPool::Tables::FindAllocatingFiles(
+    int size, int CheckPoint::*field) const {
+  // A file built while building another one (e.g. a dependency loaded from
+  // the fallback database) is recorded first, so the enclosing file only
+  // gets what is left in its range.
+  std::vector<int> result(size, -1);
+  for (int i = 0; i < file_allocations_.size(); i++) {
+    const FileAllocations& file = file_allocations_[i];
+    for (int j = file.begin.*field; j < file.end.*field && j < size; j++) {
+      if (result[j] == -1) result[j] = i;
+    }
+  }
+  return result;
+}
+
+size_t DescriptorPool::Tables::SpaceUsedLong(
+    const Tables* tables, internal::WrappedMutex* mu,
+    std::map<std::string, size_t>* by_file) {
+  // Bytes used by each file, with the last element being for memory not
+  // allocated by any file.
+  std::vector<size_t> file_bytes;
+  std::vector<std::string> file_names;
+  // Options messages and the index of the file owning them, measured once
+  // the lock is released: computing their size needs their descriptors, which
+  // may have to be built in this very pool.
+  std::vector<std::pair<const Message*, int>> messages;
+  {
+    MutexLockMaybe lock(mu);
+    const int num_files = tables->file_allocations_.size();
+    file_bytes.resize(num_files + 1);
+    for (const FileAllocations& file : tables->file_allocations_) {
+      file_names.push_back(file.file->name());
+    }
+    auto owner = [num_files](int file) {
+      return file == -1 ? num_files : file;
+    };
+
+    std::vector<int> files = tables->FindAllocatingFiles(
+        tables->allocations_.size(), &CheckPoint::allocations_before_checkpoint);
+    for (int i = 0; i < files.size(); i++) {
+      file_bytes[owner(files[i])] +=
+          sizeof(std::vector<char>) + tables->allocations_[i].capacity();
+    }
+    files = tables->FindAllocatingFiles(tables->strings_.size(),
+                                        &CheckPoint::strings_before_checkpoint);
+    for (int i = 0; i < files.size(); i++) {
+      file_bytes[owner(files[i])] +=
+          sizeof(std::unique_ptr<std::string>) + sizeof(std::string) +
+          internal::StringSpaceUsedExcludingSelfLong(*tables->strings_[i]);
+    }
+    files = tables->FindAllocatingFiles(
+        tables->messages_.size(), &CheckPoint::messages_before_checkpoint);
+    for (int i = 0; i < files.size(); i++) {
+      file_bytes[owner(files[i])] += sizeof(std::unique_ptr<Message>);
+      messages.emplace_back(tables->messages_[i].get(), owner(files[i]));
+    }
+    files = tables->FindAllocatingFiles(
+        tables->once_dynamics_.size(),
+        &CheckPoint::once_dynamics_before_checkpoint);
+    for (int i = 0; i < files.size(); i++) {
+      file_bytes[owner(files[i])] +=
+          sizeof(std::unique_ptr<internal::once_flag>) +
+          sizeof(internal::once_flag);
+    }
+    files = tables->FindAllocatingFiles(
+        tables->file_tables_.size(), &CheckPoint::file_tables_before_checkpoint);
+    for (int i = 0; i < files.size(); i++) {
+      file_bytes[owner(files[i])] +=
+          sizeof(std::unique_ptr<FileDescriptorTables>) +
+          tables->file_tables_[i]->SpaceUsedLong();
+      std::vector<const Message*> lazy_messages;
+      tables->file_tables_[i]->AppendLazyMessages(&lazy_messages);
+      for (const Message* message : lazy_messages) {
+        messages.emplace_back(message, owner(files[i]));
+      }
+    }
+
+    // The pool-wide indices.
+    file_bytes[num_files] +=
+        sizeof(*tables) +
+        HashMapSpaceUsedExcludingSelfLong(tables->symbols_by_name_) +
+        HashMapSpaceUsedExcludingSelfLong(tables->files_by_name_) +
+        HashMapSpaceUsedExcludingSelfLong(tables->interned_strings_) +
+        HashMapSpaceUsedExcludingSelfLong(tables->interned_options_) +
+        tables->extensions_.size() *
+            (sizeof(ExtensionsGroupedByDescriptorMap::value_type) +
+             4 * sizeof(void*)) +
+        tables->published_symbols_.SpaceUsedExcludingSelfLong() +
+        tables->published_files_.SpaceUsedExcludingSelfLong() +
+        tables->file_allocations_.capacity() * sizeof(FileAllocations);
+    for (const auto& entry : tables->interned_options_) {
+      file_bytes[num_files] +=
+          internal::StringSpaceUsedExcludingSelfLong(entry.first);
+    }
+  }
+
+  for (const auto& message : messages) {
+    file_bytes[message.second] += message.first->SpaceUsedLong();
+  }
+
+  size_t total = 0;
+  for (size_t bytes : file_bytes) total += bytes;
+  if (by_file != nullptr) {
+    by_file->clear();
+    for (int i = 0; i < file_names.size(); i++) {
+      (*by_file)[file_names[i]] += file_bytes[i];
+    }
+  }
+  return total;
+}
+
 internal::once_flag* DescriptorPool::Tables::AllocateOnceDynamic() {
   internal::once_flag* result = new internal::once_flag();
   once_dynamics_.emplace_back(result);
@@ -1255,7 +1695,10 @@ DescriptorPool::DescriptorPool()
       lazily_build_dependencies_(false),
       allow_unknown_(false),
       enforce_weak_(false),
-      disallow_enforce_utf8_(false) {}
+      disallow_enforce_utf8_(false),
+      trust_inputs_(false),
+      drop_source_code_info_(false),
+      parse_options_lazily_(false) {}
 
 DescriptorPool::DescriptorPool(DescriptorDatabase* fallback_database,
                                ErrorCollector* error_collector)
@@ -1268,7 +1711,13 @@ DescriptorPool::DescriptorPool(DescriptorDatabase* fallback_database,
       lazily_build_dependencies_(false),
       allow_unknown_(false),
       enforce_weak_(false),
-      disallow_enforce_utf8_(false) {}
+      disallow_enforce_utf8_(false),
+      trust_inputs_(false),
+      drop_source_code_info_(false),
+      parse_options_lazily_(false) {
+  // Only pools with a mutex are looked up concurrently with building.
+  tables_->publish_for_lock_free_lookup_ = true;
+}
 
 DescriptorPool::DescriptorPool(const DescriptorPool* underlay)
     : mutex_(nullptr),
@@ -1280,7 +1729,10 @@ DescriptorPool::DescriptorPool(const DescriptorPool* underlay)
       lazily_build_dependencies_(false),
       allow_unknown_(false),
       enforce_weak_(false),
-      disallow_enforce_utf8_(false) {}
+      disallow_enforce_utf8_(false),
+      trust_inputs_(false),
+      drop_source_code_info_(false),
+      parse_options_lazily_(false) {}
 
 DescriptorPool::~DescriptorPool() {
   if (mutex_ != nullptr) delete mutex_;
@@ -1307,20 +1759,34 @@ bool DescriptorPool::InternalIsFileLoaded(ConstStringParam filename) const {
   return tables_->FindFile(filename) != nullptr;
 }
 
+size_t DescriptorPool::SpaceUsedLong() const { return SpaceUsedLong(nullptr); }
+
+size_t DescriptorPool::SpaceUsedLong(
+    std::map<std::string, size_t>* space_used_by_file) const {
+  return sizeof(*this) +
+         Tables::SpaceUsedLong(tables_.get(), mutex_, space_used_by_file);
+}
+
 // generated_pool ====================================================
 
 namespace {
 
 
 EncodedDescriptorDatabase* GeneratedDatabase() {
-  static auto generated_database =
-      internal::OnShutdownDelete(new EncodedDescriptorDatabase());
+  static auto generated_database = [] {
+    auto database = new EncodedDescriptorDatabase();
+    // Like the GOOGLE_CHECK a failing Add() would hit.
+    database->SetLazyErrorsFatal(true);
+    return internal::OnShutdownDelete(database);
+  }();
   return generated_database;
 }
 
 DescriptorPool* NewGeneratedPool() {
   auto generated_pool = new DescriptorPool(GeneratedDatabase());
   generated_pool->InternalSetLazilyBuildDependencies();
+  // Generated code is only ever produced from files protoc has validated.
+  generated_pool->TrustInputs(true);
   return generated_pool;
 }
 
@@ -1368,7 +1834,10 @@ void DescriptorPool::InternalAddGeneratedFile(
   // Therefore, when we parse one, we have to be very careful to avoid using
   // any descriptor-based operations, since this might cause infinite recursion
   // or deadlock.
-  GOOGLE_CHECK(GeneratedDatabase()->Add(encoded_file_descriptor, size));
+  //
+  // The bytes are not even indexed yet: that happens on the first lookup in
+  // the database, so that startup does not pay for files that are never used.
+  GeneratedDatabase()->AddLazily(encoded_file_descriptor, size);
 }
 
 
@@ -1380,6 +1849,14 @@ void DescriptorPool::InternalAddGeneratedFile(
 
 const FileDescriptor* DescriptorPool::FindFileByName(
     ConstStringParam name) const {
+  if (mutex_ != nullptr) {
+    // Fast path: the file has already been built, so no lock is needed.
+    for (const DescriptorPool* pool = this; pool != nullptr;
+         pool = pool->underlay_) {
+      const FileDescriptor* result = pool->tables_->FindPublishedFile(name);
+      if (result != nullptr) return result;
+    }
+  }
   MutexLockMaybe lock(mutex_);
   if (fallback_database_ != nullptr) {
     tables_->known_bad_symbols_.clear();
@@ -2078,9 +2555,10 @@ void FileDescriptor::CopyJsonNameTo(FileDescriptorProto* proto) const {
 }
 
 void FileDescriptor::CopySourceCodeInfoTo(FileDescriptorProto* proto) const {
-  if (source_code_info_ &&
-      source_code_info_ != &SourceCodeInfo::default_instance()) {
-    proto->mutable_source_code_info()->CopyFrom(*source_code_info_);
+  const SourceCodeInfo* info =
+      tables_->GetSourceCodeInfo(this, source_code_info_);
+  if (info && info != &SourceCodeInfo::default_instance()) {
+    proto->mutable_source_code_info()->CopyFrom(*info);
   }
 }
 
@@ -2963,9 +3441,11 @@ void MethodDescriptor::DebugString(
 bool FileDescriptor::GetSourceLocation(const std::vector<int>& path,
                                        SourceLocation* out_location) const {
   GOOGLE_CHECK(out_location != nullptr);
-  if (source_code_info_) {
+  const SourceCodeInfo* info =
+      tables_->GetSourceCodeInfo(this, source_code_info_);
+  if (info) {
     if (const SourceCodeInfo_Location* loc =
-            tables_->GetSourceLocation(path, source_code_info_)) {
+            tables_->GetSourceLocation(path, info)) {
       const RepeatedField<int32>& span = loc->span();
       if (span.size() == 3 || span.size() == 4) {
         out_location->start_line = span.Get(0);
@@ -2992,6 +3472,7 @@ bool FileDescriptor::GetSourceLocation(SourceLocation* out_location) const {
 
 bool FieldDescriptor::is_packed() const {
   if (!is_packable()) return false;
+  file_->ParseLazyOptions();
   if (file_->syntax() == FileDescriptor::SYNTAX_PROTO2) {
     return (options_ != nullptr) && options_->packed();
   } else {
@@ -3154,6 +3635,12 @@ class DescriptorBuilder {
   // can later (after cross-linking) interpret those options.
   std::vector<OptionsToInterpret> options_to_interpret_;
 
+  // When the pool parses options lazily, the options of the file being built
+  // are parsed into temporary_options_, and replaced on commit by the ones
+  // recorded in lazy_options_ (see DeferLazyOptions()).
+  std::vector<FileDescriptorTables::LazyOptions> lazy_options_;
+  std::vector<std::unique_ptr<Message>> temporary_options_;
+
   bool had_errors_;
   std::string filename_;
   FileDescriptor* file_;
@@ -3299,6 +3786,16 @@ class DescriptorBuilder {
       DescriptorT* descriptor, const std::vector<int>& options_path,
       const std::string& option_name);
 
+  // The functions of FileDescriptorTables::LazyOptions for DescriptorT.
+  template <class DescriptorT>
+  static Message* NewOptions();
+  template <class DescriptorT>
+  static void SetOptions(void* descriptor, const Message* options);
+
+  // Hands the options in lazy_options_ over to the file's tables, to be
+  // parsed on first use.
+  void DeferLazyOptions(FileDescriptor* file);
+
   // Allocate string on the string pool and initialize it to full proto name.
   // Full proto name is "scope.proto_name" if scope is non-empty and
   // "proto_name" otherwise.
@@ -3331,6 +3828,12 @@ class DescriptorBuilder {
                           EnumDescriptor::ReservedRange* result);
   void BuildOneof(const OneofDescriptorProto& proto, Descriptor* parent,
                   OneofDescriptor* result);
+  // Checks that reserved and extension ranges don't overlap, and that no
+  // field or value uses a reserved number or name.
+  void CheckRangesAndReservedNames(const DescriptorProto& proto,
+                                   const Descriptor* result);
+  void CheckRangesAndReservedNames(const EnumDescriptorProto& proto,
+                                   const EnumDescriptor* result);
   void CheckEnumValueUniqueness(const EnumDescriptorProto& proto,
                                 const EnumDescriptor* result);
   void BuildEnum(const EnumDescriptorProto& proto, const Descriptor* parent,
@@ -4091,6 +4594,7 @@ void DescriptorBuilder::AddPackage(const std::string& name,
 void DescriptorBuilder::ValidateSymbolName(const std::string& name,
                                            const std::string& full_name,
                                            const Message& proto) {
+  if (pool_->trust_inputs_) return;
   if (name.empty()) {
     AddError(full_name, proto, DescriptorPool::ErrorCollector::NAME,
              "Missing name.");
@@ -4134,19 +4638,42 @@ void DescriptorBuilder::AllocateOptions(const FileOptions& orig_options,
                       "google.protobuf.FileOptions");
 }
 
+template <class DescriptorT>
+Message* DescriptorBuilder::NewOptions() {
+  return new typename DescriptorT::OptionsType;
+}
+
+template <class DescriptorT>
+void DescriptorBuilder::SetOptions(void* descriptor, const Message* options) {
+  static_cast<DescriptorT*>(descriptor)->options_ =
+      static_cast<const typename DescriptorT::OptionsType*>(options);
+}
+
+void DescriptorBuilder::DeferLazyOptions(FileDescriptor* file) {
+  // Options that turned up again later in the file were interned then, and
+  // are shared now rather than parsed again.  The temporary options go away
+  // with this builder.
+  int count = 0;
+  for (const auto& lazy : lazy_options_) {
+    const Message* interned = tables_->FindInternedOptions(*lazy.serialized);
+    lazy.set_options(lazy.descriptor, interned);
+    if (interned == nullptr) lazy_options_[count++] = lazy;
+  }
+  if (count == 0) return;
+  FileDescriptorTables::LazyOptions* lazy_options =
+      tables_->AllocateArray<FileDescriptorTables::LazyOptions>(count);
+  std::copy(lazy_options_.begin(), lazy_options_.begin() + count,
+            lazy_options);
+  file_tables_->SetLazyOptions(lazy_options, count);
+  file->options_once_ = tables_->AllocateOnceDynamic();
+}
+
 template <class DescriptorT>
 void DescriptorBuilder::AllocateOptionsImpl(
     const std::string& name_scope, const std::string& element_name,
     const typename DescriptorT::OptionsType& orig_options,
     DescriptorT* descriptor, const std::vector<int>& options_path,
     const std::string& option_name) {
-  // We need to use a dummy pointer to work around a bug in older versions of
-  // GCC.  Otherwise, the following two lines could be replaced with:
-  //   typename DescriptorT::OptionsType* options =
-  //       tables_->AllocateMessage<typename DescriptorT::OptionsType>();
-  typename DescriptorT::OptionsType* const dummy = nullptr;
-  typename DescriptorT::OptionsType* options = tables_->AllocateMessage(dummy);
-
   if (!orig_options.IsInitialized()) {
     AddError(name_scope + "." + element_name, orig_options,
              DescriptorPool::ErrorCollector::OPTION_NAME,
@@ -4158,19 +4685,60 @@ void DescriptorBuilder::AllocateOptionsImpl(
   // friendly. Without RTTI, MergeFrom() and CopyFrom() will fallback to the
   // reflection based method, which requires the Descriptor. However, we are in
   // the middle of building the descriptors, thus the deadlock.
-  options->ParseFromString(orig_options.SerializeAsString());
-  descriptor->options_ = options;
-
-  // Don't add to options_to_interpret_ unless there were uninterpreted
-  // options.  This not only avoids unnecessary work, but prevents a
-  // bootstrapping problem when building descriptors for descriptor.proto.
-  // descriptor.proto does not contain any uninterpreted options, but
-  // attempting to interpret options anyway will cause
-  // OptionsType::GetDescriptor() to be called which may then deadlock since
-  // we're still trying to build it.
-  if (options->uninterpreted_option_size() > 0) {
-    options_to_interpret_.push_back(OptionsToInterpret(
-        name_scope, element_name, options_path, &orig_options, options));
+  const std::string serialized = orig_options.SerializeAsString();
+
+  // Options which are final once parsed are shared by all descriptors with
+  // identical options in the pool.  Those still containing uninterpreted
+  // options are modified by the OptionInterpreter, so each gets its own.
+  const bool shareable = orig_options.uninterpreted_option_size() == 0;
+  std::string key;
+  const Message* interned = nullptr;
+  if (shareable) {
+    key = StrCat(option_name, StringPiece("\0", 1), serialized);
+    interned = tables_->FindInternedOptions(key);
+  }
+  if (interned != nullptr) {
+    descriptor->options_ =
+        static_cast<const typename DescriptorT::OptionsType*>(interned);
+  } else if (shareable && pool_->parse_options_lazily_ &&
+             // Options seen before in the pool are parsed and interned
+             // below, which is cheaper than keeping each copy serialized.
+             tables_->FindOptionsKey(key) == nullptr &&
+             // ExtensionRange::options_ is read directly, not via options().
+             !std::is_same<DescriptorT, Descriptor::ExtensionRange>::value) {
+    // Building the file may still need the options, e.g. to validate them.
+    typename DescriptorT::OptionsType* options =
+        new typename DescriptorT::OptionsType;
+    temporary_options_.emplace_back(options);
+    options->ParseFromString(serialized);
+    descriptor->options_ = options;
+    lazy_options_.push_back({descriptor, tables_->AllocateOptionsKey(key),
+                             &DescriptorBuilder::NewOptions<DescriptorT>,
+                             &DescriptorBuilder::SetOptions<DescriptorT>});
+  } else {
+    // We need to use a dummy pointer to work around a bug in older versions
+    // of GCC.  Otherwise, the following two lines could be replaced with:
+    //   typename DescriptorT::OptionsType* options =
+    //       tables_->AllocateMessage<typename DescriptorT::OptionsType>();
+    typename DescriptorT::OptionsType* const dummy = nullptr;
+    typename DescriptorT::OptionsType* options =
+        tables_->AllocateMessage(dummy);
+    options->ParseFromString(serialized);
+    descriptor->options_ = options;
+
+    // Don't add to options_to_interpret_ unless there were uninterpreted
+    // options.  This not only avoids unnecessary work, but prevents a
+    // bootstrapping problem when building descriptors for descriptor.proto.
+    // descriptor.proto does not contain any uninterpreted options, but
+    // attempting to interpret options anyway will cause
+    // OptionsType::GetDescriptor() to be called which may then deadlock since
+    // we're still trying to build it.
+    if (options->uninterpreted_option_size() > 0) {
+      options_to_interpret_.push_back(OptionsToInterpret(
+          name_scope, element_name, options_path, &orig_options, options));
+    } else if (shareable) {
+      tables_->InternOptions(key, options);
+    }
   }
 
   // If the custom option is in unknown fields, no need to interpret it.
@@ -4317,6 +4885,8 @@ const FileDescriptor* DescriptorBuilder::BuildFile(
 
   file_tables_->FinalizeTables();
   if (result) {
+    if (!lazy_options_.empty()) DeferLazyOptions(result);
+    tables_->RecordFileAllocations(result);
     tables_->ClearLastCheckpoint();
     result->finished_building_ = true;
   } else {
@@ -4333,8 +4903,9 @@ FileDescriptor* DescriptorBuilder::BuildFileImpl(
 
   result->is_placeholder_ = false;
   result->finished_building_ = false;
+  result->options_once_ = nullptr;
   SourceCodeInfo* info = nullptr;
-  if (proto.has_source_code_info()) {
+  if (proto.has_source_code_info() && !pool_->drop_source_code_info_) {
     info = tables_->AllocateMessage<SourceCodeInfo>();
     info->CopyFrom(proto.source_code_info());
     result->source_code_info_ = info;
@@ -4344,6 +4915,11 @@ FileDescriptor* DescriptorBuilder::BuildFileImpl(
 
   file_tables_ = tables_->AllocateFileTables();
   file_->tables_ = file_tables_;
+  if (proto.has_source_code_info() && pool_->drop_source_code_info_ &&
+      pool_->fallback_database_ != nullptr) {
+    file_tables_->LoadSourceCodeInfoOnDemand(pool_->fallback_database_,
+                                             pool_->mutex_);
+  }
 
   if (!proto.has_name()) {
     AddError("", proto, DescriptorPool::ErrorCollector::OTHER,
@@ -4362,15 +4938,15 @@ FileDescriptor* DescriptorBuilder::BuildFileImpl(
              "Unrecognized syntax: " + proto.syntax());
   }
 
-  result->name_ = tables_->AllocateString(proto.name());
+  result->name_ = tables_->AllocateInternedString(proto.name());
   if (proto.has_package()) {
-    result->package_ = tables_->AllocateString(proto.package());
+    result->package_ = tables_->AllocateInternedString(proto.package());
   } else {
     // We cannot rely on proto.package() returning a valid string if
     // proto.has_package() is false, because we might be running at static
     // initialization time, in which case default values have not yet been
     // initialized.
-    result->package_ = tables_->AllocateString("");
+    result->package_ = tables_->AllocateInternedString("");
   }
   result->pool_ = pool_;
 
@@ -4449,7 +5025,7 @@ FileDescriptor* DescriptorBuilder::BuildFileImpl(
     result->dependencies_[i] = dependency;
     if (pool_->lazily_build_dependencies_ && !dependency) {
       result->dependencies_names_[i] =
-          tables_->AllocateString(proto.dependency(i));
+          tables_->AllocateInternedString(proto.dependency(i));
     }
   }
 
@@ -4537,7 +5113,8 @@ FileDescriptor* DescriptorBuilder::BuildFileImpl(
 
   // Validate options. See comments at InternalSetLazilyBuildDependencies about
   // error checking and lazy import building.
-  if (!had_errors_ && !pool_->lazily_build_dependencies_) {
+  if (!had_errors_ && !pool_->lazily_build_dependencies_ &&
+      !pool_->trust_inputs_) {
     ValidateFileOptions(result, proto);
   }
 
@@ -4554,7 +5131,7 @@ FileDescriptor* DescriptorBuilder::BuildFileImpl(
   // checking. Also, don't log unused dependencies if there were previous
   // errors, since the results might be inaccurate.
   if (!had_errors_ && !unused_dependency_.empty() &&
-      !pool_->lazily_build_dependencies_) {
+      !pool_->lazily_build_dependencies_ && !pool_->trust_inputs_) {
     LogUnusedDependency(proto, result);
   }
 
@@ -4586,7 +5163,7 @@ void DescriptorBuilder::BuildMessage(const DescriptorProto& proto,
   std::string* full_name = AllocateNameString(scope, proto.name());
   ValidateSymbolName(proto.name(), *full_name, proto);
 
-  result->name_ = tables_->AllocateString(proto.name());
+  result->name_ = tables_->AllocateInternedString(proto.name());
   result->full_name_ = full_name;
   result->file_ = file_;
   result->containing_type_ = parent;
@@ -4615,7 +5192,7 @@ void DescriptorBuilder::BuildMessage(const DescriptorProto& proto,
       tables_->AllocateArray<const std::string*>(reserved_name_count);
   for (int i = 0; i < reserved_name_count; ++i) {
     result->reserved_names_[i] =
-        tables_->AllocateString(proto.reserved_name(i));
+        tables_->AllocateInternedString(proto.reserved_name(i));
   }
 
   // Copy options.
@@ -4628,6 +5205,13 @@ void DescriptorBuilder::BuildMessage(const DescriptorProto& proto,
 
   AddSymbol(result->full_name(), parent, result->name(), proto, Symbol(result));
 
+  CheckRangesAndReservedNames(proto, result);
+}
+
+void DescriptorBuilder::CheckRangesAndReservedNames(
+    const DescriptorProto& proto, const Descriptor* result) {
+  if (pool_->trust_inputs_) return;
+
   for (int i = 0; i < proto.reserved_range_size(); i++) {
     const DescriptorProto_ReservedRange& range1 = proto.reserved_range(i);
     for (int j = i + 1; j < proto.reserved_range_size(); j++) {
@@ -4725,7 +5309,7 @@ void DescriptorBuilder::BuildFieldOrExtension(const FieldDescriptorProto& proto,
   std::string* full_name = AllocateNameString(scope, proto.name());
   ValidateSymbolName(proto.name(), *full_name, proto);
 
-  result->name_ = tables_->AllocateString(proto.name());
+  result->name_ = tables_->AllocateInternedString(proto.name());
   result->full_name_ = full_name;
   result->file_ = file_;
   result->number_ = proto.number();
@@ -4748,22 +5332,21 @@ void DescriptorBuilder::BuildFieldOrExtension(const FieldDescriptorProto& proto,
   if (lowercase_name == proto.name()) {
     result->lowercase_name_ = result->name_;
   } else {
-    result->lowercase_name_ = tables_->AllocateString(lowercase_name);
+    result->lowercase_name_ = tables_->AllocateInternedString(lowercase_name);
   }
 
-  // Don't bother with the above optimization for camel-case names since
-  // .proto files that follow the guide shouldn't be using names in this
-  // format, so the optimization wouldn't help much.
-  result->camelcase_name_ =
-      tables_->AllocateString(ToCamelCase(proto.name(),
-                                          /* lower_first = */ true));
+  // Camel-case and JSON names are usually identical, and are shared through
+  // the pool's interned strings along with all other identical names.
+  result->camelcase_name_ = tables_->AllocateInternedString(
+      ToCamelCase(proto.name(), /* lower_first = */ true));
 
   if (proto.has_json_name()) {
     result->has_json_name_ = true;
-    result->json_name_ = tables_->AllocateString(proto.json_name());
+    result->json_name_ = tables_->AllocateInternedString(proto.json_name());
   } else {
     result->has_json_name_ = false;
-    result->json_name_ = tables_->AllocateString(ToJsonName(proto.name()));
+    result->json_name_ =
+        tables_->AllocateInternedString(ToJsonName(proto.name()));
   }
 
   // Some compilers do not allow static_cast directly between two enum types,
@@ -5081,7 +5664,7 @@ void DescriptorBuilder::BuildOneof(const OneofDescriptorProto& proto,
       AllocateNameString(parent->full_name(), proto.name());
   ValidateSymbolName(proto.name(), *full_name, proto);
 
-  result->name_ = tables_->AllocateString(proto.name());
+  result->name_ = tables_->AllocateInternedString(proto.name());
   result->full_name_ = full_name;
 
   result->containing_type_ = parent;
@@ -5103,6 +5686,7 @@ void DescriptorBuilder::BuildOneof(const OneofDescriptorProto& proto,
 
 void DescriptorBuilder::CheckEnumValueUniqueness(
     const EnumDescriptorProto& proto, const EnumDescriptor* result) {
+  if (pool_->trust_inputs_) return;
 
   // Check that enum labels are still unique when we remove the enum prefix from
   // values that have it.
@@ -5175,7 +5759,7 @@ void DescriptorBuilder::BuildEnum(const EnumDescriptorProto& proto,
   std::string* full_name = AllocateNameString(scope, proto.name());
   ValidateSymbolName(proto.name(), *full_name, proto);
 
-  result->name_ = tables_->AllocateString(proto.name());
+  result->name_ = tables_->AllocateInternedString(proto.name());
   result->full_name_ = full_name;
   result->file_ = file_;
   result->containing_type_ = parent;
@@ -5199,7 +5783,7 @@ void DescriptorBuilder::BuildEnum(const EnumDescriptorProto& proto,
       tables_->AllocateArray<const std::string*>(reserved_name_count);
   for (int i = 0; i < reserved_name_count; ++i) {
     result->reserved_names_[i] =
-        tables_->AllocateString(proto.reserved_name(i));
+        tables_->AllocateInternedString(proto.reserved_name(i));
   }
 
   CheckEnumValueUniqueness(proto, result);
@@ -5214,6 +5798,13 @@ void DescriptorBuilder::BuildEnum(const EnumDescriptorProto& proto,
 
   AddSymbol(result->full_name(), parent, result->name(), proto, Symbol(result));
 
+  CheckRangesAndReservedNames(proto, result);
+}
+
+void DescriptorBuilder::CheckRangesAndReservedNames(
+    const EnumDescriptorProto& proto, const EnumDescriptor* result) {
+  if (pool_->trust_inputs_) return;
+
   for (int i = 0; i < proto.reserved_range_size(); i++) {
     const EnumDescriptorProto_EnumReservedRange& range1 =
         proto.reserved_range(i);
@@ -5266,7 +5857,7 @@ void DescriptorBuilder::BuildEnum(const EnumDescriptorProto& proto,
 void DescriptorBuilder::BuildEnumValue(const EnumValueDescriptorProto& proto,
                                        const EnumDescriptor* parent,
                                        EnumValueDescriptor* result) {
-  result->name_ = tables_->AllocateString(proto.name());
+  result->name_ = tables_->AllocateInternedString(proto.name());
   result->number_ = proto.number();
   result->type_ = parent;
 
@@ -5340,7 +5931,7 @@ void DescriptorBuilder::BuildService(const ServiceDescriptorProto& proto,
   std::string* full_name = AllocateNameString(file_->package(), proto.name());
   ValidateSymbolName(proto.name(), *full_name, proto);
 
-  result->name_ = tables_->AllocateString(proto.name());
+  result->name_ = tables_->AllocateInternedString(proto.name());
   result->full_name_ = full_name;
   result->file_ = file_;
 
@@ -5361,7 +5952,7 @@ void DescriptorBuilder::BuildService(const ServiceDescriptorProto& proto,
 void DescriptorBuilder::BuildMethod(const MethodDescriptorProto& proto,
                                     const ServiceDescriptor* parent,
                                     MethodDescriptor* result) {
-  result->name_ = tables_->AllocateString(proto.name());
+  result->name_ = tables_->AllocateInternedString(proto.name());
   result->service_ = parent;
 
   std::string* full_name =
@@ -7371,6 +7962,10 @@ void FileDescriptor::DependenciesOnceInit(const FileDescriptor* to_init) {
   to_init->InternalDependenciesOnceInit();
 }
 
+void FileDescriptor::OptionsOnceInit(const FileDescriptor* to_init) {
+  to_init->tables_->ParseLazyOptions();
+}
+
 const FileDescriptor* FileDescriptor::dependency(int index) const {
   if (dependencies_once_) {
     // Do once init for all indices, as it's unlikely only a single index would
@@ -1553,6 +1553,13 @@ class PROTOBUF_EXPORT FileDescriptor {
   static void DependenciesOnceInit(const FileDescriptor* to_init);
   void InternalDependenciesOnceInit() const;
 
+  // Non-null if the options of this file and the descriptors in it are
+  // parsed on first use (see DescriptorPool::ParseOptionsLazily()).  All the
+  // options() accessors call ParseLazyOptions() first.
+  internal::once_flag* options_once_;
+  static void OptionsOnceInit(const FileDescriptor* to_init);
+  inline void ParseLazyOptions() const;
+
   // These are arranged to minimize padding on 64-bit.
   int dependency_count_;
   int public_dependency_count_;
@@ -1800,6 +1807,51 @@ class PROTOBUF_EXPORT DescriptorPool {
   // DescriptorPool will report a import not found error.
   void EnforceWeakDependencies(bool enforce) { enforce_weak_ = enforce; }
 
+  // By default, every file built is checked for all the rules that protoc
+  // enforces: valid identifiers, no overlapping reserved or extension
+  // ranges, unique enum values, valid options, proto3 restrictions
+  // (including conflicting JSON names), and so on.  If you call
+  // TrustInputs(true), these checks are skipped, which makes building
+  // faster.  Only do this for files known to be valid, e.g. because protoc
+  // produced them: an invalid file may then be built without errors, and
+  // the resulting descriptors may violate invariants that other code relies
+  // on.  Errors that prevent building the descriptors, such as undefined
+  // types or duplicate symbols, are still reported.  Options that were left
+  // uninterpreted (which protoc never does) are still interpreted.
+  void TrustInputs(bool trust) { trust_inputs_ = trust; }
+
+  // By default, files built in the pool keep their SourceCodeInfo, if any,
+  // for FileDescriptor::GetSourceLocation() and CopySourceCodeInfoTo().  With
+  // DropSourceCodeInfo(true), it is not kept: if the pool has a fallback
+  // database, it is loaded from there (by looking the file up again) the
+  // first time one of these methods needs it, otherwise they behave as if the
+  // file had no SourceCodeInfo.  The locations of options in a SourceCodeInfo
+  // loaded this way are not updated for interpreted options, so they only
+  // match descriptors built from files with all their options interpreted,
+  // as protoc produces them.
+  void DropSourceCodeInfo(bool drop) { drop_source_code_info_ = drop; }
+
+  // By default, the options of every descriptor are parsed when building
+  // its file.  With ParseOptionsLazily(true), the options of a file and of
+  // all the descriptors it contains are only kept serialized, and parsed the
+  // first time options() is called on any of these descriptors.  Building
+  // the file still parses them temporarily, to validate them.  Options which
+  // have to be interpreted, or which are identical to options seen before in
+  // the pool, are parsed when building, and the latter are shared.
+  void ParseOptionsLazily(bool lazily) { parse_options_lazily_ = lazily; }
+
+  // Returns the number of bytes of memory used by this pool, not counting
+  // its underlay or database.  This is an estimate: allocator overhead and
+  // some of the hash-map internals are approximated.
+  size_t SpaceUsedLong() const;
+
+  // Same as above, but also fills `space_used_by_file` with the part of the
+  // total allocated while building each file: its descriptors, names,
+  // options and lookup tables.  Names and options shared with files built
+  // later are counted for the first file using them.  The remainder is the
+  // pool's own indices over all files.
+  size_t SpaceUsedLong(std::map<std::string, size_t>* space_used_by_file) const;
+
   // Internal stuff --------------------------------------------------
   // These methods MUST NOT be called from outside the proto2 library.
   // These methods may contain hidden pitfalls and may be removed in a
@@ -1964,6 +2016,9 @@ class PROTOBUF_EXPORT DescriptorPool {
   bool allow_unknown_;
   bool enforce_weak_;
   bool disallow_enforce_utf8_;
+  bool trust_inputs_;
+  bool drop_source_code_info_;
+  bool parse_options_lazily_;
 
   // Set of files to track for unused imports. The bool value when true means
   // unused imports are treated as errors (and as warnings when false).
@@ -1988,7 +2043,10 @@ class PROTOBUF_EXPORT DescriptorPool {
   inline TYPE CLASS::FIELD(int index) const { return FIELD##s_ + index; }
 
 #define PROTOBUF_DEFINE_OPTIONS_ACCESSOR(CLASS, TYPE) \
-  inline const TYPE& CLASS::options() const { return *options_; }
+  inline const TYPE& CLASS::options() const {        \
+    file()->ParseLazyOptions();                      \
+    return *options_;                                \
+  }
 
 PROTOBUF_DEFINE_STRING_ACCESSOR(Descriptor, name)
 PROTOBUF_DEFINE_STRING_ACCESSOR(Descriptor, full_name)
@@ -2097,7 +2155,17 @@ PROTOBUF_DEFINE_ACCESSOR(FileDescriptor, message_type_count, int)
 PROTOBUF_DEFINE_ACCESSOR(FileDescriptor, enum_type_count, int)
 PROTOBUF_DEFINE_ACCESSOR(FileDescriptor, service_count, int)
 PROTOBUF_DEFINE_ACCESSOR(FileDescriptor, extension_count, int)
-PROTOBUF_DEFINE_OPTIONS_ACCESSOR(FileDescriptor, FileOptions)
+inline void FileDescriptor::ParseLazyOptions() const {
+  if (options_once_) {
+    internal::call_once(*options_once_, &FileDescriptor::OptionsOnceInit,
+                        this);
+  }
+}
+
+inline const FileOptions& FileDescriptor::options() const {
+  ParseLazyOptions();
+  return *options_;
+}
 PROTOBUF_DEFINE_ACCESSOR(FileDescriptor, is_placeholder, bool)
 
 PROTOBUF_DEFINE_ARRAY_ACCESSOR(FileDescriptor, message_type, const Descriptor*)
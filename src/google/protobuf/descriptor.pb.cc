@@ -1446,6 +1446,8 @@ const char* FileDescriptorSet::_InternalParse(const char* ptr, ::PROTOBUF_NAMESP
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
           ptr -= 1;
+          file_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<10>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_file(), ptr);
@@ -1756,9 +1758,10 @@ const char* FileDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAME
       // optional string name = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_name(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &name_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FileDescriptorProto.name");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -1767,9 +1770,10 @@ const char* FileDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAME
       // optional string package = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_package();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_package(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&package_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &package_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FileDescriptorProto.package");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -1795,6 +1799,8 @@ const char* FileDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAME
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
           ptr -= 1;
+          message_type_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<34>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_message_type(), ptr);
@@ -1807,6 +1813,8 @@ const char* FileDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAME
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
           ptr -= 1;
+          enum_type_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<42>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_enum_type(), ptr);
@@ -1819,6 +1827,8 @@ const char* FileDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAME
       case 6:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
           ptr -= 1;
+          service_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<50>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_service(), ptr);
@@ -1831,6 +1841,8 @@ const char* FileDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAME
       case 7:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
           ptr -= 1;
+          extension_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<58>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_extension(), ptr);
@@ -1886,9 +1898,10 @@ const char* FileDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAME
       // optional string syntax = 12;
       case 12:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
-          auto str = _internal_mutable_syntax();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_syntax(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&syntax_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &syntax_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FileDescriptorProto.syntax");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -2520,7 +2533,14 @@ void DescriptorProto_ExtensionRange::CopyFrom(const DescriptorProto_ExtensionRan
 // @@protoc_insertion_point(class_specific_copy_from_start:google.protobuf.DescriptorProto.ExtensionRange)
   if (&from == this) return;
   Clear();
-  MergeFrom(from);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  if (from._internal_has_options()) {
+    _internal_mutable_options()->PROTOBUF_NAMESPACE_ID::ExtensionRangeOptions::MergeFrom(from._internal_options());
+  }
+  ::memcpy(&start_, &from.start_,
+    static_cast<size_t>(reinterpret_cast<char*>(&end_) -
+    reinterpret_cast<char*>(&start_)) + sizeof(end_));
 }
 
 bool DescriptorProto_ExtensionRange::IsInitialized() const {
@@ -2779,7 +2799,11 @@ void DescriptorProto_ReservedRange::CopyFrom(const DescriptorProto_ReservedRange
 // @@protoc_insertion_point(class_specific_copy_from_start:google.protobuf.DescriptorProto.ReservedRange)
   if (&from == this) return;
   Clear();
-  MergeFrom(from);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  ::memcpy(&start_, &from.start_,
+    static_cast<size_t>(reinterpret_cast<char*>(&end_) -
+    reinterpret_cast<char*>(&start_)) + sizeof(end_));
 }
 
 bool DescriptorProto_ReservedRange::IsInitialized() const {
@@ -2937,9 +2961,10 @@ const char* DescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
       // optional string name = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_name(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &name_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.DescriptorProto.name");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -2949,6 +2974,8 @@ const char* DescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
           ptr -= 1;
+          field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<18>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_field(), ptr);
@@ -2961,6 +2988,8 @@ const char* DescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
           ptr -= 1;
+          nested_type_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<26>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_nested_type(), ptr);
@@ -2973,6 +3002,8 @@ const char* DescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
           ptr -= 1;
+          enum_type_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<34>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_enum_type(), ptr);
@@ -2985,6 +3016,8 @@ const char* DescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
           ptr -= 1;
+          extension_range_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<42>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_extension_range(), ptr);
@@ -2997,6 +3030,8 @@ const char* DescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
       case 6:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
           ptr -= 1;
+          extension_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<50>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_extension(), ptr);
@@ -3016,6 +3051,8 @@ const char* DescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
       case 8:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
           ptr -= 1;
+          oneof_decl_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<66>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_oneof_decl(), ptr);
@@ -3028,6 +3065,8 @@ const char* DescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
       case 9:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
           ptr -= 1;
+          reserved_range_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<74>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_reserved_range(), ptr);
@@ -3430,6 +3469,8 @@ const char* ExtensionRangeOptions::_InternalParse(const char* ptr, ::PROTOBUF_NA
       case 999:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
           ptr -= 2;
+          uninterpreted_option_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<7994>(ptr));
           do {
             ptr += 2;
             ptr = ctx->ParseMessage(_internal_add_uninterpreted_option(), ptr);
@@ -3773,9 +3814,10 @@ const char* FieldDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // optional string name = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_name(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &name_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FieldDescriptorProto.name");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -3784,9 +3826,10 @@ const char* FieldDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // optional string extendee = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_extendee();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_extendee(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&extendee_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &extendee_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FieldDescriptorProto.extendee");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -3827,9 +3870,10 @@ const char* FieldDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // optional string type_name = 6;
       case 6:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
-          auto str = _internal_mutable_type_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_type_name(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&type_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &type_name_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FieldDescriptorProto.type_name");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -3838,9 +3882,10 @@ const char* FieldDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // optional string default_value = 7;
       case 7:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
-          auto str = _internal_mutable_default_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_default_value(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&default_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &default_value_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FieldDescriptorProto.default_value");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -3864,9 +3909,10 @@ const char* FieldDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // optional string json_name = 10;
       case 10:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
-          auto str = _internal_mutable_json_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_json_name(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&json_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &json_name_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FieldDescriptorProto.json_name");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -4178,7 +4224,29 @@ void FieldDescriptorProto::CopyFrom(const FieldDescriptorProto& from) {
 // @@protoc_insertion_point(class_specific_copy_from_start:google.protobuf.FieldDescriptorProto)
   if (&from == this) return;
   Clear();
-  MergeFrom(from);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  if (from._internal_has_name()) {
+    _internal_set_name(from._internal_name());
+  }
+  if (from._internal_has_extendee()) {
+    _internal_set_extendee(from._internal_extendee());
+  }
+  if (from._internal_has_type_name()) {
+    _internal_set_type_name(from._internal_type_name());
+  }
+  if (from._internal_has_default_value()) {
+    _internal_set_default_value(from._internal_default_value());
+  }
+  if (from._internal_has_json_name()) {
+    _internal_set_json_name(from._internal_json_name());
+  }
+  if (from._internal_has_options()) {
+    _internal_mutable_options()->PROTOBUF_NAMESPACE_ID::FieldOptions::MergeFrom(from._internal_options());
+  }
+  ::memcpy(&number_, &from.number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&type_) -
+    reinterpret_cast<char*>(&number_)) + sizeof(type_));
 }
 
 bool FieldDescriptorProto::IsInitialized() const {
@@ -4322,9 +4390,10 @@ const char* OneofDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       // optional string name = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_name(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &name_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.OneofDescriptorProto.name");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -4726,7 +4795,11 @@ void EnumDescriptorProto_EnumReservedRange::CopyFrom(const EnumDescriptorProto_E
 // @@protoc_insertion_point(class_specific_copy_from_start:google.protobuf.EnumDescriptorProto.EnumReservedRange)
   if (&from == this) return;
   Clear();
-  MergeFrom(from);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  ::memcpy(&start_, &from.start_,
+    static_cast<size_t>(reinterpret_cast<char*>(&end_) -
+    reinterpret_cast<char*>(&start_)) + sizeof(end_));
 }
 
 bool EnumDescriptorProto_EnumReservedRange::IsInitialized() const {
@@ -4869,9 +4942,10 @@ const char* EnumDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAME
       // optional string name = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_name(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &name_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.EnumDescriptorProto.name");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -4881,6 +4955,8 @@ const char* EnumDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAME
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
           ptr -= 1;
+          value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<18>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_value(), ptr);
@@ -4900,6 +4976,8 @@ const char* EnumDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NAME
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
           ptr -= 1;
+          reserved_range_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<34>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_reserved_range(), ptr);
@@ -5253,9 +5331,10 @@ const char* EnumValueDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF
       // optional string name = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_name(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &name_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.EnumValueDescriptorProto.name");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -5568,9 +5647,10 @@ const char* ServiceDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_N
       // optional string name = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_name(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &name_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.ServiceDescriptorProto.name");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -5580,6 +5660,8 @@ const char* ServiceDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_N
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
           ptr -= 1;
+          method_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<18>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_method(), ptr);
@@ -5920,9 +6002,10 @@ const char* MethodDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NA
       // optional string name = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_name(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &name_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.MethodDescriptorProto.name");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -5931,9 +6014,10 @@ const char* MethodDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NA
       // optional string input_type = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_input_type();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_input_type(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&input_type_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &input_type_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.MethodDescriptorProto.input_type");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -5942,9 +6026,10 @@ const char* MethodDescriptorProto::_InternalParse(const char* ptr, ::PROTOBUF_NA
       // optional string output_type = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          auto str = _internal_mutable_output_type();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_output_type(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&output_type_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &output_type_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.MethodDescriptorProto.output_type");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -6176,7 +6261,23 @@ void MethodDescriptorProto::CopyFrom(const MethodDescriptorProto& from) {
 // @@protoc_insertion_point(class_specific_copy_from_start:google.protobuf.MethodDescriptorProto)
   if (&from == this) return;
   Clear();
-  MergeFrom(from);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  if (from._internal_has_name()) {
+    _internal_set_name(from._internal_name());
+  }
+  if (from._internal_has_input_type()) {
+    _internal_set_input_type(from._internal_input_type());
+  }
+  if (from._internal_has_output_type()) {
+    _internal_set_output_type(from._internal_output_type());
+  }
+  if (from._internal_has_options()) {
+    _internal_mutable_options()->PROTOBUF_NAMESPACE_ID::MethodOptions::MergeFrom(from._internal_options());
+  }
+  ::memcpy(&client_streaming_, &from.client_streaming_,
+    static_cast<size_t>(reinterpret_cast<char*>(&server_streaming_) -
+    reinterpret_cast<char*>(&client_streaming_)) + sizeof(server_streaming_));
 }
 
 bool MethodDescriptorProto::IsInitialized() const {
@@ -6470,9 +6571,10 @@ const char* FileOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
       // optional string java_package = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_java_package();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_java_package(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&java_package_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &java_package_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FileOptions.java_package");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -6481,9 +6583,10 @@ const char* FileOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
       // optional string java_outer_classname = 8;
       case 8:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
-          auto str = _internal_mutable_java_outer_classname();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_java_outer_classname(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&java_outer_classname_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &java_outer_classname_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FileOptions.java_outer_classname");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -6512,9 +6615,10 @@ const char* FileOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
       // optional string go_package = 11;
       case 11:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
-          auto str = _internal_mutable_go_package();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_go_package(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&go_package_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &go_package_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FileOptions.go_package");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -6579,9 +6683,10 @@ const char* FileOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
       // optional string objc_class_prefix = 36;
       case 36:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          auto str = _internal_mutable_objc_class_prefix();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_objc_class_prefix(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&objc_class_prefix_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &objc_class_prefix_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FileOptions.objc_class_prefix");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -6590,9 +6695,10 @@ const char* FileOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
       // optional string csharp_namespace = 37;
       case 37:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          auto str = _internal_mutable_csharp_namespace();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_csharp_namespace(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&csharp_namespace_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &csharp_namespace_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FileOptions.csharp_namespace");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -6601,9 +6707,10 @@ const char* FileOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
       // optional string swift_prefix = 39;
       case 39:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
-          auto str = _internal_mutable_swift_prefix();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_swift_prefix(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&swift_prefix_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &swift_prefix_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FileOptions.swift_prefix");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -6612,9 +6719,10 @@ const char* FileOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
       // optional string php_class_prefix = 40;
       case 40:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
-          auto str = _internal_mutable_php_class_prefix();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_php_class_prefix(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&php_class_prefix_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &php_class_prefix_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FileOptions.php_class_prefix");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -6623,9 +6731,10 @@ const char* FileOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
       // optional string php_namespace = 41;
       case 41:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
-          auto str = _internal_mutable_php_namespace();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_php_namespace(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&php_namespace_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &php_namespace_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FileOptions.php_namespace");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -6642,9 +6751,10 @@ const char* FileOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
       // optional string php_metadata_namespace = 44;
       case 44:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
-          auto str = _internal_mutable_php_metadata_namespace();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_php_metadata_namespace(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&php_metadata_namespace_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &php_metadata_namespace_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FileOptions.php_metadata_namespace");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -6653,9 +6763,10 @@ const char* FileOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
       // optional string ruby_package = 45;
       case 45:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
-          auto str = _internal_mutable_ruby_package();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_ruby_package(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&ruby_package_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &ruby_package_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.FileOptions.ruby_package");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -6665,6 +6776,8 @@ const char* FileOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
       case 999:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
           ptr -= 2;
+          uninterpreted_option_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<7994>(ptr));
           do {
             ptr += 2;
             ptr = ctx->ParseMessage(_internal_add_uninterpreted_option(), ptr);
@@ -7150,7 +7263,43 @@ void FileOptions::CopyFrom(const FileOptions& from) {
 // @@protoc_insertion_point(class_specific_copy_from_start:google.protobuf.FileOptions)
   if (&from == this) return;
   Clear();
-  MergeFrom(from);
+  _extensions_.MergeFrom(from._extensions_);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  uninterpreted_option_.MergeFrom(from.uninterpreted_option_);
+  if (from._internal_has_java_package()) {
+    _internal_set_java_package(from._internal_java_package());
+  }
+  if (from._internal_has_java_outer_classname()) {
+    _internal_set_java_outer_classname(from._internal_java_outer_classname());
+  }
+  if (from._internal_has_go_package()) {
+    _internal_set_go_package(from._internal_go_package());
+  }
+  if (from._internal_has_objc_class_prefix()) {
+    _internal_set_objc_class_prefix(from._internal_objc_class_prefix());
+  }
+  if (from._internal_has_csharp_namespace()) {
+    _internal_set_csharp_namespace(from._internal_csharp_namespace());
+  }
+  if (from._internal_has_swift_prefix()) {
+    _internal_set_swift_prefix(from._internal_swift_prefix());
+  }
+  if (from._internal_has_php_class_prefix()) {
+    _internal_set_php_class_prefix(from._internal_php_class_prefix());
+  }
+  if (from._internal_has_php_namespace()) {
+    _internal_set_php_namespace(from._internal_php_namespace());
+  }
+  if (from._internal_has_php_metadata_namespace()) {
+    _internal_set_php_metadata_namespace(from._internal_php_metadata_namespace());
+  }
+  if (from._internal_has_ruby_package()) {
+    _internal_set_ruby_package(from._internal_ruby_package());
+  }
+  ::memcpy(&java_multiple_files_, &from.java_multiple_files_,
+    static_cast<size_t>(reinterpret_cast<char*>(&cc_enable_arenas_) -
+    reinterpret_cast<char*>(&java_multiple_files_)) + sizeof(cc_enable_arenas_));
 }
 
 bool FileOptions::IsInitialized() const {
@@ -7326,6 +7475,8 @@ const char* MessageOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE
       case 999:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
           ptr -= 2;
+          uninterpreted_option_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<7994>(ptr));
           do {
             ptr += 2;
             ptr = ctx->ParseMessage(_internal_add_uninterpreted_option(), ptr);
@@ -7516,7 +7667,13 @@ void MessageOptions::CopyFrom(const MessageOptions& from) {
 // @@protoc_insertion_point(class_specific_copy_from_start:google.protobuf.MessageOptions)
   if (&from == this) return;
   Clear();
-  MergeFrom(from);
+  _extensions_.MergeFrom(from._extensions_);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  uninterpreted_option_.MergeFrom(from.uninterpreted_option_);
+  ::memcpy(&message_set_wire_format_, &from.message_set_wire_format_,
+    static_cast<size_t>(reinterpret_cast<char*>(&map_entry_) -
+    reinterpret_cast<char*>(&message_set_wire_format_)) + sizeof(map_entry_));
 }
 
 bool MessageOptions::IsInitialized() const {
@@ -7713,6 +7870,8 @@ const char* FieldOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_I
       case 999:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
           ptr -= 2;
+          uninterpreted_option_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<7994>(ptr));
           do {
             ptr += 2;
             ptr = ctx->ParseMessage(_internal_add_uninterpreted_option(), ptr);
@@ -7935,7 +8094,13 @@ void FieldOptions::CopyFrom(const FieldOptions& from) {
 // @@protoc_insertion_point(class_specific_copy_from_start:google.protobuf.FieldOptions)
   if (&from == this) return;
   Clear();
-  MergeFrom(from);
+  _extensions_.MergeFrom(from._extensions_);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  uninterpreted_option_.MergeFrom(from.uninterpreted_option_);
+  ::memcpy(&ctype_, &from.ctype_,
+    static_cast<size_t>(reinterpret_cast<char*>(&jstype_) -
+    reinterpret_cast<char*>(&ctype_)) + sizeof(jstype_));
 }
 
 bool FieldOptions::IsInitialized() const {
@@ -8042,6 +8207,8 @@ const char* OneofOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_I
       case 999:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
           ptr -= 2;
+          uninterpreted_option_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<7994>(ptr));
           do {
             ptr += 2;
             ptr = ctx->ParseMessage(_internal_add_uninterpreted_option(), ptr);
@@ -8302,6 +8469,8 @@ const char* EnumOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
       case 999:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
           ptr -= 2;
+          uninterpreted_option_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<7994>(ptr));
           do {
             ptr += 2;
             ptr = ctx->ParseMessage(_internal_add_uninterpreted_option(), ptr);
@@ -8464,7 +8633,13 @@ void EnumOptions::CopyFrom(const EnumOptions& from) {
 // @@protoc_insertion_point(class_specific_copy_from_start:google.protobuf.EnumOptions)
   if (&from == this) return;
   Clear();
-  MergeFrom(from);
+  _extensions_.MergeFrom(from._extensions_);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  uninterpreted_option_.MergeFrom(from.uninterpreted_option_);
+  ::memcpy(&allow_alias_, &from.allow_alias_,
+    static_cast<size_t>(reinterpret_cast<char*>(&deprecated_) -
+    reinterpret_cast<char*>(&allow_alias_)) + sizeof(deprecated_));
 }
 
 bool EnumOptions::IsInitialized() const {
@@ -8589,6 +8764,8 @@ const char* EnumValueOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPA
       case 999:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
           ptr -= 2;
+          uninterpreted_option_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<7994>(ptr));
           do {
             ptr += 2;
             ptr = ctx->ParseMessage(_internal_add_uninterpreted_option(), ptr);
@@ -8851,6 +9028,8 @@ const char* ServiceOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE
       case 999:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
           ptr -= 2;
+          uninterpreted_option_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<7994>(ptr));
           do {
             ptr += 2;
             ptr = ctx->ParseMessage(_internal_add_uninterpreted_option(), ptr);
@@ -9137,6 +9316,8 @@ const char* MethodOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_
       case 999:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
           ptr -= 2;
+          uninterpreted_option_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<7994>(ptr));
           do {
             ptr += 2;
             ptr = ctx->ParseMessage(_internal_add_uninterpreted_option(), ptr);
@@ -9301,7 +9482,13 @@ void MethodOptions::CopyFrom(const MethodOptions& from) {
 // @@protoc_insertion_point(class_specific_copy_from_start:google.protobuf.MethodOptions)
   if (&from == this) return;
   Clear();
-  MergeFrom(from);
+  _extensions_.MergeFrom(from._extensions_);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  uninterpreted_option_.MergeFrom(from.uninterpreted_option_);
+  ::memcpy(&deprecated_, &from.deprecated_,
+    static_cast<size_t>(reinterpret_cast<char*>(&idempotency_level_) -
+    reinterpret_cast<char*>(&deprecated_)) + sizeof(idempotency_level_));
 }
 
 bool MethodOptions::IsInitialized() const {
@@ -9428,9 +9615,10 @@ const char* UninterpretedOption_NamePart::_InternalParse(const char* ptr, ::PROT
       // required string name_part = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_name_part();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_name_part(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&name_part_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &name_part_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.UninterpretedOption.NamePart.name_part");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -9750,6 +9938,8 @@ const char* UninterpretedOption::_InternalParse(const char* ptr, ::PROTOBUF_NAME
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
           ptr -= 1;
+          name_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<18>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_name(), ptr);
@@ -9761,9 +9951,10 @@ const char* UninterpretedOption::_InternalParse(const char* ptr, ::PROTOBUF_NAME
       // optional string identifier_value = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          auto str = _internal_mutable_identifier_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_identifier_value(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&identifier_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &identifier_value_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.UninterpretedOption.identifier_value");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -9796,17 +9987,18 @@ const char* UninterpretedOption::_InternalParse(const char* ptr, ::PROTOBUF_NAME
       // optional bytes string_value = 7;
       case 7:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
-          auto str = _internal_mutable_string_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_string_value(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&string_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
       // optional string aggregate_value = 8;
       case 8:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
-          auto str = _internal_mutable_aggregate_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_aggregate_value(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&aggregate_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &aggregate_value_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.UninterpretedOption.aggregate_value");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -10027,7 +10219,21 @@ void UninterpretedOption::CopyFrom(const UninterpretedOption& from) {
 // @@protoc_insertion_point(class_specific_copy_from_start:google.protobuf.UninterpretedOption)
   if (&from == this) return;
   Clear();
-  MergeFrom(from);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  name_.MergeFrom(from.name_);
+  if (from._internal_has_identifier_value()) {
+    _internal_set_identifier_value(from._internal_identifier_value());
+  }
+  if (from._internal_has_string_value()) {
+    _internal_set_string_value(from._internal_string_value());
+  }
+  if (from._internal_has_aggregate_value()) {
+    _internal_set_aggregate_value(from._internal_aggregate_value());
+  }
+  ::memcpy(&positive_int_value_, &from.positive_int_value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&double_value_) -
+    reinterpret_cast<char*>(&positive_int_value_)) + sizeof(double_value_));
 }
 
 bool UninterpretedOption::IsInitialized() const {
@@ -10187,9 +10393,10 @@ const char* SourceCodeInfo_Location::_InternalParse(const char* ptr, ::PROTOBUF_
       // optional string leading_comments = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          auto str = _internal_mutable_leading_comments();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_leading_comments(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&leading_comments_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &leading_comments_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.SourceCodeInfo.Location.leading_comments");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -10198,9 +10405,10 @@ const char* SourceCodeInfo_Location::_InternalParse(const char* ptr, ::PROTOBUF_
       // optional string trailing_comments = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          auto str = _internal_mutable_trailing_comments();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_trailing_comments(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&trailing_comments_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &trailing_comments_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.SourceCodeInfo.Location.trailing_comments");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -10523,6 +10731,8 @@ const char* SourceCodeInfo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
           ptr -= 1;
+          location_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<10>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_location(), ptr);
@@ -10770,9 +10980,10 @@ const char* GeneratedCodeInfo_Annotation::_InternalParse(const char* ptr, ::PROT
       // optional string source_file = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_source_file();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_source_file(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&source_file_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
           #ifndef NDEBUG
+          const std::string* str = &source_file_.Get();
           ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "google.protobuf.GeneratedCodeInfo.Annotation.source_file");
           #endif  // !NDEBUG
           CHK_(ptr);
@@ -10968,7 +11179,15 @@ void GeneratedCodeInfo_Annotation::CopyFrom(const GeneratedCodeInfo_Annotation&
 // @@protoc_insertion_point(class_specific_copy_from_start:google.protobuf.GeneratedCodeInfo.Annotation)
   if (&from == this) return;
   Clear();
-  MergeFrom(from);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  path_.MergeFrom(from.path_);
+  if (from._internal_has_source_file()) {
+    _internal_set_source_file(from._internal_source_file());
+  }
+  ::memcpy(&begin_, &from.begin_,
+    static_cast<size_t>(reinterpret_cast<char*>(&end_) -
+    reinterpret_cast<char*>(&begin_)) + sizeof(end_));
 }
 
 bool GeneratedCodeInfo_Annotation::IsInitialized() const {
@@ -11067,6 +11286,8 @@ const char* GeneratedCodeInfo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESP
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
           ptr -= 1;
+          annotation_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<10>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_annotation(), ptr);
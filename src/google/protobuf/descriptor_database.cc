@@ -34,6 +34,7 @@
 
 #include <google/protobuf/descriptor_database.h>
 
+#include <algorithm>
 #include <set>
 
 #include <google/protobuf/descriptor.pb.h>
@@ -389,13 +390,187 @@ bool SimpleDescriptorDatabase::MaybeCopy(const FileDescriptorProto* file,
 
 // -------------------------------------------------------------------
 
+namespace {
+
+// The parts of an extension's FieldDescriptorProto that
+// EncodedDescriptorDatabase indexes.  The strings point into the encoded file.
+struct EncodedFieldView {
+  StringPiece name;
+  StringPiece extendee;
+  int number = 0;
+};
+
+// The parts of a FileDescriptorProto that EncodedDescriptorDatabase indexes.
+// These are found by scanning the wire format rather than parsing the whole
+// file, and the strings point into the encoded file so that the index can
+// refer to them without copying.
+struct EncodedFileView {
+  StringPiece name;
+  StringPiece package;
+  // Names of the top-level messages, enums, services and extensions.
+  std::vector<StringPiece> symbols;
+  // All the extensions in the file, including those nested in messages.
+  std::vector<EncodedFieldView> extensions;
+};
+
+#define PROTOBUF_DESCRIPTOR_TAG(FIELD_NUMBER, TYPE) \
+  GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(               \
+      FIELD_NUMBER, internal::WireFormatLite::WIRETYPE_##TYPE)
+
+// Reads a length-delimited string and points `*output` at it within `data`,
+// the buffer that `input` is reading from.
+bool ScanString(io::CodedInputStream* input, const char* data,
+                StringPiece* output) {
+  uint32 size;
+  if (!input->ReadVarint32(&size)) return false;
+  const char* start = data + input->CurrentPosition();
+  if (!input->Skip(size)) return false;
+  *output = StringPiece(start, size);
+  return true;
+}
+
+// Reads the length of a submessage and calls `scan_body(input)` with the
+// input limited to it.  Fails if the submessage is truncated, or nested too
+// deeply.
+template <typename ScanBody>
+bool ScanSubmessage(io::CodedInputStream* input, ScanBody scan_body) {
+  uint32 size;
+  if (!input->ReadVarint32(&size)) return false;
+  auto limit = input->IncrementRecursionDepthAndPushLimit(size);
+  if (limit.second < 0) return false;
+  if (!scan_body(input)) return false;
+  return input->DecrementRecursionDepthAndPopLimit(limit.first);
+}
+
+// Scans a FieldDescriptorProto.
+bool ScanField(io::CodedInputStream* input, const char* data,
+               EncodedFieldView* field) {
+  while (uint32 tag = input->ReadTag()) {
+    switch (tag) {
+      case PROTOBUF_DESCRIPTOR_TAG(1, LENGTH_DELIMITED):
+        if (!ScanString(input, data, &field->name)) return false;
+        break;
+      case PROTOBUF_DESCRIPTOR_TAG(2, LENGTH_DELIMITED):
+        if (!ScanString(input, data, &field->extendee)) return false;
+        break;
+      case PROTOBUF_DESCRIPTOR_TAG(3, VARINT): {
+        uint32 number;
+        if (!input->ReadVarint32(&number)) return false;
+        field->number = static_cast<int32>(number);
+        break;
+      }
+      default:
+        if (!internal::WireFormatLite::SkipField(input, tag)) return false;
+    }
+  }
+  return true;
+}
+
+// Scans a DescriptorProto, EnumDescriptorProto or ServiceDescriptorProto for
+// its name.  If `extensions` is non-NULL the input is a DescriptorProto, and
+// the extensions declared in it and its nested types are appended to
+// `*extensions`.
+bool ScanNamedType(io::CodedInputStream* input, const char* data,
+                   StringPiece* name,
+                   std::vector<EncodedFieldView>* extensions) {
+  while (uint32 tag = input->ReadTag()) {
+    if (tag == PROTOBUF_DESCRIPTOR_TAG(1, LENGTH_DELIMITED)) {
+      if (!ScanString(input, data, name)) return false;
+    } else if (extensions != NULL &&
+               tag == PROTOBUF_DESCRIPTOR_TAG(3, LENGTH_DELIMITED)) {
+      // nested_type
+      StringPiece nested_name;
+      if (!ScanSubmessage(input, [&](io::CodedInputStream* input) {
+            return ScanNamedType(input, data, &nested_name, extensions);
+          })) {
+        return false;
+      }
+    } else if (extensions != NULL &&
+               tag == PROTOBUF_DESCRIPTOR_TAG(6, LENGTH_DELIMITED)) {
+      // extension
+      extensions->emplace_back();
+      EncodedFieldView* field = &extensions->back();
+      if (!ScanSubmessage(input, [&](io::CodedInputStream* input) {
+            return ScanField(input, data, field);
+          })) {
+        return false;
+      }
+    } else if (!internal::WireFormatLite::SkipField(input, tag)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Scans an encoded FileDescriptorProto.  Returns false if it is malformed.
+bool ScanFile(const void* encoded_file, int size, EncodedFileView* file) {
+  const char* data = static_cast<const char*>(encoded_file);
+  io::CodedInputStream input(reinterpret_cast<const uint8*>(data), size);
+  while (uint32 tag = input.ReadTag()) {
+    switch (tag) {
+      case PROTOBUF_DESCRIPTOR_TAG(1, LENGTH_DELIMITED):
+        if (!ScanString(&input, data, &file->name)) return false;
+        break;
+      case PROTOBUF_DESCRIPTOR_TAG(2, LENGTH_DELIMITED):
+        if (!ScanString(&input, data, &file->package)) return false;
+        break;
+      case PROTOBUF_DESCRIPTOR_TAG(4, LENGTH_DELIMITED):
+        file->symbols.emplace_back();
+        if (!ScanSubmessage(&input, [&](io::CodedInputStream* input) {
+              return ScanNamedType(input, data, &file->symbols.back(),
+                                   &file->extensions);
+            })) {
+          return false;
+        }
+        break;
+      case PROTOBUF_DESCRIPTOR_TAG(5, LENGTH_DELIMITED):
+        file->symbols.emplace_back();
+        if (!ScanSubmessage(&input, [&](io::CodedInputStream* input) {
+              return ScanNamedType(input, data, &file->symbols.back(), NULL);
+            })) {
+          return false;
+        }
+        break;
+      case PROTOBUF_DESCRIPTOR_TAG(6, LENGTH_DELIMITED):
+        file->symbols.emplace_back();
+        if (!ScanSubmessage(&input, [&](io::CodedInputStream* input) {
+              return ScanNamedType(input, data, &file->symbols.back(), NULL);
+            })) {
+          return false;
+        }
+        break;
+      case PROTOBUF_DESCRIPTOR_TAG(7, LENGTH_DELIMITED): {
+        file->extensions.emplace_back();
+        EncodedFieldView* field = &file->extensions.back();
+        if (!ScanSubmessage(&input, [&](io::CodedInputStream* input) {
+              return ScanField(input, data, field);
+            })) {
+          return false;
+        }
+        file->symbols.push_back(field->name);
+        break;
+      }
+      default:
+        if (!internal::WireFormatLite::SkipField(&input, tag)) return false;
+    }
+  }
+  return input.ConsumedEntireMessage();
+}
+
+#undef PROTOBUF_DESCRIPTOR_TAG
+
+}  // namespace
+
 class EncodedDescriptorDatabase::DescriptorIndex {
  public:
   using Value = std::pair<const void*, int>;
-  // Helpers to recursively add particular descriptors and all their contents
-  // to the index.
-  template <typename FileProto>
-  bool AddFile(const FileProto& file, Value value);
+  // Scans the encoded file and adds it and all its contents to the index.
+  // Returns false if the bytes are not a valid FileDescriptorProto, with
+  // `*parsed` set to false, or if the file conflicts with one already in the
+  // index.
+  bool AddFile(Value value, bool* parsed);
+  // Remembers the file, to be added by the next EnsureFlat().
+  void AddLazily(Value value) { pending_files_.push_back(value); }
 
   Value FindFile(StringPiece filename);
   Value FindSymbol(StringPiece name);
@@ -403,18 +578,13 @@ class EncodedDescriptorDatabase::DescriptorIndex {
   Value FindExtension(StringPiece containing_type, int field_number);
   bool FindAllExtensionNumbers(StringPiece containing_type,
                                std::vector<int>* output);
-  void FindAllFileNames(std::vector<std::string>* output) const;
+  void FindAllFileNames(std::vector<std::string>* output);
 
  private:
   friend class EncodedDescriptorDatabase;
 
   bool AddSymbol(StringPiece symbol);
-
-  template <typename DescProto>
-  bool AddNestedExtensions(StringPiece filename,
-                           const DescProto& message_type);
-  template <typename FieldProto>
-  bool AddExtension(StringPiece filename, const FieldProto& field);
+  bool AddExtension(StringPiece filename, const EncodedFieldView& field);
 
   // All the maps below have two representations:
   //  - a std::set<> where we insert initially.
@@ -425,10 +595,33 @@ class EncodedDescriptorDatabase::DescriptorIndex {
 
   void EnsureFlat();
 
-  using String = std::string;
+  // Files passed to AddLazily() that have not been indexed yet.
+  std::vector<Value> pending_files_;
+  // Indexes all of pending_files_ at once, straight into the flat arrays.
+  void AddPendingFiles();
+  // Whether AddPendingFiles() dies on invalid or conflicting files.
+  bool lazy_errors_fatal_ = false;
+
+  // Names are stored as a position inside the encoded file they were scanned
+  // from, which makes every entry a few bytes and saves a heap allocation
+  // per name.
+  struct String {
+    uint32 offset;
+    uint32 size;
+  };
 
-  String EncodeString(StringPiece str) const { return String(str); }
-  StringPiece DecodeString(const String& str, int) const { return str; }
+  // `str` must point into the file most recently pushed into all_values_.
+  String EncodeString(StringPiece str) const {
+    if (str.empty()) return {0, 0};
+    return {static_cast<uint32>(
+                str.data() - static_cast<const char*>(all_values_.back().data)),
+            static_cast<uint32>(str.size())};
+  }
+  StringPiece DecodeString(const String& str, int data_offset) const {
+    return StringPiece(
+        static_cast<const char*>(all_values_[data_offset].data) + str.offset,
+        str.size);
+  }
 
   struct EncodedEntry {
     // Do not use `Value` here to avoid the padding of that object.
@@ -486,11 +679,6 @@ class EncodedDescriptorDatabase::DescriptorIndex {
   struct SymbolCompare {
     const DescriptorIndex& index;
 
-    std::string AsString(const SymbolEntry& entry) const {
-      return entry.AsString(index);
-    }
-    static StringPiece AsString(StringPiece str) { return str; }
-
     std::pair<StringPiece, StringPiece> GetParts(
         const SymbolEntry& entry) const {
       auto package = entry.package(index);
@@ -502,6 +690,21 @@ class EncodedDescriptorDatabase::DescriptorIndex {
       return {str, {}};
     }
 
+    // The full name for a pair of parts is `first`, followed by a '.' and
+    // `second` if `second` is non-null.  These walk through it without
+    // building the whole string.
+    static size_t FullSize(const std::pair<StringPiece, StringPiece>& parts) {
+      return parts.second.data() == nullptr
+                 ? parts.first.size()
+                 : parts.first.size() + 1 + parts.second.size();
+    }
+    static char FullCharAt(const std::pair<StringPiece, StringPiece>& parts,
+                           size_t i) {
+      if (i < parts.first.size()) return parts.first[i];
+      if (i == parts.first.size()) return '.';
+      return parts.second[i - parts.first.size() - 1];
+    }
+
     template <typename T, typename U>
     bool operator()(const T& lhs, const U& rhs) const {
       auto lhs_parts = GetParts(lhs);
@@ -516,7 +719,17 @@ class EncodedDescriptorDatabase::DescriptorIndex {
       } else if (lhs_parts.first.size() == rhs_parts.first.size()) {
         return lhs_parts.second < rhs_parts.second;
       }
-      return AsString(lhs) < AsString(rhs);
+      // One package is a prefix of the other, so compare the rest of the
+      // full names.
+      size_t lhs_size = FullSize(lhs_parts);
+      size_t rhs_size = FullSize(rhs_parts);
+      for (size_t i = std::min(lhs_parts.first.size(), rhs_parts.first.size());
+           i < std::min(lhs_size, rhs_size); i++) {
+        unsigned char lhs_char = FullCharAt(lhs_parts, i);
+        unsigned char rhs_char = FullCharAt(rhs_parts, i);
+        if (lhs_char != rhs_char) return lhs_char < rhs_char;
+      }
+      return lhs_size < rhs_size;
     }
   };
   std::set<SymbolEntry, SymbolCompare> by_symbol_{SymbolCompare{*this}};
@@ -553,16 +766,25 @@ class EncodedDescriptorDatabase::DescriptorIndex {
 
 bool EncodedDescriptorDatabase::Add(const void* encoded_file_descriptor,
                                     int size) {
-  google::protobuf::Arena arena;
-  auto* file = google::protobuf::Arena::CreateMessage<FileDescriptorProto>(&arena);
-  if (file->ParseFromArray(encoded_file_descriptor, size)) {
-    return index_->AddFile(*file,
-                           std::make_pair(encoded_file_descriptor, size));
-  } else {
+  bool parsed;
+  if (index_->AddFile(std::make_pair(encoded_file_descriptor, size),
+                      &parsed)) {
+    return true;
+  }
+  if (!parsed) {
     GOOGLE_LOG(ERROR) << "Invalid file descriptor data passed to "
                   "EncodedDescriptorDatabase::Add().";
-    return false;
   }
+  return false;
+}
+
+void EncodedDescriptorDatabase::AddLazily(const void* encoded_file_descriptor,
+                                          int size) {
+  index_->AddLazily(std::make_pair(encoded_file_descriptor, size));
+}
+
+void EncodedDescriptorDatabase::SetLazyErrorsFatal(bool fatal) {
+  index_->lazy_errors_fatal_ = fatal;
 }
 
 bool EncodedDescriptorDatabase::AddCopy(const void* encoded_file_descriptor,
@@ -623,41 +845,36 @@ bool EncodedDescriptorDatabase::FindAllExtensionNumbers(
   return index_->FindAllExtensionNumbers(extendee_type, output);
 }
 
-template <typename FileProto>
-bool EncodedDescriptorDatabase::DescriptorIndex::AddFile(const FileProto& file,
-                                                         Value value) {
+bool EncodedDescriptorDatabase::DescriptorIndex::AddFile(Value value,
+                                                         bool* parsed) {
+  EncodedFileView file;
+  *parsed = ScanFile(value.first, value.second, &file);
+  if (!*parsed) return false;
+
   // We push `value` into the array first. This is important because the AddXXX
   // functions below will expect it to be there.
-  all_values_.push_back({value.first, value.second});
+  all_values_.push_back({value.first, value.second, {0, 0}});
 
-  if (!ValidateSymbolName(file.package())) {
-    GOOGLE_LOG(ERROR) << "Invalid package name: " << file.package();
+  if (!ValidateSymbolName(file.package)) {
+    GOOGLE_LOG(ERROR) << "Invalid package name: " << file.package;
     return false;
   }
-  all_values_.back().encoded_package = EncodeString(file.package());
+  all_values_.back().encoded_package = EncodeString(file.package);
 
   if (!InsertIfNotPresent(
           &by_name_, FileEntry{static_cast<int>(all_values_.size() - 1),
-                               EncodeString(file.name())}) ||
+                               EncodeString(file.name)}) ||
       std::binary_search(by_name_flat_.begin(), by_name_flat_.end(),
-                         file.name(), by_name_.key_comp())) {
-    GOOGLE_LOG(ERROR) << "File already exists in database: " << file.name();
+                         file.name, by_name_.key_comp())) {
+    GOOGLE_LOG(ERROR) << "File already exists in database: " << file.name;
     return false;
   }
 
-  for (const auto& message_type : file.message_type()) {
-    if (!AddSymbol(message_type.name())) return false;
-    if (!AddNestedExtensions(file.name(), message_type)) return false;
-  }
-  for (const auto& enum_type : file.enum_type()) {
-    if (!AddSymbol(enum_type.name())) return false;
+  for (StringPiece symbol : file.symbols) {
+    if (!AddSymbol(symbol)) return false;
   }
-  for (const auto& extension : file.extension()) {
-    if (!AddSymbol(extension.name())) return false;
-    if (!AddExtension(file.name(), extension)) return false;
-  }
-  for (const auto& service : file.service()) {
-    if (!AddSymbol(service.name())) return false;
+  for (const auto& extension : file.extensions) {
+    if (!AddExtension(file.name, extension)) return false;
   }
 
   return true;
@@ -730,36 +947,23 @@ bool EncodedDescriptorDatabase::DescriptorIndex::AddSymbol(
   return true;
 }
 
-template <typename DescProto>
-bool EncodedDescriptorDatabase::DescriptorIndex::AddNestedExtensions(
-    StringPiece filename, const DescProto& message_type) {
-  for (const auto& nested_type : message_type.nested_type()) {
-    if (!AddNestedExtensions(filename, nested_type)) return false;
-  }
-  for (const auto& extension : message_type.extension()) {
-    if (!AddExtension(filename, extension)) return false;
-  }
-  return true;
-}
-
-template <typename FieldProto>
 bool EncodedDescriptorDatabase::DescriptorIndex::AddExtension(
-    StringPiece filename, const FieldProto& field) {
-  if (!field.extendee().empty() && field.extendee()[0] == '.') {
+    StringPiece filename, const EncodedFieldView& field) {
+  if (!field.extendee.empty() && field.extendee[0] == '.') {
     // The extension is fully-qualified.  We can use it as a lookup key in
     // the by_symbol_ table.
     if (!InsertIfNotPresent(
             &by_extension_,
             ExtensionEntry{static_cast<int>(all_values_.size() - 1),
-                           EncodeString(field.extendee()), field.number()}) ||
+                           EncodeString(field.extendee), field.number}) ||
         std::binary_search(
             by_extension_flat_.begin(), by_extension_flat_.end(),
-            std::make_pair(field.extendee().substr(1), field.number()),
+            std::make_pair(field.extendee.substr(1), field.number),
             by_extension_.key_comp())) {
       GOOGLE_LOG(ERROR) << "Extension conflicts with extension already in database: "
                     "extend "
-                 << field.extendee() << " { " << field.name() << " = "
-                 << field.number() << " } from:" << filename;
+                 << field.extendee << " { " << field.name << " = "
+                 << field.number << " } from:" << filename;
       return false;
     }
   } else {
@@ -813,7 +1017,153 @@ static void MergeIntoFlat(std::set<T, Less>* s, std::vector<T>* flat) {
   s->clear();
 }
 
+// Calls `conflict(kept, entry)` for each entry of the sorted `flat` after the
+// first, where `kept` is the last entry for which it returned false.
+template <typename T, typename Conflict>
+static void FindConflicts(const std::vector<T>& flat, Conflict conflict) {
+  if (flat.empty()) return;
+  auto kept = flat.begin();
+  for (auto it = kept + 1; it != flat.end(); ++it) {
+    if (!conflict(*kept, *it)) kept = it;
+  }
+}
+
+// Removes the entries of files marked in `rejected`.
+template <typename T>
+static void RemoveRejected(std::vector<T>* flat,
+                           const std::vector<bool>& rejected) {
+  flat->erase(std::remove_if(flat->begin(), flat->end(),
+                             [&rejected](const T& entry) {
+                               return rejected[entry.data_offset];
+                             }),
+              flat->end());
+}
+
+void EncodedDescriptorDatabase::DescriptorIndex::AddPendingFiles() {
+  // Rather than inserting the entries one at a time into the sets and
+  // checking each for conflicts as it goes in, as AddFile() does, append them
+  // all to the flat arrays, sort those once and then find the conflicts in a
+  // single pass.  Of two conflicting files, the one added later is rejected,
+  // and all of its entries are removed so that no lookup can find it.
+  std::vector<Value> pending;
+  pending.swap(pending_files_);
+  std::vector<bool> rejected(all_values_.size() + pending.size());
+  bool failed = false;
+  for (const Value& value : pending) {
+    EncodedFileView file;
+    if (!ScanFile(value.first, value.second, &file)) {
+      GOOGLE_LOG(ERROR) << "Invalid file descriptor data passed to "
+                    "EncodedDescriptorDatabase::AddLazily().";
+      failed = true;
+      continue;
+    }
+    if (!ValidateSymbolName(file.package)) {
+      GOOGLE_LOG(ERROR) << "Invalid package name: " << file.package;
+      failed = true;
+      continue;
+    }
+    all_values_.push_back({value.first, value.second, {0, 0}});
+    all_values_.back().encoded_package = EncodeString(file.package);
+    int data_offset = static_cast<int>(all_values_.size() - 1);
+
+    by_name_flat_.push_back({data_offset, EncodeString(file.name)});
+    for (StringPiece symbol : file.symbols) {
+      if (!ValidateSymbolName(symbol)) {
+        GOOGLE_LOG(ERROR) << "Invalid symbol name: " << symbol;
+        rejected[data_offset] = true;
+        continue;
+      }
+      by_symbol_flat_.push_back({data_offset, EncodeString(symbol)});
+    }
+    for (const auto& extension : file.extensions) {
+      // As in AddExtension(), only fully-qualified extendees can be indexed.
+      if (!extension.extendee.empty() && extension.extendee[0] == '.') {
+        by_extension_flat_.push_back(
+            {data_offset, EncodeString(extension.extendee), extension.number});
+      }
+    }
+  }
+  // Files are numbered in the order they were added, and those in the index
+  // already never conflict with each other.
+  auto reject = [&rejected](int a, int b) {
+    rejected[std::max(a, b)] = true;
+  };
+
+  std::stable_sort(by_name_flat_.begin(), by_name_flat_.end(),
+                   by_name_.key_comp());
+  FindConflicts(by_name_flat_, [&](const FileEntry& kept,
+                                   const FileEntry& entry) {
+    if (kept.name(*this) != entry.name(*this)) return false;
+    GOOGLE_LOG(ERROR) << "File already exists in database: " << entry.name(*this);
+    reject(kept.data_offset, entry.data_offset);
+    return true;
+  });
+
+  // Symbols that are a prefix of another are sorted right before it, so a
+  // conflict is always with the last symbol kept.
+  std::stable_sort(by_symbol_flat_.begin(), by_symbol_flat_.end(),
+                   by_symbol_.key_comp());
+  // The full names are built in reused buffers to avoid an allocation for
+  // every symbol.
+  auto full_name = [this](const SymbolEntry& entry, std::string* output) {
+    StringPiece package = entry.package(*this);
+    output->clear();
+    StrAppend(output, package, package.empty() ? "" : ".",
+              entry.symbol(*this));
+  };
+  std::string kept_name, name;
+  if (!by_symbol_flat_.empty()) full_name(by_symbol_flat_.front(), &kept_name);
+  FindConflicts(by_symbol_flat_, [&](const SymbolEntry& kept,
+                                     const SymbolEntry& entry) {
+    full_name(entry, &name);
+    if (!IsSubSymbol(kept_name, name)) {
+      // `entry` is the one kept now.
+      kept_name.swap(name);
+      return false;
+    }
+    GOOGLE_LOG(ERROR) << "Symbol name \"" << name
+               << "\" conflicts with the existing symbol \"" << kept_name
+               << "\".";
+    reject(kept.data_offset, entry.data_offset);
+    return true;
+  });
+
+  std::stable_sort(by_extension_flat_.begin(), by_extension_flat_.end(),
+                   by_extension_.key_comp());
+  FindConflicts(by_extension_flat_, [&](const ExtensionEntry& kept,
+                                        const ExtensionEntry& entry) {
+    if (kept.extendee(*this) != entry.extendee(*this) ||
+        kept.extension_number != entry.extension_number) {
+      return false;
+    }
+    GOOGLE_LOG(ERROR) << "Extension conflicts with extension already in database: "
+                  "extend ."
+               << entry.extendee(*this) << " { " << entry.extension_number
+               << " }";
+    reject(kept.data_offset, entry.data_offset);
+    return true;
+  });
+
+  if (std::find(rejected.begin(), rejected.end(), true) != rejected.end()) {
+    failed = true;
+    RemoveRejected(&by_name_flat_, rejected);
+    RemoveRejected(&by_symbol_flat_, rejected);
+    RemoveRejected(&by_extension_flat_, rejected);
+  }
+  GOOGLE_LOG_IF(FATAL, failed && lazy_errors_fatal_)
+      << "Invalid or conflicting files were passed to "
+         "EncodedDescriptorDatabase::AddLazily().";
+}
+
 void EncodedDescriptorDatabase::DescriptorIndex::EnsureFlat() {
+  if (!pending_files_.empty()) {
+    // Anything still in the sets is merged first, so that the flat arrays
+    // are sorted in the order the files were added.
+    MergeIntoFlat(&by_name_, &by_name_flat_);
+    MergeIntoFlat(&by_symbol_, &by_symbol_flat_);
+    MergeIntoFlat(&by_extension_, &by_extension_flat_);
+    AddPendingFiles();
+  }
   all_values_.shrink_to_fit();
   // Merge each of the sets into their flat counterpart.
   MergeIntoFlat(&by_name_, &by_name_flat_);
@@ -840,13 +1190,11 @@ bool EncodedDescriptorDatabase::DescriptorIndex::FindAllExtensionNumbers(
 }
 
 void EncodedDescriptorDatabase::DescriptorIndex::FindAllFileNames(
-    std::vector<std::string>* output) const {
-  output->resize(by_name_.size() + by_name_flat_.size());
+    std::vector<std::string>* output) {
+  EnsureFlat();
+
+  output->resize(by_name_flat_.size());
   int i = 0;
-  for (const auto& entry : by_name_) {
-    (*output)[i] = std::string(entry.name(*this));
-    i++;
-  }
   for (const auto& entry : by_name_flat_) {
     (*output)[i] = std::string(entry.name(*this));
     i++;
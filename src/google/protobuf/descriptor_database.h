@@ -280,6 +280,8 @@ class PROTOBUF_EXPORT SimpleDescriptorDatabase : public DescriptorDatabase {
 
 // Very similar to SimpleDescriptorDatabase, but stores all the descriptors
 // as raw bytes and generally tries to use as little memory as possible.
+// The index is kept in sorted flat arrays whose names point into the encoded
+// bytes, so it does not make a heap copy of any file or symbol name.
 //
 // The same caveats regarding FindFileContainingExtension() apply as with
 // SimpleDescriptorDatabase.
@@ -300,6 +302,19 @@ class PROTOBUF_EXPORT EncodedDescriptorDatabase : public DescriptorDatabase {
   // need to keep it around.
   bool AddCopy(const void* encoded_file_descriptor, int size);
 
+  // Like Add(), but the file is not indexed until the first lookup, so adding
+  // is just a matter of remembering the pointer.  Since the bytes are not
+  // looked at here, invalid or conflicting files cannot be reported to the
+  // caller; they are logged and skipped when the index is built.  Of two
+  // conflicting files, the one added later is skipped entirely.  This is
+  // what generated code uses to register its files during static
+  // initialization.
+  void AddLazily(const void* encoded_file_descriptor, int size);
+
+  // Makes the files skipped by AddLazily() a fatal error instead, as a
+  // failing Add() is for the generated database.
+  void SetLazyErrorsFatal(bool fatal);
+
   // Like FindFileContainingSymbol but returns only the name of the file.
   bool FindNameOfFileContainingSymbol(const std::string& symbol_name,
                                       std::string* output);
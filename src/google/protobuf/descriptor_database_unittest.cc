@@ -517,6 +517,133 @@ TEST(EncodedDescriptorDatabaseExtraTest, FindNameOfFileContainingSymbol) {
   EXPECT_FALSE(db.FindNameOfFileContainingSymbol("baz.Baz", &filename));
 }
 
+TEST(EncodedDescriptorDatabaseExtraTest, AddLazily) {
+  FileDescriptorProto foo, bar, conflict;
+  ASSERT_TRUE(TextFormat::ParseFromString(
+      "name: \"foo.proto\" "
+      "package: \"foo\" "
+      "message_type { "
+      "  name: \"Foo\" "
+      "  extension_range { start: 1 end: 100 } "
+      "}",
+      &foo));
+  ASSERT_TRUE(TextFormat::ParseFromString(
+      "name: \"bar.proto\" "
+      "package: \"bar\" "
+      "message_type { "
+      "  name: \"Bar\" "
+      "  nested_type { "
+      "    name: \"Nested\" "
+      "    extension { name: \"qux\" extendee: \".foo.Foo\" number: 5 } "
+      "  } "
+      "} "
+      "extension { name: \"baz\" extendee: \".foo.Foo\" number: 7 }",
+      &bar));
+  ASSERT_TRUE(TextFormat::ParseFromString(
+      "name: \"conflict.proto\" "
+      "package: \"foo\" "
+      "message_type { name: \"Foo\" }",
+      &conflict));
+  std::string data1 = foo.SerializeAsString();
+  std::string data2 = bar.SerializeAsString();
+  std::string data3 = conflict.SerializeAsString();
+
+  EncodedDescriptorDatabase db;
+  db.AddLazily(data1.data(), data1.size());
+  db.AddLazily(data2.data(), data2.size());
+  db.AddLazily(data3.data(), data3.size());
+
+  ScopedMemoryLog log;
+  FileDescriptorProto file;
+  EXPECT_TRUE(db.FindFileContainingSymbol("foo.Foo", &file));
+  EXPECT_EQ("foo.proto", file.name());
+  EXPECT_TRUE(db.FindFileContainingSymbol("bar.Bar.Nested", &file));
+  EXPECT_EQ("bar.proto", file.name());
+  EXPECT_TRUE(db.FindFileContainingSymbol("bar.baz", &file));
+  EXPECT_EQ("bar.proto", file.name());
+  EXPECT_TRUE(db.FindFileContainingExtension("foo.Foo", 5, &file));
+  EXPECT_EQ("bar.proto", file.name());
+
+  std::vector<int> numbers;
+  EXPECT_TRUE(db.FindAllExtensionNumbers("foo.Foo", &numbers));
+  EXPECT_THAT(numbers, testing::ElementsAre(5, 7));
+
+  // The conflicting file is reported when the index is built.
+  std::vector<std::string> errors = log.GetMessages(ERROR);
+  ASSERT_EQ(1, errors.size());
+  EXPECT_THAT(errors[0], testing::HasSubstr("foo.Foo"));
+
+  std::vector<std::string> all_files;
+  db.FindAllFileNames(&all_files);
+  EXPECT_THAT(all_files, testing::ElementsAre("bar.proto", "foo.proto"));
+  EXPECT_FALSE(db.FindFileByName("conflict.proto", &file));
+}
+
+TEST(EncodedDescriptorDatabaseExtraTest, AddLazilySkipsWholeFile) {
+  // "foo.Foo" sorts before "foo.Foo.Bar", but since later.proto was added
+  // after earlier.proto, it is later.proto that is skipped, with all of its
+  // symbols and extensions.
+  FileDescriptorProto earlier, later;
+  ASSERT_TRUE(TextFormat::ParseFromString(
+      "name: \"earlier.proto\" "
+      "package: \"foo.Foo\" "
+      "message_type { "
+      "  name: \"Bar\" "
+      "  extension_range { start: 1 end: 100 } "
+      "}",
+      &earlier));
+  ASSERT_TRUE(TextFormat::ParseFromString(
+      "name: \"later.proto\" "
+      "package: \"foo\" "
+      "message_type { name: \"Foo\" } "
+      "message_type { name: \"Other\" } "
+      "extension { name: \"ext\" extendee: \".foo.Foo.Bar\" number: 5 }",
+      &later));
+  std::string data1 = earlier.SerializeAsString();
+  std::string data2 = later.SerializeAsString();
+
+  EncodedDescriptorDatabase db;
+  db.AddLazily(data1.data(), data1.size());
+  db.AddLazily(data2.data(), data2.size());
+
+  ScopedMemoryLog log;
+  FileDescriptorProto file;
+  EXPECT_TRUE(db.FindFileContainingSymbol("foo.Foo.Bar", &file));
+  EXPECT_EQ("earlier.proto", file.name());
+  EXPECT_FALSE(db.FindFileContainingSymbol("foo.Other", &file));
+  EXPECT_FALSE(db.FindFileContainingExtension("foo.Foo.Bar", 5, &file));
+  EXPECT_FALSE(db.FindFileByName("later.proto", &file));
+  EXPECT_EQ(1, log.GetMessages(ERROR).size());
+}
+
+#ifdef PROTOBUF_HAS_DEATH_TEST
+TEST(EncodedDescriptorDatabaseExtraTest, AddLazilyFatalConflict) {
+  FileDescriptorProto file;
+  file.set_name("foo.proto");
+  std::string data = file.SerializeAsString();
+
+  EncodedDescriptorDatabase db;
+  db.SetLazyErrorsFatal(true);
+  db.AddLazily(data.data(), data.size());
+  db.AddLazily(data.data(), data.size());
+  std::vector<std::string> all_files;
+  EXPECT_DEATH(db.FindAllFileNames(&all_files), "AddLazily");
+}
+#endif  // PROTOBUF_HAS_DEATH_TEST
+
+TEST(EncodedDescriptorDatabaseExtraTest, RejectsInvalidData) {
+  FileDescriptorProto f;
+  f.set_name("foo.proto");
+  f.add_message_type()->set_name("Foo");
+  std::string data = f.SerializeAsString();
+
+  EncodedDescriptorDatabase db;
+  ScopedMemoryLog log;
+  EXPECT_FALSE(db.Add(data.data(), data.size() - 1));
+  EXPECT_EQ(1, log.GetMessages(ERROR).size());
+  EXPECT_TRUE(db.Add(data.data(), data.size()));
+}
+
 TEST(SimpleDescriptorDatabaseExtraTest, FindAllFileNames) {
   FileDescriptorProto f;
   f.set_name("foo.proto");
@@ -0,0 +1,534 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/descriptor_snapshot.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <tuple>
+
+#include <google/protobuf/stubs/logging.h>
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/coded_stream.h>
+
+#include <google/protobuf/port_def.inc>
+
+namespace google {
+namespace protobuf {
+
+// Snapshot layout.  All integers are little-endian uint32s, and all offsets
+// are relative to the start of the snapshot.
+//
+//   header:      magic "PBDS", version, then (count, offset) for each of the
+//                file, symbol and extension tables.
+//   files:       (name offset, name size, file offset, file size), sorted by
+//                name.
+//   symbols:     (name offset, name size, file index), sorted by name.  Only
+//                top-level symbols are indexed, as in EncodedDescriptorDatabase.
+//   extensions:  (extendee offset, extendee size, number, file index), sorted
+//                by extendee, then number.  The extendee has no leading dot.
+//   data:        names and encoded FileDescriptorProtos.
+
+namespace {
+
+const char kMagic[4] = {'P', 'B', 'D', 'S'};
+const uint32 kVersion = 1;
+const int kHeaderWords = 8;
+const int kFileEntryWords = 4;
+const int kSymbolEntryWords = 3;
+const int kExtensionEntryWords = 4;
+
+// Returns the index'th word of the table starting at p.
+inline uint32 ReadWord(const char* p, size_t index) {
+  uint32 value;
+  io::CodedInputStream::ReadLittleEndian32FromArray(
+      reinterpret_cast<const uint8*>(p) + index * 4, &value);
+  return value;
+}
+
+inline void AppendWord(uint32 value, std::string* output) {
+  uint8 bytes[4];
+  io::CodedOutputStream::WriteLittleEndian32ToArray(value, bytes);
+  output->append(reinterpret_cast<const char*>(bytes), 4);
+}
+
+struct SymbolEntry {
+  std::string name;
+  int file_index;
+
+  bool operator<(const SymbolEntry& other) const { return name < other.name; }
+};
+
+struct ExtensionEntry {
+  std::string extendee;
+  int number;
+  int file_index;
+
+  bool operator<(const ExtensionEntry& other) const {
+    return std::tie(extendee, number) < std::tie(other.extendee, other.number);
+  }
+};
+
+void AddExtensions(const RepeatedPtrField<FieldDescriptorProto>& fields,
+                   int file_index, std::vector<ExtensionEntry>* extensions) {
+  for (const FieldDescriptorProto& field : fields) {
+    // Relative extendee names can only be resolved by building the file.
+    if (field.extendee().empty() || field.extendee()[0] != '.') continue;
+    ExtensionEntry entry = {field.extendee().substr(1), field.number(),
+                            file_index};
+    extensions->push_back(entry);
+  }
+}
+
+void AddNestedExtensions(const DescriptorProto& message, int file_index,
+                         std::vector<ExtensionEntry>* extensions) {
+  AddExtensions(message.extension(), file_index, extensions);
+  for (const DescriptorProto& nested : message.nested_type()) {
+    AddNestedExtensions(nested, file_index, extensions);
+  }
+}
+
+}  // namespace
+
+SnapshotDescriptorDatabase::SnapshotDescriptorDatabase()
+    : data_(nullptr),
+      size_(0),
+      file_count_(0),
+      files_(nullptr),
+      symbol_count_(0),
+      symbols_(nullptr),
+      extension_count_(0),
+      extensions_(nullptr),
+      mapped_data_(nullptr),
+      mapped_size_(0) {}
+
+SnapshotDescriptorDatabase::~SnapshotDescriptorDatabase() {
+#ifndef _WIN32
+  if (mapped_data_ != nullptr) munmap(mapped_data_, mapped_size_);
+#endif
+}
+
+bool SnapshotDescriptorDatabase::BuildSnapshot(const FileDescriptorSet& files,
+                                               std::string* output) {
+  std::vector<std::pair<std::string, int> > names;
+  std::vector<SymbolEntry> symbols;
+  std::vector<ExtensionEntry> extensions;
+  for (int i = 0; i < files.file_size(); i++) {
+    const FileDescriptorProto& file = files.file(i);
+    names.push_back(std::make_pair(file.name(), i));
+    std::string prefix = file.package().empty() ? "" : file.package() + ".";
+    for (const DescriptorProto& message : file.message_type()) {
+      symbols.push_back({prefix + message.name(), i});
+      AddNestedExtensions(message, i, &extensions);
+    }
+    for (const EnumDescriptorProto& enum_type : file.enum_type()) {
+      symbols.push_back({prefix + enum_type.name(), i});
+    }
+    for (const FieldDescriptorProto& extension : file.extension()) {
+      symbols.push_back({prefix + extension.name(), i});
+    }
+    for (const ServiceDescriptorProto& service : file.service()) {
+      symbols.push_back({prefix + service.name(), i});
+    }
+    AddExtensions(file.extension(), i, &extensions);
+  }
+
+  std::sort(names.begin(), names.end());
+  for (size_t i = 1; i < names.size(); i++) {
+    if (names[i].first == names[i - 1].first) {
+      GOOGLE_LOG(ERROR) << "File already exists in snapshot: " << names[i].first;
+      return false;
+    }
+  }
+  // The symbol and extension tables refer to files by their position in the
+  // file table.
+  std::vector<int> file_positions(files.file_size());
+  for (size_t i = 0; i < names.size(); i++) {
+    file_positions[names[i].second] = i;
+  }
+  std::stable_sort(symbols.begin(), symbols.end());
+  for (size_t i = 1; i < symbols.size(); i++) {
+    if (symbols[i].name == symbols[i - 1].name) {
+      GOOGLE_LOG(ERROR) << "Symbol name \"" << symbols[i].name
+                 << "\" conflicts with the existing symbol \""
+                 << symbols[i - 1].name << "\".";
+      return false;
+    }
+  }
+  std::stable_sort(extensions.begin(), extensions.end());
+  for (size_t i = 1; i < extensions.size(); i++) {
+    if (!(extensions[i - 1] < extensions[i])) {
+      GOOGLE_LOG(ERROR) << "Extension conflicts with extension already in "
+                    "snapshot: extend "
+                 << extensions[i].extendee << " { "
+                 << extensions[i].number << " }";
+      return false;
+    }
+  }
+
+  // Lay out the data section first so that the tables can refer to it.
+  size_t data_offset =
+      4 * (kHeaderWords + kFileEntryWords * names.size() +
+           kSymbolEntryWords * symbols.size() +
+           kExtensionEntryWords * extensions.size());
+  std::string data;
+  std::vector<uint32> name_offsets(files.file_size());
+  std::vector<uint32> file_offsets(files.file_size());
+  std::vector<uint32> file_sizes(files.file_size());
+  for (int i = 0; i < files.file_size(); i++) {
+    name_offsets[i] = data_offset + data.size();
+    data += files.file(i).name();
+    file_offsets[i] = data_offset + data.size();
+    files.file(i).AppendToString(&data);
+    file_sizes[i] = data_offset + data.size() - file_offsets[i];
+  }
+  std::vector<uint32> symbol_offsets(symbols.size());
+  for (size_t i = 0; i < symbols.size(); i++) {
+    symbol_offsets[i] = data_offset + data.size();
+    data += symbols[i].name;
+  }
+  std::vector<uint32> extendee_offsets(extensions.size());
+  for (size_t i = 0; i < extensions.size(); i++) {
+    if (i > 0 && extensions[i].extendee == extensions[i - 1].extendee) {
+      extendee_offsets[i] = extendee_offsets[i - 1];
+    } else {
+      extendee_offsets[i] = data_offset + data.size();
+      data += extensions[i].extendee;
+    }
+  }
+  if (data_offset + data.size() > kuint32max) {
+    GOOGLE_LOG(ERROR) << "Descriptor snapshot would exceed 4GB.";
+    return false;
+  }
+
+  output->clear();
+  output->reserve(data_offset + data.size());
+  output->append(kMagic, sizeof(kMagic));
+  AppendWord(kVersion, output);
+  size_t table_offset = 4 * kHeaderWords;
+  AppendWord(names.size(), output);
+  AppendWord(table_offset, output);
+  table_offset += 4 * kFileEntryWords * names.size();
+  AppendWord(symbols.size(), output);
+  AppendWord(table_offset, output);
+  table_offset += 4 * kSymbolEntryWords * symbols.size();
+  AppendWord(extensions.size(), output);
+  AppendWord(table_offset, output);
+
+  for (const std::pair<std::string, int>& name : names) {
+    AppendWord(name_offsets[name.second], output);
+    AppendWord(name.first.size(), output);
+    AppendWord(file_offsets[name.second], output);
+    AppendWord(file_sizes[name.second], output);
+  }
+  for (size_t i = 0; i < symbols.size(); i++) {
+    AppendWord(symbol_offsets[i], output);
+    AppendWord(symbols[i].name.size(), output);
+    AppendWord(file_positions[symbols[i].file_index], output);
+  }
+  for (size_t i = 0; i < extensions.size(); i++) {
+    AppendWord(extendee_offsets[i], output);
+    AppendWord(extensions[i].extendee.size(), output);
+    AppendWord(extensions[i].number, output);
+    AppendWord(file_positions[extensions[i].file_index], output);
+  }
+  GOOGLE_DCHECK_EQ(data_offset, output->size());
+  output->append(data);
+  return true;
+}
+
+bool SnapshotDescriptorDatabase::Open(const void* data, size_t size) {
+  GOOGLE_CHECK(data_ == nullptr) << "Open() may only be called once.";
+  const char* bytes = static_cast<const char*>(data);
+  if (size < 4 * kHeaderWords || memcmp(bytes, kMagic, sizeof(kMagic)) != 0) {
+    GOOGLE_LOG(ERROR) << "Not a descriptor snapshot.";
+    return false;
+  }
+  if (ReadWord(bytes, 1) != kVersion) {
+    GOOGLE_LOG(ERROR) << "Unsupported descriptor snapshot version "
+               << ReadWord(bytes, 1) << ".";
+    return false;
+  }
+  // Each table must lie within the snapshot.  The entries themselves are
+  // checked when they are used, so that opening does not touch every page.
+  const int kEntryWords[] = {kFileEntryWords, kSymbolEntryWords,
+                             kExtensionEntryWords};
+  for (int i = 0; i < 3; i++) {
+    uint64 count = ReadWord(bytes, 2 + 2 * i);
+    uint64 offset = ReadWord(bytes, 3 + 2 * i);
+    if (count > kint32max || offset + 4 * kEntryWords[i] * count > size) {
+      GOOGLE_LOG(ERROR) << "Descriptor snapshot is truncated.";
+      return false;
+    }
+  }
+  data_ = bytes;
+  size_ = size;
+  file_count_ = ReadWord(bytes, 2);
+  files_ = bytes + ReadWord(bytes, 3);
+  symbol_count_ = ReadWord(bytes, 4);
+  symbols_ = bytes + ReadWord(bytes, 5);
+  extension_count_ = ReadWord(bytes, 6);
+  extensions_ = bytes + ReadWord(bytes, 7);
+  return true;
+}
+
+bool SnapshotDescriptorDatabase::OpenFile(const std::string& filename) {
+#ifndef _WIN32
+  int fd;
+  do {
+    fd = open(filename.c_str(), O_RDONLY);
+  } while (fd < 0 && errno == EINTR);
+  if (fd < 0) {
+    GOOGLE_LOG(ERROR) << filename << ": " << strerror(errno);
+    return false;
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    int error = errno;
+    close(fd);
+    GOOGLE_LOG(ERROR) << filename << ": " << strerror(error);
+    return false;
+  }
+  if (info.st_size == 0) {
+    close(fd);
+    GOOGLE_LOG(ERROR) << filename << ": file is empty.";
+    return false;
+  }
+  void* mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  int error = errno;
+  close(fd);
+  if (mapped == MAP_FAILED) {
+    GOOGLE_LOG(ERROR) << filename << ": " << strerror(error);
+    return false;
+  }
+  mapped_data_ = mapped;
+  mapped_size_ = info.st_size;
+  return Open(mapped_data_, mapped_size_);
+#else
+  std::ifstream input(filename.c_str(), std::ios::in | std::ios::binary);
+  if (!input) {
+    GOOGLE_LOG(ERROR) << filename << ": cannot open file.";
+    return false;
+  }
+  file_contents_.assign(std::istreambuf_iterator<char>(input),
+                        std::istreambuf_iterator<char>());
+  return Open(file_contents_.data(), file_contents_.size());
+#endif
+}
+
+bool SnapshotDescriptorDatabase::GetString(uint32 offset, uint32 size,
+                                           StringPiece* output) const {
+  if (static_cast<uint64>(offset) + size > size_) {
+    GOOGLE_LOG(ERROR) << "Descriptor snapshot entry is out of bounds.";
+    return false;
+  }
+  *output = StringPiece(data_ + offset, size);
+  return true;
+}
+
+bool SnapshotDescriptorDatabase::GetFileName(int index,
+                                             StringPiece* output) const {
+  const size_t entry = index * kFileEntryWords;
+  return GetString(ReadWord(files_, entry), ReadWord(files_, entry + 1),
+                   output);
+}
+
+bool SnapshotDescriptorDatabase::GetSymbol(int index, StringPiece* name,
+                                           int* file_index) const {
+  const size_t entry = index * kSymbolEntryWords;
+  *file_index = ReadWord(symbols_, entry + 2);
+  return GetString(ReadWord(symbols_, entry), ReadWord(symbols_, entry + 1),
+                   name);
+}
+
+bool SnapshotDescriptorDatabase::GetExtension(int index, StringPiece* extendee,
+                                              int* number,
+                                              int* file_index) const {
+  const size_t entry = index * kExtensionEntryWords;
+  *number = ReadWord(extensions_, entry + 2);
+  *file_index = ReadWord(extensions_, entry + 3);
+  return GetString(ReadWord(extensions_, entry),
+                   ReadWord(extensions_, entry + 1), extendee);
+}
+
+bool SnapshotDescriptorDatabase::ParseFile(int index,
+                                           FileDescriptorProto* output) const {
+  StringPiece file;
+  if (index < 0 || index >= file_count_) return false;
+  const size_t entry = index * kFileEntryWords;
+  if (!GetString(ReadWord(files_, entry + 2), ReadWord(files_, entry + 3),
+                 &file)) {
+    return false;
+  }
+  if (file.size() > std::numeric_limits<int>::max()) {
+    GOOGLE_LOG(ERROR) << "Descriptor snapshot entry is too large to parse.";
+    return false;
+  }
+  return output->ParseFromArray(file.data(), static_cast<int>(file.size()));
+}
+
+bool SnapshotDescriptorDatabase::FindFileByName(const std::string& filename,
+                                                FileDescriptorProto* output) {
+  // Binary search for the file.
+  int low = 0;
+  int high = file_count_;
+  while (low < high) {
+    int mid = low + (high - low) / 2;
+    StringPiece name;
+    if (!GetFileName(mid, &name)) return false;
+    if (name < filename) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  StringPiece name;
+  if (low == file_count_ || !GetFileName(low, &name) || name != filename) {
+    return false;
+  }
+  return ParseFile(low, output);
+}
+
+bool SnapshotDescriptorDatabase::FindFileContainingSymbol(
+    const std::string& symbol_name, FileDescriptorProto* output) {
+  // Find the last indexed symbol that is less than or equal to symbol_name;
+  // it is either symbol_name itself or the top-level symbol it is nested in.
+  int low = 0;
+  int high = symbol_count_;
+  while (low < high) {
+    int mid = low + (high - low) / 2;
+    StringPiece name;
+    int file_index;
+    if (!GetSymbol(mid, &name, &file_index)) return false;
+    if (symbol_name < name) {
+      high = mid;
+    } else {
+      low = mid + 1;
+    }
+  }
+  if (low == 0) return false;
+  StringPiece name;
+  int file_index;
+  if (!GetSymbol(low - 1, &name, &file_index)) return false;
+  StringPiece symbol(symbol_name);
+  if (symbol != name &&
+      !(symbol.starts_with(name) && symbol[name.size()] == '.')) {
+    return false;
+  }
+  return ParseFile(file_index, output);
+}
+
+bool SnapshotDescriptorDatabase::FindFileContainingExtension(
+    const std::string& containing_type, int field_number,
+    FileDescriptorProto* output) {
+  int low = 0;
+  int high = extension_count_;
+  while (low < high) {
+    int mid = low + (high - low) / 2;
+    StringPiece extendee;
+    int number;
+    int file_index;
+    if (!GetExtension(mid, &extendee, &number, &file_index)) return false;
+    if (std::make_pair(extendee, number) <
+        std::make_pair(StringPiece(containing_type), field_number)) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (low == extension_count_) return false;
+  StringPiece extendee;
+  int number;
+  int file_index;
+  if (!GetExtension(low, &extendee, &number, &file_index) ||
+      extendee != containing_type || number != field_number) {
+    return false;
+  }
+  return ParseFile(file_index, output);
+}
+
+bool SnapshotDescriptorDatabase::FindAllExtensionNumbers(
+    const std::string& extendee_type, std::vector<int>* output) {
+  int low = 0;
+  int high = extension_count_;
+  while (low < high) {
+    int mid = low + (high - low) / 2;
+    StringPiece extendee;
+    int number;
+    int file_index;
+    if (!GetExtension(mid, &extendee, &number, &file_index)) return false;
+    if (extendee < extendee_type) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  bool success = false;
+  for (int i = low; i < extension_count_; i++) {
+    StringPiece extendee;
+    int number;
+    int file_index;
+    if (!GetExtension(i, &extendee, &number, &file_index) ||
+        extendee != extendee_type) {
+      break;
+    }
+    output->push_back(number);
+    success = true;
+  }
+  return success;
+}
+
+bool SnapshotDescriptorDatabase::FindAllFileNames(
+    std::vector<std::string>* output) {
+  output->resize(file_count_);
+  for (int i = 0; i < file_count_; i++) {
+    StringPiece name;
+    if (!GetFileName(i, &name)) return false;
+    (*output)[i] = std::string(name);
+  }
+  return true;
+}
+
+}  // namespace protobuf
+}  // namespace google
+
+#include <google/protobuf/port_undef.inc>
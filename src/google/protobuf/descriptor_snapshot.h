@@ -0,0 +1,148 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// A binary snapshot format for a set of FileDescriptorProtos, and a
+// DescriptorDatabase that serves files straight out of a snapshot.
+//
+// A snapshot holds the encoded files together with sorted indexes of their
+// names, top-level symbols and extensions.  Every reference inside it is a
+// byte offset from the start of the snapshot, so it can be mmap()ed read-only
+// and used in place: opening a snapshot reads only its header, lookups are
+// binary searches over the mapped indexes, and a file is parsed only when a
+// DescriptorPool asks for it.  Processes that map the same snapshot share its
+// pages through the page cache.
+//
+// protoc writes snapshots with --descriptor_snapshot_out, from .proto files or
+// from a FileDescriptorSet given with --descriptor_set_in.
+
+#ifndef GOOGLE_PROTOBUF_DESCRIPTOR_SNAPSHOT_H__
+#define GOOGLE_PROTOBUF_DESCRIPTOR_SNAPSHOT_H__
+
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/stringpiece.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/descriptor_database.h>
+
+#include <google/protobuf/port_def.inc>
+
+#ifdef SWIG
+#error "You cannot SWIG proto headers"
+#endif
+
+namespace google {
+namespace protobuf {
+
+// Usage:
+//   // Ahead of time, e.g. with protoc --descriptor_snapshot_out:
+//   std::string snapshot;
+//   SnapshotDescriptorDatabase::BuildSnapshot(file_set, &snapshot);
+//
+//   // At startup:
+//   SnapshotDescriptorDatabase database;
+//   if (!database.OpenFile("descriptors.snapshot")) { ... }
+//   DescriptorPool pool(&database);
+//   const Descriptor* type = pool.FindMessageTypeByName("foo.Bar");
+//
+// The same caveats regarding FindFileContainingExtension() apply as with
+// SimpleDescriptorDatabase.  The database is immutable once opened, so it is
+// safe to use from several threads at once.
+class PROTOBUF_EXPORT SnapshotDescriptorDatabase : public DescriptorDatabase {
+ public:
+  SnapshotDescriptorDatabase();
+  ~SnapshotDescriptorDatabase() override;
+
+  // Encodes the files in 'files' as a snapshot and stores it in *output.
+  // Returns false and logs an error if two files have the same name or
+  // define the same symbol or extension, or if the snapshot would exceed
+  // 4GB.  For the snapshot to be usable on its own, 'files' should contain
+  // the transitive dependencies of every file, as with protoc's
+  // --include_imports.
+  static bool BuildSnapshot(const FileDescriptorSet& files,
+                            std::string* output);
+
+  // Serves files from the snapshot in [data, data + size).  The database does
+  // not make a copy of the bytes; they must stay valid and unchanged for the
+  // life of the database.  Only the header is read.  Returns false and logs
+  // an error if the data is not a snapshot.  May only be called once.
+  bool Open(const void* data, size_t size);
+
+  // Maps the given snapshot file into memory read-only and opens it.  Falls
+  // back to reading the file into memory where mmap() is not available.
+  bool OpenFile(const std::string& filename);
+
+  // implements DescriptorDatabase -----------------------------------
+  bool FindFileByName(const std::string& filename,
+                      FileDescriptorProto* output) override;
+  bool FindFileContainingSymbol(const std::string& symbol_name,
+                                FileDescriptorProto* output) override;
+  bool FindFileContainingExtension(const std::string& containing_type,
+                                   int field_number,
+                                   FileDescriptorProto* output) override;
+  bool FindAllExtensionNumbers(const std::string& extendee_type,
+                               std::vector<int>* output) override;
+  bool FindAllFileNames(std::vector<std::string>* output) override;
+
+ private:
+  // Reads the index'th entry of the given table; see descriptor_snapshot.cc
+  // for the layout.  Returns false if it points outside of the snapshot.
+  bool GetString(uint32 offset, uint32 size, StringPiece* output) const;
+  bool GetFileName(int index, StringPiece* output) const;
+  bool GetSymbol(int index, StringPiece* name, int* file_index) const;
+  bool GetExtension(int index, StringPiece* extendee, int* number,
+                    int* file_index) const;
+  // Parses the index'th file into *output.
+  bool ParseFile(int index, FileDescriptorProto* output) const;
+
+  const char* data_;
+  size_t size_;
+  int file_count_;
+  const char* files_;
+  int symbol_count_;
+  const char* symbols_;
+  int extension_count_;
+  const char* extensions_;
+
+  // What OpenFile() mapped or read, to be released by the destructor.
+  void* mapped_data_;
+  size_t mapped_size_;
+  std::string file_contents_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(SnapshotDescriptorDatabase);
+};
+
+}  // namespace protobuf
+}  // namespace google
+
+#include <google/protobuf/port_undef.inc>
+
+#endif  // GOOGLE_PROTOBUF_DESCRIPTOR_SNAPSHOT_H__
@@ -0,0 +1,219 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/descriptor_snapshot.h>
+
+#include <algorithm>
+#include <set>
+
+#include <google/protobuf/unittest.pb.h>
+#include <google/protobuf/unittest_import.pb.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/testing/file.h>
+#include <google/protobuf/testing/googletest.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace {
+
+// Adds the file and its transitive dependencies to *files, dependencies
+// first.
+void AddWithDependencies(const FileDescriptor* file,
+                         std::set<const FileDescriptor*>* seen,
+                         FileDescriptorSet* files) {
+  if (!seen->insert(file).second) return;
+  for (int i = 0; i < file->dependency_count(); i++) {
+    AddWithDependencies(file->dependency(i), seen, files);
+  }
+  file->CopyTo(files->add_file());
+}
+
+int CountExtensions(const RepeatedPtrField<FieldDescriptorProto>& fields,
+                    const std::string& extendee) {
+  int count = 0;
+  for (const FieldDescriptorProto& field : fields) {
+    if (field.extendee() == extendee) count++;
+  }
+  return count;
+}
+
+int CountNestedExtensions(const DescriptorProto& message,
+                          const std::string& extendee) {
+  int count = CountExtensions(message.extension(), extendee);
+  for (const DescriptorProto& nested : message.nested_type()) {
+    count += CountNestedExtensions(nested, extendee);
+  }
+  return count;
+}
+
+class SnapshotDescriptorDatabaseTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    std::set<const FileDescriptor*> seen;
+    AddWithDependencies(protobuf_unittest::TestAllTypes::descriptor()->file(),
+                        &seen, &files_);
+    ASSERT_TRUE(
+        SnapshotDescriptorDatabase::BuildSnapshot(files_, &snapshot_));
+  }
+
+  // Counts the extensions of the given type declared in files_.
+  int CountAllExtensions(const std::string& extendee) {
+    int count = 0;
+    for (const FileDescriptorProto& file : files_.file()) {
+      count += CountExtensions(file.extension(), extendee);
+      for (const DescriptorProto& message : file.message_type()) {
+        count += CountNestedExtensions(message, extendee);
+      }
+    }
+    return count;
+  }
+
+  FileDescriptorSet files_;
+  std::string snapshot_;
+};
+
+TEST_F(SnapshotDescriptorDatabaseTest, FindFiles) {
+  SnapshotDescriptorDatabase database;
+  ASSERT_TRUE(database.Open(snapshot_.data(), snapshot_.size()));
+
+  FileDescriptorProto file;
+  for (const FileDescriptorProto& expected : files_.file()) {
+    ASSERT_TRUE(database.FindFileByName(expected.name(), &file));
+    EXPECT_EQ(expected.DebugString(), file.DebugString());
+  }
+  EXPECT_FALSE(database.FindFileByName("no_such_file.proto", &file));
+
+  std::vector<std::string> names;
+  ASSERT_TRUE(database.FindAllFileNames(&names));
+  EXPECT_EQ(files_.file_size(), static_cast<int>(names.size()));
+  EXPECT_TRUE(std::is_sorted(names.begin(), names.end()));
+}
+
+TEST_F(SnapshotDescriptorDatabaseTest, FindSymbolsAndExtensions) {
+  SnapshotDescriptorDatabase database;
+  ASSERT_TRUE(database.Open(snapshot_.data(), snapshot_.size()));
+
+  FileDescriptorProto file;
+  ASSERT_TRUE(database.FindFileContainingSymbol(
+      "protobuf_unittest.TestAllTypes.NestedMessage.bb", &file));
+  EXPECT_EQ("google/protobuf/unittest.proto", file.name());
+  ASSERT_TRUE(
+      database.FindFileContainingSymbol("protobuf_unittest_import.ImportEnum",
+                                        &file));
+  EXPECT_EQ("google/protobuf/unittest_import.proto", file.name());
+  EXPECT_FALSE(
+      database.FindFileContainingSymbol("protobuf_unittest.TestAllTypesX",
+                                        &file));
+  EXPECT_FALSE(database.FindFileContainingSymbol("protobuf_unittest", &file));
+
+  ASSERT_TRUE(database.FindFileContainingExtension(
+      "protobuf_unittest.TestAllExtensions", 1, &file));
+  EXPECT_EQ("google/protobuf/unittest.proto", file.name());
+  EXPECT_FALSE(database.FindFileContainingExtension(
+      "protobuf_unittest.TestAllExtensions", 9999, &file));
+
+  std::vector<int> numbers;
+  ASSERT_TRUE(database.FindAllExtensionNumbers(
+      "protobuf_unittest.TestAllExtensions", &numbers));
+  EXPECT_EQ(CountAllExtensions(".protobuf_unittest.TestAllExtensions"),
+            static_cast<int>(numbers.size()));
+  EXPECT_TRUE(std::is_sorted(numbers.begin(), numbers.end()));
+}
+
+TEST_F(SnapshotDescriptorDatabaseTest, BuildPool) {
+  SnapshotDescriptorDatabase database;
+  ASSERT_TRUE(database.Open(snapshot_.data(), snapshot_.size()));
+  DescriptorPool pool(&database);
+
+  const Descriptor* original = protobuf_unittest::TestAllTypes::descriptor();
+  const Descriptor* type = pool.FindMessageTypeByName(original->full_name());
+  ASSERT_TRUE(type != nullptr);
+  EXPECT_EQ(original->file()->DebugString(), type->file()->DebugString());
+  EXPECT_TRUE(pool.FindExtensionByName("protobuf_unittest.optional_int32_"
+                                       "extension") != nullptr);
+}
+
+TEST_F(SnapshotDescriptorDatabaseTest, OpenFile) {
+  std::string filename = TestTempDir() + "/descriptor_snapshot";
+  GOOGLE_CHECK_OK(File::SetContents(filename, snapshot_, true));
+
+  SnapshotDescriptorDatabase database;
+  ASSERT_TRUE(database.OpenFile(filename));
+  DescriptorPool pool(&database);
+  EXPECT_TRUE(pool.FindMessageTypeByName("protobuf_unittest.TestAllTypes") !=
+              nullptr);
+}
+
+TEST_F(SnapshotDescriptorDatabaseTest, OpenFileFailures) {
+  SnapshotDescriptorDatabase missing;
+  EXPECT_FALSE(missing.OpenFile(TestTempDir() + "/no_such_snapshot"));
+
+  std::string filename = TestTempDir() + "/empty_descriptor_snapshot";
+  GOOGLE_CHECK_OK(File::SetContents(filename, "", true));
+  SnapshotDescriptorDatabase empty;
+  EXPECT_FALSE(empty.OpenFile(filename));
+}
+
+TEST_F(SnapshotDescriptorDatabaseTest, RejectsInvalidData) {
+  SnapshotDescriptorDatabase not_a_snapshot;
+  EXPECT_FALSE(not_a_snapshot.Open("not a snapshot", 14));
+
+  SnapshotDescriptorDatabase truncated;
+  EXPECT_FALSE(truncated.Open(snapshot_.data(), 40));
+
+  // Entries that point outside of the snapshot fail the lookup.  The last
+  // file in files_ is stored last.
+  std::string corrupt = snapshot_.substr(0, snapshot_.size() / 2);
+  SnapshotDescriptorDatabase database;
+  ASSERT_TRUE(database.Open(corrupt.data(), corrupt.size()));
+  FileDescriptorProto file;
+  EXPECT_FALSE(database.FindFileByName(
+      files_.file(files_.file_size() - 1).name(), &file));
+}
+
+TEST_F(SnapshotDescriptorDatabaseTest, RejectsConflicts) {
+  FileDescriptorSet files = files_;
+  *files.add_file() = files_.file(0);
+  std::string snapshot;
+  EXPECT_FALSE(SnapshotDescriptorDatabase::BuildSnapshot(files, &snapshot));
+
+  files = files_;
+  files.add_file()->set_name("other.proto");
+  files.mutable_file(files.file_size() - 1)->set_package("protobuf_unittest");
+  files.mutable_file(files.file_size() - 1)
+      ->add_message_type()
+      ->set_name("TestAllTypes");
+  EXPECT_FALSE(SnapshotDescriptorDatabase::BuildSnapshot(files, &snapshot));
+}
+
+}  // namespace
+}  // namespace protobuf
+}  // namespace google
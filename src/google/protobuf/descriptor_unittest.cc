@@ -36,6 +36,7 @@
 
 #include <limits>
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include <google/protobuf/compiler/importer.h>
@@ -610,6 +611,281 @@ TEST_F(FileDescriptorTest, DebugStringRoundTrip) {
 
 // ===================================================================
 
+// Test the sharing of identical names and options in a pool, and
+// DescriptorPool::SpaceUsedLong().
+class PoolMemoryTest : public testing::Test {
+ protected:
+  const FileDescriptor* BuildFile(const std::string& text) {
+    FileDescriptorProto proto;
+    EXPECT_TRUE(TextFormat::ParseFromString(text, &proto));
+    return pool_.BuildFile(proto);
+  }
+
+  DescriptorPool pool_;
+};
+
+TEST_F(PoolMemoryTest, SharesNames) {
+  const FileDescriptor* foo = BuildFile(
+      "name: 'foo.proto' package: 'pkg' "
+      "message_type { name: 'Foo' "
+      "  field { name: 'id' number: 1 label: LABEL_OPTIONAL type: TYPE_INT32 }"
+      "  field { name: 'user_name' number: 2 label: LABEL_OPTIONAL "
+      "          type: TYPE_STRING } }");
+  const FileDescriptor* bar = BuildFile(
+      "name: 'bar.proto' package: 'pkg' "
+      "message_type { name: 'Bar' "
+      "  field { name: 'id' number: 1 label: LABEL_OPTIONAL type: TYPE_INT32 }"
+      "  enum_type { name: 'Foo' value { name: 'user_name' number: 0 } } }");
+  ASSERT_TRUE(foo != nullptr);
+  ASSERT_TRUE(bar != nullptr);
+
+  EXPECT_EQ(&foo->package(), &bar->package());
+  const FieldDescriptor* foo_id = foo->message_type(0)->field(0);
+  const FieldDescriptor* bar_id = bar->message_type(0)->field(0);
+  EXPECT_EQ(&foo_id->name(), &bar_id->name());
+  const EnumDescriptor* bar_foo = bar->message_type(0)->enum_type(0);
+  EXPECT_EQ(&foo->message_type(0)->name(), &bar_foo->name());
+  // Full names stay distinct.
+  EXPECT_EQ("pkg.Foo.id", foo_id->full_name());
+  EXPECT_EQ("pkg.Bar.id", bar_id->full_name());
+
+  const FieldDescriptor* user_name = foo->message_type(0)->field(1);
+  EXPECT_EQ(&user_name->name(), &bar_foo->value(0)->name());
+  EXPECT_EQ("userName", user_name->camelcase_name());
+  EXPECT_EQ(&user_name->camelcase_name(), &user_name->json_name());
+}
+
+TEST_F(PoolMemoryTest, SharesIdenticalOptions) {
+  const FileDescriptor* file = BuildFile(
+      "name: 'foo.proto' "
+      "message_type { name: 'Foo' "
+      "  field { name: 'a' number: 1 label: LABEL_OPTIONAL type: TYPE_INT32 "
+      "          options { deprecated: true } }"
+      "  field { name: 'b' number: 2 label: LABEL_OPTIONAL type: TYPE_INT32 "
+      "          options { deprecated: true } }"
+      "  field { name: 'c' number: 3 label: LABEL_REPEATED type: TYPE_INT32 "
+      "          options { packed: true } }"
+      "  field { name: 'd' number: 4 label: LABEL_OPTIONAL type: TYPE_INT32 }"
+      "}");
+  ASSERT_TRUE(file != nullptr);
+  const Descriptor* foo = file->message_type(0);
+  EXPECT_EQ(&foo->field(0)->options(), &foo->field(1)->options());
+  EXPECT_TRUE(foo->field(1)->options().deprecated());
+  EXPECT_NE(&foo->field(0)->options(), &foo->field(2)->options());
+  EXPECT_TRUE(foo->field(2)->options().packed());
+  EXPECT_EQ(&FieldOptions::default_instance(), &foo->field(3)->options());
+
+  // Files that failed to build are rolled back along with the names and
+  // options they added, which must then not be shared.
+  EXPECT_TRUE(BuildFile("name: 'bad.proto' dependency: 'missing.proto' "
+                        "message_type { name: 'Bad' "
+                        "  field { name: 'e' number: 1 label: LABEL_OPTIONAL "
+                        "          type: TYPE_INT64 "
+                        "          options { jstype: JS_STRING } } }") ==
+              nullptr);
+  const FileDescriptor* good = BuildFile(
+      "name: 'good.proto' "
+      "message_type { name: 'Bad' "
+      "  field { name: 'e' number: 1 label: LABEL_OPTIONAL type: TYPE_INT64 "
+      "          options { jstype: JS_STRING } } }");
+  ASSERT_TRUE(good != nullptr);
+  EXPECT_EQ("e", good->message_type(0)->field(0)->name());
+  EXPECT_EQ(FieldOptions::JS_STRING,
+            good->message_type(0)->field(0)->options().jstype());
+}
+
+TEST_F(PoolMemoryTest, SpaceUsedLong) {
+  std::map<std::string, size_t> by_file;
+  const size_t empty = pool_.SpaceUsedLong(&by_file);
+  EXPECT_GT(empty, 0);
+  EXPECT_TRUE(by_file.empty());
+
+  ASSERT_TRUE(BuildFile("name: 'small.proto' message_type { name: 'Small' }") !=
+              nullptr);
+  std::string large =
+      "name: 'large.proto' dependency: 'small.proto' "
+      "message_type { name: 'Large' ";
+  for (int i = 1; i <= 100; i++) {
+    large += StrCat("field { name: 'field", i, "' number: ", i,
+                    " label: LABEL_OPTIONAL type: TYPE_STRING "
+                    " default_value: 'value", i, "' } ");
+  }
+  large += "}";
+  ASSERT_TRUE(BuildFile(large) != nullptr);
+
+  const size_t total = pool_.SpaceUsedLong(&by_file);
+  ASSERT_EQ(2, by_file.size());
+  EXPECT_GT(by_file["small.proto"], 0);
+  EXPECT_GT(by_file["large.proto"], 100 * sizeof(FieldDescriptor));
+  EXPECT_GT(by_file["large.proto"], 10 * by_file["small.proto"]);
+  EXPECT_GT(total, empty + by_file["small.proto"] + by_file["large.proto"]);
+  EXPECT_EQ(total, pool_.SpaceUsedLong());
+
+  // Measuring the options of the generated pool needs their descriptors,
+  // which are in that same pool.
+  EXPECT_GT(DescriptorPool::generated_pool()->SpaceUsedLong(&by_file),
+            protobuf_unittest::TestAllTypes::descriptor()->field_count() *
+                sizeof(FieldDescriptor));
+  EXPECT_GT(by_file["google/protobuf/unittest.proto"], 0);
+}
+
+TEST_F(PoolMemoryTest, ParseOptionsLazily) {
+  pool_.ParseOptionsLazily(true);
+  FileDescriptorProto proto;
+  ASSERT_TRUE(TextFormat::ParseFromString(
+      "name: 'foo.proto' options { java_package: 'com.foo' } "
+      "message_type { name: 'Foo' options { deprecated: true } "
+      "  field { name: 'a' number: 1 label: LABEL_OPTIONAL type: TYPE_INT32 "
+      "          options { deprecated: true } }"
+      "  field { name: 'b' number: 2 label: LABEL_OPTIONAL type: TYPE_INT32 "
+      "          options { deprecated: true } }"
+      "  field { name: 'c' number: 3 label: LABEL_REPEATED type: TYPE_INT32 "
+      "          options { packed: true } }"
+      "  field { name: 'd' number: 4 label: LABEL_OPTIONAL type: TYPE_INT32 }"
+      "  extension_range { start: 10 end: 20 options {} } }"
+      "enum_type { name: 'Bar' options { allow_alias: true } "
+      "  value { name: 'BAR' number: 0 } "
+      "  value { name: 'BAZ' number: 0 } }",
+      &proto));
+  const FileDescriptor* file = pool_.BuildFile(proto);
+  ASSERT_TRUE(file != nullptr);
+  const Descriptor* foo = file->message_type(0);
+
+  // is_packed() and the extension ranges do not go through options().
+  EXPECT_TRUE(foo->field(2)->is_packed());
+  EXPECT_TRUE(foo->extension_range(0)->options_ != nullptr);
+
+  EXPECT_EQ("com.foo", file->options().java_package());
+  EXPECT_TRUE(foo->options().deprecated());
+  EXPECT_TRUE(foo->field(0)->options().deprecated());
+  EXPECT_EQ(&foo->field(0)->options(), &foo->field(1)->options());
+  EXPECT_TRUE(foo->field(2)->options().packed());
+  EXPECT_EQ(&FieldOptions::default_instance(), &foo->field(3)->options());
+  EXPECT_TRUE(file->enum_type(0)->options().allow_alias());
+
+  FileDescriptorProto copy;
+  file->CopyTo(&copy);
+  EXPECT_EQ(proto.DebugString(), copy.DebugString());
+}
+
+// Builds 100 files with 50 fields each, all with options.  With
+// `distinct_options`, the options of every field differ.
+void BuildFilesWithOptions(DescriptorPool* pool, bool distinct_options) {
+  for (int i = 0; i < 100; i++) {
+    FileDescriptorProto file;
+    file.set_name(StrCat("file", i, ".proto"));
+    DescriptorProto* message = file.add_message_type();
+    message->set_name(StrCat("Message", i));
+    for (int j = 1; j <= 50; j++) {
+      FieldDescriptorProto* field = message->add_field();
+      field->set_name(StrCat("field", j));
+      field->set_number(j);
+      field->set_label(FieldDescriptorProto::LABEL_OPTIONAL);
+      field->set_type(FieldDescriptorProto::TYPE_INT32);
+      field->mutable_options()->set_deprecated(true);
+      if (distinct_options) {
+        // Unknown to this pool, so the option is never interpreted.
+        field->mutable_options()->mutable_unknown_fields()->AddVarint(
+            50000, i * 50 + j);
+      }
+    }
+    ASSERT_TRUE(pool->BuildFile(file) != nullptr);
+  }
+}
+
+TEST_F(PoolMemoryTest, ParseOptionsLazilySavesMemory) {
+  for (bool distinct_options : {false, true}) {
+    SCOPED_TRACE(distinct_options);
+    DescriptorPool eager_pool;
+    BuildFilesWithOptions(&eager_pool, distinct_options);
+    DescriptorPool lazy_pool;
+    lazy_pool.ParseOptionsLazily(true);
+    BuildFilesWithOptions(&lazy_pool, distinct_options);
+
+    if (distinct_options) {
+      EXPECT_LT(lazy_pool.SpaceUsedLong(), eager_pool.SpaceUsedLong());
+    } else {
+      // Identical options are parsed once and shared in both cases.
+      EXPECT_LE(lazy_pool.SpaceUsedLong(), eager_pool.SpaceUsedLong());
+    }
+
+    const Descriptor* first = lazy_pool.FindMessageTypeByName("Message0");
+    const Descriptor* last = lazy_pool.FindMessageTypeByName("Message99");
+    ASSERT_TRUE(first != nullptr);
+    ASSERT_TRUE(last != nullptr);
+    EXPECT_TRUE(last->field(49)->options().deprecated());
+    EXPECT_EQ(distinct_options ? 1 : 0,
+              last->field(49)->options().unknown_fields().field_count());
+    if (!distinct_options) {
+      EXPECT_EQ(&first->field(0)->options(), &last->field(49)->options());
+    }
+  }
+}
+
+TEST_F(PoolMemoryTest, ParseOptionsLazilyRollsBackSharing) {
+  pool_.ParseOptionsLazily(true);
+  const std::string field =
+      "field { name: 'a' number: 1 label: LABEL_OPTIONAL type: TYPE_INT32 "
+      "        options { deprecated: true } }";
+  const FileDescriptor* foo =
+      BuildFile("name: 'foo.proto' message_type { name: 'Foo' " + field + "}");
+  ASSERT_TRUE(foo != nullptr);
+  // The options were seen before, so this parses and shares them, until the
+  // file fails to build.
+  EXPECT_TRUE(BuildFile("name: 'bad.proto' dependency: 'missing.proto' "
+                        "message_type { name: 'Bad' " +
+                        field + "}") == nullptr);
+  const FileDescriptor* bar =
+      BuildFile("name: 'bar.proto' message_type { name: 'Bar' " + field +
+                "} message_type { name: 'Baz' " + field + "}");
+  ASSERT_TRUE(bar != nullptr);
+
+  const FieldOptions& bar_options = bar->message_type(0)->field(0)->options();
+  EXPECT_TRUE(bar_options.deprecated());
+  EXPECT_EQ(&bar_options, &bar->message_type(1)->field(0)->options());
+  EXPECT_TRUE(foo->message_type(0)->field(0)->options().deprecated());
+}
+
+TEST_F(PoolMemoryTest, DropSourceCodeInfo) {
+  FileDescriptorProto proto;
+  ASSERT_TRUE(TextFormat::ParseFromString(
+      "name: 'foo.proto' message_type { name: 'Foo' } "
+      "source_code_info { location { path: [4, 0] span: [1, 2, 3] } }",
+      &proto));
+  std::vector<int> path = {FileDescriptorProto::kMessageTypeFieldNumber, 0};
+  SourceLocation location;
+
+  // Without a database to load it from, it is gone.
+  pool_.DropSourceCodeInfo(true);
+  const FileDescriptor* file = pool_.BuildFile(proto);
+  ASSERT_TRUE(file != nullptr);
+  EXPECT_FALSE(file->GetSourceLocation(path, &location));
+  FileDescriptorProto copy;
+  file->CopySourceCodeInfoTo(&copy);
+  EXPECT_FALSE(copy.has_source_code_info());
+
+  // With one, it is loaded on demand.
+  SimpleDescriptorDatabase database;
+  ASSERT_TRUE(database.Add(proto));
+  DescriptorPool kept_pool(&database);
+  DescriptorPool dropped_pool(&database);
+  dropped_pool.DropSourceCodeInfo(true);
+  ASSERT_TRUE(kept_pool.FindFileByName("foo.proto") != nullptr);
+  file = dropped_pool.FindFileByName("foo.proto");
+  ASSERT_TRUE(file != nullptr);
+  EXPECT_LT(dropped_pool.SpaceUsedLong(), kept_pool.SpaceUsedLong());
+
+  ASSERT_TRUE(file->GetSourceLocation(path, &location));
+  EXPECT_EQ(1, location.start_line);
+  EXPECT_EQ(2, location.start_column);
+  EXPECT_EQ(3, location.end_column);
+  file->CopySourceCodeInfoTo(&copy);
+  EXPECT_EQ(proto.source_code_info().DebugString(),
+            copy.source_code_info().DebugString());
+}
+
+// ===================================================================
+
 // Test simple flat messages and fields.
 class DescriptorTest : public testing::Test {
  protected:
@@ -6522,6 +6798,49 @@ TEST_F(ValidationErrorTest, ValidateProto3JsonName) {
       "conflicts with field \"ab\". This is not allowed in proto3.\n");
 }
 
+TEST_F(ValidationErrorTest, TrustInputs) {
+  // A file that is invalid in many ways that don't stop it from being built.
+  const char* kInvalidFile =
+      "name: 'foo.proto' "
+      "syntax: 'proto3' "
+      "message_type {"
+      "  name: 'Foo'"
+      "  field { name:'name' number:1 label:LABEL_OPTIONAL type:TYPE_INT32 }"
+      "  field { name:'Name' number:2 label:LABEL_OPTIONAL type:TYPE_INT32 }"
+      "  field { name:'b-c' number:3 label:LABEL_OPTIONAL type:TYPE_INT32 }"
+      "  reserved_range { start: 2 end: 5 }"
+      "  reserved_range { start: 4 end: 6 }"
+      "}"
+      "enum_type {"
+      "  name: 'Bar'"
+      "  value { name:'BAR_ZERO' number:1 }"
+      "  value { name:'BAR_ONE' number:1 }"
+      "}";
+  BuildFileWithErrors(
+      kInvalidFile,
+      "foo.proto: Foo.b-c: NAME: \"b-c\" is not a valid identifier.\n"
+      "foo.proto: Foo: NUMBER: Reserved range 4 to 5 overlaps with "
+      "already-defined range 2 to 4.\n"
+      "foo.proto: Foo.Name: NUMBER: Field \"Name\" uses reserved number 2.\n"
+      "foo.proto: Foo.b-c: NUMBER: Field \"b-c\" uses reserved number 3.\n");
+
+  pool_.TrustInputs(true);
+  const FileDescriptor* file = BuildFile(kInvalidFile);
+  EXPECT_EQ("b-c", file->message_type(0)->field(2)->name());
+  EXPECT_EQ(2, file->enum_type(0)->value_count());
+
+  // Errors which prevent building the descriptors are still reported.
+  BuildFileWithErrors(
+      "name: 'bar.proto' "
+      "message_type {"
+      "  name: 'Foo'"
+      "  field { name:'a' number:1 label:LABEL_OPTIONAL type_name:'Baz' }"
+      "}",
+      "bar.proto: Foo: NAME: \"Foo\" is already defined in file "
+      "\"foo.proto\".\n"
+      "bar.proto: Foo.a: TYPE: \"Baz\" is not defined.\n");
+}
+
 
 TEST_F(ValidationErrorTest, UnusedImportWithOtherError) {
   BuildFile(
@@ -6845,6 +7164,32 @@ TEST_F(DatabaseBackedPoolTest, RollbackAfterError) {
   EXPECT_TRUE(pool.FindMessageTypeByName("Baz") == nullptr);
 }
 
+TEST_F(DatabaseBackedPoolTest, ConcurrentLookups) {
+  // Lookups of symbols and files that are already built take no lock, and may
+  // run while other threads are loading files from the database.
+  DescriptorPool pool(&database_);
+  std::vector<std::thread> threads;
+  bool ok[8] = {};
+  for (int i = 0; i < 8; i++) {
+    threads.emplace_back([&pool, &ok, i] {
+      bool result = true;
+      for (int j = 0; j < 1000; j++) {
+        const FileDescriptor* bar = pool.FindFileByName("bar.proto");
+        const Descriptor* foo = pool.FindMessageTypeByName("Foo");
+        const FieldDescriptor* foo_ext = pool.FindExtensionByName("foo_ext");
+        result = result && bar != nullptr && foo != nullptr &&
+                 foo_ext != nullptr && foo_ext->file() == bar &&
+                 foo_ext->containing_type() == foo;
+      }
+      ok[i] = result;
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+  for (int i = 0; i < 8; i++) EXPECT_TRUE(ok[i]) << i;
+  EXPECT_EQ(pool.FindFileByName("foo.proto"),
+            pool.FindMessageTypeByName("Foo")->file());
+}
+
 TEST_F(DatabaseBackedPoolTest, UnittestProto) {
   // Try to load all of unittest.proto from a DescriptorDatabase.  This should
   // thoroughly test all paths through DescriptorBuilder to insure that there
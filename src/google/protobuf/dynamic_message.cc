@@ -68,21 +68,28 @@
 #include <cstddef>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_table_driven_lite.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/unknown_field_set.h>
 #include <google/protobuf/stubs/hash.h>
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/extension_set.h>
+#include <google/protobuf/field_layout.h>
 #include <google/protobuf/map_field.h>
 #include <google/protobuf/map_field_inl.h>
 #include <google/protobuf/map_type_handler.h>
+#include <google/protobuf/parse_context.h>
+#include <google/protobuf/read_mostly_map.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/repeated_field.h>
 #include <google/protobuf/wire_format.h>
+#include <google/protobuf/wire_format_lite.h>
 
 #include <google/protobuf/port_def.inc>  // NOLINT
 
@@ -95,6 +102,8 @@ using internal::MapField;
 
 
 using internal::ArenaStringPtr;
+using internal::ParseTableField;
+using internal::WireFormatLite;
 
 // ===================================================================
 // Some helper tables and functions...
@@ -125,6 +134,19 @@ inline bool InRealOneof(const FieldDescriptor* field) {
          !field->containing_oneof()->is_synthetic();
 }
 
+// Singular primitive fields outside of any real oneof can be copied as raw
+// bytes, so they are laid out together right after the has_bits.
+inline bool IsPODField(const FieldDescriptor* field) {
+  if (field->is_repeated() || InRealOneof(field)) return false;
+  switch (field->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_STRING:
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      return false;
+    default:
+      return true;
+  }
+}
+
 // Compute the byte size of the in-memory representation of the field.
 int FieldSpaceUsed(const FieldDescriptor* field) {
   typedef FieldDescriptor FD;  // avoid line wrapping
@@ -250,6 +272,32 @@ inline int AlignOffset(int offset) { return AlignTo(offset, kSafeAlignment); }
 
 #define bitsizeof(T) (sizeof(T) * 8)
 
+// Reorders 'fields' the way PaddingOptimizer orders the members of a generated
+// class: repeated fields, then strings, then messages, then everything else,
+// and within each family fields aligned to 1 and 4 bytes are packed into
+// 8-byte blocks so that there is no padding between them.  Fields stay close
+// to field number order.  If 'odd_start' is set, i.e. the fields start 4 bytes
+// past an 8-byte boundary, a 4-byte block left over among the primitive fields
+// is moved to the front to fill the hole.
+void OptimizeLayout(std::vector<const FieldDescriptor*>* fields,
+                    bool odd_start) {
+  enum Family { REPEATED = 0, STRING = 1, MESSAGE = 2, OTHER = 3, kMaxFamily };
+  internal::OptimizeFieldLayout(
+      fields, kMaxFamily,
+      [](const FieldDescriptor* field) -> int {
+        if (field->is_repeated()) return REPEATED;
+        if (field->cpp_type() == FieldDescriptor::CPPTYPE_STRING) return STRING;
+        if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+          return MESSAGE;
+        }
+        return OTHER;
+      },
+      [](const FieldDescriptor* field) {
+        return std::min(kSafeAlignment, FieldSpaceUsed(field));
+      },
+      odd_start ? static_cast<int>(OTHER) : -1);
+}
+
 }  // namespace
 
 // ===================================================================
@@ -262,6 +310,12 @@ class DynamicMessage : public Message {
     int oneof_case_offset;
     int extensions_offset;
 
+    // The has_bits and all POD fields (see IsPODField()) live in the byte
+    // range [pod_begin_offset, pod_end_offset), which CopyFrom() clones with
+    // a single memcpy().  Both are equal if the range is empty.
+    int pod_begin_offset;
+    int pod_end_offset;
+
     // Not owned by the TypeInfo.
     DynamicMessageFactory* factory;  // The factory that created this object.
     const DescriptorPool* pool;      // The factory's DescriptorPool.
@@ -279,7 +333,22 @@ class DynamicMessage : public Message {
     const DynamicMessage* prototype;
     int weak_field_map_offset;  // The offset for the weak_field_map;
 
-    TypeInfo() : prototype(NULL) {}
+    // Offset/type dispatch tables used to parse and serialize without going
+    // through Reflection, built by BuildFastTables() once the prototype
+    // exists.  They have the same layout as the tables of generated messages
+    // and are indexed by field number; parse_fields is empty if the type is
+    // not suitable, in which case the reflection-based WireFormat routines
+    // are used instead.
+    std::vector<ParseTableField> parse_fields;
+    std::vector<internal::AuxiliaryParseTableField> parse_aux;
+    std::vector<const FieldDescriptor*> fields_by_number;
+    // Sorted by start number, so that extensions can be serialized in order.
+    std::vector<const Descriptor::ExtensionRange*> extension_ranges;
+    uint32 max_field_number;
+
+    TypeInfo() : prototype(NULL), max_field_number(0) {}
+
+    bool has_fast_tables() const { return !parse_fields.empty(); }
 
     ~TypeInfo() { delete prototype; }
   };
@@ -299,11 +368,21 @@ class DynamicMessage : public Message {
   Message* New() const override;
   Message* New(Arena* arena) const override;
 
+  void CopyFrom(const Message& from) override;
+
   int GetCachedSize() const override;
   void SetCachedSize(int size) const override;
 
   Metadata GetMetadata() const override;
 
+  // Table-driven versions of the reflection-based implementations in
+  // Message.
+  const char* _InternalParse(const char* ptr,
+                             internal::ParseContext* ctx) override;
+  size_t ByteSizeLong() const override;
+  uint8* _InternalSerialize(uint8* target,
+                            io::EpsCopyOutputStream* stream) const override;
+
   // We actually allocate more memory than sizeof(*this) when this
   // class's memory is allocated via the global operator new. Thus, we need to
   // manually call the global operator delete. Calling the destructor is taken
@@ -318,6 +397,24 @@ class DynamicMessage : public Message {
 
   void SharedCtor(bool lock_factory);
 
+  // Fills in the fast parse/serialize tables of |type_info|.  Called on the
+  // prototype's TypeInfo after the prototypes have been cross-linked.
+  static void BuildFastTables(TypeInfo* type_info);
+
+  // Helpers for the table-driven paths.  |number| is a field number with a
+  // valid entry in type_info_->parse_fields.
+  const char* ParseField(int number, uint32 tag, const char* ptr,
+                         internal::ParseContext* ctx);
+  const char* ParsePackedField(int number, const char* ptr,
+                               internal::ParseContext* ctx);
+  // Updates the has_bit or oneof case of a singular field that is about to
+  // be assigned, and returns a pointer to its storage.
+  void* MutableSingularField(int number);
+  bool HasFieldFast(int number) const;
+  size_t FieldByteSizeFast(int number) const;
+  uint8* SerializeFieldFast(int number, uint8* target,
+                            io::EpsCopyOutputStream* stream) const;
+
   // Needed to get the offset of the internal metadata member.
   friend class DynamicMessageFactory;
 
@@ -633,6 +730,39 @@ Message* DynamicMessage::New(Arena* arena) const {
   }
 }
 
+void DynamicMessage::CopyFrom(const Message& from) {
+  if (&from == this) return;
+  if (from.GetReflection() != type_info_->reflection.get()) {
+    // Not a DynamicMessage of the same type; fall back to reflection.
+    Message::CopyFrom(from);
+    return;
+  }
+  const DynamicMessage& source = static_cast<const DynamicMessage&>(from);
+
+  Clear();
+  // The has_bits and the POD fields are copied in one go.  After Clear() the
+  // bits of the non-POD fields are stale, but they are all set again below
+  // when the corresponding fields are merged.
+  if (type_info_->pod_end_offset > type_info_->pod_begin_offset) {
+    memcpy(OffsetToPointer(type_info_->pod_begin_offset),
+           source.OffsetToPointer(type_info_->pod_begin_offset),
+           type_info_->pod_end_offset - type_info_->pod_begin_offset);
+  }
+
+  const Reflection* reflection = type_info_->reflection.get();
+  std::vector<const FieldDescriptor*> fields;
+  reflection->ListFields(source, &fields);
+  fields.erase(std::remove_if(fields.begin(), fields.end(),
+                              [](const FieldDescriptor* field) {
+                                return !field->is_extension() &&
+                                       IsPODField(field);
+                              }),
+               fields.end());
+  internal::ReflectionOps::MergeFields(source, fields, this);
+  reflection->MutableUnknownFields(this)->MergeFrom(
+      reflection->GetUnknownFields(source));
+}
+
 int DynamicMessage::GetCachedSize() const {
   return cached_byte_size_.load(std::memory_order_relaxed);
 }
@@ -648,12 +778,742 @@ Metadata DynamicMessage::GetMetadata() const {
   return metadata;
 }
 
+// -------------------------------------------------------------------
+// Table-driven parsing and serialization.
+
+namespace {
+
+const uint32 kNoPresence = static_cast<uint32>(-1);
+
+// Same criteria as the C++ code generator applies before emitting parse
+// tables for a message (see TableDrivenParsingEnabled()).
+bool UseFastTables(const Descriptor* type, int max_field_number) {
+  if (type->options().message_set_wire_format() ||
+      type->options().map_entry()) {
+    return false;
+  }
+  return max_field_number < (2 << 14) &&
+         max_field_number <= 2 * type->field_count();
+}
+
+inline bool IsOpenEnum(const FieldDescriptor* field) {
+  return field->file()->syntax() == FileDescriptor::SYNTAX_PROTO3;
+}
+
+bool IsKnownEnumValue(const void* enum_type, int value) {
+  return static_cast<const EnumDescriptor*>(enum_type)->FindValueByNumber(
+             value) != nullptr;
+}
+
+// Mirrors the UTF-8 handling of WireFormat: invalid data fails the parse of
+// proto3 fields and is only logged for proto2 fields.
+bool VerifyUtf8(const FieldDescriptor* field, const std::string& value,
+                internal::WireFormat::Operation op) {
+  if (field->file()->syntax() == FileDescriptor::SYNTAX_PROTO3) {
+    return WireFormatLite::VerifyUtf8String(
+        value.data(), value.length(),
+        op == internal::WireFormat::PARSE ? WireFormatLite::PARSE
+                                          : WireFormatLite::SERIALIZE,
+        field->full_name().c_str());
+  }
+  internal::WireFormat::VerifyUTF8StringNamedField(
+      value.data(), value.length(), op, field->full_name().c_str());
+  return true;
+}
+
+template <typename T>
+inline T ReadFixed(const char** ptr) {
+  T value = internal::UnalignedLoad<T>(*ptr);
+  *ptr += sizeof(T);
+  return value;
+}
+
+}  // namespace
+
+void DynamicMessage::BuildFastTables(TypeInfo* type_info) {
+  const Descriptor* type = type_info->type;
+  int max_field_number = 0;
+  for (int i = 0; i < type->field_count(); i++) {
+    max_field_number = std::max(max_field_number, type->field(i)->number());
+  }
+  if (!UseFastTables(type, max_field_number)) return;
+
+  // Entry 0 and the entries of unused field numbers never match a wire type,
+  // so such tags fall through to the reflection-based parser.
+  ParseTableField invalid = {0, 0, internal::kInvalidMask,
+                             internal::kInvalidMask, 0, 0};
+  type_info->parse_fields.assign(max_field_number + 1, invalid);
+  type_info->parse_aux.assign(max_field_number + 1,
+                              internal::AuxiliaryParseTableField());
+  type_info->fields_by_number.assign(max_field_number + 1, nullptr);
+
+  for (int i = 0; i < type->field_count(); i++) {
+    const FieldDescriptor* field = type->field(i);
+    ParseTableField& entry = type_info->parse_fields[field->number()];
+    internal::AuxiliaryParseTableField& aux =
+        type_info->parse_aux[field->number()];
+    type_info->fields_by_number[field->number()] = field;
+
+    entry.processing_type = static_cast<unsigned char>(field->type());
+    entry.tag_size = static_cast<unsigned char>(
+        internal::WireFormat::TagSize(field->number(), field->type()));
+    if (InRealOneof(field)) {
+      entry.offset = type_info->offsets[type->field_count() +
+                                        field->containing_oneof()->index()];
+      entry.presence_index = field->containing_oneof()->index();
+      entry.processing_type |= internal::kOneofMask;
+    } else {
+      entry.offset = type_info->offsets[i];
+      entry.presence_index = type_info->has_bits_indices != nullptr
+                                 ? type_info->has_bits_indices[i]
+                                 : kNoPresence;
+    }
+    if (field->is_repeated()) {
+      entry.processing_type |= internal::kRepeatedMask;
+    }
+
+    if (field->is_map()) {
+      // Map fields keep using reflection, which knows how to keep the map and
+      // repeated representations of a DynamicMapField in sync.
+      entry.processing_type = internal::TYPE_MAP;
+      continue;
+    }
+    entry.normal_wiretype = static_cast<unsigned char>(
+        internal::WireFormat::WireTypeForFieldType(field->type()));
+    entry.packed_wiretype =
+        field->is_packable()
+            ? static_cast<unsigned char>(
+                  WireFormatLite::WIRETYPE_LENGTH_DELIMITED)
+            : static_cast<unsigned char>(internal::kNotPackedMask);
+
+    switch (field->cpp_type()) {
+      case FieldDescriptor::CPPTYPE_STRING:
+        aux.strings.default_ptr = &field->default_value_string();
+        aux.strings.field_name = field->full_name().c_str();
+        break;
+      case FieldDescriptor::CPPTYPE_MESSAGE:
+        aux.messages.default_message_void =
+            type_info->factory->GetPrototypeNoLock(field->message_type());
+        break;
+      default:
+        break;
+    }
+  }
+
+  for (int i = 0; i < type->extension_range_count(); i++) {
+    type_info->extension_ranges.push_back(type->extension_range(i));
+  }
+  std::sort(type_info->extension_ranges.begin(),
+            type_info->extension_ranges.end(),
+            [](const Descriptor::ExtensionRange* a,
+               const Descriptor::ExtensionRange* b) {
+              return a->start < b->start;
+            });
+
+  type_info->max_field_number = max_field_number;
+}
+
+void* DynamicMessage::MutableSingularField(int number) {
+  const ParseTableField& entry = type_info_->parse_fields[number];
+  void* field_ptr = OffsetToPointer(entry.offset);
+  if (entry.processing_type & internal::kOneofMask) {
+    uint32* oneof_case = static_cast<uint32*>(
+        OffsetToPointer(type_info_->oneof_case_offset)) +
+        entry.presence_index;
+    if (*oneof_case != static_cast<uint32>(number)) {
+      const FieldDescriptor* field = type_info_->fields_by_number[number];
+      if (*oneof_case != 0) {
+        type_info_->reflection->ClearOneof(this, field->containing_oneof());
+      }
+      const internal::AuxiliaryParseTableField& aux =
+          type_info_->parse_aux[number];
+      switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_STRING:
+          new (field_ptr) ArenaStringPtr();
+          static_cast<ArenaStringPtr*>(field_ptr)->UnsafeSetDefault(
+              static_cast<const std::string*>(aux.strings.default_ptr));
+          break;
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+          *static_cast<Message**>(field_ptr) =
+              static_cast<const Message*>(aux.messages.default_message())
+                  ->New(GetArena());
+          break;
+        default:
+          break;
+      }
+      *oneof_case = number;
+    }
+  } else if (entry.presence_index != kNoPresence) {
+    uint32* has_bits =
+        static_cast<uint32*>(OffsetToPointer(type_info_->has_bits_offset));
+    has_bits[entry.presence_index / 32] |=
+        static_cast<uint32>(1) << (entry.presence_index % 32);
+  }
+  return field_ptr;
+}
+
+const char* DynamicMessage::ParseField(int number, uint32 tag,
+                                       const char* ptr,
+                                       internal::ParseContext* ctx) {
+  const ParseTableField& entry = type_info_->parse_fields[number];
+  void* field_ptr = OffsetToPointer(entry.offset);
+  // Oneof members are parsed like singular fields; MutableSingularField()
+  // takes care of the oneof case.
+  switch (entry.processing_type & ~internal::kOneofMask) {
+#define HANDLE_TYPE(TYPE, CPPTYPE, READ)                                 \
+  case WireFormatLite::TYPE_##TYPE: {                                    \
+    CPPTYPE value = READ;                                                \
+    if (PROTOBUF_PREDICT_FALSE(ptr == nullptr)) return nullptr;          \
+    *static_cast<CPPTYPE*>(MutableSingularField(number)) = value;        \
+    return ptr;                                                          \
+  }                                                                      \
+  case WireFormatLite::TYPE_##TYPE | internal::kRepeatedMask: {          \
+    CPPTYPE value = READ;                                                \
+    if (PROTOBUF_PREDICT_FALSE(ptr == nullptr)) return nullptr;          \
+    static_cast<RepeatedField<CPPTYPE>*>(field_ptr)->Add(value);         \
+    return ptr;                                                          \
+  }
+
+    HANDLE_TYPE(INT32, int32, static_cast<int32>(internal::ReadVarint64(&ptr)))
+    HANDLE_TYPE(INT64, int64, static_cast<int64>(internal::ReadVarint64(&ptr)))
+    HANDLE_TYPE(UINT32, uint32,
+                static_cast<uint32>(internal::ReadVarint64(&ptr)))
+    HANDLE_TYPE(UINT64, uint64, internal::ReadVarint64(&ptr))
+    HANDLE_TYPE(SINT32, int32, internal::ReadVarintZigZag32(&ptr))
+    HANDLE_TYPE(SINT64, int64, internal::ReadVarintZigZag64(&ptr))
+    HANDLE_TYPE(BOOL, bool, internal::ReadVarint64(&ptr) != 0)
+    HANDLE_TYPE(FIXED32, uint32, ReadFixed<uint32>(&ptr))
+    HANDLE_TYPE(FIXED64, uint64, ReadFixed<uint64>(&ptr))
+    HANDLE_TYPE(SFIXED32, int32, ReadFixed<int32>(&ptr))
+    HANDLE_TYPE(SFIXED64, int64, ReadFixed<int64>(&ptr))
+    HANDLE_TYPE(FLOAT, float, ReadFixed<float>(&ptr))
+    HANDLE_TYPE(DOUBLE, double, ReadFixed<double>(&ptr))
+#undef HANDLE_TYPE
+
+    case WireFormatLite::TYPE_ENUM:
+    case WireFormatLite::TYPE_ENUM | internal::kRepeatedMask: {
+      int value = static_cast<int>(internal::ReadVarint64(&ptr));
+      if (PROTOBUF_PREDICT_FALSE(ptr == nullptr)) return nullptr;
+      const FieldDescriptor* field = type_info_->fields_by_number[number];
+      if (!IsOpenEnum(field) &&
+          !IsKnownEnumValue(field->enum_type(), value)) {
+        internal::WriteVarint(
+            number, value,
+            _internal_metadata_.mutable_unknown_fields<UnknownFieldSet>());
+      } else if (field->is_repeated()) {
+        static_cast<RepeatedField<int>*>(field_ptr)->Add(value);
+      } else {
+        *static_cast<int*>(MutableSingularField(number)) = value;
+      }
+      return ptr;
+    }
+
+    case WireFormatLite::TYPE_STRING:
+    case WireFormatLite::TYPE_BYTES: {
+      const std::string* default_value = static_cast<const std::string*>(
+          type_info_->parse_aux[number].strings.default_ptr);
+      ArenaStringPtr* value =
+          static_cast<ArenaStringPtr*>(MutableSingularField(number));
+      if (entry.processing_type & internal::kOneofMask) {
+        int size = internal::ReadSize(&ptr);
+        if (PROTOBUF_PREDICT_FALSE(ptr == nullptr)) return nullptr;
+        ptr = ctx->ReadString(ptr, size,
+                              value->Mutable(default_value, GetArena()));
+      } else {
+        ptr = internal::InlineGreedyStringParser(value, default_value,
+                                                 GetArena(), ptr, ctx);
+      }
+      if (PROTOBUF_PREDICT_FALSE(ptr == nullptr)) return nullptr;
+      if ((entry.processing_type & ~internal::kOneofMask) ==
+              WireFormatLite::TYPE_STRING &&
+          !VerifyUtf8(type_info_->fields_by_number[number], value->Get(),
+                      internal::WireFormat::PARSE)) {
+        return nullptr;
+      }
+      return ptr;
+    }
+    case WireFormatLite::TYPE_STRING | internal::kRepeatedMask:
+    case WireFormatLite::TYPE_BYTES | internal::kRepeatedMask: {
+      std::string* value =
+          static_cast<RepeatedPtrField<std::string>*>(field_ptr)->Add();
+      ptr = internal::InlineGreedyStringParser(value, ptr, ctx);
+      if (PROTOBUF_PREDICT_FALSE(ptr == nullptr)) return nullptr;
+      if (entry.processing_type ==
+              (WireFormatLite::TYPE_STRING | internal::kRepeatedMask) &&
+          !VerifyUtf8(type_info_->fields_by_number[number], *value,
+                      internal::WireFormat::PARSE)) {
+        return nullptr;
+      }
+      return ptr;
+    }
+
+    case WireFormatLite::TYPE_MESSAGE:
+    case WireFormatLite::TYPE_GROUP: {
+      Message** holder = static_cast<Message**>(MutableSingularField(number));
+      if (*holder == nullptr) {
+        *holder = static_cast<const Message*>(
+                      type_info_->parse_aux[number].messages.default_message())
+                      ->New(GetArena());
+      }
+      if ((entry.processing_type & ~internal::kOneofMask) ==
+          WireFormatLite::TYPE_GROUP) {
+        return ctx->ParseGroup(*holder, ptr, tag);
+      }
+      return ctx->ParseMessage(*holder, ptr);
+    }
+    case WireFormatLite::TYPE_MESSAGE | internal::kRepeatedMask:
+    case WireFormatLite::TYPE_GROUP | internal::kRepeatedMask: {
+      MessageLite* value = internal::MergePartialFromCodedStreamHelper::Add(
+          static_cast<internal::RepeatedPtrFieldBase*>(field_ptr),
+          type_info_->parse_aux[number].messages.default_message());
+      if (entry.processing_type ==
+          (WireFormatLite::TYPE_GROUP | internal::kRepeatedMask)) {
+        return ctx->ParseGroup(value, ptr, tag);
+      }
+      return ctx->ParseMessage(value, ptr);
+    }
+
+    default:
+      GOOGLE_LOG(DFATAL) << "Can't get here.";
+      return nullptr;
+  }
+}
+
+const char* DynamicMessage::ParsePackedField(int number, const char* ptr,
+                                             internal::ParseContext* ctx) {
+  const ParseTableField& entry = type_info_->parse_fields[number];
+  void* field_ptr = OffsetToPointer(entry.offset);
+  switch (entry.processing_type ^ internal::kRepeatedMask) {
+#define HANDLE_PACKED_TYPE(TYPE, PARSER) \
+  case WireFormatLite::TYPE_##TYPE:      \
+    return internal::Packed##PARSER##Parser(field_ptr, ptr, ctx);
+
+    HANDLE_PACKED_TYPE(INT32, Int32)
+    HANDLE_PACKED_TYPE(INT64, Int64)
+    HANDLE_PACKED_TYPE(UINT32, UInt32)
+    HANDLE_PACKED_TYPE(UINT64, UInt64)
+    HANDLE_PACKED_TYPE(SINT32, SInt32)
+    HANDLE_PACKED_TYPE(SINT64, SInt64)
+    HANDLE_PACKED_TYPE(BOOL, Bool)
+    HANDLE_PACKED_TYPE(FIXED32, Fixed32)
+    HANDLE_PACKED_TYPE(FIXED64, Fixed64)
+    HANDLE_PACKED_TYPE(SFIXED32, SFixed32)
+    HANDLE_PACKED_TYPE(SFIXED64, SFixed64)
+    HANDLE_PACKED_TYPE(FLOAT, Float)
+    HANDLE_PACKED_TYPE(DOUBLE, Double)
+#undef HANDLE_PACKED_TYPE
+
+    case WireFormatLite::TYPE_ENUM: {
+      const FieldDescriptor* field = type_info_->fields_by_number[number];
+      if (IsOpenEnum(field)) {
+        return internal::PackedEnumParser(field_ptr, ptr, ctx);
+      }
+      return internal::PackedEnumParserArg<UnknownFieldSet>(
+          field_ptr, ptr, ctx, IsKnownEnumValue, field->enum_type(),
+          &_internal_metadata_, number);
+    }
+
+    default:
+      GOOGLE_LOG(DFATAL) << "Can't get here.";
+      return nullptr;
+  }
+}
+
+const char* DynamicMessage::_InternalParse(const char* ptr,
+                                           internal::ParseContext* ctx) {
+  // Sub-messages are created from this factory's prototypes; a parse that
+  // asks for a different factory takes the reflection path.
+  if (!type_info_->has_fast_tables() ||
+      (ctx->data().factory != nullptr &&
+       ctx->data().factory != type_info_->factory)) {
+    return Message::_InternalParse(ptr, ctx);
+  }
+  const std::vector<ParseTableField>& fields = type_info_->parse_fields;
+  const uint32 max_field_number = type_info_->max_field_number;
+  while (!ctx->Done(&ptr)) {
+    uint32 tag;
+    ptr = internal::ReadTag(ptr, &tag);
+    if (PROTOBUF_PREDICT_FALSE(ptr == nullptr)) return nullptr;
+    if (tag == 0 || (tag & 7) == WireFormatLite::WIRETYPE_END_GROUP) {
+      ctx->SetLastTag(tag);
+      break;
+    }
+    const uint32 number = WireFormatLite::GetTagFieldNumber(tag);
+    const unsigned char wire_type =
+        static_cast<unsigned char>(WireFormatLite::GetTagWireType(tag));
+    if (PROTOBUF_PREDICT_TRUE(number <= max_field_number)) {
+      const ParseTableField& entry = fields[number];
+      if (PROTOBUF_PREDICT_TRUE(entry.normal_wiretype == wire_type)) {
+        ptr = ParseField(number, tag, ptr, ctx);
+        if (PROTOBUF_PREDICT_FALSE(ptr == nullptr)) return nullptr;
+        continue;
+      }
+      if (entry.packed_wiretype == wire_type) {
+        ptr = ParsePackedField(number, ptr, ctx);
+        if (PROTOBUF_PREDICT_FALSE(ptr == nullptr)) return nullptr;
+        continue;
+      }
+    }
+    // Extensions, map fields, unknown fields and mismatched wire types.
+    ptr = internal::WireFormat::_InternalParseField(this, ptr, ctx, tag);
+    if (PROTOBUF_PREDICT_FALSE(ptr == nullptr)) return nullptr;
+  }
+  return ptr;
+}
+
+bool DynamicMessage::HasFieldFast(int number) const {
+  const ParseTableField& entry = type_info_->parse_fields[number];
+  const void* field_ptr = OffsetToPointer(entry.offset);
+  if (entry.processing_type & internal::kOneofMask) {
+    return static_cast<const uint32*>(
+               OffsetToPointer(type_info_->oneof_case_offset))
+               [entry.presence_index] == static_cast<uint32>(number);
+  }
+  if (entry.presence_index != kNoPresence) {
+    const uint32* has_bits = static_cast<const uint32*>(
+        OffsetToPointer(type_info_->has_bits_offset));
+    return (has_bits[entry.presence_index / 32] >>
+            (entry.presence_index % 32)) & 1;
+  }
+  // Without a has_bit, a field is present iff it has a non-default value,
+  // exactly as in Reflection::HasBit().
+  switch (entry.processing_type) {
+    case WireFormatLite::TYPE_STRING:
+    case WireFormatLite::TYPE_BYTES:
+      return !static_cast<const ArenaStringPtr*>(field_ptr)->Get().empty();
+    case WireFormatLite::TYPE_MESSAGE:
+    case WireFormatLite::TYPE_GROUP:
+      return *static_cast<const Message* const*>(field_ptr) != nullptr;
+    case WireFormatLite::TYPE_BOOL:
+      return *static_cast<const bool*>(field_ptr);
+    case WireFormatLite::TYPE_FLOAT:
+      return *static_cast<const float*>(field_ptr) != 0.0;
+    case WireFormatLite::TYPE_DOUBLE:
+      return *static_cast<const double*>(field_ptr) != 0.0;
+    case WireFormatLite::TYPE_INT64:
+    case WireFormatLite::TYPE_UINT64:
+    case WireFormatLite::TYPE_SINT64:
+    case WireFormatLite::TYPE_FIXED64:
+    case WireFormatLite::TYPE_SFIXED64:
+      return *static_cast<const uint64*>(field_ptr) != 0;
+    default:
+      return *static_cast<const uint32*>(field_ptr) != 0;
+  }
+}
+
+size_t DynamicMessage::FieldByteSizeFast(int number) const {
+  const ParseTableField& entry = type_info_->parse_fields[number];
+  const void* field_ptr = OffsetToPointer(entry.offset);
+  const unsigned char type = entry.processing_type & ~internal::kOneofMask;
+
+  if (type == internal::TYPE_MAP) {
+    return internal::WireFormat::FieldByteSize(
+        type_info_->fields_by_number[number], *this);
+  }
+
+  if (type & internal::kRepeatedMask) {
+    size_t count = 0;
+    size_t data_size = 0;
+    switch (type ^ internal::kRepeatedMask) {
+#define HANDLE_TYPE(TYPE, CPPTYPE, SIZE)                                   \
+  case WireFormatLite::TYPE_##TYPE: {                                      \
+    const RepeatedField<CPPTYPE>& values =                                 \
+        *static_cast<const RepeatedField<CPPTYPE>*>(field_ptr);            \
+    count = values.size();                                                 \
+    data_size = SIZE;                                                      \
+    break;                                                                 \
+  }
+
+      HANDLE_TYPE(INT32, int32, WireFormatLite::Int32Size(values))
+      HANDLE_TYPE(INT64, int64, WireFormatLite::Int64Size(values))
+      HANDLE_TYPE(UINT32, uint32, WireFormatLite::UInt32Size(values))
+      HANDLE_TYPE(UINT64, uint64, WireFormatLite::UInt64Size(values))
+      HANDLE_TYPE(SINT32, int32, WireFormatLite::SInt32Size(values))
+      HANDLE_TYPE(SINT64, int64, WireFormatLite::SInt64Size(values))
+      HANDLE_TYPE(ENUM, int, WireFormatLite::EnumSize(values))
+      HANDLE_TYPE(BOOL, bool, count * WireFormatLite::kBoolSize)
+      HANDLE_TYPE(FIXED32, uint32, count * WireFormatLite::kFixed32Size)
+      HANDLE_TYPE(FIXED64, uint64, count * WireFormatLite::kFixed64Size)
+      HANDLE_TYPE(SFIXED32, int32, count * WireFormatLite::kSFixed32Size)
+      HANDLE_TYPE(SFIXED64, int64, count * WireFormatLite::kSFixed64Size)
+      HANDLE_TYPE(FLOAT, float, count * WireFormatLite::kFloatSize)
+      HANDLE_TYPE(DOUBLE, double, count * WireFormatLite::kDoubleSize)
+#undef HANDLE_TYPE
+
+      case WireFormatLite::TYPE_STRING:
+      case WireFormatLite::TYPE_BYTES: {
+        const RepeatedPtrField<std::string>& values =
+            *static_cast<const RepeatedPtrField<std::string>*>(field_ptr);
+        count = values.size();
+        for (const std::string& value : values) {
+          data_size += WireFormatLite::StringSize(value);
+        }
+        break;
+      }
+      case WireFormatLite::TYPE_MESSAGE:
+      case WireFormatLite::TYPE_GROUP: {
+        const RepeatedPtrField<Message>& values =
+            *static_cast<const RepeatedPtrField<Message>*>(field_ptr);
+        count = values.size();
+        for (const Message& value : values) {
+          data_size += type == (WireFormatLite::TYPE_GROUP |
+                                internal::kRepeatedMask)
+                           ? WireFormatLite::GroupSize(value)
+                           : WireFormatLite::MessageSize(value);
+        }
+        break;
+      }
+    }
+    if (type_info_->fields_by_number[number]->is_packed()) {
+      if (data_size == 0) return 0;
+      return entry.tag_size +
+             io::CodedOutputStream::VarintSize32(
+                 static_cast<uint32>(data_size)) +
+             data_size;
+    }
+    return count * entry.tag_size + data_size;
+  }
+
+  if (!HasFieldFast(number)) return 0;
+  size_t size = entry.tag_size;
+  switch (type) {
+#define HANDLE_TYPE(TYPE, CPPTYPE, SIZE)                           \
+  case WireFormatLite::TYPE_##TYPE: {                              \
+    const CPPTYPE& value = *static_cast<const CPPTYPE*>(field_ptr); \
+    (void)value;                                                   \
+    size += SIZE;                                                  \
+    break;                                                         \
+  }
+
+    HANDLE_TYPE(INT32, int32, WireFormatLite::Int32Size(value))
+    HANDLE_TYPE(INT64, int64, WireFormatLite::Int64Size(value))
+    HANDLE_TYPE(UINT32, uint32, WireFormatLite::UInt32Size(value))
+    HANDLE_TYPE(UINT64, uint64, WireFormatLite::UInt64Size(value))
+    HANDLE_TYPE(SINT32, int32, WireFormatLite::SInt32Size(value))
+    HANDLE_TYPE(SINT64, int64, WireFormatLite::SInt64Size(value))
+    HANDLE_TYPE(ENUM, int, WireFormatLite::EnumSize(value))
+    HANDLE_TYPE(BOOL, bool, WireFormatLite::kBoolSize)
+    HANDLE_TYPE(FIXED32, uint32, WireFormatLite::kFixed32Size)
+    HANDLE_TYPE(FIXED64, uint64, WireFormatLite::kFixed64Size)
+    HANDLE_TYPE(SFIXED32, int32, WireFormatLite::kSFixed32Size)
+    HANDLE_TYPE(SFIXED64, int64, WireFormatLite::kSFixed64Size)
+    HANDLE_TYPE(FLOAT, float, WireFormatLite::kFloatSize)
+    HANDLE_TYPE(DOUBLE, double, WireFormatLite::kDoubleSize)
+    HANDLE_TYPE(STRING, ArenaStringPtr, WireFormatLite::StringSize(value.Get()))
+    HANDLE_TYPE(BYTES, ArenaStringPtr, WireFormatLite::BytesSize(value.Get()))
+    HANDLE_TYPE(MESSAGE, Message* const, WireFormatLite::MessageSize(*value))
+    HANDLE_TYPE(GROUP, Message* const, WireFormatLite::GroupSize(*value))
+#undef HANDLE_TYPE
+  }
+  return size;
+}
+
+uint8* DynamicMessage::SerializeFieldFast(
+    int number, uint8* target, io::EpsCopyOutputStream* stream) const {
+  const ParseTableField& entry = type_info_->parse_fields[number];
+  const void* field_ptr = OffsetToPointer(entry.offset);
+  const unsigned char type = entry.processing_type & ~internal::kOneofMask;
+  const FieldDescriptor* field = type_info_->fields_by_number[number];
+
+  if (type == internal::TYPE_MAP) {
+    return internal::WireFormat::InternalSerializeField(field, *this, target,
+                                                        stream);
+  }
+
+  if (type & internal::kRepeatedMask) {
+    switch (type ^ internal::kRepeatedMask) {
+#define HANDLE_TYPE(TYPE, CPPTYPE, TYPE_METHOD, PACKED)                      \
+  case WireFormatLite::TYPE_##TYPE: {                                        \
+    const RepeatedField<CPPTYPE>& values =                                   \
+        *static_cast<const RepeatedField<CPPTYPE>*>(field_ptr);              \
+    if (values.empty()) return target;                                       \
+    if (field->is_packed()) {                                                \
+      target = stream->EnsureSpace(target);                                  \
+      return PACKED;                                                         \
+    }                                                                        \
+    for (CPPTYPE value : values) {                                           \
+      target = stream->EnsureSpace(target);                                  \
+      target =                                                               \
+          WireFormatLite::Write##TYPE_METHOD##ToArray(number, value, target); \
+    }                                                                        \
+    return target;                                                           \
+  }
+#define VARINT_PACKED(TYPE_METHOD)                                          \
+  stream->Write##TYPE_METHOD##Packed(                                      \
+      number, values,                                                      \
+      static_cast<int>(WireFormatLite::TYPE_METHOD##Size(values)), target)
+#define FIXED_PACKED stream->WriteFixedPacked(number, values, target)
+
+      HANDLE_TYPE(INT32, int32, Int32, VARINT_PACKED(Int32))
+      HANDLE_TYPE(INT64, int64, Int64, VARINT_PACKED(Int64))
+      HANDLE_TYPE(UINT32, uint32, UInt32, VARINT_PACKED(UInt32))
+      HANDLE_TYPE(UINT64, uint64, UInt64, VARINT_PACKED(UInt64))
+      HANDLE_TYPE(SINT32, int32, SInt32, VARINT_PACKED(SInt32))
+      HANDLE_TYPE(SINT64, int64, SInt64, VARINT_PACKED(SInt64))
+      HANDLE_TYPE(ENUM, int, Enum, VARINT_PACKED(Enum))
+      HANDLE_TYPE(BOOL, bool, Bool, FIXED_PACKED)
+      HANDLE_TYPE(FIXED32, uint32, Fixed32, FIXED_PACKED)
+      HANDLE_TYPE(FIXED64, uint64, Fixed64, FIXED_PACKED)
+      HANDLE_TYPE(SFIXED32, int32, SFixed32, FIXED_PACKED)
+      HANDLE_TYPE(SFIXED64, int64, SFixed64, FIXED_PACKED)
+      HANDLE_TYPE(FLOAT, float, Float, FIXED_PACKED)
+      HANDLE_TYPE(DOUBLE, double, Double, FIXED_PACKED)
+#undef FIXED_PACKED
+#undef VARINT_PACKED
+#undef HANDLE_TYPE
+
+      case WireFormatLite::TYPE_STRING:
+      case WireFormatLite::TYPE_BYTES:
+        for (const std::string& value :
+             *static_cast<const RepeatedPtrField<std::string>*>(field_ptr)) {
+          if (type == (WireFormatLite::TYPE_STRING | internal::kRepeatedMask)) {
+            VerifyUtf8(field, value, internal::WireFormat::SERIALIZE);
+          }
+          target = stream->WriteString(number, value, target);
+        }
+        return target;
+      case WireFormatLite::TYPE_MESSAGE:
+        for (const Message& value :
+             *static_cast<const RepeatedPtrField<Message>*>(field_ptr)) {
+          target = WireFormatLite::InternalWriteMessage(number, value, target,
+                                                        stream);
+        }
+        return target;
+      case WireFormatLite::TYPE_GROUP:
+        for (const Message& value :
+             *static_cast<const RepeatedPtrField<Message>*>(field_ptr)) {
+          target =
+              WireFormatLite::InternalWriteGroup(number, value, target, stream);
+        }
+        return target;
+    }
+    return target;
+  }
+
+  if (!HasFieldFast(number)) return target;
+  switch (type) {
+#define HANDLE_TYPE(TYPE, CPPTYPE, TYPE_METHOD)                          \
+  case WireFormatLite::TYPE_##TYPE:                                      \
+    target = stream->EnsureSpace(target);                                \
+    return WireFormatLite::Write##TYPE_METHOD##ToArray(                  \
+        number, *static_cast<const CPPTYPE*>(field_ptr), target);
+
+    HANDLE_TYPE(INT32, int32, Int32)
+    HANDLE_TYPE(INT64, int64, Int64)
+    HANDLE_TYPE(UINT32, uint32, UInt32)
+    HANDLE_TYPE(UINT64, uint64, UInt64)
+    HANDLE_TYPE(SINT32, int32, SInt32)
+    HANDLE_TYPE(SINT64, int64, SInt64)
+    HANDLE_TYPE(ENUM, int, Enum)
+    HANDLE_TYPE(BOOL, bool, Bool)
+    HANDLE_TYPE(FIXED32, uint32, Fixed32)
+    HANDLE_TYPE(FIXED64, uint64, Fixed64)
+    HANDLE_TYPE(SFIXED32, int32, SFixed32)
+    HANDLE_TYPE(SFIXED64, int64, SFixed64)
+    HANDLE_TYPE(FLOAT, float, Float)
+    HANDLE_TYPE(DOUBLE, double, Double)
+#undef HANDLE_TYPE
+
+    case WireFormatLite::TYPE_STRING:
+    case WireFormatLite::TYPE_BYTES: {
+      const std::string& value =
+          static_cast<const ArenaStringPtr*>(field_ptr)->Get();
+      if (type == WireFormatLite::TYPE_STRING) {
+        VerifyUtf8(field, value, internal::WireFormat::SERIALIZE);
+      }
+      return stream->WriteString(number, value, target);
+    }
+    case WireFormatLite::TYPE_MESSAGE:
+      return WireFormatLite::InternalWriteMessage(
+          number, **static_cast<const Message* const*>(field_ptr), target,
+          stream);
+    case WireFormatLite::TYPE_GROUP:
+      return WireFormatLite::InternalWriteGroup(
+          number, **static_cast<const Message* const*>(field_ptr), target,
+          stream);
+  }
+  return target;
+}
+
+size_t DynamicMessage::ByteSizeLong() const {
+  // The prototype reports its cross-linked default sub-messages as absent;
+  // leave that to Reflection.
+  if (!type_info_->has_fast_tables() || is_prototype()) {
+    return Message::ByteSizeLong();
+  }
+  size_t total_size = 0;
+  const std::vector<const FieldDescriptor*>& fields =
+      type_info_->fields_by_number;
+  for (size_t number = 1; number < fields.size(); number++) {
+    if (fields[number] != nullptr) {
+      total_size += FieldByteSizeFast(number);
+    }
+  }
+  if (type_info_->extensions_offset != -1) {
+    total_size += static_cast<const ExtensionSet*>(
+                      OffsetToPointer(type_info_->extensions_offset))
+                      ->ByteSize();
+  }
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size += internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields<UnknownFieldSet>(
+            UnknownFieldSet::default_instance));
+  }
+  SetCachedSize(internal::ToCachedSize(total_size));
+  return total_size;
+}
+
+uint8* DynamicMessage::_InternalSerialize(
+    uint8* target, io::EpsCopyOutputStream* stream) const {
+  if (!type_info_->has_fast_tables() || is_prototype()) {
+    return Message::_InternalSerialize(target, stream);
+  }
+  const std::vector<const FieldDescriptor*>& fields =
+      type_info_->fields_by_number;
+  const std::vector<const Descriptor::ExtensionRange*>& ranges =
+      type_info_->extension_ranges;
+  const ExtensionSet* extensions =
+      type_info_->extensions_offset != -1
+          ? static_cast<const ExtensionSet*>(
+                OffsetToPointer(type_info_->extensions_offset))
+          : nullptr;
+  // Fields and extension ranges are written in field number order.
+  size_t next_range = 0;
+  for (size_t number = 1; number < fields.size(); number++) {
+    if (fields[number] == nullptr) continue;
+    for (; next_range < ranges.size() &&
+           ranges[next_range]->start < static_cast<int>(number);
+         next_range++) {
+      target = extensions->_InternalSerialize(
+          ranges[next_range]->start, ranges[next_range]->end, target, stream);
+    }
+    target = SerializeFieldFast(number, target, stream);
+  }
+  for (; next_range < ranges.size(); next_range++) {
+    target = extensions->_InternalSerialize(
+        ranges[next_range]->start, ranges[next_range]->end, target, stream);
+  }
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<UnknownFieldSet>(
+            UnknownFieldSet::default_instance),
+        target, stream);
+  }
+  return target;
+}
+
 // ===================================================================
 
 struct DynamicMessageFactory::PrototypeMap {
   typedef std::unordered_map<const Descriptor*, const DynamicMessage::TypeInfo*>
       Map;
+  // All types, including ones still being built.  Guarded by
+  // prototypes_mutex_.
   Map map_;
+  // Types whose prototypes are complete but not yet in published_.
+  std::vector<const Descriptor*> unpublished_;
+  // Complete prototypes, read without taking prototypes_mutex_.
+  internal::ReadMostlyMap<const Descriptor*, const Message*> published_;
 };
 
 DynamicMessageFactory::DynamicMessageFactory()
@@ -676,8 +1536,29 @@ DynamicMessageFactory::~DynamicMessageFactory() {
 }
 
 const Message* DynamicMessageFactory::GetPrototype(const Descriptor* type) {
+  if (delegate_to_generated_factory_ &&
+      type->file()->pool() == DescriptorPool::generated_pool()) {
+    return MessageFactory::generated_factory()->GetPrototype(type);
+  }
+  // Prototypes are never removed, so one that has been published can be
+  // returned without locking.
+  if (const Message* const* prototype = prototypes_->published_.Find(type)) {
+    return *prototype;
+  }
+
   MutexLock lock(&prototypes_mutex_);
-  return GetPrototypeNoLock(type);
+  const Message* prototype = GetPrototypeNoLock(type);
+  // Building a prototype may have built those of the types it references.
+  // They are only complete now, when the outermost call has returned.
+  for (const Descriptor* built : prototypes_->unpublished_) {
+    prototypes_->published_.Insert(built, prototypes_->map_[built]->prototype);
+  }
+  prototypes_->unpublished_.clear();
+  return prototype;
+}
+
+size_t DynamicMessageFactory::GetInstanceSize(const Descriptor* type) {
+  return GetPrototype(type)->GetReflection()->schema_.GetObjectSize();
 }
 
 const Message* DynamicMessageFactory::GetPrototypeNoLock(
@@ -695,6 +1576,7 @@ const Message* DynamicMessageFactory::GetPrototypeNoLock(
 
   DynamicMessage::TypeInfo* type_info = new DynamicMessage::TypeInfo;
   *target = type_info;
+  prototypes_->unpublished_.push_back(type);
 
   type_info->type = type;
   type_info->pool = (pool_ == NULL) ? type->file()->pool() : pool_;
@@ -718,44 +1600,73 @@ const Message* DynamicMessageFactory::GetPrototypeNoLock(
   uint32* offsets = new uint32[type->field_count() + real_oneof_count];
   type_info->offsets.reset(offsets);
 
-  // Decide all field offsets by packing in order.
+  // Decide all field offsets.
   // We place the DynamicMessage object itself at the beginning of the allocated
   // space.
   int size = sizeof(DynamicMessage);
   size = AlignOffset(size);
 
-  // Next the has_bits, which is an array of uint32s.
-  type_info->has_bits_offset = -1;
-  int max_hasbit = 0;
+  // The fields outside of real oneofs are laid out in two runs, the POD
+  // fields and all the others, each ordered like the members of a generated
+  // class to avoid padding.
+  std::vector<const FieldDescriptor*> pod_fields;
+  std::vector<const FieldDescriptor*> other_fields;
+  int hasbit_count = 0;
   for (int i = 0; i < type->field_count(); i++) {
-    if (HasHasbit(type->field(i))) {
-      if (type_info->has_bits_offset == -1) {
-        // At least one field in the message requires a hasbit, so allocate
-        // hasbits.
-        type_info->has_bits_offset = size;
-        uint32* has_bits_indices = new uint32[type->field_count()];
-        for (int i = 0; i < type->field_count(); i++) {
-          // Initialize to -1, fields that need a hasbit will overwrite.
-          has_bits_indices[i] = static_cast<uint32>(-1);
-        }
-        type_info->has_bits_indices.reset(has_bits_indices);
+    const FieldDescriptor* field = type->field(i);
+    if (HasHasbit(field)) hasbit_count++;
+    if (InRealOneof(field)) continue;
+    (IsPODField(field) ? pod_fields : other_fields).push_back(field);
+  }
+  int has_bits_array_size = DivideRoundingUp(hasbit_count, bitsizeof(uint32));
+  OptimizeLayout(&pod_fields, has_bits_array_size % 2 != 0);
+  OptimizeLayout(&other_fields, false);
+
+  // Next the has_bits, which is an array of uint32s.  Has-bits are handed out
+  // in layout order, so fields that are next to each other in memory share
+  // has-bit words, as in generated classes.
+  type_info->has_bits_offset = -1;
+  if (hasbit_count > 0) {
+    type_info->has_bits_offset = size;
+    uint32* has_bits_indices = new uint32[type->field_count()];
+    for (int i = 0; i < type->field_count(); i++) {
+      // Initialize to -1, fields that need a hasbit will overwrite.
+      has_bits_indices[i] = static_cast<uint32>(-1);
+    }
+    type_info->has_bits_indices.reset(has_bits_indices);
+    int max_hasbit = 0;
+    for (const std::vector<const FieldDescriptor*>* run :
+         {&pod_fields, &other_fields}) {
+      for (const FieldDescriptor* field : *run) {
+        if (HasHasbit(field)) has_bits_indices[field->index()] = max_hasbit++;
       }
-      type_info->has_bits_indices[i] = max_hasbit++;
     }
+    GOOGLE_DCHECK_EQ(max_hasbit, hasbit_count);
+    size += has_bits_array_size * sizeof(uint32);
   }
 
-  if (max_hasbit > 0) {
-    int has_bits_array_size = DivideRoundingUp(max_hasbit, bitsizeof(uint32));
-    size += has_bits_array_size * sizeof(uint32);
-    size = AlignOffset(size);
+  // The POD fields go right after the has_bits so that both can be copied
+  // as a single block of memory.  The first of them may fill the last four
+  // bytes of an odd number of has-bit words.
+  type_info->pod_begin_offset = type_info->has_bits_offset != -1
+                                    ? type_info->has_bits_offset
+                                    : size;
+  for (const FieldDescriptor* field : pod_fields) {
+    int field_size = FieldSpaceUsed(field);
+    size = AlignTo(size, std::min(kSafeAlignment, field_size));
+    offsets[field->index()] = size;
+    size += field_size;
   }
+  type_info->pod_end_offset = size;
 
-  // The oneof_case, if any. It is an array of uint32s.
+  // The oneof_case, if any. It is an array of uint32s, which may start in
+  // the padding after the POD fields.
   if (real_oneof_count > 0) {
+    size = AlignTo(size, sizeof(uint32));
     type_info->oneof_case_offset = size;
     size += real_oneof_count * sizeof(uint32);
-    size = AlignOffset(size);
   }
+  size = AlignOffset(size);
 
   // The ExtensionSet, if any.
   if (type->extension_range_count() > 0) {
@@ -767,19 +1678,14 @@ const Message* DynamicMessageFactory::GetPrototypeNoLock(
     type_info->extensions_offset = -1;
   }
 
-  // All the fields.
-  //
-  // TODO(b/31226269):  Optimize the order of fields to minimize padding.
+  // All the remaining fields.  They are all pointer-aligned.
   int num_weak_fields = 0;
-  for (int i = 0; i < type->field_count(); i++) {
+  for (const FieldDescriptor* field : other_fields) {
     // Make sure field is aligned to avoid bus errors.
-    // Oneof fields do not use any space.
-    if (!InRealOneof(type->field(i))) {
-      int field_size = FieldSpaceUsed(type->field(i));
-      size = AlignTo(size, std::min(kSafeAlignment, field_size));
-      offsets[i] = size;
-      size += field_size;
-    }
+    int field_size = FieldSpaceUsed(field);
+    size = AlignTo(size, std::min(kSafeAlignment, field_size));
+    offsets[field->index()] = size;
+    size += field_size;
   }
 
   // The oneofs.
@@ -843,6 +1749,8 @@ const Message* DynamicMessageFactory::GetPrototypeNoLock(
   // Cross link prototypes.
   prototype->CrossLinkPrototypes();
 
+  DynamicMessage::BuildFastTables(type_info);
+
   return prototype;
 }
 
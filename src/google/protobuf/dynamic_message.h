@@ -121,9 +121,17 @@ class PROTOBUF_EXPORT DynamicMessageFactory : public MessageFactory {
   // The given descriptor must outlive the returned message, and hence must
   // outlive the DynamicMessageFactory.
   //
-  // The method is thread-safe.
+  // The method is thread-safe.  Once a prototype has been built, looking it
+  // up again takes no lock.
   const Message* GetPrototype(const Descriptor* type) override;
 
+  // Returns the number of bytes that one message of the given type occupies,
+  // not counting memory owned by its fields (strings, sub-messages, repeated
+  // elements, unknown fields).  This is what New() allocates for a
+  // DynamicMessage, and sizeof() of the class if the factory delegates to the
+  // generated factory.  Builds the prototype if it does not exist yet.
+  size_t GetInstanceSize(const Descriptor* type);
+
  private:
   const DescriptorPool* pool_;
   bool delegate_to_generated_factory_;
@@ -51,6 +51,7 @@
 
 #include <google/protobuf/stubs/logging.h>
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/strutil.h>
 #include <google/protobuf/testing/googletest.h>
 #include <gtest/gtest.h>
 
@@ -156,6 +157,61 @@ TEST_P(DynamicMessageTest, IndependentOffsets) {
   }
 }
 
+TEST_P(DynamicMessageTest, CopyFrom) {
+  // CopyFrom() between dynamic messages of the same type takes a fast path
+  // that copies the POD fields as raw bytes.
+  Arena arena;
+  Message* from = prototype_->New(GetParam() ? &arena : NULL);
+  Message* to = prototype_->New(GetParam() ? &arena : NULL);
+  TestUtil::ReflectionTester reflection_tester(descriptor_);
+
+  reflection_tester.SetAllFieldsViaReflection(from);
+  reflection_tester.SetAllFieldsViaReflection(to);
+  reflection_tester.ModifyRepeatedFieldsViaReflection(to);
+  to->CopyFrom(*from);
+  reflection_tester.ExpectAllFieldsSetViaReflection(*to);
+
+  // Copying a cleared message must clear everything, including has_bits.
+  from->Clear();
+  to->CopyFrom(*from);
+  reflection_tester.ExpectClearViaReflection(*to);
+
+  if (!GetParam()) {
+    delete from;
+    delete to;
+  }
+}
+
+TEST_P(DynamicMessageTest, CopyFromExtensionsAndOneof) {
+  Arena arena;
+  Message* from = extensions_prototype_->New(GetParam() ? &arena : NULL);
+  Message* to = extensions_prototype_->New(GetParam() ? &arena : NULL);
+  TestUtil::ReflectionTester reflection_tester(extensions_descriptor_);
+
+  reflection_tester.SetAllFieldsViaReflection(from);
+  to->CopyFrom(*from);
+  reflection_tester.ExpectAllFieldsSetViaReflection(*to);
+
+  Message* oneof_from = oneof_prototype_->New(GetParam() ? &arena : NULL);
+  Message* oneof_to = oneof_prototype_->New(GetParam() ? &arena : NULL);
+  const Reflection* reflection = oneof_from->GetReflection();
+  const FieldDescriptor* foo_string =
+      oneof_descriptor_->FindFieldByName("foo_string");
+  const FieldDescriptor* bar_int = oneof_descriptor_->FindFieldByName("bar_int");
+  reflection->SetString(oneof_from, foo_string, "foo");
+  reflection->SetInt32(oneof_from, bar_int, 7);
+  oneof_to->CopyFrom(*oneof_from);
+  EXPECT_EQ("foo", reflection->GetString(*oneof_to, foo_string));
+  EXPECT_EQ(7, reflection->GetInt32(*oneof_to, bar_int));
+
+  if (!GetParam()) {
+    delete from;
+    delete to;
+    delete oneof_from;
+    delete oneof_to;
+  }
+}
+
 TEST_P(DynamicMessageTest, Extensions) {
   // Check that extensions work.
   Arena arena;
@@ -271,6 +327,147 @@ TEST_P(DynamicMessageTest, SpaceUsed) {
   }
 }
 
+TEST_P(DynamicMessageTest, ParseAndSerialize) {
+  // DynamicMessage parses and serializes through its own field tables; make
+  // sure the wire format matches the generated code byte for byte.
+  Arena arena;
+  unittest::TestAllTypes generated;
+  TestUtil::SetAllFields(&generated);
+  std::string data = generated.SerializeAsString();
+
+  Message* message = prototype_->New(GetParam() ? &arena : NULL);
+  ASSERT_TRUE(message->ParseFromString(data));
+  TestUtil::ReflectionTester reflection_tester(descriptor_);
+  reflection_tester.ExpectAllFieldsSetViaReflection(*message);
+  EXPECT_EQ(data.size(), message->ByteSizeLong());
+  EXPECT_EQ(data, message->SerializeAsString());
+
+  // Parsing again merges into the existing fields.
+  ASSERT_TRUE(message->MergeFromString(data));
+  unittest::TestAllTypes copy(generated);
+  generated.MergeFrom(copy);
+  EXPECT_EQ(generated.SerializeAsString(), message->SerializeAsString());
+
+  if (!GetParam()) {
+    delete message;
+  }
+}
+
+TEST_P(DynamicMessageTest, ParseAndSerializePackedAndExtensions) {
+  Arena arena;
+  unittest::TestPackedTypes packed;
+  TestUtil::SetPackedFields(&packed);
+  std::string packed_data = packed.SerializeAsString();
+  Message* packed_message = packed_prototype_->New(GetParam() ? &arena : NULL);
+  ASSERT_TRUE(packed_message->ParseFromString(packed_data));
+  TestUtil::ReflectionTester packed_tester(packed_descriptor_);
+  packed_tester.ExpectPackedFieldsSetViaReflection(*packed_message);
+  EXPECT_EQ(packed_data, packed_message->SerializeAsString());
+
+  // Packed fields also accept the unpacked encoding.
+  unittest::TestUnpackedTypes unpacked;
+  TestUtil::SetUnpackedFields(&unpacked);
+  packed_message->Clear();
+  ASSERT_TRUE(packed_message->ParseFromString(unpacked.SerializeAsString()));
+  packed_tester.ExpectPackedFieldsSetViaReflection(*packed_message);
+  EXPECT_EQ(packed_data, packed_message->SerializeAsString());
+
+  unittest::TestAllExtensions extensions;
+  TestUtil::SetAllExtensions(&extensions);
+  std::string extensions_data = extensions.SerializeAsString();
+  Message* extensions_message =
+      extensions_prototype_->New(GetParam() ? &arena : NULL);
+  ASSERT_TRUE(extensions_message->ParseFromString(extensions_data));
+  TestUtil::ReflectionTester extensions_tester(extensions_descriptor_);
+  extensions_tester.ExpectAllFieldsSetViaReflection(*extensions_message);
+  EXPECT_EQ(extensions_data, extensions_message->SerializeAsString());
+
+  if (!GetParam()) {
+    delete packed_message;
+    delete extensions_message;
+  }
+}
+
+TEST_P(DynamicMessageTest, ParseOneof) {
+  Arena arena;
+  unittest::TestOneof2 generated;
+  TestUtil::SetOneof1(&generated);
+  unittest::TestOneof2 other;
+  TestUtil::SetOneof2(&other);
+
+  Message* message = oneof_prototype_->New(GetParam() ? &arena : NULL);
+  ASSERT_TRUE(message->ParseFromString(generated.SerializeAsString()));
+  EXPECT_EQ(generated.SerializeAsString(), message->SerializeAsString());
+
+  // A later member of the same oneof replaces the earlier one.
+  ASSERT_TRUE(message->MergeFromString(other.SerializeAsString()));
+  generated.MergeFrom(other);
+  EXPECT_EQ(generated.SerializeAsString(), message->SerializeAsString());
+
+  if (!GetParam()) {
+    delete message;
+  }
+}
+
+TEST_P(DynamicMessageTest, ParseUnknownFields) {
+  Arena arena;
+  unittest::TestEmptyMessage unknown;
+  UnknownFieldSet* unknown_fields = unknown.mutable_unknown_fields();
+  // An unknown value of a closed enum.
+  unknown_fields->AddVarint(
+      unittest::TestAllTypes::kOptionalNestedEnumFieldNumber, 12345);
+  // A known field with the wrong wire type.
+  unknown_fields->AddFixed32(unittest::TestAllTypes::kOptionalInt32FieldNumber,
+                             7);
+  // A field number the message does not define.
+  unknown_fields->AddVarint(123456, 1);
+  std::string data = unknown.SerializeAsString();
+
+  Message* message = prototype_->New(GetParam() ? &arena : NULL);
+  ASSERT_TRUE(message->ParseFromString(data));
+  const Reflection* reflection = message->GetReflection();
+  EXPECT_FALSE(reflection->HasField(
+      *message, descriptor_->FindFieldByName("optional_nested_enum")));
+  EXPECT_FALSE(reflection->HasField(
+      *message, descriptor_->FindFieldByName("optional_int32")));
+  EXPECT_EQ(3, reflection->GetUnknownFields(*message).field_count());
+  EXPECT_EQ(data, message->SerializeAsString());
+
+  if (!GetParam()) {
+    delete message;
+  }
+}
+
+TEST_P(DynamicMessageTest, ParseAndSerializeProto3) {
+  Arena arena;
+  proto2_nofieldpresence_unittest::TestAllTypes generated;
+  generated.set_optional_int32(1);
+  generated.set_optional_string("foo");
+  generated.mutable_optional_nested_message()->set_bb(2);
+  generated.set_optional_nested_enum(
+      proto2_nofieldpresence_unittest::TestAllTypes::BAZ);
+  generated.add_repeated_int32(3);
+  generated.add_repeated_int32(4);
+  generated.add_repeated_nested_message()->set_bb(5);
+  generated.set_oneof_string("bar");
+  std::string data = generated.SerializeAsString();
+
+  Message* message = proto3_prototype_->New(GetParam() ? &arena : NULL);
+  ASSERT_TRUE(message->ParseFromString(data));
+  EXPECT_EQ(data, message->SerializeAsString());
+
+  // Fields set to their default values are not serialized.
+  const Reflection* reflection = message->GetReflection();
+  reflection->SetInt32(
+      message, proto3_descriptor_->FindFieldByName("optional_int32"), 0);
+  generated.set_optional_int32(0);
+  EXPECT_EQ(generated.SerializeAsString(), message->SerializeAsString());
+
+  if (!GetParam()) {
+    delete message;
+  }
+}
+
 TEST_F(DynamicMessageTest, Arena) {
   Arena arena;
   Message* message = prototype_->New(&arena);
@@ -320,6 +517,71 @@ TEST_F(DynamicMessageTest, Proto3) {
   delete message;
 }
 
+TEST_F(DynamicMessageTest, InstanceSize) {
+  // Fields are reordered so that small fields share the padding of large
+  // ones, as in generated classes.
+  FileDescriptorProto file;
+  file.set_name("padding.proto");
+  file.set_syntax("proto3");
+  file.add_message_type()->set_name("Empty");
+  DescriptorProto* padded = file.add_message_type();
+  padded->set_name("Padded");
+  const FieldDescriptorProto::Type kTypes[] = {
+      FieldDescriptorProto::TYPE_BOOL, FieldDescriptorProto::TYPE_INT64,
+      FieldDescriptorProto::TYPE_BOOL, FieldDescriptorProto::TYPE_DOUBLE,
+      FieldDescriptorProto::TYPE_BOOL, FieldDescriptorProto::TYPE_INT32};
+  for (int i = 0; i < 6; i++) {
+    FieldDescriptorProto* field = padded->add_field();
+    field->set_name("f" + StrCat(i + 1));
+    field->set_number(i + 1);
+    field->set_label(FieldDescriptorProto::LABEL_OPTIONAL);
+    field->set_type(kTypes[i]);
+  }
+  ASSERT_TRUE(pool_.BuildFile(file) != NULL);
+  const Descriptor* empty = pool_.FindMessageTypeByName("Empty");
+  const Descriptor* descriptor = pool_.FindMessageTypeByName("Padded");
+
+  // Two 8-byte fields, then the three bools and the int32 in one 8-byte block.
+  EXPECT_EQ(factory_.GetInstanceSize(empty) + 24,
+            factory_.GetInstanceSize(descriptor));
+  EXPECT_EQ(factory_.GetInstanceSize(descriptor),
+            factory_.GetPrototype(descriptor)->SpaceUsedLong());
+
+  Message* message = factory_.GetPrototype(descriptor)->New();
+  const Reflection* reflection = message->GetReflection();
+  for (int i = 0; i < descriptor->field_count(); i++) {
+    const FieldDescriptor* field = descriptor->field(i);
+    switch (field->cpp_type()) {
+      case FieldDescriptor::CPPTYPE_BOOL:
+        reflection->SetBool(message, field, true);
+        break;
+      case FieldDescriptor::CPPTYPE_INT32:
+        reflection->SetInt32(message, field, -i);
+        break;
+      case FieldDescriptor::CPPTYPE_INT64:
+        reflection->SetInt64(message, field, -i);
+        break;
+      default:
+        reflection->SetDouble(message, field, i);
+        break;
+    }
+  }
+  std::unique_ptr<Message> copy(message->New());
+  copy->ParseFromString(message->SerializeAsString());
+  EXPECT_EQ(message->DebugString(), copy->DebugString());
+  EXPECT_EQ(-5, reflection->GetInt32(*copy, descriptor->field(5)));
+  EXPECT_EQ(-1, reflection->GetInt64(*copy, descriptor->field(1)));
+  EXPECT_EQ(3, reflection->GetDouble(*copy, descriptor->field(3)));
+  EXPECT_TRUE(reflection->GetBool(*copy, descriptor->field(4)));
+  delete message;
+
+  // Types handed to the generated factory have the size of their class.
+  DynamicMessageFactory generated;
+  generated.SetDelegateToGeneratedFactory(true);
+  EXPECT_EQ(sizeof(unittest::TestAllTypes),
+            generated.GetInstanceSize(unittest::TestAllTypes::descriptor()));
+}
+
 INSTANTIATE_TEST_SUITE_P(UseArena, DynamicMessageTest, ::testing::Bool());
 
 }  // namespace protobuf
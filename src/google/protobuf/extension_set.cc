@@ -34,9 +34,11 @@
 
 #include <google/protobuf/extension_set.h>
 
+#include <atomic>
+#include <memory>
 #include <tuple>
-#include <unordered_map>
 #include <utility>
+#include <vector>
 #include <google/protobuf/stubs/common.h>
 #include <google/protobuf/extension_set_inl.h>
 #include <google/protobuf/parse_context.h>
@@ -46,6 +48,7 @@
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/repeated_field.h>
 #include <google/protobuf/stubs/map_util.h>
+#include <google/protobuf/stubs/mutex.h>
 #include <google/protobuf/stubs/hash.h>
 
 #include <google/protobuf/port_def.inc>
@@ -84,39 +87,125 @@ inline bool is_packable(WireFormatLite::WireType type) {
 }
 
 // Registry stuff.
-struct ExtensionHasher {
-  std::size_t operator()(const std::pair<const MessageLite*, int>& p) const {
-    return std::hash<const MessageLite*>{}(p.first) ^
-           std::hash<int>{}(p.second);
+
+// The registered extensions, in an open-addressing hash table keyed by
+// extendee and number.  Lookups happen for every extension parsed, from any
+// thread, so they take no lock and the ExtensionInfo is stored inline in the
+// table: a lookup usually touches a single cache line.  A slot is published
+// by storing its extendee last, with release order, and is immutable once
+// visible.  Registration, which normally all happens during static
+// initialization, is serialized by a mutex.  Tables that were outgrown are
+// kept until shutdown, since readers may still be probing them; their total
+// size stays below that of the current table.
+class ExtensionRegistry {
+ public:
+  ExtensionRegistry() : table_(nullptr), size_(0) {}
+
+  void Register(const MessageLite* containing_type, int number,
+                const ExtensionInfo& info) {
+    MutexLock lock(&mu_);
+    if (Find(containing_type, number) != nullptr) {
+      GOOGLE_LOG(FATAL) << "Multiple extension registrations for type \""
+                 << containing_type->GetTypeName() << "\", field number "
+                 << number << ".";
+    }
+    Table* table = table_.load(std::memory_order_relaxed);
+    // Keep the load factor at or below 1/2 so probe sequences stay short.
+    if (table == nullptr || 2 * (size_ + 1) > table->mask + 1) {
+      Table* grown = new Table(table == nullptr ? 64 : 2 * (table->mask + 1));
+      tables_.emplace_back(grown);
+      if (table != nullptr) {
+        for (size_t i = 0; i <= table->mask; i++) {
+          const Slot& slot = table->slots[i];
+          const MessageLite* extendee =
+              slot.extendee.load(std::memory_order_relaxed);
+          if (extendee != nullptr) {
+            Place(grown, extendee, slot.number, slot.info);
+          }
+        }
+      }
+      table_.store(grown, std::memory_order_release);
+      table = grown;
+    }
+    Place(table, containing_type, number, info);
+    size_++;
+  }
+
+  const ExtensionInfo* Find(const MessageLite* containing_type,
+                            int number) const {
+    const Table* table = table_.load(std::memory_order_acquire);
+    if (table == nullptr) return nullptr;
+    for (size_t i = Hash(containing_type, number) & table->mask;;
+         i = (i + 1) & table->mask) {
+      const Slot& slot = table->slots[i];
+      const MessageLite* extendee =
+          slot.extendee.load(std::memory_order_acquire);
+      if (extendee == nullptr) return nullptr;
+      if (extendee == containing_type && slot.number == number) {
+        return &slot.info;
+      }
+    }
   }
-};
 
-typedef std::unordered_map<std::pair<const MessageLite*, int>, ExtensionInfo,
-                           ExtensionHasher>
-    ExtensionRegistry;
+ private:
+  struct Slot {
+    Slot() : extendee(nullptr) {}
+    std::atomic<const MessageLite*> extendee;  // Null if the slot is empty.
+    int number;
+    ExtensionInfo info;
+  };
 
-static const ExtensionRegistry* global_registry = nullptr;
+  struct Table {
+    explicit Table(size_t capacity)
+        : mask(capacity - 1), slots(new Slot[capacity]) {}
+    size_t mask;
+    std::unique_ptr<Slot[]> slots;
+  };
+
+  static size_t Hash(const MessageLite* containing_type, int number) {
+    uint64 key = reinterpret_cast<uintptr_t>(containing_type) ^
+                 (static_cast<uint64>(static_cast<uint32>(number)) << 32);
+    // Fibonacci hashing: the high bits of the product mix all the key bits.
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32);
+  }
+
+  static void Place(Table* table, const MessageLite* containing_type,
+                    int number, const ExtensionInfo& info) {
+    size_t i = Hash(containing_type, number) & table->mask;
+    while (table->slots[i].extendee.load(std::memory_order_relaxed) !=
+           nullptr) {
+      i = (i + 1) & table->mask;
+    }
+    Slot& slot = table->slots[i];
+    slot.number = number;
+    slot.info = info;
+    slot.extendee.store(containing_type, std::memory_order_release);
+  }
+
+  WrappedMutex mu_;
+  std::atomic<Table*> table_;
+  size_t size_;  // Guarded by mu_.
+  // Every table ever published.
+  std::vector<std::unique_ptr<Table> > tables_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ExtensionRegistry);
+};
+
+static std::atomic<ExtensionRegistry*> global_registry{nullptr};
 
-// This function is only called at startup, so there is no need for thread-
-// safety.
 void Register(const MessageLite* containing_type, int number,
               ExtensionInfo info) {
   static auto local_static_registry = OnShutdownDelete(new ExtensionRegistry);
-  global_registry = local_static_registry;
-  if (!InsertIfNotPresent(local_static_registry,
-                               std::make_pair(containing_type, number), info)) {
-    GOOGLE_LOG(FATAL) << "Multiple extension registrations for type \""
-               << containing_type->GetTypeName() << "\", field number "
-               << number << ".";
-  }
+  global_registry.store(local_static_registry, std::memory_order_release);
+  local_static_registry->Register(containing_type, number, info);
 }
 
 const ExtensionInfo* FindRegisteredExtension(const MessageLite* containing_type,
                                              int number) {
-  return global_registry == nullptr
-             ? nullptr
-             : FindOrNull(*global_registry,
-                               std::make_pair(containing_type, number));
+  ExtensionRegistry* registry =
+      global_registry.load(std::memory_order_acquire);
+  return registry == nullptr ? nullptr
+                             : registry->Find(containing_type, number);
 }
 
 }  // namespace
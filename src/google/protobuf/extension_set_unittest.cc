@@ -1327,6 +1327,43 @@ TEST(ExtensionSetTest, BoolExtension) {
   EXPECT_TRUE(msg.GetExtension(protobuf_unittest::optional_bool_extension));
 }
 
+TEST(ExtensionSetTest, GeneratedExtensionFinder) {
+  ExtensionInfo info;
+  GeneratedExtensionFinder all_extensions(
+      &unittest::TestAllExtensions::default_instance());
+  ASSERT_TRUE(all_extensions.Find(
+      unittest::optional_int32_extension.number(), &info));
+  EXPECT_EQ(WireFormatLite::TYPE_INT32, info.type);
+  EXPECT_FALSE(info.is_repeated);
+  ASSERT_TRUE(all_extensions.Find(
+      unittest::repeated_nested_message_extension.number(), &info));
+  EXPECT_EQ(WireFormatLite::TYPE_MESSAGE, info.type);
+  EXPECT_TRUE(info.is_repeated);
+  EXPECT_FALSE(all_extensions.Find(0, &info));
+  EXPECT_FALSE(all_extensions.Find(-1, &info));
+  EXPECT_FALSE(all_extensions.Find(536870911, &info));
+
+  // Extensions registered after a lookup are found too.  The registry is
+  // global, so a repeated run of this test finds them already registered.
+  const MessageLite* extendee = &unittest::TestEmptyMessage::default_instance();
+  GeneratedExtensionFinder finder(extendee);
+  if (!finder.Find(10, &info)) {
+    ExtensionSet::RegisterExtension(extendee, 10, WireFormatLite::TYPE_INT32,
+                                    false, false);
+  }
+  EXPECT_TRUE(finder.Find(10, &info));
+  if (!finder.Find(12, &info)) {
+    ExtensionSet::RegisterExtension(extendee, 12, WireFormatLite::TYPE_STRING,
+                                    true, false);
+  }
+  EXPECT_TRUE(finder.Find(10, &info));
+  EXPECT_EQ(WireFormatLite::TYPE_INT32, info.type);
+  EXPECT_FALSE(finder.Find(11, &info));
+  ASSERT_TRUE(finder.Find(12, &info));
+  EXPECT_EQ(WireFormatLite::TYPE_STRING, info.type);
+  EXPECT_TRUE(info.is_repeated);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace protobuf
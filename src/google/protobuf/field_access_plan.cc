@@ -0,0 +1,339 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/field_access_plan.h>
+
+#include <algorithm>
+
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/inlined_string_field.h>
+
+#include <google/protobuf/port_def.inc>
+
+namespace google {
+namespace protobuf {
+
+using internal::ArenaStringPtr;
+using internal::InlinedStringField;
+
+const uint32 FieldAccessPlan::kNoHasBit;
+
+FieldAccessPlan::FieldAccessPlan(const Reflection* reflection)
+    : descriptor_(reflection->descriptor_),
+      reflection_(reflection),
+      default_instance_(reflection->schema_.default_instance_),
+      has_bits_offset_(reflection->schema_.has_bits_offset_),
+      extensions_offset_(reflection->schema_.extensions_offset_),
+      has_weak_fields_(false) {
+  const internal::ReflectionSchema& schema = reflection->schema_;
+  fields_.resize(descriptor_->field_count());
+  for (int i = 0; i < descriptor_->field_count(); i++) {
+    const FieldDescriptor* field = descriptor_->field(i);
+    FieldPlan& plan = fields_[i];
+    const bool in_oneof = schema.InRealOneof(field);
+    plan.offset = schema.GetFieldOffset(field);
+    plan.has_bit_index = in_oneof ? kNoHasBit : schema.HasBitIndex(field);
+    plan.oneof_case_offset =
+        in_oneof ? schema.GetOneofCaseOffset(field->containing_oneof()) : 0;
+    plan.default_value = schema.GetFieldDefault(field);
+    if (field->options().weak()) {
+      has_weak_fields_ = true;
+      plan.kind = kReflection;
+    } else if (field->is_map()) {
+      plan.kind = kReflection;
+    } else if (field->cpp_type() == FieldDescriptor::CPPTYPE_STRING &&
+               schema.IsFieldInlined(field)) {
+      plan.kind = kInlinedString;
+    } else {
+      plan.kind = kDirect;
+    }
+    fields_by_number_.push_back(field);
+  }
+  std::sort(fields_by_number_.begin(), fields_by_number_.end(),
+            [](const FieldDescriptor* a, const FieldDescriptor* b) {
+              return a->number() < b->number();
+            });
+}
+
+void FieldAccessPlan::ListFields(
+    const Message& message, std::vector<const FieldDescriptor*>* output) const {
+  if (has_weak_fields_) {
+    reflection_->ListFields(message, output);
+    return;
+  }
+  output->clear();
+  // The default instance never has any fields set.
+  if (&message == default_instance_) return;
+
+  const uint32* has_bits =
+      has_bits_offset_ != -1
+          ? static_cast<const uint32*>(At(message, has_bits_offset_))
+          : nullptr;
+  for (const FieldDescriptor* field : fields_by_number_) {
+    const FieldPlan& plan = fields_[field->index()];
+    bool present;
+    if (field->is_repeated()) {
+      present = FieldSize(message, field) > 0;
+    } else if (plan.oneof_case_offset != 0) {
+      present = HasOneofField(message, field, plan);
+    } else if (plan.has_bit_index != kNoHasBit && has_bits != nullptr) {
+      present = (has_bits[plan.has_bit_index / 32] >>
+                 (plan.has_bit_index % 32)) & 1;
+    } else {
+      present = HasImplicitField(message, field, plan);
+    }
+    if (present) output->push_back(field);
+  }
+
+  if (extensions_offset_ != -1) {
+    // Extensions are listed in number order too; merge the two runs.
+    const size_t regular_fields = output->size();
+    reflection_->GetExtensionSet(message).AppendToList(
+        descriptor_, reflection_->descriptor_pool_, output);
+    std::inplace_merge(output->begin(), output->begin() + regular_fields,
+                       output->end(),
+                       [](const FieldDescriptor* a, const FieldDescriptor* b) {
+                         return a->number() < b->number();
+                       });
+  }
+}
+
+bool FieldAccessPlan::HasField(const Message& message,
+                               const FieldDescriptor* field) const {
+  GOOGLE_DCHECK(!field->is_repeated());
+  if (field->is_extension()) return reflection_->HasField(message, field);
+  const FieldPlan& plan = Plan(field);
+  if (plan.kind == kReflection) return reflection_->HasField(message, field);
+  if (plan.oneof_case_offset != 0) return HasOneofField(message, field, plan);
+  if (plan.has_bit_index != kNoHasBit) {
+    const uint32* has_bits =
+        static_cast<const uint32*>(At(message, has_bits_offset_));
+    return (has_bits[plan.has_bit_index / 32] >> (plan.has_bit_index % 32)) &
+           1;
+  }
+  return HasImplicitField(message, field, plan);
+}
+
+bool FieldAccessPlan::HasImplicitField(const Message& message,
+                                       const FieldDescriptor* field,
+                                       const FieldPlan& plan) const {
+  // Same rules as Reflection::HasBit(): messages are present when allocated,
+  // everything else when it differs from zero or the empty string.
+  const void* raw = At(message, plan.offset);
+  switch (field->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      return &message != default_instance_ &&
+             *static_cast<const Message* const*>(raw) != nullptr;
+    case FieldDescriptor::CPPTYPE_STRING:
+      if (plan.kind == kInlinedString) {
+        return !static_cast<const InlinedStringField*>(raw)
+                    ->GetNoArena()
+                    .empty();
+      }
+      return !static_cast<const ArenaStringPtr*>(raw)->Get().empty();
+    case FieldDescriptor::CPPTYPE_BOOL:
+      return *static_cast<const bool*>(raw);
+    case FieldDescriptor::CPPTYPE_INT32:
+    case FieldDescriptor::CPPTYPE_ENUM:
+      return *static_cast<const int32*>(raw) != 0;
+    case FieldDescriptor::CPPTYPE_UINT32:
+      return *static_cast<const uint32*>(raw) != 0;
+    case FieldDescriptor::CPPTYPE_INT64:
+      return *static_cast<const int64*>(raw) != 0;
+    case FieldDescriptor::CPPTYPE_UINT64:
+      return *static_cast<const uint64*>(raw) != 0;
+    case FieldDescriptor::CPPTYPE_FLOAT:
+      return *static_cast<const float*>(raw) != 0.0;
+    case FieldDescriptor::CPPTYPE_DOUBLE:
+      return *static_cast<const double*>(raw) != 0.0;
+  }
+  GOOGLE_LOG(FATAL) << "Can't get here.";
+  return false;
+}
+
+int FieldAccessPlan::FieldSize(const Message& message,
+                               const FieldDescriptor* field) const {
+  GOOGLE_DCHECK(field->is_repeated());
+  if (field->is_extension() || Plan(field).kind == kReflection) {
+    return reflection_->FieldSize(message, field);
+  }
+  const void* raw = At(message, Plan(field).offset);
+  switch (field->cpp_type()) {
+#define HANDLE_TYPE(CPPTYPE, TYPE)         \
+  case FieldDescriptor::CPPTYPE_##CPPTYPE: \
+    return static_cast<const RepeatedField<TYPE>*>(raw)->size();
+
+    HANDLE_TYPE(INT32, int32)
+    HANDLE_TYPE(INT64, int64)
+    HANDLE_TYPE(UINT32, uint32)
+    HANDLE_TYPE(UINT64, uint64)
+    HANDLE_TYPE(DOUBLE, double)
+    HANDLE_TYPE(FLOAT, float)
+    HANDLE_TYPE(BOOL, bool)
+    HANDLE_TYPE(ENUM, int)
+#undef HANDLE_TYPE
+
+    case FieldDescriptor::CPPTYPE_STRING:
+      return static_cast<const RepeatedPtrField<std::string>*>(raw)->size();
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      return static_cast<const RepeatedPtrField<Message>*>(raw)->size();
+  }
+  GOOGLE_LOG(FATAL) << "Can't get here.";
+  return 0;
+}
+
+const std::string& FieldAccessPlan::GetStringReference(
+    const Message& message, const FieldDescriptor* field) const {
+  GOOGLE_DCHECK(!field->is_repeated());
+  if (field->is_extension()) {
+    return reflection_->GetExtensionSet(message).GetString(
+        field->number(), field->default_value_string());
+  }
+  const FieldPlan& plan = Plan(field);
+  const void* raw = GetRaw(message, field, plan);
+  if (plan.kind == kInlinedString) {
+    return static_cast<const InlinedStringField*>(raw)->GetNoArena();
+  }
+  return static_cast<const ArenaStringPtr*>(raw)->Get();
+}
+
+const Message& FieldAccessPlan::GetMessage(const Message& message,
+                                           const FieldDescriptor* field) const {
+  GOOGLE_DCHECK(!field->is_repeated());
+  if (field->is_extension()) return reflection_->GetMessage(message, field);
+  const FieldPlan& plan = Plan(field);
+  if (plan.kind == kReflection) return reflection_->GetMessage(message, field);
+  const Message* result =
+      *static_cast<const Message* const*>(GetRaw(message, field, plan));
+  if (result == nullptr) {
+    result = *static_cast<const Message* const*>(plan.default_value);
+  }
+  return *result;
+}
+
+void* FieldAccessPlan::MutableRaw(Message* message,
+                                  const FieldDescriptor* field,
+                                  const FieldPlan& plan) const {
+  if (plan.oneof_case_offset != 0) {
+    uint32* oneof_case =
+        static_cast<uint32*>(At(message, plan.oneof_case_offset));
+    if (*oneof_case != static_cast<uint32>(field->number())) {
+      reflection_->ClearOneof(message, field->containing_oneof());
+      *oneof_case = field->number();
+    }
+  } else if (plan.has_bit_index != kNoHasBit) {
+    uint32* has_bits = static_cast<uint32*>(At(message, has_bits_offset_));
+    has_bits[plan.has_bit_index / 32] |= static_cast<uint32>(1)
+                                         << (plan.has_bit_index % 32);
+  }
+  return At(message, plan.offset);
+}
+
+void FieldAccessPlan::SetEnumValue(Message* message,
+                                   const FieldDescriptor* field,
+                                   int value) const {
+  GOOGLE_DCHECK(!field->is_repeated());
+  if (field->is_extension() ||
+      (!internal::CreateUnknownEnumValues(field) &&
+       field->enum_type()->FindValueByNumber(value) == nullptr)) {
+    reflection_->SetEnumValue(message, field, value);
+    return;
+  }
+  SetScalar<int>(message, field, value);
+}
+
+void FieldAccessPlan::SetString(Message* message, const FieldDescriptor* field,
+                                std::string value) const {
+  GOOGLE_DCHECK(!field->is_repeated());
+  if (field->is_extension()) {
+    reflection_->SetString(message, field, std::move(value));
+    return;
+  }
+  const FieldPlan& plan = Plan(field);
+  if (plan.kind == kInlinedString) {
+    static_cast<InlinedStringField*>(MutableRaw(message, field, plan))
+        ->SetNoArena(nullptr, std::move(value));
+    return;
+  }
+  const std::string* default_ptr =
+      &static_cast<const ArenaStringPtr*>(plan.default_value)->Get();
+  const bool was_set =
+      plan.oneof_case_offset == 0 || HasOneofField(*message, field, plan);
+  ArenaStringPtr* str =
+      static_cast<ArenaStringPtr*>(MutableRaw(message, field, plan));
+  // A oneof member shares its storage with the other members; it holds no
+  // string until claimed.
+  if (!was_set) str->UnsafeSetDefault(default_ptr);
+  str->Mutable(default_ptr, message->GetArena())->assign(std::move(value));
+}
+
+Message* FieldAccessPlan::MutableMessage(Message* message,
+                                         const FieldDescriptor* field) const {
+  GOOGLE_DCHECK(!field->is_repeated());
+  if (field->is_extension() || Plan(field).kind == kReflection) {
+    return reflection_->MutableMessage(message, field);
+  }
+  const FieldPlan& plan = Plan(field);
+  const bool was_set =
+      plan.oneof_case_offset == 0 || HasOneofField(*message, field, plan);
+  Message** holder = static_cast<Message**>(MutableRaw(message, field, plan));
+  if (!was_set || *holder == nullptr) {
+    *holder = (*static_cast<const Message* const*>(plan.default_value))
+                  ->New(message->GetArena());
+  }
+  return *holder;
+}
+
+const void* FieldAccessPlan::GetRawRepeated(
+    const Message& message, const FieldDescriptor* field) const {
+  GOOGLE_DCHECK(field->is_repeated());
+  if (field->is_extension() || Plan(field).kind == kReflection) {
+    return reflection_->GetRawRepeatedField(message, field, field->cpp_type(),
+                                            -1, nullptr);
+  }
+  return At(message, Plan(field).offset);
+}
+
+void* FieldAccessPlan::MutableRawRepeated(Message* message,
+                                          const FieldDescriptor* field) const {
+  GOOGLE_DCHECK(field->is_repeated());
+  if (field->is_extension() || Plan(field).kind == kReflection) {
+    return reflection_->MutableRawRepeatedField(
+        message, field, field->cpp_type(), -1, nullptr);
+  }
+  return At(message, Plan(field).offset);
+}
+
+}  // namespace protobuf
+}  // namespace google
+
+#include <google/protobuf/port_undef.inc>
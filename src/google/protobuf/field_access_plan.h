@@ -0,0 +1,332 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// FieldAccessPlan gives direct, typed access to the fields of one message
+// implementation.  It is compiled once per Reflection (that is, once per
+// generated or DynamicMessage type) from the ReflectionSchema: the offset,
+// has-bit index, oneof case and default value of every field.
+//
+// The Reflection accessors check on every call that the field belongs to the
+// message, that it has the requested type and cardinality, whether it is an
+// extension, and then re-derive its storage from the schema.  Code that walks
+// many messages generically -- merging, printing, comparing, exporting --
+// can fetch the plan once and skip that work:
+//
+//   const FieldAccessPlan* plan =
+//       message.GetReflection()->GetFieldAccessPlan();
+//   std::vector<const FieldDescriptor*> fields;
+//   plan->ListFields(message, &fields);
+//   for (const FieldDescriptor* field : fields) {
+//     if (field->cpp_type() == FieldDescriptor::CPPTYPE_INT64 &&
+//         !field->is_repeated()) {
+//       total += plan->GetInt64(message, field);
+//     }
+//   }
+//
+// The accessors behave like the Reflection methods of the same name, but the
+// usage checks are only done in debug builds; passing a field of the wrong
+// type or cardinality is undefined behavior.  Extensions, map fields and weak
+// fields have no plain storage in the message, so the plan forwards those to
+// Reflection.
+
+#ifndef GOOGLE_PROTOBUF_FIELD_ACCESS_PLAN_H__
+#define GOOGLE_PROTOBUF_FIELD_ACCESS_PLAN_H__
+
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/logging.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>
+
+#ifdef SWIG
+#error "You cannot SWIG proto headers"
+#endif
+
+#include <google/protobuf/port_def.inc>
+
+namespace google {
+namespace protobuf {
+
+// A plan is immutable once built and may be shared between threads.  Obtain
+// it from Reflection::GetFieldAccessPlan(); it stays valid as long as the
+// Reflection does.
+class PROTOBUF_EXPORT FieldAccessPlan {
+ public:
+  const Descriptor* descriptor() const { return descriptor_; }
+  const Reflection* reflection() const { return reflection_; }
+
+  // Same as Reflection::ListFields(): the set fields and extensions of
+  // message, in field number order.  Regular fields are enumerated from the
+  // has-bits and oneof cases without consulting Reflection.
+  void ListFields(const Message& message,
+                  std::vector<const FieldDescriptor*>* output) const;
+
+  bool HasField(const Message& message, const FieldDescriptor* field) const;
+  int FieldSize(const Message& message, const FieldDescriptor* field) const;
+
+  // Singular getters ------------------------------------------------
+
+  int32 GetInt32(const Message& message, const FieldDescriptor* field) const {
+    if (field->is_extension()) return reflection_->GetInt32(message, field);
+    return GetScalar<int32>(message, field);
+  }
+  int64 GetInt64(const Message& message, const FieldDescriptor* field) const {
+    if (field->is_extension()) return reflection_->GetInt64(message, field);
+    return GetScalar<int64>(message, field);
+  }
+  uint32 GetUInt32(const Message& message, const FieldDescriptor* field) const {
+    if (field->is_extension()) return reflection_->GetUInt32(message, field);
+    return GetScalar<uint32>(message, field);
+  }
+  uint64 GetUInt64(const Message& message, const FieldDescriptor* field) const {
+    if (field->is_extension()) return reflection_->GetUInt64(message, field);
+    return GetScalar<uint64>(message, field);
+  }
+  float GetFloat(const Message& message, const FieldDescriptor* field) const {
+    if (field->is_extension()) return reflection_->GetFloat(message, field);
+    return GetScalar<float>(message, field);
+  }
+  double GetDouble(const Message& message, const FieldDescriptor* field) const {
+    if (field->is_extension()) return reflection_->GetDouble(message, field);
+    return GetScalar<double>(message, field);
+  }
+  bool GetBool(const Message& message, const FieldDescriptor* field) const {
+    if (field->is_extension()) return reflection_->GetBool(message, field);
+    return GetScalar<bool>(message, field);
+  }
+  int GetEnumValue(const Message& message, const FieldDescriptor* field) const {
+    if (field->is_extension()) return reflection_->GetEnumValue(message, field);
+    return GetScalar<int>(message, field);
+  }
+  // Unlike Reflection::GetStringReference(), needs no scratch string: every
+  // string field is stored as a std::string.
+  const std::string& GetStringReference(const Message& message,
+                                        const FieldDescriptor* field) const;
+  const Message& GetMessage(const Message& message,
+                            const FieldDescriptor* field) const;
+
+  // Singular mutators -----------------------------------------------
+
+  void SetInt32(Message* message, const FieldDescriptor* field,
+                int32 value) const {
+    if (field->is_extension()) {
+      reflection_->SetInt32(message, field, value);
+    } else {
+      SetScalar<int32>(message, field, value);
+    }
+  }
+  void SetInt64(Message* message, const FieldDescriptor* field,
+                int64 value) const {
+    if (field->is_extension()) {
+      reflection_->SetInt64(message, field, value);
+    } else {
+      SetScalar<int64>(message, field, value);
+    }
+  }
+  void SetUInt32(Message* message, const FieldDescriptor* field,
+                 uint32 value) const {
+    if (field->is_extension()) {
+      reflection_->SetUInt32(message, field, value);
+    } else {
+      SetScalar<uint32>(message, field, value);
+    }
+  }
+  void SetUInt64(Message* message, const FieldDescriptor* field,
+                 uint64 value) const {
+    if (field->is_extension()) {
+      reflection_->SetUInt64(message, field, value);
+    } else {
+      SetScalar<uint64>(message, field, value);
+    }
+  }
+  void SetFloat(Message* message, const FieldDescriptor* field,
+                float value) const {
+    if (field->is_extension()) {
+      reflection_->SetFloat(message, field, value);
+    } else {
+      SetScalar<float>(message, field, value);
+    }
+  }
+  void SetDouble(Message* message, const FieldDescriptor* field,
+                 double value) const {
+    if (field->is_extension()) {
+      reflection_->SetDouble(message, field, value);
+    } else {
+      SetScalar<double>(message, field, value);
+    }
+  }
+  void SetBool(Message* message, const FieldDescriptor* field,
+               bool value) const {
+    if (field->is_extension()) {
+      reflection_->SetBool(message, field, value);
+    } else {
+      SetScalar<bool>(message, field, value);
+    }
+  }
+  // Like Reflection::SetEnumValue(), values unknown to a closed enum are
+  // stored in the unknown fields.
+  void SetEnumValue(Message* message, const FieldDescriptor* field,
+                    int value) const;
+  void SetString(Message* message, const FieldDescriptor* field,
+                 std::string value) const;
+  Message* MutableMessage(Message* message, const FieldDescriptor* field) const;
+
+  // Repeated fields -------------------------------------------------
+  //
+  // T is the C++ type of the elements: int32, int64, uint32, uint64, float,
+  // double, bool or int (for enums) for RepeatedField, std::string or Message
+  // for RepeatedPtrField.  Map fields are returned in their repeated form,
+  // as by Reflection::GetRepeatedPtrField().
+
+  template <typename T>
+  const RepeatedField<T>& GetRepeatedField(const Message& message,
+                                           const FieldDescriptor* field) const {
+    return *static_cast<const RepeatedField<T>*>(
+        GetRawRepeated(message, field));
+  }
+  template <typename T>
+  RepeatedField<T>* MutableRepeatedField(Message* message,
+                                         const FieldDescriptor* field) const {
+    return static_cast<RepeatedField<T>*>(MutableRawRepeated(message, field));
+  }
+  template <typename T>
+  const RepeatedPtrField<T>& GetRepeatedPtrField(
+      const Message& message, const FieldDescriptor* field) const {
+    return *static_cast<const RepeatedPtrField<T>*>(
+        GetRawRepeated(message, field));
+  }
+  template <typename T>
+  RepeatedPtrField<T>* MutableRepeatedPtrField(
+      Message* message, const FieldDescriptor* field) const {
+    return static_cast<RepeatedPtrField<T>*>(
+        MutableRawRepeated(message, field));
+  }
+
+ private:
+  friend class Reflection;
+
+  static const uint32 kNoHasBit = static_cast<uint32>(-1);
+
+  // How the storage of a field is reached.
+  enum Kind : uint8 {
+    kDirect,         // At offset, as the usual C++ type.
+    kInlinedString,  // At offset, as an InlinedStringField.
+    kReflection,     // Map and weak fields: through Reflection.
+  };
+
+  // Indexed by FieldDescriptor::index().
+  struct FieldPlan {
+    uint32 offset;
+    uint32 has_bit_index;      // kNoHasBit if none.
+    uint32 oneof_case_offset;  // Only for fields in a real oneof, else 0.
+    Kind kind;
+    // The field in the default instance: what an unset oneof member reads as,
+    // and for strings and messages the default the field points to.
+    const void* default_value;
+  };
+
+  explicit FieldAccessPlan(const Reflection* reflection);
+
+  const FieldPlan& Plan(const FieldDescriptor* field) const {
+    GOOGLE_DCHECK_EQ(field->containing_type(), descriptor_);
+    GOOGLE_DCHECK(!field->is_extension());
+    return fields_[field->index()];
+  }
+
+  static const void* At(const Message& message, uint32 offset) {
+    return reinterpret_cast<const char*>(&message) + offset;
+  }
+  static void* At(Message* message, uint32 offset) {
+    return reinterpret_cast<char*>(message) + offset;
+  }
+
+  bool HasOneofField(const Message& message, const FieldDescriptor* field,
+                     const FieldPlan& plan) const {
+    return *static_cast<const uint32*>(At(message, plan.oneof_case_offset)) ==
+           static_cast<uint32>(field->number());
+  }
+
+  // Where a singular field's value is read from.
+  const void* GetRaw(const Message& message, const FieldDescriptor* field,
+                     const FieldPlan& plan) const {
+    if (plan.oneof_case_offset != 0 && !HasOneofField(message, field, plan)) {
+      return plan.default_value;
+    }
+    return At(message, plan.offset);
+  }
+
+  // Marks a singular field as present, clearing any other member of its
+  // oneof first, and returns its storage.
+  void* MutableRaw(Message* message, const FieldDescriptor* field,
+                   const FieldPlan& plan) const;
+
+  template <typename T>
+  T GetScalar(const Message& message, const FieldDescriptor* field) const {
+    GOOGLE_DCHECK(!field->is_repeated());
+    return *static_cast<const T*>(GetRaw(message, field, Plan(field)));
+  }
+  template <typename T>
+  void SetScalar(Message* message, const FieldDescriptor* field,
+                 T value) const {
+    GOOGLE_DCHECK(!field->is_repeated());
+    *static_cast<T*>(MutableRaw(message, field, Plan(field))) = value;
+  }
+
+  const void* GetRawRepeated(const Message& message,
+                             const FieldDescriptor* field) const;
+  void* MutableRawRepeated(Message* message,
+                           const FieldDescriptor* field) const;
+
+  // Presence of a singular field without has-bit, as in proto3.
+  bool HasImplicitField(const Message& message, const FieldDescriptor* field,
+                        const FieldPlan& plan) const;
+
+  const Descriptor* descriptor_;
+  const Reflection* reflection_;
+  const Message* default_instance_;
+  int has_bits_offset_;       // -1 if the message has no has-bits.
+  int extensions_offset_;     // -1 if the message has no ExtensionSet.
+  bool has_weak_fields_;
+  std::vector<FieldPlan> fields_;
+  // The fields in field number order, for ListFields().
+  std::vector<const FieldDescriptor*> fields_by_number_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(FieldAccessPlan);
+};
+
+}  // namespace protobuf
+}  // namespace google
+
+#include <google/protobuf/port_undef.inc>
+
+#endif  // GOOGLE_PROTOBUF_FIELD_ACCESS_PLAN_H__
@@ -0,0 +1,279 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/field_access_plan.h>
+
+#include <memory>
+#include <vector>
+
+#include <google/protobuf/test_util.h>
+#include <google/protobuf/unittest.pb.h>
+#include <google/protobuf/unittest_no_field_presence.pb.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/testing/googletest.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace {
+
+std::vector<const FieldDescriptor*> ListFieldsViaReflection(
+    const Message& message) {
+  std::vector<const FieldDescriptor*> fields;
+  message.GetReflection()->ListFields(message, &fields);
+  return fields;
+}
+
+std::vector<const FieldDescriptor*> ListFieldsViaPlan(const Message& message) {
+  std::vector<const FieldDescriptor*> fields;
+  message.GetReflection()->GetFieldAccessPlan()->ListFields(message, &fields);
+  return fields;
+}
+
+// Checks that every singular field reads the same through the plan as
+// through Reflection.
+void ExpectSameAsReflection(const Message& message) {
+  const Reflection* reflection = message.GetReflection();
+  const FieldAccessPlan* plan = reflection->GetFieldAccessPlan();
+  const Descriptor* descriptor = message.GetDescriptor();
+  for (int i = 0; i < descriptor->field_count(); i++) {
+    const FieldDescriptor* field = descriptor->field(i);
+    SCOPED_TRACE(field->full_name());
+    if (field->is_repeated()) {
+      EXPECT_EQ(reflection->FieldSize(message, field),
+                plan->FieldSize(message, field));
+      continue;
+    }
+    EXPECT_EQ(reflection->HasField(message, field),
+              plan->HasField(message, field));
+    switch (field->cpp_type()) {
+#define HANDLE_TYPE(CPPTYPE, METHOD)                   \
+  case FieldDescriptor::CPPTYPE_##CPPTYPE:             \
+    EXPECT_EQ(reflection->Get##METHOD(message, field), \
+              plan->Get##METHOD(message, field));      \
+    break;
+
+      HANDLE_TYPE(INT32, Int32)
+      HANDLE_TYPE(INT64, Int64)
+      HANDLE_TYPE(UINT32, UInt32)
+      HANDLE_TYPE(UINT64, UInt64)
+      HANDLE_TYPE(FLOAT, Float)
+      HANDLE_TYPE(DOUBLE, Double)
+      HANDLE_TYPE(BOOL, Bool)
+      HANDLE_TYPE(ENUM, EnumValue)
+#undef HANDLE_TYPE
+
+      case FieldDescriptor::CPPTYPE_STRING:
+        EXPECT_EQ(reflection->GetString(message, field),
+                  plan->GetStringReference(message, field));
+        break;
+
+      case FieldDescriptor::CPPTYPE_MESSAGE:
+        EXPECT_EQ(&reflection->GetMessage(message, field),
+                  &plan->GetMessage(message, field));
+        break;
+    }
+  }
+}
+
+TEST(FieldAccessPlanTest, BuiltOnce) {
+  const Reflection* reflection = unittest::TestAllTypes::GetReflection();
+  const FieldAccessPlan* plan = reflection->GetFieldAccessPlan();
+  EXPECT_EQ(plan, reflection->GetFieldAccessPlan());
+  EXPECT_EQ(unittest::TestAllTypes::descriptor(), plan->descriptor());
+  EXPECT_EQ(reflection, plan->reflection());
+}
+
+TEST(FieldAccessPlanTest, ListFields) {
+  unittest::TestAllTypes message;
+  EXPECT_TRUE(ListFieldsViaPlan(message).empty());
+  EXPECT_TRUE(ListFieldsViaPlan(unittest::TestAllTypes::default_instance())
+                  .empty());
+
+  message.set_optional_int32(1);
+  message.add_repeated_string("a");
+  message.set_oneof_uint32(2);
+  EXPECT_EQ(ListFieldsViaReflection(message), ListFieldsViaPlan(message));
+  EXPECT_EQ(3, ListFieldsViaPlan(message).size());
+
+  TestUtil::SetAllFields(&message);
+  EXPECT_EQ(ListFieldsViaReflection(message), ListFieldsViaPlan(message));
+}
+
+TEST(FieldAccessPlanTest, ListFieldsWithExtensions) {
+  unittest::TestFieldOrderings message;
+  message.set_my_int(1);
+  message.SetExtension(unittest::my_extension_int, 2);
+  message.set_my_string("foo");
+  message.SetExtension(unittest::my_extension_string, "bar");
+  message.set_my_float(3.0);
+  // Fields and extensions are interleaved by field number.
+  EXPECT_EQ(ListFieldsViaReflection(message), ListFieldsViaPlan(message));
+  EXPECT_EQ(5, ListFieldsViaPlan(message).size());
+
+  unittest::TestAllExtensions extensions;
+  TestUtil::SetAllExtensions(&extensions);
+  EXPECT_EQ(ListFieldsViaReflection(extensions),
+            ListFieldsViaPlan(extensions));
+}
+
+TEST(FieldAccessPlanTest, ListFieldsWithoutHasBits) {
+  proto2_nofieldpresence_unittest::TestAllTypes message;
+  EXPECT_TRUE(ListFieldsViaPlan(message).empty());
+  message.set_optional_int32(1);
+  message.set_optional_string("");
+  message.set_optional_bytes("x");
+  message.mutable_optional_nested_message();
+  message.set_oneof_uint32(0);
+  EXPECT_EQ(ListFieldsViaReflection(message), ListFieldsViaPlan(message));
+  EXPECT_EQ(4, ListFieldsViaPlan(message).size());
+}
+
+TEST(FieldAccessPlanTest, Getters) {
+  unittest::TestAllTypes message;
+  ExpectSameAsReflection(message);
+  ExpectSameAsReflection(unittest::TestAllTypes::default_instance());
+  TestUtil::SetAllFields(&message);
+  ExpectSameAsReflection(message);
+
+  // Unset oneof members read as their defaults.
+  unittest::TestOneof2 oneof;
+  ExpectSameAsReflection(oneof);
+  oneof.mutable_foo_message()->set_qux_int(1);
+  oneof.set_bar_string("foo");
+  ExpectSameAsReflection(oneof);
+
+  proto2_nofieldpresence_unittest::TestAllTypes no_presence;
+  ExpectSameAsReflection(no_presence);
+  no_presence.set_optional_int64(5);
+  no_presence.set_optional_string("foo");
+  ExpectSameAsReflection(no_presence);
+}
+
+TEST(FieldAccessPlanTest, Setters) {
+  const Descriptor* descriptor = unittest::TestAllTypes::descriptor();
+  const FieldAccessPlan* plan =
+      unittest::TestAllTypes::GetReflection()->GetFieldAccessPlan();
+  unittest::TestAllTypes message;
+
+  plan->SetInt32(&message, descriptor->FindFieldByName("optional_int32"), 1);
+  plan->SetUInt64(&message, descriptor->FindFieldByName("optional_uint64"), 2);
+  plan->SetDouble(&message, descriptor->FindFieldByName("optional_double"),
+                  3.5);
+  plan->SetBool(&message, descriptor->FindFieldByName("optional_bool"), true);
+  plan->SetString(&message, descriptor->FindFieldByName("optional_string"),
+                  "foo");
+  plan->SetEnumValue(&message,
+                     descriptor->FindFieldByName("optional_nested_enum"),
+                     unittest::TestAllTypes::BAZ);
+  Message* nested = plan->MutableMessage(
+      &message, descriptor->FindFieldByName("optional_nested_message"));
+  nested->GetReflection()->SetInt32(
+      nested, nested->GetDescriptor()->FindFieldByName("bb"), 4);
+  plan->MutableRepeatedField<int32>(
+          &message, descriptor->FindFieldByName("repeated_int32"))
+      ->Add(5);
+  *plan->MutableRepeatedPtrField<std::string>(
+           &message, descriptor->FindFieldByName("repeated_string"))
+       ->Add() = "bar";
+
+  EXPECT_TRUE(message.has_optional_int32());
+  EXPECT_EQ(1, message.optional_int32());
+  EXPECT_EQ(2, message.optional_uint64());
+  EXPECT_EQ(3.5, message.optional_double());
+  EXPECT_TRUE(message.optional_bool());
+  EXPECT_EQ("foo", message.optional_string());
+  EXPECT_EQ(unittest::TestAllTypes::BAZ, message.optional_nested_enum());
+  EXPECT_EQ(4, message.optional_nested_message().bb());
+  ASSERT_EQ(1, message.repeated_int32_size());
+  EXPECT_EQ(5, message.repeated_int32(0));
+  ASSERT_EQ(1, message.repeated_string_size());
+  EXPECT_EQ("bar", message.repeated_string(0));
+  EXPECT_EQ(1, plan->GetRepeatedField<int32>(
+                       message, descriptor->FindFieldByName("repeated_int32"))
+                   .size());
+
+  // Values unknown to a closed enum go to the unknown fields.
+  plan->SetEnumValue(&message,
+                     descriptor->FindFieldByName("optional_foreign_enum"),
+                     12345);
+  EXPECT_FALSE(message.has_optional_foreign_enum());
+  EXPECT_EQ(1, message.unknown_fields().field_count());
+}
+
+TEST(FieldAccessPlanTest, SettersSwitchOneofMember) {
+  const Descriptor* descriptor = unittest::TestOneof2::descriptor();
+  const FieldAccessPlan* plan =
+      unittest::TestOneof2::GetReflection()->GetFieldAccessPlan();
+  unittest::TestOneof2 message;
+
+  plan->SetString(&message, descriptor->FindFieldByName("foo_string"), "foo");
+  EXPECT_EQ(unittest::TestOneof2::kFooString, message.foo_case());
+  EXPECT_EQ("foo", message.foo_string());
+
+  plan->MutableMessage(&message, descriptor->FindFieldByName("foo_message"));
+  EXPECT_EQ(unittest::TestOneof2::kFooMessage, message.foo_case());
+
+  plan->SetInt32(&message, descriptor->FindFieldByName("foo_int"), 7);
+  EXPECT_EQ(unittest::TestOneof2::kFooInt, message.foo_case());
+  EXPECT_EQ(7, message.foo_int());
+
+  plan->SetString(&message, descriptor->FindFieldByName("foo_string"), "bar");
+  EXPECT_EQ("bar", message.foo_string());
+}
+
+TEST(FieldAccessPlanTest, DynamicMessage) {
+  // Plans are per Reflection, so a DynamicMessage gets its own, built from
+  // the offsets DynamicMessageFactory chose.
+  DynamicMessageFactory factory;
+  std::unique_ptr<Message> message(
+      factory.GetPrototype(unittest::TestAllTypes::descriptor())->New());
+  const FieldAccessPlan* plan =
+      message->GetReflection()->GetFieldAccessPlan();
+  EXPECT_NE(unittest::TestAllTypes::GetReflection()->GetFieldAccessPlan(),
+            plan);
+
+  TestUtil::ReflectionTester reflection_tester(
+      unittest::TestAllTypes::descriptor());
+  reflection_tester.SetAllFieldsViaReflection(message.get());
+  EXPECT_EQ(ListFieldsViaReflection(*message), ListFieldsViaPlan(*message));
+  ExpectSameAsReflection(*message);
+
+  plan->SetString(message.get(),
+                  message->GetDescriptor()->FindFieldByName("oneof_string"),
+                  "foo");
+  ExpectSameAsReflection(*message);
+}
+
+}  // namespace
+}  // namespace protobuf
+}  // namespace google
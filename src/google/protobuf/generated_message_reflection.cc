@@ -42,6 +42,7 @@
 #include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/extension_set.h>
+#include <google/protobuf/field_access_plan.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/map_field.h>
@@ -222,10 +223,30 @@ Reflection::Reflection(const Descriptor* descriptor,
       descriptor_pool_(
           (pool == nullptr) ? DescriptorPool::internal_generated_pool() : pool),
       message_factory_(factory),
-      last_non_weak_field_index_(-1) {
+      last_non_weak_field_index_(-1),
+      field_access_plan_(nullptr) {
   last_non_weak_field_index_ = descriptor_->field_count() - 1;
 }
 
+Reflection::~Reflection() {
+  delete field_access_plan_.load(std::memory_order_relaxed);
+}
+
+const FieldAccessPlan* Reflection::GetFieldAccessPlan() const {
+  const FieldAccessPlan* plan =
+      field_access_plan_.load(std::memory_order_acquire);
+  if (PROTOBUF_PREDICT_TRUE(plan != nullptr)) return plan;
+  // Plans are immutable once built, so racing builders simply discard the
+  // losing copy instead of taking a lock.
+  FieldAccessPlan* built = new FieldAccessPlan(this);
+  if (field_access_plan_.compare_exchange_strong(plan, built,
+                                                 std::memory_order_acq_rel)) {
+    return built;
+  }
+  delete built;
+  return plan;
+}
+
 const UnknownFieldSet& Reflection::GetUnknownFields(
     const Message& message) const {
   return GetInternalMetadata(message).unknown_fields<UnknownFieldSet>(
@@ -325,10 +346,13 @@ size_t Reflection::SpaceUsedLong(const Message& message) const {
               // changed from the default value.
               const std::string* default_ptr =
                   &DefaultRaw<ArenaStringPtr>(field).Get();
-              const std::string* ptr =
-                  &GetField<ArenaStringPtr>(message, field).Get();
+              const ArenaStringPtr& field_ptr =
+                  GetField<ArenaStringPtr>(message, field);
+              const std::string* ptr = &field_ptr.Get();
 
-              if (ptr != default_ptr) {
+              // Interned values belong to the StringInternPool, not to the
+              // message.
+              if (ptr != default_ptr && !field_ptr.IsInterned()) {
                 // string fields are represented by just a pointer, so also
                 // include sizeof(string) as well.
                 total_size +=
@@ -1822,6 +1846,15 @@ bool Reflection::ContainsMapKey(const Message& message,
   return GetRaw<MapFieldBase>(message, field).ContainsMapKey(key);
 }
 
+bool Reflection::LookupMapValue(const Message& message,
+                                const FieldDescriptor* field,
+                                const MapKey& key, MapValueRef* val) const {
+  USAGE_CHECK(IsMapFieldInApi(field), "LookupMapValue",
+              "Field is not a map field.");
+  val->SetType(field->message_type()->FindFieldByName("value")->cpp_type());
+  return GetRaw<MapFieldBase>(message, field).LookupMapValue(key, val);
+}
+
 bool Reflection::InsertOrLookupMapValue(Message* message,
                                         const FieldDescriptor* field,
                                         const MapKey& key,
@@ -0,0 +1,242 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Tests for messages generated with the inline_strings option, which stores
+// singular string fields as InlinedStringField rather than ArenaStringPtr.
+
+#include <memory>
+#include <string>
+
+#include <google/protobuf/unittest_inlined_string.pb.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/message.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace {
+
+using protobuf_unittest_inlined_string::TestInlinedString;
+
+// Longer than any small-string buffer, so the tests also exercise strings
+// whose contents live on the heap.
+const char kLongValue[] =
+    "a value that is too long for the small string optimization";
+
+void SetFields(TestInlinedString* message) {
+  message->set_optional_string("foo");
+  message->set_optional_bytes(std::string("\0\1\2", 3));
+  message->set_required_string(kLongValue);
+  message->set_default_string("bar");
+  message->set_optional_int32(7);
+  message->set_oneof_string("oneof");
+  message->add_repeated_string("r1");
+  message->mutable_child()->set_optional_string("child");
+  message->mutable_child()->set_required_string("");
+}
+
+void ExpectFieldsSet(const TestInlinedString& message) {
+  EXPECT_EQ("foo", message.optional_string());
+  EXPECT_EQ(std::string("\0\1\2", 3), message.optional_bytes());
+  EXPECT_EQ(kLongValue, message.required_string());
+  EXPECT_EQ("bar", message.default_string());
+  EXPECT_EQ(7, message.optional_int32());
+  EXPECT_EQ("oneof", message.oneof_string());
+  ASSERT_EQ(1, message.repeated_string_size());
+  EXPECT_EQ("r1", message.repeated_string(0));
+  EXPECT_EQ("child", message.child().optional_string());
+}
+
+bool IsInsideMessage(const TestInlinedString& message, const void* ptr) {
+  const char* begin = reinterpret_cast<const char*>(&message);
+  const char* p = static_cast<const char*>(ptr);
+  return p >= begin && p < begin + sizeof(message);
+}
+
+TEST(InlinedStringFieldTest, FieldsAreStoredInline) {
+  TestInlinedString message;
+  EXPECT_TRUE(IsInsideMessage(message, message.mutable_optional_string()));
+  EXPECT_TRUE(IsInsideMessage(message, message.mutable_optional_bytes()));
+  EXPECT_TRUE(IsInsideMessage(message, message.mutable_default_string()));
+  EXPECT_TRUE(IsInsideMessage(message, &message.required_string()));
+
+  // Oneof members are not inlined.
+  EXPECT_FALSE(IsInsideMessage(message, message.mutable_oneof_string()));
+}
+
+TEST(InlinedStringFieldTest, Accessors) {
+  TestInlinedString message;
+  EXPECT_FALSE(message.has_optional_string());
+  EXPECT_EQ("", message.optional_string());
+  EXPECT_FALSE(message.has_default_string());
+  EXPECT_EQ("hello", message.default_string());
+
+  SetFields(&message);
+  EXPECT_TRUE(message.has_optional_string());
+  EXPECT_TRUE(message.has_default_string());
+  ExpectFieldsSet(message);
+
+  message.clear_optional_string();
+  message.clear_default_string();
+  EXPECT_FALSE(message.has_optional_string());
+  EXPECT_EQ("", message.optional_string());
+  EXPECT_FALSE(message.has_default_string());
+  EXPECT_EQ("hello", message.default_string());
+
+  message.Clear();
+  EXPECT_FALSE(message.has_required_string());
+  EXPECT_EQ("", message.required_string());
+  EXPECT_EQ("hello", message.default_string());
+}
+
+TEST(InlinedStringFieldTest, ReleaseAndSetAllocated) {
+  TestInlinedString message;
+  EXPECT_EQ(nullptr, message.release_optional_string());
+
+  message.set_optional_string(kLongValue);
+  std::unique_ptr<std::string> released(message.release_optional_string());
+  ASSERT_NE(nullptr, released);
+  EXPECT_EQ(kLongValue, *released);
+  EXPECT_FALSE(message.has_optional_string());
+  EXPECT_EQ("", message.optional_string());
+
+  message.set_allocated_optional_string(released.release());
+  EXPECT_TRUE(message.has_optional_string());
+  EXPECT_EQ(kLongValue, message.optional_string());
+
+  message.set_allocated_default_string(nullptr);
+  EXPECT_FALSE(message.has_default_string());
+  EXPECT_EQ("hello", message.default_string());
+}
+
+TEST(InlinedStringFieldTest, CopyMergeAndSwap) {
+  TestInlinedString message1;
+  SetFields(&message1);
+
+  TestInlinedString copy(message1);
+  ExpectFieldsSet(copy);
+
+  TestInlinedString merged;
+  merged.MergeFrom(message1);
+  ExpectFieldsSet(merged);
+
+  TestInlinedString message2;
+  message2.set_optional_string("other");
+  message1.Swap(&message2);
+  ExpectFieldsSet(message2);
+  EXPECT_EQ("other", message1.optional_string());
+  EXPECT_FALSE(message1.has_required_string());
+  EXPECT_EQ("hello", message1.default_string());
+}
+
+TEST(InlinedStringFieldTest, ParseAndSerialize) {
+  TestInlinedString message;
+  SetFields(&message);
+  std::string data = message.SerializeAsString();
+
+  TestInlinedString parsed;
+  ASSERT_TRUE(parsed.ParseFromString(data));
+  ExpectFieldsSet(parsed);
+  EXPECT_EQ(data, parsed.SerializeAsString());
+
+  // Parsing again into the same message reuses the inline strings.
+  ASSERT_TRUE(parsed.ParseFromString(data));
+  ExpectFieldsSet(parsed);
+
+  // Missing required field is still detected.
+  message.clear_required_string();
+  EXPECT_FALSE(parsed.ParseFromString(message.SerializePartialAsString()));
+}
+
+TEST(InlinedStringFieldTest, Arena) {
+  Arena arena;
+  TestInlinedString* message =
+      Arena::CreateMessage<TestInlinedString>(&arena);
+  SetFields(message);
+  ExpectFieldsSet(*message);
+
+  TestInlinedString* parsed = Arena::CreateMessage<TestInlinedString>(&arena);
+  ASSERT_TRUE(parsed->ParseFromString(message->SerializeAsString()));
+  ExpectFieldsSet(*parsed);
+
+  std::unique_ptr<std::string> released(message->release_required_string());
+  EXPECT_EQ(kLongValue, *released);
+
+  // Swap between arenas falls back to copying.
+  TestInlinedString heap_message;
+  heap_message.Swap(parsed);
+  ExpectFieldsSet(heap_message);
+  EXPECT_FALSE(parsed->has_optional_string());
+
+  // Long strings held by arena messages are freed by the arena destructor;
+  // leak checkers catch it if they are not.
+  parsed->set_optional_string(kLongValue);
+}
+
+TEST(InlinedStringFieldTest, Reflection) {
+  TestInlinedString message;
+  const Descriptor* descriptor = message.GetDescriptor();
+  const Reflection* reflection = message.GetReflection();
+  const FieldDescriptor* optional_string =
+      descriptor->FindFieldByName("optional_string");
+  const FieldDescriptor* default_string =
+      descriptor->FindFieldByName("default_string");
+
+  EXPECT_EQ("hello", reflection->GetString(message, default_string));
+  reflection->SetString(&message, optional_string, kLongValue);
+  EXPECT_TRUE(message.has_optional_string());
+  EXPECT_EQ(kLongValue, message.optional_string());
+  std::string scratch;
+  EXPECT_EQ(kLongValue,
+            reflection->GetStringReference(message, optional_string, &scratch));
+
+  TestInlinedString other;
+  other.set_default_string("other");
+  reflection->Swap(&message, &other);
+  EXPECT_EQ(kLongValue, other.optional_string());
+  EXPECT_EQ("other", message.default_string());
+
+  reflection->ClearField(&message, default_string);
+  EXPECT_FALSE(message.has_default_string());
+  EXPECT_EQ("hello", message.default_string());
+
+  EXPECT_GT(reflection->SpaceUsedLong(other),
+            static_cast<size_t>(sizeof(other)));
+
+  std::unique_ptr<Message> copy(other.New());
+  copy->CopyFrom(other);
+  EXPECT_EQ(kLongValue, reflection->GetString(*copy, optional_string));
+}
+
+}  // namespace
+}  // namespace protobuf
+}  // namespace google
@@ -50,6 +50,12 @@
 #include <string_view>
 #endif  // defined(__cpp_lib_string_view)
 
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GOOGLE_PROTOBUF_MAP_HAS_SSE2 1
+#endif
+
 #include <google/protobuf/stubs/common.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/generated_enum_util.h>
@@ -265,6 +271,10 @@ struct MapPair {
   MapPair(const Key& other_first, const T& other_second)
       : first(other_first), second(other_second) {}
   explicit MapPair(const Key& other_first) : first(other_first), second() {}
+  // Constructs the key from a lookup key of a transparent map.
+  template <typename K, typename = typename std::enable_if<
+                            !std::is_same<K, Key>::value>::type>
+  explicit MapPair(const K& other_first) : first(other_first), second() {}
   MapPair(const MapPair& other) : first(other.first), second(other.second) {}
 
   ~MapPair() {}
@@ -283,6 +293,1011 @@ struct MapPair {
   friend class Map<Key, T>;
 };
 
+namespace internal {
+
+// Control words of FlatInnerMap.  Full slots store 7 bits of the hash of
+// their key, so they are the only non-negative ones.
+enum : int8 { kFlatMapEmpty = -128, kFlatMapDeleted = -2 };
+
+// A group of FlatInnerMap control words that are matched all at once.
+class FlatMapGroup {
+ public:
+  enum { kWidth = 16 };
+
+#ifdef GOOGLE_PROTOBUF_MAP_HAS_SSE2
+  explicit FlatMapGroup(const int8* ctrl)
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+  // Returns a bitmask of the control words that are equal to h2.
+  uint32 Match(int8 h2) const {
+    return static_cast<uint32>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+  }
+  uint32 MatchEmptyOrDeleted() const {
+    return static_cast<uint32>(_mm_movemask_epi8(ctrl_));
+  }
+#else
+  explicit FlatMapGroup(const int8* ctrl) : ctrl_(ctrl) {}
+
+  // Returns a bitmask of the control words that are equal to h2.
+  uint32 Match(int8 h2) const {
+    uint32 mask = 0;
+    for (int i = 0; i < kWidth; i++) {
+      if (ctrl_[i] == h2) mask |= uint32{1} << i;
+    }
+    return mask;
+  }
+  uint32 MatchEmptyOrDeleted() const {
+    uint32 mask = 0;
+    for (int i = 0; i < kWidth; i++) {
+      if (ctrl_[i] < 0) mask |= uint32{1} << i;
+    }
+    return mask;
+  }
+#endif  // GOOGLE_PROTOBUF_MAP_HAS_SSE2
+
+  uint32 MatchEmpty() const { return Match(kFlatMapEmpty); }
+  uint32 MatchFull() const {
+    return ~MatchEmptyOrDeleted() & ((uint32{1} << kWidth) - 1);
+  }
+
+  // Returns the position of the lowest bit set in a non-zero mask.
+  static int LowestBitSet(uint32 mask) {
+    return Bits::Log2FloorNonZero(mask & (~mask + 1));
+  }
+
+ private:
+#ifdef GOOGLE_PROTOBUF_MAP_HAS_SSE2
+  __m128i ctrl_;
+#else
+  const int8* ctrl_;
+#endif  // GOOGLE_PROTOBUF_MAP_HAS_SSE2
+};
+
+// FlatInnerMap is an alternative to Map's default chaining hash table (see
+// Map::HashInnerMap).  It is used instead of the default one when
+// GOOGLE_PROTOBUF_MAP_OPEN_ADDRESSING is defined; as this changes the layout
+// of every Map, the macro must be defined consistently for the protobuf
+// library and all code using it.
+//
+// It is an open-addressing table in the style of SwissTable: a flat array of
+// slots plus an array of one-byte control words that tell whether each slot
+// is empty, deleted or full, and in the latter case hold 7 bits of the hash
+// of its key.  Lookups match a whole group of control words at a time (using
+// SSE2 where available) and only compare keys for the few slots whose hash
+// bits match.
+//
+// Some implementation details:
+// 1. Slots hold pointers to nodes rather than the key-value pairs themselves,
+//    so that, as with the default table, pointers and references to elements
+//    stay valid until the element is erased.
+// 2. The number of slots is a power of two, at least one group wide, and the
+//    first group of control words is mirrored after the last slot so that a
+//    group can be loaded starting at any slot.  Groups are probed
+//    triangularly, which visits every group of the table.
+// 3. At most 7/8 of the slots are ever full or deleted, so every probe
+//    sequence ends at an empty slot.
+// 4. The hash of a key is xored with a random seed, so the iteration order
+//    differs from map to map and an attacker cannot predict where keys land.
+//    Keys whose unseeded hashes collide still share their probe sequence;
+//    if a probe sequence ever gets too long, the table stops hashing and
+//    moves every node into a single ordered tree, like the default table
+//    does bucket by bucket.  This keeps find, insert and erase within
+//    O(lg n) even for adversarial keys.
+// 5. Iterators remember the node they point to and the slot it was in.  If a
+//    mutation moved the node, the slot is looked up again.
+template <typename Key, typename T>
+class FlatInnerMap : private TransparentSupport<Key>::hash {
+ public:
+  using hasher = typename TransparentSupport<Key>::hash;
+  using value_type = MapPair<Key, T>;
+  using size_type = size_t;
+
+  explicit FlatInnerMap(size_type n) : FlatInnerMap(nullptr, n) {}
+  FlatInnerMap(Arena* arena, size_type n)
+      : hasher(),
+        num_elements_(0),
+        seed_(Seed()),
+        ctrl_(nullptr),
+        slots_(nullptr),
+        tree_(nullptr),
+        alloc_(arena) {
+    AllocateTable(CapacityFor(n));
+  }
+
+  ~FlatInnerMap() {
+    clear();
+    DeallocateTable();
+  }
+
+ private:
+  using Allocator = MapAllocator<void*>;
+
+  enum { kMinCapacity = FlatMapGroup::kWidth };
+  // Probe sequences longer than this many groups make the table switch to
+  // the tree representation.  Random hashes essentially never get there.
+  enum { kMaxProbeGroups = 16 };
+
+  struct Node {
+    value_type kv;
+  };
+
+  using TreeAllocator = typename Allocator::template rebind<
+      std::pair<const KeyForTree<Key>, void*>>::other;
+  using Tree = std::map<KeyForTree<Key>, void*,
+                        typename TransparentSupport<Key>::less, TreeAllocator>;
+
+  static constexpr size_type kNotFound = ~static_cast<size_type>(0);
+
+  template <typename KeyValueType>
+  class iterator_base {
+   public:
+    using reference = KeyValueType&;
+    using pointer = KeyValueType*;
+
+    iterator_base() : node_(nullptr), m_(nullptr), index_(0) {}
+
+    explicit iterator_base(const FlatInnerMap* m) : m_(m) {
+      if (m_->tree_ != nullptr) {
+        node_ = m_->tree_->empty()
+                    ? nullptr
+                    : static_cast<Node*>(m_->tree_->begin()->second);
+        index_ = 0;
+      } else if (m_->num_elements_ == 0) {
+        node_ = nullptr;
+        index_ = 0;
+      } else {
+        SearchFrom(0);
+      }
+    }
+
+    // Any iterator_base can convert to any other.  This is overkill, and we
+    // rely on the enclosing class to use it wisely.
+    template <typename U>
+    explicit iterator_base(const iterator_base<U>& it)
+        : node_(it.node_), m_(it.m_), index_(it.index_) {}
+
+    iterator_base(Node* n, const FlatInnerMap* m, size_type index)
+        : node_(n), m_(m), index_(index) {}
+
+    reference operator*() const { return node_->kv; }
+    pointer operator->() const { return &(operator*()); }
+
+    friend bool operator==(const iterator_base& a, const iterator_base& b) {
+      return a.node_ == b.node_;
+    }
+    friend bool operator!=(const iterator_base& a, const iterator_base& b) {
+      return a.node_ != b.node_;
+    }
+
+    iterator_base& operator++() {
+      if (m_->tree_ != nullptr) {
+        auto it = m_->tree_->upper_bound(node_->kv.first);
+        node_ = it == m_->tree_->end() ? nullptr : static_cast<Node*>(it->second);
+      } else {
+        revalidate_if_necessary();
+        SearchFrom(index_ + 1);
+      }
+      return *this;
+    }
+
+    iterator_base operator++(int /* unused */) {
+      iterator_base tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    // Assumes node_ and m_ are correct and non-null, but index_ may be stale
+    // because the map was modified.  Fixes it if needed.
+    void revalidate_if_necessary() {
+      GOOGLE_DCHECK(node_ != nullptr && m_ != nullptr);
+      if (m_->tree_ != nullptr) return;
+      if (index_ < m_->capacity_ && m_->slots_[index_] == node_) return;
+      index_ = m_->FindIndex(node_->kv.first);
+      GOOGLE_DCHECK(index_ != kNotFound);
+    }
+
+    // Advances to the first full slot at or after start.  If there is none,
+    // leaves node_ == nullptr.
+    void SearchFrom(size_type start) {
+      node_ = nullptr;
+      for (index_ = start; index_ < m_->capacity_;) {
+        uint32 full = FlatMapGroup(m_->ctrl_ + index_).MatchFull();
+        // Ignore the mirrored control words past the end of the table.
+        if (m_->capacity_ - index_ < FlatMapGroup::kWidth) {
+          full &= (uint32{1} << (m_->capacity_ - index_)) - 1;
+        }
+        if (full != 0) {
+          index_ += FlatMapGroup::LowestBitSet(full);
+          node_ = m_->slots_[index_];
+          return;
+        }
+        index_ += FlatMapGroup::kWidth;
+      }
+    }
+
+    Node* node_;
+    const FlatInnerMap* m_;
+    size_type index_;
+  };
+
+ public:
+  using iterator = iterator_base<value_type>;
+  using const_iterator = iterator_base<const value_type>;
+
+  iterator begin() { return iterator(this); }
+  iterator end() { return iterator(); }
+  const_iterator begin() const { return const_iterator(this); }
+  const_iterator end() const { return const_iterator(); }
+
+  void clear() {
+    if (tree_ != nullptr) {
+      for (auto it = tree_->begin(); it != tree_->end();) {
+        Node* node = static_cast<Node*>(it->second);
+        it = tree_->erase(it);
+        DestroyNode(node);
+      }
+      DestroyTree(tree_);
+      tree_ = nullptr;
+      AllocateTable(kMinCapacity);
+    } else if (num_elements_ > 0) {
+      for (size_type i = 0; i < capacity_; i++) {
+        if (IsFull(ctrl_[i])) DestroyNode(slots_[i]);
+      }
+      ResetCtrl();
+    } else if (growth_left_ != MaxLoad(capacity_)) {
+      // Only deleted slots are left.
+      ResetCtrl();
+    }
+    num_elements_ = 0;
+  }
+
+  const hasher& hash_function() const { return *this; }
+
+  static size_type max_size() {
+    return static_cast<size_type>(1) << (sizeof(void**) >= 8 ? 60 : 28);
+  }
+  size_type size() const { return num_elements_; }
+  bool empty() const { return size() == 0; }
+
+  // Grows the table, if needed, so that it holds n elements without
+  // resizing.
+  void reserve(size_type n) {
+    if (tree_ != nullptr || n <= num_elements_ + growth_left_) return;
+    Resize(std::max(CapacityFor(n), capacity_));
+  }
+
+  template <typename K>
+  iterator find(const K& k) {
+    if (tree_ != nullptr) {
+      auto it = tree_->find(k);
+      return it == tree_->end()
+                 ? end()
+                 : iterator(static_cast<Node*>(it->second), this, 0);
+    }
+    size_type index = FindIndex(k);
+    return index == kNotFound ? end() : iterator(slots_[index], this, index);
+  }
+
+  // Insert the key into the map, if not present. In that case, the value will
+  // be value initialized.
+  template <typename K>
+  std::pair<iterator, bool> insert(const K& k) {
+    if (tree_ != nullptr) return InsertInTree(k);
+    const uint64 hash = Hash(k);
+    // Case 1: key was already present.
+    size_type index = FindIndex(k, hash);
+    if (index != kNotFound) {
+      return std::make_pair(iterator(slots_[index], this, index), false);
+    }
+    // Case 2: insert.
+    return std::make_pair(InsertNode(NewNode(k), hash), true);
+  }
+
+  value_type& operator[](const Key& k) { return *insert(k).first; }
+
+  void erase(iterator it) {
+    GOOGLE_DCHECK_EQ(it.m_, this);
+    Node* const item = it.node_;
+    if (tree_ != nullptr) {
+      tree_->erase(tree_->find(item->kv.first));
+    } else {
+      it.revalidate_if_necessary();
+      SetCtrl(it.index_, kFlatMapDeleted);
+      slots_[it.index_] = nullptr;
+    }
+    DestroyNode(item);
+    --num_elements_;
+  }
+
+ private:
+  static bool IsFull(int8 ctrl) { return ctrl >= 0; }
+
+  // Returns the index of the slot holding k, or kNotFound.
+  template <typename K>
+  size_type FindIndex(const K& k) const {
+    return FindIndex(k, Hash(k));
+  }
+  template <typename K>
+  size_type FindIndex(const K& k, uint64 hash) const {
+    const size_type mask = capacity_ - 1;
+    const int8 h2 = H2(hash);
+    size_type pos = H1(hash) & mask;
+    for (size_type step = FlatMapGroup::kWidth;; step += FlatMapGroup::kWidth) {
+      FlatMapGroup group(ctrl_ + pos);
+      for (uint32 match = group.Match(h2); match != 0; match &= match - 1) {
+        size_type index = (pos + FlatMapGroup::LowestBitSet(match)) & mask;
+        if (TransparentSupport<Key>::Equals(slots_[index]->kv.first, k)) {
+          return index;
+        }
+      }
+      if (group.MatchEmpty() != 0) return kNotFound;
+      pos = (pos + step) & mask;
+    }
+  }
+
+  // Returns the first empty or deleted slot in the probe sequence of hash,
+  // and stores the number of groups that were probed in *probe_groups.
+  size_type FindInsertIndex(uint64 hash, size_type* probe_groups) const {
+    const size_type mask = capacity_ - 1;
+    size_type pos = H1(hash) & mask;
+    *probe_groups = 1;
+    for (size_type step = FlatMapGroup::kWidth;; step += FlatMapGroup::kWidth) {
+      uint32 available = FlatMapGroup(ctrl_ + pos).MatchEmptyOrDeleted();
+      if (available != 0) {
+        return (pos + FlatMapGroup::LowestBitSet(available)) & mask;
+      }
+      ++*probe_groups;
+      pos = (pos + step) & mask;
+    }
+  }
+
+  template <typename K, typename V, typename H>
+  friend class DenseInnerMap;
+
+  // Inserts a node whose key is not in the map yet.  DenseInnerMap uses this
+  // to hand its nodes over when it falls back to hashing.
+  iterator InsertNode(Node* node) {
+    if (tree_ != nullptr) {
+      tree_->insert({node->kv.first, node});
+      ++num_elements_;
+      return iterator(node, this, 0);
+    }
+    return InsertNode(node, Hash(node->kv.first));
+  }
+
+  // Returns a new node for a map without an arena, as NewNode() does.
+  static Node* NewHeapNode(const Key& k) { return new Node{value_type(k)}; }
+
+  iterator InsertNode(Node* node, uint64 hash) {
+    if (growth_left_ == 0) ResizeForInsert();
+    size_type probe_groups;
+    size_type index = FindInsertIndex(hash, &probe_groups);
+    if (PROTOBUF_PREDICT_FALSE(probe_groups > kMaxProbeGroups)) {
+      ConvertToTree();
+      return InsertNode(node);
+    }
+    if (ctrl_[index] == kFlatMapEmpty) --growth_left_;
+    SetCtrl(index, H2(hash));
+    slots_[index] = node;
+    ++num_elements_;
+    return iterator(node, this, index);
+  }
+
+  template <typename K>
+  std::pair<iterator, bool> InsertInTree(const K& k) {
+    auto it = tree_->find(k);
+    if (it != tree_->end()) {
+      return std::make_pair(
+          iterator(static_cast<Node*>(it->second), this, 0), false);
+    }
+    Node* node = NewNode(k);
+    tree_->insert({node->kv.first, node});
+    ++num_elements_;
+    return std::make_pair(iterator(node, this, 0), true);
+  }
+
+  // Called when an insert finds no growth left.  Grows the table if it is
+  // really full, or rehashes it in place (or even shrinks it) if most of the
+  // used slots are deleted ones.
+  void ResizeForInsert() {
+    size_type new_capacity = capacity_;
+    if (num_elements_ + 1 > MaxLoad(capacity_) / 2) {
+      if (capacity_ <= max_size() / 2) new_capacity = capacity_ * 2;
+    } else {
+      new_capacity = std::max<size_type>(CapacityFor(num_elements_ + 1) * 2,
+                                         kMinCapacity);
+      new_capacity = std::min(new_capacity, capacity_);
+    }
+    Resize(new_capacity);
+  }
+
+  // Moves all nodes into a new table with the given capacity.
+  void Resize(size_type new_capacity) {
+    int8* const old_ctrl = ctrl_;
+    Node** const old_slots = slots_;
+    const size_type old_capacity = capacity_;
+    AllocateTable(new_capacity);
+    for (size_type i = 0; i < old_capacity; i++) {
+      if (!IsFull(old_ctrl[i])) continue;
+      Node* node = old_slots[i];
+      const uint64 hash = Hash(node->kv.first);
+      size_type probe_groups;
+      size_type index = FindInsertIndex(hash, &probe_groups);
+      SetCtrl(index, H2(hash));
+      slots_[index] = node;
+      --growth_left_;
+    }
+    Dealloc<int8>(old_ctrl, old_capacity + FlatMapGroup::kWidth);
+    Dealloc<Node*>(old_slots, old_capacity);
+  }
+
+  // Gives up on hashing: moves every node into a single tree.
+  void ConvertToTree() {
+    GOOGLE_DCHECK(tree_ == nullptr);
+    Tree* tree =
+        Arena::Create<Tree>(alloc_.arena(), typename Tree::key_compare(),
+                            typename Tree::allocator_type(alloc_));
+    for (size_type i = 0; i < capacity_; i++) {
+      if (IsFull(ctrl_[i])) {
+        tree->insert({slots_[i]->kv.first, slots_[i]});
+      }
+    }
+    GOOGLE_DCHECK_EQ(tree->size(), num_elements_);
+    DeallocateTable();
+    tree_ = tree;
+  }
+
+  template <typename K>
+  uint64 Hash(const K& k) const {
+    // We xor the hash value against the random seed so that we effectively
+    // have a random hash function, then mix it with the multiplication method
+    // (kPhi is roughly (sqrt(5) - 1) / 2 * 2^64) like the default table does.
+    constexpr uint64 kPhi = uint64{0x9e3779b97f4a7c15};
+    return kPhi * (static_cast<uint64>(hash_function()(k)) ^ seed_);
+  }
+  // The starting position of the probe sequence and the bits stored in the
+  // control words use disjoint bits of the hash.
+  static size_type H1(uint64 hash) { return static_cast<size_type>(hash >> 32); }
+  static int8 H2(uint64 hash) { return static_cast<int8>((hash >> 25) & 0x7f); }
+
+  // The largest number of full or deleted slots a table may have.
+  static size_type MaxLoad(size_type capacity) {
+    return capacity - capacity / 8;
+  }
+
+  // Returns the smallest valid capacity that holds n elements.
+  static size_type CapacityFor(size_type n) {
+    size_type capacity = kMinCapacity;
+    while (MaxLoad(capacity) < n) capacity *= 2;
+    return capacity;
+  }
+
+  void SetCtrl(size_type index, int8 ctrl) {
+    ctrl_[index] = ctrl;
+    // Keep the mirrored first group in sync.
+    if (index < FlatMapGroup::kWidth) ctrl_[capacity_ + index] = ctrl;
+  }
+
+  void ResetCtrl() {
+    memset(ctrl_, kFlatMapEmpty, capacity_ + FlatMapGroup::kWidth);
+    memset(slots_, 0, capacity_ * sizeof(slots_[0]));
+    growth_left_ = MaxLoad(capacity_);
+  }
+
+  void AllocateTable(size_type capacity) {
+    GOOGLE_DCHECK_GE(capacity, kMinCapacity);
+    GOOGLE_DCHECK_EQ(capacity & (capacity - 1), 0);
+    capacity_ = capacity;
+    ctrl_ = Alloc<int8>(capacity + FlatMapGroup::kWidth);
+    slots_ = Alloc<Node*>(capacity);
+    ResetCtrl();
+  }
+
+  void DeallocateTable() {
+    if (ctrl_ == nullptr) return;
+    Dealloc<int8>(ctrl_, capacity_ + FlatMapGroup::kWidth);
+    Dealloc<Node*>(slots_, capacity_);
+    ctrl_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+    growth_left_ = 0;
+  }
+
+  template <typename K>
+  Node* NewNode(const K& k) {
+    Node* node;
+    if (alloc_.arena() == nullptr) {
+      node = new Node{value_type(k)};
+    } else {
+      node = Alloc<Node>(1);
+      Arena::CreateInArenaStorage(const_cast<Key*>(&node->kv.first),
+                                  alloc_.arena(), k);
+      Arena::CreateInArenaStorage(&node->kv.second, alloc_.arena());
+    }
+    return node;
+  }
+
+  // Use alloc_ to allocate an array of n objects of type U.
+  template <typename U>
+  U* Alloc(size_type n) {
+    using alloc_type = typename Allocator::template rebind<U>::other;
+    return alloc_type(alloc_).allocate(n);
+  }
+
+  // Use alloc_ to deallocate an array of n objects of type U.
+  template <typename U>
+  void Dealloc(U* t, size_type n) {
+    using alloc_type = typename Allocator::template rebind<U>::other;
+    alloc_type(alloc_).deallocate(t, n);
+  }
+
+  void DestroyNode(Node* node) {
+    if (alloc_.arena() == nullptr) {
+      delete node;
+    }
+  }
+
+  void DestroyTree(Tree* tree) {
+    if (alloc_.arena() == nullptr) {
+      delete tree;
+    }
+  }
+
+  // Return a randomish value.
+  uint64 Seed() const {
+    // We get a little bit of randomness from the address of the map. The
+    // lower bits are not very random, due to alignment, so we discard them
+    // and shift the higher bits into their place.
+    uint64 s = reinterpret_cast<uintptr_t>(this) >> 12;
+#if defined(__x86_64__) && defined(__GNUC__) && \
+    !defined(GOOGLE_PROTOBUF_NO_RDTSC)
+    uint32 hi, lo;
+    asm("rdtsc" : "=a"(lo), "=d"(hi));
+    s += ((static_cast<uint64>(hi) << 32) | lo);
+#endif
+    return s;
+  }
+
+  friend class ::PROTOBUF_NAMESPACE_ID::Arena;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+
+  size_type num_elements_;
+  size_type capacity_;     // a power of two, or 0 in tree mode
+  size_type growth_left_;  // empty slots that may still be filled
+  uint64 seed_;
+  int8* ctrl_;    // capacity_ + FlatMapGroup::kWidth control words
+  Node** slots_;  // capacity_ slots
+  Tree* tree_;    // non-null once the table gave up on hashing
+  Allocator alloc_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(FlatInnerMap);
+};
+
+// When GOOGLE_PROTOBUF_MAP_DENSE_INTEGER_KEYS is defined, Map uses
+// DenseInnerMap for all integer keys except bool.
+template <typename Key>
+struct UseDenseInnerMap
+    : std::integral_constant<bool, std::is_integral<Key>::value &&
+                                       !std::is_same<Key, bool>::value> {};
+
+// DenseInnerMap is the InnerMap of maps with integer keys when
+// GOOGLE_PROTOBUF_MAP_DENSE_INTEGER_KEYS is defined; as this changes the
+// layout of those maps, the macro must be defined consistently for the
+// protobuf library and all code using it.  As long as every key is small and
+// non-negative and the keys are dense enough, it stores the nodes in an array
+// indexed by key, so a lookup is a single indexed load, and a bitmap of the
+// used slots makes iteration a sequential scan.  The first key that does not
+// fit (a negative key, or one that would leave the array mostly empty) moves
+// every node into a HashMap, which is used from then on.
+//
+// Some implementation details:
+// 1. Nodes are allocated the same way HashMap allocates its own, and are handed
+//    over to it when falling back to hashing, so pointers and references to
+//    elements stay valid until the element is erased.
+// 2. The array has a power of two number of slots, at least kMinCapacity.  It
+//    only grows to fit a new key if it then has at most kMaxSlotsPerNode slots
+//    per element, so its size follows the largest key present.  reserve(n)
+//    does not size it, since n says nothing about the keys; the reservation
+//    is handed to the HashMap instead, if the map falls back to hashing.
+// 3. Iteration scans the words of the bitmap in the order given by xoring
+//    their index with a random mask, and the bits of each word in a random
+//    direction.  So, as with the hash tables, the iteration order differs from
+//    map to map, while the scan stays sequential within each word.
+// 4. Iterators store the slot of their node, which is its key.  Iterators
+//    created before the fallback to hashing look their node up in the HashMap
+//    when they are next incremented.
+template <typename Key, typename T, typename HashMap>
+class DenseInnerMap : private TransparentSupport<Key>::hash {
+ public:
+  using hasher = typename TransparentSupport<Key>::hash;
+  using value_type = MapPair<Key, T>;
+  using size_type = size_t;
+
+  explicit DenseInnerMap(size_type n) : DenseInnerMap(nullptr, n) {}
+  DenseInnerMap(Arena* arena, size_type n)
+      : hasher(),
+        num_elements_(0),
+        capacity_(0),
+        seed_(Seed()),
+        slots_(nullptr),
+        present_(nullptr),
+        hash_(nullptr),
+        reserved_(n),
+        alloc_(arena) {}
+
+  ~DenseInnerMap() {
+    clear();
+    DeallocateArray();
+    if (alloc_.arena() == nullptr) delete hash_;
+  }
+
+ private:
+  using Allocator = MapAllocator<void*>;
+  using Node = typename HashMap::Node;
+  using HashIterator = typename HashMap::iterator;
+
+  enum { kMinCapacity = 16 };
+  enum { kMaxSlotsPerNode = 4 };
+  // Keys at or above this never use the array.
+  static constexpr uint64 kMaxCapacity = uint64{1} << 28;
+
+  static constexpr size_type kNotFound = ~static_cast<size_type>(0);
+
+  template <typename KeyValueType>
+  class iterator_base {
+   public:
+    using reference = KeyValueType&;
+    using pointer = KeyValueType*;
+
+    iterator_base() : node_(nullptr), m_(nullptr), index_(kNotFound) {}
+
+    explicit iterator_base(const DenseInnerMap* m) : m_(m) {
+      if (m_->hash_ != nullptr) {
+        SetHashIterator(m_->hash_->begin());
+      } else {
+        SetIndex(m_->FirstPresent());
+      }
+    }
+
+    // Any iterator_base can convert to any other.  This is overkill, and we
+    // rely on the enclosing class to use it wisely.
+    template <typename U>
+    explicit iterator_base(const iterator_base<U>& it)
+        : node_(it.node_),
+          m_(it.m_),
+          index_(it.index_),
+          hash_it_(it.hash_it_) {}
+
+    iterator_base(const DenseInnerMap* m, size_type index) : m_(m) {
+      SetIndex(index);
+    }
+
+    iterator_base(const DenseInnerMap* m, const HashIterator& it) : m_(m) {
+      SetHashIterator(it);
+    }
+
+    reference operator*() const { return node_->kv; }
+    pointer operator->() const { return &(operator*()); }
+
+    friend bool operator==(const iterator_base& a, const iterator_base& b) {
+      return a.node_ == b.node_;
+    }
+    friend bool operator!=(const iterator_base& a, const iterator_base& b) {
+      return a.node_ != b.node_;
+    }
+
+    iterator_base& operator++() {
+      if (m_->hash_ == nullptr) {
+        SetIndex(m_->NextPresent(index_));
+      } else {
+        revalidate_if_necessary();
+        ++hash_it_;
+        node_ = hash_it_.node_;
+      }
+      return *this;
+    }
+
+    iterator_base operator++(int /* unused */) {
+      iterator_base tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    // Assumes node_ and m_ are correct and non-null.  If the iterator was
+    // created before the map fell back to hashing, finds node_ in the
+    // HashMap.
+    void revalidate_if_necessary() {
+      GOOGLE_DCHECK(node_ != nullptr && m_ != nullptr);
+      if (m_->hash_ == nullptr || index_ == kNotFound) return;
+      hash_it_ = m_->hash_->find(node_->kv.first);
+      index_ = kNotFound;
+    }
+
+    void SetIndex(size_type index) {
+      index_ = index;
+      node_ = index == kNotFound ? nullptr : m_->slots_[index];
+    }
+
+    void SetHashIterator(const HashIterator& it) {
+      index_ = kNotFound;
+      hash_it_ = it;
+      node_ = it.node_;
+    }
+
+    Node* node_;
+    const DenseInnerMap* m_;
+    size_type index_;  // the slot of node_, or kNotFound in hash mode
+    HashIterator hash_it_;
+  };
+
+ public:
+  using iterator = iterator_base<value_type>;
+  using const_iterator = iterator_base<const value_type>;
+
+  iterator begin() { return iterator(this); }
+  iterator end() { return iterator(); }
+  const_iterator begin() const { return const_iterator(this); }
+  const_iterator end() const { return const_iterator(); }
+
+  void clear() {
+    if (hash_ != nullptr) {
+      hash_->clear();
+    } else if (num_elements_ > 0) {
+      for (size_type i = 0; i < capacity_; i++) {
+        if (slots_[i] != nullptr) DestroyNode(slots_[i]);
+      }
+      memset(slots_, 0, capacity_ * sizeof(slots_[0]));
+      memset(present_, 0, BitmapWords(capacity_) * sizeof(present_[0]));
+      num_elements_ = 0;
+    }
+  }
+
+  const hasher& hash_function() const { return *this; }
+
+  static size_type max_size() {
+    return static_cast<size_type>(1) << (sizeof(void**) >= 8 ? 60 : 28);
+  }
+  size_type size() const {
+    return hash_ != nullptr ? hash_->size() : num_elements_;
+  }
+  bool empty() const { return size() == 0; }
+
+  // In array mode, only records n for ConvertToHash().
+  void reserve(size_type n) {
+    if (hash_ != nullptr) {
+      hash_->reserve(n);
+    } else {
+      reserved_ = std::max(reserved_, n);
+    }
+  }
+
+  template <typename K>
+  iterator find(const K& k) {
+    if (hash_ != nullptr) return iterator(this, hash_->find(k));
+    const uint64 index = static_cast<uint64>(k);
+    if (index < capacity_ && slots_[index] != nullptr) {
+      return iterator(this, static_cast<size_type>(index));
+    }
+    return end();
+  }
+
+  // Insert the key into the map, if not present. In that case, the value will
+  // be value initialized.
+  std::pair<iterator, bool> insert(const Key& k) {
+    const uint64 index = static_cast<uint64>(k);
+    if (hash_ == nullptr && index >= capacity_ && !GrowToFit(index)) {
+      ConvertToHash();
+    }
+    if (hash_ != nullptr) {
+      std::pair<HashIterator, bool> p = hash_->insert(k);
+      return std::make_pair(iterator(this, p.first), p.second);
+    }
+    if (slots_[index] != nullptr) {
+      return std::make_pair(iterator(this, index), false);
+    }
+    slots_[index] = NewNode(k);
+    present_[index / 64] |= uint64{1} << (index % 64);
+    ++num_elements_;
+    return std::make_pair(iterator(this, index), true);
+  }
+
+  value_type& operator[](const Key& k) { return *insert(k).first; }
+
+  void erase(iterator it) {
+    GOOGLE_DCHECK_EQ(it.m_, this);
+    if (hash_ != nullptr) {
+      it.revalidate_if_necessary();
+      hash_->erase(it.hash_it_);
+      return;
+    }
+    const size_type index = it.index_;
+    GOOGLE_DCHECK(slots_[index] == it.node_);
+    slots_[index] = nullptr;
+    present_[index / 64] &= ~(uint64{1} << (index % 64));
+    DestroyNode(it.node_);
+    --num_elements_;
+  }
+
+ private:
+  // The bitmap words are visited in the order of their index xor WordMask(),
+  // and the bits of each word from high to low if Reverse().
+  size_type WordMask() const {
+    return static_cast<size_type>(seed_ >> 32) & (BitmapWords(capacity_) - 1);
+  }
+  bool Reverse() const { return (seed_ >> 63) != 0; }
+
+  // Returns the first used slot in iteration order, or kNotFound.
+  size_type FirstPresent() const {
+    return capacity_ == 0 ? kNotFound : SearchFrom(0, Reverse() ? 63 : 0);
+  }
+
+  // Returns the used slot that follows index in iteration order, or
+  // kNotFound.
+  size_type NextPresent(size_type index) const {
+    const size_type j = (index / 64) ^ WordMask();
+    const int bit = static_cast<int>(index % 64);
+    if (Reverse()) {
+      return bit == 0 ? SearchFrom(j + 1, 63) : SearchFrom(j, bit - 1);
+    }
+    return bit == 63 ? SearchFrom(j + 1, 0) : SearchFrom(j, bit + 1);
+  }
+
+  // Returns the first used slot in iteration order, starting at the given
+  // bit of the j-th word visited, or kNotFound.
+  size_type SearchFrom(size_type j, int bit) const {
+    const size_type words = BitmapWords(capacity_);
+    const size_type mask = WordMask();
+    for (; j < words; j++) {
+      const size_type w = j ^ mask;
+      uint64 word = present_[w];
+      if (Reverse()) {
+        word &= (uint64{2} << bit) - 1;  // bits at or below bit
+        if (word != 0) return w * 64 + Bits::Log2FloorNonZero64(word);
+        bit = 63;
+      } else {
+        word &= ~uint64{0} << bit;  // bits at or above bit
+        if (word != 0) {
+          return w * 64 + Bits::Log2FloorNonZero64(word & (~word + 1));
+        }
+        bit = 0;
+      }
+    }
+    return kNotFound;
+  }
+
+  // Grows the array to fit index, unless that would make it too sparse.
+  bool GrowToFit(uint64 index) {
+    if (index >= kMaxCapacity) return false;
+    const size_type new_capacity = CapacityFor(index + 1);
+    if (new_capacity > kMinCapacity &&
+        new_capacity > (num_elements_ + 1) * kMaxSlotsPerNode) {
+      return false;
+    }
+    Resize(new_capacity);
+    return true;
+  }
+
+  // Gives up on the array: moves every node into a HashMap.
+  void ConvertToHash() {
+    GOOGLE_DCHECK(hash_ == nullptr);
+    HashMap* hash = Arena::CreateMessage<HashMap>(alloc_.arena(), 0);
+    hash->reserve(std::max(num_elements_ + 1, reserved_));
+    for (size_type i = 0; i < capacity_; i++) {
+      if (slots_[i] != nullptr) hash->InsertNode(slots_[i]);
+    }
+    GOOGLE_DCHECK_EQ(hash->size(), num_elements_);
+    DeallocateArray();
+    num_elements_ = 0;
+    hash_ = hash;
+  }
+
+  // Returns the smallest valid capacity that holds the keys below n.
+  static size_type CapacityFor(uint64 n) {
+    size_type capacity = kMinCapacity;
+    while (capacity < n) capacity *= 2;
+    return capacity;
+  }
+
+  static size_type BitmapWords(size_type capacity) {
+    return (capacity + 63) / 64;
+  }
+
+  // Moves the array to one with new_capacity slots.  Since slots are indexed
+  // by key, the used slots keep their index.
+  void Resize(size_type new_capacity) {
+    GOOGLE_DCHECK_GT(new_capacity, capacity_);
+    Node** const new_slots = Alloc<Node*>(new_capacity);
+    uint64* const new_present = Alloc<uint64>(BitmapWords(new_capacity));
+    memset(new_slots, 0, new_capacity * sizeof(new_slots[0]));
+    memset(new_present, 0, BitmapWords(new_capacity) * sizeof(new_present[0]));
+    if (capacity_ > 0) {
+      memcpy(new_slots, slots_, capacity_ * sizeof(slots_[0]));
+      memcpy(new_present, present_, BitmapWords(capacity_) * sizeof(present_[0]));
+    }
+    DeallocateArray();
+    capacity_ = new_capacity;
+    slots_ = new_slots;
+    present_ = new_present;
+  }
+
+  void DeallocateArray() {
+    if (slots_ == nullptr) return;
+    Dealloc<Node*>(slots_, capacity_);
+    Dealloc<uint64>(present_, BitmapWords(capacity_));
+    slots_ = nullptr;
+    present_ = nullptr;
+    capacity_ = 0;
+  }
+
+  Node* NewNode(const Key& k) {
+    Node* node;
+    if (alloc_.arena() == nullptr) {
+      node = HashMap::NewHeapNode(k);
+    } else {
+      node = Alloc<Node>(1);
+      Arena::CreateInArenaStorage(const_cast<Key*>(&node->kv.first),
+                                  alloc_.arena(), k);
+      Arena::CreateInArenaStorage(&node->kv.second, alloc_.arena());
+    }
+    return node;
+  }
+
+  // Use alloc_ to allocate an array of n objects of type U.
+  template <typename U>
+  U* Alloc(size_type n) {
+    using alloc_type = typename Allocator::template rebind<U>::other;
+    return alloc_type(alloc_).allocate(n);
+  }
+
+  // Use alloc_ to deallocate an array of n objects of type U.
+  template <typename U>
+  void Dealloc(U* t, size_type n) {
+    using alloc_type = typename Allocator::template rebind<U>::other;
+    alloc_type(alloc_).deallocate(t, n);
+  }
+
+  void DestroyNode(Node* node) {
+    if (alloc_.arena() == nullptr) {
+      delete node;
+    }
+  }
+
+  // Return a randomish value.  Its high bits are used, so mix them with the
+  // low ones.
+  uint64 Seed() const {
+    // We get a little bit of randomness from the address of the map. The
+    // lower bits are not very random, due to alignment, so we discard them
+    // and shift the higher bits into their place.
+    uint64 s = reinterpret_cast<uintptr_t>(this) >> 12;
+#if defined(__x86_64__) && defined(__GNUC__) && \
+    !defined(GOOGLE_PROTOBUF_NO_RDTSC)
+    uint32 hi, lo;
+    asm("rdtsc" : "=a"(lo), "=d"(hi));
+    s += ((static_cast<uint64>(hi) << 32) | lo);
+#endif
+    // kPhi is roughly (sqrt(5) - 1) / 2 * 2^64.
+    constexpr uint64 kPhi = uint64{0x9e3779b97f4a7c15};
+    return s * kPhi;
+  }
+
+  friend class ::PROTOBUF_NAMESPACE_ID::Arena;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+
+  size_type num_elements_;  // in array mode only
+  size_type capacity_;      // a power of two, or 0
+  uint64 seed_;
+  Node** slots_;      // capacity_ slots, indexed by key
+  uint64* present_;   // a bit per slot, set for the used ones
+  HashMap* hash_;     // non-null once the array gave up on the keys
+  size_type reserved_;  // the largest reservation, in array mode only
+  Allocator alloc_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(DenseInnerMap);
+};
+
+}  // namespace internal
+
 // Map is an associative container type used to store protobuf map
 // fields.  Each Map instance may or may not use a different hash function, a
 // different iteration order, and so on.  E.g., please don't examine
@@ -314,6 +1329,7 @@ class Map {
   Map(const Map& other)
       : arena_(nullptr), default_enum_value_(other.default_enum_value_) {
     Init();
+    reserve(other.size());
     insert(other.begin(), other.end());
   }
 
@@ -354,7 +1370,10 @@ class Map {
 
   using Allocator = internal::MapAllocator<void*>;
 
-  // InnerMap is a generic hash-based map.  It doesn't contain any
+#ifdef GOOGLE_PROTOBUF_MAP_OPEN_ADDRESSING
+  using HashInnerMap = internal::FlatInnerMap<Key, T>;
+#else
+  // HashInnerMap is a generic hash-based map.  It doesn't contain any
   // protocol-buffer-specific logic.  It is a chaining hash map with the
   // additional feature that some buckets can be converted to use an ordered
   // container.  This ensures O(lg n) bounds on find, insert, and erase, while
@@ -383,15 +1402,17 @@ class Map {
   // 8. Mutations to a map do not invalidate the map's iterators, pointers to
   //    elements, or references to elements.
   // 9. Except for erase(iterator), any non-const method can reorder iterators.
-  // 10. InnerMap uses KeyForTree<Key> when using the Tree representation, which
-  //    is either `Key`, if Key is a scalar, or `reference_wrapper<const Key>`
-  //    otherwise. This avoids unncessary copies of string keys, for example.
-  class InnerMap : private hasher {
+  // 10. HashInnerMap uses KeyForTree<Key> when using the Tree representation,
+  //    which is either `Key`, if Key is a scalar, or
+  //    `reference_wrapper<const Key>` otherwise. This avoids unncessary copies
+  //    of string keys, for example.
+  class HashInnerMap : private hasher {
    public:
-    explicit InnerMap(size_type n) : InnerMap(nullptr, n) {}
-    InnerMap(Arena* arena, size_type n)
+    explicit HashInnerMap(size_type n) : HashInnerMap(nullptr, n) {}
+    HashInnerMap(Arena* arena, size_type n)
         : hasher(),
           num_elements_(0),
+          min_num_buckets_(kMinTableSize),
           seed_(Seed()),
           table_(nullptr),
           alloc_(arena) {
@@ -400,7 +1421,7 @@ class Map {
       num_buckets_ = index_of_first_non_null_ = n;
     }
 
-    ~InnerMap() {
+    ~HashInnerMap() {
       if (table_ != nullptr) {
         clear();
         Dealloc<void*>(table_, num_buckets_);
@@ -409,6 +1430,7 @@ class Map {
 
    private:
     enum { kMinTableSize = 8 };
+    enum { kMaxMapLoadTimes16 = 12 };  // controls RAM vs CPU tradeoff
 
     // Linked-list nodes, as one would expect for a chaining hash table.
     struct Node {
@@ -448,7 +1470,7 @@ class Map {
       // are rechecked, and updated if necessary.
       iterator_base() : node_(nullptr), m_(nullptr), bucket_index_(0) {}
 
-      explicit iterator_base(const InnerMap* m) : m_(m) {
+      explicit iterator_base(const HashInnerMap* m) : m_(m) {
         SearchFrom(m->index_of_first_non_null_);
       }
 
@@ -459,10 +1481,10 @@ class Map {
       explicit iterator_base(const iterator_base<U>& it)
           : node_(it.node_), m_(it.m_), bucket_index_(it.bucket_index_) {}
 
-      iterator_base(Node* n, const InnerMap* m, size_type index)
+      iterator_base(Node* n, const HashInnerMap* m, size_type index)
           : node_(n), m_(m), bucket_index_(index) {}
 
-      iterator_base(TreeIterator tree_it, const InnerMap* m, size_type index)
+      iterator_base(TreeIterator tree_it, const HashInnerMap* m, size_type index)
           : node_(NodeFromTreeIterator(tree_it)), m_(m), bucket_index_(index) {
         // Invariant: iterators that use buckets with trees have an even
         // bucket_index_.
@@ -556,7 +1578,7 @@ class Map {
       }
 
       Node* node_;
-      const InnerMap* m_;
+      const HashInnerMap* m_;
       size_type bucket_index_;
     };
 
@@ -597,6 +1619,7 @@ class Map {
         }
       }
       num_elements_ = 0;
+      min_num_buckets_ = kMinTableSize;
       index_of_first_non_null_ = num_buckets_;
     }
 
@@ -608,6 +1631,19 @@ class Map {
     size_type size() const { return num_elements_; }
     bool empty() const { return size() == 0; }
 
+    // Grows the table, if needed, so that it holds n elements without
+    // resizing.  Until the next clear(), the table does not shrink below
+    // that size either.
+    void reserve(size_type n) {
+      size_type new_num_buckets = num_buckets_;
+      while (n >= new_num_buckets * kMaxMapLoadTimes16 / 16 &&
+             new_num_buckets <= max_size() / 2) {
+        new_num_buckets *= 2;
+      }
+      min_num_buckets_ = std::max(min_num_buckets_, new_num_buckets);
+      if (new_num_buckets != num_buckets_) Resize(new_num_buckets);
+    }
+
     template <typename K>
     iterator find(const K& k) {
       return iterator(FindHelper(k).first);
@@ -615,7 +1651,8 @@ class Map {
 
     // Insert the key into the map, if not present. In that case, the value will
     // be value initialized.
-    std::pair<iterator, bool> insert(const Key& k) {
+    template <typename K>
+    std::pair<iterator, bool> insert(const K& k) {
       std::pair<const_iterator, size_type> p = FindHelper(k);
       // Case 1: key was already present.
       if (p.first.node_ != nullptr)
@@ -676,6 +1713,23 @@ class Map {
     }
 
    private:
+    template <typename K, typename V, typename H>
+    friend class internal::DenseInnerMap;
+
+    // Inserts a node whose key is not in the map yet.  DenseInnerMap uses
+    // this to hand its nodes over when it falls back to hashing.
+    iterator InsertNode(Node* node) {
+      ResizeIfLoadIsOutOfRange(num_elements_ + 1);
+      iterator result = InsertUnique(BucketNumber(node->kv.first), node);
+      ++num_elements_;
+      return result;
+    }
+
+    // Returns a new node for a map without an arena, as insert() does.
+    static Node* NewHeapNode(const Key& k) {
+      return new Node{value_type(k), nullptr};
+    }
+
     const_iterator find(const Key& k, TreeIterator* it) const {
       return FindHelper(k, it).first;
     }
@@ -793,7 +1847,6 @@ class Map {
     // policy that sometimes we resize down as well as up, clients can easily
     // keep O(size()) = O(number of buckets) if they want that.
     bool ResizeIfLoadIsOutOfRange(size_type new_size) {
-      const size_type kMaxMapLoadTimes16 = 12;  // controls RAM vs CPU tradeoff
       const size_type hi_cutoff = num_buckets_ * kMaxMapLoadTimes16 / 16;
       const size_type lo_cutoff = hi_cutoff / 4;
       // We don't care how many elements are in trees.  If a lot are,
@@ -805,7 +1858,7 @@ class Map {
           return true;
         }
       } else if (PROTOBUF_PREDICT_FALSE(new_size <= lo_cutoff &&
-                                        num_buckets_ > kMinTableSize)) {
+                                        num_buckets_ > min_num_buckets_)) {
         size_type lg2_of_size_reduction_factor = 1;
         // It's possible we want to shrink a lot here... size() could even be 0.
         // So, estimate how much to shrink by making sure we don't shrink so
@@ -816,7 +1869,7 @@ class Map {
           ++lg2_of_size_reduction_factor;
         }
         size_type new_num_buckets = std::max<size_type>(
-            kMinTableSize, num_buckets_ >> lg2_of_size_reduction_factor);
+            min_num_buckets_, num_buckets_ >> lg2_of_size_reduction_factor);
         if (new_num_buckets != num_buckets_) {
           Resize(new_num_buckets);
           return true;
@@ -1014,12 +2067,24 @@ class Map {
 
     size_type num_elements_;
     size_type num_buckets_;
+    size_type min_num_buckets_;  // the table does not shrink below this
     size_type seed_;
     size_type index_of_first_non_null_;
     void** table_;  // an array with num_buckets_ entries
     Allocator alloc_;
-    GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(InnerMap);
-  };  // end of class InnerMap
+    GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(HashInnerMap);
+  };  // end of class HashInnerMap
+#endif  // GOOGLE_PROTOBUF_MAP_OPEN_ADDRESSING
+
+#ifdef GOOGLE_PROTOBUF_MAP_DENSE_INTEGER_KEYS
+  // Maps with integer keys index small dense keys directly and only hash
+  // them once they get sparse; see internal::DenseInnerMap.
+  using InnerMap = typename std::conditional<
+      internal::UseDenseInnerMap<Key>::value,
+      internal::DenseInnerMap<Key, T, HashInnerMap>, HashInnerMap>::type;
+#else
+  using InnerMap = HashInnerMap;
+#endif  // GOOGLE_PROTOBUF_MAP_DENSE_INTEGER_KEYS
 
   template <typename LookupKey>
   using key_arg = typename internal::TransparentSupport<
@@ -1115,6 +2180,10 @@ class Map {
   size_type size() const { return elements_->size(); }
   bool empty() const { return size() == 0; }
 
+  // Makes room for at least n elements, so that inserting them does not
+  // rehash the table.
+  void reserve(size_type n) { elements_->reserve(n); }
+
   // Element access
   T& operator[](const key_type& key) { return (*elements_)[key].second; }
 
@@ -1184,6 +2253,15 @@ class Map {
     }
     return std::pair<iterator, bool>(iterator(p.first), p.second);
   }
+  // Inserts key with a value-initialized value if it is not present yet.  For
+  // maps with transparent lookup, key can be any type that the key type can
+  // be constructed from, e.g. a std::string_view for std::string keys, and
+  // the key is only converted if it is inserted.
+  template <typename K = key_type>
+  std::pair<iterator, bool> try_emplace(const key_arg<K>& key) {
+    std::pair<typename InnerMap::iterator, bool> p = elements_->insert(key);
+    return std::pair<iterator, bool>(iterator(p.first), p.second);
+  }
   template <class InputIt>
   void insert(InputIt first, InputIt last) {
     for (InputIt it = first; it != last; ++it) {
@@ -1224,6 +2302,7 @@ class Map {
   Map& operator=(const Map& other) {
     if (this != &other) {
       clear();
+      reserve(other.size());
       insert(other.begin(), other.end());
     }
     return *this;
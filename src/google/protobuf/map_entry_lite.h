@@ -399,56 +399,61 @@ class MapEntryImpl : public Base {
 
     const char* _InternalParse(const char* ptr, ParseContext* ctx) {
       if (PROTOBUF_PREDICT_TRUE(!ctx->Done(&ptr) && *ptr == kKeyTag)) {
-        ptr = KeyTypeHandler::Read(ptr + 1, ctx, &key_);
-        if (PROTOBUF_PREDICT_FALSE(!ptr || !Derived::ValidateKey(&key_))) {
-          return nullptr;
-        }
-        if (PROTOBUF_PREDICT_TRUE(!ctx->Done(&ptr) && *ptr == kValueTag)) {
-          typename Map::size_type map_size = map_->size();
-          value_ptr_ = &(*map_)[key_];
-          if (PROTOBUF_PREDICT_TRUE(map_size != map_->size())) {
-            using T =
-                typename MapIf<ValueTypeHandler::kIsEnum, int*, Value*>::type;
-            ptr = ValueTypeHandler::Read(ptr + 1, ctx,
-                                         reinterpret_cast<T>(value_ptr_));
-            if (PROTOBUF_PREDICT_FALSE(!ptr ||
-                                       !Derived::ValidateValue(value_ptr_))) {
-              map_->erase(key_);  // Failure! Undo insertion.
-              return nullptr;
+        ptr = ReadKey(ptr + 1, ctx, std::integral_constant<bool, kKeyView>());
+        if (PROTOBUF_PREDICT_FALSE(!ptr)) return nullptr;
+        if (PROTOBUF_PREDICT_TRUE(inserted_)) {
+          // We created a new key-value pair.  Parse the value in place.
+          value_ptr_ = &it_->second;
+          ptr = ReadValue(ptr + 1, ctx, value_ptr_);
+          if (PROTOBUF_PREDICT_TRUE(ptr != nullptr)) {
+            if (PROTOBUF_PREDICT_FALSE(!ctx->Done(&ptr))) {
+              return ParseRemainingFields(ptr, ctx, true);
             }
-            if (PROTOBUF_PREDICT_TRUE(ctx->Done(&ptr))) return ptr;
-            if (!ptr) return nullptr;
-            NewEntry();
-            ValueMover::Move(value_ptr_, entry_->mutable_value());
-            map_->erase(key_);
-            goto move_key;
+            if (PROTOBUF_PREDICT_TRUE(ptr != nullptr)) return ptr;
           }
-        } else {
-          if (!ptr) return nullptr;
+          map_->erase(it_);  // Failure! Undo insertion.
+          return nullptr;
         }
-        NewEntry();
-      move_key:
-        KeyMover::Move(&key_, entry_->mutable_key());
-      } else {
-        if (!ptr) return nullptr;
-        NewEntry();
+        return ParseRemainingFields(ptr, ctx, false);
       }
-      ptr = entry_->_InternalParse(ptr, ctx);
-      if (ptr) UseKeyAndValueFromEntry();
-      return ptr;
+      if (!ptr) return nullptr;
+      key_ = Key();
+      return ParseRemainingFields(ptr, ctx, false);
     }
 
     template <typename UnknownType>
     const char* ParseWithEnumValidation(const char* ptr, ParseContext* ctx,
                                         bool (*is_valid)(int), uint32 field_num,
                                         InternalMetadata* metadata) {
-      auto entry = NewEntry();
-      ptr = entry->_InternalParse(ptr, ctx);
-      if (!ptr) return nullptr;
-      if (is_valid(entry->value())) {
-        UseKeyAndValueFromEntry();
+      // Unknown enum values must not reach the map, so the value is parsed
+      // next to the map and only inserted once it is known to be valid.
+      key_ = Key();
+      int value = default_enum_value;
+      while (!ctx->Done(&ptr)) {
+        uint32 tag;
+        ptr = ReadTag(ptr, &tag);
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+        if (tag == kKeyTag) {
+          ptr = KeyTypeHandler::Read(ptr, ctx, &key_);
+          if (!Derived::ValidateKey(&key_)) return nullptr;
+        } else if (tag == kValueTag) {
+          ptr = ValueTypeHandler::Read(ptr, ctx, &value);
+        } else {
+          if (tag == 0 || WireFormatLite::GetTagWireType(tag) ==
+                              WireFormatLite::WIRETYPE_END_GROUP) {
+            ctx->SetLastTag(tag);
+            break;
+          }
+          ptr = UnknownFieldParse(tag, static_cast<std::string*>(nullptr), ptr,
+                                  ctx);
+        }
+        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+      }
+      if (is_valid(value)) {
+        value_ptr_ = &(*map_)[key_];
+        *value_ptr_ = static_cast<Value>(value);
       } else {
-        WriteLengthDelimited(field_num, entry->SerializeAsString(),
+        WriteLengthDelimited(field_num, SerializeKeyAndValue(value),
                              metadata->mutable_unknown_fields<UnknownType>());
       }
       return ptr;
@@ -456,13 +461,163 @@ class MapEntryImpl : public Base {
 
     MapEntryImpl* NewEntry() { return entry_ = mf_->NewEntry(); }
 
-    const Key& key() const { return key_; }
+    const Key& key() const { return key_in_map_ ? it_->first : key_; }
     const Value& value() const { return *value_ptr_; }
 
     const Key& entry_key() const { return entry_->key(); }
     const Value& entry_value() const { return entry_->value(); }
 
    private:
+    // String keys followed by their value are looked up without copying them
+    // if the map supports lookup by std::string_view.
+#if defined(__cpp_lib_string_view)
+    static constexpr bool kKeyView = std::is_same<Key, std::string>::value;
+#else
+    static constexpr bool kKeyView = false;
+#endif  // defined(__cpp_lib_string_view)
+
+    // Reads the key whose tag was just consumed.  If the value follows right
+    // away, the key is looked up, and inserted if it is new: it_ is set to its
+    // element and inserted_ tells whether the value still needs to be parsed.
+    // Otherwise the key is left in key_.
+    const char* ReadKey(const char* ptr, ParseContext* ctx,
+                        std::false_type /* key_view */) {
+      ptr = KeyTypeHandler::Read(ptr, ctx, &key_);
+      if (PROTOBUF_PREDICT_FALSE(!ptr || !Derived::ValidateKey(&key_))) {
+        return nullptr;
+      }
+      if (PROTOBUF_PREDICT_TRUE(!ctx->Done(&ptr) && *ptr == kValueTag)) {
+        std::pair<typename Map::iterator, bool> p = map_->try_emplace(key_);
+        it_ = p.first;
+        key_in_map_ = true;
+        inserted_ = p.second;
+      }
+      return ptr;
+    }
+#if defined(__cpp_lib_string_view)
+    const char* ReadKey(const char* ptr, ParseContext* ctx,
+                        std::true_type /* key_view */) {
+      const char* key_start = ptr;
+      int size = ReadSize(&ptr);
+      // The bytes of the key and the value tag after them can be read in
+      // place if they are buffered and within the limit, without calling
+      // ctx->Done(), which could flip buffers.
+      if (PROTOBUF_PREDICT_FALSE(!ptr || size >= ctx->BytesUntilLimit(ptr) ||
+                                 !ctx->IsContiguous(ptr, size + 1) ||
+                                 ptr[size] != kValueTag)) {
+        return ReadKey(key_start, ctx, std::false_type());
+      }
+      std::pair<typename Map::iterator, bool> p =
+          map_->try_emplace(std::string_view(ptr, size));
+      it_ = p.first;
+      key_in_map_ = true;
+      inserted_ = p.second;
+      // A key that was already present has been validated when it was
+      // inserted.  ValidateKey() only reads the key.
+      if (inserted_ &&
+          !Derived::ValidateKey(const_cast<std::string*>(&it_->first))) {
+        map_->erase(it_);
+        return nullptr;
+      }
+      return ptr + size;
+    }
+#endif  // defined(__cpp_lib_string_view)
+
+    using ValueReadType =
+        typename MapIf<ValueTypeHandler::kIsEnum, int*, Value*>::type;
+
+    static const char* ReadValue(const char* ptr, ParseContext* ctx,
+                                 Value* value) {
+      ptr = ValueTypeHandler::Read(ptr, ctx,
+                                   reinterpret_cast<ValueReadType>(value));
+      if (PROTOBUF_PREDICT_FALSE(!ptr || !Derived::ValidateValue(value))) {
+        return nullptr;
+      }
+      return ptr;
+    }
+
+    // Parses the rest of an entry that is not just a key followed by a value,
+    // e.g. because its fields are out of order, repeated, missing or mixed with
+    // unknown fields.  If value_in_map, the key at it_ was just inserted into
+    // the map and the value parsed in place; otherwise the key read so far, if
+    // any, is either at it_, if key_in_map_, or in key_.  The value is parsed
+    // in place whenever the key is known to be new, and into a local
+    // otherwise, which is then moved into the map.  No MapEntry is ever
+    // created.  If the entry fails to parse, a key inserted for it is removed.
+    const char* ParseRemainingFields(const char* ptr, ParseContext* ctx,
+                                     bool value_in_map) PROTOBUF_COLD {
+      Value value{};
+      SetDefaultValue(&value, std::integral_constant<
+                                  bool, ValueTypeHandler::kIsEnum>());
+      while (!ctx->Done(&ptr)) {
+        uint32 tag;
+        ptr = ReadTag(ptr, &tag);
+        if (!ptr) break;
+        if (tag == kKeyTag) {
+          if (value_in_map) {
+            // The entry has another key after all.
+            ValueMover::Move(&it_->second, &value);
+            map_->erase(it_);
+            value_in_map = false;
+          }
+          key_in_map_ = false;
+          ptr = KeyTypeHandler::Read(ptr, ctx, &key_);
+          if (!ptr || !Derived::ValidateKey(&key_)) return nullptr;
+        } else if (tag == kValueTag) {
+          ptr = ReadValue(ptr, ctx, value_in_map ? &it_->second : &value);
+        } else {
+          if (tag == 0 || WireFormatLite::GetTagWireType(tag) ==
+                              WireFormatLite::WIRETYPE_END_GROUP) {
+            ctx->SetLastTag(tag);
+            break;
+          }
+          ptr = UnknownFieldParse(tag, static_cast<std::string*>(nullptr), ptr,
+                                  ctx);
+        }
+        if (!ptr) break;
+      }
+      if (!ptr) {
+        if (value_in_map) map_->erase(it_);  // Failure! Undo insertion.
+        return nullptr;
+      }
+      if (!value_in_map) {
+        if (!key_in_map_) {
+          it_ = map_->try_emplace(key_).first;
+          key_in_map_ = true;
+        }
+        ValueMover::Move(&value, &it_->second);
+      }
+      value_ptr_ = &it_->second;
+      return ptr;
+    }
+
+    // A map entry without a value field has the default value, which is the
+    // first enum value for enums.
+    template <typename V>
+    static void SetDefaultValue(V* value, std::true_type /* is_enum */) {
+      *value = static_cast<V>(default_enum_value);
+    }
+    template <typename V>
+    static void SetDefaultValue(V*, std::false_type /* is_enum */) {}
+
+    // Returns the serialized contents of a map entry with key_ and the given
+    // enum value, to be stored as an unknown field.
+    std::string SerializeKeyAndValue(int value) const {
+      const int size = static_cast<int>(2 + KeyTypeHandler::ByteSize(key_) +
+                                        ValueTypeHandler::ByteSize(value));
+      std::string serialized;
+      serialized.resize(size);
+      uint8* target = reinterpret_cast<uint8*>(&serialized[0]);
+      io::EpsCopyOutputStream stream(
+          target, size,
+          io::CodedOutputStream::IsDefaultSerializationDeterministic());
+      target = KeyTypeHandler::Write(kKeyFieldNumber, key_, target, &stream);
+      target = ValueTypeHandler::Write(kValueFieldNumber, value, target,
+                                       &stream);
+      GOOGLE_DCHECK_EQ(target, reinterpret_cast<uint8*>(&serialized[0]) + size);
+      return serialized;
+    }
+
     void UseKeyAndValueFromEntry() {
       // Update key_ in case we need it later (because key() is called).
       // This is potentially inefficient, especially if the key is
@@ -500,6 +655,11 @@ class MapEntryImpl : public Base {
     MapField* const mf_;
     Map* const map_;
     Key key_;
+    // The element of the entry's key, valid if key_in_map_.
+    typename Map::iterator it_;
+    bool key_in_map_ = false;
+    // Whether it_ was inserted for this entry.
+    bool inserted_ = false;
     Value* value_ptr_;
     MapEntryImpl* entry_ = nullptr;
   };
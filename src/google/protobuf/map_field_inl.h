@@ -236,6 +236,22 @@ bool MapField<Derived, Key, T, kKeyFieldType, kValueFieldType,
   return false;
 }
 
+template <typename Derived, typename Key, typename T,
+          WireFormatLite::FieldType kKeyFieldType,
+          WireFormatLite::FieldType kValueFieldType, int default_enum_value>
+bool MapField<Derived, Key, T, kKeyFieldType, kValueFieldType,
+              default_enum_value>::LookupMapValue(const MapKey& map_key,
+                                                  MapValueRef* val) const {
+  const Map<Key, T>& map = GetMap();
+  const Key& key = UnwrapMapKey<Key>(map_key);
+  typename Map<Key, T>::const_iterator iter = map.find(key);
+  if (map.end() == iter) {
+    return false;
+  }
+  val->SetValue(&(iter->second));
+  return true;
+}
+
 template <typename Derived, typename Key, typename T,
           WireFormatLite::FieldType kKeyFieldType,
           WireFormatLite::FieldType kValueFieldType, int default_enum_value>
@@ -320,6 +336,7 @@ void MapField<Derived, Key, T, kKeyFieldType, kValueFieldType,
           this->MapFieldBase::repeated_field_);
   GOOGLE_CHECK(this->MapFieldBase::repeated_field_ != NULL);
   map->clear();
+  map->reserve(repeated_field->size());
   for (typename RepeatedPtrField<EntryType>::iterator it =
            repeated_field->begin();
        it != repeated_field->end(); ++it) {
@@ -31,6 +31,7 @@
 #ifndef GOOGLE_PROTOBUF_MAP_FIELD_LITE_H__
 #define GOOGLE_PROTOBUF_MAP_FIELD_LITE_H__
 
+#include <algorithm>
 #include <type_traits>
 #include <google/protobuf/parse_context.h>
 #include <google/protobuf/io/coded_stream.h>
@@ -148,6 +149,24 @@ EnumParseWrapper<UnknownType, T> InitEnumParseWrapper(
                                           metadata};
 }
 
+// Makes room in the map of map_field for n more entries, which the caller is
+// about to parse.  This keeps a long run of entries from rehashing the map
+// over and over.  T is MapFieldLite or MapField.
+//
+// n is counted on the wire, where entries may repeat a key or be empty, so it
+// can be far larger than the number of elements the map ends up with.  To
+// keep small inputs from forcing large allocations, at most
+// kMaxReservedMapEntries entries are reserved beyond the map's current size;
+// longer runs grow the map as it fills.
+static constexpr int kMaxReservedMapEntries = 1024;
+template <typename T>
+void ReserveMapEntries(T* map_field, int n) {
+  if (n > 1) {
+    auto* map = map_field->MutableMap();
+    map->reserve(map->size() + (std::min)(n, kMaxReservedMapEntries));
+  }
+}
+
 // True if IsInitialized() is true for value field in all elements of t. T is
 // expected to be message.  It's useful to have this helper here to keep the
 // protobuf compiler from ever having to emit loops in IsInitialized() methods.
@@ -0,0 +1,4713 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/map_lite_unittest.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fmap_5flite_5funittest_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fmap_5flite_5funittest_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3012000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3012003 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/message_lite.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry_lite.h>
+#include <google/protobuf/map_field_lite.h>
+#include <google/protobuf/generated_enum_util.h>
+#include "google/protobuf/unittest_lite.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5flite_5funittest_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2fmap_5flite_5funittest_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[49]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+namespace protobuf_unittest {
+class ForeignMessageArenaLite;
+class ForeignMessageArenaLiteDefaultTypeInternal;
+extern ForeignMessageArenaLiteDefaultTypeInternal _ForeignMessageArenaLite_default_instance_;
+class TestArenaMapLite;
+class TestArenaMapLiteDefaultTypeInternal;
+extern TestArenaMapLiteDefaultTypeInternal _TestArenaMapLite_default_instance_;
+class TestArenaMapLite_MapBoolBoolEntry_DoNotUse;
+class TestArenaMapLite_MapBoolBoolEntry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapBoolBoolEntry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapBoolBoolEntry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse;
+class TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse;
+class TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapInt32BytesEntry_DoNotUse;
+class TestArenaMapLite_MapInt32BytesEntry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapInt32BytesEntry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapInt32BytesEntry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapInt32DoubleEntry_DoNotUse;
+class TestArenaMapLite_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapInt32DoubleEntry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapInt32EnumEntry_DoNotUse;
+class TestArenaMapLite_MapInt32EnumEntry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapInt32EnumEntry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapInt32EnumEntry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapInt32FloatEntry_DoNotUse;
+class TestArenaMapLite_MapInt32FloatEntry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapInt32FloatEntry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapInt32FloatEntry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse;
+class TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapInt32Int32Entry_DoNotUse;
+class TestArenaMapLite_MapInt32Int32Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapInt32Int32Entry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapInt32Int32Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapInt64Int64Entry_DoNotUse;
+class TestArenaMapLite_MapInt64Int64Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapInt64Int64Entry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapInt64Int64Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse;
+class TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse;
+class TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapSint32Sint32Entry_DoNotUse;
+class TestArenaMapLite_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapSint32Sint32Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapSint64Sint64Entry_DoNotUse;
+class TestArenaMapLite_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapSint64Sint64Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapStringStringEntry_DoNotUse;
+class TestArenaMapLite_MapStringStringEntry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapStringStringEntry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapStringStringEntry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapUint32Uint32Entry_DoNotUse;
+class TestArenaMapLite_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapUint32Uint32Entry_DoNotUse_default_instance_;
+class TestArenaMapLite_MapUint64Uint64Entry_DoNotUse;
+class TestArenaMapLite_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMapLite_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal _TestArenaMapLite_MapUint64Uint64Entry_DoNotUse_default_instance_;
+class TestEnumMapLite;
+class TestEnumMapLiteDefaultTypeInternal;
+extern TestEnumMapLiteDefaultTypeInternal _TestEnumMapLite_default_instance_;
+class TestEnumMapLite_KnownMapFieldEntry_DoNotUse;
+class TestEnumMapLite_KnownMapFieldEntry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapLite_KnownMapFieldEntry_DoNotUseDefaultTypeInternal _TestEnumMapLite_KnownMapFieldEntry_DoNotUse_default_instance_;
+class TestEnumMapLite_UnknownMapFieldEntry_DoNotUse;
+class TestEnumMapLite_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapLite_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal _TestEnumMapLite_UnknownMapFieldEntry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtraLite;
+class TestEnumMapPlusExtraLiteDefaultTypeInternal;
+extern TestEnumMapPlusExtraLiteDefaultTypeInternal _TestEnumMapPlusExtraLite_default_instance_;
+class TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse;
+class TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse_default_instance_;
+class TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse;
+class TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal;
+extern TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUseDefaultTypeInternal _TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse_default_instance_;
+class TestMapLite;
+class TestMapLiteDefaultTypeInternal;
+extern TestMapLiteDefaultTypeInternal _TestMapLite_default_instance_;
+class TestMapLite_MapBoolBoolEntry_DoNotUse;
+class TestMapLite_MapBoolBoolEntry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapBoolBoolEntry_DoNotUseDefaultTypeInternal _TestMapLite_MapBoolBoolEntry_DoNotUse_default_instance_;
+class TestMapLite_MapFixed32Fixed32Entry_DoNotUse;
+class TestMapLite_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal _TestMapLite_MapFixed32Fixed32Entry_DoNotUse_default_instance_;
+class TestMapLite_MapFixed64Fixed64Entry_DoNotUse;
+class TestMapLite_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal _TestMapLite_MapFixed64Fixed64Entry_DoNotUse_default_instance_;
+class TestMapLite_MapInt32BytesEntry_DoNotUse;
+class TestMapLite_MapInt32BytesEntry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapInt32BytesEntry_DoNotUseDefaultTypeInternal _TestMapLite_MapInt32BytesEntry_DoNotUse_default_instance_;
+class TestMapLite_MapInt32DoubleEntry_DoNotUse;
+class TestMapLite_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal _TestMapLite_MapInt32DoubleEntry_DoNotUse_default_instance_;
+class TestMapLite_MapInt32EnumEntry_DoNotUse;
+class TestMapLite_MapInt32EnumEntry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapInt32EnumEntry_DoNotUseDefaultTypeInternal _TestMapLite_MapInt32EnumEntry_DoNotUse_default_instance_;
+class TestMapLite_MapInt32FloatEntry_DoNotUse;
+class TestMapLite_MapInt32FloatEntry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapInt32FloatEntry_DoNotUseDefaultTypeInternal _TestMapLite_MapInt32FloatEntry_DoNotUse_default_instance_;
+class TestMapLite_MapInt32ForeignMessageEntry_DoNotUse;
+class TestMapLite_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal _TestMapLite_MapInt32ForeignMessageEntry_DoNotUse_default_instance_;
+class TestMapLite_MapInt32Int32Entry_DoNotUse;
+class TestMapLite_MapInt32Int32Entry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapInt32Int32Entry_DoNotUseDefaultTypeInternal _TestMapLite_MapInt32Int32Entry_DoNotUse_default_instance_;
+class TestMapLite_MapInt64Int64Entry_DoNotUse;
+class TestMapLite_MapInt64Int64Entry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapInt64Int64Entry_DoNotUseDefaultTypeInternal _TestMapLite_MapInt64Int64Entry_DoNotUse_default_instance_;
+class TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse;
+class TestMapLite_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal _TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_;
+class TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse;
+class TestMapLite_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal _TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_;
+class TestMapLite_MapSint32Sint32Entry_DoNotUse;
+class TestMapLite_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal _TestMapLite_MapSint32Sint32Entry_DoNotUse_default_instance_;
+class TestMapLite_MapSint64Sint64Entry_DoNotUse;
+class TestMapLite_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal _TestMapLite_MapSint64Sint64Entry_DoNotUse_default_instance_;
+class TestMapLite_MapStringStringEntry_DoNotUse;
+class TestMapLite_MapStringStringEntry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapStringStringEntry_DoNotUseDefaultTypeInternal _TestMapLite_MapStringStringEntry_DoNotUse_default_instance_;
+class TestMapLite_MapUint32Uint32Entry_DoNotUse;
+class TestMapLite_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal _TestMapLite_MapUint32Uint32Entry_DoNotUse_default_instance_;
+class TestMapLite_MapUint64Uint64Entry_DoNotUse;
+class TestMapLite_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal _TestMapLite_MapUint64Uint64Entry_DoNotUse_default_instance_;
+class TestMapLite_TeboringEntry_DoNotUse;
+class TestMapLite_TeboringEntry_DoNotUseDefaultTypeInternal;
+extern TestMapLite_TeboringEntry_DoNotUseDefaultTypeInternal _TestMapLite_TeboringEntry_DoNotUse_default_instance_;
+class TestMessageMapLite;
+class TestMessageMapLiteDefaultTypeInternal;
+extern TestMessageMapLiteDefaultTypeInternal _TestMessageMapLite_default_instance_;
+class TestMessageMapLite_MapInt32MessageEntry_DoNotUse;
+class TestMessageMapLite_MapInt32MessageEntry_DoNotUseDefaultTypeInternal;
+extern TestMessageMapLite_MapInt32MessageEntry_DoNotUseDefaultTypeInternal _TestMessageMapLite_MapInt32MessageEntry_DoNotUse_default_instance_;
+class TestRequiredLite;
+class TestRequiredLiteDefaultTypeInternal;
+extern TestRequiredLiteDefaultTypeInternal _TestRequiredLite_default_instance_;
+class TestRequiredMessageMapLite;
+class TestRequiredMessageMapLiteDefaultTypeInternal;
+extern TestRequiredMessageMapLiteDefaultTypeInternal _TestRequiredMessageMapLite_default_instance_;
+class TestRequiredMessageMapLite_MapFieldEntry_DoNotUse;
+class TestRequiredMessageMapLite_MapFieldEntry_DoNotUseDefaultTypeInternal;
+extern TestRequiredMessageMapLite_MapFieldEntry_DoNotUseDefaultTypeInternal _TestRequiredMessageMapLite_MapFieldEntry_DoNotUse_default_instance_;
+}  // namespace protobuf_unittest
+PROTOBUF_NAMESPACE_OPEN
+template<> ::protobuf_unittest::ForeignMessageArenaLite* Arena::CreateMaybeMessage<::protobuf_unittest::ForeignMessageArenaLite>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapBoolBoolEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapBoolBoolEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapInt32BytesEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapInt32BytesEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapInt32DoubleEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapInt32DoubleEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapInt32EnumEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapInt32EnumEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapInt32FloatEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapInt32FloatEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapInt32Int32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapInt32Int32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapInt64Int64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapInt64Int64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapSint32Sint32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapSint32Sint32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapSint64Sint64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapSint64Sint64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapStringStringEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapStringStringEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapUint32Uint32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapUint32Uint32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMapLite_MapUint64Uint64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMapLite_MapUint64Uint64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestEnumMapLite* Arena::CreateMaybeMessage<::protobuf_unittest::TestEnumMapLite>(Arena*);
+template<> ::protobuf_unittest::TestEnumMapLite_KnownMapFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestEnumMapLite_KnownMapFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestEnumMapLite_UnknownMapFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestEnumMapLite_UnknownMapFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestEnumMapPlusExtraLite* Arena::CreateMaybeMessage<::protobuf_unittest::TestEnumMapPlusExtraLite>(Arena*);
+template<> ::protobuf_unittest::TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapBoolBoolEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapBoolBoolEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapFixed32Fixed32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapFixed32Fixed32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapFixed64Fixed64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapFixed64Fixed64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapInt32BytesEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapInt32BytesEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapInt32DoubleEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapInt32DoubleEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapInt32EnumEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapInt32EnumEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapInt32FloatEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapInt32FloatEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapInt32ForeignMessageEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapInt32ForeignMessageEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapInt32Int32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapInt32Int32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapInt64Int64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapInt64Int64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapSint32Sint32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapSint32Sint32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapSint64Sint64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapSint64Sint64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapStringStringEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapStringStringEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapUint32Uint32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapUint32Uint32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_MapUint64Uint64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_MapUint64Uint64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMapLite_TeboringEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapLite_TeboringEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMessageMapLite* Arena::CreateMaybeMessage<::protobuf_unittest::TestMessageMapLite>(Arena*);
+template<> ::protobuf_unittest::TestMessageMapLite_MapInt32MessageEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMessageMapLite_MapInt32MessageEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestRequiredLite* Arena::CreateMaybeMessage<::protobuf_unittest::TestRequiredLite>(Arena*);
+template<> ::protobuf_unittest::TestRequiredMessageMapLite* Arena::CreateMaybeMessage<::protobuf_unittest::TestRequiredMessageMapLite>(Arena*);
+template<> ::protobuf_unittest::TestRequiredMessageMapLite_MapFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestRequiredMessageMapLite_MapFieldEntry_DoNotUse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace protobuf_unittest {
+
+enum Proto2MapEnumLite : int {
+  PROTO2_MAP_ENUM_FOO_LITE = 0,
+  PROTO2_MAP_ENUM_BAR_LITE = 1,
+  PROTO2_MAP_ENUM_BAZ_LITE = 2
+};
+bool Proto2MapEnumLite_IsValid(int value);
+constexpr Proto2MapEnumLite Proto2MapEnumLite_MIN = PROTO2_MAP_ENUM_FOO_LITE;
+constexpr Proto2MapEnumLite Proto2MapEnumLite_MAX = PROTO2_MAP_ENUM_BAZ_LITE;
+constexpr int Proto2MapEnumLite_ARRAYSIZE = Proto2MapEnumLite_MAX + 1;
+
+const std::string& Proto2MapEnumLite_Name(Proto2MapEnumLite value);
+template<typename T>
+inline const std::string& Proto2MapEnumLite_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Proto2MapEnumLite>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Proto2MapEnumLite_Name.");
+  return Proto2MapEnumLite_Name(static_cast<Proto2MapEnumLite>(enum_t_value));
+}
+bool Proto2MapEnumLite_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Proto2MapEnumLite* value);
+enum Proto2MapEnumPlusExtraLite : int {
+  E_PROTO2_MAP_ENUM_FOO_LITE = 0,
+  E_PROTO2_MAP_ENUM_BAR_LITE = 1,
+  E_PROTO2_MAP_ENUM_BAZ_LITE = 2,
+  E_PROTO2_MAP_ENUM_EXTRA_LITE = 3
+};
+bool Proto2MapEnumPlusExtraLite_IsValid(int value);
+constexpr Proto2MapEnumPlusExtraLite Proto2MapEnumPlusExtraLite_MIN = E_PROTO2_MAP_ENUM_FOO_LITE;
+constexpr Proto2MapEnumPlusExtraLite Proto2MapEnumPlusExtraLite_MAX = E_PROTO2_MAP_ENUM_EXTRA_LITE;
+constexpr int Proto2MapEnumPlusExtraLite_ARRAYSIZE = Proto2MapEnumPlusExtraLite_MAX + 1;
+
+const std::string& Proto2MapEnumPlusExtraLite_Name(Proto2MapEnumPlusExtraLite value);
+template<typename T>
+inline const std::string& Proto2MapEnumPlusExtraLite_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Proto2MapEnumPlusExtraLite>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Proto2MapEnumPlusExtraLite_Name.");
+  return Proto2MapEnumPlusExtraLite_Name(static_cast<Proto2MapEnumPlusExtraLite>(enum_t_value));
+}
+bool Proto2MapEnumPlusExtraLite_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Proto2MapEnumPlusExtraLite* value);
+enum MapEnumLite : int {
+  MAP_ENUM_FOO_LITE = 0,
+  MAP_ENUM_BAR_LITE = 1,
+  MAP_ENUM_BAZ_LITE = 2
+};
+bool MapEnumLite_IsValid(int value);
+constexpr MapEnumLite MapEnumLite_MIN = MAP_ENUM_FOO_LITE;
+constexpr MapEnumLite MapEnumLite_MAX = MAP_ENUM_BAZ_LITE;
+constexpr int MapEnumLite_ARRAYSIZE = MapEnumLite_MAX + 1;
+
+const std::string& MapEnumLite_Name(MapEnumLite value);
+template<typename T>
+inline const std::string& MapEnumLite_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MapEnumLite>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MapEnumLite_Name.");
+  return MapEnumLite_Name(static_cast<MapEnumLite>(enum_t_value));
+}
+bool MapEnumLite_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MapEnumLite* value);
+// ===================================================================
+
+class TestMapLite_MapInt32Int32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapInt32Int32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapInt32Int32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > SuperType;
+  TestMapLite_MapInt32Int32Entry_DoNotUse();
+  explicit TestMapLite_MapInt32Int32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapInt32Int32Entry_DoNotUse& other);
+  static const TestMapLite_MapInt32Int32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapInt32Int32Entry_DoNotUse*>(&_TestMapLite_MapInt32Int32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapInt64Int64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapInt64Int64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapInt64Int64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    0 > SuperType;
+  TestMapLite_MapInt64Int64Entry_DoNotUse();
+  explicit TestMapLite_MapInt64Int64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapInt64Int64Entry_DoNotUse& other);
+  static const TestMapLite_MapInt64Int64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapInt64Int64Entry_DoNotUse*>(&_TestMapLite_MapInt64Int64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapUint32Uint32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapUint32Uint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapUint32Uint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    0 > SuperType;
+  TestMapLite_MapUint32Uint32Entry_DoNotUse();
+  explicit TestMapLite_MapUint32Uint32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapUint32Uint32Entry_DoNotUse& other);
+  static const TestMapLite_MapUint32Uint32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapUint32Uint32Entry_DoNotUse*>(&_TestMapLite_MapUint32Uint32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapUint64Uint64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapUint64Uint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapUint64Uint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    0 > SuperType;
+  TestMapLite_MapUint64Uint64Entry_DoNotUse();
+  explicit TestMapLite_MapUint64Uint64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapUint64Uint64Entry_DoNotUse& other);
+  static const TestMapLite_MapUint64Uint64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapUint64Uint64Entry_DoNotUse*>(&_TestMapLite_MapUint64Uint64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapSint32Sint32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapSint32Sint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapSint32Sint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    0 > SuperType;
+  TestMapLite_MapSint32Sint32Entry_DoNotUse();
+  explicit TestMapLite_MapSint32Sint32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapSint32Sint32Entry_DoNotUse& other);
+  static const TestMapLite_MapSint32Sint32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapSint32Sint32Entry_DoNotUse*>(&_TestMapLite_MapSint32Sint32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapSint64Sint64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapSint64Sint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapSint64Sint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    0 > SuperType;
+  TestMapLite_MapSint64Sint64Entry_DoNotUse();
+  explicit TestMapLite_MapSint64Sint64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapSint64Sint64Entry_DoNotUse& other);
+  static const TestMapLite_MapSint64Sint64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapSint64Sint64Entry_DoNotUse*>(&_TestMapLite_MapSint64Sint64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapFixed32Fixed32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapFixed32Fixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapFixed32Fixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    0 > SuperType;
+  TestMapLite_MapFixed32Fixed32Entry_DoNotUse();
+  explicit TestMapLite_MapFixed32Fixed32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapFixed32Fixed32Entry_DoNotUse& other);
+  static const TestMapLite_MapFixed32Fixed32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapFixed32Fixed32Entry_DoNotUse*>(&_TestMapLite_MapFixed32Fixed32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapFixed64Fixed64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapFixed64Fixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapFixed64Fixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    0 > SuperType;
+  TestMapLite_MapFixed64Fixed64Entry_DoNotUse();
+  explicit TestMapLite_MapFixed64Fixed64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapFixed64Fixed64Entry_DoNotUse& other);
+  static const TestMapLite_MapFixed64Fixed64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapFixed64Fixed64Entry_DoNotUse*>(&_TestMapLite_MapFixed64Fixed64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    0 > SuperType;
+  TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse();
+  explicit TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse& other);
+  static const TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse*>(&_TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    0 > SuperType;
+  TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse();
+  explicit TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse& other);
+  static const TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse*>(&_TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapInt32FloatEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapInt32FloatEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, float,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapInt32FloatEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, float,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+    0 > SuperType;
+  TestMapLite_MapInt32FloatEntry_DoNotUse();
+  explicit TestMapLite_MapInt32FloatEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapInt32FloatEntry_DoNotUse& other);
+  static const TestMapLite_MapInt32FloatEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapInt32FloatEntry_DoNotUse*>(&_TestMapLite_MapInt32FloatEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapInt32DoubleEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapInt32DoubleEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, double,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapInt32DoubleEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, double,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE,
+    0 > SuperType;
+  TestMapLite_MapInt32DoubleEntry_DoNotUse();
+  explicit TestMapLite_MapInt32DoubleEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapInt32DoubleEntry_DoNotUse& other);
+  static const TestMapLite_MapInt32DoubleEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapInt32DoubleEntry_DoNotUse*>(&_TestMapLite_MapInt32DoubleEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapBoolBoolEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapBoolBoolEntry_DoNotUse, 
+    bool, bool,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapBoolBoolEntry_DoNotUse, 
+    bool, bool,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    0 > SuperType;
+  TestMapLite_MapBoolBoolEntry_DoNotUse();
+  explicit TestMapLite_MapBoolBoolEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapBoolBoolEntry_DoNotUse& other);
+  static const TestMapLite_MapBoolBoolEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapBoolBoolEntry_DoNotUse*>(&_TestMapLite_MapBoolBoolEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapStringStringEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapStringStringEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapStringStringEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > SuperType;
+  TestMapLite_MapStringStringEntry_DoNotUse();
+  explicit TestMapLite_MapStringStringEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapStringStringEntry_DoNotUse& other);
+  static const TestMapLite_MapStringStringEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapStringStringEntry_DoNotUse*>(&_TestMapLite_MapStringStringEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapInt32BytesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapInt32BytesEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapInt32BytesEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES,
+    0 > SuperType;
+  TestMapLite_MapInt32BytesEntry_DoNotUse();
+  explicit TestMapLite_MapInt32BytesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapInt32BytesEntry_DoNotUse& other);
+  static const TestMapLite_MapInt32BytesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapInt32BytesEntry_DoNotUse*>(&_TestMapLite_MapInt32BytesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapInt32EnumEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapInt32EnumEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapInt32EnumEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > SuperType;
+  TestMapLite_MapInt32EnumEntry_DoNotUse();
+  explicit TestMapLite_MapInt32EnumEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapInt32EnumEntry_DoNotUse& other);
+  static const TestMapLite_MapInt32EnumEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapInt32EnumEntry_DoNotUse*>(&_TestMapLite_MapInt32EnumEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_MapInt32ForeignMessageEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapInt32ForeignMessageEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_MapInt32ForeignMessageEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  TestMapLite_MapInt32ForeignMessageEntry_DoNotUse();
+  explicit TestMapLite_MapInt32ForeignMessageEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_MapInt32ForeignMessageEntry_DoNotUse& other);
+  static const TestMapLite_MapInt32ForeignMessageEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_MapInt32ForeignMessageEntry_DoNotUse*>(&_TestMapLite_MapInt32ForeignMessageEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite_TeboringEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_TeboringEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMapLite_TeboringEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > SuperType;
+  TestMapLite_TeboringEntry_DoNotUse();
+  explicit TestMapLite_TeboringEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMapLite_TeboringEntry_DoNotUse& other);
+  static const TestMapLite_TeboringEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMapLite_TeboringEntry_DoNotUse*>(&_TestMapLite_TeboringEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMapLite PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestMapLite) */ {
+ public:
+  inline TestMapLite() : TestMapLite(nullptr) {};
+  virtual ~TestMapLite();
+
+  TestMapLite(const TestMapLite& from);
+  TestMapLite(TestMapLite&& from) noexcept
+    : TestMapLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestMapLite& operator=(const TestMapLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestMapLite& operator=(TestMapLite&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestMapLite& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestMapLite* internal_default_instance() {
+    return reinterpret_cast<const TestMapLite*>(
+               &_TestMapLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(TestMapLite& a, TestMapLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestMapLite* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestMapLite* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestMapLite* New() const final {
+    return CreateMaybeMessage<TestMapLite>(nullptr);
+  }
+
+  TestMapLite* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestMapLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
+    final;
+  void CopyFrom(const TestMapLite& from);
+  void MergeFrom(const TestMapLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestMapLite* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestMapLite";
+  }
+  protected:
+  explicit TestMapLite(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapInt32Int32FieldNumber = 1,
+    kMapInt64Int64FieldNumber = 2,
+    kMapUint32Uint32FieldNumber = 3,
+    kMapUint64Uint64FieldNumber = 4,
+    kMapSint32Sint32FieldNumber = 5,
+    kMapSint64Sint64FieldNumber = 6,
+    kMapFixed32Fixed32FieldNumber = 7,
+    kMapFixed64Fixed64FieldNumber = 8,
+    kMapSfixed32Sfixed32FieldNumber = 9,
+    kMapSfixed64Sfixed64FieldNumber = 10,
+    kMapInt32FloatFieldNumber = 11,
+    kMapInt32DoubleFieldNumber = 12,
+    kMapBoolBoolFieldNumber = 13,
+    kMapStringStringFieldNumber = 14,
+    kMapInt32BytesFieldNumber = 15,
+    kMapInt32EnumFieldNumber = 16,
+    kMapInt32ForeignMessageFieldNumber = 17,
+    kTeboringFieldNumber = 18,
+  };
+  // map<int32, int32> map_int32_int32 = 1;
+  int map_int32_int32_size() const;
+  private:
+  int _internal_map_int32_int32_size() const;
+  public:
+  void clear_map_int32_int32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_map_int32_int32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_map_int32_int32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map_int32_int32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map_int32_int32();
+
+  // map<int64, int64> map_int64_int64 = 2;
+  int map_int64_int64_size() const;
+  private:
+  int _internal_map_int64_int64_size() const;
+  public:
+  void clear_map_int64_int64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_map_int64_int64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_map_int64_int64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      map_int64_int64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_map_int64_int64();
+
+  // map<uint32, uint32> map_uint32_uint32 = 3;
+  int map_uint32_uint32_size() const;
+  private:
+  int _internal_map_uint32_uint32_size() const;
+  public:
+  void clear_map_uint32_uint32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_map_uint32_uint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_map_uint32_uint32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      map_uint32_uint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_map_uint32_uint32();
+
+  // map<uint64, uint64> map_uint64_uint64 = 4;
+  int map_uint64_uint64_size() const;
+  private:
+  int _internal_map_uint64_uint64_size() const;
+  public:
+  void clear_map_uint64_uint64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_map_uint64_uint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_map_uint64_uint64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      map_uint64_uint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_map_uint64_uint64();
+
+  // map<sint32, sint32> map_sint32_sint32 = 5;
+  int map_sint32_sint32_size() const;
+  private:
+  int _internal_map_sint32_sint32_size() const;
+  public:
+  void clear_map_sint32_sint32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_map_sint32_sint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_map_sint32_sint32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map_sint32_sint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map_sint32_sint32();
+
+  // map<sint64, sint64> map_sint64_sint64 = 6;
+  int map_sint64_sint64_size() const;
+  private:
+  int _internal_map_sint64_sint64_size() const;
+  public:
+  void clear_map_sint64_sint64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_map_sint64_sint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_map_sint64_sint64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      map_sint64_sint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_map_sint64_sint64();
+
+  // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+  int map_fixed32_fixed32_size() const;
+  private:
+  int _internal_map_fixed32_fixed32_size() const;
+  public:
+  void clear_map_fixed32_fixed32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_map_fixed32_fixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_map_fixed32_fixed32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      map_fixed32_fixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_map_fixed32_fixed32();
+
+  // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+  int map_fixed64_fixed64_size() const;
+  private:
+  int _internal_map_fixed64_fixed64_size() const;
+  public:
+  void clear_map_fixed64_fixed64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_map_fixed64_fixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_map_fixed64_fixed64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      map_fixed64_fixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_map_fixed64_fixed64();
+
+  // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+  int map_sfixed32_sfixed32_size() const;
+  private:
+  int _internal_map_sfixed32_sfixed32_size() const;
+  public:
+  void clear_map_sfixed32_sfixed32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_map_sfixed32_sfixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_map_sfixed32_sfixed32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map_sfixed32_sfixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map_sfixed32_sfixed32();
+
+  // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+  int map_sfixed64_sfixed64_size() const;
+  private:
+  int _internal_map_sfixed64_sfixed64_size() const;
+  public:
+  void clear_map_sfixed64_sfixed64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_map_sfixed64_sfixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_map_sfixed64_sfixed64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      map_sfixed64_sfixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_map_sfixed64_sfixed64();
+
+  // map<int32, float> map_int32_float = 11;
+  int map_int32_float_size() const;
+  private:
+  int _internal_map_int32_float_size() const;
+  public:
+  void clear_map_int32_float();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+      _internal_map_int32_float() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+      _internal_mutable_map_int32_float();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+      map_int32_float() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+      mutable_map_int32_float();
+
+  // map<int32, double> map_int32_double = 12;
+  int map_int32_double_size() const;
+  private:
+  int _internal_map_int32_double_size() const;
+  public:
+  void clear_map_int32_double();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+      _internal_map_int32_double() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+      _internal_mutable_map_int32_double();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+      map_int32_double() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+      mutable_map_int32_double();
+
+  // map<bool, bool> map_bool_bool = 13;
+  int map_bool_bool_size() const;
+  private:
+  int _internal_map_bool_bool_size() const;
+  public:
+  void clear_map_bool_bool();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+      _internal_map_bool_bool() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+      _internal_mutable_map_bool_bool();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+      map_bool_bool() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+      mutable_map_bool_bool();
+
+  // map<string, string> map_string_string = 14;
+  int map_string_string_size() const;
+  private:
+  int _internal_map_string_string_size() const;
+  public:
+  void clear_map_string_string();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_map_string_string() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_map_string_string();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      map_string_string() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_map_string_string();
+
+  // map<int32, bytes> map_int32_bytes = 15;
+  int map_int32_bytes_size() const;
+  private:
+  int _internal_map_int32_bytes_size() const;
+  public:
+  void clear_map_int32_bytes();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+      _internal_map_int32_bytes() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+      _internal_mutable_map_int32_bytes();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+      map_int32_bytes() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+      mutable_map_int32_bytes();
+
+  // map<int32, .protobuf_unittest.MapEnumLite> map_int32_enum = 16;
+  int map_int32_enum_size() const;
+  private:
+  int _internal_map_int32_enum_size() const;
+  public:
+  void clear_map_int32_enum();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >&
+      _internal_map_int32_enum() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >*
+      _internal_mutable_map_int32_enum();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >&
+      map_int32_enum() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >*
+      mutable_map_int32_enum();
+
+  // map<int32, .protobuf_unittest.ForeignMessageLite> map_int32_foreign_message = 17;
+  int map_int32_foreign_message_size() const;
+  private:
+  int _internal_map_int32_foreign_message_size() const;
+  public:
+  void clear_map_int32_foreign_message();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite >&
+      _internal_map_int32_foreign_message() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite >*
+      _internal_mutable_map_int32_foreign_message();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite >&
+      map_int32_foreign_message() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite >*
+      mutable_map_int32_foreign_message();
+
+  // map<int32, int32> teboring = 18;
+  int teboring_size() const;
+  private:
+  int _internal_teboring_size() const;
+  public:
+  void clear_teboring();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_teboring() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_teboring();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      teboring() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_teboring();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMapLite)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapInt32Int32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      0 > map_int32_int32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapInt64Int64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+      0 > map_int64_int64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapUint32Uint32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+      0 > map_uint32_uint32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapUint64Uint64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+      0 > map_uint64_uint64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapSint32Sint32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+      0 > map_sint32_sint32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapSint64Sint64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+      0 > map_sint64_sint64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapFixed32Fixed32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+      0 > map_fixed32_fixed32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapFixed64Fixed64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+      0 > map_fixed64_fixed64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapSfixed32Sfixed32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+      0 > map_sfixed32_sfixed32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapSfixed64Sfixed64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+      0 > map_sfixed64_sfixed64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapInt32FloatEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, float,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+      0 > map_int32_float_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapInt32DoubleEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, double,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE,
+      0 > map_int32_double_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapBoolBoolEntry_DoNotUse,
+      bool, bool,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+      0 > map_bool_bool_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapStringStringEntry_DoNotUse,
+      std::string, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      0 > map_string_string_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapInt32BytesEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES,
+      0 > map_int32_bytes_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapInt32EnumEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+      0 > map_int32_enum_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_MapInt32ForeignMessageEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > map_int32_foreign_message_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMapLite_TeboringEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      0 > teboring_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapInt32Int32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapInt32Int32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapInt32Int32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > SuperType;
+  TestArenaMapLite_MapInt32Int32Entry_DoNotUse();
+  explicit TestArenaMapLite_MapInt32Int32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapInt32Int32Entry_DoNotUse& other);
+  static const TestArenaMapLite_MapInt32Int32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapInt32Int32Entry_DoNotUse*>(&_TestArenaMapLite_MapInt32Int32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapInt64Int64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapInt64Int64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapInt64Int64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    0 > SuperType;
+  TestArenaMapLite_MapInt64Int64Entry_DoNotUse();
+  explicit TestArenaMapLite_MapInt64Int64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapInt64Int64Entry_DoNotUse& other);
+  static const TestArenaMapLite_MapInt64Int64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapInt64Int64Entry_DoNotUse*>(&_TestArenaMapLite_MapInt64Int64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapUint32Uint32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapUint32Uint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapUint32Uint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    0 > SuperType;
+  TestArenaMapLite_MapUint32Uint32Entry_DoNotUse();
+  explicit TestArenaMapLite_MapUint32Uint32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapUint32Uint32Entry_DoNotUse& other);
+  static const TestArenaMapLite_MapUint32Uint32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapUint32Uint32Entry_DoNotUse*>(&_TestArenaMapLite_MapUint32Uint32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapUint64Uint64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapUint64Uint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapUint64Uint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    0 > SuperType;
+  TestArenaMapLite_MapUint64Uint64Entry_DoNotUse();
+  explicit TestArenaMapLite_MapUint64Uint64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapUint64Uint64Entry_DoNotUse& other);
+  static const TestArenaMapLite_MapUint64Uint64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapUint64Uint64Entry_DoNotUse*>(&_TestArenaMapLite_MapUint64Uint64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapSint32Sint32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapSint32Sint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapSint32Sint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    0 > SuperType;
+  TestArenaMapLite_MapSint32Sint32Entry_DoNotUse();
+  explicit TestArenaMapLite_MapSint32Sint32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapSint32Sint32Entry_DoNotUse& other);
+  static const TestArenaMapLite_MapSint32Sint32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapSint32Sint32Entry_DoNotUse*>(&_TestArenaMapLite_MapSint32Sint32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapSint64Sint64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapSint64Sint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapSint64Sint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    0 > SuperType;
+  TestArenaMapLite_MapSint64Sint64Entry_DoNotUse();
+  explicit TestArenaMapLite_MapSint64Sint64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapSint64Sint64Entry_DoNotUse& other);
+  static const TestArenaMapLite_MapSint64Sint64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapSint64Sint64Entry_DoNotUse*>(&_TestArenaMapLite_MapSint64Sint64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    0 > SuperType;
+  TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse();
+  explicit TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse& other);
+  static const TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse*>(&_TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    0 > SuperType;
+  TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse();
+  explicit TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse& other);
+  static const TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse*>(&_TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    0 > SuperType;
+  TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse();
+  explicit TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse& other);
+  static const TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse*>(&_TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    0 > SuperType;
+  TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse();
+  explicit TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse& other);
+  static const TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse*>(&_TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapInt32FloatEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapInt32FloatEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, float,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapInt32FloatEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, float,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+    0 > SuperType;
+  TestArenaMapLite_MapInt32FloatEntry_DoNotUse();
+  explicit TestArenaMapLite_MapInt32FloatEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapInt32FloatEntry_DoNotUse& other);
+  static const TestArenaMapLite_MapInt32FloatEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapInt32FloatEntry_DoNotUse*>(&_TestArenaMapLite_MapInt32FloatEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapInt32DoubleEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapInt32DoubleEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, double,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapInt32DoubleEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, double,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE,
+    0 > SuperType;
+  TestArenaMapLite_MapInt32DoubleEntry_DoNotUse();
+  explicit TestArenaMapLite_MapInt32DoubleEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapInt32DoubleEntry_DoNotUse& other);
+  static const TestArenaMapLite_MapInt32DoubleEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapInt32DoubleEntry_DoNotUse*>(&_TestArenaMapLite_MapInt32DoubleEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapBoolBoolEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapBoolBoolEntry_DoNotUse, 
+    bool, bool,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapBoolBoolEntry_DoNotUse, 
+    bool, bool,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    0 > SuperType;
+  TestArenaMapLite_MapBoolBoolEntry_DoNotUse();
+  explicit TestArenaMapLite_MapBoolBoolEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapBoolBoolEntry_DoNotUse& other);
+  static const TestArenaMapLite_MapBoolBoolEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapBoolBoolEntry_DoNotUse*>(&_TestArenaMapLite_MapBoolBoolEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapStringStringEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapStringStringEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapStringStringEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > SuperType;
+  TestArenaMapLite_MapStringStringEntry_DoNotUse();
+  explicit TestArenaMapLite_MapStringStringEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapStringStringEntry_DoNotUse& other);
+  static const TestArenaMapLite_MapStringStringEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapStringStringEntry_DoNotUse*>(&_TestArenaMapLite_MapStringStringEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapInt32BytesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapInt32BytesEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapInt32BytesEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES,
+    0 > SuperType;
+  TestArenaMapLite_MapInt32BytesEntry_DoNotUse();
+  explicit TestArenaMapLite_MapInt32BytesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapInt32BytesEntry_DoNotUse& other);
+  static const TestArenaMapLite_MapInt32BytesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapInt32BytesEntry_DoNotUse*>(&_TestArenaMapLite_MapInt32BytesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapInt32EnumEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapInt32EnumEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapInt32EnumEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > SuperType;
+  TestArenaMapLite_MapInt32EnumEntry_DoNotUse();
+  explicit TestArenaMapLite_MapInt32EnumEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapInt32EnumEntry_DoNotUse& other);
+  static const TestArenaMapLite_MapInt32EnumEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapInt32EnumEntry_DoNotUse*>(&_TestArenaMapLite_MapInt32EnumEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse();
+  explicit TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse& other);
+  static const TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse*>(&_TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMapLite PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestArenaMapLite) */ {
+ public:
+  inline TestArenaMapLite() : TestArenaMapLite(nullptr) {};
+  virtual ~TestArenaMapLite();
+
+  TestArenaMapLite(const TestArenaMapLite& from);
+  TestArenaMapLite(TestArenaMapLite&& from) noexcept
+    : TestArenaMapLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestArenaMapLite& operator=(const TestArenaMapLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestArenaMapLite& operator=(TestArenaMapLite&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestArenaMapLite& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestArenaMapLite* internal_default_instance() {
+    return reinterpret_cast<const TestArenaMapLite*>(
+               &_TestArenaMapLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    36;
+
+  friend void swap(TestArenaMapLite& a, TestArenaMapLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestArenaMapLite* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestArenaMapLite* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestArenaMapLite* New() const final {
+    return CreateMaybeMessage<TestArenaMapLite>(nullptr);
+  }
+
+  TestArenaMapLite* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestArenaMapLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
+    final;
+  void CopyFrom(const TestArenaMapLite& from);
+  void MergeFrom(const TestArenaMapLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestArenaMapLite* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestArenaMapLite";
+  }
+  protected:
+  explicit TestArenaMapLite(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapInt32Int32FieldNumber = 1,
+    kMapInt64Int64FieldNumber = 2,
+    kMapUint32Uint32FieldNumber = 3,
+    kMapUint64Uint64FieldNumber = 4,
+    kMapSint32Sint32FieldNumber = 5,
+    kMapSint64Sint64FieldNumber = 6,
+    kMapFixed32Fixed32FieldNumber = 7,
+    kMapFixed64Fixed64FieldNumber = 8,
+    kMapSfixed32Sfixed32FieldNumber = 9,
+    kMapSfixed64Sfixed64FieldNumber = 10,
+    kMapInt32FloatFieldNumber = 11,
+    kMapInt32DoubleFieldNumber = 12,
+    kMapBoolBoolFieldNumber = 13,
+    kMapStringStringFieldNumber = 14,
+    kMapInt32BytesFieldNumber = 15,
+    kMapInt32EnumFieldNumber = 16,
+    kMapInt32ForeignMessageFieldNumber = 17,
+  };
+  // map<int32, int32> map_int32_int32 = 1;
+  int map_int32_int32_size() const;
+  private:
+  int _internal_map_int32_int32_size() const;
+  public:
+  void clear_map_int32_int32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_map_int32_int32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_map_int32_int32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map_int32_int32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map_int32_int32();
+
+  // map<int64, int64> map_int64_int64 = 2;
+  int map_int64_int64_size() const;
+  private:
+  int _internal_map_int64_int64_size() const;
+  public:
+  void clear_map_int64_int64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_map_int64_int64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_map_int64_int64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      map_int64_int64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_map_int64_int64();
+
+  // map<uint32, uint32> map_uint32_uint32 = 3;
+  int map_uint32_uint32_size() const;
+  private:
+  int _internal_map_uint32_uint32_size() const;
+  public:
+  void clear_map_uint32_uint32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_map_uint32_uint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_map_uint32_uint32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      map_uint32_uint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_map_uint32_uint32();
+
+  // map<uint64, uint64> map_uint64_uint64 = 4;
+  int map_uint64_uint64_size() const;
+  private:
+  int _internal_map_uint64_uint64_size() const;
+  public:
+  void clear_map_uint64_uint64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_map_uint64_uint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_map_uint64_uint64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      map_uint64_uint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_map_uint64_uint64();
+
+  // map<sint32, sint32> map_sint32_sint32 = 5;
+  int map_sint32_sint32_size() const;
+  private:
+  int _internal_map_sint32_sint32_size() const;
+  public:
+  void clear_map_sint32_sint32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_map_sint32_sint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_map_sint32_sint32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map_sint32_sint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map_sint32_sint32();
+
+  // map<sint64, sint64> map_sint64_sint64 = 6;
+  int map_sint64_sint64_size() const;
+  private:
+  int _internal_map_sint64_sint64_size() const;
+  public:
+  void clear_map_sint64_sint64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_map_sint64_sint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_map_sint64_sint64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      map_sint64_sint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_map_sint64_sint64();
+
+  // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+  int map_fixed32_fixed32_size() const;
+  private:
+  int _internal_map_fixed32_fixed32_size() const;
+  public:
+  void clear_map_fixed32_fixed32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_map_fixed32_fixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_map_fixed32_fixed32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      map_fixed32_fixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_map_fixed32_fixed32();
+
+  // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+  int map_fixed64_fixed64_size() const;
+  private:
+  int _internal_map_fixed64_fixed64_size() const;
+  public:
+  void clear_map_fixed64_fixed64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_map_fixed64_fixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_map_fixed64_fixed64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      map_fixed64_fixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_map_fixed64_fixed64();
+
+  // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+  int map_sfixed32_sfixed32_size() const;
+  private:
+  int _internal_map_sfixed32_sfixed32_size() const;
+  public:
+  void clear_map_sfixed32_sfixed32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_map_sfixed32_sfixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_map_sfixed32_sfixed32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map_sfixed32_sfixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map_sfixed32_sfixed32();
+
+  // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+  int map_sfixed64_sfixed64_size() const;
+  private:
+  int _internal_map_sfixed64_sfixed64_size() const;
+  public:
+  void clear_map_sfixed64_sfixed64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_map_sfixed64_sfixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_map_sfixed64_sfixed64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      map_sfixed64_sfixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_map_sfixed64_sfixed64();
+
+  // map<int32, float> map_int32_float = 11;
+  int map_int32_float_size() const;
+  private:
+  int _internal_map_int32_float_size() const;
+  public:
+  void clear_map_int32_float();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+      _internal_map_int32_float() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+      _internal_mutable_map_int32_float();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+      map_int32_float() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+      mutable_map_int32_float();
+
+  // map<int32, double> map_int32_double = 12;
+  int map_int32_double_size() const;
+  private:
+  int _internal_map_int32_double_size() const;
+  public:
+  void clear_map_int32_double();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+      _internal_map_int32_double() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+      _internal_mutable_map_int32_double();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+      map_int32_double() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+      mutable_map_int32_double();
+
+  // map<bool, bool> map_bool_bool = 13;
+  int map_bool_bool_size() const;
+  private:
+  int _internal_map_bool_bool_size() const;
+  public:
+  void clear_map_bool_bool();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+      _internal_map_bool_bool() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+      _internal_mutable_map_bool_bool();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+      map_bool_bool() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+      mutable_map_bool_bool();
+
+  // map<string, string> map_string_string = 14;
+  int map_string_string_size() const;
+  private:
+  int _internal_map_string_string_size() const;
+  public:
+  void clear_map_string_string();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_map_string_string() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_map_string_string();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      map_string_string() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_map_string_string();
+
+  // map<int32, bytes> map_int32_bytes = 15;
+  int map_int32_bytes_size() const;
+  private:
+  int _internal_map_int32_bytes_size() const;
+  public:
+  void clear_map_int32_bytes();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+      _internal_map_int32_bytes() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+      _internal_mutable_map_int32_bytes();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+      map_int32_bytes() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+      mutable_map_int32_bytes();
+
+  // map<int32, .protobuf_unittest.MapEnumLite> map_int32_enum = 16;
+  int map_int32_enum_size() const;
+  private:
+  int _internal_map_int32_enum_size() const;
+  public:
+  void clear_map_int32_enum();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >&
+      _internal_map_int32_enum() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >*
+      _internal_mutable_map_int32_enum();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >&
+      map_int32_enum() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >*
+      mutable_map_int32_enum();
+
+  // map<int32, .protobuf_unittest.ForeignMessageArenaLite> map_int32_foreign_message = 17;
+  int map_int32_foreign_message_size() const;
+  private:
+  int _internal_map_int32_foreign_message_size() const;
+  public:
+  void clear_map_int32_foreign_message();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite >&
+      _internal_map_int32_foreign_message() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite >*
+      _internal_mutable_map_int32_foreign_message();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite >&
+      map_int32_foreign_message() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite >*
+      mutable_map_int32_foreign_message();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestArenaMapLite)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapInt32Int32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      0 > map_int32_int32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapInt64Int64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+      0 > map_int64_int64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapUint32Uint32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+      0 > map_uint32_uint32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapUint64Uint64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+      0 > map_uint64_uint64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapSint32Sint32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+      0 > map_sint32_sint32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapSint64Sint64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+      0 > map_sint64_sint64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapFixed32Fixed32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+      0 > map_fixed32_fixed32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapFixed64Fixed64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+      0 > map_fixed64_fixed64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapSfixed32Sfixed32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+      0 > map_sfixed32_sfixed32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapSfixed64Sfixed64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+      0 > map_sfixed64_sfixed64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapInt32FloatEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, float,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+      0 > map_int32_float_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapInt32DoubleEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, double,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE,
+      0 > map_int32_double_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapBoolBoolEntry_DoNotUse,
+      bool, bool,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+      0 > map_bool_bool_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapStringStringEntry_DoNotUse,
+      std::string, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      0 > map_string_string_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapInt32BytesEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES,
+      0 > map_int32_bytes_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapInt32EnumEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+      0 > map_int32_enum_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestArenaMapLite_MapInt32ForeignMessageEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > map_int32_foreign_message_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestRequiredMessageMapLite_MapFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestRequiredMessageMapLite_MapFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestRequiredMessageMapLite_MapFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  TestRequiredMessageMapLite_MapFieldEntry_DoNotUse();
+  explicit TestRequiredMessageMapLite_MapFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestRequiredMessageMapLite_MapFieldEntry_DoNotUse& other);
+  static const TestRequiredMessageMapLite_MapFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestRequiredMessageMapLite_MapFieldEntry_DoNotUse*>(&_TestRequiredMessageMapLite_MapFieldEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestRequiredMessageMapLite PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestRequiredMessageMapLite) */ {
+ public:
+  inline TestRequiredMessageMapLite() : TestRequiredMessageMapLite(nullptr) {};
+  virtual ~TestRequiredMessageMapLite();
+
+  TestRequiredMessageMapLite(const TestRequiredMessageMapLite& from);
+  TestRequiredMessageMapLite(TestRequiredMessageMapLite&& from) noexcept
+    : TestRequiredMessageMapLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestRequiredMessageMapLite& operator=(const TestRequiredMessageMapLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestRequiredMessageMapLite& operator=(TestRequiredMessageMapLite&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestRequiredMessageMapLite& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestRequiredMessageMapLite* internal_default_instance() {
+    return reinterpret_cast<const TestRequiredMessageMapLite*>(
+               &_TestRequiredMessageMapLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    38;
+
+  friend void swap(TestRequiredMessageMapLite& a, TestRequiredMessageMapLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestRequiredMessageMapLite* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestRequiredMessageMapLite* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestRequiredMessageMapLite* New() const final {
+    return CreateMaybeMessage<TestRequiredMessageMapLite>(nullptr);
+  }
+
+  TestRequiredMessageMapLite* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestRequiredMessageMapLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
+    final;
+  void CopyFrom(const TestRequiredMessageMapLite& from);
+  void MergeFrom(const TestRequiredMessageMapLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestRequiredMessageMapLite* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestRequiredMessageMapLite";
+  }
+  protected:
+  explicit TestRequiredMessageMapLite(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapFieldFieldNumber = 1,
+  };
+  // map<int32, .protobuf_unittest.TestRequiredLite> map_field = 1;
+  int map_field_size() const;
+  private:
+  int _internal_map_field_size() const;
+  public:
+  void clear_map_field();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite >&
+      _internal_map_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite >*
+      _internal_mutable_map_field();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite >&
+      map_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite >*
+      mutable_map_field();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestRequiredMessageMapLite)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestRequiredMessageMapLite_MapFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > map_field_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapLite_KnownMapFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestEnumMapLite_KnownMapFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestEnumMapLite_KnownMapFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > SuperType;
+  TestEnumMapLite_KnownMapFieldEntry_DoNotUse();
+  explicit TestEnumMapLite_KnownMapFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestEnumMapLite_KnownMapFieldEntry_DoNotUse& other);
+  static const TestEnumMapLite_KnownMapFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestEnumMapLite_KnownMapFieldEntry_DoNotUse*>(&_TestEnumMapLite_KnownMapFieldEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestEnumMapLite_UnknownMapFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestEnumMapLite_UnknownMapFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestEnumMapLite_UnknownMapFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > SuperType;
+  TestEnumMapLite_UnknownMapFieldEntry_DoNotUse();
+  explicit TestEnumMapLite_UnknownMapFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestEnumMapLite_UnknownMapFieldEntry_DoNotUse& other);
+  static const TestEnumMapLite_UnknownMapFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestEnumMapLite_UnknownMapFieldEntry_DoNotUse*>(&_TestEnumMapLite_UnknownMapFieldEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestEnumMapLite PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestEnumMapLite) */ {
+ public:
+  inline TestEnumMapLite() : TestEnumMapLite(nullptr) {};
+  virtual ~TestEnumMapLite();
+
+  TestEnumMapLite(const TestEnumMapLite& from);
+  TestEnumMapLite(TestEnumMapLite&& from) noexcept
+    : TestEnumMapLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestEnumMapLite& operator=(const TestEnumMapLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestEnumMapLite& operator=(TestEnumMapLite&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestEnumMapLite& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestEnumMapLite* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapLite*>(
+               &_TestEnumMapLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    41;
+
+  friend void swap(TestEnumMapLite& a, TestEnumMapLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestEnumMapLite* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestEnumMapLite* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestEnumMapLite* New() const final {
+    return CreateMaybeMessage<TestEnumMapLite>(nullptr);
+  }
+
+  TestEnumMapLite* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestEnumMapLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
+    final;
+  void CopyFrom(const TestEnumMapLite& from);
+  void MergeFrom(const TestEnumMapLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestEnumMapLite* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestEnumMapLite";
+  }
+  protected:
+  explicit TestEnumMapLite(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKnownMapFieldFieldNumber = 101,
+    kUnknownMapFieldFieldNumber = 102,
+  };
+  // map<int32, .protobuf_unittest.Proto2MapEnumLite> known_map_field = 101;
+  int known_map_field_size() const;
+  private:
+  int _internal_known_map_field_size() const;
+  public:
+  void clear_known_map_field();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >&
+      _internal_known_map_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >*
+      _internal_mutable_known_map_field();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >&
+      known_map_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >*
+      mutable_known_map_field();
+
+  // map<int32, .protobuf_unittest.Proto2MapEnumLite> unknown_map_field = 102;
+  int unknown_map_field_size() const;
+  private:
+  int _internal_unknown_map_field_size() const;
+  public:
+  void clear_unknown_map_field();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >&
+      _internal_unknown_map_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >*
+      _internal_mutable_unknown_map_field();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >&
+      unknown_map_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >*
+      mutable_unknown_map_field();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestEnumMapLite)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestEnumMapLite_KnownMapFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+      0 > known_map_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestEnumMapLite_UnknownMapFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+      0 > unknown_map_field_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > SuperType;
+  TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse();
+  explicit TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse& other);
+  static const TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse*>(&_TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > SuperType;
+  TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse();
+  explicit TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse& other);
+  static const TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse*>(&_TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestEnumMapPlusExtraLite PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestEnumMapPlusExtraLite) */ {
+ public:
+  inline TestEnumMapPlusExtraLite() : TestEnumMapPlusExtraLite(nullptr) {};
+  virtual ~TestEnumMapPlusExtraLite();
+
+  TestEnumMapPlusExtraLite(const TestEnumMapPlusExtraLite& from);
+  TestEnumMapPlusExtraLite(TestEnumMapPlusExtraLite&& from) noexcept
+    : TestEnumMapPlusExtraLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestEnumMapPlusExtraLite& operator=(const TestEnumMapPlusExtraLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestEnumMapPlusExtraLite& operator=(TestEnumMapPlusExtraLite&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestEnumMapPlusExtraLite& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestEnumMapPlusExtraLite* internal_default_instance() {
+    return reinterpret_cast<const TestEnumMapPlusExtraLite*>(
+               &_TestEnumMapPlusExtraLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    44;
+
+  friend void swap(TestEnumMapPlusExtraLite& a, TestEnumMapPlusExtraLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestEnumMapPlusExtraLite* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestEnumMapPlusExtraLite* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestEnumMapPlusExtraLite* New() const final {
+    return CreateMaybeMessage<TestEnumMapPlusExtraLite>(nullptr);
+  }
+
+  TestEnumMapPlusExtraLite* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestEnumMapPlusExtraLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
+    final;
+  void CopyFrom(const TestEnumMapPlusExtraLite& from);
+  void MergeFrom(const TestEnumMapPlusExtraLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestEnumMapPlusExtraLite* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestEnumMapPlusExtraLite";
+  }
+  protected:
+  explicit TestEnumMapPlusExtraLite(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKnownMapFieldFieldNumber = 101,
+    kUnknownMapFieldFieldNumber = 102,
+  };
+  // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtraLite> known_map_field = 101;
+  int known_map_field_size() const;
+  private:
+  int _internal_known_map_field_size() const;
+  public:
+  void clear_known_map_field();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >&
+      _internal_known_map_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >*
+      _internal_mutable_known_map_field();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >&
+      known_map_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >*
+      mutable_known_map_field();
+
+  // map<int32, .protobuf_unittest.Proto2MapEnumPlusExtraLite> unknown_map_field = 102;
+  int unknown_map_field_size() const;
+  private:
+  int _internal_unknown_map_field_size() const;
+  public:
+  void clear_unknown_map_field();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >&
+      _internal_unknown_map_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >*
+      _internal_mutable_unknown_map_field();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >&
+      unknown_map_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >*
+      mutable_unknown_map_field();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestEnumMapPlusExtraLite)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestEnumMapPlusExtraLite_KnownMapFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+      0 > known_map_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestEnumMapPlusExtraLite_UnknownMapFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+      0 > unknown_map_field_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMessageMapLite_MapInt32MessageEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMessageMapLite_MapInt32MessageEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntryLite<TestMessageMapLite_MapInt32MessageEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  TestMessageMapLite_MapInt32MessageEntry_DoNotUse();
+  explicit TestMessageMapLite_MapInt32MessageEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMessageMapLite_MapInt32MessageEntry_DoNotUse& other);
+  static const TestMessageMapLite_MapInt32MessageEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMessageMapLite_MapInt32MessageEntry_DoNotUse*>(&_TestMessageMapLite_MapInt32MessageEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+};
+
+// -------------------------------------------------------------------
+
+class TestMessageMapLite PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestMessageMapLite) */ {
+ public:
+  inline TestMessageMapLite() : TestMessageMapLite(nullptr) {};
+  virtual ~TestMessageMapLite();
+
+  TestMessageMapLite(const TestMessageMapLite& from);
+  TestMessageMapLite(TestMessageMapLite&& from) noexcept
+    : TestMessageMapLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestMessageMapLite& operator=(const TestMessageMapLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestMessageMapLite& operator=(TestMessageMapLite&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestMessageMapLite& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestMessageMapLite* internal_default_instance() {
+    return reinterpret_cast<const TestMessageMapLite*>(
+               &_TestMessageMapLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    46;
+
+  friend void swap(TestMessageMapLite& a, TestMessageMapLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestMessageMapLite* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestMessageMapLite* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestMessageMapLite* New() const final {
+    return CreateMaybeMessage<TestMessageMapLite>(nullptr);
+  }
+
+  TestMessageMapLite* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestMessageMapLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
+    final;
+  void CopyFrom(const TestMessageMapLite& from);
+  void MergeFrom(const TestMessageMapLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestMessageMapLite* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestMessageMapLite";
+  }
+  protected:
+  explicit TestMessageMapLite(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapInt32MessageFieldNumber = 1,
+  };
+  // map<int32, .protobuf_unittest.TestAllTypesLite> map_int32_message = 1;
+  int map_int32_message_size() const;
+  private:
+  int _internal_map_int32_message_size() const;
+  public:
+  void clear_map_int32_message();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite >&
+      _internal_map_int32_message() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite >*
+      _internal_mutable_map_int32_message();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite >&
+      map_int32_message() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite >*
+      mutable_map_int32_message();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMessageMapLite)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapFieldLite<
+      TestMessageMapLite_MapInt32MessageEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > map_int32_message_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestRequiredLite PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestRequiredLite) */ {
+ public:
+  inline TestRequiredLite() : TestRequiredLite(nullptr) {};
+  virtual ~TestRequiredLite();
+
+  TestRequiredLite(const TestRequiredLite& from);
+  TestRequiredLite(TestRequiredLite&& from) noexcept
+    : TestRequiredLite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestRequiredLite& operator=(const TestRequiredLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestRequiredLite& operator=(TestRequiredLite&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestRequiredLite& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestRequiredLite* internal_default_instance() {
+    return reinterpret_cast<const TestRequiredLite*>(
+               &_TestRequiredLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    47;
+
+  friend void swap(TestRequiredLite& a, TestRequiredLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestRequiredLite* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestRequiredLite* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestRequiredLite* New() const final {
+    return CreateMaybeMessage<TestRequiredLite>(nullptr);
+  }
+
+  TestRequiredLite* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestRequiredLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
+    final;
+  void CopyFrom(const TestRequiredLite& from);
+  void MergeFrom(const TestRequiredLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestRequiredLite* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestRequiredLite";
+  }
+  protected:
+  explicit TestRequiredLite(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAFieldNumber = 1,
+    kBFieldNumber = 2,
+    kCFieldNumber = 3,
+  };
+  // required int32 a = 1;
+  bool has_a() const;
+  private:
+  bool _internal_has_a() const;
+  public:
+  void clear_a();
+  ::PROTOBUF_NAMESPACE_ID::int32 a() const;
+  void set_a(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_a() const;
+  void _internal_set_a(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // required int32 b = 2;
+  bool has_b() const;
+  private:
+  bool _internal_has_b() const;
+  public:
+  void clear_b();
+  ::PROTOBUF_NAMESPACE_ID::int32 b() const;
+  void set_b(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_b() const;
+  void _internal_set_b(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // required int32 c = 3;
+  bool has_c() const;
+  private:
+  bool _internal_has_c() const;
+  public:
+  void clear_c();
+  ::PROTOBUF_NAMESPACE_ID::int32 c() const;
+  void set_c(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_c() const;
+  void _internal_set_c(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestRequiredLite)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::int32 a_;
+  ::PROTOBUF_NAMESPACE_ID::int32 b_;
+  ::PROTOBUF_NAMESPACE_ID::int32 c_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ForeignMessageArenaLite PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.ForeignMessageArenaLite) */ {
+ public:
+  inline ForeignMessageArenaLite() : ForeignMessageArenaLite(nullptr) {};
+  virtual ~ForeignMessageArenaLite();
+
+  ForeignMessageArenaLite(const ForeignMessageArenaLite& from);
+  ForeignMessageArenaLite(ForeignMessageArenaLite&& from) noexcept
+    : ForeignMessageArenaLite() {
+    *this = ::std::move(from);
+  }
+
+  inline ForeignMessageArenaLite& operator=(const ForeignMessageArenaLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ForeignMessageArenaLite& operator=(ForeignMessageArenaLite&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const ForeignMessageArenaLite& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const ForeignMessageArenaLite* internal_default_instance() {
+    return reinterpret_cast<const ForeignMessageArenaLite*>(
+               &_ForeignMessageArenaLite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    48;
+
+  friend void swap(ForeignMessageArenaLite& a, ForeignMessageArenaLite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ForeignMessageArenaLite* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ForeignMessageArenaLite* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ForeignMessageArenaLite* New() const final {
+    return CreateMaybeMessage<ForeignMessageArenaLite>(nullptr);
+  }
+
+  ForeignMessageArenaLite* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ForeignMessageArenaLite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
+    final;
+  void CopyFrom(const ForeignMessageArenaLite& from);
+  void MergeFrom(const ForeignMessageArenaLite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(ForeignMessageArenaLite* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.ForeignMessageArenaLite";
+  }
+  protected:
+  explicit ForeignMessageArenaLite(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCFieldNumber = 1,
+  };
+  // optional int32 c = 1;
+  bool has_c() const;
+  private:
+  bool _internal_has_c() const;
+  public:
+  void clear_c();
+  ::PROTOBUF_NAMESPACE_ID::int32 c() const;
+  void set_c(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_c() const;
+  void _internal_set_c(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.ForeignMessageArenaLite)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::int32 c_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5flite_5funittest_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestMapLite
+
+// map<int32, int32> map_int32_int32 = 1;
+inline int TestMapLite::_internal_map_int32_int32_size() const {
+  return map_int32_int32_.size();
+}
+inline int TestMapLite::map_int32_int32_size() const {
+  return _internal_map_int32_int32_size();
+}
+inline void TestMapLite::clear_map_int32_int32() {
+  map_int32_int32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestMapLite::_internal_map_int32_int32() const {
+  return map_int32_int32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestMapLite::map_int32_int32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_int32_int32)
+  return _internal_map_int32_int32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestMapLite::_internal_mutable_map_int32_int32() {
+  return map_int32_int32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestMapLite::mutable_map_int32_int32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_int32_int32)
+  return _internal_mutable_map_int32_int32();
+}
+
+// map<int64, int64> map_int64_int64 = 2;
+inline int TestMapLite::_internal_map_int64_int64_size() const {
+  return map_int64_int64_.size();
+}
+inline int TestMapLite::map_int64_int64_size() const {
+  return _internal_map_int64_int64_size();
+}
+inline void TestMapLite::clear_map_int64_int64() {
+  map_int64_int64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestMapLite::_internal_map_int64_int64() const {
+  return map_int64_int64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestMapLite::map_int64_int64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_int64_int64)
+  return _internal_map_int64_int64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestMapLite::_internal_mutable_map_int64_int64() {
+  return map_int64_int64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestMapLite::mutable_map_int64_int64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_int64_int64)
+  return _internal_mutable_map_int64_int64();
+}
+
+// map<uint32, uint32> map_uint32_uint32 = 3;
+inline int TestMapLite::_internal_map_uint32_uint32_size() const {
+  return map_uint32_uint32_.size();
+}
+inline int TestMapLite::map_uint32_uint32_size() const {
+  return _internal_map_uint32_uint32_size();
+}
+inline void TestMapLite::clear_map_uint32_uint32() {
+  map_uint32_uint32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestMapLite::_internal_map_uint32_uint32() const {
+  return map_uint32_uint32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestMapLite::map_uint32_uint32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_uint32_uint32)
+  return _internal_map_uint32_uint32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestMapLite::_internal_mutable_map_uint32_uint32() {
+  return map_uint32_uint32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestMapLite::mutable_map_uint32_uint32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_uint32_uint32)
+  return _internal_mutable_map_uint32_uint32();
+}
+
+// map<uint64, uint64> map_uint64_uint64 = 4;
+inline int TestMapLite::_internal_map_uint64_uint64_size() const {
+  return map_uint64_uint64_.size();
+}
+inline int TestMapLite::map_uint64_uint64_size() const {
+  return _internal_map_uint64_uint64_size();
+}
+inline void TestMapLite::clear_map_uint64_uint64() {
+  map_uint64_uint64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestMapLite::_internal_map_uint64_uint64() const {
+  return map_uint64_uint64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestMapLite::map_uint64_uint64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_uint64_uint64)
+  return _internal_map_uint64_uint64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestMapLite::_internal_mutable_map_uint64_uint64() {
+  return map_uint64_uint64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestMapLite::mutable_map_uint64_uint64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_uint64_uint64)
+  return _internal_mutable_map_uint64_uint64();
+}
+
+// map<sint32, sint32> map_sint32_sint32 = 5;
+inline int TestMapLite::_internal_map_sint32_sint32_size() const {
+  return map_sint32_sint32_.size();
+}
+inline int TestMapLite::map_sint32_sint32_size() const {
+  return _internal_map_sint32_sint32_size();
+}
+inline void TestMapLite::clear_map_sint32_sint32() {
+  map_sint32_sint32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestMapLite::_internal_map_sint32_sint32() const {
+  return map_sint32_sint32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestMapLite::map_sint32_sint32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_sint32_sint32)
+  return _internal_map_sint32_sint32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestMapLite::_internal_mutable_map_sint32_sint32() {
+  return map_sint32_sint32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestMapLite::mutable_map_sint32_sint32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_sint32_sint32)
+  return _internal_mutable_map_sint32_sint32();
+}
+
+// map<sint64, sint64> map_sint64_sint64 = 6;
+inline int TestMapLite::_internal_map_sint64_sint64_size() const {
+  return map_sint64_sint64_.size();
+}
+inline int TestMapLite::map_sint64_sint64_size() const {
+  return _internal_map_sint64_sint64_size();
+}
+inline void TestMapLite::clear_map_sint64_sint64() {
+  map_sint64_sint64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestMapLite::_internal_map_sint64_sint64() const {
+  return map_sint64_sint64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestMapLite::map_sint64_sint64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_sint64_sint64)
+  return _internal_map_sint64_sint64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestMapLite::_internal_mutable_map_sint64_sint64() {
+  return map_sint64_sint64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestMapLite::mutable_map_sint64_sint64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_sint64_sint64)
+  return _internal_mutable_map_sint64_sint64();
+}
+
+// map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+inline int TestMapLite::_internal_map_fixed32_fixed32_size() const {
+  return map_fixed32_fixed32_.size();
+}
+inline int TestMapLite::map_fixed32_fixed32_size() const {
+  return _internal_map_fixed32_fixed32_size();
+}
+inline void TestMapLite::clear_map_fixed32_fixed32() {
+  map_fixed32_fixed32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestMapLite::_internal_map_fixed32_fixed32() const {
+  return map_fixed32_fixed32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestMapLite::map_fixed32_fixed32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_fixed32_fixed32)
+  return _internal_map_fixed32_fixed32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestMapLite::_internal_mutable_map_fixed32_fixed32() {
+  return map_fixed32_fixed32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestMapLite::mutable_map_fixed32_fixed32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_fixed32_fixed32)
+  return _internal_mutable_map_fixed32_fixed32();
+}
+
+// map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+inline int TestMapLite::_internal_map_fixed64_fixed64_size() const {
+  return map_fixed64_fixed64_.size();
+}
+inline int TestMapLite::map_fixed64_fixed64_size() const {
+  return _internal_map_fixed64_fixed64_size();
+}
+inline void TestMapLite::clear_map_fixed64_fixed64() {
+  map_fixed64_fixed64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestMapLite::_internal_map_fixed64_fixed64() const {
+  return map_fixed64_fixed64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestMapLite::map_fixed64_fixed64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_fixed64_fixed64)
+  return _internal_map_fixed64_fixed64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestMapLite::_internal_mutable_map_fixed64_fixed64() {
+  return map_fixed64_fixed64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestMapLite::mutable_map_fixed64_fixed64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_fixed64_fixed64)
+  return _internal_mutable_map_fixed64_fixed64();
+}
+
+// map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+inline int TestMapLite::_internal_map_sfixed32_sfixed32_size() const {
+  return map_sfixed32_sfixed32_.size();
+}
+inline int TestMapLite::map_sfixed32_sfixed32_size() const {
+  return _internal_map_sfixed32_sfixed32_size();
+}
+inline void TestMapLite::clear_map_sfixed32_sfixed32() {
+  map_sfixed32_sfixed32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestMapLite::_internal_map_sfixed32_sfixed32() const {
+  return map_sfixed32_sfixed32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestMapLite::map_sfixed32_sfixed32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_sfixed32_sfixed32)
+  return _internal_map_sfixed32_sfixed32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestMapLite::_internal_mutable_map_sfixed32_sfixed32() {
+  return map_sfixed32_sfixed32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestMapLite::mutable_map_sfixed32_sfixed32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_sfixed32_sfixed32)
+  return _internal_mutable_map_sfixed32_sfixed32();
+}
+
+// map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+inline int TestMapLite::_internal_map_sfixed64_sfixed64_size() const {
+  return map_sfixed64_sfixed64_.size();
+}
+inline int TestMapLite::map_sfixed64_sfixed64_size() const {
+  return _internal_map_sfixed64_sfixed64_size();
+}
+inline void TestMapLite::clear_map_sfixed64_sfixed64() {
+  map_sfixed64_sfixed64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestMapLite::_internal_map_sfixed64_sfixed64() const {
+  return map_sfixed64_sfixed64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestMapLite::map_sfixed64_sfixed64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_sfixed64_sfixed64)
+  return _internal_map_sfixed64_sfixed64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestMapLite::_internal_mutable_map_sfixed64_sfixed64() {
+  return map_sfixed64_sfixed64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestMapLite::mutable_map_sfixed64_sfixed64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_sfixed64_sfixed64)
+  return _internal_mutable_map_sfixed64_sfixed64();
+}
+
+// map<int32, float> map_int32_float = 11;
+inline int TestMapLite::_internal_map_int32_float_size() const {
+  return map_int32_float_.size();
+}
+inline int TestMapLite::map_int32_float_size() const {
+  return _internal_map_int32_float_size();
+}
+inline void TestMapLite::clear_map_int32_float() {
+  map_int32_float_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+TestMapLite::_internal_map_int32_float() const {
+  return map_int32_float_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+TestMapLite::map_int32_float() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_int32_float)
+  return _internal_map_int32_float();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+TestMapLite::_internal_mutable_map_int32_float() {
+  return map_int32_float_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+TestMapLite::mutable_map_int32_float() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_int32_float)
+  return _internal_mutable_map_int32_float();
+}
+
+// map<int32, double> map_int32_double = 12;
+inline int TestMapLite::_internal_map_int32_double_size() const {
+  return map_int32_double_.size();
+}
+inline int TestMapLite::map_int32_double_size() const {
+  return _internal_map_int32_double_size();
+}
+inline void TestMapLite::clear_map_int32_double() {
+  map_int32_double_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+TestMapLite::_internal_map_int32_double() const {
+  return map_int32_double_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+TestMapLite::map_int32_double() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_int32_double)
+  return _internal_map_int32_double();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+TestMapLite::_internal_mutable_map_int32_double() {
+  return map_int32_double_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+TestMapLite::mutable_map_int32_double() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_int32_double)
+  return _internal_mutable_map_int32_double();
+}
+
+// map<bool, bool> map_bool_bool = 13;
+inline int TestMapLite::_internal_map_bool_bool_size() const {
+  return map_bool_bool_.size();
+}
+inline int TestMapLite::map_bool_bool_size() const {
+  return _internal_map_bool_bool_size();
+}
+inline void TestMapLite::clear_map_bool_bool() {
+  map_bool_bool_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+TestMapLite::_internal_map_bool_bool() const {
+  return map_bool_bool_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+TestMapLite::map_bool_bool() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_bool_bool)
+  return _internal_map_bool_bool();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+TestMapLite::_internal_mutable_map_bool_bool() {
+  return map_bool_bool_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+TestMapLite::mutable_map_bool_bool() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_bool_bool)
+  return _internal_mutable_map_bool_bool();
+}
+
+// map<string, string> map_string_string = 14;
+inline int TestMapLite::_internal_map_string_string_size() const {
+  return map_string_string_.size();
+}
+inline int TestMapLite::map_string_string_size() const {
+  return _internal_map_string_string_size();
+}
+inline void TestMapLite::clear_map_string_string() {
+  map_string_string_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+TestMapLite::_internal_map_string_string() const {
+  return map_string_string_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+TestMapLite::map_string_string() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_string_string)
+  return _internal_map_string_string();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+TestMapLite::_internal_mutable_map_string_string() {
+  return map_string_string_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+TestMapLite::mutable_map_string_string() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_string_string)
+  return _internal_mutable_map_string_string();
+}
+
+// map<int32, bytes> map_int32_bytes = 15;
+inline int TestMapLite::_internal_map_int32_bytes_size() const {
+  return map_int32_bytes_.size();
+}
+inline int TestMapLite::map_int32_bytes_size() const {
+  return _internal_map_int32_bytes_size();
+}
+inline void TestMapLite::clear_map_int32_bytes() {
+  map_int32_bytes_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+TestMapLite::_internal_map_int32_bytes() const {
+  return map_int32_bytes_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+TestMapLite::map_int32_bytes() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_int32_bytes)
+  return _internal_map_int32_bytes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+TestMapLite::_internal_mutable_map_int32_bytes() {
+  return map_int32_bytes_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+TestMapLite::mutable_map_int32_bytes() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_int32_bytes)
+  return _internal_mutable_map_int32_bytes();
+}
+
+// map<int32, .protobuf_unittest.MapEnumLite> map_int32_enum = 16;
+inline int TestMapLite::_internal_map_int32_enum_size() const {
+  return map_int32_enum_.size();
+}
+inline int TestMapLite::map_int32_enum_size() const {
+  return _internal_map_int32_enum_size();
+}
+inline void TestMapLite::clear_map_int32_enum() {
+  map_int32_enum_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >&
+TestMapLite::_internal_map_int32_enum() const {
+  return map_int32_enum_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >&
+TestMapLite::map_int32_enum() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_int32_enum)
+  return _internal_map_int32_enum();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >*
+TestMapLite::_internal_mutable_map_int32_enum() {
+  return map_int32_enum_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >*
+TestMapLite::mutable_map_int32_enum() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_int32_enum)
+  return _internal_mutable_map_int32_enum();
+}
+
+// map<int32, .protobuf_unittest.ForeignMessageLite> map_int32_foreign_message = 17;
+inline int TestMapLite::_internal_map_int32_foreign_message_size() const {
+  return map_int32_foreign_message_.size();
+}
+inline int TestMapLite::map_int32_foreign_message_size() const {
+  return _internal_map_int32_foreign_message_size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite >&
+TestMapLite::_internal_map_int32_foreign_message() const {
+  return map_int32_foreign_message_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite >&
+TestMapLite::map_int32_foreign_message() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.map_int32_foreign_message)
+  return _internal_map_int32_foreign_message();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite >*
+TestMapLite::_internal_mutable_map_int32_foreign_message() {
+  return map_int32_foreign_message_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageLite >*
+TestMapLite::mutable_map_int32_foreign_message() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.map_int32_foreign_message)
+  return _internal_mutable_map_int32_foreign_message();
+}
+
+// map<int32, int32> teboring = 18;
+inline int TestMapLite::_internal_teboring_size() const {
+  return teboring_.size();
+}
+inline int TestMapLite::teboring_size() const {
+  return _internal_teboring_size();
+}
+inline void TestMapLite::clear_teboring() {
+  teboring_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestMapLite::_internal_teboring() const {
+  return teboring_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestMapLite::teboring() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMapLite.teboring)
+  return _internal_teboring();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestMapLite::_internal_mutable_teboring() {
+  return teboring_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestMapLite::mutable_teboring() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMapLite.teboring)
+  return _internal_mutable_teboring();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestArenaMapLite
+
+// map<int32, int32> map_int32_int32 = 1;
+inline int TestArenaMapLite::_internal_map_int32_int32_size() const {
+  return map_int32_int32_.size();
+}
+inline int TestArenaMapLite::map_int32_int32_size() const {
+  return _internal_map_int32_int32_size();
+}
+inline void TestArenaMapLite::clear_map_int32_int32() {
+  map_int32_int32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestArenaMapLite::_internal_map_int32_int32() const {
+  return map_int32_int32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestArenaMapLite::map_int32_int32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_int32_int32)
+  return _internal_map_int32_int32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestArenaMapLite::_internal_mutable_map_int32_int32() {
+  return map_int32_int32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestArenaMapLite::mutable_map_int32_int32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_int32_int32)
+  return _internal_mutable_map_int32_int32();
+}
+
+// map<int64, int64> map_int64_int64 = 2;
+inline int TestArenaMapLite::_internal_map_int64_int64_size() const {
+  return map_int64_int64_.size();
+}
+inline int TestArenaMapLite::map_int64_int64_size() const {
+  return _internal_map_int64_int64_size();
+}
+inline void TestArenaMapLite::clear_map_int64_int64() {
+  map_int64_int64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestArenaMapLite::_internal_map_int64_int64() const {
+  return map_int64_int64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestArenaMapLite::map_int64_int64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_int64_int64)
+  return _internal_map_int64_int64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestArenaMapLite::_internal_mutable_map_int64_int64() {
+  return map_int64_int64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestArenaMapLite::mutable_map_int64_int64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_int64_int64)
+  return _internal_mutable_map_int64_int64();
+}
+
+// map<uint32, uint32> map_uint32_uint32 = 3;
+inline int TestArenaMapLite::_internal_map_uint32_uint32_size() const {
+  return map_uint32_uint32_.size();
+}
+inline int TestArenaMapLite::map_uint32_uint32_size() const {
+  return _internal_map_uint32_uint32_size();
+}
+inline void TestArenaMapLite::clear_map_uint32_uint32() {
+  map_uint32_uint32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestArenaMapLite::_internal_map_uint32_uint32() const {
+  return map_uint32_uint32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestArenaMapLite::map_uint32_uint32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_uint32_uint32)
+  return _internal_map_uint32_uint32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestArenaMapLite::_internal_mutable_map_uint32_uint32() {
+  return map_uint32_uint32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestArenaMapLite::mutable_map_uint32_uint32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_uint32_uint32)
+  return _internal_mutable_map_uint32_uint32();
+}
+
+// map<uint64, uint64> map_uint64_uint64 = 4;
+inline int TestArenaMapLite::_internal_map_uint64_uint64_size() const {
+  return map_uint64_uint64_.size();
+}
+inline int TestArenaMapLite::map_uint64_uint64_size() const {
+  return _internal_map_uint64_uint64_size();
+}
+inline void TestArenaMapLite::clear_map_uint64_uint64() {
+  map_uint64_uint64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestArenaMapLite::_internal_map_uint64_uint64() const {
+  return map_uint64_uint64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestArenaMapLite::map_uint64_uint64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_uint64_uint64)
+  return _internal_map_uint64_uint64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestArenaMapLite::_internal_mutable_map_uint64_uint64() {
+  return map_uint64_uint64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestArenaMapLite::mutable_map_uint64_uint64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_uint64_uint64)
+  return _internal_mutable_map_uint64_uint64();
+}
+
+// map<sint32, sint32> map_sint32_sint32 = 5;
+inline int TestArenaMapLite::_internal_map_sint32_sint32_size() const {
+  return map_sint32_sint32_.size();
+}
+inline int TestArenaMapLite::map_sint32_sint32_size() const {
+  return _internal_map_sint32_sint32_size();
+}
+inline void TestArenaMapLite::clear_map_sint32_sint32() {
+  map_sint32_sint32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestArenaMapLite::_internal_map_sint32_sint32() const {
+  return map_sint32_sint32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestArenaMapLite::map_sint32_sint32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_sint32_sint32)
+  return _internal_map_sint32_sint32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestArenaMapLite::_internal_mutable_map_sint32_sint32() {
+  return map_sint32_sint32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestArenaMapLite::mutable_map_sint32_sint32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_sint32_sint32)
+  return _internal_mutable_map_sint32_sint32();
+}
+
+// map<sint64, sint64> map_sint64_sint64 = 6;
+inline int TestArenaMapLite::_internal_map_sint64_sint64_size() const {
+  return map_sint64_sint64_.size();
+}
+inline int TestArenaMapLite::map_sint64_sint64_size() const {
+  return _internal_map_sint64_sint64_size();
+}
+inline void TestArenaMapLite::clear_map_sint64_sint64() {
+  map_sint64_sint64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestArenaMapLite::_internal_map_sint64_sint64() const {
+  return map_sint64_sint64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestArenaMapLite::map_sint64_sint64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_sint64_sint64)
+  return _internal_map_sint64_sint64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestArenaMapLite::_internal_mutable_map_sint64_sint64() {
+  return map_sint64_sint64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestArenaMapLite::mutable_map_sint64_sint64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_sint64_sint64)
+  return _internal_mutable_map_sint64_sint64();
+}
+
+// map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+inline int TestArenaMapLite::_internal_map_fixed32_fixed32_size() const {
+  return map_fixed32_fixed32_.size();
+}
+inline int TestArenaMapLite::map_fixed32_fixed32_size() const {
+  return _internal_map_fixed32_fixed32_size();
+}
+inline void TestArenaMapLite::clear_map_fixed32_fixed32() {
+  map_fixed32_fixed32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestArenaMapLite::_internal_map_fixed32_fixed32() const {
+  return map_fixed32_fixed32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestArenaMapLite::map_fixed32_fixed32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_fixed32_fixed32)
+  return _internal_map_fixed32_fixed32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestArenaMapLite::_internal_mutable_map_fixed32_fixed32() {
+  return map_fixed32_fixed32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestArenaMapLite::mutable_map_fixed32_fixed32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_fixed32_fixed32)
+  return _internal_mutable_map_fixed32_fixed32();
+}
+
+// map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+inline int TestArenaMapLite::_internal_map_fixed64_fixed64_size() const {
+  return map_fixed64_fixed64_.size();
+}
+inline int TestArenaMapLite::map_fixed64_fixed64_size() const {
+  return _internal_map_fixed64_fixed64_size();
+}
+inline void TestArenaMapLite::clear_map_fixed64_fixed64() {
+  map_fixed64_fixed64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestArenaMapLite::_internal_map_fixed64_fixed64() const {
+  return map_fixed64_fixed64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestArenaMapLite::map_fixed64_fixed64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_fixed64_fixed64)
+  return _internal_map_fixed64_fixed64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestArenaMapLite::_internal_mutable_map_fixed64_fixed64() {
+  return map_fixed64_fixed64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestArenaMapLite::mutable_map_fixed64_fixed64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_fixed64_fixed64)
+  return _internal_mutable_map_fixed64_fixed64();
+}
+
+// map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+inline int TestArenaMapLite::_internal_map_sfixed32_sfixed32_size() const {
+  return map_sfixed32_sfixed32_.size();
+}
+inline int TestArenaMapLite::map_sfixed32_sfixed32_size() const {
+  return _internal_map_sfixed32_sfixed32_size();
+}
+inline void TestArenaMapLite::clear_map_sfixed32_sfixed32() {
+  map_sfixed32_sfixed32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestArenaMapLite::_internal_map_sfixed32_sfixed32() const {
+  return map_sfixed32_sfixed32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestArenaMapLite::map_sfixed32_sfixed32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_sfixed32_sfixed32)
+  return _internal_map_sfixed32_sfixed32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestArenaMapLite::_internal_mutable_map_sfixed32_sfixed32() {
+  return map_sfixed32_sfixed32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestArenaMapLite::mutable_map_sfixed32_sfixed32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_sfixed32_sfixed32)
+  return _internal_mutable_map_sfixed32_sfixed32();
+}
+
+// map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+inline int TestArenaMapLite::_internal_map_sfixed64_sfixed64_size() const {
+  return map_sfixed64_sfixed64_.size();
+}
+inline int TestArenaMapLite::map_sfixed64_sfixed64_size() const {
+  return _internal_map_sfixed64_sfixed64_size();
+}
+inline void TestArenaMapLite::clear_map_sfixed64_sfixed64() {
+  map_sfixed64_sfixed64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestArenaMapLite::_internal_map_sfixed64_sfixed64() const {
+  return map_sfixed64_sfixed64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestArenaMapLite::map_sfixed64_sfixed64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_sfixed64_sfixed64)
+  return _internal_map_sfixed64_sfixed64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestArenaMapLite::_internal_mutable_map_sfixed64_sfixed64() {
+  return map_sfixed64_sfixed64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestArenaMapLite::mutable_map_sfixed64_sfixed64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_sfixed64_sfixed64)
+  return _internal_mutable_map_sfixed64_sfixed64();
+}
+
+// map<int32, float> map_int32_float = 11;
+inline int TestArenaMapLite::_internal_map_int32_float_size() const {
+  return map_int32_float_.size();
+}
+inline int TestArenaMapLite::map_int32_float_size() const {
+  return _internal_map_int32_float_size();
+}
+inline void TestArenaMapLite::clear_map_int32_float() {
+  map_int32_float_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+TestArenaMapLite::_internal_map_int32_float() const {
+  return map_int32_float_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+TestArenaMapLite::map_int32_float() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_int32_float)
+  return _internal_map_int32_float();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+TestArenaMapLite::_internal_mutable_map_int32_float() {
+  return map_int32_float_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+TestArenaMapLite::mutable_map_int32_float() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_int32_float)
+  return _internal_mutable_map_int32_float();
+}
+
+// map<int32, double> map_int32_double = 12;
+inline int TestArenaMapLite::_internal_map_int32_double_size() const {
+  return map_int32_double_.size();
+}
+inline int TestArenaMapLite::map_int32_double_size() const {
+  return _internal_map_int32_double_size();
+}
+inline void TestArenaMapLite::clear_map_int32_double() {
+  map_int32_double_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+TestArenaMapLite::_internal_map_int32_double() const {
+  return map_int32_double_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+TestArenaMapLite::map_int32_double() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_int32_double)
+  return _internal_map_int32_double();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+TestArenaMapLite::_internal_mutable_map_int32_double() {
+  return map_int32_double_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+TestArenaMapLite::mutable_map_int32_double() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_int32_double)
+  return _internal_mutable_map_int32_double();
+}
+
+// map<bool, bool> map_bool_bool = 13;
+inline int TestArenaMapLite::_internal_map_bool_bool_size() const {
+  return map_bool_bool_.size();
+}
+inline int TestArenaMapLite::map_bool_bool_size() const {
+  return _internal_map_bool_bool_size();
+}
+inline void TestArenaMapLite::clear_map_bool_bool() {
+  map_bool_bool_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+TestArenaMapLite::_internal_map_bool_bool() const {
+  return map_bool_bool_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+TestArenaMapLite::map_bool_bool() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_bool_bool)
+  return _internal_map_bool_bool();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+TestArenaMapLite::_internal_mutable_map_bool_bool() {
+  return map_bool_bool_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+TestArenaMapLite::mutable_map_bool_bool() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_bool_bool)
+  return _internal_mutable_map_bool_bool();
+}
+
+// map<string, string> map_string_string = 14;
+inline int TestArenaMapLite::_internal_map_string_string_size() const {
+  return map_string_string_.size();
+}
+inline int TestArenaMapLite::map_string_string_size() const {
+  return _internal_map_string_string_size();
+}
+inline void TestArenaMapLite::clear_map_string_string() {
+  map_string_string_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+TestArenaMapLite::_internal_map_string_string() const {
+  return map_string_string_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+TestArenaMapLite::map_string_string() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_string_string)
+  return _internal_map_string_string();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+TestArenaMapLite::_internal_mutable_map_string_string() {
+  return map_string_string_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+TestArenaMapLite::mutable_map_string_string() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_string_string)
+  return _internal_mutable_map_string_string();
+}
+
+// map<int32, bytes> map_int32_bytes = 15;
+inline int TestArenaMapLite::_internal_map_int32_bytes_size() const {
+  return map_int32_bytes_.size();
+}
+inline int TestArenaMapLite::map_int32_bytes_size() const {
+  return _internal_map_int32_bytes_size();
+}
+inline void TestArenaMapLite::clear_map_int32_bytes() {
+  map_int32_bytes_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+TestArenaMapLite::_internal_map_int32_bytes() const {
+  return map_int32_bytes_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+TestArenaMapLite::map_int32_bytes() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_int32_bytes)
+  return _internal_map_int32_bytes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+TestArenaMapLite::_internal_mutable_map_int32_bytes() {
+  return map_int32_bytes_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+TestArenaMapLite::mutable_map_int32_bytes() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_int32_bytes)
+  return _internal_mutable_map_int32_bytes();
+}
+
+// map<int32, .protobuf_unittest.MapEnumLite> map_int32_enum = 16;
+inline int TestArenaMapLite::_internal_map_int32_enum_size() const {
+  return map_int32_enum_.size();
+}
+inline int TestArenaMapLite::map_int32_enum_size() const {
+  return _internal_map_int32_enum_size();
+}
+inline void TestArenaMapLite::clear_map_int32_enum() {
+  map_int32_enum_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >&
+TestArenaMapLite::_internal_map_int32_enum() const {
+  return map_int32_enum_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >&
+TestArenaMapLite::map_int32_enum() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_int32_enum)
+  return _internal_map_int32_enum();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >*
+TestArenaMapLite::_internal_mutable_map_int32_enum() {
+  return map_int32_enum_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnumLite >*
+TestArenaMapLite::mutable_map_int32_enum() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_int32_enum)
+  return _internal_mutable_map_int32_enum();
+}
+
+// map<int32, .protobuf_unittest.ForeignMessageArenaLite> map_int32_foreign_message = 17;
+inline int TestArenaMapLite::_internal_map_int32_foreign_message_size() const {
+  return map_int32_foreign_message_.size();
+}
+inline int TestArenaMapLite::map_int32_foreign_message_size() const {
+  return _internal_map_int32_foreign_message_size();
+}
+inline void TestArenaMapLite::clear_map_int32_foreign_message() {
+  map_int32_foreign_message_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite >&
+TestArenaMapLite::_internal_map_int32_foreign_message() const {
+  return map_int32_foreign_message_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite >&
+TestArenaMapLite::map_int32_foreign_message() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMapLite.map_int32_foreign_message)
+  return _internal_map_int32_foreign_message();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite >*
+TestArenaMapLite::_internal_mutable_map_int32_foreign_message() {
+  return map_int32_foreign_message_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessageArenaLite >*
+TestArenaMapLite::mutable_map_int32_foreign_message() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMapLite.map_int32_foreign_message)
+  return _internal_mutable_map_int32_foreign_message();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestRequiredMessageMapLite
+
+// map<int32, .protobuf_unittest.TestRequiredLite> map_field = 1;
+inline int TestRequiredMessageMapLite::_internal_map_field_size() const {
+  return map_field_.size();
+}
+inline int TestRequiredMessageMapLite::map_field_size() const {
+  return _internal_map_field_size();
+}
+inline void TestRequiredMessageMapLite::clear_map_field() {
+  map_field_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite >&
+TestRequiredMessageMapLite::_internal_map_field() const {
+  return map_field_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite >&
+TestRequiredMessageMapLite::map_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestRequiredMessageMapLite.map_field)
+  return _internal_map_field();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite >*
+TestRequiredMessageMapLite::_internal_mutable_map_field() {
+  return map_field_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequiredLite >*
+TestRequiredMessageMapLite::mutable_map_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestRequiredMessageMapLite.map_field)
+  return _internal_mutable_map_field();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestEnumMapLite
+
+// map<int32, .protobuf_unittest.Proto2MapEnumLite> known_map_field = 101;
+inline int TestEnumMapLite::_internal_known_map_field_size() const {
+  return known_map_field_.size();
+}
+inline int TestEnumMapLite::known_map_field_size() const {
+  return _internal_known_map_field_size();
+}
+inline void TestEnumMapLite::clear_known_map_field() {
+  known_map_field_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >&
+TestEnumMapLite::_internal_known_map_field() const {
+  return known_map_field_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >&
+TestEnumMapLite::known_map_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapLite.known_map_field)
+  return _internal_known_map_field();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >*
+TestEnumMapLite::_internal_mutable_known_map_field() {
+  return known_map_field_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >*
+TestEnumMapLite::mutable_known_map_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapLite.known_map_field)
+  return _internal_mutable_known_map_field();
+}
+
+// map<int32, .protobuf_unittest.Proto2MapEnumLite> unknown_map_field = 102;
+inline int TestEnumMapLite::_internal_unknown_map_field_size() const {
+  return unknown_map_field_.size();
+}
+inline int TestEnumMapLite::unknown_map_field_size() const {
+  return _internal_unknown_map_field_size();
+}
+inline void TestEnumMapLite::clear_unknown_map_field() {
+  unknown_map_field_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >&
+TestEnumMapLite::_internal_unknown_map_field() const {
+  return unknown_map_field_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >&
+TestEnumMapLite::unknown_map_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapLite.unknown_map_field)
+  return _internal_unknown_map_field();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >*
+TestEnumMapLite::_internal_mutable_unknown_map_field() {
+  return unknown_map_field_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumLite >*
+TestEnumMapLite::mutable_unknown_map_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapLite.unknown_map_field)
+  return _internal_mutable_unknown_map_field();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestEnumMapPlusExtraLite
+
+// map<int32, .protobuf_unittest.Proto2MapEnumPlusExtraLite> known_map_field = 101;
+inline int TestEnumMapPlusExtraLite::_internal_known_map_field_size() const {
+  return known_map_field_.size();
+}
+inline int TestEnumMapPlusExtraLite::known_map_field_size() const {
+  return _internal_known_map_field_size();
+}
+inline void TestEnumMapPlusExtraLite::clear_known_map_field() {
+  known_map_field_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >&
+TestEnumMapPlusExtraLite::_internal_known_map_field() const {
+  return known_map_field_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >&
+TestEnumMapPlusExtraLite::known_map_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtraLite.known_map_field)
+  return _internal_known_map_field();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >*
+TestEnumMapPlusExtraLite::_internal_mutable_known_map_field() {
+  return known_map_field_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >*
+TestEnumMapPlusExtraLite::mutable_known_map_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtraLite.known_map_field)
+  return _internal_mutable_known_map_field();
+}
+
+// map<int32, .protobuf_unittest.Proto2MapEnumPlusExtraLite> unknown_map_field = 102;
+inline int TestEnumMapPlusExtraLite::_internal_unknown_map_field_size() const {
+  return unknown_map_field_.size();
+}
+inline int TestEnumMapPlusExtraLite::unknown_map_field_size() const {
+  return _internal_unknown_map_field_size();
+}
+inline void TestEnumMapPlusExtraLite::clear_unknown_map_field() {
+  unknown_map_field_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >&
+TestEnumMapPlusExtraLite::_internal_unknown_map_field() const {
+  return unknown_map_field_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >&
+TestEnumMapPlusExtraLite::unknown_map_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestEnumMapPlusExtraLite.unknown_map_field)
+  return _internal_unknown_map_field();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >*
+TestEnumMapPlusExtraLite::_internal_mutable_unknown_map_field() {
+  return unknown_map_field_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::Proto2MapEnumPlusExtraLite >*
+TestEnumMapPlusExtraLite::mutable_unknown_map_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestEnumMapPlusExtraLite.unknown_map_field)
+  return _internal_mutable_unknown_map_field();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestMessageMapLite
+
+// map<int32, .protobuf_unittest.TestAllTypesLite> map_int32_message = 1;
+inline int TestMessageMapLite::_internal_map_int32_message_size() const {
+  return map_int32_message_.size();
+}
+inline int TestMessageMapLite::map_int32_message_size() const {
+  return _internal_map_int32_message_size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite >&
+TestMessageMapLite::_internal_map_int32_message() const {
+  return map_int32_message_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite >&
+TestMessageMapLite::map_int32_message() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMessageMapLite.map_int32_message)
+  return _internal_map_int32_message();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite >*
+TestMessageMapLite::_internal_mutable_map_int32_message() {
+  return map_int32_message_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypesLite >*
+TestMessageMapLite::mutable_map_int32_message() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMessageMapLite.map_int32_message)
+  return _internal_mutable_map_int32_message();
+}
+
+// -------------------------------------------------------------------
+
+// TestRequiredLite
+
+// required int32 a = 1;
+inline bool TestRequiredLite::_internal_has_a() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TestRequiredLite::has_a() const {
+  return _internal_has_a();
+}
+inline void TestRequiredLite::clear_a() {
+  a_ = 0;
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestRequiredLite::_internal_a() const {
+  return a_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestRequiredLite::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRequiredLite.a)
+  return _internal_a();
+}
+inline void TestRequiredLite::_internal_set_a(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000001u;
+  a_ = value;
+}
+inline void TestRequiredLite::set_a(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_a(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRequiredLite.a)
+}
+
+// required int32 b = 2;
+inline bool TestRequiredLite::_internal_has_b() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TestRequiredLite::has_b() const {
+  return _internal_has_b();
+}
+inline void TestRequiredLite::clear_b() {
+  b_ = 0;
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestRequiredLite::_internal_b() const {
+  return b_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestRequiredLite::b() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRequiredLite.b)
+  return _internal_b();
+}
+inline void TestRequiredLite::_internal_set_b(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000002u;
+  b_ = value;
+}
+inline void TestRequiredLite::set_b(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_b(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRequiredLite.b)
+}
+
+// required int32 c = 3;
+inline bool TestRequiredLite::_internal_has_c() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TestRequiredLite::has_c() const {
+  return _internal_has_c();
+}
+inline void TestRequiredLite::clear_c() {
+  c_ = 0;
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestRequiredLite::_internal_c() const {
+  return c_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestRequiredLite::c() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRequiredLite.c)
+  return _internal_c();
+}
+inline void TestRequiredLite::_internal_set_c(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000004u;
+  c_ = value;
+}
+inline void TestRequiredLite::set_c(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_c(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRequiredLite.c)
+}
+
+// -------------------------------------------------------------------
+
+// ForeignMessageArenaLite
+
+// optional int32 c = 1;
+inline bool ForeignMessageArenaLite::_internal_has_c() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ForeignMessageArenaLite::has_c() const {
+  return _internal_has_c();
+}
+inline void ForeignMessageArenaLite::clear_c() {
+  c_ = 0;
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ForeignMessageArenaLite::_internal_c() const {
+  return c_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ForeignMessageArenaLite::c() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.ForeignMessageArenaLite.c)
+  return _internal_c();
+}
+inline void ForeignMessageArenaLite::_internal_set_c(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000001u;
+  c_ = value;
+}
+inline void ForeignMessageArenaLite::set_c(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_c(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.ForeignMessageArenaLite.c)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::protobuf_unittest::Proto2MapEnumLite> : ::std::true_type {};
+template <> struct is_proto_enum< ::protobuf_unittest::Proto2MapEnumPlusExtraLite> : ::std::true_type {};
+template <> struct is_proto_enum< ::protobuf_unittest::MapEnumLite> : ::std::true_type {};
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fmap_5flite_5funittest_2eproto
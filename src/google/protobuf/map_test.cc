@@ -82,6 +82,35 @@
 
 #include <google/protobuf/port_def.inc>
 
+namespace google {
+namespace protobuf {
+namespace internal {
+
+// A key type whose hash values all collide.
+struct FlatMapCollidingKey {
+  int value;
+
+  bool operator==(const FlatMapCollidingKey& other) const {
+    return value == other.value;
+  }
+  bool operator<(const FlatMapCollidingKey& other) const {
+    return value < other.value;
+  }
+};
+
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+namespace std {
+template <>
+struct hash<google::protobuf::internal::FlatMapCollidingKey> {
+  size_t operator()(const google::protobuf::internal::FlatMapCollidingKey&) const {
+    return 42;
+  }
+};
+}  // namespace std
+
 namespace google {
 namespace protobuf {
 
@@ -900,6 +929,32 @@ TEST_F(MapImplTest, Rehash) {
   EXPECT_TRUE(map_.empty());
 }
 
+TEST_F(MapImplTest, Reserve) {
+  map_.reserve(1000);
+  EXPECT_TRUE(map_.empty());
+  for (int i = 0; i < 1000; i++) {
+    map_[i] = i + 1;
+  }
+  EXPECT_EQ(1000, map_.size());
+
+  // Reserving less than the current size is a no-op.
+  map_.reserve(10);
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(i + 1, map_[i]);
+  }
+
+  // Reserving more keeps the elements where they can be found.
+  map_.reserve(100000);
+  EXPECT_EQ(1000, map_.size());
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(i + 1, map_[i]);
+  }
+
+  map_.clear();
+  map_[5] = 6;
+  ExpectSingleElement(5, 6);
+}
+
 TEST_F(MapImplTest, EqualRange) {
   int key = 100, key_missing = 101;
   map_[key] = 100;
@@ -1081,6 +1136,300 @@ TEST_F(MapImplTest, TransparentLookupForString) {
   TestTransparent(std::cref(abc), std::cref(lkj));
 }
 
+TEST_F(MapImplTest, TryEmplace) {
+  Map<std::string, int> m;
+  auto p = m.try_emplace("ABC");
+  EXPECT_TRUE(p.second);
+  EXPECT_EQ("ABC", p.first->first);
+  EXPECT_EQ(0, p.first->second);
+  p.first->second = 1;
+  p = m.try_emplace(std::string("ABC"));
+  EXPECT_FALSE(p.second);
+  EXPECT_EQ(1, p.first->second);
+  EXPECT_EQ(1, m.size());
+#if defined(__cpp_lib_string_view)
+  p = m.try_emplace(std::string_view("ABC"));
+  EXPECT_FALSE(p.second);
+  p = m.try_emplace(std::string_view("DEF"));
+  EXPECT_TRUE(p.second);
+  EXPECT_EQ("DEF", p.first->first);
+  EXPECT_EQ(2, m.size());
+#endif  // defined(__cpp_lib_string_view)
+}
+
+// FlatInnerMap Test ================================================
+
+TEST(FlatInnerMapTest, InsertFindErase) {
+  FlatInnerMap<int32, int32> m(0);
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.begin() == m.end());
+
+  const int kSize = 10000;
+  for (int i = 0; i < kSize; i++) {
+    auto p = m.insert(i);
+    EXPECT_TRUE(p.second);
+    EXPECT_EQ(i, p.first->first);
+    p.first->second = i * 2;
+  }
+  EXPECT_EQ(kSize, m.size());
+  EXPECT_FALSE(m.insert(17).second);
+
+  for (int i = 0; i < kSize; i++) {
+    auto it = m.find(i);
+    ASSERT_TRUE(it != m.end());
+    EXPECT_EQ(i * 2, it->second);
+  }
+  EXPECT_TRUE(m.find(kSize) == m.end());
+
+  for (int i = 0; i < kSize; i += 2) {
+    m.erase(m.find(i));
+  }
+  EXPECT_EQ(kSize / 2, m.size());
+  for (int i = 0; i < kSize; i++) {
+    EXPECT_EQ(i % 2 == 1, m.find(i) != m.end());
+  }
+
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.begin() == m.end());
+  EXPECT_TRUE(m.find(1) == m.end());
+}
+
+TEST(FlatInnerMapTest, IterationVisitsEveryElementOnce) {
+  FlatInnerMap<int32, int32> m(0);
+  std::set<int32> expected;
+  for (int i = 0; i < 1000; i++) {
+    m[i * 7].second = i;
+    expected.insert(i * 7);
+  }
+  std::set<int32> seen;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    EXPECT_TRUE(seen.insert(it->first).second);
+  }
+  EXPECT_EQ(expected, seen);
+}
+
+TEST(FlatInnerMapTest, IteratorSurvivesGrowthAndReuseOfDeletedSlots) {
+  FlatInnerMap<int32, int32> m(0);
+  m[0].second = 100;
+  auto it = m.find(0);
+  const MapPair<int32, int32>* element = &*it;
+  // Churn through many inserts and erases so that the table both grows and
+  // gets rehashed in place.
+  for (int i = 1; i < 5000; i++) {
+    m.insert(i);
+    if (i % 3 == 0) m.erase(m.find(i - 1));
+  }
+  EXPECT_EQ(element, &*m.find(0));
+  EXPECT_EQ(100, it->second);
+
+  // Iterating from the stale iterator visits the same elements, in the same
+  // order, as a fresh iteration does after key 0.
+  std::vector<int32> expected;
+  bool after_zero = false;
+  for (auto i = m.begin(); i != m.end(); ++i) {
+    if (after_zero) expected.push_back(i->first);
+    if (i->first == 0) after_zero = true;
+  }
+  ASSERT_TRUE(after_zero);
+  std::vector<int32> seen;
+  for (++it; it != m.end(); ++it) seen.push_back(it->first);
+  EXPECT_EQ(expected, seen);
+
+  // Erasing while iterating, the way Map::erase() does it.
+  for (auto i = m.begin(); i != m.end();) {
+    auto next = i;
+    ++next;
+    m.erase(i);
+    i = next;
+  }
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(FlatInnerMapTest, StringKeys) {
+  FlatInnerMap<std::string, std::string> m(0);
+  for (int i = 0; i < 100; i++) {
+    m[StrCat("key", i)].second = StrCat("value", i);
+  }
+  EXPECT_EQ(100, m.size());
+  EXPECT_EQ("value42", m.find(std::string("key42"))->second);
+  EXPECT_TRUE(m.find(std::string("key100")) == m.end());
+}
+
+TEST(FlatInnerMapTest, Arena) {
+  Arena arena;
+  auto* m = Arena::CreateMessage<FlatInnerMap<std::string, int32>>(&arena, 0);
+  for (int i = 0; i < 1000; i++) {
+    (*m)[StrCat(i)].second = i;
+  }
+  EXPECT_EQ(1000, m->size());
+  EXPECT_EQ(999, m->find(std::string("999"))->second);
+  m->erase(m->find(std::string("999")));
+  EXPECT_TRUE(m->find(std::string("999")) == m->end());
+}
+
+TEST(FlatInnerMapTest, CollidingHashesFallBackToTree) {
+  FlatInnerMap<FlatMapCollidingKey, int32> m(0);
+  const int kSize = 2000;
+  for (int i = 0; i < kSize; i++) {
+    m[FlatMapCollidingKey{i}].second = i;
+  }
+  EXPECT_EQ(kSize, m.size());
+  for (int i = 0; i < kSize; i++) {
+    auto it = m.find(FlatMapCollidingKey{i});
+    ASSERT_TRUE(it != m.end());
+    EXPECT_EQ(i, it->second);
+  }
+  int count = 0;
+  for (auto it = m.begin(); it != m.end(); ++it) count++;
+  EXPECT_EQ(kSize, count);
+
+  for (int i = 0; i < kSize; i += 2) {
+    m.erase(m.find(FlatMapCollidingKey{i}));
+  }
+  EXPECT_EQ(kSize / 2, m.size());
+  EXPECT_TRUE(m.find(FlatMapCollidingKey{0}) == m.end());
+  EXPECT_TRUE(m.find(FlatMapCollidingKey{1}) != m.end());
+
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  m[FlatMapCollidingKey{5}].second = 5;
+  EXPECT_EQ(1, m.size());
+}
+
+// DenseInnerMap Test ===============================================
+
+using TestDenseInnerMap =
+    DenseInnerMap<int32, int32, FlatInnerMap<int32, int32>>;
+
+TEST(DenseInnerMapTest, DenseKeys) {
+  TestDenseInnerMap m(0);
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.begin() == m.end());
+
+  const int kSize = 1000;
+  for (int i = 0; i < kSize; i++) {
+    auto p = m.insert(i);
+    EXPECT_TRUE(p.second);
+    EXPECT_EQ(i, p.first->first);
+    p.first->second = i * 2;
+  }
+  EXPECT_EQ(kSize, m.size());
+  EXPECT_FALSE(m.insert(17).second);
+  for (int i = 0; i < kSize; i++) {
+    auto it = m.find(i);
+    ASSERT_TRUE(it != m.end());
+    EXPECT_EQ(i * 2, it->second);
+  }
+  EXPECT_TRUE(m.find(kSize) == m.end());
+  EXPECT_TRUE(m.find(-1) == m.end());
+
+  for (int i = 0; i < kSize; i += 2) {
+    m.erase(m.find(i));
+  }
+  EXPECT_EQ(kSize / 2, m.size());
+  std::set<int32> seen;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    EXPECT_EQ(1, it->first % 2);
+    EXPECT_TRUE(seen.insert(it->first).second);
+  }
+  EXPECT_EQ(kSize / 2, seen.size());
+
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.begin() == m.end());
+}
+
+TEST(DenseInnerMapTest, SparseKeysFallBackToHashing) {
+  TestDenseInnerMap m(0);
+  for (int i = 0; i < 100; i++) {
+    m[i].second = i;
+  }
+  auto it = m.find(50);
+  const MapPair<int32, int32>* element = &*it;
+
+  // Neither a negative key nor a key far beyond the others fits the array.
+  m[-1].second = -1;
+  m[1 << 20].second = 1 << 20;
+  EXPECT_EQ(102, m.size());
+  EXPECT_EQ(element, &*m.find(50));
+  EXPECT_EQ(-1, m.find(-1)->second);
+  EXPECT_EQ(1 << 20, m.find(1 << 20)->second);
+
+  // The iterator from before the fallback still walks the rest of the map.
+  int count = 1;
+  for (++it; it != m.end(); ++it) count++;
+  EXPECT_LE(count, m.size());
+
+  std::set<int32> seen;
+  for (auto i = m.begin(); i != m.end(); ++i) {
+    EXPECT_TRUE(seen.insert(i->first).second);
+  }
+  EXPECT_EQ(102, seen.size());
+
+  // Erasing while iterating, the way Map::erase() does it.
+  for (auto i = m.begin(); i != m.end();) {
+    auto next = i;
+    ++next;
+    m.erase(i);
+    i = next;
+  }
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(DenseInnerMapTest, EraseWithIteratorFromBeforeFallback) {
+  TestDenseInnerMap m(0);
+  m[3].second = 3;
+  auto it = m.find(3);
+  m[1 << 20].second = 0;
+  m.erase(it);
+  EXPECT_EQ(1, m.size());
+  EXPECT_TRUE(m.find(3) == m.end());
+}
+
+TEST(DenseInnerMapTest, Reserve) {
+  TestDenseInnerMap m(0);
+  m.reserve(1000);
+  // The array is sized by the keys present, so keys inserted in descending
+  // order fall back to hashing, which then holds the reservation.
+  for (int i = 999; i >= 0; i--) {
+    m[i].second = i;
+  }
+  EXPECT_EQ(1000, m.size());
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(i, m.find(i)->second);
+  }
+}
+
+TEST(DenseInnerMapTest, Arena) {
+  Arena arena;
+  auto* m = Arena::CreateMessage<TestDenseInnerMap>(&arena, 0);
+  for (int i = 0; i < 1000; i++) {
+    (*m)[i].second = i;
+  }
+  (*m)[-5].second = -5;
+  EXPECT_EQ(1001, m->size());
+  EXPECT_EQ(999, m->find(999)->second);
+  m->erase(m->find(999));
+  EXPECT_TRUE(m->find(999) == m->end());
+}
+
+TEST(DenseInnerMapTest, MapUsesDenseInnerMapForIntegerKeys) {
+  EXPECT_TRUE(UseDenseInnerMap<int32>::value);
+  EXPECT_TRUE(UseDenseInnerMap<uint64>::value);
+  EXPECT_FALSE(UseDenseInnerMap<bool>::value);
+  EXPECT_FALSE(UseDenseInnerMap<std::string>::value);
+
+  Map<int32, int32> m;
+  for (int i = 0; i < 64; i++) m[i] = i;
+  m[-7] = -7;
+  m[1 << 30] = 1;
+  EXPECT_EQ(66, m.size());
+  int64 sum = 0;
+  for (const auto& entry : m) sum += entry.second;
+  EXPECT_EQ(64 * 63 / 2 - 7 + 1, sum);
+}
+
 // Map Field Reflection Test ========================================
 
 static int Func(int i, int j) { return i * j; }
@@ -1104,6 +1453,12 @@ class MapFieldReflectionTest : public testing::Test {
               const Message& message) {
     return reflection->MapSize(message, field);
   }
+
+  bool IsRepeatedFieldValid(const Reflection* reflection,
+                            const FieldDescriptor* field,
+                            const Message& message) {
+    return reflection->GetMapData(message, field)->IsRepeatedFieldValid();
+  }
 };
 
 namespace {
@@ -1948,6 +2303,72 @@ TEST_F(MapFieldReflectionTest, UninitializedEntry) {
   EXPECT_FALSE(message.IsInitialized());
 }
 
+TEST_F(MapFieldReflectionTest, MergeAndCompareDynamicWithoutSync) {
+  unittest::TestMap message;
+  MapTestUtil::SetMapFields(&message);
+
+  DynamicMessageFactory factory;
+  std::unique_ptr<Message> dynamic(
+      factory.GetPrototype(unittest::TestMap::descriptor())->New());
+  dynamic->MergeFrom(message);
+  EXPECT_TRUE(util::MessageDifferencer::Equals(message, *dynamic));
+
+  // Neither merging nor comparing should have synced the maps to their
+  // repeated fields.
+  const Descriptor* descriptor = unittest::TestMap::descriptor();
+  for (int i = 0; i < descriptor->field_count(); ++i) {
+    const FieldDescriptor* field = descriptor->field(i);
+    if (!field->is_map()) continue;
+    EXPECT_FALSE(
+        IsRepeatedFieldValid(message.GetReflection(), field, message))
+        << field->name();
+    EXPECT_FALSE(
+        IsRepeatedFieldValid(dynamic->GetReflection(), field, *dynamic))
+        << field->name();
+  }
+
+  unittest::TestMap reparsed;
+  ASSERT_TRUE(reparsed.ParseFromString(dynamic->SerializeAsString()));
+  MapTestUtil::ExpectMapFieldsSet(reparsed);
+}
+
+TEST_F(MapFieldReflectionTest, CompareByMapReflection) {
+  unittest::TestMap message1;
+  unittest::TestMap message2;
+  MapTestUtil::SetMapFields(&message1);
+  MapTestUtil::SetMapFields(&message2);
+  EXPECT_TRUE(util::MessageDifferencer::Equals(message1, message2));
+
+  (*message2.mutable_map_int32_foreign_message())[0].set_c(12345);
+  EXPECT_FALSE(util::MessageDifferencer::Equals(message1, message2));
+  (*message2.mutable_map_int32_foreign_message())[0] =
+      message1.map_int32_foreign_message().at(0);
+  EXPECT_TRUE(util::MessageDifferencer::Equals(message1, message2));
+
+  (*message2.mutable_map_string_string())["new key"] = "new value";
+  EXPECT_FALSE(util::MessageDifferencer::Equals(message1, message2));
+
+  util::MessageDifferencer differencer;
+  differencer.set_scope(util::MessageDifferencer::PARTIAL);
+  EXPECT_TRUE(differencer.Compare(message1, message2));
+  EXPECT_FALSE(differencer.Compare(message2, message1));
+
+  message2.mutable_map_string_string()->erase("new key");
+  (*message2.mutable_map_string_string())["unknown key"] = "new value";
+  EXPECT_FALSE(util::MessageDifferencer::Equals(message1, message2));
+}
+
+TEST_F(MapFieldReflectionTest, FindInitializationErrorsWithoutSync) {
+  unittest::TestRequiredMessageMap message;
+  (*message.mutable_map_field())[1];
+  const FieldDescriptor* field =
+      message.GetDescriptor()->FindFieldByName("map_field");
+
+  EXPECT_EQ("map_field[0].value.a, map_field[0].value.b, map_field[0].value.c",
+            message.InitializationErrorString());
+  EXPECT_FALSE(IsRepeatedFieldValid(message.GetReflection(), field, message));
+}
+
 // Generated Message Test ===========================================
 
 TEST(GeneratedMapFieldTest, Accessors) {
@@ -2268,6 +2689,79 @@ TEST(GeneratedMapFieldTest, SerializationToStream) {
   MapTestUtil::ExpectMapFieldsSet(message2);
 }
 
+TEST(GeneratedMapFieldTest, FailedEntryDoesNotInsertKey) {
+  unittest::TestMap message;
+  (*message.mutable_map_int32_int32())[2] = 2;
+  (*message.mutable_map_string_string())["j"] = "j";
+  // Entries whose key and value are followed by an unknown field that runs
+  // past the end of the entry.
+  EXPECT_FALSE(message.MergeFromString(
+      std::string("\x0a\x06\x08\x01\x10\x02\x1a\x10", 8)));
+  EXPECT_FALSE(message.MergeFromString(
+      std::string("\x72\x08\x0a\x01k\x12\x01v\x1a\x10", 10)));
+  EXPECT_EQ(1, message.map_int32_int32().size());
+  EXPECT_EQ(2, message.map_int32_int32().at(2));
+  EXPECT_EQ(1, message.map_string_string().size());
+  EXPECT_EQ("j", message.map_string_string().at("j"));
+}
+
+TEST(GeneratedMapFieldTest, ParseExistingStringKeys) {
+  unittest::TestMap message;
+  (*message.mutable_map_string_string())["k"] = "old";
+  // An entry for an existing key replaces its value, also when the fields
+  // are out of order.
+  ASSERT_TRUE(
+      message.MergeFromString(std::string("\x72\x06\x0a\x01k\x12\x01v", 8)));
+  EXPECT_EQ("v", message.map_string_string().at("k"));
+  ASSERT_TRUE(
+      message.MergeFromString(std::string("\x72\x06\x12\x01w\x0a\x01k", 8)));
+  EXPECT_EQ("w", message.map_string_string().at("k"));
+  EXPECT_EQ(1, message.map_string_string().size());
+}
+
+TEST(GeneratedMapFieldTest, ParseRepeatedKeysReservesLittle) {
+  // Empty entries all have the same key, so the map ends up with a single
+  // element however many entries there are on the wire.
+  std::string data;
+  for (int i = 0; i < 100000; i++) {
+    data += std::string("\x72\x00", 2);  // map_string_string, empty entry
+  }
+  Arena arena;
+  unittest::TestMap* message = Arena::CreateMessage<unittest::TestMap>(&arena);
+  ASSERT_TRUE(message->ParseFromString(data));
+  EXPECT_EQ(1, message->map_string_string().size());
+  EXPECT_LT(arena.SpaceAllocated(), 128 * 1024);
+}
+
+TEST(GeneratedMapFieldTest, ParseLargeMaps) {
+  unittest::TestMapSubmessage message1;
+  unittest::TestMap* map1 = message1.mutable_test_map();
+  for (int i = 0; i < 1000; i++) {
+    (*map1->mutable_map_int32_int32())[i] = i * 3;
+    (*map1->mutable_map_string_string())[StrCat("key", i)] = StrCat(i);
+  }
+  std::string data = message1.SerializeAsString();
+
+  unittest::TestMapSubmessage message2;
+  EXPECT_TRUE(message2.ParseFromString(data));
+  EXPECT_TRUE(util::MessageDifferencer::Equals(message1, message2));
+
+  // Only a few entries are buffered at a time when parsing from a stream.
+  unittest::TestMapSubmessage message3;
+  io::ArrayInputStream input(data.data(), data.size(), 7);
+  EXPECT_TRUE(message3.ParseFromZeroCopyStream(&input));
+  EXPECT_TRUE(util::MessageDifferencer::Equals(message1, message3));
+
+#ifndef PROTOBUF_TEST_NO_DESCRIPTORS
+  DynamicMessageFactory factory;
+  std::unique_ptr<Message> message4(
+      factory.GetPrototype(unittest::TestMapSubmessage::descriptor())->New());
+  EXPECT_TRUE(message4->ParseFromString(data));
+  unittest::TestMapSubmessage message5;
+  EXPECT_TRUE(message5.ParseFromString(message4->SerializeAsString()));
+  EXPECT_TRUE(util::MessageDifferencer::Equals(message1, message5));
+#endif  // !PROTOBUF_TEST_NO_DESCRIPTORS
+}
 
 TEST(GeneratedMapFieldTest, SameTypeMaps) {
   const Descriptor* map1 = unittest::TestSameTypeMap::descriptor()
@@ -2493,6 +2987,53 @@ TEST(GeneratedMapFieldTest, CorruptedWireFormat) {
   EXPECT_FALSE(message.ParseFromString(data));
 }
 
+TEST(GeneratedMapFieldTest, UnorderedStringKeyMessageValueWireFormat) {
+  unittest::TestMap message;
+
+  // Value, unknown field and key, then a second entry for the same key.  The
+  // second value replaces the first one instead of being merged into it.
+  std::string data =
+      "\x92\x01\x0B\x12\x02\x08\x05\x18\x01\x0A\x03"
+      "abc"
+      "\x92\x01\x09\x0A\x03"
+      "abc"
+      "\x12\x02\x10\x07";
+
+  EXPECT_TRUE(message.ParseFromString(data));
+  ASSERT_EQ(1, message.map_string_foreign_message().size());
+  const unittest::ForeignMessage& value =
+      message.map_string_foreign_message().at("abc");
+  EXPECT_FALSE(value.has_c());
+  EXPECT_EQ(7, value.d());
+
+  // The same entries parsed into a message on an arena.
+  Arena arena;
+  unittest::TestMap* arena_message =
+      Arena::CreateMessage<unittest::TestMap>(&arena);
+  EXPECT_TRUE(arena_message->ParseFromString(data));
+  ASSERT_EQ(1, arena_message->map_string_foreign_message().size());
+  EXPECT_EQ(7, arena_message->map_string_foreign_message().at("abc").d());
+}
+
+TEST(GeneratedMapFieldTest, Proto2UnknownEnumUnorderedWireFormat) {
+  // An entry with an unknown enum value, the value before the key and an
+  // unknown field in between.
+  std::string data = "\xB2\x06\x06\x10";
+  data.push_back(static_cast<char>(unittest::E_PROTO2_MAP_ENUM_EXTRA));
+  data += "\x18\x01\x08\x05";
+
+  unittest::TestEnumMap to;
+  EXPECT_TRUE(to.ParseFromString(data));
+  EXPECT_EQ(0, to.unknown_map_field().size());
+  EXPECT_EQ(1, to.GetReflection()->GetUnknownFields(to).field_count());
+
+  // The unknown field keeps both the key and the value.
+  unittest::TestEnumMapPlusExtra from;
+  EXPECT_TRUE(from.ParseFromString(to.SerializeAsString()));
+  ASSERT_EQ(1, from.unknown_map_field().size());
+  EXPECT_EQ(unittest::E_PROTO2_MAP_ENUM_EXTRA, from.unknown_map_field().at(5));
+}
+
 TEST(GeneratedMapFieldTest, IsInitialized) {
   unittest::TestRequiredMessageMap map_message;
 
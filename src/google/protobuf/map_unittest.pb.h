@@ -0,0 +1,5421 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/map_unittest.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fmap_5funittest_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fmap_5funittest_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3012000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3012003 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "google/protobuf/unittest.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fmap_5funittest_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2fmap_5funittest_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[52]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto;
+namespace protobuf_unittest {
+class MessageContainingEnumCalledType;
+class MessageContainingEnumCalledTypeDefaultTypeInternal;
+extern MessageContainingEnumCalledTypeDefaultTypeInternal _MessageContainingEnumCalledType_default_instance_;
+class MessageContainingEnumCalledType_TypeEntry_DoNotUse;
+class MessageContainingEnumCalledType_TypeEntry_DoNotUseDefaultTypeInternal;
+extern MessageContainingEnumCalledType_TypeEntry_DoNotUseDefaultTypeInternal _MessageContainingEnumCalledType_TypeEntry_DoNotUse_default_instance_;
+class MessageContainingMapCalledEntry;
+class MessageContainingMapCalledEntryDefaultTypeInternal;
+extern MessageContainingMapCalledEntryDefaultTypeInternal _MessageContainingMapCalledEntry_default_instance_;
+class MessageContainingMapCalledEntry_EntryEntry_DoNotUse;
+class MessageContainingMapCalledEntry_EntryEntry_DoNotUseDefaultTypeInternal;
+extern MessageContainingMapCalledEntry_EntryEntry_DoNotUseDefaultTypeInternal _MessageContainingMapCalledEntry_EntryEntry_DoNotUse_default_instance_;
+class TestArenaMap;
+class TestArenaMapDefaultTypeInternal;
+extern TestArenaMapDefaultTypeInternal _TestArenaMap_default_instance_;
+class TestArenaMap_MapBoolBoolEntry_DoNotUse;
+class TestArenaMap_MapBoolBoolEntry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapBoolBoolEntry_DoNotUseDefaultTypeInternal _TestArenaMap_MapBoolBoolEntry_DoNotUse_default_instance_;
+class TestArenaMap_MapFixed32Fixed32Entry_DoNotUse;
+class TestArenaMap_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapFixed32Fixed32Entry_DoNotUse_default_instance_;
+class TestArenaMap_MapFixed64Fixed64Entry_DoNotUse;
+class TestArenaMap_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapFixed64Fixed64Entry_DoNotUse_default_instance_;
+class TestArenaMap_MapInt32BytesEntry_DoNotUse;
+class TestArenaMap_MapInt32BytesEntry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapInt32BytesEntry_DoNotUseDefaultTypeInternal _TestArenaMap_MapInt32BytesEntry_DoNotUse_default_instance_;
+class TestArenaMap_MapInt32DoubleEntry_DoNotUse;
+class TestArenaMap_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal _TestArenaMap_MapInt32DoubleEntry_DoNotUse_default_instance_;
+class TestArenaMap_MapInt32EnumEntry_DoNotUse;
+class TestArenaMap_MapInt32EnumEntry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapInt32EnumEntry_DoNotUseDefaultTypeInternal _TestArenaMap_MapInt32EnumEntry_DoNotUse_default_instance_;
+class TestArenaMap_MapInt32FloatEntry_DoNotUse;
+class TestArenaMap_MapInt32FloatEntry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapInt32FloatEntry_DoNotUseDefaultTypeInternal _TestArenaMap_MapInt32FloatEntry_DoNotUse_default_instance_;
+class TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse;
+class TestArenaMap_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal _TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse_default_instance_;
+class TestArenaMap_MapInt32Int32Entry_DoNotUse;
+class TestArenaMap_MapInt32Int32Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapInt32Int32Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapInt32Int32Entry_DoNotUse_default_instance_;
+class TestArenaMap_MapInt64Int64Entry_DoNotUse;
+class TestArenaMap_MapInt64Int64Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapInt64Int64Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapInt64Int64Entry_DoNotUse_default_instance_;
+class TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse;
+class TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_;
+class TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse;
+class TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_;
+class TestArenaMap_MapSint32Sint32Entry_DoNotUse;
+class TestArenaMap_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapSint32Sint32Entry_DoNotUse_default_instance_;
+class TestArenaMap_MapSint64Sint64Entry_DoNotUse;
+class TestArenaMap_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapSint64Sint64Entry_DoNotUse_default_instance_;
+class TestArenaMap_MapStringStringEntry_DoNotUse;
+class TestArenaMap_MapStringStringEntry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapStringStringEntry_DoNotUseDefaultTypeInternal _TestArenaMap_MapStringStringEntry_DoNotUse_default_instance_;
+class TestArenaMap_MapUint32Uint32Entry_DoNotUse;
+class TestArenaMap_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapUint32Uint32Entry_DoNotUse_default_instance_;
+class TestArenaMap_MapUint64Uint64Entry_DoNotUse;
+class TestArenaMap_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal;
+extern TestArenaMap_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal _TestArenaMap_MapUint64Uint64Entry_DoNotUse_default_instance_;
+class TestMap;
+class TestMapDefaultTypeInternal;
+extern TestMapDefaultTypeInternal _TestMap_default_instance_;
+class TestMapSubmessage;
+class TestMapSubmessageDefaultTypeInternal;
+extern TestMapSubmessageDefaultTypeInternal _TestMapSubmessage_default_instance_;
+class TestMap_MapBoolBoolEntry_DoNotUse;
+class TestMap_MapBoolBoolEntry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapBoolBoolEntry_DoNotUseDefaultTypeInternal _TestMap_MapBoolBoolEntry_DoNotUse_default_instance_;
+class TestMap_MapFixed32Fixed32Entry_DoNotUse;
+class TestMap_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapFixed32Fixed32Entry_DoNotUseDefaultTypeInternal _TestMap_MapFixed32Fixed32Entry_DoNotUse_default_instance_;
+class TestMap_MapFixed64Fixed64Entry_DoNotUse;
+class TestMap_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapFixed64Fixed64Entry_DoNotUseDefaultTypeInternal _TestMap_MapFixed64Fixed64Entry_DoNotUse_default_instance_;
+class TestMap_MapInt32AllTypesEntry_DoNotUse;
+class TestMap_MapInt32AllTypesEntry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapInt32AllTypesEntry_DoNotUseDefaultTypeInternal _TestMap_MapInt32AllTypesEntry_DoNotUse_default_instance_;
+class TestMap_MapInt32BytesEntry_DoNotUse;
+class TestMap_MapInt32BytesEntry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapInt32BytesEntry_DoNotUseDefaultTypeInternal _TestMap_MapInt32BytesEntry_DoNotUse_default_instance_;
+class TestMap_MapInt32DoubleEntry_DoNotUse;
+class TestMap_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapInt32DoubleEntry_DoNotUseDefaultTypeInternal _TestMap_MapInt32DoubleEntry_DoNotUse_default_instance_;
+class TestMap_MapInt32EnumEntry_DoNotUse;
+class TestMap_MapInt32EnumEntry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapInt32EnumEntry_DoNotUseDefaultTypeInternal _TestMap_MapInt32EnumEntry_DoNotUse_default_instance_;
+class TestMap_MapInt32FloatEntry_DoNotUse;
+class TestMap_MapInt32FloatEntry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapInt32FloatEntry_DoNotUseDefaultTypeInternal _TestMap_MapInt32FloatEntry_DoNotUse_default_instance_;
+class TestMap_MapInt32ForeignMessageEntry_DoNotUse;
+class TestMap_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapInt32ForeignMessageEntry_DoNotUseDefaultTypeInternal _TestMap_MapInt32ForeignMessageEntry_DoNotUse_default_instance_;
+class TestMap_MapInt32Int32Entry_DoNotUse;
+class TestMap_MapInt32Int32Entry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapInt32Int32Entry_DoNotUseDefaultTypeInternal _TestMap_MapInt32Int32Entry_DoNotUse_default_instance_;
+class TestMap_MapInt64Int64Entry_DoNotUse;
+class TestMap_MapInt64Int64Entry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapInt64Int64Entry_DoNotUseDefaultTypeInternal _TestMap_MapInt64Int64Entry_DoNotUse_default_instance_;
+class TestMap_MapSfixed32Sfixed32Entry_DoNotUse;
+class TestMap_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapSfixed32Sfixed32Entry_DoNotUseDefaultTypeInternal _TestMap_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_;
+class TestMap_MapSfixed64Sfixed64Entry_DoNotUse;
+class TestMap_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapSfixed64Sfixed64Entry_DoNotUseDefaultTypeInternal _TestMap_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_;
+class TestMap_MapSint32Sint32Entry_DoNotUse;
+class TestMap_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapSint32Sint32Entry_DoNotUseDefaultTypeInternal _TestMap_MapSint32Sint32Entry_DoNotUse_default_instance_;
+class TestMap_MapSint64Sint64Entry_DoNotUse;
+class TestMap_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapSint64Sint64Entry_DoNotUseDefaultTypeInternal _TestMap_MapSint64Sint64Entry_DoNotUse_default_instance_;
+class TestMap_MapStringForeignMessageEntry_DoNotUse;
+class TestMap_MapStringForeignMessageEntry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapStringForeignMessageEntry_DoNotUseDefaultTypeInternal _TestMap_MapStringForeignMessageEntry_DoNotUse_default_instance_;
+class TestMap_MapStringStringEntry_DoNotUse;
+class TestMap_MapStringStringEntry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapStringStringEntry_DoNotUseDefaultTypeInternal _TestMap_MapStringStringEntry_DoNotUse_default_instance_;
+class TestMap_MapUint32Uint32Entry_DoNotUse;
+class TestMap_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapUint32Uint32Entry_DoNotUseDefaultTypeInternal _TestMap_MapUint32Uint32Entry_DoNotUse_default_instance_;
+class TestMap_MapUint64Uint64Entry_DoNotUse;
+class TestMap_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal;
+extern TestMap_MapUint64Uint64Entry_DoNotUseDefaultTypeInternal _TestMap_MapUint64Uint64Entry_DoNotUse_default_instance_;
+class TestMessageMap;
+class TestMessageMapDefaultTypeInternal;
+extern TestMessageMapDefaultTypeInternal _TestMessageMap_default_instance_;
+class TestMessageMap_MapInt32MessageEntry_DoNotUse;
+class TestMessageMap_MapInt32MessageEntry_DoNotUseDefaultTypeInternal;
+extern TestMessageMap_MapInt32MessageEntry_DoNotUseDefaultTypeInternal _TestMessageMap_MapInt32MessageEntry_DoNotUse_default_instance_;
+class TestRecursiveMapMessage;
+class TestRecursiveMapMessageDefaultTypeInternal;
+extern TestRecursiveMapMessageDefaultTypeInternal _TestRecursiveMapMessage_default_instance_;
+class TestRecursiveMapMessage_AEntry_DoNotUse;
+class TestRecursiveMapMessage_AEntry_DoNotUseDefaultTypeInternal;
+extern TestRecursiveMapMessage_AEntry_DoNotUseDefaultTypeInternal _TestRecursiveMapMessage_AEntry_DoNotUse_default_instance_;
+class TestRequiredMessageMap;
+class TestRequiredMessageMapDefaultTypeInternal;
+extern TestRequiredMessageMapDefaultTypeInternal _TestRequiredMessageMap_default_instance_;
+class TestRequiredMessageMap_MapFieldEntry_DoNotUse;
+class TestRequiredMessageMap_MapFieldEntry_DoNotUseDefaultTypeInternal;
+extern TestRequiredMessageMap_MapFieldEntry_DoNotUseDefaultTypeInternal _TestRequiredMessageMap_MapFieldEntry_DoNotUse_default_instance_;
+class TestSameTypeMap;
+class TestSameTypeMapDefaultTypeInternal;
+extern TestSameTypeMapDefaultTypeInternal _TestSameTypeMap_default_instance_;
+class TestSameTypeMap_Map1Entry_DoNotUse;
+class TestSameTypeMap_Map1Entry_DoNotUseDefaultTypeInternal;
+extern TestSameTypeMap_Map1Entry_DoNotUseDefaultTypeInternal _TestSameTypeMap_Map1Entry_DoNotUse_default_instance_;
+class TestSameTypeMap_Map2Entry_DoNotUse;
+class TestSameTypeMap_Map2Entry_DoNotUseDefaultTypeInternal;
+extern TestSameTypeMap_Map2Entry_DoNotUseDefaultTypeInternal _TestSameTypeMap_Map2Entry_DoNotUse_default_instance_;
+}  // namespace protobuf_unittest
+PROTOBUF_NAMESPACE_OPEN
+template<> ::protobuf_unittest::MessageContainingEnumCalledType* Arena::CreateMaybeMessage<::protobuf_unittest::MessageContainingEnumCalledType>(Arena*);
+template<> ::protobuf_unittest::MessageContainingEnumCalledType_TypeEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MessageContainingEnumCalledType_TypeEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::MessageContainingMapCalledEntry* Arena::CreateMaybeMessage<::protobuf_unittest::MessageContainingMapCalledEntry>(Arena*);
+template<> ::protobuf_unittest::MessageContainingMapCalledEntry_EntryEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::MessageContainingMapCalledEntry_EntryEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapBoolBoolEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapBoolBoolEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapFixed32Fixed32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapFixed32Fixed32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapFixed64Fixed64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapFixed64Fixed64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapInt32BytesEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapInt32BytesEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapInt32DoubleEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapInt32DoubleEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapInt32EnumEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapInt32EnumEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapInt32FloatEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapInt32FloatEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapInt32Int32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapInt32Int32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapInt64Int64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapInt64Int64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapSint32Sint32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapSint32Sint32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapSint64Sint64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapSint64Sint64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapStringStringEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapStringStringEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapUint32Uint32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapUint32Uint32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestArenaMap_MapUint64Uint64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestArenaMap_MapUint64Uint64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap>(Arena*);
+template<> ::protobuf_unittest::TestMapSubmessage* Arena::CreateMaybeMessage<::protobuf_unittest::TestMapSubmessage>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapBoolBoolEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapBoolBoolEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapFixed32Fixed32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapFixed32Fixed32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapFixed64Fixed64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapFixed64Fixed64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapInt32AllTypesEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapInt32AllTypesEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapInt32BytesEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapInt32BytesEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapInt32DoubleEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapInt32DoubleEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapInt32EnumEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapInt32EnumEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapInt32FloatEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapInt32FloatEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapInt32ForeignMessageEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapInt32ForeignMessageEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapInt32Int32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapInt32Int32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapInt64Int64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapInt64Int64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapSfixed32Sfixed32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapSfixed32Sfixed32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapSfixed64Sfixed64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapSfixed64Sfixed64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapSint32Sint32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapSint32Sint32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapSint64Sint64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapSint64Sint64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapStringForeignMessageEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapStringForeignMessageEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapStringStringEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapStringStringEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapUint32Uint32Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapUint32Uint32Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMap_MapUint64Uint64Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMap_MapUint64Uint64Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestMessageMap* Arena::CreateMaybeMessage<::protobuf_unittest::TestMessageMap>(Arena*);
+template<> ::protobuf_unittest::TestMessageMap_MapInt32MessageEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestMessageMap_MapInt32MessageEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestRecursiveMapMessage* Arena::CreateMaybeMessage<::protobuf_unittest::TestRecursiveMapMessage>(Arena*);
+template<> ::protobuf_unittest::TestRecursiveMapMessage_AEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestRecursiveMapMessage_AEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestRequiredMessageMap* Arena::CreateMaybeMessage<::protobuf_unittest::TestRequiredMessageMap>(Arena*);
+template<> ::protobuf_unittest::TestRequiredMessageMap_MapFieldEntry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestRequiredMessageMap_MapFieldEntry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestSameTypeMap* Arena::CreateMaybeMessage<::protobuf_unittest::TestSameTypeMap>(Arena*);
+template<> ::protobuf_unittest::TestSameTypeMap_Map1Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestSameTypeMap_Map1Entry_DoNotUse>(Arena*);
+template<> ::protobuf_unittest::TestSameTypeMap_Map2Entry_DoNotUse* Arena::CreateMaybeMessage<::protobuf_unittest::TestSameTypeMap_Map2Entry_DoNotUse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace protobuf_unittest {
+
+enum MessageContainingEnumCalledType_Type : int {
+  MessageContainingEnumCalledType_Type_TYPE_FOO = 0,
+  MessageContainingEnumCalledType_Type_MessageContainingEnumCalledType_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
+  MessageContainingEnumCalledType_Type_MessageContainingEnumCalledType_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+};
+bool MessageContainingEnumCalledType_Type_IsValid(int value);
+constexpr MessageContainingEnumCalledType_Type MessageContainingEnumCalledType_Type_Type_MIN = MessageContainingEnumCalledType_Type_TYPE_FOO;
+constexpr MessageContainingEnumCalledType_Type MessageContainingEnumCalledType_Type_Type_MAX = MessageContainingEnumCalledType_Type_TYPE_FOO;
+constexpr int MessageContainingEnumCalledType_Type_Type_ARRAYSIZE = MessageContainingEnumCalledType_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageContainingEnumCalledType_Type_descriptor();
+template<typename T>
+inline const std::string& MessageContainingEnumCalledType_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MessageContainingEnumCalledType_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MessageContainingEnumCalledType_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MessageContainingEnumCalledType_Type_descriptor(), enum_t_value);
+}
+inline bool MessageContainingEnumCalledType_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MessageContainingEnumCalledType_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageContainingEnumCalledType_Type>(
+    MessageContainingEnumCalledType_Type_descriptor(), name, value);
+}
+enum MapEnum : int {
+  MAP_ENUM_FOO = 0,
+  MAP_ENUM_BAR = 1,
+  MAP_ENUM_BAZ = 2,
+  MapEnum_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
+  MapEnum_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+};
+bool MapEnum_IsValid(int value);
+constexpr MapEnum MapEnum_MIN = MAP_ENUM_FOO;
+constexpr MapEnum MapEnum_MAX = MAP_ENUM_BAZ;
+constexpr int MapEnum_ARRAYSIZE = MapEnum_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MapEnum_descriptor();
+template<typename T>
+inline const std::string& MapEnum_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MapEnum>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MapEnum_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MapEnum_descriptor(), enum_t_value);
+}
+inline bool MapEnum_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MapEnum* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MapEnum>(
+    MapEnum_descriptor(), name, value);
+}
+// ===================================================================
+
+class TestMap_MapInt32Int32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt32Int32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt32Int32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > SuperType;
+  TestMap_MapInt32Int32Entry_DoNotUse();
+  explicit TestMap_MapInt32Int32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapInt32Int32Entry_DoNotUse& other);
+  static const TestMap_MapInt32Int32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapInt32Int32Entry_DoNotUse*>(&_TestMap_MapInt32Int32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[0];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapInt64Int64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt64Int64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt64Int64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    0 > SuperType;
+  TestMap_MapInt64Int64Entry_DoNotUse();
+  explicit TestMap_MapInt64Int64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapInt64Int64Entry_DoNotUse& other);
+  static const TestMap_MapInt64Int64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapInt64Int64Entry_DoNotUse*>(&_TestMap_MapInt64Int64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[1];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapUint32Uint32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapUint32Uint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapUint32Uint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    0 > SuperType;
+  TestMap_MapUint32Uint32Entry_DoNotUse();
+  explicit TestMap_MapUint32Uint32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapUint32Uint32Entry_DoNotUse& other);
+  static const TestMap_MapUint32Uint32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapUint32Uint32Entry_DoNotUse*>(&_TestMap_MapUint32Uint32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[2];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapUint64Uint64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapUint64Uint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapUint64Uint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    0 > SuperType;
+  TestMap_MapUint64Uint64Entry_DoNotUse();
+  explicit TestMap_MapUint64Uint64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapUint64Uint64Entry_DoNotUse& other);
+  static const TestMap_MapUint64Uint64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapUint64Uint64Entry_DoNotUse*>(&_TestMap_MapUint64Uint64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[3];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapSint32Sint32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapSint32Sint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapSint32Sint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    0 > SuperType;
+  TestMap_MapSint32Sint32Entry_DoNotUse();
+  explicit TestMap_MapSint32Sint32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapSint32Sint32Entry_DoNotUse& other);
+  static const TestMap_MapSint32Sint32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapSint32Sint32Entry_DoNotUse*>(&_TestMap_MapSint32Sint32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[4];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapSint64Sint64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapSint64Sint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapSint64Sint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    0 > SuperType;
+  TestMap_MapSint64Sint64Entry_DoNotUse();
+  explicit TestMap_MapSint64Sint64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapSint64Sint64Entry_DoNotUse& other);
+  static const TestMap_MapSint64Sint64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapSint64Sint64Entry_DoNotUse*>(&_TestMap_MapSint64Sint64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[5];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapFixed32Fixed32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapFixed32Fixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapFixed32Fixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    0 > SuperType;
+  TestMap_MapFixed32Fixed32Entry_DoNotUse();
+  explicit TestMap_MapFixed32Fixed32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapFixed32Fixed32Entry_DoNotUse& other);
+  static const TestMap_MapFixed32Fixed32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapFixed32Fixed32Entry_DoNotUse*>(&_TestMap_MapFixed32Fixed32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[6];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapFixed64Fixed64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapFixed64Fixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapFixed64Fixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    0 > SuperType;
+  TestMap_MapFixed64Fixed64Entry_DoNotUse();
+  explicit TestMap_MapFixed64Fixed64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapFixed64Fixed64Entry_DoNotUse& other);
+  static const TestMap_MapFixed64Fixed64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapFixed64Fixed64Entry_DoNotUse*>(&_TestMap_MapFixed64Fixed64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[7];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapSfixed32Sfixed32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapSfixed32Sfixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapSfixed32Sfixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    0 > SuperType;
+  TestMap_MapSfixed32Sfixed32Entry_DoNotUse();
+  explicit TestMap_MapSfixed32Sfixed32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapSfixed32Sfixed32Entry_DoNotUse& other);
+  static const TestMap_MapSfixed32Sfixed32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapSfixed32Sfixed32Entry_DoNotUse*>(&_TestMap_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[8];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapSfixed64Sfixed64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapSfixed64Sfixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapSfixed64Sfixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    0 > SuperType;
+  TestMap_MapSfixed64Sfixed64Entry_DoNotUse();
+  explicit TestMap_MapSfixed64Sfixed64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapSfixed64Sfixed64Entry_DoNotUse& other);
+  static const TestMap_MapSfixed64Sfixed64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapSfixed64Sfixed64Entry_DoNotUse*>(&_TestMap_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[9];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapInt32FloatEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt32FloatEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, float,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt32FloatEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, float,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+    0 > SuperType;
+  TestMap_MapInt32FloatEntry_DoNotUse();
+  explicit TestMap_MapInt32FloatEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapInt32FloatEntry_DoNotUse& other);
+  static const TestMap_MapInt32FloatEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapInt32FloatEntry_DoNotUse*>(&_TestMap_MapInt32FloatEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[10];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapInt32DoubleEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt32DoubleEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, double,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt32DoubleEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, double,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE,
+    0 > SuperType;
+  TestMap_MapInt32DoubleEntry_DoNotUse();
+  explicit TestMap_MapInt32DoubleEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapInt32DoubleEntry_DoNotUse& other);
+  static const TestMap_MapInt32DoubleEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapInt32DoubleEntry_DoNotUse*>(&_TestMap_MapInt32DoubleEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[11];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapBoolBoolEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapBoolBoolEntry_DoNotUse, 
+    bool, bool,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapBoolBoolEntry_DoNotUse, 
+    bool, bool,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    0 > SuperType;
+  TestMap_MapBoolBoolEntry_DoNotUse();
+  explicit TestMap_MapBoolBoolEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapBoolBoolEntry_DoNotUse& other);
+  static const TestMap_MapBoolBoolEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapBoolBoolEntry_DoNotUse*>(&_TestMap_MapBoolBoolEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[12];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapStringStringEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapStringStringEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapStringStringEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > SuperType;
+  TestMap_MapStringStringEntry_DoNotUse();
+  explicit TestMap_MapStringStringEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapStringStringEntry_DoNotUse& other);
+  static const TestMap_MapStringStringEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapStringStringEntry_DoNotUse*>(&_TestMap_MapStringStringEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "protobuf_unittest.TestMap.MapStringStringEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "protobuf_unittest.TestMap.MapStringStringEntry.value");
+ }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[13];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapInt32BytesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt32BytesEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt32BytesEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES,
+    0 > SuperType;
+  TestMap_MapInt32BytesEntry_DoNotUse();
+  explicit TestMap_MapInt32BytesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapInt32BytesEntry_DoNotUse& other);
+  static const TestMap_MapInt32BytesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapInt32BytesEntry_DoNotUse*>(&_TestMap_MapInt32BytesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[14];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapInt32EnumEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt32EnumEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt32EnumEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > SuperType;
+  TestMap_MapInt32EnumEntry_DoNotUse();
+  explicit TestMap_MapInt32EnumEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapInt32EnumEntry_DoNotUse& other);
+  static const TestMap_MapInt32EnumEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapInt32EnumEntry_DoNotUse*>(&_TestMap_MapInt32EnumEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[15];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapInt32ForeignMessageEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt32ForeignMessageEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt32ForeignMessageEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  TestMap_MapInt32ForeignMessageEntry_DoNotUse();
+  explicit TestMap_MapInt32ForeignMessageEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapInt32ForeignMessageEntry_DoNotUse& other);
+  static const TestMap_MapInt32ForeignMessageEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapInt32ForeignMessageEntry_DoNotUse*>(&_TestMap_MapInt32ForeignMessageEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[16];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapStringForeignMessageEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapStringForeignMessageEntry_DoNotUse, 
+    std::string, ::protobuf_unittest::ForeignMessage,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapStringForeignMessageEntry_DoNotUse, 
+    std::string, ::protobuf_unittest::ForeignMessage,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  TestMap_MapStringForeignMessageEntry_DoNotUse();
+  explicit TestMap_MapStringForeignMessageEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapStringForeignMessageEntry_DoNotUse& other);
+  static const TestMap_MapStringForeignMessageEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapStringForeignMessageEntry_DoNotUse*>(&_TestMap_MapStringForeignMessageEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "protobuf_unittest.TestMap.MapStringForeignMessageEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[17];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap_MapInt32AllTypesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt32AllTypesEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMap_MapInt32AllTypesEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  TestMap_MapInt32AllTypesEntry_DoNotUse();
+  explicit TestMap_MapInt32AllTypesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMap_MapInt32AllTypesEntry_DoNotUse& other);
+  static const TestMap_MapInt32AllTypesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMap_MapInt32AllTypesEntry_DoNotUse*>(&_TestMap_MapInt32AllTypesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[18];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMap PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestMap) */ {
+ public:
+  inline TestMap() : TestMap(nullptr) {};
+  virtual ~TestMap();
+
+  TestMap(const TestMap& from);
+  TestMap(TestMap&& from) noexcept
+    : TestMap() {
+    *this = ::std::move(from);
+  }
+
+  inline TestMap& operator=(const TestMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestMap& operator=(TestMap&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestMap& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestMap* internal_default_instance() {
+    return reinterpret_cast<const TestMap*>(
+               &_TestMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(TestMap& a, TestMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestMap* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestMap* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestMap* New() const final {
+    return CreateMaybeMessage<TestMap>(nullptr);
+  }
+
+  TestMap* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestMap>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestMap& from);
+  void MergeFrom(const TestMap& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestMap* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestMap";
+  }
+  protected:
+  explicit TestMap(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapInt32Int32FieldNumber = 1,
+    kMapInt64Int64FieldNumber = 2,
+    kMapUint32Uint32FieldNumber = 3,
+    kMapUint64Uint64FieldNumber = 4,
+    kMapSint32Sint32FieldNumber = 5,
+    kMapSint64Sint64FieldNumber = 6,
+    kMapFixed32Fixed32FieldNumber = 7,
+    kMapFixed64Fixed64FieldNumber = 8,
+    kMapSfixed32Sfixed32FieldNumber = 9,
+    kMapSfixed64Sfixed64FieldNumber = 10,
+    kMapInt32FloatFieldNumber = 11,
+    kMapInt32DoubleFieldNumber = 12,
+    kMapBoolBoolFieldNumber = 13,
+    kMapStringStringFieldNumber = 14,
+    kMapInt32BytesFieldNumber = 15,
+    kMapInt32EnumFieldNumber = 16,
+    kMapInt32ForeignMessageFieldNumber = 17,
+    kMapStringForeignMessageFieldNumber = 18,
+    kMapInt32AllTypesFieldNumber = 19,
+  };
+  // map<int32, int32> map_int32_int32 = 1;
+  int map_int32_int32_size() const;
+  private:
+  int _internal_map_int32_int32_size() const;
+  public:
+  void clear_map_int32_int32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_map_int32_int32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_map_int32_int32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map_int32_int32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map_int32_int32();
+
+  // map<int64, int64> map_int64_int64 = 2;
+  int map_int64_int64_size() const;
+  private:
+  int _internal_map_int64_int64_size() const;
+  public:
+  void clear_map_int64_int64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_map_int64_int64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_map_int64_int64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      map_int64_int64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_map_int64_int64();
+
+  // map<uint32, uint32> map_uint32_uint32 = 3;
+  int map_uint32_uint32_size() const;
+  private:
+  int _internal_map_uint32_uint32_size() const;
+  public:
+  void clear_map_uint32_uint32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_map_uint32_uint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_map_uint32_uint32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      map_uint32_uint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_map_uint32_uint32();
+
+  // map<uint64, uint64> map_uint64_uint64 = 4;
+  int map_uint64_uint64_size() const;
+  private:
+  int _internal_map_uint64_uint64_size() const;
+  public:
+  void clear_map_uint64_uint64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_map_uint64_uint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_map_uint64_uint64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      map_uint64_uint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_map_uint64_uint64();
+
+  // map<sint32, sint32> map_sint32_sint32 = 5;
+  int map_sint32_sint32_size() const;
+  private:
+  int _internal_map_sint32_sint32_size() const;
+  public:
+  void clear_map_sint32_sint32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_map_sint32_sint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_map_sint32_sint32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map_sint32_sint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map_sint32_sint32();
+
+  // map<sint64, sint64> map_sint64_sint64 = 6;
+  int map_sint64_sint64_size() const;
+  private:
+  int _internal_map_sint64_sint64_size() const;
+  public:
+  void clear_map_sint64_sint64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_map_sint64_sint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_map_sint64_sint64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      map_sint64_sint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_map_sint64_sint64();
+
+  // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+  int map_fixed32_fixed32_size() const;
+  private:
+  int _internal_map_fixed32_fixed32_size() const;
+  public:
+  void clear_map_fixed32_fixed32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_map_fixed32_fixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_map_fixed32_fixed32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      map_fixed32_fixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_map_fixed32_fixed32();
+
+  // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+  int map_fixed64_fixed64_size() const;
+  private:
+  int _internal_map_fixed64_fixed64_size() const;
+  public:
+  void clear_map_fixed64_fixed64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_map_fixed64_fixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_map_fixed64_fixed64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      map_fixed64_fixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_map_fixed64_fixed64();
+
+  // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+  int map_sfixed32_sfixed32_size() const;
+  private:
+  int _internal_map_sfixed32_sfixed32_size() const;
+  public:
+  void clear_map_sfixed32_sfixed32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_map_sfixed32_sfixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_map_sfixed32_sfixed32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map_sfixed32_sfixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map_sfixed32_sfixed32();
+
+  // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+  int map_sfixed64_sfixed64_size() const;
+  private:
+  int _internal_map_sfixed64_sfixed64_size() const;
+  public:
+  void clear_map_sfixed64_sfixed64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_map_sfixed64_sfixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_map_sfixed64_sfixed64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      map_sfixed64_sfixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_map_sfixed64_sfixed64();
+
+  // map<int32, float> map_int32_float = 11;
+  int map_int32_float_size() const;
+  private:
+  int _internal_map_int32_float_size() const;
+  public:
+  void clear_map_int32_float();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+      _internal_map_int32_float() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+      _internal_mutable_map_int32_float();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+      map_int32_float() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+      mutable_map_int32_float();
+
+  // map<int32, double> map_int32_double = 12;
+  int map_int32_double_size() const;
+  private:
+  int _internal_map_int32_double_size() const;
+  public:
+  void clear_map_int32_double();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+      _internal_map_int32_double() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+      _internal_mutable_map_int32_double();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+      map_int32_double() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+      mutable_map_int32_double();
+
+  // map<bool, bool> map_bool_bool = 13;
+  int map_bool_bool_size() const;
+  private:
+  int _internal_map_bool_bool_size() const;
+  public:
+  void clear_map_bool_bool();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+      _internal_map_bool_bool() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+      _internal_mutable_map_bool_bool();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+      map_bool_bool() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+      mutable_map_bool_bool();
+
+  // map<string, string> map_string_string = 14;
+  int map_string_string_size() const;
+  private:
+  int _internal_map_string_string_size() const;
+  public:
+  void clear_map_string_string();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_map_string_string() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_map_string_string();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      map_string_string() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_map_string_string();
+
+  // map<int32, bytes> map_int32_bytes = 15;
+  int map_int32_bytes_size() const;
+  private:
+  int _internal_map_int32_bytes_size() const;
+  public:
+  void clear_map_int32_bytes();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+      _internal_map_int32_bytes() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+      _internal_mutable_map_int32_bytes();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+      map_int32_bytes() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+      mutable_map_int32_bytes();
+
+  // map<int32, .protobuf_unittest.MapEnum> map_int32_enum = 16;
+  int map_int32_enum_size() const;
+  private:
+  int _internal_map_int32_enum_size() const;
+  public:
+  void clear_map_int32_enum();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >&
+      _internal_map_int32_enum() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >*
+      _internal_mutable_map_int32_enum();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >&
+      map_int32_enum() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >*
+      mutable_map_int32_enum();
+
+  // map<int32, .protobuf_unittest.ForeignMessage> map_int32_foreign_message = 17;
+  int map_int32_foreign_message_size() const;
+  private:
+  int _internal_map_int32_foreign_message_size() const;
+  public:
+  void clear_map_int32_foreign_message();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >&
+      _internal_map_int32_foreign_message() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >*
+      _internal_mutable_map_int32_foreign_message();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >&
+      map_int32_foreign_message() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >*
+      mutable_map_int32_foreign_message();
+
+  // map<string, .protobuf_unittest.ForeignMessage> map_string_foreign_message = 18;
+  int map_string_foreign_message_size() const;
+  private:
+  int _internal_map_string_foreign_message_size() const;
+  public:
+  void clear_map_string_foreign_message();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::ForeignMessage >&
+      _internal_map_string_foreign_message() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::ForeignMessage >*
+      _internal_mutable_map_string_foreign_message();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::ForeignMessage >&
+      map_string_foreign_message() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::ForeignMessage >*
+      mutable_map_string_foreign_message();
+
+  // map<int32, .protobuf_unittest.TestAllTypes> map_int32_all_types = 19;
+  int map_int32_all_types_size() const;
+  private:
+  int _internal_map_int32_all_types_size() const;
+  public:
+  void clear_map_int32_all_types();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >&
+      _internal_map_int32_all_types() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >*
+      _internal_mutable_map_int32_all_types();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >&
+      map_int32_all_types() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >*
+      mutable_map_int32_all_types();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMap)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapInt32Int32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      0 > map_int32_int32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapInt64Int64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+      0 > map_int64_int64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapUint32Uint32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+      0 > map_uint32_uint32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapUint64Uint64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+      0 > map_uint64_uint64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapSint32Sint32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+      0 > map_sint32_sint32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapSint64Sint64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+      0 > map_sint64_sint64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapFixed32Fixed32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+      0 > map_fixed32_fixed32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapFixed64Fixed64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+      0 > map_fixed64_fixed64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapSfixed32Sfixed32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+      0 > map_sfixed32_sfixed32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapSfixed64Sfixed64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+      0 > map_sfixed64_sfixed64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapInt32FloatEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, float,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+      0 > map_int32_float_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapInt32DoubleEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, double,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE,
+      0 > map_int32_double_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapBoolBoolEntry_DoNotUse,
+      bool, bool,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+      0 > map_bool_bool_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapStringStringEntry_DoNotUse,
+      std::string, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      0 > map_string_string_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapInt32BytesEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES,
+      0 > map_int32_bytes_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapInt32EnumEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+      0 > map_int32_enum_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapInt32ForeignMessageEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > map_int32_foreign_message_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapStringForeignMessageEntry_DoNotUse,
+      std::string, ::protobuf_unittest::ForeignMessage,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > map_string_foreign_message_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMap_MapInt32AllTypesEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > map_int32_all_types_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMapSubmessage PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestMapSubmessage) */ {
+ public:
+  inline TestMapSubmessage() : TestMapSubmessage(nullptr) {};
+  virtual ~TestMapSubmessage();
+
+  TestMapSubmessage(const TestMapSubmessage& from);
+  TestMapSubmessage(TestMapSubmessage&& from) noexcept
+    : TestMapSubmessage() {
+    *this = ::std::move(from);
+  }
+
+  inline TestMapSubmessage& operator=(const TestMapSubmessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestMapSubmessage& operator=(TestMapSubmessage&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestMapSubmessage& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestMapSubmessage* internal_default_instance() {
+    return reinterpret_cast<const TestMapSubmessage*>(
+               &_TestMapSubmessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(TestMapSubmessage& a, TestMapSubmessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestMapSubmessage* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestMapSubmessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestMapSubmessage* New() const final {
+    return CreateMaybeMessage<TestMapSubmessage>(nullptr);
+  }
+
+  TestMapSubmessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestMapSubmessage>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestMapSubmessage& from);
+  void MergeFrom(const TestMapSubmessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestMapSubmessage* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestMapSubmessage";
+  }
+  protected:
+  explicit TestMapSubmessage(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTestMapFieldNumber = 1,
+  };
+  // .protobuf_unittest.TestMap test_map = 1;
+  bool has_test_map() const;
+  private:
+  bool _internal_has_test_map() const;
+  public:
+  void clear_test_map();
+  const ::protobuf_unittest::TestMap& test_map() const;
+  ::protobuf_unittest::TestMap* release_test_map();
+  ::protobuf_unittest::TestMap* mutable_test_map();
+  void set_allocated_test_map(::protobuf_unittest::TestMap* test_map);
+  private:
+  const ::protobuf_unittest::TestMap& _internal_test_map() const;
+  ::protobuf_unittest::TestMap* _internal_mutable_test_map();
+  public:
+  void unsafe_arena_set_allocated_test_map(
+      ::protobuf_unittest::TestMap* test_map);
+  ::protobuf_unittest::TestMap* unsafe_arena_release_test_map();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMapSubmessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::protobuf_unittest::TestMap* test_map_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMessageMap_MapInt32MessageEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMessageMap_MapInt32MessageEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestMessageMap_MapInt32MessageEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  TestMessageMap_MapInt32MessageEntry_DoNotUse();
+  explicit TestMessageMap_MapInt32MessageEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestMessageMap_MapInt32MessageEntry_DoNotUse& other);
+  static const TestMessageMap_MapInt32MessageEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestMessageMap_MapInt32MessageEntry_DoNotUse*>(&_TestMessageMap_MapInt32MessageEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[21];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestMessageMap PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestMessageMap) */ {
+ public:
+  inline TestMessageMap() : TestMessageMap(nullptr) {};
+  virtual ~TestMessageMap();
+
+  TestMessageMap(const TestMessageMap& from);
+  TestMessageMap(TestMessageMap&& from) noexcept
+    : TestMessageMap() {
+    *this = ::std::move(from);
+  }
+
+  inline TestMessageMap& operator=(const TestMessageMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestMessageMap& operator=(TestMessageMap&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestMessageMap& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestMessageMap* internal_default_instance() {
+    return reinterpret_cast<const TestMessageMap*>(
+               &_TestMessageMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(TestMessageMap& a, TestMessageMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestMessageMap* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestMessageMap* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestMessageMap* New() const final {
+    return CreateMaybeMessage<TestMessageMap>(nullptr);
+  }
+
+  TestMessageMap* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestMessageMap>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestMessageMap& from);
+  void MergeFrom(const TestMessageMap& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestMessageMap* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestMessageMap";
+  }
+  protected:
+  explicit TestMessageMap(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapInt32MessageFieldNumber = 1,
+  };
+  // map<int32, .protobuf_unittest.TestAllTypes> map_int32_message = 1;
+  int map_int32_message_size() const;
+  private:
+  int _internal_map_int32_message_size() const;
+  public:
+  void clear_map_int32_message();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >&
+      _internal_map_int32_message() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >*
+      _internal_mutable_map_int32_message();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >&
+      map_int32_message() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >*
+      mutable_map_int32_message();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestMessageMap)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestMessageMap_MapInt32MessageEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > map_int32_message_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestSameTypeMap_Map1Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestSameTypeMap_Map1Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestSameTypeMap_Map1Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > SuperType;
+  TestSameTypeMap_Map1Entry_DoNotUse();
+  explicit TestSameTypeMap_Map1Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestSameTypeMap_Map1Entry_DoNotUse& other);
+  static const TestSameTypeMap_Map1Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestSameTypeMap_Map1Entry_DoNotUse*>(&_TestSameTypeMap_Map1Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[23];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestSameTypeMap_Map2Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestSameTypeMap_Map2Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestSameTypeMap_Map2Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > SuperType;
+  TestSameTypeMap_Map2Entry_DoNotUse();
+  explicit TestSameTypeMap_Map2Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestSameTypeMap_Map2Entry_DoNotUse& other);
+  static const TestSameTypeMap_Map2Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestSameTypeMap_Map2Entry_DoNotUse*>(&_TestSameTypeMap_Map2Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[24];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestSameTypeMap PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestSameTypeMap) */ {
+ public:
+  inline TestSameTypeMap() : TestSameTypeMap(nullptr) {};
+  virtual ~TestSameTypeMap();
+
+  TestSameTypeMap(const TestSameTypeMap& from);
+  TestSameTypeMap(TestSameTypeMap&& from) noexcept
+    : TestSameTypeMap() {
+    *this = ::std::move(from);
+  }
+
+  inline TestSameTypeMap& operator=(const TestSameTypeMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestSameTypeMap& operator=(TestSameTypeMap&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestSameTypeMap& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestSameTypeMap* internal_default_instance() {
+    return reinterpret_cast<const TestSameTypeMap*>(
+               &_TestSameTypeMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(TestSameTypeMap& a, TestSameTypeMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestSameTypeMap* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestSameTypeMap* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestSameTypeMap* New() const final {
+    return CreateMaybeMessage<TestSameTypeMap>(nullptr);
+  }
+
+  TestSameTypeMap* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestSameTypeMap>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestSameTypeMap& from);
+  void MergeFrom(const TestSameTypeMap& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestSameTypeMap* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestSameTypeMap";
+  }
+  protected:
+  explicit TestSameTypeMap(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMap1FieldNumber = 1,
+    kMap2FieldNumber = 2,
+  };
+  // map<int32, int32> map1 = 1;
+  int map1_size() const;
+  private:
+  int _internal_map1_size() const;
+  public:
+  void clear_map1();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_map1() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_map1();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map1() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map1();
+
+  // map<int32, int32> map2 = 2;
+  int map2_size() const;
+  private:
+  int _internal_map2_size() const;
+  public:
+  void clear_map2();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_map2() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_map2();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map2() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map2();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestSameTypeMap)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestSameTypeMap_Map1Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      0 > map1_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestSameTypeMap_Map2Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      0 > map2_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestRequiredMessageMap_MapFieldEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestRequiredMessageMap_MapFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequired,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestRequiredMessageMap_MapFieldEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequired,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  TestRequiredMessageMap_MapFieldEntry_DoNotUse();
+  explicit TestRequiredMessageMap_MapFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestRequiredMessageMap_MapFieldEntry_DoNotUse& other);
+  static const TestRequiredMessageMap_MapFieldEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestRequiredMessageMap_MapFieldEntry_DoNotUse*>(&_TestRequiredMessageMap_MapFieldEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[26];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestRequiredMessageMap PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestRequiredMessageMap) */ {
+ public:
+  inline TestRequiredMessageMap() : TestRequiredMessageMap(nullptr) {};
+  virtual ~TestRequiredMessageMap();
+
+  TestRequiredMessageMap(const TestRequiredMessageMap& from);
+  TestRequiredMessageMap(TestRequiredMessageMap&& from) noexcept
+    : TestRequiredMessageMap() {
+    *this = ::std::move(from);
+  }
+
+  inline TestRequiredMessageMap& operator=(const TestRequiredMessageMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestRequiredMessageMap& operator=(TestRequiredMessageMap&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestRequiredMessageMap& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestRequiredMessageMap* internal_default_instance() {
+    return reinterpret_cast<const TestRequiredMessageMap*>(
+               &_TestRequiredMessageMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(TestRequiredMessageMap& a, TestRequiredMessageMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestRequiredMessageMap* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestRequiredMessageMap* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestRequiredMessageMap* New() const final {
+    return CreateMaybeMessage<TestRequiredMessageMap>(nullptr);
+  }
+
+  TestRequiredMessageMap* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestRequiredMessageMap>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestRequiredMessageMap& from);
+  void MergeFrom(const TestRequiredMessageMap& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestRequiredMessageMap* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestRequiredMessageMap";
+  }
+  protected:
+  explicit TestRequiredMessageMap(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapFieldFieldNumber = 1,
+  };
+  // map<int32, .protobuf_unittest.TestRequired> map_field = 1;
+  int map_field_size() const;
+  private:
+  int _internal_map_field_size() const;
+  public:
+  void clear_map_field();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequired >&
+      _internal_map_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequired >*
+      _internal_mutable_map_field();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequired >&
+      map_field() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequired >*
+      mutable_map_field();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestRequiredMessageMap)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestRequiredMessageMap_MapFieldEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequired,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > map_field_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapInt32Int32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapInt32Int32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapInt32Int32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > SuperType;
+  TestArenaMap_MapInt32Int32Entry_DoNotUse();
+  explicit TestArenaMap_MapInt32Int32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapInt32Int32Entry_DoNotUse& other);
+  static const TestArenaMap_MapInt32Int32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapInt32Int32Entry_DoNotUse*>(&_TestArenaMap_MapInt32Int32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[28];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapInt64Int64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapInt64Int64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapInt64Int64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+    0 > SuperType;
+  TestArenaMap_MapInt64Int64Entry_DoNotUse();
+  explicit TestArenaMap_MapInt64Int64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapInt64Int64Entry_DoNotUse& other);
+  static const TestArenaMap_MapInt64Int64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapInt64Int64Entry_DoNotUse*>(&_TestArenaMap_MapInt64Int64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[29];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapUint32Uint32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapUint32Uint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapUint32Uint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    0 > SuperType;
+  TestArenaMap_MapUint32Uint32Entry_DoNotUse();
+  explicit TestArenaMap_MapUint32Uint32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapUint32Uint32Entry_DoNotUse& other);
+  static const TestArenaMap_MapUint32Uint32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapUint32Uint32Entry_DoNotUse*>(&_TestArenaMap_MapUint32Uint32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[30];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapUint64Uint64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapUint64Uint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapUint64Uint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    0 > SuperType;
+  TestArenaMap_MapUint64Uint64Entry_DoNotUse();
+  explicit TestArenaMap_MapUint64Uint64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapUint64Uint64Entry_DoNotUse& other);
+  static const TestArenaMap_MapUint64Uint64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapUint64Uint64Entry_DoNotUse*>(&_TestArenaMap_MapUint64Uint64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[31];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapSint32Sint32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapSint32Sint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapSint32Sint32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+    0 > SuperType;
+  TestArenaMap_MapSint32Sint32Entry_DoNotUse();
+  explicit TestArenaMap_MapSint32Sint32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapSint32Sint32Entry_DoNotUse& other);
+  static const TestArenaMap_MapSint32Sint32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapSint32Sint32Entry_DoNotUse*>(&_TestArenaMap_MapSint32Sint32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[32];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapSint64Sint64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapSint64Sint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapSint64Sint64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+    0 > SuperType;
+  TestArenaMap_MapSint64Sint64Entry_DoNotUse();
+  explicit TestArenaMap_MapSint64Sint64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapSint64Sint64Entry_DoNotUse& other);
+  static const TestArenaMap_MapSint64Sint64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapSint64Sint64Entry_DoNotUse*>(&_TestArenaMap_MapSint64Sint64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[33];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapFixed32Fixed32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapFixed32Fixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapFixed32Fixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+    0 > SuperType;
+  TestArenaMap_MapFixed32Fixed32Entry_DoNotUse();
+  explicit TestArenaMap_MapFixed32Fixed32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapFixed32Fixed32Entry_DoNotUse& other);
+  static const TestArenaMap_MapFixed32Fixed32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapFixed32Fixed32Entry_DoNotUse*>(&_TestArenaMap_MapFixed32Fixed32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[34];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapFixed64Fixed64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapFixed64Fixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapFixed64Fixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+    0 > SuperType;
+  TestArenaMap_MapFixed64Fixed64Entry_DoNotUse();
+  explicit TestArenaMap_MapFixed64Fixed64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapFixed64Fixed64Entry_DoNotUse& other);
+  static const TestArenaMap_MapFixed64Fixed64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapFixed64Fixed64Entry_DoNotUse*>(&_TestArenaMap_MapFixed64Fixed64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[35];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+    0 > SuperType;
+  TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse();
+  explicit TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse& other);
+  static const TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse*>(&_TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[36];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+    0 > SuperType;
+  TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse();
+  explicit TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse& other);
+  static const TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse*>(&_TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[37];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapInt32FloatEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapInt32FloatEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, float,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapInt32FloatEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, float,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+    0 > SuperType;
+  TestArenaMap_MapInt32FloatEntry_DoNotUse();
+  explicit TestArenaMap_MapInt32FloatEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapInt32FloatEntry_DoNotUse& other);
+  static const TestArenaMap_MapInt32FloatEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapInt32FloatEntry_DoNotUse*>(&_TestArenaMap_MapInt32FloatEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[38];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapInt32DoubleEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapInt32DoubleEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, double,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapInt32DoubleEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, double,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE,
+    0 > SuperType;
+  TestArenaMap_MapInt32DoubleEntry_DoNotUse();
+  explicit TestArenaMap_MapInt32DoubleEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapInt32DoubleEntry_DoNotUse& other);
+  static const TestArenaMap_MapInt32DoubleEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapInt32DoubleEntry_DoNotUse*>(&_TestArenaMap_MapInt32DoubleEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[39];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapBoolBoolEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapBoolBoolEntry_DoNotUse, 
+    bool, bool,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapBoolBoolEntry_DoNotUse, 
+    bool, bool,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+    0 > SuperType;
+  TestArenaMap_MapBoolBoolEntry_DoNotUse();
+  explicit TestArenaMap_MapBoolBoolEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapBoolBoolEntry_DoNotUse& other);
+  static const TestArenaMap_MapBoolBoolEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapBoolBoolEntry_DoNotUse*>(&_TestArenaMap_MapBoolBoolEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[40];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapStringStringEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapStringStringEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapStringStringEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > SuperType;
+  TestArenaMap_MapStringStringEntry_DoNotUse();
+  explicit TestArenaMap_MapStringStringEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapStringStringEntry_DoNotUse& other);
+  static const TestArenaMap_MapStringStringEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapStringStringEntry_DoNotUse*>(&_TestArenaMap_MapStringStringEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "protobuf_unittest.TestArenaMap.MapStringStringEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "protobuf_unittest.TestArenaMap.MapStringStringEntry.value");
+ }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[41];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapInt32BytesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapInt32BytesEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapInt32BytesEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES,
+    0 > SuperType;
+  TestArenaMap_MapInt32BytesEntry_DoNotUse();
+  explicit TestArenaMap_MapInt32BytesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapInt32BytesEntry_DoNotUse& other);
+  static const TestArenaMap_MapInt32BytesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapInt32BytesEntry_DoNotUse*>(&_TestArenaMap_MapInt32BytesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[42];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapInt32EnumEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapInt32EnumEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapInt32EnumEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+    0 > SuperType;
+  TestArenaMap_MapInt32EnumEntry_DoNotUse();
+  explicit TestArenaMap_MapInt32EnumEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapInt32EnumEntry_DoNotUse& other);
+  static const TestArenaMap_MapInt32EnumEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapInt32EnumEntry_DoNotUse*>(&_TestArenaMap_MapInt32EnumEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[43];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse();
+  explicit TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse& other);
+  static const TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse*>(&_TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[44];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestArenaMap PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestArenaMap) */ {
+ public:
+  inline TestArenaMap() : TestArenaMap(nullptr) {};
+  virtual ~TestArenaMap();
+
+  TestArenaMap(const TestArenaMap& from);
+  TestArenaMap(TestArenaMap&& from) noexcept
+    : TestArenaMap() {
+    *this = ::std::move(from);
+  }
+
+  inline TestArenaMap& operator=(const TestArenaMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestArenaMap& operator=(TestArenaMap&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestArenaMap& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestArenaMap* internal_default_instance() {
+    return reinterpret_cast<const TestArenaMap*>(
+               &_TestArenaMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    45;
+
+  friend void swap(TestArenaMap& a, TestArenaMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestArenaMap* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestArenaMap* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestArenaMap* New() const final {
+    return CreateMaybeMessage<TestArenaMap>(nullptr);
+  }
+
+  TestArenaMap* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestArenaMap>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestArenaMap& from);
+  void MergeFrom(const TestArenaMap& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestArenaMap* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestArenaMap";
+  }
+  protected:
+  explicit TestArenaMap(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapInt32Int32FieldNumber = 1,
+    kMapInt64Int64FieldNumber = 2,
+    kMapUint32Uint32FieldNumber = 3,
+    kMapUint64Uint64FieldNumber = 4,
+    kMapSint32Sint32FieldNumber = 5,
+    kMapSint64Sint64FieldNumber = 6,
+    kMapFixed32Fixed32FieldNumber = 7,
+    kMapFixed64Fixed64FieldNumber = 8,
+    kMapSfixed32Sfixed32FieldNumber = 9,
+    kMapSfixed64Sfixed64FieldNumber = 10,
+    kMapInt32FloatFieldNumber = 11,
+    kMapInt32DoubleFieldNumber = 12,
+    kMapBoolBoolFieldNumber = 13,
+    kMapStringStringFieldNumber = 14,
+    kMapInt32BytesFieldNumber = 15,
+    kMapInt32EnumFieldNumber = 16,
+    kMapInt32ForeignMessageFieldNumber = 17,
+  };
+  // map<int32, int32> map_int32_int32 = 1;
+  int map_int32_int32_size() const;
+  private:
+  int _internal_map_int32_int32_size() const;
+  public:
+  void clear_map_int32_int32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_map_int32_int32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_map_int32_int32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map_int32_int32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map_int32_int32();
+
+  // map<int64, int64> map_int64_int64 = 2;
+  int map_int64_int64_size() const;
+  private:
+  int _internal_map_int64_int64_size() const;
+  public:
+  void clear_map_int64_int64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_map_int64_int64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_map_int64_int64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      map_int64_int64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_map_int64_int64();
+
+  // map<uint32, uint32> map_uint32_uint32 = 3;
+  int map_uint32_uint32_size() const;
+  private:
+  int _internal_map_uint32_uint32_size() const;
+  public:
+  void clear_map_uint32_uint32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_map_uint32_uint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_map_uint32_uint32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      map_uint32_uint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_map_uint32_uint32();
+
+  // map<uint64, uint64> map_uint64_uint64 = 4;
+  int map_uint64_uint64_size() const;
+  private:
+  int _internal_map_uint64_uint64_size() const;
+  public:
+  void clear_map_uint64_uint64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_map_uint64_uint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_map_uint64_uint64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      map_uint64_uint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_map_uint64_uint64();
+
+  // map<sint32, sint32> map_sint32_sint32 = 5;
+  int map_sint32_sint32_size() const;
+  private:
+  int _internal_map_sint32_sint32_size() const;
+  public:
+  void clear_map_sint32_sint32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_map_sint32_sint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_map_sint32_sint32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map_sint32_sint32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map_sint32_sint32();
+
+  // map<sint64, sint64> map_sint64_sint64 = 6;
+  int map_sint64_sint64_size() const;
+  private:
+  int _internal_map_sint64_sint64_size() const;
+  public:
+  void clear_map_sint64_sint64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_map_sint64_sint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_map_sint64_sint64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      map_sint64_sint64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_map_sint64_sint64();
+
+  // map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+  int map_fixed32_fixed32_size() const;
+  private:
+  int _internal_map_fixed32_fixed32_size() const;
+  public:
+  void clear_map_fixed32_fixed32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_map_fixed32_fixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_map_fixed32_fixed32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      map_fixed32_fixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_map_fixed32_fixed32();
+
+  // map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+  int map_fixed64_fixed64_size() const;
+  private:
+  int _internal_map_fixed64_fixed64_size() const;
+  public:
+  void clear_map_fixed64_fixed64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_map_fixed64_fixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_map_fixed64_fixed64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      map_fixed64_fixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_map_fixed64_fixed64();
+
+  // map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+  int map_sfixed32_sfixed32_size() const;
+  private:
+  int _internal_map_sfixed32_sfixed32_size() const;
+  public:
+  void clear_map_sfixed32_sfixed32();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_map_sfixed32_sfixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_map_sfixed32_sfixed32();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      map_sfixed32_sfixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_map_sfixed32_sfixed32();
+
+  // map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+  int map_sfixed64_sfixed64_size() const;
+  private:
+  int _internal_map_sfixed64_sfixed64_size() const;
+  public:
+  void clear_map_sfixed64_sfixed64();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_map_sfixed64_sfixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_map_sfixed64_sfixed64();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+      map_sfixed64_sfixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_map_sfixed64_sfixed64();
+
+  // map<int32, float> map_int32_float = 11;
+  int map_int32_float_size() const;
+  private:
+  int _internal_map_int32_float_size() const;
+  public:
+  void clear_map_int32_float();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+      _internal_map_int32_float() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+      _internal_mutable_map_int32_float();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+      map_int32_float() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+      mutable_map_int32_float();
+
+  // map<int32, double> map_int32_double = 12;
+  int map_int32_double_size() const;
+  private:
+  int _internal_map_int32_double_size() const;
+  public:
+  void clear_map_int32_double();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+      _internal_map_int32_double() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+      _internal_mutable_map_int32_double();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+      map_int32_double() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+      mutable_map_int32_double();
+
+  // map<bool, bool> map_bool_bool = 13;
+  int map_bool_bool_size() const;
+  private:
+  int _internal_map_bool_bool_size() const;
+  public:
+  void clear_map_bool_bool();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+      _internal_map_bool_bool() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+      _internal_mutable_map_bool_bool();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+      map_bool_bool() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+      mutable_map_bool_bool();
+
+  // map<string, string> map_string_string = 14;
+  int map_string_string_size() const;
+  private:
+  int _internal_map_string_string_size() const;
+  public:
+  void clear_map_string_string();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_map_string_string() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_map_string_string();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      map_string_string() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_map_string_string();
+
+  // map<int32, bytes> map_int32_bytes = 15;
+  int map_int32_bytes_size() const;
+  private:
+  int _internal_map_int32_bytes_size() const;
+  public:
+  void clear_map_int32_bytes();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+      _internal_map_int32_bytes() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+      _internal_mutable_map_int32_bytes();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+      map_int32_bytes() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+      mutable_map_int32_bytes();
+
+  // map<int32, .protobuf_unittest.MapEnum> map_int32_enum = 16;
+  int map_int32_enum_size() const;
+  private:
+  int _internal_map_int32_enum_size() const;
+  public:
+  void clear_map_int32_enum();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >&
+      _internal_map_int32_enum() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >*
+      _internal_mutable_map_int32_enum();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >&
+      map_int32_enum() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >*
+      mutable_map_int32_enum();
+
+  // map<int32, .protobuf_unittest.ForeignMessage> map_int32_foreign_message = 17;
+  int map_int32_foreign_message_size() const;
+  private:
+  int _internal_map_int32_foreign_message_size() const;
+  public:
+  void clear_map_int32_foreign_message();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >&
+      _internal_map_int32_foreign_message() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >*
+      _internal_mutable_map_int32_foreign_message();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >&
+      map_int32_foreign_message() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >*
+      mutable_map_int32_foreign_message();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestArenaMap)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapInt32Int32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      0 > map_int32_int32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapInt64Int64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64,
+      0 > map_int64_int64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapUint32Uint32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+      0 > map_uint32_uint32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapUint64Uint64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+      0 > map_uint64_uint64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapSint32Sint32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT32,
+      0 > map_sint32_sint32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapSint64Sint64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SINT64,
+      0 > map_sint64_sint64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapFixed32Fixed32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED32,
+      0 > map_fixed32_fixed32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapFixed64Fixed64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FIXED64,
+      0 > map_fixed64_fixed64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapSfixed32Sfixed32Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED32,
+      0 > map_sfixed32_sfixed32_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapSfixed64Sfixed64Entry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_SFIXED64,
+      0 > map_sfixed64_sfixed64_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapInt32FloatEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, float,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT,
+      0 > map_int32_float_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapInt32DoubleEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, double,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE,
+      0 > map_int32_double_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapBoolBoolEntry_DoNotUse,
+      bool, bool,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL,
+      0 > map_bool_bool_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapStringStringEntry_DoNotUse,
+      std::string, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      0 > map_string_string_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapInt32BytesEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES,
+      0 > map_int32_bytes_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapInt32EnumEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM,
+      0 > map_int32_enum_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestArenaMap_MapInt32ForeignMessageEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > map_int32_foreign_message_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MessageContainingEnumCalledType_TypeEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MessageContainingEnumCalledType_TypeEntry_DoNotUse, 
+    std::string, ::protobuf_unittest::MessageContainingEnumCalledType,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MessageContainingEnumCalledType_TypeEntry_DoNotUse, 
+    std::string, ::protobuf_unittest::MessageContainingEnumCalledType,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  MessageContainingEnumCalledType_TypeEntry_DoNotUse();
+  explicit MessageContainingEnumCalledType_TypeEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MessageContainingEnumCalledType_TypeEntry_DoNotUse& other);
+  static const MessageContainingEnumCalledType_TypeEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MessageContainingEnumCalledType_TypeEntry_DoNotUse*>(&_MessageContainingEnumCalledType_TypeEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "protobuf_unittest.MessageContainingEnumCalledType.TypeEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[46];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class MessageContainingEnumCalledType PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.MessageContainingEnumCalledType) */ {
+ public:
+  inline MessageContainingEnumCalledType() : MessageContainingEnumCalledType(nullptr) {};
+  virtual ~MessageContainingEnumCalledType();
+
+  MessageContainingEnumCalledType(const MessageContainingEnumCalledType& from);
+  MessageContainingEnumCalledType(MessageContainingEnumCalledType&& from) noexcept
+    : MessageContainingEnumCalledType() {
+    *this = ::std::move(from);
+  }
+
+  inline MessageContainingEnumCalledType& operator=(const MessageContainingEnumCalledType& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MessageContainingEnumCalledType& operator=(MessageContainingEnumCalledType&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const MessageContainingEnumCalledType& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const MessageContainingEnumCalledType* internal_default_instance() {
+    return reinterpret_cast<const MessageContainingEnumCalledType*>(
+               &_MessageContainingEnumCalledType_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    47;
+
+  friend void swap(MessageContainingEnumCalledType& a, MessageContainingEnumCalledType& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MessageContainingEnumCalledType* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MessageContainingEnumCalledType* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MessageContainingEnumCalledType* New() const final {
+    return CreateMaybeMessage<MessageContainingEnumCalledType>(nullptr);
+  }
+
+  MessageContainingEnumCalledType* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<MessageContainingEnumCalledType>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const MessageContainingEnumCalledType& from);
+  void MergeFrom(const MessageContainingEnumCalledType& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MessageContainingEnumCalledType* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.MessageContainingEnumCalledType";
+  }
+  protected:
+  explicit MessageContainingEnumCalledType(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+
+  typedef MessageContainingEnumCalledType_Type Type;
+  static constexpr Type TYPE_FOO =
+    MessageContainingEnumCalledType_Type_TYPE_FOO;
+  static inline bool Type_IsValid(int value) {
+    return MessageContainingEnumCalledType_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    MessageContainingEnumCalledType_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    MessageContainingEnumCalledType_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    MessageContainingEnumCalledType_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return MessageContainingEnumCalledType_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return MessageContainingEnumCalledType_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return MessageContainingEnumCalledType_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTypeFieldNumber = 1,
+  };
+  // map<string, .protobuf_unittest.MessageContainingEnumCalledType> type = 1;
+  int type_size() const;
+  private:
+  int _internal_type_size() const;
+  public:
+  void clear_type();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::MessageContainingEnumCalledType >&
+      _internal_type() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::MessageContainingEnumCalledType >*
+      _internal_mutable_type();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::MessageContainingEnumCalledType >&
+      type() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::MessageContainingEnumCalledType >*
+      mutable_type();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.MessageContainingEnumCalledType)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MessageContainingEnumCalledType_TypeEntry_DoNotUse,
+      std::string, ::protobuf_unittest::MessageContainingEnumCalledType,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > type_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MessageContainingMapCalledEntry_EntryEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MessageContainingMapCalledEntry_EntryEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MessageContainingMapCalledEntry_EntryEntry_DoNotUse, 
+    ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    0 > SuperType;
+  MessageContainingMapCalledEntry_EntryEntry_DoNotUse();
+  explicit MessageContainingMapCalledEntry_EntryEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MessageContainingMapCalledEntry_EntryEntry_DoNotUse& other);
+  static const MessageContainingMapCalledEntry_EntryEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MessageContainingMapCalledEntry_EntryEntry_DoNotUse*>(&_MessageContainingMapCalledEntry_EntryEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[48];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class MessageContainingMapCalledEntry PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.MessageContainingMapCalledEntry) */ {
+ public:
+  inline MessageContainingMapCalledEntry() : MessageContainingMapCalledEntry(nullptr) {};
+  virtual ~MessageContainingMapCalledEntry();
+
+  MessageContainingMapCalledEntry(const MessageContainingMapCalledEntry& from);
+  MessageContainingMapCalledEntry(MessageContainingMapCalledEntry&& from) noexcept
+    : MessageContainingMapCalledEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline MessageContainingMapCalledEntry& operator=(const MessageContainingMapCalledEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MessageContainingMapCalledEntry& operator=(MessageContainingMapCalledEntry&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const MessageContainingMapCalledEntry& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const MessageContainingMapCalledEntry* internal_default_instance() {
+    return reinterpret_cast<const MessageContainingMapCalledEntry*>(
+               &_MessageContainingMapCalledEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    49;
+
+  friend void swap(MessageContainingMapCalledEntry& a, MessageContainingMapCalledEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MessageContainingMapCalledEntry* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MessageContainingMapCalledEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MessageContainingMapCalledEntry* New() const final {
+    return CreateMaybeMessage<MessageContainingMapCalledEntry>(nullptr);
+  }
+
+  MessageContainingMapCalledEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<MessageContainingMapCalledEntry>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const MessageContainingMapCalledEntry& from);
+  void MergeFrom(const MessageContainingMapCalledEntry& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MessageContainingMapCalledEntry* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.MessageContainingMapCalledEntry";
+  }
+  protected:
+  explicit MessageContainingMapCalledEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntryFieldNumber = 1,
+  };
+  // map<int32, int32> entry = 1;
+  int entry_size() const;
+  private:
+  int _internal_entry_size() const;
+  public:
+  void clear_entry();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_entry() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_entry();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+      entry() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_entry();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.MessageContainingMapCalledEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      MessageContainingMapCalledEntry_EntryEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+      0 > entry_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5funittest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestRecursiveMapMessage_AEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestRecursiveMapMessage_AEntry_DoNotUse, 
+    std::string, ::protobuf_unittest::TestRecursiveMapMessage,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TestRecursiveMapMessage_AEntry_DoNotUse, 
+    std::string, ::protobuf_unittest::TestRecursiveMapMessage,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  TestRecursiveMapMessage_AEntry_DoNotUse();
+  explicit TestRecursiveMapMessage_AEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TestRecursiveMapMessage_AEntry_DoNotUse& other);
+  static const TestRecursiveMapMessage_AEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TestRecursiveMapMessage_AEntry_DoNotUse*>(&_TestRecursiveMapMessage_AEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "protobuf_unittest.TestRecursiveMapMessage.AEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[50];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class TestRecursiveMapMessage PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestRecursiveMapMessage) */ {
+ public:
+  inline TestRecursiveMapMessage() : TestRecursiveMapMessage(nullptr) {};
+  virtual ~TestRecursiveMapMessage();
+
+  TestRecursiveMapMessage(const TestRecursiveMapMessage& from);
+  TestRecursiveMapMessage(TestRecursiveMapMessage&& from) noexcept
+    : TestRecursiveMapMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline TestRecursiveMapMessage& operator=(const TestRecursiveMapMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestRecursiveMapMessage& operator=(TestRecursiveMapMessage&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestRecursiveMapMessage& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestRecursiveMapMessage* internal_default_instance() {
+    return reinterpret_cast<const TestRecursiveMapMessage*>(
+               &_TestRecursiveMapMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    51;
+
+  friend void swap(TestRecursiveMapMessage& a, TestRecursiveMapMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestRecursiveMapMessage* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestRecursiveMapMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestRecursiveMapMessage* New() const final {
+    return CreateMaybeMessage<TestRecursiveMapMessage>(nullptr);
+  }
+
+  TestRecursiveMapMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestRecursiveMapMessage>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestRecursiveMapMessage& from);
+  void MergeFrom(const TestRecursiveMapMessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestRecursiveMapMessage* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestRecursiveMapMessage";
+  }
+  protected:
+  explicit TestRecursiveMapMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2fmap_5funittest_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAFieldNumber = 1,
+  };
+  // map<string, .protobuf_unittest.TestRecursiveMapMessage> a = 1;
+  int a_size() const;
+  private:
+  int _internal_a_size() const;
+  public:
+  void clear_a();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::TestRecursiveMapMessage >&
+      _internal_a() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::TestRecursiveMapMessage >*
+      _internal_mutable_a();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::TestRecursiveMapMessage >&
+      a() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::TestRecursiveMapMessage >*
+      mutable_a();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestRecursiveMapMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      TestRecursiveMapMessage_AEntry_DoNotUse,
+      std::string, ::protobuf_unittest::TestRecursiveMapMessage,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > a_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2fmap_5funittest_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestMap
+
+// map<int32, int32> map_int32_int32 = 1;
+inline int TestMap::_internal_map_int32_int32_size() const {
+  return map_int32_int32_.size();
+}
+inline int TestMap::map_int32_int32_size() const {
+  return _internal_map_int32_int32_size();
+}
+inline void TestMap::clear_map_int32_int32() {
+  map_int32_int32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestMap::_internal_map_int32_int32() const {
+  return map_int32_int32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestMap::map_int32_int32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_int32_int32)
+  return _internal_map_int32_int32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestMap::_internal_mutable_map_int32_int32() {
+  return map_int32_int32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestMap::mutable_map_int32_int32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_int32_int32)
+  return _internal_mutable_map_int32_int32();
+}
+
+// map<int64, int64> map_int64_int64 = 2;
+inline int TestMap::_internal_map_int64_int64_size() const {
+  return map_int64_int64_.size();
+}
+inline int TestMap::map_int64_int64_size() const {
+  return _internal_map_int64_int64_size();
+}
+inline void TestMap::clear_map_int64_int64() {
+  map_int64_int64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestMap::_internal_map_int64_int64() const {
+  return map_int64_int64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestMap::map_int64_int64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_int64_int64)
+  return _internal_map_int64_int64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestMap::_internal_mutable_map_int64_int64() {
+  return map_int64_int64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestMap::mutable_map_int64_int64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_int64_int64)
+  return _internal_mutable_map_int64_int64();
+}
+
+// map<uint32, uint32> map_uint32_uint32 = 3;
+inline int TestMap::_internal_map_uint32_uint32_size() const {
+  return map_uint32_uint32_.size();
+}
+inline int TestMap::map_uint32_uint32_size() const {
+  return _internal_map_uint32_uint32_size();
+}
+inline void TestMap::clear_map_uint32_uint32() {
+  map_uint32_uint32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestMap::_internal_map_uint32_uint32() const {
+  return map_uint32_uint32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestMap::map_uint32_uint32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_uint32_uint32)
+  return _internal_map_uint32_uint32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestMap::_internal_mutable_map_uint32_uint32() {
+  return map_uint32_uint32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestMap::mutable_map_uint32_uint32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_uint32_uint32)
+  return _internal_mutable_map_uint32_uint32();
+}
+
+// map<uint64, uint64> map_uint64_uint64 = 4;
+inline int TestMap::_internal_map_uint64_uint64_size() const {
+  return map_uint64_uint64_.size();
+}
+inline int TestMap::map_uint64_uint64_size() const {
+  return _internal_map_uint64_uint64_size();
+}
+inline void TestMap::clear_map_uint64_uint64() {
+  map_uint64_uint64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestMap::_internal_map_uint64_uint64() const {
+  return map_uint64_uint64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestMap::map_uint64_uint64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_uint64_uint64)
+  return _internal_map_uint64_uint64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestMap::_internal_mutable_map_uint64_uint64() {
+  return map_uint64_uint64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestMap::mutable_map_uint64_uint64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_uint64_uint64)
+  return _internal_mutable_map_uint64_uint64();
+}
+
+// map<sint32, sint32> map_sint32_sint32 = 5;
+inline int TestMap::_internal_map_sint32_sint32_size() const {
+  return map_sint32_sint32_.size();
+}
+inline int TestMap::map_sint32_sint32_size() const {
+  return _internal_map_sint32_sint32_size();
+}
+inline void TestMap::clear_map_sint32_sint32() {
+  map_sint32_sint32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestMap::_internal_map_sint32_sint32() const {
+  return map_sint32_sint32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestMap::map_sint32_sint32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_sint32_sint32)
+  return _internal_map_sint32_sint32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestMap::_internal_mutable_map_sint32_sint32() {
+  return map_sint32_sint32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestMap::mutable_map_sint32_sint32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_sint32_sint32)
+  return _internal_mutable_map_sint32_sint32();
+}
+
+// map<sint64, sint64> map_sint64_sint64 = 6;
+inline int TestMap::_internal_map_sint64_sint64_size() const {
+  return map_sint64_sint64_.size();
+}
+inline int TestMap::map_sint64_sint64_size() const {
+  return _internal_map_sint64_sint64_size();
+}
+inline void TestMap::clear_map_sint64_sint64() {
+  map_sint64_sint64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestMap::_internal_map_sint64_sint64() const {
+  return map_sint64_sint64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestMap::map_sint64_sint64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_sint64_sint64)
+  return _internal_map_sint64_sint64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestMap::_internal_mutable_map_sint64_sint64() {
+  return map_sint64_sint64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestMap::mutable_map_sint64_sint64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_sint64_sint64)
+  return _internal_mutable_map_sint64_sint64();
+}
+
+// map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+inline int TestMap::_internal_map_fixed32_fixed32_size() const {
+  return map_fixed32_fixed32_.size();
+}
+inline int TestMap::map_fixed32_fixed32_size() const {
+  return _internal_map_fixed32_fixed32_size();
+}
+inline void TestMap::clear_map_fixed32_fixed32() {
+  map_fixed32_fixed32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestMap::_internal_map_fixed32_fixed32() const {
+  return map_fixed32_fixed32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestMap::map_fixed32_fixed32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_fixed32_fixed32)
+  return _internal_map_fixed32_fixed32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestMap::_internal_mutable_map_fixed32_fixed32() {
+  return map_fixed32_fixed32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestMap::mutable_map_fixed32_fixed32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_fixed32_fixed32)
+  return _internal_mutable_map_fixed32_fixed32();
+}
+
+// map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+inline int TestMap::_internal_map_fixed64_fixed64_size() const {
+  return map_fixed64_fixed64_.size();
+}
+inline int TestMap::map_fixed64_fixed64_size() const {
+  return _internal_map_fixed64_fixed64_size();
+}
+inline void TestMap::clear_map_fixed64_fixed64() {
+  map_fixed64_fixed64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestMap::_internal_map_fixed64_fixed64() const {
+  return map_fixed64_fixed64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestMap::map_fixed64_fixed64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_fixed64_fixed64)
+  return _internal_map_fixed64_fixed64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestMap::_internal_mutable_map_fixed64_fixed64() {
+  return map_fixed64_fixed64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestMap::mutable_map_fixed64_fixed64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_fixed64_fixed64)
+  return _internal_mutable_map_fixed64_fixed64();
+}
+
+// map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+inline int TestMap::_internal_map_sfixed32_sfixed32_size() const {
+  return map_sfixed32_sfixed32_.size();
+}
+inline int TestMap::map_sfixed32_sfixed32_size() const {
+  return _internal_map_sfixed32_sfixed32_size();
+}
+inline void TestMap::clear_map_sfixed32_sfixed32() {
+  map_sfixed32_sfixed32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestMap::_internal_map_sfixed32_sfixed32() const {
+  return map_sfixed32_sfixed32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestMap::map_sfixed32_sfixed32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_sfixed32_sfixed32)
+  return _internal_map_sfixed32_sfixed32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestMap::_internal_mutable_map_sfixed32_sfixed32() {
+  return map_sfixed32_sfixed32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestMap::mutable_map_sfixed32_sfixed32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_sfixed32_sfixed32)
+  return _internal_mutable_map_sfixed32_sfixed32();
+}
+
+// map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+inline int TestMap::_internal_map_sfixed64_sfixed64_size() const {
+  return map_sfixed64_sfixed64_.size();
+}
+inline int TestMap::map_sfixed64_sfixed64_size() const {
+  return _internal_map_sfixed64_sfixed64_size();
+}
+inline void TestMap::clear_map_sfixed64_sfixed64() {
+  map_sfixed64_sfixed64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestMap::_internal_map_sfixed64_sfixed64() const {
+  return map_sfixed64_sfixed64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestMap::map_sfixed64_sfixed64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_sfixed64_sfixed64)
+  return _internal_map_sfixed64_sfixed64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestMap::_internal_mutable_map_sfixed64_sfixed64() {
+  return map_sfixed64_sfixed64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestMap::mutable_map_sfixed64_sfixed64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_sfixed64_sfixed64)
+  return _internal_mutable_map_sfixed64_sfixed64();
+}
+
+// map<int32, float> map_int32_float = 11;
+inline int TestMap::_internal_map_int32_float_size() const {
+  return map_int32_float_.size();
+}
+inline int TestMap::map_int32_float_size() const {
+  return _internal_map_int32_float_size();
+}
+inline void TestMap::clear_map_int32_float() {
+  map_int32_float_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+TestMap::_internal_map_int32_float() const {
+  return map_int32_float_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+TestMap::map_int32_float() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_int32_float)
+  return _internal_map_int32_float();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+TestMap::_internal_mutable_map_int32_float() {
+  return map_int32_float_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+TestMap::mutable_map_int32_float() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_int32_float)
+  return _internal_mutable_map_int32_float();
+}
+
+// map<int32, double> map_int32_double = 12;
+inline int TestMap::_internal_map_int32_double_size() const {
+  return map_int32_double_.size();
+}
+inline int TestMap::map_int32_double_size() const {
+  return _internal_map_int32_double_size();
+}
+inline void TestMap::clear_map_int32_double() {
+  map_int32_double_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+TestMap::_internal_map_int32_double() const {
+  return map_int32_double_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+TestMap::map_int32_double() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_int32_double)
+  return _internal_map_int32_double();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+TestMap::_internal_mutable_map_int32_double() {
+  return map_int32_double_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+TestMap::mutable_map_int32_double() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_int32_double)
+  return _internal_mutable_map_int32_double();
+}
+
+// map<bool, bool> map_bool_bool = 13;
+inline int TestMap::_internal_map_bool_bool_size() const {
+  return map_bool_bool_.size();
+}
+inline int TestMap::map_bool_bool_size() const {
+  return _internal_map_bool_bool_size();
+}
+inline void TestMap::clear_map_bool_bool() {
+  map_bool_bool_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+TestMap::_internal_map_bool_bool() const {
+  return map_bool_bool_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+TestMap::map_bool_bool() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_bool_bool)
+  return _internal_map_bool_bool();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+TestMap::_internal_mutable_map_bool_bool() {
+  return map_bool_bool_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+TestMap::mutable_map_bool_bool() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_bool_bool)
+  return _internal_mutable_map_bool_bool();
+}
+
+// map<string, string> map_string_string = 14;
+inline int TestMap::_internal_map_string_string_size() const {
+  return map_string_string_.size();
+}
+inline int TestMap::map_string_string_size() const {
+  return _internal_map_string_string_size();
+}
+inline void TestMap::clear_map_string_string() {
+  map_string_string_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+TestMap::_internal_map_string_string() const {
+  return map_string_string_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+TestMap::map_string_string() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_string_string)
+  return _internal_map_string_string();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+TestMap::_internal_mutable_map_string_string() {
+  return map_string_string_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+TestMap::mutable_map_string_string() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_string_string)
+  return _internal_mutable_map_string_string();
+}
+
+// map<int32, bytes> map_int32_bytes = 15;
+inline int TestMap::_internal_map_int32_bytes_size() const {
+  return map_int32_bytes_.size();
+}
+inline int TestMap::map_int32_bytes_size() const {
+  return _internal_map_int32_bytes_size();
+}
+inline void TestMap::clear_map_int32_bytes() {
+  map_int32_bytes_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+TestMap::_internal_map_int32_bytes() const {
+  return map_int32_bytes_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+TestMap::map_int32_bytes() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_int32_bytes)
+  return _internal_map_int32_bytes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+TestMap::_internal_mutable_map_int32_bytes() {
+  return map_int32_bytes_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+TestMap::mutable_map_int32_bytes() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_int32_bytes)
+  return _internal_mutable_map_int32_bytes();
+}
+
+// map<int32, .protobuf_unittest.MapEnum> map_int32_enum = 16;
+inline int TestMap::_internal_map_int32_enum_size() const {
+  return map_int32_enum_.size();
+}
+inline int TestMap::map_int32_enum_size() const {
+  return _internal_map_int32_enum_size();
+}
+inline void TestMap::clear_map_int32_enum() {
+  map_int32_enum_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >&
+TestMap::_internal_map_int32_enum() const {
+  return map_int32_enum_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >&
+TestMap::map_int32_enum() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_int32_enum)
+  return _internal_map_int32_enum();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >*
+TestMap::_internal_mutable_map_int32_enum() {
+  return map_int32_enum_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >*
+TestMap::mutable_map_int32_enum() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_int32_enum)
+  return _internal_mutable_map_int32_enum();
+}
+
+// map<int32, .protobuf_unittest.ForeignMessage> map_int32_foreign_message = 17;
+inline int TestMap::_internal_map_int32_foreign_message_size() const {
+  return map_int32_foreign_message_.size();
+}
+inline int TestMap::map_int32_foreign_message_size() const {
+  return _internal_map_int32_foreign_message_size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >&
+TestMap::_internal_map_int32_foreign_message() const {
+  return map_int32_foreign_message_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >&
+TestMap::map_int32_foreign_message() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_int32_foreign_message)
+  return _internal_map_int32_foreign_message();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >*
+TestMap::_internal_mutable_map_int32_foreign_message() {
+  return map_int32_foreign_message_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >*
+TestMap::mutable_map_int32_foreign_message() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_int32_foreign_message)
+  return _internal_mutable_map_int32_foreign_message();
+}
+
+// map<string, .protobuf_unittest.ForeignMessage> map_string_foreign_message = 18;
+inline int TestMap::_internal_map_string_foreign_message_size() const {
+  return map_string_foreign_message_.size();
+}
+inline int TestMap::map_string_foreign_message_size() const {
+  return _internal_map_string_foreign_message_size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::ForeignMessage >&
+TestMap::_internal_map_string_foreign_message() const {
+  return map_string_foreign_message_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::ForeignMessage >&
+TestMap::map_string_foreign_message() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_string_foreign_message)
+  return _internal_map_string_foreign_message();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::ForeignMessage >*
+TestMap::_internal_mutable_map_string_foreign_message() {
+  return map_string_foreign_message_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::ForeignMessage >*
+TestMap::mutable_map_string_foreign_message() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_string_foreign_message)
+  return _internal_mutable_map_string_foreign_message();
+}
+
+// map<int32, .protobuf_unittest.TestAllTypes> map_int32_all_types = 19;
+inline int TestMap::_internal_map_int32_all_types_size() const {
+  return map_int32_all_types_.size();
+}
+inline int TestMap::map_int32_all_types_size() const {
+  return _internal_map_int32_all_types_size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >&
+TestMap::_internal_map_int32_all_types() const {
+  return map_int32_all_types_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >&
+TestMap::map_int32_all_types() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMap.map_int32_all_types)
+  return _internal_map_int32_all_types();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >*
+TestMap::_internal_mutable_map_int32_all_types() {
+  return map_int32_all_types_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >*
+TestMap::mutable_map_int32_all_types() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMap.map_int32_all_types)
+  return _internal_mutable_map_int32_all_types();
+}
+
+// -------------------------------------------------------------------
+
+// TestMapSubmessage
+
+// .protobuf_unittest.TestMap test_map = 1;
+inline bool TestMapSubmessage::_internal_has_test_map() const {
+  return this != internal_default_instance() && test_map_ != nullptr;
+}
+inline bool TestMapSubmessage::has_test_map() const {
+  return _internal_has_test_map();
+}
+inline void TestMapSubmessage::clear_test_map() {
+  if (GetArena() == nullptr && test_map_ != nullptr) {
+    delete test_map_;
+  }
+  test_map_ = nullptr;
+}
+inline const ::protobuf_unittest::TestMap& TestMapSubmessage::_internal_test_map() const {
+  const ::protobuf_unittest::TestMap* p = test_map_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::protobuf_unittest::TestMap*>(
+      &::protobuf_unittest::_TestMap_default_instance_);
+}
+inline const ::protobuf_unittest::TestMap& TestMapSubmessage::test_map() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestMapSubmessage.test_map)
+  return _internal_test_map();
+}
+inline void TestMapSubmessage::unsafe_arena_set_allocated_test_map(
+    ::protobuf_unittest::TestMap* test_map) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(test_map_);
+  }
+  test_map_ = test_map;
+  if (test_map) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestMapSubmessage.test_map)
+}
+inline ::protobuf_unittest::TestMap* TestMapSubmessage::release_test_map() {
+  
+  ::protobuf_unittest::TestMap* temp = test_map_;
+  test_map_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::protobuf_unittest::TestMap* TestMapSubmessage::unsafe_arena_release_test_map() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestMapSubmessage.test_map)
+  
+  ::protobuf_unittest::TestMap* temp = test_map_;
+  test_map_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestMap* TestMapSubmessage::_internal_mutable_test_map() {
+  
+  if (test_map_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestMap>(GetArena());
+    test_map_ = p;
+  }
+  return test_map_;
+}
+inline ::protobuf_unittest::TestMap* TestMapSubmessage::mutable_test_map() {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestMapSubmessage.test_map)
+  return _internal_mutable_test_map();
+}
+inline void TestMapSubmessage::set_allocated_test_map(::protobuf_unittest::TestMap* test_map) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete test_map_;
+  }
+  if (test_map) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(test_map);
+    if (message_arena != submessage_arena) {
+      test_map = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, test_map, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  test_map_ = test_map;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestMapSubmessage.test_map)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestMessageMap
+
+// map<int32, .protobuf_unittest.TestAllTypes> map_int32_message = 1;
+inline int TestMessageMap::_internal_map_int32_message_size() const {
+  return map_int32_message_.size();
+}
+inline int TestMessageMap::map_int32_message_size() const {
+  return _internal_map_int32_message_size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >&
+TestMessageMap::_internal_map_int32_message() const {
+  return map_int32_message_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >&
+TestMessageMap::map_int32_message() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestMessageMap.map_int32_message)
+  return _internal_map_int32_message();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >*
+TestMessageMap::_internal_mutable_map_int32_message() {
+  return map_int32_message_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestAllTypes >*
+TestMessageMap::mutable_map_int32_message() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestMessageMap.map_int32_message)
+  return _internal_mutable_map_int32_message();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestSameTypeMap
+
+// map<int32, int32> map1 = 1;
+inline int TestSameTypeMap::_internal_map1_size() const {
+  return map1_.size();
+}
+inline int TestSameTypeMap::map1_size() const {
+  return _internal_map1_size();
+}
+inline void TestSameTypeMap::clear_map1() {
+  map1_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestSameTypeMap::_internal_map1() const {
+  return map1_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestSameTypeMap::map1() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestSameTypeMap.map1)
+  return _internal_map1();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestSameTypeMap::_internal_mutable_map1() {
+  return map1_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestSameTypeMap::mutable_map1() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestSameTypeMap.map1)
+  return _internal_mutable_map1();
+}
+
+// map<int32, int32> map2 = 2;
+inline int TestSameTypeMap::_internal_map2_size() const {
+  return map2_.size();
+}
+inline int TestSameTypeMap::map2_size() const {
+  return _internal_map2_size();
+}
+inline void TestSameTypeMap::clear_map2() {
+  map2_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestSameTypeMap::_internal_map2() const {
+  return map2_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestSameTypeMap::map2() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestSameTypeMap.map2)
+  return _internal_map2();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestSameTypeMap::_internal_mutable_map2() {
+  return map2_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestSameTypeMap::mutable_map2() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestSameTypeMap.map2)
+  return _internal_mutable_map2();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestRequiredMessageMap
+
+// map<int32, .protobuf_unittest.TestRequired> map_field = 1;
+inline int TestRequiredMessageMap::_internal_map_field_size() const {
+  return map_field_.size();
+}
+inline int TestRequiredMessageMap::map_field_size() const {
+  return _internal_map_field_size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequired >&
+TestRequiredMessageMap::_internal_map_field() const {
+  return map_field_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequired >&
+TestRequiredMessageMap::map_field() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestRequiredMessageMap.map_field)
+  return _internal_map_field();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequired >*
+TestRequiredMessageMap::_internal_mutable_map_field() {
+  return map_field_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::TestRequired >*
+TestRequiredMessageMap::mutable_map_field() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestRequiredMessageMap.map_field)
+  return _internal_mutable_map_field();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestArenaMap
+
+// map<int32, int32> map_int32_int32 = 1;
+inline int TestArenaMap::_internal_map_int32_int32_size() const {
+  return map_int32_int32_.size();
+}
+inline int TestArenaMap::map_int32_int32_size() const {
+  return _internal_map_int32_int32_size();
+}
+inline void TestArenaMap::clear_map_int32_int32() {
+  map_int32_int32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestArenaMap::_internal_map_int32_int32() const {
+  return map_int32_int32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestArenaMap::map_int32_int32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_int32_int32)
+  return _internal_map_int32_int32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestArenaMap::_internal_mutable_map_int32_int32() {
+  return map_int32_int32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestArenaMap::mutable_map_int32_int32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_int32_int32)
+  return _internal_mutable_map_int32_int32();
+}
+
+// map<int64, int64> map_int64_int64 = 2;
+inline int TestArenaMap::_internal_map_int64_int64_size() const {
+  return map_int64_int64_.size();
+}
+inline int TestArenaMap::map_int64_int64_size() const {
+  return _internal_map_int64_int64_size();
+}
+inline void TestArenaMap::clear_map_int64_int64() {
+  map_int64_int64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestArenaMap::_internal_map_int64_int64() const {
+  return map_int64_int64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestArenaMap::map_int64_int64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_int64_int64)
+  return _internal_map_int64_int64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestArenaMap::_internal_mutable_map_int64_int64() {
+  return map_int64_int64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestArenaMap::mutable_map_int64_int64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_int64_int64)
+  return _internal_mutable_map_int64_int64();
+}
+
+// map<uint32, uint32> map_uint32_uint32 = 3;
+inline int TestArenaMap::_internal_map_uint32_uint32_size() const {
+  return map_uint32_uint32_.size();
+}
+inline int TestArenaMap::map_uint32_uint32_size() const {
+  return _internal_map_uint32_uint32_size();
+}
+inline void TestArenaMap::clear_map_uint32_uint32() {
+  map_uint32_uint32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestArenaMap::_internal_map_uint32_uint32() const {
+  return map_uint32_uint32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestArenaMap::map_uint32_uint32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_uint32_uint32)
+  return _internal_map_uint32_uint32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestArenaMap::_internal_mutable_map_uint32_uint32() {
+  return map_uint32_uint32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestArenaMap::mutable_map_uint32_uint32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_uint32_uint32)
+  return _internal_mutable_map_uint32_uint32();
+}
+
+// map<uint64, uint64> map_uint64_uint64 = 4;
+inline int TestArenaMap::_internal_map_uint64_uint64_size() const {
+  return map_uint64_uint64_.size();
+}
+inline int TestArenaMap::map_uint64_uint64_size() const {
+  return _internal_map_uint64_uint64_size();
+}
+inline void TestArenaMap::clear_map_uint64_uint64() {
+  map_uint64_uint64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestArenaMap::_internal_map_uint64_uint64() const {
+  return map_uint64_uint64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestArenaMap::map_uint64_uint64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_uint64_uint64)
+  return _internal_map_uint64_uint64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestArenaMap::_internal_mutable_map_uint64_uint64() {
+  return map_uint64_uint64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestArenaMap::mutable_map_uint64_uint64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_uint64_uint64)
+  return _internal_mutable_map_uint64_uint64();
+}
+
+// map<sint32, sint32> map_sint32_sint32 = 5;
+inline int TestArenaMap::_internal_map_sint32_sint32_size() const {
+  return map_sint32_sint32_.size();
+}
+inline int TestArenaMap::map_sint32_sint32_size() const {
+  return _internal_map_sint32_sint32_size();
+}
+inline void TestArenaMap::clear_map_sint32_sint32() {
+  map_sint32_sint32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestArenaMap::_internal_map_sint32_sint32() const {
+  return map_sint32_sint32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestArenaMap::map_sint32_sint32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_sint32_sint32)
+  return _internal_map_sint32_sint32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestArenaMap::_internal_mutable_map_sint32_sint32() {
+  return map_sint32_sint32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestArenaMap::mutable_map_sint32_sint32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_sint32_sint32)
+  return _internal_mutable_map_sint32_sint32();
+}
+
+// map<sint64, sint64> map_sint64_sint64 = 6;
+inline int TestArenaMap::_internal_map_sint64_sint64_size() const {
+  return map_sint64_sint64_.size();
+}
+inline int TestArenaMap::map_sint64_sint64_size() const {
+  return _internal_map_sint64_sint64_size();
+}
+inline void TestArenaMap::clear_map_sint64_sint64() {
+  map_sint64_sint64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestArenaMap::_internal_map_sint64_sint64() const {
+  return map_sint64_sint64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestArenaMap::map_sint64_sint64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_sint64_sint64)
+  return _internal_map_sint64_sint64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestArenaMap::_internal_mutable_map_sint64_sint64() {
+  return map_sint64_sint64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestArenaMap::mutable_map_sint64_sint64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_sint64_sint64)
+  return _internal_mutable_map_sint64_sint64();
+}
+
+// map<fixed32, fixed32> map_fixed32_fixed32 = 7;
+inline int TestArenaMap::_internal_map_fixed32_fixed32_size() const {
+  return map_fixed32_fixed32_.size();
+}
+inline int TestArenaMap::map_fixed32_fixed32_size() const {
+  return _internal_map_fixed32_fixed32_size();
+}
+inline void TestArenaMap::clear_map_fixed32_fixed32() {
+  map_fixed32_fixed32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestArenaMap::_internal_map_fixed32_fixed32() const {
+  return map_fixed32_fixed32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestArenaMap::map_fixed32_fixed32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_fixed32_fixed32)
+  return _internal_map_fixed32_fixed32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestArenaMap::_internal_mutable_map_fixed32_fixed32() {
+  return map_fixed32_fixed32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestArenaMap::mutable_map_fixed32_fixed32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_fixed32_fixed32)
+  return _internal_mutable_map_fixed32_fixed32();
+}
+
+// map<fixed64, fixed64> map_fixed64_fixed64 = 8;
+inline int TestArenaMap::_internal_map_fixed64_fixed64_size() const {
+  return map_fixed64_fixed64_.size();
+}
+inline int TestArenaMap::map_fixed64_fixed64_size() const {
+  return _internal_map_fixed64_fixed64_size();
+}
+inline void TestArenaMap::clear_map_fixed64_fixed64() {
+  map_fixed64_fixed64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestArenaMap::_internal_map_fixed64_fixed64() const {
+  return map_fixed64_fixed64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestArenaMap::map_fixed64_fixed64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_fixed64_fixed64)
+  return _internal_map_fixed64_fixed64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestArenaMap::_internal_mutable_map_fixed64_fixed64() {
+  return map_fixed64_fixed64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestArenaMap::mutable_map_fixed64_fixed64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_fixed64_fixed64)
+  return _internal_mutable_map_fixed64_fixed64();
+}
+
+// map<sfixed32, sfixed32> map_sfixed32_sfixed32 = 9;
+inline int TestArenaMap::_internal_map_sfixed32_sfixed32_size() const {
+  return map_sfixed32_sfixed32_.size();
+}
+inline int TestArenaMap::map_sfixed32_sfixed32_size() const {
+  return _internal_map_sfixed32_sfixed32_size();
+}
+inline void TestArenaMap::clear_map_sfixed32_sfixed32() {
+  map_sfixed32_sfixed32_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestArenaMap::_internal_map_sfixed32_sfixed32() const {
+  return map_sfixed32_sfixed32_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestArenaMap::map_sfixed32_sfixed32() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_sfixed32_sfixed32)
+  return _internal_map_sfixed32_sfixed32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestArenaMap::_internal_mutable_map_sfixed32_sfixed32() {
+  return map_sfixed32_sfixed32_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestArenaMap::mutable_map_sfixed32_sfixed32() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_sfixed32_sfixed32)
+  return _internal_mutable_map_sfixed32_sfixed32();
+}
+
+// map<sfixed64, sfixed64> map_sfixed64_sfixed64 = 10;
+inline int TestArenaMap::_internal_map_sfixed64_sfixed64_size() const {
+  return map_sfixed64_sfixed64_.size();
+}
+inline int TestArenaMap::map_sfixed64_sfixed64_size() const {
+  return _internal_map_sfixed64_sfixed64_size();
+}
+inline void TestArenaMap::clear_map_sfixed64_sfixed64() {
+  map_sfixed64_sfixed64_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestArenaMap::_internal_map_sfixed64_sfixed64() const {
+  return map_sfixed64_sfixed64_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestArenaMap::map_sfixed64_sfixed64() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_sfixed64_sfixed64)
+  return _internal_map_sfixed64_sfixed64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestArenaMap::_internal_mutable_map_sfixed64_sfixed64() {
+  return map_sfixed64_sfixed64_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestArenaMap::mutable_map_sfixed64_sfixed64() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_sfixed64_sfixed64)
+  return _internal_mutable_map_sfixed64_sfixed64();
+}
+
+// map<int32, float> map_int32_float = 11;
+inline int TestArenaMap::_internal_map_int32_float_size() const {
+  return map_int32_float_.size();
+}
+inline int TestArenaMap::map_int32_float_size() const {
+  return _internal_map_int32_float_size();
+}
+inline void TestArenaMap::clear_map_int32_float() {
+  map_int32_float_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+TestArenaMap::_internal_map_int32_float() const {
+  return map_int32_float_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >&
+TestArenaMap::map_int32_float() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_int32_float)
+  return _internal_map_int32_float();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+TestArenaMap::_internal_mutable_map_int32_float() {
+  return map_int32_float_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, float >*
+TestArenaMap::mutable_map_int32_float() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_int32_float)
+  return _internal_mutable_map_int32_float();
+}
+
+// map<int32, double> map_int32_double = 12;
+inline int TestArenaMap::_internal_map_int32_double_size() const {
+  return map_int32_double_.size();
+}
+inline int TestArenaMap::map_int32_double_size() const {
+  return _internal_map_int32_double_size();
+}
+inline void TestArenaMap::clear_map_int32_double() {
+  map_int32_double_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+TestArenaMap::_internal_map_int32_double() const {
+  return map_int32_double_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >&
+TestArenaMap::map_int32_double() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_int32_double)
+  return _internal_map_int32_double();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+TestArenaMap::_internal_mutable_map_int32_double() {
+  return map_int32_double_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, double >*
+TestArenaMap::mutable_map_int32_double() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_int32_double)
+  return _internal_mutable_map_int32_double();
+}
+
+// map<bool, bool> map_bool_bool = 13;
+inline int TestArenaMap::_internal_map_bool_bool_size() const {
+  return map_bool_bool_.size();
+}
+inline int TestArenaMap::map_bool_bool_size() const {
+  return _internal_map_bool_bool_size();
+}
+inline void TestArenaMap::clear_map_bool_bool() {
+  map_bool_bool_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+TestArenaMap::_internal_map_bool_bool() const {
+  return map_bool_bool_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >&
+TestArenaMap::map_bool_bool() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_bool_bool)
+  return _internal_map_bool_bool();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+TestArenaMap::_internal_mutable_map_bool_bool() {
+  return map_bool_bool_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< bool, bool >*
+TestArenaMap::mutable_map_bool_bool() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_bool_bool)
+  return _internal_mutable_map_bool_bool();
+}
+
+// map<string, string> map_string_string = 14;
+inline int TestArenaMap::_internal_map_string_string_size() const {
+  return map_string_string_.size();
+}
+inline int TestArenaMap::map_string_string_size() const {
+  return _internal_map_string_string_size();
+}
+inline void TestArenaMap::clear_map_string_string() {
+  map_string_string_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+TestArenaMap::_internal_map_string_string() const {
+  return map_string_string_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+TestArenaMap::map_string_string() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_string_string)
+  return _internal_map_string_string();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+TestArenaMap::_internal_mutable_map_string_string() {
+  return map_string_string_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+TestArenaMap::mutable_map_string_string() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_string_string)
+  return _internal_mutable_map_string_string();
+}
+
+// map<int32, bytes> map_int32_bytes = 15;
+inline int TestArenaMap::_internal_map_int32_bytes_size() const {
+  return map_int32_bytes_.size();
+}
+inline int TestArenaMap::map_int32_bytes_size() const {
+  return _internal_map_int32_bytes_size();
+}
+inline void TestArenaMap::clear_map_int32_bytes() {
+  map_int32_bytes_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+TestArenaMap::_internal_map_int32_bytes() const {
+  return map_int32_bytes_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >&
+TestArenaMap::map_int32_bytes() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_int32_bytes)
+  return _internal_map_int32_bytes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+TestArenaMap::_internal_mutable_map_int32_bytes() {
+  return map_int32_bytes_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, std::string >*
+TestArenaMap::mutable_map_int32_bytes() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_int32_bytes)
+  return _internal_mutable_map_int32_bytes();
+}
+
+// map<int32, .protobuf_unittest.MapEnum> map_int32_enum = 16;
+inline int TestArenaMap::_internal_map_int32_enum_size() const {
+  return map_int32_enum_.size();
+}
+inline int TestArenaMap::map_int32_enum_size() const {
+  return _internal_map_int32_enum_size();
+}
+inline void TestArenaMap::clear_map_int32_enum() {
+  map_int32_enum_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >&
+TestArenaMap::_internal_map_int32_enum() const {
+  return map_int32_enum_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >&
+TestArenaMap::map_int32_enum() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_int32_enum)
+  return _internal_map_int32_enum();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >*
+TestArenaMap::_internal_mutable_map_int32_enum() {
+  return map_int32_enum_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::MapEnum >*
+TestArenaMap::mutable_map_int32_enum() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_int32_enum)
+  return _internal_mutable_map_int32_enum();
+}
+
+// map<int32, .protobuf_unittest.ForeignMessage> map_int32_foreign_message = 17;
+inline int TestArenaMap::_internal_map_int32_foreign_message_size() const {
+  return map_int32_foreign_message_.size();
+}
+inline int TestArenaMap::map_int32_foreign_message_size() const {
+  return _internal_map_int32_foreign_message_size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >&
+TestArenaMap::_internal_map_int32_foreign_message() const {
+  return map_int32_foreign_message_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >&
+TestArenaMap::map_int32_foreign_message() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestArenaMap.map_int32_foreign_message)
+  return _internal_map_int32_foreign_message();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >*
+TestArenaMap::_internal_mutable_map_int32_foreign_message() {
+  return map_int32_foreign_message_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::protobuf_unittest::ForeignMessage >*
+TestArenaMap::mutable_map_int32_foreign_message() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestArenaMap.map_int32_foreign_message)
+  return _internal_mutable_map_int32_foreign_message();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// MessageContainingEnumCalledType
+
+// map<string, .protobuf_unittest.MessageContainingEnumCalledType> type = 1;
+inline int MessageContainingEnumCalledType::_internal_type_size() const {
+  return type_.size();
+}
+inline int MessageContainingEnumCalledType::type_size() const {
+  return _internal_type_size();
+}
+inline void MessageContainingEnumCalledType::clear_type() {
+  type_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::MessageContainingEnumCalledType >&
+MessageContainingEnumCalledType::_internal_type() const {
+  return type_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::MessageContainingEnumCalledType >&
+MessageContainingEnumCalledType::type() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MessageContainingEnumCalledType.type)
+  return _internal_type();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::MessageContainingEnumCalledType >*
+MessageContainingEnumCalledType::_internal_mutable_type() {
+  return type_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::MessageContainingEnumCalledType >*
+MessageContainingEnumCalledType::mutable_type() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MessageContainingEnumCalledType.type)
+  return _internal_mutable_type();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// MessageContainingMapCalledEntry
+
+// map<int32, int32> entry = 1;
+inline int MessageContainingMapCalledEntry::_internal_entry_size() const {
+  return entry_.size();
+}
+inline int MessageContainingMapCalledEntry::entry_size() const {
+  return _internal_entry_size();
+}
+inline void MessageContainingMapCalledEntry::clear_entry() {
+  entry_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+MessageContainingMapCalledEntry::_internal_entry() const {
+  return entry_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >&
+MessageContainingMapCalledEntry::entry() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.MessageContainingMapCalledEntry.entry)
+  return _internal_entry();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+MessageContainingMapCalledEntry::_internal_mutable_entry() {
+  return entry_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >*
+MessageContainingMapCalledEntry::mutable_entry() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.MessageContainingMapCalledEntry.entry)
+  return _internal_mutable_entry();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// TestRecursiveMapMessage
+
+// map<string, .protobuf_unittest.TestRecursiveMapMessage> a = 1;
+inline int TestRecursiveMapMessage::_internal_a_size() const {
+  return a_.size();
+}
+inline int TestRecursiveMapMessage::a_size() const {
+  return _internal_a_size();
+}
+inline void TestRecursiveMapMessage::clear_a() {
+  a_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::TestRecursiveMapMessage >&
+TestRecursiveMapMessage::_internal_a() const {
+  return a_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::TestRecursiveMapMessage >&
+TestRecursiveMapMessage::a() const {
+  // @@protoc_insertion_point(field_map:protobuf_unittest.TestRecursiveMapMessage.a)
+  return _internal_a();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::TestRecursiveMapMessage >*
+TestRecursiveMapMessage::_internal_mutable_a() {
+  return a_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::protobuf_unittest::TestRecursiveMapMessage >*
+TestRecursiveMapMessage::mutable_a() {
+  // @@protoc_insertion_point(field_mutable_map:protobuf_unittest.TestRecursiveMapMessage.a)
+  return _internal_mutable_a();
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::protobuf_unittest::MessageContainingEnumCalledType_Type> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protobuf_unittest::MessageContainingEnumCalledType_Type>() {
+  return ::protobuf_unittest::MessageContainingEnumCalledType_Type_descriptor();
+}
+template <> struct is_proto_enum< ::protobuf_unittest::MapEnum> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protobuf_unittest::MapEnum>() {
+  return ::protobuf_unittest::MapEnum_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2fmap_5funittest_2eproto
@@ -51,6 +51,7 @@
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/map_field.h>
 #include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/read_mostly_map.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/unknown_field_set.h>
 #include <google/protobuf/wire_format.h>
@@ -191,8 +192,8 @@ class GeneratedMessageFactory : public MessageFactory {
       file_map_;
 
   internal::WrappedMutex mutex_;
-  // Initialized lazily, so requires locking.
-  std::unordered_map<const Descriptor*, const Message*> type_map_;
+  // Initialized lazily.  Lookups take no lock; insertions hold mutex_.
+  internal::ReadMostlyMap<const Descriptor*, const Message*> type_map_;
 };
 
 GeneratedMessageFactory* GeneratedMessageFactory::singleton() {
@@ -218,18 +219,16 @@ void GeneratedMessageFactory::RegisterType(const Descriptor* descriptor,
   // function during GetPrototype(), in which case we already have locked
   // the mutex.
   mutex_.AssertHeld();
-  if (!InsertIfNotPresent(&type_map_, descriptor, prototype)) {
+  if (type_map_.Find(descriptor) != NULL) {
     GOOGLE_LOG(DFATAL) << "Type is already registered: " << descriptor->full_name();
+    return;
   }
+  type_map_.Insert(descriptor, prototype);
 }
 
 
 const Message* GeneratedMessageFactory::GetPrototype(const Descriptor* type) {
-  {
-    ReaderMutexLock lock(&mutex_);
-    const Message* result = FindPtrOrNull(type_map_, type);
-    if (result != NULL) return result;
-  }
+  if (const Message* const* result = type_map_.Find(type)) return *result;
 
   // If the type is not in the generated pool, then we can't possibly handle
   // it.
@@ -248,20 +247,21 @@ const Message* GeneratedMessageFactory::GetPrototype(const Descriptor* type) {
   WriterMutexLock lock(&mutex_);
 
   // Check if another thread preempted us.
-  const Message* result = FindPtrOrNull(type_map_, type);
+  const Message* const* result = type_map_.Find(type);
   if (result == NULL) {
     // Nope.  OK, register everything.
     internal::RegisterFileLevelMetadata(registration_data);
     // Should be here now.
-    result = FindPtrOrNull(type_map_, type);
+    result = type_map_.Find(type);
   }
 
   if (result == NULL) {
     GOOGLE_LOG(DFATAL) << "Type appears to be in generated pool but wasn't "
                 << "registered: " << type->full_name();
+    return NULL;
   }
 
-  return result;
+  return *result;
 }
 
 }  // namespace
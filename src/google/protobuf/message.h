@@ -110,6 +110,7 @@
 #ifndef GOOGLE_PROTOBUF_MESSAGE_H__
 #define GOOGLE_PROTOBUF_MESSAGE_H__
 
+#include <atomic>
 #include <iosfwd>
 #include <string>
 #include <type_traits>
@@ -144,6 +145,7 @@ class MessageFactory;
 // Defined in other files.
 class AssignDescriptorsHelper;
 class DynamicMessageFactory;
+class FieldAccessPlan;  // field_access_plan.h
 class MapKey;
 class MapValueRef;
 class MapIterator;
@@ -166,6 +168,10 @@ class MapReflectionFriend;  // scalar_map_container.h
 namespace expr {
 class CelMapReflectionFriend;  // field_backed_map_impl.cc
 }
+namespace util {
+class ColumnarConverter;   // columnar_util.h
+class MessageDifferencer;  // message_differencer.h
+}
 
 namespace internal {
 class MapFieldPrinterHelper;  // text_format.cc
@@ -861,6 +867,13 @@ class PROTOBUF_EXPORT Reflection final {
   // Message::New() is an easier way to accomplish this.
   MessageFactory* GetMessageFactory() const;
 
+  // Returns the FieldAccessPlan for messages using this Reflection.  The plan
+  // is built on the first call and lives as long as the Reflection does.  See
+  // field_access_plan.h.
+  const FieldAccessPlan* GetFieldAccessPlan() const;
+
+  ~Reflection();
+
  private:
   template <typename T>
   const RepeatedField<T>& GetRepeatedFieldInternal(
@@ -937,6 +950,9 @@ class PROTOBUF_EXPORT Reflection final {
   // contain weak fields, then this field equals descriptor_->field_count().
   int last_non_weak_field_index_;
 
+  // Built lazily by GetFieldAccessPlan().
+  mutable std::atomic<const FieldAccessPlan*> field_access_plan_;
+
   template <typename T, typename Enable>
   friend class RepeatedFieldRef;
   template <typename T, typename Enable>
@@ -944,6 +960,7 @@ class PROTOBUF_EXPORT Reflection final {
   friend class ::PROTOBUF_NAMESPACE_ID::MessageLayoutInspector;
   friend class ::PROTOBUF_NAMESPACE_ID::AssignDescriptorsHelper;
   friend class DynamicMessageFactory;
+  friend class FieldAccessPlan;
   friend class python::MapReflectionFriend;
 #define GOOGLE_PROTOBUF_HAS_CEL_MAP_REFLECTION_FRIEND
   friend class expr::CelMapReflectionFriend;
@@ -953,6 +970,11 @@ class PROTOBUF_EXPORT Reflection final {
   friend class internal::ReflectionOps;
   // Needed for implementing text format for map.
   friend class internal::MapFieldPrinterHelper;
+  // Reads the field offsets and has-bit indices in schema_ to access fields
+  // directly.
+  friend class util::ColumnarConverter;
+  // Compares map fields without syncing them to their repeated fields.
+  friend class util::MessageDifferencer;
 
   Reflection(const Descriptor* descriptor,
              const internal::ReflectionSchema& schema,
@@ -972,6 +994,12 @@ class PROTOBUF_EXPORT Reflection final {
   bool ContainsMapKey(const Message& message, const FieldDescriptor* field,
                       const MapKey& key) const;
 
+  // If key is in map field: Saves the value pointer to val and returns true.
+  // If key is not in map field: Returns false.  Unlike InsertOrLookupMapValue
+  // this never modifies the message, so val must only be used for reading.
+  bool LookupMapValue(const Message& message, const FieldDescriptor* field,
+                      const MapKey& key, MapValueRef* val) const;
+
   // If key is in map field: Saves the value pointer to val and returns
   // false. If key in not in map field: Insert the key into map, saves
   // value pointer to val and returns true.
@@ -127,6 +127,16 @@ inline bool CheckFieldPresence(const internal::ParseContext& ctx,
   return msg.IsInitializedWithErrors();
 }
 
+// Messages parsed into an arena with a string intern pool share the pool's
+// copies of short string field values.
+inline void SetStringInternPool(const MessageLite& msg,
+                                internal::ParseContext* ctx) {
+  Arena* arena = msg.GetArena();
+  if (arena != nullptr) {
+    ctx->data().string_intern_pool = arena->string_intern_pool();
+  }
+}
+
 }  // namespace
 
 void MessageLite::LogInitializationErrorMessage() const {
@@ -141,6 +151,7 @@ bool MergeFromImpl(StringPiece input, MessageLite* msg,
   const char* ptr;
   internal::ParseContext ctx(io::CodedInputStream::GetDefaultRecursionLimit(),
                              aliasing, &ptr, input);
+  SetStringInternPool(*msg, &ctx);
   ptr = msg->_InternalParse(ptr, &ctx);
   // ctx has an explicit limit set (length of string_view).
   if (PROTOBUF_PREDICT_TRUE(ptr && ctx.EndedAtLimit())) {
@@ -155,6 +166,7 @@ bool MergeFromImpl(io::ZeroCopyInputStream* input, MessageLite* msg,
   const char* ptr;
   internal::ParseContext ctx(io::CodedInputStream::GetDefaultRecursionLimit(),
                              aliasing, &ptr, input);
+  SetStringInternPool(*msg, &ctx);
   ptr = msg->_InternalParse(ptr, &ctx);
   // ctx has no explicit limit (hence we end on end of stream)
   if (PROTOBUF_PREDICT_TRUE(ptr && ctx.EndedAtEndOfStream())) {
@@ -169,6 +181,7 @@ bool MergeFromImpl(BoundedZCIS input, MessageLite* msg,
   const char* ptr;
   internal::ParseContext ctx(io::CodedInputStream::GetDefaultRecursionLimit(),
                              aliasing, &ptr, input.zcis, input.limit);
+  SetStringInternPool(*msg, &ctx);
   ptr = msg->_InternalParse(ptr, &ctx);
   if (PROTOBUF_PREDICT_FALSE(!ptr)) return false;
   ctx.BackUp(ptr);
@@ -233,6 +246,7 @@ bool MessageLite::MergeFromImpl(io::CodedInputStream* input,
   ctx.TrackCorrectEnding();
   ctx.data().pool = input->GetExtensionPool();
   ctx.data().factory = input->GetExtensionFactory();
+  SetStringInternPool(*this, &ctx);
   ptr = _InternalParse(ptr, &ctx);
   if (PROTOBUF_PREDICT_FALSE(!ptr)) return false;
   ctx.BackUp(ptr);
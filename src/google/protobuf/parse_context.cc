@@ -36,6 +36,7 @@
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/message_lite.h>
 #include <google/protobuf/repeated_field.h>
+#include <google/protobuf/string_intern_pool.h>
 #include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/stubs/strutil.h>
 
@@ -427,6 +428,26 @@ const char* InlineGreedyStringParser(std::string* s, const char* ptr,
   return ctx->ReadString(ptr, size, s);
 }
 
+const char* InternedStringParser(ArenaStringPtr* s,
+                                 const std::string* default_value,
+                                 Arena* arena, const char* ptr,
+                                 ParseContext* ctx) {
+  int size = ReadSize(&ptr);
+  if (!ptr) return nullptr;
+  StringInternPool* pool = ctx->data().string_intern_pool;
+  // Only values that are entirely input are interned, so that truncated
+  // input cannot fill the pool with garbage.
+  if (static_cast<size_t>(size) <= pool->max_value_size() &&
+      ctx->IsInputData(ptr, size)) {
+    const std::string* interned = pool->Intern(StringPiece(ptr, size));
+    if (interned != nullptr) {
+      s->SetInterned(default_value, interned, arena);
+      return ptr + size;
+    }
+  }
+  return ctx->ReadString(ptr, size, s->Mutable(default_value, arena));
+}
+
 
 template <typename T, bool sign>
 const char* VarintParser(void* object, const char* ptr, ParseContext* ctx) {
@@ -55,6 +55,7 @@ namespace protobuf {
 class UnknownFieldSet;
 class DescriptorPool;
 class MessageFactory;
+class StringInternPool;
 
 namespace internal {
 
@@ -180,6 +181,14 @@ class PROTOBUF_EXPORT EpsCopyInputStream {
   PROTOBUF_MUST_USE_RESULT const char* ReadPackedVarint(const char* ptr,
                                                         Add add);
 
+  // Returns the number of consecutive length-delimited fields with the given
+  // tag, starting with the one whose tag is at ptr, that lie entirely in the
+  // current limit and in the part of the input that is already buffered.  It
+  // is only an estimate of the fields to come; parsers use it to size
+  // containers before parsing a run of repeated fields.
+  template <uint32 tag>
+  int CountLengthDelimited(const char* ptr) const;
+
   uint32 LastTag() const { return last_tag_minus_1_ + 1; }
   bool ConsumeEndGroup(uint32 start_tag) {
     bool res = last_tag_minus_1_ == start_tag;
@@ -200,6 +209,19 @@ class PROTOBUF_EXPORT EpsCopyInputStream {
   // Returns true if more data is available, if false is returned one has to
   // call Done for further checks.
   bool DataAvailable(const char* ptr) { return ptr < limit_end_; }
+  // Returns true if the |size| bytes at |ptr| are all in the current buffer,
+  // so they can be used in place.
+  bool IsContiguous(const char* ptr, int size) const {
+    return size <= buffer_end_ + kSlopBytes - ptr;
+  }
+  // Returns true if the |size| bytes at |ptr| are all input, within the
+  // current limit.  At the end of the stream the slop bytes after buffer_end_
+  // are not input, even when no explicit limit is set.
+  bool IsInputData(const char* ptr, int size) const {
+    const char* data_end =
+        next_chunk_ == nullptr ? buffer_end_ : buffer_end_ + kSlopBytes;
+    return size <= BytesUntilLimit(ptr) && size <= data_end - ptr;
+  }
 
  protected:
   // Returns true is limit (either an explicit limit or end of stream) is
@@ -343,6 +365,8 @@ class PROTOBUF_EXPORT ParseContext : public EpsCopyInputStream {
   struct Data {
     const DescriptorPool* pool = nullptr;
     MessageFactory* factory = nullptr;
+    // If set, singular string fields share the pool's copy of short values.
+    StringInternPool* string_intern_pool = nullptr;
   };
 
   template <typename... T>
@@ -634,6 +658,29 @@ const char* EpsCopyInputStream::ReadPackedVarint(const char* ptr, Add add) {
   return ptr;
 }
 
+template <uint32 tag>
+int EpsCopyInputStream::CountLengthDelimited(const char* ptr) const {
+  constexpr int kTagSize = tag < 128 ? 1 : 2;
+  const char* end =
+      buffer_end_ + (std::min)(limit_, static_cast<int>(kSlopBytes));
+  int count = 0;
+  while (end - ptr > kTagSize && ExpectTag<tag>(ptr)) {
+    ptr += kTagSize;
+    // The size may be cut off by end, so it can't be read with ReadSize.
+    uint32 size = 0;
+    for (int shift = 0;; shift += 7) {
+      if (ptr == end || shift > 28) return count;
+      uint8 byte = static_cast<uint8>(*ptr++);
+      size |= static_cast<uint32>(byte & 0x7F) << shift;
+      if (byte < 128) break;
+    }
+    if (size > static_cast<uint32>(end - ptr)) break;
+    ptr += size;
+    count++;
+  }
+  return count;
+}
+
 // Helper for verification of utf8
 PROTOBUF_EXPORT
 bool VerifyUTF8(StringPiece s, const char* field_name);
@@ -646,6 +693,22 @@ inline bool VerifyUTF8(const std::string* s, const char* field_name) {
 PROTOBUF_EXPORT PROTOBUF_MUST_USE_RESULT const char* InlineGreedyStringParser(
     std::string* s, const char* ptr, ParseContext* ctx);
 
+PROTOBUF_EXPORT PROTOBUF_MUST_USE_RESULT const char* InternedStringParser(
+    ArenaStringPtr* s, const std::string* default_value, Arena* arena,
+    const char* ptr, ParseContext* ctx);
+
+// Parses a singular string field.  If the context has a string intern pool the
+// field may end up sharing the pool's copy of the value.
+PROTOBUF_MUST_USE_RESULT inline const char* InlineGreedyStringParser(
+    ArenaStringPtr* s, const std::string* default_value, Arena* arena,
+    const char* ptr, ParseContext* ctx) {
+  if (PROTOBUF_PREDICT_TRUE(ctx->data().string_intern_pool == nullptr)) {
+    return InlineGreedyStringParser(s->Mutable(default_value, arena), ptr,
+                                    ctx);
+  }
+  return InternedStringParser(s, default_value, arena, ptr, ctx);
+}
+
 
 // Add any of the following lines to debug which parse function is failing.
 
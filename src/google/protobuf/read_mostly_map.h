@@ -0,0 +1,184 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// This file is an internal atomic implementation, use any of the public
+// factories or pools instead.
+//
+// ReadMostlyMap is a hash map for registries that are filled once and then
+// looked up from many threads, such as the prototypes of a MessageFactory.
+// Find() takes no lock: the table is published through an atomic pointer and
+// its entries are immutable once visible.  Insert() is not thread-safe; the
+// caller serializes it, typically under the mutex that already guards the
+// first-time construction of the values.  A Find() that races with an
+// Insert() of the same key may miss it, so callers fall back to their locked
+// path when Find() returns null.
+//
+// Entries cannot be removed.  Tables that were outgrown are kept until the
+// map is destroyed, since readers may still be probing them; their total
+// size stays below that of the current table.
+
+#ifndef GOOGLE_PROTOBUF_READ_MOSTLY_MAP_H__
+#define GOOGLE_PROTOBUF_READ_MOSTLY_MAP_H__
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/logging.h>
+
+#ifdef SWIG
+#error "You cannot SWIG proto headers"
+#endif
+
+#include <google/protobuf/port_def.inc>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key> >
+class ReadMostlyMap {
+ public:
+  ReadMostlyMap() : table_(nullptr), size_(0) {}
+  ~ReadMostlyMap() {
+    for (const Entry* entry : entries_) delete entry;
+  }
+
+  // Returns the value stored for key, or null.  Safe to call concurrently
+  // with Insert().
+  const Value* Find(const Key& key) const {
+    const Table* table = table_.load(std::memory_order_acquire);
+    if (table == nullptr) return nullptr;
+    for (size_t i = Slot(key, table->mask);; i = (i + 1) & table->mask) {
+      const Entry* entry = table->slots[i].load(std::memory_order_acquire);
+      if (entry == nullptr) return nullptr;
+      if (KeyEqual()(entry->key, key)) return &entry->value;
+    }
+  }
+
+  // Adds key, which must not be present yet.  Calls must be serialized.
+  void Insert(const Key& key, const Value& value) {
+    GOOGLE_DCHECK(Find(key) == nullptr);
+    const Entry* entry = new Entry{key, value};
+    entries_.push_back(entry);
+    Table* table = table_.load(std::memory_order_relaxed);
+    // Keep the load factor at or below 1/2 so probe sequences stay short.
+    if (table == nullptr || 2 * (size_ + 1) > table->mask + 1) {
+      table = Grow(table == nullptr ? 8 : 2 * (table->mask + 1));
+    }
+    Place(table, entry);
+    size_++;
+  }
+
+  size_t size() const { return size_; }
+
+  // Bytes of memory used by the map, not counting sizeof(*this).  Must not
+  // run concurrently with Insert().
+  size_t SpaceUsedExcludingSelfLong() const {
+    size_t total = entries_.capacity() * sizeof(const Entry*) +
+                   entries_.size() * sizeof(Entry) +
+                   tables_.capacity() * sizeof(std::unique_ptr<Table>);
+    for (const auto& table : tables_) {
+      total += sizeof(Table) +
+               (table->mask + 1) * sizeof(std::atomic<const Entry*>);
+    }
+    return total;
+  }
+
+  // Calls f(key, value) for every entry.  Must not run concurrently with
+  // Insert().
+  template <typename F>
+  void ForEach(F f) const {
+    for (const Entry* entry : entries_) f(entry->key, entry->value);
+  }
+
+ private:
+  struct Entry {
+    Key key;
+    Value value;
+  };
+
+  struct Table {
+    explicit Table(size_t capacity)
+        : mask(capacity - 1), slots(new std::atomic<const Entry*>[capacity]) {
+      for (size_t i = 0; i < capacity; i++) {
+        slots[i].store(nullptr, std::memory_order_relaxed);
+      }
+    }
+    size_t mask;
+    std::unique_ptr<std::atomic<const Entry*>[]> slots;
+  };
+
+  // Returns the home slot of key.  Hashes such as std::hash of a pointer are
+  // often the identity, whose low bits are the same for every aligned
+  // object; Fibonacci hashing takes the well-mixed high bits of a product
+  // instead.
+  static size_t Slot(const Key& key, size_t mask) {
+    uint64 h = static_cast<uint64>(Hash()(key)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(h >> 32) & mask;
+  }
+
+  // Release order publishes the entry's key and value along with the slot.
+  static void Place(Table* table, const Entry* entry) {
+    size_t i = Slot(entry->key, table->mask);
+    while (table->slots[i].load(std::memory_order_relaxed) != nullptr) {
+      i = (i + 1) & table->mask;
+    }
+    table->slots[i].store(entry, std::memory_order_release);
+  }
+
+  Table* Grow(size_t capacity) {
+    Table* table = new Table(capacity);
+    tables_.emplace_back(table);
+    // The entry being inserted is placed by the caller.
+    for (size_t i = 0; i + 1 < entries_.size(); i++) Place(table, entries_[i]);
+    table_.store(table, std::memory_order_release);
+    return table;
+  }
+
+  std::atomic<Table*> table_;
+  size_t size_;
+  // Every entry in insertion order, and every table ever published.
+  std::vector<const Entry*> entries_;
+  std::vector<std::unique_ptr<Table> > tables_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ReadMostlyMap);
+};
+
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+#include <google/protobuf/port_undef.inc>
+
+#endif  // GOOGLE_PROTOBUF_READ_MOSTLY_MAP_H__
@@ -0,0 +1,113 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/read_mostly_map.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <google/protobuf/testing/googletest.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+namespace {
+
+TEST(ReadMostlyMapTest, FindAndInsert) {
+  ReadMostlyMap<int, std::string> map;
+  EXPECT_EQ(nullptr, map.Find(1));
+  EXPECT_EQ(0, map.size());
+
+  map.Insert(1, "one");
+  map.Insert(2, "two");
+  ASSERT_NE(nullptr, map.Find(1));
+  EXPECT_EQ("one", *map.Find(1));
+  EXPECT_EQ("two", *map.Find(2));
+  EXPECT_EQ(nullptr, map.Find(3));
+  EXPECT_EQ(2, map.size());
+}
+
+TEST(ReadMostlyMapTest, Grow) {
+  ReadMostlyMap<int, int> map;
+  const int* first = nullptr;
+  for (int i = 0; i < 1000; i++) {
+    map.Insert(i, i * i);
+    if (i == 0) first = map.Find(0);
+  }
+  EXPECT_EQ(1000, map.size());
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_NE(nullptr, map.Find(i));
+    EXPECT_EQ(i * i, *map.Find(i));
+  }
+  EXPECT_EQ(nullptr, map.Find(1000));
+  // Values never move once inserted.
+  EXPECT_EQ(first, map.Find(0));
+
+  int sum = 0;
+  map.ForEach([&sum](int key, int value) { sum += key; });
+  EXPECT_EQ(999 * 1000 / 2, sum);
+
+  // At least the entries and the current table, which has at least twice as
+  // many slots as entries.
+  EXPECT_GE(map.SpaceUsedExcludingSelfLong(),
+            1000 * 2 * sizeof(int) + 2000 * sizeof(void*));
+}
+
+TEST(ReadMostlyMapTest, ConcurrentReaders) {
+  // Readers either miss a key that is being inserted or see its value; they
+  // never see a partially published entry.
+  ReadMostlyMap<int, std::string> map;
+  std::atomic<bool> done(false);
+  std::atomic<int> mismatches(0);
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; t++) {
+    readers.emplace_back([&map, &done, &mismatches] {
+      while (!done.load()) {
+        for (int i = 0; i < 2000; i += 7) {
+          const std::string* value = map.Find(i);
+          if (value != nullptr && *value != std::to_string(i)) mismatches++;
+        }
+      }
+    });
+  }
+  for (int i = 0; i < 2000; i++) map.Insert(i, std::to_string(i));
+  done.store(true);
+  for (std::thread& reader : readers) reader.join();
+  EXPECT_EQ(0, mismatches.load());
+  for (int i = 0; i < 2000; i++) EXPECT_NE(nullptr, map.Find(i));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
@@ -40,6 +40,7 @@
 #include <google/protobuf/stubs/common.h>
 #include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/field_access_plan.h>
 #include <google/protobuf/map_field.h>
 #include <google/protobuf/map_field_inl.h>
 #include <google/protobuf/unknown_field_set.h>
@@ -79,13 +80,64 @@ void ReflectionOps::Merge(const Message& from, Message* to) {
 
   const Reflection* from_reflection = GetReflectionOrDie(from);
   const Reflection* to_reflection = GetReflectionOrDie(*to);
+
+  std::vector<const FieldDescriptor*> fields;
+  from_reflection->GetFieldAccessPlan()->ListFields(from, &fields);
+  MergeFields(from, fields, to);
+
+  to_reflection->MutableUnknownFields(to)->MergeFrom(
+      from_reflection->GetUnknownFields(from));
+}
+
+void ReflectionOps::MergeMapFieldByMapReflection(
+    const Message& from, Message* to, const FieldDescriptor* field) {
+  const Reflection* from_reflection = GetReflectionOrDie(from);
+  const Reflection* to_reflection = GetReflectionOrDie(*to);
+  const FieldDescriptor* value_field = field->message_type()->map_value();
+  MapIterator iter = from_reflection->MapBegin(const_cast<Message*>(&from),
+                                               field);
+  MapIterator end = from_reflection->MapEnd(const_cast<Message*>(&from), field);
+  for (; iter != end; ++iter) {
+    MapValueRef to_value;
+    to_reflection->InsertOrLookupMapValue(to, field, iter.GetKey(), &to_value);
+    const MapValueRef& from_value = iter.GetValueRef();
+    switch (value_field->cpp_type()) {
+#define HANDLE_TYPE(CPPTYPE, METHOD)                                \
+  case FieldDescriptor::CPPTYPE_##CPPTYPE:                          \
+    to_value.Set##METHOD##Value(from_value.Get##METHOD##Value());   \
+    break;
+
+      HANDLE_TYPE(INT32, Int32);
+      HANDLE_TYPE(INT64, Int64);
+      HANDLE_TYPE(UINT32, UInt32);
+      HANDLE_TYPE(UINT64, UInt64);
+      HANDLE_TYPE(FLOAT, Float);
+      HANDLE_TYPE(DOUBLE, Double);
+      HANDLE_TYPE(BOOL, Bool);
+      HANDLE_TYPE(STRING, String);
+      HANDLE_TYPE(ENUM, Enum);
+#undef HANDLE_TYPE
+
+      case FieldDescriptor::CPPTYPE_MESSAGE:
+        to_value.MutableMessageValue()->CopyFrom(
+            from_value.GetMessageValue());
+        break;
+    }
+  }
+}
+
+void ReflectionOps::MergeFields(
+    const Message& from, const std::vector<const FieldDescriptor*>& fields,
+    Message* to) {
+  const Reflection* from_reflection = GetReflectionOrDie(from);
+  const Reflection* to_reflection = GetReflectionOrDie(*to);
+  const FieldAccessPlan* from_plan = from_reflection->GetFieldAccessPlan();
+  const FieldAccessPlan* to_plan = to_reflection->GetFieldAccessPlan();
   bool is_from_generated = (from_reflection->GetMessageFactory() ==
                             google::protobuf::MessageFactory::generated_factory());
   bool is_to_generated = (to_reflection->GetMessageFactory() ==
                           google::protobuf::MessageFactory::generated_factory());
 
-  std::vector<const FieldDescriptor*> fields;
-  from_reflection->ListFieldsOmitStripped(from, &fields);
   for (int i = 0; i < fields.size(); i++) {
     const FieldDescriptor* field = fields[i];
 
@@ -103,28 +155,43 @@ void ReflectionOps::Merge(const Message& from, Message* to) {
           to_field->MergeFrom(*from_field);
           continue;
         }
+      } else if (field->is_map()) {
+        // Generated and dynamic map fields differ in type, but both can still
+        // be merged entry by entry through map reflection without syncing
+        // either side to its repeated field.
+        const MapFieldBase* from_field =
+            from_reflection->GetMapData(from, field);
+        const MapFieldBase* to_field = to_reflection->GetMapData(*to, field);
+        if (to_field->IsMapValid() && from_field->IsMapValid()) {
+          MergeMapFieldByMapReflection(from, to, field);
+          continue;
+        }
       }
-      int count = from_reflection->FieldSize(from, field);
-      for (int j = 0; j < count; j++) {
-        switch (field->cpp_type()) {
-#define HANDLE_TYPE(CPPTYPE, METHOD)                                      \
-  case FieldDescriptor::CPPTYPE_##CPPTYPE:                                \
-    to_reflection->Add##METHOD(                                           \
-        to, field, from_reflection->GetRepeated##METHOD(from, field, j)); \
+      switch (field->cpp_type()) {
+#define HANDLE_TYPE(CPPTYPE, TYPE)                                  \
+  case FieldDescriptor::CPPTYPE_##CPPTYPE:                          \
+    to_plan->MutableRepeatedField<TYPE>(to, field)->MergeFrom(      \
+        from_plan->GetRepeatedField<TYPE>(from, field));            \
     break;
 
-          HANDLE_TYPE(INT32, Int32);
-          HANDLE_TYPE(INT64, Int64);
-          HANDLE_TYPE(UINT32, UInt32);
-          HANDLE_TYPE(UINT64, UInt64);
-          HANDLE_TYPE(FLOAT, Float);
-          HANDLE_TYPE(DOUBLE, Double);
-          HANDLE_TYPE(BOOL, Bool);
-          HANDLE_TYPE(STRING, String);
-          HANDLE_TYPE(ENUM, Enum);
+        HANDLE_TYPE(INT32, int32);
+        HANDLE_TYPE(INT64, int64);
+        HANDLE_TYPE(UINT32, uint32);
+        HANDLE_TYPE(UINT64, uint64);
+        HANDLE_TYPE(FLOAT, float);
+        HANDLE_TYPE(DOUBLE, double);
+        HANDLE_TYPE(BOOL, bool);
+        HANDLE_TYPE(ENUM, int);
 #undef HANDLE_TYPE
 
-          case FieldDescriptor::CPPTYPE_MESSAGE:
+        case FieldDescriptor::CPPTYPE_STRING:
+          to_plan->MutableRepeatedPtrField<std::string>(to, field)->MergeFrom(
+              from_plan->GetRepeatedPtrField<std::string>(from, field));
+          break;
+
+        case FieldDescriptor::CPPTYPE_MESSAGE: {
+          int count = from_plan->FieldSize(from, field);
+          for (int j = 0; j < count; j++) {
             const Message& from_child =
                 from_reflection->GetRepeatedMessage(from, field, j);
             if (from_reflection == to_reflection) {
@@ -135,15 +202,15 @@ void ReflectionOps::Merge(const Message& from, Message* to) {
             } else {
               to_reflection->AddMessage(to, field)->MergeFrom(from_child);
             }
-            break;
+          }
+          break;
         }
       }
     } else {
       switch (field->cpp_type()) {
-#define HANDLE_TYPE(CPPTYPE, METHOD)                                       \
-  case FieldDescriptor::CPPTYPE_##CPPTYPE:                                 \
-    to_reflection->Set##METHOD(to, field,                                  \
-                               from_reflection->Get##METHOD(from, field)); \
+#define HANDLE_TYPE(CPPTYPE, METHOD)                                      \
+  case FieldDescriptor::CPPTYPE_##CPPTYPE:                                \
+    to_plan->Set##METHOD(to, field, from_plan->Get##METHOD(from, field)); \
     break;
 
         HANDLE_TYPE(INT32, Int32);
@@ -153,12 +220,16 @@ void ReflectionOps::Merge(const Message& from, Message* to) {
         HANDLE_TYPE(FLOAT, Float);
         HANDLE_TYPE(DOUBLE, Double);
         HANDLE_TYPE(BOOL, Bool);
-        HANDLE_TYPE(STRING, String);
-        HANDLE_TYPE(ENUM, Enum);
+        HANDLE_TYPE(ENUM, EnumValue);
 #undef HANDLE_TYPE
 
+        case FieldDescriptor::CPPTYPE_STRING:
+          to_plan->SetString(to, field,
+                             from_plan->GetStringReference(from, field));
+          break;
+
         case FieldDescriptor::CPPTYPE_MESSAGE:
-          const Message& from_child = from_reflection->GetMessage(from, field);
+          const Message& from_child = from_plan->GetMessage(from, field);
           if (from_reflection == to_reflection) {
             to_reflection
                 ->MutableMessage(
@@ -171,16 +242,13 @@ void ReflectionOps::Merge(const Message& from, Message* to) {
       }
     }
   }
-
-  to_reflection->MutableUnknownFields(to)->MergeFrom(
-      from_reflection->GetUnknownFields(from));
 }
 
 void ReflectionOps::Clear(Message* message) {
   const Reflection* reflection = GetReflectionOrDie(*message);
 
   std::vector<const FieldDescriptor*> fields;
-  reflection->ListFieldsOmitStripped(*message, &fields);
+  reflection->GetFieldAccessPlan()->ListFields(*message, &fields);
   for (int i = 0; i < fields.size(); i++) {
     reflection->ClearField(message, fields[i]);
   }
@@ -192,6 +260,7 @@ bool ReflectionOps::IsInitialized(const Message& message, bool check_fields,
                                   bool check_descendants) {
   const Descriptor* descriptor = message.GetDescriptor();
   const Reflection* reflection = GetReflectionOrDie(message);
+  const FieldAccessPlan* plan = reflection->GetFieldAccessPlan();
   if (const int field_count = descriptor->field_count()) {
     const FieldDescriptor* begin = descriptor->field(0);
     const FieldDescriptor* end = begin + field_count;
@@ -200,7 +269,7 @@ bool ReflectionOps::IsInitialized(const Message& message, bool check_fields,
     if (check_fields) {
       // Check required fields of this message.
       for (const FieldDescriptor* field = begin; field != end; ++field) {
-        if (field->is_required() && !reflection->HasField(message, field)) {
+        if (field->is_required() && !plan->HasField(message, field)) {
           return false;
         }
       }
@@ -227,15 +296,15 @@ bool ReflectionOps::IsInitialized(const Message& message, bool check_fields,
               }
             }
           } else if (field->is_repeated()) {
-            const int size = reflection->FieldSize(message, field);
+            const int size = plan->FieldSize(message, field);
             for (int j = 0; j < size; j++) {
               if (!reflection->GetRepeatedMessage(message, field, j)
                        .IsInitialized()) {
                 return false;
               }
             }
-          } else if (reflection->HasField(message, field)) {
-            if (!reflection->GetMessage(message, field).IsInitialized()) {
+          } else if (plan->HasField(message, field)) {
+            if (!plan->GetMessage(message, field).IsInitialized()) {
               return false;
             }
           }
@@ -253,13 +322,14 @@ bool ReflectionOps::IsInitialized(const Message& message, bool check_fields,
 bool ReflectionOps::IsInitialized(const Message& message) {
   const Descriptor* descriptor = message.GetDescriptor();
   const Reflection* reflection = GetReflectionOrDie(message);
+  const FieldAccessPlan* plan = reflection->GetFieldAccessPlan();
 
   // Check required fields of this message.
   {
     const int field_count = descriptor->field_count();
     for (int i = 0; i < field_count; i++) {
       if (descriptor->field(i)->is_required()) {
-        if (!reflection->HasField(message, descriptor->field(i))) {
+        if (!plan->HasField(message, descriptor->field(i))) {
           return false;
         }
       }
@@ -270,7 +340,7 @@ bool ReflectionOps::IsInitialized(const Message& message) {
   std::vector<const FieldDescriptor*> fields;
   // Should be safe to skip stripped fields because required fields are not
   // stripped.
-  reflection->ListFieldsOmitStripped(message, &fields);
+  plan->ListFields(message, &fields);
   for (int i = 0; i < fields.size(); i++) {
     const FieldDescriptor* field = fields[i];
     if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
@@ -329,7 +399,7 @@ void ReflectionOps::DiscardUnknownFields(Message* message) {
   // Walk through the fields of this message and DiscardUnknownFields on any
   // messages present.
   std::vector<const FieldDescriptor*> fields;
-  reflection->ListFields(*message, &fields);
+  reflection->GetFieldAccessPlan()->ListFields(*message, &fields);
   for (int i = 0; i < fields.size(); i++) {
     const FieldDescriptor* field = fields[i];
     // Skip over non-message fields.
@@ -386,13 +456,14 @@ void ReflectionOps::FindInitializationErrors(const Message& message,
                                              std::vector<std::string>* errors) {
   const Descriptor* descriptor = message.GetDescriptor();
   const Reflection* reflection = GetReflectionOrDie(message);
+  const FieldAccessPlan* plan = reflection->GetFieldAccessPlan();
 
   // Check required fields of this message.
   {
     const int field_count = descriptor->field_count();
     for (int i = 0; i < field_count; i++) {
       if (descriptor->field(i)->is_required()) {
-        if (!reflection->HasField(message, descriptor->field(i))) {
+        if (!plan->HasField(message, descriptor->field(i))) {
           errors->push_back(prefix + descriptor->field(i)->name());
         }
       }
@@ -401,11 +472,33 @@ void ReflectionOps::FindInitializationErrors(const Message& message,
 
   // Check sub-messages.
   std::vector<const FieldDescriptor*> fields;
-  reflection->ListFieldsOmitStripped(message, &fields);
+  plan->ListFields(message, &fields);
   for (int i = 0; i < fields.size(); i++) {
     const FieldDescriptor* field = fields[i];
     if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
 
+      if (field->is_map()) {
+        const FieldDescriptor* value_field = field->message_type()->field(1);
+        if (value_field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+          // Map entries with scalar values are always initialized.
+          continue;
+        }
+        const MapFieldBase* map_field = reflection->GetMapData(message, field);
+        if (map_field->IsMapValid()) {
+          MapIterator iter(const_cast<Message*>(&message), field);
+          MapIterator end(const_cast<Message*>(&message), field);
+          int j = 0;
+          for (map_field->MapBegin(&iter), map_field->MapEnd(&end);
+               iter != end; ++iter, ++j) {
+            FindInitializationErrors(
+                iter.GetValueRef().GetMessageValue(),
+                SubMessagePrefix(prefix, field, j) + value_field->name() + ".",
+                errors);
+          }
+          continue;
+        }
+      }
+
       if (field->is_repeated()) {
         int size = reflection->FieldSize(message, field);
 
@@ -64,6 +64,11 @@ class PROTOBUF_EXPORT ReflectionOps {
  public:
   static void Copy(const Message& from, Message* to);
   static void Merge(const Message& from, Message* to);
+  // Merges only the given set fields of "from" into "to".  Unknown fields are
+  // left alone.  "from" and "to" must be of the same type.
+  static void MergeFields(const Message& from,
+                          const std::vector<const FieldDescriptor*>& fields,
+                          Message* to);
   static void Clear(Message* message);
   static bool IsInitialized(const Message& message);
   static bool IsInitialized(const Message& message, bool check_fields,
@@ -78,6 +83,11 @@ class PROTOBUF_EXPORT ReflectionOps {
                                        std::vector<std::string>* errors);
 
  private:
+  // Merges the map field of "from" into "to" entry by entry through map
+  // reflection.  Both map fields must be in map state.
+  static void MergeMapFieldByMapReflection(const Message& from, Message* to,
+                                           const FieldDescriptor* field);
+
   // All methods are static.  No need to construct.
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ReflectionOps);
 };
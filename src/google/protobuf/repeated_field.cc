@@ -62,10 +62,18 @@ void** RepeatedPtrFieldBase::InternalExtend(int extend_amount) {
                          sizeof(old_rep->elements[0]))
       << "Requested size is too large to fit into size_t.";
   size_t bytes = kRepHeaderSize + sizeof(old_rep->elements[0]) * new_size;
+  const size_t old_bytes =
+      kRepHeaderSize + sizeof(old_rep->elements[0]) * total_size_;
   if (arena == NULL) {
     rep_ = reinterpret_cast<Rep*>(::operator new(bytes));
   } else {
-    rep_ = reinterpret_cast<Rep*>(Arena::CreateArray<char>(arena, bytes));
+    if (old_rep != NULL &&
+        arena->TryGrowArrayInPlace(old_rep, old_bytes, bytes)) {
+      // The array was the arena's most recent allocation and grew in place.
+      total_size_ = new_size;
+      return &rep_->elements[current_size_];
+    }
+    rep_ = reinterpret_cast<Rep*>(arena->AllocateGrowableArray(bytes));
   }
 #if defined(__GXX_DELETE_WITH_SIZE__) || defined(__cpp_sized_deallocation)
   const int old_total_size = total_size_;
@@ -86,6 +94,9 @@ void** RepeatedPtrFieldBase::InternalExtend(int extend_amount) {
 #else
     ::operator delete(static_cast<void*>(old_rep));
 #endif
+  } else if (old_rep != NULL) {
+    // Let later arrays reuse the old one.
+    arena->ReturnArrayMemory(old_rep, old_bytes);
   }
   return &rep_->elements[current_size_];
 }
@@ -642,6 +642,8 @@ class PROTOBUF_EXPORT RepeatedPtrFieldBase {
   void CloseGap(int start, int num);
 
   void Reserve(int new_size);
+  template <typename TypeHandler>
+  void ReserveAndConstruct(int n);
 
   int Capacity() const;
 
@@ -804,6 +806,12 @@ class GenericTypeHandler {
   static inline GenericType* New(Arena* arena, GenericType&& value) {
     return Arena::Create<GenericType>(arena, std::move(value));
   }
+  // Creates n objects on arena, which must not be NULL, in one contiguous
+  // allocation and stores pointers to them in elements.
+  static inline void NewArray(Arena* arena, int n, void** elements) {
+    GenericType* objects = Arena::CreateArrayOfObjects<GenericType>(arena, n);
+    for (int i = 0; i < n; i++) elements[i] = objects + i;
+  }
   static inline GenericType* NewFromPrototype(const GenericType* prototype,
                                               Arena* arena = NULL);
   static inline void Delete(GenericType* value, Arena* arena) {
@@ -886,6 +894,9 @@ class StringTypeHandler {
   static inline std::string* New(Arena* arena, std::string&& value) {
     return Arena::Create<std::string>(arena, std::move(value));
   }
+  static inline void NewArray(Arena* arena, int n, void** elements) {
+    for (int i = 0; i < n; i++) elements[i] = New(arena);
+  }
   static inline std::string* NewFromPrototype(const std::string*,
                                               Arena* arena) {
     return New(arena);
@@ -960,6 +971,14 @@ class RepeatedPtrField final : private internal::RepeatedPtrFieldBase {
   // array is grown, it will always be at least doubled in size.
   void Reserve(int new_size);
 
+  // Reserve space for n more elements and, on an arena, also allocate the
+  // objects for them, all in one contiguous block.  The next n calls to Add()
+  // return these objects in order, so that elements added together end up
+  // next to each other in memory.  The parser calls this after counting the
+  // elements that follow in its buffer.  On the heap, where every element is
+  // owned (and possibly released) separately, this is just Reserve().
+  void ReserveAndConstruct(int n);
+
   int Capacity() const;
 
   // Gets the underlying array.  This pointer is possibly invalidated by
@@ -1556,10 +1575,24 @@ void RepeatedField<Element>::Reserve(int new_size) {
       << "Requested size is too large to fit into size_t.";
   size_t bytes =
       kRepHeaderSize + sizeof(Element) * static_cast<size_t>(new_size);
+  const size_t old_bytes =
+      kRepHeaderSize + sizeof(Element) * static_cast<size_t>(total_size_);
   if (arena == NULL) {
     new_rep = static_cast<Rep*>(::operator new(bytes));
   } else {
-    new_rep = reinterpret_cast<Rep*>(Arena::CreateArray<char>(arena, bytes));
+    if (old_rep != NULL &&
+        arena->TryGrowArrayInPlace(old_rep, old_bytes, bytes)) {
+      // The array was the arena's most recent allocation and grew in place;
+      // only the new elements need to be constructed.
+      Element* e = &old_rep->elements[total_size_];
+      Element* limit = &old_rep->elements[new_size];
+      for (; e < limit; e++) {
+        new (e) Element;
+      }
+      total_size_ = new_size;
+      return;
+    }
+    new_rep = reinterpret_cast<Rep*>(arena->AllocateGrowableArray(bytes));
   }
   new_rep->arena = arena;
   int old_total_size = total_size_;
@@ -1589,7 +1622,10 @@ void RepeatedField<Element>::Reserve(int new_size) {
 
   // Likewise, we need to invoke destructors on the old array.
   InternalDeallocate(old_rep, old_total_size);
-
+  // On an arena, let later arrays reuse the old one.
+  if (arena != NULL && old_rep != NULL) {
+    arena->ReturnArrayMemory(old_rep, old_bytes);
+  }
 }
 
 template <typename Element>
@@ -1883,6 +1919,18 @@ inline size_t RepeatedPtrFieldBase::SpaceUsedExcludingSelfLong() const {
   return allocated_bytes;
 }
 
+template <typename TypeHandler>
+void RepeatedPtrFieldBase::ReserveAndConstruct(int n) {
+  if (n <= 0) return;
+  Reserve(current_size_ + n);
+  if (arena_ == NULL) return;
+  // Objects left over from Clear() are reused first.
+  const int missing = current_size_ + n - rep_->allocated_size;
+  if (missing <= 0) return;
+  TypeHandler::NewArray(arena_, missing, rep_->elements + rep_->allocated_size);
+  rep_->allocated_size += missing;
+}
+
 template <typename TypeHandler>
 inline typename TypeHandler::Type* RepeatedPtrFieldBase::AddFromCleared() {
   if (rep_ != NULL && current_size_ < rep_->allocated_size) {
@@ -2385,6 +2433,11 @@ inline void RepeatedPtrField<Element>::Reserve(int new_size) {
   return RepeatedPtrFieldBase::Reserve(new_size);
 }
 
+template <typename Element>
+inline void RepeatedPtrField<Element>::ReserveAndConstruct(int n) {
+  RepeatedPtrFieldBase::ReserveAndConstruct<TypeHandler>(n);
+}
+
 template <typename Element>
 inline int RepeatedPtrField<Element>::Capacity() const {
   return RepeatedPtrFieldBase::Capacity();
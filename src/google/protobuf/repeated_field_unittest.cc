@@ -807,6 +807,33 @@ TEST(RepeatedField, ClearThenReserveMore) {
   // strings.
 }
 
+TEST(RepeatedField, ArenaGrowsInPlace) {
+  Arena arena;
+  RepeatedField<int32>* field =
+      Arena::CreateMessage<RepeatedField<int32> >(&arena);
+  field->Add(1);
+  const int32* data = field->data();
+  // The array is the arena's most recent allocation, so it can simply grow.
+  field->Reserve(field->Capacity() + 1);
+  EXPECT_EQ(data, field->data());
+  EXPECT_EQ(1, field->Get(0));
+}
+
+TEST(RepeatedField, ArenaReusesAbandonedArrays) {
+  Arena arena;
+  RepeatedField<int64>* a = Arena::CreateMessage<RepeatedField<int64> >(&arena);
+  RepeatedField<int64>* b = Arena::CreateMessage<RepeatedField<int64> >(&arena);
+  // Arrays this large get blocks of their own, so growing |a| abandons its
+  // array and |b| can take it over.
+  a->Resize(10000, 1);
+  a->Reserve(20000);
+  const uint64 space_allocated = arena.SpaceAllocated();
+  b->Reserve(10000);
+  EXPECT_EQ(space_allocated, arena.SpaceAllocated());
+  b->Resize(10000, 2);
+  for (int i = 0; i < a->size(); i++) ASSERT_EQ(1, a->Get(i));
+}
+
 // ===================================================================
 // RepeatedPtrField tests.  These pretty much just mirror the RepeatedField
 // tests above.
@@ -999,6 +1026,91 @@ TEST(RepeatedPtrField, ReserveDoesntLoseAllocated) {
   EXPECT_EQ(first, field.Add());
 }
 
+TEST(RepeatedPtrField, ArenaGrowsInPlace) {
+  Arena arena;
+  RepeatedPtrField<std::string>* field =
+      Arena::CreateMessage<RepeatedPtrField<std::string> >(&arena);
+  field->Reserve(1);
+  const std::string* const* data = field->data();
+  // Nothing else was allocated since the array, so it can simply grow.
+  field->Reserve(field->Capacity() + 1);
+  EXPECT_EQ(data, field->data());
+}
+
+TEST(RepeatedPtrField, ArenaReusesAbandonedArrays) {
+  Arena arena;
+  RepeatedPtrField<std::string>* a =
+      Arena::CreateMessage<RepeatedPtrField<std::string> >(&arena);
+  RepeatedPtrField<std::string>* b =
+      Arena::CreateMessage<RepeatedPtrField<std::string> >(&arena);
+  a->Reserve(10000);
+  a->Reserve(20000);
+  const uint64 space_allocated = arena.SpaceAllocated();
+  b->Reserve(10000);
+  EXPECT_EQ(space_allocated, arena.SpaceAllocated());
+}
+
+TEST(RepeatedPtrField, ReserveAndConstructOnArena) {
+  typedef TestAllTypes::NestedMessage Nested;
+  Arena arena;
+  RepeatedPtrField<Nested>* field =
+      Arena::CreateMessage<RepeatedPtrField<Nested> >(&arena);
+  field->Add()->set_bb(1);
+  field->ReserveAndConstruct(3);
+  EXPECT_EQ(1, field->size());
+  EXPECT_LE(4, field->Capacity());
+
+  Nested* first = field->Add();
+  EXPECT_EQ(first + 1, field->Add());
+  EXPECT_EQ(first + 2, field->Add());
+  EXPECT_EQ(&arena, first->GetArena());
+  EXPECT_FALSE(first->has_bb());
+  EXPECT_EQ(1, field->Get(0).bb());
+}
+
+TEST(RepeatedPtrField, ReserveAndConstructReusesCleared) {
+  typedef TestAllTypes::NestedMessage Nested;
+  Arena arena;
+  RepeatedPtrField<Nested>* field =
+      Arena::CreateMessage<RepeatedPtrField<Nested> >(&arena);
+  Nested* cleared = field->Add();
+  cleared->set_bb(1);
+  field->Clear();
+  field->ReserveAndConstruct(2);
+  EXPECT_EQ(cleared, field->Add());
+  EXPECT_FALSE(cleared->has_bb());
+  field->Add()->set_bb(2);
+  EXPECT_EQ(2, field->size());
+}
+
+TEST(RepeatedPtrField, ReserveAndConstructOnHeap) {
+  RepeatedPtrField<std::string> field;
+  field.ReserveAndConstruct(3);
+  EXPECT_EQ(0, field.size());
+  EXPECT_LE(3, field.Capacity());
+  field.Add()->assign("a");
+  EXPECT_EQ("a", field.Get(0));
+}
+
+TEST(RepeatedPtrField, ParsedSubMessagesAreContiguousOnArena) {
+  TestAllTypes source;
+  for (int i = 0; i < 10; i++) {
+    source.add_repeated_nested_message()->set_bb(i);
+  }
+  std::string data = source.SerializeAsString();
+
+  Arena arena;
+  TestAllTypes* message = Arena::CreateMessage<TestAllTypes>(&arena);
+  ASSERT_TRUE(message->ParseFromString(data));
+  ASSERT_EQ(10, message->repeated_nested_message_size());
+  const TestAllTypes::NestedMessage* first =
+      &message->repeated_nested_message(0);
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(first + i, &message->repeated_nested_message(i));
+    EXPECT_EQ(i, message->repeated_nested_message(i).bb());
+  }
+}
+
 // Clearing elements is tricky with RepeatedPtrFields since the memory for
 // the elements is retained and reused.
 TEST(RepeatedPtrField, ClearedElements) {
@@ -0,0 +1,117 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/string_intern_pool.h>
+
+#include <google/protobuf/stubs/logging.h>
+#include <google/protobuf/message_lite.h>
+
+// Must be included last.
+#include <google/protobuf/port_def.inc>
+
+namespace google {
+namespace protobuf {
+
+const size_t StringInternPool::kDefaultMaxValueSize;
+const size_t StringInternPool::kDefaultMaxEntries;
+
+StringInternPool::StringInternPool(size_t max_value_size, size_t max_entries)
+    : max_value_size_(max_value_size),
+      max_entries_(max_entries),
+      full_(max_entries == 0),
+      hits_(0),
+      misses_(0) {}
+
+StringInternPool::~StringInternPool() {}
+
+const std::string* StringInternPool::Intern(StringPiece value) {
+  if (static_cast<size_t>(value.size()) > max_value_size_) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  const std::string* const* interned = index_.Find(value);
+  if (interned != nullptr) {
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return *interned;
+  }
+  if (full_.load(std::memory_order_relaxed)) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  return InternSlow(value);
+}
+
+const std::string* StringInternPool::InternSlow(StringPiece value) {
+  MutexLock lock(&mu_);
+  // Another thread may have added the value since the lookup.
+  const std::string* const* found = index_.Find(value);
+  if (found != nullptr) {
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return *found;
+  }
+  if (values_.size() >= max_entries_) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  values_.emplace_back(new std::string(value.data(), value.size()));
+  const std::string* interned = values_.back().get();
+  index_.Insert(StringPiece(*interned), interned);
+  if (values_.size() >= max_entries_) {
+    full_.store(true, std::memory_order_relaxed);
+  }
+  return interned;
+}
+
+size_t StringInternPool::size() const {
+  MutexLock lock(&mu_);
+  return values_.size();
+}
+
+uint64 StringInternPool::hits() const {
+  return hits_.load(std::memory_order_relaxed);
+}
+
+uint64 StringInternPool::misses() const {
+  return misses_.load(std::memory_order_relaxed);
+}
+
+size_t StringInternPool::SpaceUsedLong() const {
+  MutexLock lock(&mu_);
+  size_t total = sizeof(*this);
+  total += values_.capacity() * sizeof(values_[0]);
+  total += index_.SpaceUsedExcludingSelfLong();
+  for (const auto& value : values_) {
+    total += sizeof(*value) + internal::StringSpaceUsedExcludingSelfLong(*value);
+  }
+  return total;
+}
+
+}  // namespace protobuf
+}  // namespace google
@@ -0,0 +1,138 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// StringInternPool deduplicates the values of singular string and bytes
+// fields while parsing.  Fields such as a country code or a status name tend
+// to repeat a handful of values across very many messages; with a pool
+// attached, each distinct value is stored once and every field holding it
+// points at the shared copy instead of owning a std::string of its own.
+//
+// Interning is opt-in.  Attach a pool to an arena and every message parsed
+// into that arena uses it:
+//
+//   Arena arena;
+//   StringInternPool* pool = Arena::Create<StringInternPool>(&arena);
+//   arena.set_string_intern_pool(pool);
+//   MyLogEntry* entry = Arena::CreateMessage<MyLogEntry>(&arena);
+//   entry->ParseFromString(data);
+//
+// Interned values are immutable.  Reading a field returns the shared string;
+// the first mutable access (mutable_foo(), set_foo(), Clear() and so on)
+// gives the field a private copy, so the sharing is invisible to callers.
+// Only values up to max_value_size() bytes are interned, and once the pool
+// holds max_entries() distinct values, new values are parsed as usual.  This
+// keeps high-cardinality fields from growing the pool without bound.
+//
+// The pool must outlive every message holding one of its values.  Creating
+// it on the arena the messages live on guarantees this.  StringInternPool is
+// thread-safe.  Looking up a value that is already in the pool takes no lock,
+// so parsing threads only contend while new values are being added.
+
+#ifndef GOOGLE_PROTOBUF_STRING_INTERN_POOL_H__
+#define GOOGLE_PROTOBUF_STRING_INTERN_POOL_H__
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/hash.h>
+#include <google/protobuf/stubs/mutex.h>
+#include <google/protobuf/stubs/stringpiece.h>
+#include <google/protobuf/read_mostly_map.h>
+
+// Must be included last.
+#include <google/protobuf/port_def.inc>
+
+#ifdef SWIG
+#error "You cannot SWIG proto headers"
+#endif
+
+namespace google {
+namespace protobuf {
+
+class PROTOBUF_EXPORT StringInternPool {
+ public:
+  static const size_t kDefaultMaxValueSize = 64;
+  static const size_t kDefaultMaxEntries = 1 << 16;
+
+  StringInternPool()
+      : StringInternPool(kDefaultMaxValueSize, kDefaultMaxEntries) {}
+  StringInternPool(size_t max_value_size, size_t max_entries);
+  ~StringInternPool();
+
+  // Returns the pool's copy of |value|, adding it if necessary.  Returns
+  // nullptr if |value| is longer than max_value_size(), or if it is new and
+  // the pool already holds max_entries() values.  The returned string stays
+  // valid and unchanged for the lifetime of the pool.
+  const std::string* Intern(StringPiece value);
+
+  size_t max_value_size() const { return max_value_size_; }
+  size_t max_entries() const { return max_entries_; }
+
+  // Number of distinct values held.
+  size_t size() const;
+  // Number of Intern() calls that found an existing value, and that could
+  // not be served from the pool.
+  uint64 hits() const;
+  uint64 misses() const;
+
+  // Memory used by the pool, including the stored strings.
+  size_t SpaceUsedLong() const;
+
+ private:
+  // Adds |value| under mu_ after a lookup without the lock missed it.
+  const std::string* InternSlow(StringPiece value);
+
+  const size_t max_value_size_;
+  const size_t max_entries_;
+
+  // Keys point into the strings owned by |values_|.  Find() needs no lock;
+  // Insert() is called with mu_ held.
+  internal::ReadMostlyMap<StringPiece, const std::string*, hash<StringPiece>>
+      index_;
+  mutable internal::WrappedMutex mu_;
+  std::vector<std::unique_ptr<std::string>> values_;  // guarded by mu_
+  // Set once values_ holds max_entries_ values, so that new values are
+  // rejected without taking mu_.
+  std::atomic<bool> full_;
+  std::atomic<uint64> hits_;
+  std::atomic<uint64> misses_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(StringInternPool);
+};
+
+}  // namespace protobuf
+}  // namespace google
+
+#include <google/protobuf/port_undef.inc>
+
+#endif  // GOOGLE_PROTOBUF_STRING_INTERN_POOL_H__
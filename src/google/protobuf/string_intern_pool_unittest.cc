@@ -0,0 +1,276 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/string_intern_pool.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <google/protobuf/test_util.h>
+#include <google/protobuf/unittest.pb.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace {
+
+using protobuf_unittest::TestAllTypes;
+
+std::string SerializedWithStrings(const std::string& str,
+                                  const std::string& bytes) {
+  TestAllTypes message;
+  message.set_optional_string(str);
+  message.set_optional_bytes(bytes);
+  message.set_optional_int32(1);
+  return message.SerializeAsString();
+}
+
+TEST(StringInternPoolTest, Intern) {
+  StringInternPool pool;
+  const std::string* foo = pool.Intern("foo");
+  ASSERT_TRUE(foo != nullptr);
+  EXPECT_EQ("foo", *foo);
+  EXPECT_EQ(foo, pool.Intern(std::string("foo")));
+  const std::string* bar = pool.Intern("bar");
+  ASSERT_TRUE(bar != nullptr);
+  EXPECT_NE(foo, bar);
+  EXPECT_EQ(2, pool.size());
+  EXPECT_EQ(1, pool.hits());
+  EXPECT_EQ(0, pool.misses());
+  EXPECT_GT(pool.SpaceUsedLong(), sizeof(pool));
+}
+
+TEST(StringInternPoolTest, Limits) {
+  StringInternPool pool(4, 2);
+  EXPECT_TRUE(pool.Intern("abcd") != nullptr);
+  EXPECT_TRUE(pool.Intern("abcde") == nullptr);
+  EXPECT_TRUE(pool.Intern("") != nullptr);
+  // The pool is full: known values are still served, new ones are not.
+  EXPECT_TRUE(pool.Intern("x") == nullptr);
+  EXPECT_TRUE(pool.Intern("abcd") != nullptr);
+  EXPECT_EQ(2, pool.size());
+  EXPECT_EQ(1, pool.hits());
+  EXPECT_EQ(2, pool.misses());
+}
+
+TEST(StringInternPoolTest, ConcurrentIntern) {
+  StringInternPool pool;
+  const int kThreads = 4;
+  std::vector<const std::string*> results[kThreads];
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([&pool, &results, t] {
+      for (int i = 0; i < 1000; i++) {
+        results[t].push_back(pool.Intern(std::to_string(i % 100)));
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(100, pool.size());
+  EXPECT_EQ(kThreads * 1000 - 100, pool.hits());
+  for (int t = 1; t < kThreads; t++) EXPECT_EQ(results[0], results[t]);
+}
+
+TEST(StringInternPoolTest, ParseSharesValues) {
+  Arena arena;
+  StringInternPool* pool = Arena::Create<StringInternPool>(&arena);
+  arena.set_string_intern_pool(pool);
+  EXPECT_EQ(pool, arena.string_intern_pool());
+
+  std::string data = SerializedWithStrings("US", "bytes");
+  TestAllTypes* m1 = Arena::CreateMessage<TestAllTypes>(&arena);
+  TestAllTypes* m2 = Arena::CreateMessage<TestAllTypes>(&arena);
+  ASSERT_TRUE(m1->ParseFromString(data));
+  ASSERT_TRUE(m2->ParseFromString(data));
+
+  EXPECT_EQ("US", m1->optional_string());
+  EXPECT_EQ("bytes", m1->optional_bytes());
+  EXPECT_TRUE(m1->has_optional_string());
+  EXPECT_EQ(&m1->optional_string(), &m2->optional_string());
+  EXPECT_EQ(&m1->optional_bytes(), &m2->optional_bytes());
+  EXPECT_EQ(2, pool->size());
+  EXPECT_EQ(2, pool->hits());
+
+  EXPECT_EQ(data, m1->SerializeAsString());
+  EXPECT_EQ(data, m2->SerializeAsString());
+}
+
+TEST(StringInternPoolTest, MutationCopiesValue) {
+  Arena arena;
+  StringInternPool* pool = Arena::Create<StringInternPool>(&arena);
+  arena.set_string_intern_pool(pool);
+
+  std::string data = SerializedWithStrings("shared", "shared");
+  TestAllTypes* m1 = Arena::CreateMessage<TestAllTypes>(&arena);
+  TestAllTypes* m2 = Arena::CreateMessage<TestAllTypes>(&arena);
+  ASSERT_TRUE(m1->ParseFromString(data));
+  ASSERT_TRUE(m2->ParseFromString(data));
+  const std::string* interned = &m1->optional_string();
+
+  m1->mutable_optional_string()->append("!");
+  EXPECT_EQ("shared!", m1->optional_string());
+  EXPECT_EQ("shared", m2->optional_string());
+  EXPECT_EQ("shared", *interned);
+  EXPECT_NE(interned, &m1->optional_string());
+
+  m2->set_optional_string("other");
+  EXPECT_EQ("other", m2->optional_string());
+  EXPECT_EQ("shared", *interned);
+
+  m2->clear_optional_bytes();
+  EXPECT_EQ("", m2->optional_bytes());
+  EXPECT_EQ("shared", m1->optional_bytes());
+
+  std::string* released = m1->release_optional_bytes();
+  EXPECT_EQ("shared", *released);
+  EXPECT_NE(interned, released);
+  delete released;
+  EXPECT_EQ("shared", *interned);
+}
+
+TEST(StringInternPoolTest, ClearAndMerge) {
+  Arena arena;
+  StringInternPool* pool = Arena::Create<StringInternPool>(&arena);
+  arena.set_string_intern_pool(pool);
+
+  std::string data = SerializedWithStrings("value", "");
+  TestAllTypes* m1 = Arena::CreateMessage<TestAllTypes>(&arena);
+  ASSERT_TRUE(m1->ParseFromString(data));
+  // Parsing again over an interned value replaces it.
+  ASSERT_TRUE(m1->MergeFromString(SerializedWithStrings("value2", "")));
+  EXPECT_EQ("value2", m1->optional_string());
+
+  TestAllTypes* m2 = Arena::CreateMessage<TestAllTypes>(&arena);
+  m2->CopyFrom(*m1);
+  EXPECT_EQ("value2", m2->optional_string());
+  EXPECT_NE(&m1->optional_string(), &m2->optional_string());
+
+  m1->Clear();
+  EXPECT_FALSE(m1->has_optional_string());
+  EXPECT_EQ("", m1->optional_string());
+  m1->set_optional_string("x");
+  EXPECT_EQ("x", m1->optional_string());
+  EXPECT_EQ(3, pool->size());
+}
+
+TEST(StringInternPoolTest, AllFieldsRoundTrip) {
+  Arena arena;
+  StringInternPool* pool = Arena::Create<StringInternPool>(&arena);
+  arena.set_string_intern_pool(pool);
+
+  TestAllTypes original;
+  TestUtil::SetAllFields(&original);
+  std::string data = original.SerializeAsString();
+  TestAllTypes* m1 = Arena::CreateMessage<TestAllTypes>(&arena);
+  TestAllTypes* m2 = Arena::CreateMessage<TestAllTypes>(&arena);
+  ASSERT_TRUE(m1->ParseFromString(data));
+  ASSERT_TRUE(m2->ParseFromString(data));
+  TestUtil::ExpectAllFieldsSet(*m1);
+  TestUtil::ExpectAllFieldsSet(*m2);
+  EXPECT_EQ(&m1->default_string(), &m2->default_string());
+
+  // Interned values are owned by the pool and are not counted per message.
+  TestAllTypes* copy = Arena::CreateMessage<TestAllTypes>(&arena);
+  copy->CopyFrom(*m1);
+  EXPECT_LT(m1->SpaceUsedLong(), copy->SpaceUsedLong());
+
+  m1->Swap(m2);
+  TestUtil::ExpectAllFieldsSet(*m1);
+  m2->set_default_string("changed");
+  EXPECT_EQ("415", m1->default_string());
+  EXPECT_EQ(data, m1->SerializeAsString());
+}
+
+TEST(StringInternPoolTest, TruncatedValueIsNotInterned) {
+  Arena arena;
+  StringInternPool* pool = Arena::Create<StringInternPool>(&arena);
+  arena.set_string_intern_pool(pool);
+
+  // optional_string claims 10 bytes, but only 3 follow.
+  TestAllTypes* m = Arena::CreateMessage<TestAllTypes>(&arena);
+  EXPECT_FALSE(m->ParseFromString(std::string("\x72\x0a" "abc", 5)));
+  EXPECT_EQ(0, pool->size());
+}
+
+TEST(StringInternPoolTest, TruncatedStreamValueIsNotInterned) {
+  Arena arena;
+  StringInternPool* pool = Arena::Create<StringInternPool>(&arena);
+  arena.set_string_intern_pool(pool);
+
+  // A stream has no limit, so only the end of the input stops the value from
+  // being read out of the bytes after it.
+  std::string data = SerializedWithStrings(std::string(40, 'x'), "bytes");
+  TestAllTypes* complete = Arena::CreateMessage<TestAllTypes>(&arena);
+  ASSERT_TRUE(complete->ParseFromString(data));
+  const size_t pool_size = pool->size();
+
+  // optional_string claims 10 bytes, but only 3 follow.
+  data += std::string("\x72\x0a" "abc", 5);
+  for (int block_size = 1; block_size <= data.size(); block_size++) {
+    SCOPED_TRACE(block_size);
+    io::ArrayInputStream input(data.data(), data.size(), block_size);
+    TestAllTypes* m = Arena::CreateMessage<TestAllTypes>(&arena);
+    EXPECT_FALSE(m->ParseFromZeroCopyStream(&input));
+    EXPECT_EQ(pool_size, pool->size());
+  }
+}
+
+TEST(StringInternPoolTest, OnlyArenaMessagesUsePool) {
+  Arena arena;
+  StringInternPool* pool = Arena::Create<StringInternPool>(&arena);
+  arena.set_string_intern_pool(pool);
+
+  std::string data = SerializedWithStrings("a", "b");
+  TestAllTypes heap1, heap2;
+  ASSERT_TRUE(heap1.ParseFromString(data));
+  ASSERT_TRUE(heap2.ParseFromString(data));
+  EXPECT_NE(&heap1.optional_string(), &heap2.optional_string());
+  EXPECT_EQ(0, pool->size());
+
+  Arena other;
+  TestAllTypes* m = Arena::CreateMessage<TestAllTypes>(&other);
+  ASSERT_TRUE(m->ParseFromString(data));
+  EXPECT_EQ("a", m->optional_string());
+  EXPECT_EQ(0, pool->size());
+}
+
+TEST(StringInternPoolTest, ResetDetachesPool) {
+  Arena arena;
+  arena.set_string_intern_pool(Arena::Create<StringInternPool>(&arena));
+  arena.Reset();
+  EXPECT_TRUE(arena.string_intern_pool() == nullptr);
+}
+
+}  // namespace
+}  // namespace protobuf
+}  // namespace google
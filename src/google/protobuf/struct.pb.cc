@@ -262,6 +262,8 @@ const char* Struct::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::int
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
           ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&fields_,
+              ctx->CountLengthDelimited<10>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(&fields_, ptr);
@@ -957,6 +959,8 @@ const char* ListValue::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
           ptr -= 1;
+          values_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<10>(ptr));
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(_internal_add_values(), ptr);
@@ -52,6 +52,7 @@
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/field_access_plan.h>
 #include <google/protobuf/map_field.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/port_def.inc>
@@ -2022,7 +2023,7 @@ void TextFormat::Printer::Print(const Message& message,
     fields.push_back(descriptor->field(0));
     fields.push_back(descriptor->field(1));
   } else {
-    reflection->ListFieldsOmitStripped(message, &fields);
+    reflection->GetFieldAccessPlan()->ListFields(message, &fields);
     if (reflection->IsMessageStripped(message.GetDescriptor())) {
       generator->Print(kDoNotParse, std::strlen(kDoNotParse));
     }
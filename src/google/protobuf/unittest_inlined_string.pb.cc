@@ -0,0 +1,723 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_inlined_string.proto
+
+#include "google/protobuf/unittest_inlined_string.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestInlinedString_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto;
+namespace protobuf_unittest_inlined_string {
+class TestInlinedStringDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestInlinedString> _instance;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_string_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 oneof_uint32_;
+} _TestInlinedString_default_instance_;
+}  // namespace protobuf_unittest_inlined_string
+static void InitDefaultsscc_info_TestInlinedString_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  ::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.DefaultConstruct();
+  *::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get_mutable() = std::string("hello", 5);
+  ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyString(
+      ::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get_mutable());
+  {
+    void* ptr = &::protobuf_unittest_inlined_string::_TestInlinedString_default_instance_;
+    new (ptr) ::protobuf_unittest_inlined_string::TestInlinedString();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest_inlined_string::TestInlinedString::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestInlinedString_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestInlinedString_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto}, {}};
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto[1];
+static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto = nullptr;
+
+const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_inlined_string::TestInlinedString, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_inlined_string::TestInlinedString, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_inlined_string::TestInlinedString, _oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_inlined_string::TestInlinedString, optional_string_) | 1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_inlined_string::TestInlinedString, optional_bytes_) | 1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_inlined_string::TestInlinedString, required_string_) | 1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_inlined_string::TestInlinedString, default_string_) | 1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_inlined_string::TestInlinedString, optional_int32_),
+  offsetof(::protobuf_unittest_inlined_string::TestInlinedStringDefaultTypeInternal, oneof_string_),
+  offsetof(::protobuf_unittest_inlined_string::TestInlinedStringDefaultTypeInternal, oneof_uint32_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_inlined_string::TestInlinedString, repeated_string_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_inlined_string::TestInlinedString, child_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest_inlined_string::TestInlinedString, oneof_field_),
+  0,
+  1,
+  2,
+  3,
+  5,
+  ~0u,
+  ~0u,
+  ~0u,
+  4,
+};
+static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 15, sizeof(::protobuf_unittest_inlined_string::TestInlinedString)},
+};
+
+static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest_inlined_string::_TestInlinedString_default_instance_),
+};
+
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n-google/protobuf/unittest_inlined_strin"
+  "g.proto\022 protobuf_unittest_inlined_strin"
+  "g\"\260\002\n\021TestInlinedString\022\027\n\017optional_stri"
+  "ng\030\001 \001(\t\022\026\n\016optional_bytes\030\002 \001(\014\022\027\n\017requ"
+  "ired_string\030\003 \002(\t\022\035\n\016default_string\030\004 \001("
+  "\t:\005hello\022\026\n\016optional_int32\030\005 \001(\005\022\026\n\014oneo"
+  "f_string\030\006 \001(\tH\000\022\026\n\014oneof_uint32\030\007 \001(\rH\000"
+  "\022\027\n\017repeated_string\030\010 \003(\t\022B\n\005child\030\t \001(\013"
+  "23.protobuf_unittest_inlined_string.Test"
+  "InlinedStringB\r\n\013oneof_fieldB\003\370\001\001"
+  ;
+static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto_deps[1] = {
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto_sccs[1] = {
+  &scc_info_TestInlinedString_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto.base,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto_once;
+const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto = {
+  false, false, descriptor_table_protodef_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto, "google/protobuf/unittest_inlined_string.proto", 393,
+  &descriptor_table_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto_once, descriptor_table_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto_sccs, descriptor_table_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto_deps, 1, 0,
+  schemas, file_default_instances, TableStruct_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto::offsets,
+  file_level_metadata_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto, 1, file_level_enum_descriptors_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto, file_level_service_descriptors_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto,
+};
+
+// Force running AddDescriptors() at dynamic initialization time.
+static bool dynamic_init_dummy_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto)), true);
+namespace protobuf_unittest_inlined_string {
+
+// ===================================================================
+
+void TestInlinedString::InitAsDefaultInstance() {
+  ::protobuf_unittest_inlined_string::_TestInlinedString_default_instance_.oneof_string_.UnsafeSetDefault(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::protobuf_unittest_inlined_string::_TestInlinedString_default_instance_.oneof_uint32_ = 0u;
+  ::protobuf_unittest_inlined_string::_TestInlinedString_default_instance_._instance.get_mutable()->child_ = const_cast< ::protobuf_unittest_inlined_string::TestInlinedString*>(
+      ::protobuf_unittest_inlined_string::TestInlinedString::internal_default_instance());
+}
+class TestInlinedString::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestInlinedString>()._has_bits_);
+  static void set_has_optional_string(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_optional_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_required_string(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_default_string(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_optional_int32(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::protobuf_unittest_inlined_string::TestInlinedString& child(const TestInlinedString* msg);
+  static void set_has_child(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000004) ^ 0x00000004) != 0;
+  }
+};
+
+const ::protobuf_unittest_inlined_string::TestInlinedString&
+TestInlinedString::_Internal::child(const TestInlinedString* msg) {
+  return *msg->child_;
+}
+::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_;
+TestInlinedString::TestInlinedString(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  repeated_string_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest_inlined_string.TestInlinedString)
+}
+TestInlinedString::TestInlinedString(const TestInlinedString& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _has_bits_(from._has_bits_),
+      repeated_string_(from.repeated_string_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_optional_string()) {
+    optional_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_optional_string(),
+      GetArena());
+  }
+  if (from._internal_has_optional_bytes()) {
+    optional_bytes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_optional_bytes(),
+      GetArena());
+  }
+  if (from._internal_has_required_string()) {
+    required_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_required_string(),
+      GetArena());
+  }
+  default_string_.UnsafeSetDefault(&::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get());
+  if (from._internal_has_default_string()) {
+    default_string_.Set(&::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get(), from._internal_default_string(),
+      GetArena());
+  }
+  if (from._internal_has_child()) {
+    child_ = new ::protobuf_unittest_inlined_string::TestInlinedString(*from.child_);
+  } else {
+    child_ = nullptr;
+  }
+  optional_int32_ = from.optional_int32_;
+  clear_has_oneof_field();
+  switch (from.oneof_field_case()) {
+    case kOneofString: {
+      _internal_set_oneof_string(from._internal_oneof_string());
+      break;
+    }
+    case kOneofUint32: {
+      _internal_set_oneof_uint32(from._internal_oneof_uint32());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest_inlined_string.TestInlinedString)
+}
+
+void TestInlinedString::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestInlinedString_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto.base);
+  default_string_.UnsafeSetDefault(&::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get());
+  ::memset(&child_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&optional_int32_) -
+      reinterpret_cast<char*>(&child_)) + sizeof(optional_int32_));
+  clear_has_oneof_field();
+}
+
+TestInlinedString::~TestInlinedString() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest_inlined_string.TestInlinedString)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestInlinedString::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete child_;
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+}
+
+void TestInlinedString::ArenaDtor(void* object) {
+  TestInlinedString* _this = reinterpret_cast< TestInlinedString* >(object);
+  (void)_this;
+  _this->optional_string_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _this->optional_bytes_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _this->required_string_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _this->default_string_.DestroyNoArena(&::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get());
+}
+inline void TestInlinedString::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena) {
+  if (arena != nullptr) {
+    arena->OwnCustomDestructor(this, &TestInlinedString::ArenaDtor);
+  }
+}
+void TestInlinedString::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestInlinedString& TestInlinedString::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestInlinedString_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestInlinedString::clear_oneof_field() {
+// @@protoc_insertion_point(one_of_clear_start:protobuf_unittest_inlined_string.TestInlinedString)
+  switch (oneof_field_case()) {
+    case kOneofString: {
+      oneof_field_.oneof_string_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+      break;
+    }
+    case kOneofUint32: {
+      // No need to clear
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+
+
+void TestInlinedString::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest_inlined_string.TestInlinedString)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_string_.Clear();
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(!optional_string_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited()));
+      optional_string_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(!optional_bytes_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited()));
+      optional_bytes_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(!required_string_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited()));
+      required_string_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(!default_string_.IsDefault(&::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get()));
+      default_string_.ClearToDefault(&::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get(), GetArena());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(child_ != nullptr);
+      child_->Clear();
+    }
+  }
+  optional_int32_ = 0;
+  clear_oneof_field();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestInlinedString::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional string optional_string = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_optional_string();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          #ifndef NDEBUG
+          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protobuf_unittest_inlined_string.TestInlinedString.optional_string");
+          #endif  // !NDEBUG
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional bytes optional_bytes = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          auto str = _internal_mutable_optional_bytes();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // required string required_string = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          auto str = _internal_mutable_required_string();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          #ifndef NDEBUG
+          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protobuf_unittest_inlined_string.TestInlinedString.required_string");
+          #endif  // !NDEBUG
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional string default_string = 4 [default = "hello"];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          auto str = _internal_mutable_default_string();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          #ifndef NDEBUG
+          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protobuf_unittest_inlined_string.TestInlinedString.default_string");
+          #endif  // !NDEBUG
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional int32 optional_int32 = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          _Internal::set_has_optional_int32(&has_bits);
+          optional_int32_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string oneof_string = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          auto str = _internal_mutable_oneof_string();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          #ifndef NDEBUG
+          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protobuf_unittest_inlined_string.TestInlinedString.oneof_string");
+          #endif  // !NDEBUG
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 oneof_uint32 = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
+          _internal_set_oneof_uint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated string repeated_string = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_repeated_string();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            #ifndef NDEBUG
+            ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protobuf_unittest_inlined_string.TestInlinedString.repeated_string");
+            #endif  // !NDEBUG
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest_inlined_string.TestInlinedString child = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_child(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestInlinedString::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest_inlined_string.TestInlinedString)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional string optional_string = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_optional_string().data(), static_cast<int>(this->_internal_optional_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_inlined_string.TestInlinedString.optional_string");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_optional_string(), target);
+  }
+
+  // optional bytes optional_bytes = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_optional_bytes(), target);
+  }
+
+  // required string required_string = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_required_string().data(), static_cast<int>(this->_internal_required_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_inlined_string.TestInlinedString.required_string");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_required_string(), target);
+  }
+
+  // optional string default_string = 4 [default = "hello"];
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_default_string().data(), static_cast<int>(this->_internal_default_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_inlined_string.TestInlinedString.default_string");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_default_string(), target);
+  }
+
+  // optional int32 optional_int32 = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(5, this->_internal_optional_int32(), target);
+  }
+
+  switch (oneof_field_case()) {
+    case kOneofString: {
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+        this->_internal_oneof_string().data(), static_cast<int>(this->_internal_oneof_string().length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+        "protobuf_unittest_inlined_string.TestInlinedString.oneof_string");
+      target = stream->WriteStringMaybeAliased(
+          6, this->_internal_oneof_string(), target);
+      break;
+    }
+    case kOneofUint32: {
+      target = stream->EnsureSpace(target);
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(7, this->_internal_oneof_uint32(), target);
+      break;
+    }
+    default: ;
+  }
+  // repeated string repeated_string = 8;
+  for (int i = 0, n = this->_internal_repeated_string_size(); i < n; i++) {
+    const auto& s = this->_internal_repeated_string(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "protobuf_unittest_inlined_string.TestInlinedString.repeated_string");
+    target = stream->WriteString(8, s, target);
+  }
+
+  // optional .protobuf_unittest_inlined_string.TestInlinedString child = 9;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        9, _Internal::child(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest_inlined_string.TestInlinedString)
+  return target;
+}
+
+size_t TestInlinedString::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest_inlined_string.TestInlinedString)
+  size_t total_size = 0;
+
+  // required string required_string = 3;
+  if (_internal_has_required_string()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_required_string());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string repeated_string = 8;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(repeated_string_.size());
+  for (int i = 0, n = repeated_string_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      repeated_string_.Get(i));
+  }
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string optional_string = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_optional_string());
+    }
+
+    // optional bytes optional_bytes = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_optional_bytes());
+    }
+
+  }
+  if (cached_has_bits & 0x00000038u) {
+    // optional string default_string = 4 [default = "hello"];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_default_string());
+    }
+
+    // optional .protobuf_unittest_inlined_string.TestInlinedString child = 9;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *child_);
+    }
+
+    // optional int32 optional_int32 = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_optional_int32());
+    }
+
+  }
+  switch (oneof_field_case()) {
+    // string oneof_string = 6;
+    case kOneofString: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_oneof_string());
+      break;
+    }
+    // uint32 oneof_uint32 = 7;
+    case kOneofUint32: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+          this->_internal_oneof_uint32());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestInlinedString::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protobuf_unittest_inlined_string.TestInlinedString)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestInlinedString* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestInlinedString>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protobuf_unittest_inlined_string.TestInlinedString)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protobuf_unittest_inlined_string.TestInlinedString)
+    MergeFrom(*source);
+  }
+}
+
+void TestInlinedString::MergeFrom(const TestInlinedString& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest_inlined_string.TestInlinedString)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_string_.MergeFrom(from.repeated_string_);
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _internal_set_optional_string(from._internal_optional_string());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _internal_set_optional_bytes(from._internal_optional_bytes());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _internal_set_required_string(from._internal_required_string());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _internal_set_default_string(from._internal_default_string());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _internal_mutable_child()->::protobuf_unittest_inlined_string::TestInlinedString::MergeFrom(from._internal_child());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      optional_int32_ = from.optional_int32_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  switch (from.oneof_field_case()) {
+    case kOneofString: {
+      _internal_set_oneof_string(from._internal_oneof_string());
+      break;
+    }
+    case kOneofUint32: {
+      _internal_set_oneof_uint32(from._internal_oneof_uint32());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+}
+
+void TestInlinedString::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protobuf_unittest_inlined_string.TestInlinedString)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestInlinedString::CopyFrom(const TestInlinedString& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest_inlined_string.TestInlinedString)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestInlinedString::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+  if (_internal_has_child()) {
+    if (!child_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void TestInlinedString::InternalSwap(TestInlinedString* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  repeated_string_.InternalSwap(&other->repeated_string_);
+  optional_string_.Swap(&other->optional_string_);
+  optional_bytes_.Swap(&other->optional_bytes_);
+  required_string_.Swap(&other->required_string_);
+  default_string_.Swap(&other->default_string_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestInlinedString, optional_int32_)
+      + sizeof(TestInlinedString::optional_int32_)
+      - PROTOBUF_FIELD_OFFSET(TestInlinedString, child_)>(
+          reinterpret_cast<char*>(&child_),
+          reinterpret_cast<char*>(&other->child_));
+  swap(oneof_field_, other->oneof_field_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestInlinedString::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest_inlined_string
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::protobuf_unittest_inlined_string::TestInlinedString* Arena::CreateMaybeMessage< ::protobuf_unittest_inlined_string::TestInlinedString >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest_inlined_string::TestInlinedString >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
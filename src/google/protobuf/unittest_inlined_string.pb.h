@@ -0,0 +1,1067 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_inlined_string.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3012000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3012003 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[1]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto;
+namespace protobuf_unittest_inlined_string {
+class TestInlinedString;
+class TestInlinedStringDefaultTypeInternal;
+extern TestInlinedStringDefaultTypeInternal _TestInlinedString_default_instance_;
+}  // namespace protobuf_unittest_inlined_string
+PROTOBUF_NAMESPACE_OPEN
+template<> ::protobuf_unittest_inlined_string::TestInlinedString* Arena::CreateMaybeMessage<::protobuf_unittest_inlined_string::TestInlinedString>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace protobuf_unittest_inlined_string {
+
+// ===================================================================
+
+class TestInlinedString PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protobuf_unittest_inlined_string.TestInlinedString) */ {
+ public:
+  inline TestInlinedString() : TestInlinedString(nullptr) {};
+  virtual ~TestInlinedString();
+
+  TestInlinedString(const TestInlinedString& from);
+  TestInlinedString(TestInlinedString&& from) noexcept
+    : TestInlinedString() {
+    *this = ::std::move(from);
+  }
+
+  inline TestInlinedString& operator=(const TestInlinedString& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestInlinedString& operator=(TestInlinedString&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestInlinedString& default_instance();
+
+  enum OneofFieldCase {
+    kOneofString = 6,
+    kOneofUint32 = 7,
+    ONEOF_FIELD_NOT_SET = 0,
+  };
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestInlinedString* internal_default_instance() {
+    return reinterpret_cast<const TestInlinedString*>(
+               &_TestInlinedString_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TestInlinedString& a, TestInlinedString& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestInlinedString* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestInlinedString* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestInlinedString* New() const final {
+    return CreateMaybeMessage<TestInlinedString>(nullptr);
+  }
+
+  TestInlinedString* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestInlinedString>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestInlinedString& from);
+  void MergeFrom(const TestInlinedString& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestInlinedString* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest_inlined_string.TestInlinedString";
+  }
+  protected:
+  explicit TestInlinedString(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedStringFieldNumber = 8,
+    kOptionalStringFieldNumber = 1,
+    kOptionalBytesFieldNumber = 2,
+    kRequiredStringFieldNumber = 3,
+    kDefaultStringFieldNumber = 4,
+    kChildFieldNumber = 9,
+    kOptionalInt32FieldNumber = 5,
+    kOneofStringFieldNumber = 6,
+    kOneofUint32FieldNumber = 7,
+  };
+  // repeated string repeated_string = 8;
+  int repeated_string_size() const;
+  private:
+  int _internal_repeated_string_size() const;
+  public:
+  void clear_repeated_string();
+  const std::string& repeated_string(int index) const;
+  std::string* mutable_repeated_string(int index);
+  void set_repeated_string(int index, const std::string& value);
+  void set_repeated_string(int index, std::string&& value);
+  void set_repeated_string(int index, const char* value);
+  void set_repeated_string(int index, const char* value, size_t size);
+  std::string* add_repeated_string();
+  void add_repeated_string(const std::string& value);
+  void add_repeated_string(std::string&& value);
+  void add_repeated_string(const char* value);
+  void add_repeated_string(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& repeated_string() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_repeated_string();
+  private:
+  const std::string& _internal_repeated_string(int index) const;
+  std::string* _internal_add_repeated_string();
+  public:
+
+  // optional string optional_string = 1;
+  bool has_optional_string() const;
+  private:
+  bool _internal_has_optional_string() const;
+  public:
+  void clear_optional_string();
+  const std::string& optional_string() const;
+  void set_optional_string(const std::string& value);
+  void set_optional_string(std::string&& value);
+  void set_optional_string(const char* value);
+  void set_optional_string(const char* value, size_t size);
+  std::string* mutable_optional_string();
+  std::string* release_optional_string();
+  void set_allocated_optional_string(std::string* optional_string);
+  private:
+  const std::string& _internal_optional_string() const;
+  void _internal_set_optional_string(const std::string& value);
+  std::string* _internal_mutable_optional_string();
+  public:
+
+  // optional bytes optional_bytes = 2;
+  bool has_optional_bytes() const;
+  private:
+  bool _internal_has_optional_bytes() const;
+  public:
+  void clear_optional_bytes();
+  const std::string& optional_bytes() const;
+  void set_optional_bytes(const std::string& value);
+  void set_optional_bytes(std::string&& value);
+  void set_optional_bytes(const char* value);
+  void set_optional_bytes(const void* value, size_t size);
+  std::string* mutable_optional_bytes();
+  std::string* release_optional_bytes();
+  void set_allocated_optional_bytes(std::string* optional_bytes);
+  private:
+  const std::string& _internal_optional_bytes() const;
+  void _internal_set_optional_bytes(const std::string& value);
+  std::string* _internal_mutable_optional_bytes();
+  public:
+
+  // required string required_string = 3;
+  bool has_required_string() const;
+  private:
+  bool _internal_has_required_string() const;
+  public:
+  void clear_required_string();
+  const std::string& required_string() const;
+  void set_required_string(const std::string& value);
+  void set_required_string(std::string&& value);
+  void set_required_string(const char* value);
+  void set_required_string(const char* value, size_t size);
+  std::string* mutable_required_string();
+  std::string* release_required_string();
+  void set_allocated_required_string(std::string* required_string);
+  private:
+  const std::string& _internal_required_string() const;
+  void _internal_set_required_string(const std::string& value);
+  std::string* _internal_mutable_required_string();
+  public:
+
+  // optional string default_string = 4 [default = "hello"];
+  bool has_default_string() const;
+  private:
+  bool _internal_has_default_string() const;
+  public:
+  void clear_default_string();
+  const std::string& default_string() const;
+  void set_default_string(const std::string& value);
+  void set_default_string(std::string&& value);
+  void set_default_string(const char* value);
+  void set_default_string(const char* value, size_t size);
+  std::string* mutable_default_string();
+  std::string* release_default_string();
+  void set_allocated_default_string(std::string* default_string);
+  private:
+  const std::string& _internal_default_string() const;
+  void _internal_set_default_string(const std::string& value);
+  std::string* _internal_mutable_default_string();
+  public:
+
+  // optional .protobuf_unittest_inlined_string.TestInlinedString child = 9;
+  bool has_child() const;
+  private:
+  bool _internal_has_child() const;
+  public:
+  void clear_child();
+  const ::protobuf_unittest_inlined_string::TestInlinedString& child() const;
+  ::protobuf_unittest_inlined_string::TestInlinedString* release_child();
+  ::protobuf_unittest_inlined_string::TestInlinedString* mutable_child();
+  void set_allocated_child(::protobuf_unittest_inlined_string::TestInlinedString* child);
+  private:
+  const ::protobuf_unittest_inlined_string::TestInlinedString& _internal_child() const;
+  ::protobuf_unittest_inlined_string::TestInlinedString* _internal_mutable_child();
+  public:
+  void unsafe_arena_set_allocated_child(
+      ::protobuf_unittest_inlined_string::TestInlinedString* child);
+  ::protobuf_unittest_inlined_string::TestInlinedString* unsafe_arena_release_child();
+
+  // optional int32 optional_int32 = 5;
+  bool has_optional_int32() const;
+  private:
+  bool _internal_has_optional_int32() const;
+  public:
+  void clear_optional_int32();
+  ::PROTOBUF_NAMESPACE_ID::int32 optional_int32() const;
+  void set_optional_int32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_optional_int32() const;
+  void _internal_set_optional_int32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // string oneof_string = 6;
+  bool has_oneof_string() const;
+  private:
+  bool _internal_has_oneof_string() const;
+  public:
+  void clear_oneof_string();
+  const std::string& oneof_string() const;
+  void set_oneof_string(const std::string& value);
+  void set_oneof_string(std::string&& value);
+  void set_oneof_string(const char* value);
+  void set_oneof_string(const char* value, size_t size);
+  std::string* mutable_oneof_string();
+  std::string* release_oneof_string();
+  void set_allocated_oneof_string(std::string* oneof_string);
+  private:
+  const std::string& _internal_oneof_string() const;
+  void _internal_set_oneof_string(const std::string& value);
+  std::string* _internal_mutable_oneof_string();
+  public:
+
+  // uint32 oneof_uint32 = 7;
+  bool has_oneof_uint32() const;
+  private:
+  bool _internal_has_oneof_uint32() const;
+  public:
+  void clear_oneof_uint32();
+  ::PROTOBUF_NAMESPACE_ID::uint32 oneof_uint32() const;
+  void set_oneof_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_oneof_uint32() const;
+  void _internal_set_oneof_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  void clear_oneof_field();
+  OneofFieldCase oneof_field_case() const;
+  // @@protoc_insertion_point(class_scope:protobuf_unittest_inlined_string.TestInlinedString)
+ private:
+  class _Internal;
+  void set_has_oneof_string();
+  void set_has_oneof_uint32();
+
+  inline bool has_oneof_field() const;
+  inline void clear_has_oneof_field();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> repeated_string_;
+  ::PROTOBUF_NAMESPACE_ID::internal::InlinedStringField optional_string_;
+  ::PROTOBUF_NAMESPACE_ID::internal::InlinedStringField optional_bytes_;
+  ::PROTOBUF_NAMESPACE_ID::internal::InlinedStringField required_string_;
+  public:
+  static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> _i_give_permission_to_break_this_code_default_default_string_;
+  private:
+  ::PROTOBUF_NAMESPACE_ID::internal::InlinedStringField default_string_;
+  ::protobuf_unittest_inlined_string::TestInlinedString* child_;
+  ::PROTOBUF_NAMESPACE_ID::int32 optional_int32_;
+  union OneofFieldUnion {
+    OneofFieldUnion() {}
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_string_;
+    ::PROTOBUF_NAMESPACE_ID::uint32 oneof_uint32_;
+  } oneof_field_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TestInlinedString
+
+// optional string optional_string = 1;
+inline bool TestInlinedString::_internal_has_optional_string() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TestInlinedString::has_optional_string() const {
+  return _internal_has_optional_string();
+}
+inline void TestInlinedString::clear_optional_string() {
+  optional_string_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TestInlinedString::optional_string() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_inlined_string.TestInlinedString.optional_string)
+  return _internal_optional_string();
+}
+inline void TestInlinedString::set_optional_string(const std::string& value) {
+  _internal_set_optional_string(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest_inlined_string.TestInlinedString.optional_string)
+}
+inline std::string* TestInlinedString::mutable_optional_string() {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest_inlined_string.TestInlinedString.optional_string)
+  return _internal_mutable_optional_string();
+}
+inline const std::string& TestInlinedString::_internal_optional_string() const {
+  return optional_string_.Get();
+}
+inline void TestInlinedString::_internal_set_optional_string(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  optional_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void TestInlinedString::set_optional_string(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  optional_string_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest_inlined_string.TestInlinedString.optional_string)
+}
+inline void TestInlinedString::set_optional_string(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  optional_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest_inlined_string.TestInlinedString.optional_string)
+}
+inline void TestInlinedString::set_optional_string(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  optional_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest_inlined_string.TestInlinedString.optional_string)
+}
+inline std::string* TestInlinedString::_internal_mutable_optional_string() {
+  _has_bits_[0] |= 0x00000001u;
+  return optional_string_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* TestInlinedString::release_optional_string() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest_inlined_string.TestInlinedString.optional_string)
+  if (!_internal_has_optional_string()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return optional_string_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void TestInlinedString::set_allocated_optional_string(std::string* optional_string) {
+  if (optional_string != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  optional_string_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), optional_string,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest_inlined_string.TestInlinedString.optional_string)
+}
+
+// optional bytes optional_bytes = 2;
+inline bool TestInlinedString::_internal_has_optional_bytes() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TestInlinedString::has_optional_bytes() const {
+  return _internal_has_optional_bytes();
+}
+inline void TestInlinedString::clear_optional_bytes() {
+  optional_bytes_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& TestInlinedString::optional_bytes() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_inlined_string.TestInlinedString.optional_bytes)
+  return _internal_optional_bytes();
+}
+inline void TestInlinedString::set_optional_bytes(const std::string& value) {
+  _internal_set_optional_bytes(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest_inlined_string.TestInlinedString.optional_bytes)
+}
+inline std::string* TestInlinedString::mutable_optional_bytes() {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest_inlined_string.TestInlinedString.optional_bytes)
+  return _internal_mutable_optional_bytes();
+}
+inline const std::string& TestInlinedString::_internal_optional_bytes() const {
+  return optional_bytes_.Get();
+}
+inline void TestInlinedString::_internal_set_optional_bytes(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  optional_bytes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void TestInlinedString::set_optional_bytes(std::string&& value) {
+  _has_bits_[0] |= 0x00000002u;
+  optional_bytes_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest_inlined_string.TestInlinedString.optional_bytes)
+}
+inline void TestInlinedString::set_optional_bytes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000002u;
+  optional_bytes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest_inlined_string.TestInlinedString.optional_bytes)
+}
+inline void TestInlinedString::set_optional_bytes(const void* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000002u;
+  optional_bytes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest_inlined_string.TestInlinedString.optional_bytes)
+}
+inline std::string* TestInlinedString::_internal_mutable_optional_bytes() {
+  _has_bits_[0] |= 0x00000002u;
+  return optional_bytes_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* TestInlinedString::release_optional_bytes() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest_inlined_string.TestInlinedString.optional_bytes)
+  if (!_internal_has_optional_bytes()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  return optional_bytes_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void TestInlinedString::set_allocated_optional_bytes(std::string* optional_bytes) {
+  if (optional_bytes != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  optional_bytes_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), optional_bytes,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest_inlined_string.TestInlinedString.optional_bytes)
+}
+
+// required string required_string = 3;
+inline bool TestInlinedString::_internal_has_required_string() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TestInlinedString::has_required_string() const {
+  return _internal_has_required_string();
+}
+inline void TestInlinedString::clear_required_string() {
+  required_string_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& TestInlinedString::required_string() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_inlined_string.TestInlinedString.required_string)
+  return _internal_required_string();
+}
+inline void TestInlinedString::set_required_string(const std::string& value) {
+  _internal_set_required_string(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest_inlined_string.TestInlinedString.required_string)
+}
+inline std::string* TestInlinedString::mutable_required_string() {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest_inlined_string.TestInlinedString.required_string)
+  return _internal_mutable_required_string();
+}
+inline const std::string& TestInlinedString::_internal_required_string() const {
+  return required_string_.Get();
+}
+inline void TestInlinedString::_internal_set_required_string(const std::string& value) {
+  _has_bits_[0] |= 0x00000004u;
+  required_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void TestInlinedString::set_required_string(std::string&& value) {
+  _has_bits_[0] |= 0x00000004u;
+  required_string_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest_inlined_string.TestInlinedString.required_string)
+}
+inline void TestInlinedString::set_required_string(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000004u;
+  required_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest_inlined_string.TestInlinedString.required_string)
+}
+inline void TestInlinedString::set_required_string(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000004u;
+  required_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest_inlined_string.TestInlinedString.required_string)
+}
+inline std::string* TestInlinedString::_internal_mutable_required_string() {
+  _has_bits_[0] |= 0x00000004u;
+  return required_string_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* TestInlinedString::release_required_string() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest_inlined_string.TestInlinedString.required_string)
+  if (!_internal_has_required_string()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000004u;
+  return required_string_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void TestInlinedString::set_allocated_required_string(std::string* required_string) {
+  if (required_string != nullptr) {
+    _has_bits_[0] |= 0x00000004u;
+  } else {
+    _has_bits_[0] &= ~0x00000004u;
+  }
+  required_string_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), required_string,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest_inlined_string.TestInlinedString.required_string)
+}
+
+// optional string default_string = 4 [default = "hello"];
+inline bool TestInlinedString::_internal_has_default_string() const {
+  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool TestInlinedString::has_default_string() const {
+  return _internal_has_default_string();
+}
+inline void TestInlinedString::clear_default_string() {
+  default_string_.ClearToDefault(&::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get(), GetArena());
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& TestInlinedString::default_string() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_inlined_string.TestInlinedString.default_string)
+  return _internal_default_string();
+}
+inline void TestInlinedString::set_default_string(const std::string& value) {
+  _internal_set_default_string(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest_inlined_string.TestInlinedString.default_string)
+}
+inline std::string* TestInlinedString::mutable_default_string() {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest_inlined_string.TestInlinedString.default_string)
+  return _internal_mutable_default_string();
+}
+inline const std::string& TestInlinedString::_internal_default_string() const {
+  return default_string_.Get();
+}
+inline void TestInlinedString::_internal_set_default_string(const std::string& value) {
+  _has_bits_[0] |= 0x00000008u;
+  default_string_.Set(&::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get(), value, GetArena());
+}
+inline void TestInlinedString::set_default_string(std::string&& value) {
+  _has_bits_[0] |= 0x00000008u;
+  default_string_.Set(
+    &::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest_inlined_string.TestInlinedString.default_string)
+}
+inline void TestInlinedString::set_default_string(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000008u;
+  default_string_.Set(&::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest_inlined_string.TestInlinedString.default_string)
+}
+inline void TestInlinedString::set_default_string(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000008u;
+  default_string_.Set(&::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest_inlined_string.TestInlinedString.default_string)
+}
+inline std::string* TestInlinedString::_internal_mutable_default_string() {
+  _has_bits_[0] |= 0x00000008u;
+  return default_string_.Mutable(&::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get(), GetArena());
+}
+inline std::string* TestInlinedString::release_default_string() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest_inlined_string.TestInlinedString.default_string)
+  if (!_internal_has_default_string()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000008u;
+  return default_string_.ReleaseNonDefault(&::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get(), GetArena());
+}
+inline void TestInlinedString::set_allocated_default_string(std::string* default_string) {
+  if (default_string != nullptr) {
+    _has_bits_[0] |= 0x00000008u;
+  } else {
+    _has_bits_[0] &= ~0x00000008u;
+  }
+  default_string_.SetAllocated(&::protobuf_unittest_inlined_string::TestInlinedString::_i_give_permission_to_break_this_code_default_default_string_.get(), default_string,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest_inlined_string.TestInlinedString.default_string)
+}
+
+// optional int32 optional_int32 = 5;
+inline bool TestInlinedString::_internal_has_optional_int32() const {
+  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool TestInlinedString::has_optional_int32() const {
+  return _internal_has_optional_int32();
+}
+inline void TestInlinedString::clear_optional_int32() {
+  optional_int32_ = 0;
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestInlinedString::_internal_optional_int32() const {
+  return optional_int32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestInlinedString::optional_int32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_inlined_string.TestInlinedString.optional_int32)
+  return _internal_optional_int32();
+}
+inline void TestInlinedString::_internal_set_optional_int32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000020u;
+  optional_int32_ = value;
+}
+inline void TestInlinedString::set_optional_int32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_optional_int32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest_inlined_string.TestInlinedString.optional_int32)
+}
+
+// string oneof_string = 6;
+inline bool TestInlinedString::_internal_has_oneof_string() const {
+  return oneof_field_case() == kOneofString;
+}
+inline bool TestInlinedString::has_oneof_string() const {
+  return _internal_has_oneof_string();
+}
+inline void TestInlinedString::set_has_oneof_string() {
+  _oneof_case_[0] = kOneofString;
+}
+inline void TestInlinedString::clear_oneof_string() {
+  if (_internal_has_oneof_string()) {
+    oneof_field_.oneof_string_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+    clear_has_oneof_field();
+  }
+}
+inline const std::string& TestInlinedString::oneof_string() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_inlined_string.TestInlinedString.oneof_string)
+  return _internal_oneof_string();
+}
+inline void TestInlinedString::set_oneof_string(const std::string& value) {
+  _internal_set_oneof_string(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest_inlined_string.TestInlinedString.oneof_string)
+}
+inline std::string* TestInlinedString::mutable_oneof_string() {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest_inlined_string.TestInlinedString.oneof_string)
+  return _internal_mutable_oneof_string();
+}
+inline const std::string& TestInlinedString::_internal_oneof_string() const {
+  if (_internal_has_oneof_string()) {
+    return oneof_field_.oneof_string_.Get();
+  }
+  return *&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void TestInlinedString::_internal_set_oneof_string(const std::string& value) {
+  if (!_internal_has_oneof_string()) {
+    clear_oneof_field();
+    set_has_oneof_string();
+    oneof_field_.oneof_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  oneof_field_.oneof_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void TestInlinedString::set_oneof_string(std::string&& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest_inlined_string.TestInlinedString.oneof_string)
+  if (!_internal_has_oneof_string()) {
+    clear_oneof_field();
+    set_has_oneof_string();
+    oneof_field_.oneof_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  oneof_field_.oneof_string_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest_inlined_string.TestInlinedString.oneof_string)
+}
+inline void TestInlinedString::set_oneof_string(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  if (!_internal_has_oneof_string()) {
+    clear_oneof_field();
+    set_has_oneof_string();
+    oneof_field_.oneof_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  oneof_field_.oneof_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest_inlined_string.TestInlinedString.oneof_string)
+}
+inline void TestInlinedString::set_oneof_string(const char* value,
+                             size_t size) {
+  if (!_internal_has_oneof_string()) {
+    clear_oneof_field();
+    set_has_oneof_string();
+    oneof_field_.oneof_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  oneof_field_.oneof_string_.Set(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size),
+      GetArena());
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest_inlined_string.TestInlinedString.oneof_string)
+}
+inline std::string* TestInlinedString::_internal_mutable_oneof_string() {
+  if (!_internal_has_oneof_string()) {
+    clear_oneof_field();
+    set_has_oneof_string();
+    oneof_field_.oneof_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  return oneof_field_.oneof_string_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* TestInlinedString::release_oneof_string() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest_inlined_string.TestInlinedString.oneof_string)
+  if (_internal_has_oneof_string()) {
+    clear_has_oneof_field();
+    return oneof_field_.oneof_string_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  } else {
+    return nullptr;
+  }
+}
+inline void TestInlinedString::set_allocated_oneof_string(std::string* oneof_string) {
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  if (oneof_string != nullptr) {
+    set_has_oneof_string();
+    oneof_field_.oneof_string_.UnsafeSetDefault(oneof_string);
+    ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena();
+    if (arena != nullptr) {
+      arena->Own(oneof_string);
+    }
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest_inlined_string.TestInlinedString.oneof_string)
+}
+
+// uint32 oneof_uint32 = 7;
+inline bool TestInlinedString::_internal_has_oneof_uint32() const {
+  return oneof_field_case() == kOneofUint32;
+}
+inline bool TestInlinedString::has_oneof_uint32() const {
+  return _internal_has_oneof_uint32();
+}
+inline void TestInlinedString::set_has_oneof_uint32() {
+  _oneof_case_[0] = kOneofUint32;
+}
+inline void TestInlinedString::clear_oneof_uint32() {
+  if (_internal_has_oneof_uint32()) {
+    oneof_field_.oneof_uint32_ = 0u;
+    clear_has_oneof_field();
+  }
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestInlinedString::_internal_oneof_uint32() const {
+  if (_internal_has_oneof_uint32()) {
+    return oneof_field_.oneof_uint32_;
+  }
+  return 0u;
+}
+inline void TestInlinedString::_internal_set_oneof_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  if (!_internal_has_oneof_uint32()) {
+    clear_oneof_field();
+    set_has_oneof_uint32();
+  }
+  oneof_field_.oneof_uint32_ = value;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestInlinedString::oneof_uint32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_inlined_string.TestInlinedString.oneof_uint32)
+  return _internal_oneof_uint32();
+}
+inline void TestInlinedString::set_oneof_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_oneof_uint32(value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest_inlined_string.TestInlinedString.oneof_uint32)
+}
+
+// repeated string repeated_string = 8;
+inline int TestInlinedString::_internal_repeated_string_size() const {
+  return repeated_string_.size();
+}
+inline int TestInlinedString::repeated_string_size() const {
+  return _internal_repeated_string_size();
+}
+inline void TestInlinedString::clear_repeated_string() {
+  repeated_string_.Clear();
+}
+inline std::string* TestInlinedString::add_repeated_string() {
+  // @@protoc_insertion_point(field_add_mutable:protobuf_unittest_inlined_string.TestInlinedString.repeated_string)
+  return _internal_add_repeated_string();
+}
+inline const std::string& TestInlinedString::_internal_repeated_string(int index) const {
+  return repeated_string_.Get(index);
+}
+inline const std::string& TestInlinedString::repeated_string(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_inlined_string.TestInlinedString.repeated_string)
+  return _internal_repeated_string(index);
+}
+inline std::string* TestInlinedString::mutable_repeated_string(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest_inlined_string.TestInlinedString.repeated_string)
+  return repeated_string_.Mutable(index);
+}
+inline void TestInlinedString::set_repeated_string(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest_inlined_string.TestInlinedString.repeated_string)
+  repeated_string_.Mutable(index)->assign(value);
+}
+inline void TestInlinedString::set_repeated_string(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest_inlined_string.TestInlinedString.repeated_string)
+  repeated_string_.Mutable(index)->assign(std::move(value));
+}
+inline void TestInlinedString::set_repeated_string(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  repeated_string_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest_inlined_string.TestInlinedString.repeated_string)
+}
+inline void TestInlinedString::set_repeated_string(int index, const char* value, size_t size) {
+  repeated_string_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest_inlined_string.TestInlinedString.repeated_string)
+}
+inline std::string* TestInlinedString::_internal_add_repeated_string() {
+  return repeated_string_.Add();
+}
+inline void TestInlinedString::add_repeated_string(const std::string& value) {
+  repeated_string_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest_inlined_string.TestInlinedString.repeated_string)
+}
+inline void TestInlinedString::add_repeated_string(std::string&& value) {
+  repeated_string_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:protobuf_unittest_inlined_string.TestInlinedString.repeated_string)
+}
+inline void TestInlinedString::add_repeated_string(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  repeated_string_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protobuf_unittest_inlined_string.TestInlinedString.repeated_string)
+}
+inline void TestInlinedString::add_repeated_string(const char* value, size_t size) {
+  repeated_string_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protobuf_unittest_inlined_string.TestInlinedString.repeated_string)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TestInlinedString::repeated_string() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest_inlined_string.TestInlinedString.repeated_string)
+  return repeated_string_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TestInlinedString::mutable_repeated_string() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest_inlined_string.TestInlinedString.repeated_string)
+  return &repeated_string_;
+}
+
+// optional .protobuf_unittest_inlined_string.TestInlinedString child = 9;
+inline bool TestInlinedString::_internal_has_child() const {
+  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || child_ != nullptr);
+  return value;
+}
+inline bool TestInlinedString::has_child() const {
+  return _internal_has_child();
+}
+inline void TestInlinedString::clear_child() {
+  if (child_ != nullptr) child_->Clear();
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline const ::protobuf_unittest_inlined_string::TestInlinedString& TestInlinedString::_internal_child() const {
+  const ::protobuf_unittest_inlined_string::TestInlinedString* p = child_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::protobuf_unittest_inlined_string::TestInlinedString*>(
+      &::protobuf_unittest_inlined_string::_TestInlinedString_default_instance_);
+}
+inline const ::protobuf_unittest_inlined_string::TestInlinedString& TestInlinedString::child() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest_inlined_string.TestInlinedString.child)
+  return _internal_child();
+}
+inline void TestInlinedString::unsafe_arena_set_allocated_child(
+    ::protobuf_unittest_inlined_string::TestInlinedString* child) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(child_);
+  }
+  child_ = child;
+  if (child) {
+    _has_bits_[0] |= 0x00000010u;
+  } else {
+    _has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest_inlined_string.TestInlinedString.child)
+}
+inline ::protobuf_unittest_inlined_string::TestInlinedString* TestInlinedString::release_child() {
+  _has_bits_[0] &= ~0x00000010u;
+  ::protobuf_unittest_inlined_string::TestInlinedString* temp = child_;
+  child_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::protobuf_unittest_inlined_string::TestInlinedString* TestInlinedString::unsafe_arena_release_child() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest_inlined_string.TestInlinedString.child)
+  _has_bits_[0] &= ~0x00000010u;
+  ::protobuf_unittest_inlined_string::TestInlinedString* temp = child_;
+  child_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest_inlined_string::TestInlinedString* TestInlinedString::_internal_mutable_child() {
+  _has_bits_[0] |= 0x00000010u;
+  if (child_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest_inlined_string::TestInlinedString>(GetArena());
+    child_ = p;
+  }
+  return child_;
+}
+inline ::protobuf_unittest_inlined_string::TestInlinedString* TestInlinedString::mutable_child() {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest_inlined_string.TestInlinedString.child)
+  return _internal_mutable_child();
+}
+inline void TestInlinedString::set_allocated_child(::protobuf_unittest_inlined_string::TestInlinedString* child) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete child_;
+  }
+  if (child) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(child);
+    if (message_arena != submessage_arena) {
+      child = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, child, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000010u;
+  } else {
+    _has_bits_[0] &= ~0x00000010u;
+  }
+  child_ = child;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest_inlined_string.TestInlinedString.child)
+}
+
+inline bool TestInlinedString::has_oneof_field() const {
+  return oneof_field_case() != ONEOF_FIELD_NOT_SET;
+}
+inline void TestInlinedString::clear_has_oneof_field() {
+  _oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+inline TestInlinedString::OneofFieldCase TestInlinedString::oneof_field_case() const {
+  return TestInlinedString::OneofFieldCase(_oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest_inlined_string
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5finlined_5fstring_2eproto
@@ -0,0 +1,11889 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_lite.proto
+
+#include "google/protobuf/unittest_lite.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ForeignMessageLite_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_OptionalGroup_extension_lite_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RepeatedGroup_extension_lite_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllTypesLite_NestedMessage_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllTypesLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllTypesLite_RepeatedGroup_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestDeprecatedLite_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestHugeFieldNumbersLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestParsingMergeLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestParsingMergeLite_RepeatedFieldsGenerator_Group1_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestParsingMergeLite_RepeatedFieldsGenerator_Group2_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestParsingMergeLite_RepeatedGroup_google_2fprotobuf_2funittest_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fimport_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ImportMessageLite_google_2fprotobuf_2funittest_5fimport_5flite_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fimport_5fpublic_5flite_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PublicImportMessageLite_google_2fprotobuf_2funittest_5fimport_5fpublic_5flite_2eproto;
+namespace protobuf_unittest {
+class TestAllTypesLite_NestedMessageDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestAllTypesLite_NestedMessage> _instance;
+} _TestAllTypesLite_NestedMessage_default_instance_;
+class TestAllTypesLite_OptionalGroupDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestAllTypesLite_OptionalGroup> _instance;
+} _TestAllTypesLite_OptionalGroup_default_instance_;
+class TestAllTypesLite_RepeatedGroupDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestAllTypesLite_RepeatedGroup> _instance;
+} _TestAllTypesLite_RepeatedGroup_default_instance_;
+class TestAllTypesLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestAllTypesLite> _instance;
+  ::PROTOBUF_NAMESPACE_ID::uint32 oneof_uint32_;
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage* oneof_nested_message_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_string_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_bytes_;
+  const ::protobuf_unittest::TestAllTypesLite_NestedMessage* oneof_lazy_nested_message_;
+} _TestAllTypesLite_default_instance_;
+class ForeignMessageLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ForeignMessageLite> _instance;
+} _ForeignMessageLite_default_instance_;
+class TestPackedTypesLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestPackedTypesLite> _instance;
+} _TestPackedTypesLite_default_instance_;
+class TestAllExtensionsLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestAllExtensionsLite> _instance;
+} _TestAllExtensionsLite_default_instance_;
+class OptionalGroup_extension_liteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<OptionalGroup_extension_lite> _instance;
+} _OptionalGroup_extension_lite_default_instance_;
+class RepeatedGroup_extension_liteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RepeatedGroup_extension_lite> _instance;
+} _RepeatedGroup_extension_lite_default_instance_;
+class TestPackedExtensionsLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestPackedExtensionsLite> _instance;
+} _TestPackedExtensionsLite_default_instance_;
+class TestNestedExtensionLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestNestedExtensionLite> _instance;
+} _TestNestedExtensionLite_default_instance_;
+class TestDeprecatedLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestDeprecatedLite> _instance;
+} _TestDeprecatedLite_default_instance_;
+class TestParsingMergeLite_RepeatedFieldsGenerator_Group1DefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestParsingMergeLite_RepeatedFieldsGenerator_Group1> _instance;
+} _TestParsingMergeLite_RepeatedFieldsGenerator_Group1_default_instance_;
+class TestParsingMergeLite_RepeatedFieldsGenerator_Group2DefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestParsingMergeLite_RepeatedFieldsGenerator_Group2> _instance;
+} _TestParsingMergeLite_RepeatedFieldsGenerator_Group2_default_instance_;
+class TestParsingMergeLite_RepeatedFieldsGeneratorDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestParsingMergeLite_RepeatedFieldsGenerator> _instance;
+} _TestParsingMergeLite_RepeatedFieldsGenerator_default_instance_;
+class TestParsingMergeLite_OptionalGroupDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestParsingMergeLite_OptionalGroup> _instance;
+} _TestParsingMergeLite_OptionalGroup_default_instance_;
+class TestParsingMergeLite_RepeatedGroupDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestParsingMergeLite_RepeatedGroup> _instance;
+} _TestParsingMergeLite_RepeatedGroup_default_instance_;
+class TestParsingMergeLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestParsingMergeLite> _instance;
+} _TestParsingMergeLite_default_instance_;
+class TestEmptyMessageLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestEmptyMessageLite> _instance;
+} _TestEmptyMessageLite_default_instance_;
+class TestEmptyMessageWithExtensionsLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestEmptyMessageWithExtensionsLite> _instance;
+} _TestEmptyMessageWithExtensionsLite_default_instance_;
+class V1MessageLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<V1MessageLite> _instance;
+} _V1MessageLite_default_instance_;
+class V2MessageLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<V2MessageLite> _instance;
+} _V2MessageLite_default_instance_;
+class TestHugeFieldNumbersLite_OptionalGroupDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestHugeFieldNumbersLite_OptionalGroup> _instance;
+} _TestHugeFieldNumbersLite_OptionalGroup_default_instance_;
+class TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse> _instance;
+} _TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse_default_instance_;
+class TestHugeFieldNumbersLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestHugeFieldNumbersLite> _instance;
+  ::PROTOBUF_NAMESPACE_ID::uint32 oneof_uint32_;
+  const ::protobuf_unittest::TestAllTypesLite* oneof_test_all_types_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_string_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_bytes_;
+} _TestHugeFieldNumbersLite_default_instance_;
+class TestOneofParsingLiteDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestOneofParsingLite> _instance;
+  ::PROTOBUF_NAMESPACE_ID::int32 oneof_int32_;
+  const ::protobuf_unittest::TestAllTypesLite* oneof_submessage_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_string_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_bytes_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_string_cord_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_bytes_cord_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_string_string_piece_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_bytes_string_piece_;
+  int oneof_enum_;
+} _TestOneofParsingLite_default_instance_;
+class PackedInt32DefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PackedInt32> _instance;
+} _PackedInt32_default_instance_;
+class NonPackedInt32DefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<NonPackedInt32> _instance;
+} _NonPackedInt32_default_instance_;
+class PackedFixed32DefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PackedFixed32> _instance;
+} _PackedFixed32_default_instance_;
+class NonPackedFixed32DefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<NonPackedFixed32> _instance;
+} _NonPackedFixed32_default_instance_;
+class DupEnumDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DupEnum> _instance;
+} _DupEnum_default_instance_;
+}  // namespace protobuf_unittest
+static void InitDefaultsscc_info_DupEnum_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_DupEnum_default_instance_;
+    new (ptr) ::protobuf_unittest::DupEnum();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::DupEnum::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DupEnum_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_DupEnum_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_ForeignMessageLite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_ForeignMessageLite_default_instance_;
+    new (ptr) ::protobuf_unittest::ForeignMessageLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::ForeignMessageLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ForeignMessageLite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_ForeignMessageLite_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_NonPackedFixed32_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_NonPackedFixed32_default_instance_;
+    new (ptr) ::protobuf_unittest::NonPackedFixed32();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::NonPackedFixed32::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NonPackedFixed32_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_NonPackedFixed32_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_NonPackedInt32_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_NonPackedInt32_default_instance_;
+    new (ptr) ::protobuf_unittest::NonPackedInt32();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::NonPackedInt32::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NonPackedInt32_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_NonPackedInt32_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_OptionalGroup_extension_lite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_OptionalGroup_extension_lite_default_instance_;
+    new (ptr) ::protobuf_unittest::OptionalGroup_extension_lite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::OptionalGroup_extension_lite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_OptionalGroup_extension_lite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_OptionalGroup_extension_lite_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_PackedFixed32_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_PackedFixed32_default_instance_;
+    new (ptr) ::protobuf_unittest::PackedFixed32();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::PackedFixed32::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PackedFixed32_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_PackedFixed32_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_PackedInt32_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_PackedInt32_default_instance_;
+    new (ptr) ::protobuf_unittest::PackedInt32();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::PackedInt32::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PackedInt32_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_PackedInt32_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_RepeatedGroup_extension_lite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_RepeatedGroup_extension_lite_default_instance_;
+    new (ptr) ::protobuf_unittest::RepeatedGroup_extension_lite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::RepeatedGroup_extension_lite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RepeatedGroup_extension_lite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RepeatedGroup_extension_lite_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestAllExtensionsLite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestAllExtensionsLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestAllExtensionsLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestAllExtensionsLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllExtensionsLite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestAllExtensionsLite_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  ::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_.DefaultConstruct();
+  *::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_.get_mutable() = std::string("hello", 5);
+  ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyString(
+      ::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_.get_mutable());
+  ::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_bytes_.DefaultConstruct();
+  *::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_bytes_.get_mutable() = std::string("world", 5);
+  ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyString(
+      ::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_bytes_.get_mutable());
+  ::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_piece_.DefaultConstruct();
+  *::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_piece_.get_mutable() = std::string("abc", 3);
+  ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyString(
+      ::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_piece_.get_mutable());
+  ::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_cord_.DefaultConstruct();
+  *::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_cord_.get_mutable() = std::string("123", 3);
+  ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyString(
+      ::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_cord_.get_mutable());
+  {
+    void* ptr = &::protobuf_unittest::_TestAllTypesLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestAllTypesLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestAllTypesLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 6, 0, InitDefaultsscc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto}, {
+      &scc_info_TestAllTypesLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto.base,
+      &scc_info_TestAllTypesLite_NestedMessage_google_2fprotobuf_2funittest_5flite_2eproto.base,
+      &scc_info_ForeignMessageLite_google_2fprotobuf_2funittest_5flite_2eproto.base,
+      &scc_info_ImportMessageLite_google_2fprotobuf_2funittest_5fimport_5flite_2eproto.base,
+      &scc_info_PublicImportMessageLite_google_2fprotobuf_2funittest_5fimport_5fpublic_5flite_2eproto.base,
+      &scc_info_TestAllTypesLite_RepeatedGroup_google_2fprotobuf_2funittest_5flite_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestAllTypesLite_NestedMessage_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestAllTypesLite_NestedMessage_default_instance_;
+    new (ptr) ::protobuf_unittest::TestAllTypesLite_NestedMessage();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestAllTypesLite_NestedMessage::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllTypesLite_NestedMessage_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestAllTypesLite_NestedMessage_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestAllTypesLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestAllTypesLite_OptionalGroup_default_instance_;
+    new (ptr) ::protobuf_unittest::TestAllTypesLite_OptionalGroup();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestAllTypesLite_OptionalGroup::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllTypesLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestAllTypesLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestAllTypesLite_RepeatedGroup_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestAllTypesLite_RepeatedGroup_default_instance_;
+    new (ptr) ::protobuf_unittest::TestAllTypesLite_RepeatedGroup();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestAllTypesLite_RepeatedGroup::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllTypesLite_RepeatedGroup_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestAllTypesLite_RepeatedGroup_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestDeprecatedLite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestDeprecatedLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestDeprecatedLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestDeprecatedLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestDeprecatedLite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestDeprecatedLite_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestEmptyMessageLite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestEmptyMessageLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestEmptyMessageLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestEmptyMessageLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestEmptyMessageLite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestEmptyMessageLite_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestEmptyMessageWithExtensionsLite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestEmptyMessageWithExtensionsLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestEmptyMessageWithExtensionsLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestEmptyMessageWithExtensionsLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestEmptyMessageWithExtensionsLite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestEmptyMessageWithExtensionsLite_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestHugeFieldNumbersLite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestHugeFieldNumbersLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestHugeFieldNumbersLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestHugeFieldNumbersLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<4> scc_info_TestHugeFieldNumbersLite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 4, 0, InitDefaultsscc_info_TestHugeFieldNumbersLite_google_2fprotobuf_2funittest_5flite_2eproto}, {
+      &scc_info_ForeignMessageLite_google_2fprotobuf_2funittest_5flite_2eproto.base,
+      &scc_info_TestHugeFieldNumbersLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto.base,
+      &scc_info_TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse_google_2fprotobuf_2funittest_5flite_2eproto.base,
+      &scc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestHugeFieldNumbersLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestHugeFieldNumbersLite_OptionalGroup_default_instance_;
+    new (ptr) ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestHugeFieldNumbersLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestHugeFieldNumbersLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse();
+  }
+  ::protobuf_unittest::TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestNestedExtensionLite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestNestedExtensionLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestNestedExtensionLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestNestedExtensionLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestNestedExtensionLite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestNestedExtensionLite_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestOneofParsingLite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  ::protobuf_unittest::TestOneofParsingLite::_i_give_permission_to_break_this_code_default_oneof_bytes_.DefaultConstruct();
+  *::protobuf_unittest::TestOneofParsingLite::_i_give_permission_to_break_this_code_default_oneof_bytes_.get_mutable() = std::string("default bytes", 13);
+  ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyString(
+      ::protobuf_unittest::TestOneofParsingLite::_i_give_permission_to_break_this_code_default_oneof_bytes_.get_mutable());
+  ::protobuf_unittest::TestOneofParsingLite::_i_give_permission_to_break_this_code_default_oneof_string_cord_.DefaultConstruct();
+  *::protobuf_unittest::TestOneofParsingLite::_i_give_permission_to_break_this_code_default_oneof_string_cord_.get_mutable() = std::string("default Cord", 12);
+  ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyString(
+      ::protobuf_unittest::TestOneofParsingLite::_i_give_permission_to_break_this_code_default_oneof_string_cord_.get_mutable());
+  ::protobuf_unittest::TestOneofParsingLite::_i_give_permission_to_break_this_code_default_oneof_bytes_string_piece_.DefaultConstruct();
+  *::protobuf_unittest::TestOneofParsingLite::_i_give_permission_to_break_this_code_default_oneof_bytes_string_piece_.get_mutable() = std::string("default StringPiece", 19);
+  ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyString(
+      ::protobuf_unittest::TestOneofParsingLite::_i_give_permission_to_break_this_code_default_oneof_bytes_string_piece_.get_mutable());
+  {
+    void* ptr = &::protobuf_unittest::_TestOneofParsingLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestOneofParsingLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestOneofParsingLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestOneofParsingLite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestOneofParsingLite_google_2fprotobuf_2funittest_5flite_2eproto}, {
+      &scc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestPackedExtensionsLite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestPackedExtensionsLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestPackedExtensionsLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestPackedExtensionsLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestPackedExtensionsLite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestPackedExtensionsLite_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestPackedTypesLite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestPackedTypesLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestPackedTypesLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestPackedTypesLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestPackedTypesLite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestPackedTypesLite_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestParsingMergeLite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestParsingMergeLite_default_instance_;
+    new (ptr) ::protobuf_unittest::TestParsingMergeLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestParsingMergeLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_TestParsingMergeLite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 3, 0, InitDefaultsscc_info_TestParsingMergeLite_google_2fprotobuf_2funittest_5flite_2eproto}, {
+      &scc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto.base,
+      &scc_info_TestParsingMergeLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto.base,
+      &scc_info_TestParsingMergeLite_RepeatedGroup_google_2fprotobuf_2funittest_5flite_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestParsingMergeLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestParsingMergeLite_OptionalGroup_default_instance_;
+    new (ptr) ::protobuf_unittest::TestParsingMergeLite_OptionalGroup();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestParsingMergeLite_OptionalGroup::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestParsingMergeLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestParsingMergeLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto}, {
+      &scc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestParsingMergeLite_RepeatedFieldsGenerator_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestParsingMergeLite_RepeatedFieldsGenerator_default_instance_;
+    new (ptr) ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_TestParsingMergeLite_RepeatedFieldsGenerator_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 3, 0, InitDefaultsscc_info_TestParsingMergeLite_RepeatedFieldsGenerator_google_2fprotobuf_2funittest_5flite_2eproto}, {
+      &scc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto.base,
+      &scc_info_TestParsingMergeLite_RepeatedFieldsGenerator_Group1_google_2fprotobuf_2funittest_5flite_2eproto.base,
+      &scc_info_TestParsingMergeLite_RepeatedFieldsGenerator_Group2_google_2fprotobuf_2funittest_5flite_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestParsingMergeLite_RepeatedFieldsGenerator_Group1_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestParsingMergeLite_RepeatedFieldsGenerator_Group1_default_instance_;
+    new (ptr) ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestParsingMergeLite_RepeatedFieldsGenerator_Group1_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestParsingMergeLite_RepeatedFieldsGenerator_Group1_google_2fprotobuf_2funittest_5flite_2eproto}, {
+      &scc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestParsingMergeLite_RepeatedFieldsGenerator_Group2_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestParsingMergeLite_RepeatedFieldsGenerator_Group2_default_instance_;
+    new (ptr) ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestParsingMergeLite_RepeatedFieldsGenerator_Group2_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestParsingMergeLite_RepeatedFieldsGenerator_Group2_google_2fprotobuf_2funittest_5flite_2eproto}, {
+      &scc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestParsingMergeLite_RepeatedGroup_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestParsingMergeLite_RepeatedGroup_default_instance_;
+    new (ptr) ::protobuf_unittest::TestParsingMergeLite_RepeatedGroup();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestParsingMergeLite_RepeatedGroup::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestParsingMergeLite_RepeatedGroup_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestParsingMergeLite_RepeatedGroup_google_2fprotobuf_2funittest_5flite_2eproto}, {
+      &scc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto.base,}};
+
+static void InitDefaultsscc_info_V1MessageLite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_V1MessageLite_default_instance_;
+    new (ptr) ::protobuf_unittest::V1MessageLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::V1MessageLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_V1MessageLite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_V1MessageLite_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+static void InitDefaultsscc_info_V2MessageLite_google_2fprotobuf_2funittest_5flite_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_V2MessageLite_default_instance_;
+    new (ptr) ::protobuf_unittest::V2MessageLite();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::V2MessageLite::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_V2MessageLite_google_2fprotobuf_2funittest_5flite_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_V2MessageLite_google_2fprotobuf_2funittest_5flite_2eproto}, {}};
+
+namespace protobuf_unittest {
+bool TestAllTypesLite_NestedEnum_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> TestAllTypesLite_NestedEnum_strings[3] = {};
+
+static const char TestAllTypesLite_NestedEnum_names[] =
+  "BAR"
+  "BAZ"
+  "FOO";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry TestAllTypesLite_NestedEnum_entries[] = {
+  { {TestAllTypesLite_NestedEnum_names + 0, 3}, 2 },
+  { {TestAllTypesLite_NestedEnum_names + 3, 3}, 3 },
+  { {TestAllTypesLite_NestedEnum_names + 6, 3}, 1 },
+};
+
+static const int TestAllTypesLite_NestedEnum_entries_by_number[] = {
+  2, // 1 -> FOO
+  0, // 2 -> BAR
+  1, // 3 -> BAZ
+};
+
+const std::string& TestAllTypesLite_NestedEnum_Name(
+    TestAllTypesLite_NestedEnum value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          TestAllTypesLite_NestedEnum_entries,
+          TestAllTypesLite_NestedEnum_entries_by_number,
+          3, TestAllTypesLite_NestedEnum_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      TestAllTypesLite_NestedEnum_entries,
+      TestAllTypesLite_NestedEnum_entries_by_number,
+      3, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     TestAllTypesLite_NestedEnum_strings[idx].get();
+}
+bool TestAllTypesLite_NestedEnum_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TestAllTypesLite_NestedEnum* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      TestAllTypesLite_NestedEnum_entries, 3, name, &int_value);
+  if (success) {
+    *value = static_cast<TestAllTypesLite_NestedEnum>(int_value);
+  }
+  return success;
+}
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+constexpr TestAllTypesLite_NestedEnum TestAllTypesLite::FOO;
+constexpr TestAllTypesLite_NestedEnum TestAllTypesLite::BAR;
+constexpr TestAllTypesLite_NestedEnum TestAllTypesLite::BAZ;
+constexpr TestAllTypesLite_NestedEnum TestAllTypesLite::NestedEnum_MIN;
+constexpr TestAllTypesLite_NestedEnum TestAllTypesLite::NestedEnum_MAX;
+constexpr int TestAllTypesLite::NestedEnum_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+bool DupEnum_TestEnumWithDupValueLite_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> DupEnum_TestEnumWithDupValueLite_strings[3] = {};
+
+static const char DupEnum_TestEnumWithDupValueLite_names[] =
+  "BAR1"
+  "BAR2"
+  "BAZ"
+  "FOO1"
+  "FOO2";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry DupEnum_TestEnumWithDupValueLite_entries[] = {
+  { {DupEnum_TestEnumWithDupValueLite_names + 0, 4}, 2 },
+  { {DupEnum_TestEnumWithDupValueLite_names + 4, 4}, 2 },
+  { {DupEnum_TestEnumWithDupValueLite_names + 8, 3}, 3 },
+  { {DupEnum_TestEnumWithDupValueLite_names + 11, 4}, 1 },
+  { {DupEnum_TestEnumWithDupValueLite_names + 15, 4}, 1 },
+};
+
+static const int DupEnum_TestEnumWithDupValueLite_entries_by_number[] = {
+  3, // 1 -> FOO1
+  0, // 2 -> BAR1
+  2, // 3 -> BAZ
+};
+
+const std::string& DupEnum_TestEnumWithDupValueLite_Name(
+    DupEnum_TestEnumWithDupValueLite value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          DupEnum_TestEnumWithDupValueLite_entries,
+          DupEnum_TestEnumWithDupValueLite_entries_by_number,
+          3, DupEnum_TestEnumWithDupValueLite_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      DupEnum_TestEnumWithDupValueLite_entries,
+      DupEnum_TestEnumWithDupValueLite_entries_by_number,
+      3, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     DupEnum_TestEnumWithDupValueLite_strings[idx].get();
+}
+bool DupEnum_TestEnumWithDupValueLite_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DupEnum_TestEnumWithDupValueLite* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      DupEnum_TestEnumWithDupValueLite_entries, 5, name, &int_value);
+  if (success) {
+    *value = static_cast<DupEnum_TestEnumWithDupValueLite>(int_value);
+  }
+  return success;
+}
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+constexpr DupEnum_TestEnumWithDupValueLite DupEnum::FOO1;
+constexpr DupEnum_TestEnumWithDupValueLite DupEnum::BAR1;
+constexpr DupEnum_TestEnumWithDupValueLite DupEnum::BAZ;
+constexpr DupEnum_TestEnumWithDupValueLite DupEnum::FOO2;
+constexpr DupEnum_TestEnumWithDupValueLite DupEnum::BAR2;
+constexpr DupEnum_TestEnumWithDupValueLite DupEnum::TestEnumWithDupValueLite_MIN;
+constexpr DupEnum_TestEnumWithDupValueLite DupEnum::TestEnumWithDupValueLite_MAX;
+constexpr int DupEnum::TestEnumWithDupValueLite_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+bool ForeignEnumLite_IsValid(int value) {
+  switch (value) {
+    case 4:
+    case 5:
+    case 6:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> ForeignEnumLite_strings[3] = {};
+
+static const char ForeignEnumLite_names[] =
+  "FOREIGN_LITE_BAR"
+  "FOREIGN_LITE_BAZ"
+  "FOREIGN_LITE_FOO";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry ForeignEnumLite_entries[] = {
+  { {ForeignEnumLite_names + 0, 16}, 5 },
+  { {ForeignEnumLite_names + 16, 16}, 6 },
+  { {ForeignEnumLite_names + 32, 16}, 4 },
+};
+
+static const int ForeignEnumLite_entries_by_number[] = {
+  2, // 4 -> FOREIGN_LITE_FOO
+  0, // 5 -> FOREIGN_LITE_BAR
+  1, // 6 -> FOREIGN_LITE_BAZ
+};
+
+const std::string& ForeignEnumLite_Name(
+    ForeignEnumLite value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          ForeignEnumLite_entries,
+          ForeignEnumLite_entries_by_number,
+          3, ForeignEnumLite_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      ForeignEnumLite_entries,
+      ForeignEnumLite_entries_by_number,
+      3, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     ForeignEnumLite_strings[idx].get();
+}
+bool ForeignEnumLite_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ForeignEnumLite* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      ForeignEnumLite_entries, 3, name, &int_value);
+  if (success) {
+    *value = static_cast<ForeignEnumLite>(int_value);
+  }
+  return success;
+}
+bool V1EnumLite_IsValid(int value) {
+  switch (value) {
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> V1EnumLite_strings[1] = {};
+
+static const char V1EnumLite_names[] =
+  "V1_FIRST";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry V1EnumLite_entries[] = {
+  { {V1EnumLite_names + 0, 8}, 1 },
+};
+
+static const int V1EnumLite_entries_by_number[] = {
+  0, // 1 -> V1_FIRST
+};
+
+const std::string& V1EnumLite_Name(
+    V1EnumLite value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          V1EnumLite_entries,
+          V1EnumLite_entries_by_number,
+          1, V1EnumLite_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      V1EnumLite_entries,
+      V1EnumLite_entries_by_number,
+      1, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     V1EnumLite_strings[idx].get();
+}
+bool V1EnumLite_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, V1EnumLite* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      V1EnumLite_entries, 1, name, &int_value);
+  if (success) {
+    *value = static_cast<V1EnumLite>(int_value);
+  }
+  return success;
+}
+bool V2EnumLite_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> V2EnumLite_strings[2] = {};
+
+static const char V2EnumLite_names[] =
+  "V2_FIRST"
+  "V2_SECOND";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry V2EnumLite_entries[] = {
+  { {V2EnumLite_names + 0, 8}, 1 },
+  { {V2EnumLite_names + 8, 9}, 2 },
+};
+
+static const int V2EnumLite_entries_by_number[] = {
+  0, // 1 -> V2_FIRST
+  1, // 2 -> V2_SECOND
+};
+
+const std::string& V2EnumLite_Name(
+    V2EnumLite value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          V2EnumLite_entries,
+          V2EnumLite_entries_by_number,
+          2, V2EnumLite_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      V2EnumLite_entries,
+      V2EnumLite_entries_by_number,
+      2, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     V2EnumLite_strings[idx].get();
+}
+bool V2EnumLite_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, V2EnumLite* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      V2EnumLite_entries, 2, name, &int_value);
+  if (success) {
+    *value = static_cast<V2EnumLite>(int_value);
+  }
+  return success;
+}
+
+// ===================================================================
+
+void TestAllTypesLite_NestedMessage::InitAsDefaultInstance() {
+}
+class TestAllTypesLite_NestedMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestAllTypesLite_NestedMessage>()._has_bits_);
+  static void set_has_bb(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_cc(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TestAllTypesLite_NestedMessage::TestAllTypesLite_NestedMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestAllTypesLite.NestedMessage)
+}
+TestAllTypesLite_NestedMessage::TestAllTypesLite_NestedMessage(const TestAllTypesLite_NestedMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&cc_, &from.cc_,
+    static_cast<size_t>(reinterpret_cast<char*>(&bb_) -
+    reinterpret_cast<char*>(&cc_)) + sizeof(bb_));
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestAllTypesLite.NestedMessage)
+}
+
+void TestAllTypesLite_NestedMessage::SharedCtor() {
+  ::memset(&cc_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&bb_) -
+      reinterpret_cast<char*>(&cc_)) + sizeof(bb_));
+}
+
+TestAllTypesLite_NestedMessage::~TestAllTypesLite_NestedMessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestAllTypesLite.NestedMessage)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestAllTypesLite_NestedMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestAllTypesLite_NestedMessage::ArenaDtor(void* object) {
+  TestAllTypesLite_NestedMessage* _this = reinterpret_cast< TestAllTypesLite_NestedMessage* >(object);
+  (void)_this;
+}
+void TestAllTypesLite_NestedMessage::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestAllTypesLite_NestedMessage::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestAllTypesLite_NestedMessage& TestAllTypesLite_NestedMessage::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestAllTypesLite_NestedMessage_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestAllTypesLite_NestedMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestAllTypesLite.NestedMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&cc_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&bb_) -
+        reinterpret_cast<char*>(&cc_)) + sizeof(bb_));
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestAllTypesLite_NestedMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional int32 bb = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          _Internal::set_has_bb(&has_bits);
+          bb_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional int64 cc = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          _Internal::set_has_cc(&has_bits);
+          cc_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestAllTypesLite_NestedMessage::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestAllTypesLite.NestedMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 bb = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_bb(), target);
+  }
+
+  // optional int64 cc = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(2, this->_internal_cc(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestAllTypesLite.NestedMessage)
+  return target;
+}
+
+size_t TestAllTypesLite_NestedMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestAllTypesLite.NestedMessage)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional int64 cc = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+          this->_internal_cc());
+    }
+
+    // optional int32 bb = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_bb());
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestAllTypesLite_NestedMessage::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestAllTypesLite_NestedMessage*>(
+      &from));
+}
+
+void TestAllTypesLite_NestedMessage::MergeFrom(const TestAllTypesLite_NestedMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestAllTypesLite.NestedMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      cc_ = from.cc_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      bb_ = from.bb_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void TestAllTypesLite_NestedMessage::CopyFrom(const TestAllTypesLite_NestedMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestAllTypesLite.NestedMessage)
+  if (&from == this) return;
+  Clear();
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  ::memcpy(&cc_, &from.cc_,
+    static_cast<size_t>(reinterpret_cast<char*>(&bb_) -
+    reinterpret_cast<char*>(&cc_)) + sizeof(bb_));
+}
+
+bool TestAllTypesLite_NestedMessage::IsInitialized() const {
+  return true;
+}
+
+void TestAllTypesLite_NestedMessage::InternalSwap(TestAllTypesLite_NestedMessage* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestAllTypesLite_NestedMessage, bb_)
+      + sizeof(TestAllTypesLite_NestedMessage::bb_)
+      - PROTOBUF_FIELD_OFFSET(TestAllTypesLite_NestedMessage, cc_)>(
+          reinterpret_cast<char*>(&cc_),
+          reinterpret_cast<char*>(&other->cc_));
+}
+
+std::string TestAllTypesLite_NestedMessage::GetTypeName() const {
+  return "protobuf_unittest.TestAllTypesLite.NestedMessage";
+}
+
+
+// ===================================================================
+
+void TestAllTypesLite_OptionalGroup::InitAsDefaultInstance() {
+}
+class TestAllTypesLite_OptionalGroup::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestAllTypesLite_OptionalGroup>()._has_bits_);
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TestAllTypesLite_OptionalGroup::TestAllTypesLite_OptionalGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestAllTypesLite.OptionalGroup)
+}
+TestAllTypesLite_OptionalGroup::TestAllTypesLite_OptionalGroup(const TestAllTypesLite_OptionalGroup& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  a_ = from.a_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestAllTypesLite.OptionalGroup)
+}
+
+void TestAllTypesLite_OptionalGroup::SharedCtor() {
+  a_ = 0;
+}
+
+TestAllTypesLite_OptionalGroup::~TestAllTypesLite_OptionalGroup() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestAllTypesLite.OptionalGroup)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestAllTypesLite_OptionalGroup::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestAllTypesLite_OptionalGroup::ArenaDtor(void* object) {
+  TestAllTypesLite_OptionalGroup* _this = reinterpret_cast< TestAllTypesLite_OptionalGroup* >(object);
+  (void)_this;
+}
+void TestAllTypesLite_OptionalGroup::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestAllTypesLite_OptionalGroup::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestAllTypesLite_OptionalGroup& TestAllTypesLite_OptionalGroup::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestAllTypesLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestAllTypesLite_OptionalGroup::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestAllTypesLite.OptionalGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  a_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestAllTypesLite_OptionalGroup::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional int32 a = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 136)) {
+          _Internal::set_has_a(&has_bits);
+          a_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestAllTypesLite_OptionalGroup::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestAllTypesLite.OptionalGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 a = 17;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(17, this->_internal_a(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestAllTypesLite.OptionalGroup)
+  return target;
+}
+
+size_t TestAllTypesLite_OptionalGroup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestAllTypesLite.OptionalGroup)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 a = 17;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_a());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestAllTypesLite_OptionalGroup::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestAllTypesLite_OptionalGroup*>(
+      &from));
+}
+
+void TestAllTypesLite_OptionalGroup::MergeFrom(const TestAllTypesLite_OptionalGroup& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestAllTypesLite.OptionalGroup)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_a()) {
+    _internal_set_a(from._internal_a());
+  }
+}
+
+void TestAllTypesLite_OptionalGroup::CopyFrom(const TestAllTypesLite_OptionalGroup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestAllTypesLite.OptionalGroup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestAllTypesLite_OptionalGroup::IsInitialized() const {
+  return true;
+}
+
+void TestAllTypesLite_OptionalGroup::InternalSwap(TestAllTypesLite_OptionalGroup* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(a_, other->a_);
+}
+
+std::string TestAllTypesLite_OptionalGroup::GetTypeName() const {
+  return "protobuf_unittest.TestAllTypesLite.OptionalGroup";
+}
+
+
+// ===================================================================
+
+void TestAllTypesLite_RepeatedGroup::InitAsDefaultInstance() {
+}
+class TestAllTypesLite_RepeatedGroup::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestAllTypesLite_RepeatedGroup>()._has_bits_);
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TestAllTypesLite_RepeatedGroup::TestAllTypesLite_RepeatedGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestAllTypesLite.RepeatedGroup)
+}
+TestAllTypesLite_RepeatedGroup::TestAllTypesLite_RepeatedGroup(const TestAllTypesLite_RepeatedGroup& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  a_ = from.a_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestAllTypesLite.RepeatedGroup)
+}
+
+void TestAllTypesLite_RepeatedGroup::SharedCtor() {
+  a_ = 0;
+}
+
+TestAllTypesLite_RepeatedGroup::~TestAllTypesLite_RepeatedGroup() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestAllTypesLite.RepeatedGroup)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestAllTypesLite_RepeatedGroup::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestAllTypesLite_RepeatedGroup::ArenaDtor(void* object) {
+  TestAllTypesLite_RepeatedGroup* _this = reinterpret_cast< TestAllTypesLite_RepeatedGroup* >(object);
+  (void)_this;
+}
+void TestAllTypesLite_RepeatedGroup::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestAllTypesLite_RepeatedGroup::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestAllTypesLite_RepeatedGroup& TestAllTypesLite_RepeatedGroup::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestAllTypesLite_RepeatedGroup_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestAllTypesLite_RepeatedGroup::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestAllTypesLite.RepeatedGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  a_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestAllTypesLite_RepeatedGroup::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional int32 a = 47;
+      case 47:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 120)) {
+          _Internal::set_has_a(&has_bits);
+          a_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestAllTypesLite_RepeatedGroup::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestAllTypesLite.RepeatedGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 a = 47;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(47, this->_internal_a(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestAllTypesLite.RepeatedGroup)
+  return target;
+}
+
+size_t TestAllTypesLite_RepeatedGroup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestAllTypesLite.RepeatedGroup)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 a = 47;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_a());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestAllTypesLite_RepeatedGroup::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestAllTypesLite_RepeatedGroup*>(
+      &from));
+}
+
+void TestAllTypesLite_RepeatedGroup::MergeFrom(const TestAllTypesLite_RepeatedGroup& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestAllTypesLite.RepeatedGroup)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_a()) {
+    _internal_set_a(from._internal_a());
+  }
+}
+
+void TestAllTypesLite_RepeatedGroup::CopyFrom(const TestAllTypesLite_RepeatedGroup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestAllTypesLite.RepeatedGroup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestAllTypesLite_RepeatedGroup::IsInitialized() const {
+  return true;
+}
+
+void TestAllTypesLite_RepeatedGroup::InternalSwap(TestAllTypesLite_RepeatedGroup* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(a_, other->a_);
+}
+
+std::string TestAllTypesLite_RepeatedGroup::GetTypeName() const {
+  return "protobuf_unittest.TestAllTypesLite.RepeatedGroup";
+}
+
+
+// ===================================================================
+
+void TestAllTypesLite::InitAsDefaultInstance() {
+  ::protobuf_unittest::_TestAllTypesLite_default_instance_._instance.get_mutable()->optionalgroup_ = const_cast< ::protobuf_unittest::TestAllTypesLite_OptionalGroup*>(
+      ::protobuf_unittest::TestAllTypesLite_OptionalGroup::internal_default_instance());
+  ::protobuf_unittest::_TestAllTypesLite_default_instance_._instance.get_mutable()->optional_nested_message_ = const_cast< ::protobuf_unittest::TestAllTypesLite_NestedMessage*>(
+      ::protobuf_unittest::TestAllTypesLite_NestedMessage::internal_default_instance());
+  ::protobuf_unittest::_TestAllTypesLite_default_instance_._instance.get_mutable()->optional_foreign_message_ = const_cast< ::protobuf_unittest::ForeignMessageLite*>(
+      ::protobuf_unittest::ForeignMessageLite::internal_default_instance());
+  ::protobuf_unittest::_TestAllTypesLite_default_instance_._instance.get_mutable()->optional_import_message_ = const_cast< ::protobuf_unittest_import::ImportMessageLite*>(
+      ::protobuf_unittest_import::ImportMessageLite::internal_default_instance());
+  ::protobuf_unittest::_TestAllTypesLite_default_instance_._instance.get_mutable()->optional_public_import_message_ = const_cast< ::protobuf_unittest_import::PublicImportMessageLite*>(
+      ::protobuf_unittest_import::PublicImportMessageLite::internal_default_instance());
+  ::protobuf_unittest::_TestAllTypesLite_default_instance_._instance.get_mutable()->optional_lazy_message_ = const_cast< ::protobuf_unittest::TestAllTypesLite_NestedMessage*>(
+      ::protobuf_unittest::TestAllTypesLite_NestedMessage::internal_default_instance());
+}
+class TestAllTypesLite::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestAllTypesLite>()._has_bits_);
+  static void set_has_optional_int32(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_optional_int64(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_optional_uint32(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_optional_uint64(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_optional_sint32(HasBits* has_bits) {
+    (*has_bits)[0] |= 524288u;
+  }
+  static void set_has_optional_sint64(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static void set_has_optional_fixed32(HasBits* has_bits) {
+    (*has_bits)[0] |= 1048576u;
+  }
+  static void set_has_optional_fixed64(HasBits* has_bits) {
+    (*has_bits)[0] |= 2097152u;
+  }
+  static void set_has_optional_sfixed32(HasBits* has_bits) {
+    (*has_bits)[0] |= 8388608u;
+  }
+  static void set_has_optional_sfixed64(HasBits* has_bits) {
+    (*has_bits)[0] |= 4194304u;
+  }
+  static void set_has_optional_float(HasBits* has_bits) {
+    (*has_bits)[0] |= 16777216u;
+  }
+  static void set_has_optional_double(HasBits* has_bits) {
+    (*has_bits)[0] |= 33554432u;
+  }
+  static void set_has_optional_bool(HasBits* has_bits) {
+    (*has_bits)[0] |= 67108864u;
+  }
+  static void set_has_optional_string(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_optional_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::protobuf_unittest::TestAllTypesLite_OptionalGroup& optionalgroup(const TestAllTypesLite* msg);
+  static void set_has_optionalgroup(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::protobuf_unittest::TestAllTypesLite_NestedMessage& optional_nested_message(const TestAllTypesLite* msg);
+  static void set_has_optional_nested_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static const ::protobuf_unittest::ForeignMessageLite& optional_foreign_message(const TestAllTypesLite* msg);
+  static void set_has_optional_foreign_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static const ::protobuf_unittest_import::ImportMessageLite& optional_import_message(const TestAllTypesLite* msg);
+  static void set_has_optional_import_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_optional_nested_enum(HasBits* has_bits) {
+    (*has_bits)[0] |= 268435456u;
+  }
+  static void set_has_optional_foreign_enum(HasBits* has_bits) {
+    (*has_bits)[0] |= 536870912u;
+  }
+  static void set_has_optional_import_enum(HasBits* has_bits) {
+    (*has_bits)[0] |= 1073741824u;
+  }
+  static void set_has_optional_string_piece(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_optional_cord(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::protobuf_unittest_import::PublicImportMessageLite& optional_public_import_message(const TestAllTypesLite* msg);
+  static void set_has_optional_public_import_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static const ::protobuf_unittest::TestAllTypesLite_NestedMessage& optional_lazy_message(const TestAllTypesLite* msg);
+  static void set_has_optional_lazy_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_default_int32(HasBits* has_bits) {
+    (*has_bits)[0] |= 2147483648u;
+  }
+  static void set_has_default_int64(HasBits* has_bits) {
+    (*has_bits)[1] |= 1u;
+  }
+  static void set_has_default_uint32(HasBits* has_bits) {
+    (*has_bits)[1] |= 4u;
+  }
+  static void set_has_default_uint64(HasBits* has_bits) {
+    (*has_bits)[1] |= 2u;
+  }
+  static void set_has_default_sint32(HasBits* has_bits) {
+    (*has_bits)[1] |= 8u;
+  }
+  static void set_has_default_sint64(HasBits* has_bits) {
+    (*has_bits)[1] |= 16u;
+  }
+  static void set_has_default_fixed32(HasBits* has_bits) {
+    (*has_bits)[1] |= 64u;
+  }
+  static void set_has_default_fixed64(HasBits* has_bits) {
+    (*has_bits)[1] |= 32u;
+  }
+  static void set_has_default_sfixed32(HasBits* has_bits) {
+    (*has_bits)[1] |= 128u;
+  }
+  static void set_has_default_sfixed64(HasBits* has_bits) {
+    (*has_bits)[1] |= 256u;
+  }
+  static void set_has_default_float(HasBits* has_bits) {
+    (*has_bits)[1] |= 1024u;
+  }
+  static void set_has_default_double(HasBits* has_bits) {
+    (*has_bits)[1] |= 512u;
+  }
+  static void set_has_default_bool(HasBits* has_bits) {
+    (*has_bits)[1] |= 2048u;
+  }
+  static void set_has_default_string(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_default_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_default_nested_enum(HasBits* has_bits) {
+    (*has_bits)[1] |= 4096u;
+  }
+  static void set_has_default_foreign_enum(HasBits* has_bits) {
+    (*has_bits)[1] |= 8192u;
+  }
+  static void set_has_default_import_enum(HasBits* has_bits) {
+    (*has_bits)[1] |= 16384u;
+  }
+  static void set_has_default_string_piece(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_default_cord(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::protobuf_unittest::TestAllTypesLite_NestedMessage& oneof_nested_message(const TestAllTypesLite* msg);
+  static const ::protobuf_unittest::TestAllTypesLite_NestedMessage& oneof_lazy_nested_message(const TestAllTypesLite* msg);
+  static void set_has_deceptively_named_list(HasBits* has_bits) {
+    (*has_bits)[0] |= 134217728u;
+  }
+};
+
+const ::protobuf_unittest::TestAllTypesLite_OptionalGroup&
+TestAllTypesLite::_Internal::optionalgroup(const TestAllTypesLite* msg) {
+  return *msg->optionalgroup_;
+}
+const ::protobuf_unittest::TestAllTypesLite_NestedMessage&
+TestAllTypesLite::_Internal::optional_nested_message(const TestAllTypesLite* msg) {
+  return *msg->optional_nested_message_;
+}
+const ::protobuf_unittest::ForeignMessageLite&
+TestAllTypesLite::_Internal::optional_foreign_message(const TestAllTypesLite* msg) {
+  return *msg->optional_foreign_message_;
+}
+const ::protobuf_unittest_import::ImportMessageLite&
+TestAllTypesLite::_Internal::optional_import_message(const TestAllTypesLite* msg) {
+  return *msg->optional_import_message_;
+}
+const ::protobuf_unittest_import::PublicImportMessageLite&
+TestAllTypesLite::_Internal::optional_public_import_message(const TestAllTypesLite* msg) {
+  return *msg->optional_public_import_message_;
+}
+const ::protobuf_unittest::TestAllTypesLite_NestedMessage&
+TestAllTypesLite::_Internal::optional_lazy_message(const TestAllTypesLite* msg) {
+  return *msg->optional_lazy_message_;
+}
+const ::protobuf_unittest::TestAllTypesLite_NestedMessage&
+TestAllTypesLite::_Internal::oneof_nested_message(const TestAllTypesLite* msg) {
+  return *msg->oneof_field_.oneof_nested_message_;
+}
+const ::protobuf_unittest::TestAllTypesLite_NestedMessage&
+TestAllTypesLite::_Internal::oneof_lazy_nested_message(const TestAllTypesLite* msg) {
+  return *msg->oneof_field_.oneof_lazy_nested_message_;
+}
+void TestAllTypesLite::clear_optional_import_message() {
+  if (optional_import_message_ != nullptr) optional_import_message_->Clear();
+  _has_bits_[0] &= ~0x00000800u;
+}
+void TestAllTypesLite::clear_optional_public_import_message() {
+  if (optional_public_import_message_ != nullptr) optional_public_import_message_->Clear();
+  _has_bits_[0] &= ~0x00001000u;
+}
+void TestAllTypesLite::clear_repeated_import_message() {
+  repeated_import_message_.Clear();
+}
+::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_;
+::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_bytes_;
+::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_piece_;
+::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_cord_;
+void TestAllTypesLite::set_allocated_oneof_nested_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* oneof_nested_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (oneof_nested_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(oneof_nested_message);
+    if (message_arena != submessage_arena) {
+      oneof_nested_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, oneof_nested_message, submessage_arena);
+    }
+    set_has_oneof_nested_message();
+    oneof_field_.oneof_nested_message_ = oneof_nested_message;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.oneof_nested_message)
+}
+void TestAllTypesLite::set_allocated_oneof_lazy_nested_message(::protobuf_unittest::TestAllTypesLite_NestedMessage* oneof_lazy_nested_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (oneof_lazy_nested_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(oneof_lazy_nested_message);
+    if (message_arena != submessage_arena) {
+      oneof_lazy_nested_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, oneof_lazy_nested_message, submessage_arena);
+    }
+    set_has_oneof_lazy_nested_message();
+    oneof_field_.oneof_lazy_nested_message_ = oneof_lazy_nested_message;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestAllTypesLite.oneof_lazy_nested_message)
+}
+TestAllTypesLite::TestAllTypesLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena),
+  repeated_int32_(arena),
+  repeated_int64_(arena),
+  repeated_uint32_(arena),
+  repeated_uint64_(arena),
+  repeated_sint32_(arena),
+  repeated_sint64_(arena),
+  repeated_fixed32_(arena),
+  repeated_fixed64_(arena),
+  repeated_sfixed32_(arena),
+  repeated_sfixed64_(arena),
+  repeated_float_(arena),
+  repeated_double_(arena),
+  repeated_bool_(arena),
+  repeated_string_(arena),
+  repeated_bytes_(arena),
+  repeatedgroup_(arena),
+  repeated_nested_message_(arena),
+  repeated_foreign_message_(arena),
+  repeated_import_message_(arena),
+  repeated_nested_enum_(arena),
+  repeated_foreign_enum_(arena),
+  repeated_import_enum_(arena),
+  repeated_string_piece_(arena),
+  repeated_cord_(arena),
+  repeated_lazy_message_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestAllTypesLite)
+}
+TestAllTypesLite::TestAllTypesLite(const TestAllTypesLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_),
+      repeated_int32_(from.repeated_int32_),
+      repeated_int64_(from.repeated_int64_),
+      repeated_uint32_(from.repeated_uint32_),
+      repeated_uint64_(from.repeated_uint64_),
+      repeated_sint32_(from.repeated_sint32_),
+      repeated_sint64_(from.repeated_sint64_),
+      repeated_fixed32_(from.repeated_fixed32_),
+      repeated_fixed64_(from.repeated_fixed64_),
+      repeated_sfixed32_(from.repeated_sfixed32_),
+      repeated_sfixed64_(from.repeated_sfixed64_),
+      repeated_float_(from.repeated_float_),
+      repeated_double_(from.repeated_double_),
+      repeated_bool_(from.repeated_bool_),
+      repeated_string_(from.repeated_string_),
+      repeated_bytes_(from.repeated_bytes_),
+      repeatedgroup_(from.repeatedgroup_),
+      repeated_nested_message_(from.repeated_nested_message_),
+      repeated_foreign_message_(from.repeated_foreign_message_),
+      repeated_import_message_(from.repeated_import_message_),
+      repeated_nested_enum_(from.repeated_nested_enum_),
+      repeated_foreign_enum_(from.repeated_foreign_enum_),
+      repeated_import_enum_(from.repeated_import_enum_),
+      repeated_string_piece_(from.repeated_string_piece_),
+      repeated_cord_(from.repeated_cord_),
+      repeated_lazy_message_(from.repeated_lazy_message_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  optional_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from._internal_has_optional_string()) {
+    optional_string_.SetLite(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_optional_string(),
+      GetArena());
+  }
+  optional_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from._internal_has_optional_bytes()) {
+    optional_bytes_.SetLite(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_optional_bytes(),
+      GetArena());
+  }
+  optional_string_piece_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from._internal_has_optional_string_piece()) {
+    optional_string_piece_.SetLite(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_optional_string_piece(),
+      GetArena());
+  }
+  optional_cord_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from._internal_has_optional_cord()) {
+    optional_cord_.SetLite(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_optional_cord(),
+      GetArena());
+  }
+  default_string_.UnsafeSetDefault(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_.get());
+  if (from._internal_has_default_string()) {
+    default_string_.SetLite(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_.get(), from._internal_default_string(),
+      GetArena());
+  }
+  default_bytes_.UnsafeSetDefault(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_bytes_.get());
+  if (from._internal_has_default_bytes()) {
+    default_bytes_.SetLite(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_bytes_.get(), from._internal_default_bytes(),
+      GetArena());
+  }
+  default_string_piece_.UnsafeSetDefault(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_piece_.get());
+  if (from._internal_has_default_string_piece()) {
+    default_string_piece_.SetLite(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_piece_.get(), from._internal_default_string_piece(),
+      GetArena());
+  }
+  default_cord_.UnsafeSetDefault(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_cord_.get());
+  if (from._internal_has_default_cord()) {
+    default_cord_.SetLite(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_cord_.get(), from._internal_default_cord(),
+      GetArena());
+  }
+  if (from._internal_has_optionalgroup()) {
+    optionalgroup_ = new ::protobuf_unittest::TestAllTypesLite_OptionalGroup(*from.optionalgroup_);
+  } else {
+    optionalgroup_ = nullptr;
+  }
+  if (from._internal_has_optional_nested_message()) {
+    optional_nested_message_ = new ::protobuf_unittest::TestAllTypesLite_NestedMessage(*from.optional_nested_message_);
+  } else {
+    optional_nested_message_ = nullptr;
+  }
+  if (from._internal_has_optional_foreign_message()) {
+    optional_foreign_message_ = new ::protobuf_unittest::ForeignMessageLite(*from.optional_foreign_message_);
+  } else {
+    optional_foreign_message_ = nullptr;
+  }
+  if (from._internal_has_optional_import_message()) {
+    optional_import_message_ = new ::protobuf_unittest_import::ImportMessageLite(*from.optional_import_message_);
+  } else {
+    optional_import_message_ = nullptr;
+  }
+  if (from._internal_has_optional_public_import_message()) {
+    optional_public_import_message_ = new ::protobuf_unittest_import::PublicImportMessageLite(*from.optional_public_import_message_);
+  } else {
+    optional_public_import_message_ = nullptr;
+  }
+  if (from._internal_has_optional_lazy_message()) {
+    optional_lazy_message_ = new ::protobuf_unittest::TestAllTypesLite_NestedMessage(*from.optional_lazy_message_);
+  } else {
+    optional_lazy_message_ = nullptr;
+  }
+  ::memcpy(&optional_int64_, &from.optional_int64_,
+    static_cast<size_t>(reinterpret_cast<char*>(&default_import_enum_) -
+    reinterpret_cast<char*>(&optional_int64_)) + sizeof(default_import_enum_));
+  clear_has_oneof_field();
+  switch (from.oneof_field_case()) {
+    case kOneofUint32: {
+      _internal_set_oneof_uint32(from._internal_oneof_uint32());
+      break;
+    }
+    case kOneofNestedMessage: {
+      _internal_mutable_oneof_nested_message()->::protobuf_unittest::TestAllTypesLite_NestedMessage::MergeFrom(from._internal_oneof_nested_message());
+      break;
+    }
+    case kOneofString: {
+      _internal_set_oneof_string(from._internal_oneof_string());
+      break;
+    }
+    case kOneofBytes: {
+      _internal_set_oneof_bytes(from._internal_oneof_bytes());
+      break;
+    }
+    case kOneofLazyNestedMessage: {
+      _internal_mutable_oneof_lazy_nested_message()->::protobuf_unittest::TestAllTypesLite_NestedMessage::MergeFrom(from._internal_oneof_lazy_nested_message());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestAllTypesLite)
+}
+
+void TestAllTypesLite::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  optional_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_string_piece_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_cord_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  default_string_.UnsafeSetDefault(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_.get());
+  default_bytes_.UnsafeSetDefault(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_bytes_.get());
+  default_string_piece_.UnsafeSetDefault(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_piece_.get());
+  default_cord_.UnsafeSetDefault(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_cord_.get());
+  ::memset(&optionalgroup_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&deceptively_named_list_) -
+      reinterpret_cast<char*>(&optionalgroup_)) + sizeof(deceptively_named_list_));
+  optional_nested_enum_ = 1;
+  optional_foreign_enum_ = 4;
+  optional_import_enum_ = 7;
+  default_int32_ = 41;
+  default_int64_ = PROTOBUF_LONGLONG(42);
+  default_uint64_ = PROTOBUF_ULONGLONG(44);
+  default_uint32_ = 43u;
+  default_sint32_ = -45;
+  default_sint64_ = PROTOBUF_LONGLONG(46);
+  default_fixed64_ = PROTOBUF_ULONGLONG(48);
+  default_fixed32_ = 47u;
+  default_sfixed32_ = 49;
+  default_sfixed64_ = PROTOBUF_LONGLONG(-50);
+  default_double_ = 52000;
+  default_float_ = 51.5f;
+  default_bool_ = true;
+  default_nested_enum_ = 2;
+  default_foreign_enum_ = 5;
+  default_import_enum_ = 8;
+  clear_has_oneof_field();
+}
+
+TestAllTypesLite::~TestAllTypesLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestAllTypesLite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestAllTypesLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  optional_string_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_bytes_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_string_piece_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_cord_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  default_string_.DestroyNoArena(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_.get());
+  default_bytes_.DestroyNoArena(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_bytes_.get());
+  default_string_piece_.DestroyNoArena(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_piece_.get());
+  default_cord_.DestroyNoArena(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_cord_.get());
+  if (this != internal_default_instance()) delete optionalgroup_;
+  if (this != internal_default_instance()) delete optional_nested_message_;
+  if (this != internal_default_instance()) delete optional_foreign_message_;
+  if (this != internal_default_instance()) delete optional_import_message_;
+  if (this != internal_default_instance()) delete optional_public_import_message_;
+  if (this != internal_default_instance()) delete optional_lazy_message_;
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+}
+
+void TestAllTypesLite::ArenaDtor(void* object) {
+  TestAllTypesLite* _this = reinterpret_cast< TestAllTypesLite* >(object);
+  (void)_this;
+}
+void TestAllTypesLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestAllTypesLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestAllTypesLite& TestAllTypesLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestAllTypesLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestAllTypesLite::clear_oneof_field() {
+// @@protoc_insertion_point(one_of_clear_start:protobuf_unittest.TestAllTypesLite)
+  switch (oneof_field_case()) {
+    case kOneofUint32: {
+      // No need to clear
+      break;
+    }
+    case kOneofNestedMessage: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.oneof_nested_message_;
+      }
+      break;
+    }
+    case kOneofString: {
+      oneof_field_.oneof_string_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+      break;
+    }
+    case kOneofBytes: {
+      oneof_field_.oneof_bytes_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+      break;
+    }
+    case kOneofLazyNestedMessage: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.oneof_lazy_nested_message_;
+      }
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+
+
+void TestAllTypesLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestAllTypesLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_int32_.Clear();
+  repeated_int64_.Clear();
+  repeated_uint32_.Clear();
+  repeated_uint64_.Clear();
+  repeated_sint32_.Clear();
+  repeated_sint64_.Clear();
+  repeated_fixed32_.Clear();
+  repeated_fixed64_.Clear();
+  repeated_sfixed32_.Clear();
+  repeated_sfixed64_.Clear();
+  repeated_float_.Clear();
+  repeated_double_.Clear();
+  repeated_bool_.Clear();
+  repeated_string_.Clear();
+  repeated_bytes_.Clear();
+  repeatedgroup_.Clear();
+  repeated_nested_message_.Clear();
+  repeated_foreign_message_.Clear();
+  repeated_import_message_.Clear();
+  repeated_nested_enum_.Clear();
+  repeated_foreign_enum_.Clear();
+  repeated_import_enum_.Clear();
+  repeated_string_piece_.Clear();
+  repeated_cord_.Clear();
+  repeated_lazy_message_.Clear();
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      optional_string_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      optional_bytes_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      optional_string_piece_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      optional_cord_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      default_string_.ClearToDefault(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_.get(), GetArena());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      default_bytes_.ClearToDefault(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_bytes_.get(), GetArena());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      default_string_piece_.ClearToDefault(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_piece_.get(), GetArena());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      default_cord_.ClearToDefault(&::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_cord_.get(), GetArena());
+    }
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      GOOGLE_DCHECK(optionalgroup_ != nullptr);
+      optionalgroup_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      GOOGLE_DCHECK(optional_nested_message_ != nullptr);
+      optional_nested_message_->Clear();
+    }
+    if (cached_has_bits & 0x00000400u) {
+      GOOGLE_DCHECK(optional_foreign_message_ != nullptr);
+      optional_foreign_message_->Clear();
+    }
+    if (cached_has_bits & 0x00000800u) {
+      GOOGLE_DCHECK(optional_import_message_ != nullptr);
+      optional_import_message_->Clear();
+    }
+    if (cached_has_bits & 0x00001000u) {
+      GOOGLE_DCHECK(optional_public_import_message_ != nullptr);
+      optional_public_import_message_->Clear();
+    }
+    if (cached_has_bits & 0x00002000u) {
+      GOOGLE_DCHECK(optional_lazy_message_ != nullptr);
+      optional_lazy_message_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000c000u) {
+    ::memset(&optional_int64_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&optional_int32_) -
+        reinterpret_cast<char*>(&optional_int64_)) + sizeof(optional_int32_));
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    ::memset(&optional_uint32_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&optional_sfixed32_) -
+        reinterpret_cast<char*>(&optional_uint32_)) + sizeof(optional_sfixed32_));
+  }
+  if (cached_has_bits & 0xff000000u) {
+    ::memset(&optional_float_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&deceptively_named_list_) -
+        reinterpret_cast<char*>(&optional_float_)) + sizeof(deceptively_named_list_));
+    optional_nested_enum_ = 1;
+    optional_foreign_enum_ = 4;
+    optional_import_enum_ = 7;
+    default_int32_ = 41;
+  }
+  cached_has_bits = _has_bits_[1];
+  if (cached_has_bits & 0x000000ffu) {
+    default_int64_ = PROTOBUF_LONGLONG(42);
+    default_uint64_ = PROTOBUF_ULONGLONG(44);
+    default_uint32_ = 43u;
+    default_sint32_ = -45;
+    default_sint64_ = PROTOBUF_LONGLONG(46);
+    default_fixed64_ = PROTOBUF_ULONGLONG(48);
+    default_fixed32_ = 47u;
+    default_sfixed32_ = 49;
+  }
+  if (cached_has_bits & 0x00007f00u) {
+    default_sfixed64_ = PROTOBUF_LONGLONG(-50);
+    default_double_ = 52000;
+    default_float_ = 51.5f;
+    default_bool_ = true;
+    default_nested_enum_ = 2;
+    default_foreign_enum_ = 5;
+    default_import_enum_ = 8;
+  }
+  clear_oneof_field();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestAllTypesLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional int32 optional_int32 = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          _Internal::set_has_optional_int32(&_has_bits_);
+          optional_int32_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional int64 optional_int64 = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          _Internal::set_has_optional_int64(&_has_bits_);
+          optional_int64_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional uint32 optional_uint32 = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          _Internal::set_has_optional_uint32(&_has_bits_);
+          optional_uint32_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional uint64 optional_uint64 = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          _Internal::set_has_optional_uint64(&_has_bits_);
+          optional_uint64_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional sint32 optional_sint32 = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          _Internal::set_has_optional_sint32(&_has_bits_);
+          optional_sint32_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional sint64 optional_sint64 = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
+          _Internal::set_has_optional_sint64(&_has_bits_);
+          optional_sint64_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional fixed32 optional_fixed32 = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 61)) {
+          _Internal::set_has_optional_fixed32(&_has_bits_);
+          optional_fixed32_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr);
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+        } else goto handle_unusual;
+        continue;
+      // optional fixed64 optional_fixed64 = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 65)) {
+          _Internal::set_has_optional_fixed64(&_has_bits_);
+          optional_fixed64_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr);
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
+        } else goto handle_unusual;
+        continue;
+      // optional sfixed32 optional_sfixed32 = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 77)) {
+          _Internal::set_has_optional_sfixed32(&_has_bits_);
+          optional_sfixed32_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int32>(ptr);
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int32);
+        } else goto handle_unusual;
+        continue;
+      // optional sfixed64 optional_sfixed64 = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 81)) {
+          _Internal::set_has_optional_sfixed64(&_has_bits_);
+          optional_sfixed64_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int64>(ptr);
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int64);
+        } else goto handle_unusual;
+        continue;
+      // optional float optional_float = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 93)) {
+          _Internal::set_has_optional_float(&_has_bits_);
+          optional_float_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // optional double optional_double = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 97)) {
+          _Internal::set_has_optional_double(&_has_bits_);
+          optional_double_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else goto handle_unusual;
+        continue;
+      // optional bool optional_bool = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 104)) {
+          _Internal::set_has_optional_bool(&_has_bits_);
+          optional_bool_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional string optional_string = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+          _Internal::set_has_optional_string(&_has_bits_);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&optional_string_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional bytes optional_bytes = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
+          _Internal::set_has_optional_bytes(&_has_bits_);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&optional_bytes_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group OptionalGroup = 16 { ... };
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 131)) {
+          ptr = ctx->ParseGroup(_internal_mutable_optionalgroup(), ptr, 131);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest.TestAllTypesLite.NestedMessage optional_nested_message = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_optional_nested_message(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest.ForeignMessageLite optional_foreign_message = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_optional_foreign_message(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest_import.ImportMessageLite optional_import_message = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 162)) {
+          ptr = ctx->ParseMessage(_internal_mutable_optional_import_message(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest.TestAllTypesLite.NestedEnum optional_nested_enum = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 168)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid(val))) {
+            _internal_set_optional_nested_enum(static_cast<::protobuf_unittest::TestAllTypesLite_NestedEnum>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(21, val, mutable_unknown_fields());
+          }
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest.ForeignEnumLite optional_foreign_enum = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 176)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::protobuf_unittest::ForeignEnumLite_IsValid(val))) {
+            _internal_set_optional_foreign_enum(static_cast<::protobuf_unittest::ForeignEnumLite>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(22, val, mutable_unknown_fields());
+          }
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest_import.ImportEnumLite optional_import_enum = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 184)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::protobuf_unittest_import::ImportEnumLite_IsValid(val))) {
+            _internal_set_optional_import_enum(static_cast<::protobuf_unittest_import::ImportEnumLite>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(23, val, mutable_unknown_fields());
+          }
+        } else goto handle_unusual;
+        continue;
+      // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 194)) {
+          _Internal::set_has_optional_string_piece(&_has_bits_);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&optional_string_piece_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional string optional_cord = 25 [ctype = CORD];
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 202)) {
+          _Internal::set_has_optional_cord(&_has_bits_);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&optional_cord_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest_import.PublicImportMessageLite optional_public_import_message = 26;
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 210)) {
+          ptr = ctx->ParseMessage(_internal_mutable_optional_public_import_message(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest.TestAllTypesLite.NestedMessage optional_lazy_message = 27 [lazy = true];
+      case 27:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 218)) {
+          ptr = ctx->ParseMessage(_internal_mutable_optional_lazy_message(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated int32 repeated_int32 = 31;
+      case 31:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 248)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_repeated_int32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<248>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 250) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_repeated_int32(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated int64 repeated_int64 = 32;
+      case 32:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 0)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_repeated_int64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<256>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 2) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_repeated_int64(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated uint32 repeated_uint32 = 33;
+      case 33:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_repeated_uint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<264>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_repeated_uint32(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated uint64 repeated_uint64 = 34;
+      case 34:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_repeated_uint64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<272>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_repeated_uint64(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated sint32 repeated_sint32 = 35;
+      case 35:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_repeated_sint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<280>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_repeated_sint32(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated sint64 repeated_sint64 = 36;
+      case 36:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_repeated_sint64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<288>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt64Parser(_internal_mutable_repeated_sint64(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated fixed32 repeated_fixed32 = 37;
+      case 37:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 45)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_repeated_fixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr));
+            ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<301>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed32Parser(_internal_mutable_repeated_fixed32(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated fixed64 repeated_fixed64 = 38;
+      case 38:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 49)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_repeated_fixed64(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr));
+            ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<305>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_repeated_fixed64(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated sfixed32 repeated_sfixed32 = 39;
+      case 39:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 61)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_repeated_sfixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int32>(ptr));
+            ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int32);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<317>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSFixed32Parser(_internal_mutable_repeated_sfixed32(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated sfixed64 repeated_sfixed64 = 40;
+      case 40:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 65)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_repeated_sfixed64(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int64>(ptr));
+            ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int64);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<321>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSFixed64Parser(_internal_mutable_repeated_sfixed64(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated float repeated_float = 41;
+      case 41:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 77)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_repeated_float(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<333>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_repeated_float(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated double repeated_double = 42;
+      case 42:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 81)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_repeated_double(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+            ptr += sizeof(double);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<337>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_repeated_double(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated bool repeated_bool = 43;
+      case 43:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 88)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_repeated_bool(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<344>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedBoolParser(_internal_mutable_repeated_bool(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated string repeated_string = 44;
+      case 44:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_repeated_string();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<354>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated bytes repeated_bytes = 45;
+      case 45:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_repeated_bytes();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<362>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated group RepeatedGroup = 46 { ... };
+      case 46:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 115)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseGroup(_internal_add_repeatedgroup(), ptr, 371);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<371>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .protobuf_unittest.TestAllTypesLite.NestedMessage repeated_nested_message = 48;
+      case 48:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 130)) {
+          ptr -= 2;
+          repeated_nested_message_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<386>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_repeated_nested_message(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<386>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .protobuf_unittest.ForeignMessageLite repeated_foreign_message = 49;
+      case 49:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 138)) {
+          ptr -= 2;
+          repeated_foreign_message_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<394>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_repeated_foreign_message(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<394>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .protobuf_unittest_import.ImportMessageLite repeated_import_message = 50;
+      case 50:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 146)) {
+          ptr -= 2;
+          repeated_import_message_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<402>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_repeated_import_message(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<402>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .protobuf_unittest.TestAllTypesLite.NestedEnum repeated_nested_enum = 51;
+      case 51:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 152)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+            CHK_(ptr);
+            if (PROTOBUF_PREDICT_TRUE(::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid(val))) {
+              _internal_add_repeated_nested_enum(static_cast<::protobuf_unittest::TestAllTypesLite_NestedEnum>(val));
+            } else {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(51, val, mutable_unknown_fields());
+            }
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<408>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 154) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<std::string>(_internal_mutable_repeated_nested_enum(), ptr, ctx, ::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid, &_internal_metadata_, 51);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .protobuf_unittest.ForeignEnumLite repeated_foreign_enum = 52;
+      case 52:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 160)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+            CHK_(ptr);
+            if (PROTOBUF_PREDICT_TRUE(::protobuf_unittest::ForeignEnumLite_IsValid(val))) {
+              _internal_add_repeated_foreign_enum(static_cast<::protobuf_unittest::ForeignEnumLite>(val));
+            } else {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(52, val, mutable_unknown_fields());
+            }
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<416>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 162) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<std::string>(_internal_mutable_repeated_foreign_enum(), ptr, ctx, ::protobuf_unittest::ForeignEnumLite_IsValid, &_internal_metadata_, 52);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .protobuf_unittest_import.ImportEnumLite repeated_import_enum = 53;
+      case 53:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 168)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+            CHK_(ptr);
+            if (PROTOBUF_PREDICT_TRUE(::protobuf_unittest_import::ImportEnumLite_IsValid(val))) {
+              _internal_add_repeated_import_enum(static_cast<::protobuf_unittest_import::ImportEnumLite>(val));
+            } else {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(53, val, mutable_unknown_fields());
+            }
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<424>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 170) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<std::string>(_internal_mutable_repeated_import_enum(), ptr, ctx, ::protobuf_unittest_import::ImportEnumLite_IsValid, &_internal_metadata_, 53);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+      case 54:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 178)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_repeated_string_piece();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<434>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated string repeated_cord = 55 [ctype = CORD];
+      case 55:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 186)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_repeated_cord();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<442>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .protobuf_unittest.TestAllTypesLite.NestedMessage repeated_lazy_message = 57 [lazy = true];
+      case 57:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 202)) {
+          ptr -= 2;
+          repeated_lazy_message_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<458>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_repeated_lazy_message(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<458>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // optional int32 default_int32 = 61 [default = 41];
+      case 61:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 232)) {
+          _Internal::set_has_default_int32(&_has_bits_);
+          default_int32_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional int64 default_int64 = 62 [default = 42];
+      case 62:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 240)) {
+          _Internal::set_has_default_int64(&_has_bits_);
+          default_int64_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional uint32 default_uint32 = 63 [default = 43];
+      case 63:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 248)) {
+          _Internal::set_has_default_uint32(&_has_bits_);
+          default_uint32_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional uint64 default_uint64 = 64 [default = 44];
+      case 64:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 0)) {
+          _Internal::set_has_default_uint64(&_has_bits_);
+          default_uint64_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional sint32 default_sint32 = 65 [default = -45];
+      case 65:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          _Internal::set_has_default_sint32(&_has_bits_);
+          default_sint32_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional sint64 default_sint64 = 66 [default = 46];
+      case 66:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          _Internal::set_has_default_sint64(&_has_bits_);
+          default_sint64_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional fixed32 default_fixed32 = 67 [default = 47];
+      case 67:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 29)) {
+          _Internal::set_has_default_fixed32(&_has_bits_);
+          default_fixed32_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr);
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+        } else goto handle_unusual;
+        continue;
+      // optional fixed64 default_fixed64 = 68 [default = 48];
+      case 68:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 33)) {
+          _Internal::set_has_default_fixed64(&_has_bits_);
+          default_fixed64_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr);
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
+        } else goto handle_unusual;
+        continue;
+      // optional sfixed32 default_sfixed32 = 69 [default = 49];
+      case 69:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 45)) {
+          _Internal::set_has_default_sfixed32(&_has_bits_);
+          default_sfixed32_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int32>(ptr);
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int32);
+        } else goto handle_unusual;
+        continue;
+      // optional sfixed64 default_sfixed64 = 70 [default = -50];
+      case 70:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 49)) {
+          _Internal::set_has_default_sfixed64(&_has_bits_);
+          default_sfixed64_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int64>(ptr);
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int64);
+        } else goto handle_unusual;
+        continue;
+      // optional float default_float = 71 [default = 51.5];
+      case 71:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 61)) {
+          _Internal::set_has_default_float(&_has_bits_);
+          default_float_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // optional double default_double = 72 [default = 52000];
+      case 72:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 65)) {
+          _Internal::set_has_default_double(&_has_bits_);
+          default_double_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else goto handle_unusual;
+        continue;
+      // optional bool default_bool = 73 [default = true];
+      case 73:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 72)) {
+          _Internal::set_has_default_bool(&_has_bits_);
+          default_bool_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional string default_string = 74 [default = "hello"];
+      case 74:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+          _Internal::set_has_default_string(&_has_bits_);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&default_string_, &::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_.get(), arena, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional bytes default_bytes = 75 [default = "world"];
+      case 75:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+          _Internal::set_has_default_bytes(&_has_bits_);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&default_bytes_, &::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_bytes_.get(), arena, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest.TestAllTypesLite.NestedEnum default_nested_enum = 81 [default = BAR];
+      case 81:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 136)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid(val))) {
+            _internal_set_default_nested_enum(static_cast<::protobuf_unittest::TestAllTypesLite_NestedEnum>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(81, val, mutable_unknown_fields());
+          }
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest.ForeignEnumLite default_foreign_enum = 82 [default = FOREIGN_LITE_BAR];
+      case 82:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 144)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::protobuf_unittest::ForeignEnumLite_IsValid(val))) {
+            _internal_set_default_foreign_enum(static_cast<::protobuf_unittest::ForeignEnumLite>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(82, val, mutable_unknown_fields());
+          }
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest_import.ImportEnumLite default_import_enum = 83 [default = IMPORT_LITE_BAR];
+      case 83:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 152)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::protobuf_unittest_import::ImportEnumLite_IsValid(val))) {
+            _internal_set_default_import_enum(static_cast<::protobuf_unittest_import::ImportEnumLite>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(83, val, mutable_unknown_fields());
+          }
+        } else goto handle_unusual;
+        continue;
+      // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+      case 84:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 162)) {
+          _Internal::set_has_default_string_piece(&_has_bits_);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&default_string_piece_, &::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_piece_.get(), arena, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional string default_cord = 85 [default = "123", ctype = CORD];
+      case 85:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 170)) {
+          _Internal::set_has_default_cord(&_has_bits_);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&default_cord_, &::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_cord_.get(), arena, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 oneof_uint32 = 111;
+      case 111:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 120)) {
+          _internal_set_oneof_uint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .protobuf_unittest.TestAllTypesLite.NestedMessage oneof_nested_message = 112;
+      case 112:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_oneof_nested_message(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string oneof_string = 113;
+      case 113:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 138)) {
+          auto str = _internal_mutable_oneof_string();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes oneof_bytes = 114;
+      case 114:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 146)) {
+          auto str = _internal_mutable_oneof_bytes();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .protobuf_unittest.TestAllTypesLite.NestedMessage oneof_lazy_nested_message = 115 [lazy = true];
+      case 115:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_oneof_lazy_nested_message(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional int32 deceptively_named_list = 116;
+      case 116:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 160)) {
+          _Internal::set_has_deceptively_named_list(&_has_bits_);
+          deceptively_named_list_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestAllTypesLite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestAllTypesLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 optional_int32 = 1;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_optional_int32(), target);
+  }
+
+  // optional int64 optional_int64 = 2;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(2, this->_internal_optional_int64(), target);
+  }
+
+  // optional uint32 optional_uint32 = 3;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_optional_uint32(), target);
+  }
+
+  // optional uint64 optional_uint64 = 4;
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(4, this->_internal_optional_uint64(), target);
+  }
+
+  // optional sint32 optional_sint32 = 5;
+  if (cached_has_bits & 0x00080000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt32ToArray(5, this->_internal_optional_sint32(), target);
+  }
+
+  // optional sint64 optional_sint64 = 6;
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt64ToArray(6, this->_internal_optional_sint64(), target);
+  }
+
+  // optional fixed32 optional_fixed32 = 7;
+  if (cached_has_bits & 0x00100000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32ToArray(7, this->_internal_optional_fixed32(), target);
+  }
+
+  // optional fixed64 optional_fixed64 = 8;
+  if (cached_has_bits & 0x00200000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64ToArray(8, this->_internal_optional_fixed64(), target);
+  }
+
+  // optional sfixed32 optional_sfixed32 = 9;
+  if (cached_has_bits & 0x00800000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed32ToArray(9, this->_internal_optional_sfixed32(), target);
+  }
+
+  // optional sfixed64 optional_sfixed64 = 10;
+  if (cached_has_bits & 0x00400000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed64ToArray(10, this->_internal_optional_sfixed64(), target);
+  }
+
+  // optional float optional_float = 11;
+  if (cached_has_bits & 0x01000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(11, this->_internal_optional_float(), target);
+  }
+
+  // optional double optional_double = 12;
+  if (cached_has_bits & 0x02000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(12, this->_internal_optional_double(), target);
+  }
+
+  // optional bool optional_bool = 13;
+  if (cached_has_bits & 0x04000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(13, this->_internal_optional_bool(), target);
+  }
+
+  // optional string optional_string = 14;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        14, this->_internal_optional_string(), target);
+  }
+
+  // optional bytes optional_bytes = 15;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        15, this->_internal_optional_bytes(), target);
+  }
+
+  // optional group OptionalGroup = 16 { ... };
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        16, _Internal::optionalgroup(this), target, stream);
+  }
+
+  // optional .protobuf_unittest.TestAllTypesLite.NestedMessage optional_nested_message = 18;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        18, _Internal::optional_nested_message(this), target, stream);
+  }
+
+  // optional .protobuf_unittest.ForeignMessageLite optional_foreign_message = 19;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        19, _Internal::optional_foreign_message(this), target, stream);
+  }
+
+  // optional .protobuf_unittest_import.ImportMessageLite optional_import_message = 20;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        20, _Internal::optional_import_message(this), target, stream);
+  }
+
+  // optional .protobuf_unittest.TestAllTypesLite.NestedEnum optional_nested_enum = 21;
+  if (cached_has_bits & 0x10000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      21, this->_internal_optional_nested_enum(), target);
+  }
+
+  // optional .protobuf_unittest.ForeignEnumLite optional_foreign_enum = 22;
+  if (cached_has_bits & 0x20000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      22, this->_internal_optional_foreign_enum(), target);
+  }
+
+  // optional .protobuf_unittest_import.ImportEnumLite optional_import_enum = 23;
+  if (cached_has_bits & 0x40000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      23, this->_internal_optional_import_enum(), target);
+  }
+
+  // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteStringMaybeAliased(
+        24, this->_internal_optional_string_piece(), target);
+  }
+
+  // optional string optional_cord = 25 [ctype = CORD];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->WriteStringMaybeAliased(
+        25, this->_internal_optional_cord(), target);
+  }
+
+  // optional .protobuf_unittest_import.PublicImportMessageLite optional_public_import_message = 26;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        26, _Internal::optional_public_import_message(this), target, stream);
+  }
+
+  // optional .protobuf_unittest.TestAllTypesLite.NestedMessage optional_lazy_message = 27 [lazy = true];
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        27, _Internal::optional_lazy_message(this), target, stream);
+  }
+
+  // repeated int32 repeated_int32 = 31;
+  for (int i = 0, n = this->_internal_repeated_int32_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(31, this->_internal_repeated_int32(i), target);
+  }
+
+  // repeated int64 repeated_int64 = 32;
+  for (int i = 0, n = this->_internal_repeated_int64_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(32, this->_internal_repeated_int64(i), target);
+  }
+
+  // repeated uint32 repeated_uint32 = 33;
+  for (int i = 0, n = this->_internal_repeated_uint32_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(33, this->_internal_repeated_uint32(i), target);
+  }
+
+  // repeated uint64 repeated_uint64 = 34;
+  for (int i = 0, n = this->_internal_repeated_uint64_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(34, this->_internal_repeated_uint64(i), target);
+  }
+
+  // repeated sint32 repeated_sint32 = 35;
+  for (int i = 0, n = this->_internal_repeated_sint32_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt32ToArray(35, this->_internal_repeated_sint32(i), target);
+  }
+
+  // repeated sint64 repeated_sint64 = 36;
+  for (int i = 0, n = this->_internal_repeated_sint64_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt64ToArray(36, this->_internal_repeated_sint64(i), target);
+  }
+
+  // repeated fixed32 repeated_fixed32 = 37;
+  for (int i = 0, n = this->_internal_repeated_fixed32_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32ToArray(37, this->_internal_repeated_fixed32(i), target);
+  }
+
+  // repeated fixed64 repeated_fixed64 = 38;
+  for (int i = 0, n = this->_internal_repeated_fixed64_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64ToArray(38, this->_internal_repeated_fixed64(i), target);
+  }
+
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  for (int i = 0, n = this->_internal_repeated_sfixed32_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed32ToArray(39, this->_internal_repeated_sfixed32(i), target);
+  }
+
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  for (int i = 0, n = this->_internal_repeated_sfixed64_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed64ToArray(40, this->_internal_repeated_sfixed64(i), target);
+  }
+
+  // repeated float repeated_float = 41;
+  for (int i = 0, n = this->_internal_repeated_float_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(41, this->_internal_repeated_float(i), target);
+  }
+
+  // repeated double repeated_double = 42;
+  for (int i = 0, n = this->_internal_repeated_double_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(42, this->_internal_repeated_double(i), target);
+  }
+
+  // repeated bool repeated_bool = 43;
+  for (int i = 0, n = this->_internal_repeated_bool_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(43, this->_internal_repeated_bool(i), target);
+  }
+
+  // repeated string repeated_string = 44;
+  for (int i = 0, n = this->_internal_repeated_string_size(); i < n; i++) {
+    const auto& s = this->_internal_repeated_string(i);
+    target = stream->WriteString(44, s, target);
+  }
+
+  // repeated bytes repeated_bytes = 45;
+  for (int i = 0, n = this->_internal_repeated_bytes_size(); i < n; i++) {
+    const auto& s = this->_internal_repeated_bytes(i);
+    target = stream->WriteBytes(45, s, target);
+  }
+
+  // repeated group RepeatedGroup = 46 { ... };
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeatedgroup_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(46, this->_internal_repeatedgroup(i), target, stream);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypesLite.NestedMessage repeated_nested_message = 48;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_nested_message_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(48, this->_internal_repeated_nested_message(i), target, stream);
+  }
+
+  // repeated .protobuf_unittest.ForeignMessageLite repeated_foreign_message = 49;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_foreign_message_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(49, this->_internal_repeated_foreign_message(i), target, stream);
+  }
+
+  // repeated .protobuf_unittest_import.ImportMessageLite repeated_import_message = 50;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_import_message_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(50, this->_internal_repeated_import_message(i), target, stream);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypesLite.NestedEnum repeated_nested_enum = 51;
+  for (int i = 0, n = this->_internal_repeated_nested_enum_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+        51, this->_internal_repeated_nested_enum(i), target);
+  }
+
+  // repeated .protobuf_unittest.ForeignEnumLite repeated_foreign_enum = 52;
+  for (int i = 0, n = this->_internal_repeated_foreign_enum_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+        52, this->_internal_repeated_foreign_enum(i), target);
+  }
+
+  // repeated .protobuf_unittest_import.ImportEnumLite repeated_import_enum = 53;
+  for (int i = 0, n = this->_internal_repeated_import_enum_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+        53, this->_internal_repeated_import_enum(i), target);
+  }
+
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  for (int i = 0, n = this->_internal_repeated_string_piece_size(); i < n; i++) {
+    const auto& s = this->_internal_repeated_string_piece(i);
+    target = stream->WriteString(54, s, target);
+  }
+
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  for (int i = 0, n = this->_internal_repeated_cord_size(); i < n; i++) {
+    const auto& s = this->_internal_repeated_cord(i);
+    target = stream->WriteString(55, s, target);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypesLite.NestedMessage repeated_lazy_message = 57 [lazy = true];
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_lazy_message_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(57, this->_internal_repeated_lazy_message(i), target, stream);
+  }
+
+  // optional int32 default_int32 = 61 [default = 41];
+  if (cached_has_bits & 0x80000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(61, this->_internal_default_int32(), target);
+  }
+
+  cached_has_bits = _has_bits_[1];
+  // optional int64 default_int64 = 62 [default = 42];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(62, this->_internal_default_int64(), target);
+  }
+
+  // optional uint32 default_uint32 = 63 [default = 43];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(63, this->_internal_default_uint32(), target);
+  }
+
+  // optional uint64 default_uint64 = 64 [default = 44];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(64, this->_internal_default_uint64(), target);
+  }
+
+  // optional sint32 default_sint32 = 65 [default = -45];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt32ToArray(65, this->_internal_default_sint32(), target);
+  }
+
+  // optional sint64 default_sint64 = 66 [default = 46];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSInt64ToArray(66, this->_internal_default_sint64(), target);
+  }
+
+  // optional fixed32 default_fixed32 = 67 [default = 47];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32ToArray(67, this->_internal_default_fixed32(), target);
+  }
+
+  // optional fixed64 default_fixed64 = 68 [default = 48];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64ToArray(68, this->_internal_default_fixed64(), target);
+  }
+
+  // optional sfixed32 default_sfixed32 = 69 [default = 49];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed32ToArray(69, this->_internal_default_sfixed32(), target);
+  }
+
+  // optional sfixed64 default_sfixed64 = 70 [default = -50];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteSFixed64ToArray(70, this->_internal_default_sfixed64(), target);
+  }
+
+  // optional float default_float = 71 [default = 51.5];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(71, this->_internal_default_float(), target);
+  }
+
+  // optional double default_double = 72 [default = 52000];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(72, this->_internal_default_double(), target);
+  }
+
+  // optional bool default_bool = 73 [default = true];
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(73, this->_internal_default_bool(), target);
+  }
+
+  cached_has_bits = _has_bits_[0];
+  // optional string default_string = 74 [default = "hello"];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->WriteStringMaybeAliased(
+        74, this->_internal_default_string(), target);
+  }
+
+  // optional bytes default_bytes = 75 [default = "world"];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->WriteBytesMaybeAliased(
+        75, this->_internal_default_bytes(), target);
+  }
+
+  cached_has_bits = _has_bits_[1];
+  // optional .protobuf_unittest.TestAllTypesLite.NestedEnum default_nested_enum = 81 [default = BAR];
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      81, this->_internal_default_nested_enum(), target);
+  }
+
+  // optional .protobuf_unittest.ForeignEnumLite default_foreign_enum = 82 [default = FOREIGN_LITE_BAR];
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      82, this->_internal_default_foreign_enum(), target);
+  }
+
+  // optional .protobuf_unittest_import.ImportEnumLite default_import_enum = 83 [default = IMPORT_LITE_BAR];
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      83, this->_internal_default_import_enum(), target);
+  }
+
+  cached_has_bits = _has_bits_[0];
+  // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->WriteStringMaybeAliased(
+        84, this->_internal_default_string_piece(), target);
+  }
+
+  // optional string default_cord = 85 [default = "123", ctype = CORD];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->WriteStringMaybeAliased(
+        85, this->_internal_default_cord(), target);
+  }
+
+  switch (oneof_field_case()) {
+    case kOneofUint32: {
+      target = stream->EnsureSpace(target);
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(111, this->_internal_oneof_uint32(), target);
+      break;
+    }
+    case kOneofNestedMessage: {
+      target = stream->EnsureSpace(target);
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(
+          112, _Internal::oneof_nested_message(this), target, stream);
+      break;
+    }
+    case kOneofString: {
+      target = stream->WriteStringMaybeAliased(
+          113, this->_internal_oneof_string(), target);
+      break;
+    }
+    case kOneofBytes: {
+      target = stream->WriteBytesMaybeAliased(
+          114, this->_internal_oneof_bytes(), target);
+      break;
+    }
+    case kOneofLazyNestedMessage: {
+      target = stream->EnsureSpace(target);
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(
+          115, _Internal::oneof_lazy_nested_message(this), target, stream);
+      break;
+    }
+    default: ;
+  }
+  // optional int32 deceptively_named_list = 116;
+  if (cached_has_bits & 0x08000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(116, this->_internal_deceptively_named_list(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestAllTypesLite)
+  return target;
+}
+
+size_t TestAllTypesLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestAllTypesLite)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 repeated_int32 = 31;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int32Size(this->repeated_int32_);
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_int32_size());
+    total_size += data_size;
+  }
+
+  // repeated int64 repeated_int64 = 32;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int64Size(this->repeated_int64_);
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_int64_size());
+    total_size += data_size;
+  }
+
+  // repeated uint32 repeated_uint32 = 33;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt32Size(this->repeated_uint32_);
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_uint32_size());
+    total_size += data_size;
+  }
+
+  // repeated uint64 repeated_uint64 = 34;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt64Size(this->repeated_uint64_);
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_uint64_size());
+    total_size += data_size;
+  }
+
+  // repeated sint32 repeated_sint32 = 35;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      SInt32Size(this->repeated_sint32_);
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_sint32_size());
+    total_size += data_size;
+  }
+
+  // repeated sint64 repeated_sint64 = 36;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      SInt64Size(this->repeated_sint64_);
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_sint64_size());
+    total_size += data_size;
+  }
+
+  // repeated fixed32 repeated_fixed32 = 37;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_fixed32_size());
+    size_t data_size = 4UL * count;
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_fixed32_size());
+    total_size += data_size;
+  }
+
+  // repeated fixed64 repeated_fixed64 = 38;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_fixed64_size());
+    size_t data_size = 8UL * count;
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_fixed64_size());
+    total_size += data_size;
+  }
+
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_sfixed32_size());
+    size_t data_size = 4UL * count;
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_sfixed32_size());
+    total_size += data_size;
+  }
+
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_sfixed64_size());
+    size_t data_size = 8UL * count;
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_sfixed64_size());
+    total_size += data_size;
+  }
+
+  // repeated float repeated_float = 41;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_float_size());
+    size_t data_size = 4UL * count;
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_float_size());
+    total_size += data_size;
+  }
+
+  // repeated double repeated_double = 42;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_double_size());
+    size_t data_size = 8UL * count;
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_double_size());
+    total_size += data_size;
+  }
+
+  // repeated bool repeated_bool = 43;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_bool_size());
+    size_t data_size = 1UL * count;
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_bool_size());
+    total_size += data_size;
+  }
+
+  // repeated string repeated_string = 44;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(repeated_string_.size());
+  for (int i = 0, n = repeated_string_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      repeated_string_.Get(i));
+  }
+
+  // repeated bytes repeated_bytes = 45;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(repeated_bytes_.size());
+  for (int i = 0, n = repeated_bytes_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      repeated_bytes_.Get(i));
+  }
+
+  // repeated group RepeatedGroup = 46 { ... };
+  total_size += 4UL * this->_internal_repeatedgroup_size();
+  for (const auto& msg : this->repeatedgroup_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(msg);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypesLite.NestedMessage repeated_nested_message = 48;
+  total_size += 2UL * this->_internal_repeated_nested_message_size();
+  for (const auto& msg : this->repeated_nested_message_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .protobuf_unittest.ForeignMessageLite repeated_foreign_message = 49;
+  total_size += 2UL * this->_internal_repeated_foreign_message_size();
+  for (const auto& msg : this->repeated_foreign_message_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .protobuf_unittest_import.ImportMessageLite repeated_import_message = 50;
+  total_size += 2UL * this->_internal_repeated_import_message_size();
+  for (const auto& msg : this->repeated_import_message_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypesLite.NestedEnum repeated_nested_enum = 51;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_nested_enum_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(
+        this->_internal_repeated_nested_enum(static_cast<int>(i)));
+    }
+    total_size += (2UL * count) + data_size;
+  }
+
+  // repeated .protobuf_unittest.ForeignEnumLite repeated_foreign_enum = 52;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_foreign_enum_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(
+        this->_internal_repeated_foreign_enum(static_cast<int>(i)));
+    }
+    total_size += (2UL * count) + data_size;
+  }
+
+  // repeated .protobuf_unittest_import.ImportEnumLite repeated_import_enum = 53;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_import_enum_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(
+        this->_internal_repeated_import_enum(static_cast<int>(i)));
+    }
+    total_size += (2UL * count) + data_size;
+  }
+
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(repeated_string_piece_.size());
+  for (int i = 0, n = repeated_string_piece_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      repeated_string_piece_.Get(i));
+  }
+
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(repeated_cord_.size());
+  for (int i = 0, n = repeated_cord_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      repeated_cord_.Get(i));
+  }
+
+  // repeated .protobuf_unittest.TestAllTypesLite.NestedMessage repeated_lazy_message = 57 [lazy = true];
+  total_size += 2UL * this->_internal_repeated_lazy_message_size();
+  for (const auto& msg : this->repeated_lazy_message_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string optional_string = 14;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_optional_string());
+    }
+
+    // optional bytes optional_bytes = 15;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_optional_bytes());
+    }
+
+    // optional string optional_string_piece = 24 [ctype = STRING_PIECE];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_optional_string_piece());
+    }
+
+    // optional string optional_cord = 25 [ctype = CORD];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_optional_cord());
+    }
+
+    // optional string default_string = 74 [default = "hello"];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_default_string());
+    }
+
+    // optional bytes default_bytes = 75 [default = "world"];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_default_bytes());
+    }
+
+    // optional string default_string_piece = 84 [default = "abc", ctype = STRING_PIECE];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_default_string_piece());
+    }
+
+    // optional string default_cord = 85 [default = "123", ctype = CORD];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_default_cord());
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional group OptionalGroup = 16 { ... };
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *optionalgroup_);
+    }
+
+    // optional .protobuf_unittest.TestAllTypesLite.NestedMessage optional_nested_message = 18;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *optional_nested_message_);
+    }
+
+    // optional .protobuf_unittest.ForeignMessageLite optional_foreign_message = 19;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *optional_foreign_message_);
+    }
+
+    // optional .protobuf_unittest_import.ImportMessageLite optional_import_message = 20;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *optional_import_message_);
+    }
+
+    // optional .protobuf_unittest_import.PublicImportMessageLite optional_public_import_message = 26;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *optional_public_import_message_);
+    }
+
+    // optional .protobuf_unittest.TestAllTypesLite.NestedMessage optional_lazy_message = 27 [lazy = true];
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *optional_lazy_message_);
+    }
+
+    // optional int64 optional_int64 = 2;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+          this->_internal_optional_int64());
+    }
+
+    // optional int32 optional_int32 = 1;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_optional_int32());
+    }
+
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    // optional uint32 optional_uint32 = 3;
+    if (cached_has_bits & 0x00010000u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+          this->_internal_optional_uint32());
+    }
+
+    // optional uint64 optional_uint64 = 4;
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+          this->_internal_optional_uint64());
+    }
+
+    // optional sint64 optional_sint64 = 6;
+    if (cached_has_bits & 0x00040000u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SInt64Size(
+          this->_internal_optional_sint64());
+    }
+
+    // optional sint32 optional_sint32 = 5;
+    if (cached_has_bits & 0x00080000u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SInt32Size(
+          this->_internal_optional_sint32());
+    }
+
+    // optional fixed32 optional_fixed32 = 7;
+    if (cached_has_bits & 0x00100000u) {
+      total_size += 1 + 4;
+    }
+
+    // optional fixed64 optional_fixed64 = 8;
+    if (cached_has_bits & 0x00200000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional sfixed64 optional_sfixed64 = 10;
+    if (cached_has_bits & 0x00400000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional sfixed32 optional_sfixed32 = 9;
+    if (cached_has_bits & 0x00800000u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  if (cached_has_bits & 0xff000000u) {
+    // optional float optional_float = 11;
+    if (cached_has_bits & 0x01000000u) {
+      total_size += 1 + 4;
+    }
+
+    // optional double optional_double = 12;
+    if (cached_has_bits & 0x02000000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional bool optional_bool = 13;
+    if (cached_has_bits & 0x04000000u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 deceptively_named_list = 116;
+    if (cached_has_bits & 0x08000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_deceptively_named_list());
+    }
+
+    // optional .protobuf_unittest.TestAllTypesLite.NestedEnum optional_nested_enum = 21;
+    if (cached_has_bits & 0x10000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_optional_nested_enum());
+    }
+
+    // optional .protobuf_unittest.ForeignEnumLite optional_foreign_enum = 22;
+    if (cached_has_bits & 0x20000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_optional_foreign_enum());
+    }
+
+    // optional .protobuf_unittest_import.ImportEnumLite optional_import_enum = 23;
+    if (cached_has_bits & 0x40000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_optional_import_enum());
+    }
+
+    // optional int32 default_int32 = 61 [default = 41];
+    if (cached_has_bits & 0x80000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_default_int32());
+    }
+
+  }
+  cached_has_bits = _has_bits_[1];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional int64 default_int64 = 62 [default = 42];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+          this->_internal_default_int64());
+    }
+
+    // optional uint64 default_uint64 = 64 [default = 44];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+          this->_internal_default_uint64());
+    }
+
+    // optional uint32 default_uint32 = 63 [default = 43];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+          this->_internal_default_uint32());
+    }
+
+    // optional sint32 default_sint32 = 65 [default = -45];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SInt32Size(
+          this->_internal_default_sint32());
+    }
+
+    // optional sint64 default_sint64 = 66 [default = 46];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SInt64Size(
+          this->_internal_default_sint64());
+    }
+
+    // optional fixed64 default_fixed64 = 68 [default = 48];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 + 8;
+    }
+
+    // optional fixed32 default_fixed32 = 67 [default = 47];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 2 + 4;
+    }
+
+    // optional sfixed32 default_sfixed32 = 69 [default = 49];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 2 + 4;
+    }
+
+  }
+  if (cached_has_bits & 0x00007f00u) {
+    // optional sfixed64 default_sfixed64 = 70 [default = -50];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double default_double = 72 [default = 52000];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 2 + 8;
+    }
+
+    // optional float default_float = 71 [default = 51.5];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 2 + 4;
+    }
+
+    // optional bool default_bool = 73 [default = true];
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 2 + 1;
+    }
+
+    // optional .protobuf_unittest.TestAllTypesLite.NestedEnum default_nested_enum = 81 [default = BAR];
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_default_nested_enum());
+    }
+
+    // optional .protobuf_unittest.ForeignEnumLite default_foreign_enum = 82 [default = FOREIGN_LITE_BAR];
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_default_foreign_enum());
+    }
+
+    // optional .protobuf_unittest_import.ImportEnumLite default_import_enum = 83 [default = IMPORT_LITE_BAR];
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_default_import_enum());
+    }
+
+  }
+  switch (oneof_field_case()) {
+    // uint32 oneof_uint32 = 111;
+    case kOneofUint32: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+          this->_internal_oneof_uint32());
+      break;
+    }
+    // .protobuf_unittest.TestAllTypesLite.NestedMessage oneof_nested_message = 112;
+    case kOneofNestedMessage: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.oneof_nested_message_);
+      break;
+    }
+    // string oneof_string = 113;
+    case kOneofString: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_oneof_string());
+      break;
+    }
+    // bytes oneof_bytes = 114;
+    case kOneofBytes: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_oneof_bytes());
+      break;
+    }
+    // .protobuf_unittest.TestAllTypesLite.NestedMessage oneof_lazy_nested_message = 115 [lazy = true];
+    case kOneofLazyNestedMessage: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.oneof_lazy_nested_message_);
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestAllTypesLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestAllTypesLite*>(
+      &from));
+}
+
+void TestAllTypesLite::MergeFrom(const TestAllTypesLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestAllTypesLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_int32_.MergeFrom(from.repeated_int32_);
+  repeated_int64_.MergeFrom(from.repeated_int64_);
+  repeated_uint32_.MergeFrom(from.repeated_uint32_);
+  repeated_uint64_.MergeFrom(from.repeated_uint64_);
+  repeated_sint32_.MergeFrom(from.repeated_sint32_);
+  repeated_sint64_.MergeFrom(from.repeated_sint64_);
+  repeated_fixed32_.MergeFrom(from.repeated_fixed32_);
+  repeated_fixed64_.MergeFrom(from.repeated_fixed64_);
+  repeated_sfixed32_.MergeFrom(from.repeated_sfixed32_);
+  repeated_sfixed64_.MergeFrom(from.repeated_sfixed64_);
+  repeated_float_.MergeFrom(from.repeated_float_);
+  repeated_double_.MergeFrom(from.repeated_double_);
+  repeated_bool_.MergeFrom(from.repeated_bool_);
+  repeated_string_.MergeFrom(from.repeated_string_);
+  repeated_bytes_.MergeFrom(from.repeated_bytes_);
+  repeatedgroup_.MergeFrom(from.repeatedgroup_);
+  repeated_nested_message_.MergeFrom(from.repeated_nested_message_);
+  repeated_foreign_message_.MergeFrom(from.repeated_foreign_message_);
+  repeated_import_message_.MergeFrom(from.repeated_import_message_);
+  repeated_nested_enum_.MergeFrom(from.repeated_nested_enum_);
+  repeated_foreign_enum_.MergeFrom(from.repeated_foreign_enum_);
+  repeated_import_enum_.MergeFrom(from.repeated_import_enum_);
+  repeated_string_piece_.MergeFrom(from.repeated_string_piece_);
+  repeated_cord_.MergeFrom(from.repeated_cord_);
+  repeated_lazy_message_.MergeFrom(from.repeated_lazy_message_);
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _internal_set_optional_string(from._internal_optional_string());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _internal_set_optional_bytes(from._internal_optional_bytes());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _internal_set_optional_string_piece(from._internal_optional_string_piece());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _internal_set_optional_cord(from._internal_optional_cord());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _internal_set_default_string(from._internal_default_string());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _internal_set_default_bytes(from._internal_default_bytes());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _internal_set_default_string_piece(from._internal_default_string_piece());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _internal_set_default_cord(from._internal_default_cord());
+    }
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _internal_mutable_optionalgroup()->::protobuf_unittest::TestAllTypesLite_OptionalGroup::MergeFrom(from._internal_optionalgroup());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _internal_mutable_optional_nested_message()->::protobuf_unittest::TestAllTypesLite_NestedMessage::MergeFrom(from._internal_optional_nested_message());
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _internal_mutable_optional_foreign_message()->::protobuf_unittest::ForeignMessageLite::MergeFrom(from._internal_optional_foreign_message());
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _internal_mutable_optional_import_message()->::protobuf_unittest_import::ImportMessageLite::MergeFrom(from._internal_optional_import_message());
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _internal_mutable_optional_public_import_message()->::protobuf_unittest_import::PublicImportMessageLite::MergeFrom(from._internal_optional_public_import_message());
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _internal_mutable_optional_lazy_message()->::protobuf_unittest::TestAllTypesLite_NestedMessage::MergeFrom(from._internal_optional_lazy_message());
+    }
+    if (cached_has_bits & 0x00004000u) {
+      optional_int64_ = from.optional_int64_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      optional_int32_ = from.optional_int32_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      optional_uint32_ = from.optional_uint32_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      optional_uint64_ = from.optional_uint64_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      optional_sint64_ = from.optional_sint64_;
+    }
+    if (cached_has_bits & 0x00080000u) {
+      optional_sint32_ = from.optional_sint32_;
+    }
+    if (cached_has_bits & 0x00100000u) {
+      optional_fixed32_ = from.optional_fixed32_;
+    }
+    if (cached_has_bits & 0x00200000u) {
+      optional_fixed64_ = from.optional_fixed64_;
+    }
+    if (cached_has_bits & 0x00400000u) {
+      optional_sfixed64_ = from.optional_sfixed64_;
+    }
+    if (cached_has_bits & 0x00800000u) {
+      optional_sfixed32_ = from.optional_sfixed32_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0xff000000u) {
+    if (cached_has_bits & 0x01000000u) {
+      optional_float_ = from.optional_float_;
+    }
+    if (cached_has_bits & 0x02000000u) {
+      optional_double_ = from.optional_double_;
+    }
+    if (cached_has_bits & 0x04000000u) {
+      optional_bool_ = from.optional_bool_;
+    }
+    if (cached_has_bits & 0x08000000u) {
+      deceptively_named_list_ = from.deceptively_named_list_;
+    }
+    if (cached_has_bits & 0x10000000u) {
+      optional_nested_enum_ = from.optional_nested_enum_;
+    }
+    if (cached_has_bits & 0x20000000u) {
+      optional_foreign_enum_ = from.optional_foreign_enum_;
+    }
+    if (cached_has_bits & 0x40000000u) {
+      optional_import_enum_ = from.optional_import_enum_;
+    }
+    if (cached_has_bits & 0x80000000u) {
+      default_int32_ = from.default_int32_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  cached_has_bits = from._has_bits_[1];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      default_int64_ = from.default_int64_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      default_uint64_ = from.default_uint64_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      default_uint32_ = from.default_uint32_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      default_sint32_ = from.default_sint32_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      default_sint64_ = from.default_sint64_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      default_fixed64_ = from.default_fixed64_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      default_fixed32_ = from.default_fixed32_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      default_sfixed32_ = from.default_sfixed32_;
+    }
+    _has_bits_[1] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00007f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      default_sfixed64_ = from.default_sfixed64_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      default_double_ = from.default_double_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      default_float_ = from.default_float_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      default_bool_ = from.default_bool_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      default_nested_enum_ = from.default_nested_enum_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      default_foreign_enum_ = from.default_foreign_enum_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      default_import_enum_ = from.default_import_enum_;
+    }
+    _has_bits_[1] |= cached_has_bits;
+  }
+  switch (from.oneof_field_case()) {
+    case kOneofUint32: {
+      _internal_set_oneof_uint32(from._internal_oneof_uint32());
+      break;
+    }
+    case kOneofNestedMessage: {
+      _internal_mutable_oneof_nested_message()->::protobuf_unittest::TestAllTypesLite_NestedMessage::MergeFrom(from._internal_oneof_nested_message());
+      break;
+    }
+    case kOneofString: {
+      _internal_set_oneof_string(from._internal_oneof_string());
+      break;
+    }
+    case kOneofBytes: {
+      _internal_set_oneof_bytes(from._internal_oneof_bytes());
+      break;
+    }
+    case kOneofLazyNestedMessage: {
+      _internal_mutable_oneof_lazy_nested_message()->::protobuf_unittest::TestAllTypesLite_NestedMessage::MergeFrom(from._internal_oneof_lazy_nested_message());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+}
+
+void TestAllTypesLite::CopyFrom(const TestAllTypesLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestAllTypesLite)
+  if (&from == this) return;
+  Clear();
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  repeated_int32_.MergeFrom(from.repeated_int32_);
+  repeated_int64_.MergeFrom(from.repeated_int64_);
+  repeated_uint32_.MergeFrom(from.repeated_uint32_);
+  repeated_uint64_.MergeFrom(from.repeated_uint64_);
+  repeated_sint32_.MergeFrom(from.repeated_sint32_);
+  repeated_sint64_.MergeFrom(from.repeated_sint64_);
+  repeated_fixed32_.MergeFrom(from.repeated_fixed32_);
+  repeated_fixed64_.MergeFrom(from.repeated_fixed64_);
+  repeated_sfixed32_.MergeFrom(from.repeated_sfixed32_);
+  repeated_sfixed64_.MergeFrom(from.repeated_sfixed64_);
+  repeated_float_.MergeFrom(from.repeated_float_);
+  repeated_double_.MergeFrom(from.repeated_double_);
+  repeated_bool_.MergeFrom(from.repeated_bool_);
+  repeated_string_.MergeFrom(from.repeated_string_);
+  repeated_bytes_.MergeFrom(from.repeated_bytes_);
+  repeatedgroup_.MergeFrom(from.repeatedgroup_);
+  repeated_nested_message_.MergeFrom(from.repeated_nested_message_);
+  repeated_foreign_message_.MergeFrom(from.repeated_foreign_message_);
+  repeated_import_message_.MergeFrom(from.repeated_import_message_);
+  repeated_nested_enum_.MergeFrom(from.repeated_nested_enum_);
+  repeated_foreign_enum_.MergeFrom(from.repeated_foreign_enum_);
+  repeated_import_enum_.MergeFrom(from.repeated_import_enum_);
+  repeated_string_piece_.MergeFrom(from.repeated_string_piece_);
+  repeated_cord_.MergeFrom(from.repeated_cord_);
+  repeated_lazy_message_.MergeFrom(from.repeated_lazy_message_);
+  if (from._internal_has_optional_string()) {
+    _internal_set_optional_string(from._internal_optional_string());
+  }
+  if (from._internal_has_optional_bytes()) {
+    _internal_set_optional_bytes(from._internal_optional_bytes());
+  }
+  if (from._internal_has_optional_string_piece()) {
+    _internal_set_optional_string_piece(from._internal_optional_string_piece());
+  }
+  if (from._internal_has_optional_cord()) {
+    _internal_set_optional_cord(from._internal_optional_cord());
+  }
+  if (from._internal_has_default_string()) {
+    _internal_set_default_string(from._internal_default_string());
+  }
+  if (from._internal_has_default_bytes()) {
+    _internal_set_default_bytes(from._internal_default_bytes());
+  }
+  if (from._internal_has_default_string_piece()) {
+    _internal_set_default_string_piece(from._internal_default_string_piece());
+  }
+  if (from._internal_has_default_cord()) {
+    _internal_set_default_cord(from._internal_default_cord());
+  }
+  if (from._internal_has_optionalgroup()) {
+    _internal_mutable_optionalgroup()->::protobuf_unittest::TestAllTypesLite_OptionalGroup::MergeFrom(from._internal_optionalgroup());
+  }
+  if (from._internal_has_optional_nested_message()) {
+    _internal_mutable_optional_nested_message()->::protobuf_unittest::TestAllTypesLite_NestedMessage::MergeFrom(from._internal_optional_nested_message());
+  }
+  if (from._internal_has_optional_foreign_message()) {
+    _internal_mutable_optional_foreign_message()->::protobuf_unittest::ForeignMessageLite::MergeFrom(from._internal_optional_foreign_message());
+  }
+  if (from._internal_has_optional_import_message()) {
+    _internal_mutable_optional_import_message()->::protobuf_unittest_import::ImportMessageLite::MergeFrom(from._internal_optional_import_message());
+  }
+  if (from._internal_has_optional_public_import_message()) {
+    _internal_mutable_optional_public_import_message()->::protobuf_unittest_import::PublicImportMessageLite::MergeFrom(from._internal_optional_public_import_message());
+  }
+  if (from._internal_has_optional_lazy_message()) {
+    _internal_mutable_optional_lazy_message()->::protobuf_unittest::TestAllTypesLite_NestedMessage::MergeFrom(from._internal_optional_lazy_message());
+  }
+  ::memcpy(&optional_int64_, &from.optional_int64_,
+    static_cast<size_t>(reinterpret_cast<char*>(&default_import_enum_) -
+    reinterpret_cast<char*>(&optional_int64_)) + sizeof(default_import_enum_));
+  switch (from.oneof_field_case()) {
+    case kOneofUint32: {
+      _internal_set_oneof_uint32(from._internal_oneof_uint32());
+      break;
+    }
+    case kOneofNestedMessage: {
+      _internal_mutable_oneof_nested_message()->::protobuf_unittest::TestAllTypesLite_NestedMessage::MergeFrom(from._internal_oneof_nested_message());
+      break;
+    }
+    case kOneofString: {
+      _internal_set_oneof_string(from._internal_oneof_string());
+      break;
+    }
+    case kOneofBytes: {
+      _internal_set_oneof_bytes(from._internal_oneof_bytes());
+      break;
+    }
+    case kOneofLazyNestedMessage: {
+      _internal_mutable_oneof_lazy_nested_message()->::protobuf_unittest::TestAllTypesLite_NestedMessage::MergeFrom(from._internal_oneof_lazy_nested_message());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+}
+
+bool TestAllTypesLite::IsInitialized() const {
+  return true;
+}
+
+void TestAllTypesLite::InternalSwap(TestAllTypesLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(_has_bits_[1], other->_has_bits_[1]);
+  repeated_int32_.InternalSwap(&other->repeated_int32_);
+  repeated_int64_.InternalSwap(&other->repeated_int64_);
+  repeated_uint32_.InternalSwap(&other->repeated_uint32_);
+  repeated_uint64_.InternalSwap(&other->repeated_uint64_);
+  repeated_sint32_.InternalSwap(&other->repeated_sint32_);
+  repeated_sint64_.InternalSwap(&other->repeated_sint64_);
+  repeated_fixed32_.InternalSwap(&other->repeated_fixed32_);
+  repeated_fixed64_.InternalSwap(&other->repeated_fixed64_);
+  repeated_sfixed32_.InternalSwap(&other->repeated_sfixed32_);
+  repeated_sfixed64_.InternalSwap(&other->repeated_sfixed64_);
+  repeated_float_.InternalSwap(&other->repeated_float_);
+  repeated_double_.InternalSwap(&other->repeated_double_);
+  repeated_bool_.InternalSwap(&other->repeated_bool_);
+  repeated_string_.InternalSwap(&other->repeated_string_);
+  repeated_bytes_.InternalSwap(&other->repeated_bytes_);
+  repeatedgroup_.InternalSwap(&other->repeatedgroup_);
+  repeated_nested_message_.InternalSwap(&other->repeated_nested_message_);
+  repeated_foreign_message_.InternalSwap(&other->repeated_foreign_message_);
+  repeated_import_message_.InternalSwap(&other->repeated_import_message_);
+  repeated_nested_enum_.InternalSwap(&other->repeated_nested_enum_);
+  repeated_foreign_enum_.InternalSwap(&other->repeated_foreign_enum_);
+  repeated_import_enum_.InternalSwap(&other->repeated_import_enum_);
+  repeated_string_piece_.InternalSwap(&other->repeated_string_piece_);
+  repeated_cord_.InternalSwap(&other->repeated_cord_);
+  repeated_lazy_message_.InternalSwap(&other->repeated_lazy_message_);
+  optional_string_.Swap(&other->optional_string_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  optional_bytes_.Swap(&other->optional_bytes_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  optional_string_piece_.Swap(&other->optional_string_piece_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  optional_cord_.Swap(&other->optional_cord_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  default_string_.Swap(&other->default_string_, &::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_.get(), GetArena());
+  default_bytes_.Swap(&other->default_bytes_, &::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_bytes_.get(), GetArena());
+  default_string_piece_.Swap(&other->default_string_piece_, &::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_string_piece_.get(), GetArena());
+  default_cord_.Swap(&other->default_cord_, &::protobuf_unittest::TestAllTypesLite::_i_give_permission_to_break_this_code_default_default_cord_.get(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestAllTypesLite, deceptively_named_list_)
+      + sizeof(TestAllTypesLite::deceptively_named_list_)
+      - PROTOBUF_FIELD_OFFSET(TestAllTypesLite, optionalgroup_)>(
+          reinterpret_cast<char*>(&optionalgroup_),
+          reinterpret_cast<char*>(&other->optionalgroup_));
+  swap(optional_nested_enum_, other->optional_nested_enum_);
+  swap(optional_foreign_enum_, other->optional_foreign_enum_);
+  swap(optional_import_enum_, other->optional_import_enum_);
+  swap(default_int32_, other->default_int32_);
+  swap(default_int64_, other->default_int64_);
+  swap(default_uint64_, other->default_uint64_);
+  swap(default_uint32_, other->default_uint32_);
+  swap(default_sint32_, other->default_sint32_);
+  swap(default_sint64_, other->default_sint64_);
+  swap(default_fixed64_, other->default_fixed64_);
+  swap(default_fixed32_, other->default_fixed32_);
+  swap(default_sfixed32_, other->default_sfixed32_);
+  swap(default_sfixed64_, other->default_sfixed64_);
+  swap(default_double_, other->default_double_);
+  swap(default_float_, other->default_float_);
+  swap(default_bool_, other->default_bool_);
+  swap(default_nested_enum_, other->default_nested_enum_);
+  swap(default_foreign_enum_, other->default_foreign_enum_);
+  swap(default_import_enum_, other->default_import_enum_);
+  swap(oneof_field_, other->oneof_field_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+std::string TestAllTypesLite::GetTypeName() const {
+  return "protobuf_unittest.TestAllTypesLite";
+}
+
+
+// ===================================================================
+
+void ForeignMessageLite::InitAsDefaultInstance() {
+}
+class ForeignMessageLite::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ForeignMessageLite>()._has_bits_);
+  static void set_has_c(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ForeignMessageLite::ForeignMessageLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.ForeignMessageLite)
+}
+ForeignMessageLite::ForeignMessageLite(const ForeignMessageLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  c_ = from.c_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.ForeignMessageLite)
+}
+
+void ForeignMessageLite::SharedCtor() {
+  c_ = 0;
+}
+
+ForeignMessageLite::~ForeignMessageLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.ForeignMessageLite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void ForeignMessageLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void ForeignMessageLite::ArenaDtor(void* object) {
+  ForeignMessageLite* _this = reinterpret_cast< ForeignMessageLite* >(object);
+  (void)_this;
+}
+void ForeignMessageLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void ForeignMessageLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const ForeignMessageLite& ForeignMessageLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ForeignMessageLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void ForeignMessageLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.ForeignMessageLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  c_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* ForeignMessageLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional int32 c = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          _Internal::set_has_c(&has_bits);
+          c_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* ForeignMessageLite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.ForeignMessageLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 c = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_c(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.ForeignMessageLite)
+  return target;
+}
+
+size_t ForeignMessageLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.ForeignMessageLite)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 c = 1;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_c());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ForeignMessageLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ForeignMessageLite*>(
+      &from));
+}
+
+void ForeignMessageLite::MergeFrom(const ForeignMessageLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.ForeignMessageLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_c()) {
+    _internal_set_c(from._internal_c());
+  }
+}
+
+void ForeignMessageLite::CopyFrom(const ForeignMessageLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.ForeignMessageLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ForeignMessageLite::IsInitialized() const {
+  return true;
+}
+
+void ForeignMessageLite::InternalSwap(ForeignMessageLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(c_, other->c_);
+}
+
+std::string ForeignMessageLite::GetTypeName() const {
+  return "protobuf_unittest.ForeignMessageLite";
+}
+
+
+// ===================================================================
+
+void TestPackedTypesLite::InitAsDefaultInstance() {
+}
+class TestPackedTypesLite::_Internal {
+ public:
+};
+
+TestPackedTypesLite::TestPackedTypesLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena),
+  packed_int32_(arena),
+  packed_int64_(arena),
+  packed_uint32_(arena),
+  packed_uint64_(arena),
+  packed_sint32_(arena),
+  packed_sint64_(arena),
+  packed_fixed32_(arena),
+  packed_fixed64_(arena),
+  packed_sfixed32_(arena),
+  packed_sfixed64_(arena),
+  packed_float_(arena),
+  packed_double_(arena),
+  packed_bool_(arena),
+  packed_enum_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestPackedTypesLite)
+}
+TestPackedTypesLite::TestPackedTypesLite(const TestPackedTypesLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      packed_int32_(from.packed_int32_),
+      packed_int64_(from.packed_int64_),
+      packed_uint32_(from.packed_uint32_),
+      packed_uint64_(from.packed_uint64_),
+      packed_sint32_(from.packed_sint32_),
+      packed_sint64_(from.packed_sint64_),
+      packed_fixed32_(from.packed_fixed32_),
+      packed_fixed64_(from.packed_fixed64_),
+      packed_sfixed32_(from.packed_sfixed32_),
+      packed_sfixed64_(from.packed_sfixed64_),
+      packed_float_(from.packed_float_),
+      packed_double_(from.packed_double_),
+      packed_bool_(from.packed_bool_),
+      packed_enum_(from.packed_enum_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestPackedTypesLite)
+}
+
+void TestPackedTypesLite::SharedCtor() {
+}
+
+TestPackedTypesLite::~TestPackedTypesLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestPackedTypesLite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestPackedTypesLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestPackedTypesLite::ArenaDtor(void* object) {
+  TestPackedTypesLite* _this = reinterpret_cast< TestPackedTypesLite* >(object);
+  (void)_this;
+}
+void TestPackedTypesLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestPackedTypesLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestPackedTypesLite& TestPackedTypesLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestPackedTypesLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestPackedTypesLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestPackedTypesLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  packed_int32_.Clear();
+  packed_int64_.Clear();
+  packed_uint32_.Clear();
+  packed_uint64_.Clear();
+  packed_sint32_.Clear();
+  packed_sint64_.Clear();
+  packed_fixed32_.Clear();
+  packed_fixed64_.Clear();
+  packed_sfixed32_.Clear();
+  packed_sfixed64_.Clear();
+  packed_float_.Clear();
+  packed_double_.Clear();
+  packed_bool_.Clear();
+  packed_enum_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestPackedTypesLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated int32 packed_int32 = 90 [packed = true];
+      case 90:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 210)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_packed_int32(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 208) {
+          _internal_add_packed_int32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated int64 packed_int64 = 91 [packed = true];
+      case 91:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 218)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_packed_int64(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 216) {
+          _internal_add_packed_int64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated uint32 packed_uint32 = 92 [packed = true];
+      case 92:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 226)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_packed_uint32(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 224) {
+          _internal_add_packed_uint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated uint64 packed_uint64 = 93 [packed = true];
+      case 93:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 234)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_packed_uint64(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 232) {
+          _internal_add_packed_uint64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated sint32 packed_sint32 = 94 [packed = true];
+      case 94:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 242)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_packed_sint32(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 240) {
+          _internal_add_packed_sint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated sint64 packed_sint64 = 95 [packed = true];
+      case 95:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 250)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt64Parser(_internal_mutable_packed_sint64(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 248) {
+          _internal_add_packed_sint64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated fixed32 packed_fixed32 = 96 [packed = true];
+      case 96:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 2)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed32Parser(_internal_mutable_packed_fixed32(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 5) {
+          _internal_add_packed_fixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr));
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+        } else goto handle_unusual;
+        continue;
+      // repeated fixed64 packed_fixed64 = 97 [packed = true];
+      case 97:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_packed_fixed64(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 9) {
+          _internal_add_packed_fixed64(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr));
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
+        } else goto handle_unusual;
+        continue;
+      // repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+      case 98:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSFixed32Parser(_internal_mutable_packed_sfixed32(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21) {
+          _internal_add_packed_sfixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int32>(ptr));
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int32);
+        } else goto handle_unusual;
+        continue;
+      // repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+      case 99:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSFixed64Parser(_internal_mutable_packed_sfixed64(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 25) {
+          _internal_add_packed_sfixed64(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::int64>(ptr));
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::int64);
+        } else goto handle_unusual;
+        continue;
+      // repeated float packed_float = 100 [packed = true];
+      case 100:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_packed_float(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 37) {
+          _internal_add_packed_float(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // repeated double packed_double = 101 [packed = true];
+      case 101:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_packed_double(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 41) {
+          _internal_add_packed_double(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else goto handle_unusual;
+        continue;
+      // repeated bool packed_bool = 102 [packed = true];
+      case 102:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedBoolParser(_internal_mutable_packed_bool(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48) {
+          _internal_add_packed_bool(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .protobuf_unittest.ForeignEnumLite packed_enum = 103 [packed = true];
+      case 103:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<std::string>(_internal_mutable_packed_enum(), ptr, ctx, ::protobuf_unittest::ForeignEnumLite_IsValid, &_internal_metadata_, 103);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::protobuf_unittest::ForeignEnumLite_IsValid(val))) {
+            _internal_add_packed_enum(static_cast<::protobuf_unittest::ForeignEnumLite>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(103, val, mutable_unknown_fields());
+          }
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestPackedTypesLite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestPackedTypesLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated int32 packed_int32 = 90 [packed = true];
+  {
+    int byte_size = _packed_int32_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          90, _internal_packed_int32(), byte_size, target);
+    }
+  }
+
+  // repeated int64 packed_int64 = 91 [packed = true];
+  {
+    int byte_size = _packed_int64_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          91, _internal_packed_int64(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 packed_uint32 = 92 [packed = true];
+  {
+    int byte_size = _packed_uint32_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          92, _internal_packed_uint32(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 packed_uint64 = 93 [packed = true];
+  {
+    int byte_size = _packed_uint64_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          93, _internal_packed_uint64(), byte_size, target);
+    }
+  }
+
+  // repeated sint32 packed_sint32 = 94 [packed = true];
+  {
+    int byte_size = _packed_sint32_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          94, _internal_packed_sint32(), byte_size, target);
+    }
+  }
+
+  // repeated sint64 packed_sint64 = 95 [packed = true];
+  {
+    int byte_size = _packed_sint64_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt64Packed(
+          95, _internal_packed_sint64(), byte_size, target);
+    }
+  }
+
+  // repeated fixed32 packed_fixed32 = 96 [packed = true];
+  if (this->_internal_packed_fixed32_size() > 0) {
+    target = stream->WriteFixedPacked(96, _internal_packed_fixed32(), target);
+  }
+
+  // repeated fixed64 packed_fixed64 = 97 [packed = true];
+  if (this->_internal_packed_fixed64_size() > 0) {
+    target = stream->WriteFixedPacked(97, _internal_packed_fixed64(), target);
+  }
+
+  // repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+  if (this->_internal_packed_sfixed32_size() > 0) {
+    target = stream->WriteFixedPacked(98, _internal_packed_sfixed32(), target);
+  }
+
+  // repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+  if (this->_internal_packed_sfixed64_size() > 0) {
+    target = stream->WriteFixedPacked(99, _internal_packed_sfixed64(), target);
+  }
+
+  // repeated float packed_float = 100 [packed = true];
+  if (this->_internal_packed_float_size() > 0) {
+    target = stream->WriteFixedPacked(100, _internal_packed_float(), target);
+  }
+
+  // repeated double packed_double = 101 [packed = true];
+  if (this->_internal_packed_double_size() > 0) {
+    target = stream->WriteFixedPacked(101, _internal_packed_double(), target);
+  }
+
+  // repeated bool packed_bool = 102 [packed = true];
+  if (this->_internal_packed_bool_size() > 0) {
+    target = stream->WriteFixedPacked(102, _internal_packed_bool(), target);
+  }
+
+  // repeated .protobuf_unittest.ForeignEnumLite packed_enum = 103 [packed = true];
+  {
+    int byte_size = _packed_enum_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(
+          103, packed_enum_, byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestPackedTypesLite)
+  return target;
+}
+
+size_t TestPackedTypesLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestPackedTypesLite)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 packed_int32 = 90 [packed = true];
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int32Size(this->packed_int32_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _packed_int32_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int64 packed_int64 = 91 [packed = true];
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int64Size(this->packed_int64_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _packed_int64_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 packed_uint32 = 92 [packed = true];
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt32Size(this->packed_uint32_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _packed_uint32_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 packed_uint64 = 93 [packed = true];
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt64Size(this->packed_uint64_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _packed_uint64_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sint32 packed_sint32 = 94 [packed = true];
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      SInt32Size(this->packed_sint32_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _packed_sint32_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sint64 packed_sint64 = 95 [packed = true];
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      SInt64Size(this->packed_sint64_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _packed_sint64_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated fixed32 packed_fixed32 = 96 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_packed_fixed32_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _packed_fixed32_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated fixed64 packed_fixed64 = 97 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_packed_fixed64_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _packed_fixed64_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_packed_sfixed32_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _packed_sfixed32_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_packed_sfixed64_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _packed_sfixed64_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated float packed_float = 100 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_packed_float_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _packed_float_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated double packed_double = 101 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_packed_double_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _packed_double_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated bool packed_bool = 102 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_packed_bool_size());
+    size_t data_size = 1UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _packed_bool_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated .protobuf_unittest.ForeignEnumLite packed_enum = 103 [packed = true];
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_packed_enum_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(
+        this->_internal_packed_enum(static_cast<int>(i)));
+    }
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _packed_enum_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestPackedTypesLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestPackedTypesLite*>(
+      &from));
+}
+
+void TestPackedTypesLite::MergeFrom(const TestPackedTypesLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestPackedTypesLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  packed_int32_.MergeFrom(from.packed_int32_);
+  packed_int64_.MergeFrom(from.packed_int64_);
+  packed_uint32_.MergeFrom(from.packed_uint32_);
+  packed_uint64_.MergeFrom(from.packed_uint64_);
+  packed_sint32_.MergeFrom(from.packed_sint32_);
+  packed_sint64_.MergeFrom(from.packed_sint64_);
+  packed_fixed32_.MergeFrom(from.packed_fixed32_);
+  packed_fixed64_.MergeFrom(from.packed_fixed64_);
+  packed_sfixed32_.MergeFrom(from.packed_sfixed32_);
+  packed_sfixed64_.MergeFrom(from.packed_sfixed64_);
+  packed_float_.MergeFrom(from.packed_float_);
+  packed_double_.MergeFrom(from.packed_double_);
+  packed_bool_.MergeFrom(from.packed_bool_);
+  packed_enum_.MergeFrom(from.packed_enum_);
+}
+
+void TestPackedTypesLite::CopyFrom(const TestPackedTypesLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestPackedTypesLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestPackedTypesLite::IsInitialized() const {
+  return true;
+}
+
+void TestPackedTypesLite::InternalSwap(TestPackedTypesLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  packed_int32_.InternalSwap(&other->packed_int32_);
+  packed_int64_.InternalSwap(&other->packed_int64_);
+  packed_uint32_.InternalSwap(&other->packed_uint32_);
+  packed_uint64_.InternalSwap(&other->packed_uint64_);
+  packed_sint32_.InternalSwap(&other->packed_sint32_);
+  packed_sint64_.InternalSwap(&other->packed_sint64_);
+  packed_fixed32_.InternalSwap(&other->packed_fixed32_);
+  packed_fixed64_.InternalSwap(&other->packed_fixed64_);
+  packed_sfixed32_.InternalSwap(&other->packed_sfixed32_);
+  packed_sfixed64_.InternalSwap(&other->packed_sfixed64_);
+  packed_float_.InternalSwap(&other->packed_float_);
+  packed_double_.InternalSwap(&other->packed_double_);
+  packed_bool_.InternalSwap(&other->packed_bool_);
+  packed_enum_.InternalSwap(&other->packed_enum_);
+}
+
+std::string TestPackedTypesLite::GetTypeName() const {
+  return "protobuf_unittest.TestPackedTypesLite";
+}
+
+
+// ===================================================================
+
+void TestAllExtensionsLite::InitAsDefaultInstance() {
+}
+class TestAllExtensionsLite::_Internal {
+ public:
+};
+
+TestAllExtensionsLite::TestAllExtensionsLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena),
+  _extensions_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestAllExtensionsLite)
+}
+TestAllExtensionsLite::TestAllExtensionsLite(const TestAllExtensionsLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _extensions_.MergeFrom(from._extensions_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestAllExtensionsLite)
+}
+
+void TestAllExtensionsLite::SharedCtor() {
+}
+
+TestAllExtensionsLite::~TestAllExtensionsLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestAllExtensionsLite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestAllExtensionsLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestAllExtensionsLite::ArenaDtor(void* object) {
+  TestAllExtensionsLite* _this = reinterpret_cast< TestAllExtensionsLite* >(object);
+  (void)_this;
+}
+void TestAllExtensionsLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestAllExtensionsLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestAllExtensionsLite& TestAllExtensionsLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestAllExtensionsLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestAllExtensionsLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestAllExtensionsLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _extensions_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestAllExtensionsLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+      if ((8u <= tag)) {
+        ptr = _extensions_.ParseField(tag, ptr,
+            internal_default_instance(), &_internal_metadata_, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestAllExtensionsLite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestAllExtensionsLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // Extension range [1, 536870912)
+  target = _extensions_._InternalSerialize(
+      1, 536870912, target, stream);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestAllExtensionsLite)
+  return target;
+}
+
+size_t TestAllExtensionsLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestAllExtensionsLite)
+  size_t total_size = 0;
+
+  total_size += _extensions_.ByteSize();
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestAllExtensionsLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestAllExtensionsLite*>(
+      &from));
+}
+
+void TestAllExtensionsLite::MergeFrom(const TestAllExtensionsLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestAllExtensionsLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _extensions_.MergeFrom(from._extensions_);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+}
+
+void TestAllExtensionsLite::CopyFrom(const TestAllExtensionsLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestAllExtensionsLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestAllExtensionsLite::IsInitialized() const {
+  if (!_extensions_.IsInitialized()) {
+    return false;
+  }
+
+  return true;
+}
+
+void TestAllExtensionsLite::InternalSwap(TestAllExtensionsLite* other) {
+  using std::swap;
+  _extensions_.Swap(&other->_extensions_);
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+}
+
+std::string TestAllExtensionsLite::GetTypeName() const {
+  return "protobuf_unittest.TestAllExtensionsLite";
+}
+
+
+// ===================================================================
+
+void OptionalGroup_extension_lite::InitAsDefaultInstance() {
+}
+class OptionalGroup_extension_lite::_Internal {
+ public:
+  using HasBits = decltype(std::declval<OptionalGroup_extension_lite>()._has_bits_);
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+OptionalGroup_extension_lite::OptionalGroup_extension_lite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.OptionalGroup_extension_lite)
+}
+OptionalGroup_extension_lite::OptionalGroup_extension_lite(const OptionalGroup_extension_lite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  a_ = from.a_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.OptionalGroup_extension_lite)
+}
+
+void OptionalGroup_extension_lite::SharedCtor() {
+  a_ = 0;
+}
+
+OptionalGroup_extension_lite::~OptionalGroup_extension_lite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.OptionalGroup_extension_lite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void OptionalGroup_extension_lite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void OptionalGroup_extension_lite::ArenaDtor(void* object) {
+  OptionalGroup_extension_lite* _this = reinterpret_cast< OptionalGroup_extension_lite* >(object);
+  (void)_this;
+}
+void OptionalGroup_extension_lite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void OptionalGroup_extension_lite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const OptionalGroup_extension_lite& OptionalGroup_extension_lite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_OptionalGroup_extension_lite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void OptionalGroup_extension_lite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.OptionalGroup_extension_lite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  a_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* OptionalGroup_extension_lite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional int32 a = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 136)) {
+          _Internal::set_has_a(&has_bits);
+          a_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* OptionalGroup_extension_lite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.OptionalGroup_extension_lite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 a = 17;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(17, this->_internal_a(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.OptionalGroup_extension_lite)
+  return target;
+}
+
+size_t OptionalGroup_extension_lite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.OptionalGroup_extension_lite)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 a = 17;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_a());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void OptionalGroup_extension_lite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const OptionalGroup_extension_lite*>(
+      &from));
+}
+
+void OptionalGroup_extension_lite::MergeFrom(const OptionalGroup_extension_lite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.OptionalGroup_extension_lite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_a()) {
+    _internal_set_a(from._internal_a());
+  }
+}
+
+void OptionalGroup_extension_lite::CopyFrom(const OptionalGroup_extension_lite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.OptionalGroup_extension_lite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OptionalGroup_extension_lite::IsInitialized() const {
+  return true;
+}
+
+void OptionalGroup_extension_lite::InternalSwap(OptionalGroup_extension_lite* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(a_, other->a_);
+}
+
+std::string OptionalGroup_extension_lite::GetTypeName() const {
+  return "protobuf_unittest.OptionalGroup_extension_lite";
+}
+
+
+// ===================================================================
+
+void RepeatedGroup_extension_lite::InitAsDefaultInstance() {
+}
+class RepeatedGroup_extension_lite::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RepeatedGroup_extension_lite>()._has_bits_);
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+RepeatedGroup_extension_lite::RepeatedGroup_extension_lite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.RepeatedGroup_extension_lite)
+}
+RepeatedGroup_extension_lite::RepeatedGroup_extension_lite(const RepeatedGroup_extension_lite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  a_ = from.a_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.RepeatedGroup_extension_lite)
+}
+
+void RepeatedGroup_extension_lite::SharedCtor() {
+  a_ = 0;
+}
+
+RepeatedGroup_extension_lite::~RepeatedGroup_extension_lite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.RepeatedGroup_extension_lite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void RepeatedGroup_extension_lite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void RepeatedGroup_extension_lite::ArenaDtor(void* object) {
+  RepeatedGroup_extension_lite* _this = reinterpret_cast< RepeatedGroup_extension_lite* >(object);
+  (void)_this;
+}
+void RepeatedGroup_extension_lite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void RepeatedGroup_extension_lite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const RepeatedGroup_extension_lite& RepeatedGroup_extension_lite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RepeatedGroup_extension_lite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void RepeatedGroup_extension_lite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.RepeatedGroup_extension_lite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  a_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* RepeatedGroup_extension_lite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional int32 a = 47;
+      case 47:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 120)) {
+          _Internal::set_has_a(&has_bits);
+          a_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* RepeatedGroup_extension_lite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.RepeatedGroup_extension_lite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 a = 47;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(47, this->_internal_a(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.RepeatedGroup_extension_lite)
+  return target;
+}
+
+size_t RepeatedGroup_extension_lite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.RepeatedGroup_extension_lite)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 a = 47;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_a());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void RepeatedGroup_extension_lite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const RepeatedGroup_extension_lite*>(
+      &from));
+}
+
+void RepeatedGroup_extension_lite::MergeFrom(const RepeatedGroup_extension_lite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.RepeatedGroup_extension_lite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_a()) {
+    _internal_set_a(from._internal_a());
+  }
+}
+
+void RepeatedGroup_extension_lite::CopyFrom(const RepeatedGroup_extension_lite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.RepeatedGroup_extension_lite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RepeatedGroup_extension_lite::IsInitialized() const {
+  return true;
+}
+
+void RepeatedGroup_extension_lite::InternalSwap(RepeatedGroup_extension_lite* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(a_, other->a_);
+}
+
+std::string RepeatedGroup_extension_lite::GetTypeName() const {
+  return "protobuf_unittest.RepeatedGroup_extension_lite";
+}
+
+
+// ===================================================================
+
+void TestPackedExtensionsLite::InitAsDefaultInstance() {
+}
+class TestPackedExtensionsLite::_Internal {
+ public:
+};
+
+TestPackedExtensionsLite::TestPackedExtensionsLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena),
+  _extensions_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestPackedExtensionsLite)
+}
+TestPackedExtensionsLite::TestPackedExtensionsLite(const TestPackedExtensionsLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _extensions_.MergeFrom(from._extensions_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestPackedExtensionsLite)
+}
+
+void TestPackedExtensionsLite::SharedCtor() {
+}
+
+TestPackedExtensionsLite::~TestPackedExtensionsLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestPackedExtensionsLite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestPackedExtensionsLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestPackedExtensionsLite::ArenaDtor(void* object) {
+  TestPackedExtensionsLite* _this = reinterpret_cast< TestPackedExtensionsLite* >(object);
+  (void)_this;
+}
+void TestPackedExtensionsLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestPackedExtensionsLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestPackedExtensionsLite& TestPackedExtensionsLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestPackedExtensionsLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestPackedExtensionsLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestPackedExtensionsLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _extensions_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestPackedExtensionsLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+      if ((8u <= tag)) {
+        ptr = _extensions_.ParseField(tag, ptr,
+            internal_default_instance(), &_internal_metadata_, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestPackedExtensionsLite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestPackedExtensionsLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // Extension range [1, 536870912)
+  target = _extensions_._InternalSerialize(
+      1, 536870912, target, stream);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestPackedExtensionsLite)
+  return target;
+}
+
+size_t TestPackedExtensionsLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestPackedExtensionsLite)
+  size_t total_size = 0;
+
+  total_size += _extensions_.ByteSize();
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestPackedExtensionsLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestPackedExtensionsLite*>(
+      &from));
+}
+
+void TestPackedExtensionsLite::MergeFrom(const TestPackedExtensionsLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestPackedExtensionsLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _extensions_.MergeFrom(from._extensions_);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+}
+
+void TestPackedExtensionsLite::CopyFrom(const TestPackedExtensionsLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestPackedExtensionsLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestPackedExtensionsLite::IsInitialized() const {
+  if (!_extensions_.IsInitialized()) {
+    return false;
+  }
+
+  return true;
+}
+
+void TestPackedExtensionsLite::InternalSwap(TestPackedExtensionsLite* other) {
+  using std::swap;
+  _extensions_.Swap(&other->_extensions_);
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+}
+
+std::string TestPackedExtensionsLite::GetTypeName() const {
+  return "protobuf_unittest.TestPackedExtensionsLite";
+}
+
+
+// ===================================================================
+
+void TestNestedExtensionLite::InitAsDefaultInstance() {
+}
+class TestNestedExtensionLite::_Internal {
+ public:
+};
+
+TestNestedExtensionLite::TestNestedExtensionLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestNestedExtensionLite)
+}
+TestNestedExtensionLite::TestNestedExtensionLite(const TestNestedExtensionLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestNestedExtensionLite)
+}
+
+void TestNestedExtensionLite::SharedCtor() {
+}
+
+TestNestedExtensionLite::~TestNestedExtensionLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestNestedExtensionLite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestNestedExtensionLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestNestedExtensionLite::ArenaDtor(void* object) {
+  TestNestedExtensionLite* _this = reinterpret_cast< TestNestedExtensionLite* >(object);
+  (void)_this;
+}
+void TestNestedExtensionLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestNestedExtensionLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestNestedExtensionLite& TestNestedExtensionLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestNestedExtensionLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestNestedExtensionLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestNestedExtensionLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestNestedExtensionLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestNestedExtensionLite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestNestedExtensionLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestNestedExtensionLite)
+  return target;
+}
+
+size_t TestNestedExtensionLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestNestedExtensionLite)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestNestedExtensionLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestNestedExtensionLite*>(
+      &from));
+}
+
+void TestNestedExtensionLite::MergeFrom(const TestNestedExtensionLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestNestedExtensionLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+}
+
+void TestNestedExtensionLite::CopyFrom(const TestNestedExtensionLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestNestedExtensionLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestNestedExtensionLite::IsInitialized() const {
+  return true;
+}
+
+void TestNestedExtensionLite::InternalSwap(TestNestedExtensionLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+}
+
+std::string TestNestedExtensionLite::GetTypeName() const {
+  return "protobuf_unittest.TestNestedExtensionLite";
+}
+
+
+// ===================================================================
+
+void TestDeprecatedLite::InitAsDefaultInstance() {
+  ::protobuf_unittest::_TestDeprecatedLite_default_instance_._instance.get_mutable()->deprecated_field4_ = const_cast< ::protobuf_unittest::TestDeprecatedLite*>(
+      ::protobuf_unittest::TestDeprecatedLite::internal_default_instance());
+}
+class TestDeprecatedLite::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestDeprecatedLite>()._has_bits_);
+  static void set_has_deprecated_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_deprecated_field2(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_deprecated_field3(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::protobuf_unittest::TestDeprecatedLite& deprecated_field4(const TestDeprecatedLite* msg);
+  static void set_has_deprecated_field4(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000008) ^ 0x00000008) != 0;
+  }
+};
+
+const ::protobuf_unittest::TestDeprecatedLite&
+TestDeprecatedLite::_Internal::deprecated_field4(const TestDeprecatedLite* msg) {
+  return *msg->deprecated_field4_;
+}
+TestDeprecatedLite::TestDeprecatedLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestDeprecatedLite)
+}
+TestDeprecatedLite::TestDeprecatedLite(const TestDeprecatedLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  deprecated_field3_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from._internal_has_deprecated_field3()) {
+    deprecated_field3_.SetLite(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_deprecated_field3(),
+      GetArena());
+  }
+  if (from._internal_has_deprecated_field4()) {
+    deprecated_field4_ = new ::protobuf_unittest::TestDeprecatedLite(*from.deprecated_field4_);
+  } else {
+    deprecated_field4_ = nullptr;
+  }
+  ::memcpy(&deprecated_field_, &from.deprecated_field_,
+    static_cast<size_t>(reinterpret_cast<char*>(&deprecated_field2_) -
+    reinterpret_cast<char*>(&deprecated_field_)) + sizeof(deprecated_field2_));
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestDeprecatedLite)
+}
+
+void TestDeprecatedLite::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestDeprecatedLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  deprecated_field3_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&deprecated_field4_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&deprecated_field2_) -
+      reinterpret_cast<char*>(&deprecated_field4_)) + sizeof(deprecated_field2_));
+}
+
+TestDeprecatedLite::~TestDeprecatedLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestDeprecatedLite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestDeprecatedLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  deprecated_field3_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete deprecated_field4_;
+}
+
+void TestDeprecatedLite::ArenaDtor(void* object) {
+  TestDeprecatedLite* _this = reinterpret_cast< TestDeprecatedLite* >(object);
+  (void)_this;
+}
+void TestDeprecatedLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestDeprecatedLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestDeprecatedLite& TestDeprecatedLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestDeprecatedLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestDeprecatedLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestDeprecatedLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      deprecated_field3_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(deprecated_field4_ != nullptr);
+      deprecated_field4_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&deprecated_field_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&deprecated_field2_) -
+        reinterpret_cast<char*>(&deprecated_field_)) + sizeof(deprecated_field2_));
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestDeprecatedLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional int32 deprecated_field = 1 [deprecated = true];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          _Internal::set_has_deprecated_field(&has_bits);
+          deprecated_field_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // required int32 deprecated_field2 = 2 [deprecated = true];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          _Internal::set_has_deprecated_field2(&has_bits);
+          deprecated_field2_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional string deprecated_field3 = 3 [deprecated = true];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          _Internal::set_has_deprecated_field3(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&deprecated_field3_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest.TestDeprecatedLite deprecated_field4 = 4 [deprecated = true];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_deprecated_field4(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestDeprecatedLite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestDeprecatedLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 deprecated_field = 1 [deprecated = true];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_deprecated_field(), target);
+  }
+
+  // required int32 deprecated_field2 = 2 [deprecated = true];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_deprecated_field2(), target);
+  }
+
+  // optional string deprecated_field3 = 3 [deprecated = true];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_deprecated_field3(), target);
+  }
+
+  // optional .protobuf_unittest.TestDeprecatedLite deprecated_field4 = 4 [deprecated = true];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::deprecated_field4(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestDeprecatedLite)
+  return target;
+}
+
+size_t TestDeprecatedLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestDeprecatedLite)
+  size_t total_size = 0;
+
+  // required int32 deprecated_field2 = 2 [deprecated = true];
+  if (_internal_has_deprecated_field2()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_deprecated_field2());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string deprecated_field3 = 3 [deprecated = true];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_deprecated_field3());
+    }
+
+    // optional .protobuf_unittest.TestDeprecatedLite deprecated_field4 = 4 [deprecated = true];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *deprecated_field4_);
+    }
+
+    // optional int32 deprecated_field = 1 [deprecated = true];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_deprecated_field());
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestDeprecatedLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestDeprecatedLite*>(
+      &from));
+}
+
+void TestDeprecatedLite::MergeFrom(const TestDeprecatedLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestDeprecatedLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _internal_set_deprecated_field3(from._internal_deprecated_field3());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _internal_mutable_deprecated_field4()->::protobuf_unittest::TestDeprecatedLite::MergeFrom(from._internal_deprecated_field4());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      deprecated_field_ = from.deprecated_field_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      deprecated_field2_ = from.deprecated_field2_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void TestDeprecatedLite::CopyFrom(const TestDeprecatedLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestDeprecatedLite)
+  if (&from == this) return;
+  Clear();
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  if (from._internal_has_deprecated_field3()) {
+    _internal_set_deprecated_field3(from._internal_deprecated_field3());
+  }
+  if (from._internal_has_deprecated_field4()) {
+    _internal_mutable_deprecated_field4()->::protobuf_unittest::TestDeprecatedLite::MergeFrom(from._internal_deprecated_field4());
+  }
+  ::memcpy(&deprecated_field_, &from.deprecated_field_,
+    static_cast<size_t>(reinterpret_cast<char*>(&deprecated_field2_) -
+    reinterpret_cast<char*>(&deprecated_field_)) + sizeof(deprecated_field2_));
+}
+
+bool TestDeprecatedLite::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+  if (_internal_has_deprecated_field4()) {
+    if (!deprecated_field4_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void TestDeprecatedLite::InternalSwap(TestDeprecatedLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  deprecated_field3_.Swap(&other->deprecated_field3_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestDeprecatedLite, deprecated_field2_)
+      + sizeof(TestDeprecatedLite::deprecated_field2_)
+      - PROTOBUF_FIELD_OFFSET(TestDeprecatedLite, deprecated_field4_)>(
+          reinterpret_cast<char*>(&deprecated_field4_),
+          reinterpret_cast<char*>(&other->deprecated_field4_));
+}
+
+std::string TestDeprecatedLite::GetTypeName() const {
+  return "protobuf_unittest.TestDeprecatedLite";
+}
+
+
+// ===================================================================
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group1::InitAsDefaultInstance() {
+  ::protobuf_unittest::_TestParsingMergeLite_RepeatedFieldsGenerator_Group1_default_instance_._instance.get_mutable()->field1_ = const_cast< ::protobuf_unittest::TestAllTypesLite*>(
+      ::protobuf_unittest::TestAllTypesLite::internal_default_instance());
+}
+class TestParsingMergeLite_RepeatedFieldsGenerator_Group1::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestParsingMergeLite_RepeatedFieldsGenerator_Group1>()._has_bits_);
+  static const ::protobuf_unittest::TestAllTypesLite& field1(const TestParsingMergeLite_RepeatedFieldsGenerator_Group1* msg);
+  static void set_has_field1(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::TestAllTypesLite&
+TestParsingMergeLite_RepeatedFieldsGenerator_Group1::_Internal::field1(const TestParsingMergeLite_RepeatedFieldsGenerator_Group1* msg) {
+  return *msg->field1_;
+}
+TestParsingMergeLite_RepeatedFieldsGenerator_Group1::TestParsingMergeLite_RepeatedFieldsGenerator_Group1(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1)
+}
+TestParsingMergeLite_RepeatedFieldsGenerator_Group1::TestParsingMergeLite_RepeatedFieldsGenerator_Group1(const TestParsingMergeLite_RepeatedFieldsGenerator_Group1& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_field1()) {
+    field1_ = new ::protobuf_unittest::TestAllTypesLite(*from.field1_);
+  } else {
+    field1_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1)
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group1::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestParsingMergeLite_RepeatedFieldsGenerator_Group1_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  field1_ = nullptr;
+}
+
+TestParsingMergeLite_RepeatedFieldsGenerator_Group1::~TestParsingMergeLite_RepeatedFieldsGenerator_Group1() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group1::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete field1_;
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group1::ArenaDtor(void* object) {
+  TestParsingMergeLite_RepeatedFieldsGenerator_Group1* _this = reinterpret_cast< TestParsingMergeLite_RepeatedFieldsGenerator_Group1* >(object);
+  (void)_this;
+}
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group1::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group1::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestParsingMergeLite_RepeatedFieldsGenerator_Group1& TestParsingMergeLite_RepeatedFieldsGenerator_Group1::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestParsingMergeLite_RepeatedFieldsGenerator_Group1_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group1::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(field1_ != nullptr);
+    field1_->Clear();
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestParsingMergeLite_RepeatedFieldsGenerator_Group1::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional .protobuf_unittest.TestAllTypesLite field1 = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_field1(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestParsingMergeLite_RepeatedFieldsGenerator_Group1::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .protobuf_unittest.TestAllTypesLite field1 = 11;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        11, _Internal::field1(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1)
+  return target;
+}
+
+size_t TestParsingMergeLite_RepeatedFieldsGenerator_Group1::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .protobuf_unittest.TestAllTypesLite field1 = 11;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *field1_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group1::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestParsingMergeLite_RepeatedFieldsGenerator_Group1*>(
+      &from));
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group1::MergeFrom(const TestParsingMergeLite_RepeatedFieldsGenerator_Group1& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_field1()) {
+    _internal_mutable_field1()->::protobuf_unittest::TestAllTypesLite::MergeFrom(from._internal_field1());
+  }
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group1::CopyFrom(const TestParsingMergeLite_RepeatedFieldsGenerator_Group1& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestParsingMergeLite_RepeatedFieldsGenerator_Group1::IsInitialized() const {
+  return true;
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group1::InternalSwap(TestParsingMergeLite_RepeatedFieldsGenerator_Group1* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(field1_, other->field1_);
+}
+
+std::string TestParsingMergeLite_RepeatedFieldsGenerator_Group1::GetTypeName() const {
+  return "protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group1";
+}
+
+
+// ===================================================================
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group2::InitAsDefaultInstance() {
+  ::protobuf_unittest::_TestParsingMergeLite_RepeatedFieldsGenerator_Group2_default_instance_._instance.get_mutable()->field1_ = const_cast< ::protobuf_unittest::TestAllTypesLite*>(
+      ::protobuf_unittest::TestAllTypesLite::internal_default_instance());
+}
+class TestParsingMergeLite_RepeatedFieldsGenerator_Group2::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestParsingMergeLite_RepeatedFieldsGenerator_Group2>()._has_bits_);
+  static const ::protobuf_unittest::TestAllTypesLite& field1(const TestParsingMergeLite_RepeatedFieldsGenerator_Group2* msg);
+  static void set_has_field1(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::TestAllTypesLite&
+TestParsingMergeLite_RepeatedFieldsGenerator_Group2::_Internal::field1(const TestParsingMergeLite_RepeatedFieldsGenerator_Group2* msg) {
+  return *msg->field1_;
+}
+TestParsingMergeLite_RepeatedFieldsGenerator_Group2::TestParsingMergeLite_RepeatedFieldsGenerator_Group2(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2)
+}
+TestParsingMergeLite_RepeatedFieldsGenerator_Group2::TestParsingMergeLite_RepeatedFieldsGenerator_Group2(const TestParsingMergeLite_RepeatedFieldsGenerator_Group2& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_field1()) {
+    field1_ = new ::protobuf_unittest::TestAllTypesLite(*from.field1_);
+  } else {
+    field1_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2)
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group2::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestParsingMergeLite_RepeatedFieldsGenerator_Group2_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  field1_ = nullptr;
+}
+
+TestParsingMergeLite_RepeatedFieldsGenerator_Group2::~TestParsingMergeLite_RepeatedFieldsGenerator_Group2() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group2::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete field1_;
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group2::ArenaDtor(void* object) {
+  TestParsingMergeLite_RepeatedFieldsGenerator_Group2* _this = reinterpret_cast< TestParsingMergeLite_RepeatedFieldsGenerator_Group2* >(object);
+  (void)_this;
+}
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group2::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group2::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestParsingMergeLite_RepeatedFieldsGenerator_Group2& TestParsingMergeLite_RepeatedFieldsGenerator_Group2::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestParsingMergeLite_RepeatedFieldsGenerator_Group2_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group2::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(field1_ != nullptr);
+    field1_->Clear();
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestParsingMergeLite_RepeatedFieldsGenerator_Group2::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional .protobuf_unittest.TestAllTypesLite field1 = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 170)) {
+          ptr = ctx->ParseMessage(_internal_mutable_field1(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestParsingMergeLite_RepeatedFieldsGenerator_Group2::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .protobuf_unittest.TestAllTypesLite field1 = 21;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        21, _Internal::field1(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2)
+  return target;
+}
+
+size_t TestParsingMergeLite_RepeatedFieldsGenerator_Group2::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .protobuf_unittest.TestAllTypesLite field1 = 21;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *field1_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group2::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestParsingMergeLite_RepeatedFieldsGenerator_Group2*>(
+      &from));
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group2::MergeFrom(const TestParsingMergeLite_RepeatedFieldsGenerator_Group2& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_field1()) {
+    _internal_mutable_field1()->::protobuf_unittest::TestAllTypesLite::MergeFrom(from._internal_field1());
+  }
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group2::CopyFrom(const TestParsingMergeLite_RepeatedFieldsGenerator_Group2& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestParsingMergeLite_RepeatedFieldsGenerator_Group2::IsInitialized() const {
+  return true;
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator_Group2::InternalSwap(TestParsingMergeLite_RepeatedFieldsGenerator_Group2* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(field1_, other->field1_);
+}
+
+std::string TestParsingMergeLite_RepeatedFieldsGenerator_Group2::GetTypeName() const {
+  return "protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator.Group2";
+}
+
+
+// ===================================================================
+
+void TestParsingMergeLite_RepeatedFieldsGenerator::InitAsDefaultInstance() {
+}
+class TestParsingMergeLite_RepeatedFieldsGenerator::_Internal {
+ public:
+};
+
+TestParsingMergeLite_RepeatedFieldsGenerator::TestParsingMergeLite_RepeatedFieldsGenerator(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena),
+  field1_(arena),
+  field2_(arena),
+  field3_(arena),
+  group1_(arena),
+  group2_(arena),
+  ext1_(arena),
+  ext2_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator)
+}
+TestParsingMergeLite_RepeatedFieldsGenerator::TestParsingMergeLite_RepeatedFieldsGenerator(const TestParsingMergeLite_RepeatedFieldsGenerator& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      field1_(from.field1_),
+      field2_(from.field2_),
+      field3_(from.field3_),
+      group1_(from.group1_),
+      group2_(from.group2_),
+      ext1_(from.ext1_),
+      ext2_(from.ext2_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator)
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestParsingMergeLite_RepeatedFieldsGenerator_google_2fprotobuf_2funittest_5flite_2eproto.base);
+}
+
+TestParsingMergeLite_RepeatedFieldsGenerator::~TestParsingMergeLite_RepeatedFieldsGenerator() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator::ArenaDtor(void* object) {
+  TestParsingMergeLite_RepeatedFieldsGenerator* _this = reinterpret_cast< TestParsingMergeLite_RepeatedFieldsGenerator* >(object);
+  (void)_this;
+}
+void TestParsingMergeLite_RepeatedFieldsGenerator::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestParsingMergeLite_RepeatedFieldsGenerator::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestParsingMergeLite_RepeatedFieldsGenerator& TestParsingMergeLite_RepeatedFieldsGenerator::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestParsingMergeLite_RepeatedFieldsGenerator_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestParsingMergeLite_RepeatedFieldsGenerator::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  field1_.Clear();
+  field2_.Clear();
+  field3_.Clear();
+  group1_.Clear();
+  group2_.Clear();
+  ext1_.Clear();
+  ext2_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestParsingMergeLite_RepeatedFieldsGenerator::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated .protobuf_unittest.TestAllTypesLite field1 = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          field1_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<10>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_field1(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .protobuf_unittest.TestAllTypesLite field2 = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          field2_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<18>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_field2(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .protobuf_unittest.TestAllTypesLite field3 = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr -= 1;
+          field3_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<26>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_field3(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated group Group1 = 10 { ... };
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 83)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseGroup(_internal_add_group1(), ptr, 83);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<83>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated group Group2 = 20 { ... };
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 163)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseGroup(_internal_add_group2(), ptr, 163);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<163>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .protobuf_unittest.TestAllTypesLite ext1 = 1000;
+      case 1000:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          ptr -= 2;
+          ext1_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<8002>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_ext1(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<8002>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .protobuf_unittest.TestAllTypesLite ext2 = 1001;
+      case 1001:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          ptr -= 2;
+          ext2_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<8010>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_ext2(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<8010>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestParsingMergeLite_RepeatedFieldsGenerator::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .protobuf_unittest.TestAllTypesLite field1 = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_field1_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, this->_internal_field1(i), target, stream);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypesLite field2 = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_field2_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_field2(i), target, stream);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypesLite field3 = 3;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_field3_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, this->_internal_field3(i), target, stream);
+  }
+
+  // repeated group Group1 = 10 { ... };
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_group1_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(10, this->_internal_group1(i), target, stream);
+  }
+
+  // repeated group Group2 = 20 { ... };
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_group2_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(20, this->_internal_group2(i), target, stream);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypesLite ext1 = 1000;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_ext1_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1000, this->_internal_ext1(i), target, stream);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypesLite ext2 = 1001;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_ext2_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1001, this->_internal_ext2(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator)
+  return target;
+}
+
+size_t TestParsingMergeLite_RepeatedFieldsGenerator::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .protobuf_unittest.TestAllTypesLite field1 = 1;
+  total_size += 1UL * this->_internal_field1_size();
+  for (const auto& msg : this->field1_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypesLite field2 = 2;
+  total_size += 1UL * this->_internal_field2_size();
+  for (const auto& msg : this->field2_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypesLite field3 = 3;
+  total_size += 1UL * this->_internal_field3_size();
+  for (const auto& msg : this->field3_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated group Group1 = 10 { ... };
+  total_size += 2UL * this->_internal_group1_size();
+  for (const auto& msg : this->group1_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(msg);
+  }
+
+  // repeated group Group2 = 20 { ... };
+  total_size += 4UL * this->_internal_group2_size();
+  for (const auto& msg : this->group2_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(msg);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypesLite ext1 = 1000;
+  total_size += 2UL * this->_internal_ext1_size();
+  for (const auto& msg : this->ext1_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypesLite ext2 = 1001;
+  total_size += 2UL * this->_internal_ext2_size();
+  for (const auto& msg : this->ext2_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestParsingMergeLite_RepeatedFieldsGenerator*>(
+      &from));
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator::MergeFrom(const TestParsingMergeLite_RepeatedFieldsGenerator& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  field1_.MergeFrom(from.field1_);
+  field2_.MergeFrom(from.field2_);
+  field3_.MergeFrom(from.field3_);
+  group1_.MergeFrom(from.group1_);
+  group2_.MergeFrom(from.group2_);
+  ext1_.MergeFrom(from.ext1_);
+  ext2_.MergeFrom(from.ext2_);
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator::CopyFrom(const TestParsingMergeLite_RepeatedFieldsGenerator& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestParsingMergeLite_RepeatedFieldsGenerator::IsInitialized() const {
+  return true;
+}
+
+void TestParsingMergeLite_RepeatedFieldsGenerator::InternalSwap(TestParsingMergeLite_RepeatedFieldsGenerator* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  field1_.InternalSwap(&other->field1_);
+  field2_.InternalSwap(&other->field2_);
+  field3_.InternalSwap(&other->field3_);
+  group1_.InternalSwap(&other->group1_);
+  group2_.InternalSwap(&other->group2_);
+  ext1_.InternalSwap(&other->ext1_);
+  ext2_.InternalSwap(&other->ext2_);
+}
+
+std::string TestParsingMergeLite_RepeatedFieldsGenerator::GetTypeName() const {
+  return "protobuf_unittest.TestParsingMergeLite.RepeatedFieldsGenerator";
+}
+
+
+// ===================================================================
+
+void TestParsingMergeLite_OptionalGroup::InitAsDefaultInstance() {
+  ::protobuf_unittest::_TestParsingMergeLite_OptionalGroup_default_instance_._instance.get_mutable()->optional_group_all_types_ = const_cast< ::protobuf_unittest::TestAllTypesLite*>(
+      ::protobuf_unittest::TestAllTypesLite::internal_default_instance());
+}
+class TestParsingMergeLite_OptionalGroup::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestParsingMergeLite_OptionalGroup>()._has_bits_);
+  static const ::protobuf_unittest::TestAllTypesLite& optional_group_all_types(const TestParsingMergeLite_OptionalGroup* msg);
+  static void set_has_optional_group_all_types(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::TestAllTypesLite&
+TestParsingMergeLite_OptionalGroup::_Internal::optional_group_all_types(const TestParsingMergeLite_OptionalGroup* msg) {
+  return *msg->optional_group_all_types_;
+}
+TestParsingMergeLite_OptionalGroup::TestParsingMergeLite_OptionalGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestParsingMergeLite.OptionalGroup)
+}
+TestParsingMergeLite_OptionalGroup::TestParsingMergeLite_OptionalGroup(const TestParsingMergeLite_OptionalGroup& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_optional_group_all_types()) {
+    optional_group_all_types_ = new ::protobuf_unittest::TestAllTypesLite(*from.optional_group_all_types_);
+  } else {
+    optional_group_all_types_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestParsingMergeLite.OptionalGroup)
+}
+
+void TestParsingMergeLite_OptionalGroup::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestParsingMergeLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  optional_group_all_types_ = nullptr;
+}
+
+TestParsingMergeLite_OptionalGroup::~TestParsingMergeLite_OptionalGroup() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestParsingMergeLite.OptionalGroup)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestParsingMergeLite_OptionalGroup::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete optional_group_all_types_;
+}
+
+void TestParsingMergeLite_OptionalGroup::ArenaDtor(void* object) {
+  TestParsingMergeLite_OptionalGroup* _this = reinterpret_cast< TestParsingMergeLite_OptionalGroup* >(object);
+  (void)_this;
+}
+void TestParsingMergeLite_OptionalGroup::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestParsingMergeLite_OptionalGroup::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestParsingMergeLite_OptionalGroup& TestParsingMergeLite_OptionalGroup::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestParsingMergeLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestParsingMergeLite_OptionalGroup::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestParsingMergeLite.OptionalGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(optional_group_all_types_ != nullptr);
+    optional_group_all_types_->Clear();
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestParsingMergeLite_OptionalGroup::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional .protobuf_unittest.TestAllTypesLite optional_group_all_types = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_optional_group_all_types(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestParsingMergeLite_OptionalGroup::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestParsingMergeLite.OptionalGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .protobuf_unittest.TestAllTypesLite optional_group_all_types = 11;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        11, _Internal::optional_group_all_types(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestParsingMergeLite.OptionalGroup)
+  return target;
+}
+
+size_t TestParsingMergeLite_OptionalGroup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestParsingMergeLite.OptionalGroup)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .protobuf_unittest.TestAllTypesLite optional_group_all_types = 11;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *optional_group_all_types_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestParsingMergeLite_OptionalGroup::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestParsingMergeLite_OptionalGroup*>(
+      &from));
+}
+
+void TestParsingMergeLite_OptionalGroup::MergeFrom(const TestParsingMergeLite_OptionalGroup& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestParsingMergeLite.OptionalGroup)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_optional_group_all_types()) {
+    _internal_mutable_optional_group_all_types()->::protobuf_unittest::TestAllTypesLite::MergeFrom(from._internal_optional_group_all_types());
+  }
+}
+
+void TestParsingMergeLite_OptionalGroup::CopyFrom(const TestParsingMergeLite_OptionalGroup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestParsingMergeLite.OptionalGroup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestParsingMergeLite_OptionalGroup::IsInitialized() const {
+  return true;
+}
+
+void TestParsingMergeLite_OptionalGroup::InternalSwap(TestParsingMergeLite_OptionalGroup* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(optional_group_all_types_, other->optional_group_all_types_);
+}
+
+std::string TestParsingMergeLite_OptionalGroup::GetTypeName() const {
+  return "protobuf_unittest.TestParsingMergeLite.OptionalGroup";
+}
+
+
+// ===================================================================
+
+void TestParsingMergeLite_RepeatedGroup::InitAsDefaultInstance() {
+  ::protobuf_unittest::_TestParsingMergeLite_RepeatedGroup_default_instance_._instance.get_mutable()->repeated_group_all_types_ = const_cast< ::protobuf_unittest::TestAllTypesLite*>(
+      ::protobuf_unittest::TestAllTypesLite::internal_default_instance());
+}
+class TestParsingMergeLite_RepeatedGroup::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestParsingMergeLite_RepeatedGroup>()._has_bits_);
+  static const ::protobuf_unittest::TestAllTypesLite& repeated_group_all_types(const TestParsingMergeLite_RepeatedGroup* msg);
+  static void set_has_repeated_group_all_types(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::TestAllTypesLite&
+TestParsingMergeLite_RepeatedGroup::_Internal::repeated_group_all_types(const TestParsingMergeLite_RepeatedGroup* msg) {
+  return *msg->repeated_group_all_types_;
+}
+TestParsingMergeLite_RepeatedGroup::TestParsingMergeLite_RepeatedGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestParsingMergeLite.RepeatedGroup)
+}
+TestParsingMergeLite_RepeatedGroup::TestParsingMergeLite_RepeatedGroup(const TestParsingMergeLite_RepeatedGroup& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_repeated_group_all_types()) {
+    repeated_group_all_types_ = new ::protobuf_unittest::TestAllTypesLite(*from.repeated_group_all_types_);
+  } else {
+    repeated_group_all_types_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestParsingMergeLite.RepeatedGroup)
+}
+
+void TestParsingMergeLite_RepeatedGroup::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestParsingMergeLite_RepeatedGroup_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  repeated_group_all_types_ = nullptr;
+}
+
+TestParsingMergeLite_RepeatedGroup::~TestParsingMergeLite_RepeatedGroup() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestParsingMergeLite.RepeatedGroup)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestParsingMergeLite_RepeatedGroup::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete repeated_group_all_types_;
+}
+
+void TestParsingMergeLite_RepeatedGroup::ArenaDtor(void* object) {
+  TestParsingMergeLite_RepeatedGroup* _this = reinterpret_cast< TestParsingMergeLite_RepeatedGroup* >(object);
+  (void)_this;
+}
+void TestParsingMergeLite_RepeatedGroup::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestParsingMergeLite_RepeatedGroup::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestParsingMergeLite_RepeatedGroup& TestParsingMergeLite_RepeatedGroup::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestParsingMergeLite_RepeatedGroup_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestParsingMergeLite_RepeatedGroup::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestParsingMergeLite.RepeatedGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(repeated_group_all_types_ != nullptr);
+    repeated_group_all_types_->Clear();
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestParsingMergeLite_RepeatedGroup::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional .protobuf_unittest.TestAllTypesLite repeated_group_all_types = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 170)) {
+          ptr = ctx->ParseMessage(_internal_mutable_repeated_group_all_types(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestParsingMergeLite_RepeatedGroup::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestParsingMergeLite.RepeatedGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .protobuf_unittest.TestAllTypesLite repeated_group_all_types = 21;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        21, _Internal::repeated_group_all_types(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestParsingMergeLite.RepeatedGroup)
+  return target;
+}
+
+size_t TestParsingMergeLite_RepeatedGroup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestParsingMergeLite.RepeatedGroup)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .protobuf_unittest.TestAllTypesLite repeated_group_all_types = 21;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *repeated_group_all_types_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestParsingMergeLite_RepeatedGroup::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestParsingMergeLite_RepeatedGroup*>(
+      &from));
+}
+
+void TestParsingMergeLite_RepeatedGroup::MergeFrom(const TestParsingMergeLite_RepeatedGroup& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestParsingMergeLite.RepeatedGroup)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_repeated_group_all_types()) {
+    _internal_mutable_repeated_group_all_types()->::protobuf_unittest::TestAllTypesLite::MergeFrom(from._internal_repeated_group_all_types());
+  }
+}
+
+void TestParsingMergeLite_RepeatedGroup::CopyFrom(const TestParsingMergeLite_RepeatedGroup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestParsingMergeLite.RepeatedGroup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestParsingMergeLite_RepeatedGroup::IsInitialized() const {
+  return true;
+}
+
+void TestParsingMergeLite_RepeatedGroup::InternalSwap(TestParsingMergeLite_RepeatedGroup* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(repeated_group_all_types_, other->repeated_group_all_types_);
+}
+
+std::string TestParsingMergeLite_RepeatedGroup::GetTypeName() const {
+  return "protobuf_unittest.TestParsingMergeLite.RepeatedGroup";
+}
+
+
+// ===================================================================
+
+void TestParsingMergeLite::InitAsDefaultInstance() {
+  ::protobuf_unittest::_TestParsingMergeLite_default_instance_._instance.get_mutable()->required_all_types_ = const_cast< ::protobuf_unittest::TestAllTypesLite*>(
+      ::protobuf_unittest::TestAllTypesLite::internal_default_instance());
+  ::protobuf_unittest::_TestParsingMergeLite_default_instance_._instance.get_mutable()->optional_all_types_ = const_cast< ::protobuf_unittest::TestAllTypesLite*>(
+      ::protobuf_unittest::TestAllTypesLite::internal_default_instance());
+  ::protobuf_unittest::_TestParsingMergeLite_default_instance_._instance.get_mutable()->optionalgroup_ = const_cast< ::protobuf_unittest::TestParsingMergeLite_OptionalGroup*>(
+      ::protobuf_unittest::TestParsingMergeLite_OptionalGroup::internal_default_instance());
+}
+class TestParsingMergeLite::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestParsingMergeLite>()._has_bits_);
+  static const ::protobuf_unittest::TestAllTypesLite& required_all_types(const TestParsingMergeLite* msg);
+  static void set_has_required_all_types(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::protobuf_unittest::TestAllTypesLite& optional_all_types(const TestParsingMergeLite* msg);
+  static void set_has_optional_all_types(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::protobuf_unittest::TestParsingMergeLite_OptionalGroup& optionalgroup(const TestParsingMergeLite* msg);
+  static void set_has_optionalgroup(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::protobuf_unittest::TestAllTypesLite&
+TestParsingMergeLite::_Internal::required_all_types(const TestParsingMergeLite* msg) {
+  return *msg->required_all_types_;
+}
+const ::protobuf_unittest::TestAllTypesLite&
+TestParsingMergeLite::_Internal::optional_all_types(const TestParsingMergeLite* msg) {
+  return *msg->optional_all_types_;
+}
+const ::protobuf_unittest::TestParsingMergeLite_OptionalGroup&
+TestParsingMergeLite::_Internal::optionalgroup(const TestParsingMergeLite* msg) {
+  return *msg->optionalgroup_;
+}
+TestParsingMergeLite::TestParsingMergeLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena),
+  _extensions_(arena),
+  repeated_all_types_(arena),
+  repeatedgroup_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestParsingMergeLite)
+}
+TestParsingMergeLite::TestParsingMergeLite(const TestParsingMergeLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_),
+      repeated_all_types_(from.repeated_all_types_),
+      repeatedgroup_(from.repeatedgroup_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _extensions_.MergeFrom(from._extensions_);
+  if (from._internal_has_required_all_types()) {
+    required_all_types_ = new ::protobuf_unittest::TestAllTypesLite(*from.required_all_types_);
+  } else {
+    required_all_types_ = nullptr;
+  }
+  if (from._internal_has_optional_all_types()) {
+    optional_all_types_ = new ::protobuf_unittest::TestAllTypesLite(*from.optional_all_types_);
+  } else {
+    optional_all_types_ = nullptr;
+  }
+  if (from._internal_has_optionalgroup()) {
+    optionalgroup_ = new ::protobuf_unittest::TestParsingMergeLite_OptionalGroup(*from.optionalgroup_);
+  } else {
+    optionalgroup_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestParsingMergeLite)
+}
+
+void TestParsingMergeLite::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestParsingMergeLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  ::memset(&required_all_types_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&optionalgroup_) -
+      reinterpret_cast<char*>(&required_all_types_)) + sizeof(optionalgroup_));
+}
+
+TestParsingMergeLite::~TestParsingMergeLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestParsingMergeLite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestParsingMergeLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete required_all_types_;
+  if (this != internal_default_instance()) delete optional_all_types_;
+  if (this != internal_default_instance()) delete optionalgroup_;
+}
+
+void TestParsingMergeLite::ArenaDtor(void* object) {
+  TestParsingMergeLite* _this = reinterpret_cast< TestParsingMergeLite* >(object);
+  (void)_this;
+}
+void TestParsingMergeLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestParsingMergeLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestParsingMergeLite& TestParsingMergeLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestParsingMergeLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestParsingMergeLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestParsingMergeLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _extensions_.Clear();
+  repeated_all_types_.Clear();
+  repeatedgroup_.Clear();
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(required_all_types_ != nullptr);
+      required_all_types_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(optional_all_types_ != nullptr);
+      optional_all_types_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(optionalgroup_ != nullptr);
+      optionalgroup_->Clear();
+    }
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestParsingMergeLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // required .protobuf_unittest.TestAllTypesLite required_all_types = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_required_all_types(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest.TestAllTypesLite optional_all_types = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_optional_all_types(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .protobuf_unittest.TestAllTypesLite repeated_all_types = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr -= 1;
+          repeated_all_types_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<26>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_repeated_all_types(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // optional group OptionalGroup = 10 { ... };
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 83)) {
+          ptr = ctx->ParseGroup(_internal_mutable_optionalgroup(), ptr, 83);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated group RepeatedGroup = 20 { ... };
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 163)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseGroup(_internal_add_repeatedgroup(), ptr, 163);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<163>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+      if ((8000u <= tag)) {
+        ptr = _extensions_.ParseField(tag, ptr,
+            internal_default_instance(), &_internal_metadata_, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestParsingMergeLite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestParsingMergeLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // required .protobuf_unittest.TestAllTypesLite required_all_types = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::required_all_types(this), target, stream);
+  }
+
+  // optional .protobuf_unittest.TestAllTypesLite optional_all_types = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::optional_all_types(this), target, stream);
+  }
+
+  // repeated .protobuf_unittest.TestAllTypesLite repeated_all_types = 3;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_all_types_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, this->_internal_repeated_all_types(i), target, stream);
+  }
+
+  // optional group OptionalGroup = 10 { ... };
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        10, _Internal::optionalgroup(this), target, stream);
+  }
+
+  // repeated group RepeatedGroup = 20 { ... };
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeatedgroup_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(20, this->_internal_repeatedgroup(i), target, stream);
+  }
+
+  // Extension range [1000, 536870912)
+  target = _extensions_._InternalSerialize(
+      1000, 536870912, target, stream);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestParsingMergeLite)
+  return target;
+}
+
+size_t TestParsingMergeLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestParsingMergeLite)
+  size_t total_size = 0;
+
+  total_size += _extensions_.ByteSize();
+
+  // required .protobuf_unittest.TestAllTypesLite required_all_types = 1;
+  if (_internal_has_required_all_types()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *required_all_types_);
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .protobuf_unittest.TestAllTypesLite repeated_all_types = 3;
+  total_size += 1UL * this->_internal_repeated_all_types_size();
+  for (const auto& msg : this->repeated_all_types_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated group RepeatedGroup = 20 { ... };
+  total_size += 4UL * this->_internal_repeatedgroup_size();
+  for (const auto& msg : this->repeatedgroup_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(msg);
+  }
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
+    // optional .protobuf_unittest.TestAllTypesLite optional_all_types = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *optional_all_types_);
+    }
+
+    // optional group OptionalGroup = 10 { ... };
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *optionalgroup_);
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestParsingMergeLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestParsingMergeLite*>(
+      &from));
+}
+
+void TestParsingMergeLite::MergeFrom(const TestParsingMergeLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestParsingMergeLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _extensions_.MergeFrom(from._extensions_);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_all_types_.MergeFrom(from.repeated_all_types_);
+  repeatedgroup_.MergeFrom(from.repeatedgroup_);
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _internal_mutable_required_all_types()->::protobuf_unittest::TestAllTypesLite::MergeFrom(from._internal_required_all_types());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _internal_mutable_optional_all_types()->::protobuf_unittest::TestAllTypesLite::MergeFrom(from._internal_optional_all_types());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _internal_mutable_optionalgroup()->::protobuf_unittest::TestParsingMergeLite_OptionalGroup::MergeFrom(from._internal_optionalgroup());
+    }
+  }
+}
+
+void TestParsingMergeLite::CopyFrom(const TestParsingMergeLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestParsingMergeLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestParsingMergeLite::IsInitialized() const {
+  if (!_extensions_.IsInitialized()) {
+    return false;
+  }
+
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+  return true;
+}
+
+void TestParsingMergeLite::InternalSwap(TestParsingMergeLite* other) {
+  using std::swap;
+  _extensions_.Swap(&other->_extensions_);
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  repeated_all_types_.InternalSwap(&other->repeated_all_types_);
+  repeatedgroup_.InternalSwap(&other->repeatedgroup_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestParsingMergeLite, optionalgroup_)
+      + sizeof(TestParsingMergeLite::optionalgroup_)
+      - PROTOBUF_FIELD_OFFSET(TestParsingMergeLite, required_all_types_)>(
+          reinterpret_cast<char*>(&required_all_types_),
+          reinterpret_cast<char*>(&other->required_all_types_));
+}
+
+std::string TestParsingMergeLite::GetTypeName() const {
+  return "protobuf_unittest.TestParsingMergeLite";
+}
+
+
+// ===================================================================
+
+void TestEmptyMessageLite::InitAsDefaultInstance() {
+}
+class TestEmptyMessageLite::_Internal {
+ public:
+};
+
+TestEmptyMessageLite::TestEmptyMessageLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestEmptyMessageLite)
+}
+TestEmptyMessageLite::TestEmptyMessageLite(const TestEmptyMessageLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestEmptyMessageLite)
+}
+
+void TestEmptyMessageLite::SharedCtor() {
+}
+
+TestEmptyMessageLite::~TestEmptyMessageLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestEmptyMessageLite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestEmptyMessageLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestEmptyMessageLite::ArenaDtor(void* object) {
+  TestEmptyMessageLite* _this = reinterpret_cast< TestEmptyMessageLite* >(object);
+  (void)_this;
+}
+void TestEmptyMessageLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestEmptyMessageLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestEmptyMessageLite& TestEmptyMessageLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestEmptyMessageLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestEmptyMessageLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestEmptyMessageLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestEmptyMessageLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestEmptyMessageLite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestEmptyMessageLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestEmptyMessageLite)
+  return target;
+}
+
+size_t TestEmptyMessageLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestEmptyMessageLite)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestEmptyMessageLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestEmptyMessageLite*>(
+      &from));
+}
+
+void TestEmptyMessageLite::MergeFrom(const TestEmptyMessageLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestEmptyMessageLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+}
+
+void TestEmptyMessageLite::CopyFrom(const TestEmptyMessageLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestEmptyMessageLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestEmptyMessageLite::IsInitialized() const {
+  return true;
+}
+
+void TestEmptyMessageLite::InternalSwap(TestEmptyMessageLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+}
+
+std::string TestEmptyMessageLite::GetTypeName() const {
+  return "protobuf_unittest.TestEmptyMessageLite";
+}
+
+
+// ===================================================================
+
+void TestEmptyMessageWithExtensionsLite::InitAsDefaultInstance() {
+}
+class TestEmptyMessageWithExtensionsLite::_Internal {
+ public:
+};
+
+TestEmptyMessageWithExtensionsLite::TestEmptyMessageWithExtensionsLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena),
+  _extensions_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestEmptyMessageWithExtensionsLite)
+}
+TestEmptyMessageWithExtensionsLite::TestEmptyMessageWithExtensionsLite(const TestEmptyMessageWithExtensionsLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _extensions_.MergeFrom(from._extensions_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestEmptyMessageWithExtensionsLite)
+}
+
+void TestEmptyMessageWithExtensionsLite::SharedCtor() {
+}
+
+TestEmptyMessageWithExtensionsLite::~TestEmptyMessageWithExtensionsLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestEmptyMessageWithExtensionsLite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestEmptyMessageWithExtensionsLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestEmptyMessageWithExtensionsLite::ArenaDtor(void* object) {
+  TestEmptyMessageWithExtensionsLite* _this = reinterpret_cast< TestEmptyMessageWithExtensionsLite* >(object);
+  (void)_this;
+}
+void TestEmptyMessageWithExtensionsLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestEmptyMessageWithExtensionsLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestEmptyMessageWithExtensionsLite& TestEmptyMessageWithExtensionsLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestEmptyMessageWithExtensionsLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestEmptyMessageWithExtensionsLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestEmptyMessageWithExtensionsLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _extensions_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestEmptyMessageWithExtensionsLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+      if ((8u <= tag)) {
+        ptr = _extensions_.ParseField(tag, ptr,
+            internal_default_instance(), &_internal_metadata_, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestEmptyMessageWithExtensionsLite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestEmptyMessageWithExtensionsLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // Extension range [1, 536870912)
+  target = _extensions_._InternalSerialize(
+      1, 536870912, target, stream);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestEmptyMessageWithExtensionsLite)
+  return target;
+}
+
+size_t TestEmptyMessageWithExtensionsLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestEmptyMessageWithExtensionsLite)
+  size_t total_size = 0;
+
+  total_size += _extensions_.ByteSize();
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestEmptyMessageWithExtensionsLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestEmptyMessageWithExtensionsLite*>(
+      &from));
+}
+
+void TestEmptyMessageWithExtensionsLite::MergeFrom(const TestEmptyMessageWithExtensionsLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestEmptyMessageWithExtensionsLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _extensions_.MergeFrom(from._extensions_);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+}
+
+void TestEmptyMessageWithExtensionsLite::CopyFrom(const TestEmptyMessageWithExtensionsLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestEmptyMessageWithExtensionsLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestEmptyMessageWithExtensionsLite::IsInitialized() const {
+  if (!_extensions_.IsInitialized()) {
+    return false;
+  }
+
+  return true;
+}
+
+void TestEmptyMessageWithExtensionsLite::InternalSwap(TestEmptyMessageWithExtensionsLite* other) {
+  using std::swap;
+  _extensions_.Swap(&other->_extensions_);
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+}
+
+std::string TestEmptyMessageWithExtensionsLite::GetTypeName() const {
+  return "protobuf_unittest.TestEmptyMessageWithExtensionsLite";
+}
+
+
+// ===================================================================
+
+void V1MessageLite::InitAsDefaultInstance() {
+}
+class V1MessageLite::_Internal {
+ public:
+  using HasBits = decltype(std::declval<V1MessageLite>()._has_bits_);
+  static void set_has_int_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_enum_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+V1MessageLite::V1MessageLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.V1MessageLite)
+}
+V1MessageLite::V1MessageLite(const V1MessageLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&int_field_, &from.int_field_,
+    static_cast<size_t>(reinterpret_cast<char*>(&enum_field_) -
+    reinterpret_cast<char*>(&int_field_)) + sizeof(enum_field_));
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.V1MessageLite)
+}
+
+void V1MessageLite::SharedCtor() {
+  int_field_ = 0;
+  enum_field_ = 1;
+}
+
+V1MessageLite::~V1MessageLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.V1MessageLite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void V1MessageLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void V1MessageLite::ArenaDtor(void* object) {
+  V1MessageLite* _this = reinterpret_cast< V1MessageLite* >(object);
+  (void)_this;
+}
+void V1MessageLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void V1MessageLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const V1MessageLite& V1MessageLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_V1MessageLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void V1MessageLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.V1MessageLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    int_field_ = 0;
+    enum_field_ = 1;
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* V1MessageLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // required int32 int_field = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          _Internal::set_has_int_field(&has_bits);
+          int_field_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest.V1EnumLite enum_field = 2 [default = V1_FIRST];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::protobuf_unittest::V1EnumLite_IsValid(val))) {
+            _internal_set_enum_field(static_cast<::protobuf_unittest::V1EnumLite>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* V1MessageLite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.V1MessageLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // required int32 int_field = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_int_field(), target);
+  }
+
+  // optional .protobuf_unittest.V1EnumLite enum_field = 2 [default = V1_FIRST];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_enum_field(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.V1MessageLite)
+  return target;
+}
+
+size_t V1MessageLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.V1MessageLite)
+  size_t total_size = 0;
+
+  // required int32 int_field = 1;
+  if (_internal_has_int_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_int_field());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .protobuf_unittest.V1EnumLite enum_field = 2 [default = V1_FIRST];
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_enum_field());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void V1MessageLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const V1MessageLite*>(
+      &from));
+}
+
+void V1MessageLite::MergeFrom(const V1MessageLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.V1MessageLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      int_field_ = from.int_field_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      enum_field_ = from.enum_field_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void V1MessageLite::CopyFrom(const V1MessageLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.V1MessageLite)
+  if (&from == this) return;
+  Clear();
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  ::memcpy(&int_field_, &from.int_field_,
+    static_cast<size_t>(reinterpret_cast<char*>(&enum_field_) -
+    reinterpret_cast<char*>(&int_field_)) + sizeof(enum_field_));
+}
+
+bool V1MessageLite::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+  return true;
+}
+
+void V1MessageLite::InternalSwap(V1MessageLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(int_field_, other->int_field_);
+  swap(enum_field_, other->enum_field_);
+}
+
+std::string V1MessageLite::GetTypeName() const {
+  return "protobuf_unittest.V1MessageLite";
+}
+
+
+// ===================================================================
+
+void V2MessageLite::InitAsDefaultInstance() {
+}
+class V2MessageLite::_Internal {
+ public:
+  using HasBits = decltype(std::declval<V2MessageLite>()._has_bits_);
+  static void set_has_int_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_enum_field(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+V2MessageLite::V2MessageLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.V2MessageLite)
+}
+V2MessageLite::V2MessageLite(const V2MessageLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&int_field_, &from.int_field_,
+    static_cast<size_t>(reinterpret_cast<char*>(&enum_field_) -
+    reinterpret_cast<char*>(&int_field_)) + sizeof(enum_field_));
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.V2MessageLite)
+}
+
+void V2MessageLite::SharedCtor() {
+  int_field_ = 0;
+  enum_field_ = 1;
+}
+
+V2MessageLite::~V2MessageLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.V2MessageLite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void V2MessageLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void V2MessageLite::ArenaDtor(void* object) {
+  V2MessageLite* _this = reinterpret_cast< V2MessageLite* >(object);
+  (void)_this;
+}
+void V2MessageLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void V2MessageLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const V2MessageLite& V2MessageLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_V2MessageLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void V2MessageLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.V2MessageLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    int_field_ = 0;
+    enum_field_ = 1;
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* V2MessageLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // required int32 int_field = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          _Internal::set_has_int_field(&has_bits);
+          int_field_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest.V2EnumLite enum_field = 2 [default = V2_FIRST];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::protobuf_unittest::V2EnumLite_IsValid(val))) {
+            _internal_set_enum_field(static_cast<::protobuf_unittest::V2EnumLite>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* V2MessageLite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.V2MessageLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // required int32 int_field = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_int_field(), target);
+  }
+
+  // optional .protobuf_unittest.V2EnumLite enum_field = 2 [default = V2_FIRST];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_enum_field(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.V2MessageLite)
+  return target;
+}
+
+size_t V2MessageLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.V2MessageLite)
+  size_t total_size = 0;
+
+  // required int32 int_field = 1;
+  if (_internal_has_int_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_int_field());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .protobuf_unittest.V2EnumLite enum_field = 2 [default = V2_FIRST];
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_enum_field());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void V2MessageLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const V2MessageLite*>(
+      &from));
+}
+
+void V2MessageLite::MergeFrom(const V2MessageLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.V2MessageLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      int_field_ = from.int_field_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      enum_field_ = from.enum_field_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void V2MessageLite::CopyFrom(const V2MessageLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.V2MessageLite)
+  if (&from == this) return;
+  Clear();
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  ::memcpy(&int_field_, &from.int_field_,
+    static_cast<size_t>(reinterpret_cast<char*>(&enum_field_) -
+    reinterpret_cast<char*>(&int_field_)) + sizeof(enum_field_));
+}
+
+bool V2MessageLite::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+  return true;
+}
+
+void V2MessageLite::InternalSwap(V2MessageLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(int_field_, other->int_field_);
+  swap(enum_field_, other->enum_field_);
+}
+
+std::string V2MessageLite::GetTypeName() const {
+  return "protobuf_unittest.V2MessageLite";
+}
+
+
+// ===================================================================
+
+void TestHugeFieldNumbersLite_OptionalGroup::InitAsDefaultInstance() {
+}
+class TestHugeFieldNumbersLite_OptionalGroup::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestHugeFieldNumbersLite_OptionalGroup>()._has_bits_);
+  static void set_has_group_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TestHugeFieldNumbersLite_OptionalGroup::TestHugeFieldNumbersLite_OptionalGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestHugeFieldNumbersLite.OptionalGroup)
+}
+TestHugeFieldNumbersLite_OptionalGroup::TestHugeFieldNumbersLite_OptionalGroup(const TestHugeFieldNumbersLite_OptionalGroup& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  group_a_ = from.group_a_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestHugeFieldNumbersLite.OptionalGroup)
+}
+
+void TestHugeFieldNumbersLite_OptionalGroup::SharedCtor() {
+  group_a_ = 0;
+}
+
+TestHugeFieldNumbersLite_OptionalGroup::~TestHugeFieldNumbersLite_OptionalGroup() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestHugeFieldNumbersLite.OptionalGroup)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestHugeFieldNumbersLite_OptionalGroup::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestHugeFieldNumbersLite_OptionalGroup::ArenaDtor(void* object) {
+  TestHugeFieldNumbersLite_OptionalGroup* _this = reinterpret_cast< TestHugeFieldNumbersLite_OptionalGroup* >(object);
+  (void)_this;
+}
+void TestHugeFieldNumbersLite_OptionalGroup::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestHugeFieldNumbersLite_OptionalGroup::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestHugeFieldNumbersLite_OptionalGroup& TestHugeFieldNumbersLite_OptionalGroup::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestHugeFieldNumbersLite_OptionalGroup_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestHugeFieldNumbersLite_OptionalGroup::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestHugeFieldNumbersLite.OptionalGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  group_a_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestHugeFieldNumbersLite_OptionalGroup::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional int32 group_a = 536870009;
+      case 536870009:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 200)) {
+          _Internal::set_has_group_a(&has_bits);
+          group_a_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestHugeFieldNumbersLite_OptionalGroup::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestHugeFieldNumbersLite.OptionalGroup)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 group_a = 536870009;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(536870009, this->_internal_group_a(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestHugeFieldNumbersLite.OptionalGroup)
+  return target;
+}
+
+size_t TestHugeFieldNumbersLite_OptionalGroup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestHugeFieldNumbersLite.OptionalGroup)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 group_a = 536870009;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 5 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_group_a());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestHugeFieldNumbersLite_OptionalGroup::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestHugeFieldNumbersLite_OptionalGroup*>(
+      &from));
+}
+
+void TestHugeFieldNumbersLite_OptionalGroup::MergeFrom(const TestHugeFieldNumbersLite_OptionalGroup& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestHugeFieldNumbersLite.OptionalGroup)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_group_a()) {
+    _internal_set_group_a(from._internal_group_a());
+  }
+}
+
+void TestHugeFieldNumbersLite_OptionalGroup::CopyFrom(const TestHugeFieldNumbersLite_OptionalGroup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestHugeFieldNumbersLite.OptionalGroup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestHugeFieldNumbersLite_OptionalGroup::IsInitialized() const {
+  return true;
+}
+
+void TestHugeFieldNumbersLite_OptionalGroup::InternalSwap(TestHugeFieldNumbersLite_OptionalGroup* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(group_a_, other->group_a_);
+}
+
+std::string TestHugeFieldNumbersLite_OptionalGroup::GetTypeName() const {
+  return "protobuf_unittest.TestHugeFieldNumbersLite.OptionalGroup";
+}
+
+
+// ===================================================================
+
+TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse::TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse() {}
+TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse::TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse::MergeFrom(const TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+
+// ===================================================================
+
+void TestHugeFieldNumbersLite::InitAsDefaultInstance() {
+  ::protobuf_unittest::_TestHugeFieldNumbersLite_default_instance_._instance.get_mutable()->optional_message_ = const_cast< ::protobuf_unittest::ForeignMessageLite*>(
+      ::protobuf_unittest::ForeignMessageLite::internal_default_instance());
+  ::protobuf_unittest::_TestHugeFieldNumbersLite_default_instance_._instance.get_mutable()->optionalgroup_ = const_cast< ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup*>(
+      ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup::internal_default_instance());
+}
+class TestHugeFieldNumbersLite::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestHugeFieldNumbersLite>()._has_bits_);
+  static void set_has_optional_int32(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_fixed_32(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_optional_enum(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_optional_string(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_optional_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::protobuf_unittest::ForeignMessageLite& optional_message(const TestHugeFieldNumbersLite* msg);
+  static void set_has_optional_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup& optionalgroup(const TestHugeFieldNumbersLite* msg);
+  static void set_has_optionalgroup(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::protobuf_unittest::TestAllTypesLite& oneof_test_all_types(const TestHugeFieldNumbersLite* msg);
+};
+
+const ::protobuf_unittest::ForeignMessageLite&
+TestHugeFieldNumbersLite::_Internal::optional_message(const TestHugeFieldNumbersLite* msg) {
+  return *msg->optional_message_;
+}
+const ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup&
+TestHugeFieldNumbersLite::_Internal::optionalgroup(const TestHugeFieldNumbersLite* msg) {
+  return *msg->optionalgroup_;
+}
+const ::protobuf_unittest::TestAllTypesLite&
+TestHugeFieldNumbersLite::_Internal::oneof_test_all_types(const TestHugeFieldNumbersLite* msg) {
+  return *msg->oneof_field_.oneof_test_all_types_;
+}
+void TestHugeFieldNumbersLite::set_allocated_oneof_test_all_types(::protobuf_unittest::TestAllTypesLite* oneof_test_all_types) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (oneof_test_all_types) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(oneof_test_all_types);
+    if (message_arena != submessage_arena) {
+      oneof_test_all_types = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, oneof_test_all_types, submessage_arena);
+    }
+    set_has_oneof_test_all_types();
+    oneof_field_.oneof_test_all_types_ = oneof_test_all_types;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestHugeFieldNumbersLite.oneof_test_all_types)
+}
+TestHugeFieldNumbersLite::TestHugeFieldNumbersLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena),
+  _extensions_(arena),
+  repeated_int32_(arena),
+  packed_int32_(arena),
+  string_string_map_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestHugeFieldNumbersLite)
+}
+TestHugeFieldNumbersLite::TestHugeFieldNumbersLite(const TestHugeFieldNumbersLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_),
+      repeated_int32_(from.repeated_int32_),
+      packed_int32_(from.packed_int32_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _extensions_.MergeFrom(from._extensions_);
+  string_string_map_.MergeFrom(from.string_string_map_);
+  optional_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from._internal_has_optional_string()) {
+    optional_string_.SetLite(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_optional_string(),
+      GetArena());
+  }
+  optional_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from._internal_has_optional_bytes()) {
+    optional_bytes_.SetLite(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_optional_bytes(),
+      GetArena());
+  }
+  if (from._internal_has_optional_message()) {
+    optional_message_ = new ::protobuf_unittest::ForeignMessageLite(*from.optional_message_);
+  } else {
+    optional_message_ = nullptr;
+  }
+  if (from._internal_has_optionalgroup()) {
+    optionalgroup_ = new ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup(*from.optionalgroup_);
+  } else {
+    optionalgroup_ = nullptr;
+  }
+  ::memcpy(&optional_int32_, &from.optional_int32_,
+    static_cast<size_t>(reinterpret_cast<char*>(&optional_enum_) -
+    reinterpret_cast<char*>(&optional_int32_)) + sizeof(optional_enum_));
+  clear_has_oneof_field();
+  switch (from.oneof_field_case()) {
+    case kOneofUint32: {
+      _internal_set_oneof_uint32(from._internal_oneof_uint32());
+      break;
+    }
+    case kOneofTestAllTypes: {
+      _internal_mutable_oneof_test_all_types()->::protobuf_unittest::TestAllTypesLite::MergeFrom(from._internal_oneof_test_all_types());
+      break;
+    }
+    case kOneofString: {
+      _internal_set_oneof_string(from._internal_oneof_string());
+      break;
+    }
+    case kOneofBytes: {
+      _internal_set_oneof_bytes(from._internal_oneof_bytes());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestHugeFieldNumbersLite)
+}
+
+void TestHugeFieldNumbersLite::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestHugeFieldNumbersLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  optional_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&optional_message_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&fixed_32_) -
+      reinterpret_cast<char*>(&optional_message_)) + sizeof(fixed_32_));
+  optional_enum_ = 4;
+  clear_has_oneof_field();
+}
+
+TestHugeFieldNumbersLite::~TestHugeFieldNumbersLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestHugeFieldNumbersLite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestHugeFieldNumbersLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  optional_string_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  optional_bytes_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete optional_message_;
+  if (this != internal_default_instance()) delete optionalgroup_;
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+}
+
+void TestHugeFieldNumbersLite::ArenaDtor(void* object) {
+  TestHugeFieldNumbersLite* _this = reinterpret_cast< TestHugeFieldNumbersLite* >(object);
+  (void)_this;
+}
+void TestHugeFieldNumbersLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestHugeFieldNumbersLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestHugeFieldNumbersLite& TestHugeFieldNumbersLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestHugeFieldNumbersLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestHugeFieldNumbersLite::clear_oneof_field() {
+// @@protoc_insertion_point(one_of_clear_start:protobuf_unittest.TestHugeFieldNumbersLite)
+  switch (oneof_field_case()) {
+    case kOneofUint32: {
+      // No need to clear
+      break;
+    }
+    case kOneofTestAllTypes: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.oneof_test_all_types_;
+      }
+      break;
+    }
+    case kOneofString: {
+      oneof_field_.oneof_string_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+      break;
+    }
+    case kOneofBytes: {
+      oneof_field_.oneof_bytes_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+
+
+void TestHugeFieldNumbersLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestHugeFieldNumbersLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _extensions_.Clear();
+  repeated_int32_.Clear();
+  packed_int32_.Clear();
+  string_string_map_.Clear();
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      optional_string_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      optional_bytes_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(optional_message_ != nullptr);
+      optional_message_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(optionalgroup_ != nullptr);
+      optionalgroup_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000070u) {
+    ::memset(&optional_int32_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&fixed_32_) -
+        reinterpret_cast<char*>(&optional_int32_)) + sizeof(fixed_32_));
+    optional_enum_ = 4;
+  }
+  clear_oneof_field();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestHugeFieldNumbersLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional int32 optional_int32 = 536870000;
+      case 536870000:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 128)) {
+          _Internal::set_has_optional_int32(&has_bits);
+          optional_int32_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional int32 fixed_32 = 536870001;
+      case 536870001:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 136)) {
+          _Internal::set_has_fixed_32(&has_bits);
+          fixed_32_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated int32 repeated_int32 = 536870002 [packed = false];
+      case 536870002:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 144)) {
+          _internal_add_repeated_int32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 146) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_repeated_int32(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated int32 packed_int32 = 536870003 [packed = true];
+      case 536870003:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 154)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_packed_int32(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 152) {
+          _internal_add_packed_int32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest.ForeignEnumLite optional_enum = 536870004;
+      case 536870004:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 160)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::protobuf_unittest::ForeignEnumLite_IsValid(val))) {
+            _internal_set_optional_enum(static_cast<::protobuf_unittest::ForeignEnumLite>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(536870004, val, mutable_unknown_fields());
+          }
+        } else goto handle_unusual;
+        continue;
+      // optional string optional_string = 536870005;
+      case 536870005:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 170)) {
+          _Internal::set_has_optional_string(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&optional_string_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional bytes optional_bytes = 536870006;
+      case 536870006:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 178)) {
+          _Internal::set_has_optional_bytes(&has_bits);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&optional_bytes_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional .protobuf_unittest.ForeignMessageLite optional_message = 536870007;
+      case 536870007:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 186)) {
+          ptr = ctx->ParseMessage(_internal_mutable_optional_message(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group OptionalGroup = 536870008 { ... };
+      case 536870008:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 195)) {
+          ptr = ctx->ParseGroup(_internal_mutable_optionalgroup(), ptr, 4294960067);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // map<string, string> string_string_map = 536870010;
+      case 536870010:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 210)) {
+          ptr = ctx->ParseMessage(&string_string_map_, ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 oneof_uint32 = 536870011;
+      case 536870011:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 216)) {
+          _internal_set_oneof_uint32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .protobuf_unittest.TestAllTypesLite oneof_test_all_types = 536870012;
+      case 536870012:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 226)) {
+          ptr = ctx->ParseMessage(_internal_mutable_oneof_test_all_types(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string oneof_string = 536870013;
+      case 536870013:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 234)) {
+          auto str = _internal_mutable_oneof_string();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes oneof_bytes = 536870014;
+      case 536870014:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 242)) {
+          auto str = _internal_mutable_oneof_bytes();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+      if ((4294880000u <= tag && tag < 4294960000u)) {
+        ptr = _extensions_.ParseField(tag, ptr,
+            internal_default_instance(), &_internal_metadata_, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestHugeFieldNumbersLite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestHugeFieldNumbersLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // Extension range [536860000, 536870000)
+  target = _extensions_._InternalSerialize(
+      536860000, 536870000, target, stream);
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 optional_int32 = 536870000;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(536870000, this->_internal_optional_int32(), target);
+  }
+
+  // optional int32 fixed_32 = 536870001;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(536870001, this->_internal_fixed_32(), target);
+  }
+
+  // repeated int32 repeated_int32 = 536870002 [packed = false];
+  for (int i = 0, n = this->_internal_repeated_int32_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(536870002, this->_internal_repeated_int32(i), target);
+  }
+
+  // repeated int32 packed_int32 = 536870003 [packed = true];
+  {
+    int byte_size = _packed_int32_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          536870003, _internal_packed_int32(), byte_size, target);
+    }
+  }
+
+  // optional .protobuf_unittest.ForeignEnumLite optional_enum = 536870004;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      536870004, this->_internal_optional_enum(), target);
+  }
+
+  // optional string optional_string = 536870005;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        536870005, this->_internal_optional_string(), target);
+  }
+
+  // optional bytes optional_bytes = 536870006;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        536870006, this->_internal_optional_bytes(), target);
+  }
+
+  // optional .protobuf_unittest.ForeignMessageLite optional_message = 536870007;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        536870007, _Internal::optional_message(this), target, stream);
+  }
+
+  // optional group OptionalGroup = 536870008 { ... };
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        536870008, _Internal::optionalgroup(this), target, stream);
+  }
+
+  // map<string, string> string_string_map = 536870010;
+  if (!this->_internal_string_string_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+      }
+    };
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_string_string_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_string_string_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+          it = this->_internal_string_string_map().begin();
+          it != this->_internal_string_string_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse::Funcs::InternalSerialize(536870010, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+          it = this->_internal_string_string_map().begin();
+          it != this->_internal_string_string_map().end(); ++it) {
+        target = TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse::Funcs::InternalSerialize(536870010, it->first, it->second, target, stream);
+        Utf8Check::Check(&(*it));
+      }
+    }
+  }
+
+  switch (oneof_field_case()) {
+    case kOneofUint32: {
+      target = stream->EnsureSpace(target);
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(536870011, this->_internal_oneof_uint32(), target);
+      break;
+    }
+    case kOneofTestAllTypes: {
+      target = stream->EnsureSpace(target);
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(
+          536870012, _Internal::oneof_test_all_types(this), target, stream);
+      break;
+    }
+    case kOneofString: {
+      target = stream->WriteStringMaybeAliased(
+          536870013, this->_internal_oneof_string(), target);
+      break;
+    }
+    case kOneofBytes: {
+      target = stream->WriteBytesMaybeAliased(
+          536870014, this->_internal_oneof_bytes(), target);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestHugeFieldNumbersLite)
+  return target;
+}
+
+size_t TestHugeFieldNumbersLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestHugeFieldNumbersLite)
+  size_t total_size = 0;
+
+  total_size += _extensions_.ByteSize();
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 repeated_int32 = 536870002 [packed = false];
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int32Size(this->repeated_int32_);
+    total_size += 5 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_int32_size());
+    total_size += data_size;
+  }
+
+  // repeated int32 packed_int32 = 536870003 [packed = true];
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int32Size(this->packed_int32_);
+    if (data_size > 0) {
+      total_size += 5 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _packed_int32_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // map<string, string> string_string_map = 536870010;
+  total_size += 5 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_string_string_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_string_string_map().begin();
+      it != this->_internal_string_string_map().end(); ++it) {
+    total_size += TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    // optional string optional_string = 536870005;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 5 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_optional_string());
+    }
+
+    // optional bytes optional_bytes = 536870006;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 5 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_optional_bytes());
+    }
+
+    // optional .protobuf_unittest.ForeignMessageLite optional_message = 536870007;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 5 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *optional_message_);
+    }
+
+    // optional group OptionalGroup = 536870008 { ... };
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 10 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *optionalgroup_);
+    }
+
+    // optional int32 optional_int32 = 536870000;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 5 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_optional_int32());
+    }
+
+    // optional int32 fixed_32 = 536870001;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 5 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_fixed_32());
+    }
+
+    // optional .protobuf_unittest.ForeignEnumLite optional_enum = 536870004;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 5 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_optional_enum());
+    }
+
+  }
+  switch (oneof_field_case()) {
+    // uint32 oneof_uint32 = 536870011;
+    case kOneofUint32: {
+      total_size += 5 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+          this->_internal_oneof_uint32());
+      break;
+    }
+    // .protobuf_unittest.TestAllTypesLite oneof_test_all_types = 536870012;
+    case kOneofTestAllTypes: {
+      total_size += 5 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.oneof_test_all_types_);
+      break;
+    }
+    // string oneof_string = 536870013;
+    case kOneofString: {
+      total_size += 5 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_oneof_string());
+      break;
+    }
+    // bytes oneof_bytes = 536870014;
+    case kOneofBytes: {
+      total_size += 5 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_oneof_bytes());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestHugeFieldNumbersLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestHugeFieldNumbersLite*>(
+      &from));
+}
+
+void TestHugeFieldNumbersLite::MergeFrom(const TestHugeFieldNumbersLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestHugeFieldNumbersLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _extensions_.MergeFrom(from._extensions_);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_int32_.MergeFrom(from.repeated_int32_);
+  packed_int32_.MergeFrom(from.packed_int32_);
+  string_string_map_.MergeFrom(from.string_string_map_);
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _internal_set_optional_string(from._internal_optional_string());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _internal_set_optional_bytes(from._internal_optional_bytes());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _internal_mutable_optional_message()->::protobuf_unittest::ForeignMessageLite::MergeFrom(from._internal_optional_message());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _internal_mutable_optionalgroup()->::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup::MergeFrom(from._internal_optionalgroup());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      optional_int32_ = from.optional_int32_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      fixed_32_ = from.fixed_32_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      optional_enum_ = from.optional_enum_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  switch (from.oneof_field_case()) {
+    case kOneofUint32: {
+      _internal_set_oneof_uint32(from._internal_oneof_uint32());
+      break;
+    }
+    case kOneofTestAllTypes: {
+      _internal_mutable_oneof_test_all_types()->::protobuf_unittest::TestAllTypesLite::MergeFrom(from._internal_oneof_test_all_types());
+      break;
+    }
+    case kOneofString: {
+      _internal_set_oneof_string(from._internal_oneof_string());
+      break;
+    }
+    case kOneofBytes: {
+      _internal_set_oneof_bytes(from._internal_oneof_bytes());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+}
+
+void TestHugeFieldNumbersLite::CopyFrom(const TestHugeFieldNumbersLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestHugeFieldNumbersLite)
+  if (&from == this) return;
+  Clear();
+  _extensions_.MergeFrom(from._extensions_);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _has_bits_ = from._has_bits_;
+  repeated_int32_.MergeFrom(from.repeated_int32_);
+  packed_int32_.MergeFrom(from.packed_int32_);
+  string_string_map_.MergeFrom(from.string_string_map_);
+  if (from._internal_has_optional_string()) {
+    _internal_set_optional_string(from._internal_optional_string());
+  }
+  if (from._internal_has_optional_bytes()) {
+    _internal_set_optional_bytes(from._internal_optional_bytes());
+  }
+  if (from._internal_has_optional_message()) {
+    _internal_mutable_optional_message()->::protobuf_unittest::ForeignMessageLite::MergeFrom(from._internal_optional_message());
+  }
+  if (from._internal_has_optionalgroup()) {
+    _internal_mutable_optionalgroup()->::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup::MergeFrom(from._internal_optionalgroup());
+  }
+  ::memcpy(&optional_int32_, &from.optional_int32_,
+    static_cast<size_t>(reinterpret_cast<char*>(&optional_enum_) -
+    reinterpret_cast<char*>(&optional_int32_)) + sizeof(optional_enum_));
+  switch (from.oneof_field_case()) {
+    case kOneofUint32: {
+      _internal_set_oneof_uint32(from._internal_oneof_uint32());
+      break;
+    }
+    case kOneofTestAllTypes: {
+      _internal_mutable_oneof_test_all_types()->::protobuf_unittest::TestAllTypesLite::MergeFrom(from._internal_oneof_test_all_types());
+      break;
+    }
+    case kOneofString: {
+      _internal_set_oneof_string(from._internal_oneof_string());
+      break;
+    }
+    case kOneofBytes: {
+      _internal_set_oneof_bytes(from._internal_oneof_bytes());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+}
+
+bool TestHugeFieldNumbersLite::IsInitialized() const {
+  if (!_extensions_.IsInitialized()) {
+    return false;
+  }
+
+  return true;
+}
+
+void TestHugeFieldNumbersLite::InternalSwap(TestHugeFieldNumbersLite* other) {
+  using std::swap;
+  _extensions_.Swap(&other->_extensions_);
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  repeated_int32_.InternalSwap(&other->repeated_int32_);
+  packed_int32_.InternalSwap(&other->packed_int32_);
+  string_string_map_.Swap(&other->string_string_map_);
+  optional_string_.Swap(&other->optional_string_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  optional_bytes_.Swap(&other->optional_bytes_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestHugeFieldNumbersLite, fixed_32_)
+      + sizeof(TestHugeFieldNumbersLite::fixed_32_)
+      - PROTOBUF_FIELD_OFFSET(TestHugeFieldNumbersLite, optional_message_)>(
+          reinterpret_cast<char*>(&optional_message_),
+          reinterpret_cast<char*>(&other->optional_message_));
+  swap(optional_enum_, other->optional_enum_);
+  swap(oneof_field_, other->oneof_field_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+std::string TestHugeFieldNumbersLite::GetTypeName() const {
+  return "protobuf_unittest.TestHugeFieldNumbersLite";
+}
+
+
+// ===================================================================
+
+void TestOneofParsingLite::InitAsDefaultInstance() {
+}
+class TestOneofParsingLite::_Internal {
+ public:
+  static const ::protobuf_unittest::TestAllTypesLite& oneof_submessage(const TestOneofParsingLite* msg);
+};
+
+const ::protobuf_unittest::TestAllTypesLite&
+TestOneofParsingLite::_Internal::oneof_submessage(const TestOneofParsingLite* msg) {
+  return *msg->oneof_field_.oneof_submessage_;
+}
+void TestOneofParsingLite::set_allocated_oneof_submessage(::protobuf_unittest::TestAllTypesLite* oneof_submessage) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (oneof_submessage) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(oneof_submessage);
+    if (message_arena != submessage_arena) {
+      oneof_submessage = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, oneof_submessage, submessage_arena);
+    }
+    set_has_oneof_submessage();
+    oneof_field_.oneof_submessage_ = oneof_submessage;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestOneofParsingLite.oneof_submessage)
+}
+::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> TestOneofParsingLite::_i_give_permission_to_break_this_code_default_oneof_bytes_;
+::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> TestOneofParsingLite::_i_give_permission_to_break_this_code_default_oneof_string_cord_;
+::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> TestOneofParsingLite::_i_give_permission_to_break_this_code_default_oneof_bytes_string_piece_;
+TestOneofParsingLite::TestOneofParsingLite(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestOneofParsingLite)
+}
+TestOneofParsingLite::TestOneofParsingLite(const TestOneofParsingLite& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  clear_has_oneof_field();
+  switch (from.oneof_field_case()) {
+    case kOneofInt32: {
+      _internal_set_oneof_int32(from._internal_oneof_int32());
+      break;
+    }
+    case kOneofSubmessage: {
+      _internal_mutable_oneof_submessage()->::protobuf_unittest::TestAllTypesLite::MergeFrom(from._internal_oneof_submessage());
+      break;
+    }
+    case kOneofString: {
+      _internal_set_oneof_string(from._internal_oneof_string());
+      break;
+    }
+    case kOneofBytes: {
+      _internal_set_oneof_bytes(from._internal_oneof_bytes());
+      break;
+    }
+    case kOneofStringCord: {
+      _internal_set_oneof_string_cord(from._internal_oneof_string_cord());
+      break;
+    }
+    case kOneofBytesCord: {
+      _internal_set_oneof_bytes_cord(from._internal_oneof_bytes_cord());
+      break;
+    }
+    case kOneofStringStringPiece: {
+      _internal_set_oneof_string_string_piece(from._internal_oneof_string_string_piece());
+      break;
+    }
+    case kOneofBytesStringPiece: {
+      _internal_set_oneof_bytes_string_piece(from._internal_oneof_bytes_string_piece());
+      break;
+    }
+    case kOneofEnum: {
+      _internal_set_oneof_enum(from._internal_oneof_enum());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestOneofParsingLite)
+}
+
+void TestOneofParsingLite::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestOneofParsingLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  clear_has_oneof_field();
+}
+
+TestOneofParsingLite::~TestOneofParsingLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestOneofParsingLite)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void TestOneofParsingLite::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+}
+
+void TestOneofParsingLite::ArenaDtor(void* object) {
+  TestOneofParsingLite* _this = reinterpret_cast< TestOneofParsingLite* >(object);
+  (void)_this;
+}
+void TestOneofParsingLite::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestOneofParsingLite::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestOneofParsingLite& TestOneofParsingLite::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestOneofParsingLite_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestOneofParsingLite::clear_oneof_field() {
+// @@protoc_insertion_point(one_of_clear_start:protobuf_unittest.TestOneofParsingLite)
+  switch (oneof_field_case()) {
+    case kOneofInt32: {
+      // No need to clear
+      break;
+    }
+    case kOneofSubmessage: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.oneof_submessage_;
+      }
+      break;
+    }
+    case kOneofString: {
+      oneof_field_.oneof_string_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+      break;
+    }
+    case kOneofBytes: {
+      oneof_field_.oneof_bytes_.Destroy(&::protobuf_unittest::TestOneofParsingLite::_i_give_permission_to_break_this_code_default_oneof_bytes_.get(), GetArena());
+      break;
+    }
+    case kOneofStringCord: {
+      oneof_field_.oneof_string_cord_.Destroy(&::protobuf_unittest::TestOneofParsingLite::_i_give_permission_to_break_this_code_default_oneof_string_cord_.get(), GetArena());
+      break;
+    }
+    case kOneofBytesCord: {
+      oneof_field_.oneof_bytes_cord_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+      break;
+    }
+    case kOneofStringStringPiece: {
+      oneof_field_.oneof_string_string_piece_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+      break;
+    }
+    case kOneofBytesStringPiece: {
+      oneof_field_.oneof_bytes_string_piece_.Destroy(&::protobuf_unittest::TestOneofParsingLite::_i_give_permission_to_break_this_code_default_oneof_bytes_string_piece_.get(), GetArena());
+      break;
+    }
+    case kOneofEnum: {
+      // No need to clear
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+
+
+void TestOneofParsingLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestOneofParsingLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_oneof_field();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* TestOneofParsingLite::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // int32 oneof_int32 = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          _internal_set_oneof_int32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .protobuf_unittest.TestAllTypesLite oneof_submessage = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_oneof_submessage(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string oneof_string = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          auto str = _internal_mutable_oneof_string();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes oneof_bytes = 4 [default = "default bytes"];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          auto str = _internal_mutable_oneof_bytes();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string oneof_string_cord = 5 [default = "default Cord", ctype = CORD];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          auto str = _internal_mutable_oneof_string_cord();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes oneof_bytes_cord = 6 [ctype = CORD];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          auto str = _internal_mutable_oneof_bytes_cord();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string oneof_string_string_piece = 7 [ctype = STRING_PIECE];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          auto str = _internal_mutable_oneof_string_string_piece();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes oneof_bytes_string_piece = 8 [default = "default StringPiece", ctype = STRING_PIECE];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          auto str = _internal_mutable_oneof_bytes_string_piece();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .protobuf_unittest.V2EnumLite oneof_enum = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 72)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::protobuf_unittest::V2EnumLite_IsValid(val))) {
+            _internal_set_oneof_enum(static_cast<::protobuf_unittest::V2EnumLite>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(9, val, mutable_unknown_fields());
+          }
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestOneofParsingLite::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestOneofParsingLite)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (oneof_field_case()) {
+    case kOneofInt32: {
+      target = stream->EnsureSpace(target);
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_oneof_int32(), target);
+      break;
+    }
+    case kOneofSubmessage: {
+      target = stream->EnsureSpace(target);
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(
+          2, _Internal::oneof_submessage(this), target, stream);
+      break;
+    }
+    case kOneofString: {
+      target = stream->WriteStringMaybeAliased(
+          3, this->_internal_oneof_string(), target);
+      break;
+    }
+    case kOneofBytes: {
+      target = stream->WriteBytesMaybeAliased(
+          4, this->_internal_oneof_bytes(), target);
+      break;
+    }
+    case kOneofStringCord: {
+      target = stream->WriteStringMaybeAliased(
+          5, this->_internal_oneof_string_cord(), target);
+      break;
+    }
+    case kOneofBytesCord: {
+      target = stream->WriteBytesMaybeAliased(
+          6, this->_internal_oneof_bytes_cord(), target);
+      break;
+    }
+    case kOneofStringStringPiece: {
+      target = stream->WriteStringMaybeAliased(
+          7, this->_internal_oneof_string_string_piece(), target);
+      break;
+    }
+    case kOneofBytesStringPiece: {
+      target = stream->WriteBytesMaybeAliased(
+          8, this->_internal_oneof_bytes_string_piece(), target);
+      break;
+    }
+    case kOneofEnum: {
+      target = stream->EnsureSpace(target);
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+        9, this->_internal_oneof_enum(), target);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestOneofParsingLite)
+  return target;
+}
+
+size_t TestOneofParsingLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestOneofParsingLite)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (oneof_field_case()) {
+    // int32 oneof_int32 = 1;
+    case kOneofInt32: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_oneof_int32());
+      break;
+    }
+    // .protobuf_unittest.TestAllTypesLite oneof_submessage = 2;
+    case kOneofSubmessage: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.oneof_submessage_);
+      break;
+    }
+    // string oneof_string = 3;
+    case kOneofString: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_oneof_string());
+      break;
+    }
+    // bytes oneof_bytes = 4 [default = "default bytes"];
+    case kOneofBytes: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_oneof_bytes());
+      break;
+    }
+    // string oneof_string_cord = 5 [default = "default Cord", ctype = CORD];
+    case kOneofStringCord: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_oneof_string_cord());
+      break;
+    }
+    // bytes oneof_bytes_cord = 6 [ctype = CORD];
+    case kOneofBytesCord: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_oneof_bytes_cord());
+      break;
+    }
+    // string oneof_string_string_piece = 7 [ctype = STRING_PIECE];
+    case kOneofStringStringPiece: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_oneof_string_string_piece());
+      break;
+    }
+    // bytes oneof_bytes_string_piece = 8 [default = "default StringPiece", ctype = STRING_PIECE];
+    case kOneofBytesStringPiece: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_oneof_bytes_string_piece());
+      break;
+    }
+    // .protobuf_unittest.V2EnumLite oneof_enum = 9;
+    case kOneofEnum: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_oneof_enum());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestOneofParsingLite::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const TestOneofParsingLite*>(
+      &from));
+}
+
+void TestOneofParsingLite::MergeFrom(const TestOneofParsingLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestOneofParsingLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.oneof_field_case()) {
+    case kOneofInt32: {
+      _internal_set_oneof_int32(from._internal_oneof_int32());
+      break;
+    }
+    case kOneofSubmessage: {
+      _internal_mutable_oneof_submessage()->::protobuf_unittest::TestAllTypesLite::MergeFrom(from._internal_oneof_submessage());
+      break;
+    }
+    case kOneofString: {
+      _internal_set_oneof_string(from._internal_oneof_string());
+      break;
+    }
+    case kOneofBytes: {
+      _internal_set_oneof_bytes(from._internal_oneof_bytes());
+      break;
+    }
+    case kOneofStringCord: {
+      _internal_set_oneof_string_cord(from._internal_oneof_string_cord());
+      break;
+    }
+    case kOneofBytesCord: {
+      _internal_set_oneof_bytes_cord(from._internal_oneof_bytes_cord());
+      break;
+    }
+    case kOneofStringStringPiece: {
+      _internal_set_oneof_string_string_piece(from._internal_oneof_string_string_piece());
+      break;
+    }
+    case kOneofBytesStringPiece: {
+      _internal_set_oneof_bytes_string_piece(from._internal_oneof_bytes_string_piece());
+      break;
+    }
+    case kOneofEnum: {
+      _internal_set_oneof_enum(from._internal_oneof_enum());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+}
+
+void TestOneofParsingLite::CopyFrom(const TestOneofParsingLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestOneofParsingLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestOneofParsingLite::IsInitialized() const {
+  return true;
+}
+
+void TestOneofParsingLite::InternalSwap(TestOneofParsingLite* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  swap(oneof_field_, other->oneof_field_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+std::string TestOneofParsingLite::GetTypeName() const {
+  return "protobuf_unittest.TestOneofParsingLite";
+}
+
+
+// ===================================================================
+
+void PackedInt32::InitAsDefaultInstance() {
+}
+class PackedInt32::_Internal {
+ public:
+};
+
+PackedInt32::PackedInt32(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena),
+  repeated_int32_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.PackedInt32)
+}
+PackedInt32::PackedInt32(const PackedInt32& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      repeated_int32_(from.repeated_int32_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.PackedInt32)
+}
+
+void PackedInt32::SharedCtor() {
+}
+
+PackedInt32::~PackedInt32() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.PackedInt32)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void PackedInt32::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void PackedInt32::ArenaDtor(void* object) {
+  PackedInt32* _this = reinterpret_cast< PackedInt32* >(object);
+  (void)_this;
+}
+void PackedInt32::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void PackedInt32::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const PackedInt32& PackedInt32::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PackedInt32_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void PackedInt32::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.PackedInt32)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_int32_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* PackedInt32::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated int32 repeated_int32 = 2048 [packed = true];
+      case 2048:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 2)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_repeated_int32(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 0) {
+          _internal_add_repeated_int32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* PackedInt32::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.PackedInt32)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated int32 repeated_int32 = 2048 [packed = true];
+  {
+    int byte_size = _repeated_int32_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2048, _internal_repeated_int32(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.PackedInt32)
+  return target;
+}
+
+size_t PackedInt32::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.PackedInt32)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 repeated_int32 = 2048 [packed = true];
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int32Size(this->repeated_int32_);
+    if (data_size > 0) {
+      total_size += 3 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_int32_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void PackedInt32::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const PackedInt32*>(
+      &from));
+}
+
+void PackedInt32::MergeFrom(const PackedInt32& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.PackedInt32)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_int32_.MergeFrom(from.repeated_int32_);
+}
+
+void PackedInt32::CopyFrom(const PackedInt32& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.PackedInt32)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PackedInt32::IsInitialized() const {
+  return true;
+}
+
+void PackedInt32::InternalSwap(PackedInt32* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  repeated_int32_.InternalSwap(&other->repeated_int32_);
+}
+
+std::string PackedInt32::GetTypeName() const {
+  return "protobuf_unittest.PackedInt32";
+}
+
+
+// ===================================================================
+
+void NonPackedInt32::InitAsDefaultInstance() {
+}
+class NonPackedInt32::_Internal {
+ public:
+};
+
+NonPackedInt32::NonPackedInt32(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena),
+  repeated_int32_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.NonPackedInt32)
+}
+NonPackedInt32::NonPackedInt32(const NonPackedInt32& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      repeated_int32_(from.repeated_int32_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.NonPackedInt32)
+}
+
+void NonPackedInt32::SharedCtor() {
+}
+
+NonPackedInt32::~NonPackedInt32() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.NonPackedInt32)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void NonPackedInt32::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void NonPackedInt32::ArenaDtor(void* object) {
+  NonPackedInt32* _this = reinterpret_cast< NonPackedInt32* >(object);
+  (void)_this;
+}
+void NonPackedInt32::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void NonPackedInt32::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const NonPackedInt32& NonPackedInt32::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_NonPackedInt32_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void NonPackedInt32::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.NonPackedInt32)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_int32_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* NonPackedInt32::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated int32 repeated_int32 = 2048;
+      case 2048:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 0)) {
+          _internal_add_repeated_int32(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 2) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_repeated_int32(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* NonPackedInt32::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.NonPackedInt32)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated int32 repeated_int32 = 2048;
+  for (int i = 0, n = this->_internal_repeated_int32_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2048, this->_internal_repeated_int32(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.NonPackedInt32)
+  return target;
+}
+
+size_t NonPackedInt32::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.NonPackedInt32)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 repeated_int32 = 2048;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int32Size(this->repeated_int32_);
+    total_size += 3 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_int32_size());
+    total_size += data_size;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void NonPackedInt32::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const NonPackedInt32*>(
+      &from));
+}
+
+void NonPackedInt32::MergeFrom(const NonPackedInt32& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.NonPackedInt32)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_int32_.MergeFrom(from.repeated_int32_);
+}
+
+void NonPackedInt32::CopyFrom(const NonPackedInt32& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.NonPackedInt32)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NonPackedInt32::IsInitialized() const {
+  return true;
+}
+
+void NonPackedInt32::InternalSwap(NonPackedInt32* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  repeated_int32_.InternalSwap(&other->repeated_int32_);
+}
+
+std::string NonPackedInt32::GetTypeName() const {
+  return "protobuf_unittest.NonPackedInt32";
+}
+
+
+// ===================================================================
+
+void PackedFixed32::InitAsDefaultInstance() {
+}
+class PackedFixed32::_Internal {
+ public:
+};
+
+PackedFixed32::PackedFixed32(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena),
+  repeated_fixed32_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.PackedFixed32)
+}
+PackedFixed32::PackedFixed32(const PackedFixed32& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      repeated_fixed32_(from.repeated_fixed32_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.PackedFixed32)
+}
+
+void PackedFixed32::SharedCtor() {
+}
+
+PackedFixed32::~PackedFixed32() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.PackedFixed32)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void PackedFixed32::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void PackedFixed32::ArenaDtor(void* object) {
+  PackedFixed32* _this = reinterpret_cast< PackedFixed32* >(object);
+  (void)_this;
+}
+void PackedFixed32::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void PackedFixed32::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const PackedFixed32& PackedFixed32::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PackedFixed32_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void PackedFixed32::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.PackedFixed32)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_fixed32_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* PackedFixed32::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated fixed32 repeated_fixed32 = 2048 [packed = true];
+      case 2048:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 2)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed32Parser(_internal_mutable_repeated_fixed32(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 5) {
+          _internal_add_repeated_fixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr));
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* PackedFixed32::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.PackedFixed32)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated fixed32 repeated_fixed32 = 2048 [packed = true];
+  if (this->_internal_repeated_fixed32_size() > 0) {
+    target = stream->WriteFixedPacked(2048, _internal_repeated_fixed32(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.PackedFixed32)
+  return target;
+}
+
+size_t PackedFixed32::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.PackedFixed32)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed32 repeated_fixed32 = 2048 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_fixed32_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 3 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_fixed32_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void PackedFixed32::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const PackedFixed32*>(
+      &from));
+}
+
+void PackedFixed32::MergeFrom(const PackedFixed32& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.PackedFixed32)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_fixed32_.MergeFrom(from.repeated_fixed32_);
+}
+
+void PackedFixed32::CopyFrom(const PackedFixed32& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.PackedFixed32)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PackedFixed32::IsInitialized() const {
+  return true;
+}
+
+void PackedFixed32::InternalSwap(PackedFixed32* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  repeated_fixed32_.InternalSwap(&other->repeated_fixed32_);
+}
+
+std::string PackedFixed32::GetTypeName() const {
+  return "protobuf_unittest.PackedFixed32";
+}
+
+
+// ===================================================================
+
+void NonPackedFixed32::InitAsDefaultInstance() {
+}
+class NonPackedFixed32::_Internal {
+ public:
+};
+
+NonPackedFixed32::NonPackedFixed32(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena),
+  repeated_fixed32_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.NonPackedFixed32)
+}
+NonPackedFixed32::NonPackedFixed32(const NonPackedFixed32& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      repeated_fixed32_(from.repeated_fixed32_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.NonPackedFixed32)
+}
+
+void NonPackedFixed32::SharedCtor() {
+}
+
+NonPackedFixed32::~NonPackedFixed32() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.NonPackedFixed32)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void NonPackedFixed32::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void NonPackedFixed32::ArenaDtor(void* object) {
+  NonPackedFixed32* _this = reinterpret_cast< NonPackedFixed32* >(object);
+  (void)_this;
+}
+void NonPackedFixed32::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void NonPackedFixed32::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const NonPackedFixed32& NonPackedFixed32::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_NonPackedFixed32_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void NonPackedFixed32::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.NonPackedFixed32)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_fixed32_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* NonPackedFixed32::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated fixed32 repeated_fixed32 = 2048;
+      case 2048:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 5)) {
+          _internal_add_repeated_fixed32(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr));
+          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 2) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed32Parser(_internal_mutable_repeated_fixed32(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* NonPackedFixed32::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.NonPackedFixed32)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated fixed32 repeated_fixed32 = 2048;
+  for (int i = 0, n = this->_internal_repeated_fixed32_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32ToArray(2048, this->_internal_repeated_fixed32(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.NonPackedFixed32)
+  return target;
+}
+
+size_t NonPackedFixed32::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.NonPackedFixed32)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed32 repeated_fixed32 = 2048;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_fixed32_size());
+    size_t data_size = 4UL * count;
+    total_size += 3 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_repeated_fixed32_size());
+    total_size += data_size;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void NonPackedFixed32::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const NonPackedFixed32*>(
+      &from));
+}
+
+void NonPackedFixed32::MergeFrom(const NonPackedFixed32& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.NonPackedFixed32)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_fixed32_.MergeFrom(from.repeated_fixed32_);
+}
+
+void NonPackedFixed32::CopyFrom(const NonPackedFixed32& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.NonPackedFixed32)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NonPackedFixed32::IsInitialized() const {
+  return true;
+}
+
+void NonPackedFixed32::InternalSwap(NonPackedFixed32* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  repeated_fixed32_.InternalSwap(&other->repeated_fixed32_);
+}
+
+std::string NonPackedFixed32::GetTypeName() const {
+  return "protobuf_unittest.NonPackedFixed32";
+}
+
+
+// ===================================================================
+
+void DupEnum::InitAsDefaultInstance() {
+}
+class DupEnum::_Internal {
+ public:
+};
+
+DupEnum::DupEnum(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.DupEnum)
+}
+DupEnum::DupEnum(const DupEnum& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.DupEnum)
+}
+
+void DupEnum::SharedCtor() {
+}
+
+DupEnum::~DupEnum() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.DupEnum)
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+void DupEnum::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void DupEnum::ArenaDtor(void* object) {
+  DupEnum* _this = reinterpret_cast< DupEnum* >(object);
+  (void)_this;
+}
+void DupEnum::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void DupEnum::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const DupEnum& DupEnum::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DupEnum_google_2fprotobuf_2funittest_5flite_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void DupEnum::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.DupEnum)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* DupEnum::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<std::string>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* DupEnum::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.DupEnum)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.DupEnum)
+  return target;
+}
+
+size_t DupEnum::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.DupEnum)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void DupEnum::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const DupEnum*>(
+      &from));
+}
+
+void DupEnum::MergeFrom(const DupEnum& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.DupEnum)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+}
+
+void DupEnum::CopyFrom(const DupEnum& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.DupEnum)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DupEnum::IsInitialized() const {
+  return true;
+}
+
+void DupEnum::InternalSwap(DupEnum* other) {
+  using std::swap;
+  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+}
+
+std::string DupEnum::GetTypeName() const {
+  return "protobuf_unittest.DupEnum";
+}
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestNestedExtensionLite::kNestedExtensionFieldNumber;
+#endif
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 5, false >
+  TestNestedExtensionLite::nested_extension(kNestedExtensionFieldNumber, 0);
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestParsingMergeLite::kOptionalExtFieldNumber;
+#endif
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestParsingMergeLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::protobuf_unittest::TestAllTypesLite >, 11, false >
+  TestParsingMergeLite::optional_ext(kOptionalExtFieldNumber, ::protobuf_unittest::TestAllTypesLite::default_instance());
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestParsingMergeLite::kRepeatedExtFieldNumber;
+#endif
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestParsingMergeLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::TestAllTypesLite >, 11, false >
+  TestParsingMergeLite::repeated_ext(kRepeatedExtFieldNumber, ::protobuf_unittest::TestAllTypesLite::default_instance());
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 5, false >
+  optional_int32_extension_lite(kOptionalInt32ExtensionLiteFieldNumber, 0);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int64 >, 3, false >
+  optional_int64_extension_lite(kOptionalInt64ExtensionLiteFieldNumber, PROTOBUF_LONGLONG(0));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint32 >, 13, false >
+  optional_uint32_extension_lite(kOptionalUint32ExtensionLiteFieldNumber, 0u);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint64 >, 4, false >
+  optional_uint64_extension_lite(kOptionalUint64ExtensionLiteFieldNumber, PROTOBUF_ULONGLONG(0));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 17, false >
+  optional_sint32_extension_lite(kOptionalSint32ExtensionLiteFieldNumber, 0);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int64 >, 18, false >
+  optional_sint64_extension_lite(kOptionalSint64ExtensionLiteFieldNumber, PROTOBUF_LONGLONG(0));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint32 >, 7, false >
+  optional_fixed32_extension_lite(kOptionalFixed32ExtensionLiteFieldNumber, 0u);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint64 >, 6, false >
+  optional_fixed64_extension_lite(kOptionalFixed64ExtensionLiteFieldNumber, PROTOBUF_ULONGLONG(0));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 15, false >
+  optional_sfixed32_extension_lite(kOptionalSfixed32ExtensionLiteFieldNumber, 0);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int64 >, 16, false >
+  optional_sfixed64_extension_lite(kOptionalSfixed64ExtensionLiteFieldNumber, PROTOBUF_LONGLONG(0));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< float >, 2, false >
+  optional_float_extension_lite(kOptionalFloatExtensionLiteFieldNumber, 0);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< double >, 1, false >
+  optional_double_extension_lite(kOptionalDoubleExtensionLiteFieldNumber, 0);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
+  optional_bool_extension_lite(kOptionalBoolExtensionLiteFieldNumber, false);
+const std::string optional_string_extension_lite_default("");
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
+  optional_string_extension_lite(kOptionalStringExtensionLiteFieldNumber, optional_string_extension_lite_default);
+const std::string optional_bytes_extension_lite_default("");
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 12, false >
+  optional_bytes_extension_lite(kOptionalBytesExtensionLiteFieldNumber, optional_bytes_extension_lite_default);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::protobuf_unittest::OptionalGroup_extension_lite >, 10, false >
+  optionalgroup_extension_lite(kOptionalgroupExtensionLiteFieldNumber, ::protobuf_unittest::OptionalGroup_extension_lite::default_instance());
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedMessage >, 11, false >
+  optional_nested_message_extension_lite(kOptionalNestedMessageExtensionLiteFieldNumber, ::protobuf_unittest::TestAllTypesLite_NestedMessage::default_instance());
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::protobuf_unittest::ForeignMessageLite >, 11, false >
+  optional_foreign_message_extension_lite(kOptionalForeignMessageExtensionLiteFieldNumber, ::protobuf_unittest::ForeignMessageLite::default_instance());
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::protobuf_unittest_import::ImportMessageLite >, 11, false >
+  optional_import_message_extension_lite(kOptionalImportMessageExtensionLiteFieldNumber, ::protobuf_unittest_import::ImportMessageLite::default_instance());
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::EnumTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedEnum, ::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid>, 14, false >
+  optional_nested_enum_extension_lite(kOptionalNestedEnumExtensionLiteFieldNumber, static_cast< ::protobuf_unittest::TestAllTypesLite_NestedEnum >(1));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::EnumTypeTraits< ::protobuf_unittest::ForeignEnumLite, ::protobuf_unittest::ForeignEnumLite_IsValid>, 14, false >
+  optional_foreign_enum_extension_lite(kOptionalForeignEnumExtensionLiteFieldNumber, static_cast< ::protobuf_unittest::ForeignEnumLite >(4));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::EnumTypeTraits< ::protobuf_unittest_import::ImportEnumLite, ::protobuf_unittest_import::ImportEnumLite_IsValid>, 14, false >
+  optional_import_enum_extension_lite(kOptionalImportEnumExtensionLiteFieldNumber, static_cast< ::protobuf_unittest_import::ImportEnumLite >(7));
+const std::string optional_string_piece_extension_lite_default("");
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
+  optional_string_piece_extension_lite(kOptionalStringPieceExtensionLiteFieldNumber, optional_string_piece_extension_lite_default);
+const std::string optional_cord_extension_lite_default("");
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
+  optional_cord_extension_lite(kOptionalCordExtensionLiteFieldNumber, optional_cord_extension_lite_default);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::protobuf_unittest_import::PublicImportMessageLite >, 11, false >
+  optional_public_import_message_extension_lite(kOptionalPublicImportMessageExtensionLiteFieldNumber, ::protobuf_unittest_import::PublicImportMessageLite::default_instance());
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedMessage >, 11, false >
+  optional_lazy_message_extension_lite(kOptionalLazyMessageExtensionLiteFieldNumber, ::protobuf_unittest::TestAllTypesLite_NestedMessage::default_instance());
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 5, false >
+  repeated_int32_extension_lite(kRepeatedInt32ExtensionLiteFieldNumber, 0);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int64 >, 3, false >
+  repeated_int64_extension_lite(kRepeatedInt64ExtensionLiteFieldNumber, PROTOBUF_LONGLONG(0));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint32 >, 13, false >
+  repeated_uint32_extension_lite(kRepeatedUint32ExtensionLiteFieldNumber, 0u);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint64 >, 4, false >
+  repeated_uint64_extension_lite(kRepeatedUint64ExtensionLiteFieldNumber, PROTOBUF_ULONGLONG(0));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 17, false >
+  repeated_sint32_extension_lite(kRepeatedSint32ExtensionLiteFieldNumber, 0);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int64 >, 18, false >
+  repeated_sint64_extension_lite(kRepeatedSint64ExtensionLiteFieldNumber, PROTOBUF_LONGLONG(0));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint32 >, 7, false >
+  repeated_fixed32_extension_lite(kRepeatedFixed32ExtensionLiteFieldNumber, 0u);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint64 >, 6, false >
+  repeated_fixed64_extension_lite(kRepeatedFixed64ExtensionLiteFieldNumber, PROTOBUF_ULONGLONG(0));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 15, false >
+  repeated_sfixed32_extension_lite(kRepeatedSfixed32ExtensionLiteFieldNumber, 0);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int64 >, 16, false >
+  repeated_sfixed64_extension_lite(kRepeatedSfixed64ExtensionLiteFieldNumber, PROTOBUF_LONGLONG(0));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< float >, 2, false >
+  repeated_float_extension_lite(kRepeatedFloatExtensionLiteFieldNumber, 0);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< double >, 1, false >
+  repeated_double_extension_lite(kRepeatedDoubleExtensionLiteFieldNumber, 0);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< bool >, 8, false >
+  repeated_bool_extension_lite(kRepeatedBoolExtensionLiteFieldNumber, false);
+const std::string repeated_string_extension_lite_default("");
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedStringTypeTraits, 9, false >
+  repeated_string_extension_lite(kRepeatedStringExtensionLiteFieldNumber, repeated_string_extension_lite_default);
+const std::string repeated_bytes_extension_lite_default("");
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedStringTypeTraits, 12, false >
+  repeated_bytes_extension_lite(kRepeatedBytesExtensionLiteFieldNumber, repeated_bytes_extension_lite_default);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::RepeatedGroup_extension_lite >, 10, false >
+  repeatedgroup_extension_lite(kRepeatedgroupExtensionLiteFieldNumber, ::protobuf_unittest::RepeatedGroup_extension_lite::default_instance());
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedMessage >, 11, false >
+  repeated_nested_message_extension_lite(kRepeatedNestedMessageExtensionLiteFieldNumber, ::protobuf_unittest::TestAllTypesLite_NestedMessage::default_instance());
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::ForeignMessageLite >, 11, false >
+  repeated_foreign_message_extension_lite(kRepeatedForeignMessageExtensionLiteFieldNumber, ::protobuf_unittest::ForeignMessageLite::default_instance());
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedMessageTypeTraits< ::protobuf_unittest_import::ImportMessageLite >, 11, false >
+  repeated_import_message_extension_lite(kRepeatedImportMessageExtensionLiteFieldNumber, ::protobuf_unittest_import::ImportMessageLite::default_instance());
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedEnumTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedEnum, ::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid>, 14, false >
+  repeated_nested_enum_extension_lite(kRepeatedNestedEnumExtensionLiteFieldNumber, static_cast< ::protobuf_unittest::TestAllTypesLite_NestedEnum >(1));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedEnumTypeTraits< ::protobuf_unittest::ForeignEnumLite, ::protobuf_unittest::ForeignEnumLite_IsValid>, 14, false >
+  repeated_foreign_enum_extension_lite(kRepeatedForeignEnumExtensionLiteFieldNumber, static_cast< ::protobuf_unittest::ForeignEnumLite >(4));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedEnumTypeTraits< ::protobuf_unittest_import::ImportEnumLite, ::protobuf_unittest_import::ImportEnumLite_IsValid>, 14, false >
+  repeated_import_enum_extension_lite(kRepeatedImportEnumExtensionLiteFieldNumber, static_cast< ::protobuf_unittest_import::ImportEnumLite >(7));
+const std::string repeated_string_piece_extension_lite_default("");
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedStringTypeTraits, 9, false >
+  repeated_string_piece_extension_lite(kRepeatedStringPieceExtensionLiteFieldNumber, repeated_string_piece_extension_lite_default);
+const std::string repeated_cord_extension_lite_default("");
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedStringTypeTraits, 9, false >
+  repeated_cord_extension_lite(kRepeatedCordExtensionLiteFieldNumber, repeated_cord_extension_lite_default);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedMessageTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedMessage >, 11, false >
+  repeated_lazy_message_extension_lite(kRepeatedLazyMessageExtensionLiteFieldNumber, ::protobuf_unittest::TestAllTypesLite_NestedMessage::default_instance());
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 5, false >
+  default_int32_extension_lite(kDefaultInt32ExtensionLiteFieldNumber, 41);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int64 >, 3, false >
+  default_int64_extension_lite(kDefaultInt64ExtensionLiteFieldNumber, PROTOBUF_LONGLONG(42));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint32 >, 13, false >
+  default_uint32_extension_lite(kDefaultUint32ExtensionLiteFieldNumber, 43u);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint64 >, 4, false >
+  default_uint64_extension_lite(kDefaultUint64ExtensionLiteFieldNumber, PROTOBUF_ULONGLONG(44));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 17, false >
+  default_sint32_extension_lite(kDefaultSint32ExtensionLiteFieldNumber, -45);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int64 >, 18, false >
+  default_sint64_extension_lite(kDefaultSint64ExtensionLiteFieldNumber, PROTOBUF_LONGLONG(46));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint32 >, 7, false >
+  default_fixed32_extension_lite(kDefaultFixed32ExtensionLiteFieldNumber, 47u);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint64 >, 6, false >
+  default_fixed64_extension_lite(kDefaultFixed64ExtensionLiteFieldNumber, PROTOBUF_ULONGLONG(48));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 15, false >
+  default_sfixed32_extension_lite(kDefaultSfixed32ExtensionLiteFieldNumber, 49);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int64 >, 16, false >
+  default_sfixed64_extension_lite(kDefaultSfixed64ExtensionLiteFieldNumber, PROTOBUF_LONGLONG(-50));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< float >, 2, false >
+  default_float_extension_lite(kDefaultFloatExtensionLiteFieldNumber, 51.5f);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< double >, 1, false >
+  default_double_extension_lite(kDefaultDoubleExtensionLiteFieldNumber, 52000);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
+  default_bool_extension_lite(kDefaultBoolExtensionLiteFieldNumber, true);
+const std::string default_string_extension_lite_default("hello");
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
+  default_string_extension_lite(kDefaultStringExtensionLiteFieldNumber, default_string_extension_lite_default);
+const std::string default_bytes_extension_lite_default("world");
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 12, false >
+  default_bytes_extension_lite(kDefaultBytesExtensionLiteFieldNumber, default_bytes_extension_lite_default);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::EnumTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedEnum, ::protobuf_unittest::TestAllTypesLite_NestedEnum_IsValid>, 14, false >
+  default_nested_enum_extension_lite(kDefaultNestedEnumExtensionLiteFieldNumber, static_cast< ::protobuf_unittest::TestAllTypesLite_NestedEnum >(2));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::EnumTypeTraits< ::protobuf_unittest::ForeignEnumLite, ::protobuf_unittest::ForeignEnumLite_IsValid>, 14, false >
+  default_foreign_enum_extension_lite(kDefaultForeignEnumExtensionLiteFieldNumber, static_cast< ::protobuf_unittest::ForeignEnumLite >(5));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::EnumTypeTraits< ::protobuf_unittest_import::ImportEnumLite, ::protobuf_unittest_import::ImportEnumLite_IsValid>, 14, false >
+  default_import_enum_extension_lite(kDefaultImportEnumExtensionLiteFieldNumber, static_cast< ::protobuf_unittest_import::ImportEnumLite >(8));
+const std::string default_string_piece_extension_lite_default("abc");
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
+  default_string_piece_extension_lite(kDefaultStringPieceExtensionLiteFieldNumber, default_string_piece_extension_lite_default);
+const std::string default_cord_extension_lite_default("123");
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
+  default_cord_extension_lite(kDefaultCordExtensionLiteFieldNumber, default_cord_extension_lite_default);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint32 >, 13, false >
+  oneof_uint32_extension_lite(kOneofUint32ExtensionLiteFieldNumber, 0u);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::protobuf_unittest::TestAllTypesLite_NestedMessage >, 11, false >
+  oneof_nested_message_extension_lite(kOneofNestedMessageExtensionLiteFieldNumber, ::protobuf_unittest::TestAllTypesLite_NestedMessage::default_instance());
+const std::string oneof_string_extension_lite_default("");
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
+  oneof_string_extension_lite(kOneofStringExtensionLiteFieldNumber, oneof_string_extension_lite_default);
+const std::string oneof_bytes_extension_lite_default("");
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestAllExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 12, false >
+  oneof_bytes_extension_lite(kOneofBytesExtensionLiteFieldNumber, oneof_bytes_extension_lite_default);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 5, true >
+  packed_int32_extension_lite(kPackedInt32ExtensionLiteFieldNumber, 0);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int64 >, 3, true >
+  packed_int64_extension_lite(kPackedInt64ExtensionLiteFieldNumber, PROTOBUF_LONGLONG(0));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint32 >, 13, true >
+  packed_uint32_extension_lite(kPackedUint32ExtensionLiteFieldNumber, 0u);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint64 >, 4, true >
+  packed_uint64_extension_lite(kPackedUint64ExtensionLiteFieldNumber, PROTOBUF_ULONGLONG(0));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 17, true >
+  packed_sint32_extension_lite(kPackedSint32ExtensionLiteFieldNumber, 0);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int64 >, 18, true >
+  packed_sint64_extension_lite(kPackedSint64ExtensionLiteFieldNumber, PROTOBUF_LONGLONG(0));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint32 >, 7, true >
+  packed_fixed32_extension_lite(kPackedFixed32ExtensionLiteFieldNumber, 0u);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::uint64 >, 6, true >
+  packed_fixed64_extension_lite(kPackedFixed64ExtensionLiteFieldNumber, PROTOBUF_ULONGLONG(0));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 15, true >
+  packed_sfixed32_extension_lite(kPackedSfixed32ExtensionLiteFieldNumber, 0);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int64 >, 16, true >
+  packed_sfixed64_extension_lite(kPackedSfixed64ExtensionLiteFieldNumber, PROTOBUF_LONGLONG(0));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< float >, 2, true >
+  packed_float_extension_lite(kPackedFloatExtensionLiteFieldNumber, 0);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< double >, 1, true >
+  packed_double_extension_lite(kPackedDoubleExtensionLiteFieldNumber, 0);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedPrimitiveTypeTraits< bool >, 8, true >
+  packed_bool_extension_lite(kPackedBoolExtensionLiteFieldNumber, false);
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestPackedExtensionsLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedEnumTypeTraits< ::protobuf_unittest::ForeignEnumLite, ::protobuf_unittest::ForeignEnumLite_IsValid>, 14, true >
+  packed_enum_extension_lite(kPackedEnumExtensionLiteFieldNumber, static_cast< ::protobuf_unittest::ForeignEnumLite >(4));
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestHugeFieldNumbersLite,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::protobuf_unittest::TestAllTypesLite >, 11, false >
+  test_all_types_lite(kTestAllTypesLiteFieldNumber, ::protobuf_unittest::TestAllTypesLite::default_instance());
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestAllTypesLite_NestedMessage* Arena::CreateMaybeMessage< ::protobuf_unittest::TestAllTypesLite_NestedMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestAllTypesLite_NestedMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestAllTypesLite_OptionalGroup* Arena::CreateMaybeMessage< ::protobuf_unittest::TestAllTypesLite_OptionalGroup >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestAllTypesLite_OptionalGroup >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestAllTypesLite_RepeatedGroup* Arena::CreateMaybeMessage< ::protobuf_unittest::TestAllTypesLite_RepeatedGroup >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestAllTypesLite_RepeatedGroup >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestAllTypesLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestAllTypesLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestAllTypesLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::ForeignMessageLite* Arena::CreateMaybeMessage< ::protobuf_unittest::ForeignMessageLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::ForeignMessageLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestPackedTypesLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestPackedTypesLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestPackedTypesLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestAllExtensionsLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestAllExtensionsLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestAllExtensionsLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::OptionalGroup_extension_lite* Arena::CreateMaybeMessage< ::protobuf_unittest::OptionalGroup_extension_lite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::OptionalGroup_extension_lite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::RepeatedGroup_extension_lite* Arena::CreateMaybeMessage< ::protobuf_unittest::RepeatedGroup_extension_lite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::RepeatedGroup_extension_lite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestPackedExtensionsLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestPackedExtensionsLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestPackedExtensionsLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestNestedExtensionLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestNestedExtensionLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestNestedExtensionLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestDeprecatedLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestDeprecatedLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestDeprecatedLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1* Arena::CreateMaybeMessage< ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group1 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2* Arena::CreateMaybeMessage< ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator_Group2 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator* Arena::CreateMaybeMessage< ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestParsingMergeLite_RepeatedFieldsGenerator >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestParsingMergeLite_OptionalGroup* Arena::CreateMaybeMessage< ::protobuf_unittest::TestParsingMergeLite_OptionalGroup >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestParsingMergeLite_OptionalGroup >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestParsingMergeLite_RepeatedGroup* Arena::CreateMaybeMessage< ::protobuf_unittest::TestParsingMergeLite_RepeatedGroup >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestParsingMergeLite_RepeatedGroup >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestParsingMergeLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestParsingMergeLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestParsingMergeLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestEmptyMessageLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestEmptyMessageLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestEmptyMessageLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestEmptyMessageWithExtensionsLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestEmptyMessageWithExtensionsLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestEmptyMessageWithExtensionsLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::V1MessageLite* Arena::CreateMaybeMessage< ::protobuf_unittest::V1MessageLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::V1MessageLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::V2MessageLite* Arena::CreateMaybeMessage< ::protobuf_unittest::V2MessageLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::V2MessageLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup* Arena::CreateMaybeMessage< ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestHugeFieldNumbersLite_OptionalGroup >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestHugeFieldNumbersLite_StringStringMapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestHugeFieldNumbersLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestHugeFieldNumbersLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestHugeFieldNumbersLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestOneofParsingLite* Arena::CreateMaybeMessage< ::protobuf_unittest::TestOneofParsingLite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestOneofParsingLite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::PackedInt32* Arena::CreateMaybeMessage< ::protobuf_unittest::PackedInt32 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::PackedInt32 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::NonPackedInt32* Arena::CreateMaybeMessage< ::protobuf_unittest::NonPackedInt32 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::NonPackedInt32 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::PackedFixed32* Arena::CreateMaybeMessage< ::protobuf_unittest::PackedFixed32 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::PackedFixed32 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::NonPackedFixed32* Arena::CreateMaybeMessage< ::protobuf_unittest::NonPackedFixed32 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::NonPackedFixed32 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::DupEnum* Arena::CreateMaybeMessage< ::protobuf_unittest::DupEnum >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::DupEnum >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,404 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_lite_imports_nonlite.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3012000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3012003 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/message_lite.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include "google/protobuf/unittest.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[1]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+namespace protobuf_unittest {
+class TestLiteImportsNonlite;
+class TestLiteImportsNonliteDefaultTypeInternal;
+extern TestLiteImportsNonliteDefaultTypeInternal _TestLiteImportsNonlite_default_instance_;
+}  // namespace protobuf_unittest
+PROTOBUF_NAMESPACE_OPEN
+template<> ::protobuf_unittest::TestLiteImportsNonlite* Arena::CreateMaybeMessage<::protobuf_unittest::TestLiteImportsNonlite>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace protobuf_unittest {
+
+// ===================================================================
+
+class TestLiteImportsNonlite PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestLiteImportsNonlite) */ {
+ public:
+  inline TestLiteImportsNonlite() : TestLiteImportsNonlite(nullptr) {};
+  virtual ~TestLiteImportsNonlite();
+
+  TestLiteImportsNonlite(const TestLiteImportsNonlite& from);
+  TestLiteImportsNonlite(TestLiteImportsNonlite&& from) noexcept
+    : TestLiteImportsNonlite() {
+    *this = ::std::move(from);
+  }
+
+  inline TestLiteImportsNonlite& operator=(const TestLiteImportsNonlite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestLiteImportsNonlite& operator=(TestLiteImportsNonlite&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const TestLiteImportsNonlite& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestLiteImportsNonlite* internal_default_instance() {
+    return reinterpret_cast<const TestLiteImportsNonlite*>(
+               &_TestLiteImportsNonlite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TestLiteImportsNonlite& a, TestLiteImportsNonlite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestLiteImportsNonlite* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestLiteImportsNonlite* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestLiteImportsNonlite* New() const final {
+    return CreateMaybeMessage<TestLiteImportsNonlite>(nullptr);
+  }
+
+  TestLiteImportsNonlite* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestLiteImportsNonlite>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
+    final;
+  void CopyFrom(const TestLiteImportsNonlite& from);
+  void MergeFrom(const TestLiteImportsNonlite& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  void DiscardUnknownFields();
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestLiteImportsNonlite* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protobuf_unittest.TestLiteImportsNonlite";
+  }
+  protected:
+  explicit TestLiteImportsNonlite(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 1,
+    kMessageWithRequiredFieldNumber = 2,
+  };
+  // optional .protobuf_unittest.TestAllTypes message = 1;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::protobuf_unittest::TestAllTypes& message() const;
+  ::protobuf_unittest::TestAllTypes* release_message();
+  ::protobuf_unittest::TestAllTypes* mutable_message();
+  void set_allocated_message(::protobuf_unittest::TestAllTypes* message);
+  private:
+  const ::protobuf_unittest::TestAllTypes& _internal_message() const;
+  ::protobuf_unittest::TestAllTypes* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::protobuf_unittest::TestAllTypes* message);
+  ::protobuf_unittest::TestAllTypes* unsafe_arena_release_message();
+
+  // optional .protobuf_unittest.TestRequired message_with_required = 2;
+  bool has_message_with_required() const;
+  private:
+  bool _internal_has_message_with_required() const;
+  public:
+  void clear_message_with_required();
+  const ::protobuf_unittest::TestRequired& message_with_required() const;
+  ::protobuf_unittest::TestRequired* release_message_with_required();
+  ::protobuf_unittest::TestRequired* mutable_message_with_required();
+  void set_allocated_message_with_required(::protobuf_unittest::TestRequired* message_with_required);
+  private:
+  const ::protobuf_unittest::TestRequired& _internal_message_with_required() const;
+  ::protobuf_unittest::TestRequired* _internal_mutable_message_with_required();
+  public:
+  void unsafe_arena_set_allocated_message_with_required(
+      ::protobuf_unittest::TestRequired* message_with_required);
+  ::protobuf_unittest::TestRequired* unsafe_arena_release_message_with_required();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestLiteImportsNonlite)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::protobuf_unittest::TestAllTypes* message_;
+  ::protobuf_unittest::TestRequired* message_with_required_;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TestLiteImportsNonlite
+
+// optional .protobuf_unittest.TestAllTypes message = 1;
+inline bool TestLiteImportsNonlite::_internal_has_message() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || message_ != nullptr);
+  return value;
+}
+inline bool TestLiteImportsNonlite::has_message() const {
+  return _internal_has_message();
+}
+inline const ::protobuf_unittest::TestAllTypes& TestLiteImportsNonlite::_internal_message() const {
+  const ::protobuf_unittest::TestAllTypes* p = message_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::protobuf_unittest::TestAllTypes*>(
+      &::protobuf_unittest::_TestAllTypes_default_instance_);
+}
+inline const ::protobuf_unittest::TestAllTypes& TestLiteImportsNonlite::message() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLiteImportsNonlite.message)
+  return _internal_message();
+}
+inline void TestLiteImportsNonlite::unsafe_arena_set_allocated_message(
+    ::protobuf_unittest::TestAllTypes* message) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(message_);
+  }
+  message_ = message;
+  if (message) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestLiteImportsNonlite.message)
+}
+inline ::protobuf_unittest::TestAllTypes* TestLiteImportsNonlite::release_message() {
+  _has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllTypes* temp = message_;
+  message_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::protobuf_unittest::TestAllTypes* TestLiteImportsNonlite::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestLiteImportsNonlite.message)
+  _has_bits_[0] &= ~0x00000001u;
+  ::protobuf_unittest::TestAllTypes* temp = message_;
+  message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestAllTypes* TestLiteImportsNonlite::_internal_mutable_message() {
+  _has_bits_[0] |= 0x00000001u;
+  if (message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestAllTypes>(GetArena());
+    message_ = p;
+  }
+  return message_;
+}
+inline ::protobuf_unittest::TestAllTypes* TestLiteImportsNonlite::mutable_message() {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestLiteImportsNonlite.message)
+  return _internal_mutable_message();
+}
+inline void TestLiteImportsNonlite::set_allocated_message(::protobuf_unittest::TestAllTypes* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(message_);
+  }
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(message)->GetArena();
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestLiteImportsNonlite.message)
+}
+
+// optional .protobuf_unittest.TestRequired message_with_required = 2;
+inline bool TestLiteImportsNonlite::_internal_has_message_with_required() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || message_with_required_ != nullptr);
+  return value;
+}
+inline bool TestLiteImportsNonlite::has_message_with_required() const {
+  return _internal_has_message_with_required();
+}
+inline const ::protobuf_unittest::TestRequired& TestLiteImportsNonlite::_internal_message_with_required() const {
+  const ::protobuf_unittest::TestRequired* p = message_with_required_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::protobuf_unittest::TestRequired*>(
+      &::protobuf_unittest::_TestRequired_default_instance_);
+}
+inline const ::protobuf_unittest::TestRequired& TestLiteImportsNonlite::message_with_required() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLiteImportsNonlite.message_with_required)
+  return _internal_message_with_required();
+}
+inline void TestLiteImportsNonlite::unsafe_arena_set_allocated_message_with_required(
+    ::protobuf_unittest::TestRequired* message_with_required) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(message_with_required_);
+  }
+  message_with_required_ = message_with_required;
+  if (message_with_required) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestLiteImportsNonlite.message_with_required)
+}
+inline ::protobuf_unittest::TestRequired* TestLiteImportsNonlite::release_message_with_required() {
+  _has_bits_[0] &= ~0x00000002u;
+  ::protobuf_unittest::TestRequired* temp = message_with_required_;
+  message_with_required_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::protobuf_unittest::TestRequired* TestLiteImportsNonlite::unsafe_arena_release_message_with_required() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestLiteImportsNonlite.message_with_required)
+  _has_bits_[0] &= ~0x00000002u;
+  ::protobuf_unittest::TestRequired* temp = message_with_required_;
+  message_with_required_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest::TestRequired* TestLiteImportsNonlite::_internal_mutable_message_with_required() {
+  _has_bits_[0] |= 0x00000002u;
+  if (message_with_required_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest::TestRequired>(GetArena());
+    message_with_required_ = p;
+  }
+  return message_with_required_;
+}
+inline ::protobuf_unittest::TestRequired* TestLiteImportsNonlite::mutable_message_with_required() {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestLiteImportsNonlite.message_with_required)
+  return _internal_mutable_message_with_required();
+}
+inline void TestLiteImportsNonlite::set_allocated_message_with_required(::protobuf_unittest::TestRequired* message_with_required) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(message_with_required_);
+  }
+  if (message_with_required) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(message_with_required)->GetArena();
+    if (message_arena != submessage_arena) {
+      message_with_required = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message_with_required, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  message_with_required_ = message_with_required;
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestLiteImportsNonlite.message_with_required)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5flite_5fimports_5fnonlite_2eproto
@@ -0,0 +1,462 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_optimize_for.proto
+
+#include "google/protobuf/unittest_optimize_for.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ForeignMessage_google_2fprotobuf_2funittest_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestRequiredOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto;
+namespace protobuf_unittest {
+class TestOptimizedForSizeDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestOptimizedForSize> _instance;
+  ::PROTOBUF_NAMESPACE_ID::int32 integer_field_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr string_field_;
+} _TestOptimizedForSize_default_instance_;
+class TestRequiredOptimizedForSizeDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestRequiredOptimizedForSize> _instance;
+} _TestRequiredOptimizedForSize_default_instance_;
+class TestOptionalOptimizedForSizeDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestOptionalOptimizedForSize> _instance;
+} _TestOptionalOptimizedForSize_default_instance_;
+}  // namespace protobuf_unittest
+static void InitDefaultsscc_info_TestOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestOptimizedForSize_default_instance_;
+    new (ptr) ::protobuf_unittest::TestOptimizedForSize();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestOptimizedForSize::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto}, {
+      &scc_info_ForeignMessage_google_2fprotobuf_2funittest_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestOptionalOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestOptionalOptimizedForSize_default_instance_;
+    new (ptr) ::protobuf_unittest::TestOptionalOptimizedForSize();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestOptionalOptimizedForSize::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestOptionalOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestOptionalOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto}, {
+      &scc_info_TestRequiredOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestRequiredOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestRequiredOptimizedForSize_default_instance_;
+    new (ptr) ::protobuf_unittest::TestRequiredOptimizedForSize();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestRequiredOptimizedForSize::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestRequiredOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestRequiredOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto}, {}};
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto[3];
+static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto = nullptr;
+
+const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptimizedForSize, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptimizedForSize, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptimizedForSize, _extensions_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptimizedForSize, _oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptimizedForSize, i_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptimizedForSize, msg_),
+  offsetof(::protobuf_unittest::TestOptimizedForSizeDefaultTypeInternal, integer_field_),
+  offsetof(::protobuf_unittest::TestOptimizedForSizeDefaultTypeInternal, string_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptimizedForSize, foo_),
+  1,
+  0,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRequiredOptimizedForSize, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRequiredOptimizedForSize, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestRequiredOptimizedForSize, x_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptionalOptimizedForSize, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptionalOptimizedForSize, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestOptionalOptimizedForSize, o_),
+  0,
+};
+static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, sizeof(::protobuf_unittest::TestOptimizedForSize)},
+  { 14, 20, sizeof(::protobuf_unittest::TestRequiredOptimizedForSize)},
+  { 21, 27, sizeof(::protobuf_unittest::TestOptionalOptimizedForSize)},
+};
+
+static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_TestOptimizedForSize_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_TestRequiredOptimizedForSize_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_TestOptionalOptimizedForSize_default_instance_),
+};
+
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n+google/protobuf/unittest_optimize_for."
+  "proto\022\021protobuf_unittest\032\036google/protobu"
+  "f/unittest.proto\"\312\002\n\024TestOptimizedForSiz"
+  "e\022\t\n\001i\030\001 \001(\005\022.\n\003msg\030\023 \001(\0132!.protobuf_uni"
+  "ttest.ForeignMessage\022\027\n\rinteger_field\030\002 "
+  "\001(\005H\000\022\026\n\014string_field\030\003 \001(\tH\000*\t\010\350\007\020\200\200\200\200\002"
+  "2@\n\016test_extension\022\'.protobuf_unittest.T"
+  "estOptimizedForSize\030\322\t \001(\0052r\n\017test_exten"
+  "sion2\022\'.protobuf_unittest.TestOptimizedF"
+  "orSize\030\323\t \001(\0132/.protobuf_unittest.TestRe"
+  "quiredOptimizedForSizeB\005\n\003foo\")\n\034TestReq"
+  "uiredOptimizedForSize\022\t\n\001x\030\001 \002(\005\"Z\n\034Test"
+  "OptionalOptimizedForSize\022:\n\001o\030\001 \001(\0132/.pr"
+  "otobuf_unittest.TestRequiredOptimizedFor"
+  "SizeB\002H\002"
+  ;
+static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_deps[1] = {
+  &::descriptor_table_google_2fprotobuf_2funittest_2eproto,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_sccs[3] = {
+  &scc_info_TestOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto.base,
+  &scc_info_TestOptionalOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto.base,
+  &scc_info_TestRequiredOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto.base,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_once;
+const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto = {
+  false, false, descriptor_table_protodef_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto, "google/protobuf/unittest_optimize_for.proto", 568,
+  &descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_once, descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_sccs, descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto_deps, 3, 1,
+  schemas, file_default_instances, TableStruct_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto::offsets,
+  file_level_metadata_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto, 3, file_level_enum_descriptors_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto, file_level_service_descriptors_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto,
+};
+
+// Force running AddDescriptors() at dynamic initialization time.
+static bool dynamic_init_dummy_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto)), true);
+namespace protobuf_unittest {
+
+// ===================================================================
+
+void TestOptimizedForSize::InitAsDefaultInstance() {
+  ::protobuf_unittest::_TestOptimizedForSize_default_instance_._instance.get_mutable()->msg_ = const_cast< ::protobuf_unittest::ForeignMessage*>(
+      ::protobuf_unittest::ForeignMessage::internal_default_instance());
+  ::protobuf_unittest::_TestOptimizedForSize_default_instance_.integer_field_ = 0;
+  ::protobuf_unittest::_TestOptimizedForSize_default_instance_.string_field_.UnsafeSetDefault(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+class TestOptimizedForSize::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestOptimizedForSize>()._has_bits_);
+  static void set_has_i(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::protobuf_unittest::ForeignMessage& msg(const TestOptimizedForSize* msg);
+  static void set_has_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::ForeignMessage&
+TestOptimizedForSize::_Internal::msg(const TestOptimizedForSize* msg) {
+  return *msg->msg_;
+}
+void TestOptimizedForSize::clear_msg() {
+  if (msg_ != nullptr) msg_->Clear();
+  _has_bits_[0] &= ~0x00000001u;
+}
+TestOptimizedForSize::TestOptimizedForSize(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  _extensions_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestOptimizedForSize)
+}
+TestOptimizedForSize::TestOptimizedForSize(const TestOptimizedForSize& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _extensions_.MergeFrom(from._extensions_);
+  if (from._internal_has_msg()) {
+    msg_ = new ::protobuf_unittest::ForeignMessage(*from.msg_);
+  } else {
+    msg_ = nullptr;
+  }
+  i_ = from.i_;
+  clear_has_foo();
+  switch (from.foo_case()) {
+    case kIntegerField: {
+      _internal_set_integer_field(from._internal_integer_field());
+      break;
+    }
+    case kStringField: {
+      _internal_set_string_field(from._internal_string_field());
+      break;
+    }
+    case FOO_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestOptimizedForSize)
+}
+
+void TestOptimizedForSize::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto.base);
+  ::memset(&msg_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&i_) -
+      reinterpret_cast<char*>(&msg_)) + sizeof(i_));
+  clear_has_foo();
+}
+
+TestOptimizedForSize::~TestOptimizedForSize() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestOptimizedForSize)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestOptimizedForSize::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete msg_;
+  if (has_foo()) {
+    clear_foo();
+  }
+}
+
+void TestOptimizedForSize::ArenaDtor(void* object) {
+  TestOptimizedForSize* _this = reinterpret_cast< TestOptimizedForSize* >(object);
+  (void)_this;
+}
+void TestOptimizedForSize::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestOptimizedForSize::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestOptimizedForSize& TestOptimizedForSize::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestOptimizedForSize::clear_foo() {
+// @@protoc_insertion_point(one_of_clear_start:protobuf_unittest.TestOptimizedForSize)
+  switch (foo_case()) {
+    case kIntegerField: {
+      // No need to clear
+      break;
+    }
+    case kStringField: {
+      foo_.string_field_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+      break;
+    }
+    case FOO_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = FOO_NOT_SET;
+}
+
+
+void TestOptimizedForSize::InternalSwap(TestOptimizedForSize* other) {
+  using std::swap;
+  GetReflection()->Swap(this, other);}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestOptimizedForSize::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TestRequiredOptimizedForSize::InitAsDefaultInstance() {
+}
+class TestRequiredOptimizedForSize::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestRequiredOptimizedForSize>()._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+TestRequiredOptimizedForSize::TestRequiredOptimizedForSize(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestRequiredOptimizedForSize)
+}
+TestRequiredOptimizedForSize::TestRequiredOptimizedForSize(const TestRequiredOptimizedForSize& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  x_ = from.x_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestRequiredOptimizedForSize)
+}
+
+void TestRequiredOptimizedForSize::SharedCtor() {
+  x_ = 0;
+}
+
+TestRequiredOptimizedForSize::~TestRequiredOptimizedForSize() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestRequiredOptimizedForSize)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestRequiredOptimizedForSize::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestRequiredOptimizedForSize::ArenaDtor(void* object) {
+  TestRequiredOptimizedForSize* _this = reinterpret_cast< TestRequiredOptimizedForSize* >(object);
+  (void)_this;
+}
+void TestRequiredOptimizedForSize::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestRequiredOptimizedForSize::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestRequiredOptimizedForSize& TestRequiredOptimizedForSize::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestRequiredOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestRequiredOptimizedForSize::InternalSwap(TestRequiredOptimizedForSize* other) {
+  using std::swap;
+  GetReflection()->Swap(this, other);}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestRequiredOptimizedForSize::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TestOptionalOptimizedForSize::InitAsDefaultInstance() {
+  ::protobuf_unittest::_TestOptionalOptimizedForSize_default_instance_._instance.get_mutable()->o_ = const_cast< ::protobuf_unittest::TestRequiredOptimizedForSize*>(
+      ::protobuf_unittest::TestRequiredOptimizedForSize::internal_default_instance());
+}
+class TestOptionalOptimizedForSize::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestOptionalOptimizedForSize>()._has_bits_);
+  static const ::protobuf_unittest::TestRequiredOptimizedForSize& o(const TestOptionalOptimizedForSize* msg);
+  static void set_has_o(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::protobuf_unittest::TestRequiredOptimizedForSize&
+TestOptionalOptimizedForSize::_Internal::o(const TestOptionalOptimizedForSize* msg) {
+  return *msg->o_;
+}
+TestOptionalOptimizedForSize::TestOptionalOptimizedForSize(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestOptionalOptimizedForSize)
+}
+TestOptionalOptimizedForSize::TestOptionalOptimizedForSize(const TestOptionalOptimizedForSize& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_o()) {
+    o_ = new ::protobuf_unittest::TestRequiredOptimizedForSize(*from.o_);
+  } else {
+    o_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestOptionalOptimizedForSize)
+}
+
+void TestOptionalOptimizedForSize::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestOptionalOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto.base);
+  o_ = nullptr;
+}
+
+TestOptionalOptimizedForSize::~TestOptionalOptimizedForSize() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestOptionalOptimizedForSize)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestOptionalOptimizedForSize::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete o_;
+}
+
+void TestOptionalOptimizedForSize::ArenaDtor(void* object) {
+  TestOptionalOptimizedForSize* _this = reinterpret_cast< TestOptionalOptimizedForSize* >(object);
+  (void)_this;
+}
+void TestOptionalOptimizedForSize::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestOptionalOptimizedForSize::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestOptionalOptimizedForSize& TestOptionalOptimizedForSize::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestOptionalOptimizedForSize_google_2fprotobuf_2funittest_5foptimize_5ffor_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestOptionalOptimizedForSize::InternalSwap(TestOptionalOptimizedForSize* other) {
+  using std::swap;
+  GetReflection()->Swap(this, other);}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestOptionalOptimizedForSize::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestOptimizedForSize::kTestExtensionFieldNumber;
+#endif
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestOptimizedForSize,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 5, false >
+  TestOptimizedForSize::test_extension(kTestExtensionFieldNumber, 0);
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestOptimizedForSize::kTestExtension2FieldNumber;
+#endif
+::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::protobuf_unittest::TestOptimizedForSize,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::protobuf_unittest::TestRequiredOptimizedForSize >, 11, false >
+  TestOptimizedForSize::test_extension2(kTestExtension2FieldNumber, ::protobuf_unittest::TestRequiredOptimizedForSize::default_instance());
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestOptimizedForSize* Arena::CreateMaybeMessage< ::protobuf_unittest::TestOptimizedForSize >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestOptimizedForSize >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestRequiredOptimizedForSize* Arena::CreateMaybeMessage< ::protobuf_unittest::TestRequiredOptimizedForSize >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestRequiredOptimizedForSize >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestOptionalOptimizedForSize* Arena::CreateMaybeMessage< ::protobuf_unittest::TestOptionalOptimizedForSize >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestOptionalOptimizedForSize >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
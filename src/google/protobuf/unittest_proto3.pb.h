@@ -0,0 +1,7353 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_proto3.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fproto3_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fproto3_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3012000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3012003 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "google/protobuf/unittest_import.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fproto3_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[9]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto;
+namespace proto3_unittest {
+class ForeignMessage;
+class ForeignMessageDefaultTypeInternal;
+extern ForeignMessageDefaultTypeInternal _ForeignMessage_default_instance_;
+class NestedTestAllTypes;
+class NestedTestAllTypesDefaultTypeInternal;
+extern NestedTestAllTypesDefaultTypeInternal _NestedTestAllTypes_default_instance_;
+class TestAllTypes;
+class TestAllTypesDefaultTypeInternal;
+extern TestAllTypesDefaultTypeInternal _TestAllTypes_default_instance_;
+class TestAllTypes_NestedMessage;
+class TestAllTypes_NestedMessageDefaultTypeInternal;
+extern TestAllTypes_NestedMessageDefaultTypeInternal _TestAllTypes_NestedMessage_default_instance_;
+class TestEmptyMessage;
+class TestEmptyMessageDefaultTypeInternal;
+extern TestEmptyMessageDefaultTypeInternal _TestEmptyMessage_default_instance_;
+class TestMessageWithDummy;
+class TestMessageWithDummyDefaultTypeInternal;
+extern TestMessageWithDummyDefaultTypeInternal _TestMessageWithDummy_default_instance_;
+class TestOneof2;
+class TestOneof2DefaultTypeInternal;
+extern TestOneof2DefaultTypeInternal _TestOneof2_default_instance_;
+class TestPackedTypes;
+class TestPackedTypesDefaultTypeInternal;
+extern TestPackedTypesDefaultTypeInternal _TestPackedTypes_default_instance_;
+class TestUnpackedTypes;
+class TestUnpackedTypesDefaultTypeInternal;
+extern TestUnpackedTypesDefaultTypeInternal _TestUnpackedTypes_default_instance_;
+}  // namespace proto3_unittest
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto3_unittest::ForeignMessage* Arena::CreateMaybeMessage<::proto3_unittest::ForeignMessage>(Arena*);
+template<> ::proto3_unittest::NestedTestAllTypes* Arena::CreateMaybeMessage<::proto3_unittest::NestedTestAllTypes>(Arena*);
+template<> ::proto3_unittest::TestAllTypes* Arena::CreateMaybeMessage<::proto3_unittest::TestAllTypes>(Arena*);
+template<> ::proto3_unittest::TestAllTypes_NestedMessage* Arena::CreateMaybeMessage<::proto3_unittest::TestAllTypes_NestedMessage>(Arena*);
+template<> ::proto3_unittest::TestEmptyMessage* Arena::CreateMaybeMessage<::proto3_unittest::TestEmptyMessage>(Arena*);
+template<> ::proto3_unittest::TestMessageWithDummy* Arena::CreateMaybeMessage<::proto3_unittest::TestMessageWithDummy>(Arena*);
+template<> ::proto3_unittest::TestOneof2* Arena::CreateMaybeMessage<::proto3_unittest::TestOneof2>(Arena*);
+template<> ::proto3_unittest::TestPackedTypes* Arena::CreateMaybeMessage<::proto3_unittest::TestPackedTypes>(Arena*);
+template<> ::proto3_unittest::TestUnpackedTypes* Arena::CreateMaybeMessage<::proto3_unittest::TestUnpackedTypes>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto3_unittest {
+
+enum TestAllTypes_NestedEnum : int {
+  TestAllTypes_NestedEnum_ZERO = 0,
+  TestAllTypes_NestedEnum_FOO = 1,
+  TestAllTypes_NestedEnum_BAR = 2,
+  TestAllTypes_NestedEnum_BAZ = 3,
+  TestAllTypes_NestedEnum_NEG = -1,
+  TestAllTypes_NestedEnum_TestAllTypes_NestedEnum_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
+  TestAllTypes_NestedEnum_TestAllTypes_NestedEnum_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+};
+bool TestAllTypes_NestedEnum_IsValid(int value);
+constexpr TestAllTypes_NestedEnum TestAllTypes_NestedEnum_NestedEnum_MIN = TestAllTypes_NestedEnum_NEG;
+constexpr TestAllTypes_NestedEnum TestAllTypes_NestedEnum_NestedEnum_MAX = TestAllTypes_NestedEnum_BAZ;
+constexpr int TestAllTypes_NestedEnum_NestedEnum_ARRAYSIZE = TestAllTypes_NestedEnum_NestedEnum_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TestAllTypes_NestedEnum_descriptor();
+template<typename T>
+inline const std::string& TestAllTypes_NestedEnum_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TestAllTypes_NestedEnum>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TestAllTypes_NestedEnum_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TestAllTypes_NestedEnum_descriptor(), enum_t_value);
+}
+inline bool TestAllTypes_NestedEnum_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TestAllTypes_NestedEnum* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TestAllTypes_NestedEnum>(
+    TestAllTypes_NestedEnum_descriptor(), name, value);
+}
+enum TestOneof2_NestedEnum : int {
+  TestOneof2_NestedEnum_UNKNOWN = 0,
+  TestOneof2_NestedEnum_FOO = 1,
+  TestOneof2_NestedEnum_BAR = 2,
+  TestOneof2_NestedEnum_BAZ = 3,
+  TestOneof2_NestedEnum_TestOneof2_NestedEnum_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
+  TestOneof2_NestedEnum_TestOneof2_NestedEnum_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+};
+bool TestOneof2_NestedEnum_IsValid(int value);
+constexpr TestOneof2_NestedEnum TestOneof2_NestedEnum_NestedEnum_MIN = TestOneof2_NestedEnum_UNKNOWN;
+constexpr TestOneof2_NestedEnum TestOneof2_NestedEnum_NestedEnum_MAX = TestOneof2_NestedEnum_BAZ;
+constexpr int TestOneof2_NestedEnum_NestedEnum_ARRAYSIZE = TestOneof2_NestedEnum_NestedEnum_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TestOneof2_NestedEnum_descriptor();
+template<typename T>
+inline const std::string& TestOneof2_NestedEnum_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TestOneof2_NestedEnum>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TestOneof2_NestedEnum_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TestOneof2_NestedEnum_descriptor(), enum_t_value);
+}
+inline bool TestOneof2_NestedEnum_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TestOneof2_NestedEnum* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TestOneof2_NestedEnum>(
+    TestOneof2_NestedEnum_descriptor(), name, value);
+}
+enum ForeignEnum : int {
+  FOREIGN_ZERO = 0,
+  FOREIGN_FOO = 4,
+  FOREIGN_BAR = 5,
+  FOREIGN_BAZ = 6,
+  ForeignEnum_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
+  ForeignEnum_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+};
+bool ForeignEnum_IsValid(int value);
+constexpr ForeignEnum ForeignEnum_MIN = FOREIGN_ZERO;
+constexpr ForeignEnum ForeignEnum_MAX = FOREIGN_BAZ;
+constexpr int ForeignEnum_ARRAYSIZE = ForeignEnum_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ForeignEnum_descriptor();
+template<typename T>
+inline const std::string& ForeignEnum_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ForeignEnum>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ForeignEnum_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ForeignEnum_descriptor(), enum_t_value);
+}
+inline bool ForeignEnum_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ForeignEnum* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ForeignEnum>(
+    ForeignEnum_descriptor(), name, value);
+}
+// ===================================================================
+
+class TestAllTypes_NestedMessage PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.TestAllTypes.NestedMessage) */ {
+ public:
+  inline TestAllTypes_NestedMessage() : TestAllTypes_NestedMessage(nullptr) {};
+  virtual ~TestAllTypes_NestedMessage();
+
+  TestAllTypes_NestedMessage(const TestAllTypes_NestedMessage& from);
+  TestAllTypes_NestedMessage(TestAllTypes_NestedMessage&& from) noexcept
+    : TestAllTypes_NestedMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline TestAllTypes_NestedMessage& operator=(const TestAllTypes_NestedMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestAllTypes_NestedMessage& operator=(TestAllTypes_NestedMessage&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestAllTypes_NestedMessage& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestAllTypes_NestedMessage* internal_default_instance() {
+    return reinterpret_cast<const TestAllTypes_NestedMessage*>(
+               &_TestAllTypes_NestedMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TestAllTypes_NestedMessage& a, TestAllTypes_NestedMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestAllTypes_NestedMessage* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestAllTypes_NestedMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestAllTypes_NestedMessage* New() const final {
+    return CreateMaybeMessage<TestAllTypes_NestedMessage>(nullptr);
+  }
+
+  TestAllTypes_NestedMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestAllTypes_NestedMessage>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestAllTypes_NestedMessage& from);
+  void MergeFrom(const TestAllTypes_NestedMessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestAllTypes_NestedMessage* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto3_unittest.TestAllTypes.NestedMessage";
+  }
+  protected:
+  explicit TestAllTypes_NestedMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBbFieldNumber = 1,
+  };
+  // int32 bb = 1;
+  void clear_bb();
+  ::PROTOBUF_NAMESPACE_ID::int32 bb() const;
+  void set_bb(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_bb() const;
+  void _internal_set_bb(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto3_unittest.TestAllTypes.NestedMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::int32 bb_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestAllTypes PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.TestAllTypes) */ {
+ public:
+  inline TestAllTypes() : TestAllTypes(nullptr) {};
+  virtual ~TestAllTypes();
+
+  TestAllTypes(const TestAllTypes& from);
+  TestAllTypes(TestAllTypes&& from) noexcept
+    : TestAllTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline TestAllTypes& operator=(const TestAllTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestAllTypes& operator=(TestAllTypes&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestAllTypes& default_instance();
+
+  enum OneofFieldCase {
+    kOneofUint32 = 111,
+    kOneofNestedMessage = 112,
+    kOneofString = 113,
+    kOneofBytes = 114,
+    ONEOF_FIELD_NOT_SET = 0,
+  };
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestAllTypes* internal_default_instance() {
+    return reinterpret_cast<const TestAllTypes*>(
+               &_TestAllTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(TestAllTypes& a, TestAllTypes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestAllTypes* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestAllTypes* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestAllTypes* New() const final {
+    return CreateMaybeMessage<TestAllTypes>(nullptr);
+  }
+
+  TestAllTypes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestAllTypes>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestAllTypes& from);
+  void MergeFrom(const TestAllTypes& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestAllTypes* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto3_unittest.TestAllTypes";
+  }
+  protected:
+  explicit TestAllTypes(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  typedef TestAllTypes_NestedMessage NestedMessage;
+
+  typedef TestAllTypes_NestedEnum NestedEnum;
+  static constexpr NestedEnum ZERO =
+    TestAllTypes_NestedEnum_ZERO;
+  static constexpr NestedEnum FOO =
+    TestAllTypes_NestedEnum_FOO;
+  static constexpr NestedEnum BAR =
+    TestAllTypes_NestedEnum_BAR;
+  static constexpr NestedEnum BAZ =
+    TestAllTypes_NestedEnum_BAZ;
+  static constexpr NestedEnum NEG =
+    TestAllTypes_NestedEnum_NEG;
+  static inline bool NestedEnum_IsValid(int value) {
+    return TestAllTypes_NestedEnum_IsValid(value);
+  }
+  static constexpr NestedEnum NestedEnum_MIN =
+    TestAllTypes_NestedEnum_NestedEnum_MIN;
+  static constexpr NestedEnum NestedEnum_MAX =
+    TestAllTypes_NestedEnum_NestedEnum_MAX;
+  static constexpr int NestedEnum_ARRAYSIZE =
+    TestAllTypes_NestedEnum_NestedEnum_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  NestedEnum_descriptor() {
+    return TestAllTypes_NestedEnum_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& NestedEnum_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, NestedEnum>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function NestedEnum_Name.");
+    return TestAllTypes_NestedEnum_Name(enum_t_value);
+  }
+  static inline bool NestedEnum_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      NestedEnum* value) {
+    return TestAllTypes_NestedEnum_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedInt32FieldNumber = 31,
+    kRepeatedInt64FieldNumber = 32,
+    kRepeatedUint32FieldNumber = 33,
+    kRepeatedUint64FieldNumber = 34,
+    kRepeatedSint32FieldNumber = 35,
+    kRepeatedSint64FieldNumber = 36,
+    kRepeatedFixed32FieldNumber = 37,
+    kRepeatedFixed64FieldNumber = 38,
+    kRepeatedSfixed32FieldNumber = 39,
+    kRepeatedSfixed64FieldNumber = 40,
+    kRepeatedFloatFieldNumber = 41,
+    kRepeatedDoubleFieldNumber = 42,
+    kRepeatedBoolFieldNumber = 43,
+    kRepeatedStringFieldNumber = 44,
+    kRepeatedBytesFieldNumber = 45,
+    kRepeatedNestedMessageFieldNumber = 48,
+    kRepeatedForeignMessageFieldNumber = 49,
+    kRepeatedImportMessageFieldNumber = 50,
+    kRepeatedNestedEnumFieldNumber = 51,
+    kRepeatedForeignEnumFieldNumber = 52,
+    kRepeatedStringPieceFieldNumber = 54,
+    kRepeatedCordFieldNumber = 55,
+    kRepeatedLazyMessageFieldNumber = 57,
+    kOptionalStringFieldNumber = 14,
+    kOptionalBytesFieldNumber = 15,
+    kOptionalStringPieceFieldNumber = 24,
+    kOptionalCordFieldNumber = 25,
+    kOptionalNestedMessageFieldNumber = 18,
+    kOptionalForeignMessageFieldNumber = 19,
+    kOptionalImportMessageFieldNumber = 20,
+    kOptionalPublicImportMessageFieldNumber = 26,
+    kOptionalLazyMessageFieldNumber = 27,
+    kOptionalLazyImportMessageFieldNumber = 115,
+    kOptionalInt64FieldNumber = 2,
+    kOptionalInt32FieldNumber = 1,
+    kOptionalUint32FieldNumber = 3,
+    kOptionalUint64FieldNumber = 4,
+    kOptionalSint64FieldNumber = 6,
+    kOptionalSint32FieldNumber = 5,
+    kOptionalFixed32FieldNumber = 7,
+    kOptionalFixed64FieldNumber = 8,
+    kOptionalSfixed64FieldNumber = 10,
+    kOptionalSfixed32FieldNumber = 9,
+    kOptionalFloatFieldNumber = 11,
+    kOptionalDoubleFieldNumber = 12,
+    kOptionalBoolFieldNumber = 13,
+    kOptionalNestedEnumFieldNumber = 21,
+    kOptionalForeignEnumFieldNumber = 22,
+    kOneofUint32FieldNumber = 111,
+    kOneofNestedMessageFieldNumber = 112,
+    kOneofStringFieldNumber = 113,
+    kOneofBytesFieldNumber = 114,
+  };
+  // repeated int32 repeated_int32 = 31;
+  int repeated_int32_size() const;
+  private:
+  int _internal_repeated_int32_size() const;
+  public:
+  void clear_repeated_int32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_repeated_int32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_repeated_int32() const;
+  void _internal_add_repeated_int32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_repeated_int32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 repeated_int32(int index) const;
+  void set_repeated_int32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_repeated_int32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      repeated_int32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_repeated_int32();
+
+  // repeated int64 repeated_int64 = 32;
+  int repeated_int64_size() const;
+  private:
+  int _internal_repeated_int64_size() const;
+  public:
+  void clear_repeated_int64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_repeated_int64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_repeated_int64() const;
+  void _internal_add_repeated_int64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_repeated_int64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 repeated_int64(int index) const;
+  void set_repeated_int64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_repeated_int64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      repeated_int64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_repeated_int64();
+
+  // repeated uint32 repeated_uint32 = 33;
+  int repeated_uint32_size() const;
+  private:
+  int _internal_repeated_uint32_size() const;
+  public:
+  void clear_repeated_uint32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_repeated_uint32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_repeated_uint32() const;
+  void _internal_add_repeated_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_repeated_uint32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 repeated_uint32(int index) const;
+  void set_repeated_uint32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_repeated_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      repeated_uint32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_repeated_uint32();
+
+  // repeated uint64 repeated_uint64 = 34;
+  int repeated_uint64_size() const;
+  private:
+  int _internal_repeated_uint64_size() const;
+  public:
+  void clear_repeated_uint64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_repeated_uint64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_repeated_uint64() const;
+  void _internal_add_repeated_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_repeated_uint64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint64 repeated_uint64(int index) const;
+  void set_repeated_uint64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_repeated_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      repeated_uint64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_repeated_uint64();
+
+  // repeated sint32 repeated_sint32 = 35;
+  int repeated_sint32_size() const;
+  private:
+  int _internal_repeated_sint32_size() const;
+  public:
+  void clear_repeated_sint32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_repeated_sint32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_repeated_sint32() const;
+  void _internal_add_repeated_sint32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_repeated_sint32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 repeated_sint32(int index) const;
+  void set_repeated_sint32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_repeated_sint32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      repeated_sint32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_repeated_sint32();
+
+  // repeated sint64 repeated_sint64 = 36;
+  int repeated_sint64_size() const;
+  private:
+  int _internal_repeated_sint64_size() const;
+  public:
+  void clear_repeated_sint64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_repeated_sint64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_repeated_sint64() const;
+  void _internal_add_repeated_sint64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_repeated_sint64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 repeated_sint64(int index) const;
+  void set_repeated_sint64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_repeated_sint64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      repeated_sint64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_repeated_sint64();
+
+  // repeated fixed32 repeated_fixed32 = 37;
+  int repeated_fixed32_size() const;
+  private:
+  int _internal_repeated_fixed32_size() const;
+  public:
+  void clear_repeated_fixed32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_repeated_fixed32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_repeated_fixed32() const;
+  void _internal_add_repeated_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_repeated_fixed32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 repeated_fixed32(int index) const;
+  void set_repeated_fixed32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_repeated_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      repeated_fixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_repeated_fixed32();
+
+  // repeated fixed64 repeated_fixed64 = 38;
+  int repeated_fixed64_size() const;
+  private:
+  int _internal_repeated_fixed64_size() const;
+  public:
+  void clear_repeated_fixed64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_repeated_fixed64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_repeated_fixed64() const;
+  void _internal_add_repeated_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_repeated_fixed64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint64 repeated_fixed64(int index) const;
+  void set_repeated_fixed64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_repeated_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      repeated_fixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_repeated_fixed64();
+
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  int repeated_sfixed32_size() const;
+  private:
+  int _internal_repeated_sfixed32_size() const;
+  public:
+  void clear_repeated_sfixed32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_repeated_sfixed32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_repeated_sfixed32() const;
+  void _internal_add_repeated_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_repeated_sfixed32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 repeated_sfixed32(int index) const;
+  void set_repeated_sfixed32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_repeated_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      repeated_sfixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_repeated_sfixed32();
+
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  int repeated_sfixed64_size() const;
+  private:
+  int _internal_repeated_sfixed64_size() const;
+  public:
+  void clear_repeated_sfixed64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_repeated_sfixed64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_repeated_sfixed64() const;
+  void _internal_add_repeated_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_repeated_sfixed64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 repeated_sfixed64(int index) const;
+  void set_repeated_sfixed64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_repeated_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      repeated_sfixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_repeated_sfixed64();
+
+  // repeated float repeated_float = 41;
+  int repeated_float_size() const;
+  private:
+  int _internal_repeated_float_size() const;
+  public:
+  void clear_repeated_float();
+  private:
+  float _internal_repeated_float(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_repeated_float() const;
+  void _internal_add_repeated_float(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_repeated_float();
+  public:
+  float repeated_float(int index) const;
+  void set_repeated_float(int index, float value);
+  void add_repeated_float(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      repeated_float() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_repeated_float();
+
+  // repeated double repeated_double = 42;
+  int repeated_double_size() const;
+  private:
+  int _internal_repeated_double_size() const;
+  public:
+  void clear_repeated_double();
+  private:
+  double _internal_repeated_double(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_repeated_double() const;
+  void _internal_add_repeated_double(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_repeated_double();
+  public:
+  double repeated_double(int index) const;
+  void set_repeated_double(int index, double value);
+  void add_repeated_double(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      repeated_double() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_repeated_double();
+
+  // repeated bool repeated_bool = 43;
+  int repeated_bool_size() const;
+  private:
+  int _internal_repeated_bool_size() const;
+  public:
+  void clear_repeated_bool();
+  private:
+  bool _internal_repeated_bool(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      _internal_repeated_bool() const;
+  void _internal_add_repeated_bool(bool value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      _internal_mutable_repeated_bool();
+  public:
+  bool repeated_bool(int index) const;
+  void set_repeated_bool(int index, bool value);
+  void add_repeated_bool(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      repeated_bool() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_repeated_bool();
+
+  // repeated string repeated_string = 44;
+  int repeated_string_size() const;
+  private:
+  int _internal_repeated_string_size() const;
+  public:
+  void clear_repeated_string();
+  const std::string& repeated_string(int index) const;
+  std::string* mutable_repeated_string(int index);
+  void set_repeated_string(int index, const std::string& value);
+  void set_repeated_string(int index, std::string&& value);
+  void set_repeated_string(int index, const char* value);
+  void set_repeated_string(int index, const char* value, size_t size);
+  std::string* add_repeated_string();
+  void add_repeated_string(const std::string& value);
+  void add_repeated_string(std::string&& value);
+  void add_repeated_string(const char* value);
+  void add_repeated_string(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& repeated_string() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_repeated_string();
+  private:
+  const std::string& _internal_repeated_string(int index) const;
+  std::string* _internal_add_repeated_string();
+  public:
+
+  // repeated bytes repeated_bytes = 45;
+  int repeated_bytes_size() const;
+  private:
+  int _internal_repeated_bytes_size() const;
+  public:
+  void clear_repeated_bytes();
+  const std::string& repeated_bytes(int index) const;
+  std::string* mutable_repeated_bytes(int index);
+  void set_repeated_bytes(int index, const std::string& value);
+  void set_repeated_bytes(int index, std::string&& value);
+  void set_repeated_bytes(int index, const char* value);
+  void set_repeated_bytes(int index, const void* value, size_t size);
+  std::string* add_repeated_bytes();
+  void add_repeated_bytes(const std::string& value);
+  void add_repeated_bytes(std::string&& value);
+  void add_repeated_bytes(const char* value);
+  void add_repeated_bytes(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& repeated_bytes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_repeated_bytes();
+  private:
+  const std::string& _internal_repeated_bytes(int index) const;
+  std::string* _internal_add_repeated_bytes();
+  public:
+
+  // repeated .proto3_unittest.TestAllTypes.NestedMessage repeated_nested_message = 48;
+  int repeated_nested_message_size() const;
+  private:
+  int _internal_repeated_nested_message_size() const;
+  public:
+  void clear_repeated_nested_message();
+  ::proto3_unittest::TestAllTypes_NestedMessage* mutable_repeated_nested_message(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage >*
+      mutable_repeated_nested_message();
+  private:
+  const ::proto3_unittest::TestAllTypes_NestedMessage& _internal_repeated_nested_message(int index) const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* _internal_add_repeated_nested_message();
+  public:
+  const ::proto3_unittest::TestAllTypes_NestedMessage& repeated_nested_message(int index) const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* add_repeated_nested_message();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage >&
+      repeated_nested_message() const;
+
+  // repeated .proto3_unittest.ForeignMessage repeated_foreign_message = 49;
+  int repeated_foreign_message_size() const;
+  private:
+  int _internal_repeated_foreign_message_size() const;
+  public:
+  void clear_repeated_foreign_message();
+  ::proto3_unittest::ForeignMessage* mutable_repeated_foreign_message(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto3_unittest::ForeignMessage >*
+      mutable_repeated_foreign_message();
+  private:
+  const ::proto3_unittest::ForeignMessage& _internal_repeated_foreign_message(int index) const;
+  ::proto3_unittest::ForeignMessage* _internal_add_repeated_foreign_message();
+  public:
+  const ::proto3_unittest::ForeignMessage& repeated_foreign_message(int index) const;
+  ::proto3_unittest::ForeignMessage* add_repeated_foreign_message();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto3_unittest::ForeignMessage >&
+      repeated_foreign_message() const;
+
+  // repeated .protobuf_unittest_import.ImportMessage repeated_import_message = 50;
+  int repeated_import_message_size() const;
+  private:
+  int _internal_repeated_import_message_size() const;
+  public:
+  void clear_repeated_import_message();
+  ::protobuf_unittest_import::ImportMessage* mutable_repeated_import_message(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest_import::ImportMessage >*
+      mutable_repeated_import_message();
+  private:
+  const ::protobuf_unittest_import::ImportMessage& _internal_repeated_import_message(int index) const;
+  ::protobuf_unittest_import::ImportMessage* _internal_add_repeated_import_message();
+  public:
+  const ::protobuf_unittest_import::ImportMessage& repeated_import_message(int index) const;
+  ::protobuf_unittest_import::ImportMessage* add_repeated_import_message();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest_import::ImportMessage >&
+      repeated_import_message() const;
+
+  // repeated .proto3_unittest.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+  int repeated_nested_enum_size() const;
+  private:
+  int _internal_repeated_nested_enum_size() const;
+  public:
+  void clear_repeated_nested_enum();
+  private:
+  ::proto3_unittest::TestAllTypes_NestedEnum _internal_repeated_nested_enum(int index) const;
+  void _internal_add_repeated_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_repeated_nested_enum();
+  public:
+  ::proto3_unittest::TestAllTypes_NestedEnum repeated_nested_enum(int index) const;
+  void set_repeated_nested_enum(int index, ::proto3_unittest::TestAllTypes_NestedEnum value);
+  void add_repeated_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& repeated_nested_enum() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_repeated_nested_enum();
+
+  // repeated .proto3_unittest.ForeignEnum repeated_foreign_enum = 52;
+  int repeated_foreign_enum_size() const;
+  private:
+  int _internal_repeated_foreign_enum_size() const;
+  public:
+  void clear_repeated_foreign_enum();
+  private:
+  ::proto3_unittest::ForeignEnum _internal_repeated_foreign_enum(int index) const;
+  void _internal_add_repeated_foreign_enum(::proto3_unittest::ForeignEnum value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_repeated_foreign_enum();
+  public:
+  ::proto3_unittest::ForeignEnum repeated_foreign_enum(int index) const;
+  void set_repeated_foreign_enum(int index, ::proto3_unittest::ForeignEnum value);
+  void add_repeated_foreign_enum(::proto3_unittest::ForeignEnum value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& repeated_foreign_enum() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_repeated_foreign_enum();
+
+  // repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+  int repeated_string_piece_size() const;
+  private:
+  int _internal_repeated_string_piece_size() const;
+  public:
+  void clear_repeated_string_piece();
+ private:
+  // Hidden due to unknown ctype option.
+  const std::string& repeated_string_piece(int index) const;
+  std::string* mutable_repeated_string_piece(int index);
+  void set_repeated_string_piece(int index, const std::string& value);
+  void set_repeated_string_piece(int index, std::string&& value);
+  void set_repeated_string_piece(int index, const char* value);
+  void set_repeated_string_piece(int index, const char* value, size_t size);
+  std::string* add_repeated_string_piece();
+  void add_repeated_string_piece(const std::string& value);
+  void add_repeated_string_piece(std::string&& value);
+  void add_repeated_string_piece(const char* value);
+  void add_repeated_string_piece(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& repeated_string_piece() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_repeated_string_piece();
+  private:
+  const std::string& _internal_repeated_string_piece(int index) const;
+  std::string* _internal_add_repeated_string_piece();
+  public:
+ public:
+
+  // repeated string repeated_cord = 55 [ctype = CORD];
+  int repeated_cord_size() const;
+  private:
+  int _internal_repeated_cord_size() const;
+  public:
+  void clear_repeated_cord();
+ private:
+  // Hidden due to unknown ctype option.
+  const std::string& repeated_cord(int index) const;
+  std::string* mutable_repeated_cord(int index);
+  void set_repeated_cord(int index, const std::string& value);
+  void set_repeated_cord(int index, std::string&& value);
+  void set_repeated_cord(int index, const char* value);
+  void set_repeated_cord(int index, const char* value, size_t size);
+  std::string* add_repeated_cord();
+  void add_repeated_cord(const std::string& value);
+  void add_repeated_cord(std::string&& value);
+  void add_repeated_cord(const char* value);
+  void add_repeated_cord(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& repeated_cord() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_repeated_cord();
+  private:
+  const std::string& _internal_repeated_cord(int index) const;
+  std::string* _internal_add_repeated_cord();
+  public:
+ public:
+
+  // repeated .proto3_unittest.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+  int repeated_lazy_message_size() const;
+  private:
+  int _internal_repeated_lazy_message_size() const;
+  public:
+  void clear_repeated_lazy_message();
+  ::proto3_unittest::TestAllTypes_NestedMessage* mutable_repeated_lazy_message(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage >*
+      mutable_repeated_lazy_message();
+  private:
+  const ::proto3_unittest::TestAllTypes_NestedMessage& _internal_repeated_lazy_message(int index) const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* _internal_add_repeated_lazy_message();
+  public:
+  const ::proto3_unittest::TestAllTypes_NestedMessage& repeated_lazy_message(int index) const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* add_repeated_lazy_message();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage >&
+      repeated_lazy_message() const;
+
+  // string optional_string = 14;
+  void clear_optional_string();
+  const std::string& optional_string() const;
+  void set_optional_string(const std::string& value);
+  void set_optional_string(std::string&& value);
+  void set_optional_string(const char* value);
+  void set_optional_string(const char* value, size_t size);
+  std::string* mutable_optional_string();
+  std::string* release_optional_string();
+  void set_allocated_optional_string(std::string* optional_string);
+  private:
+  const std::string& _internal_optional_string() const;
+  void _internal_set_optional_string(const std::string& value);
+  std::string* _internal_mutable_optional_string();
+  public:
+
+  // bytes optional_bytes = 15;
+  void clear_optional_bytes();
+  const std::string& optional_bytes() const;
+  void set_optional_bytes(const std::string& value);
+  void set_optional_bytes(std::string&& value);
+  void set_optional_bytes(const char* value);
+  void set_optional_bytes(const void* value, size_t size);
+  std::string* mutable_optional_bytes();
+  std::string* release_optional_bytes();
+  void set_allocated_optional_bytes(std::string* optional_bytes);
+  private:
+  const std::string& _internal_optional_bytes() const;
+  void _internal_set_optional_bytes(const std::string& value);
+  std::string* _internal_mutable_optional_bytes();
+  public:
+
+  // string optional_string_piece = 24 [ctype = STRING_PIECE];
+  void clear_optional_string_piece();
+ private:
+  // Hidden due to unknown ctype option.
+  const std::string& optional_string_piece() const;
+  void set_optional_string_piece(const std::string& value);
+  void set_optional_string_piece(std::string&& value);
+  void set_optional_string_piece(const char* value);
+  void set_optional_string_piece(const char* value, size_t size);
+  std::string* mutable_optional_string_piece();
+  std::string* release_optional_string_piece();
+  void set_allocated_optional_string_piece(std::string* optional_string_piece);
+  private:
+  const std::string& _internal_optional_string_piece() const;
+  void _internal_set_optional_string_piece(const std::string& value);
+  std::string* _internal_mutable_optional_string_piece();
+  public:
+ public:
+
+  // string optional_cord = 25 [ctype = CORD];
+  void clear_optional_cord();
+ private:
+  // Hidden due to unknown ctype option.
+  const std::string& optional_cord() const;
+  void set_optional_cord(const std::string& value);
+  void set_optional_cord(std::string&& value);
+  void set_optional_cord(const char* value);
+  void set_optional_cord(const char* value, size_t size);
+  std::string* mutable_optional_cord();
+  std::string* release_optional_cord();
+  void set_allocated_optional_cord(std::string* optional_cord);
+  private:
+  const std::string& _internal_optional_cord() const;
+  void _internal_set_optional_cord(const std::string& value);
+  std::string* _internal_mutable_optional_cord();
+  public:
+ public:
+
+  // .proto3_unittest.TestAllTypes.NestedMessage optional_nested_message = 18;
+  bool has_optional_nested_message() const;
+  private:
+  bool _internal_has_optional_nested_message() const;
+  public:
+  void clear_optional_nested_message();
+  const ::proto3_unittest::TestAllTypes_NestedMessage& optional_nested_message() const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* release_optional_nested_message();
+  ::proto3_unittest::TestAllTypes_NestedMessage* mutable_optional_nested_message();
+  void set_allocated_optional_nested_message(::proto3_unittest::TestAllTypes_NestedMessage* optional_nested_message);
+  private:
+  const ::proto3_unittest::TestAllTypes_NestedMessage& _internal_optional_nested_message() const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* _internal_mutable_optional_nested_message();
+  public:
+  void unsafe_arena_set_allocated_optional_nested_message(
+      ::proto3_unittest::TestAllTypes_NestedMessage* optional_nested_message);
+  ::proto3_unittest::TestAllTypes_NestedMessage* unsafe_arena_release_optional_nested_message();
+
+  // .proto3_unittest.ForeignMessage optional_foreign_message = 19;
+  bool has_optional_foreign_message() const;
+  private:
+  bool _internal_has_optional_foreign_message() const;
+  public:
+  void clear_optional_foreign_message();
+  const ::proto3_unittest::ForeignMessage& optional_foreign_message() const;
+  ::proto3_unittest::ForeignMessage* release_optional_foreign_message();
+  ::proto3_unittest::ForeignMessage* mutable_optional_foreign_message();
+  void set_allocated_optional_foreign_message(::proto3_unittest::ForeignMessage* optional_foreign_message);
+  private:
+  const ::proto3_unittest::ForeignMessage& _internal_optional_foreign_message() const;
+  ::proto3_unittest::ForeignMessage* _internal_mutable_optional_foreign_message();
+  public:
+  void unsafe_arena_set_allocated_optional_foreign_message(
+      ::proto3_unittest::ForeignMessage* optional_foreign_message);
+  ::proto3_unittest::ForeignMessage* unsafe_arena_release_optional_foreign_message();
+
+  // .protobuf_unittest_import.ImportMessage optional_import_message = 20;
+  bool has_optional_import_message() const;
+  private:
+  bool _internal_has_optional_import_message() const;
+  public:
+  void clear_optional_import_message();
+  const ::protobuf_unittest_import::ImportMessage& optional_import_message() const;
+  ::protobuf_unittest_import::ImportMessage* release_optional_import_message();
+  ::protobuf_unittest_import::ImportMessage* mutable_optional_import_message();
+  void set_allocated_optional_import_message(::protobuf_unittest_import::ImportMessage* optional_import_message);
+  private:
+  const ::protobuf_unittest_import::ImportMessage& _internal_optional_import_message() const;
+  ::protobuf_unittest_import::ImportMessage* _internal_mutable_optional_import_message();
+  public:
+  void unsafe_arena_set_allocated_optional_import_message(
+      ::protobuf_unittest_import::ImportMessage* optional_import_message);
+  ::protobuf_unittest_import::ImportMessage* unsafe_arena_release_optional_import_message();
+
+  // .protobuf_unittest_import.PublicImportMessage optional_public_import_message = 26;
+  bool has_optional_public_import_message() const;
+  private:
+  bool _internal_has_optional_public_import_message() const;
+  public:
+  void clear_optional_public_import_message();
+  const ::protobuf_unittest_import::PublicImportMessage& optional_public_import_message() const;
+  ::protobuf_unittest_import::PublicImportMessage* release_optional_public_import_message();
+  ::protobuf_unittest_import::PublicImportMessage* mutable_optional_public_import_message();
+  void set_allocated_optional_public_import_message(::protobuf_unittest_import::PublicImportMessage* optional_public_import_message);
+  private:
+  const ::protobuf_unittest_import::PublicImportMessage& _internal_optional_public_import_message() const;
+  ::protobuf_unittest_import::PublicImportMessage* _internal_mutable_optional_public_import_message();
+  public:
+  void unsafe_arena_set_allocated_optional_public_import_message(
+      ::protobuf_unittest_import::PublicImportMessage* optional_public_import_message);
+  ::protobuf_unittest_import::PublicImportMessage* unsafe_arena_release_optional_public_import_message();
+
+  // .proto3_unittest.TestAllTypes.NestedMessage optional_lazy_message = 27 [lazy = true];
+  bool has_optional_lazy_message() const;
+  private:
+  bool _internal_has_optional_lazy_message() const;
+  public:
+  void clear_optional_lazy_message();
+  const ::proto3_unittest::TestAllTypes_NestedMessage& optional_lazy_message() const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* release_optional_lazy_message();
+  ::proto3_unittest::TestAllTypes_NestedMessage* mutable_optional_lazy_message();
+  void set_allocated_optional_lazy_message(::proto3_unittest::TestAllTypes_NestedMessage* optional_lazy_message);
+  private:
+  const ::proto3_unittest::TestAllTypes_NestedMessage& _internal_optional_lazy_message() const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* _internal_mutable_optional_lazy_message();
+  public:
+  void unsafe_arena_set_allocated_optional_lazy_message(
+      ::proto3_unittest::TestAllTypes_NestedMessage* optional_lazy_message);
+  ::proto3_unittest::TestAllTypes_NestedMessage* unsafe_arena_release_optional_lazy_message();
+
+  // .protobuf_unittest_import.ImportMessage optional_lazy_import_message = 115 [lazy = true];
+  bool has_optional_lazy_import_message() const;
+  private:
+  bool _internal_has_optional_lazy_import_message() const;
+  public:
+  void clear_optional_lazy_import_message();
+  const ::protobuf_unittest_import::ImportMessage& optional_lazy_import_message() const;
+  ::protobuf_unittest_import::ImportMessage* release_optional_lazy_import_message();
+  ::protobuf_unittest_import::ImportMessage* mutable_optional_lazy_import_message();
+  void set_allocated_optional_lazy_import_message(::protobuf_unittest_import::ImportMessage* optional_lazy_import_message);
+  private:
+  const ::protobuf_unittest_import::ImportMessage& _internal_optional_lazy_import_message() const;
+  ::protobuf_unittest_import::ImportMessage* _internal_mutable_optional_lazy_import_message();
+  public:
+  void unsafe_arena_set_allocated_optional_lazy_import_message(
+      ::protobuf_unittest_import::ImportMessage* optional_lazy_import_message);
+  ::protobuf_unittest_import::ImportMessage* unsafe_arena_release_optional_lazy_import_message();
+
+  // int64 optional_int64 = 2;
+  void clear_optional_int64();
+  ::PROTOBUF_NAMESPACE_ID::int64 optional_int64() const;
+  void set_optional_int64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_optional_int64() const;
+  void _internal_set_optional_int64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  public:
+
+  // int32 optional_int32 = 1;
+  void clear_optional_int32();
+  ::PROTOBUF_NAMESPACE_ID::int32 optional_int32() const;
+  void set_optional_int32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_optional_int32() const;
+  void _internal_set_optional_int32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // uint32 optional_uint32 = 3;
+  void clear_optional_uint32();
+  ::PROTOBUF_NAMESPACE_ID::uint32 optional_uint32() const;
+  void set_optional_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_optional_uint32() const;
+  void _internal_set_optional_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint64 optional_uint64 = 4;
+  void clear_optional_uint64();
+  ::PROTOBUF_NAMESPACE_ID::uint64 optional_uint64() const;
+  void set_optional_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_optional_uint64() const;
+  void _internal_set_optional_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // sint64 optional_sint64 = 6;
+  void clear_optional_sint64();
+  ::PROTOBUF_NAMESPACE_ID::int64 optional_sint64() const;
+  void set_optional_sint64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_optional_sint64() const;
+  void _internal_set_optional_sint64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  public:
+
+  // sint32 optional_sint32 = 5;
+  void clear_optional_sint32();
+  ::PROTOBUF_NAMESPACE_ID::int32 optional_sint32() const;
+  void set_optional_sint32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_optional_sint32() const;
+  void _internal_set_optional_sint32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // fixed32 optional_fixed32 = 7;
+  void clear_optional_fixed32();
+  ::PROTOBUF_NAMESPACE_ID::uint32 optional_fixed32() const;
+  void set_optional_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_optional_fixed32() const;
+  void _internal_set_optional_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // fixed64 optional_fixed64 = 8;
+  void clear_optional_fixed64();
+  ::PROTOBUF_NAMESPACE_ID::uint64 optional_fixed64() const;
+  void set_optional_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_optional_fixed64() const;
+  void _internal_set_optional_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // sfixed64 optional_sfixed64 = 10;
+  void clear_optional_sfixed64();
+  ::PROTOBUF_NAMESPACE_ID::int64 optional_sfixed64() const;
+  void set_optional_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_optional_sfixed64() const;
+  void _internal_set_optional_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  public:
+
+  // sfixed32 optional_sfixed32 = 9;
+  void clear_optional_sfixed32();
+  ::PROTOBUF_NAMESPACE_ID::int32 optional_sfixed32() const;
+  void set_optional_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_optional_sfixed32() const;
+  void _internal_set_optional_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // float optional_float = 11;
+  void clear_optional_float();
+  float optional_float() const;
+  void set_optional_float(float value);
+  private:
+  float _internal_optional_float() const;
+  void _internal_set_optional_float(float value);
+  public:
+
+  // double optional_double = 12;
+  void clear_optional_double();
+  double optional_double() const;
+  void set_optional_double(double value);
+  private:
+  double _internal_optional_double() const;
+  void _internal_set_optional_double(double value);
+  public:
+
+  // bool optional_bool = 13;
+  void clear_optional_bool();
+  bool optional_bool() const;
+  void set_optional_bool(bool value);
+  private:
+  bool _internal_optional_bool() const;
+  void _internal_set_optional_bool(bool value);
+  public:
+
+  // .proto3_unittest.TestAllTypes.NestedEnum optional_nested_enum = 21;
+  void clear_optional_nested_enum();
+  ::proto3_unittest::TestAllTypes_NestedEnum optional_nested_enum() const;
+  void set_optional_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value);
+  private:
+  ::proto3_unittest::TestAllTypes_NestedEnum _internal_optional_nested_enum() const;
+  void _internal_set_optional_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value);
+  public:
+
+  // .proto3_unittest.ForeignEnum optional_foreign_enum = 22;
+  void clear_optional_foreign_enum();
+  ::proto3_unittest::ForeignEnum optional_foreign_enum() const;
+  void set_optional_foreign_enum(::proto3_unittest::ForeignEnum value);
+  private:
+  ::proto3_unittest::ForeignEnum _internal_optional_foreign_enum() const;
+  void _internal_set_optional_foreign_enum(::proto3_unittest::ForeignEnum value);
+  public:
+
+  // uint32 oneof_uint32 = 111;
+  private:
+  bool _internal_has_oneof_uint32() const;
+  public:
+  void clear_oneof_uint32();
+  ::PROTOBUF_NAMESPACE_ID::uint32 oneof_uint32() const;
+  void set_oneof_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_oneof_uint32() const;
+  void _internal_set_oneof_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // .proto3_unittest.TestAllTypes.NestedMessage oneof_nested_message = 112;
+  bool has_oneof_nested_message() const;
+  private:
+  bool _internal_has_oneof_nested_message() const;
+  public:
+  void clear_oneof_nested_message();
+  const ::proto3_unittest::TestAllTypes_NestedMessage& oneof_nested_message() const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* release_oneof_nested_message();
+  ::proto3_unittest::TestAllTypes_NestedMessage* mutable_oneof_nested_message();
+  void set_allocated_oneof_nested_message(::proto3_unittest::TestAllTypes_NestedMessage* oneof_nested_message);
+  private:
+  const ::proto3_unittest::TestAllTypes_NestedMessage& _internal_oneof_nested_message() const;
+  ::proto3_unittest::TestAllTypes_NestedMessage* _internal_mutable_oneof_nested_message();
+  public:
+  void unsafe_arena_set_allocated_oneof_nested_message(
+      ::proto3_unittest::TestAllTypes_NestedMessage* oneof_nested_message);
+  ::proto3_unittest::TestAllTypes_NestedMessage* unsafe_arena_release_oneof_nested_message();
+
+  // string oneof_string = 113;
+  private:
+  bool _internal_has_oneof_string() const;
+  public:
+  void clear_oneof_string();
+  const std::string& oneof_string() const;
+  void set_oneof_string(const std::string& value);
+  void set_oneof_string(std::string&& value);
+  void set_oneof_string(const char* value);
+  void set_oneof_string(const char* value, size_t size);
+  std::string* mutable_oneof_string();
+  std::string* release_oneof_string();
+  void set_allocated_oneof_string(std::string* oneof_string);
+  private:
+  const std::string& _internal_oneof_string() const;
+  void _internal_set_oneof_string(const std::string& value);
+  std::string* _internal_mutable_oneof_string();
+  public:
+
+  // bytes oneof_bytes = 114;
+  private:
+  bool _internal_has_oneof_bytes() const;
+  public:
+  void clear_oneof_bytes();
+  const std::string& oneof_bytes() const;
+  void set_oneof_bytes(const std::string& value);
+  void set_oneof_bytes(std::string&& value);
+  void set_oneof_bytes(const char* value);
+  void set_oneof_bytes(const void* value, size_t size);
+  std::string* mutable_oneof_bytes();
+  std::string* release_oneof_bytes();
+  void set_allocated_oneof_bytes(std::string* oneof_bytes);
+  private:
+  const std::string& _internal_oneof_bytes() const;
+  void _internal_set_oneof_bytes(const std::string& value);
+  std::string* _internal_mutable_oneof_bytes();
+  public:
+
+  void clear_oneof_field();
+  OneofFieldCase oneof_field_case() const;
+  // @@protoc_insertion_point(class_scope:proto3_unittest.TestAllTypes)
+ private:
+  class _Internal;
+  void set_has_oneof_uint32();
+  void set_has_oneof_nested_message();
+  void set_has_oneof_string();
+  void set_has_oneof_bytes();
+
+  inline bool has_oneof_field() const;
+  inline void clear_has_oneof_field();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > repeated_int32_;
+  mutable std::atomic<int> _repeated_int32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > repeated_int64_;
+  mutable std::atomic<int> _repeated_int64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > repeated_uint32_;
+  mutable std::atomic<int> _repeated_uint32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > repeated_uint64_;
+  mutable std::atomic<int> _repeated_uint64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > repeated_sint32_;
+  mutable std::atomic<int> _repeated_sint32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > repeated_sint64_;
+  mutable std::atomic<int> _repeated_sint64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > repeated_fixed32_;
+  mutable std::atomic<int> _repeated_fixed32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > repeated_fixed64_;
+  mutable std::atomic<int> _repeated_fixed64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > repeated_sfixed32_;
+  mutable std::atomic<int> _repeated_sfixed32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > repeated_sfixed64_;
+  mutable std::atomic<int> _repeated_sfixed64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > repeated_float_;
+  mutable std::atomic<int> _repeated_float_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > repeated_double_;
+  mutable std::atomic<int> _repeated_double_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > repeated_bool_;
+  mutable std::atomic<int> _repeated_bool_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> repeated_string_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> repeated_bytes_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage > repeated_nested_message_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto3_unittest::ForeignMessage > repeated_foreign_message_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest_import::ImportMessage > repeated_import_message_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> repeated_nested_enum_;
+  mutable std::atomic<int> _repeated_nested_enum_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> repeated_foreign_enum_;
+  mutable std::atomic<int> _repeated_foreign_enum_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> repeated_string_piece_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> repeated_cord_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage > repeated_lazy_message_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr optional_string_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr optional_bytes_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr optional_string_piece_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr optional_cord_;
+  ::proto3_unittest::TestAllTypes_NestedMessage* optional_nested_message_;
+  ::proto3_unittest::ForeignMessage* optional_foreign_message_;
+  ::protobuf_unittest_import::ImportMessage* optional_import_message_;
+  ::protobuf_unittest_import::PublicImportMessage* optional_public_import_message_;
+  ::proto3_unittest::TestAllTypes_NestedMessage* optional_lazy_message_;
+  ::protobuf_unittest_import::ImportMessage* optional_lazy_import_message_;
+  ::PROTOBUF_NAMESPACE_ID::int64 optional_int64_;
+  ::PROTOBUF_NAMESPACE_ID::int32 optional_int32_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 optional_uint32_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 optional_uint64_;
+  ::PROTOBUF_NAMESPACE_ID::int64 optional_sint64_;
+  ::PROTOBUF_NAMESPACE_ID::int32 optional_sint32_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 optional_fixed32_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 optional_fixed64_;
+  ::PROTOBUF_NAMESPACE_ID::int64 optional_sfixed64_;
+  ::PROTOBUF_NAMESPACE_ID::int32 optional_sfixed32_;
+  float optional_float_;
+  double optional_double_;
+  bool optional_bool_;
+  int optional_nested_enum_;
+  int optional_foreign_enum_;
+  union OneofFieldUnion {
+    OneofFieldUnion() {}
+    ::PROTOBUF_NAMESPACE_ID::uint32 oneof_uint32_;
+    ::proto3_unittest::TestAllTypes_NestedMessage* oneof_nested_message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_string_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_bytes_;
+  } oneof_field_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestPackedTypes PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.TestPackedTypes) */ {
+ public:
+  inline TestPackedTypes() : TestPackedTypes(nullptr) {};
+  virtual ~TestPackedTypes();
+
+  TestPackedTypes(const TestPackedTypes& from);
+  TestPackedTypes(TestPackedTypes&& from) noexcept
+    : TestPackedTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline TestPackedTypes& operator=(const TestPackedTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestPackedTypes& operator=(TestPackedTypes&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestPackedTypes& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestPackedTypes* internal_default_instance() {
+    return reinterpret_cast<const TestPackedTypes*>(
+               &_TestPackedTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(TestPackedTypes& a, TestPackedTypes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestPackedTypes* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestPackedTypes* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestPackedTypes* New() const final {
+    return CreateMaybeMessage<TestPackedTypes>(nullptr);
+  }
+
+  TestPackedTypes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestPackedTypes>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestPackedTypes& from);
+  void MergeFrom(const TestPackedTypes& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestPackedTypes* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto3_unittest.TestPackedTypes";
+  }
+  protected:
+  explicit TestPackedTypes(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPackedInt32FieldNumber = 90,
+    kPackedInt64FieldNumber = 91,
+    kPackedUint32FieldNumber = 92,
+    kPackedUint64FieldNumber = 93,
+    kPackedSint32FieldNumber = 94,
+    kPackedSint64FieldNumber = 95,
+    kPackedFixed32FieldNumber = 96,
+    kPackedFixed64FieldNumber = 97,
+    kPackedSfixed32FieldNumber = 98,
+    kPackedSfixed64FieldNumber = 99,
+    kPackedFloatFieldNumber = 100,
+    kPackedDoubleFieldNumber = 101,
+    kPackedBoolFieldNumber = 102,
+    kPackedEnumFieldNumber = 103,
+  };
+  // repeated int32 packed_int32 = 90 [packed = true];
+  int packed_int32_size() const;
+  private:
+  int _internal_packed_int32_size() const;
+  public:
+  void clear_packed_int32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_packed_int32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_packed_int32() const;
+  void _internal_add_packed_int32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_packed_int32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 packed_int32(int index) const;
+  void set_packed_int32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_packed_int32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      packed_int32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_packed_int32();
+
+  // repeated int64 packed_int64 = 91 [packed = true];
+  int packed_int64_size() const;
+  private:
+  int _internal_packed_int64_size() const;
+  public:
+  void clear_packed_int64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_packed_int64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_packed_int64() const;
+  void _internal_add_packed_int64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_packed_int64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 packed_int64(int index) const;
+  void set_packed_int64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_packed_int64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      packed_int64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_packed_int64();
+
+  // repeated uint32 packed_uint32 = 92 [packed = true];
+  int packed_uint32_size() const;
+  private:
+  int _internal_packed_uint32_size() const;
+  public:
+  void clear_packed_uint32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_packed_uint32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_packed_uint32() const;
+  void _internal_add_packed_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_packed_uint32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 packed_uint32(int index) const;
+  void set_packed_uint32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_packed_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      packed_uint32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_packed_uint32();
+
+  // repeated uint64 packed_uint64 = 93 [packed = true];
+  int packed_uint64_size() const;
+  private:
+  int _internal_packed_uint64_size() const;
+  public:
+  void clear_packed_uint64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_packed_uint64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_packed_uint64() const;
+  void _internal_add_packed_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_packed_uint64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint64 packed_uint64(int index) const;
+  void set_packed_uint64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_packed_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      packed_uint64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_packed_uint64();
+
+  // repeated sint32 packed_sint32 = 94 [packed = true];
+  int packed_sint32_size() const;
+  private:
+  int _internal_packed_sint32_size() const;
+  public:
+  void clear_packed_sint32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_packed_sint32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_packed_sint32() const;
+  void _internal_add_packed_sint32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_packed_sint32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 packed_sint32(int index) const;
+  void set_packed_sint32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_packed_sint32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      packed_sint32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_packed_sint32();
+
+  // repeated sint64 packed_sint64 = 95 [packed = true];
+  int packed_sint64_size() const;
+  private:
+  int _internal_packed_sint64_size() const;
+  public:
+  void clear_packed_sint64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_packed_sint64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_packed_sint64() const;
+  void _internal_add_packed_sint64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_packed_sint64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 packed_sint64(int index) const;
+  void set_packed_sint64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_packed_sint64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      packed_sint64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_packed_sint64();
+
+  // repeated fixed32 packed_fixed32 = 96 [packed = true];
+  int packed_fixed32_size() const;
+  private:
+  int _internal_packed_fixed32_size() const;
+  public:
+  void clear_packed_fixed32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_packed_fixed32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_packed_fixed32() const;
+  void _internal_add_packed_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_packed_fixed32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 packed_fixed32(int index) const;
+  void set_packed_fixed32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_packed_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      packed_fixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_packed_fixed32();
+
+  // repeated fixed64 packed_fixed64 = 97 [packed = true];
+  int packed_fixed64_size() const;
+  private:
+  int _internal_packed_fixed64_size() const;
+  public:
+  void clear_packed_fixed64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_packed_fixed64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_packed_fixed64() const;
+  void _internal_add_packed_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_packed_fixed64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint64 packed_fixed64(int index) const;
+  void set_packed_fixed64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_packed_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      packed_fixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_packed_fixed64();
+
+  // repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+  int packed_sfixed32_size() const;
+  private:
+  int _internal_packed_sfixed32_size() const;
+  public:
+  void clear_packed_sfixed32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_packed_sfixed32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_packed_sfixed32() const;
+  void _internal_add_packed_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_packed_sfixed32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 packed_sfixed32(int index) const;
+  void set_packed_sfixed32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_packed_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      packed_sfixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_packed_sfixed32();
+
+  // repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+  int packed_sfixed64_size() const;
+  private:
+  int _internal_packed_sfixed64_size() const;
+  public:
+  void clear_packed_sfixed64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_packed_sfixed64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_packed_sfixed64() const;
+  void _internal_add_packed_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_packed_sfixed64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 packed_sfixed64(int index) const;
+  void set_packed_sfixed64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_packed_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      packed_sfixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_packed_sfixed64();
+
+  // repeated float packed_float = 100 [packed = true];
+  int packed_float_size() const;
+  private:
+  int _internal_packed_float_size() const;
+  public:
+  void clear_packed_float();
+  private:
+  float _internal_packed_float(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_packed_float() const;
+  void _internal_add_packed_float(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_packed_float();
+  public:
+  float packed_float(int index) const;
+  void set_packed_float(int index, float value);
+  void add_packed_float(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      packed_float() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_packed_float();
+
+  // repeated double packed_double = 101 [packed = true];
+  int packed_double_size() const;
+  private:
+  int _internal_packed_double_size() const;
+  public:
+  void clear_packed_double();
+  private:
+  double _internal_packed_double(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_packed_double() const;
+  void _internal_add_packed_double(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_packed_double();
+  public:
+  double packed_double(int index) const;
+  void set_packed_double(int index, double value);
+  void add_packed_double(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      packed_double() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_packed_double();
+
+  // repeated bool packed_bool = 102 [packed = true];
+  int packed_bool_size() const;
+  private:
+  int _internal_packed_bool_size() const;
+  public:
+  void clear_packed_bool();
+  private:
+  bool _internal_packed_bool(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      _internal_packed_bool() const;
+  void _internal_add_packed_bool(bool value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      _internal_mutable_packed_bool();
+  public:
+  bool packed_bool(int index) const;
+  void set_packed_bool(int index, bool value);
+  void add_packed_bool(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      packed_bool() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_packed_bool();
+
+  // repeated .proto3_unittest.ForeignEnum packed_enum = 103 [packed = true];
+  int packed_enum_size() const;
+  private:
+  int _internal_packed_enum_size() const;
+  public:
+  void clear_packed_enum();
+  private:
+  ::proto3_unittest::ForeignEnum _internal_packed_enum(int index) const;
+  void _internal_add_packed_enum(::proto3_unittest::ForeignEnum value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_packed_enum();
+  public:
+  ::proto3_unittest::ForeignEnum packed_enum(int index) const;
+  void set_packed_enum(int index, ::proto3_unittest::ForeignEnum value);
+  void add_packed_enum(::proto3_unittest::ForeignEnum value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& packed_enum() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_packed_enum();
+
+  // @@protoc_insertion_point(class_scope:proto3_unittest.TestPackedTypes)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > packed_int32_;
+  mutable std::atomic<int> _packed_int32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > packed_int64_;
+  mutable std::atomic<int> _packed_int64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > packed_uint32_;
+  mutable std::atomic<int> _packed_uint32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > packed_uint64_;
+  mutable std::atomic<int> _packed_uint64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > packed_sint32_;
+  mutable std::atomic<int> _packed_sint32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > packed_sint64_;
+  mutable std::atomic<int> _packed_sint64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > packed_fixed32_;
+  mutable std::atomic<int> _packed_fixed32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > packed_fixed64_;
+  mutable std::atomic<int> _packed_fixed64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > packed_sfixed32_;
+  mutable std::atomic<int> _packed_sfixed32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > packed_sfixed64_;
+  mutable std::atomic<int> _packed_sfixed64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > packed_float_;
+  mutable std::atomic<int> _packed_float_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > packed_double_;
+  mutable std::atomic<int> _packed_double_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > packed_bool_;
+  mutable std::atomic<int> _packed_bool_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> packed_enum_;
+  mutable std::atomic<int> _packed_enum_cached_byte_size_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestUnpackedTypes PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.TestUnpackedTypes) */ {
+ public:
+  inline TestUnpackedTypes() : TestUnpackedTypes(nullptr) {};
+  virtual ~TestUnpackedTypes();
+
+  TestUnpackedTypes(const TestUnpackedTypes& from);
+  TestUnpackedTypes(TestUnpackedTypes&& from) noexcept
+    : TestUnpackedTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline TestUnpackedTypes& operator=(const TestUnpackedTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestUnpackedTypes& operator=(TestUnpackedTypes&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestUnpackedTypes& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestUnpackedTypes* internal_default_instance() {
+    return reinterpret_cast<const TestUnpackedTypes*>(
+               &_TestUnpackedTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(TestUnpackedTypes& a, TestUnpackedTypes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestUnpackedTypes* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestUnpackedTypes* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestUnpackedTypes* New() const final {
+    return CreateMaybeMessage<TestUnpackedTypes>(nullptr);
+  }
+
+  TestUnpackedTypes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestUnpackedTypes>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestUnpackedTypes& from);
+  void MergeFrom(const TestUnpackedTypes& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestUnpackedTypes* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto3_unittest.TestUnpackedTypes";
+  }
+  protected:
+  explicit TestUnpackedTypes(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepeatedInt32FieldNumber = 1,
+    kRepeatedInt64FieldNumber = 2,
+    kRepeatedUint32FieldNumber = 3,
+    kRepeatedUint64FieldNumber = 4,
+    kRepeatedSint32FieldNumber = 5,
+    kRepeatedSint64FieldNumber = 6,
+    kRepeatedFixed32FieldNumber = 7,
+    kRepeatedFixed64FieldNumber = 8,
+    kRepeatedSfixed32FieldNumber = 9,
+    kRepeatedSfixed64FieldNumber = 10,
+    kRepeatedFloatFieldNumber = 11,
+    kRepeatedDoubleFieldNumber = 12,
+    kRepeatedBoolFieldNumber = 13,
+    kRepeatedNestedEnumFieldNumber = 14,
+  };
+  // repeated int32 repeated_int32 = 1 [packed = false];
+  int repeated_int32_size() const;
+  private:
+  int _internal_repeated_int32_size() const;
+  public:
+  void clear_repeated_int32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_repeated_int32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_repeated_int32() const;
+  void _internal_add_repeated_int32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_repeated_int32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 repeated_int32(int index) const;
+  void set_repeated_int32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_repeated_int32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      repeated_int32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_repeated_int32();
+
+  // repeated int64 repeated_int64 = 2 [packed = false];
+  int repeated_int64_size() const;
+  private:
+  int _internal_repeated_int64_size() const;
+  public:
+  void clear_repeated_int64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_repeated_int64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_repeated_int64() const;
+  void _internal_add_repeated_int64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_repeated_int64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 repeated_int64(int index) const;
+  void set_repeated_int64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_repeated_int64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      repeated_int64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_repeated_int64();
+
+  // repeated uint32 repeated_uint32 = 3 [packed = false];
+  int repeated_uint32_size() const;
+  private:
+  int _internal_repeated_uint32_size() const;
+  public:
+  void clear_repeated_uint32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_repeated_uint32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_repeated_uint32() const;
+  void _internal_add_repeated_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_repeated_uint32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 repeated_uint32(int index) const;
+  void set_repeated_uint32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_repeated_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      repeated_uint32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_repeated_uint32();
+
+  // repeated uint64 repeated_uint64 = 4 [packed = false];
+  int repeated_uint64_size() const;
+  private:
+  int _internal_repeated_uint64_size() const;
+  public:
+  void clear_repeated_uint64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_repeated_uint64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_repeated_uint64() const;
+  void _internal_add_repeated_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_repeated_uint64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint64 repeated_uint64(int index) const;
+  void set_repeated_uint64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_repeated_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      repeated_uint64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_repeated_uint64();
+
+  // repeated sint32 repeated_sint32 = 5 [packed = false];
+  int repeated_sint32_size() const;
+  private:
+  int _internal_repeated_sint32_size() const;
+  public:
+  void clear_repeated_sint32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_repeated_sint32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_repeated_sint32() const;
+  void _internal_add_repeated_sint32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_repeated_sint32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 repeated_sint32(int index) const;
+  void set_repeated_sint32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_repeated_sint32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      repeated_sint32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_repeated_sint32();
+
+  // repeated sint64 repeated_sint64 = 6 [packed = false];
+  int repeated_sint64_size() const;
+  private:
+  int _internal_repeated_sint64_size() const;
+  public:
+  void clear_repeated_sint64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_repeated_sint64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_repeated_sint64() const;
+  void _internal_add_repeated_sint64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_repeated_sint64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 repeated_sint64(int index) const;
+  void set_repeated_sint64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_repeated_sint64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      repeated_sint64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_repeated_sint64();
+
+  // repeated fixed32 repeated_fixed32 = 7 [packed = false];
+  int repeated_fixed32_size() const;
+  private:
+  int _internal_repeated_fixed32_size() const;
+  public:
+  void clear_repeated_fixed32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_repeated_fixed32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_repeated_fixed32() const;
+  void _internal_add_repeated_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_repeated_fixed32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 repeated_fixed32(int index) const;
+  void set_repeated_fixed32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_repeated_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      repeated_fixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_repeated_fixed32();
+
+  // repeated fixed64 repeated_fixed64 = 8 [packed = false];
+  int repeated_fixed64_size() const;
+  private:
+  int _internal_repeated_fixed64_size() const;
+  public:
+  void clear_repeated_fixed64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_repeated_fixed64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_repeated_fixed64() const;
+  void _internal_add_repeated_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_repeated_fixed64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint64 repeated_fixed64(int index) const;
+  void set_repeated_fixed64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_repeated_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      repeated_fixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_repeated_fixed64();
+
+  // repeated sfixed32 repeated_sfixed32 = 9 [packed = false];
+  int repeated_sfixed32_size() const;
+  private:
+  int _internal_repeated_sfixed32_size() const;
+  public:
+  void clear_repeated_sfixed32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_repeated_sfixed32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_repeated_sfixed32() const;
+  void _internal_add_repeated_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_repeated_sfixed32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 repeated_sfixed32(int index) const;
+  void set_repeated_sfixed32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_repeated_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      repeated_sfixed32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_repeated_sfixed32();
+
+  // repeated sfixed64 repeated_sfixed64 = 10 [packed = false];
+  int repeated_sfixed64_size() const;
+  private:
+  int _internal_repeated_sfixed64_size() const;
+  public:
+  void clear_repeated_sfixed64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_repeated_sfixed64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_repeated_sfixed64() const;
+  void _internal_add_repeated_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_repeated_sfixed64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 repeated_sfixed64(int index) const;
+  void set_repeated_sfixed64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_repeated_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      repeated_sfixed64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_repeated_sfixed64();
+
+  // repeated float repeated_float = 11 [packed = false];
+  int repeated_float_size() const;
+  private:
+  int _internal_repeated_float_size() const;
+  public:
+  void clear_repeated_float();
+  private:
+  float _internal_repeated_float(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_repeated_float() const;
+  void _internal_add_repeated_float(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_repeated_float();
+  public:
+  float repeated_float(int index) const;
+  void set_repeated_float(int index, float value);
+  void add_repeated_float(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      repeated_float() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_repeated_float();
+
+  // repeated double repeated_double = 12 [packed = false];
+  int repeated_double_size() const;
+  private:
+  int _internal_repeated_double_size() const;
+  public:
+  void clear_repeated_double();
+  private:
+  double _internal_repeated_double(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_repeated_double() const;
+  void _internal_add_repeated_double(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_repeated_double();
+  public:
+  double repeated_double(int index) const;
+  void set_repeated_double(int index, double value);
+  void add_repeated_double(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      repeated_double() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_repeated_double();
+
+  // repeated bool repeated_bool = 13 [packed = false];
+  int repeated_bool_size() const;
+  private:
+  int _internal_repeated_bool_size() const;
+  public:
+  void clear_repeated_bool();
+  private:
+  bool _internal_repeated_bool(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      _internal_repeated_bool() const;
+  void _internal_add_repeated_bool(bool value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      _internal_mutable_repeated_bool();
+  public:
+  bool repeated_bool(int index) const;
+  void set_repeated_bool(int index, bool value);
+  void add_repeated_bool(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      repeated_bool() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_repeated_bool();
+
+  // repeated .proto3_unittest.TestAllTypes.NestedEnum repeated_nested_enum = 14 [packed = false];
+  int repeated_nested_enum_size() const;
+  private:
+  int _internal_repeated_nested_enum_size() const;
+  public:
+  void clear_repeated_nested_enum();
+  private:
+  ::proto3_unittest::TestAllTypes_NestedEnum _internal_repeated_nested_enum(int index) const;
+  void _internal_add_repeated_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_repeated_nested_enum();
+  public:
+  ::proto3_unittest::TestAllTypes_NestedEnum repeated_nested_enum(int index) const;
+  void set_repeated_nested_enum(int index, ::proto3_unittest::TestAllTypes_NestedEnum value);
+  void add_repeated_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& repeated_nested_enum() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_repeated_nested_enum();
+
+  // @@protoc_insertion_point(class_scope:proto3_unittest.TestUnpackedTypes)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > repeated_int32_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > repeated_int64_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > repeated_uint32_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > repeated_uint64_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > repeated_sint32_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > repeated_sint64_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > repeated_fixed32_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > repeated_fixed64_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > repeated_sfixed32_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > repeated_sfixed64_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > repeated_float_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > repeated_double_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > repeated_bool_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> repeated_nested_enum_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NestedTestAllTypes PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.NestedTestAllTypes) */ {
+ public:
+  inline NestedTestAllTypes() : NestedTestAllTypes(nullptr) {};
+  virtual ~NestedTestAllTypes();
+
+  NestedTestAllTypes(const NestedTestAllTypes& from);
+  NestedTestAllTypes(NestedTestAllTypes&& from) noexcept
+    : NestedTestAllTypes() {
+    *this = ::std::move(from);
+  }
+
+  inline NestedTestAllTypes& operator=(const NestedTestAllTypes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NestedTestAllTypes& operator=(NestedTestAllTypes&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const NestedTestAllTypes& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const NestedTestAllTypes* internal_default_instance() {
+    return reinterpret_cast<const NestedTestAllTypes*>(
+               &_NestedTestAllTypes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(NestedTestAllTypes& a, NestedTestAllTypes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NestedTestAllTypes* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NestedTestAllTypes* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline NestedTestAllTypes* New() const final {
+    return CreateMaybeMessage<NestedTestAllTypes>(nullptr);
+  }
+
+  NestedTestAllTypes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<NestedTestAllTypes>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const NestedTestAllTypes& from);
+  void MergeFrom(const NestedTestAllTypes& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NestedTestAllTypes* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto3_unittest.NestedTestAllTypes";
+  }
+  protected:
+  explicit NestedTestAllTypes(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChildFieldNumber = 1,
+    kPayloadFieldNumber = 2,
+  };
+  // .proto3_unittest.NestedTestAllTypes child = 1;
+  bool has_child() const;
+  private:
+  bool _internal_has_child() const;
+  public:
+  void clear_child();
+  const ::proto3_unittest::NestedTestAllTypes& child() const;
+  ::proto3_unittest::NestedTestAllTypes* release_child();
+  ::proto3_unittest::NestedTestAllTypes* mutable_child();
+  void set_allocated_child(::proto3_unittest::NestedTestAllTypes* child);
+  private:
+  const ::proto3_unittest::NestedTestAllTypes& _internal_child() const;
+  ::proto3_unittest::NestedTestAllTypes* _internal_mutable_child();
+  public:
+  void unsafe_arena_set_allocated_child(
+      ::proto3_unittest::NestedTestAllTypes* child);
+  ::proto3_unittest::NestedTestAllTypes* unsafe_arena_release_child();
+
+  // .proto3_unittest.TestAllTypes payload = 2;
+  bool has_payload() const;
+  private:
+  bool _internal_has_payload() const;
+  public:
+  void clear_payload();
+  const ::proto3_unittest::TestAllTypes& payload() const;
+  ::proto3_unittest::TestAllTypes* release_payload();
+  ::proto3_unittest::TestAllTypes* mutable_payload();
+  void set_allocated_payload(::proto3_unittest::TestAllTypes* payload);
+  private:
+  const ::proto3_unittest::TestAllTypes& _internal_payload() const;
+  ::proto3_unittest::TestAllTypes* _internal_mutable_payload();
+  public:
+  void unsafe_arena_set_allocated_payload(
+      ::proto3_unittest::TestAllTypes* payload);
+  ::proto3_unittest::TestAllTypes* unsafe_arena_release_payload();
+
+  // @@protoc_insertion_point(class_scope:proto3_unittest.NestedTestAllTypes)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::proto3_unittest::NestedTestAllTypes* child_;
+  ::proto3_unittest::TestAllTypes* payload_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ForeignMessage PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.ForeignMessage) */ {
+ public:
+  inline ForeignMessage() : ForeignMessage(nullptr) {};
+  virtual ~ForeignMessage();
+
+  ForeignMessage(const ForeignMessage& from);
+  ForeignMessage(ForeignMessage&& from) noexcept
+    : ForeignMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ForeignMessage& operator=(const ForeignMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ForeignMessage& operator=(ForeignMessage&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const ForeignMessage& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const ForeignMessage* internal_default_instance() {
+    return reinterpret_cast<const ForeignMessage*>(
+               &_ForeignMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ForeignMessage& a, ForeignMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ForeignMessage* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ForeignMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ForeignMessage* New() const final {
+    return CreateMaybeMessage<ForeignMessage>(nullptr);
+  }
+
+  ForeignMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ForeignMessage>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const ForeignMessage& from);
+  void MergeFrom(const ForeignMessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ForeignMessage* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto3_unittest.ForeignMessage";
+  }
+  protected:
+  explicit ForeignMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCFieldNumber = 1,
+  };
+  // int32 c = 1;
+  void clear_c();
+  ::PROTOBUF_NAMESPACE_ID::int32 c() const;
+  void set_c(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_c() const;
+  void _internal_set_c(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto3_unittest.ForeignMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::int32 c_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestEmptyMessage PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.TestEmptyMessage) */ {
+ public:
+  inline TestEmptyMessage() : TestEmptyMessage(nullptr) {};
+  virtual ~TestEmptyMessage();
+
+  TestEmptyMessage(const TestEmptyMessage& from);
+  TestEmptyMessage(TestEmptyMessage&& from) noexcept
+    : TestEmptyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline TestEmptyMessage& operator=(const TestEmptyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestEmptyMessage& operator=(TestEmptyMessage&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestEmptyMessage& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestEmptyMessage* internal_default_instance() {
+    return reinterpret_cast<const TestEmptyMessage*>(
+               &_TestEmptyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(TestEmptyMessage& a, TestEmptyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestEmptyMessage* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestEmptyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestEmptyMessage* New() const final {
+    return CreateMaybeMessage<TestEmptyMessage>(nullptr);
+  }
+
+  TestEmptyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestEmptyMessage>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestEmptyMessage& from);
+  void MergeFrom(const TestEmptyMessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestEmptyMessage* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto3_unittest.TestEmptyMessage";
+  }
+  protected:
+  explicit TestEmptyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:proto3_unittest.TestEmptyMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMessageWithDummy PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.TestMessageWithDummy) */ {
+ public:
+  inline TestMessageWithDummy() : TestMessageWithDummy(nullptr) {};
+  virtual ~TestMessageWithDummy();
+
+  TestMessageWithDummy(const TestMessageWithDummy& from);
+  TestMessageWithDummy(TestMessageWithDummy&& from) noexcept
+    : TestMessageWithDummy() {
+    *this = ::std::move(from);
+  }
+
+  inline TestMessageWithDummy& operator=(const TestMessageWithDummy& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestMessageWithDummy& operator=(TestMessageWithDummy&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestMessageWithDummy& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestMessageWithDummy* internal_default_instance() {
+    return reinterpret_cast<const TestMessageWithDummy*>(
+               &_TestMessageWithDummy_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(TestMessageWithDummy& a, TestMessageWithDummy& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestMessageWithDummy* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestMessageWithDummy* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestMessageWithDummy* New() const final {
+    return CreateMaybeMessage<TestMessageWithDummy>(nullptr);
+  }
+
+  TestMessageWithDummy* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestMessageWithDummy>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestMessageWithDummy& from);
+  void MergeFrom(const TestMessageWithDummy& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestMessageWithDummy* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto3_unittest.TestMessageWithDummy";
+  }
+  protected:
+  explicit TestMessageWithDummy(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDummyFieldNumber = 536870911,
+  };
+  // bool dummy = 536870911;
+  void clear_dummy();
+  bool dummy() const;
+  void set_dummy(bool value);
+  private:
+  bool _internal_dummy() const;
+  void _internal_set_dummy(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto3_unittest.TestMessageWithDummy)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  bool dummy_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestOneof2 PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto3_unittest.TestOneof2) */ {
+ public:
+  inline TestOneof2() : TestOneof2(nullptr) {};
+  virtual ~TestOneof2();
+
+  TestOneof2(const TestOneof2& from);
+  TestOneof2(TestOneof2&& from) noexcept
+    : TestOneof2() {
+    *this = ::std::move(from);
+  }
+
+  inline TestOneof2& operator=(const TestOneof2& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestOneof2& operator=(TestOneof2&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestOneof2& default_instance();
+
+  enum FooCase {
+    kFooEnum = 6,
+    FOO_NOT_SET = 0,
+  };
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestOneof2* internal_default_instance() {
+    return reinterpret_cast<const TestOneof2*>(
+               &_TestOneof2_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(TestOneof2& a, TestOneof2& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestOneof2* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestOneof2* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestOneof2* New() const final {
+    return CreateMaybeMessage<TestOneof2>(nullptr);
+  }
+
+  TestOneof2* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestOneof2>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestOneof2& from);
+  void MergeFrom(const TestOneof2& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestOneof2* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto3_unittest.TestOneof2";
+  }
+  protected:
+  explicit TestOneof2(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2funittest_5fproto3_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  typedef TestOneof2_NestedEnum NestedEnum;
+  static constexpr NestedEnum UNKNOWN =
+    TestOneof2_NestedEnum_UNKNOWN;
+  static constexpr NestedEnum FOO =
+    TestOneof2_NestedEnum_FOO;
+  static constexpr NestedEnum BAR =
+    TestOneof2_NestedEnum_BAR;
+  static constexpr NestedEnum BAZ =
+    TestOneof2_NestedEnum_BAZ;
+  static inline bool NestedEnum_IsValid(int value) {
+    return TestOneof2_NestedEnum_IsValid(value);
+  }
+  static constexpr NestedEnum NestedEnum_MIN =
+    TestOneof2_NestedEnum_NestedEnum_MIN;
+  static constexpr NestedEnum NestedEnum_MAX =
+    TestOneof2_NestedEnum_NestedEnum_MAX;
+  static constexpr int NestedEnum_ARRAYSIZE =
+    TestOneof2_NestedEnum_NestedEnum_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  NestedEnum_descriptor() {
+    return TestOneof2_NestedEnum_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& NestedEnum_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, NestedEnum>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function NestedEnum_Name.");
+    return TestOneof2_NestedEnum_Name(enum_t_value);
+  }
+  static inline bool NestedEnum_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      NestedEnum* value) {
+    return TestOneof2_NestedEnum_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFooEnumFieldNumber = 6,
+  };
+  // .proto3_unittest.TestOneof2.NestedEnum foo_enum = 6;
+  private:
+  bool _internal_has_foo_enum() const;
+  public:
+  void clear_foo_enum();
+  ::proto3_unittest::TestOneof2_NestedEnum foo_enum() const;
+  void set_foo_enum(::proto3_unittest::TestOneof2_NestedEnum value);
+  private:
+  ::proto3_unittest::TestOneof2_NestedEnum _internal_foo_enum() const;
+  void _internal_set_foo_enum(::proto3_unittest::TestOneof2_NestedEnum value);
+  public:
+
+  void clear_foo();
+  FooCase foo_case() const;
+  // @@protoc_insertion_point(class_scope:proto3_unittest.TestOneof2)
+ private:
+  class _Internal;
+  void set_has_foo_enum();
+
+  inline bool has_foo() const;
+  inline void clear_has_foo();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  union FooUnion {
+    FooUnion() {}
+    int foo_enum_;
+  } foo_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+
+  friend struct ::TableStruct_google_2fprotobuf_2funittest_5fproto3_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TestAllTypes_NestedMessage
+
+// int32 bb = 1;
+inline void TestAllTypes_NestedMessage::clear_bb() {
+  bb_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestAllTypes_NestedMessage::_internal_bb() const {
+  return bb_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestAllTypes_NestedMessage::bb() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.NestedMessage.bb)
+  return _internal_bb();
+}
+inline void TestAllTypes_NestedMessage::_internal_set_bb(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  bb_ = value;
+}
+inline void TestAllTypes_NestedMessage::set_bb(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_bb(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.NestedMessage.bb)
+}
+
+// -------------------------------------------------------------------
+
+// TestAllTypes
+
+// int32 optional_int32 = 1;
+inline void TestAllTypes::clear_optional_int32() {
+  optional_int32_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestAllTypes::_internal_optional_int32() const {
+  return optional_int32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestAllTypes::optional_int32() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_int32)
+  return _internal_optional_int32();
+}
+inline void TestAllTypes::_internal_set_optional_int32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  optional_int32_ = value;
+}
+inline void TestAllTypes::set_optional_int32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_optional_int32(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_int32)
+}
+
+// int64 optional_int64 = 2;
+inline void TestAllTypes::clear_optional_int64() {
+  optional_int64_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestAllTypes::_internal_optional_int64() const {
+  return optional_int64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestAllTypes::optional_int64() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_int64)
+  return _internal_optional_int64();
+}
+inline void TestAllTypes::_internal_set_optional_int64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  optional_int64_ = value;
+}
+inline void TestAllTypes::set_optional_int64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_set_optional_int64(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_int64)
+}
+
+// uint32 optional_uint32 = 3;
+inline void TestAllTypes::clear_optional_uint32() {
+  optional_uint32_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestAllTypes::_internal_optional_uint32() const {
+  return optional_uint32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestAllTypes::optional_uint32() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_uint32)
+  return _internal_optional_uint32();
+}
+inline void TestAllTypes::_internal_set_optional_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  optional_uint32_ = value;
+}
+inline void TestAllTypes::set_optional_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_optional_uint32(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_uint32)
+}
+
+// uint64 optional_uint64 = 4;
+inline void TestAllTypes::clear_optional_uint64() {
+  optional_uint64_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestAllTypes::_internal_optional_uint64() const {
+  return optional_uint64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestAllTypes::optional_uint64() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_uint64)
+  return _internal_optional_uint64();
+}
+inline void TestAllTypes::_internal_set_optional_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  optional_uint64_ = value;
+}
+inline void TestAllTypes::set_optional_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_optional_uint64(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_uint64)
+}
+
+// sint32 optional_sint32 = 5;
+inline void TestAllTypes::clear_optional_sint32() {
+  optional_sint32_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestAllTypes::_internal_optional_sint32() const {
+  return optional_sint32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestAllTypes::optional_sint32() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_sint32)
+  return _internal_optional_sint32();
+}
+inline void TestAllTypes::_internal_set_optional_sint32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  optional_sint32_ = value;
+}
+inline void TestAllTypes::set_optional_sint32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_optional_sint32(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_sint32)
+}
+
+// sint64 optional_sint64 = 6;
+inline void TestAllTypes::clear_optional_sint64() {
+  optional_sint64_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestAllTypes::_internal_optional_sint64() const {
+  return optional_sint64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestAllTypes::optional_sint64() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_sint64)
+  return _internal_optional_sint64();
+}
+inline void TestAllTypes::_internal_set_optional_sint64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  optional_sint64_ = value;
+}
+inline void TestAllTypes::set_optional_sint64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_set_optional_sint64(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_sint64)
+}
+
+// fixed32 optional_fixed32 = 7;
+inline void TestAllTypes::clear_optional_fixed32() {
+  optional_fixed32_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestAllTypes::_internal_optional_fixed32() const {
+  return optional_fixed32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestAllTypes::optional_fixed32() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_fixed32)
+  return _internal_optional_fixed32();
+}
+inline void TestAllTypes::_internal_set_optional_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  optional_fixed32_ = value;
+}
+inline void TestAllTypes::set_optional_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_optional_fixed32(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_fixed32)
+}
+
+// fixed64 optional_fixed64 = 8;
+inline void TestAllTypes::clear_optional_fixed64() {
+  optional_fixed64_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestAllTypes::_internal_optional_fixed64() const {
+  return optional_fixed64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestAllTypes::optional_fixed64() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_fixed64)
+  return _internal_optional_fixed64();
+}
+inline void TestAllTypes::_internal_set_optional_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  optional_fixed64_ = value;
+}
+inline void TestAllTypes::set_optional_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_optional_fixed64(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_fixed64)
+}
+
+// sfixed32 optional_sfixed32 = 9;
+inline void TestAllTypes::clear_optional_sfixed32() {
+  optional_sfixed32_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestAllTypes::_internal_optional_sfixed32() const {
+  return optional_sfixed32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestAllTypes::optional_sfixed32() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_sfixed32)
+  return _internal_optional_sfixed32();
+}
+inline void TestAllTypes::_internal_set_optional_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  optional_sfixed32_ = value;
+}
+inline void TestAllTypes::set_optional_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_optional_sfixed32(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_sfixed32)
+}
+
+// sfixed64 optional_sfixed64 = 10;
+inline void TestAllTypes::clear_optional_sfixed64() {
+  optional_sfixed64_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestAllTypes::_internal_optional_sfixed64() const {
+  return optional_sfixed64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestAllTypes::optional_sfixed64() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_sfixed64)
+  return _internal_optional_sfixed64();
+}
+inline void TestAllTypes::_internal_set_optional_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  optional_sfixed64_ = value;
+}
+inline void TestAllTypes::set_optional_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_set_optional_sfixed64(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_sfixed64)
+}
+
+// float optional_float = 11;
+inline void TestAllTypes::clear_optional_float() {
+  optional_float_ = 0;
+}
+inline float TestAllTypes::_internal_optional_float() const {
+  return optional_float_;
+}
+inline float TestAllTypes::optional_float() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_float)
+  return _internal_optional_float();
+}
+inline void TestAllTypes::_internal_set_optional_float(float value) {
+  
+  optional_float_ = value;
+}
+inline void TestAllTypes::set_optional_float(float value) {
+  _internal_set_optional_float(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_float)
+}
+
+// double optional_double = 12;
+inline void TestAllTypes::clear_optional_double() {
+  optional_double_ = 0;
+}
+inline double TestAllTypes::_internal_optional_double() const {
+  return optional_double_;
+}
+inline double TestAllTypes::optional_double() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_double)
+  return _internal_optional_double();
+}
+inline void TestAllTypes::_internal_set_optional_double(double value) {
+  
+  optional_double_ = value;
+}
+inline void TestAllTypes::set_optional_double(double value) {
+  _internal_set_optional_double(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_double)
+}
+
+// bool optional_bool = 13;
+inline void TestAllTypes::clear_optional_bool() {
+  optional_bool_ = false;
+}
+inline bool TestAllTypes::_internal_optional_bool() const {
+  return optional_bool_;
+}
+inline bool TestAllTypes::optional_bool() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_bool)
+  return _internal_optional_bool();
+}
+inline void TestAllTypes::_internal_set_optional_bool(bool value) {
+  
+  optional_bool_ = value;
+}
+inline void TestAllTypes::set_optional_bool(bool value) {
+  _internal_set_optional_bool(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_bool)
+}
+
+// string optional_string = 14;
+inline void TestAllTypes::clear_optional_string() {
+  optional_string_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& TestAllTypes::optional_string() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_string)
+  return _internal_optional_string();
+}
+inline void TestAllTypes::set_optional_string(const std::string& value) {
+  _internal_set_optional_string(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_string)
+}
+inline std::string* TestAllTypes::mutable_optional_string() {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_string)
+  return _internal_mutable_optional_string();
+}
+inline const std::string& TestAllTypes::_internal_optional_string() const {
+  return optional_string_.Get();
+}
+inline void TestAllTypes::_internal_set_optional_string(const std::string& value) {
+  
+  optional_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void TestAllTypes::set_optional_string(std::string&& value) {
+  
+  optional_string_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto3_unittest.TestAllTypes.optional_string)
+}
+inline void TestAllTypes::set_optional_string(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  optional_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto3_unittest.TestAllTypes.optional_string)
+}
+inline void TestAllTypes::set_optional_string(const char* value,
+    size_t size) {
+  
+  optional_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto3_unittest.TestAllTypes.optional_string)
+}
+inline std::string* TestAllTypes::_internal_mutable_optional_string() {
+  
+  return optional_string_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* TestAllTypes::release_optional_string() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_string)
+  return optional_string_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void TestAllTypes::set_allocated_optional_string(std::string* optional_string) {
+  if (optional_string != nullptr) {
+    
+  } else {
+    
+  }
+  optional_string_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), optional_string,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_string)
+}
+
+// bytes optional_bytes = 15;
+inline void TestAllTypes::clear_optional_bytes() {
+  optional_bytes_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& TestAllTypes::optional_bytes() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_bytes)
+  return _internal_optional_bytes();
+}
+inline void TestAllTypes::set_optional_bytes(const std::string& value) {
+  _internal_set_optional_bytes(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_bytes)
+}
+inline std::string* TestAllTypes::mutable_optional_bytes() {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_bytes)
+  return _internal_mutable_optional_bytes();
+}
+inline const std::string& TestAllTypes::_internal_optional_bytes() const {
+  return optional_bytes_.Get();
+}
+inline void TestAllTypes::_internal_set_optional_bytes(const std::string& value) {
+  
+  optional_bytes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void TestAllTypes::set_optional_bytes(std::string&& value) {
+  
+  optional_bytes_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto3_unittest.TestAllTypes.optional_bytes)
+}
+inline void TestAllTypes::set_optional_bytes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  optional_bytes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto3_unittest.TestAllTypes.optional_bytes)
+}
+inline void TestAllTypes::set_optional_bytes(const void* value,
+    size_t size) {
+  
+  optional_bytes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto3_unittest.TestAllTypes.optional_bytes)
+}
+inline std::string* TestAllTypes::_internal_mutable_optional_bytes() {
+  
+  return optional_bytes_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* TestAllTypes::release_optional_bytes() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_bytes)
+  return optional_bytes_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void TestAllTypes::set_allocated_optional_bytes(std::string* optional_bytes) {
+  if (optional_bytes != nullptr) {
+    
+  } else {
+    
+  }
+  optional_bytes_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), optional_bytes,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_bytes)
+}
+
+// .proto3_unittest.TestAllTypes.NestedMessage optional_nested_message = 18;
+inline bool TestAllTypes::_internal_has_optional_nested_message() const {
+  return this != internal_default_instance() && optional_nested_message_ != nullptr;
+}
+inline bool TestAllTypes::has_optional_nested_message() const {
+  return _internal_has_optional_nested_message();
+}
+inline void TestAllTypes::clear_optional_nested_message() {
+  if (GetArena() == nullptr && optional_nested_message_ != nullptr) {
+    delete optional_nested_message_;
+  }
+  optional_nested_message_ = nullptr;
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::_internal_optional_nested_message() const {
+  const ::proto3_unittest::TestAllTypes_NestedMessage* p = optional_nested_message_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto3_unittest::TestAllTypes_NestedMessage*>(
+      &::proto3_unittest::_TestAllTypes_NestedMessage_default_instance_);
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::optional_nested_message() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_nested_message)
+  return _internal_optional_nested_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_nested_message(
+    ::proto3_unittest::TestAllTypes_NestedMessage* optional_nested_message) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(optional_nested_message_);
+  }
+  optional_nested_message_ = optional_nested_message;
+  if (optional_nested_message) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.TestAllTypes.optional_nested_message)
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::release_optional_nested_message() {
+  
+  ::proto3_unittest::TestAllTypes_NestedMessage* temp = optional_nested_message_;
+  optional_nested_message_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::unsafe_arena_release_optional_nested_message() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_nested_message)
+  
+  ::proto3_unittest::TestAllTypes_NestedMessage* temp = optional_nested_message_;
+  optional_nested_message_ = nullptr;
+  return temp;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::_internal_mutable_optional_nested_message() {
+  
+  if (optional_nested_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3_unittest::TestAllTypes_NestedMessage>(GetArena());
+    optional_nested_message_ = p;
+  }
+  return optional_nested_message_;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_optional_nested_message() {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_nested_message)
+  return _internal_mutable_optional_nested_message();
+}
+inline void TestAllTypes::set_allocated_optional_nested_message(::proto3_unittest::TestAllTypes_NestedMessage* optional_nested_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete optional_nested_message_;
+  }
+  if (optional_nested_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(optional_nested_message);
+    if (message_arena != submessage_arena) {
+      optional_nested_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, optional_nested_message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  optional_nested_message_ = optional_nested_message;
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_nested_message)
+}
+
+// .proto3_unittest.ForeignMessage optional_foreign_message = 19;
+inline bool TestAllTypes::_internal_has_optional_foreign_message() const {
+  return this != internal_default_instance() && optional_foreign_message_ != nullptr;
+}
+inline bool TestAllTypes::has_optional_foreign_message() const {
+  return _internal_has_optional_foreign_message();
+}
+inline void TestAllTypes::clear_optional_foreign_message() {
+  if (GetArena() == nullptr && optional_foreign_message_ != nullptr) {
+    delete optional_foreign_message_;
+  }
+  optional_foreign_message_ = nullptr;
+}
+inline const ::proto3_unittest::ForeignMessage& TestAllTypes::_internal_optional_foreign_message() const {
+  const ::proto3_unittest::ForeignMessage* p = optional_foreign_message_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto3_unittest::ForeignMessage*>(
+      &::proto3_unittest::_ForeignMessage_default_instance_);
+}
+inline const ::proto3_unittest::ForeignMessage& TestAllTypes::optional_foreign_message() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_foreign_message)
+  return _internal_optional_foreign_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_foreign_message(
+    ::proto3_unittest::ForeignMessage* optional_foreign_message) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(optional_foreign_message_);
+  }
+  optional_foreign_message_ = optional_foreign_message;
+  if (optional_foreign_message) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.TestAllTypes.optional_foreign_message)
+}
+inline ::proto3_unittest::ForeignMessage* TestAllTypes::release_optional_foreign_message() {
+  
+  ::proto3_unittest::ForeignMessage* temp = optional_foreign_message_;
+  optional_foreign_message_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto3_unittest::ForeignMessage* TestAllTypes::unsafe_arena_release_optional_foreign_message() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_foreign_message)
+  
+  ::proto3_unittest::ForeignMessage* temp = optional_foreign_message_;
+  optional_foreign_message_ = nullptr;
+  return temp;
+}
+inline ::proto3_unittest::ForeignMessage* TestAllTypes::_internal_mutable_optional_foreign_message() {
+  
+  if (optional_foreign_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3_unittest::ForeignMessage>(GetArena());
+    optional_foreign_message_ = p;
+  }
+  return optional_foreign_message_;
+}
+inline ::proto3_unittest::ForeignMessage* TestAllTypes::mutable_optional_foreign_message() {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_foreign_message)
+  return _internal_mutable_optional_foreign_message();
+}
+inline void TestAllTypes::set_allocated_optional_foreign_message(::proto3_unittest::ForeignMessage* optional_foreign_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete optional_foreign_message_;
+  }
+  if (optional_foreign_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(optional_foreign_message);
+    if (message_arena != submessage_arena) {
+      optional_foreign_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, optional_foreign_message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  optional_foreign_message_ = optional_foreign_message;
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_foreign_message)
+}
+
+// .protobuf_unittest_import.ImportMessage optional_import_message = 20;
+inline bool TestAllTypes::_internal_has_optional_import_message() const {
+  return this != internal_default_instance() && optional_import_message_ != nullptr;
+}
+inline bool TestAllTypes::has_optional_import_message() const {
+  return _internal_has_optional_import_message();
+}
+inline const ::protobuf_unittest_import::ImportMessage& TestAllTypes::_internal_optional_import_message() const {
+  const ::protobuf_unittest_import::ImportMessage* p = optional_import_message_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::protobuf_unittest_import::ImportMessage*>(
+      &::protobuf_unittest_import::_ImportMessage_default_instance_);
+}
+inline const ::protobuf_unittest_import::ImportMessage& TestAllTypes::optional_import_message() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_import_message)
+  return _internal_optional_import_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_import_message(
+    ::protobuf_unittest_import::ImportMessage* optional_import_message) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(optional_import_message_);
+  }
+  optional_import_message_ = optional_import_message;
+  if (optional_import_message) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.TestAllTypes.optional_import_message)
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::release_optional_import_message() {
+  
+  ::protobuf_unittest_import::ImportMessage* temp = optional_import_message_;
+  optional_import_message_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::unsafe_arena_release_optional_import_message() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_import_message)
+  
+  ::protobuf_unittest_import::ImportMessage* temp = optional_import_message_;
+  optional_import_message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::_internal_mutable_optional_import_message() {
+  
+  if (optional_import_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest_import::ImportMessage>(GetArena());
+    optional_import_message_ = p;
+  }
+  return optional_import_message_;
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::mutable_optional_import_message() {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_import_message)
+  return _internal_mutable_optional_import_message();
+}
+inline void TestAllTypes::set_allocated_optional_import_message(::protobuf_unittest_import::ImportMessage* optional_import_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(optional_import_message_);
+  }
+  if (optional_import_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(optional_import_message)->GetArena();
+    if (message_arena != submessage_arena) {
+      optional_import_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, optional_import_message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  optional_import_message_ = optional_import_message;
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_import_message)
+}
+
+// .proto3_unittest.TestAllTypes.NestedEnum optional_nested_enum = 21;
+inline void TestAllTypes::clear_optional_nested_enum() {
+  optional_nested_enum_ = 0;
+}
+inline ::proto3_unittest::TestAllTypes_NestedEnum TestAllTypes::_internal_optional_nested_enum() const {
+  return static_cast< ::proto3_unittest::TestAllTypes_NestedEnum >(optional_nested_enum_);
+}
+inline ::proto3_unittest::TestAllTypes_NestedEnum TestAllTypes::optional_nested_enum() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_nested_enum)
+  return _internal_optional_nested_enum();
+}
+inline void TestAllTypes::_internal_set_optional_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value) {
+  
+  optional_nested_enum_ = value;
+}
+inline void TestAllTypes::set_optional_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value) {
+  _internal_set_optional_nested_enum(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_nested_enum)
+}
+
+// .proto3_unittest.ForeignEnum optional_foreign_enum = 22;
+inline void TestAllTypes::clear_optional_foreign_enum() {
+  optional_foreign_enum_ = 0;
+}
+inline ::proto3_unittest::ForeignEnum TestAllTypes::_internal_optional_foreign_enum() const {
+  return static_cast< ::proto3_unittest::ForeignEnum >(optional_foreign_enum_);
+}
+inline ::proto3_unittest::ForeignEnum TestAllTypes::optional_foreign_enum() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_foreign_enum)
+  return _internal_optional_foreign_enum();
+}
+inline void TestAllTypes::_internal_set_optional_foreign_enum(::proto3_unittest::ForeignEnum value) {
+  
+  optional_foreign_enum_ = value;
+}
+inline void TestAllTypes::set_optional_foreign_enum(::proto3_unittest::ForeignEnum value) {
+  _internal_set_optional_foreign_enum(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_foreign_enum)
+}
+
+// string optional_string_piece = 24 [ctype = STRING_PIECE];
+inline void TestAllTypes::clear_optional_string_piece() {
+  optional_string_piece_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& TestAllTypes::optional_string_piece() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_string_piece)
+  return _internal_optional_string_piece();
+}
+inline void TestAllTypes::set_optional_string_piece(const std::string& value) {
+  _internal_set_optional_string_piece(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_string_piece)
+}
+inline std::string* TestAllTypes::mutable_optional_string_piece() {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_string_piece)
+  return _internal_mutable_optional_string_piece();
+}
+inline const std::string& TestAllTypes::_internal_optional_string_piece() const {
+  return optional_string_piece_.Get();
+}
+inline void TestAllTypes::_internal_set_optional_string_piece(const std::string& value) {
+  
+  optional_string_piece_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void TestAllTypes::set_optional_string_piece(std::string&& value) {
+  
+  optional_string_piece_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto3_unittest.TestAllTypes.optional_string_piece)
+}
+inline void TestAllTypes::set_optional_string_piece(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  optional_string_piece_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto3_unittest.TestAllTypes.optional_string_piece)
+}
+inline void TestAllTypes::set_optional_string_piece(const char* value,
+    size_t size) {
+  
+  optional_string_piece_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto3_unittest.TestAllTypes.optional_string_piece)
+}
+inline std::string* TestAllTypes::_internal_mutable_optional_string_piece() {
+  
+  return optional_string_piece_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* TestAllTypes::release_optional_string_piece() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_string_piece)
+  return optional_string_piece_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void TestAllTypes::set_allocated_optional_string_piece(std::string* optional_string_piece) {
+  if (optional_string_piece != nullptr) {
+    
+  } else {
+    
+  }
+  optional_string_piece_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), optional_string_piece,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_string_piece)
+}
+
+// string optional_cord = 25 [ctype = CORD];
+inline void TestAllTypes::clear_optional_cord() {
+  optional_cord_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& TestAllTypes::optional_cord() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_cord)
+  return _internal_optional_cord();
+}
+inline void TestAllTypes::set_optional_cord(const std::string& value) {
+  _internal_set_optional_cord(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.optional_cord)
+}
+inline std::string* TestAllTypes::mutable_optional_cord() {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_cord)
+  return _internal_mutable_optional_cord();
+}
+inline const std::string& TestAllTypes::_internal_optional_cord() const {
+  return optional_cord_.Get();
+}
+inline void TestAllTypes::_internal_set_optional_cord(const std::string& value) {
+  
+  optional_cord_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void TestAllTypes::set_optional_cord(std::string&& value) {
+  
+  optional_cord_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto3_unittest.TestAllTypes.optional_cord)
+}
+inline void TestAllTypes::set_optional_cord(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  optional_cord_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto3_unittest.TestAllTypes.optional_cord)
+}
+inline void TestAllTypes::set_optional_cord(const char* value,
+    size_t size) {
+  
+  optional_cord_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto3_unittest.TestAllTypes.optional_cord)
+}
+inline std::string* TestAllTypes::_internal_mutable_optional_cord() {
+  
+  return optional_cord_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* TestAllTypes::release_optional_cord() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_cord)
+  return optional_cord_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void TestAllTypes::set_allocated_optional_cord(std::string* optional_cord) {
+  if (optional_cord != nullptr) {
+    
+  } else {
+    
+  }
+  optional_cord_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), optional_cord,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_cord)
+}
+
+// .protobuf_unittest_import.PublicImportMessage optional_public_import_message = 26;
+inline bool TestAllTypes::_internal_has_optional_public_import_message() const {
+  return this != internal_default_instance() && optional_public_import_message_ != nullptr;
+}
+inline bool TestAllTypes::has_optional_public_import_message() const {
+  return _internal_has_optional_public_import_message();
+}
+inline const ::protobuf_unittest_import::PublicImportMessage& TestAllTypes::_internal_optional_public_import_message() const {
+  const ::protobuf_unittest_import::PublicImportMessage* p = optional_public_import_message_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::protobuf_unittest_import::PublicImportMessage*>(
+      &::protobuf_unittest_import::_PublicImportMessage_default_instance_);
+}
+inline const ::protobuf_unittest_import::PublicImportMessage& TestAllTypes::optional_public_import_message() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_public_import_message)
+  return _internal_optional_public_import_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_public_import_message(
+    ::protobuf_unittest_import::PublicImportMessage* optional_public_import_message) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(optional_public_import_message_);
+  }
+  optional_public_import_message_ = optional_public_import_message;
+  if (optional_public_import_message) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.TestAllTypes.optional_public_import_message)
+}
+inline ::protobuf_unittest_import::PublicImportMessage* TestAllTypes::release_optional_public_import_message() {
+  
+  ::protobuf_unittest_import::PublicImportMessage* temp = optional_public_import_message_;
+  optional_public_import_message_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::protobuf_unittest_import::PublicImportMessage* TestAllTypes::unsafe_arena_release_optional_public_import_message() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_public_import_message)
+  
+  ::protobuf_unittest_import::PublicImportMessage* temp = optional_public_import_message_;
+  optional_public_import_message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest_import::PublicImportMessage* TestAllTypes::_internal_mutable_optional_public_import_message() {
+  
+  if (optional_public_import_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest_import::PublicImportMessage>(GetArena());
+    optional_public_import_message_ = p;
+  }
+  return optional_public_import_message_;
+}
+inline ::protobuf_unittest_import::PublicImportMessage* TestAllTypes::mutable_optional_public_import_message() {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_public_import_message)
+  return _internal_mutable_optional_public_import_message();
+}
+inline void TestAllTypes::set_allocated_optional_public_import_message(::protobuf_unittest_import::PublicImportMessage* optional_public_import_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(optional_public_import_message_);
+  }
+  if (optional_public_import_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(optional_public_import_message)->GetArena();
+    if (message_arena != submessage_arena) {
+      optional_public_import_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, optional_public_import_message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  optional_public_import_message_ = optional_public_import_message;
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_public_import_message)
+}
+
+// .proto3_unittest.TestAllTypes.NestedMessage optional_lazy_message = 27 [lazy = true];
+inline bool TestAllTypes::_internal_has_optional_lazy_message() const {
+  return this != internal_default_instance() && optional_lazy_message_ != nullptr;
+}
+inline bool TestAllTypes::has_optional_lazy_message() const {
+  return _internal_has_optional_lazy_message();
+}
+inline void TestAllTypes::clear_optional_lazy_message() {
+  if (GetArena() == nullptr && optional_lazy_message_ != nullptr) {
+    delete optional_lazy_message_;
+  }
+  optional_lazy_message_ = nullptr;
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::_internal_optional_lazy_message() const {
+  const ::proto3_unittest::TestAllTypes_NestedMessage* p = optional_lazy_message_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto3_unittest::TestAllTypes_NestedMessage*>(
+      &::proto3_unittest::_TestAllTypes_NestedMessage_default_instance_);
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::optional_lazy_message() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_lazy_message)
+  return _internal_optional_lazy_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_lazy_message(
+    ::proto3_unittest::TestAllTypes_NestedMessage* optional_lazy_message) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(optional_lazy_message_);
+  }
+  optional_lazy_message_ = optional_lazy_message;
+  if (optional_lazy_message) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.TestAllTypes.optional_lazy_message)
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::release_optional_lazy_message() {
+  
+  ::proto3_unittest::TestAllTypes_NestedMessage* temp = optional_lazy_message_;
+  optional_lazy_message_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::unsafe_arena_release_optional_lazy_message() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_lazy_message)
+  
+  ::proto3_unittest::TestAllTypes_NestedMessage* temp = optional_lazy_message_;
+  optional_lazy_message_ = nullptr;
+  return temp;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::_internal_mutable_optional_lazy_message() {
+  
+  if (optional_lazy_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3_unittest::TestAllTypes_NestedMessage>(GetArena());
+    optional_lazy_message_ = p;
+  }
+  return optional_lazy_message_;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_optional_lazy_message() {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_lazy_message)
+  return _internal_mutable_optional_lazy_message();
+}
+inline void TestAllTypes::set_allocated_optional_lazy_message(::proto3_unittest::TestAllTypes_NestedMessage* optional_lazy_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete optional_lazy_message_;
+  }
+  if (optional_lazy_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(optional_lazy_message);
+    if (message_arena != submessage_arena) {
+      optional_lazy_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, optional_lazy_message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  optional_lazy_message_ = optional_lazy_message;
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_lazy_message)
+}
+
+// .protobuf_unittest_import.ImportMessage optional_lazy_import_message = 115 [lazy = true];
+inline bool TestAllTypes::_internal_has_optional_lazy_import_message() const {
+  return this != internal_default_instance() && optional_lazy_import_message_ != nullptr;
+}
+inline bool TestAllTypes::has_optional_lazy_import_message() const {
+  return _internal_has_optional_lazy_import_message();
+}
+inline const ::protobuf_unittest_import::ImportMessage& TestAllTypes::_internal_optional_lazy_import_message() const {
+  const ::protobuf_unittest_import::ImportMessage* p = optional_lazy_import_message_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::protobuf_unittest_import::ImportMessage*>(
+      &::protobuf_unittest_import::_ImportMessage_default_instance_);
+}
+inline const ::protobuf_unittest_import::ImportMessage& TestAllTypes::optional_lazy_import_message() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.optional_lazy_import_message)
+  return _internal_optional_lazy_import_message();
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_optional_lazy_import_message(
+    ::protobuf_unittest_import::ImportMessage* optional_lazy_import_message) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(optional_lazy_import_message_);
+  }
+  optional_lazy_import_message_ = optional_lazy_import_message;
+  if (optional_lazy_import_message) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.TestAllTypes.optional_lazy_import_message)
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::release_optional_lazy_import_message() {
+  
+  ::protobuf_unittest_import::ImportMessage* temp = optional_lazy_import_message_;
+  optional_lazy_import_message_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::unsafe_arena_release_optional_lazy_import_message() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.optional_lazy_import_message)
+  
+  ::protobuf_unittest_import::ImportMessage* temp = optional_lazy_import_message_;
+  optional_lazy_import_message_ = nullptr;
+  return temp;
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::_internal_mutable_optional_lazy_import_message() {
+  
+  if (optional_lazy_import_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protobuf_unittest_import::ImportMessage>(GetArena());
+    optional_lazy_import_message_ = p;
+  }
+  return optional_lazy_import_message_;
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::mutable_optional_lazy_import_message() {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.optional_lazy_import_message)
+  return _internal_mutable_optional_lazy_import_message();
+}
+inline void TestAllTypes::set_allocated_optional_lazy_import_message(::protobuf_unittest_import::ImportMessage* optional_lazy_import_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(optional_lazy_import_message_);
+  }
+  if (optional_lazy_import_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(optional_lazy_import_message)->GetArena();
+    if (message_arena != submessage_arena) {
+      optional_lazy_import_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, optional_lazy_import_message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  optional_lazy_import_message_ = optional_lazy_import_message;
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.optional_lazy_import_message)
+}
+
+// repeated int32 repeated_int32 = 31;
+inline int TestAllTypes::_internal_repeated_int32_size() const {
+  return repeated_int32_.size();
+}
+inline int TestAllTypes::repeated_int32_size() const {
+  return _internal_repeated_int32_size();
+}
+inline void TestAllTypes::clear_repeated_int32() {
+  repeated_int32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestAllTypes::_internal_repeated_int32(int index) const {
+  return repeated_int32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestAllTypes::repeated_int32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_int32)
+  return _internal_repeated_int32(index);
+}
+inline void TestAllTypes::set_repeated_int32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  repeated_int32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_int32)
+}
+inline void TestAllTypes::_internal_add_repeated_int32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  repeated_int32_.Add(value);
+}
+inline void TestAllTypes::add_repeated_int32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_repeated_int32(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_int32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestAllTypes::_internal_repeated_int32() const {
+  return repeated_int32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestAllTypes::repeated_int32() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_int32)
+  return _internal_repeated_int32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestAllTypes::_internal_mutable_repeated_int32() {
+  return &repeated_int32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestAllTypes::mutable_repeated_int32() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_int32)
+  return _internal_mutable_repeated_int32();
+}
+
+// repeated int64 repeated_int64 = 32;
+inline int TestAllTypes::_internal_repeated_int64_size() const {
+  return repeated_int64_.size();
+}
+inline int TestAllTypes::repeated_int64_size() const {
+  return _internal_repeated_int64_size();
+}
+inline void TestAllTypes::clear_repeated_int64() {
+  repeated_int64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestAllTypes::_internal_repeated_int64(int index) const {
+  return repeated_int64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestAllTypes::repeated_int64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_int64)
+  return _internal_repeated_int64(index);
+}
+inline void TestAllTypes::set_repeated_int64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  repeated_int64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_int64)
+}
+inline void TestAllTypes::_internal_add_repeated_int64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  repeated_int64_.Add(value);
+}
+inline void TestAllTypes::add_repeated_int64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_repeated_int64(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_int64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestAllTypes::_internal_repeated_int64() const {
+  return repeated_int64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestAllTypes::repeated_int64() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_int64)
+  return _internal_repeated_int64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestAllTypes::_internal_mutable_repeated_int64() {
+  return &repeated_int64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestAllTypes::mutable_repeated_int64() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_int64)
+  return _internal_mutable_repeated_int64();
+}
+
+// repeated uint32 repeated_uint32 = 33;
+inline int TestAllTypes::_internal_repeated_uint32_size() const {
+  return repeated_uint32_.size();
+}
+inline int TestAllTypes::repeated_uint32_size() const {
+  return _internal_repeated_uint32_size();
+}
+inline void TestAllTypes::clear_repeated_uint32() {
+  repeated_uint32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestAllTypes::_internal_repeated_uint32(int index) const {
+  return repeated_uint32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestAllTypes::repeated_uint32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_uint32)
+  return _internal_repeated_uint32(index);
+}
+inline void TestAllTypes::set_repeated_uint32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  repeated_uint32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_uint32)
+}
+inline void TestAllTypes::_internal_add_repeated_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  repeated_uint32_.Add(value);
+}
+inline void TestAllTypes::add_repeated_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_repeated_uint32(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_uint32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestAllTypes::_internal_repeated_uint32() const {
+  return repeated_uint32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestAllTypes::repeated_uint32() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_uint32)
+  return _internal_repeated_uint32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestAllTypes::_internal_mutable_repeated_uint32() {
+  return &repeated_uint32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestAllTypes::mutable_repeated_uint32() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_uint32)
+  return _internal_mutable_repeated_uint32();
+}
+
+// repeated uint64 repeated_uint64 = 34;
+inline int TestAllTypes::_internal_repeated_uint64_size() const {
+  return repeated_uint64_.size();
+}
+inline int TestAllTypes::repeated_uint64_size() const {
+  return _internal_repeated_uint64_size();
+}
+inline void TestAllTypes::clear_repeated_uint64() {
+  repeated_uint64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestAllTypes::_internal_repeated_uint64(int index) const {
+  return repeated_uint64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestAllTypes::repeated_uint64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_uint64)
+  return _internal_repeated_uint64(index);
+}
+inline void TestAllTypes::set_repeated_uint64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  repeated_uint64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_uint64)
+}
+inline void TestAllTypes::_internal_add_repeated_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  repeated_uint64_.Add(value);
+}
+inline void TestAllTypes::add_repeated_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_add_repeated_uint64(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_uint64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestAllTypes::_internal_repeated_uint64() const {
+  return repeated_uint64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestAllTypes::repeated_uint64() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_uint64)
+  return _internal_repeated_uint64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestAllTypes::_internal_mutable_repeated_uint64() {
+  return &repeated_uint64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestAllTypes::mutable_repeated_uint64() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_uint64)
+  return _internal_mutable_repeated_uint64();
+}
+
+// repeated sint32 repeated_sint32 = 35;
+inline int TestAllTypes::_internal_repeated_sint32_size() const {
+  return repeated_sint32_.size();
+}
+inline int TestAllTypes::repeated_sint32_size() const {
+  return _internal_repeated_sint32_size();
+}
+inline void TestAllTypes::clear_repeated_sint32() {
+  repeated_sint32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestAllTypes::_internal_repeated_sint32(int index) const {
+  return repeated_sint32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestAllTypes::repeated_sint32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_sint32)
+  return _internal_repeated_sint32(index);
+}
+inline void TestAllTypes::set_repeated_sint32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  repeated_sint32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_sint32)
+}
+inline void TestAllTypes::_internal_add_repeated_sint32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  repeated_sint32_.Add(value);
+}
+inline void TestAllTypes::add_repeated_sint32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_repeated_sint32(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_sint32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestAllTypes::_internal_repeated_sint32() const {
+  return repeated_sint32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestAllTypes::repeated_sint32() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_sint32)
+  return _internal_repeated_sint32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestAllTypes::_internal_mutable_repeated_sint32() {
+  return &repeated_sint32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestAllTypes::mutable_repeated_sint32() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_sint32)
+  return _internal_mutable_repeated_sint32();
+}
+
+// repeated sint64 repeated_sint64 = 36;
+inline int TestAllTypes::_internal_repeated_sint64_size() const {
+  return repeated_sint64_.size();
+}
+inline int TestAllTypes::repeated_sint64_size() const {
+  return _internal_repeated_sint64_size();
+}
+inline void TestAllTypes::clear_repeated_sint64() {
+  repeated_sint64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestAllTypes::_internal_repeated_sint64(int index) const {
+  return repeated_sint64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestAllTypes::repeated_sint64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_sint64)
+  return _internal_repeated_sint64(index);
+}
+inline void TestAllTypes::set_repeated_sint64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  repeated_sint64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_sint64)
+}
+inline void TestAllTypes::_internal_add_repeated_sint64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  repeated_sint64_.Add(value);
+}
+inline void TestAllTypes::add_repeated_sint64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_repeated_sint64(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_sint64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestAllTypes::_internal_repeated_sint64() const {
+  return repeated_sint64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestAllTypes::repeated_sint64() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_sint64)
+  return _internal_repeated_sint64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestAllTypes::_internal_mutable_repeated_sint64() {
+  return &repeated_sint64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestAllTypes::mutable_repeated_sint64() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_sint64)
+  return _internal_mutable_repeated_sint64();
+}
+
+// repeated fixed32 repeated_fixed32 = 37;
+inline int TestAllTypes::_internal_repeated_fixed32_size() const {
+  return repeated_fixed32_.size();
+}
+inline int TestAllTypes::repeated_fixed32_size() const {
+  return _internal_repeated_fixed32_size();
+}
+inline void TestAllTypes::clear_repeated_fixed32() {
+  repeated_fixed32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestAllTypes::_internal_repeated_fixed32(int index) const {
+  return repeated_fixed32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestAllTypes::repeated_fixed32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_fixed32)
+  return _internal_repeated_fixed32(index);
+}
+inline void TestAllTypes::set_repeated_fixed32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  repeated_fixed32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_fixed32)
+}
+inline void TestAllTypes::_internal_add_repeated_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  repeated_fixed32_.Add(value);
+}
+inline void TestAllTypes::add_repeated_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_repeated_fixed32(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_fixed32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestAllTypes::_internal_repeated_fixed32() const {
+  return repeated_fixed32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestAllTypes::repeated_fixed32() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_fixed32)
+  return _internal_repeated_fixed32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestAllTypes::_internal_mutable_repeated_fixed32() {
+  return &repeated_fixed32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestAllTypes::mutable_repeated_fixed32() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_fixed32)
+  return _internal_mutable_repeated_fixed32();
+}
+
+// repeated fixed64 repeated_fixed64 = 38;
+inline int TestAllTypes::_internal_repeated_fixed64_size() const {
+  return repeated_fixed64_.size();
+}
+inline int TestAllTypes::repeated_fixed64_size() const {
+  return _internal_repeated_fixed64_size();
+}
+inline void TestAllTypes::clear_repeated_fixed64() {
+  repeated_fixed64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestAllTypes::_internal_repeated_fixed64(int index) const {
+  return repeated_fixed64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestAllTypes::repeated_fixed64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_fixed64)
+  return _internal_repeated_fixed64(index);
+}
+inline void TestAllTypes::set_repeated_fixed64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  repeated_fixed64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_fixed64)
+}
+inline void TestAllTypes::_internal_add_repeated_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  repeated_fixed64_.Add(value);
+}
+inline void TestAllTypes::add_repeated_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_add_repeated_fixed64(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_fixed64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestAllTypes::_internal_repeated_fixed64() const {
+  return repeated_fixed64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestAllTypes::repeated_fixed64() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_fixed64)
+  return _internal_repeated_fixed64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestAllTypes::_internal_mutable_repeated_fixed64() {
+  return &repeated_fixed64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestAllTypes::mutable_repeated_fixed64() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_fixed64)
+  return _internal_mutable_repeated_fixed64();
+}
+
+// repeated sfixed32 repeated_sfixed32 = 39;
+inline int TestAllTypes::_internal_repeated_sfixed32_size() const {
+  return repeated_sfixed32_.size();
+}
+inline int TestAllTypes::repeated_sfixed32_size() const {
+  return _internal_repeated_sfixed32_size();
+}
+inline void TestAllTypes::clear_repeated_sfixed32() {
+  repeated_sfixed32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestAllTypes::_internal_repeated_sfixed32(int index) const {
+  return repeated_sfixed32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestAllTypes::repeated_sfixed32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_sfixed32)
+  return _internal_repeated_sfixed32(index);
+}
+inline void TestAllTypes::set_repeated_sfixed32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  repeated_sfixed32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_sfixed32)
+}
+inline void TestAllTypes::_internal_add_repeated_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  repeated_sfixed32_.Add(value);
+}
+inline void TestAllTypes::add_repeated_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_repeated_sfixed32(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_sfixed32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestAllTypes::_internal_repeated_sfixed32() const {
+  return repeated_sfixed32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestAllTypes::repeated_sfixed32() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_sfixed32)
+  return _internal_repeated_sfixed32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestAllTypes::_internal_mutable_repeated_sfixed32() {
+  return &repeated_sfixed32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestAllTypes::mutable_repeated_sfixed32() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_sfixed32)
+  return _internal_mutable_repeated_sfixed32();
+}
+
+// repeated sfixed64 repeated_sfixed64 = 40;
+inline int TestAllTypes::_internal_repeated_sfixed64_size() const {
+  return repeated_sfixed64_.size();
+}
+inline int TestAllTypes::repeated_sfixed64_size() const {
+  return _internal_repeated_sfixed64_size();
+}
+inline void TestAllTypes::clear_repeated_sfixed64() {
+  repeated_sfixed64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestAllTypes::_internal_repeated_sfixed64(int index) const {
+  return repeated_sfixed64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestAllTypes::repeated_sfixed64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_sfixed64)
+  return _internal_repeated_sfixed64(index);
+}
+inline void TestAllTypes::set_repeated_sfixed64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  repeated_sfixed64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_sfixed64)
+}
+inline void TestAllTypes::_internal_add_repeated_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  repeated_sfixed64_.Add(value);
+}
+inline void TestAllTypes::add_repeated_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_repeated_sfixed64(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_sfixed64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestAllTypes::_internal_repeated_sfixed64() const {
+  return repeated_sfixed64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestAllTypes::repeated_sfixed64() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_sfixed64)
+  return _internal_repeated_sfixed64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestAllTypes::_internal_mutable_repeated_sfixed64() {
+  return &repeated_sfixed64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestAllTypes::mutable_repeated_sfixed64() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_sfixed64)
+  return _internal_mutable_repeated_sfixed64();
+}
+
+// repeated float repeated_float = 41;
+inline int TestAllTypes::_internal_repeated_float_size() const {
+  return repeated_float_.size();
+}
+inline int TestAllTypes::repeated_float_size() const {
+  return _internal_repeated_float_size();
+}
+inline void TestAllTypes::clear_repeated_float() {
+  repeated_float_.Clear();
+}
+inline float TestAllTypes::_internal_repeated_float(int index) const {
+  return repeated_float_.Get(index);
+}
+inline float TestAllTypes::repeated_float(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_float)
+  return _internal_repeated_float(index);
+}
+inline void TestAllTypes::set_repeated_float(int index, float value) {
+  repeated_float_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_float)
+}
+inline void TestAllTypes::_internal_add_repeated_float(float value) {
+  repeated_float_.Add(value);
+}
+inline void TestAllTypes::add_repeated_float(float value) {
+  _internal_add_repeated_float(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_float)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+TestAllTypes::_internal_repeated_float() const {
+  return repeated_float_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+TestAllTypes::repeated_float() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_float)
+  return _internal_repeated_float();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+TestAllTypes::_internal_mutable_repeated_float() {
+  return &repeated_float_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+TestAllTypes::mutable_repeated_float() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_float)
+  return _internal_mutable_repeated_float();
+}
+
+// repeated double repeated_double = 42;
+inline int TestAllTypes::_internal_repeated_double_size() const {
+  return repeated_double_.size();
+}
+inline int TestAllTypes::repeated_double_size() const {
+  return _internal_repeated_double_size();
+}
+inline void TestAllTypes::clear_repeated_double() {
+  repeated_double_.Clear();
+}
+inline double TestAllTypes::_internal_repeated_double(int index) const {
+  return repeated_double_.Get(index);
+}
+inline double TestAllTypes::repeated_double(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_double)
+  return _internal_repeated_double(index);
+}
+inline void TestAllTypes::set_repeated_double(int index, double value) {
+  repeated_double_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_double)
+}
+inline void TestAllTypes::_internal_add_repeated_double(double value) {
+  repeated_double_.Add(value);
+}
+inline void TestAllTypes::add_repeated_double(double value) {
+  _internal_add_repeated_double(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_double)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+TestAllTypes::_internal_repeated_double() const {
+  return repeated_double_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+TestAllTypes::repeated_double() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_double)
+  return _internal_repeated_double();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+TestAllTypes::_internal_mutable_repeated_double() {
+  return &repeated_double_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+TestAllTypes::mutable_repeated_double() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_double)
+  return _internal_mutable_repeated_double();
+}
+
+// repeated bool repeated_bool = 43;
+inline int TestAllTypes::_internal_repeated_bool_size() const {
+  return repeated_bool_.size();
+}
+inline int TestAllTypes::repeated_bool_size() const {
+  return _internal_repeated_bool_size();
+}
+inline void TestAllTypes::clear_repeated_bool() {
+  repeated_bool_.Clear();
+}
+inline bool TestAllTypes::_internal_repeated_bool(int index) const {
+  return repeated_bool_.Get(index);
+}
+inline bool TestAllTypes::repeated_bool(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_bool)
+  return _internal_repeated_bool(index);
+}
+inline void TestAllTypes::set_repeated_bool(int index, bool value) {
+  repeated_bool_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_bool)
+}
+inline void TestAllTypes::_internal_add_repeated_bool(bool value) {
+  repeated_bool_.Add(value);
+}
+inline void TestAllTypes::add_repeated_bool(bool value) {
+  _internal_add_repeated_bool(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_bool)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+TestAllTypes::_internal_repeated_bool() const {
+  return repeated_bool_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+TestAllTypes::repeated_bool() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_bool)
+  return _internal_repeated_bool();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+TestAllTypes::_internal_mutable_repeated_bool() {
+  return &repeated_bool_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+TestAllTypes::mutable_repeated_bool() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_bool)
+  return _internal_mutable_repeated_bool();
+}
+
+// repeated string repeated_string = 44;
+inline int TestAllTypes::_internal_repeated_string_size() const {
+  return repeated_string_.size();
+}
+inline int TestAllTypes::repeated_string_size() const {
+  return _internal_repeated_string_size();
+}
+inline void TestAllTypes::clear_repeated_string() {
+  repeated_string_.Clear();
+}
+inline std::string* TestAllTypes::add_repeated_string() {
+  // @@protoc_insertion_point(field_add_mutable:proto3_unittest.TestAllTypes.repeated_string)
+  return _internal_add_repeated_string();
+}
+inline const std::string& TestAllTypes::_internal_repeated_string(int index) const {
+  return repeated_string_.Get(index);
+}
+inline const std::string& TestAllTypes::repeated_string(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_string)
+  return _internal_repeated_string(index);
+}
+inline std::string* TestAllTypes::mutable_repeated_string(int index) {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_string)
+  return repeated_string_.Mutable(index);
+}
+inline void TestAllTypes::set_repeated_string(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_string)
+  repeated_string_.Mutable(index)->assign(value);
+}
+inline void TestAllTypes::set_repeated_string(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_string)
+  repeated_string_.Mutable(index)->assign(std::move(value));
+}
+inline void TestAllTypes::set_repeated_string(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  repeated_string_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::set_repeated_string(int index, const char* value, size_t size) {
+  repeated_string_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline std::string* TestAllTypes::_internal_add_repeated_string() {
+  return repeated_string_.Add();
+}
+inline void TestAllTypes::add_repeated_string(const std::string& value) {
+  repeated_string_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::add_repeated_string(std::string&& value) {
+  repeated_string_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::add_repeated_string(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  repeated_string_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline void TestAllTypes::add_repeated_string(const char* value, size_t size) {
+  repeated_string_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto3_unittest.TestAllTypes.repeated_string)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TestAllTypes::repeated_string() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_string)
+  return repeated_string_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TestAllTypes::mutable_repeated_string() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_string)
+  return &repeated_string_;
+}
+
+// repeated bytes repeated_bytes = 45;
+inline int TestAllTypes::_internal_repeated_bytes_size() const {
+  return repeated_bytes_.size();
+}
+inline int TestAllTypes::repeated_bytes_size() const {
+  return _internal_repeated_bytes_size();
+}
+inline void TestAllTypes::clear_repeated_bytes() {
+  repeated_bytes_.Clear();
+}
+inline std::string* TestAllTypes::add_repeated_bytes() {
+  // @@protoc_insertion_point(field_add_mutable:proto3_unittest.TestAllTypes.repeated_bytes)
+  return _internal_add_repeated_bytes();
+}
+inline const std::string& TestAllTypes::_internal_repeated_bytes(int index) const {
+  return repeated_bytes_.Get(index);
+}
+inline const std::string& TestAllTypes::repeated_bytes(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_bytes)
+  return _internal_repeated_bytes(index);
+}
+inline std::string* TestAllTypes::mutable_repeated_bytes(int index) {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_bytes)
+  return repeated_bytes_.Mutable(index);
+}
+inline void TestAllTypes::set_repeated_bytes(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_bytes)
+  repeated_bytes_.Mutable(index)->assign(value);
+}
+inline void TestAllTypes::set_repeated_bytes(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_bytes)
+  repeated_bytes_.Mutable(index)->assign(std::move(value));
+}
+inline void TestAllTypes::set_repeated_bytes(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  repeated_bytes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::set_repeated_bytes(int index, const void* value, size_t size) {
+  repeated_bytes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline std::string* TestAllTypes::_internal_add_repeated_bytes() {
+  return repeated_bytes_.Add();
+}
+inline void TestAllTypes::add_repeated_bytes(const std::string& value) {
+  repeated_bytes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::add_repeated_bytes(std::string&& value) {
+  repeated_bytes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::add_repeated_bytes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  repeated_bytes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline void TestAllTypes::add_repeated_bytes(const void* value, size_t size) {
+  repeated_bytes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto3_unittest.TestAllTypes.repeated_bytes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TestAllTypes::repeated_bytes() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_bytes)
+  return repeated_bytes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TestAllTypes::mutable_repeated_bytes() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_bytes)
+  return &repeated_bytes_;
+}
+
+// repeated .proto3_unittest.TestAllTypes.NestedMessage repeated_nested_message = 48;
+inline int TestAllTypes::_internal_repeated_nested_message_size() const {
+  return repeated_nested_message_.size();
+}
+inline int TestAllTypes::repeated_nested_message_size() const {
+  return _internal_repeated_nested_message_size();
+}
+inline void TestAllTypes::clear_repeated_nested_message() {
+  repeated_nested_message_.Clear();
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_repeated_nested_message(int index) {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_nested_message)
+  return repeated_nested_message_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage >*
+TestAllTypes::mutable_repeated_nested_message() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_nested_message)
+  return &repeated_nested_message_;
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::_internal_repeated_nested_message(int index) const {
+  return repeated_nested_message_.Get(index);
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::repeated_nested_message(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_nested_message)
+  return _internal_repeated_nested_message(index);
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::_internal_add_repeated_nested_message() {
+  return repeated_nested_message_.Add();
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::add_repeated_nested_message() {
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_nested_message)
+  return _internal_add_repeated_nested_message();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage >&
+TestAllTypes::repeated_nested_message() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_nested_message)
+  return repeated_nested_message_;
+}
+
+// repeated .proto3_unittest.ForeignMessage repeated_foreign_message = 49;
+inline int TestAllTypes::_internal_repeated_foreign_message_size() const {
+  return repeated_foreign_message_.size();
+}
+inline int TestAllTypes::repeated_foreign_message_size() const {
+  return _internal_repeated_foreign_message_size();
+}
+inline void TestAllTypes::clear_repeated_foreign_message() {
+  repeated_foreign_message_.Clear();
+}
+inline ::proto3_unittest::ForeignMessage* TestAllTypes::mutable_repeated_foreign_message(int index) {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_foreign_message)
+  return repeated_foreign_message_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto3_unittest::ForeignMessage >*
+TestAllTypes::mutable_repeated_foreign_message() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_foreign_message)
+  return &repeated_foreign_message_;
+}
+inline const ::proto3_unittest::ForeignMessage& TestAllTypes::_internal_repeated_foreign_message(int index) const {
+  return repeated_foreign_message_.Get(index);
+}
+inline const ::proto3_unittest::ForeignMessage& TestAllTypes::repeated_foreign_message(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_foreign_message)
+  return _internal_repeated_foreign_message(index);
+}
+inline ::proto3_unittest::ForeignMessage* TestAllTypes::_internal_add_repeated_foreign_message() {
+  return repeated_foreign_message_.Add();
+}
+inline ::proto3_unittest::ForeignMessage* TestAllTypes::add_repeated_foreign_message() {
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_foreign_message)
+  return _internal_add_repeated_foreign_message();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto3_unittest::ForeignMessage >&
+TestAllTypes::repeated_foreign_message() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_foreign_message)
+  return repeated_foreign_message_;
+}
+
+// repeated .protobuf_unittest_import.ImportMessage repeated_import_message = 50;
+inline int TestAllTypes::_internal_repeated_import_message_size() const {
+  return repeated_import_message_.size();
+}
+inline int TestAllTypes::repeated_import_message_size() const {
+  return _internal_repeated_import_message_size();
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::mutable_repeated_import_message(int index) {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_import_message)
+  return repeated_import_message_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest_import::ImportMessage >*
+TestAllTypes::mutable_repeated_import_message() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_import_message)
+  return &repeated_import_message_;
+}
+inline const ::protobuf_unittest_import::ImportMessage& TestAllTypes::_internal_repeated_import_message(int index) const {
+  return repeated_import_message_.Get(index);
+}
+inline const ::protobuf_unittest_import::ImportMessage& TestAllTypes::repeated_import_message(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_import_message)
+  return _internal_repeated_import_message(index);
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::_internal_add_repeated_import_message() {
+  return repeated_import_message_.Add();
+}
+inline ::protobuf_unittest_import::ImportMessage* TestAllTypes::add_repeated_import_message() {
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_import_message)
+  return _internal_add_repeated_import_message();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protobuf_unittest_import::ImportMessage >&
+TestAllTypes::repeated_import_message() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_import_message)
+  return repeated_import_message_;
+}
+
+// repeated .proto3_unittest.TestAllTypes.NestedEnum repeated_nested_enum = 51;
+inline int TestAllTypes::_internal_repeated_nested_enum_size() const {
+  return repeated_nested_enum_.size();
+}
+inline int TestAllTypes::repeated_nested_enum_size() const {
+  return _internal_repeated_nested_enum_size();
+}
+inline void TestAllTypes::clear_repeated_nested_enum() {
+  repeated_nested_enum_.Clear();
+}
+inline ::proto3_unittest::TestAllTypes_NestedEnum TestAllTypes::_internal_repeated_nested_enum(int index) const {
+  return static_cast< ::proto3_unittest::TestAllTypes_NestedEnum >(repeated_nested_enum_.Get(index));
+}
+inline ::proto3_unittest::TestAllTypes_NestedEnum TestAllTypes::repeated_nested_enum(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_nested_enum)
+  return _internal_repeated_nested_enum(index);
+}
+inline void TestAllTypes::set_repeated_nested_enum(int index, ::proto3_unittest::TestAllTypes_NestedEnum value) {
+  repeated_nested_enum_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_nested_enum)
+}
+inline void TestAllTypes::_internal_add_repeated_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value) {
+  repeated_nested_enum_.Add(value);
+}
+inline void TestAllTypes::add_repeated_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value) {
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_nested_enum)
+  _internal_add_repeated_nested_enum(value);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+TestAllTypes::repeated_nested_enum() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_nested_enum)
+  return repeated_nested_enum_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+TestAllTypes::_internal_mutable_repeated_nested_enum() {
+  return &repeated_nested_enum_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+TestAllTypes::mutable_repeated_nested_enum() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_nested_enum)
+  return _internal_mutable_repeated_nested_enum();
+}
+
+// repeated .proto3_unittest.ForeignEnum repeated_foreign_enum = 52;
+inline int TestAllTypes::_internal_repeated_foreign_enum_size() const {
+  return repeated_foreign_enum_.size();
+}
+inline int TestAllTypes::repeated_foreign_enum_size() const {
+  return _internal_repeated_foreign_enum_size();
+}
+inline void TestAllTypes::clear_repeated_foreign_enum() {
+  repeated_foreign_enum_.Clear();
+}
+inline ::proto3_unittest::ForeignEnum TestAllTypes::_internal_repeated_foreign_enum(int index) const {
+  return static_cast< ::proto3_unittest::ForeignEnum >(repeated_foreign_enum_.Get(index));
+}
+inline ::proto3_unittest::ForeignEnum TestAllTypes::repeated_foreign_enum(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_foreign_enum)
+  return _internal_repeated_foreign_enum(index);
+}
+inline void TestAllTypes::set_repeated_foreign_enum(int index, ::proto3_unittest::ForeignEnum value) {
+  repeated_foreign_enum_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_foreign_enum)
+}
+inline void TestAllTypes::_internal_add_repeated_foreign_enum(::proto3_unittest::ForeignEnum value) {
+  repeated_foreign_enum_.Add(value);
+}
+inline void TestAllTypes::add_repeated_foreign_enum(::proto3_unittest::ForeignEnum value) {
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_foreign_enum)
+  _internal_add_repeated_foreign_enum(value);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+TestAllTypes::repeated_foreign_enum() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_foreign_enum)
+  return repeated_foreign_enum_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+TestAllTypes::_internal_mutable_repeated_foreign_enum() {
+  return &repeated_foreign_enum_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+TestAllTypes::mutable_repeated_foreign_enum() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_foreign_enum)
+  return _internal_mutable_repeated_foreign_enum();
+}
+
+// repeated string repeated_string_piece = 54 [ctype = STRING_PIECE];
+inline int TestAllTypes::_internal_repeated_string_piece_size() const {
+  return repeated_string_piece_.size();
+}
+inline int TestAllTypes::repeated_string_piece_size() const {
+  return _internal_repeated_string_piece_size();
+}
+inline void TestAllTypes::clear_repeated_string_piece() {
+  repeated_string_piece_.Clear();
+}
+inline std::string* TestAllTypes::add_repeated_string_piece() {
+  // @@protoc_insertion_point(field_add_mutable:proto3_unittest.TestAllTypes.repeated_string_piece)
+  return _internal_add_repeated_string_piece();
+}
+inline const std::string& TestAllTypes::_internal_repeated_string_piece(int index) const {
+  return repeated_string_piece_.Get(index);
+}
+inline const std::string& TestAllTypes::repeated_string_piece(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_string_piece)
+  return _internal_repeated_string_piece(index);
+}
+inline std::string* TestAllTypes::mutable_repeated_string_piece(int index) {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_string_piece)
+  return repeated_string_piece_.Mutable(index);
+}
+inline void TestAllTypes::set_repeated_string_piece(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_string_piece)
+  repeated_string_piece_.Mutable(index)->assign(value);
+}
+inline void TestAllTypes::set_repeated_string_piece(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_string_piece)
+  repeated_string_piece_.Mutable(index)->assign(std::move(value));
+}
+inline void TestAllTypes::set_repeated_string_piece(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  repeated_string_piece_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::set_repeated_string_piece(int index, const char* value, size_t size) {
+  repeated_string_piece_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline std::string* TestAllTypes::_internal_add_repeated_string_piece() {
+  return repeated_string_piece_.Add();
+}
+inline void TestAllTypes::add_repeated_string_piece(const std::string& value) {
+  repeated_string_piece_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::add_repeated_string_piece(std::string&& value) {
+  repeated_string_piece_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::add_repeated_string_piece(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  repeated_string_piece_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline void TestAllTypes::add_repeated_string_piece(const char* value, size_t size) {
+  repeated_string_piece_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto3_unittest.TestAllTypes.repeated_string_piece)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TestAllTypes::repeated_string_piece() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_string_piece)
+  return repeated_string_piece_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TestAllTypes::mutable_repeated_string_piece() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_string_piece)
+  return &repeated_string_piece_;
+}
+
+// repeated string repeated_cord = 55 [ctype = CORD];
+inline int TestAllTypes::_internal_repeated_cord_size() const {
+  return repeated_cord_.size();
+}
+inline int TestAllTypes::repeated_cord_size() const {
+  return _internal_repeated_cord_size();
+}
+inline void TestAllTypes::clear_repeated_cord() {
+  repeated_cord_.Clear();
+}
+inline std::string* TestAllTypes::add_repeated_cord() {
+  // @@protoc_insertion_point(field_add_mutable:proto3_unittest.TestAllTypes.repeated_cord)
+  return _internal_add_repeated_cord();
+}
+inline const std::string& TestAllTypes::_internal_repeated_cord(int index) const {
+  return repeated_cord_.Get(index);
+}
+inline const std::string& TestAllTypes::repeated_cord(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_cord)
+  return _internal_repeated_cord(index);
+}
+inline std::string* TestAllTypes::mutable_repeated_cord(int index) {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_cord)
+  return repeated_cord_.Mutable(index);
+}
+inline void TestAllTypes::set_repeated_cord(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_cord)
+  repeated_cord_.Mutable(index)->assign(value);
+}
+inline void TestAllTypes::set_repeated_cord(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.repeated_cord)
+  repeated_cord_.Mutable(index)->assign(std::move(value));
+}
+inline void TestAllTypes::set_repeated_cord(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  repeated_cord_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::set_repeated_cord(int index, const char* value, size_t size) {
+  repeated_cord_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline std::string* TestAllTypes::_internal_add_repeated_cord() {
+  return repeated_cord_.Add();
+}
+inline void TestAllTypes::add_repeated_cord(const std::string& value) {
+  repeated_cord_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::add_repeated_cord(std::string&& value) {
+  repeated_cord_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::add_repeated_cord(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  repeated_cord_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline void TestAllTypes::add_repeated_cord(const char* value, size_t size) {
+  repeated_cord_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto3_unittest.TestAllTypes.repeated_cord)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TestAllTypes::repeated_cord() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_cord)
+  return repeated_cord_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TestAllTypes::mutable_repeated_cord() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_cord)
+  return &repeated_cord_;
+}
+
+// repeated .proto3_unittest.TestAllTypes.NestedMessage repeated_lazy_message = 57 [lazy = true];
+inline int TestAllTypes::_internal_repeated_lazy_message_size() const {
+  return repeated_lazy_message_.size();
+}
+inline int TestAllTypes::repeated_lazy_message_size() const {
+  return _internal_repeated_lazy_message_size();
+}
+inline void TestAllTypes::clear_repeated_lazy_message() {
+  repeated_lazy_message_.Clear();
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_repeated_lazy_message(int index) {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.repeated_lazy_message)
+  return repeated_lazy_message_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage >*
+TestAllTypes::mutable_repeated_lazy_message() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestAllTypes.repeated_lazy_message)
+  return &repeated_lazy_message_;
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::_internal_repeated_lazy_message(int index) const {
+  return repeated_lazy_message_.Get(index);
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::repeated_lazy_message(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.repeated_lazy_message)
+  return _internal_repeated_lazy_message(index);
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::_internal_add_repeated_lazy_message() {
+  return repeated_lazy_message_.Add();
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::add_repeated_lazy_message() {
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestAllTypes.repeated_lazy_message)
+  return _internal_add_repeated_lazy_message();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto3_unittest::TestAllTypes_NestedMessage >&
+TestAllTypes::repeated_lazy_message() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestAllTypes.repeated_lazy_message)
+  return repeated_lazy_message_;
+}
+
+// uint32 oneof_uint32 = 111;
+inline bool TestAllTypes::_internal_has_oneof_uint32() const {
+  return oneof_field_case() == kOneofUint32;
+}
+inline void TestAllTypes::set_has_oneof_uint32() {
+  _oneof_case_[0] = kOneofUint32;
+}
+inline void TestAllTypes::clear_oneof_uint32() {
+  if (_internal_has_oneof_uint32()) {
+    oneof_field_.oneof_uint32_ = 0u;
+    clear_has_oneof_field();
+  }
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestAllTypes::_internal_oneof_uint32() const {
+  if (_internal_has_oneof_uint32()) {
+    return oneof_field_.oneof_uint32_;
+  }
+  return 0u;
+}
+inline void TestAllTypes::_internal_set_oneof_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  if (!_internal_has_oneof_uint32()) {
+    clear_oneof_field();
+    set_has_oneof_uint32();
+  }
+  oneof_field_.oneof_uint32_ = value;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestAllTypes::oneof_uint32() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.oneof_uint32)
+  return _internal_oneof_uint32();
+}
+inline void TestAllTypes::set_oneof_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_oneof_uint32(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.oneof_uint32)
+}
+
+// .proto3_unittest.TestAllTypes.NestedMessage oneof_nested_message = 112;
+inline bool TestAllTypes::_internal_has_oneof_nested_message() const {
+  return oneof_field_case() == kOneofNestedMessage;
+}
+inline bool TestAllTypes::has_oneof_nested_message() const {
+  return _internal_has_oneof_nested_message();
+}
+inline void TestAllTypes::set_has_oneof_nested_message() {
+  _oneof_case_[0] = kOneofNestedMessage;
+}
+inline void TestAllTypes::clear_oneof_nested_message() {
+  if (_internal_has_oneof_nested_message()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.oneof_nested_message_;
+    }
+    clear_has_oneof_field();
+  }
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::release_oneof_nested_message() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.oneof_nested_message)
+  if (_internal_has_oneof_nested_message()) {
+    clear_has_oneof_field();
+      ::proto3_unittest::TestAllTypes_NestedMessage* temp = oneof_field_.oneof_nested_message_;
+    if (GetArena() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    oneof_field_.oneof_nested_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::_internal_oneof_nested_message() const {
+  return _internal_has_oneof_nested_message()
+      ? *oneof_field_.oneof_nested_message_
+      : *reinterpret_cast< ::proto3_unittest::TestAllTypes_NestedMessage*>(&::proto3_unittest::_TestAllTypes_NestedMessage_default_instance_);
+}
+inline const ::proto3_unittest::TestAllTypes_NestedMessage& TestAllTypes::oneof_nested_message() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.oneof_nested_message)
+  return _internal_oneof_nested_message();
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::unsafe_arena_release_oneof_nested_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:proto3_unittest.TestAllTypes.oneof_nested_message)
+  if (_internal_has_oneof_nested_message()) {
+    clear_has_oneof_field();
+    ::proto3_unittest::TestAllTypes_NestedMessage* temp = oneof_field_.oneof_nested_message_;
+    oneof_field_.oneof_nested_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TestAllTypes::unsafe_arena_set_allocated_oneof_nested_message(::proto3_unittest::TestAllTypes_NestedMessage* oneof_nested_message) {
+  clear_oneof_field();
+  if (oneof_nested_message) {
+    set_has_oneof_nested_message();
+    oneof_field_.oneof_nested_message_ = oneof_nested_message;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.TestAllTypes.oneof_nested_message)
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::_internal_mutable_oneof_nested_message() {
+  if (!_internal_has_oneof_nested_message()) {
+    clear_oneof_field();
+    set_has_oneof_nested_message();
+    oneof_field_.oneof_nested_message_ = CreateMaybeMessage< ::proto3_unittest::TestAllTypes_NestedMessage >(GetArena());
+  }
+  return oneof_field_.oneof_nested_message_;
+}
+inline ::proto3_unittest::TestAllTypes_NestedMessage* TestAllTypes::mutable_oneof_nested_message() {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.oneof_nested_message)
+  return _internal_mutable_oneof_nested_message();
+}
+
+// string oneof_string = 113;
+inline bool TestAllTypes::_internal_has_oneof_string() const {
+  return oneof_field_case() == kOneofString;
+}
+inline void TestAllTypes::set_has_oneof_string() {
+  _oneof_case_[0] = kOneofString;
+}
+inline void TestAllTypes::clear_oneof_string() {
+  if (_internal_has_oneof_string()) {
+    oneof_field_.oneof_string_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+    clear_has_oneof_field();
+  }
+}
+inline const std::string& TestAllTypes::oneof_string() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.oneof_string)
+  return _internal_oneof_string();
+}
+inline void TestAllTypes::set_oneof_string(const std::string& value) {
+  _internal_set_oneof_string(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.oneof_string)
+}
+inline std::string* TestAllTypes::mutable_oneof_string() {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.oneof_string)
+  return _internal_mutable_oneof_string();
+}
+inline const std::string& TestAllTypes::_internal_oneof_string() const {
+  if (_internal_has_oneof_string()) {
+    return oneof_field_.oneof_string_.Get();
+  }
+  return *&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void TestAllTypes::_internal_set_oneof_string(const std::string& value) {
+  if (!_internal_has_oneof_string()) {
+    clear_oneof_field();
+    set_has_oneof_string();
+    oneof_field_.oneof_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  oneof_field_.oneof_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void TestAllTypes::set_oneof_string(std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.oneof_string)
+  if (!_internal_has_oneof_string()) {
+    clear_oneof_field();
+    set_has_oneof_string();
+    oneof_field_.oneof_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  oneof_field_.oneof_string_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto3_unittest.TestAllTypes.oneof_string)
+}
+inline void TestAllTypes::set_oneof_string(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  if (!_internal_has_oneof_string()) {
+    clear_oneof_field();
+    set_has_oneof_string();
+    oneof_field_.oneof_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  oneof_field_.oneof_string_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:proto3_unittest.TestAllTypes.oneof_string)
+}
+inline void TestAllTypes::set_oneof_string(const char* value,
+                             size_t size) {
+  if (!_internal_has_oneof_string()) {
+    clear_oneof_field();
+    set_has_oneof_string();
+    oneof_field_.oneof_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  oneof_field_.oneof_string_.Set(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size),
+      GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto3_unittest.TestAllTypes.oneof_string)
+}
+inline std::string* TestAllTypes::_internal_mutable_oneof_string() {
+  if (!_internal_has_oneof_string()) {
+    clear_oneof_field();
+    set_has_oneof_string();
+    oneof_field_.oneof_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  return oneof_field_.oneof_string_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* TestAllTypes::release_oneof_string() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.oneof_string)
+  if (_internal_has_oneof_string()) {
+    clear_has_oneof_field();
+    return oneof_field_.oneof_string_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  } else {
+    return nullptr;
+  }
+}
+inline void TestAllTypes::set_allocated_oneof_string(std::string* oneof_string) {
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  if (oneof_string != nullptr) {
+    set_has_oneof_string();
+    oneof_field_.oneof_string_.UnsafeSetDefault(oneof_string);
+    ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena();
+    if (arena != nullptr) {
+      arena->Own(oneof_string);
+    }
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.oneof_string)
+}
+
+// bytes oneof_bytes = 114;
+inline bool TestAllTypes::_internal_has_oneof_bytes() const {
+  return oneof_field_case() == kOneofBytes;
+}
+inline void TestAllTypes::set_has_oneof_bytes() {
+  _oneof_case_[0] = kOneofBytes;
+}
+inline void TestAllTypes::clear_oneof_bytes() {
+  if (_internal_has_oneof_bytes()) {
+    oneof_field_.oneof_bytes_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+    clear_has_oneof_field();
+  }
+}
+inline const std::string& TestAllTypes::oneof_bytes() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestAllTypes.oneof_bytes)
+  return _internal_oneof_bytes();
+}
+inline void TestAllTypes::set_oneof_bytes(const std::string& value) {
+  _internal_set_oneof_bytes(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.oneof_bytes)
+}
+inline std::string* TestAllTypes::mutable_oneof_bytes() {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.TestAllTypes.oneof_bytes)
+  return _internal_mutable_oneof_bytes();
+}
+inline const std::string& TestAllTypes::_internal_oneof_bytes() const {
+  if (_internal_has_oneof_bytes()) {
+    return oneof_field_.oneof_bytes_.Get();
+  }
+  return *&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void TestAllTypes::_internal_set_oneof_bytes(const std::string& value) {
+  if (!_internal_has_oneof_bytes()) {
+    clear_oneof_field();
+    set_has_oneof_bytes();
+    oneof_field_.oneof_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  oneof_field_.oneof_bytes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void TestAllTypes::set_oneof_bytes(std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestAllTypes.oneof_bytes)
+  if (!_internal_has_oneof_bytes()) {
+    clear_oneof_field();
+    set_has_oneof_bytes();
+    oneof_field_.oneof_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  oneof_field_.oneof_bytes_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto3_unittest.TestAllTypes.oneof_bytes)
+}
+inline void TestAllTypes::set_oneof_bytes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  if (!_internal_has_oneof_bytes()) {
+    clear_oneof_field();
+    set_has_oneof_bytes();
+    oneof_field_.oneof_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  oneof_field_.oneof_bytes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:proto3_unittest.TestAllTypes.oneof_bytes)
+}
+inline void TestAllTypes::set_oneof_bytes(const void* value,
+                             size_t size) {
+  if (!_internal_has_oneof_bytes()) {
+    clear_oneof_field();
+    set_has_oneof_bytes();
+    oneof_field_.oneof_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  oneof_field_.oneof_bytes_.Set(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size),
+      GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto3_unittest.TestAllTypes.oneof_bytes)
+}
+inline std::string* TestAllTypes::_internal_mutable_oneof_bytes() {
+  if (!_internal_has_oneof_bytes()) {
+    clear_oneof_field();
+    set_has_oneof_bytes();
+    oneof_field_.oneof_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  }
+  return oneof_field_.oneof_bytes_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* TestAllTypes::release_oneof_bytes() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.TestAllTypes.oneof_bytes)
+  if (_internal_has_oneof_bytes()) {
+    clear_has_oneof_field();
+    return oneof_field_.oneof_bytes_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  } else {
+    return nullptr;
+  }
+}
+inline void TestAllTypes::set_allocated_oneof_bytes(std::string* oneof_bytes) {
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+  if (oneof_bytes != nullptr) {
+    set_has_oneof_bytes();
+    oneof_field_.oneof_bytes_.UnsafeSetDefault(oneof_bytes);
+    ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena();
+    if (arena != nullptr) {
+      arena->Own(oneof_bytes);
+    }
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.TestAllTypes.oneof_bytes)
+}
+
+inline bool TestAllTypes::has_oneof_field() const {
+  return oneof_field_case() != ONEOF_FIELD_NOT_SET;
+}
+inline void TestAllTypes::clear_has_oneof_field() {
+  _oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+inline TestAllTypes::OneofFieldCase TestAllTypes::oneof_field_case() const {
+  return TestAllTypes::OneofFieldCase(_oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// TestPackedTypes
+
+// repeated int32 packed_int32 = 90 [packed = true];
+inline int TestPackedTypes::_internal_packed_int32_size() const {
+  return packed_int32_.size();
+}
+inline int TestPackedTypes::packed_int32_size() const {
+  return _internal_packed_int32_size();
+}
+inline void TestPackedTypes::clear_packed_int32() {
+  packed_int32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestPackedTypes::_internal_packed_int32(int index) const {
+  return packed_int32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestPackedTypes::packed_int32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_int32)
+  return _internal_packed_int32(index);
+}
+inline void TestPackedTypes::set_packed_int32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  packed_int32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_int32)
+}
+inline void TestPackedTypes::_internal_add_packed_int32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  packed_int32_.Add(value);
+}
+inline void TestPackedTypes::add_packed_int32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_packed_int32(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_int32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestPackedTypes::_internal_packed_int32() const {
+  return packed_int32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestPackedTypes::packed_int32() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_int32)
+  return _internal_packed_int32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestPackedTypes::_internal_mutable_packed_int32() {
+  return &packed_int32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestPackedTypes::mutable_packed_int32() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_int32)
+  return _internal_mutable_packed_int32();
+}
+
+// repeated int64 packed_int64 = 91 [packed = true];
+inline int TestPackedTypes::_internal_packed_int64_size() const {
+  return packed_int64_.size();
+}
+inline int TestPackedTypes::packed_int64_size() const {
+  return _internal_packed_int64_size();
+}
+inline void TestPackedTypes::clear_packed_int64() {
+  packed_int64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestPackedTypes::_internal_packed_int64(int index) const {
+  return packed_int64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestPackedTypes::packed_int64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_int64)
+  return _internal_packed_int64(index);
+}
+inline void TestPackedTypes::set_packed_int64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  packed_int64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_int64)
+}
+inline void TestPackedTypes::_internal_add_packed_int64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  packed_int64_.Add(value);
+}
+inline void TestPackedTypes::add_packed_int64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_packed_int64(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_int64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestPackedTypes::_internal_packed_int64() const {
+  return packed_int64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestPackedTypes::packed_int64() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_int64)
+  return _internal_packed_int64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestPackedTypes::_internal_mutable_packed_int64() {
+  return &packed_int64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestPackedTypes::mutable_packed_int64() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_int64)
+  return _internal_mutable_packed_int64();
+}
+
+// repeated uint32 packed_uint32 = 92 [packed = true];
+inline int TestPackedTypes::_internal_packed_uint32_size() const {
+  return packed_uint32_.size();
+}
+inline int TestPackedTypes::packed_uint32_size() const {
+  return _internal_packed_uint32_size();
+}
+inline void TestPackedTypes::clear_packed_uint32() {
+  packed_uint32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestPackedTypes::_internal_packed_uint32(int index) const {
+  return packed_uint32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestPackedTypes::packed_uint32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_uint32)
+  return _internal_packed_uint32(index);
+}
+inline void TestPackedTypes::set_packed_uint32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  packed_uint32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_uint32)
+}
+inline void TestPackedTypes::_internal_add_packed_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  packed_uint32_.Add(value);
+}
+inline void TestPackedTypes::add_packed_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_packed_uint32(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_uint32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestPackedTypes::_internal_packed_uint32() const {
+  return packed_uint32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestPackedTypes::packed_uint32() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_uint32)
+  return _internal_packed_uint32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestPackedTypes::_internal_mutable_packed_uint32() {
+  return &packed_uint32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestPackedTypes::mutable_packed_uint32() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_uint32)
+  return _internal_mutable_packed_uint32();
+}
+
+// repeated uint64 packed_uint64 = 93 [packed = true];
+inline int TestPackedTypes::_internal_packed_uint64_size() const {
+  return packed_uint64_.size();
+}
+inline int TestPackedTypes::packed_uint64_size() const {
+  return _internal_packed_uint64_size();
+}
+inline void TestPackedTypes::clear_packed_uint64() {
+  packed_uint64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestPackedTypes::_internal_packed_uint64(int index) const {
+  return packed_uint64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestPackedTypes::packed_uint64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_uint64)
+  return _internal_packed_uint64(index);
+}
+inline void TestPackedTypes::set_packed_uint64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  packed_uint64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_uint64)
+}
+inline void TestPackedTypes::_internal_add_packed_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  packed_uint64_.Add(value);
+}
+inline void TestPackedTypes::add_packed_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_add_packed_uint64(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_uint64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestPackedTypes::_internal_packed_uint64() const {
+  return packed_uint64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestPackedTypes::packed_uint64() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_uint64)
+  return _internal_packed_uint64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestPackedTypes::_internal_mutable_packed_uint64() {
+  return &packed_uint64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestPackedTypes::mutable_packed_uint64() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_uint64)
+  return _internal_mutable_packed_uint64();
+}
+
+// repeated sint32 packed_sint32 = 94 [packed = true];
+inline int TestPackedTypes::_internal_packed_sint32_size() const {
+  return packed_sint32_.size();
+}
+inline int TestPackedTypes::packed_sint32_size() const {
+  return _internal_packed_sint32_size();
+}
+inline void TestPackedTypes::clear_packed_sint32() {
+  packed_sint32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestPackedTypes::_internal_packed_sint32(int index) const {
+  return packed_sint32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestPackedTypes::packed_sint32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_sint32)
+  return _internal_packed_sint32(index);
+}
+inline void TestPackedTypes::set_packed_sint32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  packed_sint32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_sint32)
+}
+inline void TestPackedTypes::_internal_add_packed_sint32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  packed_sint32_.Add(value);
+}
+inline void TestPackedTypes::add_packed_sint32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_packed_sint32(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_sint32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestPackedTypes::_internal_packed_sint32() const {
+  return packed_sint32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestPackedTypes::packed_sint32() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_sint32)
+  return _internal_packed_sint32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestPackedTypes::_internal_mutable_packed_sint32() {
+  return &packed_sint32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestPackedTypes::mutable_packed_sint32() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_sint32)
+  return _internal_mutable_packed_sint32();
+}
+
+// repeated sint64 packed_sint64 = 95 [packed = true];
+inline int TestPackedTypes::_internal_packed_sint64_size() const {
+  return packed_sint64_.size();
+}
+inline int TestPackedTypes::packed_sint64_size() const {
+  return _internal_packed_sint64_size();
+}
+inline void TestPackedTypes::clear_packed_sint64() {
+  packed_sint64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestPackedTypes::_internal_packed_sint64(int index) const {
+  return packed_sint64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestPackedTypes::packed_sint64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_sint64)
+  return _internal_packed_sint64(index);
+}
+inline void TestPackedTypes::set_packed_sint64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  packed_sint64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_sint64)
+}
+inline void TestPackedTypes::_internal_add_packed_sint64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  packed_sint64_.Add(value);
+}
+inline void TestPackedTypes::add_packed_sint64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_packed_sint64(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_sint64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestPackedTypes::_internal_packed_sint64() const {
+  return packed_sint64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestPackedTypes::packed_sint64() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_sint64)
+  return _internal_packed_sint64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestPackedTypes::_internal_mutable_packed_sint64() {
+  return &packed_sint64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestPackedTypes::mutable_packed_sint64() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_sint64)
+  return _internal_mutable_packed_sint64();
+}
+
+// repeated fixed32 packed_fixed32 = 96 [packed = true];
+inline int TestPackedTypes::_internal_packed_fixed32_size() const {
+  return packed_fixed32_.size();
+}
+inline int TestPackedTypes::packed_fixed32_size() const {
+  return _internal_packed_fixed32_size();
+}
+inline void TestPackedTypes::clear_packed_fixed32() {
+  packed_fixed32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestPackedTypes::_internal_packed_fixed32(int index) const {
+  return packed_fixed32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestPackedTypes::packed_fixed32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_fixed32)
+  return _internal_packed_fixed32(index);
+}
+inline void TestPackedTypes::set_packed_fixed32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  packed_fixed32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_fixed32)
+}
+inline void TestPackedTypes::_internal_add_packed_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  packed_fixed32_.Add(value);
+}
+inline void TestPackedTypes::add_packed_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_packed_fixed32(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_fixed32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestPackedTypes::_internal_packed_fixed32() const {
+  return packed_fixed32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestPackedTypes::packed_fixed32() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_fixed32)
+  return _internal_packed_fixed32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestPackedTypes::_internal_mutable_packed_fixed32() {
+  return &packed_fixed32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestPackedTypes::mutable_packed_fixed32() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_fixed32)
+  return _internal_mutable_packed_fixed32();
+}
+
+// repeated fixed64 packed_fixed64 = 97 [packed = true];
+inline int TestPackedTypes::_internal_packed_fixed64_size() const {
+  return packed_fixed64_.size();
+}
+inline int TestPackedTypes::packed_fixed64_size() const {
+  return _internal_packed_fixed64_size();
+}
+inline void TestPackedTypes::clear_packed_fixed64() {
+  packed_fixed64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestPackedTypes::_internal_packed_fixed64(int index) const {
+  return packed_fixed64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestPackedTypes::packed_fixed64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_fixed64)
+  return _internal_packed_fixed64(index);
+}
+inline void TestPackedTypes::set_packed_fixed64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  packed_fixed64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_fixed64)
+}
+inline void TestPackedTypes::_internal_add_packed_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  packed_fixed64_.Add(value);
+}
+inline void TestPackedTypes::add_packed_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_add_packed_fixed64(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_fixed64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestPackedTypes::_internal_packed_fixed64() const {
+  return packed_fixed64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestPackedTypes::packed_fixed64() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_fixed64)
+  return _internal_packed_fixed64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestPackedTypes::_internal_mutable_packed_fixed64() {
+  return &packed_fixed64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestPackedTypes::mutable_packed_fixed64() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_fixed64)
+  return _internal_mutable_packed_fixed64();
+}
+
+// repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+inline int TestPackedTypes::_internal_packed_sfixed32_size() const {
+  return packed_sfixed32_.size();
+}
+inline int TestPackedTypes::packed_sfixed32_size() const {
+  return _internal_packed_sfixed32_size();
+}
+inline void TestPackedTypes::clear_packed_sfixed32() {
+  packed_sfixed32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestPackedTypes::_internal_packed_sfixed32(int index) const {
+  return packed_sfixed32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestPackedTypes::packed_sfixed32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_sfixed32)
+  return _internal_packed_sfixed32(index);
+}
+inline void TestPackedTypes::set_packed_sfixed32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  packed_sfixed32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_sfixed32)
+}
+inline void TestPackedTypes::_internal_add_packed_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  packed_sfixed32_.Add(value);
+}
+inline void TestPackedTypes::add_packed_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_packed_sfixed32(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_sfixed32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestPackedTypes::_internal_packed_sfixed32() const {
+  return packed_sfixed32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestPackedTypes::packed_sfixed32() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_sfixed32)
+  return _internal_packed_sfixed32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestPackedTypes::_internal_mutable_packed_sfixed32() {
+  return &packed_sfixed32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestPackedTypes::mutable_packed_sfixed32() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_sfixed32)
+  return _internal_mutable_packed_sfixed32();
+}
+
+// repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+inline int TestPackedTypes::_internal_packed_sfixed64_size() const {
+  return packed_sfixed64_.size();
+}
+inline int TestPackedTypes::packed_sfixed64_size() const {
+  return _internal_packed_sfixed64_size();
+}
+inline void TestPackedTypes::clear_packed_sfixed64() {
+  packed_sfixed64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestPackedTypes::_internal_packed_sfixed64(int index) const {
+  return packed_sfixed64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestPackedTypes::packed_sfixed64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_sfixed64)
+  return _internal_packed_sfixed64(index);
+}
+inline void TestPackedTypes::set_packed_sfixed64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  packed_sfixed64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_sfixed64)
+}
+inline void TestPackedTypes::_internal_add_packed_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  packed_sfixed64_.Add(value);
+}
+inline void TestPackedTypes::add_packed_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_packed_sfixed64(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_sfixed64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestPackedTypes::_internal_packed_sfixed64() const {
+  return packed_sfixed64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestPackedTypes::packed_sfixed64() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_sfixed64)
+  return _internal_packed_sfixed64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestPackedTypes::_internal_mutable_packed_sfixed64() {
+  return &packed_sfixed64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestPackedTypes::mutable_packed_sfixed64() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_sfixed64)
+  return _internal_mutable_packed_sfixed64();
+}
+
+// repeated float packed_float = 100 [packed = true];
+inline int TestPackedTypes::_internal_packed_float_size() const {
+  return packed_float_.size();
+}
+inline int TestPackedTypes::packed_float_size() const {
+  return _internal_packed_float_size();
+}
+inline void TestPackedTypes::clear_packed_float() {
+  packed_float_.Clear();
+}
+inline float TestPackedTypes::_internal_packed_float(int index) const {
+  return packed_float_.Get(index);
+}
+inline float TestPackedTypes::packed_float(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_float)
+  return _internal_packed_float(index);
+}
+inline void TestPackedTypes::set_packed_float(int index, float value) {
+  packed_float_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_float)
+}
+inline void TestPackedTypes::_internal_add_packed_float(float value) {
+  packed_float_.Add(value);
+}
+inline void TestPackedTypes::add_packed_float(float value) {
+  _internal_add_packed_float(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_float)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+TestPackedTypes::_internal_packed_float() const {
+  return packed_float_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+TestPackedTypes::packed_float() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_float)
+  return _internal_packed_float();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+TestPackedTypes::_internal_mutable_packed_float() {
+  return &packed_float_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+TestPackedTypes::mutable_packed_float() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_float)
+  return _internal_mutable_packed_float();
+}
+
+// repeated double packed_double = 101 [packed = true];
+inline int TestPackedTypes::_internal_packed_double_size() const {
+  return packed_double_.size();
+}
+inline int TestPackedTypes::packed_double_size() const {
+  return _internal_packed_double_size();
+}
+inline void TestPackedTypes::clear_packed_double() {
+  packed_double_.Clear();
+}
+inline double TestPackedTypes::_internal_packed_double(int index) const {
+  return packed_double_.Get(index);
+}
+inline double TestPackedTypes::packed_double(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_double)
+  return _internal_packed_double(index);
+}
+inline void TestPackedTypes::set_packed_double(int index, double value) {
+  packed_double_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_double)
+}
+inline void TestPackedTypes::_internal_add_packed_double(double value) {
+  packed_double_.Add(value);
+}
+inline void TestPackedTypes::add_packed_double(double value) {
+  _internal_add_packed_double(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_double)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+TestPackedTypes::_internal_packed_double() const {
+  return packed_double_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+TestPackedTypes::packed_double() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_double)
+  return _internal_packed_double();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+TestPackedTypes::_internal_mutable_packed_double() {
+  return &packed_double_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+TestPackedTypes::mutable_packed_double() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_double)
+  return _internal_mutable_packed_double();
+}
+
+// repeated bool packed_bool = 102 [packed = true];
+inline int TestPackedTypes::_internal_packed_bool_size() const {
+  return packed_bool_.size();
+}
+inline int TestPackedTypes::packed_bool_size() const {
+  return _internal_packed_bool_size();
+}
+inline void TestPackedTypes::clear_packed_bool() {
+  packed_bool_.Clear();
+}
+inline bool TestPackedTypes::_internal_packed_bool(int index) const {
+  return packed_bool_.Get(index);
+}
+inline bool TestPackedTypes::packed_bool(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_bool)
+  return _internal_packed_bool(index);
+}
+inline void TestPackedTypes::set_packed_bool(int index, bool value) {
+  packed_bool_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_bool)
+}
+inline void TestPackedTypes::_internal_add_packed_bool(bool value) {
+  packed_bool_.Add(value);
+}
+inline void TestPackedTypes::add_packed_bool(bool value) {
+  _internal_add_packed_bool(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_bool)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+TestPackedTypes::_internal_packed_bool() const {
+  return packed_bool_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+TestPackedTypes::packed_bool() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_bool)
+  return _internal_packed_bool();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+TestPackedTypes::_internal_mutable_packed_bool() {
+  return &packed_bool_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+TestPackedTypes::mutable_packed_bool() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_bool)
+  return _internal_mutable_packed_bool();
+}
+
+// repeated .proto3_unittest.ForeignEnum packed_enum = 103 [packed = true];
+inline int TestPackedTypes::_internal_packed_enum_size() const {
+  return packed_enum_.size();
+}
+inline int TestPackedTypes::packed_enum_size() const {
+  return _internal_packed_enum_size();
+}
+inline void TestPackedTypes::clear_packed_enum() {
+  packed_enum_.Clear();
+}
+inline ::proto3_unittest::ForeignEnum TestPackedTypes::_internal_packed_enum(int index) const {
+  return static_cast< ::proto3_unittest::ForeignEnum >(packed_enum_.Get(index));
+}
+inline ::proto3_unittest::ForeignEnum TestPackedTypes::packed_enum(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestPackedTypes.packed_enum)
+  return _internal_packed_enum(index);
+}
+inline void TestPackedTypes::set_packed_enum(int index, ::proto3_unittest::ForeignEnum value) {
+  packed_enum_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestPackedTypes.packed_enum)
+}
+inline void TestPackedTypes::_internal_add_packed_enum(::proto3_unittest::ForeignEnum value) {
+  packed_enum_.Add(value);
+}
+inline void TestPackedTypes::add_packed_enum(::proto3_unittest::ForeignEnum value) {
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestPackedTypes.packed_enum)
+  _internal_add_packed_enum(value);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+TestPackedTypes::packed_enum() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestPackedTypes.packed_enum)
+  return packed_enum_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+TestPackedTypes::_internal_mutable_packed_enum() {
+  return &packed_enum_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+TestPackedTypes::mutable_packed_enum() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestPackedTypes.packed_enum)
+  return _internal_mutable_packed_enum();
+}
+
+// -------------------------------------------------------------------
+
+// TestUnpackedTypes
+
+// repeated int32 repeated_int32 = 1 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_int32_size() const {
+  return repeated_int32_.size();
+}
+inline int TestUnpackedTypes::repeated_int32_size() const {
+  return _internal_repeated_int32_size();
+}
+inline void TestUnpackedTypes::clear_repeated_int32() {
+  repeated_int32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestUnpackedTypes::_internal_repeated_int32(int index) const {
+  return repeated_int32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestUnpackedTypes::repeated_int32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_int32)
+  return _internal_repeated_int32(index);
+}
+inline void TestUnpackedTypes::set_repeated_int32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  repeated_int32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_int32)
+}
+inline void TestUnpackedTypes::_internal_add_repeated_int32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  repeated_int32_.Add(value);
+}
+inline void TestUnpackedTypes::add_repeated_int32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_repeated_int32(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_int32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestUnpackedTypes::_internal_repeated_int32() const {
+  return repeated_int32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestUnpackedTypes::repeated_int32() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_int32)
+  return _internal_repeated_int32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestUnpackedTypes::_internal_mutable_repeated_int32() {
+  return &repeated_int32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestUnpackedTypes::mutable_repeated_int32() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_int32)
+  return _internal_mutable_repeated_int32();
+}
+
+// repeated int64 repeated_int64 = 2 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_int64_size() const {
+  return repeated_int64_.size();
+}
+inline int TestUnpackedTypes::repeated_int64_size() const {
+  return _internal_repeated_int64_size();
+}
+inline void TestUnpackedTypes::clear_repeated_int64() {
+  repeated_int64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestUnpackedTypes::_internal_repeated_int64(int index) const {
+  return repeated_int64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestUnpackedTypes::repeated_int64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_int64)
+  return _internal_repeated_int64(index);
+}
+inline void TestUnpackedTypes::set_repeated_int64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  repeated_int64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_int64)
+}
+inline void TestUnpackedTypes::_internal_add_repeated_int64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  repeated_int64_.Add(value);
+}
+inline void TestUnpackedTypes::add_repeated_int64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_repeated_int64(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_int64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestUnpackedTypes::_internal_repeated_int64() const {
+  return repeated_int64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestUnpackedTypes::repeated_int64() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_int64)
+  return _internal_repeated_int64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestUnpackedTypes::_internal_mutable_repeated_int64() {
+  return &repeated_int64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestUnpackedTypes::mutable_repeated_int64() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_int64)
+  return _internal_mutable_repeated_int64();
+}
+
+// repeated uint32 repeated_uint32 = 3 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_uint32_size() const {
+  return repeated_uint32_.size();
+}
+inline int TestUnpackedTypes::repeated_uint32_size() const {
+  return _internal_repeated_uint32_size();
+}
+inline void TestUnpackedTypes::clear_repeated_uint32() {
+  repeated_uint32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestUnpackedTypes::_internal_repeated_uint32(int index) const {
+  return repeated_uint32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestUnpackedTypes::repeated_uint32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_uint32)
+  return _internal_repeated_uint32(index);
+}
+inline void TestUnpackedTypes::set_repeated_uint32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  repeated_uint32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_uint32)
+}
+inline void TestUnpackedTypes::_internal_add_repeated_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  repeated_uint32_.Add(value);
+}
+inline void TestUnpackedTypes::add_repeated_uint32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_repeated_uint32(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_uint32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestUnpackedTypes::_internal_repeated_uint32() const {
+  return repeated_uint32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestUnpackedTypes::repeated_uint32() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_uint32)
+  return _internal_repeated_uint32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestUnpackedTypes::_internal_mutable_repeated_uint32() {
+  return &repeated_uint32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestUnpackedTypes::mutable_repeated_uint32() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_uint32)
+  return _internal_mutable_repeated_uint32();
+}
+
+// repeated uint64 repeated_uint64 = 4 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_uint64_size() const {
+  return repeated_uint64_.size();
+}
+inline int TestUnpackedTypes::repeated_uint64_size() const {
+  return _internal_repeated_uint64_size();
+}
+inline void TestUnpackedTypes::clear_repeated_uint64() {
+  repeated_uint64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestUnpackedTypes::_internal_repeated_uint64(int index) const {
+  return repeated_uint64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestUnpackedTypes::repeated_uint64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_uint64)
+  return _internal_repeated_uint64(index);
+}
+inline void TestUnpackedTypes::set_repeated_uint64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  repeated_uint64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_uint64)
+}
+inline void TestUnpackedTypes::_internal_add_repeated_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  repeated_uint64_.Add(value);
+}
+inline void TestUnpackedTypes::add_repeated_uint64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_add_repeated_uint64(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_uint64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestUnpackedTypes::_internal_repeated_uint64() const {
+  return repeated_uint64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestUnpackedTypes::repeated_uint64() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_uint64)
+  return _internal_repeated_uint64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestUnpackedTypes::_internal_mutable_repeated_uint64() {
+  return &repeated_uint64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestUnpackedTypes::mutable_repeated_uint64() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_uint64)
+  return _internal_mutable_repeated_uint64();
+}
+
+// repeated sint32 repeated_sint32 = 5 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_sint32_size() const {
+  return repeated_sint32_.size();
+}
+inline int TestUnpackedTypes::repeated_sint32_size() const {
+  return _internal_repeated_sint32_size();
+}
+inline void TestUnpackedTypes::clear_repeated_sint32() {
+  repeated_sint32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestUnpackedTypes::_internal_repeated_sint32(int index) const {
+  return repeated_sint32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestUnpackedTypes::repeated_sint32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_sint32)
+  return _internal_repeated_sint32(index);
+}
+inline void TestUnpackedTypes::set_repeated_sint32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  repeated_sint32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_sint32)
+}
+inline void TestUnpackedTypes::_internal_add_repeated_sint32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  repeated_sint32_.Add(value);
+}
+inline void TestUnpackedTypes::add_repeated_sint32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_repeated_sint32(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_sint32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestUnpackedTypes::_internal_repeated_sint32() const {
+  return repeated_sint32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestUnpackedTypes::repeated_sint32() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_sint32)
+  return _internal_repeated_sint32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestUnpackedTypes::_internal_mutable_repeated_sint32() {
+  return &repeated_sint32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestUnpackedTypes::mutable_repeated_sint32() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_sint32)
+  return _internal_mutable_repeated_sint32();
+}
+
+// repeated sint64 repeated_sint64 = 6 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_sint64_size() const {
+  return repeated_sint64_.size();
+}
+inline int TestUnpackedTypes::repeated_sint64_size() const {
+  return _internal_repeated_sint64_size();
+}
+inline void TestUnpackedTypes::clear_repeated_sint64() {
+  repeated_sint64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestUnpackedTypes::_internal_repeated_sint64(int index) const {
+  return repeated_sint64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestUnpackedTypes::repeated_sint64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_sint64)
+  return _internal_repeated_sint64(index);
+}
+inline void TestUnpackedTypes::set_repeated_sint64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  repeated_sint64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_sint64)
+}
+inline void TestUnpackedTypes::_internal_add_repeated_sint64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  repeated_sint64_.Add(value);
+}
+inline void TestUnpackedTypes::add_repeated_sint64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_repeated_sint64(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_sint64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestUnpackedTypes::_internal_repeated_sint64() const {
+  return repeated_sint64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestUnpackedTypes::repeated_sint64() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_sint64)
+  return _internal_repeated_sint64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestUnpackedTypes::_internal_mutable_repeated_sint64() {
+  return &repeated_sint64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestUnpackedTypes::mutable_repeated_sint64() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_sint64)
+  return _internal_mutable_repeated_sint64();
+}
+
+// repeated fixed32 repeated_fixed32 = 7 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_fixed32_size() const {
+  return repeated_fixed32_.size();
+}
+inline int TestUnpackedTypes::repeated_fixed32_size() const {
+  return _internal_repeated_fixed32_size();
+}
+inline void TestUnpackedTypes::clear_repeated_fixed32() {
+  repeated_fixed32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestUnpackedTypes::_internal_repeated_fixed32(int index) const {
+  return repeated_fixed32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestUnpackedTypes::repeated_fixed32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_fixed32)
+  return _internal_repeated_fixed32(index);
+}
+inline void TestUnpackedTypes::set_repeated_fixed32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  repeated_fixed32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_fixed32)
+}
+inline void TestUnpackedTypes::_internal_add_repeated_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  repeated_fixed32_.Add(value);
+}
+inline void TestUnpackedTypes::add_repeated_fixed32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_repeated_fixed32(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_fixed32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestUnpackedTypes::_internal_repeated_fixed32() const {
+  return repeated_fixed32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+TestUnpackedTypes::repeated_fixed32() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_fixed32)
+  return _internal_repeated_fixed32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestUnpackedTypes::_internal_mutable_repeated_fixed32() {
+  return &repeated_fixed32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+TestUnpackedTypes::mutable_repeated_fixed32() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_fixed32)
+  return _internal_mutable_repeated_fixed32();
+}
+
+// repeated fixed64 repeated_fixed64 = 8 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_fixed64_size() const {
+  return repeated_fixed64_.size();
+}
+inline int TestUnpackedTypes::repeated_fixed64_size() const {
+  return _internal_repeated_fixed64_size();
+}
+inline void TestUnpackedTypes::clear_repeated_fixed64() {
+  repeated_fixed64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestUnpackedTypes::_internal_repeated_fixed64(int index) const {
+  return repeated_fixed64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestUnpackedTypes::repeated_fixed64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_fixed64)
+  return _internal_repeated_fixed64(index);
+}
+inline void TestUnpackedTypes::set_repeated_fixed64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  repeated_fixed64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_fixed64)
+}
+inline void TestUnpackedTypes::_internal_add_repeated_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  repeated_fixed64_.Add(value);
+}
+inline void TestUnpackedTypes::add_repeated_fixed64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_add_repeated_fixed64(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_fixed64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestUnpackedTypes::_internal_repeated_fixed64() const {
+  return repeated_fixed64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+TestUnpackedTypes::repeated_fixed64() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_fixed64)
+  return _internal_repeated_fixed64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestUnpackedTypes::_internal_mutable_repeated_fixed64() {
+  return &repeated_fixed64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+TestUnpackedTypes::mutable_repeated_fixed64() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_fixed64)
+  return _internal_mutable_repeated_fixed64();
+}
+
+// repeated sfixed32 repeated_sfixed32 = 9 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_sfixed32_size() const {
+  return repeated_sfixed32_.size();
+}
+inline int TestUnpackedTypes::repeated_sfixed32_size() const {
+  return _internal_repeated_sfixed32_size();
+}
+inline void TestUnpackedTypes::clear_repeated_sfixed32() {
+  repeated_sfixed32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestUnpackedTypes::_internal_repeated_sfixed32(int index) const {
+  return repeated_sfixed32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestUnpackedTypes::repeated_sfixed32(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_sfixed32)
+  return _internal_repeated_sfixed32(index);
+}
+inline void TestUnpackedTypes::set_repeated_sfixed32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  repeated_sfixed32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_sfixed32)
+}
+inline void TestUnpackedTypes::_internal_add_repeated_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  repeated_sfixed32_.Add(value);
+}
+inline void TestUnpackedTypes::add_repeated_sfixed32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_repeated_sfixed32(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_sfixed32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestUnpackedTypes::_internal_repeated_sfixed32() const {
+  return repeated_sfixed32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+TestUnpackedTypes::repeated_sfixed32() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_sfixed32)
+  return _internal_repeated_sfixed32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestUnpackedTypes::_internal_mutable_repeated_sfixed32() {
+  return &repeated_sfixed32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+TestUnpackedTypes::mutable_repeated_sfixed32() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_sfixed32)
+  return _internal_mutable_repeated_sfixed32();
+}
+
+// repeated sfixed64 repeated_sfixed64 = 10 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_sfixed64_size() const {
+  return repeated_sfixed64_.size();
+}
+inline int TestUnpackedTypes::repeated_sfixed64_size() const {
+  return _internal_repeated_sfixed64_size();
+}
+inline void TestUnpackedTypes::clear_repeated_sfixed64() {
+  repeated_sfixed64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestUnpackedTypes::_internal_repeated_sfixed64(int index) const {
+  return repeated_sfixed64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestUnpackedTypes::repeated_sfixed64(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_sfixed64)
+  return _internal_repeated_sfixed64(index);
+}
+inline void TestUnpackedTypes::set_repeated_sfixed64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  repeated_sfixed64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_sfixed64)
+}
+inline void TestUnpackedTypes::_internal_add_repeated_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  repeated_sfixed64_.Add(value);
+}
+inline void TestUnpackedTypes::add_repeated_sfixed64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_repeated_sfixed64(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_sfixed64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestUnpackedTypes::_internal_repeated_sfixed64() const {
+  return repeated_sfixed64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TestUnpackedTypes::repeated_sfixed64() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_sfixed64)
+  return _internal_repeated_sfixed64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestUnpackedTypes::_internal_mutable_repeated_sfixed64() {
+  return &repeated_sfixed64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TestUnpackedTypes::mutable_repeated_sfixed64() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_sfixed64)
+  return _internal_mutable_repeated_sfixed64();
+}
+
+// repeated float repeated_float = 11 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_float_size() const {
+  return repeated_float_.size();
+}
+inline int TestUnpackedTypes::repeated_float_size() const {
+  return _internal_repeated_float_size();
+}
+inline void TestUnpackedTypes::clear_repeated_float() {
+  repeated_float_.Clear();
+}
+inline float TestUnpackedTypes::_internal_repeated_float(int index) const {
+  return repeated_float_.Get(index);
+}
+inline float TestUnpackedTypes::repeated_float(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_float)
+  return _internal_repeated_float(index);
+}
+inline void TestUnpackedTypes::set_repeated_float(int index, float value) {
+  repeated_float_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_float)
+}
+inline void TestUnpackedTypes::_internal_add_repeated_float(float value) {
+  repeated_float_.Add(value);
+}
+inline void TestUnpackedTypes::add_repeated_float(float value) {
+  _internal_add_repeated_float(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_float)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+TestUnpackedTypes::_internal_repeated_float() const {
+  return repeated_float_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+TestUnpackedTypes::repeated_float() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_float)
+  return _internal_repeated_float();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+TestUnpackedTypes::_internal_mutable_repeated_float() {
+  return &repeated_float_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+TestUnpackedTypes::mutable_repeated_float() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_float)
+  return _internal_mutable_repeated_float();
+}
+
+// repeated double repeated_double = 12 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_double_size() const {
+  return repeated_double_.size();
+}
+inline int TestUnpackedTypes::repeated_double_size() const {
+  return _internal_repeated_double_size();
+}
+inline void TestUnpackedTypes::clear_repeated_double() {
+  repeated_double_.Clear();
+}
+inline double TestUnpackedTypes::_internal_repeated_double(int index) const {
+  return repeated_double_.Get(index);
+}
+inline double TestUnpackedTypes::repeated_double(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_double)
+  return _internal_repeated_double(index);
+}
+inline void TestUnpackedTypes::set_repeated_double(int index, double value) {
+  repeated_double_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_double)
+}
+inline void TestUnpackedTypes::_internal_add_repeated_double(double value) {
+  repeated_double_.Add(value);
+}
+inline void TestUnpackedTypes::add_repeated_double(double value) {
+  _internal_add_repeated_double(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_double)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+TestUnpackedTypes::_internal_repeated_double() const {
+  return repeated_double_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+TestUnpackedTypes::repeated_double() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_double)
+  return _internal_repeated_double();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+TestUnpackedTypes::_internal_mutable_repeated_double() {
+  return &repeated_double_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+TestUnpackedTypes::mutable_repeated_double() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_double)
+  return _internal_mutable_repeated_double();
+}
+
+// repeated bool repeated_bool = 13 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_bool_size() const {
+  return repeated_bool_.size();
+}
+inline int TestUnpackedTypes::repeated_bool_size() const {
+  return _internal_repeated_bool_size();
+}
+inline void TestUnpackedTypes::clear_repeated_bool() {
+  repeated_bool_.Clear();
+}
+inline bool TestUnpackedTypes::_internal_repeated_bool(int index) const {
+  return repeated_bool_.Get(index);
+}
+inline bool TestUnpackedTypes::repeated_bool(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_bool)
+  return _internal_repeated_bool(index);
+}
+inline void TestUnpackedTypes::set_repeated_bool(int index, bool value) {
+  repeated_bool_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_bool)
+}
+inline void TestUnpackedTypes::_internal_add_repeated_bool(bool value) {
+  repeated_bool_.Add(value);
+}
+inline void TestUnpackedTypes::add_repeated_bool(bool value) {
+  _internal_add_repeated_bool(value);
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_bool)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+TestUnpackedTypes::_internal_repeated_bool() const {
+  return repeated_bool_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+TestUnpackedTypes::repeated_bool() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_bool)
+  return _internal_repeated_bool();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+TestUnpackedTypes::_internal_mutable_repeated_bool() {
+  return &repeated_bool_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+TestUnpackedTypes::mutable_repeated_bool() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_bool)
+  return _internal_mutable_repeated_bool();
+}
+
+// repeated .proto3_unittest.TestAllTypes.NestedEnum repeated_nested_enum = 14 [packed = false];
+inline int TestUnpackedTypes::_internal_repeated_nested_enum_size() const {
+  return repeated_nested_enum_.size();
+}
+inline int TestUnpackedTypes::repeated_nested_enum_size() const {
+  return _internal_repeated_nested_enum_size();
+}
+inline void TestUnpackedTypes::clear_repeated_nested_enum() {
+  repeated_nested_enum_.Clear();
+}
+inline ::proto3_unittest::TestAllTypes_NestedEnum TestUnpackedTypes::_internal_repeated_nested_enum(int index) const {
+  return static_cast< ::proto3_unittest::TestAllTypes_NestedEnum >(repeated_nested_enum_.Get(index));
+}
+inline ::proto3_unittest::TestAllTypes_NestedEnum TestUnpackedTypes::repeated_nested_enum(int index) const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestUnpackedTypes.repeated_nested_enum)
+  return _internal_repeated_nested_enum(index);
+}
+inline void TestUnpackedTypes::set_repeated_nested_enum(int index, ::proto3_unittest::TestAllTypes_NestedEnum value) {
+  repeated_nested_enum_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestUnpackedTypes.repeated_nested_enum)
+}
+inline void TestUnpackedTypes::_internal_add_repeated_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value) {
+  repeated_nested_enum_.Add(value);
+}
+inline void TestUnpackedTypes::add_repeated_nested_enum(::proto3_unittest::TestAllTypes_NestedEnum value) {
+  // @@protoc_insertion_point(field_add:proto3_unittest.TestUnpackedTypes.repeated_nested_enum)
+  _internal_add_repeated_nested_enum(value);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+TestUnpackedTypes::repeated_nested_enum() const {
+  // @@protoc_insertion_point(field_list:proto3_unittest.TestUnpackedTypes.repeated_nested_enum)
+  return repeated_nested_enum_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+TestUnpackedTypes::_internal_mutable_repeated_nested_enum() {
+  return &repeated_nested_enum_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+TestUnpackedTypes::mutable_repeated_nested_enum() {
+  // @@protoc_insertion_point(field_mutable_list:proto3_unittest.TestUnpackedTypes.repeated_nested_enum)
+  return _internal_mutable_repeated_nested_enum();
+}
+
+// -------------------------------------------------------------------
+
+// NestedTestAllTypes
+
+// .proto3_unittest.NestedTestAllTypes child = 1;
+inline bool NestedTestAllTypes::_internal_has_child() const {
+  return this != internal_default_instance() && child_ != nullptr;
+}
+inline bool NestedTestAllTypes::has_child() const {
+  return _internal_has_child();
+}
+inline void NestedTestAllTypes::clear_child() {
+  if (GetArena() == nullptr && child_ != nullptr) {
+    delete child_;
+  }
+  child_ = nullptr;
+}
+inline const ::proto3_unittest::NestedTestAllTypes& NestedTestAllTypes::_internal_child() const {
+  const ::proto3_unittest::NestedTestAllTypes* p = child_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto3_unittest::NestedTestAllTypes*>(
+      &::proto3_unittest::_NestedTestAllTypes_default_instance_);
+}
+inline const ::proto3_unittest::NestedTestAllTypes& NestedTestAllTypes::child() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.NestedTestAllTypes.child)
+  return _internal_child();
+}
+inline void NestedTestAllTypes::unsafe_arena_set_allocated_child(
+    ::proto3_unittest::NestedTestAllTypes* child) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(child_);
+  }
+  child_ = child;
+  if (child) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.NestedTestAllTypes.child)
+}
+inline ::proto3_unittest::NestedTestAllTypes* NestedTestAllTypes::release_child() {
+  
+  ::proto3_unittest::NestedTestAllTypes* temp = child_;
+  child_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto3_unittest::NestedTestAllTypes* NestedTestAllTypes::unsafe_arena_release_child() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.NestedTestAllTypes.child)
+  
+  ::proto3_unittest::NestedTestAllTypes* temp = child_;
+  child_ = nullptr;
+  return temp;
+}
+inline ::proto3_unittest::NestedTestAllTypes* NestedTestAllTypes::_internal_mutable_child() {
+  
+  if (child_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3_unittest::NestedTestAllTypes>(GetArena());
+    child_ = p;
+  }
+  return child_;
+}
+inline ::proto3_unittest::NestedTestAllTypes* NestedTestAllTypes::mutable_child() {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.NestedTestAllTypes.child)
+  return _internal_mutable_child();
+}
+inline void NestedTestAllTypes::set_allocated_child(::proto3_unittest::NestedTestAllTypes* child) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete child_;
+  }
+  if (child) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(child);
+    if (message_arena != submessage_arena) {
+      child = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, child, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  child_ = child;
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.NestedTestAllTypes.child)
+}
+
+// .proto3_unittest.TestAllTypes payload = 2;
+inline bool NestedTestAllTypes::_internal_has_payload() const {
+  return this != internal_default_instance() && payload_ != nullptr;
+}
+inline bool NestedTestAllTypes::has_payload() const {
+  return _internal_has_payload();
+}
+inline void NestedTestAllTypes::clear_payload() {
+  if (GetArena() == nullptr && payload_ != nullptr) {
+    delete payload_;
+  }
+  payload_ = nullptr;
+}
+inline const ::proto3_unittest::TestAllTypes& NestedTestAllTypes::_internal_payload() const {
+  const ::proto3_unittest::TestAllTypes* p = payload_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto3_unittest::TestAllTypes*>(
+      &::proto3_unittest::_TestAllTypes_default_instance_);
+}
+inline const ::proto3_unittest::TestAllTypes& NestedTestAllTypes::payload() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.NestedTestAllTypes.payload)
+  return _internal_payload();
+}
+inline void NestedTestAllTypes::unsafe_arena_set_allocated_payload(
+    ::proto3_unittest::TestAllTypes* payload) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(payload_);
+  }
+  payload_ = payload;
+  if (payload) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto3_unittest.NestedTestAllTypes.payload)
+}
+inline ::proto3_unittest::TestAllTypes* NestedTestAllTypes::release_payload() {
+  
+  ::proto3_unittest::TestAllTypes* temp = payload_;
+  payload_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto3_unittest::TestAllTypes* NestedTestAllTypes::unsafe_arena_release_payload() {
+  // @@protoc_insertion_point(field_release:proto3_unittest.NestedTestAllTypes.payload)
+  
+  ::proto3_unittest::TestAllTypes* temp = payload_;
+  payload_ = nullptr;
+  return temp;
+}
+inline ::proto3_unittest::TestAllTypes* NestedTestAllTypes::_internal_mutable_payload() {
+  
+  if (payload_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto3_unittest::TestAllTypes>(GetArena());
+    payload_ = p;
+  }
+  return payload_;
+}
+inline ::proto3_unittest::TestAllTypes* NestedTestAllTypes::mutable_payload() {
+  // @@protoc_insertion_point(field_mutable:proto3_unittest.NestedTestAllTypes.payload)
+  return _internal_mutable_payload();
+}
+inline void NestedTestAllTypes::set_allocated_payload(::proto3_unittest::TestAllTypes* payload) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete payload_;
+  }
+  if (payload) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(payload);
+    if (message_arena != submessage_arena) {
+      payload = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, payload, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  payload_ = payload;
+  // @@protoc_insertion_point(field_set_allocated:proto3_unittest.NestedTestAllTypes.payload)
+}
+
+// -------------------------------------------------------------------
+
+// ForeignMessage
+
+// int32 c = 1;
+inline void ForeignMessage::clear_c() {
+  c_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ForeignMessage::_internal_c() const {
+  return c_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ForeignMessage::c() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.ForeignMessage.c)
+  return _internal_c();
+}
+inline void ForeignMessage::_internal_set_c(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  c_ = value;
+}
+inline void ForeignMessage::set_c(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_c(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.ForeignMessage.c)
+}
+
+// -------------------------------------------------------------------
+
+// TestEmptyMessage
+
+// -------------------------------------------------------------------
+
+// TestMessageWithDummy
+
+// bool dummy = 536870911;
+inline void TestMessageWithDummy::clear_dummy() {
+  dummy_ = false;
+}
+inline bool TestMessageWithDummy::_internal_dummy() const {
+  return dummy_;
+}
+inline bool TestMessageWithDummy::dummy() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestMessageWithDummy.dummy)
+  return _internal_dummy();
+}
+inline void TestMessageWithDummy::_internal_set_dummy(bool value) {
+  
+  dummy_ = value;
+}
+inline void TestMessageWithDummy::set_dummy(bool value) {
+  _internal_set_dummy(value);
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestMessageWithDummy.dummy)
+}
+
+// -------------------------------------------------------------------
+
+// TestOneof2
+
+// .proto3_unittest.TestOneof2.NestedEnum foo_enum = 6;
+inline bool TestOneof2::_internal_has_foo_enum() const {
+  return foo_case() == kFooEnum;
+}
+inline void TestOneof2::set_has_foo_enum() {
+  _oneof_case_[0] = kFooEnum;
+}
+inline void TestOneof2::clear_foo_enum() {
+  if (_internal_has_foo_enum()) {
+    foo_.foo_enum_ = 0;
+    clear_has_foo();
+  }
+}
+inline ::proto3_unittest::TestOneof2_NestedEnum TestOneof2::_internal_foo_enum() const {
+  if (_internal_has_foo_enum()) {
+    return static_cast< ::proto3_unittest::TestOneof2_NestedEnum >(foo_.foo_enum_);
+  }
+  return static_cast< ::proto3_unittest::TestOneof2_NestedEnum >(0);
+}
+inline ::proto3_unittest::TestOneof2_NestedEnum TestOneof2::foo_enum() const {
+  // @@protoc_insertion_point(field_get:proto3_unittest.TestOneof2.foo_enum)
+  return _internal_foo_enum();
+}
+inline void TestOneof2::_internal_set_foo_enum(::proto3_unittest::TestOneof2_NestedEnum value) {
+  if (!_internal_has_foo_enum()) {
+    clear_foo();
+    set_has_foo_enum();
+  }
+  foo_.foo_enum_ = value;
+}
+inline void TestOneof2::set_foo_enum(::proto3_unittest::TestOneof2_NestedEnum value) {
+  // @@protoc_insertion_point(field_set:proto3_unittest.TestOneof2.foo_enum)
+  _internal_set_foo_enum(value);
+}
+
+inline bool TestOneof2::has_foo() const {
+  return foo_case() != FOO_NOT_SET;
+}
+inline void TestOneof2::clear_has_foo() {
+  _oneof_case_[0] = FOO_NOT_SET;
+}
+inline TestOneof2::FooCase TestOneof2::foo_case() const {
+  return TestOneof2::FooCase(_oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace proto3_unittest
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::proto3_unittest::TestAllTypes_NestedEnum> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::proto3_unittest::TestAllTypes_NestedEnum>() {
+  return ::proto3_unittest::TestAllTypes_NestedEnum_descriptor();
+}
+template <> struct is_proto_enum< ::proto3_unittest::TestOneof2_NestedEnum> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::proto3_unittest::TestOneof2_NestedEnum>() {
+  return ::proto3_unittest::TestOneof2_NestedEnum_descriptor();
+}
+template <> struct is_proto_enum< ::proto3_unittest::ForeignEnum> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::proto3_unittest::ForeignEnum>() {
+  return ::proto3_unittest::ForeignEnum_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2funittest_5fproto3_2eproto
@@ -0,0 +1,6044 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_well_known_types.proto
+
+#include "google/protobuf/unittest_well_known_types.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fany_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Any_google_2fprotobuf_2fany_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fapi_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<4> scc_info_Api_google_2fprotobuf_2fapi_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BoolValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BytesValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DoubleValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fduration_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Duration_google_2fprotobuf_2fduration_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fempty_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Empty_google_2fprotobuf_2fempty_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2ffield_5fmask_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_FieldMask_google_2fprotobuf_2ffield_5fmask_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_FloatValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Int32Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Int64Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fsource_5fcontext_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_SourceContext_google_2fprotobuf_2fsource_5fcontext_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_StringValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2ftimestamp_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2ftype_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_Type_google_2fprotobuf_2ftype_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UInt32Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UInt64Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_AnyFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_ApiFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_BoolFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_BytesFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_DoubleFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_DurationFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_EmptyFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_FloatFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_Int32FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_Int64FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_SourceContextFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_StringFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_StructFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_TimestampFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_TypeFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_Uint32FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_Uint64FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto;
+namespace protobuf_unittest {
+class TestWellKnownTypesDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestWellKnownTypes> _instance;
+} _TestWellKnownTypes_default_instance_;
+class RepeatedWellKnownTypesDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RepeatedWellKnownTypes> _instance;
+} _RepeatedWellKnownTypes_default_instance_;
+class OneofWellKnownTypesDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<OneofWellKnownTypes> _instance;
+  const PROTOBUF_NAMESPACE_ID::Any* any_field_;
+  const PROTOBUF_NAMESPACE_ID::Api* api_field_;
+  const PROTOBUF_NAMESPACE_ID::Duration* duration_field_;
+  const PROTOBUF_NAMESPACE_ID::Empty* empty_field_;
+  const PROTOBUF_NAMESPACE_ID::FieldMask* field_mask_field_;
+  const PROTOBUF_NAMESPACE_ID::SourceContext* source_context_field_;
+  const PROTOBUF_NAMESPACE_ID::Struct* struct_field_;
+  const PROTOBUF_NAMESPACE_ID::Timestamp* timestamp_field_;
+  const PROTOBUF_NAMESPACE_ID::Type* type_field_;
+  const PROTOBUF_NAMESPACE_ID::DoubleValue* double_field_;
+  const PROTOBUF_NAMESPACE_ID::FloatValue* float_field_;
+  const PROTOBUF_NAMESPACE_ID::Int64Value* int64_field_;
+  const PROTOBUF_NAMESPACE_ID::UInt64Value* uint64_field_;
+  const PROTOBUF_NAMESPACE_ID::Int32Value* int32_field_;
+  const PROTOBUF_NAMESPACE_ID::UInt32Value* uint32_field_;
+  const PROTOBUF_NAMESPACE_ID::BoolValue* bool_field_;
+  const PROTOBUF_NAMESPACE_ID::StringValue* string_field_;
+  const PROTOBUF_NAMESPACE_ID::BytesValue* bytes_field_;
+} _OneofWellKnownTypes_default_instance_;
+class MapWellKnownTypes_AnyFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_AnyFieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_AnyFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_ApiFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_ApiFieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_ApiFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_DurationFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_DurationFieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_DurationFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_EmptyFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_EmptyFieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_EmptyFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_FieldMaskFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_SourceContextFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_SourceContextFieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_SourceContextFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_StructFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_StructFieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_StructFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_TimestampFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_TimestampFieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_TimestampFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_TypeFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_TypeFieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_TypeFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_DoubleFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_DoubleFieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_DoubleFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_FloatFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_FloatFieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_FloatFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_Int64FieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_Int64FieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_Int64FieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_Uint64FieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_Uint64FieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_Uint64FieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_Int32FieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_Int32FieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_Int32FieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_Uint32FieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_Uint32FieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_Uint32FieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_BoolFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_BoolFieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_BoolFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_StringFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_StringFieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_StringFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypes_BytesFieldEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes_BytesFieldEntry_DoNotUse> _instance;
+} _MapWellKnownTypes_BytesFieldEntry_DoNotUse_default_instance_;
+class MapWellKnownTypesDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapWellKnownTypes> _instance;
+} _MapWellKnownTypes_default_instance_;
+}  // namespace protobuf_unittest
+static void InitDefaultsscc_info_MapWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::MapWellKnownTypes::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<18> scc_info_MapWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 18, 0, InitDefaultsscc_info_MapWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_MapWellKnownTypes_AnyFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_ApiFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_DurationFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_EmptyFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_SourceContextFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_StructFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_TimestampFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_TypeFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_DoubleFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_FloatFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_Int64FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_Uint64FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_Int32FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_Uint32FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_BoolFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_StringFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+      &scc_info_MapWellKnownTypes_BytesFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_AnyFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_AnyFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_AnyFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_AnyFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_Any_google_2fprotobuf_2fany_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_ApiFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_ApiFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_ApiFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_ApiFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_Api_google_2fprotobuf_2fapi_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_BoolFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_BoolFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_BoolFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_BoolFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_BoolValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_BytesFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_BytesFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_BytesFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_BytesFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_BytesValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_DoubleFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_DoubleFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_DoubleFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_DoubleFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_DoubleValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_DurationFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_DurationFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_DurationFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_DurationFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_Duration_google_2fprotobuf_2fduration_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_EmptyFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_EmptyFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_EmptyFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_EmptyFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_Empty_google_2fprotobuf_2fempty_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_FieldMask_google_2fprotobuf_2ffield_5fmask_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_FloatFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_FloatFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_FloatFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_FloatFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_FloatValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_Int32FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_Int32FieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_Int32FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_Int32FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_Int32Value_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_Int64FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_Int64FieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_Int64FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_Int64FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_Int64Value_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_SourceContextFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_SourceContextFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_SourceContextFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_SourceContextFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_SourceContext_google_2fprotobuf_2fsource_5fcontext_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_StringFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_StringFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_StringFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_StringFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_StringValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_StructFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_StructFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_StructFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_StructFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_TimestampFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_TimestampFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_TimestampFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_TimestampFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_TypeFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_TypeFieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_TypeFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_TypeFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_Type_google_2fprotobuf_2ftype_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_Uint32FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_Uint32FieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_Uint32FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_Uint32FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_UInt32Value_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapWellKnownTypes_Uint64FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_MapWellKnownTypes_Uint64FieldEntry_DoNotUse_default_instance_;
+    new (ptr) ::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse();
+  }
+  ::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapWellKnownTypes_Uint64FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapWellKnownTypes_Uint64FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_UInt64Value_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_OneofWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_OneofWellKnownTypes_default_instance_;
+    new (ptr) ::protobuf_unittest::OneofWellKnownTypes();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::OneofWellKnownTypes::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<18> scc_info_OneofWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 18, 0, InitDefaultsscc_info_OneofWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_Any_google_2fprotobuf_2fany_2eproto.base,
+      &scc_info_Api_google_2fprotobuf_2fapi_2eproto.base,
+      &scc_info_Duration_google_2fprotobuf_2fduration_2eproto.base,
+      &scc_info_Empty_google_2fprotobuf_2fempty_2eproto.base,
+      &scc_info_FieldMask_google_2fprotobuf_2ffield_5fmask_2eproto.base,
+      &scc_info_SourceContext_google_2fprotobuf_2fsource_5fcontext_2eproto.base,
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,
+      &scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto.base,
+      &scc_info_Type_google_2fprotobuf_2ftype_2eproto.base,
+      &scc_info_DoubleValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_FloatValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_Int64Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_UInt64Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_Int32Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_UInt32Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_BoolValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_StringValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_BytesValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_RepeatedWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_RepeatedWellKnownTypes_default_instance_;
+    new (ptr) ::protobuf_unittest::RepeatedWellKnownTypes();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::RepeatedWellKnownTypes::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<18> scc_info_RepeatedWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 18, 0, InitDefaultsscc_info_RepeatedWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_Any_google_2fprotobuf_2fany_2eproto.base,
+      &scc_info_Api_google_2fprotobuf_2fapi_2eproto.base,
+      &scc_info_Duration_google_2fprotobuf_2fduration_2eproto.base,
+      &scc_info_Empty_google_2fprotobuf_2fempty_2eproto.base,
+      &scc_info_FieldMask_google_2fprotobuf_2ffield_5fmask_2eproto.base,
+      &scc_info_SourceContext_google_2fprotobuf_2fsource_5fcontext_2eproto.base,
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,
+      &scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto.base,
+      &scc_info_Type_google_2fprotobuf_2ftype_2eproto.base,
+      &scc_info_DoubleValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_FloatValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_Int64Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_UInt64Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_Int32Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_UInt32Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_BoolValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_StringValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_BytesValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::protobuf_unittest::_TestWellKnownTypes_default_instance_;
+    new (ptr) ::protobuf_unittest::TestWellKnownTypes();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::protobuf_unittest::TestWellKnownTypes::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<18> scc_info_TestWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 18, 0, InitDefaultsscc_info_TestWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto}, {
+      &scc_info_Any_google_2fprotobuf_2fany_2eproto.base,
+      &scc_info_Api_google_2fprotobuf_2fapi_2eproto.base,
+      &scc_info_Duration_google_2fprotobuf_2fduration_2eproto.base,
+      &scc_info_Empty_google_2fprotobuf_2fempty_2eproto.base,
+      &scc_info_FieldMask_google_2fprotobuf_2ffield_5fmask_2eproto.base,
+      &scc_info_SourceContext_google_2fprotobuf_2fsource_5fcontext_2eproto.base,
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,
+      &scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto.base,
+      &scc_info_Type_google_2fprotobuf_2ftype_2eproto.base,
+      &scc_info_DoubleValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_FloatValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_Int64Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_UInt64Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_Int32Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_UInt32Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_BoolValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_StringValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_BytesValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[22];
+static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto = nullptr;
+
+const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, any_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, api_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, duration_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, empty_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, field_mask_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, source_context_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, struct_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, timestamp_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, type_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, double_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, float_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, int64_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, uint64_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, int32_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, uint32_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, bool_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, string_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, bytes_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::TestWellKnownTypes, value_field_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, any_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, api_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, duration_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, empty_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, field_mask_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, source_context_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, struct_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, timestamp_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, type_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, double_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, float_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, int64_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, uint64_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, int32_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, uint32_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, bool_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, string_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::RepeatedWellKnownTypes, bytes_field_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::OneofWellKnownTypes, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::OneofWellKnownTypes, _oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, any_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, api_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, duration_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, empty_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, field_mask_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, source_context_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, struct_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, timestamp_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, type_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, double_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, float_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, int64_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, uint64_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, int32_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, uint32_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, bool_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, string_field_),
+  offsetof(::protobuf_unittest::OneofWellKnownTypesDefaultTypeInternal, bytes_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::OneofWellKnownTypes, oneof_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, any_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, api_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, duration_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, empty_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, field_mask_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, source_context_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, struct_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, timestamp_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, type_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, double_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, float_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, int64_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, uint64_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, int32_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, uint32_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, bool_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, string_field_),
+  PROTOBUF_FIELD_OFFSET(::protobuf_unittest::MapWellKnownTypes, bytes_field_),
+};
+static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, sizeof(::protobuf_unittest::TestWellKnownTypes)},
+  { 24, -1, sizeof(::protobuf_unittest::RepeatedWellKnownTypes)},
+  { 47, -1, sizeof(::protobuf_unittest::OneofWellKnownTypes)},
+  { 71, 78, sizeof(::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse)},
+  { 80, 87, sizeof(::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse)},
+  { 89, 96, sizeof(::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse)},
+  { 98, 105, sizeof(::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse)},
+  { 107, 114, sizeof(::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse)},
+  { 116, 123, sizeof(::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse)},
+  { 125, 132, sizeof(::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse)},
+  { 134, 141, sizeof(::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse)},
+  { 143, 150, sizeof(::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse)},
+  { 152, 159, sizeof(::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse)},
+  { 161, 168, sizeof(::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse)},
+  { 170, 177, sizeof(::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse)},
+  { 179, 186, sizeof(::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse)},
+  { 188, 195, sizeof(::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse)},
+  { 197, 204, sizeof(::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse)},
+  { 206, 213, sizeof(::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse)},
+  { 215, 222, sizeof(::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse)},
+  { 224, 231, sizeof(::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse)},
+  { 233, -1, sizeof(::protobuf_unittest::MapWellKnownTypes)},
+};
+
+static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_TestWellKnownTypes_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_RepeatedWellKnownTypes_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_OneofWellKnownTypes_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_AnyFieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_ApiFieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_DurationFieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_EmptyFieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_SourceContextFieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_StructFieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_TimestampFieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_TypeFieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_DoubleFieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_FloatFieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_Int64FieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_Uint64FieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_Int32FieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_Uint32FieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_BoolFieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_StringFieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_BytesFieldEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protobuf_unittest::_MapWellKnownTypes_default_instance_),
+};
+
+const char descriptor_table_protodef_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n/google/protobuf/unittest_well_known_ty"
+  "pes.proto\022\021protobuf_unittest\032\031google/pro"
+  "tobuf/any.proto\032\031google/protobuf/api.pro"
+  "to\032\036google/protobuf/duration.proto\032\033goog"
+  "le/protobuf/empty.proto\032 google/protobuf"
+  "/field_mask.proto\032$google/protobuf/sourc"
+  "e_context.proto\032\034google/protobuf/struct."
+  "proto\032\037google/protobuf/timestamp.proto\032\032"
+  "google/protobuf/type.proto\032\036google/proto"
+  "buf/wrappers.proto\"\276\007\n\022TestWellKnownType"
+  "s\022\'\n\tany_field\030\001 \001(\0132\024.google.protobuf.A"
+  "ny\022\'\n\tapi_field\030\002 \001(\0132\024.google.protobuf."
+  "Api\0221\n\016duration_field\030\003 \001(\0132\031.google.pro"
+  "tobuf.Duration\022+\n\013empty_field\030\004 \001(\0132\026.go"
+  "ogle.protobuf.Empty\0224\n\020field_mask_field\030"
+  "\005 \001(\0132\032.google.protobuf.FieldMask\022<\n\024sou"
+  "rce_context_field\030\006 \001(\0132\036.google.protobu"
+  "f.SourceContext\022-\n\014struct_field\030\007 \001(\0132\027."
+  "google.protobuf.Struct\0223\n\017timestamp_fiel"
+  "d\030\010 \001(\0132\032.google.protobuf.Timestamp\022)\n\nt"
+  "ype_field\030\t \001(\0132\025.google.protobuf.Type\0222"
+  "\n\014double_field\030\n \001(\0132\034.google.protobuf.D"
+  "oubleValue\0220\n\013float_field\030\013 \001(\0132\033.google"
+  ".protobuf.FloatValue\0220\n\013int64_field\030\014 \001("
+  "\0132\033.google.protobuf.Int64Value\0222\n\014uint64"
+  "_field\030\r \001(\0132\034.google.protobuf.UInt64Val"
+  "ue\0220\n\013int32_field\030\016 \001(\0132\033.google.protobu"
+  "f.Int32Value\0222\n\014uint32_field\030\017 \001(\0132\034.goo"
+  "gle.protobuf.UInt32Value\022.\n\nbool_field\030\020"
+  " \001(\0132\032.google.protobuf.BoolValue\0222\n\014stri"
+  "ng_field\030\021 \001(\0132\034.google.protobuf.StringV"
+  "alue\0220\n\013bytes_field\030\022 \001(\0132\033.google.proto"
+  "buf.BytesValue\022+\n\013value_field\030\023 \001(\0132\026.go"
+  "ogle.protobuf.Value\"\225\007\n\026RepeatedWellKnow"
+  "nTypes\022\'\n\tany_field\030\001 \003(\0132\024.google.proto"
+  "buf.Any\022\'\n\tapi_field\030\002 \003(\0132\024.google.prot"
+  "obuf.Api\0221\n\016duration_field\030\003 \003(\0132\031.googl"
+  "e.protobuf.Duration\022+\n\013empty_field\030\004 \003(\013"
+  "2\026.google.protobuf.Empty\0224\n\020field_mask_f"
+  "ield\030\005 \003(\0132\032.google.protobuf.FieldMask\022<"
+  "\n\024source_context_field\030\006 \003(\0132\036.google.pr"
+  "otobuf.SourceContext\022-\n\014struct_field\030\007 \003"
+  "(\0132\027.google.protobuf.Struct\0223\n\017timestamp"
+  "_field\030\010 \003(\0132\032.google.protobuf.Timestamp"
+  "\022)\n\ntype_field\030\t \003(\0132\025.google.protobuf.T"
+  "ype\0222\n\014double_field\030\n \003(\0132\034.google.proto"
+  "buf.DoubleValue\0220\n\013float_field\030\013 \003(\0132\033.g"
+  "oogle.protobuf.FloatValue\0220\n\013int64_field"
+  "\030\014 \003(\0132\033.google.protobuf.Int64Value\0222\n\014u"
+  "int64_field\030\r \003(\0132\034.google.protobuf.UInt"
+  "64Value\0220\n\013int32_field\030\016 \003(\0132\033.google.pr"
+  "otobuf.Int32Value\0222\n\014uint32_field\030\017 \003(\0132"
+  "\034.google.protobuf.UInt32Value\022.\n\nbool_fi"
+  "eld\030\020 \003(\0132\032.google.protobuf.BoolValue\0222\n"
+  "\014string_field\030\021 \003(\0132\034.google.protobuf.St"
+  "ringValue\0220\n\013bytes_field\030\022 \003(\0132\033.google."
+  "protobuf.BytesValue\"\305\007\n\023OneofWellKnownTy"
+  "pes\022)\n\tany_field\030\001 \001(\0132\024.google.protobuf"
+  ".AnyH\000\022)\n\tapi_field\030\002 \001(\0132\024.google.proto"
+  "buf.ApiH\000\0223\n\016duration_field\030\003 \001(\0132\031.goog"
+  "le.protobuf.DurationH\000\022-\n\013empty_field\030\004 "
+  "\001(\0132\026.google.protobuf.EmptyH\000\0226\n\020field_m"
+  "ask_field\030\005 \001(\0132\032.google.protobuf.FieldM"
+  "askH\000\022>\n\024source_context_field\030\006 \001(\0132\036.go"
+  "ogle.protobuf.SourceContextH\000\022/\n\014struct_"
+  "field\030\007 \001(\0132\027.google.protobuf.StructH\000\0225"
+  "\n\017timestamp_field\030\010 \001(\0132\032.google.protobu"
+  "f.TimestampH\000\022+\n\ntype_field\030\t \001(\0132\025.goog"
+  "le.protobuf.TypeH\000\0224\n\014double_field\030\n \001(\013"
+  "2\034.google.protobuf.DoubleValueH\000\0222\n\013floa"
+  "t_field\030\013 \001(\0132\033.google.protobuf.FloatVal"
+  "ueH\000\0222\n\013int64_field\030\014 \001(\0132\033.google.proto"
+  "buf.Int64ValueH\000\0224\n\014uint64_field\030\r \001(\0132\034"
+  ".google.protobuf.UInt64ValueH\000\0222\n\013int32_"
+  "field\030\016 \001(\0132\033.google.protobuf.Int32Value"
+  "H\000\0224\n\014uint32_field\030\017 \001(\0132\034.google.protob"
+  "uf.UInt32ValueH\000\0220\n\nbool_field\030\020 \001(\0132\032.g"
+  "oogle.protobuf.BoolValueH\000\0224\n\014string_fie"
+  "ld\030\021 \001(\0132\034.google.protobuf.StringValueH\000"
+  "\0222\n\013bytes_field\030\022 \001(\0132\033.google.protobuf."
+  "BytesValueH\000B\r\n\013oneof_field\"\226\026\n\021MapWellK"
+  "nownTypes\022E\n\tany_field\030\001 \003(\01322.protobuf_"
+  "unittest.MapWellKnownTypes.AnyFieldEntry"
+  "\022E\n\tapi_field\030\002 \003(\01322.protobuf_unittest."
+  "MapWellKnownTypes.ApiFieldEntry\022O\n\016durat"
+  "ion_field\030\003 \003(\01327.protobuf_unittest.MapW"
+  "ellKnownTypes.DurationFieldEntry\022I\n\013empt"
+  "y_field\030\004 \003(\01324.protobuf_unittest.MapWel"
+  "lKnownTypes.EmptyFieldEntry\022R\n\020field_mas"
+  "k_field\030\005 \003(\01328.protobuf_unittest.MapWel"
+  "lKnownTypes.FieldMaskFieldEntry\022Z\n\024sourc"
+  "e_context_field\030\006 \003(\0132<.protobuf_unittes"
+  "t.MapWellKnownTypes.SourceContextFieldEn"
+  "try\022K\n\014struct_field\030\007 \003(\01325.protobuf_uni"
+  "ttest.MapWellKnownTypes.StructFieldEntry"
+  "\022Q\n\017timestamp_field\030\010 \003(\01328.protobuf_uni"
+  "ttest.MapWellKnownTypes.TimestampFieldEn"
+  "try\022G\n\ntype_field\030\t \003(\01323.protobuf_unitt"
+  "est.MapWellKnownTypes.TypeFieldEntry\022K\n\014"
+  "double_field\030\n \003(\01325.protobuf_unittest.M"
+  "apWellKnownTypes.DoubleFieldEntry\022I\n\013flo"
+  "at_field\030\013 \003(\01324.protobuf_unittest.MapWe"
+  "llKnownTypes.FloatFieldEntry\022I\n\013int64_fi"
+  "eld\030\014 \003(\01324.protobuf_unittest.MapWellKno"
+  "wnTypes.Int64FieldEntry\022K\n\014uint64_field\030"
+  "\r \003(\01325.protobuf_unittest.MapWellKnownTy"
+  "pes.Uint64FieldEntry\022I\n\013int32_field\030\016 \003("
+  "\01324.protobuf_unittest.MapWellKnownTypes."
+  "Int32FieldEntry\022K\n\014uint32_field\030\017 \003(\01325."
+  "protobuf_unittest.MapWellKnownTypes.Uint"
+  "32FieldEntry\022G\n\nbool_field\030\020 \003(\01323.proto"
+  "buf_unittest.MapWellKnownTypes.BoolField"
+  "Entry\022K\n\014string_field\030\021 \003(\01325.protobuf_u"
+  "nittest.MapWellKnownTypes.StringFieldEnt"
+  "ry\022I\n\013bytes_field\030\022 \003(\01324.protobuf_unitt"
+  "est.MapWellKnownTypes.BytesFieldEntry\032E\n"
+  "\rAnyFieldEntry\022\013\n\003key\030\001 \001(\005\022#\n\005value\030\002 \001"
+  "(\0132\024.google.protobuf.Any:\0028\001\032E\n\rApiField"
+  "Entry\022\013\n\003key\030\001 \001(\005\022#\n\005value\030\002 \001(\0132\024.goog"
+  "le.protobuf.Api:\0028\001\032O\n\022DurationFieldEntr"
+  "y\022\013\n\003key\030\001 \001(\005\022(\n\005value\030\002 \001(\0132\031.google.p"
+  "rotobuf.Duration:\0028\001\032I\n\017EmptyFieldEntry\022"
+  "\013\n\003key\030\001 \001(\005\022%\n\005value\030\002 \001(\0132\026.google.pro"
+  "tobuf.Empty:\0028\001\032Q\n\023FieldMaskFieldEntry\022\013"
+  "\n\003key\030\001 \001(\005\022)\n\005value\030\002 \001(\0132\032.google.prot"
+  "obuf.FieldMask:\0028\001\032Y\n\027SourceContextField"
+  "Entry\022\013\n\003key\030\001 \001(\005\022-\n\005value\030\002 \001(\0132\036.goog"
+  "le.protobuf.SourceContext:\0028\001\032K\n\020StructF"
+  "ieldEntry\022\013\n\003key\030\001 \001(\005\022&\n\005value\030\002 \001(\0132\027."
+  "google.protobuf.Struct:\0028\001\032Q\n\023TimestampF"
+  "ieldEntry\022\013\n\003key\030\001 \001(\005\022)\n\005value\030\002 \001(\0132\032."
+  "google.protobuf.Timestamp:\0028\001\032G\n\016TypeFie"
+  "ldEntry\022\013\n\003key\030\001 \001(\005\022$\n\005value\030\002 \001(\0132\025.go"
+  "ogle.protobuf.Type:\0028\001\032P\n\020DoubleFieldEnt"
+  "ry\022\013\n\003key\030\001 \001(\005\022+\n\005value\030\002 \001(\0132\034.google."
+  "protobuf.DoubleValue:\0028\001\032N\n\017FloatFieldEn"
+  "try\022\013\n\003key\030\001 \001(\005\022*\n\005value\030\002 \001(\0132\033.google"
+  ".protobuf.FloatValue:\0028\001\032N\n\017Int64FieldEn"
+  "try\022\013\n\003key\030\001 \001(\005\022*\n\005value\030\002 \001(\0132\033.google"
+  ".protobuf.Int64Value:\0028\001\032P\n\020Uint64FieldE"
+  "ntry\022\013\n\003key\030\001 \001(\005\022+\n\005value\030\002 \001(\0132\034.googl"
+  "e.protobuf.UInt64Value:\0028\001\032N\n\017Int32Field"
+  "Entry\022\013\n\003key\030\001 \001(\005\022*\n\005value\030\002 \001(\0132\033.goog"
+  "le.protobuf.Int32Value:\0028\001\032P\n\020Uint32Fiel"
+  "dEntry\022\013\n\003key\030\001 \001(\005\022+\n\005value\030\002 \001(\0132\034.goo"
+  "gle.protobuf.UInt32Value:\0028\001\032L\n\016BoolFiel"
+  "dEntry\022\013\n\003key\030\001 \001(\005\022)\n\005value\030\002 \001(\0132\032.goo"
+  "gle.protobuf.BoolValue:\0028\001\032P\n\020StringFiel"
+  "dEntry\022\013\n\003key\030\001 \001(\005\022+\n\005value\030\002 \001(\0132\034.goo"
+  "gle.protobuf.StringValue:\0028\001\032N\n\017BytesFie"
+  "ldEntry\022\013\n\003key\030\001 \001(\005\022*\n\005value\030\002 \001(\0132\033.go"
+  "ogle.protobuf.BytesValue:\0028\001B9\n\030com.goog"
+  "le.protobuf.testP\001\252\002\032Google.Protobuf.Tes"
+  "tProtosb\006proto3"
+  ;
+static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_deps[10] = {
+  &::descriptor_table_google_2fprotobuf_2fany_2eproto,
+  &::descriptor_table_google_2fprotobuf_2fapi_2eproto,
+  &::descriptor_table_google_2fprotobuf_2fduration_2eproto,
+  &::descriptor_table_google_2fprotobuf_2fempty_2eproto,
+  &::descriptor_table_google_2fprotobuf_2ffield_5fmask_2eproto,
+  &::descriptor_table_google_2fprotobuf_2fsource_5fcontext_2eproto,
+  &::descriptor_table_google_2fprotobuf_2fstruct_2eproto,
+  &::descriptor_table_google_2fprotobuf_2ftimestamp_2eproto,
+  &::descriptor_table_google_2fprotobuf_2ftype_2eproto,
+  &::descriptor_table_google_2fprotobuf_2fwrappers_2eproto,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_sccs[22] = {
+  &scc_info_MapWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_AnyFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_ApiFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_BoolFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_BytesFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_DoubleFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_DurationFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_EmptyFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_FloatFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_Int32FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_Int64FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_SourceContextFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_StringFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_StructFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_TimestampFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_TypeFieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_Uint32FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_MapWellKnownTypes_Uint64FieldEntry_DoNotUse_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_OneofWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_RepeatedWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+  &scc_info_TestWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once;
+const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto = {
+  false, false, descriptor_table_protodef_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto, "google/protobuf/unittest_well_known_types.proto", 6135,
+  &descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_once, descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_sccs, descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto_deps, 22, 10,
+  schemas, file_default_instances, TableStruct_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto::offsets,
+  file_level_metadata_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto, 22, file_level_enum_descriptors_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto, file_level_service_descriptors_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto,
+};
+
+// Force running AddDescriptors() at dynamic initialization time.
+static bool dynamic_init_dummy_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto)), true);
+namespace protobuf_unittest {
+
+// ===================================================================
+
+void TestWellKnownTypes::InitAsDefaultInstance() {
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->any_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Any*>(
+      PROTOBUF_NAMESPACE_ID::Any::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->api_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Api*>(
+      PROTOBUF_NAMESPACE_ID::Api::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->duration_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Duration*>(
+      PROTOBUF_NAMESPACE_ID::Duration::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->empty_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Empty*>(
+      PROTOBUF_NAMESPACE_ID::Empty::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->field_mask_field_ = const_cast< PROTOBUF_NAMESPACE_ID::FieldMask*>(
+      PROTOBUF_NAMESPACE_ID::FieldMask::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->source_context_field_ = const_cast< PROTOBUF_NAMESPACE_ID::SourceContext*>(
+      PROTOBUF_NAMESPACE_ID::SourceContext::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->struct_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Struct*>(
+      PROTOBUF_NAMESPACE_ID::Struct::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->timestamp_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Timestamp*>(
+      PROTOBUF_NAMESPACE_ID::Timestamp::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->type_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Type*>(
+      PROTOBUF_NAMESPACE_ID::Type::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->double_field_ = const_cast< PROTOBUF_NAMESPACE_ID::DoubleValue*>(
+      PROTOBUF_NAMESPACE_ID::DoubleValue::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->float_field_ = const_cast< PROTOBUF_NAMESPACE_ID::FloatValue*>(
+      PROTOBUF_NAMESPACE_ID::FloatValue::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->int64_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Int64Value*>(
+      PROTOBUF_NAMESPACE_ID::Int64Value::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->uint64_field_ = const_cast< PROTOBUF_NAMESPACE_ID::UInt64Value*>(
+      PROTOBUF_NAMESPACE_ID::UInt64Value::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->int32_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Int32Value*>(
+      PROTOBUF_NAMESPACE_ID::Int32Value::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->uint32_field_ = const_cast< PROTOBUF_NAMESPACE_ID::UInt32Value*>(
+      PROTOBUF_NAMESPACE_ID::UInt32Value::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->bool_field_ = const_cast< PROTOBUF_NAMESPACE_ID::BoolValue*>(
+      PROTOBUF_NAMESPACE_ID::BoolValue::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->string_field_ = const_cast< PROTOBUF_NAMESPACE_ID::StringValue*>(
+      PROTOBUF_NAMESPACE_ID::StringValue::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->bytes_field_ = const_cast< PROTOBUF_NAMESPACE_ID::BytesValue*>(
+      PROTOBUF_NAMESPACE_ID::BytesValue::internal_default_instance());
+  ::protobuf_unittest::_TestWellKnownTypes_default_instance_._instance.get_mutable()->value_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Value*>(
+      PROTOBUF_NAMESPACE_ID::Value::internal_default_instance());
+}
+class TestWellKnownTypes::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Any& any_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Api& api_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Duration& duration_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Empty& empty_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::FieldMask& field_mask_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::SourceContext& source_context_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Struct& struct_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Timestamp& timestamp_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Type& type_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::DoubleValue& double_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::FloatValue& float_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Int64Value& int64_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::UInt64Value& uint64_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Int32Value& int32_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::UInt32Value& uint32_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::BoolValue& bool_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::StringValue& string_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::BytesValue& bytes_field(const TestWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Value& value_field(const TestWellKnownTypes* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Any&
+TestWellKnownTypes::_Internal::any_field(const TestWellKnownTypes* msg) {
+  return *msg->any_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Api&
+TestWellKnownTypes::_Internal::api_field(const TestWellKnownTypes* msg) {
+  return *msg->api_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Duration&
+TestWellKnownTypes::_Internal::duration_field(const TestWellKnownTypes* msg) {
+  return *msg->duration_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Empty&
+TestWellKnownTypes::_Internal::empty_field(const TestWellKnownTypes* msg) {
+  return *msg->empty_field_;
+}
+const PROTOBUF_NAMESPACE_ID::FieldMask&
+TestWellKnownTypes::_Internal::field_mask_field(const TestWellKnownTypes* msg) {
+  return *msg->field_mask_field_;
+}
+const PROTOBUF_NAMESPACE_ID::SourceContext&
+TestWellKnownTypes::_Internal::source_context_field(const TestWellKnownTypes* msg) {
+  return *msg->source_context_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Struct&
+TestWellKnownTypes::_Internal::struct_field(const TestWellKnownTypes* msg) {
+  return *msg->struct_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Timestamp&
+TestWellKnownTypes::_Internal::timestamp_field(const TestWellKnownTypes* msg) {
+  return *msg->timestamp_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Type&
+TestWellKnownTypes::_Internal::type_field(const TestWellKnownTypes* msg) {
+  return *msg->type_field_;
+}
+const PROTOBUF_NAMESPACE_ID::DoubleValue&
+TestWellKnownTypes::_Internal::double_field(const TestWellKnownTypes* msg) {
+  return *msg->double_field_;
+}
+const PROTOBUF_NAMESPACE_ID::FloatValue&
+TestWellKnownTypes::_Internal::float_field(const TestWellKnownTypes* msg) {
+  return *msg->float_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Int64Value&
+TestWellKnownTypes::_Internal::int64_field(const TestWellKnownTypes* msg) {
+  return *msg->int64_field_;
+}
+const PROTOBUF_NAMESPACE_ID::UInt64Value&
+TestWellKnownTypes::_Internal::uint64_field(const TestWellKnownTypes* msg) {
+  return *msg->uint64_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Int32Value&
+TestWellKnownTypes::_Internal::int32_field(const TestWellKnownTypes* msg) {
+  return *msg->int32_field_;
+}
+const PROTOBUF_NAMESPACE_ID::UInt32Value&
+TestWellKnownTypes::_Internal::uint32_field(const TestWellKnownTypes* msg) {
+  return *msg->uint32_field_;
+}
+const PROTOBUF_NAMESPACE_ID::BoolValue&
+TestWellKnownTypes::_Internal::bool_field(const TestWellKnownTypes* msg) {
+  return *msg->bool_field_;
+}
+const PROTOBUF_NAMESPACE_ID::StringValue&
+TestWellKnownTypes::_Internal::string_field(const TestWellKnownTypes* msg) {
+  return *msg->string_field_;
+}
+const PROTOBUF_NAMESPACE_ID::BytesValue&
+TestWellKnownTypes::_Internal::bytes_field(const TestWellKnownTypes* msg) {
+  return *msg->bytes_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Value&
+TestWellKnownTypes::_Internal::value_field(const TestWellKnownTypes* msg) {
+  return *msg->value_field_;
+}
+void TestWellKnownTypes::clear_any_field() {
+  if (GetArena() == nullptr && any_field_ != nullptr) {
+    delete any_field_;
+  }
+  any_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_api_field() {
+  if (GetArena() == nullptr && api_field_ != nullptr) {
+    delete api_field_;
+  }
+  api_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_duration_field() {
+  if (GetArena() == nullptr && duration_field_ != nullptr) {
+    delete duration_field_;
+  }
+  duration_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_empty_field() {
+  if (GetArena() == nullptr && empty_field_ != nullptr) {
+    delete empty_field_;
+  }
+  empty_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_field_mask_field() {
+  if (GetArena() == nullptr && field_mask_field_ != nullptr) {
+    delete field_mask_field_;
+  }
+  field_mask_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_source_context_field() {
+  if (GetArena() == nullptr && source_context_field_ != nullptr) {
+    delete source_context_field_;
+  }
+  source_context_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_struct_field() {
+  if (GetArena() == nullptr && struct_field_ != nullptr) {
+    delete struct_field_;
+  }
+  struct_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_timestamp_field() {
+  if (GetArena() == nullptr && timestamp_field_ != nullptr) {
+    delete timestamp_field_;
+  }
+  timestamp_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_type_field() {
+  if (GetArena() == nullptr && type_field_ != nullptr) {
+    delete type_field_;
+  }
+  type_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_double_field() {
+  if (GetArena() == nullptr && double_field_ != nullptr) {
+    delete double_field_;
+  }
+  double_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_float_field() {
+  if (GetArena() == nullptr && float_field_ != nullptr) {
+    delete float_field_;
+  }
+  float_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_int64_field() {
+  if (GetArena() == nullptr && int64_field_ != nullptr) {
+    delete int64_field_;
+  }
+  int64_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_uint64_field() {
+  if (GetArena() == nullptr && uint64_field_ != nullptr) {
+    delete uint64_field_;
+  }
+  uint64_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_int32_field() {
+  if (GetArena() == nullptr && int32_field_ != nullptr) {
+    delete int32_field_;
+  }
+  int32_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_uint32_field() {
+  if (GetArena() == nullptr && uint32_field_ != nullptr) {
+    delete uint32_field_;
+  }
+  uint32_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_bool_field() {
+  if (GetArena() == nullptr && bool_field_ != nullptr) {
+    delete bool_field_;
+  }
+  bool_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_string_field() {
+  if (GetArena() == nullptr && string_field_ != nullptr) {
+    delete string_field_;
+  }
+  string_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_bytes_field() {
+  if (GetArena() == nullptr && bytes_field_ != nullptr) {
+    delete bytes_field_;
+  }
+  bytes_field_ = nullptr;
+}
+void TestWellKnownTypes::clear_value_field() {
+  if (GetArena() == nullptr && value_field_ != nullptr) {
+    delete value_field_;
+  }
+  value_field_ = nullptr;
+}
+TestWellKnownTypes::TestWellKnownTypes(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestWellKnownTypes)
+}
+TestWellKnownTypes::TestWellKnownTypes(const TestWellKnownTypes& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_any_field()) {
+    any_field_ = new PROTOBUF_NAMESPACE_ID::Any(*from.any_field_);
+  } else {
+    any_field_ = nullptr;
+  }
+  if (from._internal_has_api_field()) {
+    api_field_ = new PROTOBUF_NAMESPACE_ID::Api(*from.api_field_);
+  } else {
+    api_field_ = nullptr;
+  }
+  if (from._internal_has_duration_field()) {
+    duration_field_ = new PROTOBUF_NAMESPACE_ID::Duration(*from.duration_field_);
+  } else {
+    duration_field_ = nullptr;
+  }
+  if (from._internal_has_empty_field()) {
+    empty_field_ = new PROTOBUF_NAMESPACE_ID::Empty(*from.empty_field_);
+  } else {
+    empty_field_ = nullptr;
+  }
+  if (from._internal_has_field_mask_field()) {
+    field_mask_field_ = new PROTOBUF_NAMESPACE_ID::FieldMask(*from.field_mask_field_);
+  } else {
+    field_mask_field_ = nullptr;
+  }
+  if (from._internal_has_source_context_field()) {
+    source_context_field_ = new PROTOBUF_NAMESPACE_ID::SourceContext(*from.source_context_field_);
+  } else {
+    source_context_field_ = nullptr;
+  }
+  if (from._internal_has_struct_field()) {
+    struct_field_ = new PROTOBUF_NAMESPACE_ID::Struct(*from.struct_field_);
+  } else {
+    struct_field_ = nullptr;
+  }
+  if (from._internal_has_timestamp_field()) {
+    timestamp_field_ = new PROTOBUF_NAMESPACE_ID::Timestamp(*from.timestamp_field_);
+  } else {
+    timestamp_field_ = nullptr;
+  }
+  if (from._internal_has_type_field()) {
+    type_field_ = new PROTOBUF_NAMESPACE_ID::Type(*from.type_field_);
+  } else {
+    type_field_ = nullptr;
+  }
+  if (from._internal_has_double_field()) {
+    double_field_ = new PROTOBUF_NAMESPACE_ID::DoubleValue(*from.double_field_);
+  } else {
+    double_field_ = nullptr;
+  }
+  if (from._internal_has_float_field()) {
+    float_field_ = new PROTOBUF_NAMESPACE_ID::FloatValue(*from.float_field_);
+  } else {
+    float_field_ = nullptr;
+  }
+  if (from._internal_has_int64_field()) {
+    int64_field_ = new PROTOBUF_NAMESPACE_ID::Int64Value(*from.int64_field_);
+  } else {
+    int64_field_ = nullptr;
+  }
+  if (from._internal_has_uint64_field()) {
+    uint64_field_ = new PROTOBUF_NAMESPACE_ID::UInt64Value(*from.uint64_field_);
+  } else {
+    uint64_field_ = nullptr;
+  }
+  if (from._internal_has_int32_field()) {
+    int32_field_ = new PROTOBUF_NAMESPACE_ID::Int32Value(*from.int32_field_);
+  } else {
+    int32_field_ = nullptr;
+  }
+  if (from._internal_has_uint32_field()) {
+    uint32_field_ = new PROTOBUF_NAMESPACE_ID::UInt32Value(*from.uint32_field_);
+  } else {
+    uint32_field_ = nullptr;
+  }
+  if (from._internal_has_bool_field()) {
+    bool_field_ = new PROTOBUF_NAMESPACE_ID::BoolValue(*from.bool_field_);
+  } else {
+    bool_field_ = nullptr;
+  }
+  if (from._internal_has_string_field()) {
+    string_field_ = new PROTOBUF_NAMESPACE_ID::StringValue(*from.string_field_);
+  } else {
+    string_field_ = nullptr;
+  }
+  if (from._internal_has_bytes_field()) {
+    bytes_field_ = new PROTOBUF_NAMESPACE_ID::BytesValue(*from.bytes_field_);
+  } else {
+    bytes_field_ = nullptr;
+  }
+  if (from._internal_has_value_field()) {
+    value_field_ = new PROTOBUF_NAMESPACE_ID::Value(*from.value_field_);
+  } else {
+    value_field_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestWellKnownTypes)
+}
+
+void TestWellKnownTypes::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base);
+  ::memset(&any_field_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&value_field_) -
+      reinterpret_cast<char*>(&any_field_)) + sizeof(value_field_));
+}
+
+TestWellKnownTypes::~TestWellKnownTypes() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestWellKnownTypes)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestWellKnownTypes::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete any_field_;
+  if (this != internal_default_instance()) delete api_field_;
+  if (this != internal_default_instance()) delete duration_field_;
+  if (this != internal_default_instance()) delete empty_field_;
+  if (this != internal_default_instance()) delete field_mask_field_;
+  if (this != internal_default_instance()) delete source_context_field_;
+  if (this != internal_default_instance()) delete struct_field_;
+  if (this != internal_default_instance()) delete timestamp_field_;
+  if (this != internal_default_instance()) delete type_field_;
+  if (this != internal_default_instance()) delete double_field_;
+  if (this != internal_default_instance()) delete float_field_;
+  if (this != internal_default_instance()) delete int64_field_;
+  if (this != internal_default_instance()) delete uint64_field_;
+  if (this != internal_default_instance()) delete int32_field_;
+  if (this != internal_default_instance()) delete uint32_field_;
+  if (this != internal_default_instance()) delete bool_field_;
+  if (this != internal_default_instance()) delete string_field_;
+  if (this != internal_default_instance()) delete bytes_field_;
+  if (this != internal_default_instance()) delete value_field_;
+}
+
+void TestWellKnownTypes::ArenaDtor(void* object) {
+  TestWellKnownTypes* _this = reinterpret_cast< TestWellKnownTypes* >(object);
+  (void)_this;
+}
+void TestWellKnownTypes::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestWellKnownTypes::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestWellKnownTypes& TestWellKnownTypes::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestWellKnownTypes::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestWellKnownTypes)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && any_field_ != nullptr) {
+    delete any_field_;
+  }
+  any_field_ = nullptr;
+  if (GetArena() == nullptr && api_field_ != nullptr) {
+    delete api_field_;
+  }
+  api_field_ = nullptr;
+  if (GetArena() == nullptr && duration_field_ != nullptr) {
+    delete duration_field_;
+  }
+  duration_field_ = nullptr;
+  if (GetArena() == nullptr && empty_field_ != nullptr) {
+    delete empty_field_;
+  }
+  empty_field_ = nullptr;
+  if (GetArena() == nullptr && field_mask_field_ != nullptr) {
+    delete field_mask_field_;
+  }
+  field_mask_field_ = nullptr;
+  if (GetArena() == nullptr && source_context_field_ != nullptr) {
+    delete source_context_field_;
+  }
+  source_context_field_ = nullptr;
+  if (GetArena() == nullptr && struct_field_ != nullptr) {
+    delete struct_field_;
+  }
+  struct_field_ = nullptr;
+  if (GetArena() == nullptr && timestamp_field_ != nullptr) {
+    delete timestamp_field_;
+  }
+  timestamp_field_ = nullptr;
+  if (GetArena() == nullptr && type_field_ != nullptr) {
+    delete type_field_;
+  }
+  type_field_ = nullptr;
+  if (GetArena() == nullptr && double_field_ != nullptr) {
+    delete double_field_;
+  }
+  double_field_ = nullptr;
+  if (GetArena() == nullptr && float_field_ != nullptr) {
+    delete float_field_;
+  }
+  float_field_ = nullptr;
+  if (GetArena() == nullptr && int64_field_ != nullptr) {
+    delete int64_field_;
+  }
+  int64_field_ = nullptr;
+  if (GetArena() == nullptr && uint64_field_ != nullptr) {
+    delete uint64_field_;
+  }
+  uint64_field_ = nullptr;
+  if (GetArena() == nullptr && int32_field_ != nullptr) {
+    delete int32_field_;
+  }
+  int32_field_ = nullptr;
+  if (GetArena() == nullptr && uint32_field_ != nullptr) {
+    delete uint32_field_;
+  }
+  uint32_field_ = nullptr;
+  if (GetArena() == nullptr && bool_field_ != nullptr) {
+    delete bool_field_;
+  }
+  bool_field_ = nullptr;
+  if (GetArena() == nullptr && string_field_ != nullptr) {
+    delete string_field_;
+  }
+  string_field_ = nullptr;
+  if (GetArena() == nullptr && bytes_field_ != nullptr) {
+    delete bytes_field_;
+  }
+  bytes_field_ = nullptr;
+  if (GetArena() == nullptr && value_field_ != nullptr) {
+    delete value_field_;
+  }
+  value_field_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestWellKnownTypes::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Any any_field = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Api api_field = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_api_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Duration duration_field = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_duration_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Empty empty_field = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_empty_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.FieldMask field_mask_field = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_field_mask_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.SourceContext source_context_field = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_source_context_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Struct struct_field = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_struct_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Timestamp timestamp_field = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_timestamp_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Type type_field = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_type_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.DoubleValue double_field = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_double_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.FloatValue float_field = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_float_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Int64Value int64_field = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_int64_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.UInt64Value uint64_field = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_uint64_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Int32Value int32_field = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_int32_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.UInt32Value uint32_field = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_uint32_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.BoolValue bool_field = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bool_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.StringValue string_field = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_string_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.BytesValue bytes_field = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bytes_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Value value_field = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestWellKnownTypes::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestWellKnownTypes)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Any any_field = 1;
+  if (this->has_any_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::any_field(this), target, stream);
+  }
+
+  // .google.protobuf.Api api_field = 2;
+  if (this->has_api_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::api_field(this), target, stream);
+  }
+
+  // .google.protobuf.Duration duration_field = 3;
+  if (this->has_duration_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::duration_field(this), target, stream);
+  }
+
+  // .google.protobuf.Empty empty_field = 4;
+  if (this->has_empty_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::empty_field(this), target, stream);
+  }
+
+  // .google.protobuf.FieldMask field_mask_field = 5;
+  if (this->has_field_mask_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        5, _Internal::field_mask_field(this), target, stream);
+  }
+
+  // .google.protobuf.SourceContext source_context_field = 6;
+  if (this->has_source_context_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        6, _Internal::source_context_field(this), target, stream);
+  }
+
+  // .google.protobuf.Struct struct_field = 7;
+  if (this->has_struct_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        7, _Internal::struct_field(this), target, stream);
+  }
+
+  // .google.protobuf.Timestamp timestamp_field = 8;
+  if (this->has_timestamp_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        8, _Internal::timestamp_field(this), target, stream);
+  }
+
+  // .google.protobuf.Type type_field = 9;
+  if (this->has_type_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        9, _Internal::type_field(this), target, stream);
+  }
+
+  // .google.protobuf.DoubleValue double_field = 10;
+  if (this->has_double_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        10, _Internal::double_field(this), target, stream);
+  }
+
+  // .google.protobuf.FloatValue float_field = 11;
+  if (this->has_float_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        11, _Internal::float_field(this), target, stream);
+  }
+
+  // .google.protobuf.Int64Value int64_field = 12;
+  if (this->has_int64_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        12, _Internal::int64_field(this), target, stream);
+  }
+
+  // .google.protobuf.UInt64Value uint64_field = 13;
+  if (this->has_uint64_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        13, _Internal::uint64_field(this), target, stream);
+  }
+
+  // .google.protobuf.Int32Value int32_field = 14;
+  if (this->has_int32_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        14, _Internal::int32_field(this), target, stream);
+  }
+
+  // .google.protobuf.UInt32Value uint32_field = 15;
+  if (this->has_uint32_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        15, _Internal::uint32_field(this), target, stream);
+  }
+
+  // .google.protobuf.BoolValue bool_field = 16;
+  if (this->has_bool_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        16, _Internal::bool_field(this), target, stream);
+  }
+
+  // .google.protobuf.StringValue string_field = 17;
+  if (this->has_string_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        17, _Internal::string_field(this), target, stream);
+  }
+
+  // .google.protobuf.BytesValue bytes_field = 18;
+  if (this->has_bytes_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        18, _Internal::bytes_field(this), target, stream);
+  }
+
+  // .google.protobuf.Value value_field = 19;
+  if (this->has_value_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        19, _Internal::value_field(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestWellKnownTypes)
+  return target;
+}
+
+size_t TestWellKnownTypes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestWellKnownTypes)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.Any any_field = 1;
+  if (this->has_any_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_field_);
+  }
+
+  // .google.protobuf.Api api_field = 2;
+  if (this->has_api_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *api_field_);
+  }
+
+  // .google.protobuf.Duration duration_field = 3;
+  if (this->has_duration_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *duration_field_);
+  }
+
+  // .google.protobuf.Empty empty_field = 4;
+  if (this->has_empty_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *empty_field_);
+  }
+
+  // .google.protobuf.FieldMask field_mask_field = 5;
+  if (this->has_field_mask_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *field_mask_field_);
+  }
+
+  // .google.protobuf.SourceContext source_context_field = 6;
+  if (this->has_source_context_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *source_context_field_);
+  }
+
+  // .google.protobuf.Struct struct_field = 7;
+  if (this->has_struct_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *struct_field_);
+  }
+
+  // .google.protobuf.Timestamp timestamp_field = 8;
+  if (this->has_timestamp_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *timestamp_field_);
+  }
+
+  // .google.protobuf.Type type_field = 9;
+  if (this->has_type_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *type_field_);
+  }
+
+  // .google.protobuf.DoubleValue double_field = 10;
+  if (this->has_double_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *double_field_);
+  }
+
+  // .google.protobuf.FloatValue float_field = 11;
+  if (this->has_float_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *float_field_);
+  }
+
+  // .google.protobuf.Int64Value int64_field = 12;
+  if (this->has_int64_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int64_field_);
+  }
+
+  // .google.protobuf.UInt64Value uint64_field = 13;
+  if (this->has_uint64_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint64_field_);
+  }
+
+  // .google.protobuf.Int32Value int32_field = 14;
+  if (this->has_int32_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int32_field_);
+  }
+
+  // .google.protobuf.UInt32Value uint32_field = 15;
+  if (this->has_uint32_field()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint32_field_);
+  }
+
+  // .google.protobuf.BoolValue bool_field = 16;
+  if (this->has_bool_field()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bool_field_);
+  }
+
+  // .google.protobuf.StringValue string_field = 17;
+  if (this->has_string_field()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *string_field_);
+  }
+
+  // .google.protobuf.BytesValue bytes_field = 18;
+  if (this->has_bytes_field()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bytes_field_);
+  }
+
+  // .google.protobuf.Value value_field = 19;
+  if (this->has_value_field()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *value_field_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestWellKnownTypes::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protobuf_unittest.TestWellKnownTypes)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestWellKnownTypes* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestWellKnownTypes>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protobuf_unittest.TestWellKnownTypes)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protobuf_unittest.TestWellKnownTypes)
+    MergeFrom(*source);
+  }
+}
+
+void TestWellKnownTypes::MergeFrom(const TestWellKnownTypes& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestWellKnownTypes)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_any_field()) {
+    _internal_mutable_any_field()->PROTOBUF_NAMESPACE_ID::Any::MergeFrom(from._internal_any_field());
+  }
+  if (from.has_api_field()) {
+    _internal_mutable_api_field()->PROTOBUF_NAMESPACE_ID::Api::MergeFrom(from._internal_api_field());
+  }
+  if (from.has_duration_field()) {
+    _internal_mutable_duration_field()->PROTOBUF_NAMESPACE_ID::Duration::MergeFrom(from._internal_duration_field());
+  }
+  if (from.has_empty_field()) {
+    _internal_mutable_empty_field()->PROTOBUF_NAMESPACE_ID::Empty::MergeFrom(from._internal_empty_field());
+  }
+  if (from.has_field_mask_field()) {
+    _internal_mutable_field_mask_field()->PROTOBUF_NAMESPACE_ID::FieldMask::MergeFrom(from._internal_field_mask_field());
+  }
+  if (from.has_source_context_field()) {
+    _internal_mutable_source_context_field()->PROTOBUF_NAMESPACE_ID::SourceContext::MergeFrom(from._internal_source_context_field());
+  }
+  if (from.has_struct_field()) {
+    _internal_mutable_struct_field()->PROTOBUF_NAMESPACE_ID::Struct::MergeFrom(from._internal_struct_field());
+  }
+  if (from.has_timestamp_field()) {
+    _internal_mutable_timestamp_field()->PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(from._internal_timestamp_field());
+  }
+  if (from.has_type_field()) {
+    _internal_mutable_type_field()->PROTOBUF_NAMESPACE_ID::Type::MergeFrom(from._internal_type_field());
+  }
+  if (from.has_double_field()) {
+    _internal_mutable_double_field()->PROTOBUF_NAMESPACE_ID::DoubleValue::MergeFrom(from._internal_double_field());
+  }
+  if (from.has_float_field()) {
+    _internal_mutable_float_field()->PROTOBUF_NAMESPACE_ID::FloatValue::MergeFrom(from._internal_float_field());
+  }
+  if (from.has_int64_field()) {
+    _internal_mutable_int64_field()->PROTOBUF_NAMESPACE_ID::Int64Value::MergeFrom(from._internal_int64_field());
+  }
+  if (from.has_uint64_field()) {
+    _internal_mutable_uint64_field()->PROTOBUF_NAMESPACE_ID::UInt64Value::MergeFrom(from._internal_uint64_field());
+  }
+  if (from.has_int32_field()) {
+    _internal_mutable_int32_field()->PROTOBUF_NAMESPACE_ID::Int32Value::MergeFrom(from._internal_int32_field());
+  }
+  if (from.has_uint32_field()) {
+    _internal_mutable_uint32_field()->PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(from._internal_uint32_field());
+  }
+  if (from.has_bool_field()) {
+    _internal_mutable_bool_field()->PROTOBUF_NAMESPACE_ID::BoolValue::MergeFrom(from._internal_bool_field());
+  }
+  if (from.has_string_field()) {
+    _internal_mutable_string_field()->PROTOBUF_NAMESPACE_ID::StringValue::MergeFrom(from._internal_string_field());
+  }
+  if (from.has_bytes_field()) {
+    _internal_mutable_bytes_field()->PROTOBUF_NAMESPACE_ID::BytesValue::MergeFrom(from._internal_bytes_field());
+  }
+  if (from.has_value_field()) {
+    _internal_mutable_value_field()->PROTOBUF_NAMESPACE_ID::Value::MergeFrom(from._internal_value_field());
+  }
+}
+
+void TestWellKnownTypes::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protobuf_unittest.TestWellKnownTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestWellKnownTypes::CopyFrom(const TestWellKnownTypes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestWellKnownTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestWellKnownTypes::IsInitialized() const {
+  return true;
+}
+
+void TestWellKnownTypes::InternalSwap(TestWellKnownTypes* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, value_field_)
+      + sizeof(TestWellKnownTypes::value_field_)
+      - PROTOBUF_FIELD_OFFSET(TestWellKnownTypes, any_field_)>(
+          reinterpret_cast<char*>(&any_field_),
+          reinterpret_cast<char*>(&other->any_field_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestWellKnownTypes::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void RepeatedWellKnownTypes::InitAsDefaultInstance() {
+}
+class RepeatedWellKnownTypes::_Internal {
+ public:
+};
+
+void RepeatedWellKnownTypes::clear_any_field() {
+  any_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_api_field() {
+  api_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_duration_field() {
+  duration_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_empty_field() {
+  empty_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_field_mask_field() {
+  field_mask_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_source_context_field() {
+  source_context_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_struct_field() {
+  struct_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_timestamp_field() {
+  timestamp_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_type_field() {
+  type_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_double_field() {
+  double_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_float_field() {
+  float_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_int64_field() {
+  int64_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_uint64_field() {
+  uint64_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_int32_field() {
+  int32_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_uint32_field() {
+  uint32_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_bool_field() {
+  bool_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_string_field() {
+  string_field_.Clear();
+}
+void RepeatedWellKnownTypes::clear_bytes_field() {
+  bytes_field_.Clear();
+}
+RepeatedWellKnownTypes::RepeatedWellKnownTypes(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  any_field_(arena),
+  api_field_(arena),
+  duration_field_(arena),
+  empty_field_(arena),
+  field_mask_field_(arena),
+  source_context_field_(arena),
+  struct_field_(arena),
+  timestamp_field_(arena),
+  type_field_(arena),
+  double_field_(arena),
+  float_field_(arena),
+  int64_field_(arena),
+  uint64_field_(arena),
+  int32_field_(arena),
+  uint32_field_(arena),
+  bool_field_(arena),
+  string_field_(arena),
+  bytes_field_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.RepeatedWellKnownTypes)
+}
+RepeatedWellKnownTypes::RepeatedWellKnownTypes(const RepeatedWellKnownTypes& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      any_field_(from.any_field_),
+      api_field_(from.api_field_),
+      duration_field_(from.duration_field_),
+      empty_field_(from.empty_field_),
+      field_mask_field_(from.field_mask_field_),
+      source_context_field_(from.source_context_field_),
+      struct_field_(from.struct_field_),
+      timestamp_field_(from.timestamp_field_),
+      type_field_(from.type_field_),
+      double_field_(from.double_field_),
+      float_field_(from.float_field_),
+      int64_field_(from.int64_field_),
+      uint64_field_(from.uint64_field_),
+      int32_field_(from.int32_field_),
+      uint32_field_(from.uint32_field_),
+      bool_field_(from.bool_field_),
+      string_field_(from.string_field_),
+      bytes_field_(from.bytes_field_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.RepeatedWellKnownTypes)
+}
+
+void RepeatedWellKnownTypes::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RepeatedWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base);
+}
+
+RepeatedWellKnownTypes::~RepeatedWellKnownTypes() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.RepeatedWellKnownTypes)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void RepeatedWellKnownTypes::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void RepeatedWellKnownTypes::ArenaDtor(void* object) {
+  RepeatedWellKnownTypes* _this = reinterpret_cast< RepeatedWellKnownTypes* >(object);
+  (void)_this;
+}
+void RepeatedWellKnownTypes::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void RepeatedWellKnownTypes::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const RepeatedWellKnownTypes& RepeatedWellKnownTypes::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RepeatedWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void RepeatedWellKnownTypes::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.RepeatedWellKnownTypes)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  any_field_.Clear();
+  api_field_.Clear();
+  duration_field_.Clear();
+  empty_field_.Clear();
+  field_mask_field_.Clear();
+  source_context_field_.Clear();
+  struct_field_.Clear();
+  timestamp_field_.Clear();
+  type_field_.Clear();
+  double_field_.Clear();
+  float_field_.Clear();
+  int64_field_.Clear();
+  uint64_field_.Clear();
+  int32_field_.Clear();
+  uint32_field_.Clear();
+  bool_field_.Clear();
+  string_field_.Clear();
+  bytes_field_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RepeatedWellKnownTypes::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated .google.protobuf.Any any_field = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          any_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<10>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_any_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Api api_field = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          api_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<18>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_api_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Duration duration_field = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr -= 1;
+          duration_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<26>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_duration_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Empty empty_field = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr -= 1;
+          empty_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<34>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_empty_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.FieldMask field_mask_field = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr -= 1;
+          field_mask_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<42>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_field_mask_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.SourceContext source_context_field = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr -= 1;
+          source_context_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<50>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_source_context_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Struct struct_field = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr -= 1;
+          struct_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<58>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_struct_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Timestamp timestamp_field = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          ptr -= 1;
+          timestamp_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<66>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_timestamp_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Type type_field = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          ptr -= 1;
+          type_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<74>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_type_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.DoubleValue double_field = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+          ptr -= 1;
+          double_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<82>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_double_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.FloatValue float_field = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+          ptr -= 1;
+          float_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<90>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_float_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Int64Value int64_field = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          ptr -= 1;
+          int64_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<98>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_int64_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.UInt64Value uint64_field = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+          ptr -= 1;
+          uint64_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<106>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_uint64_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<106>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Int32Value int32_field = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+          ptr -= 1;
+          int32_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<114>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_int32_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<114>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.UInt32Value uint32_field = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
+          ptr -= 1;
+          uint32_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<122>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_uint32_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<122>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.BoolValue bool_field = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 130)) {
+          ptr -= 2;
+          bool_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<130>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_bool_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<130>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.StringValue string_field = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 138)) {
+          ptr -= 2;
+          string_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<138>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_string_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<138>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.BytesValue bytes_field = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 146)) {
+          ptr -= 2;
+          bytes_field_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<146>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_bytes_field(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<146>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* RepeatedWellKnownTypes::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.RepeatedWellKnownTypes)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Any any_field = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_any_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, this->_internal_any_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.Api api_field = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_api_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_api_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.Duration duration_field = 3;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_duration_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, this->_internal_duration_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.Empty empty_field = 4;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_empty_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, this->_internal_empty_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.FieldMask field_mask_field = 5;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_field_mask_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, this->_internal_field_mask_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.SourceContext source_context_field = 6;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_source_context_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, this->_internal_source_context_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.Struct struct_field = 7;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_struct_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, this->_internal_struct_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.Timestamp timestamp_field = 8;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_timestamp_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, this->_internal_timestamp_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.Type type_field = 9;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_type_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, this->_internal_type_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.DoubleValue double_field = 10;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_double_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, this->_internal_double_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.FloatValue float_field = 11;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_float_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, this->_internal_float_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.Int64Value int64_field = 12;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_int64_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, this->_internal_int64_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.UInt64Value uint64_field = 13;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_uint64_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(13, this->_internal_uint64_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.Int32Value int32_field = 14;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_int32_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(14, this->_internal_int32_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.UInt32Value uint32_field = 15;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_uint32_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(15, this->_internal_uint32_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.BoolValue bool_field = 16;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_bool_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(16, this->_internal_bool_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.StringValue string_field = 17;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_string_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(17, this->_internal_string_field(i), target, stream);
+  }
+
+  // repeated .google.protobuf.BytesValue bytes_field = 18;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_bytes_field_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(18, this->_internal_bytes_field(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.RepeatedWellKnownTypes)
+  return target;
+}
+
+size_t RepeatedWellKnownTypes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.RepeatedWellKnownTypes)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Any any_field = 1;
+  total_size += 1UL * this->_internal_any_field_size();
+  for (const auto& msg : this->any_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.Api api_field = 2;
+  total_size += 1UL * this->_internal_api_field_size();
+  for (const auto& msg : this->api_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.Duration duration_field = 3;
+  total_size += 1UL * this->_internal_duration_field_size();
+  for (const auto& msg : this->duration_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.Empty empty_field = 4;
+  total_size += 1UL * this->_internal_empty_field_size();
+  for (const auto& msg : this->empty_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.FieldMask field_mask_field = 5;
+  total_size += 1UL * this->_internal_field_mask_field_size();
+  for (const auto& msg : this->field_mask_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.SourceContext source_context_field = 6;
+  total_size += 1UL * this->_internal_source_context_field_size();
+  for (const auto& msg : this->source_context_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.Struct struct_field = 7;
+  total_size += 1UL * this->_internal_struct_field_size();
+  for (const auto& msg : this->struct_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.Timestamp timestamp_field = 8;
+  total_size += 1UL * this->_internal_timestamp_field_size();
+  for (const auto& msg : this->timestamp_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.Type type_field = 9;
+  total_size += 1UL * this->_internal_type_field_size();
+  for (const auto& msg : this->type_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.DoubleValue double_field = 10;
+  total_size += 1UL * this->_internal_double_field_size();
+  for (const auto& msg : this->double_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.FloatValue float_field = 11;
+  total_size += 1UL * this->_internal_float_field_size();
+  for (const auto& msg : this->float_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.Int64Value int64_field = 12;
+  total_size += 1UL * this->_internal_int64_field_size();
+  for (const auto& msg : this->int64_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.UInt64Value uint64_field = 13;
+  total_size += 1UL * this->_internal_uint64_field_size();
+  for (const auto& msg : this->uint64_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.Int32Value int32_field = 14;
+  total_size += 1UL * this->_internal_int32_field_size();
+  for (const auto& msg : this->int32_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.UInt32Value uint32_field = 15;
+  total_size += 1UL * this->_internal_uint32_field_size();
+  for (const auto& msg : this->uint32_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.BoolValue bool_field = 16;
+  total_size += 2UL * this->_internal_bool_field_size();
+  for (const auto& msg : this->bool_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.StringValue string_field = 17;
+  total_size += 2UL * this->_internal_string_field_size();
+  for (const auto& msg : this->string_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.BytesValue bytes_field = 18;
+  total_size += 2UL * this->_internal_bytes_field_size();
+  for (const auto& msg : this->bytes_field_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void RepeatedWellKnownTypes::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protobuf_unittest.RepeatedWellKnownTypes)
+  GOOGLE_DCHECK_NE(&from, this);
+  const RepeatedWellKnownTypes* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RepeatedWellKnownTypes>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protobuf_unittest.RepeatedWellKnownTypes)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protobuf_unittest.RepeatedWellKnownTypes)
+    MergeFrom(*source);
+  }
+}
+
+void RepeatedWellKnownTypes::MergeFrom(const RepeatedWellKnownTypes& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.RepeatedWellKnownTypes)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  any_field_.MergeFrom(from.any_field_);
+  api_field_.MergeFrom(from.api_field_);
+  duration_field_.MergeFrom(from.duration_field_);
+  empty_field_.MergeFrom(from.empty_field_);
+  field_mask_field_.MergeFrom(from.field_mask_field_);
+  source_context_field_.MergeFrom(from.source_context_field_);
+  struct_field_.MergeFrom(from.struct_field_);
+  timestamp_field_.MergeFrom(from.timestamp_field_);
+  type_field_.MergeFrom(from.type_field_);
+  double_field_.MergeFrom(from.double_field_);
+  float_field_.MergeFrom(from.float_field_);
+  int64_field_.MergeFrom(from.int64_field_);
+  uint64_field_.MergeFrom(from.uint64_field_);
+  int32_field_.MergeFrom(from.int32_field_);
+  uint32_field_.MergeFrom(from.uint32_field_);
+  bool_field_.MergeFrom(from.bool_field_);
+  string_field_.MergeFrom(from.string_field_);
+  bytes_field_.MergeFrom(from.bytes_field_);
+}
+
+void RepeatedWellKnownTypes::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protobuf_unittest.RepeatedWellKnownTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void RepeatedWellKnownTypes::CopyFrom(const RepeatedWellKnownTypes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.RepeatedWellKnownTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RepeatedWellKnownTypes::IsInitialized() const {
+  return true;
+}
+
+void RepeatedWellKnownTypes::InternalSwap(RepeatedWellKnownTypes* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  any_field_.InternalSwap(&other->any_field_);
+  api_field_.InternalSwap(&other->api_field_);
+  duration_field_.InternalSwap(&other->duration_field_);
+  empty_field_.InternalSwap(&other->empty_field_);
+  field_mask_field_.InternalSwap(&other->field_mask_field_);
+  source_context_field_.InternalSwap(&other->source_context_field_);
+  struct_field_.InternalSwap(&other->struct_field_);
+  timestamp_field_.InternalSwap(&other->timestamp_field_);
+  type_field_.InternalSwap(&other->type_field_);
+  double_field_.InternalSwap(&other->double_field_);
+  float_field_.InternalSwap(&other->float_field_);
+  int64_field_.InternalSwap(&other->int64_field_);
+  uint64_field_.InternalSwap(&other->uint64_field_);
+  int32_field_.InternalSwap(&other->int32_field_);
+  uint32_field_.InternalSwap(&other->uint32_field_);
+  bool_field_.InternalSwap(&other->bool_field_);
+  string_field_.InternalSwap(&other->string_field_);
+  bytes_field_.InternalSwap(&other->bytes_field_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RepeatedWellKnownTypes::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void OneofWellKnownTypes::InitAsDefaultInstance() {
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.any_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Any*>(
+      PROTOBUF_NAMESPACE_ID::Any::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.api_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Api*>(
+      PROTOBUF_NAMESPACE_ID::Api::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.duration_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Duration*>(
+      PROTOBUF_NAMESPACE_ID::Duration::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.empty_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Empty*>(
+      PROTOBUF_NAMESPACE_ID::Empty::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.field_mask_field_ = const_cast< PROTOBUF_NAMESPACE_ID::FieldMask*>(
+      PROTOBUF_NAMESPACE_ID::FieldMask::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.source_context_field_ = const_cast< PROTOBUF_NAMESPACE_ID::SourceContext*>(
+      PROTOBUF_NAMESPACE_ID::SourceContext::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.struct_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Struct*>(
+      PROTOBUF_NAMESPACE_ID::Struct::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.timestamp_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Timestamp*>(
+      PROTOBUF_NAMESPACE_ID::Timestamp::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.type_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Type*>(
+      PROTOBUF_NAMESPACE_ID::Type::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.double_field_ = const_cast< PROTOBUF_NAMESPACE_ID::DoubleValue*>(
+      PROTOBUF_NAMESPACE_ID::DoubleValue::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.float_field_ = const_cast< PROTOBUF_NAMESPACE_ID::FloatValue*>(
+      PROTOBUF_NAMESPACE_ID::FloatValue::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.int64_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Int64Value*>(
+      PROTOBUF_NAMESPACE_ID::Int64Value::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.uint64_field_ = const_cast< PROTOBUF_NAMESPACE_ID::UInt64Value*>(
+      PROTOBUF_NAMESPACE_ID::UInt64Value::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.int32_field_ = const_cast< PROTOBUF_NAMESPACE_ID::Int32Value*>(
+      PROTOBUF_NAMESPACE_ID::Int32Value::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.uint32_field_ = const_cast< PROTOBUF_NAMESPACE_ID::UInt32Value*>(
+      PROTOBUF_NAMESPACE_ID::UInt32Value::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.bool_field_ = const_cast< PROTOBUF_NAMESPACE_ID::BoolValue*>(
+      PROTOBUF_NAMESPACE_ID::BoolValue::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.string_field_ = const_cast< PROTOBUF_NAMESPACE_ID::StringValue*>(
+      PROTOBUF_NAMESPACE_ID::StringValue::internal_default_instance());
+  ::protobuf_unittest::_OneofWellKnownTypes_default_instance_.bytes_field_ = const_cast< PROTOBUF_NAMESPACE_ID::BytesValue*>(
+      PROTOBUF_NAMESPACE_ID::BytesValue::internal_default_instance());
+}
+class OneofWellKnownTypes::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Any& any_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Api& api_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Duration& duration_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Empty& empty_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::FieldMask& field_mask_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::SourceContext& source_context_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Struct& struct_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Timestamp& timestamp_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Type& type_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::DoubleValue& double_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::FloatValue& float_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Int64Value& int64_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::UInt64Value& uint64_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::Int32Value& int32_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::UInt32Value& uint32_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::BoolValue& bool_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::StringValue& string_field(const OneofWellKnownTypes* msg);
+  static const PROTOBUF_NAMESPACE_ID::BytesValue& bytes_field(const OneofWellKnownTypes* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Any&
+OneofWellKnownTypes::_Internal::any_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.any_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Api&
+OneofWellKnownTypes::_Internal::api_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.api_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Duration&
+OneofWellKnownTypes::_Internal::duration_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.duration_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Empty&
+OneofWellKnownTypes::_Internal::empty_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.empty_field_;
+}
+const PROTOBUF_NAMESPACE_ID::FieldMask&
+OneofWellKnownTypes::_Internal::field_mask_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.field_mask_field_;
+}
+const PROTOBUF_NAMESPACE_ID::SourceContext&
+OneofWellKnownTypes::_Internal::source_context_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.source_context_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Struct&
+OneofWellKnownTypes::_Internal::struct_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.struct_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Timestamp&
+OneofWellKnownTypes::_Internal::timestamp_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.timestamp_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Type&
+OneofWellKnownTypes::_Internal::type_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.type_field_;
+}
+const PROTOBUF_NAMESPACE_ID::DoubleValue&
+OneofWellKnownTypes::_Internal::double_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.double_field_;
+}
+const PROTOBUF_NAMESPACE_ID::FloatValue&
+OneofWellKnownTypes::_Internal::float_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.float_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Int64Value&
+OneofWellKnownTypes::_Internal::int64_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.int64_field_;
+}
+const PROTOBUF_NAMESPACE_ID::UInt64Value&
+OneofWellKnownTypes::_Internal::uint64_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.uint64_field_;
+}
+const PROTOBUF_NAMESPACE_ID::Int32Value&
+OneofWellKnownTypes::_Internal::int32_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.int32_field_;
+}
+const PROTOBUF_NAMESPACE_ID::UInt32Value&
+OneofWellKnownTypes::_Internal::uint32_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.uint32_field_;
+}
+const PROTOBUF_NAMESPACE_ID::BoolValue&
+OneofWellKnownTypes::_Internal::bool_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.bool_field_;
+}
+const PROTOBUF_NAMESPACE_ID::StringValue&
+OneofWellKnownTypes::_Internal::string_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.string_field_;
+}
+const PROTOBUF_NAMESPACE_ID::BytesValue&
+OneofWellKnownTypes::_Internal::bytes_field(const OneofWellKnownTypes* msg) {
+  return *msg->oneof_field_.bytes_field_;
+}
+void OneofWellKnownTypes::set_allocated_any_field(PROTOBUF_NAMESPACE_ID::Any* any_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (any_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      any_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_field, submessage_arena);
+    }
+    set_has_any_field();
+    oneof_field_.any_field_ = any_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.any_field)
+}
+void OneofWellKnownTypes::clear_any_field() {
+  if (_internal_has_any_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.any_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_api_field(PROTOBUF_NAMESPACE_ID::Api* api_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (api_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(api_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      api_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, api_field, submessage_arena);
+    }
+    set_has_api_field();
+    oneof_field_.api_field_ = api_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.api_field)
+}
+void OneofWellKnownTypes::clear_api_field() {
+  if (_internal_has_api_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.api_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_duration_field(PROTOBUF_NAMESPACE_ID::Duration* duration_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (duration_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      duration_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, duration_field, submessage_arena);
+    }
+    set_has_duration_field();
+    oneof_field_.duration_field_ = duration_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.duration_field)
+}
+void OneofWellKnownTypes::clear_duration_field() {
+  if (_internal_has_duration_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.duration_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_empty_field(PROTOBUF_NAMESPACE_ID::Empty* empty_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (empty_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(empty_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      empty_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, empty_field, submessage_arena);
+    }
+    set_has_empty_field();
+    oneof_field_.empty_field_ = empty_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.empty_field)
+}
+void OneofWellKnownTypes::clear_empty_field() {
+  if (_internal_has_empty_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.empty_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_field_mask_field(PROTOBUF_NAMESPACE_ID::FieldMask* field_mask_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (field_mask_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(field_mask_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      field_mask_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, field_mask_field, submessage_arena);
+    }
+    set_has_field_mask_field();
+    oneof_field_.field_mask_field_ = field_mask_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.field_mask_field)
+}
+void OneofWellKnownTypes::clear_field_mask_field() {
+  if (_internal_has_field_mask_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.field_mask_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_source_context_field(PROTOBUF_NAMESPACE_ID::SourceContext* source_context_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (source_context_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(source_context_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      source_context_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, source_context_field, submessage_arena);
+    }
+    set_has_source_context_field();
+    oneof_field_.source_context_field_ = source_context_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.source_context_field)
+}
+void OneofWellKnownTypes::clear_source_context_field() {
+  if (_internal_has_source_context_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.source_context_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_struct_field(PROTOBUF_NAMESPACE_ID::Struct* struct_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (struct_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(struct_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      struct_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, struct_field, submessage_arena);
+    }
+    set_has_struct_field();
+    oneof_field_.struct_field_ = struct_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.struct_field)
+}
+void OneofWellKnownTypes::clear_struct_field() {
+  if (_internal_has_struct_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.struct_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_timestamp_field(PROTOBUF_NAMESPACE_ID::Timestamp* timestamp_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (timestamp_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      timestamp_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timestamp_field, submessage_arena);
+    }
+    set_has_timestamp_field();
+    oneof_field_.timestamp_field_ = timestamp_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.timestamp_field)
+}
+void OneofWellKnownTypes::clear_timestamp_field() {
+  if (_internal_has_timestamp_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.timestamp_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_type_field(PROTOBUF_NAMESPACE_ID::Type* type_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (type_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(type_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      type_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, type_field, submessage_arena);
+    }
+    set_has_type_field();
+    oneof_field_.type_field_ = type_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.type_field)
+}
+void OneofWellKnownTypes::clear_type_field() {
+  if (_internal_has_type_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.type_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_double_field(PROTOBUF_NAMESPACE_ID::DoubleValue* double_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (double_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(double_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      double_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, double_field, submessage_arena);
+    }
+    set_has_double_field();
+    oneof_field_.double_field_ = double_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.double_field)
+}
+void OneofWellKnownTypes::clear_double_field() {
+  if (_internal_has_double_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.double_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_float_field(PROTOBUF_NAMESPACE_ID::FloatValue* float_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (float_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(float_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      float_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, float_field, submessage_arena);
+    }
+    set_has_float_field();
+    oneof_field_.float_field_ = float_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.float_field)
+}
+void OneofWellKnownTypes::clear_float_field() {
+  if (_internal_has_float_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.float_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_int64_field(PROTOBUF_NAMESPACE_ID::Int64Value* int64_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (int64_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(int64_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      int64_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, int64_field, submessage_arena);
+    }
+    set_has_int64_field();
+    oneof_field_.int64_field_ = int64_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.int64_field)
+}
+void OneofWellKnownTypes::clear_int64_field() {
+  if (_internal_has_int64_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.int64_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_uint64_field(PROTOBUF_NAMESPACE_ID::UInt64Value* uint64_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (uint64_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(uint64_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      uint64_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, uint64_field, submessage_arena);
+    }
+    set_has_uint64_field();
+    oneof_field_.uint64_field_ = uint64_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.uint64_field)
+}
+void OneofWellKnownTypes::clear_uint64_field() {
+  if (_internal_has_uint64_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.uint64_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_int32_field(PROTOBUF_NAMESPACE_ID::Int32Value* int32_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (int32_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(int32_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      int32_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, int32_field, submessage_arena);
+    }
+    set_has_int32_field();
+    oneof_field_.int32_field_ = int32_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.int32_field)
+}
+void OneofWellKnownTypes::clear_int32_field() {
+  if (_internal_has_int32_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.int32_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_uint32_field(PROTOBUF_NAMESPACE_ID::UInt32Value* uint32_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (uint32_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(uint32_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      uint32_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, uint32_field, submessage_arena);
+    }
+    set_has_uint32_field();
+    oneof_field_.uint32_field_ = uint32_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.uint32_field)
+}
+void OneofWellKnownTypes::clear_uint32_field() {
+  if (_internal_has_uint32_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.uint32_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_bool_field(PROTOBUF_NAMESPACE_ID::BoolValue* bool_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (bool_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bool_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      bool_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bool_field, submessage_arena);
+    }
+    set_has_bool_field();
+    oneof_field_.bool_field_ = bool_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.bool_field)
+}
+void OneofWellKnownTypes::clear_bool_field() {
+  if (_internal_has_bool_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.bool_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_string_field(PROTOBUF_NAMESPACE_ID::StringValue* string_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (string_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(string_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      string_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, string_field, submessage_arena);
+    }
+    set_has_string_field();
+    oneof_field_.string_field_ = string_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.string_field)
+}
+void OneofWellKnownTypes::clear_string_field() {
+  if (_internal_has_string_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.string_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+void OneofWellKnownTypes::set_allocated_bytes_field(PROTOBUF_NAMESPACE_ID::BytesValue* bytes_field) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_field();
+  if (bytes_field) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bytes_field)->GetArena();
+    if (message_arena != submessage_arena) {
+      bytes_field = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bytes_field, submessage_arena);
+    }
+    set_has_bytes_field();
+    oneof_field_.bytes_field_ = bytes_field;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.OneofWellKnownTypes.bytes_field)
+}
+void OneofWellKnownTypes::clear_bytes_field() {
+  if (_internal_has_bytes_field()) {
+    if (GetArena() == nullptr) {
+      delete oneof_field_.bytes_field_;
+    }
+    clear_has_oneof_field();
+  }
+}
+OneofWellKnownTypes::OneofWellKnownTypes(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.OneofWellKnownTypes)
+}
+OneofWellKnownTypes::OneofWellKnownTypes(const OneofWellKnownTypes& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_oneof_field();
+  switch (from.oneof_field_case()) {
+    case kAnyField: {
+      _internal_mutable_any_field()->PROTOBUF_NAMESPACE_ID::Any::MergeFrom(from._internal_any_field());
+      break;
+    }
+    case kApiField: {
+      _internal_mutable_api_field()->PROTOBUF_NAMESPACE_ID::Api::MergeFrom(from._internal_api_field());
+      break;
+    }
+    case kDurationField: {
+      _internal_mutable_duration_field()->PROTOBUF_NAMESPACE_ID::Duration::MergeFrom(from._internal_duration_field());
+      break;
+    }
+    case kEmptyField: {
+      _internal_mutable_empty_field()->PROTOBUF_NAMESPACE_ID::Empty::MergeFrom(from._internal_empty_field());
+      break;
+    }
+    case kFieldMaskField: {
+      _internal_mutable_field_mask_field()->PROTOBUF_NAMESPACE_ID::FieldMask::MergeFrom(from._internal_field_mask_field());
+      break;
+    }
+    case kSourceContextField: {
+      _internal_mutable_source_context_field()->PROTOBUF_NAMESPACE_ID::SourceContext::MergeFrom(from._internal_source_context_field());
+      break;
+    }
+    case kStructField: {
+      _internal_mutable_struct_field()->PROTOBUF_NAMESPACE_ID::Struct::MergeFrom(from._internal_struct_field());
+      break;
+    }
+    case kTimestampField: {
+      _internal_mutable_timestamp_field()->PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(from._internal_timestamp_field());
+      break;
+    }
+    case kTypeField: {
+      _internal_mutable_type_field()->PROTOBUF_NAMESPACE_ID::Type::MergeFrom(from._internal_type_field());
+      break;
+    }
+    case kDoubleField: {
+      _internal_mutable_double_field()->PROTOBUF_NAMESPACE_ID::DoubleValue::MergeFrom(from._internal_double_field());
+      break;
+    }
+    case kFloatField: {
+      _internal_mutable_float_field()->PROTOBUF_NAMESPACE_ID::FloatValue::MergeFrom(from._internal_float_field());
+      break;
+    }
+    case kInt64Field: {
+      _internal_mutable_int64_field()->PROTOBUF_NAMESPACE_ID::Int64Value::MergeFrom(from._internal_int64_field());
+      break;
+    }
+    case kUint64Field: {
+      _internal_mutable_uint64_field()->PROTOBUF_NAMESPACE_ID::UInt64Value::MergeFrom(from._internal_uint64_field());
+      break;
+    }
+    case kInt32Field: {
+      _internal_mutable_int32_field()->PROTOBUF_NAMESPACE_ID::Int32Value::MergeFrom(from._internal_int32_field());
+      break;
+    }
+    case kUint32Field: {
+      _internal_mutable_uint32_field()->PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(from._internal_uint32_field());
+      break;
+    }
+    case kBoolField: {
+      _internal_mutable_bool_field()->PROTOBUF_NAMESPACE_ID::BoolValue::MergeFrom(from._internal_bool_field());
+      break;
+    }
+    case kStringField: {
+      _internal_mutable_string_field()->PROTOBUF_NAMESPACE_ID::StringValue::MergeFrom(from._internal_string_field());
+      break;
+    }
+    case kBytesField: {
+      _internal_mutable_bytes_field()->PROTOBUF_NAMESPACE_ID::BytesValue::MergeFrom(from._internal_bytes_field());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.OneofWellKnownTypes)
+}
+
+void OneofWellKnownTypes::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_OneofWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base);
+  clear_has_oneof_field();
+}
+
+OneofWellKnownTypes::~OneofWellKnownTypes() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.OneofWellKnownTypes)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void OneofWellKnownTypes::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (has_oneof_field()) {
+    clear_oneof_field();
+  }
+}
+
+void OneofWellKnownTypes::ArenaDtor(void* object) {
+  OneofWellKnownTypes* _this = reinterpret_cast< OneofWellKnownTypes* >(object);
+  (void)_this;
+}
+void OneofWellKnownTypes::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void OneofWellKnownTypes::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const OneofWellKnownTypes& OneofWellKnownTypes::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_OneofWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void OneofWellKnownTypes::clear_oneof_field() {
+// @@protoc_insertion_point(one_of_clear_start:protobuf_unittest.OneofWellKnownTypes)
+  switch (oneof_field_case()) {
+    case kAnyField: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.any_field_;
+      }
+      break;
+    }
+    case kApiField: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.api_field_;
+      }
+      break;
+    }
+    case kDurationField: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.duration_field_;
+      }
+      break;
+    }
+    case kEmptyField: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.empty_field_;
+      }
+      break;
+    }
+    case kFieldMaskField: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.field_mask_field_;
+      }
+      break;
+    }
+    case kSourceContextField: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.source_context_field_;
+      }
+      break;
+    }
+    case kStructField: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.struct_field_;
+      }
+      break;
+    }
+    case kTimestampField: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.timestamp_field_;
+      }
+      break;
+    }
+    case kTypeField: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.type_field_;
+      }
+      break;
+    }
+    case kDoubleField: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.double_field_;
+      }
+      break;
+    }
+    case kFloatField: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.float_field_;
+      }
+      break;
+    }
+    case kInt64Field: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.int64_field_;
+      }
+      break;
+    }
+    case kUint64Field: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.uint64_field_;
+      }
+      break;
+    }
+    case kInt32Field: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.int32_field_;
+      }
+      break;
+    }
+    case kUint32Field: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.uint32_field_;
+      }
+      break;
+    }
+    case kBoolField: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.bool_field_;
+      }
+      break;
+    }
+    case kStringField: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.string_field_;
+      }
+      break;
+    }
+    case kBytesField: {
+      if (GetArena() == nullptr) {
+        delete oneof_field_.bytes_field_;
+      }
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = ONEOF_FIELD_NOT_SET;
+}
+
+
+void OneofWellKnownTypes::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.OneofWellKnownTypes)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_oneof_field();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OneofWellKnownTypes::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Any any_field = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Api api_field = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_api_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Duration duration_field = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_duration_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Empty empty_field = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_empty_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.FieldMask field_mask_field = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_field_mask_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.SourceContext source_context_field = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_source_context_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Struct struct_field = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_struct_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Timestamp timestamp_field = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_timestamp_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Type type_field = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_type_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.DoubleValue double_field = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_double_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.FloatValue float_field = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_float_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Int64Value int64_field = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_int64_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.UInt64Value uint64_field = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_uint64_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Int32Value int32_field = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_int32_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.UInt32Value uint32_field = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_uint32_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.BoolValue bool_field = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bool_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.StringValue string_field = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_string_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.BytesValue bytes_field = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bytes_field(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* OneofWellKnownTypes::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.OneofWellKnownTypes)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Any any_field = 1;
+  if (_internal_has_any_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::any_field(this), target, stream);
+  }
+
+  // .google.protobuf.Api api_field = 2;
+  if (_internal_has_api_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::api_field(this), target, stream);
+  }
+
+  // .google.protobuf.Duration duration_field = 3;
+  if (_internal_has_duration_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::duration_field(this), target, stream);
+  }
+
+  // .google.protobuf.Empty empty_field = 4;
+  if (_internal_has_empty_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::empty_field(this), target, stream);
+  }
+
+  // .google.protobuf.FieldMask field_mask_field = 5;
+  if (_internal_has_field_mask_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        5, _Internal::field_mask_field(this), target, stream);
+  }
+
+  // .google.protobuf.SourceContext source_context_field = 6;
+  if (_internal_has_source_context_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        6, _Internal::source_context_field(this), target, stream);
+  }
+
+  // .google.protobuf.Struct struct_field = 7;
+  if (_internal_has_struct_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        7, _Internal::struct_field(this), target, stream);
+  }
+
+  // .google.protobuf.Timestamp timestamp_field = 8;
+  if (_internal_has_timestamp_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        8, _Internal::timestamp_field(this), target, stream);
+  }
+
+  // .google.protobuf.Type type_field = 9;
+  if (_internal_has_type_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        9, _Internal::type_field(this), target, stream);
+  }
+
+  // .google.protobuf.DoubleValue double_field = 10;
+  if (_internal_has_double_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        10, _Internal::double_field(this), target, stream);
+  }
+
+  // .google.protobuf.FloatValue float_field = 11;
+  if (_internal_has_float_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        11, _Internal::float_field(this), target, stream);
+  }
+
+  // .google.protobuf.Int64Value int64_field = 12;
+  if (_internal_has_int64_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        12, _Internal::int64_field(this), target, stream);
+  }
+
+  // .google.protobuf.UInt64Value uint64_field = 13;
+  if (_internal_has_uint64_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        13, _Internal::uint64_field(this), target, stream);
+  }
+
+  // .google.protobuf.Int32Value int32_field = 14;
+  if (_internal_has_int32_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        14, _Internal::int32_field(this), target, stream);
+  }
+
+  // .google.protobuf.UInt32Value uint32_field = 15;
+  if (_internal_has_uint32_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        15, _Internal::uint32_field(this), target, stream);
+  }
+
+  // .google.protobuf.BoolValue bool_field = 16;
+  if (_internal_has_bool_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        16, _Internal::bool_field(this), target, stream);
+  }
+
+  // .google.protobuf.StringValue string_field = 17;
+  if (_internal_has_string_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        17, _Internal::string_field(this), target, stream);
+  }
+
+  // .google.protobuf.BytesValue bytes_field = 18;
+  if (_internal_has_bytes_field()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        18, _Internal::bytes_field(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.OneofWellKnownTypes)
+  return target;
+}
+
+size_t OneofWellKnownTypes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.OneofWellKnownTypes)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (oneof_field_case()) {
+    // .google.protobuf.Any any_field = 1;
+    case kAnyField: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.any_field_);
+      break;
+    }
+    // .google.protobuf.Api api_field = 2;
+    case kApiField: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.api_field_);
+      break;
+    }
+    // .google.protobuf.Duration duration_field = 3;
+    case kDurationField: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.duration_field_);
+      break;
+    }
+    // .google.protobuf.Empty empty_field = 4;
+    case kEmptyField: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.empty_field_);
+      break;
+    }
+    // .google.protobuf.FieldMask field_mask_field = 5;
+    case kFieldMaskField: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.field_mask_field_);
+      break;
+    }
+    // .google.protobuf.SourceContext source_context_field = 6;
+    case kSourceContextField: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.source_context_field_);
+      break;
+    }
+    // .google.protobuf.Struct struct_field = 7;
+    case kStructField: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.struct_field_);
+      break;
+    }
+    // .google.protobuf.Timestamp timestamp_field = 8;
+    case kTimestampField: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.timestamp_field_);
+      break;
+    }
+    // .google.protobuf.Type type_field = 9;
+    case kTypeField: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.type_field_);
+      break;
+    }
+    // .google.protobuf.DoubleValue double_field = 10;
+    case kDoubleField: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.double_field_);
+      break;
+    }
+    // .google.protobuf.FloatValue float_field = 11;
+    case kFloatField: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.float_field_);
+      break;
+    }
+    // .google.protobuf.Int64Value int64_field = 12;
+    case kInt64Field: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.int64_field_);
+      break;
+    }
+    // .google.protobuf.UInt64Value uint64_field = 13;
+    case kUint64Field: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.uint64_field_);
+      break;
+    }
+    // .google.protobuf.Int32Value int32_field = 14;
+    case kInt32Field: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.int32_field_);
+      break;
+    }
+    // .google.protobuf.UInt32Value uint32_field = 15;
+    case kUint32Field: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.uint32_field_);
+      break;
+    }
+    // .google.protobuf.BoolValue bool_field = 16;
+    case kBoolField: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.bool_field_);
+      break;
+    }
+    // .google.protobuf.StringValue string_field = 17;
+    case kStringField: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.string_field_);
+      break;
+    }
+    // .google.protobuf.BytesValue bytes_field = 18;
+    case kBytesField: {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_field_.bytes_field_);
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void OneofWellKnownTypes::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protobuf_unittest.OneofWellKnownTypes)
+  GOOGLE_DCHECK_NE(&from, this);
+  const OneofWellKnownTypes* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<OneofWellKnownTypes>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protobuf_unittest.OneofWellKnownTypes)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protobuf_unittest.OneofWellKnownTypes)
+    MergeFrom(*source);
+  }
+}
+
+void OneofWellKnownTypes::MergeFrom(const OneofWellKnownTypes& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.OneofWellKnownTypes)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.oneof_field_case()) {
+    case kAnyField: {
+      _internal_mutable_any_field()->PROTOBUF_NAMESPACE_ID::Any::MergeFrom(from._internal_any_field());
+      break;
+    }
+    case kApiField: {
+      _internal_mutable_api_field()->PROTOBUF_NAMESPACE_ID::Api::MergeFrom(from._internal_api_field());
+      break;
+    }
+    case kDurationField: {
+      _internal_mutable_duration_field()->PROTOBUF_NAMESPACE_ID::Duration::MergeFrom(from._internal_duration_field());
+      break;
+    }
+    case kEmptyField: {
+      _internal_mutable_empty_field()->PROTOBUF_NAMESPACE_ID::Empty::MergeFrom(from._internal_empty_field());
+      break;
+    }
+    case kFieldMaskField: {
+      _internal_mutable_field_mask_field()->PROTOBUF_NAMESPACE_ID::FieldMask::MergeFrom(from._internal_field_mask_field());
+      break;
+    }
+    case kSourceContextField: {
+      _internal_mutable_source_context_field()->PROTOBUF_NAMESPACE_ID::SourceContext::MergeFrom(from._internal_source_context_field());
+      break;
+    }
+    case kStructField: {
+      _internal_mutable_struct_field()->PROTOBUF_NAMESPACE_ID::Struct::MergeFrom(from._internal_struct_field());
+      break;
+    }
+    case kTimestampField: {
+      _internal_mutable_timestamp_field()->PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(from._internal_timestamp_field());
+      break;
+    }
+    case kTypeField: {
+      _internal_mutable_type_field()->PROTOBUF_NAMESPACE_ID::Type::MergeFrom(from._internal_type_field());
+      break;
+    }
+    case kDoubleField: {
+      _internal_mutable_double_field()->PROTOBUF_NAMESPACE_ID::DoubleValue::MergeFrom(from._internal_double_field());
+      break;
+    }
+    case kFloatField: {
+      _internal_mutable_float_field()->PROTOBUF_NAMESPACE_ID::FloatValue::MergeFrom(from._internal_float_field());
+      break;
+    }
+    case kInt64Field: {
+      _internal_mutable_int64_field()->PROTOBUF_NAMESPACE_ID::Int64Value::MergeFrom(from._internal_int64_field());
+      break;
+    }
+    case kUint64Field: {
+      _internal_mutable_uint64_field()->PROTOBUF_NAMESPACE_ID::UInt64Value::MergeFrom(from._internal_uint64_field());
+      break;
+    }
+    case kInt32Field: {
+      _internal_mutable_int32_field()->PROTOBUF_NAMESPACE_ID::Int32Value::MergeFrom(from._internal_int32_field());
+      break;
+    }
+    case kUint32Field: {
+      _internal_mutable_uint32_field()->PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(from._internal_uint32_field());
+      break;
+    }
+    case kBoolField: {
+      _internal_mutable_bool_field()->PROTOBUF_NAMESPACE_ID::BoolValue::MergeFrom(from._internal_bool_field());
+      break;
+    }
+    case kStringField: {
+      _internal_mutable_string_field()->PROTOBUF_NAMESPACE_ID::StringValue::MergeFrom(from._internal_string_field());
+      break;
+    }
+    case kBytesField: {
+      _internal_mutable_bytes_field()->PROTOBUF_NAMESPACE_ID::BytesValue::MergeFrom(from._internal_bytes_field());
+      break;
+    }
+    case ONEOF_FIELD_NOT_SET: {
+      break;
+    }
+  }
+}
+
+void OneofWellKnownTypes::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protobuf_unittest.OneofWellKnownTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void OneofWellKnownTypes::CopyFrom(const OneofWellKnownTypes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.OneofWellKnownTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OneofWellKnownTypes::IsInitialized() const {
+  return true;
+}
+
+void OneofWellKnownTypes::InternalSwap(OneofWellKnownTypes* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(oneof_field_, other->oneof_field_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OneofWellKnownTypes::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_AnyFieldEntry_DoNotUse::MapWellKnownTypes_AnyFieldEntry_DoNotUse() {}
+MapWellKnownTypes_AnyFieldEntry_DoNotUse::MapWellKnownTypes_AnyFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_AnyFieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_AnyFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_AnyFieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_AnyFieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_ApiFieldEntry_DoNotUse::MapWellKnownTypes_ApiFieldEntry_DoNotUse() {}
+MapWellKnownTypes_ApiFieldEntry_DoNotUse::MapWellKnownTypes_ApiFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_ApiFieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_ApiFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_ApiFieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_ApiFieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_DurationFieldEntry_DoNotUse::MapWellKnownTypes_DurationFieldEntry_DoNotUse() {}
+MapWellKnownTypes_DurationFieldEntry_DoNotUse::MapWellKnownTypes_DurationFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_DurationFieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_DurationFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_DurationFieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_DurationFieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_EmptyFieldEntry_DoNotUse::MapWellKnownTypes_EmptyFieldEntry_DoNotUse() {}
+MapWellKnownTypes_EmptyFieldEntry_DoNotUse::MapWellKnownTypes_EmptyFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_EmptyFieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_EmptyFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_EmptyFieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_EmptyFieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse() {}
+MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_SourceContextFieldEntry_DoNotUse::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse() {}
+MapWellKnownTypes_SourceContextFieldEntry_DoNotUse::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_SourceContextFieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_SourceContextFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_SourceContextFieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_SourceContextFieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_StructFieldEntry_DoNotUse::MapWellKnownTypes_StructFieldEntry_DoNotUse() {}
+MapWellKnownTypes_StructFieldEntry_DoNotUse::MapWellKnownTypes_StructFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_StructFieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_StructFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_StructFieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_StructFieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_TimestampFieldEntry_DoNotUse::MapWellKnownTypes_TimestampFieldEntry_DoNotUse() {}
+MapWellKnownTypes_TimestampFieldEntry_DoNotUse::MapWellKnownTypes_TimestampFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_TimestampFieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_TimestampFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_TimestampFieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_TimestampFieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_TypeFieldEntry_DoNotUse::MapWellKnownTypes_TypeFieldEntry_DoNotUse() {}
+MapWellKnownTypes_TypeFieldEntry_DoNotUse::MapWellKnownTypes_TypeFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_TypeFieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_TypeFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_TypeFieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_TypeFieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_DoubleFieldEntry_DoNotUse::MapWellKnownTypes_DoubleFieldEntry_DoNotUse() {}
+MapWellKnownTypes_DoubleFieldEntry_DoNotUse::MapWellKnownTypes_DoubleFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_DoubleFieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_DoubleFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_DoubleFieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_DoubleFieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_FloatFieldEntry_DoNotUse::MapWellKnownTypes_FloatFieldEntry_DoNotUse() {}
+MapWellKnownTypes_FloatFieldEntry_DoNotUse::MapWellKnownTypes_FloatFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_FloatFieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_FloatFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_FloatFieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_FloatFieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_Int64FieldEntry_DoNotUse::MapWellKnownTypes_Int64FieldEntry_DoNotUse() {}
+MapWellKnownTypes_Int64FieldEntry_DoNotUse::MapWellKnownTypes_Int64FieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_Int64FieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_Int64FieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_Int64FieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_Int64FieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_Uint64FieldEntry_DoNotUse::MapWellKnownTypes_Uint64FieldEntry_DoNotUse() {}
+MapWellKnownTypes_Uint64FieldEntry_DoNotUse::MapWellKnownTypes_Uint64FieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_Uint64FieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_Uint64FieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_Uint64FieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_Uint64FieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_Int32FieldEntry_DoNotUse::MapWellKnownTypes_Int32FieldEntry_DoNotUse() {}
+MapWellKnownTypes_Int32FieldEntry_DoNotUse::MapWellKnownTypes_Int32FieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_Int32FieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_Int32FieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_Int32FieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_Int32FieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_Uint32FieldEntry_DoNotUse::MapWellKnownTypes_Uint32FieldEntry_DoNotUse() {}
+MapWellKnownTypes_Uint32FieldEntry_DoNotUse::MapWellKnownTypes_Uint32FieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_Uint32FieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_Uint32FieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_Uint32FieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_Uint32FieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_BoolFieldEntry_DoNotUse::MapWellKnownTypes_BoolFieldEntry_DoNotUse() {}
+MapWellKnownTypes_BoolFieldEntry_DoNotUse::MapWellKnownTypes_BoolFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_BoolFieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_BoolFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_BoolFieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_BoolFieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_StringFieldEntry_DoNotUse::MapWellKnownTypes_StringFieldEntry_DoNotUse() {}
+MapWellKnownTypes_StringFieldEntry_DoNotUse::MapWellKnownTypes_StringFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_StringFieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_StringFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_StringFieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_StringFieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapWellKnownTypes_BytesFieldEntry_DoNotUse::MapWellKnownTypes_BytesFieldEntry_DoNotUse() {}
+MapWellKnownTypes_BytesFieldEntry_DoNotUse::MapWellKnownTypes_BytesFieldEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapWellKnownTypes_BytesFieldEntry_DoNotUse::MergeFrom(const MapWellKnownTypes_BytesFieldEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes_BytesFieldEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapWellKnownTypes_BytesFieldEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+void MapWellKnownTypes::InitAsDefaultInstance() {
+}
+class MapWellKnownTypes::_Internal {
+ public:
+};
+
+void MapWellKnownTypes::clear_any_field() {
+  any_field_.Clear();
+}
+void MapWellKnownTypes::clear_api_field() {
+  api_field_.Clear();
+}
+void MapWellKnownTypes::clear_duration_field() {
+  duration_field_.Clear();
+}
+void MapWellKnownTypes::clear_empty_field() {
+  empty_field_.Clear();
+}
+void MapWellKnownTypes::clear_field_mask_field() {
+  field_mask_field_.Clear();
+}
+void MapWellKnownTypes::clear_source_context_field() {
+  source_context_field_.Clear();
+}
+void MapWellKnownTypes::clear_struct_field() {
+  struct_field_.Clear();
+}
+void MapWellKnownTypes::clear_timestamp_field() {
+  timestamp_field_.Clear();
+}
+void MapWellKnownTypes::clear_type_field() {
+  type_field_.Clear();
+}
+void MapWellKnownTypes::clear_double_field() {
+  double_field_.Clear();
+}
+void MapWellKnownTypes::clear_float_field() {
+  float_field_.Clear();
+}
+void MapWellKnownTypes::clear_int64_field() {
+  int64_field_.Clear();
+}
+void MapWellKnownTypes::clear_uint64_field() {
+  uint64_field_.Clear();
+}
+void MapWellKnownTypes::clear_int32_field() {
+  int32_field_.Clear();
+}
+void MapWellKnownTypes::clear_uint32_field() {
+  uint32_field_.Clear();
+}
+void MapWellKnownTypes::clear_bool_field() {
+  bool_field_.Clear();
+}
+void MapWellKnownTypes::clear_string_field() {
+  string_field_.Clear();
+}
+void MapWellKnownTypes::clear_bytes_field() {
+  bytes_field_.Clear();
+}
+MapWellKnownTypes::MapWellKnownTypes(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  any_field_(arena),
+  api_field_(arena),
+  duration_field_(arena),
+  empty_field_(arena),
+  field_mask_field_(arena),
+  source_context_field_(arena),
+  struct_field_(arena),
+  timestamp_field_(arena),
+  type_field_(arena),
+  double_field_(arena),
+  float_field_(arena),
+  int64_field_(arena),
+  uint64_field_(arena),
+  int32_field_(arena),
+  uint32_field_(arena),
+  bool_field_(arena),
+  string_field_(arena),
+  bytes_field_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.MapWellKnownTypes)
+}
+MapWellKnownTypes::MapWellKnownTypes(const MapWellKnownTypes& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  any_field_.MergeFrom(from.any_field_);
+  api_field_.MergeFrom(from.api_field_);
+  duration_field_.MergeFrom(from.duration_field_);
+  empty_field_.MergeFrom(from.empty_field_);
+  field_mask_field_.MergeFrom(from.field_mask_field_);
+  source_context_field_.MergeFrom(from.source_context_field_);
+  struct_field_.MergeFrom(from.struct_field_);
+  timestamp_field_.MergeFrom(from.timestamp_field_);
+  type_field_.MergeFrom(from.type_field_);
+  double_field_.MergeFrom(from.double_field_);
+  float_field_.MergeFrom(from.float_field_);
+  int64_field_.MergeFrom(from.int64_field_);
+  uint64_field_.MergeFrom(from.uint64_field_);
+  int32_field_.MergeFrom(from.int32_field_);
+  uint32_field_.MergeFrom(from.uint32_field_);
+  bool_field_.MergeFrom(from.bool_field_);
+  string_field_.MergeFrom(from.string_field_);
+  bytes_field_.MergeFrom(from.bytes_field_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.MapWellKnownTypes)
+}
+
+void MapWellKnownTypes::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_MapWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base);
+}
+
+MapWellKnownTypes::~MapWellKnownTypes() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.MapWellKnownTypes)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void MapWellKnownTypes::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void MapWellKnownTypes::ArenaDtor(void* object) {
+  MapWellKnownTypes* _this = reinterpret_cast< MapWellKnownTypes* >(object);
+  (void)_this;
+}
+void MapWellKnownTypes::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void MapWellKnownTypes::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const MapWellKnownTypes& MapWellKnownTypes::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_MapWellKnownTypes_google_2fprotobuf_2funittest_5fwell_5fknown_5ftypes_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void MapWellKnownTypes::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.MapWellKnownTypes)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  any_field_.Clear();
+  api_field_.Clear();
+  duration_field_.Clear();
+  empty_field_.Clear();
+  field_mask_field_.Clear();
+  source_context_field_.Clear();
+  struct_field_.Clear();
+  timestamp_field_.Clear();
+  type_field_.Clear();
+  double_field_.Clear();
+  float_field_.Clear();
+  int64_field_.Clear();
+  uint64_field_.Clear();
+  int32_field_.Clear();
+  uint32_field_.Clear();
+  bool_field_.Clear();
+  string_field_.Clear();
+  bytes_field_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MapWellKnownTypes::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // map<int32, .google.protobuf.Any> any_field = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&any_field_,
+              ctx->CountLengthDelimited<10>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&any_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.Api> api_field = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&api_field_,
+              ctx->CountLengthDelimited<18>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&api_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.Duration> duration_field = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&duration_field_,
+              ctx->CountLengthDelimited<26>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&duration_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.Empty> empty_field = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&empty_field_,
+              ctx->CountLengthDelimited<34>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&empty_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.FieldMask> field_mask_field = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&field_mask_field_,
+              ctx->CountLengthDelimited<42>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&field_mask_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.SourceContext> source_context_field = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&source_context_field_,
+              ctx->CountLengthDelimited<50>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&source_context_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.Struct> struct_field = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&struct_field_,
+              ctx->CountLengthDelimited<58>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&struct_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.Timestamp> timestamp_field = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&timestamp_field_,
+              ctx->CountLengthDelimited<66>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&timestamp_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.Type> type_field = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&type_field_,
+              ctx->CountLengthDelimited<74>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&type_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.DoubleValue> double_field = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&double_field_,
+              ctx->CountLengthDelimited<82>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&double_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.FloatValue> float_field = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&float_field_,
+              ctx->CountLengthDelimited<90>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&float_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.Int64Value> int64_field = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&int64_field_,
+              ctx->CountLengthDelimited<98>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&int64_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.UInt64Value> uint64_field = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&uint64_field_,
+              ctx->CountLengthDelimited<106>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&uint64_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<106>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.Int32Value> int32_field = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&int32_field_,
+              ctx->CountLengthDelimited<114>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&int32_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<114>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.UInt32Value> uint32_field = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&uint32_field_,
+              ctx->CountLengthDelimited<122>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&uint32_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<122>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.BoolValue> bool_field = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 130)) {
+          ptr -= 2;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&bool_field_,
+              ctx->CountLengthDelimited<130>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(&bool_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<130>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.StringValue> string_field = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 138)) {
+          ptr -= 2;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&string_field_,
+              ctx->CountLengthDelimited<138>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(&string_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<138>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, .google.protobuf.BytesValue> bytes_field = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 146)) {
+          ptr -= 2;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&bytes_field_,
+              ctx->CountLengthDelimited<146>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(&bytes_field_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<146>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* MapWellKnownTypes::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.MapWellKnownTypes)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<int32, .google.protobuf.Any> any_field = 1;
+  if (!this->_internal_any_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Any >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_any_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_any_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Any >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Any >::const_iterator
+          it = this->_internal_any_field().begin();
+          it != this->_internal_any_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_AnyFieldEntry_DoNotUse::Funcs::InternalSerialize(1, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Any >::const_iterator
+          it = this->_internal_any_field().begin();
+          it != this->_internal_any_field().end(); ++it) {
+        target = MapWellKnownTypes_AnyFieldEntry_DoNotUse::Funcs::InternalSerialize(1, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Api> api_field = 2;
+  if (!this->_internal_api_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Api >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_api_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_api_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Api >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Api >::const_iterator
+          it = this->_internal_api_field().begin();
+          it != this->_internal_api_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_ApiFieldEntry_DoNotUse::Funcs::InternalSerialize(2, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Api >::const_iterator
+          it = this->_internal_api_field().begin();
+          it != this->_internal_api_field().end(); ++it) {
+        target = MapWellKnownTypes_ApiFieldEntry_DoNotUse::Funcs::InternalSerialize(2, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Duration> duration_field = 3;
+  if (!this->_internal_duration_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Duration >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_duration_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_duration_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Duration >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Duration >::const_iterator
+          it = this->_internal_duration_field().begin();
+          it != this->_internal_duration_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_DurationFieldEntry_DoNotUse::Funcs::InternalSerialize(3, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Duration >::const_iterator
+          it = this->_internal_duration_field().begin();
+          it != this->_internal_duration_field().end(); ++it) {
+        target = MapWellKnownTypes_DurationFieldEntry_DoNotUse::Funcs::InternalSerialize(3, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Empty> empty_field = 4;
+  if (!this->_internal_empty_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Empty >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_empty_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_empty_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Empty >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Empty >::const_iterator
+          it = this->_internal_empty_field().begin();
+          it != this->_internal_empty_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_EmptyFieldEntry_DoNotUse::Funcs::InternalSerialize(4, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Empty >::const_iterator
+          it = this->_internal_empty_field().begin();
+          it != this->_internal_empty_field().end(); ++it) {
+        target = MapWellKnownTypes_EmptyFieldEntry_DoNotUse::Funcs::InternalSerialize(4, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.FieldMask> field_mask_field = 5;
+  if (!this->_internal_field_mask_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FieldMask >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_field_mask_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_field_mask_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FieldMask >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FieldMask >::const_iterator
+          it = this->_internal_field_mask_field().begin();
+          it != this->_internal_field_mask_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse::Funcs::InternalSerialize(5, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FieldMask >::const_iterator
+          it = this->_internal_field_mask_field().begin();
+          it != this->_internal_field_mask_field().end(); ++it) {
+        target = MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse::Funcs::InternalSerialize(5, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.SourceContext> source_context_field = 6;
+  if (!this->_internal_source_context_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::SourceContext >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_source_context_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_source_context_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::SourceContext >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::SourceContext >::const_iterator
+          it = this->_internal_source_context_field().begin();
+          it != this->_internal_source_context_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_SourceContextFieldEntry_DoNotUse::Funcs::InternalSerialize(6, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::SourceContext >::const_iterator
+          it = this->_internal_source_context_field().begin();
+          it != this->_internal_source_context_field().end(); ++it) {
+        target = MapWellKnownTypes_SourceContextFieldEntry_DoNotUse::Funcs::InternalSerialize(6, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Struct> struct_field = 7;
+  if (!this->_internal_struct_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Struct >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_struct_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_struct_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Struct >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Struct >::const_iterator
+          it = this->_internal_struct_field().begin();
+          it != this->_internal_struct_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_StructFieldEntry_DoNotUse::Funcs::InternalSerialize(7, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Struct >::const_iterator
+          it = this->_internal_struct_field().begin();
+          it != this->_internal_struct_field().end(); ++it) {
+        target = MapWellKnownTypes_StructFieldEntry_DoNotUse::Funcs::InternalSerialize(7, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Timestamp> timestamp_field = 8;
+  if (!this->_internal_timestamp_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Timestamp >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_timestamp_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_timestamp_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Timestamp >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Timestamp >::const_iterator
+          it = this->_internal_timestamp_field().begin();
+          it != this->_internal_timestamp_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_TimestampFieldEntry_DoNotUse::Funcs::InternalSerialize(8, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Timestamp >::const_iterator
+          it = this->_internal_timestamp_field().begin();
+          it != this->_internal_timestamp_field().end(); ++it) {
+        target = MapWellKnownTypes_TimestampFieldEntry_DoNotUse::Funcs::InternalSerialize(8, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Type> type_field = 9;
+  if (!this->_internal_type_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Type >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_type_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_type_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Type >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Type >::const_iterator
+          it = this->_internal_type_field().begin();
+          it != this->_internal_type_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_TypeFieldEntry_DoNotUse::Funcs::InternalSerialize(9, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Type >::const_iterator
+          it = this->_internal_type_field().begin();
+          it != this->_internal_type_field().end(); ++it) {
+        target = MapWellKnownTypes_TypeFieldEntry_DoNotUse::Funcs::InternalSerialize(9, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.DoubleValue> double_field = 10;
+  if (!this->_internal_double_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::DoubleValue >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_double_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_double_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::DoubleValue >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::DoubleValue >::const_iterator
+          it = this->_internal_double_field().begin();
+          it != this->_internal_double_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_DoubleFieldEntry_DoNotUse::Funcs::InternalSerialize(10, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::DoubleValue >::const_iterator
+          it = this->_internal_double_field().begin();
+          it != this->_internal_double_field().end(); ++it) {
+        target = MapWellKnownTypes_DoubleFieldEntry_DoNotUse::Funcs::InternalSerialize(10, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.FloatValue> float_field = 11;
+  if (!this->_internal_float_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FloatValue >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_float_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_float_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FloatValue >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FloatValue >::const_iterator
+          it = this->_internal_float_field().begin();
+          it != this->_internal_float_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_FloatFieldEntry_DoNotUse::Funcs::InternalSerialize(11, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FloatValue >::const_iterator
+          it = this->_internal_float_field().begin();
+          it != this->_internal_float_field().end(); ++it) {
+        target = MapWellKnownTypes_FloatFieldEntry_DoNotUse::Funcs::InternalSerialize(11, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Int64Value> int64_field = 12;
+  if (!this->_internal_int64_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int64Value >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_int64_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_int64_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int64Value >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int64Value >::const_iterator
+          it = this->_internal_int64_field().begin();
+          it != this->_internal_int64_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_Int64FieldEntry_DoNotUse::Funcs::InternalSerialize(12, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int64Value >::const_iterator
+          it = this->_internal_int64_field().begin();
+          it != this->_internal_int64_field().end(); ++it) {
+        target = MapWellKnownTypes_Int64FieldEntry_DoNotUse::Funcs::InternalSerialize(12, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.UInt64Value> uint64_field = 13;
+  if (!this->_internal_uint64_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt64Value >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_uint64_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_uint64_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt64Value >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt64Value >::const_iterator
+          it = this->_internal_uint64_field().begin();
+          it != this->_internal_uint64_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_Uint64FieldEntry_DoNotUse::Funcs::InternalSerialize(13, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt64Value >::const_iterator
+          it = this->_internal_uint64_field().begin();
+          it != this->_internal_uint64_field().end(); ++it) {
+        target = MapWellKnownTypes_Uint64FieldEntry_DoNotUse::Funcs::InternalSerialize(13, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.Int32Value> int32_field = 14;
+  if (!this->_internal_int32_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int32Value >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_int32_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_int32_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int32Value >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int32Value >::const_iterator
+          it = this->_internal_int32_field().begin();
+          it != this->_internal_int32_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_Int32FieldEntry_DoNotUse::Funcs::InternalSerialize(14, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int32Value >::const_iterator
+          it = this->_internal_int32_field().begin();
+          it != this->_internal_int32_field().end(); ++it) {
+        target = MapWellKnownTypes_Int32FieldEntry_DoNotUse::Funcs::InternalSerialize(14, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.UInt32Value> uint32_field = 15;
+  if (!this->_internal_uint32_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt32Value >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_uint32_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_uint32_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt32Value >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt32Value >::const_iterator
+          it = this->_internal_uint32_field().begin();
+          it != this->_internal_uint32_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_Uint32FieldEntry_DoNotUse::Funcs::InternalSerialize(15, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt32Value >::const_iterator
+          it = this->_internal_uint32_field().begin();
+          it != this->_internal_uint32_field().end(); ++it) {
+        target = MapWellKnownTypes_Uint32FieldEntry_DoNotUse::Funcs::InternalSerialize(15, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.BoolValue> bool_field = 16;
+  if (!this->_internal_bool_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BoolValue >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_bool_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_bool_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BoolValue >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BoolValue >::const_iterator
+          it = this->_internal_bool_field().begin();
+          it != this->_internal_bool_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_BoolFieldEntry_DoNotUse::Funcs::InternalSerialize(16, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BoolValue >::const_iterator
+          it = this->_internal_bool_field().begin();
+          it != this->_internal_bool_field().end(); ++it) {
+        target = MapWellKnownTypes_BoolFieldEntry_DoNotUse::Funcs::InternalSerialize(16, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.StringValue> string_field = 17;
+  if (!this->_internal_string_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::StringValue >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_string_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_string_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::StringValue >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::StringValue >::const_iterator
+          it = this->_internal_string_field().begin();
+          it != this->_internal_string_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_StringFieldEntry_DoNotUse::Funcs::InternalSerialize(17, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::StringValue >::const_iterator
+          it = this->_internal_string_field().begin();
+          it != this->_internal_string_field().end(); ++it) {
+        target = MapWellKnownTypes_StringFieldEntry_DoNotUse::Funcs::InternalSerialize(17, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, .google.protobuf.BytesValue> bytes_field = 18;
+  if (!this->_internal_bytes_field().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BytesValue >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_bytes_field().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_bytes_field().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BytesValue >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BytesValue >::const_iterator
+          it = this->_internal_bytes_field().begin();
+          it != this->_internal_bytes_field().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapWellKnownTypes_BytesFieldEntry_DoNotUse::Funcs::InternalSerialize(18, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BytesValue >::const_iterator
+          it = this->_internal_bytes_field().begin();
+          it != this->_internal_bytes_field().end(); ++it) {
+        target = MapWellKnownTypes_BytesFieldEntry_DoNotUse::Funcs::InternalSerialize(18, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.MapWellKnownTypes)
+  return target;
+}
+
+size_t MapWellKnownTypes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.MapWellKnownTypes)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, .google.protobuf.Any> any_field = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_any_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Any >::const_iterator
+      it = this->_internal_any_field().begin();
+      it != this->_internal_any_field().end(); ++it) {
+    total_size += MapWellKnownTypes_AnyFieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.Api> api_field = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_api_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Api >::const_iterator
+      it = this->_internal_api_field().begin();
+      it != this->_internal_api_field().end(); ++it) {
+    total_size += MapWellKnownTypes_ApiFieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.Duration> duration_field = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_duration_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Duration >::const_iterator
+      it = this->_internal_duration_field().begin();
+      it != this->_internal_duration_field().end(); ++it) {
+    total_size += MapWellKnownTypes_DurationFieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.Empty> empty_field = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_empty_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Empty >::const_iterator
+      it = this->_internal_empty_field().begin();
+      it != this->_internal_empty_field().end(); ++it) {
+    total_size += MapWellKnownTypes_EmptyFieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.FieldMask> field_mask_field = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_field_mask_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FieldMask >::const_iterator
+      it = this->_internal_field_mask_field().begin();
+      it != this->_internal_field_mask_field().end(); ++it) {
+    total_size += MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.SourceContext> source_context_field = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_source_context_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::SourceContext >::const_iterator
+      it = this->_internal_source_context_field().begin();
+      it != this->_internal_source_context_field().end(); ++it) {
+    total_size += MapWellKnownTypes_SourceContextFieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.Struct> struct_field = 7;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_struct_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Struct >::const_iterator
+      it = this->_internal_struct_field().begin();
+      it != this->_internal_struct_field().end(); ++it) {
+    total_size += MapWellKnownTypes_StructFieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.Timestamp> timestamp_field = 8;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_timestamp_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Timestamp >::const_iterator
+      it = this->_internal_timestamp_field().begin();
+      it != this->_internal_timestamp_field().end(); ++it) {
+    total_size += MapWellKnownTypes_TimestampFieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.Type> type_field = 9;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_type_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Type >::const_iterator
+      it = this->_internal_type_field().begin();
+      it != this->_internal_type_field().end(); ++it) {
+    total_size += MapWellKnownTypes_TypeFieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.DoubleValue> double_field = 10;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_double_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::DoubleValue >::const_iterator
+      it = this->_internal_double_field().begin();
+      it != this->_internal_double_field().end(); ++it) {
+    total_size += MapWellKnownTypes_DoubleFieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.FloatValue> float_field = 11;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_float_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::FloatValue >::const_iterator
+      it = this->_internal_float_field().begin();
+      it != this->_internal_float_field().end(); ++it) {
+    total_size += MapWellKnownTypes_FloatFieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.Int64Value> int64_field = 12;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_int64_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int64Value >::const_iterator
+      it = this->_internal_int64_field().begin();
+      it != this->_internal_int64_field().end(); ++it) {
+    total_size += MapWellKnownTypes_Int64FieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.UInt64Value> uint64_field = 13;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_uint64_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt64Value >::const_iterator
+      it = this->_internal_uint64_field().begin();
+      it != this->_internal_uint64_field().end(); ++it) {
+    total_size += MapWellKnownTypes_Uint64FieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.Int32Value> int32_field = 14;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_int32_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::Int32Value >::const_iterator
+      it = this->_internal_int32_field().begin();
+      it != this->_internal_int32_field().end(); ++it) {
+    total_size += MapWellKnownTypes_Int32FieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.UInt32Value> uint32_field = 15;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_uint32_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::UInt32Value >::const_iterator
+      it = this->_internal_uint32_field().begin();
+      it != this->_internal_uint32_field().end(); ++it) {
+    total_size += MapWellKnownTypes_Uint32FieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.BoolValue> bool_field = 16;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_bool_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BoolValue >::const_iterator
+      it = this->_internal_bool_field().begin();
+      it != this->_internal_bool_field().end(); ++it) {
+    total_size += MapWellKnownTypes_BoolFieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.StringValue> string_field = 17;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_string_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::StringValue >::const_iterator
+      it = this->_internal_string_field().begin();
+      it != this->_internal_string_field().end(); ++it) {
+    total_size += MapWellKnownTypes_StringFieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, .google.protobuf.BytesValue> bytes_field = 18;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_bytes_field_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, PROTOBUF_NAMESPACE_ID::BytesValue >::const_iterator
+      it = this->_internal_bytes_field().begin();
+      it != this->_internal_bytes_field().end(); ++it) {
+    total_size += MapWellKnownTypes_BytesFieldEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void MapWellKnownTypes::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protobuf_unittest.MapWellKnownTypes)
+  GOOGLE_DCHECK_NE(&from, this);
+  const MapWellKnownTypes* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<MapWellKnownTypes>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protobuf_unittest.MapWellKnownTypes)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protobuf_unittest.MapWellKnownTypes)
+    MergeFrom(*source);
+  }
+}
+
+void MapWellKnownTypes::MergeFrom(const MapWellKnownTypes& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.MapWellKnownTypes)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  any_field_.MergeFrom(from.any_field_);
+  api_field_.MergeFrom(from.api_field_);
+  duration_field_.MergeFrom(from.duration_field_);
+  empty_field_.MergeFrom(from.empty_field_);
+  field_mask_field_.MergeFrom(from.field_mask_field_);
+  source_context_field_.MergeFrom(from.source_context_field_);
+  struct_field_.MergeFrom(from.struct_field_);
+  timestamp_field_.MergeFrom(from.timestamp_field_);
+  type_field_.MergeFrom(from.type_field_);
+  double_field_.MergeFrom(from.double_field_);
+  float_field_.MergeFrom(from.float_field_);
+  int64_field_.MergeFrom(from.int64_field_);
+  uint64_field_.MergeFrom(from.uint64_field_);
+  int32_field_.MergeFrom(from.int32_field_);
+  uint32_field_.MergeFrom(from.uint32_field_);
+  bool_field_.MergeFrom(from.bool_field_);
+  string_field_.MergeFrom(from.string_field_);
+  bytes_field_.MergeFrom(from.bytes_field_);
+}
+
+void MapWellKnownTypes::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protobuf_unittest.MapWellKnownTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void MapWellKnownTypes::CopyFrom(const MapWellKnownTypes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.MapWellKnownTypes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MapWellKnownTypes::IsInitialized() const {
+  return true;
+}
+
+void MapWellKnownTypes::InternalSwap(MapWellKnownTypes* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  any_field_.Swap(&other->any_field_);
+  api_field_.Swap(&other->api_field_);
+  duration_field_.Swap(&other->duration_field_);
+  empty_field_.Swap(&other->empty_field_);
+  field_mask_field_.Swap(&other->field_mask_field_);
+  source_context_field_.Swap(&other->source_context_field_);
+  struct_field_.Swap(&other->struct_field_);
+  timestamp_field_.Swap(&other->timestamp_field_);
+  type_field_.Swap(&other->type_field_);
+  double_field_.Swap(&other->double_field_);
+  float_field_.Swap(&other->float_field_);
+  int64_field_.Swap(&other->int64_field_);
+  uint64_field_.Swap(&other->uint64_field_);
+  int32_field_.Swap(&other->int32_field_);
+  uint32_field_.Swap(&other->uint32_field_);
+  bool_field_.Swap(&other->bool_field_);
+  string_field_.Swap(&other->string_field_);
+  bytes_field_.Swap(&other->bytes_field_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MapWellKnownTypes::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace protobuf_unittest
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::TestWellKnownTypes* Arena::CreateMaybeMessage< ::protobuf_unittest::TestWellKnownTypes >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::TestWellKnownTypes >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::RepeatedWellKnownTypes* Arena::CreateMaybeMessage< ::protobuf_unittest::RepeatedWellKnownTypes >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::RepeatedWellKnownTypes >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::OneofWellKnownTypes* Arena::CreateMaybeMessage< ::protobuf_unittest::OneofWellKnownTypes >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::OneofWellKnownTypes >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_AnyFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_ApiFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_DurationFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_EmptyFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_FieldMaskFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_SourceContextFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_StructFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_TimestampFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_TypeFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_DoubleFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_FloatFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_Int64FieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_Uint64FieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_Int32FieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_Uint32FieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_BoolFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_StringFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes_BytesFieldEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protobuf_unittest::MapWellKnownTypes* Arena::CreateMaybeMessage< ::protobuf_unittest::MapWellKnownTypes >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protobuf_unittest::MapWellKnownTypes >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
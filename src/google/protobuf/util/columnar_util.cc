@@ -0,0 +1,335 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/util/columnar_util.h>
+
+#include <cstring>
+#include <memory>
+
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/util/delimited_message_util.h>
+
+#include <google/protobuf/port_def.inc>
+
+namespace google {
+namespace protobuf {
+namespace util {
+
+namespace {
+
+const uint32 kNoHasBit = static_cast<uint32>(-1);
+
+int ValueSize(FieldDescriptor::CppType type) {
+  switch (type) {
+    case FieldDescriptor::CPPTYPE_INT32:
+    case FieldDescriptor::CPPTYPE_ENUM:
+      return sizeof(int32);
+    case FieldDescriptor::CPPTYPE_INT64:
+      return sizeof(int64);
+    case FieldDescriptor::CPPTYPE_UINT32:
+      return sizeof(uint32);
+    case FieldDescriptor::CPPTYPE_UINT64:
+      return sizeof(uint64);
+    case FieldDescriptor::CPPTYPE_DOUBLE:
+      return sizeof(double);
+    case FieldDescriptor::CPPTYPE_FLOAT:
+      return sizeof(float);
+    case FieldDescriptor::CPPTYPE_BOOL:
+      return sizeof(bool);
+    default:
+      return 0;
+  }
+}
+
+template <typename T>
+inline void AppendValue(std::vector<char>* values, T value) {
+  size_t size = values->size();
+  values->resize(size + sizeof(T));
+  memcpy(values->data() + size, &value, sizeof(T));
+}
+
+template <typename T>
+inline T ValueAt(const std::vector<char>& values, int row) {
+  T value;
+  memcpy(&value, values.data() + row * sizeof(T), sizeof(T));
+  return value;
+}
+
+}  // namespace
+
+const ColumnarBatch::Column* ColumnarBatch::FindColumn(
+    const FieldDescriptor* field) const {
+  for (const Column& column : columns_) {
+    if (column.field_ == field) return &column;
+  }
+  return NULL;
+}
+
+void ColumnarBatch::Clear() {
+  num_rows_ = 0;
+  columns_.clear();
+}
+
+ColumnarConverter::ColumnarConverter(const Message& prototype)
+    : prototype_(&prototype),
+      descriptor_(prototype.GetDescriptor()),
+      reflection_(prototype.GetReflection()) {
+  const internal::ReflectionSchema& schema = reflection_->schema_;
+  has_bits_offset_ =
+      schema.HasHasbits() ? static_cast<int>(schema.HasBitsOffset()) : -1;
+  for (int i = 0; i < descriptor_->field_count(); i++) {
+    const FieldDescriptor* field = descriptor_->field(i);
+    if (field->is_repeated() ||
+        field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE ||
+        schema.IsFieldStripped(field)) {
+      continue;
+    }
+    FieldPlan plan;
+    plan.field = field;
+    plan.cpp_type = field->cpp_type();
+    plan.offset = schema.GetFieldOffset(field);
+    plan.in_oneof = schema.InRealOneof(field);
+    plan.has_bit_index = plan.in_oneof ? kNoHasBit : schema.HasBitIndex(field);
+    plan.oneof_case_offset =
+        plan.in_oneof ? schema.GetOneofCaseOffset(field->containing_oneof())
+                      : 0;
+    plan.inlined = schema.IsFieldInlined(field);
+    plan.default_string = NULL;
+    if (plan.cpp_type == FieldDescriptor::CPPTYPE_STRING && !plan.in_oneof) {
+      const void* default_value = schema.GetFieldDefault(field);
+      plan.default_string =
+          plan.inlined
+              ? &static_cast<const internal::InlinedStringField*>(
+                     default_value)
+                     ->GetNoArena()
+              : &static_cast<const internal::ArenaStringPtr*>(default_value)
+                     ->Get();
+    }
+    plan_.push_back(plan);
+  }
+}
+
+void ColumnarConverter::InitColumns(ColumnarBatch* batch) const {
+  GOOGLE_DCHECK_EQ(batch->num_rows_, 0);
+  batch->columns_.resize(plan_.size());
+  for (size_t i = 0; i < plan_.size(); i++) {
+    ColumnarBatch::Column& column = batch->columns_[i];
+    column.field_ = plan_[i].field;
+    column.value_size_ = ValueSize(plan_[i].cpp_type);
+    if (column.value_size_ == 0) column.offsets_.push_back(0);
+  }
+}
+
+void ColumnarConverter::Reserve(ColumnarBatch* batch, int rows) const {
+  if (batch->columns_.empty()) InitColumns(batch);
+  const size_t total = batch->num_rows_ + rows;
+  for (ColumnarBatch::Column& column : batch->columns_) {
+    column.validity_.reserve((total + 7) / 8);
+    if (column.value_size_ != 0) {
+      column.values_.reserve(total * column.value_size_);
+    } else {
+      column.offsets_.reserve(total + 1);
+    }
+  }
+}
+
+void ColumnarConverter::AppendRow(const Message& row,
+                                  ColumnarBatch* batch) const {
+  GOOGLE_DCHECK_EQ(row.GetReflection(), reflection_);
+  if (batch->columns_.empty()) InitColumns(batch);
+  GOOGLE_DCHECK_EQ(batch->columns_.size(), plan_.size());
+  const int index = batch->num_rows_++;
+  const char* base = reinterpret_cast<const char*>(&row);
+  const uint32* has_bits =
+      has_bits_offset_ == -1
+          ? NULL
+          : reinterpret_cast<const uint32*>(base + has_bits_offset_);
+
+  for (size_t i = 0; i < plan_.size(); i++) {
+    const FieldPlan& plan = plan_[i];
+    ColumnarBatch::Column& column = batch->columns_[i];
+    // value is NULL if the field is a oneof member that is not set, in which
+    // case its memory belongs to another member.
+    const char* value = base + plan.offset;
+    bool valid = true;
+    bool has_presence = true;
+    if (plan.in_oneof) {
+      valid = *reinterpret_cast<const uint32*>(base + plan.oneof_case_offset) ==
+              static_cast<uint32>(plan.field->number());
+      if (!valid) value = NULL;
+    } else if (plan.has_bit_index != kNoHasBit) {
+      valid = (has_bits[plan.has_bit_index / 32] >>
+               (plan.has_bit_index % 32)) & 1;
+    } else {
+      has_presence = false;
+    }
+
+    switch (plan.cpp_type) {
+#define HANDLE_TYPE(CPPTYPE, TYPE, DEFAULT)                            \
+  case FieldDescriptor::CPPTYPE_##CPPTYPE: {                           \
+    TYPE v = value != NULL ? *reinterpret_cast<const TYPE*>(value)     \
+                           : static_cast<TYPE>(plan.field->DEFAULT()); \
+    if (!has_presence) valid = v != 0;                                 \
+    AppendValue(&column.values_, v);                                   \
+    break;                                                             \
+  }
+
+      HANDLE_TYPE(INT32, int32, default_value_int32)
+      HANDLE_TYPE(INT64, int64, default_value_int64)
+      HANDLE_TYPE(UINT32, uint32, default_value_uint32)
+      HANDLE_TYPE(UINT64, uint64, default_value_uint64)
+      HANDLE_TYPE(DOUBLE, double, default_value_double)
+      HANDLE_TYPE(FLOAT, float, default_value_float)
+      HANDLE_TYPE(BOOL, bool, default_value_bool)
+#undef HANDLE_TYPE
+
+      case FieldDescriptor::CPPTYPE_ENUM: {
+        int32 v = value != NULL ? *reinterpret_cast<const int32*>(value)
+                                : plan.field->default_value_enum()->number();
+        if (!has_presence) valid = v != 0;
+        AppendValue(&column.values_, v);
+        break;
+      }
+
+      case FieldDescriptor::CPPTYPE_STRING: {
+        const std::string* s = NULL;
+        if (value == NULL) {
+          // Not set; the column holds "" like the other unset rows.
+        } else if (plan.inlined) {
+          s = &reinterpret_cast<const internal::InlinedStringField*>(value)
+                   ->GetNoArena();
+        } else {
+          s = &reinterpret_cast<const internal::ArenaStringPtr*>(value)->Get();
+        }
+        if (s != NULL && valid) {
+          column.string_data_.append(*s);
+        }
+        if (!has_presence) valid = s != NULL && !s->empty();
+        column.offsets_.push_back(
+            static_cast<uint32>(column.string_data_.size()));
+        break;
+      }
+
+      default:
+        GOOGLE_LOG(FATAL) << "Unexpected field type";
+    }
+
+    if (index % 8 == 0) column.validity_.push_back(0);
+    if (valid) column.validity_.back() |= static_cast<uint8>(1 << (index % 8));
+  }
+}
+
+bool ColumnarConverter::AppendDelimitedRows(io::ZeroCopyInputStream* input,
+                                            ColumnarBatch* batch) const {
+  std::unique_ptr<Message> row(prototype_->New());
+  while (true) {
+    bool clean_eof;
+    row->Clear();
+    if (!ParseDelimitedFromZeroCopyStream(row.get(), input, &clean_eof)) {
+      return clean_eof;
+    }
+    AppendRow(*row, batch);
+  }
+}
+
+void ColumnarConverter::GetRow(const ColumnarBatch& batch, int row,
+                               Message* message) const {
+  GOOGLE_DCHECK_EQ(message->GetReflection(), reflection_);
+  GOOGLE_DCHECK_EQ(batch.columns_.size(), plan_.size());
+  GOOGLE_DCHECK_LT(row, batch.num_rows_);
+  char* base = reinterpret_cast<char*>(message);
+  uint32* has_bits = has_bits_offset_ == -1
+                         ? NULL
+                         : reinterpret_cast<uint32*>(base + has_bits_offset_);
+  Arena* arena = message->GetArena();
+
+  for (size_t i = 0; i < plan_.size(); i++) {
+    const FieldPlan& plan = plan_[i];
+    const ColumnarBatch::Column& column = batch.columns_[i];
+    GOOGLE_DCHECK_EQ(column.field_, plan.field);
+    if (!column.IsValid(row)) continue;
+
+    if (plan.in_oneof) {
+      // Setting a oneof member may have to clear another one first, which is
+      // left to reflection.
+      const FieldDescriptor* field = plan.field;
+      switch (plan.cpp_type) {
+#define HANDLE_TYPE(CPPTYPE, TYPE, METHOD)                                 \
+  case FieldDescriptor::CPPTYPE_##CPPTYPE:                                 \
+    reflection_->Set##METHOD(message, field,                               \
+                             ValueAt<TYPE>(column.values_, row));          \
+    break;
+
+        HANDLE_TYPE(INT32, int32, Int32)
+        HANDLE_TYPE(INT64, int64, Int64)
+        HANDLE_TYPE(UINT32, uint32, UInt32)
+        HANDLE_TYPE(UINT64, uint64, UInt64)
+        HANDLE_TYPE(DOUBLE, double, Double)
+        HANDLE_TYPE(FLOAT, float, Float)
+        HANDLE_TYPE(BOOL, bool, Bool)
+        HANDLE_TYPE(ENUM, int32, EnumValue)
+#undef HANDLE_TYPE
+
+        case FieldDescriptor::CPPTYPE_STRING:
+          reflection_->SetString(message, field,
+                                 std::string(column.GetString(row)));
+          break;
+
+        default:
+          GOOGLE_LOG(FATAL) << "Unexpected field type";
+      }
+      continue;
+    }
+
+    char* value = base + plan.offset;
+    if (plan.cpp_type == FieldDescriptor::CPPTYPE_STRING) {
+      StringPiece s = column.GetString(row);
+      if (plan.inlined) {
+        reinterpret_cast<internal::InlinedStringField*>(value)->SetNoArena(
+            plan.default_string, s);
+      } else {
+        reinterpret_cast<internal::ArenaStringPtr*>(value)->Set(
+            plan.default_string, std::string(s.data(), s.size()), arena);
+      }
+    } else {
+      memcpy(value, column.values_.data() + row * column.value_size_,
+             column.value_size_);
+    }
+    if (plan.has_bit_index != kNoHasBit) {
+      has_bits[plan.has_bit_index / 32] |= 1u << (plan.has_bit_index % 32);
+    }
+  }
+}
+
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
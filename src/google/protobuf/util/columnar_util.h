@@ -0,0 +1,220 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Utilities for converting repeated messages to and from columnar
+// (struct-of-arrays) form, as used by analytics code that processes one field
+// of many rows at a time.
+//
+// ColumnarConverter compiles a plan from the reflection schema of a message
+// type once: the offset, has-bit and oneof case of every convertible field.
+// Rows are then read and written through these offsets directly, without the
+// virtual Reflection calls a field-by-field loop would make.
+//
+// Example:
+//   ColumnarConverter converter(Row::default_instance());
+//   ColumnarBatch batch;
+//   converter.AppendRows(table.rows(), &batch);
+//   const ColumnarBatch::Column& price = batch.column(0);
+//   for (int i = 0; i < batch.num_rows(); i++) {
+//     if (price.IsValid(i)) total += price.values<double>()[i];
+//   }
+
+#ifndef GOOGLE_PROTOBUF_UTIL_COLUMNAR_UTIL_H__
+#define GOOGLE_PROTOBUF_UTIL_COLUMNAR_UTIL_H__
+
+#include <string>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/logging.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>
+#include <google/protobuf/stubs/strutil.h>
+
+#include <google/protobuf/port_def.inc>
+
+namespace google {
+namespace protobuf {
+namespace io {
+class ZeroCopyInputStream;  // zero_copy_stream.h
+}  // namespace io
+
+namespace util {
+
+class ColumnarConverter;
+
+// A batch of rows in columnar form.  It has one column for every field the
+// ColumnarConverter that filled it supports, in field declaration order.
+class PROTOBUF_EXPORT ColumnarBatch {
+ public:
+  // The values of one field in all rows.
+  class PROTOBUF_EXPORT Column {
+   public:
+    const FieldDescriptor* field() const { return field_; }
+
+    // Whether the field is set in the given row.  Fields without presence
+    // (proto3 scalars) count as set when they differ from zero or "".
+    bool IsValid(int row) const {
+      return (validity_[row >> 3] >> (row & 7)) & 1;
+    }
+    // Bitmap of valid rows, with row i at bit (i % 8) of byte (i / 8).
+    const uint8* validity_bitmap() const { return validity_.data(); }
+
+    // Values of fixed-width fields, one per row; rows in which the field is
+    // not set hold its default value.  T must be the field's C++ type (int32
+    // for enums).
+    template <typename T>
+    const T* values() const {
+      GOOGLE_DCHECK(field_->cpp_type() != FieldDescriptor::CPPTYPE_STRING);
+      GOOGLE_DCHECK_EQ(sizeof(T), value_size_);
+      return reinterpret_cast<const T*>(values_.data());
+    }
+
+    // Values of string and bytes fields: row i holds the bytes of
+    // string_data() between offsets()[i] and offsets()[i + 1].
+    const uint32* offsets() const { return offsets_.data(); }
+    const char* string_data() const { return string_data_.data(); }
+    StringPiece GetString(int row) const {
+      return StringPiece(string_data_.data() + offsets_[row],
+                         offsets_[row + 1] - offsets_[row]);
+    }
+
+   private:
+    friend class ColumnarBatch;
+    friend class ColumnarConverter;
+
+    const FieldDescriptor* field_;
+    int value_size_;  // 0 for strings.
+    std::vector<uint8> validity_;
+    std::vector<char> values_;
+    std::vector<uint32> offsets_;
+    std::string string_data_;
+  };
+
+  ColumnarBatch() : num_rows_(0) {}
+
+  int num_rows() const { return num_rows_; }
+  int num_columns() const { return static_cast<int>(columns_.size()); }
+  const Column& column(int index) const { return columns_[index]; }
+  // Returns the column of the given field, or NULL if there is none.
+  const Column* FindColumn(const FieldDescriptor* field) const;
+
+  // Removes all rows and columns.
+  void Clear();
+
+ private:
+  friend class ColumnarConverter;
+
+  int num_rows_;
+  std::vector<Column> columns_;
+};
+
+// Converts between messages of one type and ColumnarBatch.  All singular
+// fields of numeric, bool, enum, string and bytes type, including oneof
+// members, become columns; repeated, map and message fields are skipped.
+//
+// A converter is immutable once constructed and may be shared between
+// threads.
+class PROTOBUF_EXPORT ColumnarConverter {
+ public:
+  // Compiles the plan for messages of the same type as prototype, which is
+  // typically the default instance of a generated message or a prototype
+  // from DynamicMessageFactory, and must outlive the converter.
+  explicit ColumnarConverter(const Message& prototype);
+
+  const Descriptor* descriptor() const { return descriptor_; }
+  // The fields that become columns, in column order.
+  int num_columns() const { return static_cast<int>(plan_.size()); }
+  const FieldDescriptor* column_field(int index) const {
+    return plan_[index].field;
+  }
+
+  // Appends a row to batch, which must be empty or only have been filled by
+  // converters for the same type.
+  void AppendRow(const Message& row, ColumnarBatch* batch) const;
+
+  template <typename Msg>
+  void AppendRows(const RepeatedPtrField<Msg>& rows,
+                  ColumnarBatch* batch) const {
+    Reserve(batch, rows.size());
+    for (const Msg& row : rows) AppendRow(row, batch);
+  }
+
+  // Reads size-delimited messages (see delimited_message_util.h) from input
+  // until it ends and appends them to batch.  Returns false if a message
+  // fails to parse; the rows before it are kept.
+  bool AppendDelimitedRows(io::ZeroCopyInputStream* input,
+                           ColumnarBatch* batch) const;
+
+  // Sets the fields of message, which should be empty, to the values of the
+  // given row of batch.  Fields without a valid value are left alone.
+  void GetRow(const ColumnarBatch& batch, int row, Message* message) const;
+
+  // Appends one message per row of batch to rows.
+  template <typename Msg>
+  void ToRows(const ColumnarBatch& batch, RepeatedPtrField<Msg>* rows) const {
+    rows->Reserve(rows->size() + batch.num_rows());
+    for (int i = 0; i < batch.num_rows(); i++) GetRow(batch, i, rows->Add());
+  }
+
+ private:
+  // How one field is read and written.
+  struct FieldPlan {
+    const FieldDescriptor* field;
+    FieldDescriptor::CppType cpp_type;
+    uint32 offset;
+    uint32 has_bit_index;      // static_cast<uint32>(-1) if none.
+    uint32 oneof_case_offset;  // Only for fields in a real oneof.
+    bool in_oneof;
+    bool inlined;  // For strings: InlinedStringField, not ArenaStringPtr.
+    // For strings outside of oneofs: the default the field points to.
+    const std::string* default_string;
+  };
+
+  void Reserve(ColumnarBatch* batch, int rows) const;
+  void InitColumns(ColumnarBatch* batch) const;
+
+  const Message* prototype_;
+  const Descriptor* descriptor_;
+  const Reflection* reflection_;
+  int has_bits_offset_;  // -1 if the message has no has-bits.
+  std::vector<FieldPlan> plan_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ColumnarConverter);
+};
+
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
+
+#include <google/protobuf/port_undef.inc>
+
+#endif  // GOOGLE_PROTOBUF_UTIL_COLUMNAR_UTIL_H__
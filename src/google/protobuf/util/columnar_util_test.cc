@@ -0,0 +1,267 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/util/columnar_util.h>
+
+#include <memory>
+#include <string>
+
+#include <google/protobuf/unittest.pb.h>
+#include <google/protobuf/unittest_proto3.pb.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/util/delimited_message_util.h>
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace util {
+namespace {
+
+using protobuf_unittest::TestAllTypes;
+
+const ColumnarBatch::Column& GetColumn(const ColumnarBatch& batch,
+                                       const Descriptor* descriptor,
+                                       const std::string& name) {
+  const FieldDescriptor* field = descriptor->FindFieldByName(name);
+  GOOGLE_CHECK(field != NULL) << name;
+  const ColumnarBatch::Column* column = batch.FindColumn(field);
+  GOOGLE_CHECK(column != NULL) << name;
+  return *column;
+}
+
+void FillRows(RepeatedPtrField<TestAllTypes>* rows) {
+  TestAllTypes* row = rows->Add();
+  row->set_optional_int32(1);
+  row->set_optional_double(1.5);
+  row->set_optional_bool(true);
+  row->set_optional_string("a");
+  row->set_default_string("x");
+  row->set_optional_nested_enum(TestAllTypes::BAZ);
+  row->set_oneof_uint32(7);
+
+  rows->Add();
+
+  row = rows->Add();
+  row->set_optional_int64(-5);
+  row->set_optional_bytes(std::string("\0z", 2));
+  row->set_oneof_string("b");
+}
+
+TEST(ColumnarUtilTest, Columns) {
+  RepeatedPtrField<TestAllTypes> rows;
+  FillRows(&rows);
+  ColumnarConverter converter(TestAllTypes::default_instance());
+  ColumnarBatch batch;
+  converter.AppendRows(rows, &batch);
+  const Descriptor* descriptor = TestAllTypes::descriptor();
+  EXPECT_EQ(3, batch.num_rows());
+  EXPECT_EQ(converter.num_columns(), batch.num_columns());
+
+  const ColumnarBatch::Column& int32_column =
+      GetColumn(batch, descriptor, "optional_int32");
+  EXPECT_TRUE(int32_column.IsValid(0));
+  EXPECT_FALSE(int32_column.IsValid(1));
+  EXPECT_FALSE(int32_column.IsValid(2));
+  EXPECT_EQ(1, int32_column.values<int32>()[0]);
+  EXPECT_EQ(0, int32_column.values<int32>()[1]);
+
+  const ColumnarBatch::Column& int64_column =
+      GetColumn(batch, descriptor, "optional_int64");
+  EXPECT_TRUE(int64_column.IsValid(2));
+  EXPECT_EQ(-5, int64_column.values<int64>()[2]);
+
+  const ColumnarBatch::Column& double_column =
+      GetColumn(batch, descriptor, "optional_double");
+  EXPECT_EQ(1.5, double_column.values<double>()[0]);
+  const ColumnarBatch::Column& bool_column =
+      GetColumn(batch, descriptor, "optional_bool");
+  EXPECT_TRUE(bool_column.values<bool>()[0]);
+  EXPECT_FALSE(bool_column.values<bool>()[1]);
+  const ColumnarBatch::Column& enum_column =
+      GetColumn(batch, descriptor, "optional_nested_enum");
+  EXPECT_EQ(TestAllTypes::BAZ, enum_column.values<int32>()[0]);
+  EXPECT_EQ(TestAllTypes::FOO, enum_column.values<int32>()[1]);
+
+  // Unset rows hold the field's default.
+  const ColumnarBatch::Column& default_int32_column =
+      GetColumn(batch, descriptor, "default_int32");
+  EXPECT_FALSE(default_int32_column.IsValid(0));
+  EXPECT_EQ(41, default_int32_column.values<int32>()[0]);
+
+  const ColumnarBatch::Column& string_column =
+      GetColumn(batch, descriptor, "optional_string");
+  EXPECT_TRUE(string_column.IsValid(0));
+  EXPECT_FALSE(string_column.IsValid(1));
+  EXPECT_EQ("a", string_column.GetString(0));
+  EXPECT_EQ("", string_column.GetString(1));
+  EXPECT_EQ("", string_column.GetString(2));
+  EXPECT_EQ(0u, string_column.offsets()[0]);
+  EXPECT_EQ(1u, string_column.offsets()[3]);
+  const ColumnarBatch::Column& bytes_column =
+      GetColumn(batch, descriptor, "optional_bytes");
+  EXPECT_EQ(std::string("\0z", 2), bytes_column.GetString(2));
+
+  const ColumnarBatch::Column& oneof_uint32_column =
+      GetColumn(batch, descriptor, "oneof_uint32");
+  EXPECT_TRUE(oneof_uint32_column.IsValid(0));
+  EXPECT_FALSE(oneof_uint32_column.IsValid(2));
+  EXPECT_EQ(7u, oneof_uint32_column.values<uint32>()[0]);
+  EXPECT_EQ(0u, oneof_uint32_column.values<uint32>()[2]);
+  const ColumnarBatch::Column& oneof_string_column =
+      GetColumn(batch, descriptor, "oneof_string");
+  EXPECT_FALSE(oneof_string_column.IsValid(0));
+  EXPECT_TRUE(oneof_string_column.IsValid(2));
+  EXPECT_EQ("b", oneof_string_column.GetString(2));
+
+  // Repeated and message fields are not converted.
+  EXPECT_TRUE(batch.FindColumn(descriptor->FindFieldByName(
+                  "repeated_int32")) == NULL);
+  EXPECT_TRUE(batch.FindColumn(descriptor->FindFieldByName(
+                  "optional_nested_message")) == NULL);
+}
+
+TEST(ColumnarUtilTest, RoundTrip) {
+  RepeatedPtrField<TestAllTypes> rows;
+  FillRows(&rows);
+  ColumnarConverter converter(TestAllTypes::default_instance());
+  ColumnarBatch batch;
+  converter.AppendRows(rows, &batch);
+
+  RepeatedPtrField<TestAllTypes> result;
+  converter.ToRows(batch, &result);
+  ASSERT_EQ(rows.size(), result.size());
+  for (int i = 0; i < rows.size(); i++) {
+    EXPECT_TRUE(MessageDifferencer::Equals(rows.Get(i), result.Get(i)))
+        << result.Get(i).DebugString();
+  }
+  // Strings with non-empty defaults must not have been written through the
+  // default instance.
+  EXPECT_EQ("hello", TestAllTypes::default_instance().default_string());
+  EXPECT_EQ("hello", result.Get(1).default_string());
+}
+
+TEST(ColumnarUtilTest, RoundTripOnArena) {
+  RepeatedPtrField<TestAllTypes> rows;
+  FillRows(&rows);
+  ColumnarConverter converter(TestAllTypes::default_instance());
+  ColumnarBatch batch;
+  converter.AppendRows(rows, &batch);
+
+  Arena arena;
+  for (int i = 0; i < rows.size(); i++) {
+    TestAllTypes* message = Arena::CreateMessage<TestAllTypes>(&arena);
+    converter.GetRow(batch, i, message);
+    EXPECT_TRUE(MessageDifferencer::Equals(rows.Get(i), *message));
+  }
+}
+
+TEST(ColumnarUtilTest, Proto3FieldsWithoutPresence) {
+  RepeatedPtrField<proto3_unittest::TestAllTypes> rows;
+  rows.Add()->set_optional_int32(0);
+  rows.Add()->set_optional_int32(3);
+  rows.Mutable(1)->set_optional_string("c");
+  ColumnarConverter converter(
+      proto3_unittest::TestAllTypes::default_instance());
+  ColumnarBatch batch;
+  converter.AppendRows(rows, &batch);
+
+  const Descriptor* descriptor = proto3_unittest::TestAllTypes::descriptor();
+  const ColumnarBatch::Column& int32_column =
+      GetColumn(batch, descriptor, "optional_int32");
+  EXPECT_FALSE(int32_column.IsValid(0));
+  EXPECT_TRUE(int32_column.IsValid(1));
+  EXPECT_EQ(3, int32_column.values<int32>()[1]);
+  const ColumnarBatch::Column& string_column =
+      GetColumn(batch, descriptor, "optional_string");
+  EXPECT_FALSE(string_column.IsValid(0));
+  EXPECT_TRUE(string_column.IsValid(1));
+
+  RepeatedPtrField<proto3_unittest::TestAllTypes> result;
+  converter.ToRows(batch, &result);
+  ASSERT_EQ(2, result.size());
+  EXPECT_TRUE(MessageDifferencer::Equals(rows.Get(1), result.Get(1)));
+}
+
+TEST(ColumnarUtilTest, DelimitedRows) {
+  RepeatedPtrField<TestAllTypes> rows;
+  FillRows(&rows);
+  std::string data;
+  {
+    io::StringOutputStream output(&data);
+    for (const TestAllTypes& row : rows) {
+      ASSERT_TRUE(SerializeDelimitedToZeroCopyStream(row, &output));
+    }
+  }
+
+  ColumnarConverter converter(TestAllTypes::default_instance());
+  ColumnarBatch batch;
+  io::ArrayInputStream input(data.data(), data.size());
+  EXPECT_TRUE(converter.AppendDelimitedRows(&input, &batch));
+  ASSERT_EQ(3, batch.num_rows());
+  EXPECT_EQ("a", GetColumn(batch, TestAllTypes::descriptor(),
+                           "optional_string").GetString(0));
+
+  // A truncated last message is an error, but the rows before it are kept.
+  batch.Clear();
+  io::ArrayInputStream truncated(data.data(), data.size() - 1);
+  EXPECT_FALSE(converter.AppendDelimitedRows(&truncated, &batch));
+  EXPECT_EQ(2, batch.num_rows());
+}
+
+TEST(ColumnarUtilTest, DynamicMessage) {
+  DynamicMessageFactory factory;
+  const Message* prototype = factory.GetPrototype(TestAllTypes::descriptor());
+  RepeatedPtrField<TestAllTypes> rows;
+  FillRows(&rows);
+  std::unique_ptr<Message> row(prototype->New());
+  ColumnarConverter converter(*prototype);
+  ColumnarBatch batch;
+  for (const TestAllTypes& generated_row : rows) {
+    row->ParseFromString(generated_row.SerializeAsString());
+    converter.AppendRow(*row, &batch);
+  }
+  EXPECT_EQ("b", GetColumn(batch, TestAllTypes::descriptor(), "oneof_string")
+                     .GetString(2));
+  EXPECT_EQ(-5, GetColumn(batch, TestAllTypes::descriptor(), "optional_int64")
+                    .values<int64>()[2]);
+
+  for (int i = 0; i < rows.size(); i++) {
+    row->Clear();
+    converter.GetRow(batch, i, row.get());
+    EXPECT_EQ(rows.Get(i).SerializeAsString(), row->SerializeAsString());
+  }
+}
+
+}  // namespace
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
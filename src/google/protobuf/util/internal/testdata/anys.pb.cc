@@ -0,0 +1,3575 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/internal/testdata/anys.proto
+
+#include "google/protobuf/util/internal/testdata/anys.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fany_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Any_google_2fprotobuf_2fany_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DoubleValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fduration_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Duration_google_2fprotobuf_2fduration_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Int32Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2ftimestamp_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_AnyWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Data_MapDataEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+namespace proto_util_converter {
+namespace testing {
+class AnyTestCasesDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AnyTestCases> _instance;
+} _AnyTestCases_default_instance_;
+class AnyWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AnyWrapper> _instance;
+} _AnyWrapper_default_instance_;
+class ImportsDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Imports> _instance;
+} _Imports_default_instance_;
+class Data_MapDataEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Data_MapDataEntry_DoNotUse> _instance;
+} _Data_MapDataEntry_DoNotUse_default_instance_;
+class DataDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Data> _instance;
+} _Data_default_instance_;
+class AnyInDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AnyIn> _instance;
+} _AnyIn_default_instance_;
+class AnyOutDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AnyOut> _instance;
+} _AnyOut_default_instance_;
+class AnyMDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AnyM> _instance;
+} _AnyM_default_instance_;
+}  // namespace testing
+}  // namespace proto_util_converter
+static void InitDefaultsscc_info_AnyIn_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_AnyIn_default_instance_;
+    new (ptr) ::proto_util_converter::testing::AnyIn();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::AnyIn::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_AnyIn_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_AnyIn_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto}, {
+      &scc_info_Any_google_2fprotobuf_2fany_2eproto.base,}};
+
+static void InitDefaultsscc_info_AnyM_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_AnyM_default_instance_;
+    new (ptr) ::proto_util_converter::testing::AnyM();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::AnyM::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AnyM_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_AnyM_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto}, {}};
+
+static void InitDefaultsscc_info_AnyOut_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_AnyOut_default_instance_;
+    new (ptr) ::proto_util_converter::testing::AnyOut();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::AnyOut::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_AnyOut_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_AnyOut_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto}, {
+      &scc_info_Any_google_2fprotobuf_2fany_2eproto.base,}};
+
+static void InitDefaultsscc_info_AnyTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_AnyTestCases_default_instance_;
+    new (ptr) ::proto_util_converter::testing::AnyTestCases();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::AnyTestCases::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_AnyTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_AnyTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto}, {
+      &scc_info_AnyWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base,
+      &scc_info_Any_google_2fprotobuf_2fany_2eproto.base,}};
+
+static void InitDefaultsscc_info_AnyWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_AnyWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::AnyWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::AnyWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_AnyWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_AnyWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto}, {
+      &scc_info_Any_google_2fprotobuf_2fany_2eproto.base,}};
+
+static void InitDefaultsscc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_Data_default_instance_;
+    new (ptr) ::proto_util_converter::testing::Data();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::Data::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 5, 0, InitDefaultsscc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto}, {
+      &scc_info_Int32Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto.base,
+      &scc_info_Data_MapDataEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base,
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,
+      &scc_info_Any_google_2fprotobuf_2fany_2eproto.base,}};
+
+static void InitDefaultsscc_info_Data_MapDataEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_Data_MapDataEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto_util_converter::testing::Data_MapDataEntry_DoNotUse();
+  }
+  ::proto_util_converter::testing::Data_MapDataEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Data_MapDataEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Data_MapDataEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto}, {}};
+
+static void InitDefaultsscc_info_Imports_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_Imports_default_instance_;
+    new (ptr) ::proto_util_converter::testing::Imports();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::Imports::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_Imports_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 6, 0, InitDefaultsscc_info_Imports_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto}, {
+      &scc_info_DoubleValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,
+      &scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto.base,
+      &scc_info_Duration_google_2fprotobuf_2fduration_2eproto.base,
+      &scc_info_Int32Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base,}};
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto[8];
+static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto = nullptr;
+
+const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, empty_any_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, type_only_any_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, wrapper_any_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, any_with_timestamp_value_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, any_with_duration_value_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, any_with_struct_value_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, recursive_any_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, any_with_message_value_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, any_with_nested_message_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, any_with_message_with_wrapper_type_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, any_with_message_with_timestamp_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, any_with_message_containing_map_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, any_with_message_containing_struct_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, any_with_message_containing_repeated_message_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, recursive_any_with_type_field_at_end_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, repeated_any_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, empty_any_with_null_type_url_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, top_level_any_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, top_level_any_with_type_field_at_end_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, top_level_any_with_pivot_one_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, top_level_any_with_pivot_two_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyTestCases, top_level_any_unordered_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyWrapper, any_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Imports, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Imports, dbl_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Imports, struct__),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Imports, timestamp_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Imports, duration_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Imports, i32_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Imports, data_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Data_MapDataEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Data_MapDataEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Data_MapDataEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Data_MapDataEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Data, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Data, attr_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Data, str_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Data, msgs_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Data, nested_data_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Data, int_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Data, time_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Data, map_data_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Data, struct_data_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Data, repeated_data_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Data, repeated_any_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyIn, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyIn, something_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyIn, any_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyOut, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyOut, any_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyM, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::AnyM, foo_),
+};
+static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, sizeof(::proto_util_converter::testing::AnyTestCases)},
+  { 27, -1, sizeof(::proto_util_converter::testing::AnyWrapper)},
+  { 33, -1, sizeof(::proto_util_converter::testing::Imports)},
+  { 44, 51, sizeof(::proto_util_converter::testing::Data_MapDataEntry_DoNotUse)},
+  { 53, -1, sizeof(::proto_util_converter::testing::Data)},
+  { 68, -1, sizeof(::proto_util_converter::testing::AnyIn)},
+  { 75, -1, sizeof(::proto_util_converter::testing::AnyOut)},
+  { 81, -1, sizeof(::proto_util_converter::testing::AnyM)},
+};
+
+static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_AnyTestCases_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_AnyWrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_Imports_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_Data_MapDataEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_Data_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_AnyIn_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_AnyOut_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_AnyM_default_instance_),
+};
+
+const char descriptor_table_protodef_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n1google/protobuf/util/internal/testdata"
+  "/anys.proto\022\034proto_util_converter.testin"
+  "g\032\031google/protobuf/any.proto\032\036google/pro"
+  "tobuf/duration.proto\032\034google/protobuf/st"
+  "ruct.proto\032\037google/protobuf/timestamp.pr"
+  "oto\032\036google/protobuf/wrappers.proto\"\273\014\n\014"
+  "AnyTestCases\022;\n\tempty_any\030\001 \001(\0132(.proto_"
+  "util_converter.testing.AnyWrapper\022\?\n\rtyp"
+  "e_only_any\030\002 \001(\0132(.proto_util_converter."
+  "testing.AnyWrapper\022=\n\013wrapper_any\030\003 \001(\0132"
+  "(.proto_util_converter.testing.AnyWrappe"
+  "r\022J\n\030any_with_timestamp_value\030\004 \001(\0132(.pr"
+  "oto_util_converter.testing.AnyWrapper\022I\n"
+  "\027any_with_duration_value\030\005 \001(\0132(.proto_u"
+  "til_converter.testing.AnyWrapper\022G\n\025any_"
+  "with_struct_value\030\006 \001(\0132(.proto_util_con"
+  "verter.testing.AnyWrapper\022\?\n\rrecursive_a"
+  "ny\030\007 \001(\0132(.proto_util_converter.testing."
+  "AnyWrapper\022H\n\026any_with_message_value\030\010 \001"
+  "(\0132(.proto_util_converter.testing.AnyWra"
+  "pper\022I\n\027any_with_nested_message\030\t \001(\0132(."
+  "proto_util_converter.testing.AnyWrapper\022"
+  "T\n\"any_with_message_with_wrapper_type\030\n "
+  "\001(\0132(.proto_util_converter.testing.AnyWr"
+  "apper\022Q\n\037any_with_message_with_timestamp"
+  "\030\013 \001(\0132(.proto_util_converter.testing.An"
+  "yWrapper\022Q\n\037any_with_message_containing_"
+  "map\030\014 \001(\0132(.proto_util_converter.testing"
+  ".AnyWrapper\022T\n\"any_with_message_containi"
+  "ng_struct\030\r \001(\0132(.proto_util_converter.t"
+  "esting.AnyWrapper\022^\n,any_with_message_co"
+  "ntaining_repeated_message\030\016 \001(\0132(.proto_"
+  "util_converter.testing.AnyWrapper\022V\n$rec"
+  "ursive_any_with_type_field_at_end\030\017 \001(\0132"
+  "(.proto_util_converter.testing.AnyWrappe"
+  "r\022>\n\014repeated_any\030\020 \001(\0132(.proto_util_con"
+  "verter.testing.AnyWrapper\022N\n\034empty_any_w"
+  "ith_null_type_url\030\021 \001(\0132(.proto_util_con"
+  "verter.testing.AnyWrapper\022+\n\rtop_level_a"
+  "ny\0302 \001(\0132\024.google.protobuf.Any\022B\n$top_le"
+  "vel_any_with_type_field_at_end\0303 \001(\0132\024.g"
+  "oogle.protobuf.Any\022:\n\034top_level_any_with"
+  "_pivot_one\0304 \001(\0132\024.google.protobuf.Any\022:"
+  "\n\034top_level_any_with_pivot_two\0305 \001(\0132\024.g"
+  "oogle.protobuf.Any\0225\n\027top_level_any_unor"
+  "dered\0306 \001(\0132\024.google.protobuf.Any\"/\n\nAny"
+  "Wrapper\022!\n\003any\030\001 \001(\0132\024.google.protobuf.A"
+  "ny\"\225\002\n\007Imports\022)\n\003dbl\030\001 \001(\0132\034.google.pro"
+  "tobuf.DoubleValue\022\'\n\006struct\030\002 \001(\0132\027.goog"
+  "le.protobuf.Struct\022-\n\ttimestamp\030\003 \001(\0132\032."
+  "google.protobuf.Timestamp\022+\n\010duration\030\004 "
+  "\001(\0132\031.google.protobuf.Duration\022(\n\003i32\030\005 "
+  "\001(\0132\033.google.protobuf.Int32Value\0220\n\004data"
+  "\030d \001(\0132\".proto_util_converter.testing.Da"
+  "ta\"\314\003\n\004Data\022\014\n\004attr\030\001 \001(\005\022\013\n\003str\030\002 \001(\t\022\014"
+  "\n\004msgs\030\003 \003(\t\0227\n\013nested_data\030\004 \001(\0132\".prot"
+  "o_util_converter.testing.Data\0220\n\013int_wra"
+  "pper\030\005 \001(\0132\033.google.protobuf.Int32Value\022"
+  "(\n\004time\030\006 \001(\0132\032.google.protobuf.Timestam"
+  "p\022A\n\010map_data\030\007 \003(\0132/.proto_util_convert"
+  "er.testing.Data.MapDataEntry\022,\n\013struct_d"
+  "ata\030\010 \001(\0132\027.google.protobuf.Struct\0229\n\rre"
+  "peated_data\030\t \003(\0132\".proto_util_converter"
+  ".testing.Data\022*\n\014repeated_any\030\n \003(\0132\024.go"
+  "ogle.protobuf.Any\032.\n\014MapDataEntry\022\013\n\003key"
+  "\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"=\n\005AnyIn\022\021\n\tso"
+  "mething\030\001 \001(\t\022!\n\003any\030\002 \001(\0132\024.google.prot"
+  "obuf.Any\"+\n\006AnyOut\022!\n\003any\030\001 \001(\0132\024.google"
+  ".protobuf.Any\"\023\n\004AnyM\022\013\n\003foo\030\001 \001(\t2\307\001\n\016A"
+  "nyTestService\022^\n\004Call\022*.proto_util_conve"
+  "rter.testing.AnyTestCases\032*.proto_util_c"
+  "onverter.testing.AnyTestCases\022U\n\005Call1\022%"
+  ".proto_util_converter.testing.Imports\032%."
+  "proto_util_converter.testing.Importsb\006pr"
+  "oto3"
+  ;
+static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto_deps[5] = {
+  &::descriptor_table_google_2fprotobuf_2fany_2eproto,
+  &::descriptor_table_google_2fprotobuf_2fduration_2eproto,
+  &::descriptor_table_google_2fprotobuf_2fstruct_2eproto,
+  &::descriptor_table_google_2fprotobuf_2ftimestamp_2eproto,
+  &::descriptor_table_google_2fprotobuf_2fwrappers_2eproto,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto_sccs[8] = {
+  &scc_info_AnyIn_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base,
+  &scc_info_AnyM_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base,
+  &scc_info_AnyOut_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base,
+  &scc_info_AnyTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base,
+  &scc_info_AnyWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base,
+  &scc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base,
+  &scc_info_Data_MapDataEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base,
+  &scc_info_Imports_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto_once;
+const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto = {
+  false, false, descriptor_table_protodef_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto, "google/protobuf/util/internal/testdata/anys.proto", 2964,
+  &descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto_once, descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto_sccs, descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto_deps, 8, 5,
+  schemas, file_default_instances, TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto::offsets,
+  file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto, 8, file_level_enum_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto, file_level_service_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto,
+};
+
+// Force running AddDescriptors() at dynamic initialization time.
+static bool dynamic_init_dummy_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto)), true);
+namespace proto_util_converter {
+namespace testing {
+
+// ===================================================================
+
+void AnyTestCases::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->empty_any_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->type_only_any_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->wrapper_any_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->any_with_timestamp_value_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->any_with_duration_value_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->any_with_struct_value_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->recursive_any_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->any_with_message_value_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->any_with_nested_message_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->any_with_message_with_wrapper_type_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->any_with_message_with_timestamp_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->any_with_message_containing_map_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->any_with_message_containing_struct_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->any_with_message_containing_repeated_message_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->recursive_any_with_type_field_at_end_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->repeated_any_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->empty_any_with_null_type_url_ = const_cast< ::proto_util_converter::testing::AnyWrapper*>(
+      ::proto_util_converter::testing::AnyWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->top_level_any_ = const_cast< PROTOBUF_NAMESPACE_ID::Any*>(
+      PROTOBUF_NAMESPACE_ID::Any::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->top_level_any_with_type_field_at_end_ = const_cast< PROTOBUF_NAMESPACE_ID::Any*>(
+      PROTOBUF_NAMESPACE_ID::Any::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->top_level_any_with_pivot_one_ = const_cast< PROTOBUF_NAMESPACE_ID::Any*>(
+      PROTOBUF_NAMESPACE_ID::Any::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->top_level_any_with_pivot_two_ = const_cast< PROTOBUF_NAMESPACE_ID::Any*>(
+      PROTOBUF_NAMESPACE_ID::Any::internal_default_instance());
+  ::proto_util_converter::testing::_AnyTestCases_default_instance_._instance.get_mutable()->top_level_any_unordered_ = const_cast< PROTOBUF_NAMESPACE_ID::Any*>(
+      PROTOBUF_NAMESPACE_ID::Any::internal_default_instance());
+}
+class AnyTestCases::_Internal {
+ public:
+  static const ::proto_util_converter::testing::AnyWrapper& empty_any(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& type_only_any(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& wrapper_any(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& any_with_timestamp_value(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& any_with_duration_value(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& any_with_struct_value(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& recursive_any(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& any_with_message_value(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& any_with_nested_message(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& any_with_message_with_wrapper_type(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& any_with_message_with_timestamp(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& any_with_message_containing_map(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& any_with_message_containing_struct(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& any_with_message_containing_repeated_message(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& recursive_any_with_type_field_at_end(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& repeated_any(const AnyTestCases* msg);
+  static const ::proto_util_converter::testing::AnyWrapper& empty_any_with_null_type_url(const AnyTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::Any& top_level_any(const AnyTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::Any& top_level_any_with_type_field_at_end(const AnyTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::Any& top_level_any_with_pivot_one(const AnyTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::Any& top_level_any_with_pivot_two(const AnyTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::Any& top_level_any_unordered(const AnyTestCases* msg);
+};
+
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::empty_any(const AnyTestCases* msg) {
+  return *msg->empty_any_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::type_only_any(const AnyTestCases* msg) {
+  return *msg->type_only_any_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::wrapper_any(const AnyTestCases* msg) {
+  return *msg->wrapper_any_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::any_with_timestamp_value(const AnyTestCases* msg) {
+  return *msg->any_with_timestamp_value_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::any_with_duration_value(const AnyTestCases* msg) {
+  return *msg->any_with_duration_value_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::any_with_struct_value(const AnyTestCases* msg) {
+  return *msg->any_with_struct_value_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::recursive_any(const AnyTestCases* msg) {
+  return *msg->recursive_any_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::any_with_message_value(const AnyTestCases* msg) {
+  return *msg->any_with_message_value_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::any_with_nested_message(const AnyTestCases* msg) {
+  return *msg->any_with_nested_message_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::any_with_message_with_wrapper_type(const AnyTestCases* msg) {
+  return *msg->any_with_message_with_wrapper_type_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::any_with_message_with_timestamp(const AnyTestCases* msg) {
+  return *msg->any_with_message_with_timestamp_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::any_with_message_containing_map(const AnyTestCases* msg) {
+  return *msg->any_with_message_containing_map_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::any_with_message_containing_struct(const AnyTestCases* msg) {
+  return *msg->any_with_message_containing_struct_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::any_with_message_containing_repeated_message(const AnyTestCases* msg) {
+  return *msg->any_with_message_containing_repeated_message_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::recursive_any_with_type_field_at_end(const AnyTestCases* msg) {
+  return *msg->recursive_any_with_type_field_at_end_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::repeated_any(const AnyTestCases* msg) {
+  return *msg->repeated_any_;
+}
+const ::proto_util_converter::testing::AnyWrapper&
+AnyTestCases::_Internal::empty_any_with_null_type_url(const AnyTestCases* msg) {
+  return *msg->empty_any_with_null_type_url_;
+}
+const PROTOBUF_NAMESPACE_ID::Any&
+AnyTestCases::_Internal::top_level_any(const AnyTestCases* msg) {
+  return *msg->top_level_any_;
+}
+const PROTOBUF_NAMESPACE_ID::Any&
+AnyTestCases::_Internal::top_level_any_with_type_field_at_end(const AnyTestCases* msg) {
+  return *msg->top_level_any_with_type_field_at_end_;
+}
+const PROTOBUF_NAMESPACE_ID::Any&
+AnyTestCases::_Internal::top_level_any_with_pivot_one(const AnyTestCases* msg) {
+  return *msg->top_level_any_with_pivot_one_;
+}
+const PROTOBUF_NAMESPACE_ID::Any&
+AnyTestCases::_Internal::top_level_any_with_pivot_two(const AnyTestCases* msg) {
+  return *msg->top_level_any_with_pivot_two_;
+}
+const PROTOBUF_NAMESPACE_ID::Any&
+AnyTestCases::_Internal::top_level_any_unordered(const AnyTestCases* msg) {
+  return *msg->top_level_any_unordered_;
+}
+void AnyTestCases::clear_top_level_any() {
+  if (GetArena() == nullptr && top_level_any_ != nullptr) {
+    delete top_level_any_;
+  }
+  top_level_any_ = nullptr;
+}
+void AnyTestCases::clear_top_level_any_with_type_field_at_end() {
+  if (GetArena() == nullptr && top_level_any_with_type_field_at_end_ != nullptr) {
+    delete top_level_any_with_type_field_at_end_;
+  }
+  top_level_any_with_type_field_at_end_ = nullptr;
+}
+void AnyTestCases::clear_top_level_any_with_pivot_one() {
+  if (GetArena() == nullptr && top_level_any_with_pivot_one_ != nullptr) {
+    delete top_level_any_with_pivot_one_;
+  }
+  top_level_any_with_pivot_one_ = nullptr;
+}
+void AnyTestCases::clear_top_level_any_with_pivot_two() {
+  if (GetArena() == nullptr && top_level_any_with_pivot_two_ != nullptr) {
+    delete top_level_any_with_pivot_two_;
+  }
+  top_level_any_with_pivot_two_ = nullptr;
+}
+void AnyTestCases::clear_top_level_any_unordered() {
+  if (GetArena() == nullptr && top_level_any_unordered_ != nullptr) {
+    delete top_level_any_unordered_;
+  }
+  top_level_any_unordered_ = nullptr;
+}
+AnyTestCases::AnyTestCases(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.AnyTestCases)
+}
+AnyTestCases::AnyTestCases(const AnyTestCases& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_empty_any()) {
+    empty_any_ = new ::proto_util_converter::testing::AnyWrapper(*from.empty_any_);
+  } else {
+    empty_any_ = nullptr;
+  }
+  if (from._internal_has_type_only_any()) {
+    type_only_any_ = new ::proto_util_converter::testing::AnyWrapper(*from.type_only_any_);
+  } else {
+    type_only_any_ = nullptr;
+  }
+  if (from._internal_has_wrapper_any()) {
+    wrapper_any_ = new ::proto_util_converter::testing::AnyWrapper(*from.wrapper_any_);
+  } else {
+    wrapper_any_ = nullptr;
+  }
+  if (from._internal_has_any_with_timestamp_value()) {
+    any_with_timestamp_value_ = new ::proto_util_converter::testing::AnyWrapper(*from.any_with_timestamp_value_);
+  } else {
+    any_with_timestamp_value_ = nullptr;
+  }
+  if (from._internal_has_any_with_duration_value()) {
+    any_with_duration_value_ = new ::proto_util_converter::testing::AnyWrapper(*from.any_with_duration_value_);
+  } else {
+    any_with_duration_value_ = nullptr;
+  }
+  if (from._internal_has_any_with_struct_value()) {
+    any_with_struct_value_ = new ::proto_util_converter::testing::AnyWrapper(*from.any_with_struct_value_);
+  } else {
+    any_with_struct_value_ = nullptr;
+  }
+  if (from._internal_has_recursive_any()) {
+    recursive_any_ = new ::proto_util_converter::testing::AnyWrapper(*from.recursive_any_);
+  } else {
+    recursive_any_ = nullptr;
+  }
+  if (from._internal_has_any_with_message_value()) {
+    any_with_message_value_ = new ::proto_util_converter::testing::AnyWrapper(*from.any_with_message_value_);
+  } else {
+    any_with_message_value_ = nullptr;
+  }
+  if (from._internal_has_any_with_nested_message()) {
+    any_with_nested_message_ = new ::proto_util_converter::testing::AnyWrapper(*from.any_with_nested_message_);
+  } else {
+    any_with_nested_message_ = nullptr;
+  }
+  if (from._internal_has_any_with_message_with_wrapper_type()) {
+    any_with_message_with_wrapper_type_ = new ::proto_util_converter::testing::AnyWrapper(*from.any_with_message_with_wrapper_type_);
+  } else {
+    any_with_message_with_wrapper_type_ = nullptr;
+  }
+  if (from._internal_has_any_with_message_with_timestamp()) {
+    any_with_message_with_timestamp_ = new ::proto_util_converter::testing::AnyWrapper(*from.any_with_message_with_timestamp_);
+  } else {
+    any_with_message_with_timestamp_ = nullptr;
+  }
+  if (from._internal_has_any_with_message_containing_map()) {
+    any_with_message_containing_map_ = new ::proto_util_converter::testing::AnyWrapper(*from.any_with_message_containing_map_);
+  } else {
+    any_with_message_containing_map_ = nullptr;
+  }
+  if (from._internal_has_any_with_message_containing_struct()) {
+    any_with_message_containing_struct_ = new ::proto_util_converter::testing::AnyWrapper(*from.any_with_message_containing_struct_);
+  } else {
+    any_with_message_containing_struct_ = nullptr;
+  }
+  if (from._internal_has_any_with_message_containing_repeated_message()) {
+    any_with_message_containing_repeated_message_ = new ::proto_util_converter::testing::AnyWrapper(*from.any_with_message_containing_repeated_message_);
+  } else {
+    any_with_message_containing_repeated_message_ = nullptr;
+  }
+  if (from._internal_has_recursive_any_with_type_field_at_end()) {
+    recursive_any_with_type_field_at_end_ = new ::proto_util_converter::testing::AnyWrapper(*from.recursive_any_with_type_field_at_end_);
+  } else {
+    recursive_any_with_type_field_at_end_ = nullptr;
+  }
+  if (from._internal_has_repeated_any()) {
+    repeated_any_ = new ::proto_util_converter::testing::AnyWrapper(*from.repeated_any_);
+  } else {
+    repeated_any_ = nullptr;
+  }
+  if (from._internal_has_empty_any_with_null_type_url()) {
+    empty_any_with_null_type_url_ = new ::proto_util_converter::testing::AnyWrapper(*from.empty_any_with_null_type_url_);
+  } else {
+    empty_any_with_null_type_url_ = nullptr;
+  }
+  if (from._internal_has_top_level_any()) {
+    top_level_any_ = new PROTOBUF_NAMESPACE_ID::Any(*from.top_level_any_);
+  } else {
+    top_level_any_ = nullptr;
+  }
+  if (from._internal_has_top_level_any_with_type_field_at_end()) {
+    top_level_any_with_type_field_at_end_ = new PROTOBUF_NAMESPACE_ID::Any(*from.top_level_any_with_type_field_at_end_);
+  } else {
+    top_level_any_with_type_field_at_end_ = nullptr;
+  }
+  if (from._internal_has_top_level_any_with_pivot_one()) {
+    top_level_any_with_pivot_one_ = new PROTOBUF_NAMESPACE_ID::Any(*from.top_level_any_with_pivot_one_);
+  } else {
+    top_level_any_with_pivot_one_ = nullptr;
+  }
+  if (from._internal_has_top_level_any_with_pivot_two()) {
+    top_level_any_with_pivot_two_ = new PROTOBUF_NAMESPACE_ID::Any(*from.top_level_any_with_pivot_two_);
+  } else {
+    top_level_any_with_pivot_two_ = nullptr;
+  }
+  if (from._internal_has_top_level_any_unordered()) {
+    top_level_any_unordered_ = new PROTOBUF_NAMESPACE_ID::Any(*from.top_level_any_unordered_);
+  } else {
+    top_level_any_unordered_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.AnyTestCases)
+}
+
+void AnyTestCases::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AnyTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base);
+  ::memset(&empty_any_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&top_level_any_unordered_) -
+      reinterpret_cast<char*>(&empty_any_)) + sizeof(top_level_any_unordered_));
+}
+
+AnyTestCases::~AnyTestCases() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.AnyTestCases)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void AnyTestCases::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete empty_any_;
+  if (this != internal_default_instance()) delete type_only_any_;
+  if (this != internal_default_instance()) delete wrapper_any_;
+  if (this != internal_default_instance()) delete any_with_timestamp_value_;
+  if (this != internal_default_instance()) delete any_with_duration_value_;
+  if (this != internal_default_instance()) delete any_with_struct_value_;
+  if (this != internal_default_instance()) delete recursive_any_;
+  if (this != internal_default_instance()) delete any_with_message_value_;
+  if (this != internal_default_instance()) delete any_with_nested_message_;
+  if (this != internal_default_instance()) delete any_with_message_with_wrapper_type_;
+  if (this != internal_default_instance()) delete any_with_message_with_timestamp_;
+  if (this != internal_default_instance()) delete any_with_message_containing_map_;
+  if (this != internal_default_instance()) delete any_with_message_containing_struct_;
+  if (this != internal_default_instance()) delete any_with_message_containing_repeated_message_;
+  if (this != internal_default_instance()) delete recursive_any_with_type_field_at_end_;
+  if (this != internal_default_instance()) delete repeated_any_;
+  if (this != internal_default_instance()) delete empty_any_with_null_type_url_;
+  if (this != internal_default_instance()) delete top_level_any_;
+  if (this != internal_default_instance()) delete top_level_any_with_type_field_at_end_;
+  if (this != internal_default_instance()) delete top_level_any_with_pivot_one_;
+  if (this != internal_default_instance()) delete top_level_any_with_pivot_two_;
+  if (this != internal_default_instance()) delete top_level_any_unordered_;
+}
+
+void AnyTestCases::ArenaDtor(void* object) {
+  AnyTestCases* _this = reinterpret_cast< AnyTestCases* >(object);
+  (void)_this;
+}
+void AnyTestCases::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void AnyTestCases::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const AnyTestCases& AnyTestCases::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AnyTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void AnyTestCases::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.AnyTestCases)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && empty_any_ != nullptr) {
+    delete empty_any_;
+  }
+  empty_any_ = nullptr;
+  if (GetArena() == nullptr && type_only_any_ != nullptr) {
+    delete type_only_any_;
+  }
+  type_only_any_ = nullptr;
+  if (GetArena() == nullptr && wrapper_any_ != nullptr) {
+    delete wrapper_any_;
+  }
+  wrapper_any_ = nullptr;
+  if (GetArena() == nullptr && any_with_timestamp_value_ != nullptr) {
+    delete any_with_timestamp_value_;
+  }
+  any_with_timestamp_value_ = nullptr;
+  if (GetArena() == nullptr && any_with_duration_value_ != nullptr) {
+    delete any_with_duration_value_;
+  }
+  any_with_duration_value_ = nullptr;
+  if (GetArena() == nullptr && any_with_struct_value_ != nullptr) {
+    delete any_with_struct_value_;
+  }
+  any_with_struct_value_ = nullptr;
+  if (GetArena() == nullptr && recursive_any_ != nullptr) {
+    delete recursive_any_;
+  }
+  recursive_any_ = nullptr;
+  if (GetArena() == nullptr && any_with_message_value_ != nullptr) {
+    delete any_with_message_value_;
+  }
+  any_with_message_value_ = nullptr;
+  if (GetArena() == nullptr && any_with_nested_message_ != nullptr) {
+    delete any_with_nested_message_;
+  }
+  any_with_nested_message_ = nullptr;
+  if (GetArena() == nullptr && any_with_message_with_wrapper_type_ != nullptr) {
+    delete any_with_message_with_wrapper_type_;
+  }
+  any_with_message_with_wrapper_type_ = nullptr;
+  if (GetArena() == nullptr && any_with_message_with_timestamp_ != nullptr) {
+    delete any_with_message_with_timestamp_;
+  }
+  any_with_message_with_timestamp_ = nullptr;
+  if (GetArena() == nullptr && any_with_message_containing_map_ != nullptr) {
+    delete any_with_message_containing_map_;
+  }
+  any_with_message_containing_map_ = nullptr;
+  if (GetArena() == nullptr && any_with_message_containing_struct_ != nullptr) {
+    delete any_with_message_containing_struct_;
+  }
+  any_with_message_containing_struct_ = nullptr;
+  if (GetArena() == nullptr && any_with_message_containing_repeated_message_ != nullptr) {
+    delete any_with_message_containing_repeated_message_;
+  }
+  any_with_message_containing_repeated_message_ = nullptr;
+  if (GetArena() == nullptr && recursive_any_with_type_field_at_end_ != nullptr) {
+    delete recursive_any_with_type_field_at_end_;
+  }
+  recursive_any_with_type_field_at_end_ = nullptr;
+  if (GetArena() == nullptr && repeated_any_ != nullptr) {
+    delete repeated_any_;
+  }
+  repeated_any_ = nullptr;
+  if (GetArena() == nullptr && empty_any_with_null_type_url_ != nullptr) {
+    delete empty_any_with_null_type_url_;
+  }
+  empty_any_with_null_type_url_ = nullptr;
+  if (GetArena() == nullptr && top_level_any_ != nullptr) {
+    delete top_level_any_;
+  }
+  top_level_any_ = nullptr;
+  if (GetArena() == nullptr && top_level_any_with_type_field_at_end_ != nullptr) {
+    delete top_level_any_with_type_field_at_end_;
+  }
+  top_level_any_with_type_field_at_end_ = nullptr;
+  if (GetArena() == nullptr && top_level_any_with_pivot_one_ != nullptr) {
+    delete top_level_any_with_pivot_one_;
+  }
+  top_level_any_with_pivot_one_ = nullptr;
+  if (GetArena() == nullptr && top_level_any_with_pivot_two_ != nullptr) {
+    delete top_level_any_with_pivot_two_;
+  }
+  top_level_any_with_pivot_two_ = nullptr;
+  if (GetArena() == nullptr && top_level_any_unordered_ != nullptr) {
+    delete top_level_any_unordered_;
+  }
+  top_level_any_unordered_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AnyTestCases::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .proto_util_converter.testing.AnyWrapper empty_any = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_empty_any(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper type_only_any = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_type_only_any(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper wrapper_any = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_wrapper_any(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper any_with_timestamp_value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any_with_timestamp_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper any_with_duration_value = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any_with_duration_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper any_with_struct_value = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any_with_struct_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper recursive_any = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_recursive_any(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper any_with_message_value = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any_with_message_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper any_with_nested_message = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any_with_nested_message(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper any_with_message_with_wrapper_type = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any_with_message_with_wrapper_type(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper any_with_message_with_timestamp = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any_with_message_with_timestamp(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper any_with_message_containing_map = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any_with_message_containing_map(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper any_with_message_containing_struct = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any_with_message_containing_struct(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper any_with_message_containing_repeated_message = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any_with_message_containing_repeated_message(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper recursive_any_with_type_field_at_end = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_recursive_any_with_type_field_at_end(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper repeated_any = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_repeated_any(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.AnyWrapper empty_any_with_null_type_url = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_empty_any_with_null_type_url(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Any top_level_any = 50;
+      case 50:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_any(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Any top_level_any_with_type_field_at_end = 51;
+      case 51:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_any_with_type_field_at_end(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Any top_level_any_with_pivot_one = 52;
+      case 52:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 162)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_any_with_pivot_one(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Any top_level_any_with_pivot_two = 53;
+      case 53:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 170)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_any_with_pivot_two(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Any top_level_any_unordered = 54;
+      case 54:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 178)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_any_unordered(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* AnyTestCases::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.AnyTestCases)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .proto_util_converter.testing.AnyWrapper empty_any = 1;
+  if (this->has_empty_any()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::empty_any(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper type_only_any = 2;
+  if (this->has_type_only_any()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::type_only_any(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper wrapper_any = 3;
+  if (this->has_wrapper_any()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::wrapper_any(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_timestamp_value = 4;
+  if (this->has_any_with_timestamp_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::any_with_timestamp_value(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_duration_value = 5;
+  if (this->has_any_with_duration_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        5, _Internal::any_with_duration_value(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_struct_value = 6;
+  if (this->has_any_with_struct_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        6, _Internal::any_with_struct_value(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper recursive_any = 7;
+  if (this->has_recursive_any()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        7, _Internal::recursive_any(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_value = 8;
+  if (this->has_any_with_message_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        8, _Internal::any_with_message_value(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_nested_message = 9;
+  if (this->has_any_with_nested_message()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        9, _Internal::any_with_nested_message(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_with_wrapper_type = 10;
+  if (this->has_any_with_message_with_wrapper_type()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        10, _Internal::any_with_message_with_wrapper_type(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_with_timestamp = 11;
+  if (this->has_any_with_message_with_timestamp()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        11, _Internal::any_with_message_with_timestamp(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_containing_map = 12;
+  if (this->has_any_with_message_containing_map()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        12, _Internal::any_with_message_containing_map(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_containing_struct = 13;
+  if (this->has_any_with_message_containing_struct()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        13, _Internal::any_with_message_containing_struct(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_containing_repeated_message = 14;
+  if (this->has_any_with_message_containing_repeated_message()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        14, _Internal::any_with_message_containing_repeated_message(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper recursive_any_with_type_field_at_end = 15;
+  if (this->has_recursive_any_with_type_field_at_end()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        15, _Internal::recursive_any_with_type_field_at_end(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper repeated_any = 16;
+  if (this->has_repeated_any()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        16, _Internal::repeated_any(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper empty_any_with_null_type_url = 17;
+  if (this->has_empty_any_with_null_type_url()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        17, _Internal::empty_any_with_null_type_url(this), target, stream);
+  }
+
+  // .google.protobuf.Any top_level_any = 50;
+  if (this->has_top_level_any()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        50, _Internal::top_level_any(this), target, stream);
+  }
+
+  // .google.protobuf.Any top_level_any_with_type_field_at_end = 51;
+  if (this->has_top_level_any_with_type_field_at_end()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        51, _Internal::top_level_any_with_type_field_at_end(this), target, stream);
+  }
+
+  // .google.protobuf.Any top_level_any_with_pivot_one = 52;
+  if (this->has_top_level_any_with_pivot_one()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        52, _Internal::top_level_any_with_pivot_one(this), target, stream);
+  }
+
+  // .google.protobuf.Any top_level_any_with_pivot_two = 53;
+  if (this->has_top_level_any_with_pivot_two()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        53, _Internal::top_level_any_with_pivot_two(this), target, stream);
+  }
+
+  // .google.protobuf.Any top_level_any_unordered = 54;
+  if (this->has_top_level_any_unordered()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        54, _Internal::top_level_any_unordered(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.AnyTestCases)
+  return target;
+}
+
+size_t AnyTestCases::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.AnyTestCases)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .proto_util_converter.testing.AnyWrapper empty_any = 1;
+  if (this->has_empty_any()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *empty_any_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper type_only_any = 2;
+  if (this->has_type_only_any()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *type_only_any_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper wrapper_any = 3;
+  if (this->has_wrapper_any()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *wrapper_any_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_timestamp_value = 4;
+  if (this->has_any_with_timestamp_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_with_timestamp_value_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_duration_value = 5;
+  if (this->has_any_with_duration_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_with_duration_value_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_struct_value = 6;
+  if (this->has_any_with_struct_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_with_struct_value_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper recursive_any = 7;
+  if (this->has_recursive_any()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *recursive_any_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_value = 8;
+  if (this->has_any_with_message_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_with_message_value_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_nested_message = 9;
+  if (this->has_any_with_nested_message()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_with_nested_message_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_with_wrapper_type = 10;
+  if (this->has_any_with_message_with_wrapper_type()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_with_message_with_wrapper_type_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_with_timestamp = 11;
+  if (this->has_any_with_message_with_timestamp()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_with_message_with_timestamp_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_containing_map = 12;
+  if (this->has_any_with_message_containing_map()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_with_message_containing_map_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_containing_struct = 13;
+  if (this->has_any_with_message_containing_struct()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_with_message_containing_struct_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_containing_repeated_message = 14;
+  if (this->has_any_with_message_containing_repeated_message()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_with_message_containing_repeated_message_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper recursive_any_with_type_field_at_end = 15;
+  if (this->has_recursive_any_with_type_field_at_end()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *recursive_any_with_type_field_at_end_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper repeated_any = 16;
+  if (this->has_repeated_any()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *repeated_any_);
+  }
+
+  // .proto_util_converter.testing.AnyWrapper empty_any_with_null_type_url = 17;
+  if (this->has_empty_any_with_null_type_url()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *empty_any_with_null_type_url_);
+  }
+
+  // .google.protobuf.Any top_level_any = 50;
+  if (this->has_top_level_any()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_any_);
+  }
+
+  // .google.protobuf.Any top_level_any_with_type_field_at_end = 51;
+  if (this->has_top_level_any_with_type_field_at_end()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_any_with_type_field_at_end_);
+  }
+
+  // .google.protobuf.Any top_level_any_with_pivot_one = 52;
+  if (this->has_top_level_any_with_pivot_one()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_any_with_pivot_one_);
+  }
+
+  // .google.protobuf.Any top_level_any_with_pivot_two = 53;
+  if (this->has_top_level_any_with_pivot_two()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_any_with_pivot_two_);
+  }
+
+  // .google.protobuf.Any top_level_any_unordered = 54;
+  if (this->has_top_level_any_unordered()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_any_unordered_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void AnyTestCases::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.AnyTestCases)
+  GOOGLE_DCHECK_NE(&from, this);
+  const AnyTestCases* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AnyTestCases>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.AnyTestCases)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.AnyTestCases)
+    MergeFrom(*source);
+  }
+}
+
+void AnyTestCases::MergeFrom(const AnyTestCases& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.AnyTestCases)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_empty_any()) {
+    _internal_mutable_empty_any()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_empty_any());
+  }
+  if (from.has_type_only_any()) {
+    _internal_mutable_type_only_any()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_type_only_any());
+  }
+  if (from.has_wrapper_any()) {
+    _internal_mutable_wrapper_any()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_wrapper_any());
+  }
+  if (from.has_any_with_timestamp_value()) {
+    _internal_mutable_any_with_timestamp_value()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_any_with_timestamp_value());
+  }
+  if (from.has_any_with_duration_value()) {
+    _internal_mutable_any_with_duration_value()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_any_with_duration_value());
+  }
+  if (from.has_any_with_struct_value()) {
+    _internal_mutable_any_with_struct_value()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_any_with_struct_value());
+  }
+  if (from.has_recursive_any()) {
+    _internal_mutable_recursive_any()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_recursive_any());
+  }
+  if (from.has_any_with_message_value()) {
+    _internal_mutable_any_with_message_value()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_any_with_message_value());
+  }
+  if (from.has_any_with_nested_message()) {
+    _internal_mutable_any_with_nested_message()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_any_with_nested_message());
+  }
+  if (from.has_any_with_message_with_wrapper_type()) {
+    _internal_mutable_any_with_message_with_wrapper_type()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_any_with_message_with_wrapper_type());
+  }
+  if (from.has_any_with_message_with_timestamp()) {
+    _internal_mutable_any_with_message_with_timestamp()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_any_with_message_with_timestamp());
+  }
+  if (from.has_any_with_message_containing_map()) {
+    _internal_mutable_any_with_message_containing_map()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_any_with_message_containing_map());
+  }
+  if (from.has_any_with_message_containing_struct()) {
+    _internal_mutable_any_with_message_containing_struct()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_any_with_message_containing_struct());
+  }
+  if (from.has_any_with_message_containing_repeated_message()) {
+    _internal_mutable_any_with_message_containing_repeated_message()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_any_with_message_containing_repeated_message());
+  }
+  if (from.has_recursive_any_with_type_field_at_end()) {
+    _internal_mutable_recursive_any_with_type_field_at_end()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_recursive_any_with_type_field_at_end());
+  }
+  if (from.has_repeated_any()) {
+    _internal_mutable_repeated_any()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_repeated_any());
+  }
+  if (from.has_empty_any_with_null_type_url()) {
+    _internal_mutable_empty_any_with_null_type_url()->::proto_util_converter::testing::AnyWrapper::MergeFrom(from._internal_empty_any_with_null_type_url());
+  }
+  if (from.has_top_level_any()) {
+    _internal_mutable_top_level_any()->PROTOBUF_NAMESPACE_ID::Any::MergeFrom(from._internal_top_level_any());
+  }
+  if (from.has_top_level_any_with_type_field_at_end()) {
+    _internal_mutable_top_level_any_with_type_field_at_end()->PROTOBUF_NAMESPACE_ID::Any::MergeFrom(from._internal_top_level_any_with_type_field_at_end());
+  }
+  if (from.has_top_level_any_with_pivot_one()) {
+    _internal_mutable_top_level_any_with_pivot_one()->PROTOBUF_NAMESPACE_ID::Any::MergeFrom(from._internal_top_level_any_with_pivot_one());
+  }
+  if (from.has_top_level_any_with_pivot_two()) {
+    _internal_mutable_top_level_any_with_pivot_two()->PROTOBUF_NAMESPACE_ID::Any::MergeFrom(from._internal_top_level_any_with_pivot_two());
+  }
+  if (from.has_top_level_any_unordered()) {
+    _internal_mutable_top_level_any_unordered()->PROTOBUF_NAMESPACE_ID::Any::MergeFrom(from._internal_top_level_any_unordered());
+  }
+}
+
+void AnyTestCases::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.AnyTestCases)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void AnyTestCases::CopyFrom(const AnyTestCases& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.AnyTestCases)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AnyTestCases::IsInitialized() const {
+  return true;
+}
+
+void AnyTestCases::InternalSwap(AnyTestCases* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AnyTestCases, top_level_any_unordered_)
+      + sizeof(AnyTestCases::top_level_any_unordered_)
+      - PROTOBUF_FIELD_OFFSET(AnyTestCases, empty_any_)>(
+          reinterpret_cast<char*>(&empty_any_),
+          reinterpret_cast<char*>(&other->empty_any_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AnyTestCases::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void AnyWrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_AnyWrapper_default_instance_._instance.get_mutable()->any_ = const_cast< PROTOBUF_NAMESPACE_ID::Any*>(
+      PROTOBUF_NAMESPACE_ID::Any::internal_default_instance());
+}
+class AnyWrapper::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Any& any(const AnyWrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Any&
+AnyWrapper::_Internal::any(const AnyWrapper* msg) {
+  return *msg->any_;
+}
+void AnyWrapper::clear_any() {
+  if (GetArena() == nullptr && any_ != nullptr) {
+    delete any_;
+  }
+  any_ = nullptr;
+}
+AnyWrapper::AnyWrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.AnyWrapper)
+}
+AnyWrapper::AnyWrapper(const AnyWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_any()) {
+    any_ = new PROTOBUF_NAMESPACE_ID::Any(*from.any_);
+  } else {
+    any_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.AnyWrapper)
+}
+
+void AnyWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AnyWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base);
+  any_ = nullptr;
+}
+
+AnyWrapper::~AnyWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.AnyWrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void AnyWrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete any_;
+}
+
+void AnyWrapper::ArenaDtor(void* object) {
+  AnyWrapper* _this = reinterpret_cast< AnyWrapper* >(object);
+  (void)_this;
+}
+void AnyWrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void AnyWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const AnyWrapper& AnyWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AnyWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void AnyWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.AnyWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && any_ != nullptr) {
+    delete any_;
+  }
+  any_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AnyWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Any any = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* AnyWrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.AnyWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Any any = 1;
+  if (this->has_any()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::any(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.AnyWrapper)
+  return target;
+}
+
+size_t AnyWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.AnyWrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.Any any = 1;
+  if (this->has_any()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void AnyWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.AnyWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const AnyWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AnyWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.AnyWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.AnyWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void AnyWrapper::MergeFrom(const AnyWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.AnyWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_any()) {
+    _internal_mutable_any()->PROTOBUF_NAMESPACE_ID::Any::MergeFrom(from._internal_any());
+  }
+}
+
+void AnyWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.AnyWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void AnyWrapper::CopyFrom(const AnyWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.AnyWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AnyWrapper::IsInitialized() const {
+  return true;
+}
+
+void AnyWrapper::InternalSwap(AnyWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(any_, other->any_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AnyWrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void Imports::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_Imports_default_instance_._instance.get_mutable()->dbl_ = const_cast< PROTOBUF_NAMESPACE_ID::DoubleValue*>(
+      PROTOBUF_NAMESPACE_ID::DoubleValue::internal_default_instance());
+  ::proto_util_converter::testing::_Imports_default_instance_._instance.get_mutable()->struct__ = const_cast< PROTOBUF_NAMESPACE_ID::Struct*>(
+      PROTOBUF_NAMESPACE_ID::Struct::internal_default_instance());
+  ::proto_util_converter::testing::_Imports_default_instance_._instance.get_mutable()->timestamp_ = const_cast< PROTOBUF_NAMESPACE_ID::Timestamp*>(
+      PROTOBUF_NAMESPACE_ID::Timestamp::internal_default_instance());
+  ::proto_util_converter::testing::_Imports_default_instance_._instance.get_mutable()->duration_ = const_cast< PROTOBUF_NAMESPACE_ID::Duration*>(
+      PROTOBUF_NAMESPACE_ID::Duration::internal_default_instance());
+  ::proto_util_converter::testing::_Imports_default_instance_._instance.get_mutable()->i32_ = const_cast< PROTOBUF_NAMESPACE_ID::Int32Value*>(
+      PROTOBUF_NAMESPACE_ID::Int32Value::internal_default_instance());
+  ::proto_util_converter::testing::_Imports_default_instance_._instance.get_mutable()->data_ = const_cast< ::proto_util_converter::testing::Data*>(
+      ::proto_util_converter::testing::Data::internal_default_instance());
+}
+class Imports::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::DoubleValue& dbl(const Imports* msg);
+  static const PROTOBUF_NAMESPACE_ID::Struct& struct_(const Imports* msg);
+  static const PROTOBUF_NAMESPACE_ID::Timestamp& timestamp(const Imports* msg);
+  static const PROTOBUF_NAMESPACE_ID::Duration& duration(const Imports* msg);
+  static const PROTOBUF_NAMESPACE_ID::Int32Value& i32(const Imports* msg);
+  static const ::proto_util_converter::testing::Data& data(const Imports* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::DoubleValue&
+Imports::_Internal::dbl(const Imports* msg) {
+  return *msg->dbl_;
+}
+const PROTOBUF_NAMESPACE_ID::Struct&
+Imports::_Internal::struct_(const Imports* msg) {
+  return *msg->struct__;
+}
+const PROTOBUF_NAMESPACE_ID::Timestamp&
+Imports::_Internal::timestamp(const Imports* msg) {
+  return *msg->timestamp_;
+}
+const PROTOBUF_NAMESPACE_ID::Duration&
+Imports::_Internal::duration(const Imports* msg) {
+  return *msg->duration_;
+}
+const PROTOBUF_NAMESPACE_ID::Int32Value&
+Imports::_Internal::i32(const Imports* msg) {
+  return *msg->i32_;
+}
+const ::proto_util_converter::testing::Data&
+Imports::_Internal::data(const Imports* msg) {
+  return *msg->data_;
+}
+void Imports::clear_dbl() {
+  if (GetArena() == nullptr && dbl_ != nullptr) {
+    delete dbl_;
+  }
+  dbl_ = nullptr;
+}
+void Imports::clear_struct_() {
+  if (GetArena() == nullptr && struct__ != nullptr) {
+    delete struct__;
+  }
+  struct__ = nullptr;
+}
+void Imports::clear_timestamp() {
+  if (GetArena() == nullptr && timestamp_ != nullptr) {
+    delete timestamp_;
+  }
+  timestamp_ = nullptr;
+}
+void Imports::clear_duration() {
+  if (GetArena() == nullptr && duration_ != nullptr) {
+    delete duration_;
+  }
+  duration_ = nullptr;
+}
+void Imports::clear_i32() {
+  if (GetArena() == nullptr && i32_ != nullptr) {
+    delete i32_;
+  }
+  i32_ = nullptr;
+}
+Imports::Imports(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.Imports)
+}
+Imports::Imports(const Imports& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_dbl()) {
+    dbl_ = new PROTOBUF_NAMESPACE_ID::DoubleValue(*from.dbl_);
+  } else {
+    dbl_ = nullptr;
+  }
+  if (from._internal_has_struct_()) {
+    struct__ = new PROTOBUF_NAMESPACE_ID::Struct(*from.struct__);
+  } else {
+    struct__ = nullptr;
+  }
+  if (from._internal_has_timestamp()) {
+    timestamp_ = new PROTOBUF_NAMESPACE_ID::Timestamp(*from.timestamp_);
+  } else {
+    timestamp_ = nullptr;
+  }
+  if (from._internal_has_duration()) {
+    duration_ = new PROTOBUF_NAMESPACE_ID::Duration(*from.duration_);
+  } else {
+    duration_ = nullptr;
+  }
+  if (from._internal_has_i32()) {
+    i32_ = new PROTOBUF_NAMESPACE_ID::Int32Value(*from.i32_);
+  } else {
+    i32_ = nullptr;
+  }
+  if (from._internal_has_data()) {
+    data_ = new ::proto_util_converter::testing::Data(*from.data_);
+  } else {
+    data_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.Imports)
+}
+
+void Imports::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Imports_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base);
+  ::memset(&dbl_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&data_) -
+      reinterpret_cast<char*>(&dbl_)) + sizeof(data_));
+}
+
+Imports::~Imports() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.Imports)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void Imports::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete dbl_;
+  if (this != internal_default_instance()) delete struct__;
+  if (this != internal_default_instance()) delete timestamp_;
+  if (this != internal_default_instance()) delete duration_;
+  if (this != internal_default_instance()) delete i32_;
+  if (this != internal_default_instance()) delete data_;
+}
+
+void Imports::ArenaDtor(void* object) {
+  Imports* _this = reinterpret_cast< Imports* >(object);
+  (void)_this;
+}
+void Imports::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void Imports::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const Imports& Imports::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Imports_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void Imports::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.Imports)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && dbl_ != nullptr) {
+    delete dbl_;
+  }
+  dbl_ = nullptr;
+  if (GetArena() == nullptr && struct__ != nullptr) {
+    delete struct__;
+  }
+  struct__ = nullptr;
+  if (GetArena() == nullptr && timestamp_ != nullptr) {
+    delete timestamp_;
+  }
+  timestamp_ = nullptr;
+  if (GetArena() == nullptr && duration_ != nullptr) {
+    delete duration_;
+  }
+  duration_ = nullptr;
+  if (GetArena() == nullptr && i32_ != nullptr) {
+    delete i32_;
+  }
+  i32_ = nullptr;
+  if (GetArena() == nullptr && data_ != nullptr) {
+    delete data_;
+  }
+  data_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Imports::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.DoubleValue dbl = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_dbl(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Struct struct = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_struct_(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Timestamp timestamp = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_timestamp(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Duration duration = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_duration(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Int32Value i32 = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_i32(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.Data data = 100;
+      case 100:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_data(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* Imports::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.Imports)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.DoubleValue dbl = 1;
+  if (this->has_dbl()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::dbl(this), target, stream);
+  }
+
+  // .google.protobuf.Struct struct = 2;
+  if (this->has_struct_()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::struct_(this), target, stream);
+  }
+
+  // .google.protobuf.Timestamp timestamp = 3;
+  if (this->has_timestamp()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::timestamp(this), target, stream);
+  }
+
+  // .google.protobuf.Duration duration = 4;
+  if (this->has_duration()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::duration(this), target, stream);
+  }
+
+  // .google.protobuf.Int32Value i32 = 5;
+  if (this->has_i32()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        5, _Internal::i32(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.Data data = 100;
+  if (this->has_data()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        100, _Internal::data(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.Imports)
+  return target;
+}
+
+size_t Imports::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.Imports)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.DoubleValue dbl = 1;
+  if (this->has_dbl()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *dbl_);
+  }
+
+  // .google.protobuf.Struct struct = 2;
+  if (this->has_struct_()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *struct__);
+  }
+
+  // .google.protobuf.Timestamp timestamp = 3;
+  if (this->has_timestamp()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *timestamp_);
+  }
+
+  // .google.protobuf.Duration duration = 4;
+  if (this->has_duration()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *duration_);
+  }
+
+  // .google.protobuf.Int32Value i32 = 5;
+  if (this->has_i32()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *i32_);
+  }
+
+  // .proto_util_converter.testing.Data data = 100;
+  if (this->has_data()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *data_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Imports::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.Imports)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Imports* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Imports>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.Imports)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.Imports)
+    MergeFrom(*source);
+  }
+}
+
+void Imports::MergeFrom(const Imports& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.Imports)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_dbl()) {
+    _internal_mutable_dbl()->PROTOBUF_NAMESPACE_ID::DoubleValue::MergeFrom(from._internal_dbl());
+  }
+  if (from.has_struct_()) {
+    _internal_mutable_struct_()->PROTOBUF_NAMESPACE_ID::Struct::MergeFrom(from._internal_struct_());
+  }
+  if (from.has_timestamp()) {
+    _internal_mutable_timestamp()->PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(from._internal_timestamp());
+  }
+  if (from.has_duration()) {
+    _internal_mutable_duration()->PROTOBUF_NAMESPACE_ID::Duration::MergeFrom(from._internal_duration());
+  }
+  if (from.has_i32()) {
+    _internal_mutable_i32()->PROTOBUF_NAMESPACE_ID::Int32Value::MergeFrom(from._internal_i32());
+  }
+  if (from.has_data()) {
+    _internal_mutable_data()->::proto_util_converter::testing::Data::MergeFrom(from._internal_data());
+  }
+}
+
+void Imports::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.Imports)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Imports::CopyFrom(const Imports& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.Imports)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Imports::IsInitialized() const {
+  return true;
+}
+
+void Imports::InternalSwap(Imports* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Imports, data_)
+      + sizeof(Imports::data_)
+      - PROTOBUF_FIELD_OFFSET(Imports, dbl_)>(
+          reinterpret_cast<char*>(&dbl_),
+          reinterpret_cast<char*>(&other->dbl_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Imports::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+Data_MapDataEntry_DoNotUse::Data_MapDataEntry_DoNotUse() {}
+Data_MapDataEntry_DoNotUse::Data_MapDataEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Data_MapDataEntry_DoNotUse::MergeFrom(const Data_MapDataEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Data_MapDataEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void Data_MapDataEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+void Data::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_Data_default_instance_._instance.get_mutable()->nested_data_ = const_cast< ::proto_util_converter::testing::Data*>(
+      ::proto_util_converter::testing::Data::internal_default_instance());
+  ::proto_util_converter::testing::_Data_default_instance_._instance.get_mutable()->int_wrapper_ = const_cast< PROTOBUF_NAMESPACE_ID::Int32Value*>(
+      PROTOBUF_NAMESPACE_ID::Int32Value::internal_default_instance());
+  ::proto_util_converter::testing::_Data_default_instance_._instance.get_mutable()->time_ = const_cast< PROTOBUF_NAMESPACE_ID::Timestamp*>(
+      PROTOBUF_NAMESPACE_ID::Timestamp::internal_default_instance());
+  ::proto_util_converter::testing::_Data_default_instance_._instance.get_mutable()->struct_data_ = const_cast< PROTOBUF_NAMESPACE_ID::Struct*>(
+      PROTOBUF_NAMESPACE_ID::Struct::internal_default_instance());
+}
+class Data::_Internal {
+ public:
+  static const ::proto_util_converter::testing::Data& nested_data(const Data* msg);
+  static const PROTOBUF_NAMESPACE_ID::Int32Value& int_wrapper(const Data* msg);
+  static const PROTOBUF_NAMESPACE_ID::Timestamp& time(const Data* msg);
+  static const PROTOBUF_NAMESPACE_ID::Struct& struct_data(const Data* msg);
+};
+
+const ::proto_util_converter::testing::Data&
+Data::_Internal::nested_data(const Data* msg) {
+  return *msg->nested_data_;
+}
+const PROTOBUF_NAMESPACE_ID::Int32Value&
+Data::_Internal::int_wrapper(const Data* msg) {
+  return *msg->int_wrapper_;
+}
+const PROTOBUF_NAMESPACE_ID::Timestamp&
+Data::_Internal::time(const Data* msg) {
+  return *msg->time_;
+}
+const PROTOBUF_NAMESPACE_ID::Struct&
+Data::_Internal::struct_data(const Data* msg) {
+  return *msg->struct_data_;
+}
+void Data::clear_int_wrapper() {
+  if (GetArena() == nullptr && int_wrapper_ != nullptr) {
+    delete int_wrapper_;
+  }
+  int_wrapper_ = nullptr;
+}
+void Data::clear_time() {
+  if (GetArena() == nullptr && time_ != nullptr) {
+    delete time_;
+  }
+  time_ = nullptr;
+}
+void Data::clear_struct_data() {
+  if (GetArena() == nullptr && struct_data_ != nullptr) {
+    delete struct_data_;
+  }
+  struct_data_ = nullptr;
+}
+void Data::clear_repeated_any() {
+  repeated_any_.Clear();
+}
+Data::Data(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  msgs_(arena),
+  map_data_(arena),
+  repeated_data_(arena),
+  repeated_any_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.Data)
+}
+Data::Data(const Data& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      msgs_(from.msgs_),
+      repeated_data_(from.repeated_data_),
+      repeated_any_(from.repeated_any_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  map_data_.MergeFrom(from.map_data_);
+  str_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_str().empty()) {
+    str_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_str(),
+      GetArena());
+  }
+  if (from._internal_has_nested_data()) {
+    nested_data_ = new ::proto_util_converter::testing::Data(*from.nested_data_);
+  } else {
+    nested_data_ = nullptr;
+  }
+  if (from._internal_has_int_wrapper()) {
+    int_wrapper_ = new PROTOBUF_NAMESPACE_ID::Int32Value(*from.int_wrapper_);
+  } else {
+    int_wrapper_ = nullptr;
+  }
+  if (from._internal_has_time()) {
+    time_ = new PROTOBUF_NAMESPACE_ID::Timestamp(*from.time_);
+  } else {
+    time_ = nullptr;
+  }
+  if (from._internal_has_struct_data()) {
+    struct_data_ = new PROTOBUF_NAMESPACE_ID::Struct(*from.struct_data_);
+  } else {
+    struct_data_ = nullptr;
+  }
+  attr_ = from.attr_;
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.Data)
+}
+
+void Data::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base);
+  str_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&nested_data_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&attr_) -
+      reinterpret_cast<char*>(&nested_data_)) + sizeof(attr_));
+}
+
+Data::~Data() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.Data)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void Data::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  str_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete nested_data_;
+  if (this != internal_default_instance()) delete int_wrapper_;
+  if (this != internal_default_instance()) delete time_;
+  if (this != internal_default_instance()) delete struct_data_;
+}
+
+void Data::ArenaDtor(void* object) {
+  Data* _this = reinterpret_cast< Data* >(object);
+  (void)_this;
+}
+void Data::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void Data::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const Data& Data::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void Data::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.Data)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  msgs_.Clear();
+  map_data_.Clear();
+  repeated_data_.Clear();
+  repeated_any_.Clear();
+  str_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (GetArena() == nullptr && nested_data_ != nullptr) {
+    delete nested_data_;
+  }
+  nested_data_ = nullptr;
+  if (GetArena() == nullptr && int_wrapper_ != nullptr) {
+    delete int_wrapper_;
+  }
+  int_wrapper_ = nullptr;
+  if (GetArena() == nullptr && time_ != nullptr) {
+    delete time_;
+  }
+  time_ = nullptr;
+  if (GetArena() == nullptr && struct_data_ != nullptr) {
+    delete struct_data_;
+  }
+  struct_data_ = nullptr;
+  attr_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Data::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // int32 attr = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          attr_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string str = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&str_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          const std::string* str = &str_.Get();
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto_util_converter.testing.Data.str"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated string msgs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_msgs();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto_util_converter.testing.Data.msgs"));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.Data nested_data = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_nested_data(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Int32Value int_wrapper = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_int_wrapper(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Timestamp time = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_time(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // map<string, string> map_data = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&map_data_,
+              ctx->CountLengthDelimited<58>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&map_data_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Struct struct_data = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_struct_data(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .proto_util_converter.testing.Data repeated_data = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          ptr -= 1;
+          repeated_data_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<74>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_repeated_data(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Any repeated_any = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+          ptr -= 1;
+          repeated_any_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<82>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_repeated_any(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* Data::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.Data)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 attr = 1;
+  if (this->attr() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_attr(), target);
+  }
+
+  // string str = 2;
+  if (this->str().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_str().data(), static_cast<int>(this->_internal_str().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto_util_converter.testing.Data.str");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_str(), target);
+  }
+
+  // repeated string msgs = 3;
+  for (int i = 0, n = this->_internal_msgs_size(); i < n; i++) {
+    const auto& s = this->_internal_msgs(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto_util_converter.testing.Data.msgs");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // .proto_util_converter.testing.Data nested_data = 4;
+  if (this->has_nested_data()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::nested_data(this), target, stream);
+  }
+
+  // .google.protobuf.Int32Value int_wrapper = 5;
+  if (this->has_int_wrapper()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        5, _Internal::int_wrapper(this), target, stream);
+  }
+
+  // .google.protobuf.Timestamp time = 6;
+  if (this->has_time()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        6, _Internal::time(this), target, stream);
+  }
+
+  // map<string, string> map_data = 7;
+  if (!this->_internal_map_data().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          p->first.data(), static_cast<int>(p->first.length()),
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+          "proto_util_converter.testing.Data.MapDataEntry.key");
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          p->second.data(), static_cast<int>(p->second.length()),
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+          "proto_util_converter.testing.Data.MapDataEntry.value");
+      }
+    };
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_map_data().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_map_data().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+          it = this->_internal_map_data().begin();
+          it != this->_internal_map_data().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = Data_MapDataEntry_DoNotUse::Funcs::InternalSerialize(7, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+          it = this->_internal_map_data().begin();
+          it != this->_internal_map_data().end(); ++it) {
+        target = Data_MapDataEntry_DoNotUse::Funcs::InternalSerialize(7, it->first, it->second, target, stream);
+        Utf8Check::Check(&(*it));
+      }
+    }
+  }
+
+  // .google.protobuf.Struct struct_data = 8;
+  if (this->has_struct_data()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        8, _Internal::struct_data(this), target, stream);
+  }
+
+  // repeated .proto_util_converter.testing.Data repeated_data = 9;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_data_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, this->_internal_repeated_data(i), target, stream);
+  }
+
+  // repeated .google.protobuf.Any repeated_any = 10;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_any_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, this->_internal_repeated_any(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.Data)
+  return target;
+}
+
+size_t Data::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.Data)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string msgs = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(msgs_.size());
+  for (int i = 0, n = msgs_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      msgs_.Get(i));
+  }
+
+  // map<string, string> map_data = 7;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_map_data_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_map_data().begin();
+      it != this->_internal_map_data().end(); ++it) {
+    total_size += Data_MapDataEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // repeated .proto_util_converter.testing.Data repeated_data = 9;
+  total_size += 1UL * this->_internal_repeated_data_size();
+  for (const auto& msg : this->repeated_data_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.Any repeated_any = 10;
+  total_size += 1UL * this->_internal_repeated_any_size();
+  for (const auto& msg : this->repeated_any_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string str = 2;
+  if (this->str().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_str());
+  }
+
+  // .proto_util_converter.testing.Data nested_data = 4;
+  if (this->has_nested_data()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *nested_data_);
+  }
+
+  // .google.protobuf.Int32Value int_wrapper = 5;
+  if (this->has_int_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int_wrapper_);
+  }
+
+  // .google.protobuf.Timestamp time = 6;
+  if (this->has_time()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *time_);
+  }
+
+  // .google.protobuf.Struct struct_data = 8;
+  if (this->has_struct_data()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *struct_data_);
+  }
+
+  // int32 attr = 1;
+  if (this->attr() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_attr());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Data::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.Data)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Data* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Data>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.Data)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.Data)
+    MergeFrom(*source);
+  }
+}
+
+void Data::MergeFrom(const Data& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.Data)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  msgs_.MergeFrom(from.msgs_);
+  map_data_.MergeFrom(from.map_data_);
+  repeated_data_.MergeFrom(from.repeated_data_);
+  repeated_any_.MergeFrom(from.repeated_any_);
+  if (from.str().size() > 0) {
+    _internal_set_str(from._internal_str());
+  }
+  if (from.has_nested_data()) {
+    _internal_mutable_nested_data()->::proto_util_converter::testing::Data::MergeFrom(from._internal_nested_data());
+  }
+  if (from.has_int_wrapper()) {
+    _internal_mutable_int_wrapper()->PROTOBUF_NAMESPACE_ID::Int32Value::MergeFrom(from._internal_int_wrapper());
+  }
+  if (from.has_time()) {
+    _internal_mutable_time()->PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(from._internal_time());
+  }
+  if (from.has_struct_data()) {
+    _internal_mutable_struct_data()->PROTOBUF_NAMESPACE_ID::Struct::MergeFrom(from._internal_struct_data());
+  }
+  if (from.attr() != 0) {
+    _internal_set_attr(from._internal_attr());
+  }
+}
+
+void Data::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.Data)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Data::CopyFrom(const Data& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.Data)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Data::IsInitialized() const {
+  return true;
+}
+
+void Data::InternalSwap(Data* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  msgs_.InternalSwap(&other->msgs_);
+  map_data_.Swap(&other->map_data_);
+  repeated_data_.InternalSwap(&other->repeated_data_);
+  repeated_any_.InternalSwap(&other->repeated_any_);
+  str_.Swap(&other->str_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Data, attr_)
+      + sizeof(Data::attr_)
+      - PROTOBUF_FIELD_OFFSET(Data, nested_data_)>(
+          reinterpret_cast<char*>(&nested_data_),
+          reinterpret_cast<char*>(&other->nested_data_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Data::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void AnyIn::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_AnyIn_default_instance_._instance.get_mutable()->any_ = const_cast< PROTOBUF_NAMESPACE_ID::Any*>(
+      PROTOBUF_NAMESPACE_ID::Any::internal_default_instance());
+}
+class AnyIn::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Any& any(const AnyIn* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Any&
+AnyIn::_Internal::any(const AnyIn* msg) {
+  return *msg->any_;
+}
+void AnyIn::clear_any() {
+  if (GetArena() == nullptr && any_ != nullptr) {
+    delete any_;
+  }
+  any_ = nullptr;
+}
+AnyIn::AnyIn(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.AnyIn)
+}
+AnyIn::AnyIn(const AnyIn& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  something_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_something().empty()) {
+    something_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_something(),
+      GetArena());
+  }
+  if (from._internal_has_any()) {
+    any_ = new PROTOBUF_NAMESPACE_ID::Any(*from.any_);
+  } else {
+    any_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.AnyIn)
+}
+
+void AnyIn::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AnyIn_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base);
+  something_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  any_ = nullptr;
+}
+
+AnyIn::~AnyIn() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.AnyIn)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void AnyIn::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  something_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete any_;
+}
+
+void AnyIn::ArenaDtor(void* object) {
+  AnyIn* _this = reinterpret_cast< AnyIn* >(object);
+  (void)_this;
+}
+void AnyIn::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void AnyIn::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const AnyIn& AnyIn::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AnyIn_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void AnyIn::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.AnyIn)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  something_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (GetArena() == nullptr && any_ != nullptr) {
+    delete any_;
+  }
+  any_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AnyIn::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string something = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&something_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          const std::string* str = &something_.Get();
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto_util_converter.testing.AnyIn.something"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Any any = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* AnyIn::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.AnyIn)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string something = 1;
+  if (this->something().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_something().data(), static_cast<int>(this->_internal_something().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto_util_converter.testing.AnyIn.something");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_something(), target);
+  }
+
+  // .google.protobuf.Any any = 2;
+  if (this->has_any()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::any(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.AnyIn)
+  return target;
+}
+
+size_t AnyIn::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.AnyIn)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string something = 1;
+  if (this->something().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_something());
+  }
+
+  // .google.protobuf.Any any = 2;
+  if (this->has_any()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void AnyIn::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.AnyIn)
+  GOOGLE_DCHECK_NE(&from, this);
+  const AnyIn* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AnyIn>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.AnyIn)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.AnyIn)
+    MergeFrom(*source);
+  }
+}
+
+void AnyIn::MergeFrom(const AnyIn& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.AnyIn)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.something().size() > 0) {
+    _internal_set_something(from._internal_something());
+  }
+  if (from.has_any()) {
+    _internal_mutable_any()->PROTOBUF_NAMESPACE_ID::Any::MergeFrom(from._internal_any());
+  }
+}
+
+void AnyIn::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.AnyIn)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void AnyIn::CopyFrom(const AnyIn& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.AnyIn)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AnyIn::IsInitialized() const {
+  return true;
+}
+
+void AnyIn::InternalSwap(AnyIn* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  something_.Swap(&other->something_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(any_, other->any_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AnyIn::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void AnyOut::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_AnyOut_default_instance_._instance.get_mutable()->any_ = const_cast< PROTOBUF_NAMESPACE_ID::Any*>(
+      PROTOBUF_NAMESPACE_ID::Any::internal_default_instance());
+}
+class AnyOut::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Any& any(const AnyOut* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Any&
+AnyOut::_Internal::any(const AnyOut* msg) {
+  return *msg->any_;
+}
+void AnyOut::clear_any() {
+  if (GetArena() == nullptr && any_ != nullptr) {
+    delete any_;
+  }
+  any_ = nullptr;
+}
+AnyOut::AnyOut(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.AnyOut)
+}
+AnyOut::AnyOut(const AnyOut& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_any()) {
+    any_ = new PROTOBUF_NAMESPACE_ID::Any(*from.any_);
+  } else {
+    any_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.AnyOut)
+}
+
+void AnyOut::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AnyOut_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base);
+  any_ = nullptr;
+}
+
+AnyOut::~AnyOut() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.AnyOut)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void AnyOut::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete any_;
+}
+
+void AnyOut::ArenaDtor(void* object) {
+  AnyOut* _this = reinterpret_cast< AnyOut* >(object);
+  (void)_this;
+}
+void AnyOut::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void AnyOut::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const AnyOut& AnyOut::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AnyOut_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void AnyOut::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.AnyOut)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && any_ != nullptr) {
+    delete any_;
+  }
+  any_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AnyOut::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Any any = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* AnyOut::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.AnyOut)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Any any = 1;
+  if (this->has_any()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::any(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.AnyOut)
+  return target;
+}
+
+size_t AnyOut::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.AnyOut)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.Any any = 1;
+  if (this->has_any()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void AnyOut::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.AnyOut)
+  GOOGLE_DCHECK_NE(&from, this);
+  const AnyOut* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AnyOut>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.AnyOut)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.AnyOut)
+    MergeFrom(*source);
+  }
+}
+
+void AnyOut::MergeFrom(const AnyOut& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.AnyOut)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_any()) {
+    _internal_mutable_any()->PROTOBUF_NAMESPACE_ID::Any::MergeFrom(from._internal_any());
+  }
+}
+
+void AnyOut::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.AnyOut)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void AnyOut::CopyFrom(const AnyOut& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.AnyOut)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AnyOut::IsInitialized() const {
+  return true;
+}
+
+void AnyOut::InternalSwap(AnyOut* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(any_, other->any_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AnyOut::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void AnyM::InitAsDefaultInstance() {
+}
+class AnyM::_Internal {
+ public:
+};
+
+AnyM::AnyM(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.AnyM)
+}
+AnyM::AnyM(const AnyM& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  foo_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_foo().empty()) {
+    foo_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_foo(),
+      GetArena());
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.AnyM)
+}
+
+void AnyM::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AnyM_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base);
+  foo_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+AnyM::~AnyM() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.AnyM)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void AnyM::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  foo_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void AnyM::ArenaDtor(void* object) {
+  AnyM* _this = reinterpret_cast< AnyM* >(object);
+  (void)_this;
+}
+void AnyM::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void AnyM::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const AnyM& AnyM::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AnyM_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void AnyM::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.AnyM)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  foo_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AnyM::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string foo = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&foo_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          const std::string* str = &foo_.Get();
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto_util_converter.testing.AnyM.foo"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* AnyM::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.AnyM)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string foo = 1;
+  if (this->foo().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_foo().data(), static_cast<int>(this->_internal_foo().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto_util_converter.testing.AnyM.foo");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_foo(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.AnyM)
+  return target;
+}
+
+size_t AnyM::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.AnyM)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string foo = 1;
+  if (this->foo().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_foo());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void AnyM::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.AnyM)
+  GOOGLE_DCHECK_NE(&from, this);
+  const AnyM* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AnyM>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.AnyM)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.AnyM)
+    MergeFrom(*source);
+  }
+}
+
+void AnyM::MergeFrom(const AnyM& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.AnyM)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.foo().size() > 0) {
+    _internal_set_foo(from._internal_foo());
+  }
+}
+
+void AnyM::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.AnyM)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void AnyM::CopyFrom(const AnyM& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.AnyM)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AnyM::IsInitialized() const {
+  return true;
+}
+
+void AnyM::InternalSwap(AnyM* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  foo_.Swap(&other->foo_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AnyM::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace testing
+}  // namespace proto_util_converter
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::AnyTestCases* Arena::CreateMaybeMessage< ::proto_util_converter::testing::AnyTestCases >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::AnyTestCases >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::AnyWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::AnyWrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::AnyWrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::Imports* Arena::CreateMaybeMessage< ::proto_util_converter::testing::Imports >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::Imports >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::Data_MapDataEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto_util_converter::testing::Data_MapDataEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::Data_MapDataEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::Data* Arena::CreateMaybeMessage< ::proto_util_converter::testing::Data >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::Data >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::AnyIn* Arena::CreateMaybeMessage< ::proto_util_converter::testing::AnyIn >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::AnyIn >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::AnyOut* Arena::CreateMaybeMessage< ::proto_util_converter::testing::AnyOut >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::AnyOut >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::AnyM* Arena::CreateMaybeMessage< ::proto_util_converter::testing::AnyM >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::AnyM >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,5134 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/internal/testdata/anys.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3012000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3012003 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/any.pb.h>
+#include <google/protobuf/duration.pb.h>
+#include <google/protobuf/struct.pb.h>
+#include <google/protobuf/timestamp.pb.h>
+#include <google/protobuf/wrappers.pb.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[8]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+namespace proto_util_converter {
+namespace testing {
+class AnyIn;
+class AnyInDefaultTypeInternal;
+extern AnyInDefaultTypeInternal _AnyIn_default_instance_;
+class AnyM;
+class AnyMDefaultTypeInternal;
+extern AnyMDefaultTypeInternal _AnyM_default_instance_;
+class AnyOut;
+class AnyOutDefaultTypeInternal;
+extern AnyOutDefaultTypeInternal _AnyOut_default_instance_;
+class AnyTestCases;
+class AnyTestCasesDefaultTypeInternal;
+extern AnyTestCasesDefaultTypeInternal _AnyTestCases_default_instance_;
+class AnyWrapper;
+class AnyWrapperDefaultTypeInternal;
+extern AnyWrapperDefaultTypeInternal _AnyWrapper_default_instance_;
+class Data;
+class DataDefaultTypeInternal;
+extern DataDefaultTypeInternal _Data_default_instance_;
+class Data_MapDataEntry_DoNotUse;
+class Data_MapDataEntry_DoNotUseDefaultTypeInternal;
+extern Data_MapDataEntry_DoNotUseDefaultTypeInternal _Data_MapDataEntry_DoNotUse_default_instance_;
+class Imports;
+class ImportsDefaultTypeInternal;
+extern ImportsDefaultTypeInternal _Imports_default_instance_;
+}  // namespace testing
+}  // namespace proto_util_converter
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto_util_converter::testing::AnyIn* Arena::CreateMaybeMessage<::proto_util_converter::testing::AnyIn>(Arena*);
+template<> ::proto_util_converter::testing::AnyM* Arena::CreateMaybeMessage<::proto_util_converter::testing::AnyM>(Arena*);
+template<> ::proto_util_converter::testing::AnyOut* Arena::CreateMaybeMessage<::proto_util_converter::testing::AnyOut>(Arena*);
+template<> ::proto_util_converter::testing::AnyTestCases* Arena::CreateMaybeMessage<::proto_util_converter::testing::AnyTestCases>(Arena*);
+template<> ::proto_util_converter::testing::AnyWrapper* Arena::CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(Arena*);
+template<> ::proto_util_converter::testing::Data* Arena::CreateMaybeMessage<::proto_util_converter::testing::Data>(Arena*);
+template<> ::proto_util_converter::testing::Data_MapDataEntry_DoNotUse* Arena::CreateMaybeMessage<::proto_util_converter::testing::Data_MapDataEntry_DoNotUse>(Arena*);
+template<> ::proto_util_converter::testing::Imports* Arena::CreateMaybeMessage<::proto_util_converter::testing::Imports>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto_util_converter {
+namespace testing {
+
+// ===================================================================
+
+class AnyTestCases PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.AnyTestCases) */ {
+ public:
+  inline AnyTestCases() : AnyTestCases(nullptr) {};
+  virtual ~AnyTestCases();
+
+  AnyTestCases(const AnyTestCases& from);
+  AnyTestCases(AnyTestCases&& from) noexcept
+    : AnyTestCases() {
+    *this = ::std::move(from);
+  }
+
+  inline AnyTestCases& operator=(const AnyTestCases& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AnyTestCases& operator=(AnyTestCases&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AnyTestCases& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AnyTestCases* internal_default_instance() {
+    return reinterpret_cast<const AnyTestCases*>(
+               &_AnyTestCases_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(AnyTestCases& a, AnyTestCases& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AnyTestCases* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AnyTestCases* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AnyTestCases* New() const final {
+    return CreateMaybeMessage<AnyTestCases>(nullptr);
+  }
+
+  AnyTestCases* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AnyTestCases>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AnyTestCases& from);
+  void MergeFrom(const AnyTestCases& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AnyTestCases* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.AnyTestCases";
+  }
+  protected:
+  explicit AnyTestCases(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEmptyAnyFieldNumber = 1,
+    kTypeOnlyAnyFieldNumber = 2,
+    kWrapperAnyFieldNumber = 3,
+    kAnyWithTimestampValueFieldNumber = 4,
+    kAnyWithDurationValueFieldNumber = 5,
+    kAnyWithStructValueFieldNumber = 6,
+    kRecursiveAnyFieldNumber = 7,
+    kAnyWithMessageValueFieldNumber = 8,
+    kAnyWithNestedMessageFieldNumber = 9,
+    kAnyWithMessageWithWrapperTypeFieldNumber = 10,
+    kAnyWithMessageWithTimestampFieldNumber = 11,
+    kAnyWithMessageContainingMapFieldNumber = 12,
+    kAnyWithMessageContainingStructFieldNumber = 13,
+    kAnyWithMessageContainingRepeatedMessageFieldNumber = 14,
+    kRecursiveAnyWithTypeFieldAtEndFieldNumber = 15,
+    kRepeatedAnyFieldNumber = 16,
+    kEmptyAnyWithNullTypeUrlFieldNumber = 17,
+    kTopLevelAnyFieldNumber = 50,
+    kTopLevelAnyWithTypeFieldAtEndFieldNumber = 51,
+    kTopLevelAnyWithPivotOneFieldNumber = 52,
+    kTopLevelAnyWithPivotTwoFieldNumber = 53,
+    kTopLevelAnyUnorderedFieldNumber = 54,
+  };
+  // .proto_util_converter.testing.AnyWrapper empty_any = 1;
+  bool has_empty_any() const;
+  private:
+  bool _internal_has_empty_any() const;
+  public:
+  void clear_empty_any();
+  const ::proto_util_converter::testing::AnyWrapper& empty_any() const;
+  ::proto_util_converter::testing::AnyWrapper* release_empty_any();
+  ::proto_util_converter::testing::AnyWrapper* mutable_empty_any();
+  void set_allocated_empty_any(::proto_util_converter::testing::AnyWrapper* empty_any);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_empty_any() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_empty_any();
+  public:
+  void unsafe_arena_set_allocated_empty_any(
+      ::proto_util_converter::testing::AnyWrapper* empty_any);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_empty_any();
+
+  // .proto_util_converter.testing.AnyWrapper type_only_any = 2;
+  bool has_type_only_any() const;
+  private:
+  bool _internal_has_type_only_any() const;
+  public:
+  void clear_type_only_any();
+  const ::proto_util_converter::testing::AnyWrapper& type_only_any() const;
+  ::proto_util_converter::testing::AnyWrapper* release_type_only_any();
+  ::proto_util_converter::testing::AnyWrapper* mutable_type_only_any();
+  void set_allocated_type_only_any(::proto_util_converter::testing::AnyWrapper* type_only_any);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_type_only_any() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_type_only_any();
+  public:
+  void unsafe_arena_set_allocated_type_only_any(
+      ::proto_util_converter::testing::AnyWrapper* type_only_any);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_type_only_any();
+
+  // .proto_util_converter.testing.AnyWrapper wrapper_any = 3;
+  bool has_wrapper_any() const;
+  private:
+  bool _internal_has_wrapper_any() const;
+  public:
+  void clear_wrapper_any();
+  const ::proto_util_converter::testing::AnyWrapper& wrapper_any() const;
+  ::proto_util_converter::testing::AnyWrapper* release_wrapper_any();
+  ::proto_util_converter::testing::AnyWrapper* mutable_wrapper_any();
+  void set_allocated_wrapper_any(::proto_util_converter::testing::AnyWrapper* wrapper_any);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_wrapper_any() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_wrapper_any();
+  public:
+  void unsafe_arena_set_allocated_wrapper_any(
+      ::proto_util_converter::testing::AnyWrapper* wrapper_any);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_wrapper_any();
+
+  // .proto_util_converter.testing.AnyWrapper any_with_timestamp_value = 4;
+  bool has_any_with_timestamp_value() const;
+  private:
+  bool _internal_has_any_with_timestamp_value() const;
+  public:
+  void clear_any_with_timestamp_value();
+  const ::proto_util_converter::testing::AnyWrapper& any_with_timestamp_value() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_timestamp_value();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_timestamp_value();
+  void set_allocated_any_with_timestamp_value(::proto_util_converter::testing::AnyWrapper* any_with_timestamp_value);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_any_with_timestamp_value() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_any_with_timestamp_value();
+  public:
+  void unsafe_arena_set_allocated_any_with_timestamp_value(
+      ::proto_util_converter::testing::AnyWrapper* any_with_timestamp_value);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_any_with_timestamp_value();
+
+  // .proto_util_converter.testing.AnyWrapper any_with_duration_value = 5;
+  bool has_any_with_duration_value() const;
+  private:
+  bool _internal_has_any_with_duration_value() const;
+  public:
+  void clear_any_with_duration_value();
+  const ::proto_util_converter::testing::AnyWrapper& any_with_duration_value() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_duration_value();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_duration_value();
+  void set_allocated_any_with_duration_value(::proto_util_converter::testing::AnyWrapper* any_with_duration_value);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_any_with_duration_value() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_any_with_duration_value();
+  public:
+  void unsafe_arena_set_allocated_any_with_duration_value(
+      ::proto_util_converter::testing::AnyWrapper* any_with_duration_value);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_any_with_duration_value();
+
+  // .proto_util_converter.testing.AnyWrapper any_with_struct_value = 6;
+  bool has_any_with_struct_value() const;
+  private:
+  bool _internal_has_any_with_struct_value() const;
+  public:
+  void clear_any_with_struct_value();
+  const ::proto_util_converter::testing::AnyWrapper& any_with_struct_value() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_struct_value();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_struct_value();
+  void set_allocated_any_with_struct_value(::proto_util_converter::testing::AnyWrapper* any_with_struct_value);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_any_with_struct_value() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_any_with_struct_value();
+  public:
+  void unsafe_arena_set_allocated_any_with_struct_value(
+      ::proto_util_converter::testing::AnyWrapper* any_with_struct_value);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_any_with_struct_value();
+
+  // .proto_util_converter.testing.AnyWrapper recursive_any = 7;
+  bool has_recursive_any() const;
+  private:
+  bool _internal_has_recursive_any() const;
+  public:
+  void clear_recursive_any();
+  const ::proto_util_converter::testing::AnyWrapper& recursive_any() const;
+  ::proto_util_converter::testing::AnyWrapper* release_recursive_any();
+  ::proto_util_converter::testing::AnyWrapper* mutable_recursive_any();
+  void set_allocated_recursive_any(::proto_util_converter::testing::AnyWrapper* recursive_any);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_recursive_any() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_recursive_any();
+  public:
+  void unsafe_arena_set_allocated_recursive_any(
+      ::proto_util_converter::testing::AnyWrapper* recursive_any);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_recursive_any();
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_value = 8;
+  bool has_any_with_message_value() const;
+  private:
+  bool _internal_has_any_with_message_value() const;
+  public:
+  void clear_any_with_message_value();
+  const ::proto_util_converter::testing::AnyWrapper& any_with_message_value() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_message_value();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_message_value();
+  void set_allocated_any_with_message_value(::proto_util_converter::testing::AnyWrapper* any_with_message_value);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_any_with_message_value() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_any_with_message_value();
+  public:
+  void unsafe_arena_set_allocated_any_with_message_value(
+      ::proto_util_converter::testing::AnyWrapper* any_with_message_value);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_any_with_message_value();
+
+  // .proto_util_converter.testing.AnyWrapper any_with_nested_message = 9;
+  bool has_any_with_nested_message() const;
+  private:
+  bool _internal_has_any_with_nested_message() const;
+  public:
+  void clear_any_with_nested_message();
+  const ::proto_util_converter::testing::AnyWrapper& any_with_nested_message() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_nested_message();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_nested_message();
+  void set_allocated_any_with_nested_message(::proto_util_converter::testing::AnyWrapper* any_with_nested_message);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_any_with_nested_message() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_any_with_nested_message();
+  public:
+  void unsafe_arena_set_allocated_any_with_nested_message(
+      ::proto_util_converter::testing::AnyWrapper* any_with_nested_message);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_any_with_nested_message();
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_with_wrapper_type = 10;
+  bool has_any_with_message_with_wrapper_type() const;
+  private:
+  bool _internal_has_any_with_message_with_wrapper_type() const;
+  public:
+  void clear_any_with_message_with_wrapper_type();
+  const ::proto_util_converter::testing::AnyWrapper& any_with_message_with_wrapper_type() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_message_with_wrapper_type();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_message_with_wrapper_type();
+  void set_allocated_any_with_message_with_wrapper_type(::proto_util_converter::testing::AnyWrapper* any_with_message_with_wrapper_type);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_any_with_message_with_wrapper_type() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_any_with_message_with_wrapper_type();
+  public:
+  void unsafe_arena_set_allocated_any_with_message_with_wrapper_type(
+      ::proto_util_converter::testing::AnyWrapper* any_with_message_with_wrapper_type);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_any_with_message_with_wrapper_type();
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_with_timestamp = 11;
+  bool has_any_with_message_with_timestamp() const;
+  private:
+  bool _internal_has_any_with_message_with_timestamp() const;
+  public:
+  void clear_any_with_message_with_timestamp();
+  const ::proto_util_converter::testing::AnyWrapper& any_with_message_with_timestamp() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_message_with_timestamp();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_message_with_timestamp();
+  void set_allocated_any_with_message_with_timestamp(::proto_util_converter::testing::AnyWrapper* any_with_message_with_timestamp);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_any_with_message_with_timestamp() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_any_with_message_with_timestamp();
+  public:
+  void unsafe_arena_set_allocated_any_with_message_with_timestamp(
+      ::proto_util_converter::testing::AnyWrapper* any_with_message_with_timestamp);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_any_with_message_with_timestamp();
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_containing_map = 12;
+  bool has_any_with_message_containing_map() const;
+  private:
+  bool _internal_has_any_with_message_containing_map() const;
+  public:
+  void clear_any_with_message_containing_map();
+  const ::proto_util_converter::testing::AnyWrapper& any_with_message_containing_map() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_message_containing_map();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_message_containing_map();
+  void set_allocated_any_with_message_containing_map(::proto_util_converter::testing::AnyWrapper* any_with_message_containing_map);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_any_with_message_containing_map() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_any_with_message_containing_map();
+  public:
+  void unsafe_arena_set_allocated_any_with_message_containing_map(
+      ::proto_util_converter::testing::AnyWrapper* any_with_message_containing_map);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_any_with_message_containing_map();
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_containing_struct = 13;
+  bool has_any_with_message_containing_struct() const;
+  private:
+  bool _internal_has_any_with_message_containing_struct() const;
+  public:
+  void clear_any_with_message_containing_struct();
+  const ::proto_util_converter::testing::AnyWrapper& any_with_message_containing_struct() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_message_containing_struct();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_message_containing_struct();
+  void set_allocated_any_with_message_containing_struct(::proto_util_converter::testing::AnyWrapper* any_with_message_containing_struct);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_any_with_message_containing_struct() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_any_with_message_containing_struct();
+  public:
+  void unsafe_arena_set_allocated_any_with_message_containing_struct(
+      ::proto_util_converter::testing::AnyWrapper* any_with_message_containing_struct);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_any_with_message_containing_struct();
+
+  // .proto_util_converter.testing.AnyWrapper any_with_message_containing_repeated_message = 14;
+  bool has_any_with_message_containing_repeated_message() const;
+  private:
+  bool _internal_has_any_with_message_containing_repeated_message() const;
+  public:
+  void clear_any_with_message_containing_repeated_message();
+  const ::proto_util_converter::testing::AnyWrapper& any_with_message_containing_repeated_message() const;
+  ::proto_util_converter::testing::AnyWrapper* release_any_with_message_containing_repeated_message();
+  ::proto_util_converter::testing::AnyWrapper* mutable_any_with_message_containing_repeated_message();
+  void set_allocated_any_with_message_containing_repeated_message(::proto_util_converter::testing::AnyWrapper* any_with_message_containing_repeated_message);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_any_with_message_containing_repeated_message() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_any_with_message_containing_repeated_message();
+  public:
+  void unsafe_arena_set_allocated_any_with_message_containing_repeated_message(
+      ::proto_util_converter::testing::AnyWrapper* any_with_message_containing_repeated_message);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_any_with_message_containing_repeated_message();
+
+  // .proto_util_converter.testing.AnyWrapper recursive_any_with_type_field_at_end = 15;
+  bool has_recursive_any_with_type_field_at_end() const;
+  private:
+  bool _internal_has_recursive_any_with_type_field_at_end() const;
+  public:
+  void clear_recursive_any_with_type_field_at_end();
+  const ::proto_util_converter::testing::AnyWrapper& recursive_any_with_type_field_at_end() const;
+  ::proto_util_converter::testing::AnyWrapper* release_recursive_any_with_type_field_at_end();
+  ::proto_util_converter::testing::AnyWrapper* mutable_recursive_any_with_type_field_at_end();
+  void set_allocated_recursive_any_with_type_field_at_end(::proto_util_converter::testing::AnyWrapper* recursive_any_with_type_field_at_end);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_recursive_any_with_type_field_at_end() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_recursive_any_with_type_field_at_end();
+  public:
+  void unsafe_arena_set_allocated_recursive_any_with_type_field_at_end(
+      ::proto_util_converter::testing::AnyWrapper* recursive_any_with_type_field_at_end);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_recursive_any_with_type_field_at_end();
+
+  // .proto_util_converter.testing.AnyWrapper repeated_any = 16;
+  bool has_repeated_any() const;
+  private:
+  bool _internal_has_repeated_any() const;
+  public:
+  void clear_repeated_any();
+  const ::proto_util_converter::testing::AnyWrapper& repeated_any() const;
+  ::proto_util_converter::testing::AnyWrapper* release_repeated_any();
+  ::proto_util_converter::testing::AnyWrapper* mutable_repeated_any();
+  void set_allocated_repeated_any(::proto_util_converter::testing::AnyWrapper* repeated_any);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_repeated_any() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_repeated_any();
+  public:
+  void unsafe_arena_set_allocated_repeated_any(
+      ::proto_util_converter::testing::AnyWrapper* repeated_any);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_repeated_any();
+
+  // .proto_util_converter.testing.AnyWrapper empty_any_with_null_type_url = 17;
+  bool has_empty_any_with_null_type_url() const;
+  private:
+  bool _internal_has_empty_any_with_null_type_url() const;
+  public:
+  void clear_empty_any_with_null_type_url();
+  const ::proto_util_converter::testing::AnyWrapper& empty_any_with_null_type_url() const;
+  ::proto_util_converter::testing::AnyWrapper* release_empty_any_with_null_type_url();
+  ::proto_util_converter::testing::AnyWrapper* mutable_empty_any_with_null_type_url();
+  void set_allocated_empty_any_with_null_type_url(::proto_util_converter::testing::AnyWrapper* empty_any_with_null_type_url);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_empty_any_with_null_type_url() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_empty_any_with_null_type_url();
+  public:
+  void unsafe_arena_set_allocated_empty_any_with_null_type_url(
+      ::proto_util_converter::testing::AnyWrapper* empty_any_with_null_type_url);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_empty_any_with_null_type_url();
+
+  // .google.protobuf.Any top_level_any = 50;
+  bool has_top_level_any() const;
+  private:
+  bool _internal_has_top_level_any() const;
+  public:
+  void clear_top_level_any();
+  const PROTOBUF_NAMESPACE_ID::Any& top_level_any() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_top_level_any();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_top_level_any();
+  void set_allocated_top_level_any(PROTOBUF_NAMESPACE_ID::Any* top_level_any);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Any& _internal_top_level_any() const;
+  PROTOBUF_NAMESPACE_ID::Any* _internal_mutable_top_level_any();
+  public:
+  void unsafe_arena_set_allocated_top_level_any(
+      PROTOBUF_NAMESPACE_ID::Any* top_level_any);
+  PROTOBUF_NAMESPACE_ID::Any* unsafe_arena_release_top_level_any();
+
+  // .google.protobuf.Any top_level_any_with_type_field_at_end = 51;
+  bool has_top_level_any_with_type_field_at_end() const;
+  private:
+  bool _internal_has_top_level_any_with_type_field_at_end() const;
+  public:
+  void clear_top_level_any_with_type_field_at_end();
+  const PROTOBUF_NAMESPACE_ID::Any& top_level_any_with_type_field_at_end() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_top_level_any_with_type_field_at_end();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_top_level_any_with_type_field_at_end();
+  void set_allocated_top_level_any_with_type_field_at_end(PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_type_field_at_end);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Any& _internal_top_level_any_with_type_field_at_end() const;
+  PROTOBUF_NAMESPACE_ID::Any* _internal_mutable_top_level_any_with_type_field_at_end();
+  public:
+  void unsafe_arena_set_allocated_top_level_any_with_type_field_at_end(
+      PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_type_field_at_end);
+  PROTOBUF_NAMESPACE_ID::Any* unsafe_arena_release_top_level_any_with_type_field_at_end();
+
+  // .google.protobuf.Any top_level_any_with_pivot_one = 52;
+  bool has_top_level_any_with_pivot_one() const;
+  private:
+  bool _internal_has_top_level_any_with_pivot_one() const;
+  public:
+  void clear_top_level_any_with_pivot_one();
+  const PROTOBUF_NAMESPACE_ID::Any& top_level_any_with_pivot_one() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_top_level_any_with_pivot_one();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_top_level_any_with_pivot_one();
+  void set_allocated_top_level_any_with_pivot_one(PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_one);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Any& _internal_top_level_any_with_pivot_one() const;
+  PROTOBUF_NAMESPACE_ID::Any* _internal_mutable_top_level_any_with_pivot_one();
+  public:
+  void unsafe_arena_set_allocated_top_level_any_with_pivot_one(
+      PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_one);
+  PROTOBUF_NAMESPACE_ID::Any* unsafe_arena_release_top_level_any_with_pivot_one();
+
+  // .google.protobuf.Any top_level_any_with_pivot_two = 53;
+  bool has_top_level_any_with_pivot_two() const;
+  private:
+  bool _internal_has_top_level_any_with_pivot_two() const;
+  public:
+  void clear_top_level_any_with_pivot_two();
+  const PROTOBUF_NAMESPACE_ID::Any& top_level_any_with_pivot_two() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_top_level_any_with_pivot_two();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_top_level_any_with_pivot_two();
+  void set_allocated_top_level_any_with_pivot_two(PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_two);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Any& _internal_top_level_any_with_pivot_two() const;
+  PROTOBUF_NAMESPACE_ID::Any* _internal_mutable_top_level_any_with_pivot_two();
+  public:
+  void unsafe_arena_set_allocated_top_level_any_with_pivot_two(
+      PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_two);
+  PROTOBUF_NAMESPACE_ID::Any* unsafe_arena_release_top_level_any_with_pivot_two();
+
+  // .google.protobuf.Any top_level_any_unordered = 54;
+  bool has_top_level_any_unordered() const;
+  private:
+  bool _internal_has_top_level_any_unordered() const;
+  public:
+  void clear_top_level_any_unordered();
+  const PROTOBUF_NAMESPACE_ID::Any& top_level_any_unordered() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_top_level_any_unordered();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_top_level_any_unordered();
+  void set_allocated_top_level_any_unordered(PROTOBUF_NAMESPACE_ID::Any* top_level_any_unordered);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Any& _internal_top_level_any_unordered() const;
+  PROTOBUF_NAMESPACE_ID::Any* _internal_mutable_top_level_any_unordered();
+  public:
+  void unsafe_arena_set_allocated_top_level_any_unordered(
+      PROTOBUF_NAMESPACE_ID::Any* top_level_any_unordered);
+  PROTOBUF_NAMESPACE_ID::Any* unsafe_arena_release_top_level_any_unordered();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.AnyTestCases)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::proto_util_converter::testing::AnyWrapper* empty_any_;
+  ::proto_util_converter::testing::AnyWrapper* type_only_any_;
+  ::proto_util_converter::testing::AnyWrapper* wrapper_any_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_timestamp_value_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_duration_value_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_struct_value_;
+  ::proto_util_converter::testing::AnyWrapper* recursive_any_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_message_value_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_nested_message_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_message_with_wrapper_type_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_message_with_timestamp_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_message_containing_map_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_message_containing_struct_;
+  ::proto_util_converter::testing::AnyWrapper* any_with_message_containing_repeated_message_;
+  ::proto_util_converter::testing::AnyWrapper* recursive_any_with_type_field_at_end_;
+  ::proto_util_converter::testing::AnyWrapper* repeated_any_;
+  ::proto_util_converter::testing::AnyWrapper* empty_any_with_null_type_url_;
+  PROTOBUF_NAMESPACE_ID::Any* top_level_any_;
+  PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_type_field_at_end_;
+  PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_one_;
+  PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_two_;
+  PROTOBUF_NAMESPACE_ID::Any* top_level_any_unordered_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AnyWrapper PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.AnyWrapper) */ {
+ public:
+  inline AnyWrapper() : AnyWrapper(nullptr) {};
+  virtual ~AnyWrapper();
+
+  AnyWrapper(const AnyWrapper& from);
+  AnyWrapper(AnyWrapper&& from) noexcept
+    : AnyWrapper() {
+    *this = ::std::move(from);
+  }
+
+  inline AnyWrapper& operator=(const AnyWrapper& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AnyWrapper& operator=(AnyWrapper&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AnyWrapper& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AnyWrapper* internal_default_instance() {
+    return reinterpret_cast<const AnyWrapper*>(
+               &_AnyWrapper_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(AnyWrapper& a, AnyWrapper& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AnyWrapper* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AnyWrapper* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AnyWrapper* New() const final {
+    return CreateMaybeMessage<AnyWrapper>(nullptr);
+  }
+
+  AnyWrapper* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AnyWrapper>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AnyWrapper& from);
+  void MergeFrom(const AnyWrapper& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AnyWrapper* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.AnyWrapper";
+  }
+  protected:
+  explicit AnyWrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAnyFieldNumber = 1,
+  };
+  // .google.protobuf.Any any = 1;
+  bool has_any() const;
+  private:
+  bool _internal_has_any() const;
+  public:
+  void clear_any();
+  const PROTOBUF_NAMESPACE_ID::Any& any() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_any();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_any();
+  void set_allocated_any(PROTOBUF_NAMESPACE_ID::Any* any);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Any& _internal_any() const;
+  PROTOBUF_NAMESPACE_ID::Any* _internal_mutable_any();
+  public:
+  void unsafe_arena_set_allocated_any(
+      PROTOBUF_NAMESPACE_ID::Any* any);
+  PROTOBUF_NAMESPACE_ID::Any* unsafe_arena_release_any();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.AnyWrapper)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  PROTOBUF_NAMESPACE_ID::Any* any_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Imports PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Imports) */ {
+ public:
+  inline Imports() : Imports(nullptr) {};
+  virtual ~Imports();
+
+  Imports(const Imports& from);
+  Imports(Imports&& from) noexcept
+    : Imports() {
+    *this = ::std::move(from);
+  }
+
+  inline Imports& operator=(const Imports& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Imports& operator=(Imports&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Imports& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Imports* internal_default_instance() {
+    return reinterpret_cast<const Imports*>(
+               &_Imports_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Imports& a, Imports& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Imports* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Imports* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Imports* New() const final {
+    return CreateMaybeMessage<Imports>(nullptr);
+  }
+
+  Imports* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Imports>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Imports& from);
+  void MergeFrom(const Imports& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Imports* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Imports";
+  }
+  protected:
+  explicit Imports(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDblFieldNumber = 1,
+    kStructFieldNumber = 2,
+    kTimestampFieldNumber = 3,
+    kDurationFieldNumber = 4,
+    kI32FieldNumber = 5,
+    kDataFieldNumber = 100,
+  };
+  // .google.protobuf.DoubleValue dbl = 1;
+  bool has_dbl() const;
+  private:
+  bool _internal_has_dbl() const;
+  public:
+  void clear_dbl();
+  const PROTOBUF_NAMESPACE_ID::DoubleValue& dbl() const;
+  PROTOBUF_NAMESPACE_ID::DoubleValue* release_dbl();
+  PROTOBUF_NAMESPACE_ID::DoubleValue* mutable_dbl();
+  void set_allocated_dbl(PROTOBUF_NAMESPACE_ID::DoubleValue* dbl);
+  private:
+  const PROTOBUF_NAMESPACE_ID::DoubleValue& _internal_dbl() const;
+  PROTOBUF_NAMESPACE_ID::DoubleValue* _internal_mutable_dbl();
+  public:
+  void unsafe_arena_set_allocated_dbl(
+      PROTOBUF_NAMESPACE_ID::DoubleValue* dbl);
+  PROTOBUF_NAMESPACE_ID::DoubleValue* unsafe_arena_release_dbl();
+
+  // .google.protobuf.Struct struct = 2;
+  bool has_struct_() const;
+  private:
+  bool _internal_has_struct_() const;
+  public:
+  void clear_struct_();
+  const PROTOBUF_NAMESPACE_ID::Struct& struct_() const;
+  PROTOBUF_NAMESPACE_ID::Struct* release_struct_();
+  PROTOBUF_NAMESPACE_ID::Struct* mutable_struct_();
+  void set_allocated_struct_(PROTOBUF_NAMESPACE_ID::Struct* struct_);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Struct& _internal_struct_() const;
+  PROTOBUF_NAMESPACE_ID::Struct* _internal_mutable_struct_();
+  public:
+  void unsafe_arena_set_allocated_struct_(
+      PROTOBUF_NAMESPACE_ID::Struct* struct_);
+  PROTOBUF_NAMESPACE_ID::Struct* unsafe_arena_release_struct_();
+
+  // .google.protobuf.Timestamp timestamp = 3;
+  bool has_timestamp() const;
+  private:
+  bool _internal_has_timestamp() const;
+  public:
+  void clear_timestamp();
+  const PROTOBUF_NAMESPACE_ID::Timestamp& timestamp() const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* release_timestamp();
+  PROTOBUF_NAMESPACE_ID::Timestamp* mutable_timestamp();
+  void set_allocated_timestamp(PROTOBUF_NAMESPACE_ID::Timestamp* timestamp);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Timestamp& _internal_timestamp() const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* _internal_mutable_timestamp();
+  public:
+  void unsafe_arena_set_allocated_timestamp(
+      PROTOBUF_NAMESPACE_ID::Timestamp* timestamp);
+  PROTOBUF_NAMESPACE_ID::Timestamp* unsafe_arena_release_timestamp();
+
+  // .google.protobuf.Duration duration = 4;
+  bool has_duration() const;
+  private:
+  bool _internal_has_duration() const;
+  public:
+  void clear_duration();
+  const PROTOBUF_NAMESPACE_ID::Duration& duration() const;
+  PROTOBUF_NAMESPACE_ID::Duration* release_duration();
+  PROTOBUF_NAMESPACE_ID::Duration* mutable_duration();
+  void set_allocated_duration(PROTOBUF_NAMESPACE_ID::Duration* duration);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Duration& _internal_duration() const;
+  PROTOBUF_NAMESPACE_ID::Duration* _internal_mutable_duration();
+  public:
+  void unsafe_arena_set_allocated_duration(
+      PROTOBUF_NAMESPACE_ID::Duration* duration);
+  PROTOBUF_NAMESPACE_ID::Duration* unsafe_arena_release_duration();
+
+  // .google.protobuf.Int32Value i32 = 5;
+  bool has_i32() const;
+  private:
+  bool _internal_has_i32() const;
+  public:
+  void clear_i32();
+  const PROTOBUF_NAMESPACE_ID::Int32Value& i32() const;
+  PROTOBUF_NAMESPACE_ID::Int32Value* release_i32();
+  PROTOBUF_NAMESPACE_ID::Int32Value* mutable_i32();
+  void set_allocated_i32(PROTOBUF_NAMESPACE_ID::Int32Value* i32);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Int32Value& _internal_i32() const;
+  PROTOBUF_NAMESPACE_ID::Int32Value* _internal_mutable_i32();
+  public:
+  void unsafe_arena_set_allocated_i32(
+      PROTOBUF_NAMESPACE_ID::Int32Value* i32);
+  PROTOBUF_NAMESPACE_ID::Int32Value* unsafe_arena_release_i32();
+
+  // .proto_util_converter.testing.Data data = 100;
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const ::proto_util_converter::testing::Data& data() const;
+  ::proto_util_converter::testing::Data* release_data();
+  ::proto_util_converter::testing::Data* mutable_data();
+  void set_allocated_data(::proto_util_converter::testing::Data* data);
+  private:
+  const ::proto_util_converter::testing::Data& _internal_data() const;
+  ::proto_util_converter::testing::Data* _internal_mutable_data();
+  public:
+  void unsafe_arena_set_allocated_data(
+      ::proto_util_converter::testing::Data* data);
+  ::proto_util_converter::testing::Data* unsafe_arena_release_data();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Imports)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  PROTOBUF_NAMESPACE_ID::DoubleValue* dbl_;
+  PROTOBUF_NAMESPACE_ID::Struct* struct__;
+  PROTOBUF_NAMESPACE_ID::Timestamp* timestamp_;
+  PROTOBUF_NAMESPACE_ID::Duration* duration_;
+  PROTOBUF_NAMESPACE_ID::Int32Value* i32_;
+  ::proto_util_converter::testing::Data* data_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Data_MapDataEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Data_MapDataEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Data_MapDataEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    0 > SuperType;
+  Data_MapDataEntry_DoNotUse();
+  explicit Data_MapDataEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Data_MapDataEntry_DoNotUse& other);
+  static const Data_MapDataEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Data_MapDataEntry_DoNotUse*>(&_Data_MapDataEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.Data.MapDataEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "proto_util_converter.testing.Data.MapDataEntry.value");
+ }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.file_level_metadata[3];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class Data PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Data) */ {
+ public:
+  inline Data() : Data(nullptr) {};
+  virtual ~Data();
+
+  Data(const Data& from);
+  Data(Data&& from) noexcept
+    : Data() {
+    *this = ::std::move(from);
+  }
+
+  inline Data& operator=(const Data& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Data& operator=(Data&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Data& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Data* internal_default_instance() {
+    return reinterpret_cast<const Data*>(
+               &_Data_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(Data& a, Data& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Data* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Data* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Data* New() const final {
+    return CreateMaybeMessage<Data>(nullptr);
+  }
+
+  Data* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Data>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Data& from);
+  void MergeFrom(const Data& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Data* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Data";
+  }
+  protected:
+  explicit Data(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMsgsFieldNumber = 3,
+    kMapDataFieldNumber = 7,
+    kRepeatedDataFieldNumber = 9,
+    kRepeatedAnyFieldNumber = 10,
+    kStrFieldNumber = 2,
+    kNestedDataFieldNumber = 4,
+    kIntWrapperFieldNumber = 5,
+    kTimeFieldNumber = 6,
+    kStructDataFieldNumber = 8,
+    kAttrFieldNumber = 1,
+  };
+  // repeated string msgs = 3;
+  int msgs_size() const;
+  private:
+  int _internal_msgs_size() const;
+  public:
+  void clear_msgs();
+  const std::string& msgs(int index) const;
+  std::string* mutable_msgs(int index);
+  void set_msgs(int index, const std::string& value);
+  void set_msgs(int index, std::string&& value);
+  void set_msgs(int index, const char* value);
+  void set_msgs(int index, const char* value, size_t size);
+  std::string* add_msgs();
+  void add_msgs(const std::string& value);
+  void add_msgs(std::string&& value);
+  void add_msgs(const char* value);
+  void add_msgs(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& msgs() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_msgs();
+  private:
+  const std::string& _internal_msgs(int index) const;
+  std::string* _internal_add_msgs();
+  public:
+
+  // map<string, string> map_data = 7;
+  int map_data_size() const;
+  private:
+  int _internal_map_data_size() const;
+  public:
+  void clear_map_data();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_map_data() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_map_data();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      map_data() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_map_data();
+
+  // repeated .proto_util_converter.testing.Data repeated_data = 9;
+  int repeated_data_size() const;
+  private:
+  int _internal_repeated_data_size() const;
+  public:
+  void clear_repeated_data();
+  ::proto_util_converter::testing::Data* mutable_repeated_data(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Data >*
+      mutable_repeated_data();
+  private:
+  const ::proto_util_converter::testing::Data& _internal_repeated_data(int index) const;
+  ::proto_util_converter::testing::Data* _internal_add_repeated_data();
+  public:
+  const ::proto_util_converter::testing::Data& repeated_data(int index) const;
+  ::proto_util_converter::testing::Data* add_repeated_data();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Data >&
+      repeated_data() const;
+
+  // repeated .google.protobuf.Any repeated_any = 10;
+  int repeated_any_size() const;
+  private:
+  int _internal_repeated_any_size() const;
+  public:
+  void clear_repeated_any();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_repeated_any(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Any >*
+      mutable_repeated_any();
+  private:
+  const PROTOBUF_NAMESPACE_ID::Any& _internal_repeated_any(int index) const;
+  PROTOBUF_NAMESPACE_ID::Any* _internal_add_repeated_any();
+  public:
+  const PROTOBUF_NAMESPACE_ID::Any& repeated_any(int index) const;
+  PROTOBUF_NAMESPACE_ID::Any* add_repeated_any();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Any >&
+      repeated_any() const;
+
+  // string str = 2;
+  void clear_str();
+  const std::string& str() const;
+  void set_str(const std::string& value);
+  void set_str(std::string&& value);
+  void set_str(const char* value);
+  void set_str(const char* value, size_t size);
+  std::string* mutable_str();
+  std::string* release_str();
+  void set_allocated_str(std::string* str);
+  private:
+  const std::string& _internal_str() const;
+  void _internal_set_str(const std::string& value);
+  std::string* _internal_mutable_str();
+  public:
+
+  // .proto_util_converter.testing.Data nested_data = 4;
+  bool has_nested_data() const;
+  private:
+  bool _internal_has_nested_data() const;
+  public:
+  void clear_nested_data();
+  const ::proto_util_converter::testing::Data& nested_data() const;
+  ::proto_util_converter::testing::Data* release_nested_data();
+  ::proto_util_converter::testing::Data* mutable_nested_data();
+  void set_allocated_nested_data(::proto_util_converter::testing::Data* nested_data);
+  private:
+  const ::proto_util_converter::testing::Data& _internal_nested_data() const;
+  ::proto_util_converter::testing::Data* _internal_mutable_nested_data();
+  public:
+  void unsafe_arena_set_allocated_nested_data(
+      ::proto_util_converter::testing::Data* nested_data);
+  ::proto_util_converter::testing::Data* unsafe_arena_release_nested_data();
+
+  // .google.protobuf.Int32Value int_wrapper = 5;
+  bool has_int_wrapper() const;
+  private:
+  bool _internal_has_int_wrapper() const;
+  public:
+  void clear_int_wrapper();
+  const PROTOBUF_NAMESPACE_ID::Int32Value& int_wrapper() const;
+  PROTOBUF_NAMESPACE_ID::Int32Value* release_int_wrapper();
+  PROTOBUF_NAMESPACE_ID::Int32Value* mutable_int_wrapper();
+  void set_allocated_int_wrapper(PROTOBUF_NAMESPACE_ID::Int32Value* int_wrapper);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Int32Value& _internal_int_wrapper() const;
+  PROTOBUF_NAMESPACE_ID::Int32Value* _internal_mutable_int_wrapper();
+  public:
+  void unsafe_arena_set_allocated_int_wrapper(
+      PROTOBUF_NAMESPACE_ID::Int32Value* int_wrapper);
+  PROTOBUF_NAMESPACE_ID::Int32Value* unsafe_arena_release_int_wrapper();
+
+  // .google.protobuf.Timestamp time = 6;
+  bool has_time() const;
+  private:
+  bool _internal_has_time() const;
+  public:
+  void clear_time();
+  const PROTOBUF_NAMESPACE_ID::Timestamp& time() const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* release_time();
+  PROTOBUF_NAMESPACE_ID::Timestamp* mutable_time();
+  void set_allocated_time(PROTOBUF_NAMESPACE_ID::Timestamp* time);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Timestamp& _internal_time() const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* _internal_mutable_time();
+  public:
+  void unsafe_arena_set_allocated_time(
+      PROTOBUF_NAMESPACE_ID::Timestamp* time);
+  PROTOBUF_NAMESPACE_ID::Timestamp* unsafe_arena_release_time();
+
+  // .google.protobuf.Struct struct_data = 8;
+  bool has_struct_data() const;
+  private:
+  bool _internal_has_struct_data() const;
+  public:
+  void clear_struct_data();
+  const PROTOBUF_NAMESPACE_ID::Struct& struct_data() const;
+  PROTOBUF_NAMESPACE_ID::Struct* release_struct_data();
+  PROTOBUF_NAMESPACE_ID::Struct* mutable_struct_data();
+  void set_allocated_struct_data(PROTOBUF_NAMESPACE_ID::Struct* struct_data);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Struct& _internal_struct_data() const;
+  PROTOBUF_NAMESPACE_ID::Struct* _internal_mutable_struct_data();
+  public:
+  void unsafe_arena_set_allocated_struct_data(
+      PROTOBUF_NAMESPACE_ID::Struct* struct_data);
+  PROTOBUF_NAMESPACE_ID::Struct* unsafe_arena_release_struct_data();
+
+  // int32 attr = 1;
+  void clear_attr();
+  ::PROTOBUF_NAMESPACE_ID::int32 attr() const;
+  void set_attr(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_attr() const;
+  void _internal_set_attr(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Data)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> msgs_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      Data_MapDataEntry_DoNotUse,
+      std::string, std::string,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      0 > map_data_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Data > repeated_data_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Any > repeated_any_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr str_;
+  ::proto_util_converter::testing::Data* nested_data_;
+  PROTOBUF_NAMESPACE_ID::Int32Value* int_wrapper_;
+  PROTOBUF_NAMESPACE_ID::Timestamp* time_;
+  PROTOBUF_NAMESPACE_ID::Struct* struct_data_;
+  ::PROTOBUF_NAMESPACE_ID::int32 attr_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AnyIn PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.AnyIn) */ {
+ public:
+  inline AnyIn() : AnyIn(nullptr) {};
+  virtual ~AnyIn();
+
+  AnyIn(const AnyIn& from);
+  AnyIn(AnyIn&& from) noexcept
+    : AnyIn() {
+    *this = ::std::move(from);
+  }
+
+  inline AnyIn& operator=(const AnyIn& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AnyIn& operator=(AnyIn&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AnyIn& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AnyIn* internal_default_instance() {
+    return reinterpret_cast<const AnyIn*>(
+               &_AnyIn_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(AnyIn& a, AnyIn& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AnyIn* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AnyIn* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AnyIn* New() const final {
+    return CreateMaybeMessage<AnyIn>(nullptr);
+  }
+
+  AnyIn* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AnyIn>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AnyIn& from);
+  void MergeFrom(const AnyIn& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AnyIn* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.AnyIn";
+  }
+  protected:
+  explicit AnyIn(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSomethingFieldNumber = 1,
+    kAnyFieldNumber = 2,
+  };
+  // string something = 1;
+  void clear_something();
+  const std::string& something() const;
+  void set_something(const std::string& value);
+  void set_something(std::string&& value);
+  void set_something(const char* value);
+  void set_something(const char* value, size_t size);
+  std::string* mutable_something();
+  std::string* release_something();
+  void set_allocated_something(std::string* something);
+  private:
+  const std::string& _internal_something() const;
+  void _internal_set_something(const std::string& value);
+  std::string* _internal_mutable_something();
+  public:
+
+  // .google.protobuf.Any any = 2;
+  bool has_any() const;
+  private:
+  bool _internal_has_any() const;
+  public:
+  void clear_any();
+  const PROTOBUF_NAMESPACE_ID::Any& any() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_any();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_any();
+  void set_allocated_any(PROTOBUF_NAMESPACE_ID::Any* any);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Any& _internal_any() const;
+  PROTOBUF_NAMESPACE_ID::Any* _internal_mutable_any();
+  public:
+  void unsafe_arena_set_allocated_any(
+      PROTOBUF_NAMESPACE_ID::Any* any);
+  PROTOBUF_NAMESPACE_ID::Any* unsafe_arena_release_any();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.AnyIn)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr something_;
+  PROTOBUF_NAMESPACE_ID::Any* any_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AnyOut PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.AnyOut) */ {
+ public:
+  inline AnyOut() : AnyOut(nullptr) {};
+  virtual ~AnyOut();
+
+  AnyOut(const AnyOut& from);
+  AnyOut(AnyOut&& from) noexcept
+    : AnyOut() {
+    *this = ::std::move(from);
+  }
+
+  inline AnyOut& operator=(const AnyOut& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AnyOut& operator=(AnyOut&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AnyOut& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AnyOut* internal_default_instance() {
+    return reinterpret_cast<const AnyOut*>(
+               &_AnyOut_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(AnyOut& a, AnyOut& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AnyOut* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AnyOut* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AnyOut* New() const final {
+    return CreateMaybeMessage<AnyOut>(nullptr);
+  }
+
+  AnyOut* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AnyOut>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AnyOut& from);
+  void MergeFrom(const AnyOut& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AnyOut* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.AnyOut";
+  }
+  protected:
+  explicit AnyOut(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAnyFieldNumber = 1,
+  };
+  // .google.protobuf.Any any = 1;
+  bool has_any() const;
+  private:
+  bool _internal_has_any() const;
+  public:
+  void clear_any();
+  const PROTOBUF_NAMESPACE_ID::Any& any() const;
+  PROTOBUF_NAMESPACE_ID::Any* release_any();
+  PROTOBUF_NAMESPACE_ID::Any* mutable_any();
+  void set_allocated_any(PROTOBUF_NAMESPACE_ID::Any* any);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Any& _internal_any() const;
+  PROTOBUF_NAMESPACE_ID::Any* _internal_mutable_any();
+  public:
+  void unsafe_arena_set_allocated_any(
+      PROTOBUF_NAMESPACE_ID::Any* any);
+  PROTOBUF_NAMESPACE_ID::Any* unsafe_arena_release_any();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.AnyOut)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  PROTOBUF_NAMESPACE_ID::Any* any_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AnyM PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.AnyM) */ {
+ public:
+  inline AnyM() : AnyM(nullptr) {};
+  virtual ~AnyM();
+
+  AnyM(const AnyM& from);
+  AnyM(AnyM&& from) noexcept
+    : AnyM() {
+    *this = ::std::move(from);
+  }
+
+  inline AnyM& operator=(const AnyM& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AnyM& operator=(AnyM&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AnyM& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AnyM* internal_default_instance() {
+    return reinterpret_cast<const AnyM*>(
+               &_AnyM_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(AnyM& a, AnyM& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AnyM* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AnyM* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AnyM* New() const final {
+    return CreateMaybeMessage<AnyM>(nullptr);
+  }
+
+  AnyM* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AnyM>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AnyM& from);
+  void MergeFrom(const AnyM& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AnyM* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.AnyM";
+  }
+  protected:
+  explicit AnyM(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFooFieldNumber = 1,
+  };
+  // string foo = 1;
+  void clear_foo();
+  const std::string& foo() const;
+  void set_foo(const std::string& value);
+  void set_foo(std::string&& value);
+  void set_foo(const char* value);
+  void set_foo(const char* value, size_t size);
+  std::string* mutable_foo();
+  std::string* release_foo();
+  void set_allocated_foo(std::string* foo);
+  private:
+  const std::string& _internal_foo() const;
+  void _internal_set_foo(const std::string& value);
+  std::string* _internal_mutable_foo();
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.AnyM)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr foo_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// AnyTestCases
+
+// .proto_util_converter.testing.AnyWrapper empty_any = 1;
+inline bool AnyTestCases::_internal_has_empty_any() const {
+  return this != internal_default_instance() && empty_any_ != nullptr;
+}
+inline bool AnyTestCases::has_empty_any() const {
+  return _internal_has_empty_any();
+}
+inline void AnyTestCases::clear_empty_any() {
+  if (GetArena() == nullptr && empty_any_ != nullptr) {
+    delete empty_any_;
+  }
+  empty_any_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_empty_any() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = empty_any_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::empty_any() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.empty_any)
+  return _internal_empty_any();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_empty_any(
+    ::proto_util_converter::testing::AnyWrapper* empty_any) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(empty_any_);
+  }
+  empty_any_ = empty_any;
+  if (empty_any) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.empty_any)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_empty_any() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = empty_any_;
+  empty_any_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_empty_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.empty_any)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = empty_any_;
+  empty_any_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_empty_any() {
+  
+  if (empty_any_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    empty_any_ = p;
+  }
+  return empty_any_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_empty_any() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.empty_any)
+  return _internal_mutable_empty_any();
+}
+inline void AnyTestCases::set_allocated_empty_any(::proto_util_converter::testing::AnyWrapper* empty_any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete empty_any_;
+  }
+  if (empty_any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(empty_any);
+    if (message_arena != submessage_arena) {
+      empty_any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, empty_any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  empty_any_ = empty_any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.empty_any)
+}
+
+// .proto_util_converter.testing.AnyWrapper type_only_any = 2;
+inline bool AnyTestCases::_internal_has_type_only_any() const {
+  return this != internal_default_instance() && type_only_any_ != nullptr;
+}
+inline bool AnyTestCases::has_type_only_any() const {
+  return _internal_has_type_only_any();
+}
+inline void AnyTestCases::clear_type_only_any() {
+  if (GetArena() == nullptr && type_only_any_ != nullptr) {
+    delete type_only_any_;
+  }
+  type_only_any_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_type_only_any() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = type_only_any_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::type_only_any() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.type_only_any)
+  return _internal_type_only_any();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_type_only_any(
+    ::proto_util_converter::testing::AnyWrapper* type_only_any) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(type_only_any_);
+  }
+  type_only_any_ = type_only_any;
+  if (type_only_any) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.type_only_any)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_type_only_any() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = type_only_any_;
+  type_only_any_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_type_only_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.type_only_any)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = type_only_any_;
+  type_only_any_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_type_only_any() {
+  
+  if (type_only_any_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    type_only_any_ = p;
+  }
+  return type_only_any_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_type_only_any() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.type_only_any)
+  return _internal_mutable_type_only_any();
+}
+inline void AnyTestCases::set_allocated_type_only_any(::proto_util_converter::testing::AnyWrapper* type_only_any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete type_only_any_;
+  }
+  if (type_only_any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(type_only_any);
+    if (message_arena != submessage_arena) {
+      type_only_any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, type_only_any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  type_only_any_ = type_only_any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.type_only_any)
+}
+
+// .proto_util_converter.testing.AnyWrapper wrapper_any = 3;
+inline bool AnyTestCases::_internal_has_wrapper_any() const {
+  return this != internal_default_instance() && wrapper_any_ != nullptr;
+}
+inline bool AnyTestCases::has_wrapper_any() const {
+  return _internal_has_wrapper_any();
+}
+inline void AnyTestCases::clear_wrapper_any() {
+  if (GetArena() == nullptr && wrapper_any_ != nullptr) {
+    delete wrapper_any_;
+  }
+  wrapper_any_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_wrapper_any() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = wrapper_any_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::wrapper_any() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.wrapper_any)
+  return _internal_wrapper_any();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_wrapper_any(
+    ::proto_util_converter::testing::AnyWrapper* wrapper_any) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(wrapper_any_);
+  }
+  wrapper_any_ = wrapper_any;
+  if (wrapper_any) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.wrapper_any)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_wrapper_any() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = wrapper_any_;
+  wrapper_any_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_wrapper_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.wrapper_any)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = wrapper_any_;
+  wrapper_any_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_wrapper_any() {
+  
+  if (wrapper_any_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    wrapper_any_ = p;
+  }
+  return wrapper_any_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_wrapper_any() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.wrapper_any)
+  return _internal_mutable_wrapper_any();
+}
+inline void AnyTestCases::set_allocated_wrapper_any(::proto_util_converter::testing::AnyWrapper* wrapper_any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete wrapper_any_;
+  }
+  if (wrapper_any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(wrapper_any);
+    if (message_arena != submessage_arena) {
+      wrapper_any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, wrapper_any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  wrapper_any_ = wrapper_any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.wrapper_any)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_timestamp_value = 4;
+inline bool AnyTestCases::_internal_has_any_with_timestamp_value() const {
+  return this != internal_default_instance() && any_with_timestamp_value_ != nullptr;
+}
+inline bool AnyTestCases::has_any_with_timestamp_value() const {
+  return _internal_has_any_with_timestamp_value();
+}
+inline void AnyTestCases::clear_any_with_timestamp_value() {
+  if (GetArena() == nullptr && any_with_timestamp_value_ != nullptr) {
+    delete any_with_timestamp_value_;
+  }
+  any_with_timestamp_value_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_any_with_timestamp_value() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_timestamp_value_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_timestamp_value() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_timestamp_value)
+  return _internal_any_with_timestamp_value();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_any_with_timestamp_value(
+    ::proto_util_converter::testing::AnyWrapper* any_with_timestamp_value) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_with_timestamp_value_);
+  }
+  any_with_timestamp_value_ = any_with_timestamp_value;
+  if (any_with_timestamp_value) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_timestamp_value)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_timestamp_value() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_timestamp_value_;
+  any_with_timestamp_value_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_any_with_timestamp_value() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_timestamp_value)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_timestamp_value_;
+  any_with_timestamp_value_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_any_with_timestamp_value() {
+  
+  if (any_with_timestamp_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    any_with_timestamp_value_ = p;
+  }
+  return any_with_timestamp_value_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_timestamp_value() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_timestamp_value)
+  return _internal_mutable_any_with_timestamp_value();
+}
+inline void AnyTestCases::set_allocated_any_with_timestamp_value(::proto_util_converter::testing::AnyWrapper* any_with_timestamp_value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete any_with_timestamp_value_;
+  }
+  if (any_with_timestamp_value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(any_with_timestamp_value);
+    if (message_arena != submessage_arena) {
+      any_with_timestamp_value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_timestamp_value, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_timestamp_value_ = any_with_timestamp_value;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_timestamp_value)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_duration_value = 5;
+inline bool AnyTestCases::_internal_has_any_with_duration_value() const {
+  return this != internal_default_instance() && any_with_duration_value_ != nullptr;
+}
+inline bool AnyTestCases::has_any_with_duration_value() const {
+  return _internal_has_any_with_duration_value();
+}
+inline void AnyTestCases::clear_any_with_duration_value() {
+  if (GetArena() == nullptr && any_with_duration_value_ != nullptr) {
+    delete any_with_duration_value_;
+  }
+  any_with_duration_value_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_any_with_duration_value() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_duration_value_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_duration_value() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_duration_value)
+  return _internal_any_with_duration_value();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_any_with_duration_value(
+    ::proto_util_converter::testing::AnyWrapper* any_with_duration_value) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_with_duration_value_);
+  }
+  any_with_duration_value_ = any_with_duration_value;
+  if (any_with_duration_value) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_duration_value)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_duration_value() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_duration_value_;
+  any_with_duration_value_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_any_with_duration_value() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_duration_value)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_duration_value_;
+  any_with_duration_value_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_any_with_duration_value() {
+  
+  if (any_with_duration_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    any_with_duration_value_ = p;
+  }
+  return any_with_duration_value_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_duration_value() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_duration_value)
+  return _internal_mutable_any_with_duration_value();
+}
+inline void AnyTestCases::set_allocated_any_with_duration_value(::proto_util_converter::testing::AnyWrapper* any_with_duration_value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete any_with_duration_value_;
+  }
+  if (any_with_duration_value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(any_with_duration_value);
+    if (message_arena != submessage_arena) {
+      any_with_duration_value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_duration_value, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_duration_value_ = any_with_duration_value;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_duration_value)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_struct_value = 6;
+inline bool AnyTestCases::_internal_has_any_with_struct_value() const {
+  return this != internal_default_instance() && any_with_struct_value_ != nullptr;
+}
+inline bool AnyTestCases::has_any_with_struct_value() const {
+  return _internal_has_any_with_struct_value();
+}
+inline void AnyTestCases::clear_any_with_struct_value() {
+  if (GetArena() == nullptr && any_with_struct_value_ != nullptr) {
+    delete any_with_struct_value_;
+  }
+  any_with_struct_value_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_any_with_struct_value() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_struct_value_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_struct_value() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_struct_value)
+  return _internal_any_with_struct_value();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_any_with_struct_value(
+    ::proto_util_converter::testing::AnyWrapper* any_with_struct_value) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_with_struct_value_);
+  }
+  any_with_struct_value_ = any_with_struct_value;
+  if (any_with_struct_value) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_struct_value)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_struct_value() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_struct_value_;
+  any_with_struct_value_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_any_with_struct_value() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_struct_value)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_struct_value_;
+  any_with_struct_value_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_any_with_struct_value() {
+  
+  if (any_with_struct_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    any_with_struct_value_ = p;
+  }
+  return any_with_struct_value_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_struct_value() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_struct_value)
+  return _internal_mutable_any_with_struct_value();
+}
+inline void AnyTestCases::set_allocated_any_with_struct_value(::proto_util_converter::testing::AnyWrapper* any_with_struct_value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete any_with_struct_value_;
+  }
+  if (any_with_struct_value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(any_with_struct_value);
+    if (message_arena != submessage_arena) {
+      any_with_struct_value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_struct_value, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_struct_value_ = any_with_struct_value;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_struct_value)
+}
+
+// .proto_util_converter.testing.AnyWrapper recursive_any = 7;
+inline bool AnyTestCases::_internal_has_recursive_any() const {
+  return this != internal_default_instance() && recursive_any_ != nullptr;
+}
+inline bool AnyTestCases::has_recursive_any() const {
+  return _internal_has_recursive_any();
+}
+inline void AnyTestCases::clear_recursive_any() {
+  if (GetArena() == nullptr && recursive_any_ != nullptr) {
+    delete recursive_any_;
+  }
+  recursive_any_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_recursive_any() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = recursive_any_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::recursive_any() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.recursive_any)
+  return _internal_recursive_any();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_recursive_any(
+    ::proto_util_converter::testing::AnyWrapper* recursive_any) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(recursive_any_);
+  }
+  recursive_any_ = recursive_any;
+  if (recursive_any) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.recursive_any)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_recursive_any() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = recursive_any_;
+  recursive_any_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_recursive_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.recursive_any)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = recursive_any_;
+  recursive_any_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_recursive_any() {
+  
+  if (recursive_any_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    recursive_any_ = p;
+  }
+  return recursive_any_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_recursive_any() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.recursive_any)
+  return _internal_mutable_recursive_any();
+}
+inline void AnyTestCases::set_allocated_recursive_any(::proto_util_converter::testing::AnyWrapper* recursive_any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete recursive_any_;
+  }
+  if (recursive_any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(recursive_any);
+    if (message_arena != submessage_arena) {
+      recursive_any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, recursive_any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  recursive_any_ = recursive_any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.recursive_any)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_message_value = 8;
+inline bool AnyTestCases::_internal_has_any_with_message_value() const {
+  return this != internal_default_instance() && any_with_message_value_ != nullptr;
+}
+inline bool AnyTestCases::has_any_with_message_value() const {
+  return _internal_has_any_with_message_value();
+}
+inline void AnyTestCases::clear_any_with_message_value() {
+  if (GetArena() == nullptr && any_with_message_value_ != nullptr) {
+    delete any_with_message_value_;
+  }
+  any_with_message_value_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_any_with_message_value() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_message_value_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_message_value() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_message_value)
+  return _internal_any_with_message_value();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_any_with_message_value(
+    ::proto_util_converter::testing::AnyWrapper* any_with_message_value) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_with_message_value_);
+  }
+  any_with_message_value_ = any_with_message_value;
+  if (any_with_message_value) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_value)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_message_value() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_value_;
+  any_with_message_value_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_any_with_message_value() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_message_value)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_value_;
+  any_with_message_value_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_any_with_message_value() {
+  
+  if (any_with_message_value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    any_with_message_value_ = p;
+  }
+  return any_with_message_value_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_message_value() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_message_value)
+  return _internal_mutable_any_with_message_value();
+}
+inline void AnyTestCases::set_allocated_any_with_message_value(::proto_util_converter::testing::AnyWrapper* any_with_message_value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete any_with_message_value_;
+  }
+  if (any_with_message_value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(any_with_message_value);
+    if (message_arena != submessage_arena) {
+      any_with_message_value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_message_value, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_message_value_ = any_with_message_value;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_value)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_nested_message = 9;
+inline bool AnyTestCases::_internal_has_any_with_nested_message() const {
+  return this != internal_default_instance() && any_with_nested_message_ != nullptr;
+}
+inline bool AnyTestCases::has_any_with_nested_message() const {
+  return _internal_has_any_with_nested_message();
+}
+inline void AnyTestCases::clear_any_with_nested_message() {
+  if (GetArena() == nullptr && any_with_nested_message_ != nullptr) {
+    delete any_with_nested_message_;
+  }
+  any_with_nested_message_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_any_with_nested_message() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_nested_message_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_nested_message() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_nested_message)
+  return _internal_any_with_nested_message();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_any_with_nested_message(
+    ::proto_util_converter::testing::AnyWrapper* any_with_nested_message) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_with_nested_message_);
+  }
+  any_with_nested_message_ = any_with_nested_message;
+  if (any_with_nested_message) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_nested_message)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_nested_message() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_nested_message_;
+  any_with_nested_message_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_any_with_nested_message() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_nested_message)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_nested_message_;
+  any_with_nested_message_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_any_with_nested_message() {
+  
+  if (any_with_nested_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    any_with_nested_message_ = p;
+  }
+  return any_with_nested_message_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_nested_message() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_nested_message)
+  return _internal_mutable_any_with_nested_message();
+}
+inline void AnyTestCases::set_allocated_any_with_nested_message(::proto_util_converter::testing::AnyWrapper* any_with_nested_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete any_with_nested_message_;
+  }
+  if (any_with_nested_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(any_with_nested_message);
+    if (message_arena != submessage_arena) {
+      any_with_nested_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_nested_message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_nested_message_ = any_with_nested_message;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_nested_message)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_message_with_wrapper_type = 10;
+inline bool AnyTestCases::_internal_has_any_with_message_with_wrapper_type() const {
+  return this != internal_default_instance() && any_with_message_with_wrapper_type_ != nullptr;
+}
+inline bool AnyTestCases::has_any_with_message_with_wrapper_type() const {
+  return _internal_has_any_with_message_with_wrapper_type();
+}
+inline void AnyTestCases::clear_any_with_message_with_wrapper_type() {
+  if (GetArena() == nullptr && any_with_message_with_wrapper_type_ != nullptr) {
+    delete any_with_message_with_wrapper_type_;
+  }
+  any_with_message_with_wrapper_type_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_any_with_message_with_wrapper_type() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_message_with_wrapper_type_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_message_with_wrapper_type() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_message_with_wrapper_type)
+  return _internal_any_with_message_with_wrapper_type();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_any_with_message_with_wrapper_type(
+    ::proto_util_converter::testing::AnyWrapper* any_with_message_with_wrapper_type) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_with_message_with_wrapper_type_);
+  }
+  any_with_message_with_wrapper_type_ = any_with_message_with_wrapper_type;
+  if (any_with_message_with_wrapper_type) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_with_wrapper_type)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_message_with_wrapper_type() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_with_wrapper_type_;
+  any_with_message_with_wrapper_type_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_any_with_message_with_wrapper_type() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_message_with_wrapper_type)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_with_wrapper_type_;
+  any_with_message_with_wrapper_type_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_any_with_message_with_wrapper_type() {
+  
+  if (any_with_message_with_wrapper_type_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    any_with_message_with_wrapper_type_ = p;
+  }
+  return any_with_message_with_wrapper_type_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_message_with_wrapper_type() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_message_with_wrapper_type)
+  return _internal_mutable_any_with_message_with_wrapper_type();
+}
+inline void AnyTestCases::set_allocated_any_with_message_with_wrapper_type(::proto_util_converter::testing::AnyWrapper* any_with_message_with_wrapper_type) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete any_with_message_with_wrapper_type_;
+  }
+  if (any_with_message_with_wrapper_type) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(any_with_message_with_wrapper_type);
+    if (message_arena != submessage_arena) {
+      any_with_message_with_wrapper_type = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_message_with_wrapper_type, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_message_with_wrapper_type_ = any_with_message_with_wrapper_type;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_with_wrapper_type)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_message_with_timestamp = 11;
+inline bool AnyTestCases::_internal_has_any_with_message_with_timestamp() const {
+  return this != internal_default_instance() && any_with_message_with_timestamp_ != nullptr;
+}
+inline bool AnyTestCases::has_any_with_message_with_timestamp() const {
+  return _internal_has_any_with_message_with_timestamp();
+}
+inline void AnyTestCases::clear_any_with_message_with_timestamp() {
+  if (GetArena() == nullptr && any_with_message_with_timestamp_ != nullptr) {
+    delete any_with_message_with_timestamp_;
+  }
+  any_with_message_with_timestamp_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_any_with_message_with_timestamp() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_message_with_timestamp_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_message_with_timestamp() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_message_with_timestamp)
+  return _internal_any_with_message_with_timestamp();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_any_with_message_with_timestamp(
+    ::proto_util_converter::testing::AnyWrapper* any_with_message_with_timestamp) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_with_message_with_timestamp_);
+  }
+  any_with_message_with_timestamp_ = any_with_message_with_timestamp;
+  if (any_with_message_with_timestamp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_with_timestamp)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_message_with_timestamp() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_with_timestamp_;
+  any_with_message_with_timestamp_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_any_with_message_with_timestamp() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_message_with_timestamp)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_with_timestamp_;
+  any_with_message_with_timestamp_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_any_with_message_with_timestamp() {
+  
+  if (any_with_message_with_timestamp_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    any_with_message_with_timestamp_ = p;
+  }
+  return any_with_message_with_timestamp_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_message_with_timestamp() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_message_with_timestamp)
+  return _internal_mutable_any_with_message_with_timestamp();
+}
+inline void AnyTestCases::set_allocated_any_with_message_with_timestamp(::proto_util_converter::testing::AnyWrapper* any_with_message_with_timestamp) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete any_with_message_with_timestamp_;
+  }
+  if (any_with_message_with_timestamp) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(any_with_message_with_timestamp);
+    if (message_arena != submessage_arena) {
+      any_with_message_with_timestamp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_message_with_timestamp, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_message_with_timestamp_ = any_with_message_with_timestamp;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_with_timestamp)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_message_containing_map = 12;
+inline bool AnyTestCases::_internal_has_any_with_message_containing_map() const {
+  return this != internal_default_instance() && any_with_message_containing_map_ != nullptr;
+}
+inline bool AnyTestCases::has_any_with_message_containing_map() const {
+  return _internal_has_any_with_message_containing_map();
+}
+inline void AnyTestCases::clear_any_with_message_containing_map() {
+  if (GetArena() == nullptr && any_with_message_containing_map_ != nullptr) {
+    delete any_with_message_containing_map_;
+  }
+  any_with_message_containing_map_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_any_with_message_containing_map() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_message_containing_map_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_message_containing_map() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_message_containing_map)
+  return _internal_any_with_message_containing_map();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_any_with_message_containing_map(
+    ::proto_util_converter::testing::AnyWrapper* any_with_message_containing_map) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_with_message_containing_map_);
+  }
+  any_with_message_containing_map_ = any_with_message_containing_map;
+  if (any_with_message_containing_map) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_containing_map)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_message_containing_map() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_containing_map_;
+  any_with_message_containing_map_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_any_with_message_containing_map() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_message_containing_map)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_containing_map_;
+  any_with_message_containing_map_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_any_with_message_containing_map() {
+  
+  if (any_with_message_containing_map_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    any_with_message_containing_map_ = p;
+  }
+  return any_with_message_containing_map_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_message_containing_map() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_message_containing_map)
+  return _internal_mutable_any_with_message_containing_map();
+}
+inline void AnyTestCases::set_allocated_any_with_message_containing_map(::proto_util_converter::testing::AnyWrapper* any_with_message_containing_map) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete any_with_message_containing_map_;
+  }
+  if (any_with_message_containing_map) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(any_with_message_containing_map);
+    if (message_arena != submessage_arena) {
+      any_with_message_containing_map = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_message_containing_map, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_message_containing_map_ = any_with_message_containing_map;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_containing_map)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_message_containing_struct = 13;
+inline bool AnyTestCases::_internal_has_any_with_message_containing_struct() const {
+  return this != internal_default_instance() && any_with_message_containing_struct_ != nullptr;
+}
+inline bool AnyTestCases::has_any_with_message_containing_struct() const {
+  return _internal_has_any_with_message_containing_struct();
+}
+inline void AnyTestCases::clear_any_with_message_containing_struct() {
+  if (GetArena() == nullptr && any_with_message_containing_struct_ != nullptr) {
+    delete any_with_message_containing_struct_;
+  }
+  any_with_message_containing_struct_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_any_with_message_containing_struct() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_message_containing_struct_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_message_containing_struct() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_message_containing_struct)
+  return _internal_any_with_message_containing_struct();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_any_with_message_containing_struct(
+    ::proto_util_converter::testing::AnyWrapper* any_with_message_containing_struct) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_with_message_containing_struct_);
+  }
+  any_with_message_containing_struct_ = any_with_message_containing_struct;
+  if (any_with_message_containing_struct) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_containing_struct)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_message_containing_struct() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_containing_struct_;
+  any_with_message_containing_struct_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_any_with_message_containing_struct() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_message_containing_struct)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_containing_struct_;
+  any_with_message_containing_struct_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_any_with_message_containing_struct() {
+  
+  if (any_with_message_containing_struct_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    any_with_message_containing_struct_ = p;
+  }
+  return any_with_message_containing_struct_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_message_containing_struct() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_message_containing_struct)
+  return _internal_mutable_any_with_message_containing_struct();
+}
+inline void AnyTestCases::set_allocated_any_with_message_containing_struct(::proto_util_converter::testing::AnyWrapper* any_with_message_containing_struct) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete any_with_message_containing_struct_;
+  }
+  if (any_with_message_containing_struct) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(any_with_message_containing_struct);
+    if (message_arena != submessage_arena) {
+      any_with_message_containing_struct = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_message_containing_struct, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_message_containing_struct_ = any_with_message_containing_struct;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_containing_struct)
+}
+
+// .proto_util_converter.testing.AnyWrapper any_with_message_containing_repeated_message = 14;
+inline bool AnyTestCases::_internal_has_any_with_message_containing_repeated_message() const {
+  return this != internal_default_instance() && any_with_message_containing_repeated_message_ != nullptr;
+}
+inline bool AnyTestCases::has_any_with_message_containing_repeated_message() const {
+  return _internal_has_any_with_message_containing_repeated_message();
+}
+inline void AnyTestCases::clear_any_with_message_containing_repeated_message() {
+  if (GetArena() == nullptr && any_with_message_containing_repeated_message_ != nullptr) {
+    delete any_with_message_containing_repeated_message_;
+  }
+  any_with_message_containing_repeated_message_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_any_with_message_containing_repeated_message() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = any_with_message_containing_repeated_message_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::any_with_message_containing_repeated_message() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.any_with_message_containing_repeated_message)
+  return _internal_any_with_message_containing_repeated_message();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_any_with_message_containing_repeated_message(
+    ::proto_util_converter::testing::AnyWrapper* any_with_message_containing_repeated_message) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_with_message_containing_repeated_message_);
+  }
+  any_with_message_containing_repeated_message_ = any_with_message_containing_repeated_message;
+  if (any_with_message_containing_repeated_message) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_containing_repeated_message)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_any_with_message_containing_repeated_message() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_containing_repeated_message_;
+  any_with_message_containing_repeated_message_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_any_with_message_containing_repeated_message() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.any_with_message_containing_repeated_message)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = any_with_message_containing_repeated_message_;
+  any_with_message_containing_repeated_message_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_any_with_message_containing_repeated_message() {
+  
+  if (any_with_message_containing_repeated_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    any_with_message_containing_repeated_message_ = p;
+  }
+  return any_with_message_containing_repeated_message_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_any_with_message_containing_repeated_message() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.any_with_message_containing_repeated_message)
+  return _internal_mutable_any_with_message_containing_repeated_message();
+}
+inline void AnyTestCases::set_allocated_any_with_message_containing_repeated_message(::proto_util_converter::testing::AnyWrapper* any_with_message_containing_repeated_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete any_with_message_containing_repeated_message_;
+  }
+  if (any_with_message_containing_repeated_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(any_with_message_containing_repeated_message);
+    if (message_arena != submessage_arena) {
+      any_with_message_containing_repeated_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any_with_message_containing_repeated_message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_with_message_containing_repeated_message_ = any_with_message_containing_repeated_message;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.any_with_message_containing_repeated_message)
+}
+
+// .proto_util_converter.testing.AnyWrapper recursive_any_with_type_field_at_end = 15;
+inline bool AnyTestCases::_internal_has_recursive_any_with_type_field_at_end() const {
+  return this != internal_default_instance() && recursive_any_with_type_field_at_end_ != nullptr;
+}
+inline bool AnyTestCases::has_recursive_any_with_type_field_at_end() const {
+  return _internal_has_recursive_any_with_type_field_at_end();
+}
+inline void AnyTestCases::clear_recursive_any_with_type_field_at_end() {
+  if (GetArena() == nullptr && recursive_any_with_type_field_at_end_ != nullptr) {
+    delete recursive_any_with_type_field_at_end_;
+  }
+  recursive_any_with_type_field_at_end_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_recursive_any_with_type_field_at_end() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = recursive_any_with_type_field_at_end_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::recursive_any_with_type_field_at_end() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.recursive_any_with_type_field_at_end)
+  return _internal_recursive_any_with_type_field_at_end();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_recursive_any_with_type_field_at_end(
+    ::proto_util_converter::testing::AnyWrapper* recursive_any_with_type_field_at_end) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(recursive_any_with_type_field_at_end_);
+  }
+  recursive_any_with_type_field_at_end_ = recursive_any_with_type_field_at_end;
+  if (recursive_any_with_type_field_at_end) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.recursive_any_with_type_field_at_end)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_recursive_any_with_type_field_at_end() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = recursive_any_with_type_field_at_end_;
+  recursive_any_with_type_field_at_end_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_recursive_any_with_type_field_at_end() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.recursive_any_with_type_field_at_end)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = recursive_any_with_type_field_at_end_;
+  recursive_any_with_type_field_at_end_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_recursive_any_with_type_field_at_end() {
+  
+  if (recursive_any_with_type_field_at_end_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    recursive_any_with_type_field_at_end_ = p;
+  }
+  return recursive_any_with_type_field_at_end_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_recursive_any_with_type_field_at_end() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.recursive_any_with_type_field_at_end)
+  return _internal_mutable_recursive_any_with_type_field_at_end();
+}
+inline void AnyTestCases::set_allocated_recursive_any_with_type_field_at_end(::proto_util_converter::testing::AnyWrapper* recursive_any_with_type_field_at_end) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete recursive_any_with_type_field_at_end_;
+  }
+  if (recursive_any_with_type_field_at_end) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(recursive_any_with_type_field_at_end);
+    if (message_arena != submessage_arena) {
+      recursive_any_with_type_field_at_end = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, recursive_any_with_type_field_at_end, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  recursive_any_with_type_field_at_end_ = recursive_any_with_type_field_at_end;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.recursive_any_with_type_field_at_end)
+}
+
+// .proto_util_converter.testing.AnyWrapper repeated_any = 16;
+inline bool AnyTestCases::_internal_has_repeated_any() const {
+  return this != internal_default_instance() && repeated_any_ != nullptr;
+}
+inline bool AnyTestCases::has_repeated_any() const {
+  return _internal_has_repeated_any();
+}
+inline void AnyTestCases::clear_repeated_any() {
+  if (GetArena() == nullptr && repeated_any_ != nullptr) {
+    delete repeated_any_;
+  }
+  repeated_any_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_repeated_any() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = repeated_any_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::repeated_any() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.repeated_any)
+  return _internal_repeated_any();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_repeated_any(
+    ::proto_util_converter::testing::AnyWrapper* repeated_any) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(repeated_any_);
+  }
+  repeated_any_ = repeated_any;
+  if (repeated_any) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.repeated_any)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_repeated_any() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = repeated_any_;
+  repeated_any_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_repeated_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.repeated_any)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = repeated_any_;
+  repeated_any_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_repeated_any() {
+  
+  if (repeated_any_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    repeated_any_ = p;
+  }
+  return repeated_any_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_repeated_any() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.repeated_any)
+  return _internal_mutable_repeated_any();
+}
+inline void AnyTestCases::set_allocated_repeated_any(::proto_util_converter::testing::AnyWrapper* repeated_any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete repeated_any_;
+  }
+  if (repeated_any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(repeated_any);
+    if (message_arena != submessage_arena) {
+      repeated_any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, repeated_any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  repeated_any_ = repeated_any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.repeated_any)
+}
+
+// .proto_util_converter.testing.AnyWrapper empty_any_with_null_type_url = 17;
+inline bool AnyTestCases::_internal_has_empty_any_with_null_type_url() const {
+  return this != internal_default_instance() && empty_any_with_null_type_url_ != nullptr;
+}
+inline bool AnyTestCases::has_empty_any_with_null_type_url() const {
+  return _internal_has_empty_any_with_null_type_url();
+}
+inline void AnyTestCases::clear_empty_any_with_null_type_url() {
+  if (GetArena() == nullptr && empty_any_with_null_type_url_ != nullptr) {
+    delete empty_any_with_null_type_url_;
+  }
+  empty_any_with_null_type_url_ = nullptr;
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::_internal_empty_any_with_null_type_url() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = empty_any_with_null_type_url_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& AnyTestCases::empty_any_with_null_type_url() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.empty_any_with_null_type_url)
+  return _internal_empty_any_with_null_type_url();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_empty_any_with_null_type_url(
+    ::proto_util_converter::testing::AnyWrapper* empty_any_with_null_type_url) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(empty_any_with_null_type_url_);
+  }
+  empty_any_with_null_type_url_ = empty_any_with_null_type_url;
+  if (empty_any_with_null_type_url) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.empty_any_with_null_type_url)
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::release_empty_any_with_null_type_url() {
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = empty_any_with_null_type_url_;
+  empty_any_with_null_type_url_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::unsafe_arena_release_empty_any_with_null_type_url() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.empty_any_with_null_type_url)
+  
+  ::proto_util_converter::testing::AnyWrapper* temp = empty_any_with_null_type_url_;
+  empty_any_with_null_type_url_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::_internal_mutable_empty_any_with_null_type_url() {
+  
+  if (empty_any_with_null_type_url_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    empty_any_with_null_type_url_ = p;
+  }
+  return empty_any_with_null_type_url_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* AnyTestCases::mutable_empty_any_with_null_type_url() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.empty_any_with_null_type_url)
+  return _internal_mutable_empty_any_with_null_type_url();
+}
+inline void AnyTestCases::set_allocated_empty_any_with_null_type_url(::proto_util_converter::testing::AnyWrapper* empty_any_with_null_type_url) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete empty_any_with_null_type_url_;
+  }
+  if (empty_any_with_null_type_url) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(empty_any_with_null_type_url);
+    if (message_arena != submessage_arena) {
+      empty_any_with_null_type_url = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, empty_any_with_null_type_url, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  empty_any_with_null_type_url_ = empty_any_with_null_type_url;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.empty_any_with_null_type_url)
+}
+
+// .google.protobuf.Any top_level_any = 50;
+inline bool AnyTestCases::_internal_has_top_level_any() const {
+  return this != internal_default_instance() && top_level_any_ != nullptr;
+}
+inline bool AnyTestCases::has_top_level_any() const {
+  return _internal_has_top_level_any();
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyTestCases::_internal_top_level_any() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = top_level_any_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyTestCases::top_level_any() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.top_level_any)
+  return _internal_top_level_any();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_top_level_any(
+    PROTOBUF_NAMESPACE_ID::Any* top_level_any) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_);
+  }
+  top_level_any_ = top_level_any;
+  if (top_level_any) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.top_level_any)
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::release_top_level_any() {
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = top_level_any_;
+  top_level_any_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::unsafe_arena_release_top_level_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.top_level_any)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = top_level_any_;
+  top_level_any_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::_internal_mutable_top_level_any() {
+  
+  if (top_level_any_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArena());
+    top_level_any_ = p;
+  }
+  return top_level_any_;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::mutable_top_level_any() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.top_level_any)
+  return _internal_mutable_top_level_any();
+}
+inline void AnyTestCases::set_allocated_top_level_any(PROTOBUF_NAMESPACE_ID::Any* top_level_any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_);
+  }
+  if (top_level_any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any)->GetArena();
+    if (message_arena != submessage_arena) {
+      top_level_any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, top_level_any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  top_level_any_ = top_level_any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.top_level_any)
+}
+
+// .google.protobuf.Any top_level_any_with_type_field_at_end = 51;
+inline bool AnyTestCases::_internal_has_top_level_any_with_type_field_at_end() const {
+  return this != internal_default_instance() && top_level_any_with_type_field_at_end_ != nullptr;
+}
+inline bool AnyTestCases::has_top_level_any_with_type_field_at_end() const {
+  return _internal_has_top_level_any_with_type_field_at_end();
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyTestCases::_internal_top_level_any_with_type_field_at_end() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = top_level_any_with_type_field_at_end_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyTestCases::top_level_any_with_type_field_at_end() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.top_level_any_with_type_field_at_end)
+  return _internal_top_level_any_with_type_field_at_end();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_top_level_any_with_type_field_at_end(
+    PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_type_field_at_end) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_with_type_field_at_end_);
+  }
+  top_level_any_with_type_field_at_end_ = top_level_any_with_type_field_at_end;
+  if (top_level_any_with_type_field_at_end) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.top_level_any_with_type_field_at_end)
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::release_top_level_any_with_type_field_at_end() {
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = top_level_any_with_type_field_at_end_;
+  top_level_any_with_type_field_at_end_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::unsafe_arena_release_top_level_any_with_type_field_at_end() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.top_level_any_with_type_field_at_end)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = top_level_any_with_type_field_at_end_;
+  top_level_any_with_type_field_at_end_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::_internal_mutable_top_level_any_with_type_field_at_end() {
+  
+  if (top_level_any_with_type_field_at_end_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArena());
+    top_level_any_with_type_field_at_end_ = p;
+  }
+  return top_level_any_with_type_field_at_end_;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::mutable_top_level_any_with_type_field_at_end() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.top_level_any_with_type_field_at_end)
+  return _internal_mutable_top_level_any_with_type_field_at_end();
+}
+inline void AnyTestCases::set_allocated_top_level_any_with_type_field_at_end(PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_type_field_at_end) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_with_type_field_at_end_);
+  }
+  if (top_level_any_with_type_field_at_end) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_with_type_field_at_end)->GetArena();
+    if (message_arena != submessage_arena) {
+      top_level_any_with_type_field_at_end = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, top_level_any_with_type_field_at_end, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  top_level_any_with_type_field_at_end_ = top_level_any_with_type_field_at_end;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.top_level_any_with_type_field_at_end)
+}
+
+// .google.protobuf.Any top_level_any_with_pivot_one = 52;
+inline bool AnyTestCases::_internal_has_top_level_any_with_pivot_one() const {
+  return this != internal_default_instance() && top_level_any_with_pivot_one_ != nullptr;
+}
+inline bool AnyTestCases::has_top_level_any_with_pivot_one() const {
+  return _internal_has_top_level_any_with_pivot_one();
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyTestCases::_internal_top_level_any_with_pivot_one() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = top_level_any_with_pivot_one_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyTestCases::top_level_any_with_pivot_one() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_one)
+  return _internal_top_level_any_with_pivot_one();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_top_level_any_with_pivot_one(
+    PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_one) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_with_pivot_one_);
+  }
+  top_level_any_with_pivot_one_ = top_level_any_with_pivot_one;
+  if (top_level_any_with_pivot_one) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_one)
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::release_top_level_any_with_pivot_one() {
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = top_level_any_with_pivot_one_;
+  top_level_any_with_pivot_one_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::unsafe_arena_release_top_level_any_with_pivot_one() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_one)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = top_level_any_with_pivot_one_;
+  top_level_any_with_pivot_one_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::_internal_mutable_top_level_any_with_pivot_one() {
+  
+  if (top_level_any_with_pivot_one_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArena());
+    top_level_any_with_pivot_one_ = p;
+  }
+  return top_level_any_with_pivot_one_;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::mutable_top_level_any_with_pivot_one() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_one)
+  return _internal_mutable_top_level_any_with_pivot_one();
+}
+inline void AnyTestCases::set_allocated_top_level_any_with_pivot_one(PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_one) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_with_pivot_one_);
+  }
+  if (top_level_any_with_pivot_one) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_with_pivot_one)->GetArena();
+    if (message_arena != submessage_arena) {
+      top_level_any_with_pivot_one = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, top_level_any_with_pivot_one, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  top_level_any_with_pivot_one_ = top_level_any_with_pivot_one;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_one)
+}
+
+// .google.protobuf.Any top_level_any_with_pivot_two = 53;
+inline bool AnyTestCases::_internal_has_top_level_any_with_pivot_two() const {
+  return this != internal_default_instance() && top_level_any_with_pivot_two_ != nullptr;
+}
+inline bool AnyTestCases::has_top_level_any_with_pivot_two() const {
+  return _internal_has_top_level_any_with_pivot_two();
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyTestCases::_internal_top_level_any_with_pivot_two() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = top_level_any_with_pivot_two_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyTestCases::top_level_any_with_pivot_two() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_two)
+  return _internal_top_level_any_with_pivot_two();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_top_level_any_with_pivot_two(
+    PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_two) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_with_pivot_two_);
+  }
+  top_level_any_with_pivot_two_ = top_level_any_with_pivot_two;
+  if (top_level_any_with_pivot_two) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_two)
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::release_top_level_any_with_pivot_two() {
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = top_level_any_with_pivot_two_;
+  top_level_any_with_pivot_two_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::unsafe_arena_release_top_level_any_with_pivot_two() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_two)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = top_level_any_with_pivot_two_;
+  top_level_any_with_pivot_two_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::_internal_mutable_top_level_any_with_pivot_two() {
+  
+  if (top_level_any_with_pivot_two_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArena());
+    top_level_any_with_pivot_two_ = p;
+  }
+  return top_level_any_with_pivot_two_;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::mutable_top_level_any_with_pivot_two() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_two)
+  return _internal_mutable_top_level_any_with_pivot_two();
+}
+inline void AnyTestCases::set_allocated_top_level_any_with_pivot_two(PROTOBUF_NAMESPACE_ID::Any* top_level_any_with_pivot_two) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_with_pivot_two_);
+  }
+  if (top_level_any_with_pivot_two) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_with_pivot_two)->GetArena();
+    if (message_arena != submessage_arena) {
+      top_level_any_with_pivot_two = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, top_level_any_with_pivot_two, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  top_level_any_with_pivot_two_ = top_level_any_with_pivot_two;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.top_level_any_with_pivot_two)
+}
+
+// .google.protobuf.Any top_level_any_unordered = 54;
+inline bool AnyTestCases::_internal_has_top_level_any_unordered() const {
+  return this != internal_default_instance() && top_level_any_unordered_ != nullptr;
+}
+inline bool AnyTestCases::has_top_level_any_unordered() const {
+  return _internal_has_top_level_any_unordered();
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyTestCases::_internal_top_level_any_unordered() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = top_level_any_unordered_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyTestCases::top_level_any_unordered() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyTestCases.top_level_any_unordered)
+  return _internal_top_level_any_unordered();
+}
+inline void AnyTestCases::unsafe_arena_set_allocated_top_level_any_unordered(
+    PROTOBUF_NAMESPACE_ID::Any* top_level_any_unordered) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_unordered_);
+  }
+  top_level_any_unordered_ = top_level_any_unordered;
+  if (top_level_any_unordered) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyTestCases.top_level_any_unordered)
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::release_top_level_any_unordered() {
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = top_level_any_unordered_;
+  top_level_any_unordered_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::unsafe_arena_release_top_level_any_unordered() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyTestCases.top_level_any_unordered)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = top_level_any_unordered_;
+  top_level_any_unordered_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::_internal_mutable_top_level_any_unordered() {
+  
+  if (top_level_any_unordered_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArena());
+    top_level_any_unordered_ = p;
+  }
+  return top_level_any_unordered_;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyTestCases::mutable_top_level_any_unordered() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyTestCases.top_level_any_unordered)
+  return _internal_mutable_top_level_any_unordered();
+}
+inline void AnyTestCases::set_allocated_top_level_any_unordered(PROTOBUF_NAMESPACE_ID::Any* top_level_any_unordered) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_unordered_);
+  }
+  if (top_level_any_unordered) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(top_level_any_unordered)->GetArena();
+    if (message_arena != submessage_arena) {
+      top_level_any_unordered = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, top_level_any_unordered, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  top_level_any_unordered_ = top_level_any_unordered;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyTestCases.top_level_any_unordered)
+}
+
+// -------------------------------------------------------------------
+
+// AnyWrapper
+
+// .google.protobuf.Any any = 1;
+inline bool AnyWrapper::_internal_has_any() const {
+  return this != internal_default_instance() && any_ != nullptr;
+}
+inline bool AnyWrapper::has_any() const {
+  return _internal_has_any();
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyWrapper::_internal_any() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = any_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyWrapper::any() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyWrapper.any)
+  return _internal_any();
+}
+inline void AnyWrapper::unsafe_arena_set_allocated_any(
+    PROTOBUF_NAMESPACE_ID::Any* any) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_);
+  }
+  any_ = any;
+  if (any) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyWrapper.any)
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyWrapper::release_any() {
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = any_;
+  any_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyWrapper::unsafe_arena_release_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyWrapper.any)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = any_;
+  any_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyWrapper::_internal_mutable_any() {
+  
+  if (any_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArena());
+    any_ = p;
+  }
+  return any_;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyWrapper::mutable_any() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyWrapper.any)
+  return _internal_mutable_any();
+}
+inline void AnyWrapper::set_allocated_any(PROTOBUF_NAMESPACE_ID::Any* any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_);
+  }
+  if (any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any)->GetArena();
+    if (message_arena != submessage_arena) {
+      any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_ = any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyWrapper.any)
+}
+
+// -------------------------------------------------------------------
+
+// Imports
+
+// .google.protobuf.DoubleValue dbl = 1;
+inline bool Imports::_internal_has_dbl() const {
+  return this != internal_default_instance() && dbl_ != nullptr;
+}
+inline bool Imports::has_dbl() const {
+  return _internal_has_dbl();
+}
+inline const PROTOBUF_NAMESPACE_ID::DoubleValue& Imports::_internal_dbl() const {
+  const PROTOBUF_NAMESPACE_ID::DoubleValue* p = dbl_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::DoubleValue*>(
+      &PROTOBUF_NAMESPACE_ID::_DoubleValue_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::DoubleValue& Imports::dbl() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Imports.dbl)
+  return _internal_dbl();
+}
+inline void Imports::unsafe_arena_set_allocated_dbl(
+    PROTOBUF_NAMESPACE_ID::DoubleValue* dbl) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dbl_);
+  }
+  dbl_ = dbl;
+  if (dbl) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Imports.dbl)
+}
+inline PROTOBUF_NAMESPACE_ID::DoubleValue* Imports::release_dbl() {
+  
+  PROTOBUF_NAMESPACE_ID::DoubleValue* temp = dbl_;
+  dbl_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::DoubleValue* Imports::unsafe_arena_release_dbl() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Imports.dbl)
+  
+  PROTOBUF_NAMESPACE_ID::DoubleValue* temp = dbl_;
+  dbl_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::DoubleValue* Imports::_internal_mutable_dbl() {
+  
+  if (dbl_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::DoubleValue>(GetArena());
+    dbl_ = p;
+  }
+  return dbl_;
+}
+inline PROTOBUF_NAMESPACE_ID::DoubleValue* Imports::mutable_dbl() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Imports.dbl)
+  return _internal_mutable_dbl();
+}
+inline void Imports::set_allocated_dbl(PROTOBUF_NAMESPACE_ID::DoubleValue* dbl) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(dbl_);
+  }
+  if (dbl) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dbl)->GetArena();
+    if (message_arena != submessage_arena) {
+      dbl = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dbl, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  dbl_ = dbl;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Imports.dbl)
+}
+
+// .google.protobuf.Struct struct = 2;
+inline bool Imports::_internal_has_struct_() const {
+  return this != internal_default_instance() && struct__ != nullptr;
+}
+inline bool Imports::has_struct_() const {
+  return _internal_has_struct_();
+}
+inline const PROTOBUF_NAMESPACE_ID::Struct& Imports::_internal_struct_() const {
+  const PROTOBUF_NAMESPACE_ID::Struct* p = struct__;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Struct*>(
+      &PROTOBUF_NAMESPACE_ID::_Struct_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Struct& Imports::struct_() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Imports.struct)
+  return _internal_struct_();
+}
+inline void Imports::unsafe_arena_set_allocated_struct_(
+    PROTOBUF_NAMESPACE_ID::Struct* struct_) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(struct__);
+  }
+  struct__ = struct_;
+  if (struct_) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Imports.struct)
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* Imports::release_struct_() {
+  
+  PROTOBUF_NAMESPACE_ID::Struct* temp = struct__;
+  struct__ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* Imports::unsafe_arena_release_struct_() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Imports.struct)
+  
+  PROTOBUF_NAMESPACE_ID::Struct* temp = struct__;
+  struct__ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* Imports::_internal_mutable_struct_() {
+  
+  if (struct__ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Struct>(GetArena());
+    struct__ = p;
+  }
+  return struct__;
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* Imports::mutable_struct_() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Imports.struct)
+  return _internal_mutable_struct_();
+}
+inline void Imports::set_allocated_struct_(PROTOBUF_NAMESPACE_ID::Struct* struct_) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(struct__);
+  }
+  if (struct_) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(struct_)->GetArena();
+    if (message_arena != submessage_arena) {
+      struct_ = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, struct_, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  struct__ = struct_;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Imports.struct)
+}
+
+// .google.protobuf.Timestamp timestamp = 3;
+inline bool Imports::_internal_has_timestamp() const {
+  return this != internal_default_instance() && timestamp_ != nullptr;
+}
+inline bool Imports::has_timestamp() const {
+  return _internal_has_timestamp();
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& Imports::_internal_timestamp() const {
+  const PROTOBUF_NAMESPACE_ID::Timestamp* p = timestamp_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Timestamp*>(
+      &PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& Imports::timestamp() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Imports.timestamp)
+  return _internal_timestamp();
+}
+inline void Imports::unsafe_arena_set_allocated_timestamp(
+    PROTOBUF_NAMESPACE_ID::Timestamp* timestamp) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp_);
+  }
+  timestamp_ = timestamp;
+  if (timestamp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Imports.timestamp)
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* Imports::release_timestamp() {
+  
+  PROTOBUF_NAMESPACE_ID::Timestamp* temp = timestamp_;
+  timestamp_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* Imports::unsafe_arena_release_timestamp() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Imports.timestamp)
+  
+  PROTOBUF_NAMESPACE_ID::Timestamp* temp = timestamp_;
+  timestamp_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* Imports::_internal_mutable_timestamp() {
+  
+  if (timestamp_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Timestamp>(GetArena());
+    timestamp_ = p;
+  }
+  return timestamp_;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* Imports::mutable_timestamp() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Imports.timestamp)
+  return _internal_mutable_timestamp();
+}
+inline void Imports::set_allocated_timestamp(PROTOBUF_NAMESPACE_ID::Timestamp* timestamp) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp_);
+  }
+  if (timestamp) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp)->GetArena();
+    if (message_arena != submessage_arena) {
+      timestamp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timestamp, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  timestamp_ = timestamp;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Imports.timestamp)
+}
+
+// .google.protobuf.Duration duration = 4;
+inline bool Imports::_internal_has_duration() const {
+  return this != internal_default_instance() && duration_ != nullptr;
+}
+inline bool Imports::has_duration() const {
+  return _internal_has_duration();
+}
+inline const PROTOBUF_NAMESPACE_ID::Duration& Imports::_internal_duration() const {
+  const PROTOBUF_NAMESPACE_ID::Duration* p = duration_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Duration*>(
+      &PROTOBUF_NAMESPACE_ID::_Duration_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Duration& Imports::duration() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Imports.duration)
+  return _internal_duration();
+}
+inline void Imports::unsafe_arena_set_allocated_duration(
+    PROTOBUF_NAMESPACE_ID::Duration* duration) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration_);
+  }
+  duration_ = duration;
+  if (duration) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Imports.duration)
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* Imports::release_duration() {
+  
+  PROTOBUF_NAMESPACE_ID::Duration* temp = duration_;
+  duration_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* Imports::unsafe_arena_release_duration() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Imports.duration)
+  
+  PROTOBUF_NAMESPACE_ID::Duration* temp = duration_;
+  duration_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* Imports::_internal_mutable_duration() {
+  
+  if (duration_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Duration>(GetArena());
+    duration_ = p;
+  }
+  return duration_;
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* Imports::mutable_duration() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Imports.duration)
+  return _internal_mutable_duration();
+}
+inline void Imports::set_allocated_duration(PROTOBUF_NAMESPACE_ID::Duration* duration) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration_);
+  }
+  if (duration) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration)->GetArena();
+    if (message_arena != submessage_arena) {
+      duration = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, duration, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  duration_ = duration;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Imports.duration)
+}
+
+// .google.protobuf.Int32Value i32 = 5;
+inline bool Imports::_internal_has_i32() const {
+  return this != internal_default_instance() && i32_ != nullptr;
+}
+inline bool Imports::has_i32() const {
+  return _internal_has_i32();
+}
+inline const PROTOBUF_NAMESPACE_ID::Int32Value& Imports::_internal_i32() const {
+  const PROTOBUF_NAMESPACE_ID::Int32Value* p = i32_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Int32Value*>(
+      &PROTOBUF_NAMESPACE_ID::_Int32Value_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Int32Value& Imports::i32() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Imports.i32)
+  return _internal_i32();
+}
+inline void Imports::unsafe_arena_set_allocated_i32(
+    PROTOBUF_NAMESPACE_ID::Int32Value* i32) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(i32_);
+  }
+  i32_ = i32;
+  if (i32) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Imports.i32)
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* Imports::release_i32() {
+  
+  PROTOBUF_NAMESPACE_ID::Int32Value* temp = i32_;
+  i32_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* Imports::unsafe_arena_release_i32() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Imports.i32)
+  
+  PROTOBUF_NAMESPACE_ID::Int32Value* temp = i32_;
+  i32_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* Imports::_internal_mutable_i32() {
+  
+  if (i32_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Int32Value>(GetArena());
+    i32_ = p;
+  }
+  return i32_;
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* Imports::mutable_i32() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Imports.i32)
+  return _internal_mutable_i32();
+}
+inline void Imports::set_allocated_i32(PROTOBUF_NAMESPACE_ID::Int32Value* i32) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(i32_);
+  }
+  if (i32) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(i32)->GetArena();
+    if (message_arena != submessage_arena) {
+      i32 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, i32, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  i32_ = i32;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Imports.i32)
+}
+
+// .proto_util_converter.testing.Data data = 100;
+inline bool Imports::_internal_has_data() const {
+  return this != internal_default_instance() && data_ != nullptr;
+}
+inline bool Imports::has_data() const {
+  return _internal_has_data();
+}
+inline void Imports::clear_data() {
+  if (GetArena() == nullptr && data_ != nullptr) {
+    delete data_;
+  }
+  data_ = nullptr;
+}
+inline const ::proto_util_converter::testing::Data& Imports::_internal_data() const {
+  const ::proto_util_converter::testing::Data* p = data_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Data*>(
+      &::proto_util_converter::testing::_Data_default_instance_);
+}
+inline const ::proto_util_converter::testing::Data& Imports::data() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Imports.data)
+  return _internal_data();
+}
+inline void Imports::unsafe_arena_set_allocated_data(
+    ::proto_util_converter::testing::Data* data) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(data_);
+  }
+  data_ = data;
+  if (data) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Imports.data)
+}
+inline ::proto_util_converter::testing::Data* Imports::release_data() {
+  
+  ::proto_util_converter::testing::Data* temp = data_;
+  data_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::Data* Imports::unsafe_arena_release_data() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Imports.data)
+  
+  ::proto_util_converter::testing::Data* temp = data_;
+  data_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Data* Imports::_internal_mutable_data() {
+  
+  if (data_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Data>(GetArena());
+    data_ = p;
+  }
+  return data_;
+}
+inline ::proto_util_converter::testing::Data* Imports::mutable_data() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Imports.data)
+  return _internal_mutable_data();
+}
+inline void Imports::set_allocated_data(::proto_util_converter::testing::Data* data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete data_;
+  }
+  if (data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(data);
+    if (message_arena != submessage_arena) {
+      data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, data, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  data_ = data;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Imports.data)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// Data
+
+// int32 attr = 1;
+inline void Data::clear_attr() {
+  attr_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Data::_internal_attr() const {
+  return attr_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Data::attr() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.attr)
+  return _internal_attr();
+}
+inline void Data::_internal_set_attr(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  attr_ = value;
+}
+inline void Data::set_attr(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_attr(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Data.attr)
+}
+
+// string str = 2;
+inline void Data::clear_str() {
+  str_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& Data::str() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.str)
+  return _internal_str();
+}
+inline void Data::set_str(const std::string& value) {
+  _internal_set_str(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Data.str)
+}
+inline std::string* Data::mutable_str() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.str)
+  return _internal_mutable_str();
+}
+inline const std::string& Data::_internal_str() const {
+  return str_.Get();
+}
+inline void Data::_internal_set_str(const std::string& value) {
+  
+  str_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Data::set_str(std::string&& value) {
+  
+  str_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Data.str)
+}
+inline void Data::set_str(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  str_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Data.str)
+}
+inline void Data::set_str(const char* value,
+    size_t size) {
+  
+  str_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Data.str)
+}
+inline std::string* Data::_internal_mutable_str() {
+  
+  return str_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Data::release_str() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Data.str)
+  return str_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Data::set_allocated_str(std::string* str) {
+  if (str != nullptr) {
+    
+  } else {
+    
+  }
+  str_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), str,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Data.str)
+}
+
+// repeated string msgs = 3;
+inline int Data::_internal_msgs_size() const {
+  return msgs_.size();
+}
+inline int Data::msgs_size() const {
+  return _internal_msgs_size();
+}
+inline void Data::clear_msgs() {
+  msgs_.Clear();
+}
+inline std::string* Data::add_msgs() {
+  // @@protoc_insertion_point(field_add_mutable:proto_util_converter.testing.Data.msgs)
+  return _internal_add_msgs();
+}
+inline const std::string& Data::_internal_msgs(int index) const {
+  return msgs_.Get(index);
+}
+inline const std::string& Data::msgs(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.msgs)
+  return _internal_msgs(index);
+}
+inline std::string* Data::mutable_msgs(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.msgs)
+  return msgs_.Mutable(index);
+}
+inline void Data::set_msgs(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Data.msgs)
+  msgs_.Mutable(index)->assign(value);
+}
+inline void Data::set_msgs(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Data.msgs)
+  msgs_.Mutable(index)->assign(std::move(value));
+}
+inline void Data::set_msgs(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  msgs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Data.msgs)
+}
+inline void Data::set_msgs(int index, const char* value, size_t size) {
+  msgs_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Data.msgs)
+}
+inline std::string* Data::_internal_add_msgs() {
+  return msgs_.Add();
+}
+inline void Data::add_msgs(const std::string& value) {
+  msgs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Data.msgs)
+}
+inline void Data::add_msgs(std::string&& value) {
+  msgs_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Data.msgs)
+}
+inline void Data::add_msgs(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  msgs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto_util_converter.testing.Data.msgs)
+}
+inline void Data::add_msgs(const char* value, size_t size) {
+  msgs_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto_util_converter.testing.Data.msgs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Data::msgs() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Data.msgs)
+  return msgs_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Data::mutable_msgs() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Data.msgs)
+  return &msgs_;
+}
+
+// .proto_util_converter.testing.Data nested_data = 4;
+inline bool Data::_internal_has_nested_data() const {
+  return this != internal_default_instance() && nested_data_ != nullptr;
+}
+inline bool Data::has_nested_data() const {
+  return _internal_has_nested_data();
+}
+inline void Data::clear_nested_data() {
+  if (GetArena() == nullptr && nested_data_ != nullptr) {
+    delete nested_data_;
+  }
+  nested_data_ = nullptr;
+}
+inline const ::proto_util_converter::testing::Data& Data::_internal_nested_data() const {
+  const ::proto_util_converter::testing::Data* p = nested_data_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Data*>(
+      &::proto_util_converter::testing::_Data_default_instance_);
+}
+inline const ::proto_util_converter::testing::Data& Data::nested_data() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.nested_data)
+  return _internal_nested_data();
+}
+inline void Data::unsafe_arena_set_allocated_nested_data(
+    ::proto_util_converter::testing::Data* nested_data) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(nested_data_);
+  }
+  nested_data_ = nested_data;
+  if (nested_data) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Data.nested_data)
+}
+inline ::proto_util_converter::testing::Data* Data::release_nested_data() {
+  
+  ::proto_util_converter::testing::Data* temp = nested_data_;
+  nested_data_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::Data* Data::unsafe_arena_release_nested_data() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Data.nested_data)
+  
+  ::proto_util_converter::testing::Data* temp = nested_data_;
+  nested_data_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Data* Data::_internal_mutable_nested_data() {
+  
+  if (nested_data_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Data>(GetArena());
+    nested_data_ = p;
+  }
+  return nested_data_;
+}
+inline ::proto_util_converter::testing::Data* Data::mutable_nested_data() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.nested_data)
+  return _internal_mutable_nested_data();
+}
+inline void Data::set_allocated_nested_data(::proto_util_converter::testing::Data* nested_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete nested_data_;
+  }
+  if (nested_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(nested_data);
+    if (message_arena != submessage_arena) {
+      nested_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, nested_data, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  nested_data_ = nested_data;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Data.nested_data)
+}
+
+// .google.protobuf.Int32Value int_wrapper = 5;
+inline bool Data::_internal_has_int_wrapper() const {
+  return this != internal_default_instance() && int_wrapper_ != nullptr;
+}
+inline bool Data::has_int_wrapper() const {
+  return _internal_has_int_wrapper();
+}
+inline const PROTOBUF_NAMESPACE_ID::Int32Value& Data::_internal_int_wrapper() const {
+  const PROTOBUF_NAMESPACE_ID::Int32Value* p = int_wrapper_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Int32Value*>(
+      &PROTOBUF_NAMESPACE_ID::_Int32Value_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Int32Value& Data::int_wrapper() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.int_wrapper)
+  return _internal_int_wrapper();
+}
+inline void Data::unsafe_arena_set_allocated_int_wrapper(
+    PROTOBUF_NAMESPACE_ID::Int32Value* int_wrapper) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(int_wrapper_);
+  }
+  int_wrapper_ = int_wrapper;
+  if (int_wrapper) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Data.int_wrapper)
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* Data::release_int_wrapper() {
+  
+  PROTOBUF_NAMESPACE_ID::Int32Value* temp = int_wrapper_;
+  int_wrapper_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* Data::unsafe_arena_release_int_wrapper() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Data.int_wrapper)
+  
+  PROTOBUF_NAMESPACE_ID::Int32Value* temp = int_wrapper_;
+  int_wrapper_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* Data::_internal_mutable_int_wrapper() {
+  
+  if (int_wrapper_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Int32Value>(GetArena());
+    int_wrapper_ = p;
+  }
+  return int_wrapper_;
+}
+inline PROTOBUF_NAMESPACE_ID::Int32Value* Data::mutable_int_wrapper() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.int_wrapper)
+  return _internal_mutable_int_wrapper();
+}
+inline void Data::set_allocated_int_wrapper(PROTOBUF_NAMESPACE_ID::Int32Value* int_wrapper) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(int_wrapper_);
+  }
+  if (int_wrapper) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(int_wrapper)->GetArena();
+    if (message_arena != submessage_arena) {
+      int_wrapper = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, int_wrapper, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  int_wrapper_ = int_wrapper;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Data.int_wrapper)
+}
+
+// .google.protobuf.Timestamp time = 6;
+inline bool Data::_internal_has_time() const {
+  return this != internal_default_instance() && time_ != nullptr;
+}
+inline bool Data::has_time() const {
+  return _internal_has_time();
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& Data::_internal_time() const {
+  const PROTOBUF_NAMESPACE_ID::Timestamp* p = time_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Timestamp*>(
+      &PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& Data::time() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.time)
+  return _internal_time();
+}
+inline void Data::unsafe_arena_set_allocated_time(
+    PROTOBUF_NAMESPACE_ID::Timestamp* time) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(time_);
+  }
+  time_ = time;
+  if (time) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Data.time)
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* Data::release_time() {
+  
+  PROTOBUF_NAMESPACE_ID::Timestamp* temp = time_;
+  time_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* Data::unsafe_arena_release_time() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Data.time)
+  
+  PROTOBUF_NAMESPACE_ID::Timestamp* temp = time_;
+  time_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* Data::_internal_mutable_time() {
+  
+  if (time_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Timestamp>(GetArena());
+    time_ = p;
+  }
+  return time_;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* Data::mutable_time() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.time)
+  return _internal_mutable_time();
+}
+inline void Data::set_allocated_time(PROTOBUF_NAMESPACE_ID::Timestamp* time) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(time_);
+  }
+  if (time) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(time)->GetArena();
+    if (message_arena != submessage_arena) {
+      time = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  time_ = time;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Data.time)
+}
+
+// map<string, string> map_data = 7;
+inline int Data::_internal_map_data_size() const {
+  return map_data_.size();
+}
+inline int Data::map_data_size() const {
+  return _internal_map_data_size();
+}
+inline void Data::clear_map_data() {
+  map_data_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+Data::_internal_map_data() const {
+  return map_data_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+Data::map_data() const {
+  // @@protoc_insertion_point(field_map:proto_util_converter.testing.Data.map_data)
+  return _internal_map_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+Data::_internal_mutable_map_data() {
+  return map_data_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+Data::mutable_map_data() {
+  // @@protoc_insertion_point(field_mutable_map:proto_util_converter.testing.Data.map_data)
+  return _internal_mutable_map_data();
+}
+
+// .google.protobuf.Struct struct_data = 8;
+inline bool Data::_internal_has_struct_data() const {
+  return this != internal_default_instance() && struct_data_ != nullptr;
+}
+inline bool Data::has_struct_data() const {
+  return _internal_has_struct_data();
+}
+inline const PROTOBUF_NAMESPACE_ID::Struct& Data::_internal_struct_data() const {
+  const PROTOBUF_NAMESPACE_ID::Struct* p = struct_data_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Struct*>(
+      &PROTOBUF_NAMESPACE_ID::_Struct_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Struct& Data::struct_data() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.struct_data)
+  return _internal_struct_data();
+}
+inline void Data::unsafe_arena_set_allocated_struct_data(
+    PROTOBUF_NAMESPACE_ID::Struct* struct_data) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(struct_data_);
+  }
+  struct_data_ = struct_data;
+  if (struct_data) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Data.struct_data)
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* Data::release_struct_data() {
+  
+  PROTOBUF_NAMESPACE_ID::Struct* temp = struct_data_;
+  struct_data_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* Data::unsafe_arena_release_struct_data() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Data.struct_data)
+  
+  PROTOBUF_NAMESPACE_ID::Struct* temp = struct_data_;
+  struct_data_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* Data::_internal_mutable_struct_data() {
+  
+  if (struct_data_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Struct>(GetArena());
+    struct_data_ = p;
+  }
+  return struct_data_;
+}
+inline PROTOBUF_NAMESPACE_ID::Struct* Data::mutable_struct_data() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.struct_data)
+  return _internal_mutable_struct_data();
+}
+inline void Data::set_allocated_struct_data(PROTOBUF_NAMESPACE_ID::Struct* struct_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(struct_data_);
+  }
+  if (struct_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(struct_data)->GetArena();
+    if (message_arena != submessage_arena) {
+      struct_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, struct_data, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  struct_data_ = struct_data;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Data.struct_data)
+}
+
+// repeated .proto_util_converter.testing.Data repeated_data = 9;
+inline int Data::_internal_repeated_data_size() const {
+  return repeated_data_.size();
+}
+inline int Data::repeated_data_size() const {
+  return _internal_repeated_data_size();
+}
+inline void Data::clear_repeated_data() {
+  repeated_data_.Clear();
+}
+inline ::proto_util_converter::testing::Data* Data::mutable_repeated_data(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.repeated_data)
+  return repeated_data_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Data >*
+Data::mutable_repeated_data() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Data.repeated_data)
+  return &repeated_data_;
+}
+inline const ::proto_util_converter::testing::Data& Data::_internal_repeated_data(int index) const {
+  return repeated_data_.Get(index);
+}
+inline const ::proto_util_converter::testing::Data& Data::repeated_data(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.repeated_data)
+  return _internal_repeated_data(index);
+}
+inline ::proto_util_converter::testing::Data* Data::_internal_add_repeated_data() {
+  return repeated_data_.Add();
+}
+inline ::proto_util_converter::testing::Data* Data::add_repeated_data() {
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Data.repeated_data)
+  return _internal_add_repeated_data();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Data >&
+Data::repeated_data() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Data.repeated_data)
+  return repeated_data_;
+}
+
+// repeated .google.protobuf.Any repeated_any = 10;
+inline int Data::_internal_repeated_any_size() const {
+  return repeated_any_.size();
+}
+inline int Data::repeated_any_size() const {
+  return _internal_repeated_any_size();
+}
+inline PROTOBUF_NAMESPACE_ID::Any* Data::mutable_repeated_any(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Data.repeated_any)
+  return repeated_any_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Any >*
+Data::mutable_repeated_any() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Data.repeated_any)
+  return &repeated_any_;
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& Data::_internal_repeated_any(int index) const {
+  return repeated_any_.Get(index);
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& Data::repeated_any(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Data.repeated_any)
+  return _internal_repeated_any(index);
+}
+inline PROTOBUF_NAMESPACE_ID::Any* Data::_internal_add_repeated_any() {
+  return repeated_any_.Add();
+}
+inline PROTOBUF_NAMESPACE_ID::Any* Data::add_repeated_any() {
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Data.repeated_any)
+  return _internal_add_repeated_any();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Any >&
+Data::repeated_any() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Data.repeated_any)
+  return repeated_any_;
+}
+
+// -------------------------------------------------------------------
+
+// AnyIn
+
+// string something = 1;
+inline void AnyIn::clear_something() {
+  something_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& AnyIn::something() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyIn.something)
+  return _internal_something();
+}
+inline void AnyIn::set_something(const std::string& value) {
+  _internal_set_something(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.AnyIn.something)
+}
+inline std::string* AnyIn::mutable_something() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyIn.something)
+  return _internal_mutable_something();
+}
+inline const std::string& AnyIn::_internal_something() const {
+  return something_.Get();
+}
+inline void AnyIn::_internal_set_something(const std::string& value) {
+  
+  something_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AnyIn::set_something(std::string&& value) {
+  
+  something_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.AnyIn.something)
+}
+inline void AnyIn::set_something(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  something_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.AnyIn.something)
+}
+inline void AnyIn::set_something(const char* value,
+    size_t size) {
+  
+  something_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.AnyIn.something)
+}
+inline std::string* AnyIn::_internal_mutable_something() {
+  
+  return something_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* AnyIn::release_something() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyIn.something)
+  return something_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void AnyIn::set_allocated_something(std::string* something) {
+  if (something != nullptr) {
+    
+  } else {
+    
+  }
+  something_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), something,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyIn.something)
+}
+
+// .google.protobuf.Any any = 2;
+inline bool AnyIn::_internal_has_any() const {
+  return this != internal_default_instance() && any_ != nullptr;
+}
+inline bool AnyIn::has_any() const {
+  return _internal_has_any();
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyIn::_internal_any() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = any_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyIn::any() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyIn.any)
+  return _internal_any();
+}
+inline void AnyIn::unsafe_arena_set_allocated_any(
+    PROTOBUF_NAMESPACE_ID::Any* any) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_);
+  }
+  any_ = any;
+  if (any) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyIn.any)
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyIn::release_any() {
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = any_;
+  any_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyIn::unsafe_arena_release_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyIn.any)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = any_;
+  any_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyIn::_internal_mutable_any() {
+  
+  if (any_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArena());
+    any_ = p;
+  }
+  return any_;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyIn::mutable_any() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyIn.any)
+  return _internal_mutable_any();
+}
+inline void AnyIn::set_allocated_any(PROTOBUF_NAMESPACE_ID::Any* any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_);
+  }
+  if (any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any)->GetArena();
+    if (message_arena != submessage_arena) {
+      any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_ = any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyIn.any)
+}
+
+// -------------------------------------------------------------------
+
+// AnyOut
+
+// .google.protobuf.Any any = 1;
+inline bool AnyOut::_internal_has_any() const {
+  return this != internal_default_instance() && any_ != nullptr;
+}
+inline bool AnyOut::has_any() const {
+  return _internal_has_any();
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyOut::_internal_any() const {
+  const PROTOBUF_NAMESPACE_ID::Any* p = any_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Any*>(
+      &PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Any& AnyOut::any() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyOut.any)
+  return _internal_any();
+}
+inline void AnyOut::unsafe_arena_set_allocated_any(
+    PROTOBUF_NAMESPACE_ID::Any* any) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_);
+  }
+  any_ = any;
+  if (any) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.AnyOut.any)
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyOut::release_any() {
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = any_;
+  any_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyOut::unsafe_arena_release_any() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyOut.any)
+  
+  PROTOBUF_NAMESPACE_ID::Any* temp = any_;
+  any_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyOut::_internal_mutable_any() {
+  
+  if (any_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Any>(GetArena());
+    any_ = p;
+  }
+  return any_;
+}
+inline PROTOBUF_NAMESPACE_ID::Any* AnyOut::mutable_any() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyOut.any)
+  return _internal_mutable_any();
+}
+inline void AnyOut::set_allocated_any(PROTOBUF_NAMESPACE_ID::Any* any) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(any_);
+  }
+  if (any) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(any)->GetArena();
+    if (message_arena != submessage_arena) {
+      any = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, any, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  any_ = any;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyOut.any)
+}
+
+// -------------------------------------------------------------------
+
+// AnyM
+
+// string foo = 1;
+inline void AnyM::clear_foo() {
+  foo_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& AnyM::foo() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.AnyM.foo)
+  return _internal_foo();
+}
+inline void AnyM::set_foo(const std::string& value) {
+  _internal_set_foo(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.AnyM.foo)
+}
+inline std::string* AnyM::mutable_foo() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.AnyM.foo)
+  return _internal_mutable_foo();
+}
+inline const std::string& AnyM::_internal_foo() const {
+  return foo_.Get();
+}
+inline void AnyM::_internal_set_foo(const std::string& value) {
+  
+  foo_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AnyM::set_foo(std::string&& value) {
+  
+  foo_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.AnyM.foo)
+}
+inline void AnyM::set_foo(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  foo_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.AnyM.foo)
+}
+inline void AnyM::set_foo(const char* value,
+    size_t size) {
+  
+  foo_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.AnyM.foo)
+}
+inline std::string* AnyM::_internal_mutable_foo() {
+  
+  return foo_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* AnyM::release_foo() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.AnyM.foo)
+  return foo_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void AnyM::set_allocated_foo(std::string* foo) {
+  if (foo != nullptr) {
+    
+  } else {
+    
+  }
+  foo_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), foo,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.AnyM.foo)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace testing
+}  // namespace proto_util_converter
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fanys_2eproto
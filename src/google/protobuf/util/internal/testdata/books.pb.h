@@ -0,0 +1,9206 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/internal/testdata/books.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3012000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3012003 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "google/protobuf/util/internal/testdata/anys.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[16]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+namespace proto_util_converter {
+namespace testing {
+class Author;
+class AuthorDefaultTypeInternal;
+extern AuthorDefaultTypeInternal _Author_default_instance_;
+class BadAuthor;
+class BadAuthorDefaultTypeInternal;
+extern BadAuthorDefaultTypeInternal _BadAuthor_default_instance_;
+class BadNestedBook;
+class BadNestedBookDefaultTypeInternal;
+extern BadNestedBookDefaultTypeInternal _BadNestedBook_default_instance_;
+class Book;
+class BookDefaultTypeInternal;
+extern BookDefaultTypeInternal _Book_default_instance_;
+class Book_Data;
+class Book_DataDefaultTypeInternal;
+extern Book_DataDefaultTypeInternal _Book_Data_default_instance_;
+class Book_Label;
+class Book_LabelDefaultTypeInternal;
+extern Book_LabelDefaultTypeInternal _Book_Label_default_instance_;
+class Cyclic;
+class CyclicDefaultTypeInternal;
+extern CyclicDefaultTypeInternal _Cyclic_default_instance_;
+class NestedBook;
+class NestedBookDefaultTypeInternal;
+extern NestedBookDefaultTypeInternal _NestedBook_default_instance_;
+class PackedPrimitive;
+class PackedPrimitiveDefaultTypeInternal;
+extern PackedPrimitiveDefaultTypeInternal _PackedPrimitive_default_instance_;
+class Primitive;
+class PrimitiveDefaultTypeInternal;
+extern PrimitiveDefaultTypeInternal _Primitive_default_instance_;
+class Publisher;
+class PublisherDefaultTypeInternal;
+extern PublisherDefaultTypeInternal _Publisher_default_instance_;
+class TestJsonName1;
+class TestJsonName1DefaultTypeInternal;
+extern TestJsonName1DefaultTypeInternal _TestJsonName1_default_instance_;
+class TestJsonName2;
+class TestJsonName2DefaultTypeInternal;
+extern TestJsonName2DefaultTypeInternal _TestJsonName2_default_instance_;
+class TestMessageFieldsWithSameJsonName;
+class TestMessageFieldsWithSameJsonNameDefaultTypeInternal;
+extern TestMessageFieldsWithSameJsonNameDefaultTypeInternal _TestMessageFieldsWithSameJsonName_default_instance_;
+class TestPrimitiveFieldsWithSameJsonName;
+class TestPrimitiveFieldsWithSameJsonNameDefaultTypeInternal;
+extern TestPrimitiveFieldsWithSameJsonNameDefaultTypeInternal _TestPrimitiveFieldsWithSameJsonName_default_instance_;
+class TestRepeatedFieldsWithSameJsonName;
+class TestRepeatedFieldsWithSameJsonNameDefaultTypeInternal;
+extern TestRepeatedFieldsWithSameJsonNameDefaultTypeInternal _TestRepeatedFieldsWithSameJsonName_default_instance_;
+}  // namespace testing
+}  // namespace proto_util_converter
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto_util_converter::testing::Author* Arena::CreateMaybeMessage<::proto_util_converter::testing::Author>(Arena*);
+template<> ::proto_util_converter::testing::BadAuthor* Arena::CreateMaybeMessage<::proto_util_converter::testing::BadAuthor>(Arena*);
+template<> ::proto_util_converter::testing::BadNestedBook* Arena::CreateMaybeMessage<::proto_util_converter::testing::BadNestedBook>(Arena*);
+template<> ::proto_util_converter::testing::Book* Arena::CreateMaybeMessage<::proto_util_converter::testing::Book>(Arena*);
+template<> ::proto_util_converter::testing::Book_Data* Arena::CreateMaybeMessage<::proto_util_converter::testing::Book_Data>(Arena*);
+template<> ::proto_util_converter::testing::Book_Label* Arena::CreateMaybeMessage<::proto_util_converter::testing::Book_Label>(Arena*);
+template<> ::proto_util_converter::testing::Cyclic* Arena::CreateMaybeMessage<::proto_util_converter::testing::Cyclic>(Arena*);
+template<> ::proto_util_converter::testing::NestedBook* Arena::CreateMaybeMessage<::proto_util_converter::testing::NestedBook>(Arena*);
+template<> ::proto_util_converter::testing::PackedPrimitive* Arena::CreateMaybeMessage<::proto_util_converter::testing::PackedPrimitive>(Arena*);
+template<> ::proto_util_converter::testing::Primitive* Arena::CreateMaybeMessage<::proto_util_converter::testing::Primitive>(Arena*);
+template<> ::proto_util_converter::testing::Publisher* Arena::CreateMaybeMessage<::proto_util_converter::testing::Publisher>(Arena*);
+template<> ::proto_util_converter::testing::TestJsonName1* Arena::CreateMaybeMessage<::proto_util_converter::testing::TestJsonName1>(Arena*);
+template<> ::proto_util_converter::testing::TestJsonName2* Arena::CreateMaybeMessage<::proto_util_converter::testing::TestJsonName2>(Arena*);
+template<> ::proto_util_converter::testing::TestMessageFieldsWithSameJsonName* Arena::CreateMaybeMessage<::proto_util_converter::testing::TestMessageFieldsWithSameJsonName>(Arena*);
+template<> ::proto_util_converter::testing::TestPrimitiveFieldsWithSameJsonName* Arena::CreateMaybeMessage<::proto_util_converter::testing::TestPrimitiveFieldsWithSameJsonName>(Arena*);
+template<> ::proto_util_converter::testing::TestRepeatedFieldsWithSameJsonName* Arena::CreateMaybeMessage<::proto_util_converter::testing::TestRepeatedFieldsWithSameJsonName>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto_util_converter {
+namespace testing {
+
+enum Book_Type : int {
+  Book_Type_FICTION = 1,
+  Book_Type_KIDS = 2,
+  Book_Type_ACTION_AND_ADVENTURE = 3,
+  Book_Type_arts_and_photography = 4,
+  Book_Type_I18N_Tech = 5
+};
+bool Book_Type_IsValid(int value);
+constexpr Book_Type Book_Type_Type_MIN = Book_Type_FICTION;
+constexpr Book_Type Book_Type_Type_MAX = Book_Type_I18N_Tech;
+constexpr int Book_Type_Type_ARRAYSIZE = Book_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Book_Type_descriptor();
+template<typename T>
+inline const std::string& Book_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Book_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Book_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Book_Type_descriptor(), enum_t_value);
+}
+inline bool Book_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Book_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Book_Type>(
+    Book_Type_descriptor(), name, value);
+}
+// ===================================================================
+
+class Book_Data PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Book.Data) */ {
+ public:
+  inline Book_Data() : Book_Data(nullptr) {};
+  virtual ~Book_Data();
+
+  Book_Data(const Book_Data& from);
+  Book_Data(Book_Data&& from) noexcept
+    : Book_Data() {
+    *this = ::std::move(from);
+  }
+
+  inline Book_Data& operator=(const Book_Data& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Book_Data& operator=(Book_Data&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Book_Data& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Book_Data* internal_default_instance() {
+    return reinterpret_cast<const Book_Data*>(
+               &_Book_Data_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Book_Data& a, Book_Data& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Book_Data* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Book_Data* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Book_Data* New() const final {
+    return CreateMaybeMessage<Book_Data>(nullptr);
+  }
+
+  Book_Data* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Book_Data>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Book_Data& from);
+  void MergeFrom(const Book_Data& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Book_Data* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Book.Data";
+  }
+  protected:
+  explicit Book_Data(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCopyrightFieldNumber = 8,
+    kYearFieldNumber = 7,
+  };
+  // optional string copyright = 8;
+  bool has_copyright() const;
+  private:
+  bool _internal_has_copyright() const;
+  public:
+  void clear_copyright();
+  const std::string& copyright() const;
+  void set_copyright(const std::string& value);
+  void set_copyright(std::string&& value);
+  void set_copyright(const char* value);
+  void set_copyright(const char* value, size_t size);
+  std::string* mutable_copyright();
+  std::string* release_copyright();
+  void set_allocated_copyright(std::string* copyright);
+  private:
+  const std::string& _internal_copyright() const;
+  void _internal_set_copyright(const std::string& value);
+  std::string* _internal_mutable_copyright();
+  public:
+
+  // optional uint32 year = 7;
+  bool has_year() const;
+  private:
+  bool _internal_has_year() const;
+  public:
+  void clear_year();
+  ::PROTOBUF_NAMESPACE_ID::uint32 year() const;
+  void set_year(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_year() const;
+  void _internal_set_year(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Book.Data)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr copyright_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 year_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Book_Label PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Book.Label) */ {
+ public:
+  inline Book_Label() : Book_Label(nullptr) {};
+  virtual ~Book_Label();
+
+  Book_Label(const Book_Label& from);
+  Book_Label(Book_Label&& from) noexcept
+    : Book_Label() {
+    *this = ::std::move(from);
+  }
+
+  inline Book_Label& operator=(const Book_Label& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Book_Label& operator=(Book_Label&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Book_Label& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Book_Label* internal_default_instance() {
+    return reinterpret_cast<const Book_Label*>(
+               &_Book_Label_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Book_Label& a, Book_Label& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Book_Label* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Book_Label* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Book_Label* New() const final {
+    return CreateMaybeMessage<Book_Label>(nullptr);
+  }
+
+  Book_Label* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Book_Label>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Book_Label& from);
+  void MergeFrom(const Book_Label& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Book_Label* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Book.Label";
+  }
+  protected:
+  explicit Book_Label(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // optional string key = 1;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  void set_key(const std::string& value);
+  void set_key(std::string&& value);
+  void set_key(const char* value);
+  void set_key(const char* value, size_t size);
+  std::string* mutable_key();
+  std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // optional string value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  void set_value(const std::string& value);
+  void set_value(std::string&& value);
+  void set_value(const char* value);
+  void set_value(const char* value, size_t size);
+  std::string* mutable_value();
+  std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Book.Label)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Book PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Book) */ {
+ public:
+  inline Book() : Book(nullptr) {};
+  virtual ~Book();
+
+  Book(const Book& from);
+  Book(Book&& from) noexcept
+    : Book() {
+    *this = ::std::move(from);
+  }
+
+  inline Book& operator=(const Book& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Book& operator=(Book&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Book& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Book* internal_default_instance() {
+    return reinterpret_cast<const Book*>(
+               &_Book_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Book& a, Book& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Book* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Book* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Book* New() const final {
+    return CreateMaybeMessage<Book>(nullptr);
+  }
+
+  Book* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Book>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Book& from);
+  void MergeFrom(const Book& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Book* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Book";
+  }
+  protected:
+  explicit Book(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  typedef Book_Data Data;
+  typedef Book_Label Label;
+
+  typedef Book_Type Type;
+  static constexpr Type FICTION =
+    Book_Type_FICTION;
+  static constexpr Type KIDS =
+    Book_Type_KIDS;
+  static constexpr Type ACTION_AND_ADVENTURE =
+    Book_Type_ACTION_AND_ADVENTURE;
+  static constexpr Type arts_and_photography =
+    Book_Type_arts_and_photography;
+  static constexpr Type I18N_Tech =
+    Book_Type_I18N_Tech;
+  static inline bool Type_IsValid(int value) {
+    return Book_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    Book_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    Book_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    Book_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return Book_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return Book_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return Book_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLabelsFieldNumber = 10,
+    kPrimitiveRepeatedFieldNumber = 14,
+    kTitleFieldNumber = 1,
+    kContentFieldNumber = 5,
+    kSnakeFieldFieldNumber = 12,
+    kAuthorFieldNumber = 2,
+    kDataFieldNumber = 6,
+    kPublisherFieldNumber = 9,
+    kTypeNotFoundFieldNumber = 13,
+    kPublishedFieldNumber = 4,
+    kLengthFieldNumber = 3,
+    kTypeFieldNumber = 11,
+  };
+  // repeated .proto_util_converter.testing.Book.Label labels = 10;
+  int labels_size() const;
+  private:
+  int _internal_labels_size() const;
+  public:
+  void clear_labels();
+  ::proto_util_converter::testing::Book_Label* mutable_labels(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Book_Label >*
+      mutable_labels();
+  private:
+  const ::proto_util_converter::testing::Book_Label& _internal_labels(int index) const;
+  ::proto_util_converter::testing::Book_Label* _internal_add_labels();
+  public:
+  const ::proto_util_converter::testing::Book_Label& labels(int index) const;
+  ::proto_util_converter::testing::Book_Label* add_labels();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Book_Label >&
+      labels() const;
+
+  // repeated int32 primitive_repeated = 14;
+  int primitive_repeated_size() const;
+  private:
+  int _internal_primitive_repeated_size() const;
+  public:
+  void clear_primitive_repeated();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_primitive_repeated(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_primitive_repeated() const;
+  void _internal_add_primitive_repeated(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_primitive_repeated();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 primitive_repeated(int index) const;
+  void set_primitive_repeated(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_primitive_repeated(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      primitive_repeated() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_primitive_repeated();
+
+  // optional string title = 1;
+  bool has_title() const;
+  private:
+  bool _internal_has_title() const;
+  public:
+  void clear_title();
+  const std::string& title() const;
+  void set_title(const std::string& value);
+  void set_title(std::string&& value);
+  void set_title(const char* value);
+  void set_title(const char* value, size_t size);
+  std::string* mutable_title();
+  std::string* release_title();
+  void set_allocated_title(std::string* title);
+  private:
+  const std::string& _internal_title() const;
+  void _internal_set_title(const std::string& value);
+  std::string* _internal_mutable_title();
+  public:
+
+  // optional bytes content = 5;
+  bool has_content() const;
+  private:
+  bool _internal_has_content() const;
+  public:
+  void clear_content();
+  const std::string& content() const;
+  void set_content(const std::string& value);
+  void set_content(std::string&& value);
+  void set_content(const char* value);
+  void set_content(const void* value, size_t size);
+  std::string* mutable_content();
+  std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // optional string snake_field = 12;
+  bool has_snake_field() const;
+  private:
+  bool _internal_has_snake_field() const;
+  public:
+  void clear_snake_field();
+  const std::string& snake_field() const;
+  void set_snake_field(const std::string& value);
+  void set_snake_field(std::string&& value);
+  void set_snake_field(const char* value);
+  void set_snake_field(const char* value, size_t size);
+  std::string* mutable_snake_field();
+  std::string* release_snake_field();
+  void set_allocated_snake_field(std::string* snake_field);
+  private:
+  const std::string& _internal_snake_field() const;
+  void _internal_set_snake_field(const std::string& value);
+  std::string* _internal_mutable_snake_field();
+  public:
+
+  // optional .proto_util_converter.testing.Author author = 2;
+  bool has_author() const;
+  private:
+  bool _internal_has_author() const;
+  public:
+  void clear_author();
+  const ::proto_util_converter::testing::Author& author() const;
+  ::proto_util_converter::testing::Author* release_author();
+  ::proto_util_converter::testing::Author* mutable_author();
+  void set_allocated_author(::proto_util_converter::testing::Author* author);
+  private:
+  const ::proto_util_converter::testing::Author& _internal_author() const;
+  ::proto_util_converter::testing::Author* _internal_mutable_author();
+  public:
+  void unsafe_arena_set_allocated_author(
+      ::proto_util_converter::testing::Author* author);
+  ::proto_util_converter::testing::Author* unsafe_arena_release_author();
+
+  // optional group Data = 6 { ... };
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const ::proto_util_converter::testing::Book_Data& data() const;
+  ::proto_util_converter::testing::Book_Data* release_data();
+  ::proto_util_converter::testing::Book_Data* mutable_data();
+  void set_allocated_data(::proto_util_converter::testing::Book_Data* data);
+  private:
+  const ::proto_util_converter::testing::Book_Data& _internal_data() const;
+  ::proto_util_converter::testing::Book_Data* _internal_mutable_data();
+  public:
+  void unsafe_arena_set_allocated_data(
+      ::proto_util_converter::testing::Book_Data* data);
+  ::proto_util_converter::testing::Book_Data* unsafe_arena_release_data();
+
+  // optional .proto_util_converter.testing.Publisher publisher = 9;
+  bool has_publisher() const;
+  private:
+  bool _internal_has_publisher() const;
+  public:
+  void clear_publisher();
+  const ::proto_util_converter::testing::Publisher& publisher() const;
+  ::proto_util_converter::testing::Publisher* release_publisher();
+  ::proto_util_converter::testing::Publisher* mutable_publisher();
+  void set_allocated_publisher(::proto_util_converter::testing::Publisher* publisher);
+  private:
+  const ::proto_util_converter::testing::Publisher& _internal_publisher() const;
+  ::proto_util_converter::testing::Publisher* _internal_mutable_publisher();
+  public:
+  void unsafe_arena_set_allocated_publisher(
+      ::proto_util_converter::testing::Publisher* publisher);
+  ::proto_util_converter::testing::Publisher* unsafe_arena_release_publisher();
+
+  // optional .proto_util_converter.testing.AnyWrapper type_not_found = 13;
+  bool has_type_not_found() const;
+  private:
+  bool _internal_has_type_not_found() const;
+  public:
+  void clear_type_not_found();
+  const ::proto_util_converter::testing::AnyWrapper& type_not_found() const;
+  ::proto_util_converter::testing::AnyWrapper* release_type_not_found();
+  ::proto_util_converter::testing::AnyWrapper* mutable_type_not_found();
+  void set_allocated_type_not_found(::proto_util_converter::testing::AnyWrapper* type_not_found);
+  private:
+  const ::proto_util_converter::testing::AnyWrapper& _internal_type_not_found() const;
+  ::proto_util_converter::testing::AnyWrapper* _internal_mutable_type_not_found();
+  public:
+  void unsafe_arena_set_allocated_type_not_found(
+      ::proto_util_converter::testing::AnyWrapper* type_not_found);
+  ::proto_util_converter::testing::AnyWrapper* unsafe_arena_release_type_not_found();
+
+  // optional int64 published = 4;
+  bool has_published() const;
+  private:
+  bool _internal_has_published() const;
+  public:
+  void clear_published();
+  ::PROTOBUF_NAMESPACE_ID::int64 published() const;
+  void set_published(::PROTOBUF_NAMESPACE_ID::int64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_published() const;
+  void _internal_set_published(::PROTOBUF_NAMESPACE_ID::int64 value);
+  public:
+
+  // optional uint32 length = 3;
+  bool has_length() const;
+  private:
+  bool _internal_has_length() const;
+  public:
+  void clear_length();
+  ::PROTOBUF_NAMESPACE_ID::uint32 length() const;
+  void set_length(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_length() const;
+  void _internal_set_length(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // optional .proto_util_converter.testing.Book.Type type = 11;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::proto_util_converter::testing::Book_Type type() const;
+  void set_type(::proto_util_converter::testing::Book_Type value);
+  private:
+  ::proto_util_converter::testing::Book_Type _internal_type() const;
+  void _internal_set_type(::proto_util_converter::testing::Book_Type value);
+  public:
+
+  GOOGLE_PROTOBUF_EXTENSION_ACCESSORS(Book)
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Book)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::ExtensionSet _extensions_;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Book_Label > labels_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > primitive_repeated_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr title_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr snake_field_;
+  ::proto_util_converter::testing::Author* author_;
+  ::proto_util_converter::testing::Book_Data* data_;
+  ::proto_util_converter::testing::Publisher* publisher_;
+  ::proto_util_converter::testing::AnyWrapper* type_not_found_;
+  ::PROTOBUF_NAMESPACE_ID::int64 published_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 length_;
+  int type_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Publisher PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Publisher) */ {
+ public:
+  inline Publisher() : Publisher(nullptr) {};
+  virtual ~Publisher();
+
+  Publisher(const Publisher& from);
+  Publisher(Publisher&& from) noexcept
+    : Publisher() {
+    *this = ::std::move(from);
+  }
+
+  inline Publisher& operator=(const Publisher& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Publisher& operator=(Publisher&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Publisher& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Publisher* internal_default_instance() {
+    return reinterpret_cast<const Publisher*>(
+               &_Publisher_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(Publisher& a, Publisher& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Publisher* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Publisher* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Publisher* New() const final {
+    return CreateMaybeMessage<Publisher>(nullptr);
+  }
+
+  Publisher* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Publisher>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Publisher& from);
+  void MergeFrom(const Publisher& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Publisher* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Publisher";
+  }
+  protected:
+  explicit Publisher(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+  };
+  // required string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Publisher)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Author PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Author) */ {
+ public:
+  inline Author() : Author(nullptr) {};
+  virtual ~Author();
+
+  Author(const Author& from);
+  Author(Author&& from) noexcept
+    : Author() {
+    *this = ::std::move(from);
+  }
+
+  inline Author& operator=(const Author& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Author& operator=(Author&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Author& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Author* internal_default_instance() {
+    return reinterpret_cast<const Author*>(
+               &_Author_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(Author& a, Author& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Author* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Author* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Author* New() const final {
+    return CreateMaybeMessage<Author>(nullptr);
+  }
+
+  Author* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Author>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Author& from);
+  void MergeFrom(const Author& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Author* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Author";
+  }
+  protected:
+  explicit Author(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPseudonymFieldNumber = 3,
+    kFriendFieldNumber = 5,
+    kNameFieldNumber = 2,
+    kIdFieldNumber = 1,
+    kAliveFieldNumber = 4,
+  };
+  // repeated string pseudonym = 3;
+  int pseudonym_size() const;
+  private:
+  int _internal_pseudonym_size() const;
+  public:
+  void clear_pseudonym();
+  const std::string& pseudonym(int index) const;
+  std::string* mutable_pseudonym(int index);
+  void set_pseudonym(int index, const std::string& value);
+  void set_pseudonym(int index, std::string&& value);
+  void set_pseudonym(int index, const char* value);
+  void set_pseudonym(int index, const char* value, size_t size);
+  std::string* add_pseudonym();
+  void add_pseudonym(const std::string& value);
+  void add_pseudonym(std::string&& value);
+  void add_pseudonym(const char* value);
+  void add_pseudonym(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& pseudonym() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_pseudonym();
+  private:
+  const std::string& _internal_pseudonym(int index) const;
+  std::string* _internal_add_pseudonym();
+  public:
+
+  // repeated .proto_util_converter.testing.Author friend = 5;
+  int friend__size() const;
+  private:
+  int _internal_friend__size() const;
+  public:
+  void clear_friend_();
+  ::proto_util_converter::testing::Author* mutable_friend_(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >*
+      mutable_friend_();
+  private:
+  const ::proto_util_converter::testing::Author& _internal_friend_(int index) const;
+  ::proto_util_converter::testing::Author* _internal_add_friend_();
+  public:
+  const ::proto_util_converter::testing::Author& friend_(int index) const;
+  ::proto_util_converter::testing::Author* add_friend_();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >&
+      friend_() const;
+
+  // optional string name = 2;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional uint64 id = 1[json_name = "@id"];
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  ::PROTOBUF_NAMESPACE_ID::uint64 id() const;
+  void set_id(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_id() const;
+  void _internal_set_id(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // optional bool alive = 4;
+  bool has_alive() const;
+  private:
+  bool _internal_has_alive() const;
+  public:
+  void clear_alive();
+  bool alive() const;
+  void set_alive(bool value);
+  private:
+  bool _internal_alive() const;
+  void _internal_set_alive(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Author)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> pseudonym_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author > friend__;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 id_;
+  bool alive_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BadAuthor PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.BadAuthor) */ {
+ public:
+  inline BadAuthor() : BadAuthor(nullptr) {};
+  virtual ~BadAuthor();
+
+  BadAuthor(const BadAuthor& from);
+  BadAuthor(BadAuthor&& from) noexcept
+    : BadAuthor() {
+    *this = ::std::move(from);
+  }
+
+  inline BadAuthor& operator=(const BadAuthor& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BadAuthor& operator=(BadAuthor&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const BadAuthor& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const BadAuthor* internal_default_instance() {
+    return reinterpret_cast<const BadAuthor*>(
+               &_BadAuthor_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(BadAuthor& a, BadAuthor& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BadAuthor* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BadAuthor* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline BadAuthor* New() const final {
+    return CreateMaybeMessage<BadAuthor>(nullptr);
+  }
+
+  BadAuthor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<BadAuthor>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const BadAuthor& from);
+  void MergeFrom(const BadAuthor& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BadAuthor* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.BadAuthor";
+  }
+  protected:
+  explicit BadAuthor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 2,
+    kAliveFieldNumber = 4,
+    kIdFieldNumber = 1,
+    kPseudonymFieldNumber = 3,
+  };
+  // repeated uint64 name = 2;
+  int name_size() const;
+  private:
+  int _internal_name_size() const;
+  public:
+  void clear_name();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_name(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_name() const;
+  void _internal_add_name(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_name();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint64 name(int index) const;
+  void set_name(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_name(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      name() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_name();
+
+  // repeated bool alive = 4 [packed = true];
+  int alive_size() const;
+  private:
+  int _internal_alive_size() const;
+  public:
+  void clear_alive();
+  private:
+  bool _internal_alive(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      _internal_alive() const;
+  void _internal_add_alive(bool value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      _internal_mutable_alive();
+  public:
+  bool alive(int index) const;
+  void set_alive(int index, bool value);
+  void add_alive(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      alive() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_alive();
+
+  // optional string id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  const std::string& id() const;
+  void set_id(const std::string& value);
+  void set_id(std::string&& value);
+  void set_id(const char* value);
+  void set_id(const char* value, size_t size);
+  std::string* mutable_id();
+  std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // optional string pseudonym = 3;
+  bool has_pseudonym() const;
+  private:
+  bool _internal_has_pseudonym() const;
+  public:
+  void clear_pseudonym();
+  const std::string& pseudonym() const;
+  void set_pseudonym(const std::string& value);
+  void set_pseudonym(std::string&& value);
+  void set_pseudonym(const char* value);
+  void set_pseudonym(const char* value, size_t size);
+  std::string* mutable_pseudonym();
+  std::string* release_pseudonym();
+  void set_allocated_pseudonym(std::string* pseudonym);
+  private:
+  const std::string& _internal_pseudonym() const;
+  void _internal_set_pseudonym(const std::string& value);
+  std::string* _internal_mutable_pseudonym();
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.BadAuthor)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > name_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > alive_;
+  mutable std::atomic<int> _alive_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pseudonym_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Primitive PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Primitive) */ {
+ public:
+  inline Primitive() : Primitive(nullptr) {};
+  virtual ~Primitive();
+
+  Primitive(const Primitive& from);
+  Primitive(Primitive&& from) noexcept
+    : Primitive() {
+    *this = ::std::move(from);
+  }
+
+  inline Primitive& operator=(const Primitive& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Primitive& operator=(Primitive&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Primitive& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Primitive* internal_default_instance() {
+    return reinterpret_cast<const Primitive*>(
+               &_Primitive_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(Primitive& a, Primitive& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Primitive* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Primitive* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Primitive* New() const final {
+    return CreateMaybeMessage<Primitive>(nullptr);
+  }
+
+  Primitive* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Primitive>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Primitive& from);
+  void MergeFrom(const Primitive& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Primitive* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Primitive";
+  }
+  protected:
+  explicit Primitive(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepFix32FieldNumber = 16,
+    kRepU32FieldNumber = 17,
+    kRepI32FieldNumber = 18,
+    kRepSf32FieldNumber = 19,
+    kRepS32FieldNumber = 20,
+    kRepFix64FieldNumber = 21,
+    kRepU64FieldNumber = 22,
+    kRepI64FieldNumber = 23,
+    kRepSf64FieldNumber = 24,
+    kRepS64FieldNumber = 25,
+    kRepStrFieldNumber = 26,
+    kRepBytesFieldNumber = 27,
+    kRepFloatFieldNumber = 28,
+    kRepDoubleFieldNumber = 29,
+    kRepBoolFieldNumber = 30,
+    kStrFieldNumber = 11,
+    kBytesFieldNumber = 12,
+    kFix32FieldNumber = 1,
+    kU32FieldNumber = 2,
+    kI32FieldNumber = 3,
+    kSf32FieldNumber = 4,
+    kFix64FieldNumber = 6,
+    kU64FieldNumber = 7,
+    kI64FieldNumber = 8,
+    kSf64FieldNumber = 9,
+    kS32FieldNumber = 5,
+    kFloatFieldNumber = 13,
+    kS64FieldNumber = 10,
+    kDoubleFieldNumber = 14,
+    kBoolFieldNumber = 15,
+  };
+  // repeated fixed32 rep_fix32 = 16;
+  int rep_fix32_size() const;
+  private:
+  int _internal_rep_fix32_size() const;
+  public:
+  void clear_rep_fix32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_rep_fix32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_rep_fix32() const;
+  void _internal_add_rep_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_rep_fix32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 rep_fix32(int index) const;
+  void set_rep_fix32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_rep_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      rep_fix32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_rep_fix32();
+
+  // repeated uint32 rep_u32 = 17;
+  int rep_u32_size() const;
+  private:
+  int _internal_rep_u32_size() const;
+  public:
+  void clear_rep_u32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_rep_u32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_rep_u32() const;
+  void _internal_add_rep_u32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_rep_u32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 rep_u32(int index) const;
+  void set_rep_u32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_rep_u32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      rep_u32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_rep_u32();
+
+  // repeated int32 rep_i32 = 18;
+  int rep_i32_size() const;
+  private:
+  int _internal_rep_i32_size() const;
+  public:
+  void clear_rep_i32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_rep_i32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_rep_i32() const;
+  void _internal_add_rep_i32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_rep_i32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 rep_i32(int index) const;
+  void set_rep_i32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_rep_i32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      rep_i32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_rep_i32();
+
+  // repeated sfixed32 rep_sf32 = 19;
+  int rep_sf32_size() const;
+  private:
+  int _internal_rep_sf32_size() const;
+  public:
+  void clear_rep_sf32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_rep_sf32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_rep_sf32() const;
+  void _internal_add_rep_sf32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_rep_sf32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 rep_sf32(int index) const;
+  void set_rep_sf32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_rep_sf32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      rep_sf32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_rep_sf32();
+
+  // repeated sint32 rep_s32 = 20;
+  int rep_s32_size() const;
+  private:
+  int _internal_rep_s32_size() const;
+  public:
+  void clear_rep_s32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_rep_s32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_rep_s32() const;
+  void _internal_add_rep_s32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_rep_s32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 rep_s32(int index) const;
+  void set_rep_s32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_rep_s32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      rep_s32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_rep_s32();
+
+  // repeated fixed64 rep_fix64 = 21;
+  int rep_fix64_size() const;
+  private:
+  int _internal_rep_fix64_size() const;
+  public:
+  void clear_rep_fix64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_rep_fix64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_rep_fix64() const;
+  void _internal_add_rep_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_rep_fix64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint64 rep_fix64(int index) const;
+  void set_rep_fix64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_rep_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      rep_fix64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_rep_fix64();
+
+  // repeated uint64 rep_u64 = 22;
+  int rep_u64_size() const;
+  private:
+  int _internal_rep_u64_size() const;
+  public:
+  void clear_rep_u64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_rep_u64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_rep_u64() const;
+  void _internal_add_rep_u64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_rep_u64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint64 rep_u64(int index) const;
+  void set_rep_u64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_rep_u64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      rep_u64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_rep_u64();
+
+  // repeated int64 rep_i64 = 23;
+  int rep_i64_size() const;
+  private:
+  int _internal_rep_i64_size() const;
+  public:
+  void clear_rep_i64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_rep_i64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_rep_i64() const;
+  void _internal_add_rep_i64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_rep_i64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 rep_i64(int index) const;
+  void set_rep_i64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_rep_i64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      rep_i64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_rep_i64();
+
+  // repeated sfixed64 rep_sf64 = 24;
+  int rep_sf64_size() const;
+  private:
+  int _internal_rep_sf64_size() const;
+  public:
+  void clear_rep_sf64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_rep_sf64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_rep_sf64() const;
+  void _internal_add_rep_sf64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_rep_sf64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 rep_sf64(int index) const;
+  void set_rep_sf64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_rep_sf64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      rep_sf64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_rep_sf64();
+
+  // repeated sint64 rep_s64 = 25;
+  int rep_s64_size() const;
+  private:
+  int _internal_rep_s64_size() const;
+  public:
+  void clear_rep_s64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_rep_s64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_rep_s64() const;
+  void _internal_add_rep_s64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_rep_s64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 rep_s64(int index) const;
+  void set_rep_s64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_rep_s64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      rep_s64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_rep_s64();
+
+  // repeated string rep_str = 26;
+  int rep_str_size() const;
+  private:
+  int _internal_rep_str_size() const;
+  public:
+  void clear_rep_str();
+  const std::string& rep_str(int index) const;
+  std::string* mutable_rep_str(int index);
+  void set_rep_str(int index, const std::string& value);
+  void set_rep_str(int index, std::string&& value);
+  void set_rep_str(int index, const char* value);
+  void set_rep_str(int index, const char* value, size_t size);
+  std::string* add_rep_str();
+  void add_rep_str(const std::string& value);
+  void add_rep_str(std::string&& value);
+  void add_rep_str(const char* value);
+  void add_rep_str(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& rep_str() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_rep_str();
+  private:
+  const std::string& _internal_rep_str(int index) const;
+  std::string* _internal_add_rep_str();
+  public:
+
+  // repeated bytes rep_bytes = 27;
+  int rep_bytes_size() const;
+  private:
+  int _internal_rep_bytes_size() const;
+  public:
+  void clear_rep_bytes();
+  const std::string& rep_bytes(int index) const;
+  std::string* mutable_rep_bytes(int index);
+  void set_rep_bytes(int index, const std::string& value);
+  void set_rep_bytes(int index, std::string&& value);
+  void set_rep_bytes(int index, const char* value);
+  void set_rep_bytes(int index, const void* value, size_t size);
+  std::string* add_rep_bytes();
+  void add_rep_bytes(const std::string& value);
+  void add_rep_bytes(std::string&& value);
+  void add_rep_bytes(const char* value);
+  void add_rep_bytes(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& rep_bytes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_rep_bytes();
+  private:
+  const std::string& _internal_rep_bytes(int index) const;
+  std::string* _internal_add_rep_bytes();
+  public:
+
+  // repeated float rep_float = 28;
+  int rep_float_size() const;
+  private:
+  int _internal_rep_float_size() const;
+  public:
+  void clear_rep_float();
+  private:
+  float _internal_rep_float(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_rep_float() const;
+  void _internal_add_rep_float(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_rep_float();
+  public:
+  float rep_float(int index) const;
+  void set_rep_float(int index, float value);
+  void add_rep_float(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      rep_float() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_rep_float();
+
+  // repeated double rep_double = 29;
+  int rep_double_size() const;
+  private:
+  int _internal_rep_double_size() const;
+  public:
+  void clear_rep_double();
+  private:
+  double _internal_rep_double(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_rep_double() const;
+  void _internal_add_rep_double(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_rep_double();
+  public:
+  double rep_double(int index) const;
+  void set_rep_double(int index, double value);
+  void add_rep_double(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      rep_double() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_rep_double();
+
+  // repeated bool rep_bool = 30;
+  int rep_bool_size() const;
+  private:
+  int _internal_rep_bool_size() const;
+  public:
+  void clear_rep_bool();
+  private:
+  bool _internal_rep_bool(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      _internal_rep_bool() const;
+  void _internal_add_rep_bool(bool value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      _internal_mutable_rep_bool();
+  public:
+  bool rep_bool(int index) const;
+  void set_rep_bool(int index, bool value);
+  void add_rep_bool(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      rep_bool() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_rep_bool();
+
+  // optional string str = 11;
+  bool has_str() const;
+  private:
+  bool _internal_has_str() const;
+  public:
+  void clear_str();
+  const std::string& str() const;
+  void set_str(const std::string& value);
+  void set_str(std::string&& value);
+  void set_str(const char* value);
+  void set_str(const char* value, size_t size);
+  std::string* mutable_str();
+  std::string* release_str();
+  void set_allocated_str(std::string* str);
+  private:
+  const std::string& _internal_str() const;
+  void _internal_set_str(const std::string& value);
+  std::string* _internal_mutable_str();
+  public:
+
+  // optional bytes bytes = 12;
+  bool has_bytes() const;
+  private:
+  bool _internal_has_bytes() const;
+  public:
+  void clear_bytes();
+  const std::string& bytes() const;
+  void set_bytes(const std::string& value);
+  void set_bytes(std::string&& value);
+  void set_bytes(const char* value);
+  void set_bytes(const void* value, size_t size);
+  std::string* mutable_bytes();
+  std::string* release_bytes();
+  void set_allocated_bytes(std::string* bytes);
+  private:
+  const std::string& _internal_bytes() const;
+  void _internal_set_bytes(const std::string& value);
+  std::string* _internal_mutable_bytes();
+  public:
+
+  // optional fixed32 fix32 = 1;
+  bool has_fix32() const;
+  private:
+  bool _internal_has_fix32() const;
+  public:
+  void clear_fix32();
+  ::PROTOBUF_NAMESPACE_ID::uint32 fix32() const;
+  void set_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_fix32() const;
+  void _internal_set_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // optional uint32 u32 = 2;
+  bool has_u32() const;
+  private:
+  bool _internal_has_u32() const;
+  public:
+  void clear_u32();
+  ::PROTOBUF_NAMESPACE_ID::uint32 u32() const;
+  void set_u32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_u32() const;
+  void _internal_set_u32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // optional int32 i32 = 3;
+  bool has_i32() const;
+  private:
+  bool _internal_has_i32() const;
+  public:
+  void clear_i32();
+  ::PROTOBUF_NAMESPACE_ID::int32 i32() const;
+  void set_i32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_i32() const;
+  void _internal_set_i32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // optional sfixed32 sf32 = 4;
+  bool has_sf32() const;
+  private:
+  bool _internal_has_sf32() const;
+  public:
+  void clear_sf32();
+  ::PROTOBUF_NAMESPACE_ID::int32 sf32() const;
+  void set_sf32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_sf32() const;
+  void _internal_set_sf32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // optional fixed64 fix64 = 6;
+  bool has_fix64() const;
+  private:
+  bool _internal_has_fix64() const;
+  public:
+  void clear_fix64();
+  ::PROTOBUF_NAMESPACE_ID::uint64 fix64() const;
+  void set_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_fix64() const;
+  void _internal_set_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // optional uint64 u64 = 7;
+  bool has_u64() const;
+  private:
+  bool _internal_has_u64() const;
+  public:
+  void clear_u64();
+  ::PROTOBUF_NAMESPACE_ID::uint64 u64() const;
+  void set_u64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_u64() const;
+  void _internal_set_u64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // optional int64 i64 = 8;
+  bool has_i64() const;
+  private:
+  bool _internal_has_i64() const;
+  public:
+  void clear_i64();
+  ::PROTOBUF_NAMESPACE_ID::int64 i64() const;
+  void set_i64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_i64() const;
+  void _internal_set_i64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  public:
+
+  // optional sfixed64 sf64 = 9;
+  bool has_sf64() const;
+  private:
+  bool _internal_has_sf64() const;
+  public:
+  void clear_sf64();
+  ::PROTOBUF_NAMESPACE_ID::int64 sf64() const;
+  void set_sf64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_sf64() const;
+  void _internal_set_sf64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  public:
+
+  // optional sint32 s32 = 5;
+  bool has_s32() const;
+  private:
+  bool _internal_has_s32() const;
+  public:
+  void clear_s32();
+  ::PROTOBUF_NAMESPACE_ID::int32 s32() const;
+  void set_s32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_s32() const;
+  void _internal_set_s32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // optional float float = 13;
+  bool has_float_() const;
+  private:
+  bool _internal_has_float_() const;
+  public:
+  void clear_float_();
+  float float_() const;
+  void set_float_(float value);
+  private:
+  float _internal_float_() const;
+  void _internal_set_float_(float value);
+  public:
+
+  // optional sint64 s64 = 10;
+  bool has_s64() const;
+  private:
+  bool _internal_has_s64() const;
+  public:
+  void clear_s64();
+  ::PROTOBUF_NAMESPACE_ID::int64 s64() const;
+  void set_s64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_s64() const;
+  void _internal_set_s64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  public:
+
+  // optional double double = 14;
+  bool has_double_() const;
+  private:
+  bool _internal_has_double_() const;
+  public:
+  void clear_double_();
+  double double_() const;
+  void set_double_(double value);
+  private:
+  double _internal_double_() const;
+  void _internal_set_double_(double value);
+  public:
+
+  // optional bool bool = 15;
+  bool has_bool_() const;
+  private:
+  bool _internal_has_bool_() const;
+  public:
+  void clear_bool_();
+  bool bool_() const;
+  void set_bool_(bool value);
+  private:
+  bool _internal_bool_() const;
+  void _internal_set_bool_(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Primitive)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > rep_fix32_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > rep_u32_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > rep_i32_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > rep_sf32_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > rep_s32_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > rep_fix64_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > rep_u64_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > rep_i64_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > rep_sf64_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > rep_s64_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> rep_str_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> rep_bytes_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > rep_float_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > rep_double_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > rep_bool_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr str_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bytes_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 fix32_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 u32_;
+  ::PROTOBUF_NAMESPACE_ID::int32 i32_;
+  ::PROTOBUF_NAMESPACE_ID::int32 sf32_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 fix64_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 u64_;
+  ::PROTOBUF_NAMESPACE_ID::int64 i64_;
+  ::PROTOBUF_NAMESPACE_ID::int64 sf64_;
+  ::PROTOBUF_NAMESPACE_ID::int32 s32_;
+  float float__;
+  ::PROTOBUF_NAMESPACE_ID::int64 s64_;
+  double double__;
+  bool bool__;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PackedPrimitive PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.PackedPrimitive) */ {
+ public:
+  inline PackedPrimitive() : PackedPrimitive(nullptr) {};
+  virtual ~PackedPrimitive();
+
+  PackedPrimitive(const PackedPrimitive& from);
+  PackedPrimitive(PackedPrimitive&& from) noexcept
+    : PackedPrimitive() {
+    *this = ::std::move(from);
+  }
+
+  inline PackedPrimitive& operator=(const PackedPrimitive& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PackedPrimitive& operator=(PackedPrimitive&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const PackedPrimitive& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const PackedPrimitive* internal_default_instance() {
+    return reinterpret_cast<const PackedPrimitive*>(
+               &_PackedPrimitive_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(PackedPrimitive& a, PackedPrimitive& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackedPrimitive* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackedPrimitive* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline PackedPrimitive* New() const final {
+    return CreateMaybeMessage<PackedPrimitive>(nullptr);
+  }
+
+  PackedPrimitive* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<PackedPrimitive>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const PackedPrimitive& from);
+  void MergeFrom(const PackedPrimitive& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PackedPrimitive* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.PackedPrimitive";
+  }
+  protected:
+  explicit PackedPrimitive(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepFix32FieldNumber = 16,
+    kRepU32FieldNumber = 17,
+    kRepI32FieldNumber = 18,
+    kRepSf32FieldNumber = 19,
+    kRepS32FieldNumber = 20,
+    kRepFix64FieldNumber = 21,
+    kRepU64FieldNumber = 22,
+    kRepI64FieldNumber = 23,
+    kRepSf64FieldNumber = 24,
+    kRepS64FieldNumber = 25,
+    kRepFloatFieldNumber = 28,
+    kRepDoubleFieldNumber = 29,
+    kRepBoolFieldNumber = 30,
+  };
+  // repeated fixed32 rep_fix32 = 16 [packed = true];
+  int rep_fix32_size() const;
+  private:
+  int _internal_rep_fix32_size() const;
+  public:
+  void clear_rep_fix32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_rep_fix32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_rep_fix32() const;
+  void _internal_add_rep_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_rep_fix32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 rep_fix32(int index) const;
+  void set_rep_fix32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_rep_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      rep_fix32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_rep_fix32();
+
+  // repeated uint32 rep_u32 = 17 [packed = true];
+  int rep_u32_size() const;
+  private:
+  int _internal_rep_u32_size() const;
+  public:
+  void clear_rep_u32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_rep_u32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_rep_u32() const;
+  void _internal_add_rep_u32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_rep_u32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 rep_u32(int index) const;
+  void set_rep_u32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_rep_u32(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      rep_u32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_rep_u32();
+
+  // repeated int32 rep_i32 = 18 [packed = true];
+  int rep_i32_size() const;
+  private:
+  int _internal_rep_i32_size() const;
+  public:
+  void clear_rep_i32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_rep_i32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_rep_i32() const;
+  void _internal_add_rep_i32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_rep_i32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 rep_i32(int index) const;
+  void set_rep_i32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_rep_i32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      rep_i32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_rep_i32();
+
+  // repeated sfixed32 rep_sf32 = 19 [packed = true];
+  int rep_sf32_size() const;
+  private:
+  int _internal_rep_sf32_size() const;
+  public:
+  void clear_rep_sf32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_rep_sf32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_rep_sf32() const;
+  void _internal_add_rep_sf32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_rep_sf32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 rep_sf32(int index) const;
+  void set_rep_sf32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_rep_sf32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      rep_sf32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_rep_sf32();
+
+  // repeated sint32 rep_s32 = 20 [packed = true];
+  int rep_s32_size() const;
+  private:
+  int _internal_rep_s32_size() const;
+  public:
+  void clear_rep_s32();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_rep_s32(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_rep_s32() const;
+  void _internal_add_rep_s32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_rep_s32();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 rep_s32(int index) const;
+  void set_rep_s32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_rep_s32(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      rep_s32() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_rep_s32();
+
+  // repeated fixed64 rep_fix64 = 21 [packed = true];
+  int rep_fix64_size() const;
+  private:
+  int _internal_rep_fix64_size() const;
+  public:
+  void clear_rep_fix64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_rep_fix64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_rep_fix64() const;
+  void _internal_add_rep_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_rep_fix64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint64 rep_fix64(int index) const;
+  void set_rep_fix64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_rep_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      rep_fix64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_rep_fix64();
+
+  // repeated uint64 rep_u64 = 22 [packed = true];
+  int rep_u64_size() const;
+  private:
+  int _internal_rep_u64_size() const;
+  public:
+  void clear_rep_u64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_rep_u64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      _internal_rep_u64() const;
+  void _internal_add_rep_u64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      _internal_mutable_rep_u64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint64 rep_u64(int index) const;
+  void set_rep_u64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void add_rep_u64(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+      rep_u64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+      mutable_rep_u64();
+
+  // repeated int64 rep_i64 = 23 [packed = true];
+  int rep_i64_size() const;
+  private:
+  int _internal_rep_i64_size() const;
+  public:
+  void clear_rep_i64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_rep_i64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_rep_i64() const;
+  void _internal_add_rep_i64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_rep_i64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 rep_i64(int index) const;
+  void set_rep_i64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_rep_i64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      rep_i64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_rep_i64();
+
+  // repeated sfixed64 rep_sf64 = 24 [packed = true];
+  int rep_sf64_size() const;
+  private:
+  int _internal_rep_sf64_size() const;
+  public:
+  void clear_rep_sf64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_rep_sf64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_rep_sf64() const;
+  void _internal_add_rep_sf64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_rep_sf64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 rep_sf64(int index) const;
+  void set_rep_sf64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_rep_sf64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      rep_sf64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_rep_sf64();
+
+  // repeated sint64 rep_s64 = 25 [packed = true];
+  int rep_s64_size() const;
+  private:
+  int _internal_rep_s64_size() const;
+  public:
+  void clear_rep_s64();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_rep_s64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_rep_s64() const;
+  void _internal_add_rep_s64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_rep_s64();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 rep_s64(int index) const;
+  void set_rep_s64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_rep_s64(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      rep_s64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_rep_s64();
+
+  // repeated float rep_float = 28 [packed = true];
+  int rep_float_size() const;
+  private:
+  int _internal_rep_float_size() const;
+  public:
+  void clear_rep_float();
+  private:
+  float _internal_rep_float(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_rep_float() const;
+  void _internal_add_rep_float(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_rep_float();
+  public:
+  float rep_float(int index) const;
+  void set_rep_float(int index, float value);
+  void add_rep_float(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      rep_float() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_rep_float();
+
+  // repeated double rep_double = 29 [packed = true];
+  int rep_double_size() const;
+  private:
+  int _internal_rep_double_size() const;
+  public:
+  void clear_rep_double();
+  private:
+  double _internal_rep_double(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_rep_double() const;
+  void _internal_add_rep_double(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_rep_double();
+  public:
+  double rep_double(int index) const;
+  void set_rep_double(int index, double value);
+  void add_rep_double(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      rep_double() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_rep_double();
+
+  // repeated bool rep_bool = 30 [packed = true];
+  int rep_bool_size() const;
+  private:
+  int _internal_rep_bool_size() const;
+  public:
+  void clear_rep_bool();
+  private:
+  bool _internal_rep_bool(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      _internal_rep_bool() const;
+  void _internal_add_rep_bool(bool value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      _internal_mutable_rep_bool();
+  public:
+  bool rep_bool(int index) const;
+  void set_rep_bool(int index, bool value);
+  void add_rep_bool(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      rep_bool() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_rep_bool();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.PackedPrimitive)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > rep_fix32_;
+  mutable std::atomic<int> _rep_fix32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > rep_u32_;
+  mutable std::atomic<int> _rep_u32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > rep_i32_;
+  mutable std::atomic<int> _rep_i32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > rep_sf32_;
+  mutable std::atomic<int> _rep_sf32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > rep_s32_;
+  mutable std::atomic<int> _rep_s32_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > rep_fix64_;
+  mutable std::atomic<int> _rep_fix64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > rep_u64_;
+  mutable std::atomic<int> _rep_u64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > rep_i64_;
+  mutable std::atomic<int> _rep_i64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > rep_sf64_;
+  mutable std::atomic<int> _rep_sf64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > rep_s64_;
+  mutable std::atomic<int> _rep_s64_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > rep_float_;
+  mutable std::atomic<int> _rep_float_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > rep_double_;
+  mutable std::atomic<int> _rep_double_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > rep_bool_;
+  mutable std::atomic<int> _rep_bool_cached_byte_size_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NestedBook PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.NestedBook) */ {
+ public:
+  inline NestedBook() : NestedBook(nullptr) {};
+  virtual ~NestedBook();
+
+  NestedBook(const NestedBook& from);
+  NestedBook(NestedBook&& from) noexcept
+    : NestedBook() {
+    *this = ::std::move(from);
+  }
+
+  inline NestedBook& operator=(const NestedBook& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NestedBook& operator=(NestedBook&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const NestedBook& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const NestedBook* internal_default_instance() {
+    return reinterpret_cast<const NestedBook*>(
+               &_NestedBook_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(NestedBook& a, NestedBook& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NestedBook* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NestedBook* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline NestedBook* New() const final {
+    return CreateMaybeMessage<NestedBook>(nullptr);
+  }
+
+  NestedBook* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<NestedBook>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const NestedBook& from);
+  void MergeFrom(const NestedBook& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NestedBook* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.NestedBook";
+  }
+  protected:
+  explicit NestedBook(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBookFieldNumber = 1,
+  };
+  // optional .proto_util_converter.testing.Book book = 1;
+  bool has_book() const;
+  private:
+  bool _internal_has_book() const;
+  public:
+  void clear_book();
+  const ::proto_util_converter::testing::Book& book() const;
+  ::proto_util_converter::testing::Book* release_book();
+  ::proto_util_converter::testing::Book* mutable_book();
+  void set_allocated_book(::proto_util_converter::testing::Book* book);
+  private:
+  const ::proto_util_converter::testing::Book& _internal_book() const;
+  ::proto_util_converter::testing::Book* _internal_mutable_book();
+  public:
+  void unsafe_arena_set_allocated_book(
+      ::proto_util_converter::testing::Book* book);
+  ::proto_util_converter::testing::Book* unsafe_arena_release_book();
+
+  static const int kAnotherBookFieldNumber = 301;
+  static ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::proto_util_converter::testing::Book,
+      ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::proto_util_converter::testing::NestedBook >, 11, false >
+    another_book;
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.NestedBook)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::proto_util_converter::testing::Book* book_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BadNestedBook PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.BadNestedBook) */ {
+ public:
+  inline BadNestedBook() : BadNestedBook(nullptr) {};
+  virtual ~BadNestedBook();
+
+  BadNestedBook(const BadNestedBook& from);
+  BadNestedBook(BadNestedBook&& from) noexcept
+    : BadNestedBook() {
+    *this = ::std::move(from);
+  }
+
+  inline BadNestedBook& operator=(const BadNestedBook& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BadNestedBook& operator=(BadNestedBook&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const BadNestedBook& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const BadNestedBook* internal_default_instance() {
+    return reinterpret_cast<const BadNestedBook*>(
+               &_BadNestedBook_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(BadNestedBook& a, BadNestedBook& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BadNestedBook* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BadNestedBook* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline BadNestedBook* New() const final {
+    return CreateMaybeMessage<BadNestedBook>(nullptr);
+  }
+
+  BadNestedBook* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<BadNestedBook>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const BadNestedBook& from);
+  void MergeFrom(const BadNestedBook& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BadNestedBook* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.BadNestedBook";
+  }
+  protected:
+  explicit BadNestedBook(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBookFieldNumber = 1,
+  };
+  // repeated uint32 book = 1 [packed = true];
+  int book_size() const;
+  private:
+  int _internal_book_size() const;
+  public:
+  void clear_book();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_book(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_book() const;
+  void _internal_add_book(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_book();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 book(int index) const;
+  void set_book(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_book(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      book() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_book();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.BadNestedBook)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > book_;
+  mutable std::atomic<int> _book_cached_byte_size_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Cyclic PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.Cyclic) */ {
+ public:
+  inline Cyclic() : Cyclic(nullptr) {};
+  virtual ~Cyclic();
+
+  Cyclic(const Cyclic& from);
+  Cyclic(Cyclic&& from) noexcept
+    : Cyclic() {
+    *this = ::std::move(from);
+  }
+
+  inline Cyclic& operator=(const Cyclic& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Cyclic& operator=(Cyclic&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Cyclic& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Cyclic* internal_default_instance() {
+    return reinterpret_cast<const Cyclic*>(
+               &_Cyclic_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(Cyclic& a, Cyclic& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Cyclic* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Cyclic* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Cyclic* New() const final {
+    return CreateMaybeMessage<Cyclic>(nullptr);
+  }
+
+  Cyclic* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Cyclic>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Cyclic& from);
+  void MergeFrom(const Cyclic& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Cyclic* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.Cyclic";
+  }
+  protected:
+  explicit Cyclic(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMAuthorFieldNumber = 5,
+    kMStrFieldNumber = 2,
+    kMBookFieldNumber = 3,
+    kMCyclicFieldNumber = 4,
+    kMIntFieldNumber = 1,
+  };
+  // repeated .proto_util_converter.testing.Author m_author = 5;
+  int m_author_size() const;
+  private:
+  int _internal_m_author_size() const;
+  public:
+  void clear_m_author();
+  ::proto_util_converter::testing::Author* mutable_m_author(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >*
+      mutable_m_author();
+  private:
+  const ::proto_util_converter::testing::Author& _internal_m_author(int index) const;
+  ::proto_util_converter::testing::Author* _internal_add_m_author();
+  public:
+  const ::proto_util_converter::testing::Author& m_author(int index) const;
+  ::proto_util_converter::testing::Author* add_m_author();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >&
+      m_author() const;
+
+  // optional string m_str = 2;
+  bool has_m_str() const;
+  private:
+  bool _internal_has_m_str() const;
+  public:
+  void clear_m_str();
+  const std::string& m_str() const;
+  void set_m_str(const std::string& value);
+  void set_m_str(std::string&& value);
+  void set_m_str(const char* value);
+  void set_m_str(const char* value, size_t size);
+  std::string* mutable_m_str();
+  std::string* release_m_str();
+  void set_allocated_m_str(std::string* m_str);
+  private:
+  const std::string& _internal_m_str() const;
+  void _internal_set_m_str(const std::string& value);
+  std::string* _internal_mutable_m_str();
+  public:
+
+  // optional .proto_util_converter.testing.Book m_book = 3;
+  bool has_m_book() const;
+  private:
+  bool _internal_has_m_book() const;
+  public:
+  void clear_m_book();
+  const ::proto_util_converter::testing::Book& m_book() const;
+  ::proto_util_converter::testing::Book* release_m_book();
+  ::proto_util_converter::testing::Book* mutable_m_book();
+  void set_allocated_m_book(::proto_util_converter::testing::Book* m_book);
+  private:
+  const ::proto_util_converter::testing::Book& _internal_m_book() const;
+  ::proto_util_converter::testing::Book* _internal_mutable_m_book();
+  public:
+  void unsafe_arena_set_allocated_m_book(
+      ::proto_util_converter::testing::Book* m_book);
+  ::proto_util_converter::testing::Book* unsafe_arena_release_m_book();
+
+  // optional .proto_util_converter.testing.Cyclic m_cyclic = 4;
+  bool has_m_cyclic() const;
+  private:
+  bool _internal_has_m_cyclic() const;
+  public:
+  void clear_m_cyclic();
+  const ::proto_util_converter::testing::Cyclic& m_cyclic() const;
+  ::proto_util_converter::testing::Cyclic* release_m_cyclic();
+  ::proto_util_converter::testing::Cyclic* mutable_m_cyclic();
+  void set_allocated_m_cyclic(::proto_util_converter::testing::Cyclic* m_cyclic);
+  private:
+  const ::proto_util_converter::testing::Cyclic& _internal_m_cyclic() const;
+  ::proto_util_converter::testing::Cyclic* _internal_mutable_m_cyclic();
+  public:
+  void unsafe_arena_set_allocated_m_cyclic(
+      ::proto_util_converter::testing::Cyclic* m_cyclic);
+  ::proto_util_converter::testing::Cyclic* unsafe_arena_release_m_cyclic();
+
+  // optional int32 m_int = 1;
+  bool has_m_int() const;
+  private:
+  bool _internal_has_m_int() const;
+  public:
+  void clear_m_int();
+  ::PROTOBUF_NAMESPACE_ID::int32 m_int() const;
+  void set_m_int(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_m_int() const;
+  void _internal_set_m_int(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.Cyclic)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author > m_author_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr m_str_;
+  ::proto_util_converter::testing::Book* m_book_;
+  ::proto_util_converter::testing::Cyclic* m_cyclic_;
+  ::PROTOBUF_NAMESPACE_ID::int32 m_int_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestJsonName1 PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.TestJsonName1) */ {
+ public:
+  inline TestJsonName1() : TestJsonName1(nullptr) {};
+  virtual ~TestJsonName1();
+
+  TestJsonName1(const TestJsonName1& from);
+  TestJsonName1(TestJsonName1&& from) noexcept
+    : TestJsonName1() {
+    *this = ::std::move(from);
+  }
+
+  inline TestJsonName1& operator=(const TestJsonName1& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestJsonName1& operator=(TestJsonName1&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestJsonName1& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestJsonName1* internal_default_instance() {
+    return reinterpret_cast<const TestJsonName1*>(
+               &_TestJsonName1_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(TestJsonName1& a, TestJsonName1& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestJsonName1* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestJsonName1* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestJsonName1* New() const final {
+    return CreateMaybeMessage<TestJsonName1>(nullptr);
+  }
+
+  TestJsonName1* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestJsonName1>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestJsonName1& from);
+  void MergeFrom(const TestJsonName1& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestJsonName1* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.TestJsonName1";
+  }
+  protected:
+  explicit TestJsonName1(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOneValueFieldNumber = 1,
+  };
+  // optional int32 one_value = 1[json_name = "value"];
+  bool has_one_value() const;
+  private:
+  bool _internal_has_one_value() const;
+  public:
+  void clear_one_value();
+  ::PROTOBUF_NAMESPACE_ID::int32 one_value() const;
+  void set_one_value(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_one_value() const;
+  void _internal_set_one_value(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.TestJsonName1)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::int32 one_value_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestJsonName2 PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.TestJsonName2) */ {
+ public:
+  inline TestJsonName2() : TestJsonName2(nullptr) {};
+  virtual ~TestJsonName2();
+
+  TestJsonName2(const TestJsonName2& from);
+  TestJsonName2(TestJsonName2&& from) noexcept
+    : TestJsonName2() {
+    *this = ::std::move(from);
+  }
+
+  inline TestJsonName2& operator=(const TestJsonName2& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestJsonName2& operator=(TestJsonName2&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestJsonName2& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestJsonName2* internal_default_instance() {
+    return reinterpret_cast<const TestJsonName2*>(
+               &_TestJsonName2_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(TestJsonName2& a, TestJsonName2& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestJsonName2* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestJsonName2* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestJsonName2* New() const final {
+    return CreateMaybeMessage<TestJsonName2>(nullptr);
+  }
+
+  TestJsonName2* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestJsonName2>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestJsonName2& from);
+  void MergeFrom(const TestJsonName2& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestJsonName2* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.TestJsonName2";
+  }
+  protected:
+  explicit TestJsonName2(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAnotherValueFieldNumber = 1,
+  };
+  // optional int32 another_value = 1[json_name = "value"];
+  bool has_another_value() const;
+  private:
+  bool _internal_has_another_value() const;
+  public:
+  void clear_another_value();
+  ::PROTOBUF_NAMESPACE_ID::int32 another_value() const;
+  void set_another_value(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_another_value() const;
+  void _internal_set_another_value(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.TestJsonName2)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::int32 another_value_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestPrimitiveFieldsWithSameJsonName PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName) */ {
+ public:
+  inline TestPrimitiveFieldsWithSameJsonName() : TestPrimitiveFieldsWithSameJsonName(nullptr) {};
+  virtual ~TestPrimitiveFieldsWithSameJsonName();
+
+  TestPrimitiveFieldsWithSameJsonName(const TestPrimitiveFieldsWithSameJsonName& from);
+  TestPrimitiveFieldsWithSameJsonName(TestPrimitiveFieldsWithSameJsonName&& from) noexcept
+    : TestPrimitiveFieldsWithSameJsonName() {
+    *this = ::std::move(from);
+  }
+
+  inline TestPrimitiveFieldsWithSameJsonName& operator=(const TestPrimitiveFieldsWithSameJsonName& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestPrimitiveFieldsWithSameJsonName& operator=(TestPrimitiveFieldsWithSameJsonName&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestPrimitiveFieldsWithSameJsonName& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestPrimitiveFieldsWithSameJsonName* internal_default_instance() {
+    return reinterpret_cast<const TestPrimitiveFieldsWithSameJsonName*>(
+               &_TestPrimitiveFieldsWithSameJsonName_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(TestPrimitiveFieldsWithSameJsonName& a, TestPrimitiveFieldsWithSameJsonName& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestPrimitiveFieldsWithSameJsonName* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestPrimitiveFieldsWithSameJsonName* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestPrimitiveFieldsWithSameJsonName* New() const final {
+    return CreateMaybeMessage<TestPrimitiveFieldsWithSameJsonName>(nullptr);
+  }
+
+  TestPrimitiveFieldsWithSameJsonName* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestPrimitiveFieldsWithSameJsonName>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestPrimitiveFieldsWithSameJsonName& from);
+  void MergeFrom(const TestPrimitiveFieldsWithSameJsonName& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestPrimitiveFieldsWithSameJsonName* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName";
+  }
+  protected:
+  explicit TestPrimitiveFieldsWithSameJsonName(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValStr1FieldNumber = 1,
+    kValStr1FieldNumber_2 = 2,
+    kValInt321FieldNumber = 3,
+    kValInt321FieldNumber_4 = 4,
+    kValUint321FieldNumber = 5,
+    kValUint321FieldNumber_6 = 6,
+    kValInt641FieldNumber = 7,
+    kValInt641FieldNumber_8 = 8,
+    kValUint641FieldNumber = 9,
+    kValUint641FieldNumber_10 = 10,
+    kValBool1FieldNumber = 11,
+    kValBool1FieldNumber_12 = 12,
+    kValFloat1FieldNumber = 15,
+    kValDouble1FieldNumber = 13,
+    kValDouble1FieldNumber_14 = 14,
+    kValFloat1FieldNumber_16 = 16,
+  };
+  // optional string val_str1 = 1;
+  bool has_val_str1() const;
+  private:
+  bool _internal_has_val_str1() const;
+  public:
+  void clear_val_str1();
+  const std::string& val_str1() const;
+  void set_val_str1(const std::string& value);
+  void set_val_str1(std::string&& value);
+  void set_val_str1(const char* value);
+  void set_val_str1(const char* value, size_t size);
+  std::string* mutable_val_str1();
+  std::string* release_val_str1();
+  void set_allocated_val_str1(std::string* val_str1);
+  private:
+  const std::string& _internal_val_str1() const;
+  void _internal_set_val_str1(const std::string& value);
+  std::string* _internal_mutable_val_str1();
+  public:
+
+  // optional string val_str_1 = 2;
+  bool has_val_str_1() const;
+  private:
+  bool _internal_has_val_str_1() const;
+  public:
+  void clear_val_str_1();
+  const std::string& val_str_1() const;
+  void set_val_str_1(const std::string& value);
+  void set_val_str_1(std::string&& value);
+  void set_val_str_1(const char* value);
+  void set_val_str_1(const char* value, size_t size);
+  std::string* mutable_val_str_1();
+  std::string* release_val_str_1();
+  void set_allocated_val_str_1(std::string* val_str_1);
+  private:
+  const std::string& _internal_val_str_1() const;
+  void _internal_set_val_str_1(const std::string& value);
+  std::string* _internal_mutable_val_str_1();
+  public:
+
+  // optional int32 val_int321 = 3;
+  bool has_val_int321() const;
+  private:
+  bool _internal_has_val_int321() const;
+  public:
+  void clear_val_int321();
+  ::PROTOBUF_NAMESPACE_ID::int32 val_int321() const;
+  void set_val_int321(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_val_int321() const;
+  void _internal_set_val_int321(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // optional int32 val_int32_1 = 4;
+  bool has_val_int32_1() const;
+  private:
+  bool _internal_has_val_int32_1() const;
+  public:
+  void clear_val_int32_1();
+  ::PROTOBUF_NAMESPACE_ID::int32 val_int32_1() const;
+  void set_val_int32_1(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_val_int32_1() const;
+  void _internal_set_val_int32_1(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // optional uint32 val_uint321 = 5;
+  bool has_val_uint321() const;
+  private:
+  bool _internal_has_val_uint321() const;
+  public:
+  void clear_val_uint321();
+  ::PROTOBUF_NAMESPACE_ID::uint32 val_uint321() const;
+  void set_val_uint321(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_val_uint321() const;
+  void _internal_set_val_uint321(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // optional uint32 val_uint32_1 = 6;
+  bool has_val_uint32_1() const;
+  private:
+  bool _internal_has_val_uint32_1() const;
+  public:
+  void clear_val_uint32_1();
+  ::PROTOBUF_NAMESPACE_ID::uint32 val_uint32_1() const;
+  void set_val_uint32_1(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_val_uint32_1() const;
+  void _internal_set_val_uint32_1(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // optional int64 val_int641 = 7;
+  bool has_val_int641() const;
+  private:
+  bool _internal_has_val_int641() const;
+  public:
+  void clear_val_int641();
+  ::PROTOBUF_NAMESPACE_ID::int64 val_int641() const;
+  void set_val_int641(::PROTOBUF_NAMESPACE_ID::int64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_val_int641() const;
+  void _internal_set_val_int641(::PROTOBUF_NAMESPACE_ID::int64 value);
+  public:
+
+  // optional int64 val_int64_1 = 8;
+  bool has_val_int64_1() const;
+  private:
+  bool _internal_has_val_int64_1() const;
+  public:
+  void clear_val_int64_1();
+  ::PROTOBUF_NAMESPACE_ID::int64 val_int64_1() const;
+  void set_val_int64_1(::PROTOBUF_NAMESPACE_ID::int64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_val_int64_1() const;
+  void _internal_set_val_int64_1(::PROTOBUF_NAMESPACE_ID::int64 value);
+  public:
+
+  // optional uint64 val_uint641 = 9;
+  bool has_val_uint641() const;
+  private:
+  bool _internal_has_val_uint641() const;
+  public:
+  void clear_val_uint641();
+  ::PROTOBUF_NAMESPACE_ID::uint64 val_uint641() const;
+  void set_val_uint641(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_val_uint641() const;
+  void _internal_set_val_uint641(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // optional uint64 val_uint64_1 = 10;
+  bool has_val_uint64_1() const;
+  private:
+  bool _internal_has_val_uint64_1() const;
+  public:
+  void clear_val_uint64_1();
+  ::PROTOBUF_NAMESPACE_ID::uint64 val_uint64_1() const;
+  void set_val_uint64_1(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_val_uint64_1() const;
+  void _internal_set_val_uint64_1(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // optional bool val_bool1 = 11;
+  bool has_val_bool1() const;
+  private:
+  bool _internal_has_val_bool1() const;
+  public:
+  void clear_val_bool1();
+  bool val_bool1() const;
+  void set_val_bool1(bool value);
+  private:
+  bool _internal_val_bool1() const;
+  void _internal_set_val_bool1(bool value);
+  public:
+
+  // optional bool val_bool_1 = 12;
+  bool has_val_bool_1() const;
+  private:
+  bool _internal_has_val_bool_1() const;
+  public:
+  void clear_val_bool_1();
+  bool val_bool_1() const;
+  void set_val_bool_1(bool value);
+  private:
+  bool _internal_val_bool_1() const;
+  void _internal_set_val_bool_1(bool value);
+  public:
+
+  // optional float val_float1 = 15;
+  bool has_val_float1() const;
+  private:
+  bool _internal_has_val_float1() const;
+  public:
+  void clear_val_float1();
+  float val_float1() const;
+  void set_val_float1(float value);
+  private:
+  float _internal_val_float1() const;
+  void _internal_set_val_float1(float value);
+  public:
+
+  // optional double val_double1 = 13;
+  bool has_val_double1() const;
+  private:
+  bool _internal_has_val_double1() const;
+  public:
+  void clear_val_double1();
+  double val_double1() const;
+  void set_val_double1(double value);
+  private:
+  double _internal_val_double1() const;
+  void _internal_set_val_double1(double value);
+  public:
+
+  // optional double val_double_1 = 14;
+  bool has_val_double_1() const;
+  private:
+  bool _internal_has_val_double_1() const;
+  public:
+  void clear_val_double_1();
+  double val_double_1() const;
+  void set_val_double_1(double value);
+  private:
+  double _internal_val_double_1() const;
+  void _internal_set_val_double_1(double value);
+  public:
+
+  // optional float val_float_1 = 16;
+  bool has_val_float_1() const;
+  private:
+  bool _internal_has_val_float_1() const;
+  public:
+  void clear_val_float_1();
+  float val_float_1() const;
+  void set_val_float_1(float value);
+  private:
+  float _internal_val_float_1() const;
+  void _internal_set_val_float_1(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr val_str1_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr val_str_1_;
+  ::PROTOBUF_NAMESPACE_ID::int32 val_int321_;
+  ::PROTOBUF_NAMESPACE_ID::int32 val_int32_1_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 val_uint321_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 val_uint32_1_;
+  ::PROTOBUF_NAMESPACE_ID::int64 val_int641_;
+  ::PROTOBUF_NAMESPACE_ID::int64 val_int64_1_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 val_uint641_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 val_uint64_1_;
+  bool val_bool1_;
+  bool val_bool_1_;
+  float val_float1_;
+  double val_double1_;
+  double val_double_1_;
+  float val_float_1_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestRepeatedFieldsWithSameJsonName PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName) */ {
+ public:
+  inline TestRepeatedFieldsWithSameJsonName() : TestRepeatedFieldsWithSameJsonName(nullptr) {};
+  virtual ~TestRepeatedFieldsWithSameJsonName();
+
+  TestRepeatedFieldsWithSameJsonName(const TestRepeatedFieldsWithSameJsonName& from);
+  TestRepeatedFieldsWithSameJsonName(TestRepeatedFieldsWithSameJsonName&& from) noexcept
+    : TestRepeatedFieldsWithSameJsonName() {
+    *this = ::std::move(from);
+  }
+
+  inline TestRepeatedFieldsWithSameJsonName& operator=(const TestRepeatedFieldsWithSameJsonName& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestRepeatedFieldsWithSameJsonName& operator=(TestRepeatedFieldsWithSameJsonName&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestRepeatedFieldsWithSameJsonName& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestRepeatedFieldsWithSameJsonName* internal_default_instance() {
+    return reinterpret_cast<const TestRepeatedFieldsWithSameJsonName*>(
+               &_TestRepeatedFieldsWithSameJsonName_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(TestRepeatedFieldsWithSameJsonName& a, TestRepeatedFieldsWithSameJsonName& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestRepeatedFieldsWithSameJsonName* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestRepeatedFieldsWithSameJsonName* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestRepeatedFieldsWithSameJsonName* New() const final {
+    return CreateMaybeMessage<TestRepeatedFieldsWithSameJsonName>(nullptr);
+  }
+
+  TestRepeatedFieldsWithSameJsonName* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestRepeatedFieldsWithSameJsonName>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestRepeatedFieldsWithSameJsonName& from);
+  void MergeFrom(const TestRepeatedFieldsWithSameJsonName& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestRepeatedFieldsWithSameJsonName* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName";
+  }
+  protected:
+  explicit TestRepeatedFieldsWithSameJsonName(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepStr1FieldNumber = 1,
+    kRepStr1FieldNumber_2 = 2,
+  };
+  // repeated string rep_str1 = 1;
+  int rep_str1_size() const;
+  private:
+  int _internal_rep_str1_size() const;
+  public:
+  void clear_rep_str1();
+  const std::string& rep_str1(int index) const;
+  std::string* mutable_rep_str1(int index);
+  void set_rep_str1(int index, const std::string& value);
+  void set_rep_str1(int index, std::string&& value);
+  void set_rep_str1(int index, const char* value);
+  void set_rep_str1(int index, const char* value, size_t size);
+  std::string* add_rep_str1();
+  void add_rep_str1(const std::string& value);
+  void add_rep_str1(std::string&& value);
+  void add_rep_str1(const char* value);
+  void add_rep_str1(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& rep_str1() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_rep_str1();
+  private:
+  const std::string& _internal_rep_str1(int index) const;
+  std::string* _internal_add_rep_str1();
+  public:
+
+  // repeated string rep_str_1 = 2;
+  int rep_str_1_size() const;
+  private:
+  int _internal_rep_str_1_size() const;
+  public:
+  void clear_rep_str_1();
+  const std::string& rep_str_1(int index) const;
+  std::string* mutable_rep_str_1(int index);
+  void set_rep_str_1(int index, const std::string& value);
+  void set_rep_str_1(int index, std::string&& value);
+  void set_rep_str_1(int index, const char* value);
+  void set_rep_str_1(int index, const char* value, size_t size);
+  std::string* add_rep_str_1();
+  void add_rep_str_1(const std::string& value);
+  void add_rep_str_1(std::string&& value);
+  void add_rep_str_1(const char* value);
+  void add_rep_str_1(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& rep_str_1() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_rep_str_1();
+  private:
+  const std::string& _internal_rep_str_1(int index) const;
+  std::string* _internal_add_rep_str_1();
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> rep_str1_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> rep_str_1_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TestMessageFieldsWithSameJsonName PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.TestMessageFieldsWithSameJsonName) */ {
+ public:
+  inline TestMessageFieldsWithSameJsonName() : TestMessageFieldsWithSameJsonName(nullptr) {};
+  virtual ~TestMessageFieldsWithSameJsonName();
+
+  TestMessageFieldsWithSameJsonName(const TestMessageFieldsWithSameJsonName& from);
+  TestMessageFieldsWithSameJsonName(TestMessageFieldsWithSameJsonName&& from) noexcept
+    : TestMessageFieldsWithSameJsonName() {
+    *this = ::std::move(from);
+  }
+
+  inline TestMessageFieldsWithSameJsonName& operator=(const TestMessageFieldsWithSameJsonName& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TestMessageFieldsWithSameJsonName& operator=(TestMessageFieldsWithSameJsonName&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TestMessageFieldsWithSameJsonName& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TestMessageFieldsWithSameJsonName* internal_default_instance() {
+    return reinterpret_cast<const TestMessageFieldsWithSameJsonName*>(
+               &_TestMessageFieldsWithSameJsonName_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(TestMessageFieldsWithSameJsonName& a, TestMessageFieldsWithSameJsonName& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestMessageFieldsWithSameJsonName* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestMessageFieldsWithSameJsonName* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TestMessageFieldsWithSameJsonName* New() const final {
+    return CreateMaybeMessage<TestMessageFieldsWithSameJsonName>(nullptr);
+  }
+
+  TestMessageFieldsWithSameJsonName* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TestMessageFieldsWithSameJsonName>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TestMessageFieldsWithSameJsonName& from);
+  void MergeFrom(const TestMessageFieldsWithSameJsonName& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestMessageFieldsWithSameJsonName* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.TestMessageFieldsWithSameJsonName";
+  }
+  protected:
+  explicit TestMessageFieldsWithSameJsonName(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPrim1FieldNumber = 1,
+    kPrim1FieldNumber_2 = 2,
+  };
+  // optional .proto_util_converter.testing.Primitive prim1 = 1;
+  bool has_prim1() const;
+  private:
+  bool _internal_has_prim1() const;
+  public:
+  void clear_prim1();
+  const ::proto_util_converter::testing::Primitive& prim1() const;
+  ::proto_util_converter::testing::Primitive* release_prim1();
+  ::proto_util_converter::testing::Primitive* mutable_prim1();
+  void set_allocated_prim1(::proto_util_converter::testing::Primitive* prim1);
+  private:
+  const ::proto_util_converter::testing::Primitive& _internal_prim1() const;
+  ::proto_util_converter::testing::Primitive* _internal_mutable_prim1();
+  public:
+  void unsafe_arena_set_allocated_prim1(
+      ::proto_util_converter::testing::Primitive* prim1);
+  ::proto_util_converter::testing::Primitive* unsafe_arena_release_prim1();
+
+  // optional .proto_util_converter.testing.Primitive prim_1 = 2;
+  bool has_prim_1() const;
+  private:
+  bool _internal_has_prim_1() const;
+  public:
+  void clear_prim_1();
+  const ::proto_util_converter::testing::Primitive& prim_1() const;
+  ::proto_util_converter::testing::Primitive* release_prim_1();
+  ::proto_util_converter::testing::Primitive* mutable_prim_1();
+  void set_allocated_prim_1(::proto_util_converter::testing::Primitive* prim_1);
+  private:
+  const ::proto_util_converter::testing::Primitive& _internal_prim_1() const;
+  ::proto_util_converter::testing::Primitive* _internal_mutable_prim_1();
+  public:
+  void unsafe_arena_set_allocated_prim_1(
+      ::proto_util_converter::testing::Primitive* prim_1);
+  ::proto_util_converter::testing::Primitive* unsafe_arena_release_prim_1();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.TestMessageFieldsWithSameJsonName)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::proto_util_converter::testing::Primitive* prim1_;
+  ::proto_util_converter::testing::Primitive* prim_1_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto;
+};
+// ===================================================================
+
+static const int kMoreAuthorFieldNumber = 201;
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::proto_util_converter::testing::Book,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedMessageTypeTraits< ::proto_util_converter::testing::Author >, 11, false >
+  more_author;
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Book_Data
+
+// optional uint32 year = 7;
+inline bool Book_Data::_internal_has_year() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Book_Data::has_year() const {
+  return _internal_has_year();
+}
+inline void Book_Data::clear_year() {
+  year_ = 0u;
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Book_Data::_internal_year() const {
+  return year_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Book_Data::year() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.Data.year)
+  return _internal_year();
+}
+inline void Book_Data::_internal_set_year(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _has_bits_[0] |= 0x00000002u;
+  year_ = value;
+}
+inline void Book_Data::set_year(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_year(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.Data.year)
+}
+
+// optional string copyright = 8;
+inline bool Book_Data::_internal_has_copyright() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Book_Data::has_copyright() const {
+  return _internal_has_copyright();
+}
+inline void Book_Data::clear_copyright() {
+  copyright_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Book_Data::copyright() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.Data.copyright)
+  return _internal_copyright();
+}
+inline void Book_Data::set_copyright(const std::string& value) {
+  _internal_set_copyright(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.Data.copyright)
+}
+inline std::string* Book_Data::mutable_copyright() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.Data.copyright)
+  return _internal_mutable_copyright();
+}
+inline const std::string& Book_Data::_internal_copyright() const {
+  return copyright_.Get();
+}
+inline void Book_Data::_internal_set_copyright(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  copyright_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Book_Data::set_copyright(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  copyright_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Book.Data.copyright)
+}
+inline void Book_Data::set_copyright(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  copyright_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Book.Data.copyright)
+}
+inline void Book_Data::set_copyright(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  copyright_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Book.Data.copyright)
+}
+inline std::string* Book_Data::_internal_mutable_copyright() {
+  _has_bits_[0] |= 0x00000001u;
+  return copyright_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Book_Data::release_copyright() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.Data.copyright)
+  if (!_internal_has_copyright()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return copyright_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Book_Data::set_allocated_copyright(std::string* copyright) {
+  if (copyright != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  copyright_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), copyright,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.Data.copyright)
+}
+
+// -------------------------------------------------------------------
+
+// Book_Label
+
+// optional string key = 1;
+inline bool Book_Label::_internal_has_key() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Book_Label::has_key() const {
+  return _internal_has_key();
+}
+inline void Book_Label::clear_key() {
+  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Book_Label::key() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.Label.key)
+  return _internal_key();
+}
+inline void Book_Label::set_key(const std::string& value) {
+  _internal_set_key(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.Label.key)
+}
+inline std::string* Book_Label::mutable_key() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.Label.key)
+  return _internal_mutable_key();
+}
+inline const std::string& Book_Label::_internal_key() const {
+  return key_.Get();
+}
+inline void Book_Label::_internal_set_key(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Book_Label::set_key(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  key_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Book.Label.key)
+}
+inline void Book_Label::set_key(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Book.Label.key)
+}
+inline void Book_Label::set_key(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Book.Label.key)
+}
+inline std::string* Book_Label::_internal_mutable_key() {
+  _has_bits_[0] |= 0x00000001u;
+  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Book_Label::release_key() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.Label.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return key_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Book_Label::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.Label.key)
+}
+
+// optional string value = 2;
+inline bool Book_Label::_internal_has_value() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Book_Label::has_value() const {
+  return _internal_has_value();
+}
+inline void Book_Label::clear_value() {
+  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Book_Label::value() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.Label.value)
+  return _internal_value();
+}
+inline void Book_Label::set_value(const std::string& value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.Label.value)
+}
+inline std::string* Book_Label::mutable_value() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.Label.value)
+  return _internal_mutable_value();
+}
+inline const std::string& Book_Label::_internal_value() const {
+  return value_.Get();
+}
+inline void Book_Label::_internal_set_value(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Book_Label::set_value(std::string&& value) {
+  _has_bits_[0] |= 0x00000002u;
+  value_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Book.Label.value)
+}
+inline void Book_Label::set_value(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000002u;
+  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Book.Label.value)
+}
+inline void Book_Label::set_value(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000002u;
+  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Book.Label.value)
+}
+inline std::string* Book_Label::_internal_mutable_value() {
+  _has_bits_[0] |= 0x00000002u;
+  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Book_Label::release_value() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.Label.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  return value_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Book_Label::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.Label.value)
+}
+
+// -------------------------------------------------------------------
+
+// Book
+
+// optional string title = 1;
+inline bool Book::_internal_has_title() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Book::has_title() const {
+  return _internal_has_title();
+}
+inline void Book::clear_title() {
+  title_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Book::title() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.title)
+  return _internal_title();
+}
+inline void Book::set_title(const std::string& value) {
+  _internal_set_title(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.title)
+}
+inline std::string* Book::mutable_title() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.title)
+  return _internal_mutable_title();
+}
+inline const std::string& Book::_internal_title() const {
+  return title_.Get();
+}
+inline void Book::_internal_set_title(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  title_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Book::set_title(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  title_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Book.title)
+}
+inline void Book::set_title(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  title_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Book.title)
+}
+inline void Book::set_title(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  title_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Book.title)
+}
+inline std::string* Book::_internal_mutable_title() {
+  _has_bits_[0] |= 0x00000001u;
+  return title_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Book::release_title() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.title)
+  if (!_internal_has_title()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return title_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Book::set_allocated_title(std::string* title) {
+  if (title != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  title_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), title,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.title)
+}
+
+// optional .proto_util_converter.testing.Author author = 2;
+inline bool Book::_internal_has_author() const {
+  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || author_ != nullptr);
+  return value;
+}
+inline bool Book::has_author() const {
+  return _internal_has_author();
+}
+inline void Book::clear_author() {
+  if (author_ != nullptr) author_->Clear();
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline const ::proto_util_converter::testing::Author& Book::_internal_author() const {
+  const ::proto_util_converter::testing::Author* p = author_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Author*>(
+      &::proto_util_converter::testing::_Author_default_instance_);
+}
+inline const ::proto_util_converter::testing::Author& Book::author() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.author)
+  return _internal_author();
+}
+inline void Book::unsafe_arena_set_allocated_author(
+    ::proto_util_converter::testing::Author* author) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(author_);
+  }
+  author_ = author;
+  if (author) {
+    _has_bits_[0] |= 0x00000008u;
+  } else {
+    _has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Book.author)
+}
+inline ::proto_util_converter::testing::Author* Book::release_author() {
+  _has_bits_[0] &= ~0x00000008u;
+  ::proto_util_converter::testing::Author* temp = author_;
+  author_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::Author* Book::unsafe_arena_release_author() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.author)
+  _has_bits_[0] &= ~0x00000008u;
+  ::proto_util_converter::testing::Author* temp = author_;
+  author_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Author* Book::_internal_mutable_author() {
+  _has_bits_[0] |= 0x00000008u;
+  if (author_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Author>(GetArena());
+    author_ = p;
+  }
+  return author_;
+}
+inline ::proto_util_converter::testing::Author* Book::mutable_author() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.author)
+  return _internal_mutable_author();
+}
+inline void Book::set_allocated_author(::proto_util_converter::testing::Author* author) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete author_;
+  }
+  if (author) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(author);
+    if (message_arena != submessage_arena) {
+      author = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, author, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000008u;
+  } else {
+    _has_bits_[0] &= ~0x00000008u;
+  }
+  author_ = author;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.author)
+}
+
+// optional uint32 length = 3;
+inline bool Book::_internal_has_length() const {
+  bool value = (_has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Book::has_length() const {
+  return _internal_has_length();
+}
+inline void Book::clear_length() {
+  length_ = 0u;
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Book::_internal_length() const {
+  return length_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Book::length() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.length)
+  return _internal_length();
+}
+inline void Book::_internal_set_length(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _has_bits_[0] |= 0x00000100u;
+  length_ = value;
+}
+inline void Book::set_length(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_length(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.length)
+}
+
+// optional int64 published = 4;
+inline bool Book::_internal_has_published() const {
+  bool value = (_has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Book::has_published() const {
+  return _internal_has_published();
+}
+inline void Book::clear_published() {
+  published_ = PROTOBUF_LONGLONG(0);
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Book::_internal_published() const {
+  return published_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Book::published() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.published)
+  return _internal_published();
+}
+inline void Book::_internal_set_published(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _has_bits_[0] |= 0x00000080u;
+  published_ = value;
+}
+inline void Book::set_published(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_set_published(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.published)
+}
+
+// optional bytes content = 5;
+inline bool Book::_internal_has_content() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Book::has_content() const {
+  return _internal_has_content();
+}
+inline void Book::clear_content() {
+  content_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Book::content() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.content)
+  return _internal_content();
+}
+inline void Book::set_content(const std::string& value) {
+  _internal_set_content(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.content)
+}
+inline std::string* Book::mutable_content() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.content)
+  return _internal_mutable_content();
+}
+inline const std::string& Book::_internal_content() const {
+  return content_.Get();
+}
+inline void Book::_internal_set_content(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Book::set_content(std::string&& value) {
+  _has_bits_[0] |= 0x00000002u;
+  content_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Book.content)
+}
+inline void Book::set_content(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000002u;
+  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Book.content)
+}
+inline void Book::set_content(const void* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000002u;
+  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Book.content)
+}
+inline std::string* Book::_internal_mutable_content() {
+  _has_bits_[0] |= 0x00000002u;
+  return content_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Book::release_content() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.content)
+  if (!_internal_has_content()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  return content_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Book::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  content_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), content,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.content)
+}
+
+// optional group Data = 6 { ... };
+inline bool Book::_internal_has_data() const {
+  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || data_ != nullptr);
+  return value;
+}
+inline bool Book::has_data() const {
+  return _internal_has_data();
+}
+inline void Book::clear_data() {
+  if (data_ != nullptr) data_->Clear();
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline const ::proto_util_converter::testing::Book_Data& Book::_internal_data() const {
+  const ::proto_util_converter::testing::Book_Data* p = data_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Book_Data*>(
+      &::proto_util_converter::testing::_Book_Data_default_instance_);
+}
+inline const ::proto_util_converter::testing::Book_Data& Book::data() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.data)
+  return _internal_data();
+}
+inline void Book::unsafe_arena_set_allocated_data(
+    ::proto_util_converter::testing::Book_Data* data) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(data_);
+  }
+  data_ = data;
+  if (data) {
+    _has_bits_[0] |= 0x00000010u;
+  } else {
+    _has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Book.data)
+}
+inline ::proto_util_converter::testing::Book_Data* Book::release_data() {
+  _has_bits_[0] &= ~0x00000010u;
+  ::proto_util_converter::testing::Book_Data* temp = data_;
+  data_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::Book_Data* Book::unsafe_arena_release_data() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.data)
+  _has_bits_[0] &= ~0x00000010u;
+  ::proto_util_converter::testing::Book_Data* temp = data_;
+  data_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Book_Data* Book::_internal_mutable_data() {
+  _has_bits_[0] |= 0x00000010u;
+  if (data_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Book_Data>(GetArena());
+    data_ = p;
+  }
+  return data_;
+}
+inline ::proto_util_converter::testing::Book_Data* Book::mutable_data() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.data)
+  return _internal_mutable_data();
+}
+inline void Book::set_allocated_data(::proto_util_converter::testing::Book_Data* data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete data_;
+  }
+  if (data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(data);
+    if (message_arena != submessage_arena) {
+      data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, data, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000010u;
+  } else {
+    _has_bits_[0] &= ~0x00000010u;
+  }
+  data_ = data;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.data)
+}
+
+// optional .proto_util_converter.testing.Publisher publisher = 9;
+inline bool Book::_internal_has_publisher() const {
+  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || publisher_ != nullptr);
+  return value;
+}
+inline bool Book::has_publisher() const {
+  return _internal_has_publisher();
+}
+inline void Book::clear_publisher() {
+  if (publisher_ != nullptr) publisher_->Clear();
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline const ::proto_util_converter::testing::Publisher& Book::_internal_publisher() const {
+  const ::proto_util_converter::testing::Publisher* p = publisher_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Publisher*>(
+      &::proto_util_converter::testing::_Publisher_default_instance_);
+}
+inline const ::proto_util_converter::testing::Publisher& Book::publisher() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.publisher)
+  return _internal_publisher();
+}
+inline void Book::unsafe_arena_set_allocated_publisher(
+    ::proto_util_converter::testing::Publisher* publisher) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(publisher_);
+  }
+  publisher_ = publisher;
+  if (publisher) {
+    _has_bits_[0] |= 0x00000020u;
+  } else {
+    _has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Book.publisher)
+}
+inline ::proto_util_converter::testing::Publisher* Book::release_publisher() {
+  _has_bits_[0] &= ~0x00000020u;
+  ::proto_util_converter::testing::Publisher* temp = publisher_;
+  publisher_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::Publisher* Book::unsafe_arena_release_publisher() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.publisher)
+  _has_bits_[0] &= ~0x00000020u;
+  ::proto_util_converter::testing::Publisher* temp = publisher_;
+  publisher_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Publisher* Book::_internal_mutable_publisher() {
+  _has_bits_[0] |= 0x00000020u;
+  if (publisher_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Publisher>(GetArena());
+    publisher_ = p;
+  }
+  return publisher_;
+}
+inline ::proto_util_converter::testing::Publisher* Book::mutable_publisher() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.publisher)
+  return _internal_mutable_publisher();
+}
+inline void Book::set_allocated_publisher(::proto_util_converter::testing::Publisher* publisher) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete publisher_;
+  }
+  if (publisher) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(publisher);
+    if (message_arena != submessage_arena) {
+      publisher = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, publisher, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000020u;
+  } else {
+    _has_bits_[0] &= ~0x00000020u;
+  }
+  publisher_ = publisher;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.publisher)
+}
+
+// repeated .proto_util_converter.testing.Book.Label labels = 10;
+inline int Book::_internal_labels_size() const {
+  return labels_.size();
+}
+inline int Book::labels_size() const {
+  return _internal_labels_size();
+}
+inline void Book::clear_labels() {
+  labels_.Clear();
+}
+inline ::proto_util_converter::testing::Book_Label* Book::mutable_labels(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.labels)
+  return labels_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Book_Label >*
+Book::mutable_labels() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Book.labels)
+  return &labels_;
+}
+inline const ::proto_util_converter::testing::Book_Label& Book::_internal_labels(int index) const {
+  return labels_.Get(index);
+}
+inline const ::proto_util_converter::testing::Book_Label& Book::labels(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.labels)
+  return _internal_labels(index);
+}
+inline ::proto_util_converter::testing::Book_Label* Book::_internal_add_labels() {
+  return labels_.Add();
+}
+inline ::proto_util_converter::testing::Book_Label* Book::add_labels() {
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Book.labels)
+  return _internal_add_labels();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Book_Label >&
+Book::labels() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Book.labels)
+  return labels_;
+}
+
+// optional .proto_util_converter.testing.Book.Type type = 11;
+inline bool Book::_internal_has_type() const {
+  bool value = (_has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Book::has_type() const {
+  return _internal_has_type();
+}
+inline void Book::clear_type() {
+  type_ = 1;
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline ::proto_util_converter::testing::Book_Type Book::_internal_type() const {
+  return static_cast< ::proto_util_converter::testing::Book_Type >(type_);
+}
+inline ::proto_util_converter::testing::Book_Type Book::type() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.type)
+  return _internal_type();
+}
+inline void Book::_internal_set_type(::proto_util_converter::testing::Book_Type value) {
+  assert(::proto_util_converter::testing::Book_Type_IsValid(value));
+  _has_bits_[0] |= 0x00000200u;
+  type_ = value;
+}
+inline void Book::set_type(::proto_util_converter::testing::Book_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.type)
+}
+
+// optional string snake_field = 12;
+inline bool Book::_internal_has_snake_field() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Book::has_snake_field() const {
+  return _internal_has_snake_field();
+}
+inline void Book::clear_snake_field() {
+  snake_field_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Book::snake_field() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.snake_field)
+  return _internal_snake_field();
+}
+inline void Book::set_snake_field(const std::string& value) {
+  _internal_set_snake_field(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.snake_field)
+}
+inline std::string* Book::mutable_snake_field() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.snake_field)
+  return _internal_mutable_snake_field();
+}
+inline const std::string& Book::_internal_snake_field() const {
+  return snake_field_.Get();
+}
+inline void Book::_internal_set_snake_field(const std::string& value) {
+  _has_bits_[0] |= 0x00000004u;
+  snake_field_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Book::set_snake_field(std::string&& value) {
+  _has_bits_[0] |= 0x00000004u;
+  snake_field_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Book.snake_field)
+}
+inline void Book::set_snake_field(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000004u;
+  snake_field_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Book.snake_field)
+}
+inline void Book::set_snake_field(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000004u;
+  snake_field_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Book.snake_field)
+}
+inline std::string* Book::_internal_mutable_snake_field() {
+  _has_bits_[0] |= 0x00000004u;
+  return snake_field_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Book::release_snake_field() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.snake_field)
+  if (!_internal_has_snake_field()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000004u;
+  return snake_field_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Book::set_allocated_snake_field(std::string* snake_field) {
+  if (snake_field != nullptr) {
+    _has_bits_[0] |= 0x00000004u;
+  } else {
+    _has_bits_[0] &= ~0x00000004u;
+  }
+  snake_field_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), snake_field,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.snake_field)
+}
+
+// optional .proto_util_converter.testing.AnyWrapper type_not_found = 13;
+inline bool Book::_internal_has_type_not_found() const {
+  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || type_not_found_ != nullptr);
+  return value;
+}
+inline bool Book::has_type_not_found() const {
+  return _internal_has_type_not_found();
+}
+inline const ::proto_util_converter::testing::AnyWrapper& Book::_internal_type_not_found() const {
+  const ::proto_util_converter::testing::AnyWrapper* p = type_not_found_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::AnyWrapper*>(
+      &::proto_util_converter::testing::_AnyWrapper_default_instance_);
+}
+inline const ::proto_util_converter::testing::AnyWrapper& Book::type_not_found() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.type_not_found)
+  return _internal_type_not_found();
+}
+inline void Book::unsafe_arena_set_allocated_type_not_found(
+    ::proto_util_converter::testing::AnyWrapper* type_not_found) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(type_not_found_);
+  }
+  type_not_found_ = type_not_found;
+  if (type_not_found) {
+    _has_bits_[0] |= 0x00000040u;
+  } else {
+    _has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Book.type_not_found)
+}
+inline ::proto_util_converter::testing::AnyWrapper* Book::release_type_not_found() {
+  _has_bits_[0] &= ~0x00000040u;
+  ::proto_util_converter::testing::AnyWrapper* temp = type_not_found_;
+  type_not_found_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* Book::unsafe_arena_release_type_not_found() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Book.type_not_found)
+  _has_bits_[0] &= ~0x00000040u;
+  ::proto_util_converter::testing::AnyWrapper* temp = type_not_found_;
+  type_not_found_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::AnyWrapper* Book::_internal_mutable_type_not_found() {
+  _has_bits_[0] |= 0x00000040u;
+  if (type_not_found_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::AnyWrapper>(GetArena());
+    type_not_found_ = p;
+  }
+  return type_not_found_;
+}
+inline ::proto_util_converter::testing::AnyWrapper* Book::mutable_type_not_found() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Book.type_not_found)
+  return _internal_mutable_type_not_found();
+}
+inline void Book::set_allocated_type_not_found(::proto_util_converter::testing::AnyWrapper* type_not_found) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(type_not_found_);
+  }
+  if (type_not_found) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(type_not_found)->GetArena();
+    if (message_arena != submessage_arena) {
+      type_not_found = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, type_not_found, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000040u;
+  } else {
+    _has_bits_[0] &= ~0x00000040u;
+  }
+  type_not_found_ = type_not_found;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Book.type_not_found)
+}
+
+// repeated int32 primitive_repeated = 14;
+inline int Book::_internal_primitive_repeated_size() const {
+  return primitive_repeated_.size();
+}
+inline int Book::primitive_repeated_size() const {
+  return _internal_primitive_repeated_size();
+}
+inline void Book::clear_primitive_repeated() {
+  primitive_repeated_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Book::_internal_primitive_repeated(int index) const {
+  return primitive_repeated_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Book::primitive_repeated(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Book.primitive_repeated)
+  return _internal_primitive_repeated(index);
+}
+inline void Book::set_primitive_repeated(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  primitive_repeated_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Book.primitive_repeated)
+}
+inline void Book::_internal_add_primitive_repeated(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  primitive_repeated_.Add(value);
+}
+inline void Book::add_primitive_repeated(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_primitive_repeated(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Book.primitive_repeated)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+Book::_internal_primitive_repeated() const {
+  return primitive_repeated_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+Book::primitive_repeated() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Book.primitive_repeated)
+  return _internal_primitive_repeated();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+Book::_internal_mutable_primitive_repeated() {
+  return &primitive_repeated_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+Book::mutable_primitive_repeated() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Book.primitive_repeated)
+  return _internal_mutable_primitive_repeated();
+}
+
+// -------------------------------------------------------------------
+
+// Publisher
+
+// required string name = 1;
+inline bool Publisher::_internal_has_name() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Publisher::has_name() const {
+  return _internal_has_name();
+}
+inline void Publisher::clear_name() {
+  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Publisher::name() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Publisher.name)
+  return _internal_name();
+}
+inline void Publisher::set_name(const std::string& value) {
+  _internal_set_name(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Publisher.name)
+}
+inline std::string* Publisher::mutable_name() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Publisher.name)
+  return _internal_mutable_name();
+}
+inline const std::string& Publisher::_internal_name() const {
+  return name_.Get();
+}
+inline void Publisher::_internal_set_name(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Publisher::set_name(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  name_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Publisher.name)
+}
+inline void Publisher::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Publisher.name)
+}
+inline void Publisher::set_name(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Publisher.name)
+}
+inline std::string* Publisher::_internal_mutable_name() {
+  _has_bits_[0] |= 0x00000001u;
+  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Publisher::release_name() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Publisher.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return name_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Publisher::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Publisher.name)
+}
+
+// -------------------------------------------------------------------
+
+// Author
+
+// optional uint64 id = 1[json_name = "@id"];
+inline bool Author::_internal_has_id() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Author::has_id() const {
+  return _internal_has_id();
+}
+inline void Author::clear_id() {
+  id_ = PROTOBUF_ULONGLONG(0);
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Author::_internal_id() const {
+  return id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Author::id() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Author.id)
+  return _internal_id();
+}
+inline void Author::_internal_set_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _has_bits_[0] |= 0x00000002u;
+  id_ = value;
+}
+inline void Author::set_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Author.id)
+}
+
+// optional string name = 2;
+inline bool Author::_internal_has_name() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Author::has_name() const {
+  return _internal_has_name();
+}
+inline void Author::clear_name() {
+  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Author::name() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Author.name)
+  return _internal_name();
+}
+inline void Author::set_name(const std::string& value) {
+  _internal_set_name(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Author.name)
+}
+inline std::string* Author::mutable_name() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Author.name)
+  return _internal_mutable_name();
+}
+inline const std::string& Author::_internal_name() const {
+  return name_.Get();
+}
+inline void Author::_internal_set_name(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Author::set_name(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  name_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Author.name)
+}
+inline void Author::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Author.name)
+}
+inline void Author::set_name(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Author.name)
+}
+inline std::string* Author::_internal_mutable_name() {
+  _has_bits_[0] |= 0x00000001u;
+  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Author::release_name() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Author.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return name_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Author::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Author.name)
+}
+
+// repeated string pseudonym = 3;
+inline int Author::_internal_pseudonym_size() const {
+  return pseudonym_.size();
+}
+inline int Author::pseudonym_size() const {
+  return _internal_pseudonym_size();
+}
+inline void Author::clear_pseudonym() {
+  pseudonym_.Clear();
+}
+inline std::string* Author::add_pseudonym() {
+  // @@protoc_insertion_point(field_add_mutable:proto_util_converter.testing.Author.pseudonym)
+  return _internal_add_pseudonym();
+}
+inline const std::string& Author::_internal_pseudonym(int index) const {
+  return pseudonym_.Get(index);
+}
+inline const std::string& Author::pseudonym(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Author.pseudonym)
+  return _internal_pseudonym(index);
+}
+inline std::string* Author::mutable_pseudonym(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Author.pseudonym)
+  return pseudonym_.Mutable(index);
+}
+inline void Author::set_pseudonym(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Author.pseudonym)
+  pseudonym_.Mutable(index)->assign(value);
+}
+inline void Author::set_pseudonym(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Author.pseudonym)
+  pseudonym_.Mutable(index)->assign(std::move(value));
+}
+inline void Author::set_pseudonym(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  pseudonym_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Author.pseudonym)
+}
+inline void Author::set_pseudonym(int index, const char* value, size_t size) {
+  pseudonym_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Author.pseudonym)
+}
+inline std::string* Author::_internal_add_pseudonym() {
+  return pseudonym_.Add();
+}
+inline void Author::add_pseudonym(const std::string& value) {
+  pseudonym_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Author.pseudonym)
+}
+inline void Author::add_pseudonym(std::string&& value) {
+  pseudonym_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Author.pseudonym)
+}
+inline void Author::add_pseudonym(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  pseudonym_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto_util_converter.testing.Author.pseudonym)
+}
+inline void Author::add_pseudonym(const char* value, size_t size) {
+  pseudonym_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto_util_converter.testing.Author.pseudonym)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Author::pseudonym() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Author.pseudonym)
+  return pseudonym_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Author::mutable_pseudonym() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Author.pseudonym)
+  return &pseudonym_;
+}
+
+// optional bool alive = 4;
+inline bool Author::_internal_has_alive() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Author::has_alive() const {
+  return _internal_has_alive();
+}
+inline void Author::clear_alive() {
+  alive_ = false;
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline bool Author::_internal_alive() const {
+  return alive_;
+}
+inline bool Author::alive() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Author.alive)
+  return _internal_alive();
+}
+inline void Author::_internal_set_alive(bool value) {
+  _has_bits_[0] |= 0x00000004u;
+  alive_ = value;
+}
+inline void Author::set_alive(bool value) {
+  _internal_set_alive(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Author.alive)
+}
+
+// repeated .proto_util_converter.testing.Author friend = 5;
+inline int Author::_internal_friend__size() const {
+  return friend__.size();
+}
+inline int Author::friend__size() const {
+  return _internal_friend__size();
+}
+inline void Author::clear_friend_() {
+  friend__.Clear();
+}
+inline ::proto_util_converter::testing::Author* Author::mutable_friend_(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Author.friend)
+  return friend__.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >*
+Author::mutable_friend_() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Author.friend)
+  return &friend__;
+}
+inline const ::proto_util_converter::testing::Author& Author::_internal_friend_(int index) const {
+  return friend__.Get(index);
+}
+inline const ::proto_util_converter::testing::Author& Author::friend_(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Author.friend)
+  return _internal_friend_(index);
+}
+inline ::proto_util_converter::testing::Author* Author::_internal_add_friend_() {
+  return friend__.Add();
+}
+inline ::proto_util_converter::testing::Author* Author::add_friend_() {
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Author.friend)
+  return _internal_add_friend_();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >&
+Author::friend_() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Author.friend)
+  return friend__;
+}
+
+// -------------------------------------------------------------------
+
+// BadAuthor
+
+// optional string id = 1;
+inline bool BadAuthor::_internal_has_id() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool BadAuthor::has_id() const {
+  return _internal_has_id();
+}
+inline void BadAuthor::clear_id() {
+  id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BadAuthor::id() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.BadAuthor.id)
+  return _internal_id();
+}
+inline void BadAuthor::set_id(const std::string& value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.BadAuthor.id)
+}
+inline std::string* BadAuthor::mutable_id() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.BadAuthor.id)
+  return _internal_mutable_id();
+}
+inline const std::string& BadAuthor::_internal_id() const {
+  return id_.Get();
+}
+inline void BadAuthor::_internal_set_id(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void BadAuthor::set_id(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  id_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.BadAuthor.id)
+}
+inline void BadAuthor::set_id(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.BadAuthor.id)
+}
+inline void BadAuthor::set_id(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.BadAuthor.id)
+}
+inline std::string* BadAuthor::_internal_mutable_id() {
+  _has_bits_[0] |= 0x00000001u;
+  return id_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* BadAuthor::release_id() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.BadAuthor.id)
+  if (!_internal_has_id()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return id_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void BadAuthor::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  id_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), id,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.BadAuthor.id)
+}
+
+// repeated uint64 name = 2;
+inline int BadAuthor::_internal_name_size() const {
+  return name_.size();
+}
+inline int BadAuthor::name_size() const {
+  return _internal_name_size();
+}
+inline void BadAuthor::clear_name() {
+  name_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 BadAuthor::_internal_name(int index) const {
+  return name_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 BadAuthor::name(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.BadAuthor.name)
+  return _internal_name(index);
+}
+inline void BadAuthor::set_name(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  name_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.BadAuthor.name)
+}
+inline void BadAuthor::_internal_add_name(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  name_.Add(value);
+}
+inline void BadAuthor::add_name(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_add_name(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.BadAuthor.name)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+BadAuthor::_internal_name() const {
+  return name_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+BadAuthor::name() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.BadAuthor.name)
+  return _internal_name();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+BadAuthor::_internal_mutable_name() {
+  return &name_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+BadAuthor::mutable_name() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.BadAuthor.name)
+  return _internal_mutable_name();
+}
+
+// optional string pseudonym = 3;
+inline bool BadAuthor::_internal_has_pseudonym() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool BadAuthor::has_pseudonym() const {
+  return _internal_has_pseudonym();
+}
+inline void BadAuthor::clear_pseudonym() {
+  pseudonym_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& BadAuthor::pseudonym() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.BadAuthor.pseudonym)
+  return _internal_pseudonym();
+}
+inline void BadAuthor::set_pseudonym(const std::string& value) {
+  _internal_set_pseudonym(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.BadAuthor.pseudonym)
+}
+inline std::string* BadAuthor::mutable_pseudonym() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.BadAuthor.pseudonym)
+  return _internal_mutable_pseudonym();
+}
+inline const std::string& BadAuthor::_internal_pseudonym() const {
+  return pseudonym_.Get();
+}
+inline void BadAuthor::_internal_set_pseudonym(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  pseudonym_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void BadAuthor::set_pseudonym(std::string&& value) {
+  _has_bits_[0] |= 0x00000002u;
+  pseudonym_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.BadAuthor.pseudonym)
+}
+inline void BadAuthor::set_pseudonym(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000002u;
+  pseudonym_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.BadAuthor.pseudonym)
+}
+inline void BadAuthor::set_pseudonym(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000002u;
+  pseudonym_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.BadAuthor.pseudonym)
+}
+inline std::string* BadAuthor::_internal_mutable_pseudonym() {
+  _has_bits_[0] |= 0x00000002u;
+  return pseudonym_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* BadAuthor::release_pseudonym() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.BadAuthor.pseudonym)
+  if (!_internal_has_pseudonym()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  return pseudonym_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void BadAuthor::set_allocated_pseudonym(std::string* pseudonym) {
+  if (pseudonym != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  pseudonym_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), pseudonym,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.BadAuthor.pseudonym)
+}
+
+// repeated bool alive = 4 [packed = true];
+inline int BadAuthor::_internal_alive_size() const {
+  return alive_.size();
+}
+inline int BadAuthor::alive_size() const {
+  return _internal_alive_size();
+}
+inline void BadAuthor::clear_alive() {
+  alive_.Clear();
+}
+inline bool BadAuthor::_internal_alive(int index) const {
+  return alive_.Get(index);
+}
+inline bool BadAuthor::alive(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.BadAuthor.alive)
+  return _internal_alive(index);
+}
+inline void BadAuthor::set_alive(int index, bool value) {
+  alive_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.BadAuthor.alive)
+}
+inline void BadAuthor::_internal_add_alive(bool value) {
+  alive_.Add(value);
+}
+inline void BadAuthor::add_alive(bool value) {
+  _internal_add_alive(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.BadAuthor.alive)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+BadAuthor::_internal_alive() const {
+  return alive_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+BadAuthor::alive() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.BadAuthor.alive)
+  return _internal_alive();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+BadAuthor::_internal_mutable_alive() {
+  return &alive_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+BadAuthor::mutable_alive() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.BadAuthor.alive)
+  return _internal_mutable_alive();
+}
+
+// -------------------------------------------------------------------
+
+// Primitive
+
+// optional fixed32 fix32 = 1;
+inline bool Primitive::_internal_has_fix32() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Primitive::has_fix32() const {
+  return _internal_has_fix32();
+}
+inline void Primitive::clear_fix32() {
+  fix32_ = 0u;
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Primitive::_internal_fix32() const {
+  return fix32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Primitive::fix32() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.fix32)
+  return _internal_fix32();
+}
+inline void Primitive::_internal_set_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _has_bits_[0] |= 0x00000004u;
+  fix32_ = value;
+}
+inline void Primitive::set_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_fix32(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.fix32)
+}
+
+// optional uint32 u32 = 2;
+inline bool Primitive::_internal_has_u32() const {
+  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Primitive::has_u32() const {
+  return _internal_has_u32();
+}
+inline void Primitive::clear_u32() {
+  u32_ = 0u;
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Primitive::_internal_u32() const {
+  return u32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Primitive::u32() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.u32)
+  return _internal_u32();
+}
+inline void Primitive::_internal_set_u32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _has_bits_[0] |= 0x00000008u;
+  u32_ = value;
+}
+inline void Primitive::set_u32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_u32(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.u32)
+}
+
+// optional int32 i32 = 3;
+inline bool Primitive::_internal_has_i32() const {
+  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Primitive::has_i32() const {
+  return _internal_has_i32();
+}
+inline void Primitive::clear_i32() {
+  i32_ = 0;
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::_internal_i32() const {
+  return i32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::i32() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.i32)
+  return _internal_i32();
+}
+inline void Primitive::_internal_set_i32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000010u;
+  i32_ = value;
+}
+inline void Primitive::set_i32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_i32(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.i32)
+}
+
+// optional sfixed32 sf32 = 4;
+inline bool Primitive::_internal_has_sf32() const {
+  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Primitive::has_sf32() const {
+  return _internal_has_sf32();
+}
+inline void Primitive::clear_sf32() {
+  sf32_ = 0;
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::_internal_sf32() const {
+  return sf32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::sf32() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.sf32)
+  return _internal_sf32();
+}
+inline void Primitive::_internal_set_sf32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000020u;
+  sf32_ = value;
+}
+inline void Primitive::set_sf32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_sf32(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.sf32)
+}
+
+// optional sint32 s32 = 5;
+inline bool Primitive::_internal_has_s32() const {
+  bool value = (_has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Primitive::has_s32() const {
+  return _internal_has_s32();
+}
+inline void Primitive::clear_s32() {
+  s32_ = 0;
+  _has_bits_[0] &= ~0x00000400u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::_internal_s32() const {
+  return s32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::s32() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.s32)
+  return _internal_s32();
+}
+inline void Primitive::_internal_set_s32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000400u;
+  s32_ = value;
+}
+inline void Primitive::set_s32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_s32(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.s32)
+}
+
+// optional fixed64 fix64 = 6;
+inline bool Primitive::_internal_has_fix64() const {
+  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Primitive::has_fix64() const {
+  return _internal_has_fix64();
+}
+inline void Primitive::clear_fix64() {
+  fix64_ = PROTOBUF_ULONGLONG(0);
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Primitive::_internal_fix64() const {
+  return fix64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Primitive::fix64() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.fix64)
+  return _internal_fix64();
+}
+inline void Primitive::_internal_set_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _has_bits_[0] |= 0x00000040u;
+  fix64_ = value;
+}
+inline void Primitive::set_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fix64(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.fix64)
+}
+
+// optional uint64 u64 = 7;
+inline bool Primitive::_internal_has_u64() const {
+  bool value = (_has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Primitive::has_u64() const {
+  return _internal_has_u64();
+}
+inline void Primitive::clear_u64() {
+  u64_ = PROTOBUF_ULONGLONG(0);
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Primitive::_internal_u64() const {
+  return u64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Primitive::u64() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.u64)
+  return _internal_u64();
+}
+inline void Primitive::_internal_set_u64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _has_bits_[0] |= 0x00000080u;
+  u64_ = value;
+}
+inline void Primitive::set_u64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_u64(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.u64)
+}
+
+// optional int64 i64 = 8;
+inline bool Primitive::_internal_has_i64() const {
+  bool value = (_has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Primitive::has_i64() const {
+  return _internal_has_i64();
+}
+inline void Primitive::clear_i64() {
+  i64_ = PROTOBUF_LONGLONG(0);
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::_internal_i64() const {
+  return i64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::i64() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.i64)
+  return _internal_i64();
+}
+inline void Primitive::_internal_set_i64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _has_bits_[0] |= 0x00000100u;
+  i64_ = value;
+}
+inline void Primitive::set_i64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_set_i64(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.i64)
+}
+
+// optional sfixed64 sf64 = 9;
+inline bool Primitive::_internal_has_sf64() const {
+  bool value = (_has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Primitive::has_sf64() const {
+  return _internal_has_sf64();
+}
+inline void Primitive::clear_sf64() {
+  sf64_ = PROTOBUF_LONGLONG(0);
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::_internal_sf64() const {
+  return sf64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::sf64() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.sf64)
+  return _internal_sf64();
+}
+inline void Primitive::_internal_set_sf64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _has_bits_[0] |= 0x00000200u;
+  sf64_ = value;
+}
+inline void Primitive::set_sf64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_set_sf64(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.sf64)
+}
+
+// optional sint64 s64 = 10;
+inline bool Primitive::_internal_has_s64() const {
+  bool value = (_has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool Primitive::has_s64() const {
+  return _internal_has_s64();
+}
+inline void Primitive::clear_s64() {
+  s64_ = PROTOBUF_LONGLONG(0);
+  _has_bits_[0] &= ~0x00001000u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::_internal_s64() const {
+  return s64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::s64() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.s64)
+  return _internal_s64();
+}
+inline void Primitive::_internal_set_s64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _has_bits_[0] |= 0x00001000u;
+  s64_ = value;
+}
+inline void Primitive::set_s64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_set_s64(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.s64)
+}
+
+// optional string str = 11;
+inline bool Primitive::_internal_has_str() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Primitive::has_str() const {
+  return _internal_has_str();
+}
+inline void Primitive::clear_str() {
+  str_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Primitive::str() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.str)
+  return _internal_str();
+}
+inline void Primitive::set_str(const std::string& value) {
+  _internal_set_str(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.str)
+}
+inline std::string* Primitive::mutable_str() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Primitive.str)
+  return _internal_mutable_str();
+}
+inline const std::string& Primitive::_internal_str() const {
+  return str_.Get();
+}
+inline void Primitive::_internal_set_str(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  str_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Primitive::set_str(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  str_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Primitive.str)
+}
+inline void Primitive::set_str(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  str_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Primitive.str)
+}
+inline void Primitive::set_str(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  str_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Primitive.str)
+}
+inline std::string* Primitive::_internal_mutable_str() {
+  _has_bits_[0] |= 0x00000001u;
+  return str_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Primitive::release_str() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Primitive.str)
+  if (!_internal_has_str()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return str_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Primitive::set_allocated_str(std::string* str) {
+  if (str != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  str_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), str,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Primitive.str)
+}
+
+// optional bytes bytes = 12;
+inline bool Primitive::_internal_has_bytes() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Primitive::has_bytes() const {
+  return _internal_has_bytes();
+}
+inline void Primitive::clear_bytes() {
+  bytes_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Primitive::bytes() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.bytes)
+  return _internal_bytes();
+}
+inline void Primitive::set_bytes(const std::string& value) {
+  _internal_set_bytes(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.bytes)
+}
+inline std::string* Primitive::mutable_bytes() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Primitive.bytes)
+  return _internal_mutable_bytes();
+}
+inline const std::string& Primitive::_internal_bytes() const {
+  return bytes_.Get();
+}
+inline void Primitive::_internal_set_bytes(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  bytes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Primitive::set_bytes(std::string&& value) {
+  _has_bits_[0] |= 0x00000002u;
+  bytes_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Primitive.bytes)
+}
+inline void Primitive::set_bytes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000002u;
+  bytes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Primitive.bytes)
+}
+inline void Primitive::set_bytes(const void* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000002u;
+  bytes_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Primitive.bytes)
+}
+inline std::string* Primitive::_internal_mutable_bytes() {
+  _has_bits_[0] |= 0x00000002u;
+  return bytes_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Primitive::release_bytes() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Primitive.bytes)
+  if (!_internal_has_bytes()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  return bytes_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Primitive::set_allocated_bytes(std::string* bytes) {
+  if (bytes != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  bytes_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), bytes,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Primitive.bytes)
+}
+
+// optional float float = 13;
+inline bool Primitive::_internal_has_float_() const {
+  bool value = (_has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Primitive::has_float_() const {
+  return _internal_has_float_();
+}
+inline void Primitive::clear_float_() {
+  float__ = 0;
+  _has_bits_[0] &= ~0x00000800u;
+}
+inline float Primitive::_internal_float_() const {
+  return float__;
+}
+inline float Primitive::float_() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.float)
+  return _internal_float_();
+}
+inline void Primitive::_internal_set_float_(float value) {
+  _has_bits_[0] |= 0x00000800u;
+  float__ = value;
+}
+inline void Primitive::set_float_(float value) {
+  _internal_set_float_(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.float)
+}
+
+// optional double double = 14;
+inline bool Primitive::_internal_has_double_() const {
+  bool value = (_has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool Primitive::has_double_() const {
+  return _internal_has_double_();
+}
+inline void Primitive::clear_double_() {
+  double__ = 0;
+  _has_bits_[0] &= ~0x00002000u;
+}
+inline double Primitive::_internal_double_() const {
+  return double__;
+}
+inline double Primitive::double_() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.double)
+  return _internal_double_();
+}
+inline void Primitive::_internal_set_double_(double value) {
+  _has_bits_[0] |= 0x00002000u;
+  double__ = value;
+}
+inline void Primitive::set_double_(double value) {
+  _internal_set_double_(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.double)
+}
+
+// optional bool bool = 15;
+inline bool Primitive::_internal_has_bool_() const {
+  bool value = (_has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool Primitive::has_bool_() const {
+  return _internal_has_bool_();
+}
+inline void Primitive::clear_bool_() {
+  bool__ = false;
+  _has_bits_[0] &= ~0x00004000u;
+}
+inline bool Primitive::_internal_bool_() const {
+  return bool__;
+}
+inline bool Primitive::bool_() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.bool)
+  return _internal_bool_();
+}
+inline void Primitive::_internal_set_bool_(bool value) {
+  _has_bits_[0] |= 0x00004000u;
+  bool__ = value;
+}
+inline void Primitive::set_bool_(bool value) {
+  _internal_set_bool_(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.bool)
+}
+
+// repeated fixed32 rep_fix32 = 16;
+inline int Primitive::_internal_rep_fix32_size() const {
+  return rep_fix32_.size();
+}
+inline int Primitive::rep_fix32_size() const {
+  return _internal_rep_fix32_size();
+}
+inline void Primitive::clear_rep_fix32() {
+  rep_fix32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Primitive::_internal_rep_fix32(int index) const {
+  return rep_fix32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Primitive::rep_fix32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_fix32)
+  return _internal_rep_fix32(index);
+}
+inline void Primitive::set_rep_fix32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_fix32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_fix32)
+}
+inline void Primitive::_internal_add_rep_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_fix32_.Add(value);
+}
+inline void Primitive::add_rep_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_rep_fix32(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_fix32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+Primitive::_internal_rep_fix32() const {
+  return rep_fix32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+Primitive::rep_fix32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_fix32)
+  return _internal_rep_fix32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+Primitive::_internal_mutable_rep_fix32() {
+  return &rep_fix32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+Primitive::mutable_rep_fix32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_fix32)
+  return _internal_mutable_rep_fix32();
+}
+
+// repeated uint32 rep_u32 = 17;
+inline int Primitive::_internal_rep_u32_size() const {
+  return rep_u32_.size();
+}
+inline int Primitive::rep_u32_size() const {
+  return _internal_rep_u32_size();
+}
+inline void Primitive::clear_rep_u32() {
+  rep_u32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Primitive::_internal_rep_u32(int index) const {
+  return rep_u32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Primitive::rep_u32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_u32)
+  return _internal_rep_u32(index);
+}
+inline void Primitive::set_rep_u32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_u32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_u32)
+}
+inline void Primitive::_internal_add_rep_u32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_u32_.Add(value);
+}
+inline void Primitive::add_rep_u32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_rep_u32(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_u32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+Primitive::_internal_rep_u32() const {
+  return rep_u32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+Primitive::rep_u32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_u32)
+  return _internal_rep_u32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+Primitive::_internal_mutable_rep_u32() {
+  return &rep_u32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+Primitive::mutable_rep_u32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_u32)
+  return _internal_mutable_rep_u32();
+}
+
+// repeated int32 rep_i32 = 18;
+inline int Primitive::_internal_rep_i32_size() const {
+  return rep_i32_.size();
+}
+inline int Primitive::rep_i32_size() const {
+  return _internal_rep_i32_size();
+}
+inline void Primitive::clear_rep_i32() {
+  rep_i32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::_internal_rep_i32(int index) const {
+  return rep_i32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::rep_i32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_i32)
+  return _internal_rep_i32(index);
+}
+inline void Primitive::set_rep_i32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_i32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_i32)
+}
+inline void Primitive::_internal_add_rep_i32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_i32_.Add(value);
+}
+inline void Primitive::add_rep_i32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_rep_i32(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_i32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+Primitive::_internal_rep_i32() const {
+  return rep_i32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+Primitive::rep_i32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_i32)
+  return _internal_rep_i32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+Primitive::_internal_mutable_rep_i32() {
+  return &rep_i32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+Primitive::mutable_rep_i32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_i32)
+  return _internal_mutable_rep_i32();
+}
+
+// repeated sfixed32 rep_sf32 = 19;
+inline int Primitive::_internal_rep_sf32_size() const {
+  return rep_sf32_.size();
+}
+inline int Primitive::rep_sf32_size() const {
+  return _internal_rep_sf32_size();
+}
+inline void Primitive::clear_rep_sf32() {
+  rep_sf32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::_internal_rep_sf32(int index) const {
+  return rep_sf32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::rep_sf32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_sf32)
+  return _internal_rep_sf32(index);
+}
+inline void Primitive::set_rep_sf32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_sf32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_sf32)
+}
+inline void Primitive::_internal_add_rep_sf32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_sf32_.Add(value);
+}
+inline void Primitive::add_rep_sf32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_rep_sf32(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_sf32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+Primitive::_internal_rep_sf32() const {
+  return rep_sf32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+Primitive::rep_sf32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_sf32)
+  return _internal_rep_sf32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+Primitive::_internal_mutable_rep_sf32() {
+  return &rep_sf32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+Primitive::mutable_rep_sf32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_sf32)
+  return _internal_mutable_rep_sf32();
+}
+
+// repeated sint32 rep_s32 = 20;
+inline int Primitive::_internal_rep_s32_size() const {
+  return rep_s32_.size();
+}
+inline int Primitive::rep_s32_size() const {
+  return _internal_rep_s32_size();
+}
+inline void Primitive::clear_rep_s32() {
+  rep_s32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::_internal_rep_s32(int index) const {
+  return rep_s32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Primitive::rep_s32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_s32)
+  return _internal_rep_s32(index);
+}
+inline void Primitive::set_rep_s32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_s32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_s32)
+}
+inline void Primitive::_internal_add_rep_s32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_s32_.Add(value);
+}
+inline void Primitive::add_rep_s32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_rep_s32(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_s32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+Primitive::_internal_rep_s32() const {
+  return rep_s32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+Primitive::rep_s32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_s32)
+  return _internal_rep_s32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+Primitive::_internal_mutable_rep_s32() {
+  return &rep_s32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+Primitive::mutable_rep_s32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_s32)
+  return _internal_mutable_rep_s32();
+}
+
+// repeated fixed64 rep_fix64 = 21;
+inline int Primitive::_internal_rep_fix64_size() const {
+  return rep_fix64_.size();
+}
+inline int Primitive::rep_fix64_size() const {
+  return _internal_rep_fix64_size();
+}
+inline void Primitive::clear_rep_fix64() {
+  rep_fix64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Primitive::_internal_rep_fix64(int index) const {
+  return rep_fix64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Primitive::rep_fix64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_fix64)
+  return _internal_rep_fix64(index);
+}
+inline void Primitive::set_rep_fix64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_fix64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_fix64)
+}
+inline void Primitive::_internal_add_rep_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_fix64_.Add(value);
+}
+inline void Primitive::add_rep_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_add_rep_fix64(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_fix64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+Primitive::_internal_rep_fix64() const {
+  return rep_fix64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+Primitive::rep_fix64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_fix64)
+  return _internal_rep_fix64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+Primitive::_internal_mutable_rep_fix64() {
+  return &rep_fix64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+Primitive::mutable_rep_fix64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_fix64)
+  return _internal_mutable_rep_fix64();
+}
+
+// repeated uint64 rep_u64 = 22;
+inline int Primitive::_internal_rep_u64_size() const {
+  return rep_u64_.size();
+}
+inline int Primitive::rep_u64_size() const {
+  return _internal_rep_u64_size();
+}
+inline void Primitive::clear_rep_u64() {
+  rep_u64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Primitive::_internal_rep_u64(int index) const {
+  return rep_u64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Primitive::rep_u64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_u64)
+  return _internal_rep_u64(index);
+}
+inline void Primitive::set_rep_u64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_u64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_u64)
+}
+inline void Primitive::_internal_add_rep_u64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_u64_.Add(value);
+}
+inline void Primitive::add_rep_u64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_add_rep_u64(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_u64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+Primitive::_internal_rep_u64() const {
+  return rep_u64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+Primitive::rep_u64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_u64)
+  return _internal_rep_u64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+Primitive::_internal_mutable_rep_u64() {
+  return &rep_u64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+Primitive::mutable_rep_u64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_u64)
+  return _internal_mutable_rep_u64();
+}
+
+// repeated int64 rep_i64 = 23;
+inline int Primitive::_internal_rep_i64_size() const {
+  return rep_i64_.size();
+}
+inline int Primitive::rep_i64_size() const {
+  return _internal_rep_i64_size();
+}
+inline void Primitive::clear_rep_i64() {
+  rep_i64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::_internal_rep_i64(int index) const {
+  return rep_i64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::rep_i64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_i64)
+  return _internal_rep_i64(index);
+}
+inline void Primitive::set_rep_i64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_i64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_i64)
+}
+inline void Primitive::_internal_add_rep_i64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_i64_.Add(value);
+}
+inline void Primitive::add_rep_i64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_rep_i64(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_i64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+Primitive::_internal_rep_i64() const {
+  return rep_i64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+Primitive::rep_i64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_i64)
+  return _internal_rep_i64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+Primitive::_internal_mutable_rep_i64() {
+  return &rep_i64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+Primitive::mutable_rep_i64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_i64)
+  return _internal_mutable_rep_i64();
+}
+
+// repeated sfixed64 rep_sf64 = 24;
+inline int Primitive::_internal_rep_sf64_size() const {
+  return rep_sf64_.size();
+}
+inline int Primitive::rep_sf64_size() const {
+  return _internal_rep_sf64_size();
+}
+inline void Primitive::clear_rep_sf64() {
+  rep_sf64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::_internal_rep_sf64(int index) const {
+  return rep_sf64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::rep_sf64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_sf64)
+  return _internal_rep_sf64(index);
+}
+inline void Primitive::set_rep_sf64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_sf64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_sf64)
+}
+inline void Primitive::_internal_add_rep_sf64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_sf64_.Add(value);
+}
+inline void Primitive::add_rep_sf64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_rep_sf64(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_sf64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+Primitive::_internal_rep_sf64() const {
+  return rep_sf64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+Primitive::rep_sf64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_sf64)
+  return _internal_rep_sf64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+Primitive::_internal_mutable_rep_sf64() {
+  return &rep_sf64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+Primitive::mutable_rep_sf64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_sf64)
+  return _internal_mutable_rep_sf64();
+}
+
+// repeated sint64 rep_s64 = 25;
+inline int Primitive::_internal_rep_s64_size() const {
+  return rep_s64_.size();
+}
+inline int Primitive::rep_s64_size() const {
+  return _internal_rep_s64_size();
+}
+inline void Primitive::clear_rep_s64() {
+  rep_s64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::_internal_rep_s64(int index) const {
+  return rep_s64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 Primitive::rep_s64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_s64)
+  return _internal_rep_s64(index);
+}
+inline void Primitive::set_rep_s64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_s64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_s64)
+}
+inline void Primitive::_internal_add_rep_s64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_s64_.Add(value);
+}
+inline void Primitive::add_rep_s64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_rep_s64(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_s64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+Primitive::_internal_rep_s64() const {
+  return rep_s64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+Primitive::rep_s64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_s64)
+  return _internal_rep_s64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+Primitive::_internal_mutable_rep_s64() {
+  return &rep_s64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+Primitive::mutable_rep_s64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_s64)
+  return _internal_mutable_rep_s64();
+}
+
+// repeated string rep_str = 26;
+inline int Primitive::_internal_rep_str_size() const {
+  return rep_str_.size();
+}
+inline int Primitive::rep_str_size() const {
+  return _internal_rep_str_size();
+}
+inline void Primitive::clear_rep_str() {
+  rep_str_.Clear();
+}
+inline std::string* Primitive::add_rep_str() {
+  // @@protoc_insertion_point(field_add_mutable:proto_util_converter.testing.Primitive.rep_str)
+  return _internal_add_rep_str();
+}
+inline const std::string& Primitive::_internal_rep_str(int index) const {
+  return rep_str_.Get(index);
+}
+inline const std::string& Primitive::rep_str(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_str)
+  return _internal_rep_str(index);
+}
+inline std::string* Primitive::mutable_rep_str(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Primitive.rep_str)
+  return rep_str_.Mutable(index);
+}
+inline void Primitive::set_rep_str(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_str)
+  rep_str_.Mutable(index)->assign(value);
+}
+inline void Primitive::set_rep_str(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_str)
+  rep_str_.Mutable(index)->assign(std::move(value));
+}
+inline void Primitive::set_rep_str(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  rep_str_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Primitive.rep_str)
+}
+inline void Primitive::set_rep_str(int index, const char* value, size_t size) {
+  rep_str_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Primitive.rep_str)
+}
+inline std::string* Primitive::_internal_add_rep_str() {
+  return rep_str_.Add();
+}
+inline void Primitive::add_rep_str(const std::string& value) {
+  rep_str_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_str)
+}
+inline void Primitive::add_rep_str(std::string&& value) {
+  rep_str_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_str)
+}
+inline void Primitive::add_rep_str(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  rep_str_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto_util_converter.testing.Primitive.rep_str)
+}
+inline void Primitive::add_rep_str(const char* value, size_t size) {
+  rep_str_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto_util_converter.testing.Primitive.rep_str)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Primitive::rep_str() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_str)
+  return rep_str_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Primitive::mutable_rep_str() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_str)
+  return &rep_str_;
+}
+
+// repeated bytes rep_bytes = 27;
+inline int Primitive::_internal_rep_bytes_size() const {
+  return rep_bytes_.size();
+}
+inline int Primitive::rep_bytes_size() const {
+  return _internal_rep_bytes_size();
+}
+inline void Primitive::clear_rep_bytes() {
+  rep_bytes_.Clear();
+}
+inline std::string* Primitive::add_rep_bytes() {
+  // @@protoc_insertion_point(field_add_mutable:proto_util_converter.testing.Primitive.rep_bytes)
+  return _internal_add_rep_bytes();
+}
+inline const std::string& Primitive::_internal_rep_bytes(int index) const {
+  return rep_bytes_.Get(index);
+}
+inline const std::string& Primitive::rep_bytes(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_bytes)
+  return _internal_rep_bytes(index);
+}
+inline std::string* Primitive::mutable_rep_bytes(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Primitive.rep_bytes)
+  return rep_bytes_.Mutable(index);
+}
+inline void Primitive::set_rep_bytes(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_bytes)
+  rep_bytes_.Mutable(index)->assign(value);
+}
+inline void Primitive::set_rep_bytes(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_bytes)
+  rep_bytes_.Mutable(index)->assign(std::move(value));
+}
+inline void Primitive::set_rep_bytes(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  rep_bytes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Primitive.rep_bytes)
+}
+inline void Primitive::set_rep_bytes(int index, const void* value, size_t size) {
+  rep_bytes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Primitive.rep_bytes)
+}
+inline std::string* Primitive::_internal_add_rep_bytes() {
+  return rep_bytes_.Add();
+}
+inline void Primitive::add_rep_bytes(const std::string& value) {
+  rep_bytes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_bytes)
+}
+inline void Primitive::add_rep_bytes(std::string&& value) {
+  rep_bytes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_bytes)
+}
+inline void Primitive::add_rep_bytes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  rep_bytes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto_util_converter.testing.Primitive.rep_bytes)
+}
+inline void Primitive::add_rep_bytes(const void* value, size_t size) {
+  rep_bytes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto_util_converter.testing.Primitive.rep_bytes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Primitive::rep_bytes() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_bytes)
+  return rep_bytes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Primitive::mutable_rep_bytes() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_bytes)
+  return &rep_bytes_;
+}
+
+// repeated float rep_float = 28;
+inline int Primitive::_internal_rep_float_size() const {
+  return rep_float_.size();
+}
+inline int Primitive::rep_float_size() const {
+  return _internal_rep_float_size();
+}
+inline void Primitive::clear_rep_float() {
+  rep_float_.Clear();
+}
+inline float Primitive::_internal_rep_float(int index) const {
+  return rep_float_.Get(index);
+}
+inline float Primitive::rep_float(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_float)
+  return _internal_rep_float(index);
+}
+inline void Primitive::set_rep_float(int index, float value) {
+  rep_float_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_float)
+}
+inline void Primitive::_internal_add_rep_float(float value) {
+  rep_float_.Add(value);
+}
+inline void Primitive::add_rep_float(float value) {
+  _internal_add_rep_float(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_float)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Primitive::_internal_rep_float() const {
+  return rep_float_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Primitive::rep_float() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_float)
+  return _internal_rep_float();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Primitive::_internal_mutable_rep_float() {
+  return &rep_float_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Primitive::mutable_rep_float() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_float)
+  return _internal_mutable_rep_float();
+}
+
+// repeated double rep_double = 29;
+inline int Primitive::_internal_rep_double_size() const {
+  return rep_double_.size();
+}
+inline int Primitive::rep_double_size() const {
+  return _internal_rep_double_size();
+}
+inline void Primitive::clear_rep_double() {
+  rep_double_.Clear();
+}
+inline double Primitive::_internal_rep_double(int index) const {
+  return rep_double_.Get(index);
+}
+inline double Primitive::rep_double(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_double)
+  return _internal_rep_double(index);
+}
+inline void Primitive::set_rep_double(int index, double value) {
+  rep_double_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_double)
+}
+inline void Primitive::_internal_add_rep_double(double value) {
+  rep_double_.Add(value);
+}
+inline void Primitive::add_rep_double(double value) {
+  _internal_add_rep_double(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_double)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+Primitive::_internal_rep_double() const {
+  return rep_double_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+Primitive::rep_double() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_double)
+  return _internal_rep_double();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+Primitive::_internal_mutable_rep_double() {
+  return &rep_double_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+Primitive::mutable_rep_double() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_double)
+  return _internal_mutable_rep_double();
+}
+
+// repeated bool rep_bool = 30;
+inline int Primitive::_internal_rep_bool_size() const {
+  return rep_bool_.size();
+}
+inline int Primitive::rep_bool_size() const {
+  return _internal_rep_bool_size();
+}
+inline void Primitive::clear_rep_bool() {
+  rep_bool_.Clear();
+}
+inline bool Primitive::_internal_rep_bool(int index) const {
+  return rep_bool_.Get(index);
+}
+inline bool Primitive::rep_bool(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Primitive.rep_bool)
+  return _internal_rep_bool(index);
+}
+inline void Primitive::set_rep_bool(int index, bool value) {
+  rep_bool_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Primitive.rep_bool)
+}
+inline void Primitive::_internal_add_rep_bool(bool value) {
+  rep_bool_.Add(value);
+}
+inline void Primitive::add_rep_bool(bool value) {
+  _internal_add_rep_bool(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Primitive.rep_bool)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+Primitive::_internal_rep_bool() const {
+  return rep_bool_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+Primitive::rep_bool() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Primitive.rep_bool)
+  return _internal_rep_bool();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+Primitive::_internal_mutable_rep_bool() {
+  return &rep_bool_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+Primitive::mutable_rep_bool() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Primitive.rep_bool)
+  return _internal_mutable_rep_bool();
+}
+
+// -------------------------------------------------------------------
+
+// PackedPrimitive
+
+// repeated fixed32 rep_fix32 = 16 [packed = true];
+inline int PackedPrimitive::_internal_rep_fix32_size() const {
+  return rep_fix32_.size();
+}
+inline int PackedPrimitive::rep_fix32_size() const {
+  return _internal_rep_fix32_size();
+}
+inline void PackedPrimitive::clear_rep_fix32() {
+  rep_fix32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 PackedPrimitive::_internal_rep_fix32(int index) const {
+  return rep_fix32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 PackedPrimitive::rep_fix32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_fix32)
+  return _internal_rep_fix32(index);
+}
+inline void PackedPrimitive::set_rep_fix32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_fix32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_fix32)
+}
+inline void PackedPrimitive::_internal_add_rep_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_fix32_.Add(value);
+}
+inline void PackedPrimitive::add_rep_fix32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_rep_fix32(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_fix32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+PackedPrimitive::_internal_rep_fix32() const {
+  return rep_fix32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+PackedPrimitive::rep_fix32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_fix32)
+  return _internal_rep_fix32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+PackedPrimitive::_internal_mutable_rep_fix32() {
+  return &rep_fix32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+PackedPrimitive::mutable_rep_fix32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_fix32)
+  return _internal_mutable_rep_fix32();
+}
+
+// repeated uint32 rep_u32 = 17 [packed = true];
+inline int PackedPrimitive::_internal_rep_u32_size() const {
+  return rep_u32_.size();
+}
+inline int PackedPrimitive::rep_u32_size() const {
+  return _internal_rep_u32_size();
+}
+inline void PackedPrimitive::clear_rep_u32() {
+  rep_u32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 PackedPrimitive::_internal_rep_u32(int index) const {
+  return rep_u32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 PackedPrimitive::rep_u32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_u32)
+  return _internal_rep_u32(index);
+}
+inline void PackedPrimitive::set_rep_u32(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_u32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_u32)
+}
+inline void PackedPrimitive::_internal_add_rep_u32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  rep_u32_.Add(value);
+}
+inline void PackedPrimitive::add_rep_u32(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_rep_u32(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_u32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+PackedPrimitive::_internal_rep_u32() const {
+  return rep_u32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+PackedPrimitive::rep_u32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_u32)
+  return _internal_rep_u32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+PackedPrimitive::_internal_mutable_rep_u32() {
+  return &rep_u32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+PackedPrimitive::mutable_rep_u32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_u32)
+  return _internal_mutable_rep_u32();
+}
+
+// repeated int32 rep_i32 = 18 [packed = true];
+inline int PackedPrimitive::_internal_rep_i32_size() const {
+  return rep_i32_.size();
+}
+inline int PackedPrimitive::rep_i32_size() const {
+  return _internal_rep_i32_size();
+}
+inline void PackedPrimitive::clear_rep_i32() {
+  rep_i32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 PackedPrimitive::_internal_rep_i32(int index) const {
+  return rep_i32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 PackedPrimitive::rep_i32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_i32)
+  return _internal_rep_i32(index);
+}
+inline void PackedPrimitive::set_rep_i32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_i32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_i32)
+}
+inline void PackedPrimitive::_internal_add_rep_i32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_i32_.Add(value);
+}
+inline void PackedPrimitive::add_rep_i32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_rep_i32(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_i32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+PackedPrimitive::_internal_rep_i32() const {
+  return rep_i32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+PackedPrimitive::rep_i32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_i32)
+  return _internal_rep_i32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+PackedPrimitive::_internal_mutable_rep_i32() {
+  return &rep_i32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+PackedPrimitive::mutable_rep_i32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_i32)
+  return _internal_mutable_rep_i32();
+}
+
+// repeated sfixed32 rep_sf32 = 19 [packed = true];
+inline int PackedPrimitive::_internal_rep_sf32_size() const {
+  return rep_sf32_.size();
+}
+inline int PackedPrimitive::rep_sf32_size() const {
+  return _internal_rep_sf32_size();
+}
+inline void PackedPrimitive::clear_rep_sf32() {
+  rep_sf32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 PackedPrimitive::_internal_rep_sf32(int index) const {
+  return rep_sf32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 PackedPrimitive::rep_sf32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_sf32)
+  return _internal_rep_sf32(index);
+}
+inline void PackedPrimitive::set_rep_sf32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_sf32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_sf32)
+}
+inline void PackedPrimitive::_internal_add_rep_sf32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_sf32_.Add(value);
+}
+inline void PackedPrimitive::add_rep_sf32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_rep_sf32(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_sf32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+PackedPrimitive::_internal_rep_sf32() const {
+  return rep_sf32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+PackedPrimitive::rep_sf32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_sf32)
+  return _internal_rep_sf32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+PackedPrimitive::_internal_mutable_rep_sf32() {
+  return &rep_sf32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+PackedPrimitive::mutable_rep_sf32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_sf32)
+  return _internal_mutable_rep_sf32();
+}
+
+// repeated sint32 rep_s32 = 20 [packed = true];
+inline int PackedPrimitive::_internal_rep_s32_size() const {
+  return rep_s32_.size();
+}
+inline int PackedPrimitive::rep_s32_size() const {
+  return _internal_rep_s32_size();
+}
+inline void PackedPrimitive::clear_rep_s32() {
+  rep_s32_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 PackedPrimitive::_internal_rep_s32(int index) const {
+  return rep_s32_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 PackedPrimitive::rep_s32(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_s32)
+  return _internal_rep_s32(index);
+}
+inline void PackedPrimitive::set_rep_s32(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_s32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_s32)
+}
+inline void PackedPrimitive::_internal_add_rep_s32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  rep_s32_.Add(value);
+}
+inline void PackedPrimitive::add_rep_s32(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_rep_s32(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_s32)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+PackedPrimitive::_internal_rep_s32() const {
+  return rep_s32_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+PackedPrimitive::rep_s32() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_s32)
+  return _internal_rep_s32();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+PackedPrimitive::_internal_mutable_rep_s32() {
+  return &rep_s32_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+PackedPrimitive::mutable_rep_s32() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_s32)
+  return _internal_mutable_rep_s32();
+}
+
+// repeated fixed64 rep_fix64 = 21 [packed = true];
+inline int PackedPrimitive::_internal_rep_fix64_size() const {
+  return rep_fix64_.size();
+}
+inline int PackedPrimitive::rep_fix64_size() const {
+  return _internal_rep_fix64_size();
+}
+inline void PackedPrimitive::clear_rep_fix64() {
+  rep_fix64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 PackedPrimitive::_internal_rep_fix64(int index) const {
+  return rep_fix64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 PackedPrimitive::rep_fix64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_fix64)
+  return _internal_rep_fix64(index);
+}
+inline void PackedPrimitive::set_rep_fix64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_fix64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_fix64)
+}
+inline void PackedPrimitive::_internal_add_rep_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_fix64_.Add(value);
+}
+inline void PackedPrimitive::add_rep_fix64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_add_rep_fix64(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_fix64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+PackedPrimitive::_internal_rep_fix64() const {
+  return rep_fix64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+PackedPrimitive::rep_fix64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_fix64)
+  return _internal_rep_fix64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+PackedPrimitive::_internal_mutable_rep_fix64() {
+  return &rep_fix64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+PackedPrimitive::mutable_rep_fix64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_fix64)
+  return _internal_mutable_rep_fix64();
+}
+
+// repeated uint64 rep_u64 = 22 [packed = true];
+inline int PackedPrimitive::_internal_rep_u64_size() const {
+  return rep_u64_.size();
+}
+inline int PackedPrimitive::rep_u64_size() const {
+  return _internal_rep_u64_size();
+}
+inline void PackedPrimitive::clear_rep_u64() {
+  rep_u64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 PackedPrimitive::_internal_rep_u64(int index) const {
+  return rep_u64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 PackedPrimitive::rep_u64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_u64)
+  return _internal_rep_u64(index);
+}
+inline void PackedPrimitive::set_rep_u64(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_u64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_u64)
+}
+inline void PackedPrimitive::_internal_add_rep_u64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  rep_u64_.Add(value);
+}
+inline void PackedPrimitive::add_rep_u64(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_add_rep_u64(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_u64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+PackedPrimitive::_internal_rep_u64() const {
+  return rep_u64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+PackedPrimitive::rep_u64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_u64)
+  return _internal_rep_u64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+PackedPrimitive::_internal_mutable_rep_u64() {
+  return &rep_u64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+PackedPrimitive::mutable_rep_u64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_u64)
+  return _internal_mutable_rep_u64();
+}
+
+// repeated int64 rep_i64 = 23 [packed = true];
+inline int PackedPrimitive::_internal_rep_i64_size() const {
+  return rep_i64_.size();
+}
+inline int PackedPrimitive::rep_i64_size() const {
+  return _internal_rep_i64_size();
+}
+inline void PackedPrimitive::clear_rep_i64() {
+  rep_i64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 PackedPrimitive::_internal_rep_i64(int index) const {
+  return rep_i64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 PackedPrimitive::rep_i64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_i64)
+  return _internal_rep_i64(index);
+}
+inline void PackedPrimitive::set_rep_i64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_i64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_i64)
+}
+inline void PackedPrimitive::_internal_add_rep_i64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_i64_.Add(value);
+}
+inline void PackedPrimitive::add_rep_i64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_rep_i64(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_i64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+PackedPrimitive::_internal_rep_i64() const {
+  return rep_i64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+PackedPrimitive::rep_i64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_i64)
+  return _internal_rep_i64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+PackedPrimitive::_internal_mutable_rep_i64() {
+  return &rep_i64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+PackedPrimitive::mutable_rep_i64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_i64)
+  return _internal_mutable_rep_i64();
+}
+
+// repeated sfixed64 rep_sf64 = 24 [packed = true];
+inline int PackedPrimitive::_internal_rep_sf64_size() const {
+  return rep_sf64_.size();
+}
+inline int PackedPrimitive::rep_sf64_size() const {
+  return _internal_rep_sf64_size();
+}
+inline void PackedPrimitive::clear_rep_sf64() {
+  rep_sf64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 PackedPrimitive::_internal_rep_sf64(int index) const {
+  return rep_sf64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 PackedPrimitive::rep_sf64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_sf64)
+  return _internal_rep_sf64(index);
+}
+inline void PackedPrimitive::set_rep_sf64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_sf64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_sf64)
+}
+inline void PackedPrimitive::_internal_add_rep_sf64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_sf64_.Add(value);
+}
+inline void PackedPrimitive::add_rep_sf64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_rep_sf64(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_sf64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+PackedPrimitive::_internal_rep_sf64() const {
+  return rep_sf64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+PackedPrimitive::rep_sf64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_sf64)
+  return _internal_rep_sf64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+PackedPrimitive::_internal_mutable_rep_sf64() {
+  return &rep_sf64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+PackedPrimitive::mutable_rep_sf64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_sf64)
+  return _internal_mutable_rep_sf64();
+}
+
+// repeated sint64 rep_s64 = 25 [packed = true];
+inline int PackedPrimitive::_internal_rep_s64_size() const {
+  return rep_s64_.size();
+}
+inline int PackedPrimitive::rep_s64_size() const {
+  return _internal_rep_s64_size();
+}
+inline void PackedPrimitive::clear_rep_s64() {
+  rep_s64_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 PackedPrimitive::_internal_rep_s64(int index) const {
+  return rep_s64_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 PackedPrimitive::rep_s64(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_s64)
+  return _internal_rep_s64(index);
+}
+inline void PackedPrimitive::set_rep_s64(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_s64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_s64)
+}
+inline void PackedPrimitive::_internal_add_rep_s64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  rep_s64_.Add(value);
+}
+inline void PackedPrimitive::add_rep_s64(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_rep_s64(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_s64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+PackedPrimitive::_internal_rep_s64() const {
+  return rep_s64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+PackedPrimitive::rep_s64() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_s64)
+  return _internal_rep_s64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+PackedPrimitive::_internal_mutable_rep_s64() {
+  return &rep_s64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+PackedPrimitive::mutable_rep_s64() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_s64)
+  return _internal_mutable_rep_s64();
+}
+
+// repeated float rep_float = 28 [packed = true];
+inline int PackedPrimitive::_internal_rep_float_size() const {
+  return rep_float_.size();
+}
+inline int PackedPrimitive::rep_float_size() const {
+  return _internal_rep_float_size();
+}
+inline void PackedPrimitive::clear_rep_float() {
+  rep_float_.Clear();
+}
+inline float PackedPrimitive::_internal_rep_float(int index) const {
+  return rep_float_.Get(index);
+}
+inline float PackedPrimitive::rep_float(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_float)
+  return _internal_rep_float(index);
+}
+inline void PackedPrimitive::set_rep_float(int index, float value) {
+  rep_float_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_float)
+}
+inline void PackedPrimitive::_internal_add_rep_float(float value) {
+  rep_float_.Add(value);
+}
+inline void PackedPrimitive::add_rep_float(float value) {
+  _internal_add_rep_float(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_float)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+PackedPrimitive::_internal_rep_float() const {
+  return rep_float_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+PackedPrimitive::rep_float() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_float)
+  return _internal_rep_float();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+PackedPrimitive::_internal_mutable_rep_float() {
+  return &rep_float_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+PackedPrimitive::mutable_rep_float() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_float)
+  return _internal_mutable_rep_float();
+}
+
+// repeated double rep_double = 29 [packed = true];
+inline int PackedPrimitive::_internal_rep_double_size() const {
+  return rep_double_.size();
+}
+inline int PackedPrimitive::rep_double_size() const {
+  return _internal_rep_double_size();
+}
+inline void PackedPrimitive::clear_rep_double() {
+  rep_double_.Clear();
+}
+inline double PackedPrimitive::_internal_rep_double(int index) const {
+  return rep_double_.Get(index);
+}
+inline double PackedPrimitive::rep_double(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_double)
+  return _internal_rep_double(index);
+}
+inline void PackedPrimitive::set_rep_double(int index, double value) {
+  rep_double_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_double)
+}
+inline void PackedPrimitive::_internal_add_rep_double(double value) {
+  rep_double_.Add(value);
+}
+inline void PackedPrimitive::add_rep_double(double value) {
+  _internal_add_rep_double(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_double)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+PackedPrimitive::_internal_rep_double() const {
+  return rep_double_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+PackedPrimitive::rep_double() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_double)
+  return _internal_rep_double();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+PackedPrimitive::_internal_mutable_rep_double() {
+  return &rep_double_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+PackedPrimitive::mutable_rep_double() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_double)
+  return _internal_mutable_rep_double();
+}
+
+// repeated bool rep_bool = 30 [packed = true];
+inline int PackedPrimitive::_internal_rep_bool_size() const {
+  return rep_bool_.size();
+}
+inline int PackedPrimitive::rep_bool_size() const {
+  return _internal_rep_bool_size();
+}
+inline void PackedPrimitive::clear_rep_bool() {
+  rep_bool_.Clear();
+}
+inline bool PackedPrimitive::_internal_rep_bool(int index) const {
+  return rep_bool_.Get(index);
+}
+inline bool PackedPrimitive::rep_bool(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.PackedPrimitive.rep_bool)
+  return _internal_rep_bool(index);
+}
+inline void PackedPrimitive::set_rep_bool(int index, bool value) {
+  rep_bool_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.PackedPrimitive.rep_bool)
+}
+inline void PackedPrimitive::_internal_add_rep_bool(bool value) {
+  rep_bool_.Add(value);
+}
+inline void PackedPrimitive::add_rep_bool(bool value) {
+  _internal_add_rep_bool(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.PackedPrimitive.rep_bool)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+PackedPrimitive::_internal_rep_bool() const {
+  return rep_bool_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+PackedPrimitive::rep_bool() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.PackedPrimitive.rep_bool)
+  return _internal_rep_bool();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+PackedPrimitive::_internal_mutable_rep_bool() {
+  return &rep_bool_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+PackedPrimitive::mutable_rep_bool() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.PackedPrimitive.rep_bool)
+  return _internal_mutable_rep_bool();
+}
+
+// -------------------------------------------------------------------
+
+// NestedBook
+
+// optional .proto_util_converter.testing.Book book = 1;
+inline bool NestedBook::_internal_has_book() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || book_ != nullptr);
+  return value;
+}
+inline bool NestedBook::has_book() const {
+  return _internal_has_book();
+}
+inline void NestedBook::clear_book() {
+  if (book_ != nullptr) book_->Clear();
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const ::proto_util_converter::testing::Book& NestedBook::_internal_book() const {
+  const ::proto_util_converter::testing::Book* p = book_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Book*>(
+      &::proto_util_converter::testing::_Book_default_instance_);
+}
+inline const ::proto_util_converter::testing::Book& NestedBook::book() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.NestedBook.book)
+  return _internal_book();
+}
+inline void NestedBook::unsafe_arena_set_allocated_book(
+    ::proto_util_converter::testing::Book* book) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(book_);
+  }
+  book_ = book;
+  if (book) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.NestedBook.book)
+}
+inline ::proto_util_converter::testing::Book* NestedBook::release_book() {
+  _has_bits_[0] &= ~0x00000001u;
+  ::proto_util_converter::testing::Book* temp = book_;
+  book_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::Book* NestedBook::unsafe_arena_release_book() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.NestedBook.book)
+  _has_bits_[0] &= ~0x00000001u;
+  ::proto_util_converter::testing::Book* temp = book_;
+  book_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Book* NestedBook::_internal_mutable_book() {
+  _has_bits_[0] |= 0x00000001u;
+  if (book_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Book>(GetArena());
+    book_ = p;
+  }
+  return book_;
+}
+inline ::proto_util_converter::testing::Book* NestedBook::mutable_book() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.NestedBook.book)
+  return _internal_mutable_book();
+}
+inline void NestedBook::set_allocated_book(::proto_util_converter::testing::Book* book) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete book_;
+  }
+  if (book) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(book);
+    if (message_arena != submessage_arena) {
+      book = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, book, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  book_ = book;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.NestedBook.book)
+}
+
+// -------------------------------------------------------------------
+
+// BadNestedBook
+
+// repeated uint32 book = 1 [packed = true];
+inline int BadNestedBook::_internal_book_size() const {
+  return book_.size();
+}
+inline int BadNestedBook::book_size() const {
+  return _internal_book_size();
+}
+inline void BadNestedBook::clear_book() {
+  book_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 BadNestedBook::_internal_book(int index) const {
+  return book_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 BadNestedBook::book(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.BadNestedBook.book)
+  return _internal_book(index);
+}
+inline void BadNestedBook::set_book(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  book_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.BadNestedBook.book)
+}
+inline void BadNestedBook::_internal_add_book(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  book_.Add(value);
+}
+inline void BadNestedBook::add_book(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_book(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.BadNestedBook.book)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+BadNestedBook::_internal_book() const {
+  return book_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+BadNestedBook::book() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.BadNestedBook.book)
+  return _internal_book();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+BadNestedBook::_internal_mutable_book() {
+  return &book_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+BadNestedBook::mutable_book() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.BadNestedBook.book)
+  return _internal_mutable_book();
+}
+
+// -------------------------------------------------------------------
+
+// Cyclic
+
+// optional int32 m_int = 1;
+inline bool Cyclic::_internal_has_m_int() const {
+  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Cyclic::has_m_int() const {
+  return _internal_has_m_int();
+}
+inline void Cyclic::clear_m_int() {
+  m_int_ = 0;
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Cyclic::_internal_m_int() const {
+  return m_int_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Cyclic::m_int() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Cyclic.m_int)
+  return _internal_m_int();
+}
+inline void Cyclic::_internal_set_m_int(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000008u;
+  m_int_ = value;
+}
+inline void Cyclic::set_m_int(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_m_int(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Cyclic.m_int)
+}
+
+// optional string m_str = 2;
+inline bool Cyclic::_internal_has_m_str() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Cyclic::has_m_str() const {
+  return _internal_has_m_str();
+}
+inline void Cyclic::clear_m_str() {
+  m_str_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Cyclic::m_str() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Cyclic.m_str)
+  return _internal_m_str();
+}
+inline void Cyclic::set_m_str(const std::string& value) {
+  _internal_set_m_str(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.Cyclic.m_str)
+}
+inline std::string* Cyclic::mutable_m_str() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Cyclic.m_str)
+  return _internal_mutable_m_str();
+}
+inline const std::string& Cyclic::_internal_m_str() const {
+  return m_str_.Get();
+}
+inline void Cyclic::_internal_set_m_str(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  m_str_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Cyclic::set_m_str(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  m_str_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.Cyclic.m_str)
+}
+inline void Cyclic::set_m_str(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  m_str_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.Cyclic.m_str)
+}
+inline void Cyclic::set_m_str(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  m_str_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.Cyclic.m_str)
+}
+inline std::string* Cyclic::_internal_mutable_m_str() {
+  _has_bits_[0] |= 0x00000001u;
+  return m_str_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Cyclic::release_m_str() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Cyclic.m_str)
+  if (!_internal_has_m_str()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return m_str_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Cyclic::set_allocated_m_str(std::string* m_str) {
+  if (m_str != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  m_str_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), m_str,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Cyclic.m_str)
+}
+
+// optional .proto_util_converter.testing.Book m_book = 3;
+inline bool Cyclic::_internal_has_m_book() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || m_book_ != nullptr);
+  return value;
+}
+inline bool Cyclic::has_m_book() const {
+  return _internal_has_m_book();
+}
+inline void Cyclic::clear_m_book() {
+  if (m_book_ != nullptr) m_book_->Clear();
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const ::proto_util_converter::testing::Book& Cyclic::_internal_m_book() const {
+  const ::proto_util_converter::testing::Book* p = m_book_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Book*>(
+      &::proto_util_converter::testing::_Book_default_instance_);
+}
+inline const ::proto_util_converter::testing::Book& Cyclic::m_book() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Cyclic.m_book)
+  return _internal_m_book();
+}
+inline void Cyclic::unsafe_arena_set_allocated_m_book(
+    ::proto_util_converter::testing::Book* m_book) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(m_book_);
+  }
+  m_book_ = m_book;
+  if (m_book) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Cyclic.m_book)
+}
+inline ::proto_util_converter::testing::Book* Cyclic::release_m_book() {
+  _has_bits_[0] &= ~0x00000002u;
+  ::proto_util_converter::testing::Book* temp = m_book_;
+  m_book_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::Book* Cyclic::unsafe_arena_release_m_book() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Cyclic.m_book)
+  _has_bits_[0] &= ~0x00000002u;
+  ::proto_util_converter::testing::Book* temp = m_book_;
+  m_book_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Book* Cyclic::_internal_mutable_m_book() {
+  _has_bits_[0] |= 0x00000002u;
+  if (m_book_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Book>(GetArena());
+    m_book_ = p;
+  }
+  return m_book_;
+}
+inline ::proto_util_converter::testing::Book* Cyclic::mutable_m_book() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Cyclic.m_book)
+  return _internal_mutable_m_book();
+}
+inline void Cyclic::set_allocated_m_book(::proto_util_converter::testing::Book* m_book) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete m_book_;
+  }
+  if (m_book) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(m_book);
+    if (message_arena != submessage_arena) {
+      m_book = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, m_book, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  m_book_ = m_book;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Cyclic.m_book)
+}
+
+// repeated .proto_util_converter.testing.Author m_author = 5;
+inline int Cyclic::_internal_m_author_size() const {
+  return m_author_.size();
+}
+inline int Cyclic::m_author_size() const {
+  return _internal_m_author_size();
+}
+inline void Cyclic::clear_m_author() {
+  m_author_.Clear();
+}
+inline ::proto_util_converter::testing::Author* Cyclic::mutable_m_author(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Cyclic.m_author)
+  return m_author_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >*
+Cyclic::mutable_m_author() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.Cyclic.m_author)
+  return &m_author_;
+}
+inline const ::proto_util_converter::testing::Author& Cyclic::_internal_m_author(int index) const {
+  return m_author_.Get(index);
+}
+inline const ::proto_util_converter::testing::Author& Cyclic::m_author(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Cyclic.m_author)
+  return _internal_m_author(index);
+}
+inline ::proto_util_converter::testing::Author* Cyclic::_internal_add_m_author() {
+  return m_author_.Add();
+}
+inline ::proto_util_converter::testing::Author* Cyclic::add_m_author() {
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.Cyclic.m_author)
+  return _internal_add_m_author();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_util_converter::testing::Author >&
+Cyclic::m_author() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.Cyclic.m_author)
+  return m_author_;
+}
+
+// optional .proto_util_converter.testing.Cyclic m_cyclic = 4;
+inline bool Cyclic::_internal_has_m_cyclic() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || m_cyclic_ != nullptr);
+  return value;
+}
+inline bool Cyclic::has_m_cyclic() const {
+  return _internal_has_m_cyclic();
+}
+inline void Cyclic::clear_m_cyclic() {
+  if (m_cyclic_ != nullptr) m_cyclic_->Clear();
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline const ::proto_util_converter::testing::Cyclic& Cyclic::_internal_m_cyclic() const {
+  const ::proto_util_converter::testing::Cyclic* p = m_cyclic_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Cyclic*>(
+      &::proto_util_converter::testing::_Cyclic_default_instance_);
+}
+inline const ::proto_util_converter::testing::Cyclic& Cyclic::m_cyclic() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.Cyclic.m_cyclic)
+  return _internal_m_cyclic();
+}
+inline void Cyclic::unsafe_arena_set_allocated_m_cyclic(
+    ::proto_util_converter::testing::Cyclic* m_cyclic) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(m_cyclic_);
+  }
+  m_cyclic_ = m_cyclic;
+  if (m_cyclic) {
+    _has_bits_[0] |= 0x00000004u;
+  } else {
+    _has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.Cyclic.m_cyclic)
+}
+inline ::proto_util_converter::testing::Cyclic* Cyclic::release_m_cyclic() {
+  _has_bits_[0] &= ~0x00000004u;
+  ::proto_util_converter::testing::Cyclic* temp = m_cyclic_;
+  m_cyclic_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::Cyclic* Cyclic::unsafe_arena_release_m_cyclic() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.Cyclic.m_cyclic)
+  _has_bits_[0] &= ~0x00000004u;
+  ::proto_util_converter::testing::Cyclic* temp = m_cyclic_;
+  m_cyclic_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Cyclic* Cyclic::_internal_mutable_m_cyclic() {
+  _has_bits_[0] |= 0x00000004u;
+  if (m_cyclic_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Cyclic>(GetArena());
+    m_cyclic_ = p;
+  }
+  return m_cyclic_;
+}
+inline ::proto_util_converter::testing::Cyclic* Cyclic::mutable_m_cyclic() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.Cyclic.m_cyclic)
+  return _internal_mutable_m_cyclic();
+}
+inline void Cyclic::set_allocated_m_cyclic(::proto_util_converter::testing::Cyclic* m_cyclic) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete m_cyclic_;
+  }
+  if (m_cyclic) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(m_cyclic);
+    if (message_arena != submessage_arena) {
+      m_cyclic = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, m_cyclic, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000004u;
+  } else {
+    _has_bits_[0] &= ~0x00000004u;
+  }
+  m_cyclic_ = m_cyclic;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.Cyclic.m_cyclic)
+}
+
+// -------------------------------------------------------------------
+
+// TestJsonName1
+
+// optional int32 one_value = 1[json_name = "value"];
+inline bool TestJsonName1::_internal_has_one_value() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TestJsonName1::has_one_value() const {
+  return _internal_has_one_value();
+}
+inline void TestJsonName1::clear_one_value() {
+  one_value_ = 0;
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestJsonName1::_internal_one_value() const {
+  return one_value_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestJsonName1::one_value() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestJsonName1.one_value)
+  return _internal_one_value();
+}
+inline void TestJsonName1::_internal_set_one_value(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000001u;
+  one_value_ = value;
+}
+inline void TestJsonName1::set_one_value(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_one_value(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestJsonName1.one_value)
+}
+
+// -------------------------------------------------------------------
+
+// TestJsonName2
+
+// optional int32 another_value = 1[json_name = "value"];
+inline bool TestJsonName2::_internal_has_another_value() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TestJsonName2::has_another_value() const {
+  return _internal_has_another_value();
+}
+inline void TestJsonName2::clear_another_value() {
+  another_value_ = 0;
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestJsonName2::_internal_another_value() const {
+  return another_value_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestJsonName2::another_value() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestJsonName2.another_value)
+  return _internal_another_value();
+}
+inline void TestJsonName2::_internal_set_another_value(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000001u;
+  another_value_ = value;
+}
+inline void TestJsonName2::set_another_value(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_another_value(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestJsonName2.another_value)
+}
+
+// -------------------------------------------------------------------
+
+// TestPrimitiveFieldsWithSameJsonName
+
+// optional string val_str1 = 1;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_str1() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_str1() const {
+  return _internal_has_val_str1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_str1() {
+  val_str1_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TestPrimitiveFieldsWithSameJsonName::val_str1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str1)
+  return _internal_val_str1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_str1(const std::string& value) {
+  _internal_set_val_str1(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str1)
+}
+inline std::string* TestPrimitiveFieldsWithSameJsonName::mutable_val_str1() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str1)
+  return _internal_mutable_val_str1();
+}
+inline const std::string& TestPrimitiveFieldsWithSameJsonName::_internal_val_str1() const {
+  return val_str1_.Get();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_str1(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  val_str1_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_str1(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  val_str1_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str1)
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_str1(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  val_str1_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str1)
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_str1(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  val_str1_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str1)
+}
+inline std::string* TestPrimitiveFieldsWithSameJsonName::_internal_mutable_val_str1() {
+  _has_bits_[0] |= 0x00000001u;
+  return val_str1_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* TestPrimitiveFieldsWithSameJsonName::release_val_str1() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str1)
+  if (!_internal_has_val_str1()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return val_str1_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_allocated_val_str1(std::string* val_str1) {
+  if (val_str1 != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  val_str1_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), val_str1,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str1)
+}
+
+// optional string val_str_1 = 2;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_str_1() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_str_1() const {
+  return _internal_has_val_str_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_str_1() {
+  val_str_1_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& TestPrimitiveFieldsWithSameJsonName::val_str_1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str_1)
+  return _internal_val_str_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_str_1(const std::string& value) {
+  _internal_set_val_str_1(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str_1)
+}
+inline std::string* TestPrimitiveFieldsWithSameJsonName::mutable_val_str_1() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str_1)
+  return _internal_mutable_val_str_1();
+}
+inline const std::string& TestPrimitiveFieldsWithSameJsonName::_internal_val_str_1() const {
+  return val_str_1_.Get();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_str_1(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  val_str_1_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_str_1(std::string&& value) {
+  _has_bits_[0] |= 0x00000002u;
+  val_str_1_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str_1)
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_str_1(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000002u;
+  val_str_1_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str_1)
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_str_1(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000002u;
+  val_str_1_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str_1)
+}
+inline std::string* TestPrimitiveFieldsWithSameJsonName::_internal_mutable_val_str_1() {
+  _has_bits_[0] |= 0x00000002u;
+  return val_str_1_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* TestPrimitiveFieldsWithSameJsonName::release_val_str_1() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str_1)
+  if (!_internal_has_val_str_1()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  return val_str_1_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_allocated_val_str_1(std::string* val_str_1) {
+  if (val_str_1 != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  val_str_1_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), val_str_1,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_str_1)
+}
+
+// optional int32 val_int321 = 3;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_int321() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_int321() const {
+  return _internal_has_val_int321();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_int321() {
+  val_int321_ = 0;
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestPrimitiveFieldsWithSameJsonName::_internal_val_int321() const {
+  return val_int321_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestPrimitiveFieldsWithSameJsonName::val_int321() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_int321)
+  return _internal_val_int321();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_int321(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000004u;
+  val_int321_ = value;
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_int321(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_val_int321(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_int321)
+}
+
+// optional int32 val_int32_1 = 4;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_int32_1() const {
+  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_int32_1() const {
+  return _internal_has_val_int32_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_int32_1() {
+  val_int32_1_ = 0;
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestPrimitiveFieldsWithSameJsonName::_internal_val_int32_1() const {
+  return val_int32_1_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TestPrimitiveFieldsWithSameJsonName::val_int32_1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_int32_1)
+  return _internal_val_int32_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_int32_1(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000008u;
+  val_int32_1_ = value;
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_int32_1(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_val_int32_1(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_int32_1)
+}
+
+// optional uint32 val_uint321 = 5;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_uint321() const {
+  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_uint321() const {
+  return _internal_has_val_uint321();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_uint321() {
+  val_uint321_ = 0u;
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestPrimitiveFieldsWithSameJsonName::_internal_val_uint321() const {
+  return val_uint321_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestPrimitiveFieldsWithSameJsonName::val_uint321() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_uint321)
+  return _internal_val_uint321();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_uint321(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _has_bits_[0] |= 0x00000010u;
+  val_uint321_ = value;
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_uint321(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_val_uint321(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_uint321)
+}
+
+// optional uint32 val_uint32_1 = 6;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_uint32_1() const {
+  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_uint32_1() const {
+  return _internal_has_val_uint32_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_uint32_1() {
+  val_uint32_1_ = 0u;
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestPrimitiveFieldsWithSameJsonName::_internal_val_uint32_1() const {
+  return val_uint32_1_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TestPrimitiveFieldsWithSameJsonName::val_uint32_1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_uint32_1)
+  return _internal_val_uint32_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_uint32_1(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _has_bits_[0] |= 0x00000020u;
+  val_uint32_1_ = value;
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_uint32_1(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_val_uint32_1(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_uint32_1)
+}
+
+// optional int64 val_int641 = 7;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_int641() const {
+  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_int641() const {
+  return _internal_has_val_int641();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_int641() {
+  val_int641_ = PROTOBUF_LONGLONG(0);
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestPrimitiveFieldsWithSameJsonName::_internal_val_int641() const {
+  return val_int641_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestPrimitiveFieldsWithSameJsonName::val_int641() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_int641)
+  return _internal_val_int641();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_int641(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _has_bits_[0] |= 0x00000040u;
+  val_int641_ = value;
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_int641(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_set_val_int641(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_int641)
+}
+
+// optional int64 val_int64_1 = 8;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_int64_1() const {
+  bool value = (_has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_int64_1() const {
+  return _internal_has_val_int64_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_int64_1() {
+  val_int64_1_ = PROTOBUF_LONGLONG(0);
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestPrimitiveFieldsWithSameJsonName::_internal_val_int64_1() const {
+  return val_int64_1_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TestPrimitiveFieldsWithSameJsonName::val_int64_1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_int64_1)
+  return _internal_val_int64_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_int64_1(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _has_bits_[0] |= 0x00000080u;
+  val_int64_1_ = value;
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_int64_1(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_set_val_int64_1(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_int64_1)
+}
+
+// optional uint64 val_uint641 = 9;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_uint641() const {
+  bool value = (_has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_uint641() const {
+  return _internal_has_val_uint641();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_uint641() {
+  val_uint641_ = PROTOBUF_ULONGLONG(0);
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestPrimitiveFieldsWithSameJsonName::_internal_val_uint641() const {
+  return val_uint641_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestPrimitiveFieldsWithSameJsonName::val_uint641() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_uint641)
+  return _internal_val_uint641();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_uint641(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _has_bits_[0] |= 0x00000100u;
+  val_uint641_ = value;
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_uint641(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_val_uint641(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_uint641)
+}
+
+// optional uint64 val_uint64_1 = 10;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_uint64_1() const {
+  bool value = (_has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_uint64_1() const {
+  return _internal_has_val_uint64_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_uint64_1() {
+  val_uint64_1_ = PROTOBUF_ULONGLONG(0);
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestPrimitiveFieldsWithSameJsonName::_internal_val_uint64_1() const {
+  return val_uint64_1_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TestPrimitiveFieldsWithSameJsonName::val_uint64_1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_uint64_1)
+  return _internal_val_uint64_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_uint64_1(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _has_bits_[0] |= 0x00000200u;
+  val_uint64_1_ = value;
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_uint64_1(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_val_uint64_1(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_uint64_1)
+}
+
+// optional bool val_bool1 = 11;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_bool1() const {
+  bool value = (_has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_bool1() const {
+  return _internal_has_val_bool1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_bool1() {
+  val_bool1_ = false;
+  _has_bits_[0] &= ~0x00000400u;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_val_bool1() const {
+  return val_bool1_;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::val_bool1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_bool1)
+  return _internal_val_bool1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_bool1(bool value) {
+  _has_bits_[0] |= 0x00000400u;
+  val_bool1_ = value;
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_bool1(bool value) {
+  _internal_set_val_bool1(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_bool1)
+}
+
+// optional bool val_bool_1 = 12;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_bool_1() const {
+  bool value = (_has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_bool_1() const {
+  return _internal_has_val_bool_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_bool_1() {
+  val_bool_1_ = false;
+  _has_bits_[0] &= ~0x00000800u;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_val_bool_1() const {
+  return val_bool_1_;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::val_bool_1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_bool_1)
+  return _internal_val_bool_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_bool_1(bool value) {
+  _has_bits_[0] |= 0x00000800u;
+  val_bool_1_ = value;
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_bool_1(bool value) {
+  _internal_set_val_bool_1(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_bool_1)
+}
+
+// optional double val_double1 = 13;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_double1() const {
+  bool value = (_has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_double1() const {
+  return _internal_has_val_double1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_double1() {
+  val_double1_ = 0;
+  _has_bits_[0] &= ~0x00002000u;
+}
+inline double TestPrimitiveFieldsWithSameJsonName::_internal_val_double1() const {
+  return val_double1_;
+}
+inline double TestPrimitiveFieldsWithSameJsonName::val_double1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_double1)
+  return _internal_val_double1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_double1(double value) {
+  _has_bits_[0] |= 0x00002000u;
+  val_double1_ = value;
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_double1(double value) {
+  _internal_set_val_double1(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_double1)
+}
+
+// optional double val_double_1 = 14;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_double_1() const {
+  bool value = (_has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_double_1() const {
+  return _internal_has_val_double_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_double_1() {
+  val_double_1_ = 0;
+  _has_bits_[0] &= ~0x00004000u;
+}
+inline double TestPrimitiveFieldsWithSameJsonName::_internal_val_double_1() const {
+  return val_double_1_;
+}
+inline double TestPrimitiveFieldsWithSameJsonName::val_double_1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_double_1)
+  return _internal_val_double_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_double_1(double value) {
+  _has_bits_[0] |= 0x00004000u;
+  val_double_1_ = value;
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_double_1(double value) {
+  _internal_set_val_double_1(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_double_1)
+}
+
+// optional float val_float1 = 15;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_float1() const {
+  bool value = (_has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_float1() const {
+  return _internal_has_val_float1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_float1() {
+  val_float1_ = 0;
+  _has_bits_[0] &= ~0x00001000u;
+}
+inline float TestPrimitiveFieldsWithSameJsonName::_internal_val_float1() const {
+  return val_float1_;
+}
+inline float TestPrimitiveFieldsWithSameJsonName::val_float1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_float1)
+  return _internal_val_float1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_float1(float value) {
+  _has_bits_[0] |= 0x00001000u;
+  val_float1_ = value;
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_float1(float value) {
+  _internal_set_val_float1(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_float1)
+}
+
+// optional float val_float_1 = 16;
+inline bool TestPrimitiveFieldsWithSameJsonName::_internal_has_val_float_1() const {
+  bool value = (_has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool TestPrimitiveFieldsWithSameJsonName::has_val_float_1() const {
+  return _internal_has_val_float_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::clear_val_float_1() {
+  val_float_1_ = 0;
+  _has_bits_[0] &= ~0x00008000u;
+}
+inline float TestPrimitiveFieldsWithSameJsonName::_internal_val_float_1() const {
+  return val_float_1_;
+}
+inline float TestPrimitiveFieldsWithSameJsonName::val_float_1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_float_1)
+  return _internal_val_float_1();
+}
+inline void TestPrimitiveFieldsWithSameJsonName::_internal_set_val_float_1(float value) {
+  _has_bits_[0] |= 0x00008000u;
+  val_float_1_ = value;
+}
+inline void TestPrimitiveFieldsWithSameJsonName::set_val_float_1(float value) {
+  _internal_set_val_float_1(value);
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestPrimitiveFieldsWithSameJsonName.val_float_1)
+}
+
+// -------------------------------------------------------------------
+
+// TestRepeatedFieldsWithSameJsonName
+
+// repeated string rep_str1 = 1;
+inline int TestRepeatedFieldsWithSameJsonName::_internal_rep_str1_size() const {
+  return rep_str1_.size();
+}
+inline int TestRepeatedFieldsWithSameJsonName::rep_str1_size() const {
+  return _internal_rep_str1_size();
+}
+inline void TestRepeatedFieldsWithSameJsonName::clear_rep_str1() {
+  rep_str1_.Clear();
+}
+inline std::string* TestRepeatedFieldsWithSameJsonName::add_rep_str1() {
+  // @@protoc_insertion_point(field_add_mutable:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str1)
+  return _internal_add_rep_str1();
+}
+inline const std::string& TestRepeatedFieldsWithSameJsonName::_internal_rep_str1(int index) const {
+  return rep_str1_.Get(index);
+}
+inline const std::string& TestRepeatedFieldsWithSameJsonName::rep_str1(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str1)
+  return _internal_rep_str1(index);
+}
+inline std::string* TestRepeatedFieldsWithSameJsonName::mutable_rep_str1(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str1)
+  return rep_str1_.Mutable(index);
+}
+inline void TestRepeatedFieldsWithSameJsonName::set_rep_str1(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str1)
+  rep_str1_.Mutable(index)->assign(value);
+}
+inline void TestRepeatedFieldsWithSameJsonName::set_rep_str1(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str1)
+  rep_str1_.Mutable(index)->assign(std::move(value));
+}
+inline void TestRepeatedFieldsWithSameJsonName::set_rep_str1(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  rep_str1_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str1)
+}
+inline void TestRepeatedFieldsWithSameJsonName::set_rep_str1(int index, const char* value, size_t size) {
+  rep_str1_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str1)
+}
+inline std::string* TestRepeatedFieldsWithSameJsonName::_internal_add_rep_str1() {
+  return rep_str1_.Add();
+}
+inline void TestRepeatedFieldsWithSameJsonName::add_rep_str1(const std::string& value) {
+  rep_str1_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str1)
+}
+inline void TestRepeatedFieldsWithSameJsonName::add_rep_str1(std::string&& value) {
+  rep_str1_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str1)
+}
+inline void TestRepeatedFieldsWithSameJsonName::add_rep_str1(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  rep_str1_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str1)
+}
+inline void TestRepeatedFieldsWithSameJsonName::add_rep_str1(const char* value, size_t size) {
+  rep_str1_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str1)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TestRepeatedFieldsWithSameJsonName::rep_str1() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str1)
+  return rep_str1_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TestRepeatedFieldsWithSameJsonName::mutable_rep_str1() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str1)
+  return &rep_str1_;
+}
+
+// repeated string rep_str_1 = 2;
+inline int TestRepeatedFieldsWithSameJsonName::_internal_rep_str_1_size() const {
+  return rep_str_1_.size();
+}
+inline int TestRepeatedFieldsWithSameJsonName::rep_str_1_size() const {
+  return _internal_rep_str_1_size();
+}
+inline void TestRepeatedFieldsWithSameJsonName::clear_rep_str_1() {
+  rep_str_1_.Clear();
+}
+inline std::string* TestRepeatedFieldsWithSameJsonName::add_rep_str_1() {
+  // @@protoc_insertion_point(field_add_mutable:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str_1)
+  return _internal_add_rep_str_1();
+}
+inline const std::string& TestRepeatedFieldsWithSameJsonName::_internal_rep_str_1(int index) const {
+  return rep_str_1_.Get(index);
+}
+inline const std::string& TestRepeatedFieldsWithSameJsonName::rep_str_1(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str_1)
+  return _internal_rep_str_1(index);
+}
+inline std::string* TestRepeatedFieldsWithSameJsonName::mutable_rep_str_1(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str_1)
+  return rep_str_1_.Mutable(index);
+}
+inline void TestRepeatedFieldsWithSameJsonName::set_rep_str_1(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str_1)
+  rep_str_1_.Mutable(index)->assign(value);
+}
+inline void TestRepeatedFieldsWithSameJsonName::set_rep_str_1(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str_1)
+  rep_str_1_.Mutable(index)->assign(std::move(value));
+}
+inline void TestRepeatedFieldsWithSameJsonName::set_rep_str_1(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  rep_str_1_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str_1)
+}
+inline void TestRepeatedFieldsWithSameJsonName::set_rep_str_1(int index, const char* value, size_t size) {
+  rep_str_1_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str_1)
+}
+inline std::string* TestRepeatedFieldsWithSameJsonName::_internal_add_rep_str_1() {
+  return rep_str_1_.Add();
+}
+inline void TestRepeatedFieldsWithSameJsonName::add_rep_str_1(const std::string& value) {
+  rep_str_1_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str_1)
+}
+inline void TestRepeatedFieldsWithSameJsonName::add_rep_str_1(std::string&& value) {
+  rep_str_1_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str_1)
+}
+inline void TestRepeatedFieldsWithSameJsonName::add_rep_str_1(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  rep_str_1_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str_1)
+}
+inline void TestRepeatedFieldsWithSameJsonName::add_rep_str_1(const char* value, size_t size) {
+  rep_str_1_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str_1)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TestRepeatedFieldsWithSameJsonName::rep_str_1() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str_1)
+  return rep_str_1_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TestRepeatedFieldsWithSameJsonName::mutable_rep_str_1() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.TestRepeatedFieldsWithSameJsonName.rep_str_1)
+  return &rep_str_1_;
+}
+
+// -------------------------------------------------------------------
+
+// TestMessageFieldsWithSameJsonName
+
+// optional .proto_util_converter.testing.Primitive prim1 = 1;
+inline bool TestMessageFieldsWithSameJsonName::_internal_has_prim1() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || prim1_ != nullptr);
+  return value;
+}
+inline bool TestMessageFieldsWithSameJsonName::has_prim1() const {
+  return _internal_has_prim1();
+}
+inline void TestMessageFieldsWithSameJsonName::clear_prim1() {
+  if (prim1_ != nullptr) prim1_->Clear();
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const ::proto_util_converter::testing::Primitive& TestMessageFieldsWithSameJsonName::_internal_prim1() const {
+  const ::proto_util_converter::testing::Primitive* p = prim1_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Primitive*>(
+      &::proto_util_converter::testing::_Primitive_default_instance_);
+}
+inline const ::proto_util_converter::testing::Primitive& TestMessageFieldsWithSameJsonName::prim1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestMessageFieldsWithSameJsonName.prim1)
+  return _internal_prim1();
+}
+inline void TestMessageFieldsWithSameJsonName::unsafe_arena_set_allocated_prim1(
+    ::proto_util_converter::testing::Primitive* prim1) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(prim1_);
+  }
+  prim1_ = prim1;
+  if (prim1) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TestMessageFieldsWithSameJsonName.prim1)
+}
+inline ::proto_util_converter::testing::Primitive* TestMessageFieldsWithSameJsonName::release_prim1() {
+  _has_bits_[0] &= ~0x00000001u;
+  ::proto_util_converter::testing::Primitive* temp = prim1_;
+  prim1_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::Primitive* TestMessageFieldsWithSameJsonName::unsafe_arena_release_prim1() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TestMessageFieldsWithSameJsonName.prim1)
+  _has_bits_[0] &= ~0x00000001u;
+  ::proto_util_converter::testing::Primitive* temp = prim1_;
+  prim1_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Primitive* TestMessageFieldsWithSameJsonName::_internal_mutable_prim1() {
+  _has_bits_[0] |= 0x00000001u;
+  if (prim1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Primitive>(GetArena());
+    prim1_ = p;
+  }
+  return prim1_;
+}
+inline ::proto_util_converter::testing::Primitive* TestMessageFieldsWithSameJsonName::mutable_prim1() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TestMessageFieldsWithSameJsonName.prim1)
+  return _internal_mutable_prim1();
+}
+inline void TestMessageFieldsWithSameJsonName::set_allocated_prim1(::proto_util_converter::testing::Primitive* prim1) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete prim1_;
+  }
+  if (prim1) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(prim1);
+    if (message_arena != submessage_arena) {
+      prim1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, prim1, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  prim1_ = prim1;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TestMessageFieldsWithSameJsonName.prim1)
+}
+
+// optional .proto_util_converter.testing.Primitive prim_1 = 2;
+inline bool TestMessageFieldsWithSameJsonName::_internal_has_prim_1() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || prim_1_ != nullptr);
+  return value;
+}
+inline bool TestMessageFieldsWithSameJsonName::has_prim_1() const {
+  return _internal_has_prim_1();
+}
+inline void TestMessageFieldsWithSameJsonName::clear_prim_1() {
+  if (prim_1_ != nullptr) prim_1_->Clear();
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const ::proto_util_converter::testing::Primitive& TestMessageFieldsWithSameJsonName::_internal_prim_1() const {
+  const ::proto_util_converter::testing::Primitive* p = prim_1_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::Primitive*>(
+      &::proto_util_converter::testing::_Primitive_default_instance_);
+}
+inline const ::proto_util_converter::testing::Primitive& TestMessageFieldsWithSameJsonName::prim_1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TestMessageFieldsWithSameJsonName.prim_1)
+  return _internal_prim_1();
+}
+inline void TestMessageFieldsWithSameJsonName::unsafe_arena_set_allocated_prim_1(
+    ::proto_util_converter::testing::Primitive* prim_1) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(prim_1_);
+  }
+  prim_1_ = prim_1;
+  if (prim_1) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TestMessageFieldsWithSameJsonName.prim_1)
+}
+inline ::proto_util_converter::testing::Primitive* TestMessageFieldsWithSameJsonName::release_prim_1() {
+  _has_bits_[0] &= ~0x00000002u;
+  ::proto_util_converter::testing::Primitive* temp = prim_1_;
+  prim_1_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::Primitive* TestMessageFieldsWithSameJsonName::unsafe_arena_release_prim_1() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TestMessageFieldsWithSameJsonName.prim_1)
+  _has_bits_[0] &= ~0x00000002u;
+  ::proto_util_converter::testing::Primitive* temp = prim_1_;
+  prim_1_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::Primitive* TestMessageFieldsWithSameJsonName::_internal_mutable_prim_1() {
+  _has_bits_[0] |= 0x00000002u;
+  if (prim_1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::Primitive>(GetArena());
+    prim_1_ = p;
+  }
+  return prim_1_;
+}
+inline ::proto_util_converter::testing::Primitive* TestMessageFieldsWithSameJsonName::mutable_prim_1() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TestMessageFieldsWithSameJsonName.prim_1)
+  return _internal_mutable_prim_1();
+}
+inline void TestMessageFieldsWithSameJsonName::set_allocated_prim_1(::proto_util_converter::testing::Primitive* prim_1) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete prim_1_;
+  }
+  if (prim_1) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(prim_1);
+    if (message_arena != submessage_arena) {
+      prim_1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, prim_1, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  prim_1_ = prim_1;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TestMessageFieldsWithSameJsonName.prim_1)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace testing
+}  // namespace proto_util_converter
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::proto_util_converter::testing::Book_Type> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::proto_util_converter::testing::Book_Type>() {
+  return ::proto_util_converter::testing::Book_Type_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2fbooks_2eproto
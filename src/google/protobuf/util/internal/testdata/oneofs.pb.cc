@@ -0,0 +1,2072 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/internal/testdata/oneofs.proto
+
+#include "google/protobuf/util/internal/testdata/oneofs.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fany_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Any_google_2fprotobuf_2fany_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2ftimestamp_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_MoreData_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto;
+namespace proto_util_converter {
+namespace testing {
+namespace oneofs {
+class OneOfsRequestDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<OneOfsRequest> _instance;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr str_data_;
+  ::PROTOBUF_NAMESPACE_ID::int32 int_data_;
+  const ::proto_util_converter::testing::oneofs::Data* message_data_;
+  const ::proto_util_converter::testing::oneofs::MoreData* more_data_;
+  const PROTOBUF_NAMESPACE_ID::Struct* struct_data_;
+  const PROTOBUF_NAMESPACE_ID::Value* value_data_;
+  const PROTOBUF_NAMESPACE_ID::ListValue* list_value_data_;
+  const PROTOBUF_NAMESPACE_ID::Timestamp* ts_data_;
+} _OneOfsRequest_default_instance_;
+class RequestWithSimpleOneofDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RequestWithSimpleOneof> _instance;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr str_data_;
+  ::PROTOBUF_NAMESPACE_ID::int32 int_data_;
+  const ::proto_util_converter::testing::oneofs::Data* message_data_;
+  const ::proto_util_converter::testing::oneofs::MoreData* more_data_;
+} _RequestWithSimpleOneof_default_instance_;
+class DataDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Data> _instance;
+} _Data_default_instance_;
+class MoreDataDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MoreData> _instance;
+} _MoreData_default_instance_;
+class ResponseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Response> _instance;
+} _Response_default_instance_;
+}  // namespace oneofs
+}  // namespace testing
+}  // namespace proto_util_converter
+static void InitDefaultsscc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::oneofs::_Data_default_instance_;
+    new (ptr) ::proto_util_converter::testing::oneofs::Data();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::oneofs::Data::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto}, {}};
+
+static void InitDefaultsscc_info_MoreData_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::oneofs::_MoreData_default_instance_;
+    new (ptr) ::proto_util_converter::testing::oneofs::MoreData();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::oneofs::MoreData::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_MoreData_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_MoreData_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto}, {}};
+
+static void InitDefaultsscc_info_OneOfsRequest_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::oneofs::_OneOfsRequest_default_instance_;
+    new (ptr) ::proto_util_converter::testing::oneofs::OneOfsRequest();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::oneofs::OneOfsRequest::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_OneOfsRequest_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 5, 0, InitDefaultsscc_info_OneOfsRequest_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto}, {
+      &scc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base,
+      &scc_info_MoreData_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base,
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,
+      &scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto.base,
+      &scc_info_Any_google_2fprotobuf_2fany_2eproto.base,}};
+
+static void InitDefaultsscc_info_RequestWithSimpleOneof_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::oneofs::_RequestWithSimpleOneof_default_instance_;
+    new (ptr) ::proto_util_converter::testing::oneofs::RequestWithSimpleOneof();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::oneofs::RequestWithSimpleOneof::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_RequestWithSimpleOneof_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_RequestWithSimpleOneof_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto}, {
+      &scc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base,
+      &scc_info_MoreData_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base,}};
+
+static void InitDefaultsscc_info_Response_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::oneofs::_Response_default_instance_;
+    new (ptr) ::proto_util_converter::testing::oneofs::Response();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::oneofs::Response::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Response_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Response_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto}, {}};
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto[5];
+static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto = nullptr;
+
+const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::oneofs::OneOfsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::oneofs::OneOfsRequest, _oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::oneofs::OneOfsRequest, value_),
+  offsetof(::proto_util_converter::testing::oneofs::OneOfsRequestDefaultTypeInternal, str_data_),
+  offsetof(::proto_util_converter::testing::oneofs::OneOfsRequestDefaultTypeInternal, int_data_),
+  offsetof(::proto_util_converter::testing::oneofs::OneOfsRequestDefaultTypeInternal, message_data_),
+  offsetof(::proto_util_converter::testing::oneofs::OneOfsRequestDefaultTypeInternal, more_data_),
+  offsetof(::proto_util_converter::testing::oneofs::OneOfsRequestDefaultTypeInternal, struct_data_),
+  offsetof(::proto_util_converter::testing::oneofs::OneOfsRequestDefaultTypeInternal, value_data_),
+  offsetof(::proto_util_converter::testing::oneofs::OneOfsRequestDefaultTypeInternal, list_value_data_),
+  offsetof(::proto_util_converter::testing::oneofs::OneOfsRequestDefaultTypeInternal, ts_data_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::oneofs::OneOfsRequest, any_data_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::oneofs::OneOfsRequest, data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::oneofs::RequestWithSimpleOneof, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::oneofs::RequestWithSimpleOneof, _oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::oneofs::RequestWithSimpleOneof, value_),
+  offsetof(::proto_util_converter::testing::oneofs::RequestWithSimpleOneofDefaultTypeInternal, str_data_),
+  offsetof(::proto_util_converter::testing::oneofs::RequestWithSimpleOneofDefaultTypeInternal, int_data_),
+  offsetof(::proto_util_converter::testing::oneofs::RequestWithSimpleOneofDefaultTypeInternal, message_data_),
+  offsetof(::proto_util_converter::testing::oneofs::RequestWithSimpleOneofDefaultTypeInternal, more_data_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::oneofs::RequestWithSimpleOneof, data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::oneofs::Data, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::oneofs::Data, data_value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::oneofs::MoreData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::oneofs::MoreData, str_value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::oneofs::Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::oneofs::Response, value_),
+};
+static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, sizeof(::proto_util_converter::testing::oneofs::OneOfsRequest)},
+  { 16, -1, sizeof(::proto_util_converter::testing::oneofs::RequestWithSimpleOneof)},
+  { 27, -1, sizeof(::proto_util_converter::testing::oneofs::Data)},
+  { 33, -1, sizeof(::proto_util_converter::testing::oneofs::MoreData)},
+  { 39, -1, sizeof(::proto_util_converter::testing::oneofs::Response)},
+};
+
+static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::oneofs::_OneOfsRequest_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::oneofs::_RequestWithSimpleOneof_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::oneofs::_Data_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::oneofs::_MoreData_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::oneofs::_Response_default_instance_),
+};
+
+const char descriptor_table_protodef_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n3google/protobuf/util/internal/testdata"
+  "/oneofs.proto\022#proto_util_converter.test"
+  "ing.oneofs\032\031google/protobuf/any.proto\032\034g"
+  "oogle/protobuf/struct.proto\032\037google/prot"
+  "obuf/timestamp.proto\"\301\003\n\rOneOfsRequest\022\r"
+  "\n\005value\030\001 \001(\t\022\022\n\010str_data\030\002 \001(\tH\000\022\022\n\010int"
+  "_data\030\003 \001(\005H\000\022A\n\014message_data\030\004 \001(\0132).pr"
+  "oto_util_converter.testing.oneofs.DataH\000"
+  "\022B\n\tmore_data\030\005 \001(\0132-.proto_util_convert"
+  "er.testing.oneofs.MoreDataH\000\022.\n\013struct_d"
+  "ata\030\006 \001(\0132\027.google.protobuf.StructH\000\022,\n\n"
+  "value_data\030\007 \001(\0132\026.google.protobuf.Value"
+  "H\000\0225\n\017list_value_data\030\010 \001(\0132\032.google.pro"
+  "tobuf.ListValueH\000\022-\n\007ts_data\030\t \001(\0132\032.goo"
+  "gle.protobuf.TimestampH\000\022&\n\010any_data\030\023 \001"
+  "(\0132\024.google.protobuf.AnyB\006\n\004data\"\336\001\n\026Req"
+  "uestWithSimpleOneof\022\r\n\005value\030\001 \001(\t\022\022\n\010st"
+  "r_data\030\002 \001(\tH\000\022\022\n\010int_data\030\003 \001(\005H\000\022A\n\014me"
+  "ssage_data\030\004 \001(\0132).proto_util_converter."
+  "testing.oneofs.DataH\000\022B\n\tmore_data\030\005 \001(\013"
+  "2-.proto_util_converter.testing.oneofs.M"
+  "oreDataH\000B\006\n\004data\"\032\n\004Data\022\022\n\ndata_value\030"
+  "\001 \001(\005\"\035\n\010MoreData\022\021\n\tstr_value\030\001 \001(\t\"\031\n\010"
+  "Response\022\r\n\005value\030\001 \001(\tb\006proto3"
+  ;
+static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto_deps[3] = {
+  &::descriptor_table_google_2fprotobuf_2fany_2eproto,
+  &::descriptor_table_google_2fprotobuf_2fstruct_2eproto,
+  &::descriptor_table_google_2fprotobuf_2ftimestamp_2eproto,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto_sccs[5] = {
+  &scc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base,
+  &scc_info_MoreData_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base,
+  &scc_info_OneOfsRequest_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base,
+  &scc_info_RequestWithSimpleOneof_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base,
+  &scc_info_Response_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto_once;
+const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto = {
+  false, false, descriptor_table_protodef_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto, "google/protobuf/util/internal/testdata/oneofs.proto", 951,
+  &descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto_once, descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto_sccs, descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto_deps, 5, 3,
+  schemas, file_default_instances, TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto::offsets,
+  file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto, 5, file_level_enum_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto, file_level_service_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto,
+};
+
+// Force running AddDescriptors() at dynamic initialization time.
+static bool dynamic_init_dummy_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto)), true);
+namespace proto_util_converter {
+namespace testing {
+namespace oneofs {
+
+// ===================================================================
+
+void OneOfsRequest::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::oneofs::_OneOfsRequest_default_instance_.str_data_.UnsafeSetDefault(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::proto_util_converter::testing::oneofs::_OneOfsRequest_default_instance_.int_data_ = 0;
+  ::proto_util_converter::testing::oneofs::_OneOfsRequest_default_instance_.message_data_ = const_cast< ::proto_util_converter::testing::oneofs::Data*>(
+      ::proto_util_converter::testing::oneofs::Data::internal_default_instance());
+  ::proto_util_converter::testing::oneofs::_OneOfsRequest_default_instance_.more_data_ = const_cast< ::proto_util_converter::testing::oneofs::MoreData*>(
+      ::proto_util_converter::testing::oneofs::MoreData::internal_default_instance());
+  ::proto_util_converter::testing::oneofs::_OneOfsRequest_default_instance_.struct_data_ = const_cast< PROTOBUF_NAMESPACE_ID::Struct*>(
+      PROTOBUF_NAMESPACE_ID::Struct::internal_default_instance());
+  ::proto_util_converter::testing::oneofs::_OneOfsRequest_default_instance_.value_data_ = const_cast< PROTOBUF_NAMESPACE_ID::Value*>(
+      PROTOBUF_NAMESPACE_ID::Value::internal_default_instance());
+  ::proto_util_converter::testing::oneofs::_OneOfsRequest_default_instance_.list_value_data_ = const_cast< PROTOBUF_NAMESPACE_ID::ListValue*>(
+      PROTOBUF_NAMESPACE_ID::ListValue::internal_default_instance());
+  ::proto_util_converter::testing::oneofs::_OneOfsRequest_default_instance_.ts_data_ = const_cast< PROTOBUF_NAMESPACE_ID::Timestamp*>(
+      PROTOBUF_NAMESPACE_ID::Timestamp::internal_default_instance());
+  ::proto_util_converter::testing::oneofs::_OneOfsRequest_default_instance_._instance.get_mutable()->any_data_ = const_cast< PROTOBUF_NAMESPACE_ID::Any*>(
+      PROTOBUF_NAMESPACE_ID::Any::internal_default_instance());
+}
+class OneOfsRequest::_Internal {
+ public:
+  static const ::proto_util_converter::testing::oneofs::Data& message_data(const OneOfsRequest* msg);
+  static const ::proto_util_converter::testing::oneofs::MoreData& more_data(const OneOfsRequest* msg);
+  static const PROTOBUF_NAMESPACE_ID::Struct& struct_data(const OneOfsRequest* msg);
+  static const PROTOBUF_NAMESPACE_ID::Value& value_data(const OneOfsRequest* msg);
+  static const PROTOBUF_NAMESPACE_ID::ListValue& list_value_data(const OneOfsRequest* msg);
+  static const PROTOBUF_NAMESPACE_ID::Timestamp& ts_data(const OneOfsRequest* msg);
+  static const PROTOBUF_NAMESPACE_ID::Any& any_data(const OneOfsRequest* msg);
+};
+
+const ::proto_util_converter::testing::oneofs::Data&
+OneOfsRequest::_Internal::message_data(const OneOfsRequest* msg) {
+  return *msg->data_.message_data_;
+}
+const ::proto_util_converter::testing::oneofs::MoreData&
+OneOfsRequest::_Internal::more_data(const OneOfsRequest* msg) {
+  return *msg->data_.more_data_;
+}
+const PROTOBUF_NAMESPACE_ID::Struct&
+OneOfsRequest::_Internal::struct_data(const OneOfsRequest* msg) {
+  return *msg->data_.struct_data_;
+}
+const PROTOBUF_NAMESPACE_ID::Value&
+OneOfsRequest::_Internal::value_data(const OneOfsRequest* msg) {
+  return *msg->data_.value_data_;
+}
+const PROTOBUF_NAMESPACE_ID::ListValue&
+OneOfsRequest::_Internal::list_value_data(const OneOfsRequest* msg) {
+  return *msg->data_.list_value_data_;
+}
+const PROTOBUF_NAMESPACE_ID::Timestamp&
+OneOfsRequest::_Internal::ts_data(const OneOfsRequest* msg) {
+  return *msg->data_.ts_data_;
+}
+const PROTOBUF_NAMESPACE_ID::Any&
+OneOfsRequest::_Internal::any_data(const OneOfsRequest* msg) {
+  return *msg->any_data_;
+}
+void OneOfsRequest::set_allocated_message_data(::proto_util_converter::testing::oneofs::Data* message_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_data();
+  if (message_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(message_data);
+    if (message_arena != submessage_arena) {
+      message_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message_data, submessage_arena);
+    }
+    set_has_message_data();
+    data_.message_data_ = message_data;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.oneofs.OneOfsRequest.message_data)
+}
+void OneOfsRequest::set_allocated_more_data(::proto_util_converter::testing::oneofs::MoreData* more_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_data();
+  if (more_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(more_data);
+    if (message_arena != submessage_arena) {
+      more_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, more_data, submessage_arena);
+    }
+    set_has_more_data();
+    data_.more_data_ = more_data;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.oneofs.OneOfsRequest.more_data)
+}
+void OneOfsRequest::set_allocated_struct_data(PROTOBUF_NAMESPACE_ID::Struct* struct_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_data();
+  if (struct_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(struct_data)->GetArena();
+    if (message_arena != submessage_arena) {
+      struct_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, struct_data, submessage_arena);
+    }
+    set_has_struct_data();
+    data_.struct_data_ = struct_data;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.oneofs.OneOfsRequest.struct_data)
+}
+void OneOfsRequest::clear_struct_data() {
+  if (_internal_has_struct_data()) {
+    if (GetArena() == nullptr) {
+      delete data_.struct_data_;
+    }
+    clear_has_data();
+  }
+}
+void OneOfsRequest::set_allocated_value_data(PROTOBUF_NAMESPACE_ID::Value* value_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_data();
+  if (value_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(value_data)->GetArena();
+    if (message_arena != submessage_arena) {
+      value_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, value_data, submessage_arena);
+    }
+    set_has_value_data();
+    data_.value_data_ = value_data;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.oneofs.OneOfsRequest.value_data)
+}
+void OneOfsRequest::clear_value_data() {
+  if (_internal_has_value_data()) {
+    if (GetArena() == nullptr) {
+      delete data_.value_data_;
+    }
+    clear_has_data();
+  }
+}
+void OneOfsRequest::set_allocated_list_value_data(PROTOBUF_NAMESPACE_ID::ListValue* list_value_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_data();
+  if (list_value_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(list_value_data)->GetArena();
+    if (message_arena != submessage_arena) {
+      list_value_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, list_value_data, submessage_arena);
+    }
+    set_has_list_value_data();
+    data_.list_value_data_ = list_value_data;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.oneofs.OneOfsRequest.list_value_data)
+}
+void OneOfsRequest::clear_list_value_data() {
+  if (_internal_has_list_value_data()) {
+    if (GetArena() == nullptr) {
+      delete data_.list_value_data_;
+    }
+    clear_has_data();
+  }
+}
+void OneOfsRequest::set_allocated_ts_data(PROTOBUF_NAMESPACE_ID::Timestamp* ts_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_data();
+  if (ts_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(ts_data)->GetArena();
+    if (message_arena != submessage_arena) {
+      ts_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ts_data, submessage_arena);
+    }
+    set_has_ts_data();
+    data_.ts_data_ = ts_data;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.oneofs.OneOfsRequest.ts_data)
+}
+void OneOfsRequest::clear_ts_data() {
+  if (_internal_has_ts_data()) {
+    if (GetArena() == nullptr) {
+      delete data_.ts_data_;
+    }
+    clear_has_data();
+  }
+}
+void OneOfsRequest::clear_any_data() {
+  if (GetArena() == nullptr && any_data_ != nullptr) {
+    delete any_data_;
+  }
+  any_data_ = nullptr;
+}
+OneOfsRequest::OneOfsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.oneofs.OneOfsRequest)
+}
+OneOfsRequest::OneOfsRequest(const OneOfsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_value().empty()) {
+    value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_value(),
+      GetArena());
+  }
+  if (from._internal_has_any_data()) {
+    any_data_ = new PROTOBUF_NAMESPACE_ID::Any(*from.any_data_);
+  } else {
+    any_data_ = nullptr;
+  }
+  clear_has_data();
+  switch (from.data_case()) {
+    case kStrData: {
+      _internal_set_str_data(from._internal_str_data());
+      break;
+    }
+    case kIntData: {
+      _internal_set_int_data(from._internal_int_data());
+      break;
+    }
+    case kMessageData: {
+      _internal_mutable_message_data()->::proto_util_converter::testing::oneofs::Data::MergeFrom(from._internal_message_data());
+      break;
+    }
+    case kMoreData: {
+      _internal_mutable_more_data()->::proto_util_converter::testing::oneofs::MoreData::MergeFrom(from._internal_more_data());
+      break;
+    }
+    case kStructData: {
+      _internal_mutable_struct_data()->PROTOBUF_NAMESPACE_ID::Struct::MergeFrom(from._internal_struct_data());
+      break;
+    }
+    case kValueData: {
+      _internal_mutable_value_data()->PROTOBUF_NAMESPACE_ID::Value::MergeFrom(from._internal_value_data());
+      break;
+    }
+    case kListValueData: {
+      _internal_mutable_list_value_data()->PROTOBUF_NAMESPACE_ID::ListValue::MergeFrom(from._internal_list_value_data());
+      break;
+    }
+    case kTsData: {
+      _internal_mutable_ts_data()->PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(from._internal_ts_data());
+      break;
+    }
+    case DATA_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.oneofs.OneOfsRequest)
+}
+
+void OneOfsRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_OneOfsRequest_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base);
+  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  any_data_ = nullptr;
+  clear_has_data();
+}
+
+OneOfsRequest::~OneOfsRequest() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.oneofs.OneOfsRequest)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void OneOfsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete any_data_;
+  if (has_data()) {
+    clear_data();
+  }
+}
+
+void OneOfsRequest::ArenaDtor(void* object) {
+  OneOfsRequest* _this = reinterpret_cast< OneOfsRequest* >(object);
+  (void)_this;
+}
+void OneOfsRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void OneOfsRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const OneOfsRequest& OneOfsRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_OneOfsRequest_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void OneOfsRequest::clear_data() {
+// @@protoc_insertion_point(one_of_clear_start:proto_util_converter.testing.oneofs.OneOfsRequest)
+  switch (data_case()) {
+    case kStrData: {
+      data_.str_data_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+      break;
+    }
+    case kIntData: {
+      // No need to clear
+      break;
+    }
+    case kMessageData: {
+      if (GetArena() == nullptr) {
+        delete data_.message_data_;
+      }
+      break;
+    }
+    case kMoreData: {
+      if (GetArena() == nullptr) {
+        delete data_.more_data_;
+      }
+      break;
+    }
+    case kStructData: {
+      if (GetArena() == nullptr) {
+        delete data_.struct_data_;
+      }
+      break;
+    }
+    case kValueData: {
+      if (GetArena() == nullptr) {
+        delete data_.value_data_;
+      }
+      break;
+    }
+    case kListValueData: {
+      if (GetArena() == nullptr) {
+        delete data_.list_value_data_;
+      }
+      break;
+    }
+    case kTsData: {
+      if (GetArena() == nullptr) {
+        delete data_.ts_data_;
+      }
+      break;
+    }
+    case DATA_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = DATA_NOT_SET;
+}
+
+
+void OneOfsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.oneofs.OneOfsRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (GetArena() == nullptr && any_data_ != nullptr) {
+    delete any_data_;
+  }
+  any_data_ = nullptr;
+  clear_data();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OneOfsRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          const std::string* str = &value_.Get();
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto_util_converter.testing.oneofs.OneOfsRequest.value"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string str_data = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          auto str = _internal_mutable_str_data();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto_util_converter.testing.oneofs.OneOfsRequest.str_data"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int32 int_data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          _internal_set_int_data(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.oneofs.Data message_data = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message_data(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.oneofs.MoreData more_data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_more_data(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Struct struct_data = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_struct_data(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Value value_data = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value_data(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.ListValue list_value_data = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_list_value_data(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Timestamp ts_data = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ts_data(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Any any_data = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_any_data(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* OneOfsRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.oneofs.OneOfsRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string value = 1;
+  if (this->value().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto_util_converter.testing.oneofs.OneOfsRequest.value");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_value(), target);
+  }
+
+  // string str_data = 2;
+  if (_internal_has_str_data()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_str_data().data(), static_cast<int>(this->_internal_str_data().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto_util_converter.testing.oneofs.OneOfsRequest.str_data");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_str_data(), target);
+  }
+
+  // int32 int_data = 3;
+  if (_internal_has_int_data()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_int_data(), target);
+  }
+
+  // .proto_util_converter.testing.oneofs.Data message_data = 4;
+  if (_internal_has_message_data()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::message_data(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.oneofs.MoreData more_data = 5;
+  if (_internal_has_more_data()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        5, _Internal::more_data(this), target, stream);
+  }
+
+  // .google.protobuf.Struct struct_data = 6;
+  if (_internal_has_struct_data()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        6, _Internal::struct_data(this), target, stream);
+  }
+
+  // .google.protobuf.Value value_data = 7;
+  if (_internal_has_value_data()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        7, _Internal::value_data(this), target, stream);
+  }
+
+  // .google.protobuf.ListValue list_value_data = 8;
+  if (_internal_has_list_value_data()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        8, _Internal::list_value_data(this), target, stream);
+  }
+
+  // .google.protobuf.Timestamp ts_data = 9;
+  if (_internal_has_ts_data()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        9, _Internal::ts_data(this), target, stream);
+  }
+
+  // .google.protobuf.Any any_data = 19;
+  if (this->has_any_data()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        19, _Internal::any_data(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.oneofs.OneOfsRequest)
+  return target;
+}
+
+size_t OneOfsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.oneofs.OneOfsRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string value = 1;
+  if (this->value().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  // .google.protobuf.Any any_data = 19;
+  if (this->has_any_data()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *any_data_);
+  }
+
+  switch (data_case()) {
+    // string str_data = 2;
+    case kStrData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_str_data());
+      break;
+    }
+    // int32 int_data = 3;
+    case kIntData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_int_data());
+      break;
+    }
+    // .proto_util_converter.testing.oneofs.Data message_data = 4;
+    case kMessageData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *data_.message_data_);
+      break;
+    }
+    // .proto_util_converter.testing.oneofs.MoreData more_data = 5;
+    case kMoreData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *data_.more_data_);
+      break;
+    }
+    // .google.protobuf.Struct struct_data = 6;
+    case kStructData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *data_.struct_data_);
+      break;
+    }
+    // .google.protobuf.Value value_data = 7;
+    case kValueData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *data_.value_data_);
+      break;
+    }
+    // .google.protobuf.ListValue list_value_data = 8;
+    case kListValueData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *data_.list_value_data_);
+      break;
+    }
+    // .google.protobuf.Timestamp ts_data = 9;
+    case kTsData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *data_.ts_data_);
+      break;
+    }
+    case DATA_NOT_SET: {
+      break;
+    }
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void OneOfsRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.oneofs.OneOfsRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const OneOfsRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<OneOfsRequest>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.oneofs.OneOfsRequest)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.oneofs.OneOfsRequest)
+    MergeFrom(*source);
+  }
+}
+
+void OneOfsRequest::MergeFrom(const OneOfsRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.oneofs.OneOfsRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.value().size() > 0) {
+    _internal_set_value(from._internal_value());
+  }
+  if (from.has_any_data()) {
+    _internal_mutable_any_data()->PROTOBUF_NAMESPACE_ID::Any::MergeFrom(from._internal_any_data());
+  }
+  switch (from.data_case()) {
+    case kStrData: {
+      _internal_set_str_data(from._internal_str_data());
+      break;
+    }
+    case kIntData: {
+      _internal_set_int_data(from._internal_int_data());
+      break;
+    }
+    case kMessageData: {
+      _internal_mutable_message_data()->::proto_util_converter::testing::oneofs::Data::MergeFrom(from._internal_message_data());
+      break;
+    }
+    case kMoreData: {
+      _internal_mutable_more_data()->::proto_util_converter::testing::oneofs::MoreData::MergeFrom(from._internal_more_data());
+      break;
+    }
+    case kStructData: {
+      _internal_mutable_struct_data()->PROTOBUF_NAMESPACE_ID::Struct::MergeFrom(from._internal_struct_data());
+      break;
+    }
+    case kValueData: {
+      _internal_mutable_value_data()->PROTOBUF_NAMESPACE_ID::Value::MergeFrom(from._internal_value_data());
+      break;
+    }
+    case kListValueData: {
+      _internal_mutable_list_value_data()->PROTOBUF_NAMESPACE_ID::ListValue::MergeFrom(from._internal_list_value_data());
+      break;
+    }
+    case kTsData: {
+      _internal_mutable_ts_data()->PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(from._internal_ts_data());
+      break;
+    }
+    case DATA_NOT_SET: {
+      break;
+    }
+  }
+}
+
+void OneOfsRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.oneofs.OneOfsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void OneOfsRequest::CopyFrom(const OneOfsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.oneofs.OneOfsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OneOfsRequest::IsInitialized() const {
+  return true;
+}
+
+void OneOfsRequest::InternalSwap(OneOfsRequest* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  value_.Swap(&other->value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(any_data_, other->any_data_);
+  swap(data_, other->data_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OneOfsRequest::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void RequestWithSimpleOneof::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::oneofs::_RequestWithSimpleOneof_default_instance_.str_data_.UnsafeSetDefault(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::proto_util_converter::testing::oneofs::_RequestWithSimpleOneof_default_instance_.int_data_ = 0;
+  ::proto_util_converter::testing::oneofs::_RequestWithSimpleOneof_default_instance_.message_data_ = const_cast< ::proto_util_converter::testing::oneofs::Data*>(
+      ::proto_util_converter::testing::oneofs::Data::internal_default_instance());
+  ::proto_util_converter::testing::oneofs::_RequestWithSimpleOneof_default_instance_.more_data_ = const_cast< ::proto_util_converter::testing::oneofs::MoreData*>(
+      ::proto_util_converter::testing::oneofs::MoreData::internal_default_instance());
+}
+class RequestWithSimpleOneof::_Internal {
+ public:
+  static const ::proto_util_converter::testing::oneofs::Data& message_data(const RequestWithSimpleOneof* msg);
+  static const ::proto_util_converter::testing::oneofs::MoreData& more_data(const RequestWithSimpleOneof* msg);
+};
+
+const ::proto_util_converter::testing::oneofs::Data&
+RequestWithSimpleOneof::_Internal::message_data(const RequestWithSimpleOneof* msg) {
+  return *msg->data_.message_data_;
+}
+const ::proto_util_converter::testing::oneofs::MoreData&
+RequestWithSimpleOneof::_Internal::more_data(const RequestWithSimpleOneof* msg) {
+  return *msg->data_.more_data_;
+}
+void RequestWithSimpleOneof::set_allocated_message_data(::proto_util_converter::testing::oneofs::Data* message_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_data();
+  if (message_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(message_data);
+    if (message_arena != submessage_arena) {
+      message_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message_data, submessage_arena);
+    }
+    set_has_message_data();
+    data_.message_data_ = message_data;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.oneofs.RequestWithSimpleOneof.message_data)
+}
+void RequestWithSimpleOneof::set_allocated_more_data(::proto_util_converter::testing::oneofs::MoreData* more_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_data();
+  if (more_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(more_data);
+    if (message_arena != submessage_arena) {
+      more_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, more_data, submessage_arena);
+    }
+    set_has_more_data();
+    data_.more_data_ = more_data;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.oneofs.RequestWithSimpleOneof.more_data)
+}
+RequestWithSimpleOneof::RequestWithSimpleOneof(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.oneofs.RequestWithSimpleOneof)
+}
+RequestWithSimpleOneof::RequestWithSimpleOneof(const RequestWithSimpleOneof& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_value().empty()) {
+    value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_value(),
+      GetArena());
+  }
+  clear_has_data();
+  switch (from.data_case()) {
+    case kStrData: {
+      _internal_set_str_data(from._internal_str_data());
+      break;
+    }
+    case kIntData: {
+      _internal_set_int_data(from._internal_int_data());
+      break;
+    }
+    case kMessageData: {
+      _internal_mutable_message_data()->::proto_util_converter::testing::oneofs::Data::MergeFrom(from._internal_message_data());
+      break;
+    }
+    case kMoreData: {
+      _internal_mutable_more_data()->::proto_util_converter::testing::oneofs::MoreData::MergeFrom(from._internal_more_data());
+      break;
+    }
+    case DATA_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.oneofs.RequestWithSimpleOneof)
+}
+
+void RequestWithSimpleOneof::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RequestWithSimpleOneof_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base);
+  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  clear_has_data();
+}
+
+RequestWithSimpleOneof::~RequestWithSimpleOneof() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.oneofs.RequestWithSimpleOneof)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void RequestWithSimpleOneof::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (has_data()) {
+    clear_data();
+  }
+}
+
+void RequestWithSimpleOneof::ArenaDtor(void* object) {
+  RequestWithSimpleOneof* _this = reinterpret_cast< RequestWithSimpleOneof* >(object);
+  (void)_this;
+}
+void RequestWithSimpleOneof::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void RequestWithSimpleOneof::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const RequestWithSimpleOneof& RequestWithSimpleOneof::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RequestWithSimpleOneof_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void RequestWithSimpleOneof::clear_data() {
+// @@protoc_insertion_point(one_of_clear_start:proto_util_converter.testing.oneofs.RequestWithSimpleOneof)
+  switch (data_case()) {
+    case kStrData: {
+      data_.str_data_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+      break;
+    }
+    case kIntData: {
+      // No need to clear
+      break;
+    }
+    case kMessageData: {
+      if (GetArena() == nullptr) {
+        delete data_.message_data_;
+      }
+      break;
+    }
+    case kMoreData: {
+      if (GetArena() == nullptr) {
+        delete data_.more_data_;
+      }
+      break;
+    }
+    case DATA_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = DATA_NOT_SET;
+}
+
+
+void RequestWithSimpleOneof::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.oneofs.RequestWithSimpleOneof)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  clear_data();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestWithSimpleOneof::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          const std::string* str = &value_.Get();
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto_util_converter.testing.oneofs.RequestWithSimpleOneof.value"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string str_data = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          auto str = _internal_mutable_str_data();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto_util_converter.testing.oneofs.RequestWithSimpleOneof.str_data"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int32 int_data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          _internal_set_int_data(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.oneofs.Data message_data = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message_data(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.oneofs.MoreData more_data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_more_data(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* RequestWithSimpleOneof::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.oneofs.RequestWithSimpleOneof)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string value = 1;
+  if (this->value().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto_util_converter.testing.oneofs.RequestWithSimpleOneof.value");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_value(), target);
+  }
+
+  // string str_data = 2;
+  if (_internal_has_str_data()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_str_data().data(), static_cast<int>(this->_internal_str_data().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto_util_converter.testing.oneofs.RequestWithSimpleOneof.str_data");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_str_data(), target);
+  }
+
+  // int32 int_data = 3;
+  if (_internal_has_int_data()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_int_data(), target);
+  }
+
+  // .proto_util_converter.testing.oneofs.Data message_data = 4;
+  if (_internal_has_message_data()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::message_data(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.oneofs.MoreData more_data = 5;
+  if (_internal_has_more_data()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        5, _Internal::more_data(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.oneofs.RequestWithSimpleOneof)
+  return target;
+}
+
+size_t RequestWithSimpleOneof::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.oneofs.RequestWithSimpleOneof)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string value = 1;
+  if (this->value().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  switch (data_case()) {
+    // string str_data = 2;
+    case kStrData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_str_data());
+      break;
+    }
+    // int32 int_data = 3;
+    case kIntData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_int_data());
+      break;
+    }
+    // .proto_util_converter.testing.oneofs.Data message_data = 4;
+    case kMessageData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *data_.message_data_);
+      break;
+    }
+    // .proto_util_converter.testing.oneofs.MoreData more_data = 5;
+    case kMoreData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *data_.more_data_);
+      break;
+    }
+    case DATA_NOT_SET: {
+      break;
+    }
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void RequestWithSimpleOneof::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.oneofs.RequestWithSimpleOneof)
+  GOOGLE_DCHECK_NE(&from, this);
+  const RequestWithSimpleOneof* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RequestWithSimpleOneof>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.oneofs.RequestWithSimpleOneof)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.oneofs.RequestWithSimpleOneof)
+    MergeFrom(*source);
+  }
+}
+
+void RequestWithSimpleOneof::MergeFrom(const RequestWithSimpleOneof& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.oneofs.RequestWithSimpleOneof)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.value().size() > 0) {
+    _internal_set_value(from._internal_value());
+  }
+  switch (from.data_case()) {
+    case kStrData: {
+      _internal_set_str_data(from._internal_str_data());
+      break;
+    }
+    case kIntData: {
+      _internal_set_int_data(from._internal_int_data());
+      break;
+    }
+    case kMessageData: {
+      _internal_mutable_message_data()->::proto_util_converter::testing::oneofs::Data::MergeFrom(from._internal_message_data());
+      break;
+    }
+    case kMoreData: {
+      _internal_mutable_more_data()->::proto_util_converter::testing::oneofs::MoreData::MergeFrom(from._internal_more_data());
+      break;
+    }
+    case DATA_NOT_SET: {
+      break;
+    }
+  }
+}
+
+void RequestWithSimpleOneof::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.oneofs.RequestWithSimpleOneof)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void RequestWithSimpleOneof::CopyFrom(const RequestWithSimpleOneof& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.oneofs.RequestWithSimpleOneof)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestWithSimpleOneof::IsInitialized() const {
+  return true;
+}
+
+void RequestWithSimpleOneof::InternalSwap(RequestWithSimpleOneof* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  value_.Swap(&other->value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(data_, other->data_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestWithSimpleOneof::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void Data::InitAsDefaultInstance() {
+}
+class Data::_Internal {
+ public:
+};
+
+Data::Data(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.oneofs.Data)
+}
+Data::Data(const Data& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  data_value_ = from.data_value_;
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.oneofs.Data)
+}
+
+void Data::SharedCtor() {
+  data_value_ = 0;
+}
+
+Data::~Data() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.oneofs.Data)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void Data::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void Data::ArenaDtor(void* object) {
+  Data* _this = reinterpret_cast< Data* >(object);
+  (void)_this;
+}
+void Data::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void Data::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const Data& Data::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Data_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void Data::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.oneofs.Data)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  data_value_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Data::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // int32 data_value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          data_value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* Data::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.oneofs.Data)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 data_value = 1;
+  if (this->data_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_data_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.oneofs.Data)
+  return target;
+}
+
+size_t Data::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.oneofs.Data)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 data_value = 1;
+  if (this->data_value() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_data_value());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Data::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.oneofs.Data)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Data* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Data>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.oneofs.Data)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.oneofs.Data)
+    MergeFrom(*source);
+  }
+}
+
+void Data::MergeFrom(const Data& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.oneofs.Data)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.data_value() != 0) {
+    _internal_set_data_value(from._internal_data_value());
+  }
+}
+
+void Data::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.oneofs.Data)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Data::CopyFrom(const Data& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.oneofs.Data)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Data::IsInitialized() const {
+  return true;
+}
+
+void Data::InternalSwap(Data* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(data_value_, other->data_value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Data::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void MoreData::InitAsDefaultInstance() {
+}
+class MoreData::_Internal {
+ public:
+};
+
+MoreData::MoreData(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.oneofs.MoreData)
+}
+MoreData::MoreData(const MoreData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  str_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_str_value().empty()) {
+    str_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_str_value(),
+      GetArena());
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.oneofs.MoreData)
+}
+
+void MoreData::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_MoreData_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base);
+  str_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+MoreData::~MoreData() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.oneofs.MoreData)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void MoreData::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  str_value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void MoreData::ArenaDtor(void* object) {
+  MoreData* _this = reinterpret_cast< MoreData* >(object);
+  (void)_this;
+}
+void MoreData::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void MoreData::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const MoreData& MoreData::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_MoreData_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void MoreData::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.oneofs.MoreData)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  str_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MoreData::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string str_value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&str_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          const std::string* str = &str_value_.Get();
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto_util_converter.testing.oneofs.MoreData.str_value"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* MoreData::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.oneofs.MoreData)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string str_value = 1;
+  if (this->str_value().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_str_value().data(), static_cast<int>(this->_internal_str_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto_util_converter.testing.oneofs.MoreData.str_value");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_str_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.oneofs.MoreData)
+  return target;
+}
+
+size_t MoreData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.oneofs.MoreData)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string str_value = 1;
+  if (this->str_value().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_str_value());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void MoreData::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.oneofs.MoreData)
+  GOOGLE_DCHECK_NE(&from, this);
+  const MoreData* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<MoreData>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.oneofs.MoreData)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.oneofs.MoreData)
+    MergeFrom(*source);
+  }
+}
+
+void MoreData::MergeFrom(const MoreData& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.oneofs.MoreData)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.str_value().size() > 0) {
+    _internal_set_str_value(from._internal_str_value());
+  }
+}
+
+void MoreData::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.oneofs.MoreData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void MoreData::CopyFrom(const MoreData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.oneofs.MoreData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MoreData::IsInitialized() const {
+  return true;
+}
+
+void MoreData::InternalSwap(MoreData* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  str_value_.Swap(&other->str_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MoreData::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void Response::InitAsDefaultInstance() {
+}
+class Response::_Internal {
+ public:
+};
+
+Response::Response(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.oneofs.Response)
+}
+Response::Response(const Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_value().empty()) {
+    value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_value(),
+      GetArena());
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.oneofs.Response)
+}
+
+void Response::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Response_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base);
+  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+Response::~Response() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.oneofs.Response)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void Response::ArenaDtor(void* object) {
+  Response* _this = reinterpret_cast< Response* >(object);
+  (void)_this;
+}
+void Response::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void Response::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const Response& Response::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Response_google_2fprotobuf_2futil_2finternal_2ftestdata_2foneofs_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.oneofs.Response)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Response::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          const std::string* str = &value_.Get();
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto_util_converter.testing.oneofs.Response.value"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* Response::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.oneofs.Response)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string value = 1;
+  if (this->value().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto_util_converter.testing.oneofs.Response.value");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.oneofs.Response)
+  return target;
+}
+
+size_t Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.oneofs.Response)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string value = 1;
+  if (this->value().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Response::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.oneofs.Response)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Response* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Response>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.oneofs.Response)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.oneofs.Response)
+    MergeFrom(*source);
+  }
+}
+
+void Response::MergeFrom(const Response& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.oneofs.Response)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.value().size() > 0) {
+    _internal_set_value(from._internal_value());
+  }
+}
+
+void Response::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.oneofs.Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Response::CopyFrom(const Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.oneofs.Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Response::IsInitialized() const {
+  return true;
+}
+
+void Response::InternalSwap(Response* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  value_.Swap(&other->value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Response::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace oneofs
+}  // namespace testing
+}  // namespace proto_util_converter
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::oneofs::OneOfsRequest* Arena::CreateMaybeMessage< ::proto_util_converter::testing::oneofs::OneOfsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::oneofs::OneOfsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::oneofs::RequestWithSimpleOneof* Arena::CreateMaybeMessage< ::proto_util_converter::testing::oneofs::RequestWithSimpleOneof >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::oneofs::RequestWithSimpleOneof >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::oneofs::Data* Arena::CreateMaybeMessage< ::proto_util_converter::testing::oneofs::Data >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::oneofs::Data >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::oneofs::MoreData* Arena::CreateMaybeMessage< ::proto_util_converter::testing::oneofs::MoreData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::oneofs::MoreData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::oneofs::Response* Arena::CreateMaybeMessage< ::proto_util_converter::testing::oneofs::Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::oneofs::Response >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
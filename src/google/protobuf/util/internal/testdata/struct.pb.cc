@@ -0,0 +1,4428 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/internal/testdata/struct.proto
+
+#include "google/protobuf/util/internal/testdata/struct.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_MapOfStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapOfStruct_ListvalueMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapOfStruct_StructMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapOfStruct_ValueMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_RepeatedListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_RepeatedValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_StructWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto;
+namespace proto_util_converter {
+namespace testing {
+class StructTestCasesDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<StructTestCases> _instance;
+} _StructTestCases_default_instance_;
+class StructWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<StructWrapper> _instance;
+} _StructWrapper_default_instance_;
+class ValueWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ValueWrapper> _instance;
+} _ValueWrapper_default_instance_;
+class RepeatedValueWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RepeatedValueWrapper> _instance;
+} _RepeatedValueWrapper_default_instance_;
+class ListValueWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ListValueWrapper> _instance;
+} _ListValueWrapper_default_instance_;
+class RepeatedListValueWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RepeatedListValueWrapper> _instance;
+} _RepeatedListValueWrapper_default_instance_;
+class MapOfStruct_StructMapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapOfStruct_StructMapEntry_DoNotUse> _instance;
+} _MapOfStruct_StructMapEntry_DoNotUse_default_instance_;
+class MapOfStruct_ValueMapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapOfStruct_ValueMapEntry_DoNotUse> _instance;
+} _MapOfStruct_ValueMapEntry_DoNotUse_default_instance_;
+class MapOfStruct_ListvalueMapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapOfStruct_ListvalueMapEntry_DoNotUse> _instance;
+} _MapOfStruct_ListvalueMapEntry_DoNotUse_default_instance_;
+class MapOfStructDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MapOfStruct> _instance;
+} _MapOfStruct_default_instance_;
+class DummyDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Dummy> _instance;
+} _Dummy_default_instance_;
+class StructTypeDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<StructType> _instance;
+} _StructType_default_instance_;
+}  // namespace testing
+}  // namespace proto_util_converter
+static void InitDefaultsscc_info_Dummy_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_Dummy_default_instance_;
+    new (ptr) ::proto_util_converter::testing::Dummy();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::Dummy::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Dummy_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Dummy_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto}, {}};
+
+static void InitDefaultsscc_info_ListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_ListValueWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::ListValueWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::ListValueWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_ListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto}, {
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapOfStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_MapOfStruct_default_instance_;
+    new (ptr) ::proto_util_converter::testing::MapOfStruct();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::MapOfStruct::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_MapOfStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 3, 0, InitDefaultsscc_info_MapOfStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto}, {
+      &scc_info_MapOfStruct_StructMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+      &scc_info_MapOfStruct_ValueMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+      &scc_info_MapOfStruct_ListvalueMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapOfStruct_ListvalueMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_MapOfStruct_ListvalueMapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto_util_converter::testing::MapOfStruct_ListvalueMapEntry_DoNotUse();
+  }
+  ::proto_util_converter::testing::MapOfStruct_ListvalueMapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapOfStruct_ListvalueMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapOfStruct_ListvalueMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto}, {
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapOfStruct_StructMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_MapOfStruct_StructMapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto_util_converter::testing::MapOfStruct_StructMapEntry_DoNotUse();
+  }
+  ::proto_util_converter::testing::MapOfStruct_StructMapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapOfStruct_StructMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapOfStruct_StructMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto}, {
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,}};
+
+static void InitDefaultsscc_info_MapOfStruct_ValueMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_MapOfStruct_ValueMapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto_util_converter::testing::MapOfStruct_ValueMapEntry_DoNotUse();
+  }
+  ::proto_util_converter::testing::MapOfStruct_ValueMapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_MapOfStruct_ValueMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_MapOfStruct_ValueMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto}, {
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,}};
+
+static void InitDefaultsscc_info_RepeatedListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_RepeatedListValueWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::RepeatedListValueWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::RepeatedListValueWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_RepeatedListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_RepeatedListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto}, {
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,}};
+
+static void InitDefaultsscc_info_RepeatedValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_RepeatedValueWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::RepeatedValueWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::RepeatedValueWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_RepeatedValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_RepeatedValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto}, {
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,}};
+
+static void InitDefaultsscc_info_StructTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_StructTestCases_default_instance_;
+    new (ptr) ::proto_util_converter::testing::StructTestCases();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::StructTestCases::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<7> scc_info_StructTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 7, 0, InitDefaultsscc_info_StructTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto}, {
+      &scc_info_StructWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,
+      &scc_info_ValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+      &scc_info_ListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+      &scc_info_RepeatedValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+      &scc_info_RepeatedListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+      &scc_info_MapOfStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,}};
+
+static void InitDefaultsscc_info_StructType_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_StructType_default_instance_;
+    new (ptr) ::proto_util_converter::testing::StructType();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::StructType::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_StructType_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_StructType_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto}, {
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,}};
+
+static void InitDefaultsscc_info_StructWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_StructWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::StructWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::StructWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_StructWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_StructWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto}, {
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,}};
+
+static void InitDefaultsscc_info_ValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_ValueWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::ValueWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::ValueWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_ValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto}, {
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,}};
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto[12];
+static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto = nullptr;
+
+const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, empty_value_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, empty_value2_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, null_value_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, simple_struct_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, longer_struct_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, struct_with_nested_struct_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, struct_with_nested_list_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, struct_with_list_of_nulls_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, struct_with_list_of_lists_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, struct_with_list_of_structs_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, struct_with_empty_list_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, struct_with_list_with_empty_struct_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, top_level_struct_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, top_level_struct_with_empty_list_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, top_level_struct_with_list_with_empty_struct_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, value_wrapper_simple_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, value_wrapper_with_struct_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, value_wrapper_with_list_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, value_wrapper_with_empty_list_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, value_wrapper_with_list_with_empty_struct_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, list_value_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, list_value_wrapper_with_empty_list_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, list_value_wrapper_with_list_with_empty_struct_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, top_level_value_simple_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, top_level_value_with_struct_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, top_level_value_with_list_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, top_level_value_with_empty_list_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, top_level_value_with_list_with_empty_struct_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, top_level_listvalue_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, top_level_empty_listvalue_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, top_level_listvalue_with_empty_struct_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, repeated_value_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, repeated_value_nested_list_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, repeated_value_nested_list2_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, repeated_value_nested_list3_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, repeated_listvalue_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, map_of_struct_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, map_of_struct_value_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructTestCases, map_of_listvalue_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructWrapper, struct__),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::ValueWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::ValueWrapper, value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::RepeatedValueWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::RepeatedValueWrapper, values_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::ListValueWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::ListValueWrapper, shopping_list_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::RepeatedListValueWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::RepeatedListValueWrapper, dimensions_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct_StructMapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct_StructMapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct_StructMapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct_StructMapEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct_ValueMapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct_ValueMapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct_ValueMapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct_ValueMapEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct_ListvalueMapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct_ListvalueMapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct_ListvalueMapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct_ListvalueMapEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct, struct_map_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct, value_map_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::MapOfStruct, listvalue_map_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Dummy, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Dummy, text_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructType, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StructType, object_),
+};
+static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, sizeof(::proto_util_converter::testing::StructTestCases)},
+  { 44, -1, sizeof(::proto_util_converter::testing::StructWrapper)},
+  { 50, -1, sizeof(::proto_util_converter::testing::ValueWrapper)},
+  { 56, -1, sizeof(::proto_util_converter::testing::RepeatedValueWrapper)},
+  { 62, -1, sizeof(::proto_util_converter::testing::ListValueWrapper)},
+  { 68, -1, sizeof(::proto_util_converter::testing::RepeatedListValueWrapper)},
+  { 74, 81, sizeof(::proto_util_converter::testing::MapOfStruct_StructMapEntry_DoNotUse)},
+  { 83, 90, sizeof(::proto_util_converter::testing::MapOfStruct_ValueMapEntry_DoNotUse)},
+  { 92, 99, sizeof(::proto_util_converter::testing::MapOfStruct_ListvalueMapEntry_DoNotUse)},
+  { 101, -1, sizeof(::proto_util_converter::testing::MapOfStruct)},
+  { 109, -1, sizeof(::proto_util_converter::testing::Dummy)},
+  { 115, -1, sizeof(::proto_util_converter::testing::StructType)},
+};
+
+static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_StructTestCases_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_StructWrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_ValueWrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_RepeatedValueWrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_ListValueWrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_RepeatedListValueWrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_MapOfStruct_StructMapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_MapOfStruct_ValueMapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_MapOfStruct_ListvalueMapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_MapOfStruct_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_Dummy_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_StructType_default_instance_),
+};
+
+const char descriptor_table_protodef_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n3google/protobuf/util/internal/testdata"
+  "/struct.proto\022\034proto_util_converter.test"
+  "ing\032\034google/protobuf/struct.proto\"\374\026\n\017St"
+  "ructTestCases\022@\n\013empty_value\030\001 \001(\0132+.pro"
+  "to_util_converter.testing.StructWrapper\022"
+  "A\n\014empty_value2\030\002 \001(\0132+.proto_util_conve"
+  "rter.testing.StructWrapper\022\?\n\nnull_value"
+  "\030\003 \001(\0132+.proto_util_converter.testing.St"
+  "ructWrapper\022B\n\rsimple_struct\030\004 \001(\0132+.pro"
+  "to_util_converter.testing.StructWrapper\022"
+  "B\n\rlonger_struct\030\005 \001(\0132+.proto_util_conv"
+  "erter.testing.StructWrapper\022N\n\031struct_wi"
+  "th_nested_struct\030\006 \001(\0132+.proto_util_conv"
+  "erter.testing.StructWrapper\022L\n\027struct_wi"
+  "th_nested_list\030\007 \001(\0132+.proto_util_conver"
+  "ter.testing.StructWrapper\022N\n\031struct_with"
+  "_list_of_nulls\030\010 \001(\0132+.proto_util_conver"
+  "ter.testing.StructWrapper\022N\n\031struct_with"
+  "_list_of_lists\030\t \001(\0132+.proto_util_conver"
+  "ter.testing.StructWrapper\022P\n\033struct_with"
+  "_list_of_structs\030\n \001(\0132+.proto_util_conv"
+  "erter.testing.StructWrapper\022K\n\026struct_wi"
+  "th_empty_list\030\013 \001(\0132+.proto_util_convert"
+  "er.testing.StructWrapper\022W\n\"struct_with_"
+  "list_with_empty_struct\030\014 \001(\0132+.proto_uti"
+  "l_converter.testing.StructWrapper\0221\n\020top"
+  "_level_struct\030\r \001(\0132\027.google.protobuf.St"
+  "ruct\022A\n top_level_struct_with_empty_list"
+  "\030\016 \001(\0132\027.google.protobuf.Struct\022M\n,top_l"
+  "evel_struct_with_list_with_empty_struct\030"
+  "\017 \001(\0132\027.google.protobuf.Struct\022H\n\024value_"
+  "wrapper_simple\030\020 \001(\0132*.proto_util_conver"
+  "ter.testing.ValueWrapper\022M\n\031value_wrappe"
+  "r_with_struct\030\021 \001(\0132*.proto_util_convert"
+  "er.testing.ValueWrapper\022K\n\027value_wrapper"
+  "_with_list\030\022 \001(\0132*.proto_util_converter."
+  "testing.ValueWrapper\022Q\n\035value_wrapper_wi"
+  "th_empty_list\030\023 \001(\0132*.proto_util_convert"
+  "er.testing.ValueWrapper\022]\n)value_wrapper"
+  "_with_list_with_empty_struct\030\024 \001(\0132*.pro"
+  "to_util_converter.testing.ValueWrapper\022J"
+  "\n\022list_value_wrapper\030\025 \001(\0132..proto_util_"
+  "converter.testing.ListValueWrapper\022Z\n\"li"
+  "st_value_wrapper_with_empty_list\030\026 \001(\0132."
+  ".proto_util_converter.testing.ListValueW"
+  "rapper\022f\n.list_value_wrapper_with_list_w"
+  "ith_empty_struct\030\027 \001(\0132..proto_util_conv"
+  "erter.testing.ListValueWrapper\0226\n\026top_le"
+  "vel_value_simple\030\030 \001(\0132\026.google.protobuf"
+  ".Value\022;\n\033top_level_value_with_struct\030\031 "
+  "\001(\0132\026.google.protobuf.Value\0229\n\031top_level"
+  "_value_with_list\030\032 \001(\0132\026.google.protobuf"
+  ".Value\022\?\n\037top_level_value_with_empty_lis"
+  "t\030\033 \001(\0132\026.google.protobuf.Value\022K\n+top_l"
+  "evel_value_with_list_with_empty_struct\030\034"
+  " \001(\0132\026.google.protobuf.Value\0227\n\023top_leve"
+  "l_listvalue\030\035 \001(\0132\032.google.protobuf.List"
+  "Value\022=\n\031top_level_empty_listvalue\030\036 \001(\013"
+  "2\032.google.protobuf.ListValue\022I\n%top_leve"
+  "l_listvalue_with_empty_struct\030\037 \001(\0132\032.go"
+  "ogle.protobuf.ListValue\022J\n\016repeated_valu"
+  "e\030  \001(\01322.proto_util_converter.testing.R"
+  "epeatedValueWrapper\022V\n\032repeated_value_ne"
+  "sted_list\030! \001(\01322.proto_util_converter.t"
+  "esting.RepeatedValueWrapper\022W\n\033repeated_"
+  "value_nested_list2\030\" \001(\01322.proto_util_co"
+  "nverter.testing.RepeatedValueWrapper\022W\n\033"
+  "repeated_value_nested_list3\030# \001(\01322.prot"
+  "o_util_converter.testing.RepeatedValueWr"
+  "apper\022R\n\022repeated_listvalue\030$ \001(\01326.prot"
+  "o_util_converter.testing.RepeatedListVal"
+  "ueWrapper\022@\n\rmap_of_struct\030% \001(\0132).proto"
+  "_util_converter.testing.MapOfStruct\022F\n\023m"
+  "ap_of_struct_value\030& \001(\0132).proto_util_co"
+  "nverter.testing.MapOfStruct\022C\n\020map_of_li"
+  "stvalue\030\' \001(\0132).proto_util_converter.tes"
+  "ting.MapOfStruct\"8\n\rStructWrapper\022\'\n\006str"
+  "uct\030\001 \001(\0132\027.google.protobuf.Struct\"5\n\014Va"
+  "lueWrapper\022%\n\005value\030\001 \001(\0132\026.google.proto"
+  "buf.Value\">\n\024RepeatedValueWrapper\022&\n\006val"
+  "ues\030\001 \003(\0132\026.google.protobuf.Value\"E\n\020Lis"
+  "tValueWrapper\0221\n\rshopping_list\030\001 \001(\0132\032.g"
+  "oogle.protobuf.ListValue\"J\n\030RepeatedList"
+  "ValueWrapper\022.\n\ndimensions\030\001 \003(\0132\032.googl"
+  "e.protobuf.ListValue\"\340\003\n\013MapOfStruct\022L\n\n"
+  "struct_map\030\001 \003(\01328.proto_util_converter."
+  "testing.MapOfStruct.StructMapEntry\022J\n\tva"
+  "lue_map\030\002 \003(\01327.proto_util_converter.tes"
+  "ting.MapOfStruct.ValueMapEntry\022R\n\rlistva"
+  "lue_map\030\003 \003(\0132;.proto_util_converter.tes"
+  "ting.MapOfStruct.ListvalueMapEntry\032I\n\016St"
+  "ructMapEntry\022\013\n\003key\030\001 \001(\t\022&\n\005value\030\002 \001(\013"
+  "2\027.google.protobuf.Struct:\0028\001\032G\n\rValueMa"
+  "pEntry\022\013\n\003key\030\001 \001(\t\022%\n\005value\030\002 \001(\0132\026.goo"
+  "gle.protobuf.Value:\0028\001\032O\n\021ListvalueMapEn"
+  "try\022\013\n\003key\030\001 \001(\t\022)\n\005value\030\002 \001(\0132\032.google"
+  ".protobuf.ListValue:\0028\001\"\025\n\005Dummy\022\014\n\004text"
+  "\030\001 \001(\t\"5\n\nStructType\022\'\n\006object\030\001 \001(\0132\027.g"
+  "oogle.protobuf.Struct2o\n\021StructTestServi"
+  "ce\022Z\n\004Call\022#.proto_util_converter.testin"
+  "g.Dummy\032-.proto_util_converter.testing.S"
+  "tructTestCasesb\006proto3"
+  ;
+static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto_deps[1] = {
+  &::descriptor_table_google_2fprotobuf_2fstruct_2eproto,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto_sccs[12] = {
+  &scc_info_Dummy_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+  &scc_info_ListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+  &scc_info_MapOfStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+  &scc_info_MapOfStruct_ListvalueMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+  &scc_info_MapOfStruct_StructMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+  &scc_info_MapOfStruct_ValueMapEntry_DoNotUse_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+  &scc_info_RepeatedListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+  &scc_info_RepeatedValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+  &scc_info_StructTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+  &scc_info_StructType_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+  &scc_info_StructWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+  &scc_info_ValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto_once;
+const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto = {
+  false, false, descriptor_table_protodef_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto, "google/protobuf/util/internal/testdata/struct.proto", 4062,
+  &descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto_once, descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto_sccs, descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto_deps, 12, 1,
+  schemas, file_default_instances, TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto::offsets,
+  file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto, 12, file_level_enum_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto, file_level_service_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto,
+};
+
+// Force running AddDescriptors() at dynamic initialization time.
+static bool dynamic_init_dummy_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto)), true);
+namespace proto_util_converter {
+namespace testing {
+
+// ===================================================================
+
+void StructTestCases::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->empty_value_ = const_cast< ::proto_util_converter::testing::StructWrapper*>(
+      ::proto_util_converter::testing::StructWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->empty_value2_ = const_cast< ::proto_util_converter::testing::StructWrapper*>(
+      ::proto_util_converter::testing::StructWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->null_value_ = const_cast< ::proto_util_converter::testing::StructWrapper*>(
+      ::proto_util_converter::testing::StructWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->simple_struct_ = const_cast< ::proto_util_converter::testing::StructWrapper*>(
+      ::proto_util_converter::testing::StructWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->longer_struct_ = const_cast< ::proto_util_converter::testing::StructWrapper*>(
+      ::proto_util_converter::testing::StructWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->struct_with_nested_struct_ = const_cast< ::proto_util_converter::testing::StructWrapper*>(
+      ::proto_util_converter::testing::StructWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->struct_with_nested_list_ = const_cast< ::proto_util_converter::testing::StructWrapper*>(
+      ::proto_util_converter::testing::StructWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->struct_with_list_of_nulls_ = const_cast< ::proto_util_converter::testing::StructWrapper*>(
+      ::proto_util_converter::testing::StructWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->struct_with_list_of_lists_ = const_cast< ::proto_util_converter::testing::StructWrapper*>(
+      ::proto_util_converter::testing::StructWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->struct_with_list_of_structs_ = const_cast< ::proto_util_converter::testing::StructWrapper*>(
+      ::proto_util_converter::testing::StructWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->struct_with_empty_list_ = const_cast< ::proto_util_converter::testing::StructWrapper*>(
+      ::proto_util_converter::testing::StructWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->struct_with_list_with_empty_struct_ = const_cast< ::proto_util_converter::testing::StructWrapper*>(
+      ::proto_util_converter::testing::StructWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->top_level_struct_ = const_cast< PROTOBUF_NAMESPACE_ID::Struct*>(
+      PROTOBUF_NAMESPACE_ID::Struct::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->top_level_struct_with_empty_list_ = const_cast< PROTOBUF_NAMESPACE_ID::Struct*>(
+      PROTOBUF_NAMESPACE_ID::Struct::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->top_level_struct_with_list_with_empty_struct_ = const_cast< PROTOBUF_NAMESPACE_ID::Struct*>(
+      PROTOBUF_NAMESPACE_ID::Struct::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->value_wrapper_simple_ = const_cast< ::proto_util_converter::testing::ValueWrapper*>(
+      ::proto_util_converter::testing::ValueWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->value_wrapper_with_struct_ = const_cast< ::proto_util_converter::testing::ValueWrapper*>(
+      ::proto_util_converter::testing::ValueWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->value_wrapper_with_list_ = const_cast< ::proto_util_converter::testing::ValueWrapper*>(
+      ::proto_util_converter::testing::ValueWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->value_wrapper_with_empty_list_ = const_cast< ::proto_util_converter::testing::ValueWrapper*>(
+      ::proto_util_converter::testing::ValueWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->value_wrapper_with_list_with_empty_struct_ = const_cast< ::proto_util_converter::testing::ValueWrapper*>(
+      ::proto_util_converter::testing::ValueWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->list_value_wrapper_ = const_cast< ::proto_util_converter::testing::ListValueWrapper*>(
+      ::proto_util_converter::testing::ListValueWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->list_value_wrapper_with_empty_list_ = const_cast< ::proto_util_converter::testing::ListValueWrapper*>(
+      ::proto_util_converter::testing::ListValueWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->list_value_wrapper_with_list_with_empty_struct_ = const_cast< ::proto_util_converter::testing::ListValueWrapper*>(
+      ::proto_util_converter::testing::ListValueWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->top_level_value_simple_ = const_cast< PROTOBUF_NAMESPACE_ID::Value*>(
+      PROTOBUF_NAMESPACE_ID::Value::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->top_level_value_with_struct_ = const_cast< PROTOBUF_NAMESPACE_ID::Value*>(
+      PROTOBUF_NAMESPACE_ID::Value::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->top_level_value_with_list_ = const_cast< PROTOBUF_NAMESPACE_ID::Value*>(
+      PROTOBUF_NAMESPACE_ID::Value::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->top_level_value_with_empty_list_ = const_cast< PROTOBUF_NAMESPACE_ID::Value*>(
+      PROTOBUF_NAMESPACE_ID::Value::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->top_level_value_with_list_with_empty_struct_ = const_cast< PROTOBUF_NAMESPACE_ID::Value*>(
+      PROTOBUF_NAMESPACE_ID::Value::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->top_level_listvalue_ = const_cast< PROTOBUF_NAMESPACE_ID::ListValue*>(
+      PROTOBUF_NAMESPACE_ID::ListValue::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->top_level_empty_listvalue_ = const_cast< PROTOBUF_NAMESPACE_ID::ListValue*>(
+      PROTOBUF_NAMESPACE_ID::ListValue::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->top_level_listvalue_with_empty_struct_ = const_cast< PROTOBUF_NAMESPACE_ID::ListValue*>(
+      PROTOBUF_NAMESPACE_ID::ListValue::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->repeated_value_ = const_cast< ::proto_util_converter::testing::RepeatedValueWrapper*>(
+      ::proto_util_converter::testing::RepeatedValueWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->repeated_value_nested_list_ = const_cast< ::proto_util_converter::testing::RepeatedValueWrapper*>(
+      ::proto_util_converter::testing::RepeatedValueWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->repeated_value_nested_list2_ = const_cast< ::proto_util_converter::testing::RepeatedValueWrapper*>(
+      ::proto_util_converter::testing::RepeatedValueWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->repeated_value_nested_list3_ = const_cast< ::proto_util_converter::testing::RepeatedValueWrapper*>(
+      ::proto_util_converter::testing::RepeatedValueWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->repeated_listvalue_ = const_cast< ::proto_util_converter::testing::RepeatedListValueWrapper*>(
+      ::proto_util_converter::testing::RepeatedListValueWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->map_of_struct_ = const_cast< ::proto_util_converter::testing::MapOfStruct*>(
+      ::proto_util_converter::testing::MapOfStruct::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->map_of_struct_value_ = const_cast< ::proto_util_converter::testing::MapOfStruct*>(
+      ::proto_util_converter::testing::MapOfStruct::internal_default_instance());
+  ::proto_util_converter::testing::_StructTestCases_default_instance_._instance.get_mutable()->map_of_listvalue_ = const_cast< ::proto_util_converter::testing::MapOfStruct*>(
+      ::proto_util_converter::testing::MapOfStruct::internal_default_instance());
+}
+class StructTestCases::_Internal {
+ public:
+  static const ::proto_util_converter::testing::StructWrapper& empty_value(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::StructWrapper& empty_value2(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::StructWrapper& null_value(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::StructWrapper& simple_struct(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::StructWrapper& longer_struct(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::StructWrapper& struct_with_nested_struct(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::StructWrapper& struct_with_nested_list(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::StructWrapper& struct_with_list_of_nulls(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::StructWrapper& struct_with_list_of_lists(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::StructWrapper& struct_with_list_of_structs(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::StructWrapper& struct_with_empty_list(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::StructWrapper& struct_with_list_with_empty_struct(const StructTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::Struct& top_level_struct(const StructTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::Struct& top_level_struct_with_empty_list(const StructTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::Struct& top_level_struct_with_list_with_empty_struct(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::ValueWrapper& value_wrapper_simple(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::ValueWrapper& value_wrapper_with_struct(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::ValueWrapper& value_wrapper_with_list(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::ValueWrapper& value_wrapper_with_empty_list(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::ValueWrapper& value_wrapper_with_list_with_empty_struct(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::ListValueWrapper& list_value_wrapper(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::ListValueWrapper& list_value_wrapper_with_empty_list(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::ListValueWrapper& list_value_wrapper_with_list_with_empty_struct(const StructTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::Value& top_level_value_simple(const StructTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::Value& top_level_value_with_struct(const StructTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::Value& top_level_value_with_list(const StructTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::Value& top_level_value_with_empty_list(const StructTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::Value& top_level_value_with_list_with_empty_struct(const StructTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::ListValue& top_level_listvalue(const StructTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::ListValue& top_level_empty_listvalue(const StructTestCases* msg);
+  static const PROTOBUF_NAMESPACE_ID::ListValue& top_level_listvalue_with_empty_struct(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::RepeatedValueWrapper& repeated_value(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::RepeatedValueWrapper& repeated_value_nested_list(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::RepeatedValueWrapper& repeated_value_nested_list2(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::RepeatedValueWrapper& repeated_value_nested_list3(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::RepeatedListValueWrapper& repeated_listvalue(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::MapOfStruct& map_of_struct(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::MapOfStruct& map_of_struct_value(const StructTestCases* msg);
+  static const ::proto_util_converter::testing::MapOfStruct& map_of_listvalue(const StructTestCases* msg);
+};
+
+const ::proto_util_converter::testing::StructWrapper&
+StructTestCases::_Internal::empty_value(const StructTestCases* msg) {
+  return *msg->empty_value_;
+}
+const ::proto_util_converter::testing::StructWrapper&
+StructTestCases::_Internal::empty_value2(const StructTestCases* msg) {
+  return *msg->empty_value2_;
+}
+const ::proto_util_converter::testing::StructWrapper&
+StructTestCases::_Internal::null_value(const StructTestCases* msg) {
+  return *msg->null_value_;
+}
+const ::proto_util_converter::testing::StructWrapper&
+StructTestCases::_Internal::simple_struct(const StructTestCases* msg) {
+  return *msg->simple_struct_;
+}
+const ::proto_util_converter::testing::StructWrapper&
+StructTestCases::_Internal::longer_struct(const StructTestCases* msg) {
+  return *msg->longer_struct_;
+}
+const ::proto_util_converter::testing::StructWrapper&
+StructTestCases::_Internal::struct_with_nested_struct(const StructTestCases* msg) {
+  return *msg->struct_with_nested_struct_;
+}
+const ::proto_util_converter::testing::StructWrapper&
+StructTestCases::_Internal::struct_with_nested_list(const StructTestCases* msg) {
+  return *msg->struct_with_nested_list_;
+}
+const ::proto_util_converter::testing::StructWrapper&
+StructTestCases::_Internal::struct_with_list_of_nulls(const StructTestCases* msg) {
+  return *msg->struct_with_list_of_nulls_;
+}
+const ::proto_util_converter::testing::StructWrapper&
+StructTestCases::_Internal::struct_with_list_of_lists(const StructTestCases* msg) {
+  return *msg->struct_with_list_of_lists_;
+}
+const ::proto_util_converter::testing::StructWrapper&
+StructTestCases::_Internal::struct_with_list_of_structs(const StructTestCases* msg) {
+  return *msg->struct_with_list_of_structs_;
+}
+const ::proto_util_converter::testing::StructWrapper&
+StructTestCases::_Internal::struct_with_empty_list(const StructTestCases* msg) {
+  return *msg->struct_with_empty_list_;
+}
+const ::proto_util_converter::testing::StructWrapper&
+StructTestCases::_Internal::struct_with_list_with_empty_struct(const StructTestCases* msg) {
+  return *msg->struct_with_list_with_empty_struct_;
+}
+const PROTOBUF_NAMESPACE_ID::Struct&
+StructTestCases::_Internal::top_level_struct(const StructTestCases* msg) {
+  return *msg->top_level_struct_;
+}
+const PROTOBUF_NAMESPACE_ID::Struct&
+StructTestCases::_Internal::top_level_struct_with_empty_list(const StructTestCases* msg) {
+  return *msg->top_level_struct_with_empty_list_;
+}
+const PROTOBUF_NAMESPACE_ID::Struct&
+StructTestCases::_Internal::top_level_struct_with_list_with_empty_struct(const StructTestCases* msg) {
+  return *msg->top_level_struct_with_list_with_empty_struct_;
+}
+const ::proto_util_converter::testing::ValueWrapper&
+StructTestCases::_Internal::value_wrapper_simple(const StructTestCases* msg) {
+  return *msg->value_wrapper_simple_;
+}
+const ::proto_util_converter::testing::ValueWrapper&
+StructTestCases::_Internal::value_wrapper_with_struct(const StructTestCases* msg) {
+  return *msg->value_wrapper_with_struct_;
+}
+const ::proto_util_converter::testing::ValueWrapper&
+StructTestCases::_Internal::value_wrapper_with_list(const StructTestCases* msg) {
+  return *msg->value_wrapper_with_list_;
+}
+const ::proto_util_converter::testing::ValueWrapper&
+StructTestCases::_Internal::value_wrapper_with_empty_list(const StructTestCases* msg) {
+  return *msg->value_wrapper_with_empty_list_;
+}
+const ::proto_util_converter::testing::ValueWrapper&
+StructTestCases::_Internal::value_wrapper_with_list_with_empty_struct(const StructTestCases* msg) {
+  return *msg->value_wrapper_with_list_with_empty_struct_;
+}
+const ::proto_util_converter::testing::ListValueWrapper&
+StructTestCases::_Internal::list_value_wrapper(const StructTestCases* msg) {
+  return *msg->list_value_wrapper_;
+}
+const ::proto_util_converter::testing::ListValueWrapper&
+StructTestCases::_Internal::list_value_wrapper_with_empty_list(const StructTestCases* msg) {
+  return *msg->list_value_wrapper_with_empty_list_;
+}
+const ::proto_util_converter::testing::ListValueWrapper&
+StructTestCases::_Internal::list_value_wrapper_with_list_with_empty_struct(const StructTestCases* msg) {
+  return *msg->list_value_wrapper_with_list_with_empty_struct_;
+}
+const PROTOBUF_NAMESPACE_ID::Value&
+StructTestCases::_Internal::top_level_value_simple(const StructTestCases* msg) {
+  return *msg->top_level_value_simple_;
+}
+const PROTOBUF_NAMESPACE_ID::Value&
+StructTestCases::_Internal::top_level_value_with_struct(const StructTestCases* msg) {
+  return *msg->top_level_value_with_struct_;
+}
+const PROTOBUF_NAMESPACE_ID::Value&
+StructTestCases::_Internal::top_level_value_with_list(const StructTestCases* msg) {
+  return *msg->top_level_value_with_list_;
+}
+const PROTOBUF_NAMESPACE_ID::Value&
+StructTestCases::_Internal::top_level_value_with_empty_list(const StructTestCases* msg) {
+  return *msg->top_level_value_with_empty_list_;
+}
+const PROTOBUF_NAMESPACE_ID::Value&
+StructTestCases::_Internal::top_level_value_with_list_with_empty_struct(const StructTestCases* msg) {
+  return *msg->top_level_value_with_list_with_empty_struct_;
+}
+const PROTOBUF_NAMESPACE_ID::ListValue&
+StructTestCases::_Internal::top_level_listvalue(const StructTestCases* msg) {
+  return *msg->top_level_listvalue_;
+}
+const PROTOBUF_NAMESPACE_ID::ListValue&
+StructTestCases::_Internal::top_level_empty_listvalue(const StructTestCases* msg) {
+  return *msg->top_level_empty_listvalue_;
+}
+const PROTOBUF_NAMESPACE_ID::ListValue&
+StructTestCases::_Internal::top_level_listvalue_with_empty_struct(const StructTestCases* msg) {
+  return *msg->top_level_listvalue_with_empty_struct_;
+}
+const ::proto_util_converter::testing::RepeatedValueWrapper&
+StructTestCases::_Internal::repeated_value(const StructTestCases* msg) {
+  return *msg->repeated_value_;
+}
+const ::proto_util_converter::testing::RepeatedValueWrapper&
+StructTestCases::_Internal::repeated_value_nested_list(const StructTestCases* msg) {
+  return *msg->repeated_value_nested_list_;
+}
+const ::proto_util_converter::testing::RepeatedValueWrapper&
+StructTestCases::_Internal::repeated_value_nested_list2(const StructTestCases* msg) {
+  return *msg->repeated_value_nested_list2_;
+}
+const ::proto_util_converter::testing::RepeatedValueWrapper&
+StructTestCases::_Internal::repeated_value_nested_list3(const StructTestCases* msg) {
+  return *msg->repeated_value_nested_list3_;
+}
+const ::proto_util_converter::testing::RepeatedListValueWrapper&
+StructTestCases::_Internal::repeated_listvalue(const StructTestCases* msg) {
+  return *msg->repeated_listvalue_;
+}
+const ::proto_util_converter::testing::MapOfStruct&
+StructTestCases::_Internal::map_of_struct(const StructTestCases* msg) {
+  return *msg->map_of_struct_;
+}
+const ::proto_util_converter::testing::MapOfStruct&
+StructTestCases::_Internal::map_of_struct_value(const StructTestCases* msg) {
+  return *msg->map_of_struct_value_;
+}
+const ::proto_util_converter::testing::MapOfStruct&
+StructTestCases::_Internal::map_of_listvalue(const StructTestCases* msg) {
+  return *msg->map_of_listvalue_;
+}
+void StructTestCases::clear_top_level_struct() {
+  if (GetArena() == nullptr && top_level_struct_ != nullptr) {
+    delete top_level_struct_;
+  }
+  top_level_struct_ = nullptr;
+}
+void StructTestCases::clear_top_level_struct_with_empty_list() {
+  if (GetArena() == nullptr && top_level_struct_with_empty_list_ != nullptr) {
+    delete top_level_struct_with_empty_list_;
+  }
+  top_level_struct_with_empty_list_ = nullptr;
+}
+void StructTestCases::clear_top_level_struct_with_list_with_empty_struct() {
+  if (GetArena() == nullptr && top_level_struct_with_list_with_empty_struct_ != nullptr) {
+    delete top_level_struct_with_list_with_empty_struct_;
+  }
+  top_level_struct_with_list_with_empty_struct_ = nullptr;
+}
+void StructTestCases::clear_top_level_value_simple() {
+  if (GetArena() == nullptr && top_level_value_simple_ != nullptr) {
+    delete top_level_value_simple_;
+  }
+  top_level_value_simple_ = nullptr;
+}
+void StructTestCases::clear_top_level_value_with_struct() {
+  if (GetArena() == nullptr && top_level_value_with_struct_ != nullptr) {
+    delete top_level_value_with_struct_;
+  }
+  top_level_value_with_struct_ = nullptr;
+}
+void StructTestCases::clear_top_level_value_with_list() {
+  if (GetArena() == nullptr && top_level_value_with_list_ != nullptr) {
+    delete top_level_value_with_list_;
+  }
+  top_level_value_with_list_ = nullptr;
+}
+void StructTestCases::clear_top_level_value_with_empty_list() {
+  if (GetArena() == nullptr && top_level_value_with_empty_list_ != nullptr) {
+    delete top_level_value_with_empty_list_;
+  }
+  top_level_value_with_empty_list_ = nullptr;
+}
+void StructTestCases::clear_top_level_value_with_list_with_empty_struct() {
+  if (GetArena() == nullptr && top_level_value_with_list_with_empty_struct_ != nullptr) {
+    delete top_level_value_with_list_with_empty_struct_;
+  }
+  top_level_value_with_list_with_empty_struct_ = nullptr;
+}
+void StructTestCases::clear_top_level_listvalue() {
+  if (GetArena() == nullptr && top_level_listvalue_ != nullptr) {
+    delete top_level_listvalue_;
+  }
+  top_level_listvalue_ = nullptr;
+}
+void StructTestCases::clear_top_level_empty_listvalue() {
+  if (GetArena() == nullptr && top_level_empty_listvalue_ != nullptr) {
+    delete top_level_empty_listvalue_;
+  }
+  top_level_empty_listvalue_ = nullptr;
+}
+void StructTestCases::clear_top_level_listvalue_with_empty_struct() {
+  if (GetArena() == nullptr && top_level_listvalue_with_empty_struct_ != nullptr) {
+    delete top_level_listvalue_with_empty_struct_;
+  }
+  top_level_listvalue_with_empty_struct_ = nullptr;
+}
+StructTestCases::StructTestCases(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.StructTestCases)
+}
+StructTestCases::StructTestCases(const StructTestCases& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_empty_value()) {
+    empty_value_ = new ::proto_util_converter::testing::StructWrapper(*from.empty_value_);
+  } else {
+    empty_value_ = nullptr;
+  }
+  if (from._internal_has_empty_value2()) {
+    empty_value2_ = new ::proto_util_converter::testing::StructWrapper(*from.empty_value2_);
+  } else {
+    empty_value2_ = nullptr;
+  }
+  if (from._internal_has_null_value()) {
+    null_value_ = new ::proto_util_converter::testing::StructWrapper(*from.null_value_);
+  } else {
+    null_value_ = nullptr;
+  }
+  if (from._internal_has_simple_struct()) {
+    simple_struct_ = new ::proto_util_converter::testing::StructWrapper(*from.simple_struct_);
+  } else {
+    simple_struct_ = nullptr;
+  }
+  if (from._internal_has_longer_struct()) {
+    longer_struct_ = new ::proto_util_converter::testing::StructWrapper(*from.longer_struct_);
+  } else {
+    longer_struct_ = nullptr;
+  }
+  if (from._internal_has_struct_with_nested_struct()) {
+    struct_with_nested_struct_ = new ::proto_util_converter::testing::StructWrapper(*from.struct_with_nested_struct_);
+  } else {
+    struct_with_nested_struct_ = nullptr;
+  }
+  if (from._internal_has_struct_with_nested_list()) {
+    struct_with_nested_list_ = new ::proto_util_converter::testing::StructWrapper(*from.struct_with_nested_list_);
+  } else {
+    struct_with_nested_list_ = nullptr;
+  }
+  if (from._internal_has_struct_with_list_of_nulls()) {
+    struct_with_list_of_nulls_ = new ::proto_util_converter::testing::StructWrapper(*from.struct_with_list_of_nulls_);
+  } else {
+    struct_with_list_of_nulls_ = nullptr;
+  }
+  if (from._internal_has_struct_with_list_of_lists()) {
+    struct_with_list_of_lists_ = new ::proto_util_converter::testing::StructWrapper(*from.struct_with_list_of_lists_);
+  } else {
+    struct_with_list_of_lists_ = nullptr;
+  }
+  if (from._internal_has_struct_with_list_of_structs()) {
+    struct_with_list_of_structs_ = new ::proto_util_converter::testing::StructWrapper(*from.struct_with_list_of_structs_);
+  } else {
+    struct_with_list_of_structs_ = nullptr;
+  }
+  if (from._internal_has_struct_with_empty_list()) {
+    struct_with_empty_list_ = new ::proto_util_converter::testing::StructWrapper(*from.struct_with_empty_list_);
+  } else {
+    struct_with_empty_list_ = nullptr;
+  }
+  if (from._internal_has_struct_with_list_with_empty_struct()) {
+    struct_with_list_with_empty_struct_ = new ::proto_util_converter::testing::StructWrapper(*from.struct_with_list_with_empty_struct_);
+  } else {
+    struct_with_list_with_empty_struct_ = nullptr;
+  }
+  if (from._internal_has_top_level_struct()) {
+    top_level_struct_ = new PROTOBUF_NAMESPACE_ID::Struct(*from.top_level_struct_);
+  } else {
+    top_level_struct_ = nullptr;
+  }
+  if (from._internal_has_top_level_struct_with_empty_list()) {
+    top_level_struct_with_empty_list_ = new PROTOBUF_NAMESPACE_ID::Struct(*from.top_level_struct_with_empty_list_);
+  } else {
+    top_level_struct_with_empty_list_ = nullptr;
+  }
+  if (from._internal_has_top_level_struct_with_list_with_empty_struct()) {
+    top_level_struct_with_list_with_empty_struct_ = new PROTOBUF_NAMESPACE_ID::Struct(*from.top_level_struct_with_list_with_empty_struct_);
+  } else {
+    top_level_struct_with_list_with_empty_struct_ = nullptr;
+  }
+  if (from._internal_has_value_wrapper_simple()) {
+    value_wrapper_simple_ = new ::proto_util_converter::testing::ValueWrapper(*from.value_wrapper_simple_);
+  } else {
+    value_wrapper_simple_ = nullptr;
+  }
+  if (from._internal_has_value_wrapper_with_struct()) {
+    value_wrapper_with_struct_ = new ::proto_util_converter::testing::ValueWrapper(*from.value_wrapper_with_struct_);
+  } else {
+    value_wrapper_with_struct_ = nullptr;
+  }
+  if (from._internal_has_value_wrapper_with_list()) {
+    value_wrapper_with_list_ = new ::proto_util_converter::testing::ValueWrapper(*from.value_wrapper_with_list_);
+  } else {
+    value_wrapper_with_list_ = nullptr;
+  }
+  if (from._internal_has_value_wrapper_with_empty_list()) {
+    value_wrapper_with_empty_list_ = new ::proto_util_converter::testing::ValueWrapper(*from.value_wrapper_with_empty_list_);
+  } else {
+    value_wrapper_with_empty_list_ = nullptr;
+  }
+  if (from._internal_has_value_wrapper_with_list_with_empty_struct()) {
+    value_wrapper_with_list_with_empty_struct_ = new ::proto_util_converter::testing::ValueWrapper(*from.value_wrapper_with_list_with_empty_struct_);
+  } else {
+    value_wrapper_with_list_with_empty_struct_ = nullptr;
+  }
+  if (from._internal_has_list_value_wrapper()) {
+    list_value_wrapper_ = new ::proto_util_converter::testing::ListValueWrapper(*from.list_value_wrapper_);
+  } else {
+    list_value_wrapper_ = nullptr;
+  }
+  if (from._internal_has_list_value_wrapper_with_empty_list()) {
+    list_value_wrapper_with_empty_list_ = new ::proto_util_converter::testing::ListValueWrapper(*from.list_value_wrapper_with_empty_list_);
+  } else {
+    list_value_wrapper_with_empty_list_ = nullptr;
+  }
+  if (from._internal_has_list_value_wrapper_with_list_with_empty_struct()) {
+    list_value_wrapper_with_list_with_empty_struct_ = new ::proto_util_converter::testing::ListValueWrapper(*from.list_value_wrapper_with_list_with_empty_struct_);
+  } else {
+    list_value_wrapper_with_list_with_empty_struct_ = nullptr;
+  }
+  if (from._internal_has_top_level_value_simple()) {
+    top_level_value_simple_ = new PROTOBUF_NAMESPACE_ID::Value(*from.top_level_value_simple_);
+  } else {
+    top_level_value_simple_ = nullptr;
+  }
+  if (from._internal_has_top_level_value_with_struct()) {
+    top_level_value_with_struct_ = new PROTOBUF_NAMESPACE_ID::Value(*from.top_level_value_with_struct_);
+  } else {
+    top_level_value_with_struct_ = nullptr;
+  }
+  if (from._internal_has_top_level_value_with_list()) {
+    top_level_value_with_list_ = new PROTOBUF_NAMESPACE_ID::Value(*from.top_level_value_with_list_);
+  } else {
+    top_level_value_with_list_ = nullptr;
+  }
+  if (from._internal_has_top_level_value_with_empty_list()) {
+    top_level_value_with_empty_list_ = new PROTOBUF_NAMESPACE_ID::Value(*from.top_level_value_with_empty_list_);
+  } else {
+    top_level_value_with_empty_list_ = nullptr;
+  }
+  if (from._internal_has_top_level_value_with_list_with_empty_struct()) {
+    top_level_value_with_list_with_empty_struct_ = new PROTOBUF_NAMESPACE_ID::Value(*from.top_level_value_with_list_with_empty_struct_);
+  } else {
+    top_level_value_with_list_with_empty_struct_ = nullptr;
+  }
+  if (from._internal_has_top_level_listvalue()) {
+    top_level_listvalue_ = new PROTOBUF_NAMESPACE_ID::ListValue(*from.top_level_listvalue_);
+  } else {
+    top_level_listvalue_ = nullptr;
+  }
+  if (from._internal_has_top_level_empty_listvalue()) {
+    top_level_empty_listvalue_ = new PROTOBUF_NAMESPACE_ID::ListValue(*from.top_level_empty_listvalue_);
+  } else {
+    top_level_empty_listvalue_ = nullptr;
+  }
+  if (from._internal_has_top_level_listvalue_with_empty_struct()) {
+    top_level_listvalue_with_empty_struct_ = new PROTOBUF_NAMESPACE_ID::ListValue(*from.top_level_listvalue_with_empty_struct_);
+  } else {
+    top_level_listvalue_with_empty_struct_ = nullptr;
+  }
+  if (from._internal_has_repeated_value()) {
+    repeated_value_ = new ::proto_util_converter::testing::RepeatedValueWrapper(*from.repeated_value_);
+  } else {
+    repeated_value_ = nullptr;
+  }
+  if (from._internal_has_repeated_value_nested_list()) {
+    repeated_value_nested_list_ = new ::proto_util_converter::testing::RepeatedValueWrapper(*from.repeated_value_nested_list_);
+  } else {
+    repeated_value_nested_list_ = nullptr;
+  }
+  if (from._internal_has_repeated_value_nested_list2()) {
+    repeated_value_nested_list2_ = new ::proto_util_converter::testing::RepeatedValueWrapper(*from.repeated_value_nested_list2_);
+  } else {
+    repeated_value_nested_list2_ = nullptr;
+  }
+  if (from._internal_has_repeated_value_nested_list3()) {
+    repeated_value_nested_list3_ = new ::proto_util_converter::testing::RepeatedValueWrapper(*from.repeated_value_nested_list3_);
+  } else {
+    repeated_value_nested_list3_ = nullptr;
+  }
+  if (from._internal_has_repeated_listvalue()) {
+    repeated_listvalue_ = new ::proto_util_converter::testing::RepeatedListValueWrapper(*from.repeated_listvalue_);
+  } else {
+    repeated_listvalue_ = nullptr;
+  }
+  if (from._internal_has_map_of_struct()) {
+    map_of_struct_ = new ::proto_util_converter::testing::MapOfStruct(*from.map_of_struct_);
+  } else {
+    map_of_struct_ = nullptr;
+  }
+  if (from._internal_has_map_of_struct_value()) {
+    map_of_struct_value_ = new ::proto_util_converter::testing::MapOfStruct(*from.map_of_struct_value_);
+  } else {
+    map_of_struct_value_ = nullptr;
+  }
+  if (from._internal_has_map_of_listvalue()) {
+    map_of_listvalue_ = new ::proto_util_converter::testing::MapOfStruct(*from.map_of_listvalue_);
+  } else {
+    map_of_listvalue_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.StructTestCases)
+}
+
+void StructTestCases::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_StructTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+  ::memset(&empty_value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&map_of_listvalue_) -
+      reinterpret_cast<char*>(&empty_value_)) + sizeof(map_of_listvalue_));
+}
+
+StructTestCases::~StructTestCases() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.StructTestCases)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void StructTestCases::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete empty_value_;
+  if (this != internal_default_instance()) delete empty_value2_;
+  if (this != internal_default_instance()) delete null_value_;
+  if (this != internal_default_instance()) delete simple_struct_;
+  if (this != internal_default_instance()) delete longer_struct_;
+  if (this != internal_default_instance()) delete struct_with_nested_struct_;
+  if (this != internal_default_instance()) delete struct_with_nested_list_;
+  if (this != internal_default_instance()) delete struct_with_list_of_nulls_;
+  if (this != internal_default_instance()) delete struct_with_list_of_lists_;
+  if (this != internal_default_instance()) delete struct_with_list_of_structs_;
+  if (this != internal_default_instance()) delete struct_with_empty_list_;
+  if (this != internal_default_instance()) delete struct_with_list_with_empty_struct_;
+  if (this != internal_default_instance()) delete top_level_struct_;
+  if (this != internal_default_instance()) delete top_level_struct_with_empty_list_;
+  if (this != internal_default_instance()) delete top_level_struct_with_list_with_empty_struct_;
+  if (this != internal_default_instance()) delete value_wrapper_simple_;
+  if (this != internal_default_instance()) delete value_wrapper_with_struct_;
+  if (this != internal_default_instance()) delete value_wrapper_with_list_;
+  if (this != internal_default_instance()) delete value_wrapper_with_empty_list_;
+  if (this != internal_default_instance()) delete value_wrapper_with_list_with_empty_struct_;
+  if (this != internal_default_instance()) delete list_value_wrapper_;
+  if (this != internal_default_instance()) delete list_value_wrapper_with_empty_list_;
+  if (this != internal_default_instance()) delete list_value_wrapper_with_list_with_empty_struct_;
+  if (this != internal_default_instance()) delete top_level_value_simple_;
+  if (this != internal_default_instance()) delete top_level_value_with_struct_;
+  if (this != internal_default_instance()) delete top_level_value_with_list_;
+  if (this != internal_default_instance()) delete top_level_value_with_empty_list_;
+  if (this != internal_default_instance()) delete top_level_value_with_list_with_empty_struct_;
+  if (this != internal_default_instance()) delete top_level_listvalue_;
+  if (this != internal_default_instance()) delete top_level_empty_listvalue_;
+  if (this != internal_default_instance()) delete top_level_listvalue_with_empty_struct_;
+  if (this != internal_default_instance()) delete repeated_value_;
+  if (this != internal_default_instance()) delete repeated_value_nested_list_;
+  if (this != internal_default_instance()) delete repeated_value_nested_list2_;
+  if (this != internal_default_instance()) delete repeated_value_nested_list3_;
+  if (this != internal_default_instance()) delete repeated_listvalue_;
+  if (this != internal_default_instance()) delete map_of_struct_;
+  if (this != internal_default_instance()) delete map_of_struct_value_;
+  if (this != internal_default_instance()) delete map_of_listvalue_;
+}
+
+void StructTestCases::ArenaDtor(void* object) {
+  StructTestCases* _this = reinterpret_cast< StructTestCases* >(object);
+  (void)_this;
+}
+void StructTestCases::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void StructTestCases::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const StructTestCases& StructTestCases::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_StructTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void StructTestCases::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.StructTestCases)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && empty_value_ != nullptr) {
+    delete empty_value_;
+  }
+  empty_value_ = nullptr;
+  if (GetArena() == nullptr && empty_value2_ != nullptr) {
+    delete empty_value2_;
+  }
+  empty_value2_ = nullptr;
+  if (GetArena() == nullptr && null_value_ != nullptr) {
+    delete null_value_;
+  }
+  null_value_ = nullptr;
+  if (GetArena() == nullptr && simple_struct_ != nullptr) {
+    delete simple_struct_;
+  }
+  simple_struct_ = nullptr;
+  if (GetArena() == nullptr && longer_struct_ != nullptr) {
+    delete longer_struct_;
+  }
+  longer_struct_ = nullptr;
+  if (GetArena() == nullptr && struct_with_nested_struct_ != nullptr) {
+    delete struct_with_nested_struct_;
+  }
+  struct_with_nested_struct_ = nullptr;
+  if (GetArena() == nullptr && struct_with_nested_list_ != nullptr) {
+    delete struct_with_nested_list_;
+  }
+  struct_with_nested_list_ = nullptr;
+  if (GetArena() == nullptr && struct_with_list_of_nulls_ != nullptr) {
+    delete struct_with_list_of_nulls_;
+  }
+  struct_with_list_of_nulls_ = nullptr;
+  if (GetArena() == nullptr && struct_with_list_of_lists_ != nullptr) {
+    delete struct_with_list_of_lists_;
+  }
+  struct_with_list_of_lists_ = nullptr;
+  if (GetArena() == nullptr && struct_with_list_of_structs_ != nullptr) {
+    delete struct_with_list_of_structs_;
+  }
+  struct_with_list_of_structs_ = nullptr;
+  if (GetArena() == nullptr && struct_with_empty_list_ != nullptr) {
+    delete struct_with_empty_list_;
+  }
+  struct_with_empty_list_ = nullptr;
+  if (GetArena() == nullptr && struct_with_list_with_empty_struct_ != nullptr) {
+    delete struct_with_list_with_empty_struct_;
+  }
+  struct_with_list_with_empty_struct_ = nullptr;
+  if (GetArena() == nullptr && top_level_struct_ != nullptr) {
+    delete top_level_struct_;
+  }
+  top_level_struct_ = nullptr;
+  if (GetArena() == nullptr && top_level_struct_with_empty_list_ != nullptr) {
+    delete top_level_struct_with_empty_list_;
+  }
+  top_level_struct_with_empty_list_ = nullptr;
+  if (GetArena() == nullptr && top_level_struct_with_list_with_empty_struct_ != nullptr) {
+    delete top_level_struct_with_list_with_empty_struct_;
+  }
+  top_level_struct_with_list_with_empty_struct_ = nullptr;
+  if (GetArena() == nullptr && value_wrapper_simple_ != nullptr) {
+    delete value_wrapper_simple_;
+  }
+  value_wrapper_simple_ = nullptr;
+  if (GetArena() == nullptr && value_wrapper_with_struct_ != nullptr) {
+    delete value_wrapper_with_struct_;
+  }
+  value_wrapper_with_struct_ = nullptr;
+  if (GetArena() == nullptr && value_wrapper_with_list_ != nullptr) {
+    delete value_wrapper_with_list_;
+  }
+  value_wrapper_with_list_ = nullptr;
+  if (GetArena() == nullptr && value_wrapper_with_empty_list_ != nullptr) {
+    delete value_wrapper_with_empty_list_;
+  }
+  value_wrapper_with_empty_list_ = nullptr;
+  if (GetArena() == nullptr && value_wrapper_with_list_with_empty_struct_ != nullptr) {
+    delete value_wrapper_with_list_with_empty_struct_;
+  }
+  value_wrapper_with_list_with_empty_struct_ = nullptr;
+  if (GetArena() == nullptr && list_value_wrapper_ != nullptr) {
+    delete list_value_wrapper_;
+  }
+  list_value_wrapper_ = nullptr;
+  if (GetArena() == nullptr && list_value_wrapper_with_empty_list_ != nullptr) {
+    delete list_value_wrapper_with_empty_list_;
+  }
+  list_value_wrapper_with_empty_list_ = nullptr;
+  if (GetArena() == nullptr && list_value_wrapper_with_list_with_empty_struct_ != nullptr) {
+    delete list_value_wrapper_with_list_with_empty_struct_;
+  }
+  list_value_wrapper_with_list_with_empty_struct_ = nullptr;
+  if (GetArena() == nullptr && top_level_value_simple_ != nullptr) {
+    delete top_level_value_simple_;
+  }
+  top_level_value_simple_ = nullptr;
+  if (GetArena() == nullptr && top_level_value_with_struct_ != nullptr) {
+    delete top_level_value_with_struct_;
+  }
+  top_level_value_with_struct_ = nullptr;
+  if (GetArena() == nullptr && top_level_value_with_list_ != nullptr) {
+    delete top_level_value_with_list_;
+  }
+  top_level_value_with_list_ = nullptr;
+  if (GetArena() == nullptr && top_level_value_with_empty_list_ != nullptr) {
+    delete top_level_value_with_empty_list_;
+  }
+  top_level_value_with_empty_list_ = nullptr;
+  if (GetArena() == nullptr && top_level_value_with_list_with_empty_struct_ != nullptr) {
+    delete top_level_value_with_list_with_empty_struct_;
+  }
+  top_level_value_with_list_with_empty_struct_ = nullptr;
+  if (GetArena() == nullptr && top_level_listvalue_ != nullptr) {
+    delete top_level_listvalue_;
+  }
+  top_level_listvalue_ = nullptr;
+  if (GetArena() == nullptr && top_level_empty_listvalue_ != nullptr) {
+    delete top_level_empty_listvalue_;
+  }
+  top_level_empty_listvalue_ = nullptr;
+  if (GetArena() == nullptr && top_level_listvalue_with_empty_struct_ != nullptr) {
+    delete top_level_listvalue_with_empty_struct_;
+  }
+  top_level_listvalue_with_empty_struct_ = nullptr;
+  if (GetArena() == nullptr && repeated_value_ != nullptr) {
+    delete repeated_value_;
+  }
+  repeated_value_ = nullptr;
+  if (GetArena() == nullptr && repeated_value_nested_list_ != nullptr) {
+    delete repeated_value_nested_list_;
+  }
+  repeated_value_nested_list_ = nullptr;
+  if (GetArena() == nullptr && repeated_value_nested_list2_ != nullptr) {
+    delete repeated_value_nested_list2_;
+  }
+  repeated_value_nested_list2_ = nullptr;
+  if (GetArena() == nullptr && repeated_value_nested_list3_ != nullptr) {
+    delete repeated_value_nested_list3_;
+  }
+  repeated_value_nested_list3_ = nullptr;
+  if (GetArena() == nullptr && repeated_listvalue_ != nullptr) {
+    delete repeated_listvalue_;
+  }
+  repeated_listvalue_ = nullptr;
+  if (GetArena() == nullptr && map_of_struct_ != nullptr) {
+    delete map_of_struct_;
+  }
+  map_of_struct_ = nullptr;
+  if (GetArena() == nullptr && map_of_struct_value_ != nullptr) {
+    delete map_of_struct_value_;
+  }
+  map_of_struct_value_ = nullptr;
+  if (GetArena() == nullptr && map_of_listvalue_ != nullptr) {
+    delete map_of_listvalue_;
+  }
+  map_of_listvalue_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StructTestCases::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .proto_util_converter.testing.StructWrapper empty_value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_empty_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.StructWrapper empty_value2 = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_empty_value2(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.StructWrapper null_value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_null_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.StructWrapper simple_struct = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_simple_struct(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.StructWrapper longer_struct = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_longer_struct(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.StructWrapper struct_with_nested_struct = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_struct_with_nested_struct(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.StructWrapper struct_with_nested_list = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_struct_with_nested_list(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.StructWrapper struct_with_list_of_nulls = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_struct_with_list_of_nulls(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.StructWrapper struct_with_list_of_lists = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_struct_with_list_of_lists(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.StructWrapper struct_with_list_of_structs = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_struct_with_list_of_structs(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.StructWrapper struct_with_empty_list = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_struct_with_empty_list(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.StructWrapper struct_with_list_with_empty_struct = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_struct_with_list_with_empty_struct(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Struct top_level_struct = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_struct(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Struct top_level_struct_with_empty_list = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_struct_with_empty_list(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Struct top_level_struct_with_list_with_empty_struct = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_struct_with_list_with_empty_struct(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.ValueWrapper value_wrapper_simple = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value_wrapper_simple(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.ValueWrapper value_wrapper_with_struct = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value_wrapper_with_struct(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.ValueWrapper value_wrapper_with_list = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value_wrapper_with_list(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.ValueWrapper value_wrapper_with_empty_list = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value_wrapper_with_empty_list(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.ValueWrapper value_wrapper_with_list_with_empty_struct = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 162)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value_wrapper_with_list_with_empty_struct(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.ListValueWrapper list_value_wrapper = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 170)) {
+          ptr = ctx->ParseMessage(_internal_mutable_list_value_wrapper(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.ListValueWrapper list_value_wrapper_with_empty_list = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 178)) {
+          ptr = ctx->ParseMessage(_internal_mutable_list_value_wrapper_with_empty_list(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.ListValueWrapper list_value_wrapper_with_list_with_empty_struct = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 186)) {
+          ptr = ctx->ParseMessage(_internal_mutable_list_value_wrapper_with_list_with_empty_struct(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Value top_level_value_simple = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 194)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_value_simple(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Value top_level_value_with_struct = 25;
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 202)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_value_with_struct(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Value top_level_value_with_list = 26;
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 210)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_value_with_list(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Value top_level_value_with_empty_list = 27;
+      case 27:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 218)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_value_with_empty_list(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Value top_level_value_with_list_with_empty_struct = 28;
+      case 28:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 226)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_value_with_list_with_empty_struct(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.ListValue top_level_listvalue = 29;
+      case 29:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 234)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_listvalue(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.ListValue top_level_empty_listvalue = 30;
+      case 30:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 242)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_empty_listvalue(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.ListValue top_level_listvalue_with_empty_struct = 31;
+      case 31:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 250)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top_level_listvalue_with_empty_struct(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.RepeatedValueWrapper repeated_value = 32;
+      case 32:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 2)) {
+          ptr = ctx->ParseMessage(_internal_mutable_repeated_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.RepeatedValueWrapper repeated_value_nested_list = 33;
+      case 33:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_repeated_value_nested_list(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.RepeatedValueWrapper repeated_value_nested_list2 = 34;
+      case 34:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_repeated_value_nested_list2(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.RepeatedValueWrapper repeated_value_nested_list3 = 35;
+      case 35:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_repeated_value_nested_list3(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.RepeatedListValueWrapper repeated_listvalue = 36;
+      case 36:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_repeated_listvalue(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.MapOfStruct map_of_struct = 37;
+      case 37:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_map_of_struct(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.MapOfStruct map_of_struct_value = 38;
+      case 38:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_map_of_struct_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.MapOfStruct map_of_listvalue = 39;
+      case 39:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_map_of_listvalue(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* StructTestCases::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.StructTestCases)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .proto_util_converter.testing.StructWrapper empty_value = 1;
+  if (this->has_empty_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::empty_value(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.StructWrapper empty_value2 = 2;
+  if (this->has_empty_value2()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::empty_value2(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.StructWrapper null_value = 3;
+  if (this->has_null_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::null_value(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.StructWrapper simple_struct = 4;
+  if (this->has_simple_struct()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::simple_struct(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.StructWrapper longer_struct = 5;
+  if (this->has_longer_struct()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        5, _Internal::longer_struct(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.StructWrapper struct_with_nested_struct = 6;
+  if (this->has_struct_with_nested_struct()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        6, _Internal::struct_with_nested_struct(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.StructWrapper struct_with_nested_list = 7;
+  if (this->has_struct_with_nested_list()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        7, _Internal::struct_with_nested_list(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.StructWrapper struct_with_list_of_nulls = 8;
+  if (this->has_struct_with_list_of_nulls()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        8, _Internal::struct_with_list_of_nulls(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.StructWrapper struct_with_list_of_lists = 9;
+  if (this->has_struct_with_list_of_lists()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        9, _Internal::struct_with_list_of_lists(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.StructWrapper struct_with_list_of_structs = 10;
+  if (this->has_struct_with_list_of_structs()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        10, _Internal::struct_with_list_of_structs(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.StructWrapper struct_with_empty_list = 11;
+  if (this->has_struct_with_empty_list()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        11, _Internal::struct_with_empty_list(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.StructWrapper struct_with_list_with_empty_struct = 12;
+  if (this->has_struct_with_list_with_empty_struct()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        12, _Internal::struct_with_list_with_empty_struct(this), target, stream);
+  }
+
+  // .google.protobuf.Struct top_level_struct = 13;
+  if (this->has_top_level_struct()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        13, _Internal::top_level_struct(this), target, stream);
+  }
+
+  // .google.protobuf.Struct top_level_struct_with_empty_list = 14;
+  if (this->has_top_level_struct_with_empty_list()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        14, _Internal::top_level_struct_with_empty_list(this), target, stream);
+  }
+
+  // .google.protobuf.Struct top_level_struct_with_list_with_empty_struct = 15;
+  if (this->has_top_level_struct_with_list_with_empty_struct()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        15, _Internal::top_level_struct_with_list_with_empty_struct(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.ValueWrapper value_wrapper_simple = 16;
+  if (this->has_value_wrapper_simple()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        16, _Internal::value_wrapper_simple(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.ValueWrapper value_wrapper_with_struct = 17;
+  if (this->has_value_wrapper_with_struct()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        17, _Internal::value_wrapper_with_struct(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.ValueWrapper value_wrapper_with_list = 18;
+  if (this->has_value_wrapper_with_list()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        18, _Internal::value_wrapper_with_list(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.ValueWrapper value_wrapper_with_empty_list = 19;
+  if (this->has_value_wrapper_with_empty_list()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        19, _Internal::value_wrapper_with_empty_list(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.ValueWrapper value_wrapper_with_list_with_empty_struct = 20;
+  if (this->has_value_wrapper_with_list_with_empty_struct()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        20, _Internal::value_wrapper_with_list_with_empty_struct(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.ListValueWrapper list_value_wrapper = 21;
+  if (this->has_list_value_wrapper()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        21, _Internal::list_value_wrapper(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.ListValueWrapper list_value_wrapper_with_empty_list = 22;
+  if (this->has_list_value_wrapper_with_empty_list()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        22, _Internal::list_value_wrapper_with_empty_list(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.ListValueWrapper list_value_wrapper_with_list_with_empty_struct = 23;
+  if (this->has_list_value_wrapper_with_list_with_empty_struct()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        23, _Internal::list_value_wrapper_with_list_with_empty_struct(this), target, stream);
+  }
+
+  // .google.protobuf.Value top_level_value_simple = 24;
+  if (this->has_top_level_value_simple()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        24, _Internal::top_level_value_simple(this), target, stream);
+  }
+
+  // .google.protobuf.Value top_level_value_with_struct = 25;
+  if (this->has_top_level_value_with_struct()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        25, _Internal::top_level_value_with_struct(this), target, stream);
+  }
+
+  // .google.protobuf.Value top_level_value_with_list = 26;
+  if (this->has_top_level_value_with_list()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        26, _Internal::top_level_value_with_list(this), target, stream);
+  }
+
+  // .google.protobuf.Value top_level_value_with_empty_list = 27;
+  if (this->has_top_level_value_with_empty_list()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        27, _Internal::top_level_value_with_empty_list(this), target, stream);
+  }
+
+  // .google.protobuf.Value top_level_value_with_list_with_empty_struct = 28;
+  if (this->has_top_level_value_with_list_with_empty_struct()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        28, _Internal::top_level_value_with_list_with_empty_struct(this), target, stream);
+  }
+
+  // .google.protobuf.ListValue top_level_listvalue = 29;
+  if (this->has_top_level_listvalue()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        29, _Internal::top_level_listvalue(this), target, stream);
+  }
+
+  // .google.protobuf.ListValue top_level_empty_listvalue = 30;
+  if (this->has_top_level_empty_listvalue()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        30, _Internal::top_level_empty_listvalue(this), target, stream);
+  }
+
+  // .google.protobuf.ListValue top_level_listvalue_with_empty_struct = 31;
+  if (this->has_top_level_listvalue_with_empty_struct()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        31, _Internal::top_level_listvalue_with_empty_struct(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.RepeatedValueWrapper repeated_value = 32;
+  if (this->has_repeated_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        32, _Internal::repeated_value(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.RepeatedValueWrapper repeated_value_nested_list = 33;
+  if (this->has_repeated_value_nested_list()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        33, _Internal::repeated_value_nested_list(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.RepeatedValueWrapper repeated_value_nested_list2 = 34;
+  if (this->has_repeated_value_nested_list2()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        34, _Internal::repeated_value_nested_list2(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.RepeatedValueWrapper repeated_value_nested_list3 = 35;
+  if (this->has_repeated_value_nested_list3()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        35, _Internal::repeated_value_nested_list3(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.RepeatedListValueWrapper repeated_listvalue = 36;
+  if (this->has_repeated_listvalue()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        36, _Internal::repeated_listvalue(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.MapOfStruct map_of_struct = 37;
+  if (this->has_map_of_struct()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        37, _Internal::map_of_struct(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.MapOfStruct map_of_struct_value = 38;
+  if (this->has_map_of_struct_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        38, _Internal::map_of_struct_value(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.MapOfStruct map_of_listvalue = 39;
+  if (this->has_map_of_listvalue()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        39, _Internal::map_of_listvalue(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.StructTestCases)
+  return target;
+}
+
+size_t StructTestCases::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.StructTestCases)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .proto_util_converter.testing.StructWrapper empty_value = 1;
+  if (this->has_empty_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *empty_value_);
+  }
+
+  // .proto_util_converter.testing.StructWrapper empty_value2 = 2;
+  if (this->has_empty_value2()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *empty_value2_);
+  }
+
+  // .proto_util_converter.testing.StructWrapper null_value = 3;
+  if (this->has_null_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *null_value_);
+  }
+
+  // .proto_util_converter.testing.StructWrapper simple_struct = 4;
+  if (this->has_simple_struct()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *simple_struct_);
+  }
+
+  // .proto_util_converter.testing.StructWrapper longer_struct = 5;
+  if (this->has_longer_struct()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *longer_struct_);
+  }
+
+  // .proto_util_converter.testing.StructWrapper struct_with_nested_struct = 6;
+  if (this->has_struct_with_nested_struct()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *struct_with_nested_struct_);
+  }
+
+  // .proto_util_converter.testing.StructWrapper struct_with_nested_list = 7;
+  if (this->has_struct_with_nested_list()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *struct_with_nested_list_);
+  }
+
+  // .proto_util_converter.testing.StructWrapper struct_with_list_of_nulls = 8;
+  if (this->has_struct_with_list_of_nulls()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *struct_with_list_of_nulls_);
+  }
+
+  // .proto_util_converter.testing.StructWrapper struct_with_list_of_lists = 9;
+  if (this->has_struct_with_list_of_lists()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *struct_with_list_of_lists_);
+  }
+
+  // .proto_util_converter.testing.StructWrapper struct_with_list_of_structs = 10;
+  if (this->has_struct_with_list_of_structs()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *struct_with_list_of_structs_);
+  }
+
+  // .proto_util_converter.testing.StructWrapper struct_with_empty_list = 11;
+  if (this->has_struct_with_empty_list()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *struct_with_empty_list_);
+  }
+
+  // .proto_util_converter.testing.StructWrapper struct_with_list_with_empty_struct = 12;
+  if (this->has_struct_with_list_with_empty_struct()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *struct_with_list_with_empty_struct_);
+  }
+
+  // .google.protobuf.Struct top_level_struct = 13;
+  if (this->has_top_level_struct()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_struct_);
+  }
+
+  // .google.protobuf.Struct top_level_struct_with_empty_list = 14;
+  if (this->has_top_level_struct_with_empty_list()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_struct_with_empty_list_);
+  }
+
+  // .google.protobuf.Struct top_level_struct_with_list_with_empty_struct = 15;
+  if (this->has_top_level_struct_with_list_with_empty_struct()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_struct_with_list_with_empty_struct_);
+  }
+
+  // .proto_util_converter.testing.ValueWrapper value_wrapper_simple = 16;
+  if (this->has_value_wrapper_simple()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *value_wrapper_simple_);
+  }
+
+  // .proto_util_converter.testing.ValueWrapper value_wrapper_with_struct = 17;
+  if (this->has_value_wrapper_with_struct()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *value_wrapper_with_struct_);
+  }
+
+  // .proto_util_converter.testing.ValueWrapper value_wrapper_with_list = 18;
+  if (this->has_value_wrapper_with_list()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *value_wrapper_with_list_);
+  }
+
+  // .proto_util_converter.testing.ValueWrapper value_wrapper_with_empty_list = 19;
+  if (this->has_value_wrapper_with_empty_list()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *value_wrapper_with_empty_list_);
+  }
+
+  // .proto_util_converter.testing.ValueWrapper value_wrapper_with_list_with_empty_struct = 20;
+  if (this->has_value_wrapper_with_list_with_empty_struct()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *value_wrapper_with_list_with_empty_struct_);
+  }
+
+  // .proto_util_converter.testing.ListValueWrapper list_value_wrapper = 21;
+  if (this->has_list_value_wrapper()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *list_value_wrapper_);
+  }
+
+  // .proto_util_converter.testing.ListValueWrapper list_value_wrapper_with_empty_list = 22;
+  if (this->has_list_value_wrapper_with_empty_list()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *list_value_wrapper_with_empty_list_);
+  }
+
+  // .proto_util_converter.testing.ListValueWrapper list_value_wrapper_with_list_with_empty_struct = 23;
+  if (this->has_list_value_wrapper_with_list_with_empty_struct()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *list_value_wrapper_with_list_with_empty_struct_);
+  }
+
+  // .google.protobuf.Value top_level_value_simple = 24;
+  if (this->has_top_level_value_simple()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_value_simple_);
+  }
+
+  // .google.protobuf.Value top_level_value_with_struct = 25;
+  if (this->has_top_level_value_with_struct()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_value_with_struct_);
+  }
+
+  // .google.protobuf.Value top_level_value_with_list = 26;
+  if (this->has_top_level_value_with_list()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_value_with_list_);
+  }
+
+  // .google.protobuf.Value top_level_value_with_empty_list = 27;
+  if (this->has_top_level_value_with_empty_list()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_value_with_empty_list_);
+  }
+
+  // .google.protobuf.Value top_level_value_with_list_with_empty_struct = 28;
+  if (this->has_top_level_value_with_list_with_empty_struct()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_value_with_list_with_empty_struct_);
+  }
+
+  // .google.protobuf.ListValue top_level_listvalue = 29;
+  if (this->has_top_level_listvalue()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_listvalue_);
+  }
+
+  // .google.protobuf.ListValue top_level_empty_listvalue = 30;
+  if (this->has_top_level_empty_listvalue()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_empty_listvalue_);
+  }
+
+  // .google.protobuf.ListValue top_level_listvalue_with_empty_struct = 31;
+  if (this->has_top_level_listvalue_with_empty_struct()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *top_level_listvalue_with_empty_struct_);
+  }
+
+  // .proto_util_converter.testing.RepeatedValueWrapper repeated_value = 32;
+  if (this->has_repeated_value()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *repeated_value_);
+  }
+
+  // .proto_util_converter.testing.RepeatedValueWrapper repeated_value_nested_list = 33;
+  if (this->has_repeated_value_nested_list()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *repeated_value_nested_list_);
+  }
+
+  // .proto_util_converter.testing.RepeatedValueWrapper repeated_value_nested_list2 = 34;
+  if (this->has_repeated_value_nested_list2()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *repeated_value_nested_list2_);
+  }
+
+  // .proto_util_converter.testing.RepeatedValueWrapper repeated_value_nested_list3 = 35;
+  if (this->has_repeated_value_nested_list3()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *repeated_value_nested_list3_);
+  }
+
+  // .proto_util_converter.testing.RepeatedListValueWrapper repeated_listvalue = 36;
+  if (this->has_repeated_listvalue()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *repeated_listvalue_);
+  }
+
+  // .proto_util_converter.testing.MapOfStruct map_of_struct = 37;
+  if (this->has_map_of_struct()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *map_of_struct_);
+  }
+
+  // .proto_util_converter.testing.MapOfStruct map_of_struct_value = 38;
+  if (this->has_map_of_struct_value()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *map_of_struct_value_);
+  }
+
+  // .proto_util_converter.testing.MapOfStruct map_of_listvalue = 39;
+  if (this->has_map_of_listvalue()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *map_of_listvalue_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void StructTestCases::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.StructTestCases)
+  GOOGLE_DCHECK_NE(&from, this);
+  const StructTestCases* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<StructTestCases>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.StructTestCases)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.StructTestCases)
+    MergeFrom(*source);
+  }
+}
+
+void StructTestCases::MergeFrom(const StructTestCases& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.StructTestCases)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_empty_value()) {
+    _internal_mutable_empty_value()->::proto_util_converter::testing::StructWrapper::MergeFrom(from._internal_empty_value());
+  }
+  if (from.has_empty_value2()) {
+    _internal_mutable_empty_value2()->::proto_util_converter::testing::StructWrapper::MergeFrom(from._internal_empty_value2());
+  }
+  if (from.has_null_value()) {
+    _internal_mutable_null_value()->::proto_util_converter::testing::StructWrapper::MergeFrom(from._internal_null_value());
+  }
+  if (from.has_simple_struct()) {
+    _internal_mutable_simple_struct()->::proto_util_converter::testing::StructWrapper::MergeFrom(from._internal_simple_struct());
+  }
+  if (from.has_longer_struct()) {
+    _internal_mutable_longer_struct()->::proto_util_converter::testing::StructWrapper::MergeFrom(from._internal_longer_struct());
+  }
+  if (from.has_struct_with_nested_struct()) {
+    _internal_mutable_struct_with_nested_struct()->::proto_util_converter::testing::StructWrapper::MergeFrom(from._internal_struct_with_nested_struct());
+  }
+  if (from.has_struct_with_nested_list()) {
+    _internal_mutable_struct_with_nested_list()->::proto_util_converter::testing::StructWrapper::MergeFrom(from._internal_struct_with_nested_list());
+  }
+  if (from.has_struct_with_list_of_nulls()) {
+    _internal_mutable_struct_with_list_of_nulls()->::proto_util_converter::testing::StructWrapper::MergeFrom(from._internal_struct_with_list_of_nulls());
+  }
+  if (from.has_struct_with_list_of_lists()) {
+    _internal_mutable_struct_with_list_of_lists()->::proto_util_converter::testing::StructWrapper::MergeFrom(from._internal_struct_with_list_of_lists());
+  }
+  if (from.has_struct_with_list_of_structs()) {
+    _internal_mutable_struct_with_list_of_structs()->::proto_util_converter::testing::StructWrapper::MergeFrom(from._internal_struct_with_list_of_structs());
+  }
+  if (from.has_struct_with_empty_list()) {
+    _internal_mutable_struct_with_empty_list()->::proto_util_converter::testing::StructWrapper::MergeFrom(from._internal_struct_with_empty_list());
+  }
+  if (from.has_struct_with_list_with_empty_struct()) {
+    _internal_mutable_struct_with_list_with_empty_struct()->::proto_util_converter::testing::StructWrapper::MergeFrom(from._internal_struct_with_list_with_empty_struct());
+  }
+  if (from.has_top_level_struct()) {
+    _internal_mutable_top_level_struct()->PROTOBUF_NAMESPACE_ID::Struct::MergeFrom(from._internal_top_level_struct());
+  }
+  if (from.has_top_level_struct_with_empty_list()) {
+    _internal_mutable_top_level_struct_with_empty_list()->PROTOBUF_NAMESPACE_ID::Struct::MergeFrom(from._internal_top_level_struct_with_empty_list());
+  }
+  if (from.has_top_level_struct_with_list_with_empty_struct()) {
+    _internal_mutable_top_level_struct_with_list_with_empty_struct()->PROTOBUF_NAMESPACE_ID::Struct::MergeFrom(from._internal_top_level_struct_with_list_with_empty_struct());
+  }
+  if (from.has_value_wrapper_simple()) {
+    _internal_mutable_value_wrapper_simple()->::proto_util_converter::testing::ValueWrapper::MergeFrom(from._internal_value_wrapper_simple());
+  }
+  if (from.has_value_wrapper_with_struct()) {
+    _internal_mutable_value_wrapper_with_struct()->::proto_util_converter::testing::ValueWrapper::MergeFrom(from._internal_value_wrapper_with_struct());
+  }
+  if (from.has_value_wrapper_with_list()) {
+    _internal_mutable_value_wrapper_with_list()->::proto_util_converter::testing::ValueWrapper::MergeFrom(from._internal_value_wrapper_with_list());
+  }
+  if (from.has_value_wrapper_with_empty_list()) {
+    _internal_mutable_value_wrapper_with_empty_list()->::proto_util_converter::testing::ValueWrapper::MergeFrom(from._internal_value_wrapper_with_empty_list());
+  }
+  if (from.has_value_wrapper_with_list_with_empty_struct()) {
+    _internal_mutable_value_wrapper_with_list_with_empty_struct()->::proto_util_converter::testing::ValueWrapper::MergeFrom(from._internal_value_wrapper_with_list_with_empty_struct());
+  }
+  if (from.has_list_value_wrapper()) {
+    _internal_mutable_list_value_wrapper()->::proto_util_converter::testing::ListValueWrapper::MergeFrom(from._internal_list_value_wrapper());
+  }
+  if (from.has_list_value_wrapper_with_empty_list()) {
+    _internal_mutable_list_value_wrapper_with_empty_list()->::proto_util_converter::testing::ListValueWrapper::MergeFrom(from._internal_list_value_wrapper_with_empty_list());
+  }
+  if (from.has_list_value_wrapper_with_list_with_empty_struct()) {
+    _internal_mutable_list_value_wrapper_with_list_with_empty_struct()->::proto_util_converter::testing::ListValueWrapper::MergeFrom(from._internal_list_value_wrapper_with_list_with_empty_struct());
+  }
+  if (from.has_top_level_value_simple()) {
+    _internal_mutable_top_level_value_simple()->PROTOBUF_NAMESPACE_ID::Value::MergeFrom(from._internal_top_level_value_simple());
+  }
+  if (from.has_top_level_value_with_struct()) {
+    _internal_mutable_top_level_value_with_struct()->PROTOBUF_NAMESPACE_ID::Value::MergeFrom(from._internal_top_level_value_with_struct());
+  }
+  if (from.has_top_level_value_with_list()) {
+    _internal_mutable_top_level_value_with_list()->PROTOBUF_NAMESPACE_ID::Value::MergeFrom(from._internal_top_level_value_with_list());
+  }
+  if (from.has_top_level_value_with_empty_list()) {
+    _internal_mutable_top_level_value_with_empty_list()->PROTOBUF_NAMESPACE_ID::Value::MergeFrom(from._internal_top_level_value_with_empty_list());
+  }
+  if (from.has_top_level_value_with_list_with_empty_struct()) {
+    _internal_mutable_top_level_value_with_list_with_empty_struct()->PROTOBUF_NAMESPACE_ID::Value::MergeFrom(from._internal_top_level_value_with_list_with_empty_struct());
+  }
+  if (from.has_top_level_listvalue()) {
+    _internal_mutable_top_level_listvalue()->PROTOBUF_NAMESPACE_ID::ListValue::MergeFrom(from._internal_top_level_listvalue());
+  }
+  if (from.has_top_level_empty_listvalue()) {
+    _internal_mutable_top_level_empty_listvalue()->PROTOBUF_NAMESPACE_ID::ListValue::MergeFrom(from._internal_top_level_empty_listvalue());
+  }
+  if (from.has_top_level_listvalue_with_empty_struct()) {
+    _internal_mutable_top_level_listvalue_with_empty_struct()->PROTOBUF_NAMESPACE_ID::ListValue::MergeFrom(from._internal_top_level_listvalue_with_empty_struct());
+  }
+  if (from.has_repeated_value()) {
+    _internal_mutable_repeated_value()->::proto_util_converter::testing::RepeatedValueWrapper::MergeFrom(from._internal_repeated_value());
+  }
+  if (from.has_repeated_value_nested_list()) {
+    _internal_mutable_repeated_value_nested_list()->::proto_util_converter::testing::RepeatedValueWrapper::MergeFrom(from._internal_repeated_value_nested_list());
+  }
+  if (from.has_repeated_value_nested_list2()) {
+    _internal_mutable_repeated_value_nested_list2()->::proto_util_converter::testing::RepeatedValueWrapper::MergeFrom(from._internal_repeated_value_nested_list2());
+  }
+  if (from.has_repeated_value_nested_list3()) {
+    _internal_mutable_repeated_value_nested_list3()->::proto_util_converter::testing::RepeatedValueWrapper::MergeFrom(from._internal_repeated_value_nested_list3());
+  }
+  if (from.has_repeated_listvalue()) {
+    _internal_mutable_repeated_listvalue()->::proto_util_converter::testing::RepeatedListValueWrapper::MergeFrom(from._internal_repeated_listvalue());
+  }
+  if (from.has_map_of_struct()) {
+    _internal_mutable_map_of_struct()->::proto_util_converter::testing::MapOfStruct::MergeFrom(from._internal_map_of_struct());
+  }
+  if (from.has_map_of_struct_value()) {
+    _internal_mutable_map_of_struct_value()->::proto_util_converter::testing::MapOfStruct::MergeFrom(from._internal_map_of_struct_value());
+  }
+  if (from.has_map_of_listvalue()) {
+    _internal_mutable_map_of_listvalue()->::proto_util_converter::testing::MapOfStruct::MergeFrom(from._internal_map_of_listvalue());
+  }
+}
+
+void StructTestCases::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.StructTestCases)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void StructTestCases::CopyFrom(const StructTestCases& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.StructTestCases)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StructTestCases::IsInitialized() const {
+  return true;
+}
+
+void StructTestCases::InternalSwap(StructTestCases* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StructTestCases, map_of_listvalue_)
+      + sizeof(StructTestCases::map_of_listvalue_)
+      - PROTOBUF_FIELD_OFFSET(StructTestCases, empty_value_)>(
+          reinterpret_cast<char*>(&empty_value_),
+          reinterpret_cast<char*>(&other->empty_value_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StructTestCases::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void StructWrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_StructWrapper_default_instance_._instance.get_mutable()->struct__ = const_cast< PROTOBUF_NAMESPACE_ID::Struct*>(
+      PROTOBUF_NAMESPACE_ID::Struct::internal_default_instance());
+}
+class StructWrapper::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Struct& struct_(const StructWrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Struct&
+StructWrapper::_Internal::struct_(const StructWrapper* msg) {
+  return *msg->struct__;
+}
+void StructWrapper::clear_struct_() {
+  if (GetArena() == nullptr && struct__ != nullptr) {
+    delete struct__;
+  }
+  struct__ = nullptr;
+}
+StructWrapper::StructWrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.StructWrapper)
+}
+StructWrapper::StructWrapper(const StructWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_struct_()) {
+    struct__ = new PROTOBUF_NAMESPACE_ID::Struct(*from.struct__);
+  } else {
+    struct__ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.StructWrapper)
+}
+
+void StructWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_StructWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+  struct__ = nullptr;
+}
+
+StructWrapper::~StructWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.StructWrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void StructWrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete struct__;
+}
+
+void StructWrapper::ArenaDtor(void* object) {
+  StructWrapper* _this = reinterpret_cast< StructWrapper* >(object);
+  (void)_this;
+}
+void StructWrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void StructWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const StructWrapper& StructWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_StructWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void StructWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.StructWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && struct__ != nullptr) {
+    delete struct__;
+  }
+  struct__ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StructWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Struct struct = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_struct_(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* StructWrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.StructWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Struct struct = 1;
+  if (this->has_struct_()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::struct_(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.StructWrapper)
+  return target;
+}
+
+size_t StructWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.StructWrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.Struct struct = 1;
+  if (this->has_struct_()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *struct__);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void StructWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.StructWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const StructWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<StructWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.StructWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.StructWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void StructWrapper::MergeFrom(const StructWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.StructWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_struct_()) {
+    _internal_mutable_struct_()->PROTOBUF_NAMESPACE_ID::Struct::MergeFrom(from._internal_struct_());
+  }
+}
+
+void StructWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.StructWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void StructWrapper::CopyFrom(const StructWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.StructWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StructWrapper::IsInitialized() const {
+  return true;
+}
+
+void StructWrapper::InternalSwap(StructWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(struct__, other->struct__);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StructWrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void ValueWrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_ValueWrapper_default_instance_._instance.get_mutable()->value_ = const_cast< PROTOBUF_NAMESPACE_ID::Value*>(
+      PROTOBUF_NAMESPACE_ID::Value::internal_default_instance());
+}
+class ValueWrapper::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Value& value(const ValueWrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Value&
+ValueWrapper::_Internal::value(const ValueWrapper* msg) {
+  return *msg->value_;
+}
+void ValueWrapper::clear_value() {
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+}
+ValueWrapper::ValueWrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.ValueWrapper)
+}
+ValueWrapper::ValueWrapper(const ValueWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_value()) {
+    value_ = new PROTOBUF_NAMESPACE_ID::Value(*from.value_);
+  } else {
+    value_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.ValueWrapper)
+}
+
+void ValueWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+  value_ = nullptr;
+}
+
+ValueWrapper::~ValueWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.ValueWrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void ValueWrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete value_;
+}
+
+void ValueWrapper::ArenaDtor(void* object) {
+  ValueWrapper* _this = reinterpret_cast< ValueWrapper* >(object);
+  (void)_this;
+}
+void ValueWrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void ValueWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const ValueWrapper& ValueWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void ValueWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.ValueWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ValueWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Value value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* ValueWrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.ValueWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Value value = 1;
+  if (this->has_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::value(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.ValueWrapper)
+  return target;
+}
+
+size_t ValueWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.ValueWrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.Value value = 1;
+  if (this->has_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *value_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ValueWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.ValueWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ValueWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ValueWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.ValueWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.ValueWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void ValueWrapper::MergeFrom(const ValueWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.ValueWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_value()) {
+    _internal_mutable_value()->PROTOBUF_NAMESPACE_ID::Value::MergeFrom(from._internal_value());
+  }
+}
+
+void ValueWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.ValueWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ValueWrapper::CopyFrom(const ValueWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.ValueWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ValueWrapper::IsInitialized() const {
+  return true;
+}
+
+void ValueWrapper::InternalSwap(ValueWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(value_, other->value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ValueWrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void RepeatedValueWrapper::InitAsDefaultInstance() {
+}
+class RepeatedValueWrapper::_Internal {
+ public:
+};
+
+void RepeatedValueWrapper::clear_values() {
+  values_.Clear();
+}
+RepeatedValueWrapper::RepeatedValueWrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  values_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.RepeatedValueWrapper)
+}
+RepeatedValueWrapper::RepeatedValueWrapper(const RepeatedValueWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      values_(from.values_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.RepeatedValueWrapper)
+}
+
+void RepeatedValueWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RepeatedValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+}
+
+RepeatedValueWrapper::~RepeatedValueWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.RepeatedValueWrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void RepeatedValueWrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void RepeatedValueWrapper::ArenaDtor(void* object) {
+  RepeatedValueWrapper* _this = reinterpret_cast< RepeatedValueWrapper* >(object);
+  (void)_this;
+}
+void RepeatedValueWrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void RepeatedValueWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const RepeatedValueWrapper& RepeatedValueWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RepeatedValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void RepeatedValueWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.RepeatedValueWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  values_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RepeatedValueWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated .google.protobuf.Value values = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          values_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<10>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_values(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* RepeatedValueWrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.RepeatedValueWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Value values = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_values_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, this->_internal_values(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.RepeatedValueWrapper)
+  return target;
+}
+
+size_t RepeatedValueWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.RepeatedValueWrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Value values = 1;
+  total_size += 1UL * this->_internal_values_size();
+  for (const auto& msg : this->values_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void RepeatedValueWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.RepeatedValueWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const RepeatedValueWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RepeatedValueWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.RepeatedValueWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.RepeatedValueWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void RepeatedValueWrapper::MergeFrom(const RepeatedValueWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.RepeatedValueWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  values_.MergeFrom(from.values_);
+}
+
+void RepeatedValueWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.RepeatedValueWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void RepeatedValueWrapper::CopyFrom(const RepeatedValueWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.RepeatedValueWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RepeatedValueWrapper::IsInitialized() const {
+  return true;
+}
+
+void RepeatedValueWrapper::InternalSwap(RepeatedValueWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  values_.InternalSwap(&other->values_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RepeatedValueWrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void ListValueWrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_ListValueWrapper_default_instance_._instance.get_mutable()->shopping_list_ = const_cast< PROTOBUF_NAMESPACE_ID::ListValue*>(
+      PROTOBUF_NAMESPACE_ID::ListValue::internal_default_instance());
+}
+class ListValueWrapper::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::ListValue& shopping_list(const ListValueWrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::ListValue&
+ListValueWrapper::_Internal::shopping_list(const ListValueWrapper* msg) {
+  return *msg->shopping_list_;
+}
+void ListValueWrapper::clear_shopping_list() {
+  if (GetArena() == nullptr && shopping_list_ != nullptr) {
+    delete shopping_list_;
+  }
+  shopping_list_ = nullptr;
+}
+ListValueWrapper::ListValueWrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.ListValueWrapper)
+}
+ListValueWrapper::ListValueWrapper(const ListValueWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_shopping_list()) {
+    shopping_list_ = new PROTOBUF_NAMESPACE_ID::ListValue(*from.shopping_list_);
+  } else {
+    shopping_list_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.ListValueWrapper)
+}
+
+void ListValueWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+  shopping_list_ = nullptr;
+}
+
+ListValueWrapper::~ListValueWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.ListValueWrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void ListValueWrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete shopping_list_;
+}
+
+void ListValueWrapper::ArenaDtor(void* object) {
+  ListValueWrapper* _this = reinterpret_cast< ListValueWrapper* >(object);
+  (void)_this;
+}
+void ListValueWrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void ListValueWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const ListValueWrapper& ListValueWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void ListValueWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.ListValueWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && shopping_list_ != nullptr) {
+    delete shopping_list_;
+  }
+  shopping_list_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ListValueWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.ListValue shopping_list = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_shopping_list(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* ListValueWrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.ListValueWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.ListValue shopping_list = 1;
+  if (this->has_shopping_list()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::shopping_list(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.ListValueWrapper)
+  return target;
+}
+
+size_t ListValueWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.ListValueWrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.ListValue shopping_list = 1;
+  if (this->has_shopping_list()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *shopping_list_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ListValueWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.ListValueWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ListValueWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ListValueWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.ListValueWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.ListValueWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void ListValueWrapper::MergeFrom(const ListValueWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.ListValueWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_shopping_list()) {
+    _internal_mutable_shopping_list()->PROTOBUF_NAMESPACE_ID::ListValue::MergeFrom(from._internal_shopping_list());
+  }
+}
+
+void ListValueWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.ListValueWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ListValueWrapper::CopyFrom(const ListValueWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.ListValueWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ListValueWrapper::IsInitialized() const {
+  return true;
+}
+
+void ListValueWrapper::InternalSwap(ListValueWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(shopping_list_, other->shopping_list_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ListValueWrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void RepeatedListValueWrapper::InitAsDefaultInstance() {
+}
+class RepeatedListValueWrapper::_Internal {
+ public:
+};
+
+void RepeatedListValueWrapper::clear_dimensions() {
+  dimensions_.Clear();
+}
+RepeatedListValueWrapper::RepeatedListValueWrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  dimensions_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.RepeatedListValueWrapper)
+}
+RepeatedListValueWrapper::RepeatedListValueWrapper(const RepeatedListValueWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      dimensions_(from.dimensions_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.RepeatedListValueWrapper)
+}
+
+void RepeatedListValueWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RepeatedListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+}
+
+RepeatedListValueWrapper::~RepeatedListValueWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.RepeatedListValueWrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void RepeatedListValueWrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void RepeatedListValueWrapper::ArenaDtor(void* object) {
+  RepeatedListValueWrapper* _this = reinterpret_cast< RepeatedListValueWrapper* >(object);
+  (void)_this;
+}
+void RepeatedListValueWrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void RepeatedListValueWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const RepeatedListValueWrapper& RepeatedListValueWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RepeatedListValueWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void RepeatedListValueWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.RepeatedListValueWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  dimensions_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RepeatedListValueWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated .google.protobuf.ListValue dimensions = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          dimensions_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<10>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_dimensions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* RepeatedListValueWrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.RepeatedListValueWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.ListValue dimensions = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_dimensions_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, this->_internal_dimensions(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.RepeatedListValueWrapper)
+  return target;
+}
+
+size_t RepeatedListValueWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.RepeatedListValueWrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.ListValue dimensions = 1;
+  total_size += 1UL * this->_internal_dimensions_size();
+  for (const auto& msg : this->dimensions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void RepeatedListValueWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.RepeatedListValueWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const RepeatedListValueWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RepeatedListValueWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.RepeatedListValueWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.RepeatedListValueWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void RepeatedListValueWrapper::MergeFrom(const RepeatedListValueWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.RepeatedListValueWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  dimensions_.MergeFrom(from.dimensions_);
+}
+
+void RepeatedListValueWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.RepeatedListValueWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void RepeatedListValueWrapper::CopyFrom(const RepeatedListValueWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.RepeatedListValueWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RepeatedListValueWrapper::IsInitialized() const {
+  return true;
+}
+
+void RepeatedListValueWrapper::InternalSwap(RepeatedListValueWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  dimensions_.InternalSwap(&other->dimensions_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RepeatedListValueWrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+MapOfStruct_StructMapEntry_DoNotUse::MapOfStruct_StructMapEntry_DoNotUse() {}
+MapOfStruct_StructMapEntry_DoNotUse::MapOfStruct_StructMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapOfStruct_StructMapEntry_DoNotUse::MergeFrom(const MapOfStruct_StructMapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapOfStruct_StructMapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapOfStruct_StructMapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapOfStruct_ValueMapEntry_DoNotUse::MapOfStruct_ValueMapEntry_DoNotUse() {}
+MapOfStruct_ValueMapEntry_DoNotUse::MapOfStruct_ValueMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapOfStruct_ValueMapEntry_DoNotUse::MergeFrom(const MapOfStruct_ValueMapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapOfStruct_ValueMapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapOfStruct_ValueMapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+MapOfStruct_ListvalueMapEntry_DoNotUse::MapOfStruct_ListvalueMapEntry_DoNotUse() {}
+MapOfStruct_ListvalueMapEntry_DoNotUse::MapOfStruct_ListvalueMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MapOfStruct_ListvalueMapEntry_DoNotUse::MergeFrom(const MapOfStruct_ListvalueMapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MapOfStruct_ListvalueMapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void MapOfStruct_ListvalueMapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+void MapOfStruct::InitAsDefaultInstance() {
+}
+class MapOfStruct::_Internal {
+ public:
+};
+
+void MapOfStruct::clear_struct_map() {
+  struct_map_.Clear();
+}
+void MapOfStruct::clear_value_map() {
+  value_map_.Clear();
+}
+void MapOfStruct::clear_listvalue_map() {
+  listvalue_map_.Clear();
+}
+MapOfStruct::MapOfStruct(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  struct_map_(arena),
+  value_map_(arena),
+  listvalue_map_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.MapOfStruct)
+}
+MapOfStruct::MapOfStruct(const MapOfStruct& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  struct_map_.MergeFrom(from.struct_map_);
+  value_map_.MergeFrom(from.value_map_);
+  listvalue_map_.MergeFrom(from.listvalue_map_);
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.MapOfStruct)
+}
+
+void MapOfStruct::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_MapOfStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+}
+
+MapOfStruct::~MapOfStruct() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.MapOfStruct)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void MapOfStruct::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void MapOfStruct::ArenaDtor(void* object) {
+  MapOfStruct* _this = reinterpret_cast< MapOfStruct* >(object);
+  (void)_this;
+}
+void MapOfStruct::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void MapOfStruct::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const MapOfStruct& MapOfStruct::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_MapOfStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void MapOfStruct::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.MapOfStruct)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  struct_map_.Clear();
+  value_map_.Clear();
+  listvalue_map_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MapOfStruct::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // map<string, .google.protobuf.Struct> struct_map = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&struct_map_,
+              ctx->CountLengthDelimited<10>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&struct_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<string, .google.protobuf.Value> value_map = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&value_map_,
+              ctx->CountLengthDelimited<18>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&value_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<string, .google.protobuf.ListValue> listvalue_map = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&listvalue_map_,
+              ctx->CountLengthDelimited<26>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&listvalue_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* MapOfStruct::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.MapOfStruct)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<string, .google.protobuf.Struct> struct_map = 1;
+  if (!this->_internal_struct_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::Struct >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          p->first.data(), static_cast<int>(p->first.length()),
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+          "proto_util_converter.testing.MapOfStruct.StructMapEntry.key");
+      }
+    };
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_struct_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_struct_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::Struct >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::Struct >::const_iterator
+          it = this->_internal_struct_map().begin();
+          it != this->_internal_struct_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapOfStruct_StructMapEntry_DoNotUse::Funcs::InternalSerialize(1, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::Struct >::const_iterator
+          it = this->_internal_struct_map().begin();
+          it != this->_internal_struct_map().end(); ++it) {
+        target = MapOfStruct_StructMapEntry_DoNotUse::Funcs::InternalSerialize(1, it->first, it->second, target, stream);
+        Utf8Check::Check(&(*it));
+      }
+    }
+  }
+
+  // map<string, .google.protobuf.Value> value_map = 2;
+  if (!this->_internal_value_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::Value >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          p->first.data(), static_cast<int>(p->first.length()),
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+          "proto_util_converter.testing.MapOfStruct.ValueMapEntry.key");
+      }
+    };
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_value_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_value_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::Value >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::Value >::const_iterator
+          it = this->_internal_value_map().begin();
+          it != this->_internal_value_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapOfStruct_ValueMapEntry_DoNotUse::Funcs::InternalSerialize(2, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::Value >::const_iterator
+          it = this->_internal_value_map().begin();
+          it != this->_internal_value_map().end(); ++it) {
+        target = MapOfStruct_ValueMapEntry_DoNotUse::Funcs::InternalSerialize(2, it->first, it->second, target, stream);
+        Utf8Check::Check(&(*it));
+      }
+    }
+  }
+
+  // map<string, .google.protobuf.ListValue> listvalue_map = 3;
+  if (!this->_internal_listvalue_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::ListValue >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          p->first.data(), static_cast<int>(p->first.length()),
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+          "proto_util_converter.testing.MapOfStruct.ListvalueMapEntry.key");
+      }
+    };
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_listvalue_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_listvalue_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::ListValue >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::ListValue >::const_iterator
+          it = this->_internal_listvalue_map().begin();
+          it != this->_internal_listvalue_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = MapOfStruct_ListvalueMapEntry_DoNotUse::Funcs::InternalSerialize(3, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::ListValue >::const_iterator
+          it = this->_internal_listvalue_map().begin();
+          it != this->_internal_listvalue_map().end(); ++it) {
+        target = MapOfStruct_ListvalueMapEntry_DoNotUse::Funcs::InternalSerialize(3, it->first, it->second, target, stream);
+        Utf8Check::Check(&(*it));
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.MapOfStruct)
+  return target;
+}
+
+size_t MapOfStruct::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.MapOfStruct)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, .google.protobuf.Struct> struct_map = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_struct_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::Struct >::const_iterator
+      it = this->_internal_struct_map().begin();
+      it != this->_internal_struct_map().end(); ++it) {
+    total_size += MapOfStruct_StructMapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<string, .google.protobuf.Value> value_map = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_value_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::Value >::const_iterator
+      it = this->_internal_value_map().begin();
+      it != this->_internal_value_map().end(); ++it) {
+    total_size += MapOfStruct_ValueMapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<string, .google.protobuf.ListValue> listvalue_map = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_listvalue_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, PROTOBUF_NAMESPACE_ID::ListValue >::const_iterator
+      it = this->_internal_listvalue_map().begin();
+      it != this->_internal_listvalue_map().end(); ++it) {
+    total_size += MapOfStruct_ListvalueMapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void MapOfStruct::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.MapOfStruct)
+  GOOGLE_DCHECK_NE(&from, this);
+  const MapOfStruct* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<MapOfStruct>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.MapOfStruct)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.MapOfStruct)
+    MergeFrom(*source);
+  }
+}
+
+void MapOfStruct::MergeFrom(const MapOfStruct& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.MapOfStruct)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  struct_map_.MergeFrom(from.struct_map_);
+  value_map_.MergeFrom(from.value_map_);
+  listvalue_map_.MergeFrom(from.listvalue_map_);
+}
+
+void MapOfStruct::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.MapOfStruct)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void MapOfStruct::CopyFrom(const MapOfStruct& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.MapOfStruct)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MapOfStruct::IsInitialized() const {
+  return true;
+}
+
+void MapOfStruct::InternalSwap(MapOfStruct* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  struct_map_.Swap(&other->struct_map_);
+  value_map_.Swap(&other->value_map_);
+  listvalue_map_.Swap(&other->listvalue_map_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MapOfStruct::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void Dummy::InitAsDefaultInstance() {
+}
+class Dummy::_Internal {
+ public:
+};
+
+Dummy::Dummy(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.Dummy)
+}
+Dummy::Dummy(const Dummy& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  text_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_text().empty()) {
+    text_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_text(),
+      GetArena());
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.Dummy)
+}
+
+void Dummy::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Dummy_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+  text_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+Dummy::~Dummy() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.Dummy)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void Dummy::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  text_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void Dummy::ArenaDtor(void* object) {
+  Dummy* _this = reinterpret_cast< Dummy* >(object);
+  (void)_this;
+}
+void Dummy::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void Dummy::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const Dummy& Dummy::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Dummy_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void Dummy::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.Dummy)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  text_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Dummy::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string text = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&text_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          const std::string* str = &text_.Get();
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto_util_converter.testing.Dummy.text"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* Dummy::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.Dummy)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string text = 1;
+  if (this->text().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto_util_converter.testing.Dummy.text");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_text(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.Dummy)
+  return target;
+}
+
+size_t Dummy::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.Dummy)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string text = 1;
+  if (this->text().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_text());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Dummy::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.Dummy)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Dummy* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Dummy>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.Dummy)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.Dummy)
+    MergeFrom(*source);
+  }
+}
+
+void Dummy::MergeFrom(const Dummy& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.Dummy)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.text().size() > 0) {
+    _internal_set_text(from._internal_text());
+  }
+}
+
+void Dummy::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.Dummy)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Dummy::CopyFrom(const Dummy& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.Dummy)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Dummy::IsInitialized() const {
+  return true;
+}
+
+void Dummy::InternalSwap(Dummy* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  text_.Swap(&other->text_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Dummy::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void StructType::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_StructType_default_instance_._instance.get_mutable()->object_ = const_cast< PROTOBUF_NAMESPACE_ID::Struct*>(
+      PROTOBUF_NAMESPACE_ID::Struct::internal_default_instance());
+}
+class StructType::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Struct& object(const StructType* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Struct&
+StructType::_Internal::object(const StructType* msg) {
+  return *msg->object_;
+}
+void StructType::clear_object() {
+  if (GetArena() == nullptr && object_ != nullptr) {
+    delete object_;
+  }
+  object_ = nullptr;
+}
+StructType::StructType(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.StructType)
+}
+StructType::StructType(const StructType& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_object()) {
+    object_ = new PROTOBUF_NAMESPACE_ID::Struct(*from.object_);
+  } else {
+    object_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.StructType)
+}
+
+void StructType::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_StructType_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+  object_ = nullptr;
+}
+
+StructType::~StructType() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.StructType)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void StructType::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete object_;
+}
+
+void StructType::ArenaDtor(void* object) {
+  StructType* _this = reinterpret_cast< StructType* >(object);
+  (void)_this;
+}
+void StructType::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void StructType::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const StructType& StructType::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_StructType_google_2fprotobuf_2futil_2finternal_2ftestdata_2fstruct_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void StructType::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.StructType)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && object_ != nullptr) {
+    delete object_;
+  }
+  object_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StructType::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Struct object = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_object(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* StructType::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.StructType)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Struct object = 1;
+  if (this->has_object()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::object(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.StructType)
+  return target;
+}
+
+size_t StructType::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.StructType)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.Struct object = 1;
+  if (this->has_object()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *object_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void StructType::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.StructType)
+  GOOGLE_DCHECK_NE(&from, this);
+  const StructType* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<StructType>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.StructType)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.StructType)
+    MergeFrom(*source);
+  }
+}
+
+void StructType::MergeFrom(const StructType& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.StructType)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_object()) {
+    _internal_mutable_object()->PROTOBUF_NAMESPACE_ID::Struct::MergeFrom(from._internal_object());
+  }
+}
+
+void StructType::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.StructType)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void StructType::CopyFrom(const StructType& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.StructType)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StructType::IsInitialized() const {
+  return true;
+}
+
+void StructType::InternalSwap(StructType* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(object_, other->object_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StructType::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace testing
+}  // namespace proto_util_converter
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::StructTestCases* Arena::CreateMaybeMessage< ::proto_util_converter::testing::StructTestCases >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::StructTestCases >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::StructWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::StructWrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::StructWrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::ValueWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::ValueWrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::ValueWrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::RepeatedValueWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::RepeatedValueWrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::RepeatedValueWrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::ListValueWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::ListValueWrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::ListValueWrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::RepeatedListValueWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::RepeatedListValueWrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::RepeatedListValueWrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::MapOfStruct_StructMapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto_util_converter::testing::MapOfStruct_StructMapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::MapOfStruct_StructMapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::MapOfStruct_ValueMapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto_util_converter::testing::MapOfStruct_ValueMapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::MapOfStruct_ValueMapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::MapOfStruct_ListvalueMapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto_util_converter::testing::MapOfStruct_ListvalueMapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::MapOfStruct_ListvalueMapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::MapOfStruct* Arena::CreateMaybeMessage< ::proto_util_converter::testing::MapOfStruct >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::MapOfStruct >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::Dummy* Arena::CreateMaybeMessage< ::proto_util_converter::testing::Dummy >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::Dummy >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::StructType* Arena::CreateMaybeMessage< ::proto_util_converter::testing::StructType >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::StructType >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,3121 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/internal/testdata/timestamp_duration.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3012000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3012003 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/inlined_string_field.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/duration.pb.h>
+#include <google/protobuf/timestamp.pb.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[4]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto;
+namespace proto_util_converter {
+namespace testing {
+class DurationType;
+class DurationTypeDefaultTypeInternal;
+extern DurationTypeDefaultTypeInternal _DurationType_default_instance_;
+class TimeStampType;
+class TimeStampTypeDefaultTypeInternal;
+extern TimeStampTypeDefaultTypeInternal _TimeStampType_default_instance_;
+class TimestampDuration;
+class TimestampDurationDefaultTypeInternal;
+extern TimestampDurationDefaultTypeInternal _TimestampDuration_default_instance_;
+class TimestampDurationTestCases;
+class TimestampDurationTestCasesDefaultTypeInternal;
+extern TimestampDurationTestCasesDefaultTypeInternal _TimestampDurationTestCases_default_instance_;
+}  // namespace testing
+}  // namespace proto_util_converter
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto_util_converter::testing::DurationType* Arena::CreateMaybeMessage<::proto_util_converter::testing::DurationType>(Arena*);
+template<> ::proto_util_converter::testing::TimeStampType* Arena::CreateMaybeMessage<::proto_util_converter::testing::TimeStampType>(Arena*);
+template<> ::proto_util_converter::testing::TimestampDuration* Arena::CreateMaybeMessage<::proto_util_converter::testing::TimestampDuration>(Arena*);
+template<> ::proto_util_converter::testing::TimestampDurationTestCases* Arena::CreateMaybeMessage<::proto_util_converter::testing::TimestampDurationTestCases>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto_util_converter {
+namespace testing {
+
+// ===================================================================
+
+class TimestampDurationTestCases PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.TimestampDurationTestCases) */ {
+ public:
+  inline TimestampDurationTestCases() : TimestampDurationTestCases(nullptr) {};
+  virtual ~TimestampDurationTestCases();
+
+  TimestampDurationTestCases(const TimestampDurationTestCases& from);
+  TimestampDurationTestCases(TimestampDurationTestCases&& from) noexcept
+    : TimestampDurationTestCases() {
+    *this = ::std::move(from);
+  }
+
+  inline TimestampDurationTestCases& operator=(const TimestampDurationTestCases& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TimestampDurationTestCases& operator=(TimestampDurationTestCases&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TimestampDurationTestCases& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TimestampDurationTestCases* internal_default_instance() {
+    return reinterpret_cast<const TimestampDurationTestCases*>(
+               &_TimestampDurationTestCases_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TimestampDurationTestCases& a, TimestampDurationTestCases& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimestampDurationTestCases* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimestampDurationTestCases* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TimestampDurationTestCases* New() const final {
+    return CreateMaybeMessage<TimestampDurationTestCases>(nullptr);
+  }
+
+  TimestampDurationTestCases* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TimestampDurationTestCases>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TimestampDurationTestCases& from);
+  void MergeFrom(const TimestampDurationTestCases& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimestampDurationTestCases* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.TimestampDurationTestCases";
+  }
+  protected:
+  explicit TimestampDurationTestCases(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEpochFieldNumber = 1,
+    kEpoch2FieldNumber = 2,
+    kMintimeFieldNumber = 3,
+    kMaxtimeFieldNumber = 4,
+    kTimeval1FieldNumber = 5,
+    kTimeval2FieldNumber = 6,
+    kTimeval3FieldNumber = 7,
+    kTimeval4FieldNumber = 8,
+    kTimeval5FieldNumber = 9,
+    kTimeval6FieldNumber = 10,
+    kTimeval7FieldNumber = 11,
+    kTimeval8FieldNumber = 12,
+    kZeroDurationFieldNumber = 101,
+    kMinDurationFieldNumber = 102,
+    kMaxDurationFieldNumber = 103,
+    kDuration1FieldNumber = 104,
+    kDuration2FieldNumber = 105,
+    kDuration3FieldNumber = 106,
+    kDuration4FieldNumber = 107,
+    kDuration5FieldNumber = 108,
+  };
+  // .proto_util_converter.testing.TimeStampType epoch = 1;
+  bool has_epoch() const;
+  private:
+  bool _internal_has_epoch() const;
+  public:
+  void clear_epoch();
+  const ::proto_util_converter::testing::TimeStampType& epoch() const;
+  ::proto_util_converter::testing::TimeStampType* release_epoch();
+  ::proto_util_converter::testing::TimeStampType* mutable_epoch();
+  void set_allocated_epoch(::proto_util_converter::testing::TimeStampType* epoch);
+  private:
+  const ::proto_util_converter::testing::TimeStampType& _internal_epoch() const;
+  ::proto_util_converter::testing::TimeStampType* _internal_mutable_epoch();
+  public:
+  void unsafe_arena_set_allocated_epoch(
+      ::proto_util_converter::testing::TimeStampType* epoch);
+  ::proto_util_converter::testing::TimeStampType* unsafe_arena_release_epoch();
+
+  // .proto_util_converter.testing.TimeStampType epoch2 = 2;
+  bool has_epoch2() const;
+  private:
+  bool _internal_has_epoch2() const;
+  public:
+  void clear_epoch2();
+  const ::proto_util_converter::testing::TimeStampType& epoch2() const;
+  ::proto_util_converter::testing::TimeStampType* release_epoch2();
+  ::proto_util_converter::testing::TimeStampType* mutable_epoch2();
+  void set_allocated_epoch2(::proto_util_converter::testing::TimeStampType* epoch2);
+  private:
+  const ::proto_util_converter::testing::TimeStampType& _internal_epoch2() const;
+  ::proto_util_converter::testing::TimeStampType* _internal_mutable_epoch2();
+  public:
+  void unsafe_arena_set_allocated_epoch2(
+      ::proto_util_converter::testing::TimeStampType* epoch2);
+  ::proto_util_converter::testing::TimeStampType* unsafe_arena_release_epoch2();
+
+  // .proto_util_converter.testing.TimeStampType mintime = 3;
+  bool has_mintime() const;
+  private:
+  bool _internal_has_mintime() const;
+  public:
+  void clear_mintime();
+  const ::proto_util_converter::testing::TimeStampType& mintime() const;
+  ::proto_util_converter::testing::TimeStampType* release_mintime();
+  ::proto_util_converter::testing::TimeStampType* mutable_mintime();
+  void set_allocated_mintime(::proto_util_converter::testing::TimeStampType* mintime);
+  private:
+  const ::proto_util_converter::testing::TimeStampType& _internal_mintime() const;
+  ::proto_util_converter::testing::TimeStampType* _internal_mutable_mintime();
+  public:
+  void unsafe_arena_set_allocated_mintime(
+      ::proto_util_converter::testing::TimeStampType* mintime);
+  ::proto_util_converter::testing::TimeStampType* unsafe_arena_release_mintime();
+
+  // .proto_util_converter.testing.TimeStampType maxtime = 4;
+  bool has_maxtime() const;
+  private:
+  bool _internal_has_maxtime() const;
+  public:
+  void clear_maxtime();
+  const ::proto_util_converter::testing::TimeStampType& maxtime() const;
+  ::proto_util_converter::testing::TimeStampType* release_maxtime();
+  ::proto_util_converter::testing::TimeStampType* mutable_maxtime();
+  void set_allocated_maxtime(::proto_util_converter::testing::TimeStampType* maxtime);
+  private:
+  const ::proto_util_converter::testing::TimeStampType& _internal_maxtime() const;
+  ::proto_util_converter::testing::TimeStampType* _internal_mutable_maxtime();
+  public:
+  void unsafe_arena_set_allocated_maxtime(
+      ::proto_util_converter::testing::TimeStampType* maxtime);
+  ::proto_util_converter::testing::TimeStampType* unsafe_arena_release_maxtime();
+
+  // .proto_util_converter.testing.TimeStampType timeval1 = 5;
+  bool has_timeval1() const;
+  private:
+  bool _internal_has_timeval1() const;
+  public:
+  void clear_timeval1();
+  const ::proto_util_converter::testing::TimeStampType& timeval1() const;
+  ::proto_util_converter::testing::TimeStampType* release_timeval1();
+  ::proto_util_converter::testing::TimeStampType* mutable_timeval1();
+  void set_allocated_timeval1(::proto_util_converter::testing::TimeStampType* timeval1);
+  private:
+  const ::proto_util_converter::testing::TimeStampType& _internal_timeval1() const;
+  ::proto_util_converter::testing::TimeStampType* _internal_mutable_timeval1();
+  public:
+  void unsafe_arena_set_allocated_timeval1(
+      ::proto_util_converter::testing::TimeStampType* timeval1);
+  ::proto_util_converter::testing::TimeStampType* unsafe_arena_release_timeval1();
+
+  // .proto_util_converter.testing.TimeStampType timeval2 = 6;
+  bool has_timeval2() const;
+  private:
+  bool _internal_has_timeval2() const;
+  public:
+  void clear_timeval2();
+  const ::proto_util_converter::testing::TimeStampType& timeval2() const;
+  ::proto_util_converter::testing::TimeStampType* release_timeval2();
+  ::proto_util_converter::testing::TimeStampType* mutable_timeval2();
+  void set_allocated_timeval2(::proto_util_converter::testing::TimeStampType* timeval2);
+  private:
+  const ::proto_util_converter::testing::TimeStampType& _internal_timeval2() const;
+  ::proto_util_converter::testing::TimeStampType* _internal_mutable_timeval2();
+  public:
+  void unsafe_arena_set_allocated_timeval2(
+      ::proto_util_converter::testing::TimeStampType* timeval2);
+  ::proto_util_converter::testing::TimeStampType* unsafe_arena_release_timeval2();
+
+  // .proto_util_converter.testing.TimeStampType timeval3 = 7;
+  bool has_timeval3() const;
+  private:
+  bool _internal_has_timeval3() const;
+  public:
+  void clear_timeval3();
+  const ::proto_util_converter::testing::TimeStampType& timeval3() const;
+  ::proto_util_converter::testing::TimeStampType* release_timeval3();
+  ::proto_util_converter::testing::TimeStampType* mutable_timeval3();
+  void set_allocated_timeval3(::proto_util_converter::testing::TimeStampType* timeval3);
+  private:
+  const ::proto_util_converter::testing::TimeStampType& _internal_timeval3() const;
+  ::proto_util_converter::testing::TimeStampType* _internal_mutable_timeval3();
+  public:
+  void unsafe_arena_set_allocated_timeval3(
+      ::proto_util_converter::testing::TimeStampType* timeval3);
+  ::proto_util_converter::testing::TimeStampType* unsafe_arena_release_timeval3();
+
+  // .proto_util_converter.testing.TimeStampType timeval4 = 8;
+  bool has_timeval4() const;
+  private:
+  bool _internal_has_timeval4() const;
+  public:
+  void clear_timeval4();
+  const ::proto_util_converter::testing::TimeStampType& timeval4() const;
+  ::proto_util_converter::testing::TimeStampType* release_timeval4();
+  ::proto_util_converter::testing::TimeStampType* mutable_timeval4();
+  void set_allocated_timeval4(::proto_util_converter::testing::TimeStampType* timeval4);
+  private:
+  const ::proto_util_converter::testing::TimeStampType& _internal_timeval4() const;
+  ::proto_util_converter::testing::TimeStampType* _internal_mutable_timeval4();
+  public:
+  void unsafe_arena_set_allocated_timeval4(
+      ::proto_util_converter::testing::TimeStampType* timeval4);
+  ::proto_util_converter::testing::TimeStampType* unsafe_arena_release_timeval4();
+
+  // .proto_util_converter.testing.TimeStampType timeval5 = 9;
+  bool has_timeval5() const;
+  private:
+  bool _internal_has_timeval5() const;
+  public:
+  void clear_timeval5();
+  const ::proto_util_converter::testing::TimeStampType& timeval5() const;
+  ::proto_util_converter::testing::TimeStampType* release_timeval5();
+  ::proto_util_converter::testing::TimeStampType* mutable_timeval5();
+  void set_allocated_timeval5(::proto_util_converter::testing::TimeStampType* timeval5);
+  private:
+  const ::proto_util_converter::testing::TimeStampType& _internal_timeval5() const;
+  ::proto_util_converter::testing::TimeStampType* _internal_mutable_timeval5();
+  public:
+  void unsafe_arena_set_allocated_timeval5(
+      ::proto_util_converter::testing::TimeStampType* timeval5);
+  ::proto_util_converter::testing::TimeStampType* unsafe_arena_release_timeval5();
+
+  // .proto_util_converter.testing.TimeStampType timeval6 = 10;
+  bool has_timeval6() const;
+  private:
+  bool _internal_has_timeval6() const;
+  public:
+  void clear_timeval6();
+  const ::proto_util_converter::testing::TimeStampType& timeval6() const;
+  ::proto_util_converter::testing::TimeStampType* release_timeval6();
+  ::proto_util_converter::testing::TimeStampType* mutable_timeval6();
+  void set_allocated_timeval6(::proto_util_converter::testing::TimeStampType* timeval6);
+  private:
+  const ::proto_util_converter::testing::TimeStampType& _internal_timeval6() const;
+  ::proto_util_converter::testing::TimeStampType* _internal_mutable_timeval6();
+  public:
+  void unsafe_arena_set_allocated_timeval6(
+      ::proto_util_converter::testing::TimeStampType* timeval6);
+  ::proto_util_converter::testing::TimeStampType* unsafe_arena_release_timeval6();
+
+  // .proto_util_converter.testing.TimeStampType timeval7 = 11;
+  bool has_timeval7() const;
+  private:
+  bool _internal_has_timeval7() const;
+  public:
+  void clear_timeval7();
+  const ::proto_util_converter::testing::TimeStampType& timeval7() const;
+  ::proto_util_converter::testing::TimeStampType* release_timeval7();
+  ::proto_util_converter::testing::TimeStampType* mutable_timeval7();
+  void set_allocated_timeval7(::proto_util_converter::testing::TimeStampType* timeval7);
+  private:
+  const ::proto_util_converter::testing::TimeStampType& _internal_timeval7() const;
+  ::proto_util_converter::testing::TimeStampType* _internal_mutable_timeval7();
+  public:
+  void unsafe_arena_set_allocated_timeval7(
+      ::proto_util_converter::testing::TimeStampType* timeval7);
+  ::proto_util_converter::testing::TimeStampType* unsafe_arena_release_timeval7();
+
+  // .google.protobuf.Timestamp timeval8 = 12;
+  bool has_timeval8() const;
+  private:
+  bool _internal_has_timeval8() const;
+  public:
+  void clear_timeval8();
+  const PROTOBUF_NAMESPACE_ID::Timestamp& timeval8() const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* release_timeval8();
+  PROTOBUF_NAMESPACE_ID::Timestamp* mutable_timeval8();
+  void set_allocated_timeval8(PROTOBUF_NAMESPACE_ID::Timestamp* timeval8);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Timestamp& _internal_timeval8() const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* _internal_mutable_timeval8();
+  public:
+  void unsafe_arena_set_allocated_timeval8(
+      PROTOBUF_NAMESPACE_ID::Timestamp* timeval8);
+  PROTOBUF_NAMESPACE_ID::Timestamp* unsafe_arena_release_timeval8();
+
+  // .proto_util_converter.testing.DurationType zero_duration = 101;
+  bool has_zero_duration() const;
+  private:
+  bool _internal_has_zero_duration() const;
+  public:
+  void clear_zero_duration();
+  const ::proto_util_converter::testing::DurationType& zero_duration() const;
+  ::proto_util_converter::testing::DurationType* release_zero_duration();
+  ::proto_util_converter::testing::DurationType* mutable_zero_duration();
+  void set_allocated_zero_duration(::proto_util_converter::testing::DurationType* zero_duration);
+  private:
+  const ::proto_util_converter::testing::DurationType& _internal_zero_duration() const;
+  ::proto_util_converter::testing::DurationType* _internal_mutable_zero_duration();
+  public:
+  void unsafe_arena_set_allocated_zero_duration(
+      ::proto_util_converter::testing::DurationType* zero_duration);
+  ::proto_util_converter::testing::DurationType* unsafe_arena_release_zero_duration();
+
+  // .proto_util_converter.testing.DurationType min_duration = 102;
+  bool has_min_duration() const;
+  private:
+  bool _internal_has_min_duration() const;
+  public:
+  void clear_min_duration();
+  const ::proto_util_converter::testing::DurationType& min_duration() const;
+  ::proto_util_converter::testing::DurationType* release_min_duration();
+  ::proto_util_converter::testing::DurationType* mutable_min_duration();
+  void set_allocated_min_duration(::proto_util_converter::testing::DurationType* min_duration);
+  private:
+  const ::proto_util_converter::testing::DurationType& _internal_min_duration() const;
+  ::proto_util_converter::testing::DurationType* _internal_mutable_min_duration();
+  public:
+  void unsafe_arena_set_allocated_min_duration(
+      ::proto_util_converter::testing::DurationType* min_duration);
+  ::proto_util_converter::testing::DurationType* unsafe_arena_release_min_duration();
+
+  // .proto_util_converter.testing.DurationType max_duration = 103;
+  bool has_max_duration() const;
+  private:
+  bool _internal_has_max_duration() const;
+  public:
+  void clear_max_duration();
+  const ::proto_util_converter::testing::DurationType& max_duration() const;
+  ::proto_util_converter::testing::DurationType* release_max_duration();
+  ::proto_util_converter::testing::DurationType* mutable_max_duration();
+  void set_allocated_max_duration(::proto_util_converter::testing::DurationType* max_duration);
+  private:
+  const ::proto_util_converter::testing::DurationType& _internal_max_duration() const;
+  ::proto_util_converter::testing::DurationType* _internal_mutable_max_duration();
+  public:
+  void unsafe_arena_set_allocated_max_duration(
+      ::proto_util_converter::testing::DurationType* max_duration);
+  ::proto_util_converter::testing::DurationType* unsafe_arena_release_max_duration();
+
+  // .proto_util_converter.testing.DurationType duration1 = 104;
+  bool has_duration1() const;
+  private:
+  bool _internal_has_duration1() const;
+  public:
+  void clear_duration1();
+  const ::proto_util_converter::testing::DurationType& duration1() const;
+  ::proto_util_converter::testing::DurationType* release_duration1();
+  ::proto_util_converter::testing::DurationType* mutable_duration1();
+  void set_allocated_duration1(::proto_util_converter::testing::DurationType* duration1);
+  private:
+  const ::proto_util_converter::testing::DurationType& _internal_duration1() const;
+  ::proto_util_converter::testing::DurationType* _internal_mutable_duration1();
+  public:
+  void unsafe_arena_set_allocated_duration1(
+      ::proto_util_converter::testing::DurationType* duration1);
+  ::proto_util_converter::testing::DurationType* unsafe_arena_release_duration1();
+
+  // .proto_util_converter.testing.DurationType duration2 = 105;
+  bool has_duration2() const;
+  private:
+  bool _internal_has_duration2() const;
+  public:
+  void clear_duration2();
+  const ::proto_util_converter::testing::DurationType& duration2() const;
+  ::proto_util_converter::testing::DurationType* release_duration2();
+  ::proto_util_converter::testing::DurationType* mutable_duration2();
+  void set_allocated_duration2(::proto_util_converter::testing::DurationType* duration2);
+  private:
+  const ::proto_util_converter::testing::DurationType& _internal_duration2() const;
+  ::proto_util_converter::testing::DurationType* _internal_mutable_duration2();
+  public:
+  void unsafe_arena_set_allocated_duration2(
+      ::proto_util_converter::testing::DurationType* duration2);
+  ::proto_util_converter::testing::DurationType* unsafe_arena_release_duration2();
+
+  // .proto_util_converter.testing.DurationType duration3 = 106;
+  bool has_duration3() const;
+  private:
+  bool _internal_has_duration3() const;
+  public:
+  void clear_duration3();
+  const ::proto_util_converter::testing::DurationType& duration3() const;
+  ::proto_util_converter::testing::DurationType* release_duration3();
+  ::proto_util_converter::testing::DurationType* mutable_duration3();
+  void set_allocated_duration3(::proto_util_converter::testing::DurationType* duration3);
+  private:
+  const ::proto_util_converter::testing::DurationType& _internal_duration3() const;
+  ::proto_util_converter::testing::DurationType* _internal_mutable_duration3();
+  public:
+  void unsafe_arena_set_allocated_duration3(
+      ::proto_util_converter::testing::DurationType* duration3);
+  ::proto_util_converter::testing::DurationType* unsafe_arena_release_duration3();
+
+  // .proto_util_converter.testing.DurationType duration4 = 107;
+  bool has_duration4() const;
+  private:
+  bool _internal_has_duration4() const;
+  public:
+  void clear_duration4();
+  const ::proto_util_converter::testing::DurationType& duration4() const;
+  ::proto_util_converter::testing::DurationType* release_duration4();
+  ::proto_util_converter::testing::DurationType* mutable_duration4();
+  void set_allocated_duration4(::proto_util_converter::testing::DurationType* duration4);
+  private:
+  const ::proto_util_converter::testing::DurationType& _internal_duration4() const;
+  ::proto_util_converter::testing::DurationType* _internal_mutable_duration4();
+  public:
+  void unsafe_arena_set_allocated_duration4(
+      ::proto_util_converter::testing::DurationType* duration4);
+  ::proto_util_converter::testing::DurationType* unsafe_arena_release_duration4();
+
+  // .google.protobuf.Duration duration5 = 108;
+  bool has_duration5() const;
+  private:
+  bool _internal_has_duration5() const;
+  public:
+  void clear_duration5();
+  const PROTOBUF_NAMESPACE_ID::Duration& duration5() const;
+  PROTOBUF_NAMESPACE_ID::Duration* release_duration5();
+  PROTOBUF_NAMESPACE_ID::Duration* mutable_duration5();
+  void set_allocated_duration5(PROTOBUF_NAMESPACE_ID::Duration* duration5);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Duration& _internal_duration5() const;
+  PROTOBUF_NAMESPACE_ID::Duration* _internal_mutable_duration5();
+  public:
+  void unsafe_arena_set_allocated_duration5(
+      PROTOBUF_NAMESPACE_ID::Duration* duration5);
+  PROTOBUF_NAMESPACE_ID::Duration* unsafe_arena_release_duration5();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.TimestampDurationTestCases)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::proto_util_converter::testing::TimeStampType* epoch_;
+  ::proto_util_converter::testing::TimeStampType* epoch2_;
+  ::proto_util_converter::testing::TimeStampType* mintime_;
+  ::proto_util_converter::testing::TimeStampType* maxtime_;
+  ::proto_util_converter::testing::TimeStampType* timeval1_;
+  ::proto_util_converter::testing::TimeStampType* timeval2_;
+  ::proto_util_converter::testing::TimeStampType* timeval3_;
+  ::proto_util_converter::testing::TimeStampType* timeval4_;
+  ::proto_util_converter::testing::TimeStampType* timeval5_;
+  ::proto_util_converter::testing::TimeStampType* timeval6_;
+  ::proto_util_converter::testing::TimeStampType* timeval7_;
+  PROTOBUF_NAMESPACE_ID::Timestamp* timeval8_;
+  ::proto_util_converter::testing::DurationType* zero_duration_;
+  ::proto_util_converter::testing::DurationType* min_duration_;
+  ::proto_util_converter::testing::DurationType* max_duration_;
+  ::proto_util_converter::testing::DurationType* duration1_;
+  ::proto_util_converter::testing::DurationType* duration2_;
+  ::proto_util_converter::testing::DurationType* duration3_;
+  ::proto_util_converter::testing::DurationType* duration4_;
+  PROTOBUF_NAMESPACE_ID::Duration* duration5_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TimeStampType PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.TimeStampType) */ {
+ public:
+  inline TimeStampType() : TimeStampType(nullptr) {};
+  virtual ~TimeStampType();
+
+  TimeStampType(const TimeStampType& from);
+  TimeStampType(TimeStampType&& from) noexcept
+    : TimeStampType() {
+    *this = ::std::move(from);
+  }
+
+  inline TimeStampType& operator=(const TimeStampType& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TimeStampType& operator=(TimeStampType&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TimeStampType& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TimeStampType* internal_default_instance() {
+    return reinterpret_cast<const TimeStampType*>(
+               &_TimeStampType_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(TimeStampType& a, TimeStampType& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimeStampType* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimeStampType* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TimeStampType* New() const final {
+    return CreateMaybeMessage<TimeStampType>(nullptr);
+  }
+
+  TimeStampType* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TimeStampType>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TimeStampType& from);
+  void MergeFrom(const TimeStampType& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimeStampType* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.TimeStampType";
+  }
+  protected:
+  explicit TimeStampType(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTimestampFieldNumber = 1,
+  };
+  // .google.protobuf.Timestamp timestamp = 1;
+  bool has_timestamp() const;
+  private:
+  bool _internal_has_timestamp() const;
+  public:
+  void clear_timestamp();
+  const PROTOBUF_NAMESPACE_ID::Timestamp& timestamp() const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* release_timestamp();
+  PROTOBUF_NAMESPACE_ID::Timestamp* mutable_timestamp();
+  void set_allocated_timestamp(PROTOBUF_NAMESPACE_ID::Timestamp* timestamp);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Timestamp& _internal_timestamp() const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* _internal_mutable_timestamp();
+  public:
+  void unsafe_arena_set_allocated_timestamp(
+      PROTOBUF_NAMESPACE_ID::Timestamp* timestamp);
+  PROTOBUF_NAMESPACE_ID::Timestamp* unsafe_arena_release_timestamp();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.TimeStampType)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  PROTOBUF_NAMESPACE_ID::Timestamp* timestamp_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DurationType PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.DurationType) */ {
+ public:
+  inline DurationType() : DurationType(nullptr) {};
+  virtual ~DurationType();
+
+  DurationType(const DurationType& from);
+  DurationType(DurationType&& from) noexcept
+    : DurationType() {
+    *this = ::std::move(from);
+  }
+
+  inline DurationType& operator=(const DurationType& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DurationType& operator=(DurationType&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const DurationType& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const DurationType* internal_default_instance() {
+    return reinterpret_cast<const DurationType*>(
+               &_DurationType_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(DurationType& a, DurationType& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DurationType* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DurationType* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline DurationType* New() const final {
+    return CreateMaybeMessage<DurationType>(nullptr);
+  }
+
+  DurationType* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<DurationType>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const DurationType& from);
+  void MergeFrom(const DurationType& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DurationType* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.DurationType";
+  }
+  protected:
+  explicit DurationType(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDurationFieldNumber = 1,
+  };
+  // .google.protobuf.Duration duration = 1;
+  bool has_duration() const;
+  private:
+  bool _internal_has_duration() const;
+  public:
+  void clear_duration();
+  const PROTOBUF_NAMESPACE_ID::Duration& duration() const;
+  PROTOBUF_NAMESPACE_ID::Duration* release_duration();
+  PROTOBUF_NAMESPACE_ID::Duration* mutable_duration();
+  void set_allocated_duration(PROTOBUF_NAMESPACE_ID::Duration* duration);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Duration& _internal_duration() const;
+  PROTOBUF_NAMESPACE_ID::Duration* _internal_mutable_duration();
+  public:
+  void unsafe_arena_set_allocated_duration(
+      PROTOBUF_NAMESPACE_ID::Duration* duration);
+  PROTOBUF_NAMESPACE_ID::Duration* unsafe_arena_release_duration();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.DurationType)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  PROTOBUF_NAMESPACE_ID::Duration* duration_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TimestampDuration PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_util_converter.testing.TimestampDuration) */ {
+ public:
+  inline TimestampDuration() : TimestampDuration(nullptr) {};
+  virtual ~TimestampDuration();
+
+  TimestampDuration(const TimestampDuration& from);
+  TimestampDuration(TimestampDuration&& from) noexcept
+    : TimestampDuration() {
+    *this = ::std::move(from);
+  }
+
+  inline TimestampDuration& operator=(const TimestampDuration& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TimestampDuration& operator=(TimestampDuration&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TimestampDuration& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TimestampDuration* internal_default_instance() {
+    return reinterpret_cast<const TimestampDuration*>(
+               &_TimestampDuration_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(TimestampDuration& a, TimestampDuration& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimestampDuration* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimestampDuration* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TimestampDuration* New() const final {
+    return CreateMaybeMessage<TimestampDuration>(nullptr);
+  }
+
+  TimestampDuration* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TimestampDuration>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TimestampDuration& from);
+  void MergeFrom(const TimestampDuration& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimestampDuration* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_util_converter.testing.TimestampDuration";
+  }
+  protected:
+  explicit TimestampDuration(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto);
+    return ::descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRepTsFieldNumber = 3,
+    kTsFieldNumber = 1,
+    kDurFieldNumber = 2,
+  };
+  // repeated .google.protobuf.Timestamp rep_ts = 3;
+  int rep_ts_size() const;
+  private:
+  int _internal_rep_ts_size() const;
+  public:
+  void clear_rep_ts();
+  PROTOBUF_NAMESPACE_ID::Timestamp* mutable_rep_ts(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Timestamp >*
+      mutable_rep_ts();
+  private:
+  const PROTOBUF_NAMESPACE_ID::Timestamp& _internal_rep_ts(int index) const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* _internal_add_rep_ts();
+  public:
+  const PROTOBUF_NAMESPACE_ID::Timestamp& rep_ts(int index) const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* add_rep_ts();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Timestamp >&
+      rep_ts() const;
+
+  // .google.protobuf.Timestamp ts = 1;
+  bool has_ts() const;
+  private:
+  bool _internal_has_ts() const;
+  public:
+  void clear_ts();
+  const PROTOBUF_NAMESPACE_ID::Timestamp& ts() const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* release_ts();
+  PROTOBUF_NAMESPACE_ID::Timestamp* mutable_ts();
+  void set_allocated_ts(PROTOBUF_NAMESPACE_ID::Timestamp* ts);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Timestamp& _internal_ts() const;
+  PROTOBUF_NAMESPACE_ID::Timestamp* _internal_mutable_ts();
+  public:
+  void unsafe_arena_set_allocated_ts(
+      PROTOBUF_NAMESPACE_ID::Timestamp* ts);
+  PROTOBUF_NAMESPACE_ID::Timestamp* unsafe_arena_release_ts();
+
+  // .google.protobuf.Duration dur = 2;
+  bool has_dur() const;
+  private:
+  bool _internal_has_dur() const;
+  public:
+  void clear_dur();
+  const PROTOBUF_NAMESPACE_ID::Duration& dur() const;
+  PROTOBUF_NAMESPACE_ID::Duration* release_dur();
+  PROTOBUF_NAMESPACE_ID::Duration* mutable_dur();
+  void set_allocated_dur(PROTOBUF_NAMESPACE_ID::Duration* dur);
+  private:
+  const PROTOBUF_NAMESPACE_ID::Duration& _internal_dur() const;
+  PROTOBUF_NAMESPACE_ID::Duration* _internal_mutable_dur();
+  public:
+  void unsafe_arena_set_allocated_dur(
+      PROTOBUF_NAMESPACE_ID::Duration* dur);
+  PROTOBUF_NAMESPACE_ID::Duration* unsafe_arena_release_dur();
+
+  // @@protoc_insertion_point(class_scope:proto_util_converter.testing.TimestampDuration)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Timestamp > rep_ts_;
+  PROTOBUF_NAMESPACE_ID::Timestamp* ts_;
+  PROTOBUF_NAMESPACE_ID::Duration* dur_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TimestampDurationTestCases
+
+// .proto_util_converter.testing.TimeStampType epoch = 1;
+inline bool TimestampDurationTestCases::_internal_has_epoch() const {
+  return this != internal_default_instance() && epoch_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_epoch() const {
+  return _internal_has_epoch();
+}
+inline void TimestampDurationTestCases::clear_epoch() {
+  if (GetArena() == nullptr && epoch_ != nullptr) {
+    delete epoch_;
+  }
+  epoch_ = nullptr;
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::_internal_epoch() const {
+  const ::proto_util_converter::testing::TimeStampType* p = epoch_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::TimeStampType*>(
+      &::proto_util_converter::testing::_TimeStampType_default_instance_);
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::epoch() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.epoch)
+  return _internal_epoch();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_epoch(
+    ::proto_util_converter::testing::TimeStampType* epoch) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(epoch_);
+  }
+  epoch_ = epoch;
+  if (epoch) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.epoch)
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::release_epoch() {
+  
+  ::proto_util_converter::testing::TimeStampType* temp = epoch_;
+  epoch_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::unsafe_arena_release_epoch() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.epoch)
+  
+  ::proto_util_converter::testing::TimeStampType* temp = epoch_;
+  epoch_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::_internal_mutable_epoch() {
+  
+  if (epoch_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::TimeStampType>(GetArena());
+    epoch_ = p;
+  }
+  return epoch_;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::mutable_epoch() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.epoch)
+  return _internal_mutable_epoch();
+}
+inline void TimestampDurationTestCases::set_allocated_epoch(::proto_util_converter::testing::TimeStampType* epoch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete epoch_;
+  }
+  if (epoch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(epoch);
+    if (message_arena != submessage_arena) {
+      epoch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, epoch, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  epoch_ = epoch;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.epoch)
+}
+
+// .proto_util_converter.testing.TimeStampType epoch2 = 2;
+inline bool TimestampDurationTestCases::_internal_has_epoch2() const {
+  return this != internal_default_instance() && epoch2_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_epoch2() const {
+  return _internal_has_epoch2();
+}
+inline void TimestampDurationTestCases::clear_epoch2() {
+  if (GetArena() == nullptr && epoch2_ != nullptr) {
+    delete epoch2_;
+  }
+  epoch2_ = nullptr;
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::_internal_epoch2() const {
+  const ::proto_util_converter::testing::TimeStampType* p = epoch2_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::TimeStampType*>(
+      &::proto_util_converter::testing::_TimeStampType_default_instance_);
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::epoch2() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.epoch2)
+  return _internal_epoch2();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_epoch2(
+    ::proto_util_converter::testing::TimeStampType* epoch2) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(epoch2_);
+  }
+  epoch2_ = epoch2;
+  if (epoch2) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.epoch2)
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::release_epoch2() {
+  
+  ::proto_util_converter::testing::TimeStampType* temp = epoch2_;
+  epoch2_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::unsafe_arena_release_epoch2() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.epoch2)
+  
+  ::proto_util_converter::testing::TimeStampType* temp = epoch2_;
+  epoch2_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::_internal_mutable_epoch2() {
+  
+  if (epoch2_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::TimeStampType>(GetArena());
+    epoch2_ = p;
+  }
+  return epoch2_;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::mutable_epoch2() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.epoch2)
+  return _internal_mutable_epoch2();
+}
+inline void TimestampDurationTestCases::set_allocated_epoch2(::proto_util_converter::testing::TimeStampType* epoch2) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete epoch2_;
+  }
+  if (epoch2) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(epoch2);
+    if (message_arena != submessage_arena) {
+      epoch2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, epoch2, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  epoch2_ = epoch2;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.epoch2)
+}
+
+// .proto_util_converter.testing.TimeStampType mintime = 3;
+inline bool TimestampDurationTestCases::_internal_has_mintime() const {
+  return this != internal_default_instance() && mintime_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_mintime() const {
+  return _internal_has_mintime();
+}
+inline void TimestampDurationTestCases::clear_mintime() {
+  if (GetArena() == nullptr && mintime_ != nullptr) {
+    delete mintime_;
+  }
+  mintime_ = nullptr;
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::_internal_mintime() const {
+  const ::proto_util_converter::testing::TimeStampType* p = mintime_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::TimeStampType*>(
+      &::proto_util_converter::testing::_TimeStampType_default_instance_);
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::mintime() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.mintime)
+  return _internal_mintime();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_mintime(
+    ::proto_util_converter::testing::TimeStampType* mintime) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(mintime_);
+  }
+  mintime_ = mintime;
+  if (mintime) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.mintime)
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::release_mintime() {
+  
+  ::proto_util_converter::testing::TimeStampType* temp = mintime_;
+  mintime_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::unsafe_arena_release_mintime() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.mintime)
+  
+  ::proto_util_converter::testing::TimeStampType* temp = mintime_;
+  mintime_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::_internal_mutable_mintime() {
+  
+  if (mintime_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::TimeStampType>(GetArena());
+    mintime_ = p;
+  }
+  return mintime_;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::mutable_mintime() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.mintime)
+  return _internal_mutable_mintime();
+}
+inline void TimestampDurationTestCases::set_allocated_mintime(::proto_util_converter::testing::TimeStampType* mintime) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete mintime_;
+  }
+  if (mintime) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(mintime);
+    if (message_arena != submessage_arena) {
+      mintime = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mintime, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  mintime_ = mintime;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.mintime)
+}
+
+// .proto_util_converter.testing.TimeStampType maxtime = 4;
+inline bool TimestampDurationTestCases::_internal_has_maxtime() const {
+  return this != internal_default_instance() && maxtime_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_maxtime() const {
+  return _internal_has_maxtime();
+}
+inline void TimestampDurationTestCases::clear_maxtime() {
+  if (GetArena() == nullptr && maxtime_ != nullptr) {
+    delete maxtime_;
+  }
+  maxtime_ = nullptr;
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::_internal_maxtime() const {
+  const ::proto_util_converter::testing::TimeStampType* p = maxtime_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::TimeStampType*>(
+      &::proto_util_converter::testing::_TimeStampType_default_instance_);
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::maxtime() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.maxtime)
+  return _internal_maxtime();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_maxtime(
+    ::proto_util_converter::testing::TimeStampType* maxtime) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(maxtime_);
+  }
+  maxtime_ = maxtime;
+  if (maxtime) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.maxtime)
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::release_maxtime() {
+  
+  ::proto_util_converter::testing::TimeStampType* temp = maxtime_;
+  maxtime_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::unsafe_arena_release_maxtime() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.maxtime)
+  
+  ::proto_util_converter::testing::TimeStampType* temp = maxtime_;
+  maxtime_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::_internal_mutable_maxtime() {
+  
+  if (maxtime_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::TimeStampType>(GetArena());
+    maxtime_ = p;
+  }
+  return maxtime_;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::mutable_maxtime() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.maxtime)
+  return _internal_mutable_maxtime();
+}
+inline void TimestampDurationTestCases::set_allocated_maxtime(::proto_util_converter::testing::TimeStampType* maxtime) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete maxtime_;
+  }
+  if (maxtime) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(maxtime);
+    if (message_arena != submessage_arena) {
+      maxtime = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, maxtime, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  maxtime_ = maxtime;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.maxtime)
+}
+
+// .proto_util_converter.testing.TimeStampType timeval1 = 5;
+inline bool TimestampDurationTestCases::_internal_has_timeval1() const {
+  return this != internal_default_instance() && timeval1_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_timeval1() const {
+  return _internal_has_timeval1();
+}
+inline void TimestampDurationTestCases::clear_timeval1() {
+  if (GetArena() == nullptr && timeval1_ != nullptr) {
+    delete timeval1_;
+  }
+  timeval1_ = nullptr;
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::_internal_timeval1() const {
+  const ::proto_util_converter::testing::TimeStampType* p = timeval1_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::TimeStampType*>(
+      &::proto_util_converter::testing::_TimeStampType_default_instance_);
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::timeval1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.timeval1)
+  return _internal_timeval1();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_timeval1(
+    ::proto_util_converter::testing::TimeStampType* timeval1) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timeval1_);
+  }
+  timeval1_ = timeval1;
+  if (timeval1) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval1)
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::release_timeval1() {
+  
+  ::proto_util_converter::testing::TimeStampType* temp = timeval1_;
+  timeval1_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::unsafe_arena_release_timeval1() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.timeval1)
+  
+  ::proto_util_converter::testing::TimeStampType* temp = timeval1_;
+  timeval1_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::_internal_mutable_timeval1() {
+  
+  if (timeval1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::TimeStampType>(GetArena());
+    timeval1_ = p;
+  }
+  return timeval1_;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::mutable_timeval1() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.timeval1)
+  return _internal_mutable_timeval1();
+}
+inline void TimestampDurationTestCases::set_allocated_timeval1(::proto_util_converter::testing::TimeStampType* timeval1) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete timeval1_;
+  }
+  if (timeval1) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(timeval1);
+    if (message_arena != submessage_arena) {
+      timeval1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timeval1, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  timeval1_ = timeval1;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval1)
+}
+
+// .proto_util_converter.testing.TimeStampType timeval2 = 6;
+inline bool TimestampDurationTestCases::_internal_has_timeval2() const {
+  return this != internal_default_instance() && timeval2_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_timeval2() const {
+  return _internal_has_timeval2();
+}
+inline void TimestampDurationTestCases::clear_timeval2() {
+  if (GetArena() == nullptr && timeval2_ != nullptr) {
+    delete timeval2_;
+  }
+  timeval2_ = nullptr;
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::_internal_timeval2() const {
+  const ::proto_util_converter::testing::TimeStampType* p = timeval2_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::TimeStampType*>(
+      &::proto_util_converter::testing::_TimeStampType_default_instance_);
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::timeval2() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.timeval2)
+  return _internal_timeval2();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_timeval2(
+    ::proto_util_converter::testing::TimeStampType* timeval2) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timeval2_);
+  }
+  timeval2_ = timeval2;
+  if (timeval2) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval2)
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::release_timeval2() {
+  
+  ::proto_util_converter::testing::TimeStampType* temp = timeval2_;
+  timeval2_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::unsafe_arena_release_timeval2() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.timeval2)
+  
+  ::proto_util_converter::testing::TimeStampType* temp = timeval2_;
+  timeval2_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::_internal_mutable_timeval2() {
+  
+  if (timeval2_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::TimeStampType>(GetArena());
+    timeval2_ = p;
+  }
+  return timeval2_;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::mutable_timeval2() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.timeval2)
+  return _internal_mutable_timeval2();
+}
+inline void TimestampDurationTestCases::set_allocated_timeval2(::proto_util_converter::testing::TimeStampType* timeval2) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete timeval2_;
+  }
+  if (timeval2) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(timeval2);
+    if (message_arena != submessage_arena) {
+      timeval2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timeval2, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  timeval2_ = timeval2;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval2)
+}
+
+// .proto_util_converter.testing.TimeStampType timeval3 = 7;
+inline bool TimestampDurationTestCases::_internal_has_timeval3() const {
+  return this != internal_default_instance() && timeval3_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_timeval3() const {
+  return _internal_has_timeval3();
+}
+inline void TimestampDurationTestCases::clear_timeval3() {
+  if (GetArena() == nullptr && timeval3_ != nullptr) {
+    delete timeval3_;
+  }
+  timeval3_ = nullptr;
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::_internal_timeval3() const {
+  const ::proto_util_converter::testing::TimeStampType* p = timeval3_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::TimeStampType*>(
+      &::proto_util_converter::testing::_TimeStampType_default_instance_);
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::timeval3() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.timeval3)
+  return _internal_timeval3();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_timeval3(
+    ::proto_util_converter::testing::TimeStampType* timeval3) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timeval3_);
+  }
+  timeval3_ = timeval3;
+  if (timeval3) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval3)
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::release_timeval3() {
+  
+  ::proto_util_converter::testing::TimeStampType* temp = timeval3_;
+  timeval3_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::unsafe_arena_release_timeval3() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.timeval3)
+  
+  ::proto_util_converter::testing::TimeStampType* temp = timeval3_;
+  timeval3_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::_internal_mutable_timeval3() {
+  
+  if (timeval3_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::TimeStampType>(GetArena());
+    timeval3_ = p;
+  }
+  return timeval3_;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::mutable_timeval3() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.timeval3)
+  return _internal_mutable_timeval3();
+}
+inline void TimestampDurationTestCases::set_allocated_timeval3(::proto_util_converter::testing::TimeStampType* timeval3) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete timeval3_;
+  }
+  if (timeval3) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(timeval3);
+    if (message_arena != submessage_arena) {
+      timeval3 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timeval3, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  timeval3_ = timeval3;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval3)
+}
+
+// .proto_util_converter.testing.TimeStampType timeval4 = 8;
+inline bool TimestampDurationTestCases::_internal_has_timeval4() const {
+  return this != internal_default_instance() && timeval4_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_timeval4() const {
+  return _internal_has_timeval4();
+}
+inline void TimestampDurationTestCases::clear_timeval4() {
+  if (GetArena() == nullptr && timeval4_ != nullptr) {
+    delete timeval4_;
+  }
+  timeval4_ = nullptr;
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::_internal_timeval4() const {
+  const ::proto_util_converter::testing::TimeStampType* p = timeval4_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::TimeStampType*>(
+      &::proto_util_converter::testing::_TimeStampType_default_instance_);
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::timeval4() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.timeval4)
+  return _internal_timeval4();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_timeval4(
+    ::proto_util_converter::testing::TimeStampType* timeval4) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timeval4_);
+  }
+  timeval4_ = timeval4;
+  if (timeval4) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval4)
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::release_timeval4() {
+  
+  ::proto_util_converter::testing::TimeStampType* temp = timeval4_;
+  timeval4_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::unsafe_arena_release_timeval4() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.timeval4)
+  
+  ::proto_util_converter::testing::TimeStampType* temp = timeval4_;
+  timeval4_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::_internal_mutable_timeval4() {
+  
+  if (timeval4_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::TimeStampType>(GetArena());
+    timeval4_ = p;
+  }
+  return timeval4_;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::mutable_timeval4() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.timeval4)
+  return _internal_mutable_timeval4();
+}
+inline void TimestampDurationTestCases::set_allocated_timeval4(::proto_util_converter::testing::TimeStampType* timeval4) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete timeval4_;
+  }
+  if (timeval4) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(timeval4);
+    if (message_arena != submessage_arena) {
+      timeval4 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timeval4, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  timeval4_ = timeval4;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval4)
+}
+
+// .proto_util_converter.testing.TimeStampType timeval5 = 9;
+inline bool TimestampDurationTestCases::_internal_has_timeval5() const {
+  return this != internal_default_instance() && timeval5_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_timeval5() const {
+  return _internal_has_timeval5();
+}
+inline void TimestampDurationTestCases::clear_timeval5() {
+  if (GetArena() == nullptr && timeval5_ != nullptr) {
+    delete timeval5_;
+  }
+  timeval5_ = nullptr;
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::_internal_timeval5() const {
+  const ::proto_util_converter::testing::TimeStampType* p = timeval5_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::TimeStampType*>(
+      &::proto_util_converter::testing::_TimeStampType_default_instance_);
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::timeval5() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.timeval5)
+  return _internal_timeval5();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_timeval5(
+    ::proto_util_converter::testing::TimeStampType* timeval5) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timeval5_);
+  }
+  timeval5_ = timeval5;
+  if (timeval5) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval5)
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::release_timeval5() {
+  
+  ::proto_util_converter::testing::TimeStampType* temp = timeval5_;
+  timeval5_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::unsafe_arena_release_timeval5() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.timeval5)
+  
+  ::proto_util_converter::testing::TimeStampType* temp = timeval5_;
+  timeval5_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::_internal_mutable_timeval5() {
+  
+  if (timeval5_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::TimeStampType>(GetArena());
+    timeval5_ = p;
+  }
+  return timeval5_;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::mutable_timeval5() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.timeval5)
+  return _internal_mutable_timeval5();
+}
+inline void TimestampDurationTestCases::set_allocated_timeval5(::proto_util_converter::testing::TimeStampType* timeval5) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete timeval5_;
+  }
+  if (timeval5) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(timeval5);
+    if (message_arena != submessage_arena) {
+      timeval5 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timeval5, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  timeval5_ = timeval5;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval5)
+}
+
+// .proto_util_converter.testing.TimeStampType timeval6 = 10;
+inline bool TimestampDurationTestCases::_internal_has_timeval6() const {
+  return this != internal_default_instance() && timeval6_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_timeval6() const {
+  return _internal_has_timeval6();
+}
+inline void TimestampDurationTestCases::clear_timeval6() {
+  if (GetArena() == nullptr && timeval6_ != nullptr) {
+    delete timeval6_;
+  }
+  timeval6_ = nullptr;
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::_internal_timeval6() const {
+  const ::proto_util_converter::testing::TimeStampType* p = timeval6_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::TimeStampType*>(
+      &::proto_util_converter::testing::_TimeStampType_default_instance_);
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::timeval6() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.timeval6)
+  return _internal_timeval6();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_timeval6(
+    ::proto_util_converter::testing::TimeStampType* timeval6) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timeval6_);
+  }
+  timeval6_ = timeval6;
+  if (timeval6) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval6)
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::release_timeval6() {
+  
+  ::proto_util_converter::testing::TimeStampType* temp = timeval6_;
+  timeval6_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::unsafe_arena_release_timeval6() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.timeval6)
+  
+  ::proto_util_converter::testing::TimeStampType* temp = timeval6_;
+  timeval6_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::_internal_mutable_timeval6() {
+  
+  if (timeval6_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::TimeStampType>(GetArena());
+    timeval6_ = p;
+  }
+  return timeval6_;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::mutable_timeval6() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.timeval6)
+  return _internal_mutable_timeval6();
+}
+inline void TimestampDurationTestCases::set_allocated_timeval6(::proto_util_converter::testing::TimeStampType* timeval6) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete timeval6_;
+  }
+  if (timeval6) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(timeval6);
+    if (message_arena != submessage_arena) {
+      timeval6 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timeval6, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  timeval6_ = timeval6;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval6)
+}
+
+// .proto_util_converter.testing.TimeStampType timeval7 = 11;
+inline bool TimestampDurationTestCases::_internal_has_timeval7() const {
+  return this != internal_default_instance() && timeval7_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_timeval7() const {
+  return _internal_has_timeval7();
+}
+inline void TimestampDurationTestCases::clear_timeval7() {
+  if (GetArena() == nullptr && timeval7_ != nullptr) {
+    delete timeval7_;
+  }
+  timeval7_ = nullptr;
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::_internal_timeval7() const {
+  const ::proto_util_converter::testing::TimeStampType* p = timeval7_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::TimeStampType*>(
+      &::proto_util_converter::testing::_TimeStampType_default_instance_);
+}
+inline const ::proto_util_converter::testing::TimeStampType& TimestampDurationTestCases::timeval7() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.timeval7)
+  return _internal_timeval7();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_timeval7(
+    ::proto_util_converter::testing::TimeStampType* timeval7) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timeval7_);
+  }
+  timeval7_ = timeval7;
+  if (timeval7) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval7)
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::release_timeval7() {
+  
+  ::proto_util_converter::testing::TimeStampType* temp = timeval7_;
+  timeval7_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::unsafe_arena_release_timeval7() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.timeval7)
+  
+  ::proto_util_converter::testing::TimeStampType* temp = timeval7_;
+  timeval7_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::_internal_mutable_timeval7() {
+  
+  if (timeval7_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::TimeStampType>(GetArena());
+    timeval7_ = p;
+  }
+  return timeval7_;
+}
+inline ::proto_util_converter::testing::TimeStampType* TimestampDurationTestCases::mutable_timeval7() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.timeval7)
+  return _internal_mutable_timeval7();
+}
+inline void TimestampDurationTestCases::set_allocated_timeval7(::proto_util_converter::testing::TimeStampType* timeval7) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete timeval7_;
+  }
+  if (timeval7) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(timeval7);
+    if (message_arena != submessage_arena) {
+      timeval7 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timeval7, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  timeval7_ = timeval7;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval7)
+}
+
+// .google.protobuf.Timestamp timeval8 = 12;
+inline bool TimestampDurationTestCases::_internal_has_timeval8() const {
+  return this != internal_default_instance() && timeval8_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_timeval8() const {
+  return _internal_has_timeval8();
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& TimestampDurationTestCases::_internal_timeval8() const {
+  const PROTOBUF_NAMESPACE_ID::Timestamp* p = timeval8_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Timestamp*>(
+      &PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& TimestampDurationTestCases::timeval8() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.timeval8)
+  return _internal_timeval8();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_timeval8(
+    PROTOBUF_NAMESPACE_ID::Timestamp* timeval8) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timeval8_);
+  }
+  timeval8_ = timeval8;
+  if (timeval8) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval8)
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TimestampDurationTestCases::release_timeval8() {
+  
+  PROTOBUF_NAMESPACE_ID::Timestamp* temp = timeval8_;
+  timeval8_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TimestampDurationTestCases::unsafe_arena_release_timeval8() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.timeval8)
+  
+  PROTOBUF_NAMESPACE_ID::Timestamp* temp = timeval8_;
+  timeval8_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TimestampDurationTestCases::_internal_mutable_timeval8() {
+  
+  if (timeval8_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Timestamp>(GetArena());
+    timeval8_ = p;
+  }
+  return timeval8_;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TimestampDurationTestCases::mutable_timeval8() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.timeval8)
+  return _internal_mutable_timeval8();
+}
+inline void TimestampDurationTestCases::set_allocated_timeval8(PROTOBUF_NAMESPACE_ID::Timestamp* timeval8) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(timeval8_);
+  }
+  if (timeval8) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timeval8)->GetArena();
+    if (message_arena != submessage_arena) {
+      timeval8 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timeval8, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  timeval8_ = timeval8;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.timeval8)
+}
+
+// .proto_util_converter.testing.DurationType zero_duration = 101;
+inline bool TimestampDurationTestCases::_internal_has_zero_duration() const {
+  return this != internal_default_instance() && zero_duration_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_zero_duration() const {
+  return _internal_has_zero_duration();
+}
+inline void TimestampDurationTestCases::clear_zero_duration() {
+  if (GetArena() == nullptr && zero_duration_ != nullptr) {
+    delete zero_duration_;
+  }
+  zero_duration_ = nullptr;
+}
+inline const ::proto_util_converter::testing::DurationType& TimestampDurationTestCases::_internal_zero_duration() const {
+  const ::proto_util_converter::testing::DurationType* p = zero_duration_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::DurationType*>(
+      &::proto_util_converter::testing::_DurationType_default_instance_);
+}
+inline const ::proto_util_converter::testing::DurationType& TimestampDurationTestCases::zero_duration() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.zero_duration)
+  return _internal_zero_duration();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_zero_duration(
+    ::proto_util_converter::testing::DurationType* zero_duration) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(zero_duration_);
+  }
+  zero_duration_ = zero_duration;
+  if (zero_duration) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.zero_duration)
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::release_zero_duration() {
+  
+  ::proto_util_converter::testing::DurationType* temp = zero_duration_;
+  zero_duration_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::unsafe_arena_release_zero_duration() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.zero_duration)
+  
+  ::proto_util_converter::testing::DurationType* temp = zero_duration_;
+  zero_duration_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::_internal_mutable_zero_duration() {
+  
+  if (zero_duration_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::DurationType>(GetArena());
+    zero_duration_ = p;
+  }
+  return zero_duration_;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::mutable_zero_duration() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.zero_duration)
+  return _internal_mutable_zero_duration();
+}
+inline void TimestampDurationTestCases::set_allocated_zero_duration(::proto_util_converter::testing::DurationType* zero_duration) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete zero_duration_;
+  }
+  if (zero_duration) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(zero_duration);
+    if (message_arena != submessage_arena) {
+      zero_duration = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, zero_duration, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  zero_duration_ = zero_duration;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.zero_duration)
+}
+
+// .proto_util_converter.testing.DurationType min_duration = 102;
+inline bool TimestampDurationTestCases::_internal_has_min_duration() const {
+  return this != internal_default_instance() && min_duration_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_min_duration() const {
+  return _internal_has_min_duration();
+}
+inline void TimestampDurationTestCases::clear_min_duration() {
+  if (GetArena() == nullptr && min_duration_ != nullptr) {
+    delete min_duration_;
+  }
+  min_duration_ = nullptr;
+}
+inline const ::proto_util_converter::testing::DurationType& TimestampDurationTestCases::_internal_min_duration() const {
+  const ::proto_util_converter::testing::DurationType* p = min_duration_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::DurationType*>(
+      &::proto_util_converter::testing::_DurationType_default_instance_);
+}
+inline const ::proto_util_converter::testing::DurationType& TimestampDurationTestCases::min_duration() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.min_duration)
+  return _internal_min_duration();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_min_duration(
+    ::proto_util_converter::testing::DurationType* min_duration) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(min_duration_);
+  }
+  min_duration_ = min_duration;
+  if (min_duration) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.min_duration)
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::release_min_duration() {
+  
+  ::proto_util_converter::testing::DurationType* temp = min_duration_;
+  min_duration_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::unsafe_arena_release_min_duration() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.min_duration)
+  
+  ::proto_util_converter::testing::DurationType* temp = min_duration_;
+  min_duration_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::_internal_mutable_min_duration() {
+  
+  if (min_duration_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::DurationType>(GetArena());
+    min_duration_ = p;
+  }
+  return min_duration_;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::mutable_min_duration() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.min_duration)
+  return _internal_mutable_min_duration();
+}
+inline void TimestampDurationTestCases::set_allocated_min_duration(::proto_util_converter::testing::DurationType* min_duration) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete min_duration_;
+  }
+  if (min_duration) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(min_duration);
+    if (message_arena != submessage_arena) {
+      min_duration = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, min_duration, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  min_duration_ = min_duration;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.min_duration)
+}
+
+// .proto_util_converter.testing.DurationType max_duration = 103;
+inline bool TimestampDurationTestCases::_internal_has_max_duration() const {
+  return this != internal_default_instance() && max_duration_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_max_duration() const {
+  return _internal_has_max_duration();
+}
+inline void TimestampDurationTestCases::clear_max_duration() {
+  if (GetArena() == nullptr && max_duration_ != nullptr) {
+    delete max_duration_;
+  }
+  max_duration_ = nullptr;
+}
+inline const ::proto_util_converter::testing::DurationType& TimestampDurationTestCases::_internal_max_duration() const {
+  const ::proto_util_converter::testing::DurationType* p = max_duration_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::DurationType*>(
+      &::proto_util_converter::testing::_DurationType_default_instance_);
+}
+inline const ::proto_util_converter::testing::DurationType& TimestampDurationTestCases::max_duration() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.max_duration)
+  return _internal_max_duration();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_max_duration(
+    ::proto_util_converter::testing::DurationType* max_duration) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(max_duration_);
+  }
+  max_duration_ = max_duration;
+  if (max_duration) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.max_duration)
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::release_max_duration() {
+  
+  ::proto_util_converter::testing::DurationType* temp = max_duration_;
+  max_duration_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::unsafe_arena_release_max_duration() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.max_duration)
+  
+  ::proto_util_converter::testing::DurationType* temp = max_duration_;
+  max_duration_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::_internal_mutable_max_duration() {
+  
+  if (max_duration_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::DurationType>(GetArena());
+    max_duration_ = p;
+  }
+  return max_duration_;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::mutable_max_duration() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.max_duration)
+  return _internal_mutable_max_duration();
+}
+inline void TimestampDurationTestCases::set_allocated_max_duration(::proto_util_converter::testing::DurationType* max_duration) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete max_duration_;
+  }
+  if (max_duration) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(max_duration);
+    if (message_arena != submessage_arena) {
+      max_duration = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, max_duration, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  max_duration_ = max_duration;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.max_duration)
+}
+
+// .proto_util_converter.testing.DurationType duration1 = 104;
+inline bool TimestampDurationTestCases::_internal_has_duration1() const {
+  return this != internal_default_instance() && duration1_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_duration1() const {
+  return _internal_has_duration1();
+}
+inline void TimestampDurationTestCases::clear_duration1() {
+  if (GetArena() == nullptr && duration1_ != nullptr) {
+    delete duration1_;
+  }
+  duration1_ = nullptr;
+}
+inline const ::proto_util_converter::testing::DurationType& TimestampDurationTestCases::_internal_duration1() const {
+  const ::proto_util_converter::testing::DurationType* p = duration1_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::DurationType*>(
+      &::proto_util_converter::testing::_DurationType_default_instance_);
+}
+inline const ::proto_util_converter::testing::DurationType& TimestampDurationTestCases::duration1() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.duration1)
+  return _internal_duration1();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_duration1(
+    ::proto_util_converter::testing::DurationType* duration1) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration1_);
+  }
+  duration1_ = duration1;
+  if (duration1) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.duration1)
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::release_duration1() {
+  
+  ::proto_util_converter::testing::DurationType* temp = duration1_;
+  duration1_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::unsafe_arena_release_duration1() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.duration1)
+  
+  ::proto_util_converter::testing::DurationType* temp = duration1_;
+  duration1_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::_internal_mutable_duration1() {
+  
+  if (duration1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::DurationType>(GetArena());
+    duration1_ = p;
+  }
+  return duration1_;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::mutable_duration1() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.duration1)
+  return _internal_mutable_duration1();
+}
+inline void TimestampDurationTestCases::set_allocated_duration1(::proto_util_converter::testing::DurationType* duration1) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete duration1_;
+  }
+  if (duration1) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(duration1);
+    if (message_arena != submessage_arena) {
+      duration1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, duration1, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  duration1_ = duration1;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.duration1)
+}
+
+// .proto_util_converter.testing.DurationType duration2 = 105;
+inline bool TimestampDurationTestCases::_internal_has_duration2() const {
+  return this != internal_default_instance() && duration2_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_duration2() const {
+  return _internal_has_duration2();
+}
+inline void TimestampDurationTestCases::clear_duration2() {
+  if (GetArena() == nullptr && duration2_ != nullptr) {
+    delete duration2_;
+  }
+  duration2_ = nullptr;
+}
+inline const ::proto_util_converter::testing::DurationType& TimestampDurationTestCases::_internal_duration2() const {
+  const ::proto_util_converter::testing::DurationType* p = duration2_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::DurationType*>(
+      &::proto_util_converter::testing::_DurationType_default_instance_);
+}
+inline const ::proto_util_converter::testing::DurationType& TimestampDurationTestCases::duration2() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.duration2)
+  return _internal_duration2();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_duration2(
+    ::proto_util_converter::testing::DurationType* duration2) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration2_);
+  }
+  duration2_ = duration2;
+  if (duration2) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.duration2)
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::release_duration2() {
+  
+  ::proto_util_converter::testing::DurationType* temp = duration2_;
+  duration2_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::unsafe_arena_release_duration2() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.duration2)
+  
+  ::proto_util_converter::testing::DurationType* temp = duration2_;
+  duration2_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::_internal_mutable_duration2() {
+  
+  if (duration2_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::DurationType>(GetArena());
+    duration2_ = p;
+  }
+  return duration2_;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::mutable_duration2() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.duration2)
+  return _internal_mutable_duration2();
+}
+inline void TimestampDurationTestCases::set_allocated_duration2(::proto_util_converter::testing::DurationType* duration2) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete duration2_;
+  }
+  if (duration2) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(duration2);
+    if (message_arena != submessage_arena) {
+      duration2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, duration2, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  duration2_ = duration2;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.duration2)
+}
+
+// .proto_util_converter.testing.DurationType duration3 = 106;
+inline bool TimestampDurationTestCases::_internal_has_duration3() const {
+  return this != internal_default_instance() && duration3_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_duration3() const {
+  return _internal_has_duration3();
+}
+inline void TimestampDurationTestCases::clear_duration3() {
+  if (GetArena() == nullptr && duration3_ != nullptr) {
+    delete duration3_;
+  }
+  duration3_ = nullptr;
+}
+inline const ::proto_util_converter::testing::DurationType& TimestampDurationTestCases::_internal_duration3() const {
+  const ::proto_util_converter::testing::DurationType* p = duration3_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::DurationType*>(
+      &::proto_util_converter::testing::_DurationType_default_instance_);
+}
+inline const ::proto_util_converter::testing::DurationType& TimestampDurationTestCases::duration3() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.duration3)
+  return _internal_duration3();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_duration3(
+    ::proto_util_converter::testing::DurationType* duration3) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration3_);
+  }
+  duration3_ = duration3;
+  if (duration3) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.duration3)
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::release_duration3() {
+  
+  ::proto_util_converter::testing::DurationType* temp = duration3_;
+  duration3_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::unsafe_arena_release_duration3() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.duration3)
+  
+  ::proto_util_converter::testing::DurationType* temp = duration3_;
+  duration3_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::_internal_mutable_duration3() {
+  
+  if (duration3_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::DurationType>(GetArena());
+    duration3_ = p;
+  }
+  return duration3_;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::mutable_duration3() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.duration3)
+  return _internal_mutable_duration3();
+}
+inline void TimestampDurationTestCases::set_allocated_duration3(::proto_util_converter::testing::DurationType* duration3) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete duration3_;
+  }
+  if (duration3) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(duration3);
+    if (message_arena != submessage_arena) {
+      duration3 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, duration3, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  duration3_ = duration3;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.duration3)
+}
+
+// .proto_util_converter.testing.DurationType duration4 = 107;
+inline bool TimestampDurationTestCases::_internal_has_duration4() const {
+  return this != internal_default_instance() && duration4_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_duration4() const {
+  return _internal_has_duration4();
+}
+inline void TimestampDurationTestCases::clear_duration4() {
+  if (GetArena() == nullptr && duration4_ != nullptr) {
+    delete duration4_;
+  }
+  duration4_ = nullptr;
+}
+inline const ::proto_util_converter::testing::DurationType& TimestampDurationTestCases::_internal_duration4() const {
+  const ::proto_util_converter::testing::DurationType* p = duration4_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::proto_util_converter::testing::DurationType*>(
+      &::proto_util_converter::testing::_DurationType_default_instance_);
+}
+inline const ::proto_util_converter::testing::DurationType& TimestampDurationTestCases::duration4() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.duration4)
+  return _internal_duration4();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_duration4(
+    ::proto_util_converter::testing::DurationType* duration4) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration4_);
+  }
+  duration4_ = duration4;
+  if (duration4) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.duration4)
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::release_duration4() {
+  
+  ::proto_util_converter::testing::DurationType* temp = duration4_;
+  duration4_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::unsafe_arena_release_duration4() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.duration4)
+  
+  ::proto_util_converter::testing::DurationType* temp = duration4_;
+  duration4_ = nullptr;
+  return temp;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::_internal_mutable_duration4() {
+  
+  if (duration4_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_util_converter::testing::DurationType>(GetArena());
+    duration4_ = p;
+  }
+  return duration4_;
+}
+inline ::proto_util_converter::testing::DurationType* TimestampDurationTestCases::mutable_duration4() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.duration4)
+  return _internal_mutable_duration4();
+}
+inline void TimestampDurationTestCases::set_allocated_duration4(::proto_util_converter::testing::DurationType* duration4) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete duration4_;
+  }
+  if (duration4) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(duration4);
+    if (message_arena != submessage_arena) {
+      duration4 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, duration4, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  duration4_ = duration4;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.duration4)
+}
+
+// .google.protobuf.Duration duration5 = 108;
+inline bool TimestampDurationTestCases::_internal_has_duration5() const {
+  return this != internal_default_instance() && duration5_ != nullptr;
+}
+inline bool TimestampDurationTestCases::has_duration5() const {
+  return _internal_has_duration5();
+}
+inline const PROTOBUF_NAMESPACE_ID::Duration& TimestampDurationTestCases::_internal_duration5() const {
+  const PROTOBUF_NAMESPACE_ID::Duration* p = duration5_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Duration*>(
+      &PROTOBUF_NAMESPACE_ID::_Duration_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Duration& TimestampDurationTestCases::duration5() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDurationTestCases.duration5)
+  return _internal_duration5();
+}
+inline void TimestampDurationTestCases::unsafe_arena_set_allocated_duration5(
+    PROTOBUF_NAMESPACE_ID::Duration* duration5) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration5_);
+  }
+  duration5_ = duration5;
+  if (duration5) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.duration5)
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* TimestampDurationTestCases::release_duration5() {
+  
+  PROTOBUF_NAMESPACE_ID::Duration* temp = duration5_;
+  duration5_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* TimestampDurationTestCases::unsafe_arena_release_duration5() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDurationTestCases.duration5)
+  
+  PROTOBUF_NAMESPACE_ID::Duration* temp = duration5_;
+  duration5_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* TimestampDurationTestCases::_internal_mutable_duration5() {
+  
+  if (duration5_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Duration>(GetArena());
+    duration5_ = p;
+  }
+  return duration5_;
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* TimestampDurationTestCases::mutable_duration5() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDurationTestCases.duration5)
+  return _internal_mutable_duration5();
+}
+inline void TimestampDurationTestCases::set_allocated_duration5(PROTOBUF_NAMESPACE_ID::Duration* duration5) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration5_);
+  }
+  if (duration5) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration5)->GetArena();
+    if (message_arena != submessage_arena) {
+      duration5 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, duration5, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  duration5_ = duration5;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDurationTestCases.duration5)
+}
+
+// -------------------------------------------------------------------
+
+// TimeStampType
+
+// .google.protobuf.Timestamp timestamp = 1;
+inline bool TimeStampType::_internal_has_timestamp() const {
+  return this != internal_default_instance() && timestamp_ != nullptr;
+}
+inline bool TimeStampType::has_timestamp() const {
+  return _internal_has_timestamp();
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& TimeStampType::_internal_timestamp() const {
+  const PROTOBUF_NAMESPACE_ID::Timestamp* p = timestamp_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Timestamp*>(
+      &PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& TimeStampType::timestamp() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimeStampType.timestamp)
+  return _internal_timestamp();
+}
+inline void TimeStampType::unsafe_arena_set_allocated_timestamp(
+    PROTOBUF_NAMESPACE_ID::Timestamp* timestamp) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp_);
+  }
+  timestamp_ = timestamp;
+  if (timestamp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimeStampType.timestamp)
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TimeStampType::release_timestamp() {
+  
+  PROTOBUF_NAMESPACE_ID::Timestamp* temp = timestamp_;
+  timestamp_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TimeStampType::unsafe_arena_release_timestamp() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimeStampType.timestamp)
+  
+  PROTOBUF_NAMESPACE_ID::Timestamp* temp = timestamp_;
+  timestamp_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TimeStampType::_internal_mutable_timestamp() {
+  
+  if (timestamp_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Timestamp>(GetArena());
+    timestamp_ = p;
+  }
+  return timestamp_;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TimeStampType::mutable_timestamp() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimeStampType.timestamp)
+  return _internal_mutable_timestamp();
+}
+inline void TimeStampType::set_allocated_timestamp(PROTOBUF_NAMESPACE_ID::Timestamp* timestamp) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp_);
+  }
+  if (timestamp) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp)->GetArena();
+    if (message_arena != submessage_arena) {
+      timestamp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timestamp, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  timestamp_ = timestamp;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimeStampType.timestamp)
+}
+
+// -------------------------------------------------------------------
+
+// DurationType
+
+// .google.protobuf.Duration duration = 1;
+inline bool DurationType::_internal_has_duration() const {
+  return this != internal_default_instance() && duration_ != nullptr;
+}
+inline bool DurationType::has_duration() const {
+  return _internal_has_duration();
+}
+inline const PROTOBUF_NAMESPACE_ID::Duration& DurationType::_internal_duration() const {
+  const PROTOBUF_NAMESPACE_ID::Duration* p = duration_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Duration*>(
+      &PROTOBUF_NAMESPACE_ID::_Duration_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Duration& DurationType::duration() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.DurationType.duration)
+  return _internal_duration();
+}
+inline void DurationType::unsafe_arena_set_allocated_duration(
+    PROTOBUF_NAMESPACE_ID::Duration* duration) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration_);
+  }
+  duration_ = duration;
+  if (duration) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.DurationType.duration)
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* DurationType::release_duration() {
+  
+  PROTOBUF_NAMESPACE_ID::Duration* temp = duration_;
+  duration_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* DurationType::unsafe_arena_release_duration() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.DurationType.duration)
+  
+  PROTOBUF_NAMESPACE_ID::Duration* temp = duration_;
+  duration_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* DurationType::_internal_mutable_duration() {
+  
+  if (duration_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Duration>(GetArena());
+    duration_ = p;
+  }
+  return duration_;
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* DurationType::mutable_duration() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.DurationType.duration)
+  return _internal_mutable_duration();
+}
+inline void DurationType::set_allocated_duration(PROTOBUF_NAMESPACE_ID::Duration* duration) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration_);
+  }
+  if (duration) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(duration)->GetArena();
+    if (message_arena != submessage_arena) {
+      duration = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, duration, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  duration_ = duration;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.DurationType.duration)
+}
+
+// -------------------------------------------------------------------
+
+// TimestampDuration
+
+// .google.protobuf.Timestamp ts = 1;
+inline bool TimestampDuration::_internal_has_ts() const {
+  return this != internal_default_instance() && ts_ != nullptr;
+}
+inline bool TimestampDuration::has_ts() const {
+  return _internal_has_ts();
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& TimestampDuration::_internal_ts() const {
+  const PROTOBUF_NAMESPACE_ID::Timestamp* p = ts_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Timestamp*>(
+      &PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& TimestampDuration::ts() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDuration.ts)
+  return _internal_ts();
+}
+inline void TimestampDuration::unsafe_arena_set_allocated_ts(
+    PROTOBUF_NAMESPACE_ID::Timestamp* ts) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(ts_);
+  }
+  ts_ = ts;
+  if (ts) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDuration.ts)
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TimestampDuration::release_ts() {
+  
+  PROTOBUF_NAMESPACE_ID::Timestamp* temp = ts_;
+  ts_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TimestampDuration::unsafe_arena_release_ts() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDuration.ts)
+  
+  PROTOBUF_NAMESPACE_ID::Timestamp* temp = ts_;
+  ts_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TimestampDuration::_internal_mutable_ts() {
+  
+  if (ts_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Timestamp>(GetArena());
+    ts_ = p;
+  }
+  return ts_;
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TimestampDuration::mutable_ts() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDuration.ts)
+  return _internal_mutable_ts();
+}
+inline void TimestampDuration::set_allocated_ts(PROTOBUF_NAMESPACE_ID::Timestamp* ts) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(ts_);
+  }
+  if (ts) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(ts)->GetArena();
+    if (message_arena != submessage_arena) {
+      ts = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ts, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  ts_ = ts;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDuration.ts)
+}
+
+// .google.protobuf.Duration dur = 2;
+inline bool TimestampDuration::_internal_has_dur() const {
+  return this != internal_default_instance() && dur_ != nullptr;
+}
+inline bool TimestampDuration::has_dur() const {
+  return _internal_has_dur();
+}
+inline const PROTOBUF_NAMESPACE_ID::Duration& TimestampDuration::_internal_dur() const {
+  const PROTOBUF_NAMESPACE_ID::Duration* p = dur_;
+  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Duration*>(
+      &PROTOBUF_NAMESPACE_ID::_Duration_default_instance_);
+}
+inline const PROTOBUF_NAMESPACE_ID::Duration& TimestampDuration::dur() const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDuration.dur)
+  return _internal_dur();
+}
+inline void TimestampDuration::unsafe_arena_set_allocated_dur(
+    PROTOBUF_NAMESPACE_ID::Duration* dur) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dur_);
+  }
+  dur_ = dur;
+  if (dur) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_util_converter.testing.TimestampDuration.dur)
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* TimestampDuration::release_dur() {
+  
+  PROTOBUF_NAMESPACE_ID::Duration* temp = dur_;
+  dur_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* TimestampDuration::unsafe_arena_release_dur() {
+  // @@protoc_insertion_point(field_release:proto_util_converter.testing.TimestampDuration.dur)
+  
+  PROTOBUF_NAMESPACE_ID::Duration* temp = dur_;
+  dur_ = nullptr;
+  return temp;
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* TimestampDuration::_internal_mutable_dur() {
+  
+  if (dur_ == nullptr) {
+    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Duration>(GetArena());
+    dur_ = p;
+  }
+  return dur_;
+}
+inline PROTOBUF_NAMESPACE_ID::Duration* TimestampDuration::mutable_dur() {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDuration.dur)
+  return _internal_mutable_dur();
+}
+inline void TimestampDuration::set_allocated_dur(PROTOBUF_NAMESPACE_ID::Duration* dur) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(dur_);
+  }
+  if (dur) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dur)->GetArena();
+    if (message_arena != submessage_arena) {
+      dur = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dur, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  dur_ = dur;
+  // @@protoc_insertion_point(field_set_allocated:proto_util_converter.testing.TimestampDuration.dur)
+}
+
+// repeated .google.protobuf.Timestamp rep_ts = 3;
+inline int TimestampDuration::_internal_rep_ts_size() const {
+  return rep_ts_.size();
+}
+inline int TimestampDuration::rep_ts_size() const {
+  return _internal_rep_ts_size();
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TimestampDuration::mutable_rep_ts(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_util_converter.testing.TimestampDuration.rep_ts)
+  return rep_ts_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Timestamp >*
+TimestampDuration::mutable_rep_ts() {
+  // @@protoc_insertion_point(field_mutable_list:proto_util_converter.testing.TimestampDuration.rep_ts)
+  return &rep_ts_;
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& TimestampDuration::_internal_rep_ts(int index) const {
+  return rep_ts_.Get(index);
+}
+inline const PROTOBUF_NAMESPACE_ID::Timestamp& TimestampDuration::rep_ts(int index) const {
+  // @@protoc_insertion_point(field_get:proto_util_converter.testing.TimestampDuration.rep_ts)
+  return _internal_rep_ts(index);
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TimestampDuration::_internal_add_rep_ts() {
+  return rep_ts_.Add();
+}
+inline PROTOBUF_NAMESPACE_ID::Timestamp* TimestampDuration::add_rep_ts() {
+  // @@protoc_insertion_point(field_add:proto_util_converter.testing.TimestampDuration.rep_ts)
+  return _internal_add_rep_ts();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< PROTOBUF_NAMESPACE_ID::Timestamp >&
+TimestampDuration::rep_ts() const {
+  // @@protoc_insertion_point(field_list:proto_util_converter.testing.TimestampDuration.rep_ts)
+  return rep_ts_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace testing
+}  // namespace proto_util_converter
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_google_2fprotobuf_2futil_2finternal_2ftestdata_2ftimestamp_5fduration_2eproto
@@ -0,0 +1,3391 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/internal/testdata/wrappers.proto
+
+#include "google/protobuf/util/internal/testdata/wrappers.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BoolValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BytesValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DoubleValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_FloatValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Int32Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Int64Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_StringValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UInt32Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UInt64Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_BoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_BytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_DoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_FloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Int32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Int64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_StringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_UInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_UInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto;
+namespace proto_util_converter {
+namespace testing {
+class WrappersTestCasesDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<WrappersTestCases> _instance;
+} _WrappersTestCases_default_instance_;
+class DoubleWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DoubleWrapper> _instance;
+} _DoubleWrapper_default_instance_;
+class FloatWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<FloatWrapper> _instance;
+} _FloatWrapper_default_instance_;
+class Int64WrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Int64Wrapper> _instance;
+} _Int64Wrapper_default_instance_;
+class UInt64WrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UInt64Wrapper> _instance;
+} _UInt64Wrapper_default_instance_;
+class Int32WrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Int32Wrapper> _instance;
+} _Int32Wrapper_default_instance_;
+class UInt32WrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UInt32Wrapper> _instance;
+} _UInt32Wrapper_default_instance_;
+class BoolWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BoolWrapper> _instance;
+} _BoolWrapper_default_instance_;
+class StringWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<StringWrapper> _instance;
+} _StringWrapper_default_instance_;
+class BytesWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BytesWrapper> _instance;
+} _BytesWrapper_default_instance_;
+}  // namespace testing
+}  // namespace proto_util_converter
+static void InitDefaultsscc_info_BoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_BoolWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::BoolWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::BoolWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_BoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_BoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_BoolValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_BytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_BytesWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::BytesWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::BytesWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_BytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_BytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_BytesValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_DoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_DoubleWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::DoubleWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::DoubleWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_DoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_DoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_DoubleValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_FloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_FloatWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::FloatWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::FloatWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_FloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_FloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_FloatValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_Int32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_Int32Wrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::Int32Wrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::Int32Wrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Int32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_Int32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_Int32Value_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_Int64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_Int64Wrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::Int64Wrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::Int64Wrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Int64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_Int64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_Int64Value_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_StringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_StringWrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::StringWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::StringWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_StringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_StringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_StringValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_UInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_UInt32Wrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::UInt32Wrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::UInt32Wrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_UInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_UInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_UInt32Value_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_UInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_UInt64Wrapper_default_instance_;
+    new (ptr) ::proto_util_converter::testing::UInt64Wrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::UInt64Wrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_UInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_UInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_UInt64Value_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static void InitDefaultsscc_info_WrappersTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto_util_converter::testing::_WrappersTestCases_default_instance_;
+    new (ptr) ::proto_util_converter::testing::WrappersTestCases();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto_util_converter::testing::WrappersTestCases::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<9> scc_info_WrappersTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 9, 0, InitDefaultsscc_info_WrappersTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto}, {
+      &scc_info_DoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_FloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_Int64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_UInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_Int32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_UInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_BoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_StringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+      &scc_info_BytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,}};
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto[10];
+static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto = nullptr;
+
+const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, double_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, float_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, int64_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, uint64_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, int32_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, uint32_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, bool_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, string_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, bytes_wrapper_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, double_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, float_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, int64_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, uint64_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, int32_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, uint32_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, bool_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, string_wrapper_default_),
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::WrappersTestCases, bytes_wrapper_default_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::DoubleWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::DoubleWrapper, double__),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::FloatWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::FloatWrapper, float__),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Int64Wrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Int64Wrapper, int64_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::UInt64Wrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::UInt64Wrapper, uint64_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Int32Wrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::Int32Wrapper, int32_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::UInt32Wrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::UInt32Wrapper, uint32_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::BoolWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::BoolWrapper, bool__),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StringWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::StringWrapper, string_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::BytesWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto_util_converter::testing::BytesWrapper, bytes_),
+};
+static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, sizeof(::proto_util_converter::testing::WrappersTestCases)},
+  { 23, -1, sizeof(::proto_util_converter::testing::DoubleWrapper)},
+  { 29, -1, sizeof(::proto_util_converter::testing::FloatWrapper)},
+  { 35, -1, sizeof(::proto_util_converter::testing::Int64Wrapper)},
+  { 41, -1, sizeof(::proto_util_converter::testing::UInt64Wrapper)},
+  { 47, -1, sizeof(::proto_util_converter::testing::Int32Wrapper)},
+  { 53, -1, sizeof(::proto_util_converter::testing::UInt32Wrapper)},
+  { 59, -1, sizeof(::proto_util_converter::testing::BoolWrapper)},
+  { 65, -1, sizeof(::proto_util_converter::testing::StringWrapper)},
+  { 71, -1, sizeof(::proto_util_converter::testing::BytesWrapper)},
+};
+
+static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_WrappersTestCases_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_DoubleWrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_FloatWrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_Int64Wrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_UInt64Wrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_Int32Wrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_UInt32Wrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_BoolWrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_StringWrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto_util_converter::testing::_BytesWrapper_default_instance_),
+};
+
+const char descriptor_table_protodef_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n5google/protobuf/util/internal/testdata"
+  "/wrappers.proto\022\034proto_util_converter.te"
+  "sting\032\036google/protobuf/wrappers.proto\"\235\n"
+  "\n\021WrappersTestCases\022C\n\016double_wrapper\030\001 "
+  "\001(\0132+.proto_util_converter.testing.Doubl"
+  "eWrapper\022A\n\rfloat_wrapper\030\002 \001(\0132*.proto_"
+  "util_converter.testing.FloatWrapper\022A\n\ri"
+  "nt64_wrapper\030\003 \001(\0132*.proto_util_converte"
+  "r.testing.Int64Wrapper\022C\n\016uint64_wrapper"
+  "\030\004 \001(\0132+.proto_util_converter.testing.UI"
+  "nt64Wrapper\022A\n\rint32_wrapper\030\005 \001(\0132*.pro"
+  "to_util_converter.testing.Int32Wrapper\022C"
+  "\n\016uint32_wrapper\030\006 \001(\0132+.proto_util_conv"
+  "erter.testing.UInt32Wrapper\022\?\n\014bool_wrap"
+  "per\030\007 \001(\0132).proto_util_converter.testing"
+  ".BoolWrapper\022C\n\016string_wrapper\030\010 \001(\0132+.p"
+  "roto_util_converter.testing.StringWrappe"
+  "r\022A\n\rbytes_wrapper\030\t \001(\0132*.proto_util_co"
+  "nverter.testing.BytesWrapper\022K\n\026double_w"
+  "rapper_default\030\n \001(\0132+.proto_util_conver"
+  "ter.testing.DoubleWrapper\022I\n\025float_wrapp"
+  "er_default\030\013 \001(\0132*.proto_util_converter."
+  "testing.FloatWrapper\022I\n\025int64_wrapper_de"
+  "fault\030\014 \001(\0132*.proto_util_converter.testi"
+  "ng.Int64Wrapper\022K\n\026uint64_wrapper_defaul"
+  "t\030\r \001(\0132+.proto_util_converter.testing.U"
+  "Int64Wrapper\022I\n\025int32_wrapper_default\030\016 "
+  "\001(\0132*.proto_util_converter.testing.Int32"
+  "Wrapper\022K\n\026uint32_wrapper_default\030\017 \001(\0132"
+  "+.proto_util_converter.testing.UInt32Wra"
+  "pper\022G\n\024bool_wrapper_default\030\020 \001(\0132).pro"
+  "to_util_converter.testing.BoolWrapper\022K\n"
+  "\026string_wrapper_default\030\021 \001(\0132+.proto_ut"
+  "il_converter.testing.StringWrapper\022I\n\025by"
+  "tes_wrapper_default\030\022 \001(\0132*.proto_util_c"
+  "onverter.testing.BytesWrapper\"=\n\rDoubleW"
+  "rapper\022,\n\006double\030\001 \001(\0132\034.google.protobuf"
+  ".DoubleValue\":\n\014FloatWrapper\022*\n\005float\030\001 "
+  "\001(\0132\033.google.protobuf.FloatValue\":\n\014Int6"
+  "4Wrapper\022*\n\005int64\030\001 \001(\0132\033.google.protobu"
+  "f.Int64Value\"=\n\rUInt64Wrapper\022,\n\006uint64\030"
+  "\001 \001(\0132\034.google.protobuf.UInt64Value\":\n\014I"
+  "nt32Wrapper\022*\n\005int32\030\001 \001(\0132\033.google.prot"
+  "obuf.Int32Value\"=\n\rUInt32Wrapper\022,\n\006uint"
+  "32\030\001 \001(\0132\034.google.protobuf.UInt32Value\"7"
+  "\n\013BoolWrapper\022(\n\004bool\030\001 \001(\0132\032.google.pro"
+  "tobuf.BoolValue\"=\n\rStringWrapper\022,\n\006stri"
+  "ng\030\001 \001(\0132\034.google.protobuf.StringValue\":"
+  "\n\014BytesWrapper\022*\n\005bytes\030\001 \001(\0132\033.google.p"
+  "rotobuf.BytesValue2\177\n\023WrappersTestServic"
+  "e\022h\n\004Call\022/.proto_util_converter.testing"
+  ".WrappersTestCases\032/.proto_util_converte"
+  "r.testing.WrappersTestCasesb\006proto3"
+  ;
+static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto_deps[1] = {
+  &::descriptor_table_google_2fprotobuf_2fwrappers_2eproto,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto_sccs[10] = {
+  &scc_info_BoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+  &scc_info_BytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+  &scc_info_DoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+  &scc_info_FloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+  &scc_info_Int32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+  &scc_info_Int64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+  &scc_info_StringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+  &scc_info_UInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+  &scc_info_UInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+  &scc_info_WrappersTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto_once;
+const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto = {
+  false, false, descriptor_table_protodef_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto, "google/protobuf/util/internal/testdata/wrappers.proto", 2115,
+  &descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto_once, descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto_sccs, descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto_deps, 10, 1,
+  schemas, file_default_instances, TableStruct_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto::offsets,
+  file_level_metadata_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto, 10, file_level_enum_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto, file_level_service_descriptors_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto,
+};
+
+// Force running AddDescriptors() at dynamic initialization time.
+static bool dynamic_init_dummy_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto)), true);
+namespace proto_util_converter {
+namespace testing {
+
+// ===================================================================
+
+void WrappersTestCases::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->double_wrapper_ = const_cast< ::proto_util_converter::testing::DoubleWrapper*>(
+      ::proto_util_converter::testing::DoubleWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->float_wrapper_ = const_cast< ::proto_util_converter::testing::FloatWrapper*>(
+      ::proto_util_converter::testing::FloatWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->int64_wrapper_ = const_cast< ::proto_util_converter::testing::Int64Wrapper*>(
+      ::proto_util_converter::testing::Int64Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->uint64_wrapper_ = const_cast< ::proto_util_converter::testing::UInt64Wrapper*>(
+      ::proto_util_converter::testing::UInt64Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->int32_wrapper_ = const_cast< ::proto_util_converter::testing::Int32Wrapper*>(
+      ::proto_util_converter::testing::Int32Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->uint32_wrapper_ = const_cast< ::proto_util_converter::testing::UInt32Wrapper*>(
+      ::proto_util_converter::testing::UInt32Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->bool_wrapper_ = const_cast< ::proto_util_converter::testing::BoolWrapper*>(
+      ::proto_util_converter::testing::BoolWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->string_wrapper_ = const_cast< ::proto_util_converter::testing::StringWrapper*>(
+      ::proto_util_converter::testing::StringWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->bytes_wrapper_ = const_cast< ::proto_util_converter::testing::BytesWrapper*>(
+      ::proto_util_converter::testing::BytesWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->double_wrapper_default_ = const_cast< ::proto_util_converter::testing::DoubleWrapper*>(
+      ::proto_util_converter::testing::DoubleWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->float_wrapper_default_ = const_cast< ::proto_util_converter::testing::FloatWrapper*>(
+      ::proto_util_converter::testing::FloatWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->int64_wrapper_default_ = const_cast< ::proto_util_converter::testing::Int64Wrapper*>(
+      ::proto_util_converter::testing::Int64Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->uint64_wrapper_default_ = const_cast< ::proto_util_converter::testing::UInt64Wrapper*>(
+      ::proto_util_converter::testing::UInt64Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->int32_wrapper_default_ = const_cast< ::proto_util_converter::testing::Int32Wrapper*>(
+      ::proto_util_converter::testing::Int32Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->uint32_wrapper_default_ = const_cast< ::proto_util_converter::testing::UInt32Wrapper*>(
+      ::proto_util_converter::testing::UInt32Wrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->bool_wrapper_default_ = const_cast< ::proto_util_converter::testing::BoolWrapper*>(
+      ::proto_util_converter::testing::BoolWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->string_wrapper_default_ = const_cast< ::proto_util_converter::testing::StringWrapper*>(
+      ::proto_util_converter::testing::StringWrapper::internal_default_instance());
+  ::proto_util_converter::testing::_WrappersTestCases_default_instance_._instance.get_mutable()->bytes_wrapper_default_ = const_cast< ::proto_util_converter::testing::BytesWrapper*>(
+      ::proto_util_converter::testing::BytesWrapper::internal_default_instance());
+}
+class WrappersTestCases::_Internal {
+ public:
+  static const ::proto_util_converter::testing::DoubleWrapper& double_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::FloatWrapper& float_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::Int64Wrapper& int64_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::UInt64Wrapper& uint64_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::Int32Wrapper& int32_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::UInt32Wrapper& uint32_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::BoolWrapper& bool_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::StringWrapper& string_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::BytesWrapper& bytes_wrapper(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::DoubleWrapper& double_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::FloatWrapper& float_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::Int64Wrapper& int64_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::UInt64Wrapper& uint64_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::Int32Wrapper& int32_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::UInt32Wrapper& uint32_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::BoolWrapper& bool_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::StringWrapper& string_wrapper_default(const WrappersTestCases* msg);
+  static const ::proto_util_converter::testing::BytesWrapper& bytes_wrapper_default(const WrappersTestCases* msg);
+};
+
+const ::proto_util_converter::testing::DoubleWrapper&
+WrappersTestCases::_Internal::double_wrapper(const WrappersTestCases* msg) {
+  return *msg->double_wrapper_;
+}
+const ::proto_util_converter::testing::FloatWrapper&
+WrappersTestCases::_Internal::float_wrapper(const WrappersTestCases* msg) {
+  return *msg->float_wrapper_;
+}
+const ::proto_util_converter::testing::Int64Wrapper&
+WrappersTestCases::_Internal::int64_wrapper(const WrappersTestCases* msg) {
+  return *msg->int64_wrapper_;
+}
+const ::proto_util_converter::testing::UInt64Wrapper&
+WrappersTestCases::_Internal::uint64_wrapper(const WrappersTestCases* msg) {
+  return *msg->uint64_wrapper_;
+}
+const ::proto_util_converter::testing::Int32Wrapper&
+WrappersTestCases::_Internal::int32_wrapper(const WrappersTestCases* msg) {
+  return *msg->int32_wrapper_;
+}
+const ::proto_util_converter::testing::UInt32Wrapper&
+WrappersTestCases::_Internal::uint32_wrapper(const WrappersTestCases* msg) {
+  return *msg->uint32_wrapper_;
+}
+const ::proto_util_converter::testing::BoolWrapper&
+WrappersTestCases::_Internal::bool_wrapper(const WrappersTestCases* msg) {
+  return *msg->bool_wrapper_;
+}
+const ::proto_util_converter::testing::StringWrapper&
+WrappersTestCases::_Internal::string_wrapper(const WrappersTestCases* msg) {
+  return *msg->string_wrapper_;
+}
+const ::proto_util_converter::testing::BytesWrapper&
+WrappersTestCases::_Internal::bytes_wrapper(const WrappersTestCases* msg) {
+  return *msg->bytes_wrapper_;
+}
+const ::proto_util_converter::testing::DoubleWrapper&
+WrappersTestCases::_Internal::double_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->double_wrapper_default_;
+}
+const ::proto_util_converter::testing::FloatWrapper&
+WrappersTestCases::_Internal::float_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->float_wrapper_default_;
+}
+const ::proto_util_converter::testing::Int64Wrapper&
+WrappersTestCases::_Internal::int64_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->int64_wrapper_default_;
+}
+const ::proto_util_converter::testing::UInt64Wrapper&
+WrappersTestCases::_Internal::uint64_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->uint64_wrapper_default_;
+}
+const ::proto_util_converter::testing::Int32Wrapper&
+WrappersTestCases::_Internal::int32_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->int32_wrapper_default_;
+}
+const ::proto_util_converter::testing::UInt32Wrapper&
+WrappersTestCases::_Internal::uint32_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->uint32_wrapper_default_;
+}
+const ::proto_util_converter::testing::BoolWrapper&
+WrappersTestCases::_Internal::bool_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->bool_wrapper_default_;
+}
+const ::proto_util_converter::testing::StringWrapper&
+WrappersTestCases::_Internal::string_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->string_wrapper_default_;
+}
+const ::proto_util_converter::testing::BytesWrapper&
+WrappersTestCases::_Internal::bytes_wrapper_default(const WrappersTestCases* msg) {
+  return *msg->bytes_wrapper_default_;
+}
+WrappersTestCases::WrappersTestCases(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.WrappersTestCases)
+}
+WrappersTestCases::WrappersTestCases(const WrappersTestCases& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_double_wrapper()) {
+    double_wrapper_ = new ::proto_util_converter::testing::DoubleWrapper(*from.double_wrapper_);
+  } else {
+    double_wrapper_ = nullptr;
+  }
+  if (from._internal_has_float_wrapper()) {
+    float_wrapper_ = new ::proto_util_converter::testing::FloatWrapper(*from.float_wrapper_);
+  } else {
+    float_wrapper_ = nullptr;
+  }
+  if (from._internal_has_int64_wrapper()) {
+    int64_wrapper_ = new ::proto_util_converter::testing::Int64Wrapper(*from.int64_wrapper_);
+  } else {
+    int64_wrapper_ = nullptr;
+  }
+  if (from._internal_has_uint64_wrapper()) {
+    uint64_wrapper_ = new ::proto_util_converter::testing::UInt64Wrapper(*from.uint64_wrapper_);
+  } else {
+    uint64_wrapper_ = nullptr;
+  }
+  if (from._internal_has_int32_wrapper()) {
+    int32_wrapper_ = new ::proto_util_converter::testing::Int32Wrapper(*from.int32_wrapper_);
+  } else {
+    int32_wrapper_ = nullptr;
+  }
+  if (from._internal_has_uint32_wrapper()) {
+    uint32_wrapper_ = new ::proto_util_converter::testing::UInt32Wrapper(*from.uint32_wrapper_);
+  } else {
+    uint32_wrapper_ = nullptr;
+  }
+  if (from._internal_has_bool_wrapper()) {
+    bool_wrapper_ = new ::proto_util_converter::testing::BoolWrapper(*from.bool_wrapper_);
+  } else {
+    bool_wrapper_ = nullptr;
+  }
+  if (from._internal_has_string_wrapper()) {
+    string_wrapper_ = new ::proto_util_converter::testing::StringWrapper(*from.string_wrapper_);
+  } else {
+    string_wrapper_ = nullptr;
+  }
+  if (from._internal_has_bytes_wrapper()) {
+    bytes_wrapper_ = new ::proto_util_converter::testing::BytesWrapper(*from.bytes_wrapper_);
+  } else {
+    bytes_wrapper_ = nullptr;
+  }
+  if (from._internal_has_double_wrapper_default()) {
+    double_wrapper_default_ = new ::proto_util_converter::testing::DoubleWrapper(*from.double_wrapper_default_);
+  } else {
+    double_wrapper_default_ = nullptr;
+  }
+  if (from._internal_has_float_wrapper_default()) {
+    float_wrapper_default_ = new ::proto_util_converter::testing::FloatWrapper(*from.float_wrapper_default_);
+  } else {
+    float_wrapper_default_ = nullptr;
+  }
+  if (from._internal_has_int64_wrapper_default()) {
+    int64_wrapper_default_ = new ::proto_util_converter::testing::Int64Wrapper(*from.int64_wrapper_default_);
+  } else {
+    int64_wrapper_default_ = nullptr;
+  }
+  if (from._internal_has_uint64_wrapper_default()) {
+    uint64_wrapper_default_ = new ::proto_util_converter::testing::UInt64Wrapper(*from.uint64_wrapper_default_);
+  } else {
+    uint64_wrapper_default_ = nullptr;
+  }
+  if (from._internal_has_int32_wrapper_default()) {
+    int32_wrapper_default_ = new ::proto_util_converter::testing::Int32Wrapper(*from.int32_wrapper_default_);
+  } else {
+    int32_wrapper_default_ = nullptr;
+  }
+  if (from._internal_has_uint32_wrapper_default()) {
+    uint32_wrapper_default_ = new ::proto_util_converter::testing::UInt32Wrapper(*from.uint32_wrapper_default_);
+  } else {
+    uint32_wrapper_default_ = nullptr;
+  }
+  if (from._internal_has_bool_wrapper_default()) {
+    bool_wrapper_default_ = new ::proto_util_converter::testing::BoolWrapper(*from.bool_wrapper_default_);
+  } else {
+    bool_wrapper_default_ = nullptr;
+  }
+  if (from._internal_has_string_wrapper_default()) {
+    string_wrapper_default_ = new ::proto_util_converter::testing::StringWrapper(*from.string_wrapper_default_);
+  } else {
+    string_wrapper_default_ = nullptr;
+  }
+  if (from._internal_has_bytes_wrapper_default()) {
+    bytes_wrapper_default_ = new ::proto_util_converter::testing::BytesWrapper(*from.bytes_wrapper_default_);
+  } else {
+    bytes_wrapper_default_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.WrappersTestCases)
+}
+
+void WrappersTestCases::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_WrappersTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  ::memset(&double_wrapper_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&bytes_wrapper_default_) -
+      reinterpret_cast<char*>(&double_wrapper_)) + sizeof(bytes_wrapper_default_));
+}
+
+WrappersTestCases::~WrappersTestCases() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.WrappersTestCases)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void WrappersTestCases::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete double_wrapper_;
+  if (this != internal_default_instance()) delete float_wrapper_;
+  if (this != internal_default_instance()) delete int64_wrapper_;
+  if (this != internal_default_instance()) delete uint64_wrapper_;
+  if (this != internal_default_instance()) delete int32_wrapper_;
+  if (this != internal_default_instance()) delete uint32_wrapper_;
+  if (this != internal_default_instance()) delete bool_wrapper_;
+  if (this != internal_default_instance()) delete string_wrapper_;
+  if (this != internal_default_instance()) delete bytes_wrapper_;
+  if (this != internal_default_instance()) delete double_wrapper_default_;
+  if (this != internal_default_instance()) delete float_wrapper_default_;
+  if (this != internal_default_instance()) delete int64_wrapper_default_;
+  if (this != internal_default_instance()) delete uint64_wrapper_default_;
+  if (this != internal_default_instance()) delete int32_wrapper_default_;
+  if (this != internal_default_instance()) delete uint32_wrapper_default_;
+  if (this != internal_default_instance()) delete bool_wrapper_default_;
+  if (this != internal_default_instance()) delete string_wrapper_default_;
+  if (this != internal_default_instance()) delete bytes_wrapper_default_;
+}
+
+void WrappersTestCases::ArenaDtor(void* object) {
+  WrappersTestCases* _this = reinterpret_cast< WrappersTestCases* >(object);
+  (void)_this;
+}
+void WrappersTestCases::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void WrappersTestCases::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const WrappersTestCases& WrappersTestCases::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_WrappersTestCases_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void WrappersTestCases::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.WrappersTestCases)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && double_wrapper_ != nullptr) {
+    delete double_wrapper_;
+  }
+  double_wrapper_ = nullptr;
+  if (GetArena() == nullptr && float_wrapper_ != nullptr) {
+    delete float_wrapper_;
+  }
+  float_wrapper_ = nullptr;
+  if (GetArena() == nullptr && int64_wrapper_ != nullptr) {
+    delete int64_wrapper_;
+  }
+  int64_wrapper_ = nullptr;
+  if (GetArena() == nullptr && uint64_wrapper_ != nullptr) {
+    delete uint64_wrapper_;
+  }
+  uint64_wrapper_ = nullptr;
+  if (GetArena() == nullptr && int32_wrapper_ != nullptr) {
+    delete int32_wrapper_;
+  }
+  int32_wrapper_ = nullptr;
+  if (GetArena() == nullptr && uint32_wrapper_ != nullptr) {
+    delete uint32_wrapper_;
+  }
+  uint32_wrapper_ = nullptr;
+  if (GetArena() == nullptr && bool_wrapper_ != nullptr) {
+    delete bool_wrapper_;
+  }
+  bool_wrapper_ = nullptr;
+  if (GetArena() == nullptr && string_wrapper_ != nullptr) {
+    delete string_wrapper_;
+  }
+  string_wrapper_ = nullptr;
+  if (GetArena() == nullptr && bytes_wrapper_ != nullptr) {
+    delete bytes_wrapper_;
+  }
+  bytes_wrapper_ = nullptr;
+  if (GetArena() == nullptr && double_wrapper_default_ != nullptr) {
+    delete double_wrapper_default_;
+  }
+  double_wrapper_default_ = nullptr;
+  if (GetArena() == nullptr && float_wrapper_default_ != nullptr) {
+    delete float_wrapper_default_;
+  }
+  float_wrapper_default_ = nullptr;
+  if (GetArena() == nullptr && int64_wrapper_default_ != nullptr) {
+    delete int64_wrapper_default_;
+  }
+  int64_wrapper_default_ = nullptr;
+  if (GetArena() == nullptr && uint64_wrapper_default_ != nullptr) {
+    delete uint64_wrapper_default_;
+  }
+  uint64_wrapper_default_ = nullptr;
+  if (GetArena() == nullptr && int32_wrapper_default_ != nullptr) {
+    delete int32_wrapper_default_;
+  }
+  int32_wrapper_default_ = nullptr;
+  if (GetArena() == nullptr && uint32_wrapper_default_ != nullptr) {
+    delete uint32_wrapper_default_;
+  }
+  uint32_wrapper_default_ = nullptr;
+  if (GetArena() == nullptr && bool_wrapper_default_ != nullptr) {
+    delete bool_wrapper_default_;
+  }
+  bool_wrapper_default_ = nullptr;
+  if (GetArena() == nullptr && string_wrapper_default_ != nullptr) {
+    delete string_wrapper_default_;
+  }
+  string_wrapper_default_ = nullptr;
+  if (GetArena() == nullptr && bytes_wrapper_default_ != nullptr) {
+    delete bytes_wrapper_default_;
+  }
+  bytes_wrapper_default_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WrappersTestCases::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .proto_util_converter.testing.DoubleWrapper double_wrapper = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_double_wrapper(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.FloatWrapper float_wrapper = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_float_wrapper(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.Int64Wrapper int64_wrapper = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_int64_wrapper(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_uint64_wrapper(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.Int32Wrapper int32_wrapper = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_int32_wrapper(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_uint32_wrapper(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.BoolWrapper bool_wrapper = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bool_wrapper(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.StringWrapper string_wrapper = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_string_wrapper(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.BytesWrapper bytes_wrapper = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bytes_wrapper(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.DoubleWrapper double_wrapper_default = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_double_wrapper_default(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.FloatWrapper float_wrapper_default = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_float_wrapper_default(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.Int64Wrapper int64_wrapper_default = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_int64_wrapper_default(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper_default = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_uint64_wrapper_default(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.Int32Wrapper int32_wrapper_default = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_int32_wrapper_default(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper_default = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_uint32_wrapper_default(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.BoolWrapper bool_wrapper_default = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bool_wrapper_default(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.StringWrapper string_wrapper_default = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_string_wrapper_default(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto_util_converter.testing.BytesWrapper bytes_wrapper_default = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bytes_wrapper_default(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* WrappersTestCases::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.WrappersTestCases)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .proto_util_converter.testing.DoubleWrapper double_wrapper = 1;
+  if (this->has_double_wrapper()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::double_wrapper(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.FloatWrapper float_wrapper = 2;
+  if (this->has_float_wrapper()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::float_wrapper(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.Int64Wrapper int64_wrapper = 3;
+  if (this->has_int64_wrapper()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::int64_wrapper(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper = 4;
+  if (this->has_uint64_wrapper()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::uint64_wrapper(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.Int32Wrapper int32_wrapper = 5;
+  if (this->has_int32_wrapper()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        5, _Internal::int32_wrapper(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper = 6;
+  if (this->has_uint32_wrapper()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        6, _Internal::uint32_wrapper(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.BoolWrapper bool_wrapper = 7;
+  if (this->has_bool_wrapper()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        7, _Internal::bool_wrapper(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.StringWrapper string_wrapper = 8;
+  if (this->has_string_wrapper()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        8, _Internal::string_wrapper(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.BytesWrapper bytes_wrapper = 9;
+  if (this->has_bytes_wrapper()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        9, _Internal::bytes_wrapper(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.DoubleWrapper double_wrapper_default = 10;
+  if (this->has_double_wrapper_default()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        10, _Internal::double_wrapper_default(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.FloatWrapper float_wrapper_default = 11;
+  if (this->has_float_wrapper_default()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        11, _Internal::float_wrapper_default(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.Int64Wrapper int64_wrapper_default = 12;
+  if (this->has_int64_wrapper_default()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        12, _Internal::int64_wrapper_default(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper_default = 13;
+  if (this->has_uint64_wrapper_default()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        13, _Internal::uint64_wrapper_default(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.Int32Wrapper int32_wrapper_default = 14;
+  if (this->has_int32_wrapper_default()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        14, _Internal::int32_wrapper_default(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper_default = 15;
+  if (this->has_uint32_wrapper_default()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        15, _Internal::uint32_wrapper_default(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.BoolWrapper bool_wrapper_default = 16;
+  if (this->has_bool_wrapper_default()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        16, _Internal::bool_wrapper_default(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.StringWrapper string_wrapper_default = 17;
+  if (this->has_string_wrapper_default()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        17, _Internal::string_wrapper_default(this), target, stream);
+  }
+
+  // .proto_util_converter.testing.BytesWrapper bytes_wrapper_default = 18;
+  if (this->has_bytes_wrapper_default()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        18, _Internal::bytes_wrapper_default(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.WrappersTestCases)
+  return target;
+}
+
+size_t WrappersTestCases::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.WrappersTestCases)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .proto_util_converter.testing.DoubleWrapper double_wrapper = 1;
+  if (this->has_double_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *double_wrapper_);
+  }
+
+  // .proto_util_converter.testing.FloatWrapper float_wrapper = 2;
+  if (this->has_float_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *float_wrapper_);
+  }
+
+  // .proto_util_converter.testing.Int64Wrapper int64_wrapper = 3;
+  if (this->has_int64_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int64_wrapper_);
+  }
+
+  // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper = 4;
+  if (this->has_uint64_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint64_wrapper_);
+  }
+
+  // .proto_util_converter.testing.Int32Wrapper int32_wrapper = 5;
+  if (this->has_int32_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int32_wrapper_);
+  }
+
+  // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper = 6;
+  if (this->has_uint32_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint32_wrapper_);
+  }
+
+  // .proto_util_converter.testing.BoolWrapper bool_wrapper = 7;
+  if (this->has_bool_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bool_wrapper_);
+  }
+
+  // .proto_util_converter.testing.StringWrapper string_wrapper = 8;
+  if (this->has_string_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *string_wrapper_);
+  }
+
+  // .proto_util_converter.testing.BytesWrapper bytes_wrapper = 9;
+  if (this->has_bytes_wrapper()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bytes_wrapper_);
+  }
+
+  // .proto_util_converter.testing.DoubleWrapper double_wrapper_default = 10;
+  if (this->has_double_wrapper_default()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *double_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.FloatWrapper float_wrapper_default = 11;
+  if (this->has_float_wrapper_default()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *float_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.Int64Wrapper int64_wrapper_default = 12;
+  if (this->has_int64_wrapper_default()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int64_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.UInt64Wrapper uint64_wrapper_default = 13;
+  if (this->has_uint64_wrapper_default()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint64_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.Int32Wrapper int32_wrapper_default = 14;
+  if (this->has_int32_wrapper_default()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int32_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.UInt32Wrapper uint32_wrapper_default = 15;
+  if (this->has_uint32_wrapper_default()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint32_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.BoolWrapper bool_wrapper_default = 16;
+  if (this->has_bool_wrapper_default()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bool_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.StringWrapper string_wrapper_default = 17;
+  if (this->has_string_wrapper_default()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *string_wrapper_default_);
+  }
+
+  // .proto_util_converter.testing.BytesWrapper bytes_wrapper_default = 18;
+  if (this->has_bytes_wrapper_default()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bytes_wrapper_default_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void WrappersTestCases::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.WrappersTestCases)
+  GOOGLE_DCHECK_NE(&from, this);
+  const WrappersTestCases* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<WrappersTestCases>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.WrappersTestCases)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.WrappersTestCases)
+    MergeFrom(*source);
+  }
+}
+
+void WrappersTestCases::MergeFrom(const WrappersTestCases& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.WrappersTestCases)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_double_wrapper()) {
+    _internal_mutable_double_wrapper()->::proto_util_converter::testing::DoubleWrapper::MergeFrom(from._internal_double_wrapper());
+  }
+  if (from.has_float_wrapper()) {
+    _internal_mutable_float_wrapper()->::proto_util_converter::testing::FloatWrapper::MergeFrom(from._internal_float_wrapper());
+  }
+  if (from.has_int64_wrapper()) {
+    _internal_mutable_int64_wrapper()->::proto_util_converter::testing::Int64Wrapper::MergeFrom(from._internal_int64_wrapper());
+  }
+  if (from.has_uint64_wrapper()) {
+    _internal_mutable_uint64_wrapper()->::proto_util_converter::testing::UInt64Wrapper::MergeFrom(from._internal_uint64_wrapper());
+  }
+  if (from.has_int32_wrapper()) {
+    _internal_mutable_int32_wrapper()->::proto_util_converter::testing::Int32Wrapper::MergeFrom(from._internal_int32_wrapper());
+  }
+  if (from.has_uint32_wrapper()) {
+    _internal_mutable_uint32_wrapper()->::proto_util_converter::testing::UInt32Wrapper::MergeFrom(from._internal_uint32_wrapper());
+  }
+  if (from.has_bool_wrapper()) {
+    _internal_mutable_bool_wrapper()->::proto_util_converter::testing::BoolWrapper::MergeFrom(from._internal_bool_wrapper());
+  }
+  if (from.has_string_wrapper()) {
+    _internal_mutable_string_wrapper()->::proto_util_converter::testing::StringWrapper::MergeFrom(from._internal_string_wrapper());
+  }
+  if (from.has_bytes_wrapper()) {
+    _internal_mutable_bytes_wrapper()->::proto_util_converter::testing::BytesWrapper::MergeFrom(from._internal_bytes_wrapper());
+  }
+  if (from.has_double_wrapper_default()) {
+    _internal_mutable_double_wrapper_default()->::proto_util_converter::testing::DoubleWrapper::MergeFrom(from._internal_double_wrapper_default());
+  }
+  if (from.has_float_wrapper_default()) {
+    _internal_mutable_float_wrapper_default()->::proto_util_converter::testing::FloatWrapper::MergeFrom(from._internal_float_wrapper_default());
+  }
+  if (from.has_int64_wrapper_default()) {
+    _internal_mutable_int64_wrapper_default()->::proto_util_converter::testing::Int64Wrapper::MergeFrom(from._internal_int64_wrapper_default());
+  }
+  if (from.has_uint64_wrapper_default()) {
+    _internal_mutable_uint64_wrapper_default()->::proto_util_converter::testing::UInt64Wrapper::MergeFrom(from._internal_uint64_wrapper_default());
+  }
+  if (from.has_int32_wrapper_default()) {
+    _internal_mutable_int32_wrapper_default()->::proto_util_converter::testing::Int32Wrapper::MergeFrom(from._internal_int32_wrapper_default());
+  }
+  if (from.has_uint32_wrapper_default()) {
+    _internal_mutable_uint32_wrapper_default()->::proto_util_converter::testing::UInt32Wrapper::MergeFrom(from._internal_uint32_wrapper_default());
+  }
+  if (from.has_bool_wrapper_default()) {
+    _internal_mutable_bool_wrapper_default()->::proto_util_converter::testing::BoolWrapper::MergeFrom(from._internal_bool_wrapper_default());
+  }
+  if (from.has_string_wrapper_default()) {
+    _internal_mutable_string_wrapper_default()->::proto_util_converter::testing::StringWrapper::MergeFrom(from._internal_string_wrapper_default());
+  }
+  if (from.has_bytes_wrapper_default()) {
+    _internal_mutable_bytes_wrapper_default()->::proto_util_converter::testing::BytesWrapper::MergeFrom(from._internal_bytes_wrapper_default());
+  }
+}
+
+void WrappersTestCases::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.WrappersTestCases)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void WrappersTestCases::CopyFrom(const WrappersTestCases& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.WrappersTestCases)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WrappersTestCases::IsInitialized() const {
+  return true;
+}
+
+void WrappersTestCases::InternalSwap(WrappersTestCases* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WrappersTestCases, bytes_wrapper_default_)
+      + sizeof(WrappersTestCases::bytes_wrapper_default_)
+      - PROTOBUF_FIELD_OFFSET(WrappersTestCases, double_wrapper_)>(
+          reinterpret_cast<char*>(&double_wrapper_),
+          reinterpret_cast<char*>(&other->double_wrapper_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WrappersTestCases::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void DoubleWrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_DoubleWrapper_default_instance_._instance.get_mutable()->double__ = const_cast< PROTOBUF_NAMESPACE_ID::DoubleValue*>(
+      PROTOBUF_NAMESPACE_ID::DoubleValue::internal_default_instance());
+}
+class DoubleWrapper::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::DoubleValue& double_(const DoubleWrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::DoubleValue&
+DoubleWrapper::_Internal::double_(const DoubleWrapper* msg) {
+  return *msg->double__;
+}
+void DoubleWrapper::clear_double_() {
+  if (GetArena() == nullptr && double__ != nullptr) {
+    delete double__;
+  }
+  double__ = nullptr;
+}
+DoubleWrapper::DoubleWrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.DoubleWrapper)
+}
+DoubleWrapper::DoubleWrapper(const DoubleWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_double_()) {
+    double__ = new PROTOBUF_NAMESPACE_ID::DoubleValue(*from.double__);
+  } else {
+    double__ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.DoubleWrapper)
+}
+
+void DoubleWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_DoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  double__ = nullptr;
+}
+
+DoubleWrapper::~DoubleWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.DoubleWrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void DoubleWrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete double__;
+}
+
+void DoubleWrapper::ArenaDtor(void* object) {
+  DoubleWrapper* _this = reinterpret_cast< DoubleWrapper* >(object);
+  (void)_this;
+}
+void DoubleWrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void DoubleWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const DoubleWrapper& DoubleWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DoubleWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void DoubleWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.DoubleWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && double__ != nullptr) {
+    delete double__;
+  }
+  double__ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DoubleWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.DoubleValue double = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_double_(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* DoubleWrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.DoubleWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.DoubleValue double = 1;
+  if (this->has_double_()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::double_(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.DoubleWrapper)
+  return target;
+}
+
+size_t DoubleWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.DoubleWrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.DoubleValue double = 1;
+  if (this->has_double_()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *double__);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void DoubleWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.DoubleWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const DoubleWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<DoubleWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.DoubleWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.DoubleWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void DoubleWrapper::MergeFrom(const DoubleWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.DoubleWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_double_()) {
+    _internal_mutable_double_()->PROTOBUF_NAMESPACE_ID::DoubleValue::MergeFrom(from._internal_double_());
+  }
+}
+
+void DoubleWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.DoubleWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void DoubleWrapper::CopyFrom(const DoubleWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.DoubleWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DoubleWrapper::IsInitialized() const {
+  return true;
+}
+
+void DoubleWrapper::InternalSwap(DoubleWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(double__, other->double__);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DoubleWrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void FloatWrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_FloatWrapper_default_instance_._instance.get_mutable()->float__ = const_cast< PROTOBUF_NAMESPACE_ID::FloatValue*>(
+      PROTOBUF_NAMESPACE_ID::FloatValue::internal_default_instance());
+}
+class FloatWrapper::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::FloatValue& float_(const FloatWrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::FloatValue&
+FloatWrapper::_Internal::float_(const FloatWrapper* msg) {
+  return *msg->float__;
+}
+void FloatWrapper::clear_float_() {
+  if (GetArena() == nullptr && float__ != nullptr) {
+    delete float__;
+  }
+  float__ = nullptr;
+}
+FloatWrapper::FloatWrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.FloatWrapper)
+}
+FloatWrapper::FloatWrapper(const FloatWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_float_()) {
+    float__ = new PROTOBUF_NAMESPACE_ID::FloatValue(*from.float__);
+  } else {
+    float__ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.FloatWrapper)
+}
+
+void FloatWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_FloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  float__ = nullptr;
+}
+
+FloatWrapper::~FloatWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.FloatWrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void FloatWrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete float__;
+}
+
+void FloatWrapper::ArenaDtor(void* object) {
+  FloatWrapper* _this = reinterpret_cast< FloatWrapper* >(object);
+  (void)_this;
+}
+void FloatWrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void FloatWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const FloatWrapper& FloatWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_FloatWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void FloatWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.FloatWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && float__ != nullptr) {
+    delete float__;
+  }
+  float__ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FloatWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.FloatValue float = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_float_(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* FloatWrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.FloatWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.FloatValue float = 1;
+  if (this->has_float_()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::float_(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.FloatWrapper)
+  return target;
+}
+
+size_t FloatWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.FloatWrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.FloatValue float = 1;
+  if (this->has_float_()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *float__);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void FloatWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.FloatWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const FloatWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<FloatWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.FloatWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.FloatWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void FloatWrapper::MergeFrom(const FloatWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.FloatWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_float_()) {
+    _internal_mutable_float_()->PROTOBUF_NAMESPACE_ID::FloatValue::MergeFrom(from._internal_float_());
+  }
+}
+
+void FloatWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.FloatWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void FloatWrapper::CopyFrom(const FloatWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.FloatWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FloatWrapper::IsInitialized() const {
+  return true;
+}
+
+void FloatWrapper::InternalSwap(FloatWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(float__, other->float__);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FloatWrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void Int64Wrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_Int64Wrapper_default_instance_._instance.get_mutable()->int64_ = const_cast< PROTOBUF_NAMESPACE_ID::Int64Value*>(
+      PROTOBUF_NAMESPACE_ID::Int64Value::internal_default_instance());
+}
+class Int64Wrapper::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Int64Value& int64(const Int64Wrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Int64Value&
+Int64Wrapper::_Internal::int64(const Int64Wrapper* msg) {
+  return *msg->int64_;
+}
+void Int64Wrapper::clear_int64() {
+  if (GetArena() == nullptr && int64_ != nullptr) {
+    delete int64_;
+  }
+  int64_ = nullptr;
+}
+Int64Wrapper::Int64Wrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.Int64Wrapper)
+}
+Int64Wrapper::Int64Wrapper(const Int64Wrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_int64()) {
+    int64_ = new PROTOBUF_NAMESPACE_ID::Int64Value(*from.int64_);
+  } else {
+    int64_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.Int64Wrapper)
+}
+
+void Int64Wrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Int64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  int64_ = nullptr;
+}
+
+Int64Wrapper::~Int64Wrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.Int64Wrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void Int64Wrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete int64_;
+}
+
+void Int64Wrapper::ArenaDtor(void* object) {
+  Int64Wrapper* _this = reinterpret_cast< Int64Wrapper* >(object);
+  (void)_this;
+}
+void Int64Wrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void Int64Wrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const Int64Wrapper& Int64Wrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Int64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void Int64Wrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.Int64Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && int64_ != nullptr) {
+    delete int64_;
+  }
+  int64_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Int64Wrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Int64Value int64 = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_int64(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* Int64Wrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.Int64Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Int64Value int64 = 1;
+  if (this->has_int64()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::int64(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.Int64Wrapper)
+  return target;
+}
+
+size_t Int64Wrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.Int64Wrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.Int64Value int64 = 1;
+  if (this->has_int64()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int64_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Int64Wrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.Int64Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Int64Wrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Int64Wrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.Int64Wrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.Int64Wrapper)
+    MergeFrom(*source);
+  }
+}
+
+void Int64Wrapper::MergeFrom(const Int64Wrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.Int64Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_int64()) {
+    _internal_mutable_int64()->PROTOBUF_NAMESPACE_ID::Int64Value::MergeFrom(from._internal_int64());
+  }
+}
+
+void Int64Wrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.Int64Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Int64Wrapper::CopyFrom(const Int64Wrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.Int64Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Int64Wrapper::IsInitialized() const {
+  return true;
+}
+
+void Int64Wrapper::InternalSwap(Int64Wrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(int64_, other->int64_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Int64Wrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void UInt64Wrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_UInt64Wrapper_default_instance_._instance.get_mutable()->uint64_ = const_cast< PROTOBUF_NAMESPACE_ID::UInt64Value*>(
+      PROTOBUF_NAMESPACE_ID::UInt64Value::internal_default_instance());
+}
+class UInt64Wrapper::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::UInt64Value& uint64(const UInt64Wrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::UInt64Value&
+UInt64Wrapper::_Internal::uint64(const UInt64Wrapper* msg) {
+  return *msg->uint64_;
+}
+void UInt64Wrapper::clear_uint64() {
+  if (GetArena() == nullptr && uint64_ != nullptr) {
+    delete uint64_;
+  }
+  uint64_ = nullptr;
+}
+UInt64Wrapper::UInt64Wrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.UInt64Wrapper)
+}
+UInt64Wrapper::UInt64Wrapper(const UInt64Wrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_uint64()) {
+    uint64_ = new PROTOBUF_NAMESPACE_ID::UInt64Value(*from.uint64_);
+  } else {
+    uint64_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.UInt64Wrapper)
+}
+
+void UInt64Wrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_UInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  uint64_ = nullptr;
+}
+
+UInt64Wrapper::~UInt64Wrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.UInt64Wrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void UInt64Wrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete uint64_;
+}
+
+void UInt64Wrapper::ArenaDtor(void* object) {
+  UInt64Wrapper* _this = reinterpret_cast< UInt64Wrapper* >(object);
+  (void)_this;
+}
+void UInt64Wrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void UInt64Wrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const UInt64Wrapper& UInt64Wrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UInt64Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void UInt64Wrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.UInt64Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && uint64_ != nullptr) {
+    delete uint64_;
+  }
+  uint64_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UInt64Wrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.UInt64Value uint64 = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_uint64(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* UInt64Wrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.UInt64Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.UInt64Value uint64 = 1;
+  if (this->has_uint64()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::uint64(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.UInt64Wrapper)
+  return target;
+}
+
+size_t UInt64Wrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.UInt64Wrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.UInt64Value uint64 = 1;
+  if (this->has_uint64()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint64_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void UInt64Wrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.UInt64Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const UInt64Wrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UInt64Wrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.UInt64Wrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.UInt64Wrapper)
+    MergeFrom(*source);
+  }
+}
+
+void UInt64Wrapper::MergeFrom(const UInt64Wrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.UInt64Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_uint64()) {
+    _internal_mutable_uint64()->PROTOBUF_NAMESPACE_ID::UInt64Value::MergeFrom(from._internal_uint64());
+  }
+}
+
+void UInt64Wrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.UInt64Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void UInt64Wrapper::CopyFrom(const UInt64Wrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.UInt64Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UInt64Wrapper::IsInitialized() const {
+  return true;
+}
+
+void UInt64Wrapper::InternalSwap(UInt64Wrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(uint64_, other->uint64_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UInt64Wrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void Int32Wrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_Int32Wrapper_default_instance_._instance.get_mutable()->int32_ = const_cast< PROTOBUF_NAMESPACE_ID::Int32Value*>(
+      PROTOBUF_NAMESPACE_ID::Int32Value::internal_default_instance());
+}
+class Int32Wrapper::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Int32Value& int32(const Int32Wrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Int32Value&
+Int32Wrapper::_Internal::int32(const Int32Wrapper* msg) {
+  return *msg->int32_;
+}
+void Int32Wrapper::clear_int32() {
+  if (GetArena() == nullptr && int32_ != nullptr) {
+    delete int32_;
+  }
+  int32_ = nullptr;
+}
+Int32Wrapper::Int32Wrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.Int32Wrapper)
+}
+Int32Wrapper::Int32Wrapper(const Int32Wrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_int32()) {
+    int32_ = new PROTOBUF_NAMESPACE_ID::Int32Value(*from.int32_);
+  } else {
+    int32_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.Int32Wrapper)
+}
+
+void Int32Wrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Int32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  int32_ = nullptr;
+}
+
+Int32Wrapper::~Int32Wrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.Int32Wrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void Int32Wrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete int32_;
+}
+
+void Int32Wrapper::ArenaDtor(void* object) {
+  Int32Wrapper* _this = reinterpret_cast< Int32Wrapper* >(object);
+  (void)_this;
+}
+void Int32Wrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void Int32Wrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const Int32Wrapper& Int32Wrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Int32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void Int32Wrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.Int32Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && int32_ != nullptr) {
+    delete int32_;
+  }
+  int32_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Int32Wrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Int32Value int32 = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_int32(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* Int32Wrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.Int32Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Int32Value int32 = 1;
+  if (this->has_int32()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::int32(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.Int32Wrapper)
+  return target;
+}
+
+size_t Int32Wrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.Int32Wrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.Int32Value int32 = 1;
+  if (this->has_int32()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int32_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Int32Wrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.Int32Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Int32Wrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Int32Wrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.Int32Wrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.Int32Wrapper)
+    MergeFrom(*source);
+  }
+}
+
+void Int32Wrapper::MergeFrom(const Int32Wrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.Int32Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_int32()) {
+    _internal_mutable_int32()->PROTOBUF_NAMESPACE_ID::Int32Value::MergeFrom(from._internal_int32());
+  }
+}
+
+void Int32Wrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.Int32Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Int32Wrapper::CopyFrom(const Int32Wrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.Int32Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Int32Wrapper::IsInitialized() const {
+  return true;
+}
+
+void Int32Wrapper::InternalSwap(Int32Wrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(int32_, other->int32_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Int32Wrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void UInt32Wrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_UInt32Wrapper_default_instance_._instance.get_mutable()->uint32_ = const_cast< PROTOBUF_NAMESPACE_ID::UInt32Value*>(
+      PROTOBUF_NAMESPACE_ID::UInt32Value::internal_default_instance());
+}
+class UInt32Wrapper::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::UInt32Value& uint32(const UInt32Wrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::UInt32Value&
+UInt32Wrapper::_Internal::uint32(const UInt32Wrapper* msg) {
+  return *msg->uint32_;
+}
+void UInt32Wrapper::clear_uint32() {
+  if (GetArena() == nullptr && uint32_ != nullptr) {
+    delete uint32_;
+  }
+  uint32_ = nullptr;
+}
+UInt32Wrapper::UInt32Wrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.UInt32Wrapper)
+}
+UInt32Wrapper::UInt32Wrapper(const UInt32Wrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_uint32()) {
+    uint32_ = new PROTOBUF_NAMESPACE_ID::UInt32Value(*from.uint32_);
+  } else {
+    uint32_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.UInt32Wrapper)
+}
+
+void UInt32Wrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_UInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  uint32_ = nullptr;
+}
+
+UInt32Wrapper::~UInt32Wrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.UInt32Wrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void UInt32Wrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete uint32_;
+}
+
+void UInt32Wrapper::ArenaDtor(void* object) {
+  UInt32Wrapper* _this = reinterpret_cast< UInt32Wrapper* >(object);
+  (void)_this;
+}
+void UInt32Wrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void UInt32Wrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const UInt32Wrapper& UInt32Wrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UInt32Wrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void UInt32Wrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.UInt32Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && uint32_ != nullptr) {
+    delete uint32_;
+  }
+  uint32_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UInt32Wrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.UInt32Value uint32 = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_uint32(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* UInt32Wrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.UInt32Wrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.UInt32Value uint32 = 1;
+  if (this->has_uint32()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::uint32(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.UInt32Wrapper)
+  return target;
+}
+
+size_t UInt32Wrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.UInt32Wrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.UInt32Value uint32 = 1;
+  if (this->has_uint32()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint32_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void UInt32Wrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.UInt32Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const UInt32Wrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UInt32Wrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.UInt32Wrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.UInt32Wrapper)
+    MergeFrom(*source);
+  }
+}
+
+void UInt32Wrapper::MergeFrom(const UInt32Wrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.UInt32Wrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_uint32()) {
+    _internal_mutable_uint32()->PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(from._internal_uint32());
+  }
+}
+
+void UInt32Wrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.UInt32Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void UInt32Wrapper::CopyFrom(const UInt32Wrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.UInt32Wrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UInt32Wrapper::IsInitialized() const {
+  return true;
+}
+
+void UInt32Wrapper::InternalSwap(UInt32Wrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(uint32_, other->uint32_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UInt32Wrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void BoolWrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_BoolWrapper_default_instance_._instance.get_mutable()->bool__ = const_cast< PROTOBUF_NAMESPACE_ID::BoolValue*>(
+      PROTOBUF_NAMESPACE_ID::BoolValue::internal_default_instance());
+}
+class BoolWrapper::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::BoolValue& bool_(const BoolWrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::BoolValue&
+BoolWrapper::_Internal::bool_(const BoolWrapper* msg) {
+  return *msg->bool__;
+}
+void BoolWrapper::clear_bool_() {
+  if (GetArena() == nullptr && bool__ != nullptr) {
+    delete bool__;
+  }
+  bool__ = nullptr;
+}
+BoolWrapper::BoolWrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.BoolWrapper)
+}
+BoolWrapper::BoolWrapper(const BoolWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_bool_()) {
+    bool__ = new PROTOBUF_NAMESPACE_ID::BoolValue(*from.bool__);
+  } else {
+    bool__ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.BoolWrapper)
+}
+
+void BoolWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_BoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  bool__ = nullptr;
+}
+
+BoolWrapper::~BoolWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.BoolWrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void BoolWrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete bool__;
+}
+
+void BoolWrapper::ArenaDtor(void* object) {
+  BoolWrapper* _this = reinterpret_cast< BoolWrapper* >(object);
+  (void)_this;
+}
+void BoolWrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void BoolWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const BoolWrapper& BoolWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BoolWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void BoolWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.BoolWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && bool__ != nullptr) {
+    delete bool__;
+  }
+  bool__ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BoolWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.BoolValue bool = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bool_(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* BoolWrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.BoolWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.BoolValue bool = 1;
+  if (this->has_bool_()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::bool_(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.BoolWrapper)
+  return target;
+}
+
+size_t BoolWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.BoolWrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.BoolValue bool = 1;
+  if (this->has_bool_()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bool__);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void BoolWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.BoolWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const BoolWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BoolWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.BoolWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.BoolWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void BoolWrapper::MergeFrom(const BoolWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.BoolWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_bool_()) {
+    _internal_mutable_bool_()->PROTOBUF_NAMESPACE_ID::BoolValue::MergeFrom(from._internal_bool_());
+  }
+}
+
+void BoolWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.BoolWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void BoolWrapper::CopyFrom(const BoolWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.BoolWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BoolWrapper::IsInitialized() const {
+  return true;
+}
+
+void BoolWrapper::InternalSwap(BoolWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(bool__, other->bool__);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BoolWrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void StringWrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_StringWrapper_default_instance_._instance.get_mutable()->string_ = const_cast< PROTOBUF_NAMESPACE_ID::StringValue*>(
+      PROTOBUF_NAMESPACE_ID::StringValue::internal_default_instance());
+}
+class StringWrapper::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::StringValue& string(const StringWrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::StringValue&
+StringWrapper::_Internal::string(const StringWrapper* msg) {
+  return *msg->string_;
+}
+void StringWrapper::clear_string() {
+  if (GetArena() == nullptr && string_ != nullptr) {
+    delete string_;
+  }
+  string_ = nullptr;
+}
+StringWrapper::StringWrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.StringWrapper)
+}
+StringWrapper::StringWrapper(const StringWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_string()) {
+    string_ = new PROTOBUF_NAMESPACE_ID::StringValue(*from.string_);
+  } else {
+    string_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.StringWrapper)
+}
+
+void StringWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_StringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  string_ = nullptr;
+}
+
+StringWrapper::~StringWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.StringWrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void StringWrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete string_;
+}
+
+void StringWrapper::ArenaDtor(void* object) {
+  StringWrapper* _this = reinterpret_cast< StringWrapper* >(object);
+  (void)_this;
+}
+void StringWrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void StringWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const StringWrapper& StringWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_StringWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void StringWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.StringWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && string_ != nullptr) {
+    delete string_;
+  }
+  string_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StringWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.StringValue string = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_string(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* StringWrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.StringWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.StringValue string = 1;
+  if (this->has_string()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::string(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.StringWrapper)
+  return target;
+}
+
+size_t StringWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.StringWrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.StringValue string = 1;
+  if (this->has_string()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *string_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void StringWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.StringWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const StringWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<StringWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.StringWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.StringWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void StringWrapper::MergeFrom(const StringWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.StringWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_string()) {
+    _internal_mutable_string()->PROTOBUF_NAMESPACE_ID::StringValue::MergeFrom(from._internal_string());
+  }
+}
+
+void StringWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.StringWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void StringWrapper::CopyFrom(const StringWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.StringWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StringWrapper::IsInitialized() const {
+  return true;
+}
+
+void StringWrapper::InternalSwap(StringWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(string_, other->string_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StringWrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void BytesWrapper::InitAsDefaultInstance() {
+  ::proto_util_converter::testing::_BytesWrapper_default_instance_._instance.get_mutable()->bytes_ = const_cast< PROTOBUF_NAMESPACE_ID::BytesValue*>(
+      PROTOBUF_NAMESPACE_ID::BytesValue::internal_default_instance());
+}
+class BytesWrapper::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::BytesValue& bytes(const BytesWrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::BytesValue&
+BytesWrapper::_Internal::bytes(const BytesWrapper* msg) {
+  return *msg->bytes_;
+}
+void BytesWrapper::clear_bytes() {
+  if (GetArena() == nullptr && bytes_ != nullptr) {
+    delete bytes_;
+  }
+  bytes_ = nullptr;
+}
+BytesWrapper::BytesWrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto_util_converter.testing.BytesWrapper)
+}
+BytesWrapper::BytesWrapper(const BytesWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_bytes()) {
+    bytes_ = new PROTOBUF_NAMESPACE_ID::BytesValue(*from.bytes_);
+  } else {
+    bytes_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_util_converter.testing.BytesWrapper)
+}
+
+void BytesWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_BytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  bytes_ = nullptr;
+}
+
+BytesWrapper::~BytesWrapper() {
+  // @@protoc_insertion_point(destructor:proto_util_converter.testing.BytesWrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void BytesWrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete bytes_;
+}
+
+void BytesWrapper::ArenaDtor(void* object) {
+  BytesWrapper* _this = reinterpret_cast< BytesWrapper* >(object);
+  (void)_this;
+}
+void BytesWrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void BytesWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const BytesWrapper& BytesWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BytesWrapper_google_2fprotobuf_2futil_2finternal_2ftestdata_2fwrappers_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void BytesWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_util_converter.testing.BytesWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && bytes_ != nullptr) {
+    delete bytes_;
+  }
+  bytes_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BytesWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.BytesValue bytes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bytes(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* BytesWrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_util_converter.testing.BytesWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.BytesValue bytes = 1;
+  if (this->has_bytes()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::bytes(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_util_converter.testing.BytesWrapper)
+  return target;
+}
+
+size_t BytesWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_util_converter.testing.BytesWrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.BytesValue bytes = 1;
+  if (this->has_bytes()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bytes_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void BytesWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto_util_converter.testing.BytesWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const BytesWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BytesWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto_util_converter.testing.BytesWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto_util_converter.testing.BytesWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void BytesWrapper::MergeFrom(const BytesWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto_util_converter.testing.BytesWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_bytes()) {
+    _internal_mutable_bytes()->PROTOBUF_NAMESPACE_ID::BytesValue::MergeFrom(from._internal_bytes());
+  }
+}
+
+void BytesWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto_util_converter.testing.BytesWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void BytesWrapper::CopyFrom(const BytesWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_util_converter.testing.BytesWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BytesWrapper::IsInitialized() const {
+  return true;
+}
+
+void BytesWrapper::InternalSwap(BytesWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(bytes_, other->bytes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BytesWrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace testing
+}  // namespace proto_util_converter
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::WrappersTestCases* Arena::CreateMaybeMessage< ::proto_util_converter::testing::WrappersTestCases >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::WrappersTestCases >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::DoubleWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::DoubleWrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::DoubleWrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::FloatWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::FloatWrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::FloatWrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::Int64Wrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::Int64Wrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::Int64Wrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::UInt64Wrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::UInt64Wrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::UInt64Wrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::Int32Wrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::Int32Wrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::Int32Wrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::UInt32Wrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::UInt32Wrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::UInt32Wrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::BoolWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::BoolWrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::BoolWrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::StringWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::StringWrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::StringWrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_util_converter::testing::BytesWrapper* Arena::CreateMaybeMessage< ::proto_util_converter::testing::BytesWrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_util_converter::testing::BytesWrapper >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,8138 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/util/json_format_proto3.proto
+
+#include "google/protobuf/util/json_format_proto3.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fany_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Any_google_2fprotobuf_2fany_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BoolValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BytesValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DoubleValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fduration_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Duration_google_2fprotobuf_2fduration_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2ffield_5fmask_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_FieldMask_google_2fprotobuf_2ffield_5fmask_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_FloatValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Int32Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Int64Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_StringValue_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2ftimestamp_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UInt32Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2fwrappers_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UInt64Value_google_2fprotobuf_2fwrappers_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_MessageType_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestBoolValue_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMap_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMap_Int32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMap_Int64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMap_Uint32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMap_Uint64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_TestNestedMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestNestedMap_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestNestedMap_Int32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestNestedMap_Int64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestNestedMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestNestedMap_Uint32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestNestedMap_Uint64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestStringMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_google_2fprotobuf_2funittest_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestAllExtensions_google_2fprotobuf_2funittest_2eproto;
+namespace proto3 {
+class MessageTypeDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<MessageType> _instance;
+} _MessageType_default_instance_;
+class TestMessageDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMessage> _instance;
+} _TestMessage_default_instance_;
+class TestOneofDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestOneof> _instance;
+  ::PROTOBUF_NAMESPACE_ID::int32 oneof_int32_value_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_string_value_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oneof_bytes_value_;
+  int oneof_enum_value_;
+  const ::proto3::MessageType* oneof_message_value_;
+} _TestOneof_default_instance_;
+class TestMap_BoolMapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMap_BoolMapEntry_DoNotUse> _instance;
+} _TestMap_BoolMapEntry_DoNotUse_default_instance_;
+class TestMap_Int32MapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMap_Int32MapEntry_DoNotUse> _instance;
+} _TestMap_Int32MapEntry_DoNotUse_default_instance_;
+class TestMap_Int64MapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMap_Int64MapEntry_DoNotUse> _instance;
+} _TestMap_Int64MapEntry_DoNotUse_default_instance_;
+class TestMap_Uint32MapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMap_Uint32MapEntry_DoNotUse> _instance;
+} _TestMap_Uint32MapEntry_DoNotUse_default_instance_;
+class TestMap_Uint64MapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMap_Uint64MapEntry_DoNotUse> _instance;
+} _TestMap_Uint64MapEntry_DoNotUse_default_instance_;
+class TestMap_StringMapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMap_StringMapEntry_DoNotUse> _instance;
+} _TestMap_StringMapEntry_DoNotUse_default_instance_;
+class TestMapDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestMap> _instance;
+} _TestMap_default_instance_;
+class TestNestedMap_BoolMapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestNestedMap_BoolMapEntry_DoNotUse> _instance;
+} _TestNestedMap_BoolMapEntry_DoNotUse_default_instance_;
+class TestNestedMap_Int32MapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestNestedMap_Int32MapEntry_DoNotUse> _instance;
+} _TestNestedMap_Int32MapEntry_DoNotUse_default_instance_;
+class TestNestedMap_Int64MapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestNestedMap_Int64MapEntry_DoNotUse> _instance;
+} _TestNestedMap_Int64MapEntry_DoNotUse_default_instance_;
+class TestNestedMap_Uint32MapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestNestedMap_Uint32MapEntry_DoNotUse> _instance;
+} _TestNestedMap_Uint32MapEntry_DoNotUse_default_instance_;
+class TestNestedMap_Uint64MapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestNestedMap_Uint64MapEntry_DoNotUse> _instance;
+} _TestNestedMap_Uint64MapEntry_DoNotUse_default_instance_;
+class TestNestedMap_StringMapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestNestedMap_StringMapEntry_DoNotUse> _instance;
+} _TestNestedMap_StringMapEntry_DoNotUse_default_instance_;
+class TestNestedMap_MapMapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestNestedMap_MapMapEntry_DoNotUse> _instance;
+} _TestNestedMap_MapMapEntry_DoNotUse_default_instance_;
+class TestNestedMapDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestNestedMap> _instance;
+} _TestNestedMap_default_instance_;
+class TestStringMap_StringMapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestStringMap_StringMapEntry_DoNotUse> _instance;
+} _TestStringMap_StringMapEntry_DoNotUse_default_instance_;
+class TestStringMapDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestStringMap> _instance;
+} _TestStringMap_default_instance_;
+class TestWrapperDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestWrapper> _instance;
+} _TestWrapper_default_instance_;
+class TestTimestampDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestTimestamp> _instance;
+} _TestTimestamp_default_instance_;
+class TestDurationDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestDuration> _instance;
+} _TestDuration_default_instance_;
+class TestFieldMaskDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestFieldMask> _instance;
+} _TestFieldMask_default_instance_;
+class TestStructDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestStruct> _instance;
+} _TestStruct_default_instance_;
+class TestAnyDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestAny> _instance;
+} _TestAny_default_instance_;
+class TestValueDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestValue> _instance;
+} _TestValue_default_instance_;
+class TestListValueDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestListValue> _instance;
+} _TestListValue_default_instance_;
+class TestBoolValue_BoolMapEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestBoolValue_BoolMapEntry_DoNotUse> _instance;
+} _TestBoolValue_BoolMapEntry_DoNotUse_default_instance_;
+class TestBoolValueDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestBoolValue> _instance;
+} _TestBoolValue_default_instance_;
+class TestCustomJsonNameDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestCustomJsonName> _instance;
+} _TestCustomJsonName_default_instance_;
+class TestExtensionsDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestExtensions> _instance;
+} _TestExtensions_default_instance_;
+class TestEnumValueDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TestEnumValue> _instance;
+} _TestEnumValue_default_instance_;
+}  // namespace proto3
+static void InitDefaultsscc_info_MessageType_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_MessageType_default_instance_;
+    new (ptr) ::proto3::MessageType();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::MessageType::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_MessageType_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_MessageType_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestAny_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestAny_default_instance_;
+    new (ptr) ::proto3::TestAny();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestAny::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestAny_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestAny_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {
+      &scc_info_Any_google_2fprotobuf_2fany_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestBoolValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestBoolValue_default_instance_;
+    new (ptr) ::proto3::TestBoolValue();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestBoolValue::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestBoolValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestBoolValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {
+      &scc_info_TestBoolValue_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestBoolValue_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestBoolValue_BoolMapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto3::TestBoolValue_BoolMapEntry_DoNotUse();
+  }
+  ::proto3::TestBoolValue_BoolMapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestBoolValue_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestBoolValue_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestCustomJsonName_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestCustomJsonName_default_instance_;
+    new (ptr) ::proto3::TestCustomJsonName();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestCustomJsonName::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestCustomJsonName_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestCustomJsonName_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestDuration_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestDuration_default_instance_;
+    new (ptr) ::proto3::TestDuration();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestDuration::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestDuration_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestDuration_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {
+      &scc_info_Duration_google_2fprotobuf_2fduration_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestEnumValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestEnumValue_default_instance_;
+    new (ptr) ::proto3::TestEnumValue();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestEnumValue::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestEnumValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestEnumValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestExtensions_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestExtensions_default_instance_;
+    new (ptr) ::proto3::TestExtensions();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestExtensions::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestExtensions_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestExtensions_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {
+      &scc_info_TestAllExtensions_google_2fprotobuf_2funittest_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestFieldMask_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestFieldMask_default_instance_;
+    new (ptr) ::proto3::TestFieldMask();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestFieldMask::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestFieldMask_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestFieldMask_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {
+      &scc_info_FieldMask_google_2fprotobuf_2ffield_5fmask_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestListValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestListValue_default_instance_;
+    new (ptr) ::proto3::TestListValue();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestListValue::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestListValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestListValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestMap_default_instance_;
+    new (ptr) ::proto3::TestMap();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestMap::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_TestMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 6, 0, InitDefaultsscc_info_TestMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {
+      &scc_info_TestMap_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+      &scc_info_TestMap_Int32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+      &scc_info_TestMap_Int64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+      &scc_info_TestMap_Uint32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+      &scc_info_TestMap_Uint64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+      &scc_info_TestMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestMap_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestMap_BoolMapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto3::TestMap_BoolMapEntry_DoNotUse();
+  }
+  ::proto3::TestMap_BoolMapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMap_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestMap_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestMap_Int32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestMap_Int32MapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto3::TestMap_Int32MapEntry_DoNotUse();
+  }
+  ::proto3::TestMap_Int32MapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMap_Int32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestMap_Int32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestMap_Int64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestMap_Int64MapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto3::TestMap_Int64MapEntry_DoNotUse();
+  }
+  ::proto3::TestMap_Int64MapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMap_Int64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestMap_Int64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestMap_StringMapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto3::TestMap_StringMapEntry_DoNotUse();
+  }
+  ::proto3::TestMap_StringMapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestMap_Uint32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestMap_Uint32MapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto3::TestMap_Uint32MapEntry_DoNotUse();
+  }
+  ::proto3::TestMap_Uint32MapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMap_Uint32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestMap_Uint32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestMap_Uint64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestMap_Uint64MapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto3::TestMap_Uint64MapEntry_DoNotUse();
+  }
+  ::proto3::TestMap_Uint64MapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestMap_Uint64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestMap_Uint64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestMessage_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestMessage_default_instance_;
+    new (ptr) ::proto3::TestMessage();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestMessage::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestMessage_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestMessage_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {
+      &scc_info_MessageType_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestNestedMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestNestedMap_MapMapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto3::TestNestedMap_MapMapEntry_DoNotUse();
+  }
+  {
+    void* ptr = &::proto3::_TestNestedMap_default_instance_;
+    new (ptr) ::proto3::TestNestedMap();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestNestedMap_MapMapEntry_DoNotUse::InitAsDefaultInstance();
+  ::proto3::TestNestedMap::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_TestNestedMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 6, 0, InitDefaultsscc_info_TestNestedMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {
+      &scc_info_TestNestedMap_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+      &scc_info_TestNestedMap_Int32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+      &scc_info_TestNestedMap_Int64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+      &scc_info_TestNestedMap_Uint32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+      &scc_info_TestNestedMap_Uint64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+      &scc_info_TestNestedMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestNestedMap_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestNestedMap_BoolMapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto3::TestNestedMap_BoolMapEntry_DoNotUse();
+  }
+  ::proto3::TestNestedMap_BoolMapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestNestedMap_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestNestedMap_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestNestedMap_Int32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestNestedMap_Int32MapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto3::TestNestedMap_Int32MapEntry_DoNotUse();
+  }
+  ::proto3::TestNestedMap_Int32MapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestNestedMap_Int32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestNestedMap_Int32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestNestedMap_Int64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestNestedMap_Int64MapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto3::TestNestedMap_Int64MapEntry_DoNotUse();
+  }
+  ::proto3::TestNestedMap_Int64MapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestNestedMap_Int64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestNestedMap_Int64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestNestedMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestNestedMap_StringMapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto3::TestNestedMap_StringMapEntry_DoNotUse();
+  }
+  ::proto3::TestNestedMap_StringMapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestNestedMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestNestedMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestNestedMap_Uint32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestNestedMap_Uint32MapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto3::TestNestedMap_Uint32MapEntry_DoNotUse();
+  }
+  ::proto3::TestNestedMap_Uint32MapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestNestedMap_Uint32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestNestedMap_Uint32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestNestedMap_Uint64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestNestedMap_Uint64MapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto3::TestNestedMap_Uint64MapEntry_DoNotUse();
+  }
+  ::proto3::TestNestedMap_Uint64MapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestNestedMap_Uint64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestNestedMap_Uint64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestOneof_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestOneof_default_instance_;
+    new (ptr) ::proto3::TestOneof();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestOneof::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestOneof_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestOneof_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {
+      &scc_info_MessageType_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestStringMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestStringMap_default_instance_;
+    new (ptr) ::proto3::TestStringMap();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestStringMap::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestStringMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestStringMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {
+      &scc_info_TestStringMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestStringMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestStringMap_StringMapEntry_DoNotUse_default_instance_;
+    new (ptr) ::proto3::TestStringMap_StringMapEntry_DoNotUse();
+  }
+  ::proto3::TestStringMap_StringMapEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TestStringMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TestStringMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {}};
+
+static void InitDefaultsscc_info_TestStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestStruct_default_instance_;
+    new (ptr) ::proto3::TestStruct();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestStruct::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestTimestamp_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestTimestamp_default_instance_;
+    new (ptr) ::proto3::TestTimestamp();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestTimestamp::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestTimestamp_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestTimestamp_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {
+      &scc_info_Timestamp_google_2fprotobuf_2ftimestamp_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestValue_default_instance_;
+    new (ptr) ::proto3::TestValue();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestValue::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TestValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TestValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {
+      &scc_info_ListValue_google_2fprotobuf_2fstruct_2eproto.base,}};
+
+static void InitDefaultsscc_info_TestWrapper_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::proto3::_TestWrapper_default_instance_;
+    new (ptr) ::proto3::TestWrapper();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::proto3::TestWrapper::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<9> scc_info_TestWrapper_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 9, 0, InitDefaultsscc_info_TestWrapper_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto}, {
+      &scc_info_BoolValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_Int32Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_Int64Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_UInt32Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_UInt64Value_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_FloatValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_DoubleValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_StringValue_google_2fprotobuf_2fwrappers_2eproto.base,
+      &scc_info_BytesValue_google_2fprotobuf_2fwrappers_2eproto.base,}};
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[33];
+static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[1];
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto = nullptr;
+
+const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::MessageType, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::MessageType, value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, bool_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, int32_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, int64_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, uint32_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, uint64_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, float_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, double_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, string_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, bytes_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, enum_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, message_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, repeated_bool_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, repeated_int32_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, repeated_int64_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, repeated_uint32_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, repeated_uint64_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, repeated_float_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, repeated_double_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, repeated_string_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, repeated_bytes_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, repeated_enum_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMessage, repeated_message_value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestOneof, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestOneof, _oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  offsetof(::proto3::TestOneofDefaultTypeInternal, oneof_int32_value_),
+  offsetof(::proto3::TestOneofDefaultTypeInternal, oneof_string_value_),
+  offsetof(::proto3::TestOneofDefaultTypeInternal, oneof_bytes_value_),
+  offsetof(::proto3::TestOneofDefaultTypeInternal, oneof_enum_value_),
+  offsetof(::proto3::TestOneofDefaultTypeInternal, oneof_message_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestOneof, oneof_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_BoolMapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_BoolMapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_BoolMapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_BoolMapEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int32MapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int32MapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int32MapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int32MapEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int64MapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int64MapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int64MapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Int64MapEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint32MapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint32MapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint32MapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint32MapEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint64MapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint64MapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint64MapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_Uint64MapEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_StringMapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_StringMapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_StringMapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap_StringMapEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap, bool_map_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap, int32_map_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap, int64_map_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap, uint32_map_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap, uint64_map_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestMap, string_map_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_BoolMapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_BoolMapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_BoolMapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_BoolMapEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int32MapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int32MapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int32MapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int32MapEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int64MapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int64MapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int64MapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Int64MapEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint32MapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint32MapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint32MapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint32MapEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint64MapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint64MapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint64MapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_Uint64MapEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_StringMapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_StringMapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_StringMapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_StringMapEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_MapMapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_MapMapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_MapMapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap_MapMapEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, bool_map_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, int32_map_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, int64_map_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, uint32_map_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, uint64_map_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, string_map_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestNestedMap, map_map_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestStringMap_StringMapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestStringMap_StringMapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestStringMap_StringMapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestStringMap_StringMapEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestStringMap, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestStringMap, string_map_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, bool_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, int32_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, int64_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, uint32_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, uint64_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, float_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, double_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, string_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, bytes_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, repeated_bool_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, repeated_int32_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, repeated_int64_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, repeated_uint32_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, repeated_uint64_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, repeated_float_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, repeated_double_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, repeated_string_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestWrapper, repeated_bytes_value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestTimestamp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestTimestamp, value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestTimestamp, repeated_value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestDuration, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestDuration, value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestDuration, repeated_value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestFieldMask, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestFieldMask, value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestStruct, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestStruct, value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestStruct, repeated_value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestAny, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestAny, value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestAny, repeated_value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestValue, value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestValue, repeated_value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestListValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestListValue, value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestListValue, repeated_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestBoolValue_BoolMapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestBoolValue_BoolMapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestBoolValue_BoolMapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestBoolValue_BoolMapEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestBoolValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestBoolValue, bool_value_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestBoolValue, bool_map_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestCustomJsonName, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestCustomJsonName, value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestExtensions, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestExtensions, extensions_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestEnumValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::proto3::TestEnumValue, enum_value1_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestEnumValue, enum_value2_),
+  PROTOBUF_FIELD_OFFSET(::proto3::TestEnumValue, enum_value3_),
+};
+static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, sizeof(::proto3::MessageType)},
+  { 6, -1, sizeof(::proto3::TestMessage)},
+  { 33, -1, sizeof(::proto3::TestOneof)},
+  { 44, 51, sizeof(::proto3::TestMap_BoolMapEntry_DoNotUse)},
+  { 53, 60, sizeof(::proto3::TestMap_Int32MapEntry_DoNotUse)},
+  { 62, 69, sizeof(::proto3::TestMap_Int64MapEntry_DoNotUse)},
+  { 71, 78, sizeof(::proto3::TestMap_Uint32MapEntry_DoNotUse)},
+  { 80, 87, sizeof(::proto3::TestMap_Uint64MapEntry_DoNotUse)},
+  { 89, 96, sizeof(::proto3::TestMap_StringMapEntry_DoNotUse)},
+  { 98, -1, sizeof(::proto3::TestMap)},
+  { 109, 116, sizeof(::proto3::TestNestedMap_BoolMapEntry_DoNotUse)},
+  { 118, 125, sizeof(::proto3::TestNestedMap_Int32MapEntry_DoNotUse)},
+  { 127, 134, sizeof(::proto3::TestNestedMap_Int64MapEntry_DoNotUse)},
+  { 136, 143, sizeof(::proto3::TestNestedMap_Uint32MapEntry_DoNotUse)},
+  { 145, 152, sizeof(::proto3::TestNestedMap_Uint64MapEntry_DoNotUse)},
+  { 154, 161, sizeof(::proto3::TestNestedMap_StringMapEntry_DoNotUse)},
+  { 163, 170, sizeof(::proto3::TestNestedMap_MapMapEntry_DoNotUse)},
+  { 172, -1, sizeof(::proto3::TestNestedMap)},
+  { 184, 191, sizeof(::proto3::TestStringMap_StringMapEntry_DoNotUse)},
+  { 193, -1, sizeof(::proto3::TestStringMap)},
+  { 199, -1, sizeof(::proto3::TestWrapper)},
+  { 222, -1, sizeof(::proto3::TestTimestamp)},
+  { 229, -1, sizeof(::proto3::TestDuration)},
+  { 236, -1, sizeof(::proto3::TestFieldMask)},
+  { 242, -1, sizeof(::proto3::TestStruct)},
+  { 249, -1, sizeof(::proto3::TestAny)},
+  { 256, -1, sizeof(::proto3::TestValue)},
+  { 263, -1, sizeof(::proto3::TestListValue)},
+  { 270, 277, sizeof(::proto3::TestBoolValue_BoolMapEntry_DoNotUse)},
+  { 279, -1, sizeof(::proto3::TestBoolValue)},
+  { 286, -1, sizeof(::proto3::TestCustomJsonName)},
+  { 292, -1, sizeof(::proto3::TestExtensions)},
+  { 298, -1, sizeof(::proto3::TestEnumValue)},
+};
+
+static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_MessageType_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestMessage_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestOneof_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestMap_BoolMapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestMap_Int32MapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestMap_Int64MapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestMap_Uint32MapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestMap_Uint64MapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestMap_StringMapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestMap_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestNestedMap_BoolMapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestNestedMap_Int32MapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestNestedMap_Int64MapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestNestedMap_Uint32MapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestNestedMap_Uint64MapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestNestedMap_StringMapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestNestedMap_MapMapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestNestedMap_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestStringMap_StringMapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestStringMap_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestWrapper_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestTimestamp_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestDuration_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestFieldMask_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestStruct_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestAny_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestValue_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestListValue_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestBoolValue_BoolMapEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestBoolValue_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestCustomJsonName_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestExtensions_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto3::_TestEnumValue_default_instance_),
+};
+
+const char descriptor_table_protodef_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n-google/protobuf/util/json_format_proto"
+  "3.proto\022\006proto3\032\031google/protobuf/any.pro"
+  "to\032\036google/protobuf/duration.proto\032 goog"
+  "le/protobuf/field_mask.proto\032\034google/pro"
+  "tobuf/struct.proto\032\037google/protobuf/time"
+  "stamp.proto\032\036google/protobuf/wrappers.pr"
+  "oto\032\036google/protobuf/unittest.proto\"\034\n\013M"
+  "essageType\022\r\n\005value\030\001 \001(\005\"\224\005\n\013TestMessag"
+  "e\022\022\n\nbool_value\030\001 \001(\010\022\023\n\013int32_value\030\002 \001"
+  "(\005\022\023\n\013int64_value\030\003 \001(\003\022\024\n\014uint32_value\030"
+  "\004 \001(\r\022\024\n\014uint64_value\030\005 \001(\004\022\023\n\013float_val"
+  "ue\030\006 \001(\002\022\024\n\014double_value\030\007 \001(\001\022\024\n\014string"
+  "_value\030\010 \001(\t\022\023\n\013bytes_value\030\t \001(\014\022$\n\nenu"
+  "m_value\030\n \001(\0162\020.proto3.EnumType\022*\n\rmessa"
+  "ge_value\030\013 \001(\0132\023.proto3.MessageType\022\033\n\023r"
+  "epeated_bool_value\030\025 \003(\010\022\034\n\024repeated_int"
+  "32_value\030\026 \003(\005\022\034\n\024repeated_int64_value\030\027"
+  " \003(\003\022\035\n\025repeated_uint32_value\030\030 \003(\r\022\035\n\025r"
+  "epeated_uint64_value\030\031 \003(\004\022\034\n\024repeated_f"
+  "loat_value\030\032 \003(\002\022\035\n\025repeated_double_valu"
+  "e\030\033 \003(\001\022\035\n\025repeated_string_value\030\034 \003(\t\022\034"
+  "\n\024repeated_bytes_value\030\035 \003(\014\022-\n\023repeated"
+  "_enum_value\030\036 \003(\0162\020.proto3.EnumType\0223\n\026r"
+  "epeated_message_value\030\037 \003(\0132\023.proto3.Mes"
+  "sageType\"\324\001\n\tTestOneof\022\033\n\021oneof_int32_va"
+  "lue\030\001 \001(\005H\000\022\034\n\022oneof_string_value\030\002 \001(\tH"
+  "\000\022\033\n\021oneof_bytes_value\030\003 \001(\014H\000\022,\n\020oneof_"
+  "enum_value\030\004 \001(\0162\020.proto3.EnumTypeH\000\0222\n\023"
+  "oneof_message_value\030\005 \001(\0132\023.proto3.Messa"
+  "geTypeH\000B\r\n\013oneof_value\"\341\004\n\007TestMap\022.\n\010b"
+  "ool_map\030\001 \003(\0132\034.proto3.TestMap.BoolMapEn"
+  "try\0220\n\tint32_map\030\002 \003(\0132\035.proto3.TestMap."
+  "Int32MapEntry\0220\n\tint64_map\030\003 \003(\0132\035.proto"
+  "3.TestMap.Int64MapEntry\0222\n\nuint32_map\030\004 "
+  "\003(\0132\036.proto3.TestMap.Uint32MapEntry\0222\n\nu"
+  "int64_map\030\005 \003(\0132\036.proto3.TestMap.Uint64M"
+  "apEntry\0222\n\nstring_map\030\006 \003(\0132\036.proto3.Tes"
+  "tMap.StringMapEntry\032.\n\014BoolMapEntry\022\013\n\003k"
+  "ey\030\001 \001(\010\022\r\n\005value\030\002 \001(\005:\0028\001\032/\n\rInt32MapE"
+  "ntry\022\013\n\003key\030\001 \001(\005\022\r\n\005value\030\002 \001(\005:\0028\001\032/\n\r"
+  "Int64MapEntry\022\013\n\003key\030\001 \001(\003\022\r\n\005value\030\002 \001("
+  "\005:\0028\001\0320\n\016Uint32MapEntry\022\013\n\003key\030\001 \001(\r\022\r\n\005"
+  "value\030\002 \001(\005:\0028\001\0320\n\016Uint64MapEntry\022\013\n\003key"
+  "\030\001 \001(\004\022\r\n\005value\030\002 \001(\005:\0028\001\0320\n\016StringMapEn"
+  "try\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\005:\0028\001\"\205\006\n\r"
+  "TestNestedMap\0224\n\010bool_map\030\001 \003(\0132\".proto3"
+  ".TestNestedMap.BoolMapEntry\0226\n\tint32_map"
+  "\030\002 \003(\0132#.proto3.TestNestedMap.Int32MapEn"
+  "try\0226\n\tint64_map\030\003 \003(\0132#.proto3.TestNest"
+  "edMap.Int64MapEntry\0228\n\nuint32_map\030\004 \003(\0132"
+  "$.proto3.TestNestedMap.Uint32MapEntry\0228\n"
+  "\nuint64_map\030\005 \003(\0132$.proto3.TestNestedMap"
+  ".Uint64MapEntry\0228\n\nstring_map\030\006 \003(\0132$.pr"
+  "oto3.TestNestedMap.StringMapEntry\0222\n\007map"
+  "_map\030\007 \003(\0132!.proto3.TestNestedMap.MapMap"
+  "Entry\032.\n\014BoolMapEntry\022\013\n\003key\030\001 \001(\010\022\r\n\005va"
+  "lue\030\002 \001(\005:\0028\001\032/\n\rInt32MapEntry\022\013\n\003key\030\001 "
+  "\001(\005\022\r\n\005value\030\002 \001(\005:\0028\001\032/\n\rInt64MapEntry\022"
+  "\013\n\003key\030\001 \001(\003\022\r\n\005value\030\002 \001(\005:\0028\001\0320\n\016Uint3"
+  "2MapEntry\022\013\n\003key\030\001 \001(\r\022\r\n\005value\030\002 \001(\005:\0028"
+  "\001\0320\n\016Uint64MapEntry\022\013\n\003key\030\001 \001(\004\022\r\n\005valu"
+  "e\030\002 \001(\005:\0028\001\0320\n\016StringMapEntry\022\013\n\003key\030\001 \001"
+  "(\t\022\r\n\005value\030\002 \001(\005:\0028\001\032D\n\013MapMapEntry\022\013\n\003"
+  "key\030\001 \001(\t\022$\n\005value\030\002 \001(\0132\025.proto3.TestNe"
+  "stedMap:\0028\001\"{\n\rTestStringMap\0228\n\nstring_m"
+  "ap\030\001 \003(\0132$.proto3.TestStringMap.StringMa"
+  "pEntry\0320\n\016StringMapEntry\022\013\n\003key\030\001 \001(\t\022\r\n"
+  "\005value\030\002 \001(\t:\0028\001\"\356\007\n\013TestWrapper\022.\n\nbool"
+  "_value\030\001 \001(\0132\032.google.protobuf.BoolValue"
+  "\0220\n\013int32_value\030\002 \001(\0132\033.google.protobuf."
+  "Int32Value\0220\n\013int64_value\030\003 \001(\0132\033.google"
+  ".protobuf.Int64Value\0222\n\014uint32_value\030\004 \001"
+  "(\0132\034.google.protobuf.UInt32Value\0222\n\014uint"
+  "64_value\030\005 \001(\0132\034.google.protobuf.UInt64V"
+  "alue\0220\n\013float_value\030\006 \001(\0132\033.google.proto"
+  "buf.FloatValue\0222\n\014double_value\030\007 \001(\0132\034.g"
+  "oogle.protobuf.DoubleValue\0222\n\014string_val"
+  "ue\030\010 \001(\0132\034.google.protobuf.StringValue\0220"
+  "\n\013bytes_value\030\t \001(\0132\033.google.protobuf.By"
+  "tesValue\0227\n\023repeated_bool_value\030\013 \003(\0132\032."
+  "google.protobuf.BoolValue\0229\n\024repeated_in"
+  "t32_value\030\014 \003(\0132\033.google.protobuf.Int32V"
+  "alue\0229\n\024repeated_int64_value\030\r \003(\0132\033.goo"
+  "gle.protobuf.Int64Value\022;\n\025repeated_uint"
+  "32_value\030\016 \003(\0132\034.google.protobuf.UInt32V"
+  "alue\022;\n\025repeated_uint64_value\030\017 \003(\0132\034.go"
+  "ogle.protobuf.UInt64Value\0229\n\024repeated_fl"
+  "oat_value\030\020 \003(\0132\033.google.protobuf.FloatV"
+  "alue\022;\n\025repeated_double_value\030\021 \003(\0132\034.go"
+  "ogle.protobuf.DoubleValue\022;\n\025repeated_st"
+  "ring_value\030\022 \003(\0132\034.google.protobuf.Strin"
+  "gValue\0229\n\024repeated_bytes_value\030\023 \003(\0132\033.g"
+  "oogle.protobuf.BytesValue\"n\n\rTestTimesta"
+  "mp\022)\n\005value\030\001 \001(\0132\032.google.protobuf.Time"
+  "stamp\0222\n\016repeated_value\030\002 \003(\0132\032.google.p"
+  "rotobuf.Timestamp\"k\n\014TestDuration\022(\n\005val"
+  "ue\030\001 \001(\0132\031.google.protobuf.Duration\0221\n\016r"
+  "epeated_value\030\002 \003(\0132\031.google.protobuf.Du"
+  "ration\":\n\rTestFieldMask\022)\n\005value\030\001 \001(\0132\032"
+  ".google.protobuf.FieldMask\"e\n\nTestStruct"
+  "\022&\n\005value\030\001 \001(\0132\027.google.protobuf.Struct"
+  "\022/\n\016repeated_value\030\002 \003(\0132\027.google.protob"
+  "uf.Struct\"\\\n\007TestAny\022#\n\005value\030\001 \001(\0132\024.go"
+  "ogle.protobuf.Any\022,\n\016repeated_value\030\002 \003("
+  "\0132\024.google.protobuf.Any\"b\n\tTestValue\022%\n\005"
+  "value\030\001 \001(\0132\026.google.protobuf.Value\022.\n\016r"
+  "epeated_value\030\002 \003(\0132\026.google.protobuf.Va"
+  "lue\"n\n\rTestListValue\022)\n\005value\030\001 \001(\0132\032.go"
+  "ogle.protobuf.ListValue\0222\n\016repeated_valu"
+  "e\030\002 \003(\0132\032.google.protobuf.ListValue\"\211\001\n\r"
+  "TestBoolValue\022\022\n\nbool_value\030\001 \001(\010\0224\n\010boo"
+  "l_map\030\002 \003(\0132\".proto3.TestBoolValue.BoolM"
+  "apEntry\032.\n\014BoolMapEntry\022\013\n\003key\030\001 \001(\010\022\r\n\005"
+  "value\030\002 \001(\005:\0028\001\"+\n\022TestCustomJsonName\022\025\n"
+  "\005value\030\001 \001(\005R\006@value\"J\n\016TestExtensions\0228"
+  "\n\nextensions\030\001 \001(\0132$.protobuf_unittest.T"
+  "estAllExtensions\"\204\001\n\rTestEnumValue\022%\n\013en"
+  "um_value1\030\001 \001(\0162\020.proto3.EnumType\022%\n\013enu"
+  "m_value2\030\002 \001(\0162\020.proto3.EnumType\022%\n\013enum"
+  "_value3\030\003 \001(\0162\020.proto3.EnumType*\034\n\010EnumT"
+  "ype\022\007\n\003FOO\020\000\022\007\n\003BAR\020\001B,\n\030com.google.prot"
+  "obuf.utilB\020JsonFormatProto3b\006proto3"
+  ;
+static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_deps[7] = {
+  &::descriptor_table_google_2fprotobuf_2fany_2eproto,
+  &::descriptor_table_google_2fprotobuf_2fduration_2eproto,
+  &::descriptor_table_google_2fprotobuf_2ffield_5fmask_2eproto,
+  &::descriptor_table_google_2fprotobuf_2fstruct_2eproto,
+  &::descriptor_table_google_2fprotobuf_2ftimestamp_2eproto,
+  &::descriptor_table_google_2fprotobuf_2funittest_2eproto,
+  &::descriptor_table_google_2fprotobuf_2fwrappers_2eproto,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_sccs[32] = {
+  &scc_info_MessageType_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestAny_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestBoolValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestBoolValue_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestCustomJsonName_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestDuration_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestEnumValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestExtensions_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestFieldMask_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestListValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestMap_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestMap_Int32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestMap_Int64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestMap_Uint32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestMap_Uint64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestMessage_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestNestedMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestNestedMap_BoolMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestNestedMap_Int32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestNestedMap_Int64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestNestedMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestNestedMap_Uint32MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestNestedMap_Uint64MapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestOneof_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestStringMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestStringMap_StringMapEntry_DoNotUse_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestTimestamp_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+  &scc_info_TestWrapper_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once;
+const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto = {
+  false, false, descriptor_table_protodef_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto, "google/protobuf/util/json_format_proto3.proto", 4875,
+  &descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_once, descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_sccs, descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto_deps, 32, 7,
+  schemas, file_default_instances, TableStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto::offsets,
+  file_level_metadata_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto, 33, file_level_enum_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto, file_level_service_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto,
+};
+
+// Force running AddDescriptors() at dynamic initialization time.
+static bool dynamic_init_dummy_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto)), true);
+namespace proto3 {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EnumType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto);
+  return file_level_enum_descriptors_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto[0];
+}
+bool EnumType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+void MessageType::InitAsDefaultInstance() {
+}
+class MessageType::_Internal {
+ public:
+};
+
+MessageType::MessageType(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.MessageType)
+}
+MessageType::MessageType(const MessageType& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  value_ = from.value_;
+  // @@protoc_insertion_point(copy_constructor:proto3.MessageType)
+}
+
+void MessageType::SharedCtor() {
+  value_ = 0;
+}
+
+MessageType::~MessageType() {
+  // @@protoc_insertion_point(destructor:proto3.MessageType)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void MessageType::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void MessageType::ArenaDtor(void* object) {
+  MessageType* _this = reinterpret_cast< MessageType* >(object);
+  (void)_this;
+}
+void MessageType::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void MessageType::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const MessageType& MessageType::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_MessageType_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void MessageType::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.MessageType)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  value_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MessageType::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // int32 value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* MessageType::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.MessageType)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 value = 1;
+  if (this->value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.MessageType)
+  return target;
+}
+
+size_t MessageType::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.MessageType)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 value = 1;
+  if (this->value() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_value());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void MessageType::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.MessageType)
+  GOOGLE_DCHECK_NE(&from, this);
+  const MessageType* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<MessageType>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.MessageType)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.MessageType)
+    MergeFrom(*source);
+  }
+}
+
+void MessageType::MergeFrom(const MessageType& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.MessageType)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.value() != 0) {
+    _internal_set_value(from._internal_value());
+  }
+}
+
+void MessageType::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.MessageType)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void MessageType::CopyFrom(const MessageType& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.MessageType)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MessageType::IsInitialized() const {
+  return true;
+}
+
+void MessageType::InternalSwap(MessageType* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(value_, other->value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MessageType::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TestMessage::InitAsDefaultInstance() {
+  ::proto3::_TestMessage_default_instance_._instance.get_mutable()->message_value_ = const_cast< ::proto3::MessageType*>(
+      ::proto3::MessageType::internal_default_instance());
+}
+class TestMessage::_Internal {
+ public:
+  static const ::proto3::MessageType& message_value(const TestMessage* msg);
+};
+
+const ::proto3::MessageType&
+TestMessage::_Internal::message_value(const TestMessage* msg) {
+  return *msg->message_value_;
+}
+TestMessage::TestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  repeated_bool_value_(arena),
+  repeated_int32_value_(arena),
+  repeated_int64_value_(arena),
+  repeated_uint32_value_(arena),
+  repeated_uint64_value_(arena),
+  repeated_float_value_(arena),
+  repeated_double_value_(arena),
+  repeated_string_value_(arena),
+  repeated_bytes_value_(arena),
+  repeated_enum_value_(arena),
+  repeated_message_value_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestMessage)
+}
+TestMessage::TestMessage(const TestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      repeated_bool_value_(from.repeated_bool_value_),
+      repeated_int32_value_(from.repeated_int32_value_),
+      repeated_int64_value_(from.repeated_int64_value_),
+      repeated_uint32_value_(from.repeated_uint32_value_),
+      repeated_uint64_value_(from.repeated_uint64_value_),
+      repeated_float_value_(from.repeated_float_value_),
+      repeated_double_value_(from.repeated_double_value_),
+      repeated_string_value_(from.repeated_string_value_),
+      repeated_bytes_value_(from.repeated_bytes_value_),
+      repeated_enum_value_(from.repeated_enum_value_),
+      repeated_message_value_(from.repeated_message_value_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  string_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_string_value().empty()) {
+    string_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_string_value(),
+      GetArena());
+  }
+  bytes_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_bytes_value().empty()) {
+    bytes_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_bytes_value(),
+      GetArena());
+  }
+  if (from._internal_has_message_value()) {
+    message_value_ = new ::proto3::MessageType(*from.message_value_);
+  } else {
+    message_value_ = nullptr;
+  }
+  ::memcpy(&bool_value_, &from.bool_value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&enum_value_) -
+    reinterpret_cast<char*>(&bool_value_)) + sizeof(enum_value_));
+  // @@protoc_insertion_point(copy_constructor:proto3.TestMessage)
+}
+
+void TestMessage::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestMessage_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  string_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  bytes_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&message_value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&enum_value_) -
+      reinterpret_cast<char*>(&message_value_)) + sizeof(enum_value_));
+}
+
+TestMessage::~TestMessage() {
+  // @@protoc_insertion_point(destructor:proto3.TestMessage)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  string_value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  bytes_value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete message_value_;
+}
+
+void TestMessage::ArenaDtor(void* object) {
+  TestMessage* _this = reinterpret_cast< TestMessage* >(object);
+  (void)_this;
+}
+void TestMessage::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestMessage::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestMessage& TestMessage::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestMessage_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_bool_value_.Clear();
+  repeated_int32_value_.Clear();
+  repeated_int64_value_.Clear();
+  repeated_uint32_value_.Clear();
+  repeated_uint64_value_.Clear();
+  repeated_float_value_.Clear();
+  repeated_double_value_.Clear();
+  repeated_string_value_.Clear();
+  repeated_bytes_value_.Clear();
+  repeated_enum_value_.Clear();
+  repeated_message_value_.Clear();
+  string_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  bytes_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (GetArena() == nullptr && message_value_ != nullptr) {
+    delete message_value_;
+  }
+  message_value_ = nullptr;
+  ::memset(&bool_value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&enum_value_) -
+      reinterpret_cast<char*>(&bool_value_)) + sizeof(enum_value_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // bool bool_value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          bool_value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int32 int32_value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          int32_value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int64 int64_value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          int64_value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 uint32_value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          uint32_value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 uint64_value = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          uint64_value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // float float_value = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 53)) {
+          float_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // double double_value = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 57)) {
+          double_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else goto handle_unusual;
+        continue;
+      // string string_value = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&string_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          const std::string* str = &string_value_.Get();
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto3.TestMessage.string_value"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes bytes_value = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(&bytes_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), arena, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto3.EnumType enum_value = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 80)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_enum_value(static_cast<::proto3::EnumType>(val));
+        } else goto handle_unusual;
+        continue;
+      // .proto3.MessageType message_value = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated bool repeated_bool_value = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 170)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedBoolParser(_internal_mutable_repeated_bool_value(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 168) {
+          _internal_add_repeated_bool_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated int32 repeated_int32_value = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 178)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_repeated_int32_value(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 176) {
+          _internal_add_repeated_int32_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated int64 repeated_int64_value = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 186)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_repeated_int64_value(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 184) {
+          _internal_add_repeated_int64_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated uint32 repeated_uint32_value = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 194)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_repeated_uint32_value(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 192) {
+          _internal_add_repeated_uint32_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated uint64 repeated_uint64_value = 25;
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 202)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_repeated_uint64_value(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 200) {
+          _internal_add_repeated_uint64_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated float repeated_float_value = 26;
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 210)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_repeated_float_value(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 213) {
+          _internal_add_repeated_float_value(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // repeated double repeated_double_value = 27;
+      case 27:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 218)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_repeated_double_value(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 217) {
+          _internal_add_repeated_double_value(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else goto handle_unusual;
+        continue;
+      // repeated string repeated_string_value = 28;
+      case 28:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 226)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_repeated_string_value();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto3.TestMessage.repeated_string_value"));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<226>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated bytes repeated_bytes_value = 29;
+      case 29:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 234)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_repeated_bytes_value();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<234>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .proto3.EnumType repeated_enum_value = 30;
+      case 30:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 242)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser(_internal_mutable_repeated_enum_value(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 240) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_add_repeated_enum_value(static_cast<::proto3::EnumType>(val));
+        } else goto handle_unusual;
+        continue;
+      // repeated .proto3.MessageType repeated_message_value = 31;
+      case 31:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 250)) {
+          ptr -= 2;
+          repeated_message_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<250>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_repeated_message_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<250>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestMessage::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool bool_value = 1;
+  if (this->bool_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(1, this->_internal_bool_value(), target);
+  }
+
+  // int32 int32_value = 2;
+  if (this->int32_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_int32_value(), target);
+  }
+
+  // int64 int64_value = 3;
+  if (this->int64_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(3, this->_internal_int64_value(), target);
+  }
+
+  // uint32 uint32_value = 4;
+  if (this->uint32_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_uint32_value(), target);
+  }
+
+  // uint64 uint64_value = 5;
+  if (this->uint64_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(5, this->_internal_uint64_value(), target);
+  }
+
+  // float float_value = 6;
+  if (!(this->float_value() <= 0 && this->float_value() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(6, this->_internal_float_value(), target);
+  }
+
+  // double double_value = 7;
+  if (!(this->double_value() <= 0 && this->double_value() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(7, this->_internal_double_value(), target);
+  }
+
+  // string string_value = 8;
+  if (this->string_value().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_string_value().data(), static_cast<int>(this->_internal_string_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto3.TestMessage.string_value");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_string_value(), target);
+  }
+
+  // bytes bytes_value = 9;
+  if (this->bytes_value().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        9, this->_internal_bytes_value(), target);
+  }
+
+  // .proto3.EnumType enum_value = 10;
+  if (this->enum_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      10, this->_internal_enum_value(), target);
+  }
+
+  // .proto3.MessageType message_value = 11;
+  if (this->has_message_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        11, _Internal::message_value(this), target, stream);
+  }
+
+  // repeated bool repeated_bool_value = 21;
+  if (this->_internal_repeated_bool_value_size() > 0) {
+    target = stream->WriteFixedPacked(21, _internal_repeated_bool_value(), target);
+  }
+
+  // repeated int32 repeated_int32_value = 22;
+  {
+    int byte_size = _repeated_int32_value_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          22, _internal_repeated_int32_value(), byte_size, target);
+    }
+  }
+
+  // repeated int64 repeated_int64_value = 23;
+  {
+    int byte_size = _repeated_int64_value_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          23, _internal_repeated_int64_value(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 repeated_uint32_value = 24;
+  {
+    int byte_size = _repeated_uint32_value_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          24, _internal_repeated_uint32_value(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 repeated_uint64_value = 25;
+  {
+    int byte_size = _repeated_uint64_value_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          25, _internal_repeated_uint64_value(), byte_size, target);
+    }
+  }
+
+  // repeated float repeated_float_value = 26;
+  if (this->_internal_repeated_float_value_size() > 0) {
+    target = stream->WriteFixedPacked(26, _internal_repeated_float_value(), target);
+  }
+
+  // repeated double repeated_double_value = 27;
+  if (this->_internal_repeated_double_value_size() > 0) {
+    target = stream->WriteFixedPacked(27, _internal_repeated_double_value(), target);
+  }
+
+  // repeated string repeated_string_value = 28;
+  for (int i = 0, n = this->_internal_repeated_string_value_size(); i < n; i++) {
+    const auto& s = this->_internal_repeated_string_value(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto3.TestMessage.repeated_string_value");
+    target = stream->WriteString(28, s, target);
+  }
+
+  // repeated bytes repeated_bytes_value = 29;
+  for (int i = 0, n = this->_internal_repeated_bytes_value_size(); i < n; i++) {
+    const auto& s = this->_internal_repeated_bytes_value(i);
+    target = stream->WriteBytes(29, s, target);
+  }
+
+  // repeated .proto3.EnumType repeated_enum_value = 30;
+  {
+    int byte_size = _repeated_enum_value_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(
+          30, repeated_enum_value_, byte_size, target);
+    }
+  }
+
+  // repeated .proto3.MessageType repeated_message_value = 31;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_message_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(31, this->_internal_repeated_message_value(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestMessage)
+  return target;
+}
+
+size_t TestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestMessage)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bool repeated_bool_value = 21;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_bool_value_size());
+    size_t data_size = 1UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_bool_value_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 repeated_int32_value = 22;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int32Size(this->repeated_int32_value_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_int32_value_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int64 repeated_int64_value = 23;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int64Size(this->repeated_int64_value_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_int64_value_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 repeated_uint32_value = 24;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt32Size(this->repeated_uint32_value_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_uint32_value_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 repeated_uint64_value = 25;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt64Size(this->repeated_uint64_value_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_uint64_value_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated float repeated_float_value = 26;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_float_value_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_float_value_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated double repeated_double_value = 27;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_double_value_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_double_value_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated string repeated_string_value = 28;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(repeated_string_value_.size());
+  for (int i = 0, n = repeated_string_value_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      repeated_string_value_.Get(i));
+  }
+
+  // repeated bytes repeated_bytes_value = 29;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(repeated_bytes_value_.size());
+  for (int i = 0, n = repeated_bytes_value_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      repeated_bytes_value_.Get(i));
+  }
+
+  // repeated .proto3.EnumType repeated_enum_value = 30;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_repeated_enum_value_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(
+        this->_internal_repeated_enum_value(static_cast<int>(i)));
+    }
+    if (data_size > 0) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _repeated_enum_value_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated .proto3.MessageType repeated_message_value = 31;
+  total_size += 2UL * this->_internal_repeated_message_value_size();
+  for (const auto& msg : this->repeated_message_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string string_value = 8;
+  if (this->string_value().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_string_value());
+  }
+
+  // bytes bytes_value = 9;
+  if (this->bytes_value().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_bytes_value());
+  }
+
+  // .proto3.MessageType message_value = 11;
+  if (this->has_message_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *message_value_);
+  }
+
+  // bool bool_value = 1;
+  if (this->bool_value() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 int32_value = 2;
+  if (this->int32_value() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_int32_value());
+  }
+
+  // int64 int64_value = 3;
+  if (this->int64_value() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+        this->_internal_int64_value());
+  }
+
+  // uint64 uint64_value = 5;
+  if (this->uint64_value() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_uint64_value());
+  }
+
+  // uint32 uint32_value = 4;
+  if (this->uint32_value() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_uint32_value());
+  }
+
+  // float float_value = 6;
+  if (!(this->float_value() <= 0 && this->float_value() >= 0)) {
+    total_size += 1 + 4;
+  }
+
+  // double double_value = 7;
+  if (!(this->double_value() <= 0 && this->double_value() >= 0)) {
+    total_size += 1 + 8;
+  }
+
+  // .proto3.EnumType enum_value = 10;
+  if (this->enum_value() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_enum_value());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestMessage* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestMessage>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestMessage)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestMessage)
+    MergeFrom(*source);
+  }
+}
+
+void TestMessage::MergeFrom(const TestMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_bool_value_.MergeFrom(from.repeated_bool_value_);
+  repeated_int32_value_.MergeFrom(from.repeated_int32_value_);
+  repeated_int64_value_.MergeFrom(from.repeated_int64_value_);
+  repeated_uint32_value_.MergeFrom(from.repeated_uint32_value_);
+  repeated_uint64_value_.MergeFrom(from.repeated_uint64_value_);
+  repeated_float_value_.MergeFrom(from.repeated_float_value_);
+  repeated_double_value_.MergeFrom(from.repeated_double_value_);
+  repeated_string_value_.MergeFrom(from.repeated_string_value_);
+  repeated_bytes_value_.MergeFrom(from.repeated_bytes_value_);
+  repeated_enum_value_.MergeFrom(from.repeated_enum_value_);
+  repeated_message_value_.MergeFrom(from.repeated_message_value_);
+  if (from.string_value().size() > 0) {
+    _internal_set_string_value(from._internal_string_value());
+  }
+  if (from.bytes_value().size() > 0) {
+    _internal_set_bytes_value(from._internal_bytes_value());
+  }
+  if (from.has_message_value()) {
+    _internal_mutable_message_value()->::proto3::MessageType::MergeFrom(from._internal_message_value());
+  }
+  if (from.bool_value() != 0) {
+    _internal_set_bool_value(from._internal_bool_value());
+  }
+  if (from.int32_value() != 0) {
+    _internal_set_int32_value(from._internal_int32_value());
+  }
+  if (from.int64_value() != 0) {
+    _internal_set_int64_value(from._internal_int64_value());
+  }
+  if (from.uint64_value() != 0) {
+    _internal_set_uint64_value(from._internal_uint64_value());
+  }
+  if (from.uint32_value() != 0) {
+    _internal_set_uint32_value(from._internal_uint32_value());
+  }
+  if (!(from.float_value() <= 0 && from.float_value() >= 0)) {
+    _internal_set_float_value(from._internal_float_value());
+  }
+  if (!(from.double_value() <= 0 && from.double_value() >= 0)) {
+    _internal_set_double_value(from._internal_double_value());
+  }
+  if (from.enum_value() != 0) {
+    _internal_set_enum_value(from._internal_enum_value());
+  }
+}
+
+void TestMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestMessage::CopyFrom(const TestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestMessage)
+  if (&from == this) return;
+  Clear();
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  repeated_bool_value_.MergeFrom(from.repeated_bool_value_);
+  repeated_int32_value_.MergeFrom(from.repeated_int32_value_);
+  repeated_int64_value_.MergeFrom(from.repeated_int64_value_);
+  repeated_uint32_value_.MergeFrom(from.repeated_uint32_value_);
+  repeated_uint64_value_.MergeFrom(from.repeated_uint64_value_);
+  repeated_float_value_.MergeFrom(from.repeated_float_value_);
+  repeated_double_value_.MergeFrom(from.repeated_double_value_);
+  repeated_string_value_.MergeFrom(from.repeated_string_value_);
+  repeated_bytes_value_.MergeFrom(from.repeated_bytes_value_);
+  repeated_enum_value_.MergeFrom(from.repeated_enum_value_);
+  repeated_message_value_.MergeFrom(from.repeated_message_value_);
+  if (from.string_value().size() > 0) {
+    _internal_set_string_value(from._internal_string_value());
+  }
+  if (from.bytes_value().size() > 0) {
+    _internal_set_bytes_value(from._internal_bytes_value());
+  }
+  if (from.has_message_value()) {
+    _internal_mutable_message_value()->::proto3::MessageType::MergeFrom(from._internal_message_value());
+  }
+  ::memcpy(&bool_value_, &from.bool_value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&enum_value_) -
+    reinterpret_cast<char*>(&bool_value_)) + sizeof(enum_value_));
+}
+
+bool TestMessage::IsInitialized() const {
+  return true;
+}
+
+void TestMessage::InternalSwap(TestMessage* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  repeated_bool_value_.InternalSwap(&other->repeated_bool_value_);
+  repeated_int32_value_.InternalSwap(&other->repeated_int32_value_);
+  repeated_int64_value_.InternalSwap(&other->repeated_int64_value_);
+  repeated_uint32_value_.InternalSwap(&other->repeated_uint32_value_);
+  repeated_uint64_value_.InternalSwap(&other->repeated_uint64_value_);
+  repeated_float_value_.InternalSwap(&other->repeated_float_value_);
+  repeated_double_value_.InternalSwap(&other->repeated_double_value_);
+  repeated_string_value_.InternalSwap(&other->repeated_string_value_);
+  repeated_bytes_value_.InternalSwap(&other->repeated_bytes_value_);
+  repeated_enum_value_.InternalSwap(&other->repeated_enum_value_);
+  repeated_message_value_.InternalSwap(&other->repeated_message_value_);
+  string_value_.Swap(&other->string_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  bytes_value_.Swap(&other->bytes_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestMessage, enum_value_)
+      + sizeof(TestMessage::enum_value_)
+      - PROTOBUF_FIELD_OFFSET(TestMessage, message_value_)>(
+          reinterpret_cast<char*>(&message_value_),
+          reinterpret_cast<char*>(&other->message_value_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestMessage::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TestOneof::InitAsDefaultInstance() {
+  ::proto3::_TestOneof_default_instance_.oneof_int32_value_ = 0;
+  ::proto3::_TestOneof_default_instance_.oneof_string_value_.UnsafeSetDefault(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::proto3::_TestOneof_default_instance_.oneof_bytes_value_.UnsafeSetDefault(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::proto3::_TestOneof_default_instance_.oneof_enum_value_ = 0;
+  ::proto3::_TestOneof_default_instance_.oneof_message_value_ = const_cast< ::proto3::MessageType*>(
+      ::proto3::MessageType::internal_default_instance());
+}
+class TestOneof::_Internal {
+ public:
+  static const ::proto3::MessageType& oneof_message_value(const TestOneof* msg);
+};
+
+const ::proto3::MessageType&
+TestOneof::_Internal::oneof_message_value(const TestOneof* msg) {
+  return *msg->oneof_value_.oneof_message_value_;
+}
+void TestOneof::set_allocated_oneof_message_value(::proto3::MessageType* oneof_message_value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_oneof_value();
+  if (oneof_message_value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(oneof_message_value);
+    if (message_arena != submessage_arena) {
+      oneof_message_value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, oneof_message_value, submessage_arena);
+    }
+    set_has_oneof_message_value();
+    oneof_value_.oneof_message_value_ = oneof_message_value;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto3.TestOneof.oneof_message_value)
+}
+TestOneof::TestOneof(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestOneof)
+}
+TestOneof::TestOneof(const TestOneof& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_oneof_value();
+  switch (from.oneof_value_case()) {
+    case kOneofInt32Value: {
+      _internal_set_oneof_int32_value(from._internal_oneof_int32_value());
+      break;
+    }
+    case kOneofStringValue: {
+      _internal_set_oneof_string_value(from._internal_oneof_string_value());
+      break;
+    }
+    case kOneofBytesValue: {
+      _internal_set_oneof_bytes_value(from._internal_oneof_bytes_value());
+      break;
+    }
+    case kOneofEnumValue: {
+      _internal_set_oneof_enum_value(from._internal_oneof_enum_value());
+      break;
+    }
+    case kOneofMessageValue: {
+      _internal_mutable_oneof_message_value()->::proto3::MessageType::MergeFrom(from._internal_oneof_message_value());
+      break;
+    }
+    case ONEOF_VALUE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:proto3.TestOneof)
+}
+
+void TestOneof::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestOneof_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  clear_has_oneof_value();
+}
+
+TestOneof::~TestOneof() {
+  // @@protoc_insertion_point(destructor:proto3.TestOneof)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestOneof::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (has_oneof_value()) {
+    clear_oneof_value();
+  }
+}
+
+void TestOneof::ArenaDtor(void* object) {
+  TestOneof* _this = reinterpret_cast< TestOneof* >(object);
+  (void)_this;
+}
+void TestOneof::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestOneof::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestOneof& TestOneof::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestOneof_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestOneof::clear_oneof_value() {
+// @@protoc_insertion_point(one_of_clear_start:proto3.TestOneof)
+  switch (oneof_value_case()) {
+    case kOneofInt32Value: {
+      // No need to clear
+      break;
+    }
+    case kOneofStringValue: {
+      oneof_value_.oneof_string_value_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+      break;
+    }
+    case kOneofBytesValue: {
+      oneof_value_.oneof_bytes_value_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+      break;
+    }
+    case kOneofEnumValue: {
+      // No need to clear
+      break;
+    }
+    case kOneofMessageValue: {
+      if (GetArena() == nullptr) {
+        delete oneof_value_.oneof_message_value_;
+      }
+      break;
+    }
+    case ONEOF_VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = ONEOF_VALUE_NOT_SET;
+}
+
+
+void TestOneof::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestOneof)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_oneof_value();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestOneof::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // int32 oneof_int32_value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          _internal_set_oneof_int32_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string oneof_string_value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          auto str = _internal_mutable_oneof_string_value();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto3.TestOneof.oneof_string_value"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes oneof_bytes_value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          auto str = _internal_mutable_oneof_bytes_value();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .proto3.EnumType oneof_enum_value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_oneof_enum_value(static_cast<::proto3::EnumType>(val));
+        } else goto handle_unusual;
+        continue;
+      // .proto3.MessageType oneof_message_value = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_oneof_message_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestOneof::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestOneof)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 oneof_int32_value = 1;
+  if (_internal_has_oneof_int32_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_oneof_int32_value(), target);
+  }
+
+  // string oneof_string_value = 2;
+  if (_internal_has_oneof_string_value()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_oneof_string_value().data(), static_cast<int>(this->_internal_oneof_string_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto3.TestOneof.oneof_string_value");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_oneof_string_value(), target);
+  }
+
+  // bytes oneof_bytes_value = 3;
+  if (_internal_has_oneof_bytes_value()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_oneof_bytes_value(), target);
+  }
+
+  // .proto3.EnumType oneof_enum_value = 4;
+  if (_internal_has_oneof_enum_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_oneof_enum_value(), target);
+  }
+
+  // .proto3.MessageType oneof_message_value = 5;
+  if (_internal_has_oneof_message_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        5, _Internal::oneof_message_value(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestOneof)
+  return target;
+}
+
+size_t TestOneof::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestOneof)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (oneof_value_case()) {
+    // int32 oneof_int32_value = 1;
+    case kOneofInt32Value: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_oneof_int32_value());
+      break;
+    }
+    // string oneof_string_value = 2;
+    case kOneofStringValue: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_oneof_string_value());
+      break;
+    }
+    // bytes oneof_bytes_value = 3;
+    case kOneofBytesValue: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_oneof_bytes_value());
+      break;
+    }
+    // .proto3.EnumType oneof_enum_value = 4;
+    case kOneofEnumValue: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_oneof_enum_value());
+      break;
+    }
+    // .proto3.MessageType oneof_message_value = 5;
+    case kOneofMessageValue: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *oneof_value_.oneof_message_value_);
+      break;
+    }
+    case ONEOF_VALUE_NOT_SET: {
+      break;
+    }
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestOneof::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestOneof)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestOneof* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestOneof>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestOneof)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestOneof)
+    MergeFrom(*source);
+  }
+}
+
+void TestOneof::MergeFrom(const TestOneof& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestOneof)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.oneof_value_case()) {
+    case kOneofInt32Value: {
+      _internal_set_oneof_int32_value(from._internal_oneof_int32_value());
+      break;
+    }
+    case kOneofStringValue: {
+      _internal_set_oneof_string_value(from._internal_oneof_string_value());
+      break;
+    }
+    case kOneofBytesValue: {
+      _internal_set_oneof_bytes_value(from._internal_oneof_bytes_value());
+      break;
+    }
+    case kOneofEnumValue: {
+      _internal_set_oneof_enum_value(from._internal_oneof_enum_value());
+      break;
+    }
+    case kOneofMessageValue: {
+      _internal_mutable_oneof_message_value()->::proto3::MessageType::MergeFrom(from._internal_oneof_message_value());
+      break;
+    }
+    case ONEOF_VALUE_NOT_SET: {
+      break;
+    }
+  }
+}
+
+void TestOneof::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestOneof)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestOneof::CopyFrom(const TestOneof& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestOneof)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestOneof::IsInitialized() const {
+  return true;
+}
+
+void TestOneof::InternalSwap(TestOneof* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(oneof_value_, other->oneof_value_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestOneof::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+TestMap_BoolMapEntry_DoNotUse::TestMap_BoolMapEntry_DoNotUse() {}
+TestMap_BoolMapEntry_DoNotUse::TestMap_BoolMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMap_BoolMapEntry_DoNotUse::MergeFrom(const TestMap_BoolMapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TestMap_BoolMapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void TestMap_BoolMapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+TestMap_Int32MapEntry_DoNotUse::TestMap_Int32MapEntry_DoNotUse() {}
+TestMap_Int32MapEntry_DoNotUse::TestMap_Int32MapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMap_Int32MapEntry_DoNotUse::MergeFrom(const TestMap_Int32MapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TestMap_Int32MapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void TestMap_Int32MapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+TestMap_Int64MapEntry_DoNotUse::TestMap_Int64MapEntry_DoNotUse() {}
+TestMap_Int64MapEntry_DoNotUse::TestMap_Int64MapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMap_Int64MapEntry_DoNotUse::MergeFrom(const TestMap_Int64MapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TestMap_Int64MapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void TestMap_Int64MapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+TestMap_Uint32MapEntry_DoNotUse::TestMap_Uint32MapEntry_DoNotUse() {}
+TestMap_Uint32MapEntry_DoNotUse::TestMap_Uint32MapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMap_Uint32MapEntry_DoNotUse::MergeFrom(const TestMap_Uint32MapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TestMap_Uint32MapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void TestMap_Uint32MapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+TestMap_Uint64MapEntry_DoNotUse::TestMap_Uint64MapEntry_DoNotUse() {}
+TestMap_Uint64MapEntry_DoNotUse::TestMap_Uint64MapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMap_Uint64MapEntry_DoNotUse::MergeFrom(const TestMap_Uint64MapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TestMap_Uint64MapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void TestMap_Uint64MapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+TestMap_StringMapEntry_DoNotUse::TestMap_StringMapEntry_DoNotUse() {}
+TestMap_StringMapEntry_DoNotUse::TestMap_StringMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestMap_StringMapEntry_DoNotUse::MergeFrom(const TestMap_StringMapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TestMap_StringMapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void TestMap_StringMapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+void TestMap::InitAsDefaultInstance() {
+}
+class TestMap::_Internal {
+ public:
+};
+
+TestMap::TestMap(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  bool_map_(arena),
+  int32_map_(arena),
+  int64_map_(arena),
+  uint32_map_(arena),
+  uint64_map_(arena),
+  string_map_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestMap)
+}
+TestMap::TestMap(const TestMap& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  bool_map_.MergeFrom(from.bool_map_);
+  int32_map_.MergeFrom(from.int32_map_);
+  int64_map_.MergeFrom(from.int64_map_);
+  uint32_map_.MergeFrom(from.uint32_map_);
+  uint64_map_.MergeFrom(from.uint64_map_);
+  string_map_.MergeFrom(from.string_map_);
+  // @@protoc_insertion_point(copy_constructor:proto3.TestMap)
+}
+
+void TestMap::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+}
+
+TestMap::~TestMap() {
+  // @@protoc_insertion_point(destructor:proto3.TestMap)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestMap::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestMap::ArenaDtor(void* object) {
+  TestMap* _this = reinterpret_cast< TestMap* >(object);
+  (void)_this;
+}
+void TestMap::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestMap::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestMap& TestMap::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestMap)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  bool_map_.Clear();
+  int32_map_.Clear();
+  int64_map_.Clear();
+  uint32_map_.Clear();
+  uint64_map_.Clear();
+  string_map_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestMap::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // map<bool, int32> bool_map = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&bool_map_,
+              ctx->CountLengthDelimited<10>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&bool_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, int32> int32_map = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&int32_map_,
+              ctx->CountLengthDelimited<18>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&int32_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int64, int32> int64_map = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&int64_map_,
+              ctx->CountLengthDelimited<26>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&int64_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<uint32, int32> uint32_map = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&uint32_map_,
+              ctx->CountLengthDelimited<34>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&uint32_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<uint64, int32> uint64_map = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&uint64_map_,
+              ctx->CountLengthDelimited<42>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&uint64_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<string, int32> string_map = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&string_map_,
+              ctx->CountLengthDelimited<50>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&string_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestMap::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestMap)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<bool, int32> bool_map = 1;
+  if (!this->_internal_bool_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< bool, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_bool_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_bool_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_bool_map().begin();
+          it != this->_internal_bool_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestMap_BoolMapEntry_DoNotUse::Funcs::InternalSerialize(1, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_bool_map().begin();
+          it != this->_internal_bool_map().end(); ++it) {
+        target = TestMap_BoolMapEntry_DoNotUse::Funcs::InternalSerialize(1, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, int32> int32_map = 2;
+  if (!this->_internal_int32_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_int32_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_int32_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_int32_map().begin();
+          it != this->_internal_int32_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestMap_Int32MapEntry_DoNotUse::Funcs::InternalSerialize(2, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_int32_map().begin();
+          it != this->_internal_int32_map().end(); ++it) {
+        target = TestMap_Int32MapEntry_DoNotUse::Funcs::InternalSerialize(2, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int64, int32> int64_map = 3;
+  if (!this->_internal_int64_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int64, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_int64_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_int64_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_int64_map().begin();
+          it != this->_internal_int64_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestMap_Int64MapEntry_DoNotUse::Funcs::InternalSerialize(3, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_int64_map().begin();
+          it != this->_internal_int64_map().end(); ++it) {
+        target = TestMap_Int64MapEntry_DoNotUse::Funcs::InternalSerialize(3, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, int32> uint32_map = 4;
+  if (!this->_internal_uint32_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::uint32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_uint32_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_uint32_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_uint32_map().begin();
+          it != this->_internal_uint32_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestMap_Uint32MapEntry_DoNotUse::Funcs::InternalSerialize(4, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_uint32_map().begin();
+          it != this->_internal_uint32_map().end(); ++it) {
+        target = TestMap_Uint32MapEntry_DoNotUse::Funcs::InternalSerialize(4, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<uint64, int32> uint64_map = 5;
+  if (!this->_internal_uint64_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::uint64, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_uint64_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_uint64_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_uint64_map().begin();
+          it != this->_internal_uint64_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestMap_Uint64MapEntry_DoNotUse::Funcs::InternalSerialize(5, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_uint64_map().begin();
+          it != this->_internal_uint64_map().end(); ++it) {
+        target = TestMap_Uint64MapEntry_DoNotUse::Funcs::InternalSerialize(5, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<string, int32> string_map = 6;
+  if (!this->_internal_string_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          p->first.data(), static_cast<int>(p->first.length()),
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+          "proto3.TestMap.StringMapEntry.key");
+      }
+    };
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_string_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_string_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_string_map().begin();
+          it != this->_internal_string_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestMap_StringMapEntry_DoNotUse::Funcs::InternalSerialize(6, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_string_map().begin();
+          it != this->_internal_string_map().end(); ++it) {
+        target = TestMap_StringMapEntry_DoNotUse::Funcs::InternalSerialize(6, it->first, it->second, target, stream);
+        Utf8Check::Check(&(*it));
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestMap)
+  return target;
+}
+
+size_t TestMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestMap)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<bool, int32> bool_map = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_bool_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->_internal_bool_map().begin();
+      it != this->_internal_bool_map().end(); ++it) {
+    total_size += TestMap_BoolMapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, int32> int32_map = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_int32_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->_internal_int32_map().begin();
+      it != this->_internal_int32_map().end(); ++it) {
+    total_size += TestMap_Int32MapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int64, int32> int64_map = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_int64_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->_internal_int64_map().begin();
+      it != this->_internal_int64_map().end(); ++it) {
+    total_size += TestMap_Int64MapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint32, int32> uint32_map = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_uint32_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->_internal_uint32_map().begin();
+      it != this->_internal_uint32_map().end(); ++it) {
+    total_size += TestMap_Uint32MapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint64, int32> uint64_map = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_uint64_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->_internal_uint64_map().begin();
+      it != this->_internal_uint64_map().end(); ++it) {
+    total_size += TestMap_Uint64MapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<string, int32> string_map = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_string_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->_internal_string_map().begin();
+      it != this->_internal_string_map().end(); ++it) {
+    total_size += TestMap_StringMapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestMap::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestMap)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestMap* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestMap>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestMap)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestMap)
+    MergeFrom(*source);
+  }
+}
+
+void TestMap::MergeFrom(const TestMap& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestMap)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  bool_map_.MergeFrom(from.bool_map_);
+  int32_map_.MergeFrom(from.int32_map_);
+  int64_map_.MergeFrom(from.int64_map_);
+  uint32_map_.MergeFrom(from.uint32_map_);
+  uint64_map_.MergeFrom(from.uint64_map_);
+  string_map_.MergeFrom(from.string_map_);
+}
+
+void TestMap::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestMap::CopyFrom(const TestMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestMap::IsInitialized() const {
+  return true;
+}
+
+void TestMap::InternalSwap(TestMap* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  bool_map_.Swap(&other->bool_map_);
+  int32_map_.Swap(&other->int32_map_);
+  int64_map_.Swap(&other->int64_map_);
+  uint32_map_.Swap(&other->uint32_map_);
+  uint64_map_.Swap(&other->uint64_map_);
+  string_map_.Swap(&other->string_map_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestMap::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+TestNestedMap_BoolMapEntry_DoNotUse::TestNestedMap_BoolMapEntry_DoNotUse() {}
+TestNestedMap_BoolMapEntry_DoNotUse::TestNestedMap_BoolMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestNestedMap_BoolMapEntry_DoNotUse::MergeFrom(const TestNestedMap_BoolMapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TestNestedMap_BoolMapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void TestNestedMap_BoolMapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+TestNestedMap_Int32MapEntry_DoNotUse::TestNestedMap_Int32MapEntry_DoNotUse() {}
+TestNestedMap_Int32MapEntry_DoNotUse::TestNestedMap_Int32MapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestNestedMap_Int32MapEntry_DoNotUse::MergeFrom(const TestNestedMap_Int32MapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TestNestedMap_Int32MapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void TestNestedMap_Int32MapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+TestNestedMap_Int64MapEntry_DoNotUse::TestNestedMap_Int64MapEntry_DoNotUse() {}
+TestNestedMap_Int64MapEntry_DoNotUse::TestNestedMap_Int64MapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestNestedMap_Int64MapEntry_DoNotUse::MergeFrom(const TestNestedMap_Int64MapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TestNestedMap_Int64MapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void TestNestedMap_Int64MapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+TestNestedMap_Uint32MapEntry_DoNotUse::TestNestedMap_Uint32MapEntry_DoNotUse() {}
+TestNestedMap_Uint32MapEntry_DoNotUse::TestNestedMap_Uint32MapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestNestedMap_Uint32MapEntry_DoNotUse::MergeFrom(const TestNestedMap_Uint32MapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TestNestedMap_Uint32MapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void TestNestedMap_Uint32MapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+TestNestedMap_Uint64MapEntry_DoNotUse::TestNestedMap_Uint64MapEntry_DoNotUse() {}
+TestNestedMap_Uint64MapEntry_DoNotUse::TestNestedMap_Uint64MapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestNestedMap_Uint64MapEntry_DoNotUse::MergeFrom(const TestNestedMap_Uint64MapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TestNestedMap_Uint64MapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void TestNestedMap_Uint64MapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+TestNestedMap_StringMapEntry_DoNotUse::TestNestedMap_StringMapEntry_DoNotUse() {}
+TestNestedMap_StringMapEntry_DoNotUse::TestNestedMap_StringMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestNestedMap_StringMapEntry_DoNotUse::MergeFrom(const TestNestedMap_StringMapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TestNestedMap_StringMapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void TestNestedMap_StringMapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+TestNestedMap_MapMapEntry_DoNotUse::TestNestedMap_MapMapEntry_DoNotUse() {}
+TestNestedMap_MapMapEntry_DoNotUse::TestNestedMap_MapMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestNestedMap_MapMapEntry_DoNotUse::MergeFrom(const TestNestedMap_MapMapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TestNestedMap_MapMapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void TestNestedMap_MapMapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+void TestNestedMap::InitAsDefaultInstance() {
+}
+class TestNestedMap::_Internal {
+ public:
+};
+
+TestNestedMap::TestNestedMap(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  bool_map_(arena),
+  int32_map_(arena),
+  int64_map_(arena),
+  uint32_map_(arena),
+  uint64_map_(arena),
+  string_map_(arena),
+  map_map_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestNestedMap)
+}
+TestNestedMap::TestNestedMap(const TestNestedMap& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  bool_map_.MergeFrom(from.bool_map_);
+  int32_map_.MergeFrom(from.int32_map_);
+  int64_map_.MergeFrom(from.int64_map_);
+  uint32_map_.MergeFrom(from.uint32_map_);
+  uint64_map_.MergeFrom(from.uint64_map_);
+  string_map_.MergeFrom(from.string_map_);
+  map_map_.MergeFrom(from.map_map_);
+  // @@protoc_insertion_point(copy_constructor:proto3.TestNestedMap)
+}
+
+void TestNestedMap::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestNestedMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+}
+
+TestNestedMap::~TestNestedMap() {
+  // @@protoc_insertion_point(destructor:proto3.TestNestedMap)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestNestedMap::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestNestedMap::ArenaDtor(void* object) {
+  TestNestedMap* _this = reinterpret_cast< TestNestedMap* >(object);
+  (void)_this;
+}
+void TestNestedMap::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestNestedMap::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestNestedMap& TestNestedMap::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestNestedMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestNestedMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestNestedMap)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  bool_map_.Clear();
+  int32_map_.Clear();
+  int64_map_.Clear();
+  uint32_map_.Clear();
+  uint64_map_.Clear();
+  string_map_.Clear();
+  map_map_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestNestedMap::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // map<bool, int32> bool_map = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&bool_map_,
+              ctx->CountLengthDelimited<10>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&bool_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int32, int32> int32_map = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&int32_map_,
+              ctx->CountLengthDelimited<18>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&int32_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<int64, int32> int64_map = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&int64_map_,
+              ctx->CountLengthDelimited<26>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&int64_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<uint32, int32> uint32_map = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&uint32_map_,
+              ctx->CountLengthDelimited<34>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&uint32_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<uint64, int32> uint64_map = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&uint64_map_,
+              ctx->CountLengthDelimited<42>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&uint64_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<string, int32> string_map = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&string_map_,
+              ctx->CountLengthDelimited<50>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&string_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<string, .proto3.TestNestedMap> map_map = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&map_map_,
+              ctx->CountLengthDelimited<58>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&map_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestNestedMap::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestNestedMap)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<bool, int32> bool_map = 1;
+  if (!this->_internal_bool_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< bool, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_bool_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_bool_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_bool_map().begin();
+          it != this->_internal_bool_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestNestedMap_BoolMapEntry_DoNotUse::Funcs::InternalSerialize(1, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_bool_map().begin();
+          it != this->_internal_bool_map().end(); ++it) {
+        target = TestNestedMap_BoolMapEntry_DoNotUse::Funcs::InternalSerialize(1, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int32, int32> int32_map = 2;
+  if (!this->_internal_int32_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_int32_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_int32_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_int32_map().begin();
+          it != this->_internal_int32_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestNestedMap_Int32MapEntry_DoNotUse::Funcs::InternalSerialize(2, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_int32_map().begin();
+          it != this->_internal_int32_map().end(); ++it) {
+        target = TestNestedMap_Int32MapEntry_DoNotUse::Funcs::InternalSerialize(2, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<int64, int32> int64_map = 3;
+  if (!this->_internal_int64_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::int64, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_int64_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_int64_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_int64_map().begin();
+          it != this->_internal_int64_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestNestedMap_Int64MapEntry_DoNotUse::Funcs::InternalSerialize(3, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_int64_map().begin();
+          it != this->_internal_int64_map().end(); ++it) {
+        target = TestNestedMap_Int64MapEntry_DoNotUse::Funcs::InternalSerialize(3, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, int32> uint32_map = 4;
+  if (!this->_internal_uint32_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::uint32, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_uint32_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_uint32_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_uint32_map().begin();
+          it != this->_internal_uint32_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestNestedMap_Uint32MapEntry_DoNotUse::Funcs::InternalSerialize(4, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_uint32_map().begin();
+          it != this->_internal_uint32_map().end(); ++it) {
+        target = TestNestedMap_Uint32MapEntry_DoNotUse::Funcs::InternalSerialize(4, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<uint64, int32> uint64_map = 5;
+  if (!this->_internal_uint64_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::uint64, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_uint64_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_uint64_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_uint64_map().begin();
+          it != this->_internal_uint64_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestNestedMap_Uint64MapEntry_DoNotUse::Funcs::InternalSerialize(5, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_uint64_map().begin();
+          it != this->_internal_uint64_map().end(); ++it) {
+        target = TestNestedMap_Uint64MapEntry_DoNotUse::Funcs::InternalSerialize(5, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // map<string, int32> string_map = 6;
+  if (!this->_internal_string_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          p->first.data(), static_cast<int>(p->first.length()),
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+          "proto3.TestNestedMap.StringMapEntry.key");
+      }
+    };
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_string_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_string_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_string_map().begin();
+          it != this->_internal_string_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestNestedMap_StringMapEntry_DoNotUse::Funcs::InternalSerialize(6, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_string_map().begin();
+          it != this->_internal_string_map().end(); ++it) {
+        target = TestNestedMap_StringMapEntry_DoNotUse::Funcs::InternalSerialize(6, it->first, it->second, target, stream);
+        Utf8Check::Check(&(*it));
+      }
+    }
+  }
+
+  // map<string, .proto3.TestNestedMap> map_map = 7;
+  if (!this->_internal_map_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto3::TestNestedMap >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          p->first.data(), static_cast<int>(p->first.length()),
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+          "proto3.TestNestedMap.MapMapEntry.key");
+      }
+    };
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_map_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_map_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto3::TestNestedMap >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto3::TestNestedMap >::const_iterator
+          it = this->_internal_map_map().begin();
+          it != this->_internal_map_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestNestedMap_MapMapEntry_DoNotUse::Funcs::InternalSerialize(7, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto3::TestNestedMap >::const_iterator
+          it = this->_internal_map_map().begin();
+          it != this->_internal_map_map().end(); ++it) {
+        target = TestNestedMap_MapMapEntry_DoNotUse::Funcs::InternalSerialize(7, it->first, it->second, target, stream);
+        Utf8Check::Check(&(*it));
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestNestedMap)
+  return target;
+}
+
+size_t TestNestedMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestNestedMap)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<bool, int32> bool_map = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_bool_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->_internal_bool_map().begin();
+      it != this->_internal_bool_map().end(); ++it) {
+    total_size += TestNestedMap_BoolMapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int32, int32> int32_map = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_int32_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->_internal_int32_map().begin();
+      it != this->_internal_int32_map().end(); ++it) {
+    total_size += TestNestedMap_Int32MapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<int64, int32> int64_map = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_int64_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->_internal_int64_map().begin();
+      it != this->_internal_int64_map().end(); ++it) {
+    total_size += TestNestedMap_Int64MapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint32, int32> uint32_map = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_uint32_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->_internal_uint32_map().begin();
+      it != this->_internal_uint32_map().end(); ++it) {
+    total_size += TestNestedMap_Uint32MapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint64, int32> uint64_map = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_uint64_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->_internal_uint64_map().begin();
+      it != this->_internal_uint64_map().end(); ++it) {
+    total_size += TestNestedMap_Uint64MapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<string, int32> string_map = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_string_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->_internal_string_map().begin();
+      it != this->_internal_string_map().end(); ++it) {
+    total_size += TestNestedMap_StringMapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<string, .proto3.TestNestedMap> map_map = 7;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_map_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::proto3::TestNestedMap >::const_iterator
+      it = this->_internal_map_map().begin();
+      it != this->_internal_map_map().end(); ++it) {
+    total_size += TestNestedMap_MapMapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestNestedMap::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestNestedMap)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestNestedMap* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestNestedMap>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestNestedMap)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestNestedMap)
+    MergeFrom(*source);
+  }
+}
+
+void TestNestedMap::MergeFrom(const TestNestedMap& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestNestedMap)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  bool_map_.MergeFrom(from.bool_map_);
+  int32_map_.MergeFrom(from.int32_map_);
+  int64_map_.MergeFrom(from.int64_map_);
+  uint32_map_.MergeFrom(from.uint32_map_);
+  uint64_map_.MergeFrom(from.uint64_map_);
+  string_map_.MergeFrom(from.string_map_);
+  map_map_.MergeFrom(from.map_map_);
+}
+
+void TestNestedMap::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestNestedMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestNestedMap::CopyFrom(const TestNestedMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestNestedMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestNestedMap::IsInitialized() const {
+  return true;
+}
+
+void TestNestedMap::InternalSwap(TestNestedMap* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  bool_map_.Swap(&other->bool_map_);
+  int32_map_.Swap(&other->int32_map_);
+  int64_map_.Swap(&other->int64_map_);
+  uint32_map_.Swap(&other->uint32_map_);
+  uint64_map_.Swap(&other->uint64_map_);
+  string_map_.Swap(&other->string_map_);
+  map_map_.Swap(&other->map_map_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestNestedMap::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+TestStringMap_StringMapEntry_DoNotUse::TestStringMap_StringMapEntry_DoNotUse() {}
+TestStringMap_StringMapEntry_DoNotUse::TestStringMap_StringMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestStringMap_StringMapEntry_DoNotUse::MergeFrom(const TestStringMap_StringMapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TestStringMap_StringMapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void TestStringMap_StringMapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+void TestStringMap::InitAsDefaultInstance() {
+}
+class TestStringMap::_Internal {
+ public:
+};
+
+TestStringMap::TestStringMap(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  string_map_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestStringMap)
+}
+TestStringMap::TestStringMap(const TestStringMap& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  string_map_.MergeFrom(from.string_map_);
+  // @@protoc_insertion_point(copy_constructor:proto3.TestStringMap)
+}
+
+void TestStringMap::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestStringMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+}
+
+TestStringMap::~TestStringMap() {
+  // @@protoc_insertion_point(destructor:proto3.TestStringMap)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestStringMap::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestStringMap::ArenaDtor(void* object) {
+  TestStringMap* _this = reinterpret_cast< TestStringMap* >(object);
+  (void)_this;
+}
+void TestStringMap::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestStringMap::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestStringMap& TestStringMap::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestStringMap_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestStringMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestStringMap)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  string_map_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestStringMap::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // map<string, string> string_map = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&string_map_,
+              ctx->CountLengthDelimited<10>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&string_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestStringMap::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestStringMap)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<string, string> string_map = 1;
+  if (!this->_internal_string_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          p->first.data(), static_cast<int>(p->first.length()),
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+          "proto3.TestStringMap.StringMapEntry.key");
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          p->second.data(), static_cast<int>(p->second.length()),
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+          "proto3.TestStringMap.StringMapEntry.value");
+      }
+    };
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_string_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_string_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+          it = this->_internal_string_map().begin();
+          it != this->_internal_string_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestStringMap_StringMapEntry_DoNotUse::Funcs::InternalSerialize(1, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+          it = this->_internal_string_map().begin();
+          it != this->_internal_string_map().end(); ++it) {
+        target = TestStringMap_StringMapEntry_DoNotUse::Funcs::InternalSerialize(1, it->first, it->second, target, stream);
+        Utf8Check::Check(&(*it));
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestStringMap)
+  return target;
+}
+
+size_t TestStringMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestStringMap)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, string> string_map = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_string_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_string_map().begin();
+      it != this->_internal_string_map().end(); ++it) {
+    total_size += TestStringMap_StringMapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestStringMap::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestStringMap)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestStringMap* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestStringMap>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestStringMap)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestStringMap)
+    MergeFrom(*source);
+  }
+}
+
+void TestStringMap::MergeFrom(const TestStringMap& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestStringMap)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  string_map_.MergeFrom(from.string_map_);
+}
+
+void TestStringMap::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestStringMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestStringMap::CopyFrom(const TestStringMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestStringMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestStringMap::IsInitialized() const {
+  return true;
+}
+
+void TestStringMap::InternalSwap(TestStringMap* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  string_map_.Swap(&other->string_map_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestStringMap::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TestWrapper::InitAsDefaultInstance() {
+  ::proto3::_TestWrapper_default_instance_._instance.get_mutable()->bool_value_ = const_cast< PROTOBUF_NAMESPACE_ID::BoolValue*>(
+      PROTOBUF_NAMESPACE_ID::BoolValue::internal_default_instance());
+  ::proto3::_TestWrapper_default_instance_._instance.get_mutable()->int32_value_ = const_cast< PROTOBUF_NAMESPACE_ID::Int32Value*>(
+      PROTOBUF_NAMESPACE_ID::Int32Value::internal_default_instance());
+  ::proto3::_TestWrapper_default_instance_._instance.get_mutable()->int64_value_ = const_cast< PROTOBUF_NAMESPACE_ID::Int64Value*>(
+      PROTOBUF_NAMESPACE_ID::Int64Value::internal_default_instance());
+  ::proto3::_TestWrapper_default_instance_._instance.get_mutable()->uint32_value_ = const_cast< PROTOBUF_NAMESPACE_ID::UInt32Value*>(
+      PROTOBUF_NAMESPACE_ID::UInt32Value::internal_default_instance());
+  ::proto3::_TestWrapper_default_instance_._instance.get_mutable()->uint64_value_ = const_cast< PROTOBUF_NAMESPACE_ID::UInt64Value*>(
+      PROTOBUF_NAMESPACE_ID::UInt64Value::internal_default_instance());
+  ::proto3::_TestWrapper_default_instance_._instance.get_mutable()->float_value_ = const_cast< PROTOBUF_NAMESPACE_ID::FloatValue*>(
+      PROTOBUF_NAMESPACE_ID::FloatValue::internal_default_instance());
+  ::proto3::_TestWrapper_default_instance_._instance.get_mutable()->double_value_ = const_cast< PROTOBUF_NAMESPACE_ID::DoubleValue*>(
+      PROTOBUF_NAMESPACE_ID::DoubleValue::internal_default_instance());
+  ::proto3::_TestWrapper_default_instance_._instance.get_mutable()->string_value_ = const_cast< PROTOBUF_NAMESPACE_ID::StringValue*>(
+      PROTOBUF_NAMESPACE_ID::StringValue::internal_default_instance());
+  ::proto3::_TestWrapper_default_instance_._instance.get_mutable()->bytes_value_ = const_cast< PROTOBUF_NAMESPACE_ID::BytesValue*>(
+      PROTOBUF_NAMESPACE_ID::BytesValue::internal_default_instance());
+}
+class TestWrapper::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::BoolValue& bool_value(const TestWrapper* msg);
+  static const PROTOBUF_NAMESPACE_ID::Int32Value& int32_value(const TestWrapper* msg);
+  static const PROTOBUF_NAMESPACE_ID::Int64Value& int64_value(const TestWrapper* msg);
+  static const PROTOBUF_NAMESPACE_ID::UInt32Value& uint32_value(const TestWrapper* msg);
+  static const PROTOBUF_NAMESPACE_ID::UInt64Value& uint64_value(const TestWrapper* msg);
+  static const PROTOBUF_NAMESPACE_ID::FloatValue& float_value(const TestWrapper* msg);
+  static const PROTOBUF_NAMESPACE_ID::DoubleValue& double_value(const TestWrapper* msg);
+  static const PROTOBUF_NAMESPACE_ID::StringValue& string_value(const TestWrapper* msg);
+  static const PROTOBUF_NAMESPACE_ID::BytesValue& bytes_value(const TestWrapper* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::BoolValue&
+TestWrapper::_Internal::bool_value(const TestWrapper* msg) {
+  return *msg->bool_value_;
+}
+const PROTOBUF_NAMESPACE_ID::Int32Value&
+TestWrapper::_Internal::int32_value(const TestWrapper* msg) {
+  return *msg->int32_value_;
+}
+const PROTOBUF_NAMESPACE_ID::Int64Value&
+TestWrapper::_Internal::int64_value(const TestWrapper* msg) {
+  return *msg->int64_value_;
+}
+const PROTOBUF_NAMESPACE_ID::UInt32Value&
+TestWrapper::_Internal::uint32_value(const TestWrapper* msg) {
+  return *msg->uint32_value_;
+}
+const PROTOBUF_NAMESPACE_ID::UInt64Value&
+TestWrapper::_Internal::uint64_value(const TestWrapper* msg) {
+  return *msg->uint64_value_;
+}
+const PROTOBUF_NAMESPACE_ID::FloatValue&
+TestWrapper::_Internal::float_value(const TestWrapper* msg) {
+  return *msg->float_value_;
+}
+const PROTOBUF_NAMESPACE_ID::DoubleValue&
+TestWrapper::_Internal::double_value(const TestWrapper* msg) {
+  return *msg->double_value_;
+}
+const PROTOBUF_NAMESPACE_ID::StringValue&
+TestWrapper::_Internal::string_value(const TestWrapper* msg) {
+  return *msg->string_value_;
+}
+const PROTOBUF_NAMESPACE_ID::BytesValue&
+TestWrapper::_Internal::bytes_value(const TestWrapper* msg) {
+  return *msg->bytes_value_;
+}
+void TestWrapper::clear_bool_value() {
+  if (GetArena() == nullptr && bool_value_ != nullptr) {
+    delete bool_value_;
+  }
+  bool_value_ = nullptr;
+}
+void TestWrapper::clear_int32_value() {
+  if (GetArena() == nullptr && int32_value_ != nullptr) {
+    delete int32_value_;
+  }
+  int32_value_ = nullptr;
+}
+void TestWrapper::clear_int64_value() {
+  if (GetArena() == nullptr && int64_value_ != nullptr) {
+    delete int64_value_;
+  }
+  int64_value_ = nullptr;
+}
+void TestWrapper::clear_uint32_value() {
+  if (GetArena() == nullptr && uint32_value_ != nullptr) {
+    delete uint32_value_;
+  }
+  uint32_value_ = nullptr;
+}
+void TestWrapper::clear_uint64_value() {
+  if (GetArena() == nullptr && uint64_value_ != nullptr) {
+    delete uint64_value_;
+  }
+  uint64_value_ = nullptr;
+}
+void TestWrapper::clear_float_value() {
+  if (GetArena() == nullptr && float_value_ != nullptr) {
+    delete float_value_;
+  }
+  float_value_ = nullptr;
+}
+void TestWrapper::clear_double_value() {
+  if (GetArena() == nullptr && double_value_ != nullptr) {
+    delete double_value_;
+  }
+  double_value_ = nullptr;
+}
+void TestWrapper::clear_string_value() {
+  if (GetArena() == nullptr && string_value_ != nullptr) {
+    delete string_value_;
+  }
+  string_value_ = nullptr;
+}
+void TestWrapper::clear_bytes_value() {
+  if (GetArena() == nullptr && bytes_value_ != nullptr) {
+    delete bytes_value_;
+  }
+  bytes_value_ = nullptr;
+}
+void TestWrapper::clear_repeated_bool_value() {
+  repeated_bool_value_.Clear();
+}
+void TestWrapper::clear_repeated_int32_value() {
+  repeated_int32_value_.Clear();
+}
+void TestWrapper::clear_repeated_int64_value() {
+  repeated_int64_value_.Clear();
+}
+void TestWrapper::clear_repeated_uint32_value() {
+  repeated_uint32_value_.Clear();
+}
+void TestWrapper::clear_repeated_uint64_value() {
+  repeated_uint64_value_.Clear();
+}
+void TestWrapper::clear_repeated_float_value() {
+  repeated_float_value_.Clear();
+}
+void TestWrapper::clear_repeated_double_value() {
+  repeated_double_value_.Clear();
+}
+void TestWrapper::clear_repeated_string_value() {
+  repeated_string_value_.Clear();
+}
+void TestWrapper::clear_repeated_bytes_value() {
+  repeated_bytes_value_.Clear();
+}
+TestWrapper::TestWrapper(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  repeated_bool_value_(arena),
+  repeated_int32_value_(arena),
+  repeated_int64_value_(arena),
+  repeated_uint32_value_(arena),
+  repeated_uint64_value_(arena),
+  repeated_float_value_(arena),
+  repeated_double_value_(arena),
+  repeated_string_value_(arena),
+  repeated_bytes_value_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestWrapper)
+}
+TestWrapper::TestWrapper(const TestWrapper& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      repeated_bool_value_(from.repeated_bool_value_),
+      repeated_int32_value_(from.repeated_int32_value_),
+      repeated_int64_value_(from.repeated_int64_value_),
+      repeated_uint32_value_(from.repeated_uint32_value_),
+      repeated_uint64_value_(from.repeated_uint64_value_),
+      repeated_float_value_(from.repeated_float_value_),
+      repeated_double_value_(from.repeated_double_value_),
+      repeated_string_value_(from.repeated_string_value_),
+      repeated_bytes_value_(from.repeated_bytes_value_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_bool_value()) {
+    bool_value_ = new PROTOBUF_NAMESPACE_ID::BoolValue(*from.bool_value_);
+  } else {
+    bool_value_ = nullptr;
+  }
+  if (from._internal_has_int32_value()) {
+    int32_value_ = new PROTOBUF_NAMESPACE_ID::Int32Value(*from.int32_value_);
+  } else {
+    int32_value_ = nullptr;
+  }
+  if (from._internal_has_int64_value()) {
+    int64_value_ = new PROTOBUF_NAMESPACE_ID::Int64Value(*from.int64_value_);
+  } else {
+    int64_value_ = nullptr;
+  }
+  if (from._internal_has_uint32_value()) {
+    uint32_value_ = new PROTOBUF_NAMESPACE_ID::UInt32Value(*from.uint32_value_);
+  } else {
+    uint32_value_ = nullptr;
+  }
+  if (from._internal_has_uint64_value()) {
+    uint64_value_ = new PROTOBUF_NAMESPACE_ID::UInt64Value(*from.uint64_value_);
+  } else {
+    uint64_value_ = nullptr;
+  }
+  if (from._internal_has_float_value()) {
+    float_value_ = new PROTOBUF_NAMESPACE_ID::FloatValue(*from.float_value_);
+  } else {
+    float_value_ = nullptr;
+  }
+  if (from._internal_has_double_value()) {
+    double_value_ = new PROTOBUF_NAMESPACE_ID::DoubleValue(*from.double_value_);
+  } else {
+    double_value_ = nullptr;
+  }
+  if (from._internal_has_string_value()) {
+    string_value_ = new PROTOBUF_NAMESPACE_ID::StringValue(*from.string_value_);
+  } else {
+    string_value_ = nullptr;
+  }
+  if (from._internal_has_bytes_value()) {
+    bytes_value_ = new PROTOBUF_NAMESPACE_ID::BytesValue(*from.bytes_value_);
+  } else {
+    bytes_value_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto3.TestWrapper)
+}
+
+void TestWrapper::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestWrapper_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  ::memset(&bool_value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&bytes_value_) -
+      reinterpret_cast<char*>(&bool_value_)) + sizeof(bytes_value_));
+}
+
+TestWrapper::~TestWrapper() {
+  // @@protoc_insertion_point(destructor:proto3.TestWrapper)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestWrapper::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete bool_value_;
+  if (this != internal_default_instance()) delete int32_value_;
+  if (this != internal_default_instance()) delete int64_value_;
+  if (this != internal_default_instance()) delete uint32_value_;
+  if (this != internal_default_instance()) delete uint64_value_;
+  if (this != internal_default_instance()) delete float_value_;
+  if (this != internal_default_instance()) delete double_value_;
+  if (this != internal_default_instance()) delete string_value_;
+  if (this != internal_default_instance()) delete bytes_value_;
+}
+
+void TestWrapper::ArenaDtor(void* object) {
+  TestWrapper* _this = reinterpret_cast< TestWrapper* >(object);
+  (void)_this;
+}
+void TestWrapper::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestWrapper::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestWrapper& TestWrapper::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestWrapper_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestWrapper::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_bool_value_.Clear();
+  repeated_int32_value_.Clear();
+  repeated_int64_value_.Clear();
+  repeated_uint32_value_.Clear();
+  repeated_uint64_value_.Clear();
+  repeated_float_value_.Clear();
+  repeated_double_value_.Clear();
+  repeated_string_value_.Clear();
+  repeated_bytes_value_.Clear();
+  if (GetArena() == nullptr && bool_value_ != nullptr) {
+    delete bool_value_;
+  }
+  bool_value_ = nullptr;
+  if (GetArena() == nullptr && int32_value_ != nullptr) {
+    delete int32_value_;
+  }
+  int32_value_ = nullptr;
+  if (GetArena() == nullptr && int64_value_ != nullptr) {
+    delete int64_value_;
+  }
+  int64_value_ = nullptr;
+  if (GetArena() == nullptr && uint32_value_ != nullptr) {
+    delete uint32_value_;
+  }
+  uint32_value_ = nullptr;
+  if (GetArena() == nullptr && uint64_value_ != nullptr) {
+    delete uint64_value_;
+  }
+  uint64_value_ = nullptr;
+  if (GetArena() == nullptr && float_value_ != nullptr) {
+    delete float_value_;
+  }
+  float_value_ = nullptr;
+  if (GetArena() == nullptr && double_value_ != nullptr) {
+    delete double_value_;
+  }
+  double_value_ = nullptr;
+  if (GetArena() == nullptr && string_value_ != nullptr) {
+    delete string_value_;
+  }
+  string_value_ = nullptr;
+  if (GetArena() == nullptr && bytes_value_ != nullptr) {
+    delete bytes_value_;
+  }
+  bytes_value_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestWrapper::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.BoolValue bool_value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bool_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Int32Value int32_value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_int32_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.Int64Value int64_value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_int64_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.UInt32Value uint32_value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_uint32_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.UInt64Value uint64_value = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_uint64_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.FloatValue float_value = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_float_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.DoubleValue double_value = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_double_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.StringValue string_value = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_string_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .google.protobuf.BytesValue bytes_value = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bytes_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.BoolValue repeated_bool_value = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+          ptr -= 1;
+          repeated_bool_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<90>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_repeated_bool_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Int32Value repeated_int32_value = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          ptr -= 1;
+          repeated_int32_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<98>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_repeated_int32_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Int64Value repeated_int64_value = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+          ptr -= 1;
+          repeated_int64_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<106>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_repeated_int64_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<106>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.UInt32Value repeated_uint32_value = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+          ptr -= 1;
+          repeated_uint32_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<114>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_repeated_uint32_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<114>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.UInt64Value repeated_uint64_value = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
+          ptr -= 1;
+          repeated_uint64_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<122>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_repeated_uint64_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<122>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.FloatValue repeated_float_value = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 130)) {
+          ptr -= 2;
+          repeated_float_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<130>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_repeated_float_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<130>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.DoubleValue repeated_double_value = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 138)) {
+          ptr -= 2;
+          repeated_double_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<138>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_repeated_double_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<138>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.StringValue repeated_string_value = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 146)) {
+          ptr -= 2;
+          repeated_string_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<146>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_repeated_string_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<146>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.BytesValue repeated_bytes_value = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 154)) {
+          ptr -= 2;
+          repeated_bytes_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<154>(ptr));
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_repeated_bytes_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<154>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestWrapper::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestWrapper)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.BoolValue bool_value = 1;
+  if (this->has_bool_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::bool_value(this), target, stream);
+  }
+
+  // .google.protobuf.Int32Value int32_value = 2;
+  if (this->has_int32_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::int32_value(this), target, stream);
+  }
+
+  // .google.protobuf.Int64Value int64_value = 3;
+  if (this->has_int64_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::int64_value(this), target, stream);
+  }
+
+  // .google.protobuf.UInt32Value uint32_value = 4;
+  if (this->has_uint32_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::uint32_value(this), target, stream);
+  }
+
+  // .google.protobuf.UInt64Value uint64_value = 5;
+  if (this->has_uint64_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        5, _Internal::uint64_value(this), target, stream);
+  }
+
+  // .google.protobuf.FloatValue float_value = 6;
+  if (this->has_float_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        6, _Internal::float_value(this), target, stream);
+  }
+
+  // .google.protobuf.DoubleValue double_value = 7;
+  if (this->has_double_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        7, _Internal::double_value(this), target, stream);
+  }
+
+  // .google.protobuf.StringValue string_value = 8;
+  if (this->has_string_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        8, _Internal::string_value(this), target, stream);
+  }
+
+  // .google.protobuf.BytesValue bytes_value = 9;
+  if (this->has_bytes_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        9, _Internal::bytes_value(this), target, stream);
+  }
+
+  // repeated .google.protobuf.BoolValue repeated_bool_value = 11;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_bool_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, this->_internal_repeated_bool_value(i), target, stream);
+  }
+
+  // repeated .google.protobuf.Int32Value repeated_int32_value = 12;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_int32_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, this->_internal_repeated_int32_value(i), target, stream);
+  }
+
+  // repeated .google.protobuf.Int64Value repeated_int64_value = 13;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_int64_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(13, this->_internal_repeated_int64_value(i), target, stream);
+  }
+
+  // repeated .google.protobuf.UInt32Value repeated_uint32_value = 14;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_uint32_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(14, this->_internal_repeated_uint32_value(i), target, stream);
+  }
+
+  // repeated .google.protobuf.UInt64Value repeated_uint64_value = 15;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_uint64_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(15, this->_internal_repeated_uint64_value(i), target, stream);
+  }
+
+  // repeated .google.protobuf.FloatValue repeated_float_value = 16;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_float_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(16, this->_internal_repeated_float_value(i), target, stream);
+  }
+
+  // repeated .google.protobuf.DoubleValue repeated_double_value = 17;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_double_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(17, this->_internal_repeated_double_value(i), target, stream);
+  }
+
+  // repeated .google.protobuf.StringValue repeated_string_value = 18;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_string_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(18, this->_internal_repeated_string_value(i), target, stream);
+  }
+
+  // repeated .google.protobuf.BytesValue repeated_bytes_value = 19;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_bytes_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(19, this->_internal_repeated_bytes_value(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestWrapper)
+  return target;
+}
+
+size_t TestWrapper::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestWrapper)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.BoolValue repeated_bool_value = 11;
+  total_size += 1UL * this->_internal_repeated_bool_value_size();
+  for (const auto& msg : this->repeated_bool_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.Int32Value repeated_int32_value = 12;
+  total_size += 1UL * this->_internal_repeated_int32_value_size();
+  for (const auto& msg : this->repeated_int32_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.Int64Value repeated_int64_value = 13;
+  total_size += 1UL * this->_internal_repeated_int64_value_size();
+  for (const auto& msg : this->repeated_int64_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.UInt32Value repeated_uint32_value = 14;
+  total_size += 1UL * this->_internal_repeated_uint32_value_size();
+  for (const auto& msg : this->repeated_uint32_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.UInt64Value repeated_uint64_value = 15;
+  total_size += 1UL * this->_internal_repeated_uint64_value_size();
+  for (const auto& msg : this->repeated_uint64_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.FloatValue repeated_float_value = 16;
+  total_size += 2UL * this->_internal_repeated_float_value_size();
+  for (const auto& msg : this->repeated_float_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.DoubleValue repeated_double_value = 17;
+  total_size += 2UL * this->_internal_repeated_double_value_size();
+  for (const auto& msg : this->repeated_double_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.StringValue repeated_string_value = 18;
+  total_size += 2UL * this->_internal_repeated_string_value_size();
+  for (const auto& msg : this->repeated_string_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .google.protobuf.BytesValue repeated_bytes_value = 19;
+  total_size += 2UL * this->_internal_repeated_bytes_value_size();
+  for (const auto& msg : this->repeated_bytes_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .google.protobuf.BoolValue bool_value = 1;
+  if (this->has_bool_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bool_value_);
+  }
+
+  // .google.protobuf.Int32Value int32_value = 2;
+  if (this->has_int32_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int32_value_);
+  }
+
+  // .google.protobuf.Int64Value int64_value = 3;
+  if (this->has_int64_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *int64_value_);
+  }
+
+  // .google.protobuf.UInt32Value uint32_value = 4;
+  if (this->has_uint32_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint32_value_);
+  }
+
+  // .google.protobuf.UInt64Value uint64_value = 5;
+  if (this->has_uint64_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *uint64_value_);
+  }
+
+  // .google.protobuf.FloatValue float_value = 6;
+  if (this->has_float_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *float_value_);
+  }
+
+  // .google.protobuf.DoubleValue double_value = 7;
+  if (this->has_double_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *double_value_);
+  }
+
+  // .google.protobuf.StringValue string_value = 8;
+  if (this->has_string_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *string_value_);
+  }
+
+  // .google.protobuf.BytesValue bytes_value = 9;
+  if (this->has_bytes_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *bytes_value_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestWrapper::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestWrapper* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestWrapper>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestWrapper)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestWrapper)
+    MergeFrom(*source);
+  }
+}
+
+void TestWrapper::MergeFrom(const TestWrapper& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestWrapper)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_bool_value_.MergeFrom(from.repeated_bool_value_);
+  repeated_int32_value_.MergeFrom(from.repeated_int32_value_);
+  repeated_int64_value_.MergeFrom(from.repeated_int64_value_);
+  repeated_uint32_value_.MergeFrom(from.repeated_uint32_value_);
+  repeated_uint64_value_.MergeFrom(from.repeated_uint64_value_);
+  repeated_float_value_.MergeFrom(from.repeated_float_value_);
+  repeated_double_value_.MergeFrom(from.repeated_double_value_);
+  repeated_string_value_.MergeFrom(from.repeated_string_value_);
+  repeated_bytes_value_.MergeFrom(from.repeated_bytes_value_);
+  if (from.has_bool_value()) {
+    _internal_mutable_bool_value()->PROTOBUF_NAMESPACE_ID::BoolValue::MergeFrom(from._internal_bool_value());
+  }
+  if (from.has_int32_value()) {
+    _internal_mutable_int32_value()->PROTOBUF_NAMESPACE_ID::Int32Value::MergeFrom(from._internal_int32_value());
+  }
+  if (from.has_int64_value()) {
+    _internal_mutable_int64_value()->PROTOBUF_NAMESPACE_ID::Int64Value::MergeFrom(from._internal_int64_value());
+  }
+  if (from.has_uint32_value()) {
+    _internal_mutable_uint32_value()->PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(from._internal_uint32_value());
+  }
+  if (from.has_uint64_value()) {
+    _internal_mutable_uint64_value()->PROTOBUF_NAMESPACE_ID::UInt64Value::MergeFrom(from._internal_uint64_value());
+  }
+  if (from.has_float_value()) {
+    _internal_mutable_float_value()->PROTOBUF_NAMESPACE_ID::FloatValue::MergeFrom(from._internal_float_value());
+  }
+  if (from.has_double_value()) {
+    _internal_mutable_double_value()->PROTOBUF_NAMESPACE_ID::DoubleValue::MergeFrom(from._internal_double_value());
+  }
+  if (from.has_string_value()) {
+    _internal_mutable_string_value()->PROTOBUF_NAMESPACE_ID::StringValue::MergeFrom(from._internal_string_value());
+  }
+  if (from.has_bytes_value()) {
+    _internal_mutable_bytes_value()->PROTOBUF_NAMESPACE_ID::BytesValue::MergeFrom(from._internal_bytes_value());
+  }
+}
+
+void TestWrapper::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestWrapper::CopyFrom(const TestWrapper& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestWrapper)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestWrapper::IsInitialized() const {
+  return true;
+}
+
+void TestWrapper::InternalSwap(TestWrapper* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  repeated_bool_value_.InternalSwap(&other->repeated_bool_value_);
+  repeated_int32_value_.InternalSwap(&other->repeated_int32_value_);
+  repeated_int64_value_.InternalSwap(&other->repeated_int64_value_);
+  repeated_uint32_value_.InternalSwap(&other->repeated_uint32_value_);
+  repeated_uint64_value_.InternalSwap(&other->repeated_uint64_value_);
+  repeated_float_value_.InternalSwap(&other->repeated_float_value_);
+  repeated_double_value_.InternalSwap(&other->repeated_double_value_);
+  repeated_string_value_.InternalSwap(&other->repeated_string_value_);
+  repeated_bytes_value_.InternalSwap(&other->repeated_bytes_value_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestWrapper, bytes_value_)
+      + sizeof(TestWrapper::bytes_value_)
+      - PROTOBUF_FIELD_OFFSET(TestWrapper, bool_value_)>(
+          reinterpret_cast<char*>(&bool_value_),
+          reinterpret_cast<char*>(&other->bool_value_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestWrapper::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TestTimestamp::InitAsDefaultInstance() {
+  ::proto3::_TestTimestamp_default_instance_._instance.get_mutable()->value_ = const_cast< PROTOBUF_NAMESPACE_ID::Timestamp*>(
+      PROTOBUF_NAMESPACE_ID::Timestamp::internal_default_instance());
+}
+class TestTimestamp::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Timestamp& value(const TestTimestamp* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Timestamp&
+TestTimestamp::_Internal::value(const TestTimestamp* msg) {
+  return *msg->value_;
+}
+void TestTimestamp::clear_value() {
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+}
+void TestTimestamp::clear_repeated_value() {
+  repeated_value_.Clear();
+}
+TestTimestamp::TestTimestamp(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  repeated_value_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestTimestamp)
+}
+TestTimestamp::TestTimestamp(const TestTimestamp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      repeated_value_(from.repeated_value_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_value()) {
+    value_ = new PROTOBUF_NAMESPACE_ID::Timestamp(*from.value_);
+  } else {
+    value_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto3.TestTimestamp)
+}
+
+void TestTimestamp::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestTimestamp_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  value_ = nullptr;
+}
+
+TestTimestamp::~TestTimestamp() {
+  // @@protoc_insertion_point(destructor:proto3.TestTimestamp)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestTimestamp::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete value_;
+}
+
+void TestTimestamp::ArenaDtor(void* object) {
+  TestTimestamp* _this = reinterpret_cast< TestTimestamp* >(object);
+  (void)_this;
+}
+void TestTimestamp::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestTimestamp::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestTimestamp& TestTimestamp::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestTimestamp_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestTimestamp::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestTimestamp)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_value_.Clear();
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestTimestamp::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Timestamp value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Timestamp repeated_value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          repeated_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<18>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_repeated_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestTimestamp::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestTimestamp)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Timestamp value = 1;
+  if (this->has_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::value(this), target, stream);
+  }
+
+  // repeated .google.protobuf.Timestamp repeated_value = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_repeated_value(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestTimestamp)
+  return target;
+}
+
+size_t TestTimestamp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestTimestamp)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Timestamp repeated_value = 2;
+  total_size += 1UL * this->_internal_repeated_value_size();
+  for (const auto& msg : this->repeated_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .google.protobuf.Timestamp value = 1;
+  if (this->has_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *value_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestTimestamp::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestTimestamp)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestTimestamp* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestTimestamp>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestTimestamp)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestTimestamp)
+    MergeFrom(*source);
+  }
+}
+
+void TestTimestamp::MergeFrom(const TestTimestamp& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestTimestamp)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_value_.MergeFrom(from.repeated_value_);
+  if (from.has_value()) {
+    _internal_mutable_value()->PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(from._internal_value());
+  }
+}
+
+void TestTimestamp::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestTimestamp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestTimestamp::CopyFrom(const TestTimestamp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestTimestamp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTimestamp::IsInitialized() const {
+  return true;
+}
+
+void TestTimestamp::InternalSwap(TestTimestamp* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  repeated_value_.InternalSwap(&other->repeated_value_);
+  swap(value_, other->value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestTimestamp::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TestDuration::InitAsDefaultInstance() {
+  ::proto3::_TestDuration_default_instance_._instance.get_mutable()->value_ = const_cast< PROTOBUF_NAMESPACE_ID::Duration*>(
+      PROTOBUF_NAMESPACE_ID::Duration::internal_default_instance());
+}
+class TestDuration::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Duration& value(const TestDuration* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Duration&
+TestDuration::_Internal::value(const TestDuration* msg) {
+  return *msg->value_;
+}
+void TestDuration::clear_value() {
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+}
+void TestDuration::clear_repeated_value() {
+  repeated_value_.Clear();
+}
+TestDuration::TestDuration(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  repeated_value_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestDuration)
+}
+TestDuration::TestDuration(const TestDuration& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      repeated_value_(from.repeated_value_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_value()) {
+    value_ = new PROTOBUF_NAMESPACE_ID::Duration(*from.value_);
+  } else {
+    value_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto3.TestDuration)
+}
+
+void TestDuration::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestDuration_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  value_ = nullptr;
+}
+
+TestDuration::~TestDuration() {
+  // @@protoc_insertion_point(destructor:proto3.TestDuration)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestDuration::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete value_;
+}
+
+void TestDuration::ArenaDtor(void* object) {
+  TestDuration* _this = reinterpret_cast< TestDuration* >(object);
+  (void)_this;
+}
+void TestDuration::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestDuration::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestDuration& TestDuration::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestDuration_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestDuration::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestDuration)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_value_.Clear();
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestDuration::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Duration value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Duration repeated_value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          repeated_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<18>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_repeated_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestDuration::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestDuration)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Duration value = 1;
+  if (this->has_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::value(this), target, stream);
+  }
+
+  // repeated .google.protobuf.Duration repeated_value = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_repeated_value(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestDuration)
+  return target;
+}
+
+size_t TestDuration::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestDuration)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Duration repeated_value = 2;
+  total_size += 1UL * this->_internal_repeated_value_size();
+  for (const auto& msg : this->repeated_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .google.protobuf.Duration value = 1;
+  if (this->has_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *value_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestDuration::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestDuration)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestDuration* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestDuration>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestDuration)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestDuration)
+    MergeFrom(*source);
+  }
+}
+
+void TestDuration::MergeFrom(const TestDuration& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestDuration)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_value_.MergeFrom(from.repeated_value_);
+  if (from.has_value()) {
+    _internal_mutable_value()->PROTOBUF_NAMESPACE_ID::Duration::MergeFrom(from._internal_value());
+  }
+}
+
+void TestDuration::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestDuration)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestDuration::CopyFrom(const TestDuration& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestDuration)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestDuration::IsInitialized() const {
+  return true;
+}
+
+void TestDuration::InternalSwap(TestDuration* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  repeated_value_.InternalSwap(&other->repeated_value_);
+  swap(value_, other->value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestDuration::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TestFieldMask::InitAsDefaultInstance() {
+  ::proto3::_TestFieldMask_default_instance_._instance.get_mutable()->value_ = const_cast< PROTOBUF_NAMESPACE_ID::FieldMask*>(
+      PROTOBUF_NAMESPACE_ID::FieldMask::internal_default_instance());
+}
+class TestFieldMask::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::FieldMask& value(const TestFieldMask* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::FieldMask&
+TestFieldMask::_Internal::value(const TestFieldMask* msg) {
+  return *msg->value_;
+}
+void TestFieldMask::clear_value() {
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+}
+TestFieldMask::TestFieldMask(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestFieldMask)
+}
+TestFieldMask::TestFieldMask(const TestFieldMask& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_value()) {
+    value_ = new PROTOBUF_NAMESPACE_ID::FieldMask(*from.value_);
+  } else {
+    value_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto3.TestFieldMask)
+}
+
+void TestFieldMask::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestFieldMask_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  value_ = nullptr;
+}
+
+TestFieldMask::~TestFieldMask() {
+  // @@protoc_insertion_point(destructor:proto3.TestFieldMask)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestFieldMask::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete value_;
+}
+
+void TestFieldMask::ArenaDtor(void* object) {
+  TestFieldMask* _this = reinterpret_cast< TestFieldMask* >(object);
+  (void)_this;
+}
+void TestFieldMask::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestFieldMask::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestFieldMask& TestFieldMask::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestFieldMask_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestFieldMask::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestFieldMask)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestFieldMask::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.FieldMask value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestFieldMask::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestFieldMask)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.FieldMask value = 1;
+  if (this->has_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::value(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestFieldMask)
+  return target;
+}
+
+size_t TestFieldMask::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestFieldMask)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.FieldMask value = 1;
+  if (this->has_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *value_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestFieldMask::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestFieldMask)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestFieldMask* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestFieldMask>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestFieldMask)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestFieldMask)
+    MergeFrom(*source);
+  }
+}
+
+void TestFieldMask::MergeFrom(const TestFieldMask& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestFieldMask)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_value()) {
+    _internal_mutable_value()->PROTOBUF_NAMESPACE_ID::FieldMask::MergeFrom(from._internal_value());
+  }
+}
+
+void TestFieldMask::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestFieldMask)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestFieldMask::CopyFrom(const TestFieldMask& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestFieldMask)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestFieldMask::IsInitialized() const {
+  return true;
+}
+
+void TestFieldMask::InternalSwap(TestFieldMask* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(value_, other->value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestFieldMask::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TestStruct::InitAsDefaultInstance() {
+  ::proto3::_TestStruct_default_instance_._instance.get_mutable()->value_ = const_cast< PROTOBUF_NAMESPACE_ID::Struct*>(
+      PROTOBUF_NAMESPACE_ID::Struct::internal_default_instance());
+}
+class TestStruct::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Struct& value(const TestStruct* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Struct&
+TestStruct::_Internal::value(const TestStruct* msg) {
+  return *msg->value_;
+}
+void TestStruct::clear_value() {
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+}
+void TestStruct::clear_repeated_value() {
+  repeated_value_.Clear();
+}
+TestStruct::TestStruct(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  repeated_value_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestStruct)
+}
+TestStruct::TestStruct(const TestStruct& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      repeated_value_(from.repeated_value_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_value()) {
+    value_ = new PROTOBUF_NAMESPACE_ID::Struct(*from.value_);
+  } else {
+    value_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto3.TestStruct)
+}
+
+void TestStruct::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  value_ = nullptr;
+}
+
+TestStruct::~TestStruct() {
+  // @@protoc_insertion_point(destructor:proto3.TestStruct)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestStruct::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete value_;
+}
+
+void TestStruct::ArenaDtor(void* object) {
+  TestStruct* _this = reinterpret_cast< TestStruct* >(object);
+  (void)_this;
+}
+void TestStruct::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestStruct::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestStruct& TestStruct::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestStruct_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestStruct::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestStruct)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_value_.Clear();
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestStruct::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Struct value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Struct repeated_value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          repeated_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<18>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_repeated_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestStruct::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestStruct)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Struct value = 1;
+  if (this->has_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::value(this), target, stream);
+  }
+
+  // repeated .google.protobuf.Struct repeated_value = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_repeated_value(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestStruct)
+  return target;
+}
+
+size_t TestStruct::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestStruct)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Struct repeated_value = 2;
+  total_size += 1UL * this->_internal_repeated_value_size();
+  for (const auto& msg : this->repeated_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .google.protobuf.Struct value = 1;
+  if (this->has_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *value_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestStruct::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestStruct)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestStruct* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestStruct>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestStruct)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestStruct)
+    MergeFrom(*source);
+  }
+}
+
+void TestStruct::MergeFrom(const TestStruct& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestStruct)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_value_.MergeFrom(from.repeated_value_);
+  if (from.has_value()) {
+    _internal_mutable_value()->PROTOBUF_NAMESPACE_ID::Struct::MergeFrom(from._internal_value());
+  }
+}
+
+void TestStruct::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestStruct)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestStruct::CopyFrom(const TestStruct& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestStruct)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestStruct::IsInitialized() const {
+  return true;
+}
+
+void TestStruct::InternalSwap(TestStruct* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  repeated_value_.InternalSwap(&other->repeated_value_);
+  swap(value_, other->value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestStruct::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TestAny::InitAsDefaultInstance() {
+  ::proto3::_TestAny_default_instance_._instance.get_mutable()->value_ = const_cast< PROTOBUF_NAMESPACE_ID::Any*>(
+      PROTOBUF_NAMESPACE_ID::Any::internal_default_instance());
+}
+class TestAny::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Any& value(const TestAny* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Any&
+TestAny::_Internal::value(const TestAny* msg) {
+  return *msg->value_;
+}
+void TestAny::clear_value() {
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+}
+void TestAny::clear_repeated_value() {
+  repeated_value_.Clear();
+}
+TestAny::TestAny(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  repeated_value_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestAny)
+}
+TestAny::TestAny(const TestAny& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      repeated_value_(from.repeated_value_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_value()) {
+    value_ = new PROTOBUF_NAMESPACE_ID::Any(*from.value_);
+  } else {
+    value_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto3.TestAny)
+}
+
+void TestAny::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestAny_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  value_ = nullptr;
+}
+
+TestAny::~TestAny() {
+  // @@protoc_insertion_point(destructor:proto3.TestAny)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestAny::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete value_;
+}
+
+void TestAny::ArenaDtor(void* object) {
+  TestAny* _this = reinterpret_cast< TestAny* >(object);
+  (void)_this;
+}
+void TestAny::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestAny::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestAny& TestAny::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestAny_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestAny::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestAny)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_value_.Clear();
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestAny::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Any value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Any repeated_value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          repeated_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<18>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_repeated_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestAny::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestAny)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Any value = 1;
+  if (this->has_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::value(this), target, stream);
+  }
+
+  // repeated .google.protobuf.Any repeated_value = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_repeated_value(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestAny)
+  return target;
+}
+
+size_t TestAny::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestAny)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Any repeated_value = 2;
+  total_size += 1UL * this->_internal_repeated_value_size();
+  for (const auto& msg : this->repeated_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .google.protobuf.Any value = 1;
+  if (this->has_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *value_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestAny::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestAny)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestAny* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestAny>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestAny)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestAny)
+    MergeFrom(*source);
+  }
+}
+
+void TestAny::MergeFrom(const TestAny& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestAny)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_value_.MergeFrom(from.repeated_value_);
+  if (from.has_value()) {
+    _internal_mutable_value()->PROTOBUF_NAMESPACE_ID::Any::MergeFrom(from._internal_value());
+  }
+}
+
+void TestAny::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestAny)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestAny::CopyFrom(const TestAny& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestAny)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestAny::IsInitialized() const {
+  return true;
+}
+
+void TestAny::InternalSwap(TestAny* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  repeated_value_.InternalSwap(&other->repeated_value_);
+  swap(value_, other->value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestAny::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TestValue::InitAsDefaultInstance() {
+  ::proto3::_TestValue_default_instance_._instance.get_mutable()->value_ = const_cast< PROTOBUF_NAMESPACE_ID::Value*>(
+      PROTOBUF_NAMESPACE_ID::Value::internal_default_instance());
+}
+class TestValue::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::Value& value(const TestValue* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::Value&
+TestValue::_Internal::value(const TestValue* msg) {
+  return *msg->value_;
+}
+void TestValue::clear_value() {
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+}
+void TestValue::clear_repeated_value() {
+  repeated_value_.Clear();
+}
+TestValue::TestValue(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  repeated_value_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestValue)
+}
+TestValue::TestValue(const TestValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      repeated_value_(from.repeated_value_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_value()) {
+    value_ = new PROTOBUF_NAMESPACE_ID::Value(*from.value_);
+  } else {
+    value_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto3.TestValue)
+}
+
+void TestValue::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  value_ = nullptr;
+}
+
+TestValue::~TestValue() {
+  // @@protoc_insertion_point(destructor:proto3.TestValue)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete value_;
+}
+
+void TestValue::ArenaDtor(void* object) {
+  TestValue* _this = reinterpret_cast< TestValue* >(object);
+  (void)_this;
+}
+void TestValue::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestValue::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestValue& TestValue::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestValue)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_value_.Clear();
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestValue::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.Value value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.Value repeated_value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          repeated_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<18>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_repeated_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestValue::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestValue)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Value value = 1;
+  if (this->has_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::value(this), target, stream);
+  }
+
+  // repeated .google.protobuf.Value repeated_value = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_repeated_value(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestValue)
+  return target;
+}
+
+size_t TestValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestValue)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.Value repeated_value = 2;
+  total_size += 1UL * this->_internal_repeated_value_size();
+  for (const auto& msg : this->repeated_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .google.protobuf.Value value = 1;
+  if (this->has_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *value_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestValue::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestValue)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestValue* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestValue>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestValue)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestValue)
+    MergeFrom(*source);
+  }
+}
+
+void TestValue::MergeFrom(const TestValue& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestValue)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_value_.MergeFrom(from.repeated_value_);
+  if (from.has_value()) {
+    _internal_mutable_value()->PROTOBUF_NAMESPACE_ID::Value::MergeFrom(from._internal_value());
+  }
+}
+
+void TestValue::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestValue::CopyFrom(const TestValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestValue::IsInitialized() const {
+  return true;
+}
+
+void TestValue::InternalSwap(TestValue* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  repeated_value_.InternalSwap(&other->repeated_value_);
+  swap(value_, other->value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestValue::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TestListValue::InitAsDefaultInstance() {
+  ::proto3::_TestListValue_default_instance_._instance.get_mutable()->value_ = const_cast< PROTOBUF_NAMESPACE_ID::ListValue*>(
+      PROTOBUF_NAMESPACE_ID::ListValue::internal_default_instance());
+}
+class TestListValue::_Internal {
+ public:
+  static const PROTOBUF_NAMESPACE_ID::ListValue& value(const TestListValue* msg);
+};
+
+const PROTOBUF_NAMESPACE_ID::ListValue&
+TestListValue::_Internal::value(const TestListValue* msg) {
+  return *msg->value_;
+}
+void TestListValue::clear_value() {
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+}
+void TestListValue::clear_repeated_value() {
+  repeated_value_.Clear();
+}
+TestListValue::TestListValue(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  repeated_value_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestListValue)
+}
+TestListValue::TestListValue(const TestListValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      repeated_value_(from.repeated_value_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_value()) {
+    value_ = new PROTOBUF_NAMESPACE_ID::ListValue(*from.value_);
+  } else {
+    value_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto3.TestListValue)
+}
+
+void TestListValue::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestListValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  value_ = nullptr;
+}
+
+TestListValue::~TestListValue() {
+  // @@protoc_insertion_point(destructor:proto3.TestListValue)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestListValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete value_;
+}
+
+void TestListValue::ArenaDtor(void* object) {
+  TestListValue* _this = reinterpret_cast< TestListValue* >(object);
+  (void)_this;
+}
+void TestListValue::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestListValue::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestListValue& TestListValue::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestListValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestListValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestListValue)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  repeated_value_.Clear();
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
+  }
+  value_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestListValue::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .google.protobuf.ListValue value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .google.protobuf.ListValue repeated_value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          repeated_value_.ReserveAndConstruct(
+              ctx->CountLengthDelimited<18>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_repeated_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestListValue::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestListValue)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.ListValue value = 1;
+  if (this->has_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::value(this), target, stream);
+  }
+
+  // repeated .google.protobuf.ListValue repeated_value = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_repeated_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_repeated_value(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestListValue)
+  return target;
+}
+
+size_t TestListValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestListValue)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .google.protobuf.ListValue repeated_value = 2;
+  total_size += 1UL * this->_internal_repeated_value_size();
+  for (const auto& msg : this->repeated_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .google.protobuf.ListValue value = 1;
+  if (this->has_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *value_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestListValue::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestListValue)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestListValue* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestListValue>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestListValue)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestListValue)
+    MergeFrom(*source);
+  }
+}
+
+void TestListValue::MergeFrom(const TestListValue& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestListValue)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_value_.MergeFrom(from.repeated_value_);
+  if (from.has_value()) {
+    _internal_mutable_value()->PROTOBUF_NAMESPACE_ID::ListValue::MergeFrom(from._internal_value());
+  }
+}
+
+void TestListValue::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestListValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestListValue::CopyFrom(const TestListValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestListValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestListValue::IsInitialized() const {
+  return true;
+}
+
+void TestListValue::InternalSwap(TestListValue* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  repeated_value_.InternalSwap(&other->repeated_value_);
+  swap(value_, other->value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestListValue::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+TestBoolValue_BoolMapEntry_DoNotUse::TestBoolValue_BoolMapEntry_DoNotUse() {}
+TestBoolValue_BoolMapEntry_DoNotUse::TestBoolValue_BoolMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TestBoolValue_BoolMapEntry_DoNotUse::MergeFrom(const TestBoolValue_BoolMapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TestBoolValue_BoolMapEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void TestBoolValue_BoolMapEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+void TestBoolValue::InitAsDefaultInstance() {
+}
+class TestBoolValue::_Internal {
+ public:
+};
+
+TestBoolValue::TestBoolValue(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  bool_map_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestBoolValue)
+}
+TestBoolValue::TestBoolValue(const TestBoolValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  bool_map_.MergeFrom(from.bool_map_);
+  bool_value_ = from.bool_value_;
+  // @@protoc_insertion_point(copy_constructor:proto3.TestBoolValue)
+}
+
+void TestBoolValue::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestBoolValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  bool_value_ = false;
+}
+
+TestBoolValue::~TestBoolValue() {
+  // @@protoc_insertion_point(destructor:proto3.TestBoolValue)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestBoolValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestBoolValue::ArenaDtor(void* object) {
+  TestBoolValue* _this = reinterpret_cast< TestBoolValue* >(object);
+  (void)_this;
+}
+void TestBoolValue::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestBoolValue::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestBoolValue& TestBoolValue::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestBoolValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestBoolValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestBoolValue)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  bool_map_.Clear();
+  bool_value_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestBoolValue::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // bool bool_value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          bool_value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // map<bool, int32> bool_map = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          ::PROTOBUF_NAMESPACE_ID::internal::ReserveMapEntries(&bool_map_,
+              ctx->CountLengthDelimited<18>(ptr));
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&bool_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestBoolValue::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestBoolValue)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool bool_value = 1;
+  if (this->bool_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(1, this->_internal_bool_value(), target);
+  }
+
+  // map<bool, int32> bool_map = 2;
+  if (!this->_internal_bool_map().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< bool, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_bool_map().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_bool_map().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_bool_map().begin();
+          it != this->_internal_bool_map().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = TestBoolValue_BoolMapEntry_DoNotUse::Funcs::InternalSerialize(2, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+          it = this->_internal_bool_map().begin();
+          it != this->_internal_bool_map().end(); ++it) {
+        target = TestBoolValue_BoolMapEntry_DoNotUse::Funcs::InternalSerialize(2, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestBoolValue)
+  return target;
+}
+
+size_t TestBoolValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestBoolValue)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<bool, int32> bool_map = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_bool_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< bool, ::PROTOBUF_NAMESPACE_ID::int32 >::const_iterator
+      it = this->_internal_bool_map().begin();
+      it != this->_internal_bool_map().end(); ++it) {
+    total_size += TestBoolValue_BoolMapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // bool bool_value = 1;
+  if (this->bool_value() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestBoolValue::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestBoolValue)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestBoolValue* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestBoolValue>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestBoolValue)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestBoolValue)
+    MergeFrom(*source);
+  }
+}
+
+void TestBoolValue::MergeFrom(const TestBoolValue& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestBoolValue)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  bool_map_.MergeFrom(from.bool_map_);
+  if (from.bool_value() != 0) {
+    _internal_set_bool_value(from._internal_bool_value());
+  }
+}
+
+void TestBoolValue::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestBoolValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestBoolValue::CopyFrom(const TestBoolValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestBoolValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestBoolValue::IsInitialized() const {
+  return true;
+}
+
+void TestBoolValue::InternalSwap(TestBoolValue* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  bool_map_.Swap(&other->bool_map_);
+  swap(bool_value_, other->bool_value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestBoolValue::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TestCustomJsonName::InitAsDefaultInstance() {
+}
+class TestCustomJsonName::_Internal {
+ public:
+};
+
+TestCustomJsonName::TestCustomJsonName(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestCustomJsonName)
+}
+TestCustomJsonName::TestCustomJsonName(const TestCustomJsonName& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  value_ = from.value_;
+  // @@protoc_insertion_point(copy_constructor:proto3.TestCustomJsonName)
+}
+
+void TestCustomJsonName::SharedCtor() {
+  value_ = 0;
+}
+
+TestCustomJsonName::~TestCustomJsonName() {
+  // @@protoc_insertion_point(destructor:proto3.TestCustomJsonName)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestCustomJsonName::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestCustomJsonName::ArenaDtor(void* object) {
+  TestCustomJsonName* _this = reinterpret_cast< TestCustomJsonName* >(object);
+  (void)_this;
+}
+void TestCustomJsonName::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestCustomJsonName::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestCustomJsonName& TestCustomJsonName::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestCustomJsonName_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestCustomJsonName::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestCustomJsonName)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  value_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestCustomJsonName::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // int32 value = 1[json_name = "@value"];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestCustomJsonName::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestCustomJsonName)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 value = 1[json_name = "@value"];
+  if (this->value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestCustomJsonName)
+  return target;
+}
+
+size_t TestCustomJsonName::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestCustomJsonName)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 value = 1[json_name = "@value"];
+  if (this->value() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_value());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestCustomJsonName::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestCustomJsonName)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestCustomJsonName* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestCustomJsonName>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestCustomJsonName)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestCustomJsonName)
+    MergeFrom(*source);
+  }
+}
+
+void TestCustomJsonName::MergeFrom(const TestCustomJsonName& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestCustomJsonName)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.value() != 0) {
+    _internal_set_value(from._internal_value());
+  }
+}
+
+void TestCustomJsonName::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestCustomJsonName)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestCustomJsonName::CopyFrom(const TestCustomJsonName& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestCustomJsonName)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestCustomJsonName::IsInitialized() const {
+  return true;
+}
+
+void TestCustomJsonName::InternalSwap(TestCustomJsonName* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(value_, other->value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestCustomJsonName::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TestExtensions::InitAsDefaultInstance() {
+  ::proto3::_TestExtensions_default_instance_._instance.get_mutable()->extensions_ = const_cast< ::protobuf_unittest::TestAllExtensions*>(
+      ::protobuf_unittest::TestAllExtensions::internal_default_instance());
+}
+class TestExtensions::_Internal {
+ public:
+  static const ::protobuf_unittest::TestAllExtensions& extensions(const TestExtensions* msg);
+};
+
+const ::protobuf_unittest::TestAllExtensions&
+TestExtensions::_Internal::extensions(const TestExtensions* msg) {
+  return *msg->extensions_;
+}
+void TestExtensions::clear_extensions() {
+  if (GetArena() == nullptr && extensions_ != nullptr) {
+    delete extensions_;
+  }
+  extensions_ = nullptr;
+}
+TestExtensions::TestExtensions(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestExtensions)
+}
+TestExtensions::TestExtensions(const TestExtensions& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_extensions()) {
+    extensions_ = new ::protobuf_unittest::TestAllExtensions(*from.extensions_);
+  } else {
+    extensions_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:proto3.TestExtensions)
+}
+
+void TestExtensions::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TestExtensions_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  extensions_ = nullptr;
+}
+
+TestExtensions::~TestExtensions() {
+  // @@protoc_insertion_point(destructor:proto3.TestExtensions)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestExtensions::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete extensions_;
+}
+
+void TestExtensions::ArenaDtor(void* object) {
+  TestExtensions* _this = reinterpret_cast< TestExtensions* >(object);
+  (void)_this;
+}
+void TestExtensions::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestExtensions::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestExtensions& TestExtensions::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestExtensions_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestExtensions::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestExtensions)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && extensions_ != nullptr) {
+    delete extensions_;
+  }
+  extensions_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestExtensions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .protobuf_unittest.TestAllExtensions extensions = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_extensions(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestExtensions::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestExtensions)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .protobuf_unittest.TestAllExtensions extensions = 1;
+  if (this->has_extensions()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::extensions(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestExtensions)
+  return target;
+}
+
+size_t TestExtensions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestExtensions)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .protobuf_unittest.TestAllExtensions extensions = 1;
+  if (this->has_extensions()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *extensions_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestExtensions::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestExtensions)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestExtensions* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestExtensions>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestExtensions)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestExtensions)
+    MergeFrom(*source);
+  }
+}
+
+void TestExtensions::MergeFrom(const TestExtensions& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestExtensions)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_extensions()) {
+    _internal_mutable_extensions()->::protobuf_unittest::TestAllExtensions::MergeFrom(from._internal_extensions());
+  }
+}
+
+void TestExtensions::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestExtensions)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestExtensions::CopyFrom(const TestExtensions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestExtensions)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestExtensions::IsInitialized() const {
+  if (_internal_has_extensions()) {
+    if (!extensions_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void TestExtensions::InternalSwap(TestExtensions* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(extensions_, other->extensions_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestExtensions::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TestEnumValue::InitAsDefaultInstance() {
+}
+class TestEnumValue::_Internal {
+ public:
+};
+
+TestEnumValue::TestEnumValue(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:proto3.TestEnumValue)
+}
+TestEnumValue::TestEnumValue(const TestEnumValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&enum_value1_, &from.enum_value1_,
+    static_cast<size_t>(reinterpret_cast<char*>(&enum_value3_) -
+    reinterpret_cast<char*>(&enum_value1_)) + sizeof(enum_value3_));
+  // @@protoc_insertion_point(copy_constructor:proto3.TestEnumValue)
+}
+
+void TestEnumValue::SharedCtor() {
+  ::memset(&enum_value1_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&enum_value3_) -
+      reinterpret_cast<char*>(&enum_value1_)) + sizeof(enum_value3_));
+}
+
+TestEnumValue::~TestEnumValue() {
+  // @@protoc_insertion_point(destructor:proto3.TestEnumValue)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TestEnumValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TestEnumValue::ArenaDtor(void* object) {
+  TestEnumValue* _this = reinterpret_cast< TestEnumValue* >(object);
+  (void)_this;
+}
+void TestEnumValue::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TestEnumValue::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TestEnumValue& TestEnumValue::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TestEnumValue_google_2fprotobuf_2futil_2fjson_5fformat_5fproto3_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TestEnumValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto3.TestEnumValue)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&enum_value1_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&enum_value3_) -
+      reinterpret_cast<char*>(&enum_value1_)) + sizeof(enum_value3_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestEnumValue::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .proto3.EnumType enum_value1 = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_enum_value1(static_cast<::proto3::EnumType>(val));
+        } else goto handle_unusual;
+        continue;
+      // .proto3.EnumType enum_value2 = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_enum_value2(static_cast<::proto3::EnumType>(val));
+        } else goto handle_unusual;
+        continue;
+      // .proto3.EnumType enum_value3 = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_enum_value3(static_cast<::proto3::EnumType>(val));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TestEnumValue::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto3.TestEnumValue)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .proto3.EnumType enum_value1 = 1;
+  if (this->enum_value1() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_enum_value1(), target);
+  }
+
+  // .proto3.EnumType enum_value2 = 2;
+  if (this->enum_value2() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_enum_value2(), target);
+  }
+
+  // .proto3.EnumType enum_value3 = 3;
+  if (this->enum_value3() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_enum_value3(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto3.TestEnumValue)
+  return target;
+}
+
+size_t TestEnumValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto3.TestEnumValue)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .proto3.EnumType enum_value1 = 1;
+  if (this->enum_value1() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_enum_value1());
+  }
+
+  // .proto3.EnumType enum_value2 = 2;
+  if (this->enum_value2() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_enum_value2());
+  }
+
+  // .proto3.EnumType enum_value3 = 3;
+  if (this->enum_value3() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_enum_value3());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TestEnumValue::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:proto3.TestEnumValue)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TestEnumValue* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TestEnumValue>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto3.TestEnumValue)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto3.TestEnumValue)
+    MergeFrom(*source);
+  }
+}
+
+void TestEnumValue::MergeFrom(const TestEnumValue& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto3.TestEnumValue)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.enum_value1() != 0) {
+    _internal_set_enum_value1(from._internal_enum_value1());
+  }
+  if (from.enum_value2() != 0) {
+    _internal_set_enum_value2(from._internal_enum_value2());
+  }
+  if (from.enum_value3() != 0) {
+    _internal_set_enum_value3(from._internal_enum_value3());
+  }
+}
+
+void TestEnumValue::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:proto3.TestEnumValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TestEnumValue::CopyFrom(const TestEnumValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto3.TestEnumValue)
+  if (&from == this) return;
+  Clear();
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&enum_value1_, &from.enum_value1_,
+    static_cast<size_t>(reinterpret_cast<char*>(&enum_value3_) -
+    reinterpret_cast<char*>(&enum_value1_)) + sizeof(enum_value3_));
+}
+
+bool TestEnumValue::IsInitialized() const {
+  return true;
+}
+
+void TestEnumValue::InternalSwap(TestEnumValue* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestEnumValue, enum_value3_)
+      + sizeof(TestEnumValue::enum_value3_)
+      - PROTOBUF_FIELD_OFFSET(TestEnumValue, enum_value1_)>(
+          reinterpret_cast<char*>(&enum_value1_),
+          reinterpret_cast<char*>(&other->enum_value1_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestEnumValue::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto3
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::proto3::MessageType* Arena::CreateMaybeMessage< ::proto3::MessageType >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::MessageType >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestMessage* Arena::CreateMaybeMessage< ::proto3::TestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestOneof* Arena::CreateMaybeMessage< ::proto3::TestOneof >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestOneof >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestMap_BoolMapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto3::TestMap_BoolMapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestMap_BoolMapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestMap_Int32MapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto3::TestMap_Int32MapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestMap_Int32MapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestMap_Int64MapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto3::TestMap_Int64MapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestMap_Int64MapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestMap_Uint32MapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto3::TestMap_Uint32MapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestMap_Uint32MapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestMap_Uint64MapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto3::TestMap_Uint64MapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestMap_Uint64MapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestMap_StringMapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto3::TestMap_StringMapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestMap_StringMapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestMap* Arena::CreateMaybeMessage< ::proto3::TestMap >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestMap >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestNestedMap_BoolMapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto3::TestNestedMap_BoolMapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestNestedMap_BoolMapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestNestedMap_Int32MapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto3::TestNestedMap_Int32MapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestNestedMap_Int32MapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestNestedMap_Int64MapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto3::TestNestedMap_Int64MapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestNestedMap_Int64MapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestNestedMap_Uint32MapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto3::TestNestedMap_Uint32MapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestNestedMap_Uint32MapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestNestedMap_Uint64MapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto3::TestNestedMap_Uint64MapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestNestedMap_Uint64MapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestNestedMap_StringMapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto3::TestNestedMap_StringMapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestNestedMap_StringMapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestNestedMap_MapMapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto3::TestNestedMap_MapMapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestNestedMap_MapMapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestNestedMap* Arena::CreateMaybeMessage< ::proto3::TestNestedMap >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestNestedMap >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestStringMap_StringMapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto3::TestStringMap_StringMapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestStringMap_StringMapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestStringMap* Arena::CreateMaybeMessage< ::proto3::TestStringMap >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestStringMap >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestWrapper* Arena::CreateMaybeMessage< ::proto3::TestWrapper >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestWrapper >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestTimestamp* Arena::CreateMaybeMessage< ::proto3::TestTimestamp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestTimestamp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestDuration* Arena::CreateMaybeMessage< ::proto3::TestDuration >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestDuration >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestFieldMask* Arena::CreateMaybeMessage< ::proto3::TestFieldMask >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestFieldMask >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestStruct* Arena::CreateMaybeMessage< ::proto3::TestStruct >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestStruct >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestAny* Arena::CreateMaybeMessage< ::proto3::TestAny >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestAny >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestValue* Arena::CreateMaybeMessage< ::proto3::TestValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestValue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestListValue* Arena::CreateMaybeMessage< ::proto3::TestListValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestListValue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestBoolValue_BoolMapEntry_DoNotUse* Arena::CreateMaybeMessage< ::proto3::TestBoolValue_BoolMapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestBoolValue_BoolMapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestBoolValue* Arena::CreateMaybeMessage< ::proto3::TestBoolValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestBoolValue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestCustomJsonName* Arena::CreateMaybeMessage< ::proto3::TestCustomJsonName >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestCustomJsonName >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestExtensions* Arena::CreateMaybeMessage< ::proto3::TestExtensions >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestExtensions >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto3::TestEnumValue* Arena::CreateMaybeMessage< ::proto3::TestEnumValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto3::TestEnumValue >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -47,6 +47,8 @@
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/field_access_plan.h>
+#include <google/protobuf/map_field.h>
 #include <google/protobuf/text_format.h>
 #include <google/protobuf/util/field_comparator.h>
 #include <google/protobuf/stubs/strutil.h>
@@ -605,10 +607,10 @@ FieldDescriptorArray MessageDifferencer::RetrieveFields(const Message& message,
   tmp_message_fields_.clear();
   tmp_message_fields_.reserve(descriptor->field_count() + 1);
 
-  const Reflection* reflection = message.GetReflection();
+  const FieldAccessPlan* plan = message.GetReflection()->GetFieldAccessPlan();
   if (descriptor->options().map_entry()) {
     if (this->scope_ == PARTIAL && base_message) {
-      reflection->ListFields(message, &tmp_message_fields_);
+      plan->ListFields(message, &tmp_message_fields_);
     } else {
       // Map entry fields are always considered present.
       for (int i = 0; i < descriptor->field_count(); i++) {
@@ -616,7 +618,7 @@ FieldDescriptorArray MessageDifferencer::RetrieveFields(const Message& message,
       }
     }
   } else {
-    reflection->ListFields(message, &tmp_message_fields_);
+    plan->ListFields(message, &tmp_message_fields_);
   }
   // Add sentinel values to deal with the
   // case where the number of the fields in
@@ -916,10 +918,104 @@ bool MessageDifferencer::IsMatch(
   return match;
 }
 
+bool MessageDifferencer::CanCompareMapFieldByMapReflection(
+    const Message& message1, const Message& message2,
+    const FieldDescriptor* field,
+    const std::vector<SpecificField>& parent_fields) {
+  if (!field->is_map() || reporter_ != NULL || field_comparator_ != NULL) {
+    return false;
+  }
+  // A custom key comparator may match entries differently than by key.
+  if (GetMapKeyComparator(field) != &map_entry_key_comparator_) return false;
+  // Ignore criteria need the entry messages, which only exist in the repeated
+  // representation.
+  if (!ignore_criteria_.empty()) return false;
+  const FieldDescriptor* key_field = field->message_type()->map_key();
+  const FieldDescriptor* value_field = field->message_type()->map_value();
+  if (ignored_fields_.find(key_field) != ignored_fields_.end() ||
+      ignored_fields_.find(value_field) != ignored_fields_.end()) {
+    return false;
+  }
+  // Only use the map representation if it is already up to date on both
+  // sides; otherwise reading it would force a sync.
+  return message1.GetReflection()->GetMapData(message1, field)->IsMapValid() &&
+         message2.GetReflection()->GetMapData(message2, field)->IsMapValid();
+}
+
+bool MessageDifferencer::CompareMapFieldByMapReflection(
+    const Message& message1, const Message& message2,
+    const FieldDescriptor* map_field,
+    std::vector<SpecificField>* parent_fields) {
+  const Reflection* reflection1 = message1.GetReflection();
+  const Reflection* reflection2 = message2.GetReflection();
+  const int count1 = reflection1->MapSize(message1, map_field);
+  const int count2 = reflection2->MapSize(message2, map_field);
+  const bool treated_as_subset = IsTreatedAsSubset(map_field);
+  if (count1 != count2 && !treated_as_subset) return false;
+  if (count1 > count2) return false;
+
+  const FieldDescriptor* value_field = map_field->message_type()->map_value();
+  // MapBegin() only needs a mutable message to build the iterator; iterating
+  // does not modify message1.
+  Message* mutable_message1 = const_cast<Message*>(&message1);
+  MapIterator end = reflection1->MapEnd(mutable_message1, map_field);
+  int index = 0;
+  for (MapIterator it = reflection1->MapBegin(mutable_message1, map_field);
+       it != end; ++it, ++index) {
+    MapValueRef value2;
+    if (!reflection2->LookupMapValue(message2, map_field, it.GetKey(),
+                                     &value2)) {
+      return false;
+    }
+    const MapValueRef& value1 = it.GetValueRef();
+    bool same;
+    switch (value_field->cpp_type()) {
+#define COMPARE_MAP_VALUE(CPPTYPE, METHOD, COMPARE_METHOD)            \
+  case FieldDescriptor::CPPTYPE_##CPPTYPE:                            \
+    same = default_field_comparator_.COMPARE_METHOD(                  \
+        *value_field, value1.Get##METHOD##Value(),                    \
+        value2.Get##METHOD##Value());                                 \
+    break;
+      COMPARE_MAP_VALUE(INT32, Int32, CompareInt32)
+      COMPARE_MAP_VALUE(INT64, Int64, CompareInt64)
+      COMPARE_MAP_VALUE(UINT32, UInt32, CompareUInt32)
+      COMPARE_MAP_VALUE(UINT64, UInt64, CompareUInt64)
+      COMPARE_MAP_VALUE(DOUBLE, Double, CompareDouble)
+      COMPARE_MAP_VALUE(FLOAT, Float, CompareFloat)
+      COMPARE_MAP_VALUE(BOOL, Bool, CompareBool)
+      COMPARE_MAP_VALUE(STRING, String, CompareString)
+      COMPARE_MAP_VALUE(ENUM, Enum, CompareInt32)
+#undef COMPARE_MAP_VALUE
+      case FieldDescriptor::CPPTYPE_MESSAGE: {
+        SpecificField specific_field;
+        specific_field.field = map_field;
+        specific_field.index = index;
+        parent_fields->push_back(specific_field);
+        specific_field = SpecificField();
+        specific_field.field = value_field;
+        parent_fields->push_back(specific_field);
+        same = Compare(value1.GetMessageValue(), value2.GetMessageValue(),
+                       parent_fields);
+        parent_fields->pop_back();
+        parent_fields->pop_back();
+        break;
+      }
+    }
+    if (!same) return false;
+  }
+  return true;
+}
+
 bool MessageDifferencer::CompareRepeatedField(
     const Message& message1, const Message& message2,
     const FieldDescriptor* repeated_field,
     std::vector<SpecificField>* parent_fields) {
+  if (CanCompareMapFieldByMapReflection(message1, message2, repeated_field,
+                                        *parent_fields)) {
+    return CompareMapFieldByMapReflection(message1, message2, repeated_field,
+                                          parent_fields);
+  }
+
   // the input FieldDescriptor is guaranteed to be repeated field.
   const Reflection* reflection1 = message1.GetReflection();
   const Reflection* reflection2 = message2.GetReflection();
@@ -767,6 +767,21 @@ class PROTOBUF_EXPORT MessageDifferencer {
                             const FieldDescriptor* field,
                             std::vector<SpecificField>* parent_fields);
 
+  // Returns true if the map field can be compared by looking entries up in
+  // the map representation directly instead of matching repeated entries.
+  // This avoids syncing both maps to their repeated fields.
+  bool CanCompareMapFieldByMapReflection(
+      const Message& message1, const Message& message2,
+      const FieldDescriptor* field,
+      const std::vector<SpecificField>& parent_fields);
+
+  // Compares two map fields key by key. Only valid if
+  // CanCompareMapFieldByMapReflection() returned true.
+  bool CompareMapFieldByMapReflection(const Message& message1,
+                                      const Message& message2,
+                                      const FieldDescriptor* field,
+                                      std::vector<SpecificField>* parent_fields);
+
   // Shorthand for CompareFieldValueUsingParentFields with NULL parent_fields.
   bool CompareFieldValue(const Message& message1, const Message& message2,
                          const FieldDescriptor* field, int index1, int index2);
@@ -48,6 +48,7 @@
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/field_access_plan.h>
 #include <google/protobuf/map_field.h>
 #include <google/protobuf/map_field_inl.h>
 #include <google/protobuf/message.h>
@@ -795,25 +796,32 @@ const char* WireFormat::_InternalParse(Message* msg, const char* ptr,
       ctx->SetLastTag(tag);
       break;
     }
-    const FieldDescriptor* field = nullptr;
+    ptr = _InternalParseField(msg, ptr, ctx, tag);
+    if (PROTOBUF_PREDICT_FALSE(ptr == nullptr)) return nullptr;
+  }
+  return ptr;
+}
 
-    int field_number = WireFormatLite::GetTagFieldNumber(tag);
-    field = descriptor->FindFieldByNumber(field_number);
+const char* WireFormat::_InternalParseField(Message* msg, const char* ptr,
+                                            internal::ParseContext* ctx,
+                                            uint32 tag) {
+  const Descriptor* descriptor = msg->GetDescriptor();
+  const Reflection* reflection = msg->GetReflection();
+  const FieldDescriptor* field = nullptr;
 
-    // If that failed, check if the field is an extension.
-    if (field == nullptr && descriptor->IsExtensionNumber(field_number)) {
-      if (ctx->data().pool == nullptr) {
-        field = reflection->FindKnownExtensionByNumber(field_number);
-      } else {
-        field =
-            ctx->data().pool->FindExtensionByNumber(descriptor, field_number);
-      }
-    }
+  int field_number = WireFormatLite::GetTagFieldNumber(tag);
+  field = descriptor->FindFieldByNumber(field_number);
 
-    ptr = _InternalParseAndMergeField(msg, ptr, ctx, tag, reflection, field);
-    if (PROTOBUF_PREDICT_FALSE(ptr == nullptr)) return nullptr;
+  // If that failed, check if the field is an extension.
+  if (field == nullptr && descriptor->IsExtensionNumber(field_number)) {
+    if (ctx->data().pool == nullptr) {
+      field = reflection->FindKnownExtensionByNumber(field_number);
+    } else {
+      field = ctx->data().pool->FindExtensionByNumber(descriptor, field_number);
+    }
   }
-  return ptr;
+
+  return _InternalParseAndMergeField(msg, ptr, ctx, tag, reflection, field);
 }
 
 const char* WireFormat::_InternalParseAndMergeField(
@@ -1045,7 +1053,7 @@ uint8* WireFormat::_InternalSerialize(const Message& message, uint8* target,
       fields.push_back(descriptor->field(i));
     }
   } else {
-    message_reflection->ListFields(message, &fields);
+    message_reflection->GetFieldAccessPlan()->ListFields(message, &fields);
   }
 
   for (auto field : fields) {
@@ -1459,7 +1467,7 @@ size_t WireFormat::ByteSize(const Message& message) {
       fields.push_back(descriptor->field(i));
     }
   } else {
-    message_reflection->ListFields(message, &fields);
+    message_reflection->GetFieldAccessPlan()->ListFields(message, &fields);
   }
 
   for (int i = 0; i < fields.size(); i++) {
@@ -114,6 +114,14 @@ class PROTOBUF_EXPORT WireFormat {
   static const char* _InternalParse(Message* msg, const char* ptr,
                                     internal::ParseContext* ctx);
 
+  // This is meant for internal protobuf use (WireFormat is an internal class).
+  // Parses a single field whose tag has already been read, exactly as
+  // _InternalParse() would.  Parsers that handle the common field types
+  // themselves use this for everything else.
+  static const char* _InternalParseField(Message* msg, const char* ptr,
+                                         internal::ParseContext* ctx,
+                                         uint32 tag);
+
   // Serialize a message in protocol buffer wire format.
   //
   // Any embedded messages within the message must have their correct sizes